@@ -0,0 +1,184 @@
+#pragma once
+
+/// @file userver/storages/clickhouse/buffered_inserter.hpp
+/// @brief @copybrief storages::clickhouse::BufferedInserter
+
+#include <chrono>
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <tuple>
+#include <type_traits>
+#include <vector>
+
+#include <boost/pfr/core.hpp>
+
+#include <userver/storages/clickhouse/fwd.hpp>
+#include <userver/storages/clickhouse/impl/insertion_request.hpp>
+#include <userver/storages/clickhouse/options.hpp>
+#include <userver/utils/statistics/writer.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace storages::clickhouse {
+
+struct BufferedInserterSettings final {
+  /// Table to insert into
+  std::string table_name;
+  /// Names of the table columns, in the order of the row fields
+  std::vector<std::string> column_names;
+
+  /// Buffered rows are flushed once there are that many of them
+  std::size_t max_rows{100'000};
+  /// Buffered rows are flushed once their estimated size reaches that value
+  std::size_t max_bytes{64 * 1024 * 1024};
+  /// Buffered rows are flushed at least that often
+  std::chrono::milliseconds flush_interval{1000};
+
+  /// Number of INSERTs executed concurrently on different connections.
+  /// Adding rows waits while that many flushes are in progress
+  std::size_t max_parallel_flushes{2};
+  /// Number of retries of a failed INSERT, the rows are dropped afterwards
+  std::size_t flush_retries{2};
+  /// Delay between the retries of an INSERT
+  std::chrono::milliseconds retry_delay{100};
+  /// Timeouts of each INSERT
+  OptionalCommandControl command_control;
+};
+
+namespace impl {
+
+class InsertBuffer {
+ public:
+  virtual ~InsertBuffer() = default;
+
+  virtual std::unique_ptr<InsertBuffer> MakeEmpty() const = 0;
+
+  virtual InsertionRequest MakeRequest(
+      const std::string& table_name,
+      const std::vector<std::string_view>& column_names) const = 0;
+
+  std::size_t rows{0};
+  std::size_t bytes{0};
+};
+
+class BufferedInserterImpl;
+
+class BufferedInserterBase {
+ public:
+  BufferedInserterBase(ClusterPtr cluster, BufferedInserterSettings settings,
+                       std::unique_ptr<InsertBuffer> empty_buffer);
+  ~BufferedInserterBase();
+
+  void Add(const std::function<void(InsertBuffer&)>& append);
+
+  void Flush();
+
+  void WriteStatistics(
+      USERVER_NAMESPACE::utils::statistics::Writer& writer) const;
+
+ private:
+  std::unique_ptr<BufferedInserterImpl> impl_;
+};
+
+template <typename T>
+std::size_t EstimateFieldSize(const T& field) {
+  if constexpr (std::is_same_v<T, std::string>) {
+    return field.size();
+  } else if constexpr (std::is_same_v<T, std::optional<std::string>>) {
+    return field ? field->size() : 0;
+  } else {
+    return sizeof(T);
+  }
+}
+
+template <typename MappedType>
+struct ColumnsBuffer;
+
+template <typename... Columns>
+struct ColumnsBuffer<std::tuple<Columns...>> {
+  using type = std::tuple<typename Columns::container_type...>;
+};
+
+template <typename Row>
+class RowsInsertBuffer final : public InsertBuffer {
+ public:
+  using MappedType = typename io::CppToClickhouse<Row>::mapped_type;
+
+  std::unique_ptr<InsertBuffer> MakeEmpty() const override {
+    return std::make_unique<RowsInsertBuffer>();
+  }
+
+  InsertionRequest MakeRequest(
+      const std::string& table_name,
+      const std::vector<std::string_view>& column_names) const override {
+    return InsertionRequest::CreateFromColumns<Row>(table_name, column_names,
+                                                    columns_);
+  }
+
+  void Append(Row&& row) {
+    boost::pfr::for_each_field(row, [this](auto& field, auto index) {
+      bytes += EstimateFieldSize(field);
+      std::get<decltype(index)::value>(columns_).push_back(std::move(field));
+    });
+    ++rows;
+  }
+
+ private:
+  typename ColumnsBuffer<MappedType>::type columns_;
+};
+
+}  // namespace impl
+
+/// @brief Collects rows added by many tasks into columnar buffers and
+/// inserts them into a table in big blocks.
+///
+/// Rows are flushed by a background task once the buffer reaches
+/// `max_rows` or `max_bytes`, or `flush_interval` after the previous flush.
+/// Up to `max_parallel_flushes` INSERTs are executed concurrently on
+/// different connections of the cluster, and failed INSERTs are retried. The
+/// remaining rows are flushed on destruction.
+///
+/// Rows are compressed on the wire according to the `compression` option of
+/// components::ClickHouse.
+///
+/// `Row` is expected to be a clickhouse-mapped type, see @ref clickhouse_io.
+///
+/// @note Must be destroyed before the cluster component is.
+template <typename Row>
+class BufferedInserter final {
+ public:
+  BufferedInserter(ClusterPtr cluster, BufferedInserterSettings settings)
+      : base_(std::move(cluster), std::move(settings),
+              std::make_unique<impl::RowsInsertBuffer<Row>>()) {
+    io::impl::ValidateRowsMapping<Row>();
+  }
+
+  /// @brief Adds a row to the buffer.
+  /// @note Waits if the buffer is full and `max_parallel_flushes` flushes are
+  /// already in progress.
+  void Add(Row row) {
+    base_.Add([&row](impl::InsertBuffer& buffer) {
+      static_cast<impl::RowsInsertBuffer<Row>&>(buffer).Append(std::move(row));
+    });
+  }
+
+  /// Starts a flush of the buffered rows without waiting for thresholds
+  void Flush() { base_.Flush(); }
+
+  /// Writes statistics of rows and flushes
+  void WriteStatistics(
+      USERVER_NAMESPACE::utils::statistics::Writer& writer) const {
+    base_.WriteStatistics(writer);
+  }
+
+ private:
+  impl::BufferedInserterBase base_;
+};
+
+}  // namespace storages::clickhouse
+
+USERVER_NAMESPACE_END
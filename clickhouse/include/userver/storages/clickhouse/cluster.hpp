@@ -11,6 +11,7 @@
 #include <userver/clients/dns/resolver_fwd.hpp>
 #include <userver/components/component_fwd.hpp>
 
+#include <userver/storages/clickhouse/execution_result.hpp>
 #include <userver/storages/clickhouse/fwd.hpp>
 #include <userver/storages/clickhouse/impl/insertion_request.hpp>
 #include <userver/storages/clickhouse/impl/pool.hpp>
@@ -22,10 +23,9 @@ USERVER_NAMESPACE_BEGIN
 
 namespace storages::clickhouse {
 
-class ExecutionResult;
-
 namespace impl {
 struct ClickhouseSettings;
+class BufferedInserterImpl;
 }
 
 /// @ingroup userver_clients
@@ -60,6 +60,29 @@ class Cluster final {
   ExecutionResult Execute(OptionalCommandControl, const Query& query,
                           const Args&... args) const;
 
+  /// @brief Execute a statement at some host of the cluster
+  /// with args as query parameters and pass each block of the result to
+  /// `callback` as soon as it arrives.
+  ///
+  /// Only one block is kept in memory at a time: the next block is not read
+  /// from the connection until the callback returns, so a slow callback
+  /// throttles the server. Map blocks with ExecutionResult::As or
+  /// ExecutionResult::AsRows. If the callback throws, the query is aborted
+  /// and the exception is rethrown.
+  /// @note The command control timeout limits the whole execution, including
+  /// the time spent in the callback.
+  template <typename... Args>
+  void ExecuteStreaming(const BlockCallback& callback, const Query& query,
+                        const Args&... args) const;
+
+  /// @brief Execute a statement with specified command control settings
+  /// at some host of the cluster with args as query parameters and pass each
+  /// block of the result to `callback` as soon as it arrives.
+  /// @see ExecuteStreaming
+  template <typename... Args>
+  void ExecuteStreaming(OptionalCommandControl, const BlockCallback& callback,
+                        const Query& query, const Args&... args) const;
+
   /// @brief Insert data at some host of the cluster;
   /// `T` is expected to be a struct of vectors of same length.
   /// @param table_name table to insert into
@@ -126,11 +149,16 @@ class Cluster final {
   };
 
  private:
+  friend class impl::BufferedInserterImpl;
+
   void DoInsert(OptionalCommandControl,
                 const impl::InsertionRequest& request) const;
 
   ExecutionResult DoExecute(OptionalCommandControl, const Query& query) const;
 
+  void DoExecuteStreaming(OptionalCommandControl, const BlockCallback& callback,
+                          const Query& query) const;
+
   const impl::Pool& GetPool() const;
 
   std::vector<impl::Pool> pools_;
@@ -189,6 +217,20 @@ ExecutionResult Cluster::Execute(OptionalCommandControl optional_cc,
   return DoExecute(optional_cc, formatted_query);
 }
 
+template <typename... Args>
+void Cluster::ExecuteStreaming(const BlockCallback& callback,
+                               const Query& query, const Args&... args) const {
+  ExecuteStreaming(OptionalCommandControl{}, callback, query, args...);
+}
+
+template <typename... Args>
+void Cluster::ExecuteStreaming(OptionalCommandControl optional_cc,
+                               const BlockCallback& callback,
+                               const Query& query, const Args&... args) const {
+  const auto formatted_query = query.WithArgs(args...);
+  DoExecuteStreaming(optional_cc, callback, formatted_query);
+}
+
 }  // namespace storages::clickhouse
 
 USERVER_NAMESPACE_END
@@ -3,8 +3,10 @@
 /// @file userver/storages/clickhouse/execution_result.hpp
 /// @brief Result accessor.
 
+#include <functional>
 #include <memory>
 #include <type_traits>
+#include <utility>
 
 #include <boost/pfr/core.hpp>
 
@@ -29,6 +31,9 @@ namespace storages::clickhouse {
 /// @snippet storages/tests/execute_chtest.cpp  Sample ExecutionResult usage
 
 // clang-format on
+template <typename T>
+class ResultView;
+
 class ExecutionResult final {
  public:
   explicit ExecutionResult(impl::BlockWrapperPtr);
@@ -46,6 +51,13 @@ class ExecutionResult final {
   template <typename T>
   T As() &&;
 
+  /// Converts underlying block to strongly-typed struct of vectors, keeping
+  /// the block alive. Unlike `As`, allows the columns that point into the
+  /// block memory instead of copying the values, e.g.
+  /// storages::clickhouse::io::columns::StringViewColumn.
+  template <typename T>
+  ResultView<T> AsView() &&;
+
   /// Converts underlying block to iterable of strongly-typed struct.
   /// See @ref clickhouse_io for better understanding of `T`'s requirements.
   template <typename T>
@@ -58,11 +70,50 @@ class ExecutionResult final {
   Container AsContainer() &&;
 
  private:
+  template <typename T>
+  T MapColumns();
+
   impl::BlockWrapperPtr block_;
 };
 
+/// @brief Strongly-typed struct of vectors `T` along with the block of data
+/// its values may point into, see ExecutionResult::AsView.
+template <typename T>
+class ResultView final {
+ public:
+  ResultView(ResultView&&) noexcept = default;
+  ResultView& operator=(ResultView&&) noexcept = default;
+
+  const T& operator*() const noexcept { return value_; }
+  const T* operator->() const noexcept { return &value_; }
+
+ private:
+  friend class ExecutionResult;
+
+  ResultView(impl::BlockWrapperPtr&& block, T&& value)
+      : block_{std::move(block)}, value_{std::move(value)} {}
+
+  impl::BlockWrapperPtr block_;
+  T value_;
+};
+
+/// Callback that is invoked with each block of a streamed result, see
+/// storages::clickhouse::Cluster::ExecuteStreaming
+using BlockCallback = std::function<void(ExecutionResult&&)>;
+
 template <typename T>
 T ExecutionResult::As() && {
+  return MapColumns<T>();
+}
+
+template <typename T>
+ResultView<T> ExecutionResult::AsView() && {
+  auto value = MapColumns<T>();
+  return ResultView<T>{std::move(block_), std::move(value)};
+}
+
+template <typename T>
+T ExecutionResult::MapColumns() {
   UASSERT(block_);
   T result{};
   io::impl::ValidateColumnsMapping(result);
@@ -3,6 +3,8 @@
 #include <memory>
 #include <string>
 #include <string_view>
+#include <tuple>
+#include <utility>
 #include <vector>
 
 #include <userver/utils/assert.hpp>
@@ -36,6 +38,14 @@ class InsertionRequest final {
       const std::string& table_name,
       const std::vector<std::string_view>& column_names, const Container& data);
 
+  /// `Columns` is a tuple of `container_type`s of the columns `Row` is
+  /// mapped to
+  template <typename Row, typename Columns>
+  static InsertionRequest CreateFromColumns(
+      const std::string& table_name,
+      const std::vector<std::string_view>& column_names,
+      const Columns& columns);
+
   const std::string& GetTableName() const;
 
   const impl::BlockWrapper& GetBlock() const;
@@ -92,6 +102,19 @@ class InsertionRequest final {
     const Container& data_;
   };
 
+  template <typename MappedType, typename Columns, size_t... Indices>
+  static void AppendColumns(impl::BlockWrapper& block,
+                            const std::vector<std::string_view>& column_names,
+                            const Columns& columns,
+                            std::index_sequence<Indices...>) {
+    (io::columns::AppendWrappedColumn(
+         block,
+         std::tuple_element_t<Indices, MappedType>::Serialize(
+             std::get<Indices>(columns)),
+         column_names[Indices], Indices),
+     ...);
+  }
+
   const std::string& table_name_;
   const std::vector<std::string_view>& column_names_;
 
@@ -136,6 +159,22 @@ InsertionRequest InsertionRequest::CreateFromRows(
   return request;
 }
 
+template <typename Row, typename Columns>
+InsertionRequest InsertionRequest::CreateFromColumns(
+    const std::string& table_name,
+    const std::vector<std::string_view>& column_names, const Columns& columns) {
+  io::impl::ValidateRowsMapping<Row>();
+  // TODO : static_assert this when std::span comes
+  io::impl::ValidateColumnsCount<Row>(column_names.size());
+
+  InsertionRequest request{table_name, column_names};
+  using MappedType = typename io::CppToClickhouse<Row>::mapped_type;
+  AppendColumns<MappedType>(
+      *request.block_, request.column_names_, columns,
+      std::make_index_sequence<std::tuple_size_v<MappedType>>{});
+  return request;
+}
+
 }  // namespace storages::clickhouse::impl
 
 USERVER_NAMESPACE_END
@@ -22,6 +22,10 @@ namespace storages::clickhouse::io::columns {
 /// - `static ColumnRef Serialize(const container_type&)` - constructs a column from C++ container,
 /// - `cpp_type ColumnIterator<YourColumnType>::DataHolder::Get()`
 ///
+/// Optionally a column may implement `void AppendTo(container_type&) const`
+/// that appends all the column values at once, it is used instead of the
+/// per-value iteration when mapping a block into a struct of vectors.
+///
 /// see implementation of any of the existing columns for better understanding.
 // clang-format on
 template <typename ColumnType>
@@ -37,6 +41,9 @@ class ClickhouseColumn {
 
   size_t Size() const { return GetColumnSize(column_); }
 
+ protected:
+  const ColumnRef& GetColumn() const { return column_; }
+
  private:
   ColumnRef column_;
 };
@@ -11,6 +11,7 @@
 #include <userver/storages/clickhouse/io/columns/int64_column.hpp>
 #include <userver/storages/clickhouse/io/columns/int8_column.hpp>
 #include <userver/storages/clickhouse/io/columns/string_column.hpp>
+#include <userver/storages/clickhouse/io/columns/string_view_column.hpp>
 #include <userver/storages/clickhouse/io/columns/uint16_column.hpp>
 #include <userver/storages/clickhouse/io/columns/uint32_column.hpp>
 #include <userver/storages/clickhouse/io/columns/uint64_column.hpp>
@@ -19,6 +19,8 @@ class Float32Column final : public ClickhouseColumn<Float32Column> {
   Float32Column(ColumnRef column);
 
   static ColumnRef Serialize(const container_type& from);
+
+  void AppendTo(container_type& to) const;
 };
 
 }  // namespace storages::clickhouse::io::columns
@@ -19,6 +19,8 @@ class Float64Column final : public ClickhouseColumn<Float64Column> {
   Float64Column(ColumnRef column);
 
   static ColumnRef Serialize(const container_type& from);
+
+  void AppendTo(container_type& to) const;
 };
 
 }  // namespace storages::clickhouse::io::columns
@@ -19,6 +19,8 @@ class Int32Column final : public ClickhouseColumn<Int32Column> {
   Int32Column(ColumnRef column);
 
   static ColumnRef Serialize(const container_type& from);
+
+  void AppendTo(container_type& to) const;
 };
 
 }  // namespace storages::clickhouse::io::columns
@@ -19,6 +19,8 @@ class Int64Column final : public ClickhouseColumn<Int64Column> {
   Int64Column(ColumnRef column);
 
   static ColumnRef Serialize(const container_type& from);
+
+  void AppendTo(container_type& to) const;
 };
 
 }  // namespace storages::clickhouse::io::columns
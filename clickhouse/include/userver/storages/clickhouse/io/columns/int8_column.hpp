@@ -19,6 +19,8 @@ class Int8Column final : public ClickhouseColumn<Int8Column> {
   Int8Column(ColumnRef column);
 
   static ColumnRef Serialize(const container_type& from);
+
+  void AppendTo(container_type& to) const;
 };
 
 }  // namespace storages::clickhouse::io::columns
@@ -0,0 +1,34 @@
+#pragma once
+
+/// @file userver/storages/clickhouse/io/columns/string_view_column.hpp
+/// @brief String column support without copying the values
+/// @ingroup userver_clickhouse_types
+
+#include <string_view>
+
+#include <userver/storages/clickhouse/io/columns/column_includes.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace storages::clickhouse::io::columns {
+
+/// @brief Represents ClickHouse String column as `std::string_view`s pointing
+/// into the memory of the received block.
+///
+/// @warning The values are valid only while the block is alive, so the column
+/// may only be used with storages::clickhouse::ExecutionResult::AsView
+class StringViewColumn final : public ClickhouseColumn<StringViewColumn> {
+ public:
+  using cpp_type = std::string_view;
+  using container_type = std::vector<cpp_type>;
+
+  StringViewColumn(ColumnRef column);
+
+  static ColumnRef Serialize(const container_type& from);
+
+  void AppendTo(container_type& to) const;
+};
+
+}  // namespace storages::clickhouse::io::columns
+
+USERVER_NAMESPACE_END
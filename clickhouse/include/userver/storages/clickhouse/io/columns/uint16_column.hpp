@@ -19,6 +19,8 @@ class UInt16Column final : public ClickhouseColumn<UInt16Column> {
   UInt16Column(ColumnRef column);
 
   static ColumnRef Serialize(const container_type& from);
+
+  void AppendTo(container_type& to) const;
 };
 
 }  // namespace storages::clickhouse::io::columns
@@ -19,6 +19,8 @@ class UInt32Column final : public ClickhouseColumn<UInt32Column> {
   UInt32Column(ColumnRef column);
 
   static ColumnRef Serialize(const container_type& from);
+
+  void AppendTo(container_type& to) const;
 };
 
 }  // namespace storages::clickhouse::io::columns
@@ -19,6 +19,8 @@ class UInt64Column final : public ClickhouseColumn<UInt64Column> {
   UInt64Column(ColumnRef column);
 
   static ColumnRef Serialize(const container_type& from);
+
+  void AppendTo(container_type& to) const;
 };
 
 }  // namespace storages::clickhouse::io::columns
@@ -19,6 +19,8 @@ class UInt8Column final : public ClickhouseColumn<UInt8Column> {
   UInt8Column(ColumnRef column);
 
   static ColumnRef Serialize(const container_type& from);
+
+  void AppendTo(container_type& to) const;
 };
 
 }  // namespace storages::clickhouse::io::columns
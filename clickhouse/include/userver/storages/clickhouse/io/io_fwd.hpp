@@ -29,6 +29,7 @@ namespace storages::clickhouse::io {
 /// - UInt32 @ref storages::clickhouse::io::columns::UInt32Column
 /// - UInt64 @ref storages::clickhouse::io::columns::UInt64Column
 /// - String @ref storages::clickhouse::io::columns::StringColumn
+/// - String @ref storages::clickhouse::io::columns::StringViewColumn (no copy, see storages::clickhouse::ExecutionResult::AsView)
 /// - UUID @ref storages::clickhouse::io::columns::UuidColumn
 /// - Nullable @ref storages::clickhouse::io::columns::NullableColumn
 /// - Float32 @ref storages::clickhouse::io::columns::Float32Column
@@ -8,6 +8,8 @@
 
 #include <boost/pfr/core.hpp>
 
+#include <userver/utils/meta_light.hpp>
+
 #include <userver/storages/clickhouse/impl/block_wrapper_fwd.hpp>
 #include <userver/storages/clickhouse/impl/iterators_helper.hpp>
 #include <userver/storages/clickhouse/io/columns/column_wrapper.hpp>
@@ -32,10 +34,22 @@ class ColumnsMapper final {
 
     auto column = ColumnType{io::columns::GetWrappedColumn(block_, i)};
     field.reserve(column.Size());
-    for (auto& it : column) field.push_back(std::move(it));
+    if constexpr (kHasAppendTo<ColumnType>) {
+      column.AppendTo(field);
+    } else {
+      for (auto& it : column) field.push_back(std::move(it));
+    }
   }
 
  private:
+  template <typename ColumnType>
+  using AppendToResult = decltype(std::declval<const ColumnType&>().AppendTo(
+      std::declval<typename ColumnType::container_type&>()));
+
+  template <typename ColumnType>
+  static constexpr bool kHasAppendTo =
+      meta::kIsDetected<AppendToResult, ColumnType>;
+
   clickhouse::impl::BlockWrapper& block_;
 };
 
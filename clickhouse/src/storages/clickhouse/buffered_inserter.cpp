@@ -0,0 +1,189 @@
+#include <userver/storages/clickhouse/buffered_inserter.hpp>
+
+#include <algorithm>
+#include <mutex>
+#include <utility>
+
+#include <userver/concurrent/background_task_storage.hpp>
+#include <userver/engine/mutex.hpp>
+#include <userver/engine/semaphore.hpp>
+#include <userver/engine/sleep.hpp>
+#include <userver/engine/task/cancel.hpp>
+#include <userver/logging/log.hpp>
+#include <userver/storages/clickhouse/cluster.hpp>
+#include <userver/utils/assert.hpp>
+#include <userver/utils/periodic_task.hpp>
+
+#include <storages/clickhouse/stats/pool_statistics.hpp>
+#include <storages/clickhouse/stats/statement_timer.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace storages::clickhouse::impl {
+
+namespace {
+
+std::vector<std::string_view> MakeColumnNames(
+    const std::vector<std::string>& column_names) {
+  return {column_names.begin(), column_names.end()};
+}
+
+}  // namespace
+
+class BufferedInserterImpl final {
+ public:
+  BufferedInserterImpl(ClusterPtr cluster, BufferedInserterSettings settings,
+                       std::unique_ptr<InsertBuffer> empty_buffer);
+  ~BufferedInserterImpl();
+
+  void Add(const std::function<void(InsertBuffer&)>& append);
+
+  void Flush();
+
+  void WriteStatistics(
+      USERVER_NAMESPACE::utils::statistics::Writer& writer) const;
+
+ private:
+  std::unique_ptr<InsertBuffer> ExtractBuffer();
+  void StartFlush(std::unique_ptr<InsertBuffer> buffer);
+  void DoFlush(const InsertBuffer& buffer);
+
+  const ClusterPtr cluster_;
+  const BufferedInserterSettings settings_;
+  const std::vector<std::string_view> column_names_;
+
+  engine::Mutex mutex_;
+  std::unique_ptr<InsertBuffer> buffer_;
+
+  stats::PoolQueryStatistics flushes_;
+  stats::Counter rows_inserted_;
+  stats::Counter rows_dropped_;
+
+  engine::Semaphore flushes_semaphore_;
+  concurrent::BackgroundTaskStorage flush_tasks_;
+  USERVER_NAMESPACE::utils::PeriodicTask periodic_flush_;
+};
+
+BufferedInserterImpl::BufferedInserterImpl(
+    ClusterPtr cluster, BufferedInserterSettings settings,
+    std::unique_ptr<InsertBuffer> empty_buffer)
+    : cluster_(std::move(cluster)),
+      settings_(std::move(settings)),
+      column_names_(MakeColumnNames(settings_.column_names)),
+      buffer_(std::move(empty_buffer)),
+      flushes_semaphore_(
+          std::max<std::size_t>(settings_.max_parallel_flushes, 1)) {
+  UINVARIANT(cluster_, "ClickHouse cluster is required for buffered inserts");
+  UINVARIANT(settings_.max_rows > 0, "max_rows must be positive");
+
+  periodic_flush_.Start("clickhouse-buffered-inserter-" + settings_.table_name,
+                        settings_.flush_interval, [this] { Flush(); });
+}
+
+BufferedInserterImpl::~BufferedInserterImpl() {
+  periodic_flush_.Stop();
+  Flush();
+
+  // Waits for all the flushes in progress
+  const auto max_flushes =
+      std::max<std::size_t>(settings_.max_parallel_flushes, 1);
+  flushes_semaphore_.lock_shared_count(max_flushes);
+  flushes_semaphore_.unlock_shared_count(max_flushes);
+  flush_tasks_.CancelAndWait();
+}
+
+void BufferedInserterImpl::Add(
+    const std::function<void(InsertBuffer&)>& append) {
+  std::unique_ptr<InsertBuffer> full_buffer;
+  {
+    const std::lock_guard lock{mutex_};
+    append(*buffer_);
+    if (buffer_->rows >= settings_.max_rows ||
+        buffer_->bytes >= settings_.max_bytes) {
+      full_buffer = ExtractBuffer();
+    }
+  }
+  if (full_buffer) StartFlush(std::move(full_buffer));
+}
+
+void BufferedInserterImpl::Flush() {
+  std::unique_ptr<InsertBuffer> buffer;
+  {
+    const std::lock_guard lock{mutex_};
+    if (buffer_->rows == 0) return;
+    buffer = ExtractBuffer();
+  }
+  StartFlush(std::move(buffer));
+}
+
+void BufferedInserterImpl::WriteStatistics(
+    USERVER_NAMESPACE::utils::statistics::Writer& writer) const {
+  writer["flushes"] = flushes_;
+  writer["rows"]["inserted"] = rows_inserted_;
+  writer["rows"]["dropped"] = rows_dropped_;
+}
+
+std::unique_ptr<InsertBuffer> BufferedInserterImpl::ExtractBuffer() {
+  auto empty_buffer = buffer_->MakeEmpty();
+  return std::exchange(buffer_, std::move(empty_buffer));
+}
+
+void BufferedInserterImpl::StartFlush(std::unique_ptr<InsertBuffer> buffer) {
+  // Backpressure: do not buffer more rows until a flush slot is free
+  engine::SemaphoreLock lock{flushes_semaphore_};
+  flush_tasks_.AsyncDetach(
+      "clickhouse-buffered-insert",
+      [this, lock = std::move(lock), buffer = std::move(buffer)] {
+        DoFlush(*buffer);
+      });
+}
+
+void BufferedInserterImpl::DoFlush(const InsertBuffer& buffer) {
+  const auto request = buffer.MakeRequest(settings_.table_name, column_names_);
+
+  for (std::size_t attempt = 0;; ++attempt) {
+    try {
+      {
+        const stats::StatementTimer timer{flushes_};
+        cluster_->DoInsert(settings_.command_control, request);
+      }
+      rows_inserted_ += buffer.rows;
+      return;
+    } catch (const std::exception& e) {
+      if (attempt >= settings_.flush_retries ||
+          engine::current_task::ShouldCancel()) {
+        LOG_ERROR() << "Failed to insert " << buffer.rows << " rows into '"
+                    << settings_.table_name << "', dropping them: " << e;
+        rows_dropped_ += buffer.rows;
+        return;
+      }
+      LOG_WARNING() << "Failed to insert " << buffer.rows << " rows into '"
+                    << settings_.table_name << "', retrying: " << e;
+    }
+    engine::InterruptibleSleepFor(settings_.retry_delay);
+  }
+}
+
+BufferedInserterBase::BufferedInserterBase(
+    ClusterPtr cluster, BufferedInserterSettings settings,
+    std::unique_ptr<InsertBuffer> empty_buffer)
+    : impl_(std::make_unique<BufferedInserterImpl>(
+          std::move(cluster), std::move(settings), std::move(empty_buffer))) {}
+
+BufferedInserterBase::~BufferedInserterBase() = default;
+
+void BufferedInserterBase::Add(
+    const std::function<void(InsertBuffer&)>& append) {
+  impl_->Add(append);
+}
+
+void BufferedInserterBase::Flush() { impl_->Flush(); }
+
+void BufferedInserterBase::WriteStatistics(
+    USERVER_NAMESPACE::utils::statistics::Writer& writer) const {
+  impl_->WriteStatistics(writer);
+}
+
+}  // namespace storages::clickhouse::impl
+
+USERVER_NAMESPACE_END
@@ -104,6 +104,23 @@ ExecutionResult Connection::Execute(OptionalCommandControl optional_cc,
   return ExecutionResult{BlockWrapperPtr{result_ptr.release()}};
 }
 
+void Connection::ExecuteStreaming(OptionalCommandControl optional_cc,
+                                  const BlockCallback& callback,
+                                  const Query& query) {
+  clickhouse_cpp::Query native_query{query.QueryText()};
+  native_query.OnDataCancelable([&callback](const NativeBlock& data) {
+    // The first block only describes the columns
+    if (data.GetRowCount() != 0) {
+      auto block = std::make_unique<BlockWrapper>(NativeBlock{data});
+      callback(ExecutionResult{BlockWrapperPtr{block.release()}});
+    }
+    // we must return 'true' if we don't want to cancel query
+    return !engine::current_task::ShouldCancel();
+  });
+
+  DoExecute(optional_cc, native_query);
+}
+
 void Connection::Insert(OptionalCommandControl optional_cc,
                         const InsertionRequest& request) {
   const auto& block = request.GetBlock();
@@ -28,6 +28,9 @@ class Connection final {
 
   ExecutionResult Execute(OptionalCommandControl, const Query&);
 
+  void ExecuteStreaming(OptionalCommandControl, const BlockCallback&,
+                        const Query&);
+
   void Insert(OptionalCommandControl, const InsertionRequest&);
 
   void Ping();
@@ -23,6 +23,10 @@ ColumnRef Float32Column::Serialize(const container_type& from) {
   return impl::NumericColumn<Float32Column>::Serialize(from);
 }
 
+void Float32Column::AppendTo(container_type& to) const {
+  impl::NumericColumn<Float32Column>::AppendTo(GetColumn(), to);
+}
+
 }  // namespace storages::clickhouse::io::columns
 
 USERVER_NAMESPACE_END
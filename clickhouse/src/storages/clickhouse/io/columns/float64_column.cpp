@@ -23,6 +23,10 @@ ColumnRef Float64Column::Serialize(const container_type& from) {
   return impl::NumericColumn<Float64Column>::Serialize(from);
 }
 
+void Float64Column::AppendTo(container_type& to) const {
+  impl::NumericColumn<Float64Column>::AppendTo(GetColumn(), to);
+}
+
 }  // namespace storages::clickhouse::io::columns
 
 USERVER_NAMESPACE_END
@@ -23,6 +23,18 @@ struct NumericColumn final {
     return std::make_shared<
         clickhouse::impl::clickhouse_cpp::ColumnVector<value_type>>(from);
   }
+
+  static void AppendTo(
+      const clickhouse::impl::clickhouse_cpp::ColumnRef& column,
+      container_type& to) {
+    using NativeType =
+        clickhouse::impl::clickhouse_cpp::ColumnVector<value_type>;
+    UASSERT(column->As<NativeType>() != nullptr);
+
+    // ColumnVector keeps the values contiguously, so it is a single memcpy
+    const auto& data = static_cast<NativeType&>(*column).GetWritableData();
+    to.insert(to.end(), data.begin(), data.end());
+  }
 };
 
 }  // namespace storages::clickhouse::io::columns::impl
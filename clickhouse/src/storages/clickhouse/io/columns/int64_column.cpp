@@ -22,6 +22,10 @@ ColumnRef Int64Column::Serialize(const container_type& from) {
   return impl::NumericColumn<Int64Column>::Serialize(from);
 }
 
+void Int64Column::AppendTo(container_type& to) const {
+  impl::NumericColumn<Int64Column>::AppendTo(GetColumn(), to);
+}
+
 }  // namespace storages::clickhouse::io::columns
 
 USERVER_NAMESPACE_END
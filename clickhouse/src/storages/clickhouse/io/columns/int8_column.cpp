@@ -22,6 +22,10 @@ ColumnRef Int8Column::Serialize(const container_type& from) {
   return impl::NumericColumn<Int8Column>::Serialize(from);
 }
 
+void Int8Column::AppendTo(container_type& to) const {
+  impl::NumericColumn<Int8Column>::AppendTo(GetColumn(), to);
+}
+
 }  // namespace storages::clickhouse::io::columns
 
 USERVER_NAMESPACE_END
@@ -0,0 +1,46 @@
+#include <userver/storages/clickhouse/io/columns/string_view_column.hpp>
+
+#include <storages/clickhouse/io/columns/impl/column_includes.hpp>
+
+#include <clickhouse/columns/string.h>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace storages::clickhouse::io::columns {
+
+namespace {
+using NativeType = clickhouse::impl::clickhouse_cpp::ColumnString;
+}
+
+StringViewColumn::StringViewColumn(ColumnRef column)
+    : ClickhouseColumn{
+          impl::GetTypedColumn<StringViewColumn, NativeType>(column)} {}
+
+template <>
+StringViewColumn::cpp_type
+ColumnIterator<StringViewColumn>::DataHolder::Get() const {
+  return impl::NativeGetAt<NativeType>(column_, ind_);
+}
+
+ColumnRef StringViewColumn::Serialize(const container_type& from) {
+  auto column = std::make_shared<NativeType>();
+  for (const auto value : from) {
+    column->Append(value);
+  }
+  return column;
+}
+
+void StringViewColumn::AppendTo(container_type& to) const {
+  const auto& column = GetColumn();
+  UASSERT(column->As<NativeType>() != nullptr);
+  const auto& native = static_cast<const NativeType&>(*column);
+
+  const auto size = native.Size();
+  for (std::size_t i = 0; i < size; ++i) {
+    to.push_back(native.At(i));
+  }
+}
+
+}  // namespace storages::clickhouse::io::columns
+
+USERVER_NAMESPACE_END
@@ -23,6 +23,10 @@ ColumnRef UInt64Column::Serialize(const container_type& from) {
   return impl::NumericColumn<UInt64Column>::Serialize(from);
 }
 
+void UInt64Column::AppendTo(container_type& to) const {
+  impl::NumericColumn<UInt64Column>::AppendTo(GetColumn(), to);
+}
+
 }  // namespace storages::clickhouse::io::columns
 
 USERVER_NAMESPACE_END
@@ -22,6 +22,10 @@ ColumnRef UInt8Column::Serialize(const container_type& from) {
   return impl::NumericColumn<UInt8Column>::Serialize(from);
 }
 
+void UInt8Column::AppendTo(container_type& to) const {
+  impl::NumericColumn<UInt8Column>::AppendTo(GetColumn(), to);
+}
+
 }  // namespace storages::clickhouse::io::columns
 
 USERVER_NAMESPACE_END
@@ -0,0 +1,83 @@
+#include <userver/utest/utest.hpp>
+
+#include <vector>
+
+#include <userver/engine/async.hpp>
+#include <userver/engine/task/task_with_result.hpp>
+#include <userver/storages/clickhouse/buffered_inserter.hpp>
+#include <userver/storages/clickhouse/cluster.hpp>
+
+#include "utils_test.hpp"
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+struct BufferedRow final {
+  uint64_t id{};
+  std::string value;
+};
+
+struct BufferedData final {
+  std::vector<uint64_t> ids;
+  std::vector<std::string> values;
+};
+
+}  // namespace
+
+namespace storages::clickhouse::io {
+
+template <>
+struct CppToClickhouse<BufferedRow> {
+  using mapped_type = std::tuple<columns::UInt64Column, columns::StringColumn>;
+};
+
+template <>
+struct CppToClickhouse<BufferedData> {
+  using mapped_type = std::tuple<columns::UInt64Column, columns::StringColumn>;
+};
+
+}  // namespace storages::clickhouse::io
+
+UTEST_MT(BufferedInserter, Works, 4) {
+  ClusterWrapper cluster{};
+  cluster->Execute("DROP TABLE IF EXISTS buffered_table");
+  cluster->Execute(
+      "CREATE TABLE buffered_table (id UInt64, value String) "
+      "ENGINE = Memory");
+
+  constexpr std::size_t kTasksCount = 4;
+  constexpr std::size_t kRowsPerTask = 100;
+  {
+    storages::clickhouse::BufferedInserterSettings settings;
+    settings.table_name = "buffered_table";
+    settings.column_names = {"id", "value"};
+    settings.max_rows = 30;
+    settings.flush_interval = std::chrono::milliseconds{50};
+    // Not owned, the inserter is destroyed first
+    storages::clickhouse::ClusterPtr cluster_ptr{&*cluster, [](auto*) {}};
+    storages::clickhouse::BufferedInserter<BufferedRow> inserter{
+        cluster_ptr, std::move(settings)};
+
+    std::vector<engine::TaskWithResult<void>> tasks;
+    for (std::size_t i = 0; i < kTasksCount; ++i) {
+      tasks.push_back(engine::AsyncNoSpan([&inserter, i] {
+        for (std::size_t j = 0; j < kRowsPerTask; ++j) {
+          inserter.Add({i * kRowsPerTask + j, std::to_string(j)});
+        }
+      }));
+    }
+    for (auto& task : tasks) task.Get();
+  }
+
+  const auto result =
+      cluster->Execute("SELECT id, value FROM buffered_table ORDER BY id")
+          .As<BufferedData>();
+  ASSERT_EQ(result.ids.size(), kTasksCount * kRowsPerTask);
+  EXPECT_EQ(result.ids[kRowsPerTask + 7], kRowsPerTask + 7);
+  EXPECT_EQ(result.values[kRowsPerTask + 7], "7");
+
+  cluster->Execute("DROP TABLE buffered_table");
+}
+
+USERVER_NAMESPACE_END
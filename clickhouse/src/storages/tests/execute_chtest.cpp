@@ -31,6 +31,11 @@ struct RowData final {
   std::chrono::system_clock::time_point tp;
 };
 
+struct DataView final {
+  std::vector<uint64_t> numbers;
+  std::vector<std::string_view> strings;
+};
+
 }  // namespace
 
 namespace storages::clickhouse::io {
@@ -49,6 +54,12 @@ struct CppToClickhouse<RowData> final {
                  columns::UInt64Column, columns::DateTime64ColumnNano>;
 };
 
+template <>
+struct CppToClickhouse<DataView> final {
+  using mapped_type =
+      std::tuple<columns::UInt64Column, columns::StringViewColumn>;
+};
+
 }  // namespace storages::clickhouse::io
 /// [Sample CppToClickhouse specialization]
 
@@ -75,6 +86,47 @@ UTEST(Execute, MappingWorks) {
   EXPECT_EQ(sum, 10000 * (10000 - 1) / 2);
 }
 
+UTEST(Execute, AsView) {
+  ClusterWrapper cluster{};
+
+  const auto view = cluster
+                        ->Execute(storages::clickhouse::Query{
+                            "SELECT c.number, toString(c.number) "
+                            "FROM numbers(0, 10000) c"})
+                        .AsView<DataView>();
+
+  ASSERT_EQ(view->numbers.size(), 10000);
+  ASSERT_EQ(view->strings.size(), 10000);
+  EXPECT_EQ(view->numbers[5001], 5001);
+  EXPECT_EQ(view->strings[5001], "5001");
+}
+
+UTEST(Execute, Streaming) {
+  ClusterWrapper cluster{};
+
+  std::size_t blocks_count = 0;
+  std::vector<uint64_t> numbers;
+  cluster->ExecuteStreaming(
+      [&](storages::clickhouse::ExecutionResult&& block) {
+        ++blocks_count;
+        const auto data = std::move(block).As<Data>();
+        numbers.insert(numbers.end(), data.numbers.begin(), data.numbers.end());
+      },
+      common_query);
+
+  EXPECT_GE(blocks_count, 1);
+  ASSERT_EQ(numbers.size(), 10000);
+  EXPECT_EQ(numbers[5001], 5001);
+
+  UEXPECT_THROW(cluster->ExecuteStreaming(
+                    [](storages::clickhouse::ExecutionResult&&) {
+                      throw std::runtime_error{"stop"};
+                    },
+                    common_query),
+                std::runtime_error);
+  EXPECT_EQ(cluster->Execute(common_query).GetRowsCount(), 10000);
+}
+
 namespace {
 namespace io = storages::clickhouse::io;
 
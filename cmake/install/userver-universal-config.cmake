@@ -31,6 +31,9 @@ if (USERVER_IMPL_FEATURE_JEMALLOC AND
     NOT CMAKE_SYSTEM_NAME MATCHES "Darwin")
   find_package(Jemalloc REQUIRED)
 endif()
+if (USERVER_IMPL_FEATURE_RE2)
+  find_package(libre2 REQUIRED)
+endif()
 
 include("${USERVER_CMAKE_DIR}/AddGoogleTests.cmake")
 include("${USERVER_CMAKE_DIR}/Sanitizers.cmake")
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <chrono>
+#include <cstdint>
 #include <optional>
 #include <stdexcept>
 #include <string>
@@ -75,6 +76,7 @@ struct Config final {
   std::chrono::milliseconds cleanup_interval{};
   bool is_strong_period{};
   std::optional<std::uint64_t> failed_updates_before_expiration;
+  std::uint32_t update_priority{1};
 
   FirstUpdateMode first_update_mode{};
   FirstUpdateType first_update_type{};
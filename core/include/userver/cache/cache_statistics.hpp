@@ -6,6 +6,7 @@
 #include <atomic>
 #include <chrono>
 #include <cstddef>
+#include <cstdint>
 
 #include <userver/cache/update_type.hpp>
 #include <userver/utils/internal_tag_fwd.hpp>
@@ -30,14 +31,30 @@ struct UpdateStatistics final {
   std::atomic<std::chrono::steady_clock::time_point>
       last_successful_update_start_time{{}};
   std::atomic<std::chrono::milliseconds> last_update_duration{{}};
+
+  // Memory allocated by the task of the last successful update, and the
+  // part of it that was not freed by the end of the update. Only accounted
+  // with the `account-allocations` option of the task processor.
+  std::atomic<std::uint64_t> last_update_allocated_bytes{0};
+  std::atomic<std::int64_t> last_update_retained_bytes{0};
 };
 
 void DumpMetric(utils::statistics::Writer& writer,
                 const UpdateStatistics& stats);
 
+struct UpdateSchedulerStatistics final {
+  utils::statistics::RateCounter deferred_count{0};
+  utils::statistics::RateCounter deferral_time_ms{0};
+  utils::statistics::RateCounter slot_wait_time_ms{0};
+};
+
+void DumpMetric(utils::statistics::Writer& writer,
+                const UpdateSchedulerStatistics& stats);
+
 struct Statistics final {
   UpdateStatistics full_update;
   UpdateStatistics incremental_update;
+  UpdateSchedulerStatistics update_scheduler;
   std::atomic<std::size_t> documents_current_count{0};
 };
 
@@ -90,10 +107,14 @@ class UpdateStatisticsScope final {
  private:
   void DoFinish(impl::UpdateState new_state);
 
+  void AccountAllocations();
+
   impl::Statistics& stats_;
   impl::UpdateStatistics& update_stats_;
   impl::UpdateState state_{impl::UpdateState::kNotFinished};
   const std::chrono::steady_clock::time_point update_start_time_;
+  std::uint64_t update_start_allocated_bytes_{0};
+  std::uint64_t update_start_deallocated_bytes_{0};
 };
 
 }  // namespace cache
@@ -50,6 +50,7 @@ namespace components {
 ///
 /// ## Dynamic config
 /// * @ref USERVER_CACHES
+/// * @ref USERVER_CACHE_UPDATE_SCHEDULER
 /// * @ref USERVER_DUMPS
 ///
 /// ## Static options:
@@ -71,6 +72,7 @@ namespace components {
 /// failed-updates-before-expiration | the number of consecutive failed updates for data expiration | --
 /// has-pre-assign-check | enables the check before changing the value in the cache, by default it is the check that the new value is not empty | false
 /// alert-on-failing-to-update-times | fire an alert if the cache update failed specified amount of times in a row. If zero - alerts are disabled. Value from dynamic config takes priority over static | 0
+/// update-priority | weight of the cache updates in @ref USERVER_CACHE_UPDATE_SCHEDULER, a cache with a greater weight waits less for an update slot | 1
 /// dump.* | Manages cache behavior after dump load | -
 /// dump.first-update-mode | Behavior of update after successful load from dump. See info on modes below | skip
 /// dump.first-update-type | Update type after successful load from dump (`full`, `incremental` or `incremental-then-async-full`) | full
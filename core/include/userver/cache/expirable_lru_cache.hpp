@@ -5,15 +5,22 @@
 
 #include <atomic>
 #include <chrono>
+#include <cstdint>
+#include <memory>
 #include <optional>
+#include <unordered_map>
+#include <vector>
 
 #include <userver/cache/lru_cache_config.hpp>
 #include <userver/cache/lru_cache_statistics.hpp>
 #include <userver/cache/nway_lru_cache.hpp>
+#include <userver/cache/size_estimator.hpp>
 #include <userver/concurrent/mutex_set.hpp>
+#include <userver/concurrent/variable.hpp>
 #include <userver/dump/common.hpp>
 #include <userver/dump/dumper.hpp>
 #include <userver/engine/async.hpp>
+#include <userver/engine/future.hpp>
 #include <userver/utils/datetime.hpp>
 #include <userver/utils/impl/cached_time.hpp>
 #include <userver/utils/impl/wait_token_storage.hpp>
@@ -47,6 +54,29 @@ impl::ExpirableValue<Value> Read(dump::Reader& reader,
       reader.Read<std::chrono::system_clock::time_point>() - now + steady_now};
 }
 
+/// @brief Slower storage for the entries evicted from cache::ExpirableLruCache,
+/// e.g. on a local disk
+template <typename Key, typename Value>
+class LowerTier {
+ public:
+  virtual ~LowerTier() = default;
+
+  /// @brief Stores the entry evicted to free space.
+  ///
+  /// Called under the lock of the cache, so it should be fast and must not
+  /// access the cache.
+  virtual void Store(const Key& key, const ExpirableValue<Value>& entry) = 0;
+
+  /// Returns the stored entry on a cache miss, std::nullopt if missing
+  virtual std::optional<ExpirableValue<Value>> Load(const Key& key) = 0;
+
+  /// Removes the entry invalidated in the cache
+  virtual void Remove(const Key& key) = 0;
+
+  /// Removes all the entries on the cache invalidation
+  virtual void Clear() = 0;
+};
+
 }  // namespace impl
 
 /// @ingroup userver_containers
@@ -68,10 +98,11 @@ class ExpirableLruCache final {
     kUseCache,   ///< Cache value got from update function
   };
 
-  /// For the description of `ways` and `way_size`,
+  /// For the description of `ways`, `way_size` and `policy`,
   /// see the cache::NWayLRU::NWayLRU constructor.
   ExpirableLruCache(size_t ways, size_t way_size, const Hash& hash = Hash(),
-                    const Equal& equal = Equal());
+                    const Equal& equal = Equal(),
+                    CachePolicy policy = CachePolicy::kLRU);
 
   ~ExpirableLruCache();
 
@@ -79,6 +110,25 @@ class ExpirableLruCache final {
   /// see the cache::NWayLRU::NWayLRU constructor.
   void SetWaySize(size_t way_size);
 
+  /// For the description of `way_max_bytes`,
+  /// see cache::NWayLRU::UpdateWayMaxBytes.
+  void SetWayMaxBytes(size_t way_max_bytes);
+
+  /// Sets the estimator of the entry sizes for SetWayMaxBytes,
+  /// cache::DefaultSizeEstimator is used by default. This method is not
+  /// thread-safe.
+  void SetSizeEstimator(std::function<size_t(const Key&, const Value&)> func);
+
+  /// @brief Sets the slower storage for the evicted entries, see
+  /// impl::LowerTier. This method is not thread-safe.
+  ///
+  /// A non-expired entry found there by Get on a cache miss is returned
+  /// instead of calling the update function and is stored in the cache with
+  /// its original update time, so it expires as if it was never evicted.
+  ///
+  /// @throws std::logic_error if the policy is not cache::CachePolicy::kLRU
+  void SetLowerTier(std::shared_ptr<impl::LowerTier<Key, Value>> lower_tier);
+
   std::chrono::milliseconds GetMaxLifetime() const noexcept;
 
   void SetMaxLifetime(std::chrono::milliseconds max_lifetime);
@@ -90,10 +140,23 @@ class ExpirableLruCache final {
    */
   void SetBackgroundUpdate(BackgroundUpdateMode background_update);
 
+  std::chrono::milliseconds GetStaleWhileRevalidate() const noexcept;
+
+  /**
+   * Sets the period after the expiration during which GetOptional returns
+   * the expired value and updates it in background. 0 disables serving of
+   * the expired values.
+   */
+  void SetStaleWhileRevalidate(std::chrono::milliseconds stale_lifetime);
+
   /**
    * @returns GetOptional("key", update_func) if it is not std::nullopt.
    * Otherwise the result of update_func(key) is returned, and additionally
    * stored in cache if "read_mode" is kUseCache.
+   *
+   * Concurrent Get calls for the same missing key wait for the update_func
+   * call of the first one and return its result (or rethrow its exception)
+   * instead of calling their own update_func.
    */
   Value Get(const Key& key, const UpdateValueFunc& update_func,
             ReadMode read_mode = ReadMode::kUseCache);
@@ -135,6 +198,10 @@ class ExpirableLruCache final {
 
   size_t GetSizeApproximate() const;
 
+  /// Returns the estimated size of the entries in bytes, std::nullopt if
+  /// the limit set by SetWayMaxBytes is disabled
+  std::optional<size_t> GetBytesApproximate() const;
+
   /// Clear cache
   void Invalidate();
 
@@ -159,21 +226,49 @@ class ExpirableLruCache final {
   bool ShouldUpdate(std::chrono::steady_clock::time_point update_time,
                     std::chrono::steady_clock::time_point now) const;
 
+  bool IsStaleServable(std::chrono::steady_clock::time_point update_time,
+                       std::chrono::steady_clock::time_point now) const;
+
+  std::optional<impl::ExpirableValue<Value>> LoadFromLowerTier(
+      const Key& key, std::chrono::steady_clock::time_point now) const;
+
+  Value UpdateCoalesced(const Key& key, const UpdateValueFunc& update_func,
+                        ReadMode read_mode,
+                        std::chrono::steady_clock::time_point now);
+
+  // Returns std::nullopt if the caller has to do the update itself
+  std::optional<engine::Future<Value>> JoinUpdate(const Key& key);
+
+  std::vector<engine::Promise<Value>> LeaveUpdate(const Key& key);
+
+  using InFlightUpdates =
+      std::unordered_map<Key, std::vector<engine::Promise<Value>>, Hash,
+                         Equal>;
+
   cache::NWayLRU<Key, impl::ExpirableValue<Value>, Hash, Equal> lru_;
   std::atomic<std::chrono::milliseconds> max_lifetime_{
       std::chrono::milliseconds(0)};
   std::atomic<BackgroundUpdateMode> background_update_mode_{
       BackgroundUpdateMode::kDisabled};
+  std::atomic<std::chrono::milliseconds> stale_while_revalidate_{
+      std::chrono::milliseconds(0)};
+  std::atomic<size_t> way_max_bytes_{0};
+  std::shared_ptr<impl::LowerTier<Key, Value>> lower_tier_;
   impl::ExpirableLruCacheStatistics stats_;
   concurrent::MutexSet<Key, Hash, Equal> mutex_set_;
+  concurrent::Variable<InFlightUpdates> in_flight_updates_;
   utils::impl::WaitTokenStorage wait_token_storage_;
 };
 
 template <typename Key, typename Value, typename Hash, typename Equal>
 ExpirableLruCache<Key, Value, Hash, Equal>::ExpirableLruCache(
-    size_t ways, size_t way_size, const Hash& hash, const Equal& equal)
-    : lru_(ways, way_size, hash, equal),
-      mutex_set_{ways, way_size, hash, equal} {}
+    size_t ways, size_t way_size, const Hash& hash, const Equal& equal,
+    CachePolicy policy)
+    : lru_(ways, way_size, hash, equal, policy),
+      mutex_set_{ways, way_size, hash, equal},
+      in_flight_updates_(0, hash, equal) {
+  SetSizeEstimator(DefaultSizeEstimator{});
+}
 
 template <typename Key, typename Value, typename Hash, typename Equal>
 ExpirableLruCache<Key, Value, Hash, Equal>::~ExpirableLruCache() {
@@ -185,6 +280,38 @@ void ExpirableLruCache<Key, Value, Hash, Equal>::SetWaySize(size_t way_size) {
   lru_.UpdateWaySize(way_size);
 }
 
+template <typename Key, typename Value, typename Hash, typename Equal>
+void ExpirableLruCache<Key, Value, Hash, Equal>::SetWayMaxBytes(
+    size_t way_max_bytes) {
+  lru_.UpdateWayMaxBytes(way_max_bytes);
+  way_max_bytes_ = way_max_bytes;
+}
+
+template <typename Key, typename Value, typename Hash, typename Equal>
+void ExpirableLruCache<Key, Value, Hash, Equal>::SetSizeEstimator(
+    std::function<size_t(const Key&, const Value&)> func) {
+  lru_.SetSizeEstimator(
+      [func = std::move(func)](const Key& key,
+                               const impl::ExpirableValue<Value>& value) {
+        return func(key, value.value) + sizeof(value.update_time);
+      });
+}
+
+template <typename Key, typename Value, typename Hash, typename Equal>
+void ExpirableLruCache<Key, Value, Hash, Equal>::SetLowerTier(
+    std::shared_ptr<impl::LowerTier<Key, Value>> lower_tier) {
+  if (lower_tier) {
+    lru_.SetEvictionCallback(
+        [&tier = *lower_tier](const Key& key,
+                              const impl::ExpirableValue<Value>& entry) {
+          tier.Store(key, entry);
+        });
+  } else {
+    lru_.SetEvictionCallback({});
+  }
+  lower_tier_ = std::move(lower_tier);
+}
+
 template <typename Key, typename Value, typename Hash, typename Equal>
 std::chrono::milliseconds
 ExpirableLruCache<Key, Value, Hash, Equal>::GetMaxLifetime() const noexcept {
@@ -203,6 +330,19 @@ void ExpirableLruCache<Key, Value, Hash, Equal>::SetBackgroundUpdate(
   background_update_mode_ = background_update;
 }
 
+template <typename Key, typename Value, typename Hash, typename Equal>
+std::chrono::milliseconds
+ExpirableLruCache<Key, Value, Hash, Equal>::GetStaleWhileRevalidate()
+    const noexcept {
+  return stale_while_revalidate_.load();
+}
+
+template <typename Key, typename Value, typename Hash, typename Equal>
+void ExpirableLruCache<Key, Value, Hash, Equal>::SetStaleWhileRevalidate(
+    std::chrono::milliseconds stale_lifetime) {
+  stale_while_revalidate_ = stale_lifetime;
+}
+
 template <typename Key, typename Value, typename Hash, typename Equal>
 Value ExpirableLruCache<Key, Value, Hash, Equal>::Get(
     const Key& key, const UpdateValueFunc& update_func, ReadMode read_mode) {
@@ -212,20 +352,12 @@ Value ExpirableLruCache<Key, Value, Hash, Equal>::Get(
     return std::move(*opt_old_value);
   }
 
-  auto mutex = mutex_set_.GetMutexForKey(key);
-  std::lock_guard lock(mutex);
-  // Test one more time - concurrent ExpirableLruCache::Get()
-  // might have put the value
-  auto old_value = lru_.Get(key);
-  if (old_value && !IsExpired(old_value->update_time, now)) {
-    return std::move(old_value->value);
-  }
-
-  auto value = update_func(key);
-  if (read_mode == ReadMode::kUseCache) {
-    lru_.Put(key, {value, now});
+  auto update = JoinUpdate(key);
+  if (update) {
+    impl::CacheCoalesced(stats_);
+    return update->get();
   }
-  return value;
+  return UpdateCoalesced(key, update_func, read_mode, now);
 }
 
 template <typename Key, typename Value, typename Hash, typename Equal>
@@ -242,6 +374,13 @@ std::optional<Value> ExpirableLruCache<Key, Value, Hash, Equal>::GetOptional(
         UpdateInBackground(key, update_func);
       }
 
+      return std::move(old_value->value);
+    } else if (IsStaleServable(old_value->update_time, now)) {
+      impl::CacheStale(stats_);
+      impl::CacheHit(stats_);
+
+      UpdateInBackground(key, update_func);
+
       return std::move(old_value->value);
     } else {
       impl::CacheStale(stats_);
@@ -332,15 +471,24 @@ size_t ExpirableLruCache<Key, Value, Hash, Equal>::GetSizeApproximate() const {
   return lru_.GetSize();
 }
 
+template <typename Key, typename Value, typename Hash, typename Equal>
+std::optional<size_t>
+ExpirableLruCache<Key, Value, Hash, Equal>::GetBytesApproximate() const {
+  if (way_max_bytes_ == 0) return std::nullopt;
+  return lru_.GetBytes();
+}
+
 template <typename Key, typename Value, typename Hash, typename Equal>
 void ExpirableLruCache<Key, Value, Hash, Equal>::Invalidate() {
   lru_.Invalidate();
+  if (lower_tier_) lower_tier_->Clear();
 }
 
 template <typename Key, typename Value, typename Hash, typename Equal>
 void ExpirableLruCache<Key, Value, Hash, Equal>::InvalidateByKey(
     const Key& key) {
   lru_.InvalidateByKey(key);
+  if (lower_tier_) lower_tier_->Remove(key);
 }
 
 template <typename Key, typename Value, typename Hash, typename Equal>
@@ -378,8 +526,94 @@ bool ExpirableLruCache<Key, Value, Hash, Equal>::ShouldUpdate(
     std::chrono::steady_clock::time_point update_time,
     std::chrono::steady_clock::time_point now) const {
   auto max_lifetime = max_lifetime_.load();
-  return (background_update_mode_.load() == BackgroundUpdateMode::kEnabled) &&
-         max_lifetime.count() != 0 && update_time + max_lifetime / 2 < now;
+  if (background_update_mode_.load() != BackgroundUpdateMode::kEnabled ||
+      max_lifetime.count() == 0) {
+    return false;
+  }
+
+  // The values put at the same moment are updated at different moments
+  // within [lifetime / 2, lifetime * 5 / 8) to avoid the bursts of updates
+  const auto spread = (max_lifetime / 8).count();
+  const auto seed =
+      static_cast<std::uint64_t>(update_time.time_since_epoch().count());
+  const auto jitter = std::chrono::milliseconds(
+      spread == 0 ? 0 : ((seed * 0x9E3779B97F4A7C15ULL) >> 32) % spread);
+  return update_time + max_lifetime / 2 + jitter < now;
+}
+
+template <typename Key, typename Value, typename Hash, typename Equal>
+bool ExpirableLruCache<Key, Value, Hash, Equal>::IsStaleServable(
+    std::chrono::steady_clock::time_point update_time,
+    std::chrono::steady_clock::time_point now) const {
+  auto max_lifetime = max_lifetime_.load();
+  auto stale_lifetime = stale_while_revalidate_.load();
+  return stale_lifetime.count() != 0 &&
+         update_time + max_lifetime + stale_lifetime >= now;
+}
+
+template <typename Key, typename Value, typename Hash, typename Equal>
+std::optional<impl::ExpirableValue<Value>>
+ExpirableLruCache<Key, Value, Hash, Equal>::LoadFromLowerTier(
+    const Key& key, std::chrono::steady_clock::time_point now) const {
+  if (!lower_tier_) return std::nullopt;
+  auto entry = lower_tier_->Load(key);
+  if (entry && IsExpired(entry->update_time, now)) return std::nullopt;
+  return entry;
+}
+
+template <typename Key, typename Value, typename Hash, typename Equal>
+Value ExpirableLruCache<Key, Value, Hash, Equal>::UpdateCoalesced(
+    const Key& key, const UpdateValueFunc& update_func, ReadMode read_mode,
+    std::chrono::steady_clock::time_point now) {
+  std::optional<Value> value;
+  try {
+    auto mutex = mutex_set_.GetMutexForKey(key);
+    std::lock_guard lock(mutex);
+    // Test one more time - concurrent ExpirableLruCache::Get() or a background
+    // update might have put the value
+    auto old_value = lru_.Get(key);
+    if (old_value && !IsExpired(old_value->update_time, now)) {
+      value.emplace(std::move(old_value->value));
+    } else if (auto lower_entry = LoadFromLowerTier(key, now)) {
+      value.emplace(lower_entry->value);
+      if (read_mode == ReadMode::kUseCache) {
+        lru_.Put(key, std::move(*lower_entry));
+      }
+    } else {
+      value.emplace(update_func(key));
+      if (read_mode == ReadMode::kUseCache) {
+        lru_.Put(key, {*value, now});
+      }
+    }
+  } catch (...) {
+    for (auto& promise : LeaveUpdate(key)) {
+      promise.set_exception(std::current_exception());
+    }
+    throw;
+  }
+
+  for (auto& promise : LeaveUpdate(key)) {
+    promise.set_value(*value);
+  }
+  return std::move(*value);
+}
+
+template <typename Key, typename Value, typename Hash, typename Equal>
+std::optional<engine::Future<Value>>
+ExpirableLruCache<Key, Value, Hash, Equal>::JoinUpdate(const Key& key) {
+  auto updates = in_flight_updates_.Lock();
+  auto [it, inserted] = updates->try_emplace(key);
+  if (inserted) return std::nullopt;
+  return it->second.emplace_back().get_future();
+}
+
+template <typename Key, typename Value, typename Hash, typename Equal>
+std::vector<engine::Promise<Value>>
+ExpirableLruCache<Key, Value, Hash, Equal>::LeaveUpdate(const Key& key) {
+  auto updates = in_flight_updates_.Lock();
+  auto node = updates->extract(key);
+  UASSERT(node);
+  return std::move(node.mapped());
 }
 
 template <typename Key, typename Value, typename Hash = std::hash<Key>,
@@ -441,6 +675,9 @@ template <typename Key, typename Value, typename Hash, typename Equal>
 void DumpMetric(utils::statistics::Writer& writer,
                 const ExpirableLruCache<Key, Value, Hash, Equal>& cache) {
   writer["current-documents-count"] = cache.GetSizeApproximate();
+  if (const auto bytes = cache.GetBytesApproximate()) {
+    writer["current-bytes"] = *bytes;
+  }
   writer = cache.GetStatistics();
 }
 
@@ -0,0 +1,152 @@
+#pragma once
+
+/// @file userver/cache/invalidation_channel.hpp
+/// @brief @copybrief cache::InvalidationChannelBase
+
+#include <chrono>
+#include <cstddef>
+#include <functional>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <unordered_map>
+#include <vector>
+
+#include <userver/components/component_base.hpp>
+#include <userver/concurrent/variable.hpp>
+#include <userver/engine/mutex.hpp>
+#include <userver/utils/from_string.hpp>
+#include <userver/utils/meta_light.hpp>
+#include <userver/utils/periodic_task.hpp>
+#include <userver/utils/statistics/entry.hpp>
+#include <userver/utils/statistics/rate_counter.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace cache {
+
+namespace impl {
+class InvalidationBatch;
+}  // namespace impl
+
+/// @brief Conversion of the cache keys to strings and back for
+/// cache::InvalidationChannelBase.
+///
+/// Specialized for strings and integers. Specialize it for other key types
+/// with the same static `ToString` and `FromString` functions.
+template <typename Key, typename Enable = void>
+struct InvalidationKeyTraits {};
+
+template <>
+struct InvalidationKeyTraits<std::string> {
+  static std::string ToString(const std::string& key) { return key; }
+  static std::string FromString(const std::string& str) { return str; }
+};
+
+template <typename Key>
+struct InvalidationKeyTraits<Key, std::enable_if_t<std::is_integral_v<Key>>> {
+  static std::string ToString(Key key) { return std::to_string(key); }
+  static Key FromString(const std::string& str) {
+    return utils::FromString<Key>(str);
+  }
+};
+
+namespace impl {
+
+template <typename Key>
+using InvalidationKeyFromString =
+    decltype(InvalidationKeyTraits<Key>::FromString(std::string{}));
+
+template <typename Key>
+inline constexpr bool kHasInvalidationKeyTraits =
+    meta::kIsDetected<InvalidationKeyFromString, Key>;
+
+}  // namespace impl
+
+// clang-format off
+
+/// @ingroup userver_base_classes
+///
+/// @brief Base class for the components that broadcast the invalidations of
+/// the cache::LruCacheComponent keys to all the instances of the service.
+///
+/// The invalidated keys are gathered for `flush-interval`, deduplicated and
+/// sent in batches, one message per cache. The instance skips its own messages.
+/// The derived class implements the transport: it sends the messages in
+/// DoPublish() and passes each received message to OnMessage(). The delivery
+/// is best-effort, so the TTL of the caches still bounds the staleness if
+/// a message is lost.
+///
+/// See storages::redis::CacheInvalidationChannel for the Redis Pub/Sub
+/// transport.
+///
+/// ## Static options:
+/// Name | Description | Default value
+/// ---- | ----------- | -------------
+/// flush-interval | how long the invalidated keys are gathered before sending | 100ms
+/// max-batch-size | max keys in a message, reaching it sends the keys right away | 1000
+
+// clang-format on
+class InvalidationChannelBase : public components::ComponentBase {
+ public:
+  /// @brief Callback that is invoked with the keys invalidated on the other
+  /// instances
+  using Callback = std::function<void(const std::vector<std::string>& keys)>;
+
+  InvalidationChannelBase(const components::ComponentConfig& config,
+                          const components::ComponentContext& context);
+
+  ~InvalidationChannelBase() override;
+
+  /// @brief Schedules sending of the invalidation of the `key` of the cache
+  /// `cache_name` to the other instances.
+  void Publish(std::string_view cache_name, std::string key);
+
+  /// @brief Starts passing the keys of the cache `cache_name` invalidated on
+  /// the other instances to the `callback`
+  void Subscribe(std::string cache_name, Callback callback);
+
+  void Unsubscribe(const std::string& cache_name);
+
+  static yaml_config::Schema GetStaticConfigSchema();
+
+ protected:
+  /// @brief Sends the `message` to all the instances of the service.
+  /// @throws std::exception on failure, the message is dropped then
+  virtual void DoPublish(std::string message) = 0;
+
+  /// @brief Must be called by the derived class for each received message
+  void OnMessage(std::string_view message);
+
+  void OnAllComponentsLoaded() final;
+  void OnAllComponentsAreStopping() final;
+
+ private:
+  struct Statistics final {
+    utils::statistics::RateCounter published_keys{0};
+    utils::statistics::RateCounter deduplicated_keys{0};
+    utils::statistics::RateCounter sent_messages{0};
+    utils::statistics::RateCounter send_errors{0};
+    utils::statistics::RateCounter received_keys{0};
+    utils::statistics::RateCounter malformed_messages{0};
+  };
+
+  void Flush();
+  void WriteStatistics(utils::statistics::Writer& writer) const;
+
+  const std::string sender_id_;
+  const std::chrono::milliseconds flush_interval_;
+  const std::size_t max_batch_size_;
+
+  concurrent::Variable<std::unique_ptr<impl::InvalidationBatch>> batch_;
+  concurrent::Variable<std::unordered_map<std::string, Callback>> callbacks_;
+  Statistics stats_;
+  utils::PeriodicTask flush_task_;
+
+  // Subscriptions must be the last fields.
+  utils::statistics::Entry statistics_holder_;
+};
+
+}  // namespace cache
+
+USERVER_NAMESPACE_END
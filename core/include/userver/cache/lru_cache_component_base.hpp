@@ -6,15 +6,19 @@
 #include <functional>
 
 #include <userver/cache/expirable_lru_cache.hpp>
+#include <userver/cache/invalidation_channel.hpp>
 #include <userver/cache/lru_cache_config.hpp>
+#include <userver/cache/spillover_storage.hpp>
 #include <userver/components/component_base.hpp>
 #include <userver/concurrent/async_event_source.hpp>
 #include <userver/dump/dumper.hpp>
 #include <userver/dump/meta.hpp>
 #include <userver/dump/operations.hpp>
+#include <userver/dump/operations_string.hpp>
 #include <userver/dynamic_config/source.hpp>
 #include <userver/logging/log.hpp>
 #include <userver/testsuite/cache_control.hpp>
+#include <userver/utils/datetime.hpp>
 #include <userver/utils/statistics/entry.hpp>
 #include <userver/yaml_config/schema.hpp>
 
@@ -33,6 +37,89 @@ dynamic_config::Source FindDynamicConfigSource(
 
 bool IsDumpSupportEnabled(const components::ComponentConfig& config);
 
+InvalidationChannelBase* FindInvalidationChannel(
+    const components::ComponentConfig& config,
+    const components::ComponentContext& context);
+
+[[noreturn]] void ThrowInvalidationUnsupported(const std::string& name);
+
+SpilloverStorageBase* FindSpilloverStorage(
+    const components::ComponentConfig& config,
+    const components::ComponentContext& context);
+
+[[noreturn]] void ThrowSpilloverUnsupported(const std::string& name);
+
+void LogSpilloverLoadError(const std::string& name, const std::exception& ex);
+
+// Stores the entries evicted from the cache in the SpilloverStorageBase,
+// serialized with the dump serialization
+template <typename Key, typename Value, typename Hash, typename Equal>
+class SpilloverTier final : public LowerTier<Key, Value> {
+ public:
+  using Cache = ExpirableLruCache<Key, Value, Hash, Equal>;
+
+  SpilloverTier(SpilloverStorageBase& storage, std::string cache_name,
+                const Cache& cache)
+      : storage_(storage), cache_name_(std::move(cache_name)), cache_(cache) {}
+
+  void Store(const Key& key, const ExpirableValue<Value>& entry) override {
+    // The steady clock of the other process is meaningless
+    const auto update_time =
+        utils::datetime::Now() -
+        std::chrono::duration_cast<std::chrono::system_clock::duration>(
+            utils::datetime::SteadyNow() - entry.update_time);
+
+    dump::StringWriter writer;
+    writer.Write(entry.value);
+    writer.Write(update_time);
+    writer.Finish();
+
+    storage_.Store(cache_name_, dump::WriteToString(key),
+                   std::move(writer).Extract(), GetExpiration(update_time));
+  }
+
+  std::optional<ExpirableValue<Value>> Load(const Key& key) override {
+    const auto data = storage_.Load(cache_name_, dump::WriteToString(key));
+    if (!data) return std::nullopt;
+
+    try {
+      dump::StringReader reader(*data);
+      auto value = reader.Read<Value>();
+      const auto update_time =
+          reader.Read<std::chrono::system_clock::time_point>();
+      reader.Finish();
+      return ExpirableValue<Value>{
+          std::move(value),
+          utils::datetime::SteadyNow() -
+              std::chrono::duration_cast<std::chrono::steady_clock::duration>(
+                  utils::datetime::Now() - update_time)};
+    } catch (const std::exception& ex) {
+      LogSpilloverLoadError(cache_name_, ex);
+      return std::nullopt;
+    }
+  }
+
+  void Remove(const Key& key) override {
+    storage_.Remove(cache_name_, dump::WriteToString(key));
+  }
+
+  void Clear() override { storage_.Clear(cache_name_); }
+
+ private:
+  std::chrono::system_clock::time_point GetExpiration(
+      std::chrono::system_clock::time_point update_time) const {
+    const auto lifetime = cache_.GetMaxLifetime();
+    if (lifetime.count() == 0) {
+      return std::chrono::system_clock::time_point::max();
+    }
+    return update_time + lifetime + cache_.GetStaleWhileRevalidate();
+  }
+
+  SpilloverStorageBase& storage_;
+  const std::string cache_name_;
+  const Cache& cache_;
+};
+
 yaml_config::Schema GetLruCacheComponentBaseSchema();
 
 }  // namespace impl
@@ -56,9 +143,14 @@ yaml_config::Schema GetLruCacheComponentBaseSchema();
 /// Name | Description | Default value
 /// ---- | ----------- | -------------
 /// size | max amount of items to store in cache | --
+/// max-bytes | max estimated size of the items in bytes, requires the `lru` policy (see cache::DefaultSizeEstimator) | 0 (unlimited)
 /// ways | number of ways for associative cache | --
 /// lifetime | TTL for cache entries (0 is unlimited) | 0
+/// stale-while-revalidate | period after the TTL during which the expired entries are returned and updated in background (0 is disabled) | 0
+/// policy | eviction policy, one of `lru`, `slru`, `tinylfu` (see cache::CachePolicy) | lru
 /// config-settings | enables dynamic reconfiguration with CacheConfigSet | true
+/// invalidation-channel | name of the cache::InvalidationChannelBase component that delivers InvalidateByKeyOnAllInstances() to all the instances of the service, requires cache::InvalidationKeyTraits for the `Key` | --
+/// spillover-storage | name of the cache::SpilloverStorageBase component to store the evicted entries in and to look them up on a miss before DoGetByKey, requires the `lru` policy and the dump serialization of `Key` and `Value` | --
 ///
 /// ## Example usage:
 ///
@@ -87,6 +179,13 @@ class LruCacheComponent : public components::ComponentBase,
 
   CacheWrapper GetCache();
 
+  /// @brief Invalidates the `key` in this instance of the cache and in the
+  /// other instances of the service, using the `invalidation-channel`.
+  ///
+  /// The other instances are invalidated asynchronously and on the best-effort
+  /// basis. Without `invalidation-channel` only this instance is invalidated.
+  void InvalidateByKeyOnAllInstances(const Key& key);
+
   static yaml_config::Schema GetStaticConfigSchema();
 
  protected:
@@ -103,6 +202,8 @@ class LruCacheComponent : public components::ComponentBase,
 
   void UpdateConfig(const LruCacheConfig& config);
 
+  void OnRemoteInvalidation(const std::vector<std::string>& keys);
+
   static constexpr bool kCacheIsDumpable =
       dump::kIsDumpable<Key> && dump::kIsDumpable<Value>;
 
@@ -113,6 +214,8 @@ class LruCacheComponent : public components::ComponentBase,
   const LruCacheConfigStatic static_config_;
   std::shared_ptr<dump::Dumper> dumper_;
   const std::shared_ptr<Cache> cache_;
+  InvalidationChannelBase* invalidation_channel_{nullptr};
+  bool has_spillover_storage_{false};
 
   // Subscriptions must be the last fields.
   concurrent::AsyncEventSubscriberScope config_subscription_;
@@ -129,7 +232,11 @@ LruCacheComponent<Key, Value, Hash, Equal>::LruCacheComponent(
       name_(components::GetCurrentComponentName(config)),
       static_config_(config),
       cache_(std::make_shared<Cache>(static_config_.ways,
-                                     static_config_.GetWaySize())) {
+                                     static_config_.GetWaySize(), Hash{},
+                                     Equal{}, static_config_.config.policy)) {
+  cache_->SetWayMaxBytes(
+      static_config_.config.GetWayMaxBytes(static_config_.ways));
+
   if (impl::IsDumpSupportEnabled(config)) {
     dumper_ = std::make_shared<dump::Dumper>(
         config, context, static_cast<dump::DumpableEntity&>(*this));
@@ -137,8 +244,20 @@ LruCacheComponent<Key, Value, Hash, Equal>::LruCacheComponent(
     dumper_->ReadDump();
   }
 
+  if (auto* storage = impl::FindSpilloverStorage(config, context)) {
+    if constexpr (kCacheIsDumpable) {
+      cache_->SetLowerTier(
+          std::make_shared<impl::SpilloverTier<Key, Value, Hash, Equal>>(
+              *storage, name_, *cache_));
+      has_spillover_storage_ = true;
+    } else {
+      impl::ThrowSpilloverUnsupported(name_);
+    }
+  }
+
   cache_->SetMaxLifetime(static_config_.config.lifetime);
   cache_->SetBackgroundUpdate(static_config_.config.background_update);
+  cache_->SetStaleWhileRevalidate(static_config_.config.stale_while_revalidate);
 
   if (static_config_.use_dynamic_config) {
     LOG_INFO() << "Dynamic LRU cache config is enabled, subscribing on "
@@ -156,12 +275,25 @@ LruCacheComponent<Key, Value, Hash, Equal>::LruCacheComponent(
       context, name_,
       [this](utils::statistics::Writer& writer) { writer = *cache_; });
 
+  invalidation_channel_ = impl::FindInvalidationChannel(config, context);
+  if (invalidation_channel_) {
+    if constexpr (impl::kHasInvalidationKeyTraits<Key>) {
+      invalidation_channel_->Subscribe(
+          name_, [this](const std::vector<std::string>& keys) {
+            OnRemoteInvalidation(keys);
+          });
+    } else {
+      impl::ThrowInvalidationUnsupported(name_);
+    }
+  }
+
   reset_registration_ = testsuite::RegisterCache(config, context, this,
                                                  &LruCacheComponent::DropCache);
 }
 
 template <typename Key, typename Value, typename Hash, typename Equal>
 LruCacheComponent<Key, Value, Hash, Equal>::~LruCacheComponent() {
+  if (invalidation_channel_) invalidation_channel_->Unsubscribe(name_);
   reset_registration_.Unregister();
   statistics_holder_.Unregister();
   config_subscription_.Unsubscribe();
@@ -169,6 +301,9 @@ LruCacheComponent<Key, Value, Hash, Equal>::~LruCacheComponent() {
   if (dumper_) {
     dumper_->CancelWriteTaskAndWait();
   }
+
+  // The cache may outlive the component and the storage
+  if (has_spillover_storage_) cache_->SetLowerTier(nullptr);
 }
 
 template <typename Key, typename Value, typename Hash, typename Equal>
@@ -177,6 +312,28 @@ LruCacheComponent<Key, Value, Hash, Equal>::GetCache() {
   return CacheWrapper(cache_, [this](const Key& key) { return GetByKey(key); });
 }
 
+template <typename Key, typename Value, typename Hash, typename Equal>
+void LruCacheComponent<Key, Value, Hash, Equal>::InvalidateByKeyOnAllInstances(
+    const Key& key) {
+  cache_->InvalidateByKey(key);
+  if constexpr (impl::kHasInvalidationKeyTraits<Key>) {
+    if (invalidation_channel_) {
+      invalidation_channel_->Publish(name_,
+                                     InvalidationKeyTraits<Key>::ToString(key));
+    }
+  }
+}
+
+template <typename Key, typename Value, typename Hash, typename Equal>
+void LruCacheComponent<Key, Value, Hash, Equal>::OnRemoteInvalidation(
+    const std::vector<std::string>& keys) {
+  if constexpr (impl::kHasInvalidationKeyTraits<Key>) {
+    for (const auto& key : keys) {
+      cache_->InvalidateByKey(InvalidationKeyTraits<Key>::FromString(key));
+    }
+  }
+}
+
 template <typename Key, typename Value, typename Hash, typename Equal>
 void LruCacheComponent<Key, Value, Hash, Equal>::DropCache() {
   cache_->Invalidate();
@@ -204,8 +361,10 @@ template <typename Key, typename Value, typename Hash, typename Equal>
 void LruCacheComponent<Key, Value, Hash, Equal>::UpdateConfig(
     const LruCacheConfig& config) {
   cache_->SetWaySize(config.GetWaySize(static_config_.ways));
+  cache_->SetWayMaxBytes(config.GetWayMaxBytes(static_config_.ways));
   cache_->SetMaxLifetime(config.lifetime);
   cache_->SetBackgroundUpdate(config.background_update);
+  cache_->SetStaleWhileRevalidate(config.stale_while_revalidate);
 }
 
 template <typename Key, typename Value, typename Hash, typename Equal>
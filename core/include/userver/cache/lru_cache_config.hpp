@@ -5,6 +5,7 @@
 #include <optional>
 #include <unordered_map>
 
+#include <userver/cache/policy.hpp>
 #include <userver/components/component_fwd.hpp>
 #include <userver/dynamic_config/snapshot.hpp>
 #include <userver/formats/json_fwd.hpp>
@@ -27,11 +28,26 @@ struct LruCacheConfig final {
 
   std::size_t GetWaySize(std::size_t ways) const;
 
+  /// Returns 0 if the limit in bytes is disabled
+  std::size_t GetWayMaxBytes(std::size_t ways) const;
+
   std::size_t size;
+  /// Limit of the estimated size of the entries in bytes, 0 is unlimited
+  std::size_t max_bytes;
   std::chrono::milliseconds lifetime;
   BackgroundUpdateMode background_update;
+  /// Period after the expiration during which the expired values are served
+  /// while being updated in background, 0 disables it
+  std::chrono::milliseconds stale_while_revalidate;
+
+  /// Taken from the static config only, the dynamic config can not change
+  /// the type of an existing cache
+  CachePolicy policy{CachePolicy::kLRU};
 };
 
+CachePolicy Parse(const yaml_config::YamlConfig& config,
+                  formats::parse::To<CachePolicy>);
+
 LruCacheConfig Parse(const formats::json::Value& value,
                      formats::parse::To<LruCacheConfig>);
 
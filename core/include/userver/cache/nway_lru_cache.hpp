@@ -1,15 +1,21 @@
 #pragma once
 
+#include <algorithm>
 #include <functional>
 #include <optional>
+#include <stdexcept>
+#include <variant>
 #include <vector>
 
 #include <boost/container_hash/hash.hpp>
 
 #include <userver/cache/lru_map.hpp>
+#include <userver/cache/policy.hpp>
+#include <userver/cache/size_estimator.hpp>
 #include <userver/dump/dumper.hpp>
 #include <userver/dump/operations.hpp>
 #include <userver/engine/mutex.hpp>
+#include <userver/utils/assert.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
@@ -20,6 +26,9 @@ template <typename T, typename U, typename Hash = std::hash<T>,
           typename Equal = std::equal_to<T>>
 class NWayLRU final {
  public:
+  using SizeEstimator = std::function<std::size_t(const T&, const U&)>;
+  using EvictionCallback = std::function<void(const T&, const U&)>;
+
   /// @param ways is the number of ways (a.k.a. shards, internal hash-maps),
   /// into which elements are distributed based on their hash. Each shard is
   /// protected by an individual mutex. Larger `ways` means more internal
@@ -33,8 +42,11 @@ class NWayLRU final {
   /// according to the LRU policy.
   ///
   /// The maximum total number of elements is `ways * way_size`.
+  ///
+  /// @param policy is the eviction policy of the ways, see cache::CachePolicy
   NWayLRU(size_t ways, size_t way_size, const Hash& hash = Hash(),
-          const Equal& equal = Equal());
+          const Equal& equal = Equal(),
+          CachePolicy policy = CachePolicy::kLRU);
 
   void Put(const T& key, U value);
 
@@ -61,6 +73,36 @@ class NWayLRU final {
   /// see the cache::NWayLRU::NWayLRU constructor.
   void UpdateWaySize(size_t way_size);
 
+  /// @brief Limits the total estimated size of the elements of each way,
+  /// 0 disables the limit.
+  ///
+  /// The least recently used elements are evicted until both `way_size` and
+  /// `way_max_bytes` limits are met, an element larger than `way_max_bytes` is
+  /// not stored at all. The sizes come from the estimator, see
+  /// SetSizeEstimator.
+  ///
+  /// @throws std::logic_error if the policy is not cache::CachePolicy::kLRU
+  void UpdateWayMaxBytes(size_t way_max_bytes);
+
+  /// Sets the estimator of the element sizes for UpdateWayMaxBytes,
+  /// cache::DefaultSizeEstimator is used by default. This method is not
+  /// thread-safe.
+  void SetSizeEstimator(SizeEstimator estimator);
+
+  /// Returns the total estimated size of the elements, 0 if the limit set by
+  /// UpdateWayMaxBytes is disabled
+  size_t GetBytes() const;
+
+  /// @brief Sets the callback that is called for each element evicted to
+  /// free space for the new ones, but not for the invalidated or replaced
+  /// ones. This method is not thread-safe.
+  ///
+  /// The callback is called under the lock of the way, so it should be fast
+  /// and must not access the cache.
+  ///
+  /// @throws std::logic_error if the policy is not cache::CachePolicy::kLRU
+  void SetEvictionCallback(EvictionCallback callback);
+
   void Write(dump::Writer& writer) const;
   void Read(dump::Reader& reader);
 
@@ -69,34 +111,72 @@ class NWayLRU final {
   void SetDumper(std::shared_ptr<dump::Dumper> dumper);
 
  private:
+  template <CachePolicy Policy>
+  using Cache = LruMap<T, U, Hash, Equal, Policy>;
+
   struct Way {
-    Way(Way&& other) noexcept : cache(std::move(other.cache)) {}
+    Way(Way&& other) noexcept
+        : cache(std::move(other.cache)),
+          bytes(other.bytes),
+          max_bytes(other.max_bytes) {}
 
     // max_size is not used, will be reset by Resize() in NWayLRU::NWayLRU
-    Way(const Hash& hash, const Equal& equal) : cache(1, hash, equal) {}
+    Way(const Hash& hash, const Equal& equal, CachePolicy policy)
+        : cache(MakeCache(hash, equal, policy)) {}
+
+    template <typename Function>
+    decltype(auto) Visit(Function&& func) {
+      return std::visit(std::forward<Function>(func), cache);
+    }
+
+    template <typename Function>
+    decltype(auto) Visit(Function&& func) const {
+      return std::visit(std::forward<Function>(func), cache);
+    }
 
     mutable engine::Mutex mutex;
-    LruMap<T, U, Hash, Equal> cache;
+    std::variant<Cache<CachePolicy::kLRU>, Cache<CachePolicy::kSLRU>,
+                 Cache<CachePolicy::kTinyLFU>>
+        cache;
+
+    // Size limit by bytes is only supported for kLRU, as other policies may
+    // evict elements silently on Put
+    std::size_t bytes{0};
+    std::size_t max_bytes{0};
   };
 
+  static decltype(Way::cache) MakeCache(const Hash& hash, const Equal& equal,
+                                        CachePolicy policy);
+
   Way& GetWay(const T& key);
 
+  // Evicts the elements explicitly instead of letting the LruMap do it
+  void PutEvicting(Way& way, const T& key, U&& value);
+  void EraseFromWay(Way& way, const T& key);
+  void EvictLeastUsed(Way& way);
+  std::size_t CountBytes(const Way& way) const;
+
   void NotifyDumper();
 
   std::vector<Way> caches_;
   Hash hash_fn_;
+  const CachePolicy policy_;
+  SizeEstimator size_estimator_{DefaultSizeEstimator{}};
+  EvictionCallback eviction_callback_;
   std::shared_ptr<dump::Dumper> dumper_{nullptr};
 };
 
 template <typename T, typename U, typename Hash, typename Eq>
 NWayLRU<T, U, Hash, Eq>::NWayLRU(size_t ways, size_t way_size, const Hash& hash,
-                                 const Eq& equal)
-    : caches_(), hash_fn_(hash) {
+                                 const Eq& equal, CachePolicy policy)
+    : caches_(), hash_fn_(hash), policy_(policy) {
   caches_.reserve(ways);
-  for (size_t i = 0; i < ways; ++i) caches_.emplace_back(hash, equal);
+  for (size_t i = 0; i < ways; ++i) caches_.emplace_back(hash, equal, policy);
   if (ways == 0) throw std::logic_error("Ways must be positive");
 
-  for (auto& way : caches_) way.cache.SetMaxSize(way_size);
+  for (auto& way : caches_) {
+    way.Visit([way_size](auto& cache) { cache.SetMaxSize(way_size); });
+  }
 }
 
 template <typename T, typename U, typename Hash, typename Eq>
@@ -104,7 +184,11 @@ void NWayLRU<T, U, Hash, Eq>::Put(const T& key, U value) {
   auto& way = GetWay(key);
   {
     std::unique_lock<engine::Mutex> lock(way.mutex);
-    way.cache.Put(key, std::move(value));
+    if (way.max_bytes != 0 || eviction_callback_) {
+      PutEvicting(way, key, std::move(value));
+    } else {
+      way.Visit([&](auto& cache) { cache.Put(key, std::move(value)); });
+    }
   }
   NotifyDumper();
 }
@@ -115,14 +199,16 @@ std::optional<U> NWayLRU<T, U, Hash, Eq>::Get(const T& key,
                                               Validator validator) {
   auto& way = GetWay(key);
   std::unique_lock<engine::Mutex> lock(way.mutex);
-  auto* value = way.cache.Get(key);
+  return way.Visit([&](auto& cache) -> std::optional<U> {
+    auto* value = cache.Get(key);
 
-  if (value) {
-    if (validator(*value)) return *value;
-    way.cache.Erase(key);
-  }
+    if (value) {
+      if (validator(*value)) return *value;
+      EraseFromWay(way, key);
+    }
 
-  return std::nullopt;
+    return std::nullopt;
+  });
 }
 
 template <typename T, typename U, typename Hash, typename Eq>
@@ -130,7 +216,7 @@ void NWayLRU<T, U, Hash, Eq>::InvalidateByKey(const T& key) {
   auto& way = GetWay(key);
   {
     std::unique_lock<engine::Mutex> lock(way.mutex);
-    way.cache.Erase(key);
+    EraseFromWay(way, key);
   }
   NotifyDumper();
 }
@@ -139,14 +225,16 @@ template <typename T, typename U, typename Hash, typename Eq>
 U NWayLRU<T, U, Hash, Eq>::GetOr(const T& key, const U& default_value) {
   auto& way = GetWay(key);
   std::unique_lock<engine::Mutex> lock(way.mutex);
-  return way.cache.GetOr(key, default_value);
+  return way.Visit(
+      [&](auto& cache) { return cache.GetOr(key, default_value); });
 }
 
 template <typename T, typename U, typename Hash, typename Eq>
 void NWayLRU<T, U, Hash, Eq>::Invalidate() {
   for (auto& way : caches_) {
     std::unique_lock<engine::Mutex> lock(way.mutex);
-    way.cache.Clear();
+    way.Visit([](auto& cache) { cache.Clear(); });
+    way.bytes = 0;
   }
   NotifyDumper();
 }
@@ -156,7 +244,7 @@ template <typename Function>
 void NWayLRU<T, U, Hash, Eq>::VisitAll(Function func) const {
   for (const auto& way : caches_) {
     std::unique_lock<engine::Mutex> lock(way.mutex);
-    way.cache.VisitAll(func);
+    way.Visit([&func](const auto& cache) { cache.VisitAll(func); });
   }
 }
 
@@ -165,7 +253,7 @@ size_t NWayLRU<T, U, Hash, Eq>::GetSize() const {
   size_t size{0};
   for (const auto& way : caches_) {
     std::unique_lock<engine::Mutex> lock(way.mutex);
-    size += way.cache.GetSize();
+    size += way.Visit([](const auto& cache) { return cache.GetSize(); });
   }
   return size;
 }
@@ -174,8 +262,61 @@ template <typename T, typename U, typename Hash, typename Eq>
 void NWayLRU<T, U, Hash, Eq>::UpdateWaySize(size_t way_size) {
   for (auto& way : caches_) {
     std::unique_lock<engine::Mutex> lock(way.mutex);
-    way.cache.SetMaxSize(way_size);
+    if (way.max_bytes != 0 || eviction_callback_) {
+      // Evict here, as SetMaxSize would drop elements without accounting
+      while (way.Visit([](auto& cache) { return cache.GetSize(); }) >
+             way_size) {
+        EvictLeastUsed(way);
+      }
+    }
+    way.Visit([way_size](auto& cache) { cache.SetMaxSize(way_size); });
+  }
+}
+
+template <typename T, typename U, typename Hash, typename Eq>
+void NWayLRU<T, U, Hash, Eq>::UpdateWayMaxBytes(size_t way_max_bytes) {
+  if (way_max_bytes != 0 && policy_ != CachePolicy::kLRU) {
+    throw std::logic_error("Size limit in bytes requires the LRU policy");
+  }
+
+  for (auto& way : caches_) {
+    std::unique_lock<engine::Mutex> lock(way.mutex);
+    if (way_max_bytes == 0) {
+      way.bytes = 0;
+    } else if (way.max_bytes == 0) {
+      way.bytes = CountBytes(way);
+    }
+    way.max_bytes = way_max_bytes;
+
+    while (way.bytes > way.max_bytes) EvictLeastUsed(way);
+  }
+}
+
+template <typename T, typename U, typename Hash, typename Eq>
+void NWayLRU<T, U, Hash, Eq>::SetSizeEstimator(SizeEstimator estimator) {
+  size_estimator_ = std::move(estimator);
+  for (auto& way : caches_) {
+    std::unique_lock<engine::Mutex> lock(way.mutex);
+    if (way.max_bytes != 0) way.bytes = CountBytes(way);
+  }
+}
+
+template <typename T, typename U, typename Hash, typename Eq>
+size_t NWayLRU<T, U, Hash, Eq>::GetBytes() const {
+  size_t bytes{0};
+  for (const auto& way : caches_) {
+    std::unique_lock<engine::Mutex> lock(way.mutex);
+    bytes += way.bytes;
+  }
+  return bytes;
+}
+
+template <typename T, typename U, typename Hash, typename Eq>
+void NWayLRU<T, U, Hash, Eq>::SetEvictionCallback(EvictionCallback callback) {
+  if (callback && policy_ != CachePolicy::kLRU) {
+    throw std::logic_error("Eviction callback requires the LRU policy");
   }
+  eviction_callback_ = std::move(callback);
 }
 
 template <typename T, typename U, typename Hash, typename Eq>
@@ -198,11 +339,13 @@ void NWayLRU<T, U, Hash, Equal>::Write(dump::Writer& writer) const {
   for (const Way& way : caches_) {
     std::unique_lock<engine::Mutex> lock(way.mutex);
 
-    writer.Write(way.cache.GetSize());
+    way.Visit([&writer](const auto& cache) {
+      writer.Write(cache.GetSize());
 
-    way.cache.VisitAll([&writer](const T& key, const U& value) {
-      writer.Write(key);
-      writer.Write(value);
+      cache.VisitAll([&writer](const T& key, const U& value) {
+        writer.Write(key);
+        writer.Write(value);
+      });
     });
   }
 }
@@ -222,6 +365,84 @@ void NWayLRU<T, U, Hash, Equal>::Read(dump::Reader& reader) {
   }
 }
 
+template <typename T, typename U, typename Hash, typename Equal>
+auto NWayLRU<T, U, Hash, Equal>::MakeCache(const Hash& hash, const Equal& equal,
+                                           CachePolicy policy)
+    -> decltype(Way::cache) {
+  switch (policy) {
+    case CachePolicy::kLRU:
+      return Cache<CachePolicy::kLRU>{1, hash, equal};
+    case CachePolicy::kSLRU:
+      return Cache<CachePolicy::kSLRU>{1, hash, equal};
+    case CachePolicy::kTinyLFU:
+      return Cache<CachePolicy::kTinyLFU>{1, hash, equal};
+  }
+  UINVARIANT(false, "Unexpected cache policy");
+}
+
+template <typename T, typename U, typename Hash, typename Equal>
+void NWayLRU<T, U, Hash, Equal>::PutEvicting(Way& way, const T& key,
+                                             U&& value) {
+  auto& cache = std::get<Cache<CachePolicy::kLRU>>(way.cache);
+  EraseFromWay(way, key);
+
+  std::size_t bytes = 0;
+  if (way.max_bytes != 0) {
+    bytes = size_estimator_(key, value);
+    if (bytes > way.max_bytes) return;
+  }
+
+  while (cache.GetSize() >= cache.GetCapacity() ||
+         (way.max_bytes != 0 && way.bytes + bytes > way.max_bytes)) {
+    EvictLeastUsed(way);
+  }
+  cache.Put(key, std::move(value));
+  way.bytes += bytes;
+}
+
+template <typename T, typename U, typename Hash, typename Equal>
+void NWayLRU<T, U, Hash, Equal>::EraseFromWay(Way& way, const T& key) {
+  if (way.max_bytes == 0) {
+    way.Visit([&key](auto& cache) { cache.Erase(key); });
+    return;
+  }
+
+  auto& cache = std::get<Cache<CachePolicy::kLRU>>(way.cache);
+  const auto* value = cache.Get(key);
+  if (value) {
+    way.bytes -= std::min(size_estimator_(key, *value), way.bytes);
+    cache.Erase(key);
+  }
+}
+
+template <typename T, typename U, typename Hash, typename Equal>
+void NWayLRU<T, U, Hash, Equal>::EvictLeastUsed(Way& way) {
+  auto& cache = std::get<Cache<CachePolicy::kLRU>>(way.cache);
+  const auto* key = cache.GetLeastUsedKey();
+  if (!key) {
+    way.bytes = 0;
+    return;
+  }
+
+  if (way.max_bytes != 0) {
+    const auto bytes = size_estimator_(*key, *cache.GetLeastUsed());
+    way.bytes -= std::min(bytes, way.bytes);
+  }
+  if (eviction_callback_) eviction_callback_(*key, *cache.GetLeastUsed());
+  cache.Erase(*key);
+}
+
+template <typename T, typename U, typename Hash, typename Equal>
+std::size_t NWayLRU<T, U, Hash, Equal>::CountBytes(const Way& way) const {
+  std::size_t bytes = 0;
+  way.Visit([this, &bytes](const auto& cache) {
+    cache.VisitAll([this, &bytes](const T& key, const U& value) {
+      bytes += size_estimator_(key, value);
+    });
+  });
+  return bytes;
+}
+
 template <typename T, typename U, typename Hash, typename Equal>
 void NWayLRU<T, U, Hash, Equal>::NotifyDumper() {
   if (dumper_ != nullptr) {
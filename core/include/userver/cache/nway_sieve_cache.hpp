@@ -0,0 +1,378 @@
+#pragma once
+
+/// @file userver/cache/nway_sieve_cache.hpp
+/// @brief @copybrief cache::NWaySieveCache
+
+#include <atomic>
+#include <functional>
+#include <iterator>
+#include <list>
+#include <memory>
+#include <optional>
+#include <stdexcept>
+#include <unordered_map>
+#include <vector>
+
+#include <boost/container_hash/hash.hpp>
+
+#include <userver/dump/dumper.hpp>
+#include <userver/dump/operations.hpp>
+#include <userver/engine/mutex.hpp>
+#include <userver/rcu/rcu.hpp>
+#include <userver/utils/assert.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace cache {
+
+/// @ingroup userver_containers
+///
+/// @brief Read-optimized alternative to cache::NWayLRU with the SIEVE
+/// eviction, see https://junchengyang.com/publication/nsdi24-SIEVE.pdf
+///
+/// Lookups do not take any mutex: the index of each way is an rcu::Variable,
+/// and a hit only sets the 'visited' flag of the element if it is not set yet.
+/// Inserts, updates and invalidations take the writer's mutex of the way and
+/// copy its index, so the container suits the read-heavy caches with a high
+/// hit ratio. Use more ways for the bigger caches to keep the copies small.
+///
+/// On eviction the 'hand' walks the elements from the oldest to the newest
+/// ones, clears the 'visited' flags and evicts the first element that was not
+/// visited since the previous pass.
+///
+/// Provides the same interface as cache::NWayLRU, except for the limits in
+/// bytes and the eviction policies.
+template <typename T, typename U, typename Hash = std::hash<T>,
+          typename Equal = std::equal_to<T>>
+class NWaySieveCache final {
+ public:
+  /// For the description of `ways` and `way_size`,
+  /// see the cache::NWayLRU::NWayLRU constructor.
+  NWaySieveCache(size_t ways, size_t way_size, const Hash& hash = Hash(),
+                 const Equal& equal = Equal());
+
+  void Put(const T& key, U value);
+
+  template <typename Validator>
+  std::optional<U> Get(const T& key, Validator validator);
+
+  std::optional<U> Get(const T& key) {
+    return Get(key, [](const U&) { return true; });
+  }
+
+  U GetOr(const T& key, const U& default_value);
+
+  void Invalidate();
+
+  void InvalidateByKey(const T& key);
+
+  /// Iterates over all items. May be slow for big caches.
+  template <typename Function>
+  void VisitAll(Function func) const;
+
+  size_t GetSize() const;
+
+  /// For the description of `way_size`,
+  /// see the cache::NWayLRU::NWayLRU constructor.
+  void UpdateWaySize(size_t way_size);
+
+  void Write(dump::Writer& writer) const;
+  void Read(dump::Reader& reader);
+
+  /// The dump::Dumper will be notified of any cache updates. This method is not
+  /// thread-safe.
+  void SetDumper(std::shared_ptr<dump::Dumper> dumper);
+
+ private:
+  struct Node;
+  using NodePtr = std::shared_ptr<Node>;
+  // From the newest to the oldest elements
+  using Queue = std::list<NodePtr>;
+
+  struct Node {
+    Node(const T& key, U&& value) : key(key), value(std::move(value)) {}
+
+    const T key;
+    const U value;
+    std::atomic<bool> visited{false};
+    // Modified only by the writers
+    typename Queue::iterator position;
+  };
+
+  using Index = std::unordered_map<T, NodePtr, Hash, Equal>;
+
+  struct IndexRcuTraits {
+    using MutexType = engine::Mutex;
+    using ReclamationPolicy = rcu::AmortizedReclamation;
+  };
+
+  struct Way {
+    Way(const Hash& hash, const Equal& equal)
+        : hash(hash), equal(equal), index(0, hash, equal) {}
+
+    const Hash hash;
+    const Equal equal;
+    rcu::Variable<Index, IndexRcuTraits> index;
+
+    // Protected by the writer's mutex of the index
+    Queue queue;
+    typename Queue::iterator hand{queue.end()};
+  };
+
+  Way& GetWay(const T& key);
+
+  void Erase(Way& way, Index& index, typename Index::iterator it);
+  void EvictOne(Way& way, Index& index);
+  void EraseNode(Way& way, const NodePtr& node);
+
+  void NotifyDumper();
+
+  std::vector<std::unique_ptr<Way>> ways_;
+  std::atomic<size_t> way_size_;
+  Hash hash_fn_;
+  std::shared_ptr<dump::Dumper> dumper_{nullptr};
+};
+
+template <typename T, typename U, typename Hash, typename Eq>
+NWaySieveCache<T, U, Hash, Eq>::NWaySieveCache(size_t ways, size_t way_size,
+                                               const Hash& hash,
+                                               const Eq& equal)
+    : way_size_(way_size), hash_fn_(hash) {
+  if (ways == 0) throw std::logic_error("Ways must be positive");
+  if (way_size == 0) throw std::logic_error("Way size must be positive");
+
+  ways_.reserve(ways);
+  for (size_t i = 0; i < ways; ++i) {
+    ways_.push_back(std::make_unique<Way>(hash, equal));
+  }
+}
+
+template <typename T, typename U, typename Hash, typename Eq>
+void NWaySieveCache<T, U, Hash, Eq>::Put(const T& key, U value) {
+  auto& way = GetWay(key);
+  {
+    auto index = way.index.StartWrite();
+    auto node = std::make_shared<Node>(key, std::move(value));
+
+    const auto it = index->find(key);
+    if (it != index->end()) {
+      node->visited.store(true, std::memory_order_relaxed);
+      node->position = it->second->position;
+      *node->position = node;
+      it->second = std::move(node);
+      index.Commit();
+      NotifyDumper();
+      return;
+    }
+
+    while (index->size() >= way_size_.load()) EvictOne(way, *index);
+
+    try {
+      way.queue.push_front(node);
+      node->position = way.queue.begin();
+      try {
+        index->emplace(key, std::move(node));
+      } catch (...) {
+        way.queue.pop_front();
+        throw;
+      }
+    } catch (...) {
+      // Keep the queue and the index consistent after the evictions
+      index.Commit();
+      throw;
+    }
+    index.Commit();
+  }
+  NotifyDumper();
+}
+
+template <typename T, typename U, typename Hash, typename Eq>
+template <typename Validator>
+std::optional<U> NWaySieveCache<T, U, Hash, Eq>::Get(const T& key,
+                                                     Validator validator) {
+  auto& way = GetWay(key);
+  NodePtr node;
+  {
+    const auto index = way.index.Read();
+    const auto it = index->find(key);
+    if (it == index->end()) return std::nullopt;
+
+    // Avoids writes to the shared cache line for the hot elements
+    if (!it->second->visited.load(std::memory_order_relaxed)) {
+      it->second->visited.store(true, std::memory_order_relaxed);
+    }
+    if (validator(it->second->value)) return it->second->value;
+    node = it->second;
+  }
+
+  EraseNode(way, node);
+  return std::nullopt;
+}
+
+template <typename T, typename U, typename Hash, typename Eq>
+U NWaySieveCache<T, U, Hash, Eq>::GetOr(const T& key, const U& default_value) {
+  auto value = Get(key);
+  if (value) return std::move(*value);
+  return default_value;
+}
+
+template <typename T, typename U, typename Hash, typename Eq>
+void NWaySieveCache<T, U, Hash, Eq>::Invalidate() {
+  for (auto& way : ways_) {
+    auto index = way->index.StartWriteEmplace(0, way->hash, way->equal);
+    way->queue.clear();
+    way->hand = way->queue.end();
+    index.Commit();
+  }
+  NotifyDumper();
+}
+
+template <typename T, typename U, typename Hash, typename Eq>
+void NWaySieveCache<T, U, Hash, Eq>::InvalidateByKey(const T& key) {
+  auto& way = GetWay(key);
+  {
+    {
+      const auto current = way.index.Read();
+      if (current->count(key) == 0) return;
+    }
+
+    auto index = way.index.StartWrite();
+    const auto it = index->find(key);
+    if (it == index->end()) return;
+    Erase(way, *index, it);
+    index.Commit();
+  }
+  NotifyDumper();
+}
+
+template <typename T, typename U, typename Hash, typename Eq>
+template <typename Function>
+void NWaySieveCache<T, U, Hash, Eq>::VisitAll(Function func) const {
+  for (const auto& way : ways_) {
+    const auto index = way->index.Read();
+    for (const auto& [key, node] : *index) func(key, node->value);
+  }
+}
+
+template <typename T, typename U, typename Hash, typename Eq>
+size_t NWaySieveCache<T, U, Hash, Eq>::GetSize() const {
+  size_t size{0};
+  for (const auto& way : ways_) {
+    const auto index = way->index.Read();
+    size += index->size();
+  }
+  return size;
+}
+
+template <typename T, typename U, typename Hash, typename Eq>
+void NWaySieveCache<T, U, Hash, Eq>::UpdateWaySize(size_t way_size) {
+  if (way_size == 0) throw std::logic_error("Way size must be positive");
+
+  way_size_ = way_size;
+  for (auto& way : ways_) {
+    {
+      const auto current = way->index.Read();
+      if (current->size() <= way_size) continue;
+    }
+
+    auto index = way->index.StartWrite();
+    while (index->size() > way_size) EvictOne(*way, *index);
+    index.Commit();
+  }
+}
+
+template <typename T, typename U, typename Hash, typename Eq>
+void NWaySieveCache<T, U, Hash, Eq>::Write(dump::Writer& writer) const {
+  writer.Write(ways_.size());
+
+  for (const auto& way : ways_) {
+    const auto index = way->index.Read();
+    writer.Write(index->size());
+    for (const auto& [key, node] : *index) {
+      writer.Write(key);
+      writer.Write(node->value);
+    }
+  }
+}
+
+template <typename T, typename U, typename Hash, typename Eq>
+void NWaySieveCache<T, U, Hash, Eq>::Read(dump::Reader& reader) {
+  Invalidate();
+
+  const auto ways = reader.Read<std::size_t>();
+  for (std::size_t i = 0; i < ways; ++i) {
+    const auto elements_in_way = reader.Read<std::size_t>();
+    for (std::size_t j = 0; j < elements_in_way; ++j) {
+      auto key = reader.Read<T>();
+      auto value = reader.Read<U>();
+      Put(std::move(key), std::move(value));
+    }
+  }
+}
+
+template <typename T, typename U, typename Hash, typename Eq>
+void NWaySieveCache<T, U, Hash, Eq>::SetDumper(
+    std::shared_ptr<dump::Dumper> dumper) {
+  dumper_ = std::move(dumper);
+}
+
+template <typename T, typename U, typename Hash, typename Eq>
+typename NWaySieveCache<T, U, Hash, Eq>::Way&
+NWaySieveCache<T, U, Hash, Eq>::GetWay(const T& key) {
+  // The hash is twisted for the same reason as in NWayLRU::GetWay
+  auto seed = hash_fn_(key);
+  boost::hash_combine(seed, 0);
+  return *ways_[seed % ways_.size()];
+}
+
+template <typename T, typename U, typename Hash, typename Eq>
+void NWaySieveCache<T, U, Hash, Eq>::Erase(Way& way, Index& index,
+                                           typename Index::iterator it) {
+  const auto position = it->second->position;
+  if (way.hand == position) {
+    way.hand = position == way.queue.begin() ? way.queue.end()
+                                             : std::prev(position);
+  }
+  way.queue.erase(position);
+  index.erase(it);
+}
+
+template <typename T, typename U, typename Hash, typename Eq>
+void NWaySieveCache<T, U, Hash, Eq>::EvictOne(Way& way, Index& index) {
+  UASSERT(!way.queue.empty());
+
+  auto hand = way.hand == way.queue.end() ? std::prev(way.queue.end())
+                                          : way.hand;
+  while ((*hand)->visited.load(std::memory_order_relaxed)) {
+    (*hand)->visited.store(false, std::memory_order_relaxed);
+    hand = hand == way.queue.begin() ? std::prev(way.queue.end())
+                                     : std::prev(hand);
+  }
+
+  way.hand = hand;
+  Erase(way, index, index.find((*hand)->key));
+}
+
+template <typename T, typename U, typename Hash, typename Eq>
+void NWaySieveCache<T, U, Hash, Eq>::EraseNode(Way& way, const NodePtr& node) {
+  {
+    auto index = way.index.StartWrite();
+    const auto it = index->find(node->key);
+    // The element might have been replaced concurrently
+    if (it == index->end() || it->second != node) return;
+    Erase(way, *index, it);
+    index.Commit();
+  }
+  NotifyDumper();
+}
+
+template <typename T, typename U, typename Hash, typename Eq>
+void NWaySieveCache<T, U, Hash, Eq>::NotifyDumper() {
+  if (dumper_ != nullptr) {
+    dumper_->OnUpdateCompleted();
+  }
+}
+
+}  // namespace cache
+
+USERVER_NAMESPACE_END
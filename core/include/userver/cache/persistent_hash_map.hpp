@@ -0,0 +1,514 @@
+#pragma once
+
+/// @file userver/cache/persistent_hash_map.hpp
+/// @brief @copybrief cache::PersistentHashMap
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <iterator>
+#include <memory>
+#include <stdexcept>
+#include <utility>
+#include <variant>
+#include <vector>
+
+#include <userver/dump/meta.hpp>
+#include <userver/dump/operations.hpp>
+#include <userver/utils/assert.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace cache {
+
+/// @ingroup userver_containers
+///
+/// @brief Hash map with the structural sharing between its copies, a hash
+/// array mapped trie.
+///
+/// A copy takes O(1), the modifications of a copy take O(log32(size)) and
+/// copy only the nodes on the path to the modified element, all the other
+/// nodes and elements stay shared with the original. That makes it a
+/// container for the caches with UpdateType::kIncremental updates: the
+/// update copies the current snapshot, applies the changes, and the cost
+/// of the update is proportional to the number of changes rather than to the
+/// size of the cache. The snapshots kept alive by the readers share the
+/// memory with the newer ones.
+///
+/// For a PostgreCache set `using CacheContainer = cache::PersistentHashMap<
+/// Key, Value>;` in the policy.
+///
+/// Different copies may be used concurrently, a single copy is not
+/// thread-safe for modifications. The iterators are invalidated by any
+/// modification of the container.
+template <typename Key, typename Value, typename Hash = std::hash<Key>,
+          typename Equal = std::equal_to<Key>>
+class PersistentHashMap final {
+ public:
+  using key_type = Key;
+  using mapped_type = Value;
+  using value_type = std::pair<const Key, Value>;
+  using size_type = std::size_t;
+  using hasher = Hash;
+  using key_equal = Equal;
+
+  class const_iterator;
+  using iterator = const_iterator;
+
+  PersistentHashMap() = default;
+
+  explicit PersistentHashMap(const Hash& hash, const Equal& equal = Equal())
+      : hash_(hash), equal_(equal) {}
+
+  size_type size() const noexcept { return size_; }
+  bool empty() const noexcept { return size_ == 0; }
+
+  void clear() noexcept {
+    root_.reset();
+    size_ = 0;
+  }
+
+  const_iterator begin() const { return const_iterator{root_.get()}; }
+  const_iterator end() const noexcept { return const_iterator{}; }
+  const_iterator cbegin() const { return begin(); }
+  const_iterator cend() const noexcept { return end(); }
+
+  const_iterator find(const Key& key) const;
+
+  size_type count(const Key& key) const { return find(key) != end() ? 1 : 0; }
+  bool contains(const Key& key) const { return find(key) != end(); }
+
+  /// @throws std::out_of_range if there is no such key
+  const Value& at(const Key& key) const;
+
+  /// Returns false if the key was present, the value is not changed then
+  bool insert(value_type value);
+
+  /// Returns true if the key was not present
+  template <typename V>
+  bool insert_or_assign(Key key, V&& value);
+
+  size_type erase(const Key& key);
+
+  void swap(PersistentHashMap& other) noexcept;
+
+ private:
+  struct Entry final {
+    template <typename... Args>
+    explicit Entry(std::size_t hash, Args&&... args)
+        : hash(hash), value(std::forward<Args>(args)...) {}
+
+    const std::size_t hash;
+    const value_type value;
+  };
+
+  struct Node;
+
+  using EntryPtr = std::shared_ptr<const Entry>;
+  using NodePtr = std::shared_ptr<const Node>;
+  using Child = std::variant<EntryPtr, NodePtr>;
+
+  // A node below the last hash bits holds the entries with equal
+  // hashes, its bitmap is not used
+  struct Node final {
+    std::uint32_t bitmap{0};
+    // Ordered by the bits of the bitmap
+    std::vector<Child> children;
+  };
+
+  static constexpr int kBitsPerLevel = 5;
+  static constexpr int kHashBits = sizeof(std::size_t) * 8;
+  // The levels of the hash bits and the level of the equal hashes
+  static constexpr std::size_t kMaxDepth =
+      (kHashBits + kBitsPerLevel - 1) / kBitsPerLevel + 1;
+
+  // The nodes on the path to an element with the index of the next child to
+  // visit in each of them
+  struct Path final {
+    std::array<std::pair<const Node*, std::size_t>, kMaxDepth> nodes{};
+    std::size_t depth{0};
+  };
+
+  static std::uint32_t GetBit(std::size_t hash, int shift) noexcept {
+    return std::uint32_t{1} << ((hash >> shift) & ((1 << kBitsPerLevel) - 1));
+  }
+
+  static std::size_t GetIndex(const Node& node, std::uint32_t bit) noexcept {
+    return __builtin_popcount(node.bitmap & (bit - 1));
+  }
+
+  static NodePtr MakeSubtree(EntryPtr first, EntryPtr second, int shift);
+
+  NodePtr Assoc(const NodePtr& node, int shift, EntryPtr&& entry,
+                bool is_assign, bool& is_inserted) const;
+
+  NodePtr Dissoc(const NodePtr& node, int shift, std::size_t hash,
+                 const Key& key, bool& is_erased) const;
+
+  NodePtr root_;
+  size_type size_{0};
+  Hash hash_;
+  Equal equal_;
+};
+
+/// @brief Forward iterator over the elements in an unspecified order
+template <typename Key, typename Value, typename Hash, typename Equal>
+class PersistentHashMap<Key, Value, Hash, Equal>::const_iterator final {
+ public:
+  using iterator_category = std::forward_iterator_tag;
+  using value_type = PersistentHashMap::value_type;
+  using difference_type = std::ptrdiff_t;
+  using pointer = const value_type*;
+  using reference = const value_type&;
+
+  const_iterator() = default;
+
+  reference operator*() const noexcept {
+    UASSERT(entry_);
+    return entry_->value;
+  }
+  pointer operator->() const noexcept { return &**this; }
+
+  const_iterator& operator++() {
+    Advance();
+    return *this;
+  }
+
+  const_iterator operator++(int) {
+    auto copy = *this;
+    Advance();
+    return copy;
+  }
+
+  bool operator==(const const_iterator& other) const noexcept {
+    return entry_ == other.entry_;
+  }
+  bool operator!=(const const_iterator& other) const noexcept {
+    return entry_ != other.entry_;
+  }
+
+ private:
+  friend class PersistentHashMap;
+
+  explicit const_iterator(const Node* root) {
+    if (root) {
+      path_.nodes[path_.depth++] = {root, 0};
+      Advance();
+    }
+  }
+
+  const_iterator(const Path& path, const Entry* entry)
+      : path_(path), entry_(entry) {}
+
+  void Advance() {
+    entry_ = nullptr;
+    while (path_.depth > 0) {
+      auto& [node, index] = path_.nodes[path_.depth - 1];
+      if (index == node->children.size()) {
+        --path_.depth;
+        continue;
+      }
+
+      const auto& child = node->children[index++];
+      if (const auto* entry = std::get_if<EntryPtr>(&child)) {
+        entry_ = entry->get();
+        return;
+      }
+      UASSERT(path_.depth < kMaxDepth);
+      path_.nodes[path_.depth++] = {std::get<NodePtr>(child).get(), 0};
+    }
+  }
+
+  Path path_;
+  const Entry* entry_{nullptr};
+};
+
+template <typename Key, typename Value, typename Hash, typename Equal>
+auto PersistentHashMap<Key, Value, Hash, Equal>::find(const Key& key) const
+    -> const_iterator {
+  const auto hash = hash_(key);
+  Path path;
+  const Node* node = root_.get();
+
+  for (int shift = 0; node; shift += kBitsPerLevel) {
+    if (shift >= kHashBits) {
+      for (std::size_t i = 0; i < node->children.size(); ++i) {
+        const auto& entry = std::get<EntryPtr>(node->children[i]);
+        if (equal_(entry->value.first, key)) {
+          path.nodes[path.depth++] = {node, i + 1};
+          return const_iterator{path, entry.get()};
+        }
+      }
+      return end();
+    }
+
+    const auto bit = GetBit(hash, shift);
+    if (!(node->bitmap & bit)) return end();
+
+    const auto index = GetIndex(*node, bit);
+    path.nodes[path.depth++] = {node, index + 1};
+    const auto& child = node->children[index];
+    if (const auto* entry = std::get_if<EntryPtr>(&child)) {
+      if ((*entry)->hash != hash || !equal_((*entry)->value.first, key)) {
+        return end();
+      }
+      return const_iterator{path, entry->get()};
+    }
+    node = std::get<NodePtr>(child).get();
+  }
+  return end();
+}
+
+template <typename Key, typename Value, typename Hash, typename Equal>
+const Value& PersistentHashMap<Key, Value, Hash, Equal>::at(
+    const Key& key) const {
+  const auto it = find(key);
+  if (it == end()) throw std::out_of_range("PersistentHashMap::at");
+  return it->second;
+}
+
+template <typename Key, typename Value, typename Hash, typename Equal>
+bool PersistentHashMap<Key, Value, Hash, Equal>::insert(value_type value) {
+  const auto hash = hash_(value.first);
+  bool is_inserted = false;
+  root_ = Assoc(root_, 0, std::make_shared<const Entry>(hash, std::move(value)),
+                /*is_assign=*/false, is_inserted);
+  if (is_inserted) ++size_;
+  return is_inserted;
+}
+
+template <typename Key, typename Value, typename Hash, typename Equal>
+template <typename V>
+bool PersistentHashMap<Key, Value, Hash, Equal>::insert_or_assign(Key key,
+                                                                  V&& value) {
+  const auto hash = hash_(key);
+  bool is_inserted = false;
+  root_ = Assoc(root_, 0,
+                std::make_shared<const Entry>(hash, std::move(key),
+                                              std::forward<V>(value)),
+                /*is_assign=*/true, is_inserted);
+  if (is_inserted) ++size_;
+  return is_inserted;
+}
+
+template <typename Key, typename Value, typename Hash, typename Equal>
+auto PersistentHashMap<Key, Value, Hash, Equal>::erase(const Key& key)
+    -> size_type {
+  bool is_erased = false;
+  root_ = Dissoc(root_, 0, hash_(key), key, is_erased);
+  if (!is_erased) return 0;
+  --size_;
+  return 1;
+}
+
+template <typename Key, typename Value, typename Hash, typename Equal>
+void PersistentHashMap<Key, Value, Hash, Equal>::swap(
+    PersistentHashMap& other) noexcept {
+  using std::swap;
+  swap(root_, other.root_);
+  swap(size_, other.size_);
+  swap(hash_, other.hash_);
+  swap(equal_, other.equal_);
+}
+
+template <typename Key, typename Value, typename Hash, typename Equal>
+auto PersistentHashMap<Key, Value, Hash, Equal>::MakeSubtree(EntryPtr first,
+                                                             EntryPtr second,
+                                                             int shift)
+    -> NodePtr {
+  auto node = std::make_shared<Node>();
+  if (shift >= kHashBits) {
+    node->children.reserve(2);
+    node->children.emplace_back(std::move(first));
+    node->children.emplace_back(std::move(second));
+    return node;
+  }
+
+  const auto first_bit = GetBit(first->hash, shift);
+  const auto second_bit = GetBit(second->hash, shift);
+  if (first_bit == second_bit) {
+    node->bitmap = first_bit;
+    node->children.emplace_back(MakeSubtree(std::move(first), std::move(second),
+                                            shift + kBitsPerLevel));
+    return node;
+  }
+
+  node->bitmap = first_bit | second_bit;
+  node->children.reserve(2);
+  if (first_bit > second_bit) std::swap(first, second);
+  node->children.emplace_back(std::move(first));
+  node->children.emplace_back(std::move(second));
+  return node;
+}
+
+template <typename Key, typename Value, typename Hash, typename Equal>
+auto PersistentHashMap<Key, Value, Hash, Equal>::Assoc(
+    const NodePtr& node, int shift, EntryPtr&& entry, bool is_assign,
+    bool& is_inserted) const -> NodePtr {
+  if (!node) {
+    UASSERT(shift == 0);
+    is_inserted = true;
+    auto root = std::make_shared<Node>();
+    root->bitmap = GetBit(entry->hash, shift);
+    root->children.emplace_back(std::move(entry));
+    return root;
+  }
+
+  if (shift >= kHashBits) {
+    for (std::size_t i = 0; i < node->children.size(); ++i) {
+      const auto& old_entry = std::get<EntryPtr>(node->children[i]);
+      if (equal_(old_entry->value.first, entry->value.first)) {
+        if (!is_assign) return node;
+        auto copy = std::make_shared<Node>(*node);
+        copy->children[i] = std::move(entry);
+        return copy;
+      }
+    }
+    is_inserted = true;
+    auto copy = std::make_shared<Node>(*node);
+    copy->children.emplace_back(std::move(entry));
+    return copy;
+  }
+
+  const auto bit = GetBit(entry->hash, shift);
+  const auto index = GetIndex(*node, bit);
+  if (!(node->bitmap & bit)) {
+    is_inserted = true;
+    auto copy = std::make_shared<Node>(*node);
+    copy->bitmap |= bit;
+    copy->children.emplace(copy->children.begin() + index, std::move(entry));
+    return copy;
+  }
+
+  const auto& child = node->children[index];
+  Child new_child;
+  if (const auto* old_entry = std::get_if<EntryPtr>(&child)) {
+    if ((*old_entry)->hash == entry->hash &&
+        equal_((*old_entry)->value.first, entry->value.first)) {
+      if (!is_assign) return node;
+      new_child = std::move(entry);
+    } else {
+      is_inserted = true;
+      new_child = MakeSubtree(*old_entry, std::move(entry),
+                              shift + kBitsPerLevel);
+    }
+  } else {
+    const auto& old_node = std::get<NodePtr>(child);
+    auto new_node = Assoc(old_node, shift + kBitsPerLevel, std::move(entry),
+                          is_assign, is_inserted);
+    if (new_node == old_node) return node;
+    new_child = std::move(new_node);
+  }
+
+  auto copy = std::make_shared<Node>(*node);
+  copy->children[index] = std::move(new_child);
+  return copy;
+}
+
+template <typename Key, typename Value, typename Hash, typename Equal>
+auto PersistentHashMap<Key, Value, Hash, Equal>::Dissoc(
+    const NodePtr& node, int shift, std::size_t hash, const Key& key,
+    bool& is_erased) const -> NodePtr {
+  if (!node) return node;
+
+  std::size_t index = 0;
+  if (shift >= kHashBits) {
+    while (index < node->children.size() &&
+           !equal_(std::get<EntryPtr>(node->children[index])->value.first,
+                   key)) {
+      ++index;
+    }
+    if (index == node->children.size()) return node;
+  } else {
+    const auto bit = GetBit(hash, shift);
+    if (!(node->bitmap & bit)) return node;
+    index = GetIndex(*node, bit);
+
+    const auto& child = node->children[index];
+    if (const auto* entry = std::get_if<EntryPtr>(&child)) {
+      if ((*entry)->hash != hash || !equal_((*entry)->value.first, key)) {
+        return node;
+      }
+    } else {
+      const auto& old_node = std::get<NodePtr>(child);
+      auto new_node =
+          Dissoc(old_node, shift + kBitsPerLevel, hash, key, is_erased);
+      if (!is_erased) return node;
+
+      if (new_node) {
+        auto copy = std::make_shared<Node>(*node);
+        // A single entry is lifted up, so that the trie stays as shallow as
+        // possible
+        if (new_node->children.size() == 1 &&
+            std::holds_alternative<EntryPtr>(new_node->children.front())) {
+          copy->children[index] = new_node->children.front();
+        } else {
+          copy->children[index] = std::move(new_node);
+        }
+        return copy;
+      }
+      // The subtree got empty, the child is removed below
+    }
+  }
+
+  is_erased = true;
+  if (node->children.size() == 1) return nullptr;
+
+  auto copy = std::make_shared<Node>(*node);
+  if (shift < kHashBits) copy->bitmap &= ~GetBit(hash, shift);
+  copy->children.erase(copy->children.begin() + index);
+  return copy;
+}
+
+template <typename Key, typename Value, typename Hash, typename Equal>
+bool operator==(const PersistentHashMap<Key, Value, Hash, Equal>& lhs,
+                const PersistentHashMap<Key, Value, Hash, Equal>& rhs) {
+  if (lhs.size() != rhs.size()) return false;
+  for (const auto& [key, value] : lhs) {
+    const auto it = rhs.find(key);
+    if (it == rhs.end() || !(it->second == value)) return false;
+  }
+  return true;
+}
+
+template <typename Key, typename Value, typename Hash, typename Equal>
+bool operator!=(const PersistentHashMap<Key, Value, Hash, Equal>& lhs,
+                const PersistentHashMap<Key, Value, Hash, Equal>& rhs) {
+  return !(lhs == rhs);
+}
+
+template <typename Key, typename Value, typename Hash, typename Equal>
+void swap(PersistentHashMap<Key, Value, Hash, Equal>& lhs,
+          PersistentHashMap<Key, Value, Hash, Equal>& rhs) noexcept {
+  lhs.swap(rhs);
+}
+
+template <typename Key, typename Value, typename Hash, typename Equal>
+std::enable_if_t<dump::kIsWritable<Key> && dump::kIsWritable<Value>> Write(
+    dump::Writer& writer,
+    const PersistentHashMap<Key, Value, Hash, Equal>& map) {
+  writer.Write(map.size());
+  for (const auto& [key, value] : map) {
+    writer.Write(key);
+    writer.Write(value);
+  }
+}
+
+template <typename Key, typename Value, typename Hash, typename Equal>
+std::enable_if_t<dump::kIsReadable<Key> && dump::kIsReadable<Value>,
+                 PersistentHashMap<Key, Value, Hash, Equal>>
+Read(dump::Reader& reader,
+     dump::To<PersistentHashMap<Key, Value, Hash, Equal>>) {
+  const auto size = reader.Read<std::size_t>();
+  PersistentHashMap<Key, Value, Hash, Equal> result;
+  for (std::size_t i = 0; i < size; ++i) {
+    auto key = reader.Read<Key>();
+    result.insert_or_assign(std::move(key), reader.Read<Value>());
+  }
+  return result;
+}
+
+}  // namespace cache
+
+USERVER_NAMESPACE_END
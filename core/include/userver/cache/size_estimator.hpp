@@ -0,0 +1,71 @@
+#pragma once
+
+/// @file userver/cache/size_estimator.hpp
+/// @brief @copybrief cache::DefaultSizeEstimator
+
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+
+#include <userver/utils/meta.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace cache {
+
+namespace impl {
+
+template <typename T>
+using CapacityResult = decltype(std::declval<const T&>().capacity());
+
+template <typename T>
+using EstimateMemoryUsageResult =
+    decltype(EstimateMemoryUsage(std::declval<const T&>()));
+
+}  // namespace impl
+
+/// @brief Returns an estimate of the memory used by the value, including the
+/// heap memory of the strings and containers
+///
+/// Types with an `EstimateMemoryUsage(const T&)` function in their namespace
+/// (e.g. formats::json::Value) are accounted by that function. Contiguous
+/// containers of trivially copyable elements are accounted by their
+/// capacity, other ranges element by element.
+template <typename T>
+std::size_t EstimateSize(const T& value) {
+  if constexpr (meta::kIsDetected<impl::EstimateMemoryUsageResult, T>) {
+    return EstimateMemoryUsage(value);
+  } else if constexpr (meta::kIsInstantiationOf<std::pair, T>) {
+    return EstimateSize(value.first) + EstimateSize(value.second);
+  } else if constexpr (meta::kIsRange<T>) {
+    using Element = std::remove_cv_t<meta::RangeValueType<T>>;
+    if constexpr (std::is_trivially_copyable_v<Element> &&
+                  meta::kIsDetected<impl::CapacityResult, T>) {
+      return sizeof(T) + value.capacity() * sizeof(Element);
+    } else {
+      std::size_t size = sizeof(T);
+      for (const auto& element : value) size += EstimateSize(element);
+      return size;
+    }
+  } else {
+    return sizeof(T);
+  }
+}
+
+/// @brief Estimates the memory used by a cache entry as the sizes of the key
+/// and the value (see cache::EstimateSize) plus the bookkeeping of the cache
+///
+/// Provide a custom estimator for the values that own memory in other ways,
+/// e.g. through smart pointers.
+struct DefaultSizeEstimator final {
+  static constexpr std::size_t kEntryOverhead = 4 * sizeof(void*);
+
+  template <typename Key, typename Value>
+  std::size_t operator()(const Key& key, const Value& value) const {
+    return EstimateSize(key) + EstimateSize(value) + kEntryOverhead;
+  }
+};
+
+}  // namespace cache
+
+USERVER_NAMESPACE_END
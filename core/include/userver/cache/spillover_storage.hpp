@@ -0,0 +1,152 @@
+#pragma once
+
+/// @file userver/cache/spillover_storage.hpp
+/// @brief @copybrief cache::SpilloverStorageBase
+
+#include <chrono>
+#include <cstddef>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include <userver/components/component_base.hpp>
+#include <userver/concurrent/variable.hpp>
+#include <userver/engine/mutex.hpp>
+#include <userver/utils/periodic_task.hpp>
+#include <userver/utils/statistics/entry.hpp>
+#include <userver/utils/statistics/rate_counter.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace cache {
+
+// clang-format off
+
+/// @ingroup userver_base_classes
+///
+/// @brief Base class for the components that store the entries evicted from
+/// cache::LruCacheComponent in a slower, but larger storage, e.g. on a local
+/// disk, so that the misses of the in-memory cache do not go to the upstream.
+///
+/// The entries are serialized with the dump serialization (see
+/// @ref scripts/docs/en/userver/cache_dumps.md), gathered for
+/// `flush-interval` and written in batches in background, so the eviction
+/// does not block. The pending entries are looked up before the storage. The
+/// expired entries are removed every `cleanup-interval`, the entries of the
+/// caches without a lifetime are only removed on invalidation.
+///
+/// The derived class implements the storage: DoWrite(), DoRead() and
+/// DoScan(). The records of all the caches share the storage.
+///
+/// See storages::rocks::CacheSpilloverStorage for the RocksDB storage.
+///
+/// ## Static options:
+/// Name | Description | Default value
+/// ---- | ----------- | -------------
+/// flush-interval | how long the evicted entries are gathered before writing | 100ms
+/// max-batch-size | max records in a write, reaching it writes the records right away | 1000
+/// max-pending-records | max records waiting for a write, the evicted entries are dropped when it is reached | 100000
+/// cleanup-interval | how often the expired records are removed | 10m
+
+// clang-format on
+class SpilloverStorageBase : public components::ComponentBase {
+ public:
+  SpilloverStorageBase(const components::ComponentConfig& config,
+                       const components::ComponentContext& context);
+
+  ~SpilloverStorageBase() override;
+
+  /// @brief Schedules writing of the `value` of the `key` of the cache
+  /// `cache_name`, does not block.
+  ///
+  /// The record may be removed after the `expiration`, use
+  /// `time_point::max()` to keep it until the invalidation.
+  void Store(std::string_view cache_name, std::string_view key,
+             std::string value,
+             std::chrono::system_clock::time_point expiration);
+
+  /// @brief Returns the value written by Store, std::nullopt if it is
+  /// missing, expired or the storage has failed.
+  std::optional<std::string> Load(std::string_view cache_name,
+                                  std::string_view key);
+
+  /// @brief Schedules removal of the `key` of the cache `cache_name`, does
+  /// not block.
+  void Remove(std::string_view cache_name, std::string_view key);
+
+  /// @brief Removes all the records of the cache `cache_name`, blocks until
+  /// they are removed.
+  void Clear(std::string_view cache_name);
+
+  static yaml_config::Schema GetStaticConfigSchema();
+
+ protected:
+  /// Record to write, std::nullopt `value` removes the record
+  struct Record final {
+    std::string key;
+    std::optional<std::string> value;
+  };
+
+  /// Record read from the storage
+  using KeyValue = std::pair<std::string, std::string>;
+
+  /// @brief Writes the `records` atomically.
+  /// @throws std::exception on failure, the records are dropped then
+  virtual void DoWrite(std::vector<Record> records) = 0;
+
+  /// @brief Returns the value of the `key`, std::nullopt if it is missing.
+  /// @throws std::exception on failure
+  virtual std::optional<std::string> DoRead(std::string_view key) = 0;
+
+  /// @brief Returns up to `limit` records with the keys not less than
+  /// `begin` in the key order.
+  /// @throws std::exception on failure
+  virtual std::vector<KeyValue> DoScan(std::string_view begin,
+                                       std::size_t limit) = 0;
+
+  void OnAllComponentsLoaded() final;
+  void OnAllComponentsAreStopping() final;
+
+ private:
+  using PendingRecords =
+      std::unordered_map<std::string, std::optional<std::string>>;
+
+  struct Statistics final {
+    utils::statistics::RateCounter stored{0};
+    utils::statistics::RateCounter dropped{0};
+    utils::statistics::RateCounter written{0};
+    utils::statistics::RateCounter write_errors{0};
+    utils::statistics::RateCounter hits{0};
+    utils::statistics::RateCounter misses{0};
+    utils::statistics::RateCounter read_errors{0};
+    utils::statistics::RateCounter expired{0};
+  };
+
+  void Schedule(std::string key, std::optional<std::string> value);
+  void Flush();
+  void WriteRecords(std::vector<Record> records);
+  void RemoveExpired();
+  void WriteStatistics(utils::statistics::Writer& writer) const;
+
+  const std::chrono::milliseconds flush_interval_;
+  const std::size_t max_batch_size_;
+  const std::size_t max_pending_records_;
+  const std::chrono::milliseconds cleanup_interval_;
+
+  concurrent::Variable<PendingRecords> pending_;
+  // Orders the writes of the flushes and Clear()
+  engine::Mutex write_mutex_;
+  Statistics stats_;
+  utils::PeriodicTask flush_task_;
+  utils::PeriodicTask cleanup_task_;
+
+  // Subscriptions must be the last fields.
+  utils::statistics::Entry statistics_holder_;
+};
+
+}  // namespace cache
+
+USERVER_NAMESPACE_END
@@ -33,6 +33,8 @@ namespace clients::dns {
 /// cache-size-per-way | size of each way of network cache | 256
 /// cache-max-reply-ttl | TTL limit for network replies caching | 5m
 /// cache-failure-ttl | TTL for network failures caching | 5s
+/// cache-refresh-ahead | used network cache entries are refreshed in background this long before they expire, never less than network-timeout | 10s
+/// cache-max-stale-time | for how long an expired network cache entry may be served while it is being refreshed, e.g. during upstream DNS failures | unlimited
 ///
 /// ## Static configuration example:
 ///
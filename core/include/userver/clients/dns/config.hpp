@@ -4,6 +4,7 @@
 /// @brief @copybrief clients::dns::ResolverConfig
 
 #include <chrono>
+#include <optional>
 #include <string>
 #include <vector>
 
@@ -39,6 +40,15 @@ struct ResolverConfig {
 
   /// Network cache failure TTL
   std::chrono::milliseconds cache_failure_ttl{std::chrono::seconds{5}};
+
+  /// Network cache entries that are used within this time before their
+  /// expiration are refreshed in background. Never less than network timeout.
+  std::chrono::milliseconds cache_refresh_ahead{std::chrono::seconds{10}};
+
+  /// For how long an expired network cache entry may still be served while
+  /// it is being refreshed, e.g. during upstream DNS failures. No limit if
+  /// not set.
+  std::optional<std::chrono::milliseconds> cache_max_stale_time;
 };
 
 }  // namespace clients::dns
@@ -7,7 +7,10 @@
 #error Use clients::Http from clients/http.hpp instead
 #endif
 
+#include <cstddef>
 #include <memory>
+#include <string>
+#include <vector>
 
 #include <userver/moodycamel/concurrentqueue_fwd.h>
 
@@ -37,6 +40,7 @@ namespace curl {
 class easy;
 class multi;
 class ConnectRateLimiter;
+class share;
 }  // namespace curl
 
 namespace engine::ev {
@@ -82,6 +86,19 @@ class Client final {
   /// @note This method is thread-safe despite being non-const.
   Request CreateNotSignedRequest() { return CreateRequest(); }
 
+  /// @brief Opens `connections` connections to each of the `urls` on every
+  /// IO thread by sending HEAD requests, so that the following requests to
+  /// those destinations do not pay for DNS, TCP and TLS handshakes.
+  ///
+  /// Waits for all the requests to finish, failures are only logged.
+  /// Connections are kept in the per-IO-thread connection cache, so
+  /// `connections` should not exceed its size, see
+  /// @ref HTTP_CLIENT_CONNECTION_POOL_SIZE.
+  ///
+  /// Is called periodically for ClientSettings::warmup_urls.
+  void WarmUp(const std::vector<std::string>& urls,
+              std::size_t connections = 1);
+
   /// @cond
   // For internal use only.
   void SetMultiplexingEnabled(bool enabled);
@@ -132,6 +149,9 @@ class Client final {
  private:
   void ReinitEasy();
 
+  Request CreateRequestOnMulti(std::size_t multi_index);
+  Request SetupRequest(impl::EasyWrapper&& wrapper, std::size_t multi_index);
+
   InstanceStatistics GetMultiStatistics(size_t n) const;
 
   size_t FindMultiIndex(const curl::multi*) const;
@@ -169,6 +189,8 @@ class Client final {
 
   utils::SwappingSmart<const curl::easy> easy_;
   utils::PeriodicTask easy_reinit_task_;
+  utils::PeriodicTask warmup_task_;
+  std::shared_ptr<curl::share> ssl_share_;
 
   // Testsuite support
   std::shared_ptr<const TestsuiteConfig> testsuite_config_;
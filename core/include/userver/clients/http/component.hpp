@@ -38,6 +38,12 @@ namespace components {
 /// thread-name-prefix | set OS thread name to this value | ''
 /// threads | number of threads to process low level HTTP related IO system calls | 8
 /// defer-events | whether to defer events execution to a periodic timer; might affect timings a bit, might boost performance, use with care | false
+/// http2-multiplexing | make concurrent HTTP/2 requests to the same host wait for and share a multiplexed connection instead of opening new ones | false
+/// http2-max-concurrent-streams | max number of concurrent streams on a single multiplexed HTTP/2 connection | 100
+/// max-host-connections | max number of connections to a single host per IO thread, 0 for no limit | 0
+/// warmup-urls | connections to these URLs are opened at startup and kept warm by periodic HEAD requests | []
+/// warmup-connections | number of warm connections to each of warmup-urls per IO thread | 1
+/// warmup-interval | how often the warm connections are probed and reopened if needed | 30s
 /// fs-task-processor | task processor to run blocking HTTP related calls, like DNS resolving or hosts reading | -
 /// destination-metrics-auto-max-size | set max number of automatically created destination metrics | 100
 /// user-agent | User-Agent HTTP header to show on all requests, result of utils::GetUserverIdentifier() if empty | empty
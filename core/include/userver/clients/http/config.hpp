@@ -1,7 +1,9 @@
 #pragma once
 
 #include <chrono>
+#include <cstddef>
 #include <string>
+#include <vector>
 
 #include <userver/dynamic_config/fwd.hpp>
 #include <userver/formats/json_fwd.hpp>
@@ -40,6 +42,23 @@ struct ClientSettings final {
   const tracing::TracingManagerBase* tracing_manager{nullptr};
   const server::http::HeadersPropagator* headers_propagator{nullptr};
   CancellationPolicy cancellation_policy{CancellationPolicy::kCancel};
+
+  /// Make concurrent HTTP/2 requests to the same host share a connection
+  /// instead of opening a new one per request
+  bool http2_multiplexing{false};
+  /// Max number of HTTP/2 streams on a single multiplexed connection
+  std::size_t http2_max_concurrent_streams{100};
+  /// Max number of connections to a single host per IO thread, 0 - no limit
+  std::size_t max_host_connections{0};
+
+  /// Connections to these URLs are opened at startup and kept warm,
+  /// see Client::WarmUp
+  std::vector<std::string> warmup_urls;
+  /// Number of connections to each of `warmup_urls` per IO thread
+  std::size_t warmup_connections{1};
+  /// How often the warm connections are probed and reopened if needed.
+  /// Should be less than the curl idle connection max age of 118s.
+  std::chrono::milliseconds warmup_interval{std::chrono::seconds{30}};
 };
 
 ClientSettings Parse(const yaml_config::YamlConfig& value,
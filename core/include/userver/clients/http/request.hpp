@@ -3,6 +3,7 @@
 /// @file userver/clients/http/request.hpp
 /// @brief @copybrief clients::http::Request
 
+#include <cstddef>
 #include <memory>
 #include <string_view>
 #include <vector>
@@ -10,6 +11,7 @@
 #include <userver/clients/dns/resolver_fwd.hpp>
 #include <userver/clients/http/error.hpp>
 #include <userver/clients/http/plugin.hpp>
+#include <userver/clients/http/request_body_writer.hpp>
 #include <userver/clients/http/response.hpp>
 #include <userver/clients/http/response_future.hpp>
 #include <userver/concurrent/queue.hpp>
@@ -157,6 +159,13 @@ class Request final {
   /// data for POST request
   Request& data(std::string data) &;
   Request data(std::string data) &&;
+  /// @brief Buffer to store the response body into, its capacity is reused.
+  ///
+  /// Useful to avoid reallocations when the same kind of responses are
+  /// received repeatedly: take the buffer back with
+  /// `std::move(*response).body()` and pass it to the next request.
+  Request& response_body_buffer(std::string buffer) &;
+  Request response_body_buffer(std::string buffer) &&;
   /// form for POST request
   Request& form(Form&& form) &;
   Request form(Form&& form) &&;
@@ -329,6 +338,19 @@ class Request final {
       utils::impl::SourceLocation location =
           utils::impl::SourceLocation::Current());
 
+  /// @brief Makes the request body streamed from the returned writer
+  /// instead of being taken from data().
+  ///
+  /// The body is sent as it is written, with chunked transfer encoding for
+  /// HTTP/1.1, so no more than `max_buffered_bytes` of it are kept in
+  /// memory. Retries are disabled for such requests. The HTTP method is
+  /// PUT unless set explicitly.
+  ///
+  /// Write the body after async_perform(), otherwise Write() blocks once
+  /// the buffer is full.
+  [[nodiscard]] RequestBodyWriter stream_body(
+      std::size_t max_buffered_bytes = 1024 * 1024);
+
   /// Calls async_perform and wait for timeout_ms on a future. Default time
   /// for waiting will be timeout value if it was set. If error occurred it
   /// will be thrown as exception.
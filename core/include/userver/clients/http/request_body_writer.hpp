@@ -0,0 +1,56 @@
+#pragma once
+
+/// @file userver/clients/http/request_body_writer.hpp
+/// @brief @copybrief clients::http::RequestBodyWriter
+
+#include <memory>
+#include <string>
+
+#include <userver/engine/deadline.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace clients::http {
+
+namespace impl {
+class UploadState;
+}  // namespace impl
+
+/// @brief Writer of a streamed HTTP request body.
+///
+/// Call Request::stream_body() to get one. Written chunks are buffered in
+/// a queue bounded in bytes, and Write() blocks while the queue is full, so
+/// a slow upstream slows down the writer instead of growing the memory usage.
+/// You can use it for proxying a large request body to a remote service.
+///
+/// @snippet clients/http/client_test.cpp  Sample HTTP Client streamed body
+class RequestBodyWriter final {
+ public:
+  RequestBodyWriter(RequestBodyWriter&&) noexcept;
+  RequestBodyWriter& operator=(RequestBodyWriter&&) noexcept;
+  RequestBodyWriter(const RequestBodyWriter&) = delete;
+  RequestBodyWriter& operator=(const RequestBodyWriter&) = delete;
+
+  /// Calls Finish()
+  ~RequestBodyWriter();
+
+  /// @brief Queues a chunk of the body for sending, blocks while the queue
+  /// is full.
+  /// @returns false if the request has already finished or the deadline
+  /// has expired; the chunk is not sent in that case.
+  [[nodiscard]] bool Write(std::string chunk, engine::Deadline deadline = {});
+
+  /// Marks the end of the body. No chunks can be written after that.
+  void Finish();
+
+  /// @cond
+  explicit RequestBodyWriter(std::shared_ptr<impl::UploadState> state);
+  /// @endcond
+
+ private:
+  std::shared_ptr<impl::UploadState> state_;
+};
+
+}  // namespace clients::http
+
+USERVER_NAMESPACE_END
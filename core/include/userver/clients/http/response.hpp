@@ -35,7 +35,8 @@ class Response final {
   std::string body() const& { return response_; }
   std::string&& body() && { return std::move(response_); }
 
-  /// body as string_view
+  /// body as string_view, parse it with formats::json::FromString() and
+  /// alike without copying the body
   std::string_view body_view() const { return response_; }
 
   /// return reference to headers
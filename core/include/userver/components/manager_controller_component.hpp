@@ -34,8 +34,14 @@ class Manager;
 /// coro_pool.max_size | max amount of coroutines to keep preallocated | 4000
 /// coro_pool.stack_size | size of a single coroutine | 256 * 1024
 /// coro_pool.local_cache_size | local coroutine cache size per thread | 32
+/// coro_pool.adaptive | periodically shrink the pool toward the recently observed high-water mark of active coroutines and return unused pages of idle stacks to the OS | false
+/// coro_pool.adaptive_trim_interval | how often to trim the pool in adaptive mode | 60s
 /// event_thread_pool.threads | number of threads to process low level IO system calls (number of ev loops to start in libev) | 2
 /// event_thread_pool.thread_name | set OS thread name to this value | 'event-worker'
+/// event_thread_pool.io_backend | how to wait for fd readiness: 'libev' io watchers or 'io-uring' poll requests submitted in batches (falls back to 'libev' if not supported by the kernel) | libev
+/// event_thread_pool.timer_backend | how to run task deadlines and sleeps: 'libev' timers or a per-thread 'timer-wheel' with 1ms resolution and batched expiry | libev
+/// event_thread_pool.cpu_set | CPUs to bind the ev threads to, in the cpuset(7) list format, e.g. '0-3,8'. CPUs of `numa_node` are used if not set | any CPU
+/// event_thread_pool.numa_node | NUMA node to bind the ev threads and their memory allocations to | any node
 /// components | dictionary of "component name": "options" | -
 /// default_task_processor | name of the default task processor to use in components | -
 /// task_processors.*NAME*.*OPTIONS* | dictionary of task processors to create and their options. See description below | -
@@ -51,6 +57,10 @@ class Manager;
 /// worker_threads | threads count for the task processor | -
 /// os-scheduling | OS scheduling mode for the task processor threads. 'idle' sets the lowest priority. 'low-priority' sets the priority below 'normal' but higher than 'idle'. | normal
 /// spinning-iterations | tunes the number of spin-wait iterations in case of an empty task queue before threads go to sleep | 1000
+/// task-processor-queue | Task queue mode for the task processor. 'global-task-queue' makes all the workers share a single queue. 'work-stealing-task-queue' gives each worker a local queue and lets idle workers steal tasks from their siblings, which reduces contention with many workers and many short tasks. | global-task-queue
+/// cpu-set | CPUs to bind the worker threads to, in the cpuset(7) list format, e.g. '0-3,8'. CPUs of `numa-node` are used if not set | any CPU
+/// numa-node | NUMA node to bind the worker threads and their memory allocations (including coroutine stacks) to. Cross-node task migrations are reported in the `context_switch.numa_migrations` metric | any node
+/// span-cpu-stats-top-size | enables accounting of the CPU time consumed by tasks per the current tracing span name, reports that many spans with the most CPU time and with the longest runs without a context switch in the `span-cpu` metrics | 0 (disabled)
 /// task-trace | optional dictionary of tracing options | empty (disabled)
 /// task-trace.every | set N to trace each Nth task | 1000
 /// task-trace.max-context-switch-count | set upper limit of context switches to trace for a single task | 1000
@@ -3,6 +3,8 @@
 /// @file userver/components/tcp_acceptor_base.hpp
 /// @brief @copybrief components::TcpAcceptorBase
 
+#include <vector>
+
 #include <userver/components/component_base.hpp>
 #include <userver/concurrent/background_task_storage.hpp>
 #include <userver/engine/io/socket.hpp>
@@ -34,6 +36,10 @@ namespace components {
 /// backlog | max count of new connections pending acceptance | 1024
 /// no_delay | whether to set the `TCP_NODELAY` option on incoming sockets | true
 /// sockets_task_processor | task processor to process accepted sockets | value of `task_processor`
+/// shards | how many listening sockets with their own accept loops share the port via `SO_REUSEPORT`, ignored for `unix-socket` | 1
+/// shards_cpu_steering | on Linux distribute new TCP connections among the shards by the CPU that received them rather than by the kernel hash of the addresses | false
+/// defer_accept | on Linux wake up the acceptor only when data arrives on a new connection or after the given timeout in seconds (`TCP_DEFER_ACCEPT`), 0 - disabled | 0
+/// fast_open_queue | max pending TCP Fast Open requests, 0 - disabled (`TCP_FASTOPEN`) | 0
 ///
 /// @see @ref scripts/docs/en/userver/tutorial/tcp_service.md
 
@@ -57,7 +63,7 @@ class TcpAcceptorBase : public ComponentBase {
                   const ComponentContext& context,
                   const server::net::ListenerConfig& acceptor_config);
 
-  void KeepAccepting();
+  void KeepAccepting(engine::io::Socket& listen_sock);
 
   void OnAllComponentsLoaded() final;
   void OnAllComponentsAreStopping() final;
@@ -66,8 +72,8 @@ class TcpAcceptorBase : public ComponentBase {
   engine::TaskProcessor& acceptor_task_processor_;
   engine::TaskProcessor& sockets_task_processor_;
   concurrent::BackgroundTaskStorageCore tasks_;
-  engine::io::Socket listen_sock_;
-  engine::Task acceptor_;
+  std::vector<engine::io::Socket> listen_socks_;
+  std::vector<engine::Task> acceptors_;
 };
 
 }  // namespace components
@@ -0,0 +1,367 @@
+#pragma once
+
+/// @file userver/concurrent/bounded_queue.hpp
+/// @brief @copybrief concurrent::GenericBoundedQueue
+
+#include <atomic>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <type_traits>
+#include <utility>
+
+#include <userver/concurrent/impl/ring_buffer.hpp>
+#include <userver/concurrent/queue.hpp>
+#include <userver/concurrent/queue_helpers.hpp>
+#include <userver/engine/condition_variable.hpp>
+#include <userver/engine/deadline.hpp>
+#include <userver/engine/mutex.hpp>
+#include <userver/utils/assert.hpp>
+#include <userver/utils/atomic.hpp>
+#include <userver/utils/span.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace concurrent {
+
+namespace impl {
+
+/// Tasks waiting for a condition of a lock-free structure. Notification is
+/// a seq_cst fence and a load if there are no waiters.
+class BoundedQueueWaitList final {
+ public:
+  /// Waits until `predicate` is true, it is checked after the waiter is
+  /// registered, so a concurrent Notify() is not missed
+  template <typename Predicate>
+  [[nodiscard]] bool WaitUntil(engine::Deadline deadline,
+                               Predicate&& predicate) {
+    std::unique_lock lock{mutex_};
+    waiters_.fetch_add(1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    const bool success =
+        cv_.WaitUntil(lock, deadline, std::forward<Predicate>(predicate));
+    waiters_.fetch_sub(1, std::memory_order_relaxed);
+    return success;
+  }
+
+  /// Wakes up the waiters, must be called after the condition is changed
+  void Notify() {
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    if (waiters_.load(std::memory_order_relaxed) == 0) return;
+    {
+      // The waiter has either not checked the predicate yet, or is asleep
+      const std::lock_guard lock{mutex_};
+    }
+    cv_.NotifyAll();
+  }
+
+ private:
+  engine::Mutex mutex_;
+  engine::ConditionVariable cv_;
+  std::atomic<std::size_t> waiters_{0};
+};
+
+}  // namespace impl
+
+/// @brief Bounded FIFO queue over a contiguous ring buffer.
+///
+/// Unlike concurrent::GenericQueue, the capacity is fixed at creation, so the
+/// queue needs no capacity semaphore: a push or a pop costs a single atomic
+/// operation on the uncontended path and an additional seq_cst fence to
+/// check for blocked tasks. Blocking Push and Pop wait in a coroutine-aware
+/// way.
+///
+/// Single producer single consumer queues use a ring buffer with cached
+/// positions, the other ones use the algorithm by Dmitry Vyukov.
+///
+/// `PushMany` and `PopMany` of the Producer and Consumer transfer a batch of
+/// elements with a single atomic operation.
+///
+/// @tparam T element type, must be default-constructible
+/// @tparam QueuePolicy policy type, it should have:
+/// 1. `static constexpr bool kIsMultipleProducer`
+/// 2. `static constexpr bool kIsMultipleConsumer`
+///
+/// On practice, instead of using `GenericBoundedQueue` directly, use an alias:
+///
+/// * concurrent::BoundedMpmcQueue
+/// * concurrent::BoundedMpscQueue
+/// * concurrent::BoundedSpmcQueue
+/// * concurrent::BoundedSpscQueue
+///
+/// @see @ref scripts/docs/en/userver/synchronization.md
+template <typename T, typename QueuePolicy>
+class GenericBoundedQueue final
+    : public std::enable_shared_from_this<GenericBoundedQueue<T, QueuePolicy>> {
+  struct EmplaceEnabler final {
+    // Disable {}-initialization in Queue's constructor
+    explicit EmplaceEnabler() = default;
+  };
+
+  using ProducerToken = impl::NoToken;
+  using ConsumerToken = impl::NoToken;
+  using MultiProducerToken = impl::MultiToken;
+  using MultiConsumerToken = impl::MultiToken;
+
+  using RingBuffer = std::conditional_t<QueuePolicy::kIsMultipleProducer ||
+                                            QueuePolicy::kIsMultipleConsumer,
+                                        impl::MpmcRingBuffer<T>,
+                                        impl::SpscRingBuffer<T>>;
+
+  friend class Producer<GenericBoundedQueue, ProducerToken, EmplaceEnabler>;
+  friend class Producer<GenericBoundedQueue, MultiProducerToken,
+                        EmplaceEnabler>;
+  friend class Consumer<GenericBoundedQueue, ConsumerToken, EmplaceEnabler>;
+  friend class Consumer<GenericBoundedQueue, MultiConsumerToken,
+                        EmplaceEnabler>;
+
+ public:
+  using ValueType = T;
+
+  using Producer =
+      concurrent::Producer<GenericBoundedQueue, ProducerToken, EmplaceEnabler>;
+  using Consumer =
+      concurrent::Consumer<GenericBoundedQueue, ConsumerToken, EmplaceEnabler>;
+  using MultiProducer =
+      concurrent::Producer<GenericBoundedQueue, MultiProducerToken,
+                           EmplaceEnabler>;
+  using MultiConsumer =
+      concurrent::Consumer<GenericBoundedQueue, MultiConsumerToken,
+                           EmplaceEnabler>;
+
+  /// @cond
+  // For internal use only
+  explicit GenericBoundedQueue(std::size_t capacity, EmplaceEnabler /*unused*/)
+      : queue_(capacity) {}
+
+  ~GenericBoundedQueue() {
+    UASSERT(consumers_count_ == kCreatedAndDead || !consumers_count_);
+    UASSERT(producers_count_ == kCreatedAndDead || !producers_count_);
+    // The remaining items are destroyed with the ring buffer
+  }
+
+  GenericBoundedQueue(GenericBoundedQueue&&) = delete;
+  GenericBoundedQueue(const GenericBoundedQueue&) = delete;
+  GenericBoundedQueue& operator=(GenericBoundedQueue&&) = delete;
+  GenericBoundedQueue& operator=(const GenericBoundedQueue&) = delete;
+  /// @endcond
+
+  /// @brief Create a new queue
+  /// @param capacity the minimal capacity, it is rounded up to a power of two.
+  /// The memory for all the elements is allocated at once.
+  static std::shared_ptr<GenericBoundedQueue> Create(std::size_t capacity) {
+    return std::make_shared<GenericBoundedQueue>(capacity, EmplaceEnabler{});
+  }
+
+  /// Get a `Producer` which makes it possible to push items into the queue.
+  /// Can be called multiple times for multi-producer queues. The resulting
+  /// `Producer` is not thread-safe.
+  ///
+  /// @note `Producer` may outlive the queue and consumers.
+  Producer GetProducer() {
+    PrepareProducer();
+    return Producer(this->shared_from_this(), EmplaceEnabler{});
+  }
+
+  /// Get a `MultiProducer` which makes it possible to push items into the
+  /// queue. The resulting `MultiProducer` is thread-safe. For this queue it
+  /// has no overhead compared to `Producer`.
+  ///
+  /// @note `MultiProducer` may outlive the queue and consumers.
+  MultiProducer GetMultiProducer() {
+    static_assert(QueuePolicy::kIsMultipleProducer,
+                  "Trying to obtain MultiProducer for a single-producer queue");
+    PrepareProducer();
+    return MultiProducer(this->shared_from_this(), EmplaceEnabler{});
+  }
+
+  /// Get a `Consumer` which makes it possible to read items from the queue.
+  /// Can be called multiple times for multi-consumer queues. The resulting
+  /// `Consumer` is not thread-safe.
+  ///
+  /// @note `Consumer` may outlive the queue and producers.
+  Consumer GetConsumer() {
+    PrepareConsumer();
+    return Consumer(this->shared_from_this(), EmplaceEnabler{});
+  }
+
+  /// Get a `MultiConsumer` which makes it possible to read items from the
+  /// queue. The resulting `MultiConsumer` is thread-safe. For this queue it
+  /// has no overhead compared to `Consumer`.
+  ///
+  /// @note `MultiConsumer` may outlive the queue and producers.
+  MultiConsumer GetMultiConsumer() {
+    static_assert(QueuePolicy::kIsMultipleConsumer,
+                  "Trying to obtain MultiConsumer for a single-consumer queue");
+    PrepareConsumer();
+    return MultiConsumer(this->shared_from_this(), EmplaceEnabler{});
+  }
+
+  /// @brief Gets the capacity of the queue, pushes over it block
+  std::size_t GetCapacity() const noexcept { return queue_.GetCapacity(); }
+
+  /// @brief Gets the approximate size of queue
+  std::size_t GetSizeApproximate() const noexcept {
+    return queue_.GetSizeApproximate();
+  }
+
+ private:
+  template <typename Token>
+  [[nodiscard]] bool Push(Token& token, T&& value, engine::Deadline deadline) {
+    return PushMany(token, utils::span<T>{&value, 1}, deadline) == 1;
+  }
+
+  template <typename Token>
+  [[nodiscard]] bool PushNoblock(Token& /*token*/, T&& value) {
+    if (NoMoreConsumers() || queue_.TryPushMany(&value, 1) == 0) return false;
+    non_empty_waiters_.Notify();
+    return true;
+  }
+
+  template <typename Token>
+  [[nodiscard]] std::size_t PushMany(Token& /*token*/, utils::span<T> values,
+                                     engine::Deadline deadline) {
+    std::size_t pushed = 0;
+    while (pushed != values.size() && !NoMoreConsumers()) {
+      const auto count = queue_.TryPushMany(values.data() + pushed,
+                                            values.size() - pushed);
+      if (count != 0) {
+        pushed += count;
+        non_empty_waiters_.Notify();
+        continue;
+      }
+      if (!non_full_waiters_.WaitUntil(deadline, [this] {
+            return !queue_.IsFull() || NoMoreConsumers();
+          })) {
+        break;
+      }
+    }
+    return pushed;
+  }
+
+  template <typename Token>
+  [[nodiscard]] bool Pop(Token& token, T& value, engine::Deadline deadline) {
+    return PopMany(token, utils::span<T>{&value, 1}, deadline) == 1;
+  }
+
+  template <typename Token>
+  [[nodiscard]] bool PopNoblock(Token& /*token*/, T& value) {
+    return DoPopMany(utils::span<T>{&value, 1}) == 1;
+  }
+
+  template <typename Token>
+  [[nodiscard]] std::size_t PopMany(Token& /*token*/, utils::span<T> values,
+                                    engine::Deadline deadline) {
+    while (true) {
+      if (const auto count = DoPopMany(values)) return count;
+      if (NoMoreProducers()) {
+        // A producer might have pushed something between the pop and the
+        // check. Check twice to avoid TOCTOU.
+        return DoPopMany(values);
+      }
+      if (!non_empty_waiters_.WaitUntil(deadline, [this] {
+            return !queue_.IsEmpty() || NoMoreProducers();
+          })) {
+        return 0;
+      }
+    }
+  }
+
+  std::size_t DoPopMany(utils::span<T> values) {
+    UASSERT(!values.empty());
+    const auto count = queue_.TryPopMany(values.data(), values.size());
+    if (count != 0) non_full_waiters_.Notify();
+    return count;
+  }
+
+  void PrepareProducer() {
+    utils::AtomicUpdate(producers_count_, [](auto old_value) {
+      UINVARIANT(QueuePolicy::kIsMultipleProducer ||
+                     old_value == 0 || old_value == kCreatedAndDead,
+                 "Incorrect usage of queue producers");
+      return old_value == kCreatedAndDead ? 1 : old_value + 1;
+    });
+  }
+
+  void PrepareConsumer() {
+    utils::AtomicUpdate(consumers_count_, [](auto old_value) {
+      UINVARIANT(QueuePolicy::kIsMultipleConsumer ||
+                     old_value == 0 || old_value == kCreatedAndDead,
+                 "Incorrect usage of queue consumers");
+      return old_value == kCreatedAndDead ? 1 : old_value + 1;
+    });
+  }
+
+  void MarkConsumerIsDead() {
+    const auto new_consumers_count =
+        utils::AtomicUpdate(consumers_count_, [](auto old_value) {
+          return old_value == 1 ? kCreatedAndDead : old_value - 1;
+        });
+    if (new_consumers_count == kCreatedAndDead) non_full_waiters_.Notify();
+  }
+
+  void MarkProducerIsDead() {
+    const auto new_producers_count =
+        utils::AtomicUpdate(producers_count_, [](auto old_value) {
+          return old_value == 1 ? kCreatedAndDead : old_value - 1;
+        });
+    if (new_producers_count == kCreatedAndDead) non_empty_waiters_.Notify();
+  }
+
+  bool NoMoreConsumers() const { return consumers_count_ == kCreatedAndDead; }
+
+  bool NoMoreProducers() const { return producers_count_ == kCreatedAndDead; }
+
+  static constexpr std::size_t kCreatedAndDead =
+      std::numeric_limits<std::size_t>::max();
+
+  RingBuffer queue_;
+  std::atomic<std::size_t> consumers_count_{0};
+  std::atomic<std::size_t> producers_count_{0};
+  impl::BoundedQueueWaitList non_full_waiters_;
+  impl::BoundedQueueWaitList non_empty_waiters_;
+};
+
+/// @ingroup userver_concurrency
+///
+/// @brief Bounded FIFO multiple producers multiple consumers queue.
+///
+/// @see concurrent::GenericBoundedQueue
+/// @see @ref scripts/docs/en/userver/synchronization.md
+template <typename T>
+using BoundedMpmcQueue =
+    GenericBoundedQueue<T, impl::SimpleQueuePolicy<true, true>>;
+
+/// @ingroup userver_concurrency
+///
+/// @brief Bounded FIFO multiple producers single consumer queue.
+///
+/// @see concurrent::GenericBoundedQueue
+/// @see @ref scripts/docs/en/userver/synchronization.md
+template <typename T>
+using BoundedMpscQueue =
+    GenericBoundedQueue<T, impl::SimpleQueuePolicy<true, false>>;
+
+/// @ingroup userver_concurrency
+///
+/// @brief Bounded FIFO single producer multiple consumers queue.
+///
+/// @see concurrent::GenericBoundedQueue
+/// @see @ref scripts/docs/en/userver/synchronization.md
+template <typename T>
+using BoundedSpmcQueue =
+    GenericBoundedQueue<T, impl::SimpleQueuePolicy<false, true>>;
+
+/// @ingroup userver_concurrency
+///
+/// @brief Bounded FIFO single producer single consumer queue.
+///
+/// @see concurrent::GenericBoundedQueue
+/// @see @ref scripts/docs/en/userver/synchronization.md
+template <typename T>
+using BoundedSpscQueue =
+    GenericBoundedQueue<T, impl::SimpleQueuePolicy<false, false>>;
+
+}  // namespace concurrent
+
+USERVER_NAMESPACE_END
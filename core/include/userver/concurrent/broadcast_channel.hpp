@@ -0,0 +1,263 @@
+#pragma once
+
+/// @file userver/concurrent/broadcast_channel.hpp
+/// @brief @copybrief concurrent::BroadcastChannel
+
+#include <atomic>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <utility>
+
+#include <userver/concurrent/bounded_queue.hpp>
+#include <userver/concurrent/impl/ring_buffer.hpp>
+#include <userver/engine/deadline.hpp>
+#include <userver/engine/mutex.hpp>
+#include <userver/utils/assert.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace concurrent {
+
+/// What happens to a concurrent::BroadcastChannel::Subscriber that falls
+/// behind the channel by more than its capacity
+enum class BroadcastLagPolicy {
+  /// The lost messages are silently skipped, reading continues from the
+  /// oldest retained message
+  kDrop,
+  /// Read reports BroadcastReadStatus::kLagged once, then continues from the
+  /// oldest retained message
+  kReportLag,
+  /// The subscriber is disconnected and reads nothing anymore
+  kDisconnect,
+};
+
+/// Result of a read from concurrent::BroadcastChannel::Subscriber
+enum class BroadcastReadStatus {
+  /// A message is read
+  kOk,
+  /// Some messages are lost, see
+  /// concurrent::BroadcastChannel::Subscriber::GetLostCount
+  kLagged,
+  /// No message before the deadline or the task is cancelled
+  kEmpty,
+  /// The channel is closed and all its messages are read
+  kClosed,
+  /// The subscriber is disconnected by BroadcastLagPolicy::kDisconnect
+  kDisconnected,
+};
+
+/// @ingroup userver_concurrency
+///
+/// @brief Multiple consumer broadcast channel over a ring of shared messages.
+///
+/// Every subscriber reads every published message. A message is stored once
+/// as `std::shared_ptr<const T>` and the subscribers get copies of the
+/// pointer, so the fan-out costs neither a copy of the message nor a queue
+/// per subscriber: a subscriber is just a position in the ring.
+///
+/// Publishing never waits for the subscribers, it overwrites the oldest
+/// message in the ring. A subscriber that falls behind by more than the
+/// capacity loses messages and is handled according to its
+/// concurrent::BroadcastLagPolicy.
+///
+/// Subscriber::Read waits for a new message in a coroutine-aware way.
+///
+/// @see @ref scripts/docs/en/userver/synchronization.md
+template <typename T>
+class BroadcastChannel final
+    : public std::enable_shared_from_this<BroadcastChannel<T>> {
+  struct EmplaceEnabler final {
+    // Disable {}-initialization in BroadcastChannel's constructor
+    explicit EmplaceEnabler() = default;
+  };
+
+ public:
+  using Message = std::shared_ptr<const T>;
+
+  /// @brief A reading position in the channel, reads only the messages
+  /// published after its creation. Must not be used concurrently.
+  class Subscriber final {
+   public:
+    Subscriber(std::shared_ptr<const BroadcastChannel> channel,
+               BroadcastLagPolicy policy, EmplaceEnabler)
+        : channel_(std::move(channel)),
+          policy_(policy),
+          next_(channel_->published_.load(std::memory_order_acquire)) {}
+
+    Subscriber(Subscriber&&) noexcept = default;
+    Subscriber& operator=(Subscriber&&) noexcept = default;
+
+    /// Waits for the next message until the deadline
+    [[nodiscard]] BroadcastReadStatus Read(Message& message,
+                                           engine::Deadline deadline = {}) {
+      UASSERT(channel_);
+      while (true) {
+        const auto status = TryRead(message);
+        if (status != BroadcastReadStatus::kEmpty) return status;
+
+        const auto& channel = *channel_;
+        const auto next = next_;
+        const bool has_message = channel.wait_list_.WaitUntil(
+            deadline, [&channel, next] {
+              return channel.published_.load(std::memory_order_acquire) >
+                         next ||
+                     channel.closed_.load(std::memory_order_acquire);
+            });
+        if (!has_message) return BroadcastReadStatus::kEmpty;
+      }
+    }
+
+    /// Reads the next message if it is already published
+    [[nodiscard]] BroadcastReadStatus TryRead(Message& message) {
+      UASSERT(channel_);
+      if (disconnected_) return BroadcastReadStatus::kDisconnected;
+
+      const auto& channel = *channel_;
+      while (true) {
+        const auto published =
+            channel.published_.load(std::memory_order_acquire);
+        if (published <= next_) {
+          if (!channel.closed_.load(std::memory_order_acquire)) {
+            return BroadcastReadStatus::kEmpty;
+          }
+          // Close() is ordered after the last publish
+          if (channel.published_.load(std::memory_order_acquire) <= next_) {
+            return BroadcastReadStatus::kClosed;
+          }
+          continue;
+        }
+
+        // The message has been published, so the slot either still holds it
+        // or has been overwritten by a newer one
+        if (channel.TryGet(next_, message)) {
+          ++next_;
+          return BroadcastReadStatus::kOk;
+        }
+
+        const auto oldest = channel.GetOldestRetained();
+        UASSERT(oldest > next_);
+        lost_count_ += oldest - next_;
+        next_ = oldest;
+        switch (policy_) {
+          case BroadcastLagPolicy::kDrop:
+            continue;
+          case BroadcastLagPolicy::kReportLag:
+            return BroadcastReadStatus::kLagged;
+          case BroadcastLagPolicy::kDisconnect:
+            disconnected_ = true;
+            return BroadcastReadStatus::kDisconnected;
+        }
+        UINVARIANT(false, "Unexpected BroadcastLagPolicy");
+      }
+    }
+
+    /// The total number of messages this subscriber has lost
+    std::uint64_t GetLostCount() const noexcept { return lost_count_; }
+
+   private:
+    std::shared_ptr<const BroadcastChannel> channel_;
+    BroadcastLagPolicy policy_;
+    std::uint64_t next_;
+    std::uint64_t lost_count_{0};
+    bool disconnected_{false};
+  };
+
+  /// @cond
+  BroadcastChannel(EmplaceEnabler, std::size_t capacity)
+      : mask_(impl::GetRingBufferCapacity(capacity) - 1),
+        slots_(std::make_unique<Slot[]>(mask_ + 1)) {}
+  /// @endcond
+
+  /// Creates a channel that retains at least `capacity` last messages,
+  /// the capacity is rounded up to a power of two
+  static std::shared_ptr<BroadcastChannel> Create(std::size_t capacity) {
+    return std::make_shared<BroadcastChannel>(EmplaceEnabler{}, capacity);
+  }
+
+  /// Publishes the message to all the subscribers, never waits for them.
+  /// Must not be called after Close().
+  void Publish(Message message) {
+    UASSERT(message);
+    // Released outside of the locks
+    Message overwritten;
+    {
+      const std::lock_guard lock{publish_mutex_};
+      UINVARIANT(!closed_.load(std::memory_order_relaxed),
+                 "Publish to a closed BroadcastChannel");
+      const auto sequence = published_.load(std::memory_order_relaxed);
+      auto& slot = slots_[sequence & mask_];
+      {
+        const std::lock_guard slot_lock{slot.mutex};
+        slot.sequence = sequence;
+        overwritten = std::exchange(slot.message, std::move(message));
+      }
+      published_.store(sequence + 1, std::memory_order_release);
+    }
+    wait_list_.Notify();
+  }
+
+  /// @overload
+  void Publish(T value) {
+    Publish(std::make_shared<const T>(std::move(value)));
+  }
+
+  /// Wakes up the subscribers, they read the remaining messages and then get
+  /// BroadcastReadStatus::kClosed
+  void Close() {
+    {
+      const std::lock_guard lock{publish_mutex_};
+      closed_.store(true, std::memory_order_release);
+    }
+    wait_list_.Notify();
+  }
+
+  /// Creates a subscriber that reads the messages published from now on
+  Subscriber Subscribe(
+      BroadcastLagPolicy policy = BroadcastLagPolicy::kDrop) const {
+    return Subscriber(this->shared_from_this(), policy, EmplaceEnabler{});
+  }
+
+  std::size_t GetCapacity() const noexcept { return mask_ + 1; }
+
+  /// The total number of published messages
+  std::uint64_t GetPublishedCount() const noexcept {
+    return published_.load(std::memory_order_relaxed);
+  }
+
+ private:
+  static constexpr auto kNoSequence = std::numeric_limits<std::uint64_t>::max();
+
+  struct Slot final {
+    // Guards the copying of `message` against its overwriting, the critical
+    // section is a reference count increment
+    engine::Mutex mutex;
+    std::uint64_t sequence{kNoSequence};
+    Message message;
+  };
+
+  bool TryGet(std::uint64_t sequence, Message& message) const {
+    auto& slot = slots_[sequence & mask_];
+    const std::lock_guard lock{slot.mutex};
+    if (slot.sequence != sequence) return false;
+    message = slot.message;
+    return true;
+  }
+
+  std::uint64_t GetOldestRetained() const noexcept {
+    const auto published = published_.load(std::memory_order_acquire);
+    return published > GetCapacity() ? published - GetCapacity() : 0;
+  }
+
+  const std::size_t mask_;
+  const std::unique_ptr<Slot[]> slots_;
+  engine::Mutex publish_mutex_;
+  std::atomic<std::uint64_t> published_{0};
+  std::atomic<bool> closed_{false};
+  mutable impl::BoundedQueueWaitList wait_list_;
+};
+
+}  // namespace concurrent
+
+USERVER_NAMESPACE_END
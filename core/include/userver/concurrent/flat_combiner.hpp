@@ -0,0 +1,156 @@
+#pragma once
+
+/// @file userver/concurrent/flat_combiner.hpp
+/// @brief @copybrief concurrent::FlatCombiner
+
+#include <exception>
+#include <optional>
+#include <type_traits>
+#include <utility>
+
+#include <userver/concurrent/impl/intrusive_hooks.hpp>
+#include <userver/engine/single_use_event.hpp>
+#include <userver/utils/fast_pimpl.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace concurrent {
+
+namespace impl {
+
+class FlatCombinerOperation : public SinglyLinkedBaseHook {
+ public:
+  using Executor = void (*)(FlatCombinerOperation& self, void* state) noexcept;
+
+  explicit FlatCombinerOperation(Executor executor) noexcept
+      : executor_(executor) {}
+
+  void Execute(void* state) noexcept { executor_(*this, state); }
+
+  engine::SingleUseEvent done;
+
+ private:
+  const Executor executor_;
+};
+
+class FlatCombinerQueue final {
+ public:
+  FlatCombinerQueue();
+  ~FlatCombinerQueue();
+
+  // Returns once the operation is executed, either by the current task or
+  // by the task that holds the combiner.
+  void Execute(FlatCombinerOperation& operation, void* state) noexcept;
+
+ private:
+  struct Impl;
+  utils::FastPimpl<Impl, 192, 64> impl_;
+};
+
+template <typename Func, typename State>
+class FlatCombinerOperationImpl final : public FlatCombinerOperation {
+ public:
+  using Result = std::invoke_result_t<Func&, State&>;
+  static_assert(!std::is_reference_v<Result>,
+                "The state must not be accessed outside of the operation, "
+                "return a copy instead of a reference");
+
+  explicit FlatCombinerOperationImpl(Func& func) noexcept
+      : FlatCombinerOperation(&DoExecute), func_(func) {}
+
+  Result Get() && {
+    if (exception_) std::rethrow_exception(std::move(exception_));
+    if constexpr (!std::is_void_v<Result>) return std::move(*result_);
+  }
+
+ private:
+  using Storage = std::conditional_t<std::is_void_v<Result>, std::nullopt_t,
+                                     std::optional<Result>>;
+
+  static void DoExecute(FlatCombinerOperation& self, void* state) noexcept {
+    auto& operation = static_cast<FlatCombinerOperationImpl&>(self);
+    auto& typed_state = *static_cast<State*>(state);
+    try {
+      if constexpr (std::is_void_v<Result>) {
+        operation.func_(typed_state);
+      } else {
+        operation.result_.emplace(operation.func_(typed_state));
+      }
+    } catch (...) {
+      operation.exception_ = std::current_exception();
+    }
+  }
+
+  Func& func_;
+  Storage result_{std::nullopt};
+  std::exception_ptr exception_;
+};
+
+}  // namespace impl
+
+/// @ingroup userver_concurrency
+///
+/// @brief Protects `State` by executing the operations on it in batches by a
+/// single task at a time, the combiner, instead of passing a lock between the
+/// tasks.
+///
+/// A task posts its operation to a lock-free queue. If no task is combining
+/// at the moment, the posting task becomes the combiner and executes all the
+/// queued operations, including the ones posted while it works, handing the
+/// results over to their tasks. Otherwise it sleeps until its operation is
+/// executed. `State` stays hot in the cache of the combiner, and only one
+/// task is woken up per operation, so the throughput under contention does
+/// not degrade due to lock convoys, as it does with engine::Mutex.
+///
+/// Well suited for hot shared structures with short operations: LRU recency
+/// lists, statistics aggregators, rate limiters.
+///
+/// @warning The operations are executed in the context of the combiner task,
+/// so they must be short and must not wait for anything, or the whole queue
+/// stalls. Task-local state, e.g. engine::TaskInheritedVariable or the
+/// cancellation of the posting task, is not visible to the operation.
+///
+/// @note Waiting for the operation ignores the task cancellation. Under
+/// a constant load the combiner may keep executing the operations of the
+/// other tasks for a while before its own Execute call returns.
+///
+/// @par Usage synopsis
+/// @code
+/// concurrent::FlatCombiner<Stats> stats;
+/// stats.Execute([value](Stats& s) { s.Account(value); });
+/// const auto count = stats.Execute([](Stats& s) { return s.count; });
+/// @endcode
+template <typename State>
+class FlatCombiner final {
+ public:
+  /// Constructs `State` from the arguments
+  template <typename... Args>
+  explicit FlatCombiner(Args&&... args)
+      : state_(std::forward<Args>(args)...) {}
+
+  FlatCombiner(const FlatCombiner&) = delete;
+  FlatCombiner& operator=(const FlatCombiner&) = delete;
+
+  /// @brief Executes `func(state)` exclusively with the other operations and
+  /// returns its result.
+  /// @throws the exception thrown by `func`
+  template <typename Func>
+  std::invoke_result_t<Func&, State&> Execute(Func&& func) {
+    impl::FlatCombinerOperationImpl<std::remove_reference_t<Func>, State>
+        operation{func};
+    queue_.Execute(operation, &state_);
+    return std::move(operation).Get();
+  }
+
+  /// @brief Access to the state without synchronization.
+  /// @warning Must not be used concurrently with Execute.
+  State& GetUnsafe() noexcept { return state_; }
+
+ private:
+  impl::FlatCombinerQueue queue_;
+  State state_;
+};
+
+}  // namespace concurrent
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,254 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <utility>
+
+#include <userver/concurrent/impl/interference_shield.hpp>
+#include <userver/utils/assert.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace concurrent::impl {
+
+/// Returns the capacity of a ring buffer that fits at least `min_capacity`
+/// elements: a power of two, at least 2
+inline std::size_t GetRingBufferCapacity(std::size_t min_capacity) {
+  UINVARIANT(min_capacity <= std::numeric_limits<std::size_t>::max() / 2,
+             "Too big capacity of a ring buffer");
+  std::size_t capacity = 2;
+  while (capacity < min_capacity) capacity *= 2;
+  return capacity;
+}
+
+/// @brief Bounded multiple producers multiple consumers FIFO ring buffer by
+/// Dmitry Vyukov.
+///
+/// Each cell has a sequence number that tells whether the cell is free for the
+/// push with the same position or is filled for the pop with the position one
+/// less. A push or a pop of a batch claims several consecutive cells with a
+/// single CAS of the position.
+///
+/// The element is moved from the argument only on success.
+template <typename T>
+class MpmcRingBuffer final {
+ public:
+  explicit MpmcRingBuffer(std::size_t min_capacity)
+      : mask_(GetRingBufferCapacity(min_capacity) - 1),
+        cells_(std::make_unique<Cell[]>(mask_ + 1)) {
+    for (std::size_t i = 0; i <= mask_; ++i) {
+      cells_[i].sequence.store(i, std::memory_order_relaxed);
+    }
+  }
+
+  MpmcRingBuffer(MpmcRingBuffer&&) = delete;
+  MpmcRingBuffer& operator=(MpmcRingBuffer&&) = delete;
+
+  /// Moves up to `count` elements from `values` into the buffer
+  /// @returns the number of pushed elements, a prefix of `values`
+  std::size_t TryPushMany(T* values, std::size_t count) {
+    UASSERT(count > 0);
+    auto pos = push_pos_->load(std::memory_order_relaxed);
+    while (true) {
+      const auto diff = Diff(GetSequence(pos), pos);
+      if (diff < 0) return 0;  // full
+      if (diff > 0) {
+        // Another producer has claimed the cell
+        pos = push_pos_->load(std::memory_order_relaxed);
+        continue;
+      }
+
+      // A cell that is free for `pos + i` may only be taken by the owner of
+      // the position, so the cells stay free until the CAS succeeds
+      std::size_t claimed = 1;
+      while (claimed < count && GetSequence(pos + claimed) == pos + claimed) {
+        ++claimed;
+      }
+      if (push_pos_->compare_exchange_weak(pos, pos + claimed,
+                                           std::memory_order_relaxed)) {
+        for (std::size_t i = 0; i < claimed; ++i) {
+          auto& cell = cells_[(pos + i) & mask_];
+          cell.value = std::move(values[i]);
+          cell.sequence.store(pos + i + 1, std::memory_order_release);
+        }
+        return claimed;
+      }
+    }
+  }
+
+  /// Moves up to `count` elements from the buffer into `values`
+  /// @returns the number of popped elements
+  std::size_t TryPopMany(T* values, std::size_t count) {
+    UASSERT(count > 0);
+    auto pos = pop_pos_->load(std::memory_order_relaxed);
+    while (true) {
+      const auto diff = Diff(GetSequence(pos), pos + 1);
+      if (diff < 0) return 0;  // empty
+      if (diff > 0) {
+        // Another consumer has claimed the cell
+        pos = pop_pos_->load(std::memory_order_relaxed);
+        continue;
+      }
+
+      std::size_t claimed = 1;
+      while (claimed < count &&
+             GetSequence(pos + claimed) == pos + claimed + 1) {
+        ++claimed;
+      }
+      if (pop_pos_->compare_exchange_weak(pos, pos + claimed,
+                                          std::memory_order_relaxed)) {
+        for (std::size_t i = 0; i < claimed; ++i) {
+          auto& cell = cells_[(pos + i) & mask_];
+          values[i] = std::move(cell.value);
+          cell.sequence.store(pos + i + mask_ + 1, std::memory_order_release);
+        }
+        return claimed;
+      }
+    }
+  }
+
+  /// Whether a push would fail, must be called after a seq_cst fence to see
+  /// the concurrent pops
+  bool IsFull() const noexcept {
+    const auto pos = push_pos_->load(std::memory_order_relaxed);
+    return Diff(GetSequence(pos), pos) < 0;
+  }
+
+  /// Whether a pop would fail, must be called after a seq_cst fence to see
+  /// the concurrent pushes
+  bool IsEmpty() const noexcept {
+    const auto pos = pop_pos_->load(std::memory_order_relaxed);
+    return Diff(GetSequence(pos), pos + 1) < 0;
+  }
+
+  std::size_t GetCapacity() const noexcept { return mask_ + 1; }
+
+  std::size_t GetSizeApproximate() const noexcept {
+    // `pop_pos_` never overtakes `push_pos_`, load it first
+    const auto pop_pos = pop_pos_->load(std::memory_order_relaxed);
+    const auto push_pos = push_pos_->load(std::memory_order_relaxed);
+    return std::min(push_pos - pop_pos, GetCapacity());
+  }
+
+ private:
+  struct Cell final {
+    std::atomic<std::size_t> sequence{0};
+    T value{};
+  };
+
+  static std::intptr_t Diff(std::size_t sequence, std::size_t pos) noexcept {
+    return static_cast<std::intptr_t>(sequence - pos);
+  }
+
+  std::size_t GetSequence(std::size_t pos) const noexcept {
+    return cells_[pos & mask_].sequence.load(std::memory_order_acquire);
+  }
+
+  const std::size_t mask_;
+  const std::unique_ptr<Cell[]> cells_;
+  InterferenceShield<std::atomic<std::size_t>> push_pos_{0};
+  InterferenceShield<std::atomic<std::size_t>> pop_pos_{0};
+};
+
+/// @brief Bounded single producer single consumer FIFO ring buffer.
+///
+/// Each side caches the last seen position of the other side and rereads it
+/// only when the buffer looks full (or empty), so in the steady state a push
+/// or a pop touches a single shared cache line.
+///
+/// The element is moved from the argument only on success.
+template <typename T>
+class SpscRingBuffer final {
+ public:
+  explicit SpscRingBuffer(std::size_t min_capacity)
+      : mask_(GetRingBufferCapacity(min_capacity) - 1),
+        values_(std::make_unique<T[]>(mask_ + 1)) {}
+
+  SpscRingBuffer(SpscRingBuffer&&) = delete;
+  SpscRingBuffer& operator=(SpscRingBuffer&&) = delete;
+
+  /// Moves up to `count` elements from `values` into the buffer
+  /// @returns the number of pushed elements, a prefix of `values`
+  std::size_t TryPushMany(T* values, std::size_t count) {
+    UASSERT(count > 0);
+    auto& producer = *producer_;
+    const auto pos = producer.pos.load(std::memory_order_relaxed);
+    if (pos - producer.cached_other_pos + count > GetCapacity()) {
+      producer.cached_other_pos =
+          consumer_->pos.load(std::memory_order_acquire);
+    }
+    const auto pushed =
+        std::min(count, GetCapacity() - (pos - producer.cached_other_pos));
+    if (pushed == 0) return 0;
+
+    for (std::size_t i = 0; i < pushed; ++i) {
+      values_[(pos + i) & mask_] = std::move(values[i]);
+    }
+    producer.pos.store(pos + pushed, std::memory_order_release);
+    return pushed;
+  }
+
+  /// Moves up to `count` elements from the buffer into `values`
+  /// @returns the number of popped elements
+  std::size_t TryPopMany(T* values, std::size_t count) {
+    UASSERT(count > 0);
+    auto& consumer = *consumer_;
+    const auto pos = consumer.pos.load(std::memory_order_relaxed);
+    if (consumer.cached_other_pos - pos < count) {
+      consumer.cached_other_pos =
+          producer_->pos.load(std::memory_order_acquire);
+    }
+    const auto popped = std::min(count, consumer.cached_other_pos - pos);
+    if (popped == 0) return 0;
+
+    for (std::size_t i = 0; i < popped; ++i) {
+      values[i] = std::move(values_[(pos + i) & mask_]);
+    }
+    consumer.pos.store(pos + popped, std::memory_order_release);
+    return popped;
+  }
+
+  /// Whether a push would fail, must be called after a seq_cst fence to see
+  /// the concurrent pop
+  bool IsFull() const noexcept {
+    return producer_->pos.load(std::memory_order_relaxed) -
+               consumer_->pos.load(std::memory_order_acquire) ==
+           GetCapacity();
+  }
+
+  /// Whether a pop would fail, must be called after a seq_cst fence to see
+  /// the concurrent push
+  bool IsEmpty() const noexcept {
+    return producer_->pos.load(std::memory_order_acquire) ==
+           consumer_->pos.load(std::memory_order_relaxed);
+  }
+
+  std::size_t GetCapacity() const noexcept { return mask_ + 1; }
+
+  std::size_t GetSizeApproximate() const noexcept {
+    // The consumer position never overtakes the producer one, load it first
+    const auto pop_pos = consumer_->pos.load(std::memory_order_relaxed);
+    const auto push_pos = producer_->pos.load(std::memory_order_relaxed);
+    return std::min(push_pos - pop_pos, GetCapacity());
+  }
+
+ private:
+  struct Side final {
+    std::atomic<std::size_t> pos{0};
+    // Owned by the side, the last seen position of the other side
+    std::size_t cached_other_pos{0};
+  };
+
+  const std::size_t mask_;
+  const std::unique_ptr<T[]> values_;
+  InterferenceShield<Side> producer_;
+  InterferenceShield<Side> consumer_;
+};
+
+}  // namespace concurrent::impl
+
+USERVER_NAMESPACE_END
@@ -3,6 +3,7 @@
 #include <memory>
 
 #include <userver/engine/deadline.hpp>
+#include <userver/utils/span.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
@@ -67,6 +68,18 @@ class Producer final {
     return queue_->PushNoblock(token_, std::move(value));
   }
 
+  /// Push the elements of `values` into queue in order. May wait
+  /// asynchronously if the queue is full. The pushed elements are moved from,
+  /// the rest are left unmodified.
+  /// @returns the number of pushed elements, less than `values.size()` if the
+  /// deadline was reached or the task was canceled.
+  /// @note Only supported by concurrent::GenericBoundedQueue
+  [[nodiscard]] std::size_t PushMany(utils::span<ValueType> values,
+                                     engine::Deadline deadline = {}) const {
+    UASSERT(queue_);
+    return queue_->PushMany(token_, values, deadline);
+  }
+
   void Reset() && {
     if (queue_) queue_->MarkProducerIsDead();
     queue_.reset();
@@ -136,6 +149,16 @@ class Consumer final {
     return queue_->PopNoblock(token_, value);
   }
 
+  /// Pop up to `values.size()` elements from queue into `values`. May wait
+  /// asynchronously if the queue is empty, but the producer is alive.
+  /// @returns the number of popped elements, 0 if nothing was popped before
+  /// the deadline.
+  /// @note Only supported by concurrent::GenericBoundedQueue
+  [[nodiscard]] std::size_t PopMany(utils::span<ValueType> values,
+                                    engine::Deadline deadline = {}) const {
+    return queue_->PopMany(token_, values, deadline);
+  }
+
   void Reset() && {
     if (queue_) queue_->MarkConsumerIsDead();
     queue_.reset();
@@ -0,0 +1,68 @@
+#pragma once
+
+/// @file userver/dump/blocked_filter_bloom.hpp
+/// @brief Dump support for utils::BlockedFilterBloom and
+/// utils::BlockedCountingFilterBloom
+///
+/// @ingroup userver_dump_read_write
+
+#include <string_view>
+
+#include <userver/dump/common.hpp>
+#include <userver/dump/operations.hpp>
+#include <userver/dump/to.hpp>
+#include <userver/dump/unsafe.hpp>
+#include <userver/utils/blocked_filter_bloom.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace dump {
+
+namespace impl {
+
+inline std::string_view ReadBloomBytes(Reader& reader) {
+  const auto bytes = ReadStringViewUnsafe(reader);
+  if (bytes.empty() || bytes.size() % utils::impl::kBloomBlockSize != 0) {
+    throw Error("Invalid size of a serialized Bloom filter");
+  }
+  return bytes;
+}
+
+}  // namespace impl
+
+/// @brief utils::BlockedFilterBloom serialization support
+/// @note The filter is stored as is, so the dump can only be read with the
+/// same `Hash`. Bump the `format-version` of the dump when changing it.
+template <typename T, typename Hash>
+void Write(Writer& writer, const utils::BlockedFilterBloom<T, Hash>& filter) {
+  writer.Write(filter.GetBytes());
+}
+
+/// @brief utils::BlockedFilterBloom deserialization support
+template <typename T, typename Hash>
+utils::BlockedFilterBloom<T, Hash> Read(
+    Reader& reader, To<utils::BlockedFilterBloom<T, Hash>>) {
+  return utils::BlockedFilterBloom<T, Hash>::FromBytes(
+      impl::ReadBloomBytes(reader));
+}
+
+/// @brief utils::BlockedCountingFilterBloom serialization support
+/// @note The filter is stored as is, so the dump can only be read with the
+/// same `Hash`. Bump the `format-version` of the dump when changing it.
+template <typename T, typename Hash>
+void Write(Writer& writer,
+           const utils::BlockedCountingFilterBloom<T, Hash>& filter) {
+  writer.Write(filter.GetBytes());
+}
+
+/// @brief utils::BlockedCountingFilterBloom deserialization support
+template <typename T, typename Hash>
+utils::BlockedCountingFilterBloom<T, Hash> Read(
+    Reader& reader, To<utils::BlockedCountingFilterBloom<T, Hash>>) {
+  return utils::BlockedCountingFilterBloom<T, Hash>::FromBytes(
+      impl::ReadBloomBytes(reader));
+}
+
+}  // namespace dump
+
+USERVER_NAMESPACE_END
@@ -85,6 +85,9 @@ enum class UpdateType {
 /// `min-interval` | `string` (duration) | `WriteDumpAsync` calls performed in a fast succession are ignored | `0s`
 /// `fs-task-processor` | `string` | `TaskProcessor` for blocking disk IO | `fs-task-processor`
 /// `encrypted` | `boolean` | Whether to encrypt the dump | `false`
+/// `compressed` | `boolean` | Whether to compress the dump with zstd | `false`
+/// `compression-parallelism` | `integer` | Max number of dump blocks compressed or decompressed in parallel | 4
+/// `mmap` | `boolean` | Whether to read the dump by mapping the file into memory, see dump::MmapFileReader; ignored for encrypted dumps | `false`
 ///
 /// ## Sample usage
 /// @snippet core/src/dump/dumper_test.cpp  Sample Dumper usage
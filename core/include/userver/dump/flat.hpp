@@ -0,0 +1,193 @@
+#pragma once
+
+/// @file userver/dump/flat.hpp
+/// @brief Flat immutable containers that are dumped and restored as a single
+/// block of bytes, without deserializing the individual elements.
+///
+/// @ingroup userver_dump_read_write
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+
+#include <userver/dump/operations.hpp>
+#include <userver/dump/to.hpp>
+#include <userver/utils/assert.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace dump {
+
+/// @brief Immutable bytes of a flat container.
+///
+/// The bytes are either owned or reference a memory-mapped dump file, see
+/// `MmapFileReader`. Copies share the bytes.
+class FlatBuffer final {
+ public:
+  FlatBuffer() = default;
+
+  explicit FlatBuffer(std::string bytes);
+
+  /// The `bytes` stay valid while the `owner` is alive
+  FlatBuffer(std::shared_ptr<const void> owner, std::string_view bytes);
+
+  std::string_view GetBytes() const noexcept { return bytes_; }
+
+ private:
+  std::shared_ptr<const void> owner_;
+  std::string_view bytes_;
+};
+
+/// @brief Immutable array of strings stored as the end offsets of the strings
+/// followed by the arena of their contents.
+///
+/// Can be used as the cache data directly or be hydrated lazily into richer
+/// structures. Reading it from a dump takes a single copy of the bytes, or no
+/// copy at all with `MmapFileReader`.
+class FlatStringTable final {
+ public:
+  class Builder final {
+   public:
+    void Reserve(std::size_t count, std::size_t total_size);
+    void Add(std::string_view value);
+    FlatStringTable Build() &&;
+
+   private:
+    std::vector<std::uint64_t> ends_;
+    std::string arena_;
+  };
+
+  FlatStringTable() = default;
+
+  /// @throws `Error` if the `buffer` is not a valid table
+  explicit FlatStringTable(FlatBuffer buffer);
+
+  std::size_t size() const noexcept { return size_; }
+  bool empty() const noexcept { return size_ == 0; }
+
+  /// @warning The result is valid while the table or its copies are alive
+  std::string_view operator[](std::size_t index) const noexcept;
+
+  const FlatBuffer& GetBuffer() const noexcept { return buffer_; }
+
+ private:
+  std::uint64_t GetEnd(std::size_t index) const noexcept;
+
+  FlatBuffer buffer_;
+  std::size_t size_{0};
+  const char* arena_{nullptr};
+};
+
+/// @brief Immutable array of trivially copyable values.
+///
+/// The values are not required to be aligned within the buffer, so they are
+/// accessed by value.
+template <typename T>
+class FlatArray final {
+  static_assert(std::is_trivially_copyable_v<T>);
+
+ public:
+  FlatArray() = default;
+
+  explicit FlatArray(const std::vector<T>& values);
+
+  /// @throws `Error` if the `buffer` is not a valid array
+  explicit FlatArray(FlatBuffer buffer);
+
+  std::size_t size() const noexcept { return size_; }
+  bool empty() const noexcept { return size_ == 0; }
+
+  T operator[](std::size_t index) const noexcept;
+
+  std::vector<T> ToVector() const;
+
+  const FlatBuffer& GetBuffer() const noexcept { return buffer_; }
+
+ private:
+  FlatBuffer buffer_;
+  std::size_t size_{0};
+};
+
+namespace impl {
+
+/// Writes the bytes of the buffer followed by their checksum
+void WriteFlatBuffer(Writer& writer, const FlatBuffer& buffer);
+
+/// @throws `Error` on a checksum mismatch
+FlatBuffer ReadFlatBuffer(Reader& reader);
+
+/// Returns the element count stored in the head of the bytes, 0 for no bytes
+/// @throws `Error` if the bytes are too short
+std::size_t ReadFlatSize(std::string_view bytes);
+
+[[noreturn]] void ThrowInvalidFlatBuffer(std::string_view type);
+
+}  // namespace impl
+
+void Write(Writer& writer, const FlatStringTable& value);
+
+FlatStringTable Read(Reader& reader, To<FlatStringTable>);
+
+template <typename T>
+FlatArray<T>::FlatArray(const std::vector<T>& values) : size_(values.size()) {
+  const std::uint64_t size = size_;
+  std::string bytes(sizeof(size) + size_ * sizeof(T), '\0');
+  std::memcpy(bytes.data(), &size, sizeof(size));
+  if (size_ != 0) {
+    std::memcpy(bytes.data() + sizeof(size), values.data(), size_ * sizeof(T));
+  }
+  buffer_ = FlatBuffer{std::move(bytes)};
+}
+
+template <typename T>
+FlatArray<T>::FlatArray(FlatBuffer buffer)
+    : buffer_(std::move(buffer)),
+      size_(impl::ReadFlatSize(buffer_.GetBytes())) {
+  const auto bytes = buffer_.GetBytes();
+  if (!bytes.empty() &&
+      (size_ > bytes.size() / sizeof(T) ||
+       bytes.size() - sizeof(std::uint64_t) != size_ * sizeof(T))) {
+    impl::ThrowInvalidFlatBuffer("FlatArray");
+  }
+}
+
+template <typename T>
+T FlatArray<T>::operator[](std::size_t index) const noexcept {
+  UASSERT(index < size_);
+  T value;
+  std::memcpy(&value,
+              buffer_.GetBytes().data() + sizeof(std::uint64_t) +
+                  index * sizeof(T),
+              sizeof(T));
+  return value;
+}
+
+template <typename T>
+std::vector<T> FlatArray<T>::ToVector() const {
+  std::vector<T> result(size_);
+  if (size_ != 0) {
+    std::memcpy(result.data(),
+                buffer_.GetBytes().data() + sizeof(std::uint64_t),
+                size_ * sizeof(T));
+  }
+  return result;
+}
+
+template <typename T>
+void Write(Writer& writer, const FlatArray<T>& value) {
+  impl::WriteFlatBuffer(writer, value.GetBuffer());
+}
+
+template <typename T>
+FlatArray<T> Read(Reader& reader, To<FlatArray<T>>) {
+  return FlatArray<T>{impl::ReadFlatBuffer(reader)};
+}
+
+}  // namespace dump
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,94 @@
+#pragma once
+
+#include <cstddef>
+#include <deque>
+#include <memory>
+#include <string>
+
+#include <userver/dump/factory.hpp>
+#include <userver/dump/operations.hpp>
+#include <userver/engine/task/task_with_result.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace dump {
+
+/// @brief Compresses the data with zstd and writes it to the underlying
+/// `Writer` as a sequence of independent framed blocks.
+///
+/// Blocks are compressed by up to `parallelism` tasks running in the current
+/// task processor, which is expected to be the blocking `fs-task-processor`.
+class CompressedWriter final : public Writer {
+ public:
+  /// @throws `Error` on write operation failure
+  CompressedWriter(std::unique_ptr<Writer> base, std::size_t parallelism);
+
+  ~CompressedWriter() override;
+
+  void Finish() override;
+
+ private:
+  struct Block final {
+    std::size_t size;
+    std::string compressed;
+  };
+
+  void WriteRaw(std::string_view data) override;
+
+  void SubmitBlock();
+  void WriteOldestBlock();
+
+  std::unique_ptr<Writer> base_;
+  const std::size_t parallelism_;
+  std::string block_;
+  std::deque<engine::TaskWithResult<Block>> in_flight_;
+};
+
+/// @brief Reads the data written by `CompressedWriter`, decompressing
+/// up to `parallelism` blocks ahead in the current task processor.
+class CompressedReader final : public Reader {
+ public:
+  /// @throws `Error` on read operation failure or if the dump is not
+  /// compressed
+  CompressedReader(std::unique_ptr<Reader> base, std::size_t parallelism);
+
+  ~CompressedReader() override;
+
+  void Finish() override;
+
+ private:
+  std::string_view ReadRaw(std::size_t max_size) override;
+
+  std::string_view ReadAcrossBlocks(std::size_t max_size);
+  bool FetchBlock();
+
+  std::unique_ptr<Reader> base_;
+  const std::size_t parallelism_;
+  bool is_base_exhausted_{false};
+  std::string block_;
+  std::size_t block_pos_{0};
+  // Used when a read spans several blocks
+  std::string curr_chunk_;
+  std::deque<engine::TaskWithResult<std::string>> in_flight_;
+};
+
+/// Wraps the readers and writers of the `base` factory to store the dump
+/// compressed
+class CompressedOperationsFactory final : public OperationsFactory {
+ public:
+  CompressedOperationsFactory(std::unique_ptr<OperationsFactory> base,
+                              std::size_t parallelism);
+
+  std::unique_ptr<Reader> CreateReader(std::string full_path) override;
+
+  std::unique_ptr<Writer> CreateWriter(std::string full_path,
+                                       tracing::ScopeTime& scope) override;
+
+ private:
+  const std::unique_ptr<OperationsFactory> base_;
+  const std::size_t parallelism_;
+};
+
+}  // namespace dump
+
+USERVER_NAMESPACE_END
@@ -1,6 +1,8 @@
 #pragma once
 
 #include <chrono>
+#include <cstdint>
+#include <memory>
 
 #include <boost/filesystem/operations.hpp>
 
@@ -9,13 +11,18 @@
 #include <userver/utils/fast_pimpl.hpp>
 
 #include <userver/dump/factory.hpp>
+#include <userver/dump/flat.hpp>
 #include <userver/dump/operations.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
 namespace dump {
 
-/// A handle to a dump file. File operations block the thread.
+/// @brief A handle to a dump file. File operations block the thread.
+///
+/// The data is written in large chunks, limited by
+/// @ref USERVER_DUMPS_WRITE_LIMITS, which also controls the periodic
+/// `fdatasync` and the eviction of the written pages from the page cache.
 class FileWriter final : public Writer {
  public:
   /// @brief Creates a new dump file and opens it
@@ -28,11 +35,19 @@ class FileWriter final : public Writer {
  private:
   void WriteRaw(std::string_view data) override;
 
+  void WriteBuffer();
+  void Sync();
+
   fs::blocking::CFile file_;
   std::string final_path_;
   std::string path_;
   boost::filesystem::perms perms_;
   utils::StreamingCpuRelax cpu_relax_;
+  std::string buffer_;
+  const std::size_t sync_interval_bytes_;
+  const bool drop_page_cache_;
+  std::uint64_t written_bytes_{0};
+  std::uint64_t synced_bytes_{0};
 };
 
 /// A handle to a dump file. File operations block the thread.
@@ -52,9 +67,41 @@ class FileReader final : public Reader {
   std::string curr_chunk_;
 };
 
+/// @brief A handle to a dump file mapped into memory.
+///
+/// Reads return the mapped memory without copying, flat structures from
+/// `userver/dump/flat.hpp` reference the mapped pages directly and keep the
+/// mapping alive. Page faults block the thread.
+class MmapFileReader final : public Reader {
+ public:
+  /// @brief Opens an existing dump file and maps it into memory
+  /// @throws `Error` on a filesystem error
+  explicit MmapFileReader(std::string path);
+
+  ~MmapFileReader() override;
+
+  /// @brief Reads exactly `size` bytes that stay valid while the result is
+  /// alive
+  /// @throws `Error` on end-of-file
+  FlatBuffer ReadShared(std::size_t size);
+
+  void Finish() override;
+
+ private:
+  struct Mapping;
+
+  std::string_view ReadRaw(std::size_t max_size) override;
+
+  std::string path_;
+  std::shared_ptr<const Mapping> mapping_;
+  std::size_t position_{0};
+};
+
 class FileOperationsFactory final : public OperationsFactory {
  public:
-  explicit FileOperationsFactory(boost::filesystem::perms perms);
+  /// @param use_mmap Whether to read the dumps with `MmapFileReader`
+  explicit FileOperationsFactory(boost::filesystem::perms perms,
+                                 bool use_mmap = false);
 
   std::unique_ptr<Reader> CreateReader(std::string full_path) override;
 
@@ -63,6 +110,7 @@ class FileOperationsFactory final : public OperationsFactory {
 
  private:
   const boost::filesystem::perms perms_;
+  const bool use_mmap_;
 };
 
 }  // namespace dump
@@ -0,0 +1,68 @@
+#pragma once
+
+/// @file userver/dump/operations_string.hpp
+/// @brief In-memory dump::Writer and dump::Reader
+
+#include <string>
+#include <string_view>
+
+#include <userver/dump/operations.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace dump {
+
+/// A `Writer` that appends to a string buffer
+class StringWriter final : public Writer {
+ public:
+  StringWriter();
+
+  void Finish() override;
+
+  /// Extracts the built string, leaving the Writer in a valid but unspecified
+  /// state
+  std::string Extract() &&;
+
+ private:
+  void WriteRaw(std::string_view data) override;
+
+  std::string data_;
+};
+
+/// A `Reader` that reads from a string buffer, which must outlive the `Reader`
+class StringReader final : public Reader {
+ public:
+  explicit StringReader(std::string_view data);
+
+  /// @throws `Error` if not all the data is read
+  void Finish() override;
+
+ private:
+  std::string_view ReadRaw(std::size_t max_size) override;
+
+  std::string_view data_;
+  std::string_view unread_data_;
+};
+
+/// Serializes the `value` in the dump format, e.g. to store it in a database
+template <typename T>
+std::string WriteToString(const T& value) {
+  StringWriter writer;
+  writer.Write(value);
+  writer.Finish();
+  return std::move(writer).Extract();
+}
+
+/// @brief Deserializes the value written by WriteToString
+/// @throws `Error` if the data is malformed
+template <typename T>
+T ReadFromString(std::string_view data) {
+  StringReader reader(data);
+  auto value = reader.Read<T>();
+  reader.Finish();
+  return value;
+}
+
+}  // namespace dump
+
+USERVER_NAMESPACE_END
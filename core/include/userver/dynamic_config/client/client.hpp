@@ -25,6 +25,11 @@ struct ClientConfig {
   bool append_path_to_url{true};
   std::string stage_name;
   bool fallback_to_no_proxy{true};
+  /// How long the server may hold an incremental request until the configs
+  /// change, 0 disables the long polling
+  std::chrono::milliseconds long_poll_timeout{0};
+  /// Ask the server for the zstd-compressed responses
+  bool zstd_compression{false};
 };
 
 /// @ingroup userver_clients
@@ -68,7 +73,7 @@ class Client final {
       const std::optional<Timestamp>& last_update,
       const std::vector<std::string>& fields_to_load);
 
-  std::string FetchConfigsValues(std::string_view body);
+  std::string FetchConfigsValues(std::string_view body, bool is_long_poll);
 
   const ClientConfig config_;
   clients::http::Client& http_client_;
@@ -33,6 +33,8 @@ namespace components {
 /// configs-stage: stage name provided statically, can be overridden from file | -
 /// configs-stage-filepath: file to read stage name from, overrides static "configs-stage" if both are provided, expected format: json file with "env_name" property | -
 /// fallback-to-no-proxy | make additional attempts to retrieve configs by bypassing proxy that is set in USERVER_HTTP_PROXY runtime variable | true
+/// long-poll-timeout | how long the server may hold an incremental request until the configs change, 0 disables the long polling | 0
+/// zstd-compression | ask the server for the zstd-compressed responses | false
 ///
 /// ## Static configuration example:
 ///
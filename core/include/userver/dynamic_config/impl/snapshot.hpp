@@ -4,6 +4,7 @@
 #include <cstddef>
 #include <exception>
 #include <functional>
+#include <memory>
 #include <string>
 #include <type_traits>
 #include <typeindex>
@@ -56,6 +57,11 @@ class SnapshotData final {
   SnapshotData(const SnapshotData& defaults,
                const std::vector<KeyValue>& overrides);
 
+  // Parses the configs of `docs_map`, reusing the configs of `previous` whose
+  // JSON is the same in `docs_map` and in `previous_docs_map`
+  SnapshotData(const DocsMap& docs_map, const DocsMap& previous_docs_map,
+               const SnapshotData& previous);
+
   SnapshotData(SnapshotData&&) noexcept = default;
   SnapshotData& operator=(SnapshotData&&) noexcept = default;
 
@@ -70,10 +76,16 @@ class SnapshotData final {
 
   bool IsEmpty() const noexcept;
 
+  // Whether the config is shared with `other`, i.e. was not changed since
+  // the snapshot it was reused from
+  bool IsSameValue(ConfigId id, const SnapshotData& other) const noexcept;
+
  private:
   const std::any& DoGet(ConfigId id) const;
 
-  std::vector<std::any> user_configs_;
+  void ParseMissing(const DocsMap& docs_map);
+
+  std::vector<std::shared_ptr<const std::any>> user_configs_;
 };
 
 class StorageData;
@@ -182,6 +182,8 @@ class Source final {
   ///
   /// @note Сallbacks occur only if one of the passed config is changed. This is
   /// true under any components::DynamicConfigClientUpdater options.
+  /// The configs whose JSON did not change are not compared, as they are
+  /// reused from the previous snapshot, so such a check is cheap.
   ///
   /// @warning To use this function, configs must have the `operator==`.
   ///
@@ -223,10 +225,19 @@ class Source final {
     UASSERT(!current.GetData().IsEmpty());
     UASSERT(!previous.GetData().IsEmpty());
 
-    const bool is_equal = (true && ... && (previous[keys] == current[keys]));
+    const bool is_equal = (true && ... && IsEqual(previous, current, keys));
     return !is_equal;
   }
 
+  template <typename VariableType>
+  static bool IsEqual(const Snapshot& previous, const Snapshot& current,
+                      const Key<VariableType>& key) {
+    // Configs with unchanged JSON are shared between the snapshots
+    return current.GetData().IsSameValue(impl::ConfigIdGetter::Get(key),
+                                         previous.GetData()) ||
+           previous[key] == current[key];
+  }
+
   concurrent::AsyncEventSubscriberScope DoUpdateAndListen(
       concurrent::FunctionId id, std::string_view name,
       SnapshotEventSource::Function&& func);
@@ -20,6 +20,7 @@ template <template <typename> typename TaskType, typename Function,
           typename... Args>
 [[nodiscard]] auto MakeTaskWithResult(TaskProcessor& task_processor,
                                       Task::Importance importance,
+                                      Task::Priority priority,
                                       Deadline deadline, Function&& f,
                                       Args&&... args) {
   using ResultType =
@@ -27,7 +28,7 @@ template <template <typename> typename TaskType, typename Function,
   constexpr auto kWaitMode = TaskType<ResultType>::kWaitMode;
 
   return TaskType<ResultType>{
-      MakeTask({task_processor, importance, kWaitMode, deadline},
+      MakeTask({task_processor, importance, kWaitMode, deadline, priority},
                std::forward<Function>(f), std::forward<Args>(args)...)};
 }
 
@@ -38,8 +39,8 @@ template <typename Function, typename... Args>
 [[nodiscard]] auto AsyncNoSpan(TaskProcessor& task_processor, Function&& f,
                                Args&&... args) {
   return impl::MakeTaskWithResult<TaskWithResult>(
-      task_processor, Task::Importance::kNormal, {}, std::forward<Function>(f),
-      std::forward<Args>(args)...);
+      task_processor, Task::Importance::kNormal, Task::Priority::kNormal, {},
+      std::forward<Function>(f), std::forward<Args>(args)...);
 }
 
 /// Runs an asynchronous function call using specified task processor
@@ -47,8 +48,8 @@ template <typename Function, typename... Args>
 [[nodiscard]] auto SharedAsyncNoSpan(TaskProcessor& task_processor,
                                      Function&& f, Args&&... args) {
   return impl::MakeTaskWithResult<SharedTaskWithResult>(
-      task_processor, Task::Importance::kNormal, {}, std::forward<Function>(f),
-      std::forward<Args>(args)...);
+      task_processor, Task::Importance::kNormal, Task::Priority::kNormal, {},
+      std::forward<Function>(f), std::forward<Args>(args)...);
 }
 
 /// Runs an asynchronous function call with deadline using specified task
@@ -57,8 +58,8 @@ template <typename Function, typename... Args>
 [[nodiscard]] auto AsyncNoSpan(TaskProcessor& task_processor, Deadline deadline,
                                Function&& f, Args&&... args) {
   return impl::MakeTaskWithResult<TaskWithResult>(
-      task_processor, Task::Importance::kNormal, deadline,
-      std::forward<Function>(f), std::forward<Args>(args)...);
+      task_processor, Task::Importance::kNormal, Task::Priority::kNormal,
+      deadline, std::forward<Function>(f), std::forward<Args>(args)...);
 }
 
 /// Runs an asynchronous function call with deadline using specified task
@@ -68,7 +69,19 @@ template <typename Function, typename... Args>
                                      Deadline deadline, Function&& f,
                                      Args&&... args) {
   return impl::MakeTaskWithResult<SharedTaskWithResult>(
-      task_processor, Task::Importance::kNormal, deadline,
+      task_processor, Task::Importance::kNormal, Task::Priority::kNormal,
+      deadline, std::forward<Function>(f), std::forward<Args>(args)...);
+}
+
+/// Runs an asynchronous function call with the specified priority using
+/// specified task processor
+/// @see Task::Priority
+template <typename Function, typename... Args>
+[[nodiscard]] auto AsyncNoSpan(TaskProcessor& task_processor,
+                               Task::Priority priority, Function&& f,
+                               Args&&... args) {
+  return impl::MakeTaskWithResult<TaskWithResult>(
+      task_processor, Task::Importance::kNormal, priority, {},
       std::forward<Function>(f), std::forward<Args>(args)...);
 }
 
@@ -106,6 +119,16 @@ template <typename Function, typename... Args>
                            std::forward<Args>(args)...);
 }
 
+/// Runs an asynchronous function call with the specified priority using task
+/// processor of the caller
+/// @see Task::Priority
+template <typename Function, typename... Args>
+[[nodiscard]] auto AsyncNoSpan(Task::Priority priority, Function&& f,
+                               Args&&... args) {
+  return AsyncNoSpan(current_task::GetTaskProcessor(), priority,
+                     std::forward<Function>(f), std::forward<Args>(args)...);
+}
+
 /// @brief Runs an asynchronous function call that will start regardless of
 /// cancellations using specified task processor
 /// @see Task::Importance::Critical
@@ -113,8 +136,8 @@ template <typename Function, typename... Args>
 [[nodiscard]] auto CriticalAsyncNoSpan(TaskProcessor& task_processor,
                                        Function&& f, Args&&... args) {
   return impl::MakeTaskWithResult<TaskWithResult>(
-      task_processor, Task::Importance::kCritical, {},
-      std::forward<Function>(f), std::forward<Args>(args)...);
+      task_processor, Task::Importance::kCritical, Task::Priority::kNormal,
+      {}, std::forward<Function>(f), std::forward<Args>(args)...);
 }
 
 /// @brief Runs an asynchronous function call that will start regardless of
@@ -124,8 +147,8 @@ template <typename Function, typename... Args>
 [[nodiscard]] auto SharedCriticalAsyncNoSpan(TaskProcessor& task_processor,
                                              Function&& f, Args&&... args) {
   return impl::MakeTaskWithResult<SharedTaskWithResult>(
-      task_processor, Task::Importance::kCritical, {},
-      std::forward<Function>(f), std::forward<Args>(args)...);
+      task_processor, Task::Importance::kCritical, Task::Priority::kNormal,
+      {}, std::forward<Function>(f), std::forward<Args>(args)...);
 }
 
 /// @brief Runs an asynchronous function call that will start regardless of
@@ -155,8 +178,9 @@ template <typename Function, typename... Args>
 [[nodiscard]] auto CriticalAsyncNoSpan(Deadline deadline, Function&& f,
                                        Args&&... args) {
   return impl::MakeTaskWithResult<TaskWithResult>(
-      current_task::GetTaskProcessor(), Task::Importance::kCritical, deadline,
-      std::forward<Function>(f), std::forward<Args>(args)...);
+      current_task::GetTaskProcessor(), Task::Importance::kCritical,
+      Task::Priority::kNormal, deadline, std::forward<Function>(f),
+      std::forward<Args>(args)...);
 }
 
 }  // namespace engine
@@ -0,0 +1,523 @@
+#pragma once
+
+/// @file userver/engine/co_task.hpp
+/// @brief @copybrief engine::CoTask
+
+#include <userver/engine/task/task_processor_fwd.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace engine::impl {
+
+using CoResumeFunc = void (*)(void* frame) noexcept;
+
+// Resumes the coroutine frame on a carrier task of the task processor
+void ScheduleStackless(TaskProcessor& task_processor, CoResumeFunc resume,
+                       void* frame);
+
+}  // namespace engine::impl
+
+USERVER_NAMESPACE_END
+
+#if __cpp_impl_coroutine >= 201902L || defined(DOXYGEN)
+
+#include <atomic>
+#include <coroutine>
+#include <exception>
+#include <memory>
+#include <optional>
+#include <type_traits>
+#include <utility>
+
+#include <userver/engine/deadline.hpp>
+#include <userver/engine/exception.hpp>
+#include <userver/engine/future.hpp>
+#include <userver/engine/task/cancel.hpp>
+#include <userver/engine/task/task_base.hpp>
+#include <userver/utils/assert.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace engine {
+
+template <typename T = void>
+class CoTask;
+
+template <typename T>
+class CoTaskHandle;
+
+namespace impl {
+
+inline void ResumeCoroutine(void* frame) noexcept {
+  std::coroutine_handle<>::from_address(frame).resume();
+}
+
+// Shared by all the coroutines started by a single engine::CoAsync call
+class CoRootState final {
+ public:
+  CoRootState(TaskProcessor& task_processor, Deadline deadline) noexcept
+      : task_processor_(task_processor), deadline_(deadline) {}
+
+  void RequestCancel() noexcept {
+    is_cancel_requested_.store(true, std::memory_order_relaxed);
+  }
+
+  TaskCancellationReason GetCancellationReason() const noexcept {
+    if (is_cancel_requested_.load(std::memory_order_relaxed)) {
+      return TaskCancellationReason::kUserRequest;
+    }
+    if (deadline_.IsReached()) return TaskCancellationReason::kDeadline;
+    return TaskCancellationReason::kNone;
+  }
+
+  void ThrowIfCancelled() const {
+    const auto reason = GetCancellationReason();
+    if (reason != TaskCancellationReason::kNone) {
+      throw WaitInterruptedException(reason);
+    }
+  }
+
+  // The coroutine may be resumed before this function returns
+  void Schedule(std::coroutine_handle<> handle) {
+    ScheduleStackless(task_processor_, &ResumeCoroutine, handle.address());
+  }
+
+ private:
+  TaskProcessor& task_processor_;
+  const Deadline deadline_;
+  std::atomic<bool> is_cancel_requested_{false};
+};
+
+class CoPromiseBase {
+ public:
+  class FinalAwaiter final {
+   public:
+    bool await_ready() const noexcept { return false; }
+
+    template <typename Promise>
+    std::coroutine_handle<> await_suspend(
+        std::coroutine_handle<Promise> handle) noexcept {
+      UASSERT(handle.promise().continuation_);
+      return handle.promise().continuation_;
+    }
+
+    void await_resume() const noexcept {}
+  };
+
+  std::suspend_always initial_suspend() const noexcept { return {}; }
+
+  FinalAwaiter final_suspend() const noexcept { return {}; }
+
+  void unhandled_exception() noexcept { exception_ = std::current_exception(); }
+
+  CoRootState& GetRoot() const noexcept {
+    UASSERT(root_);
+    return *root_;
+  }
+
+  void Start(CoRootState& root, std::coroutine_handle<> continuation) noexcept {
+    root_ = &root;
+    continuation_ = continuation;
+  }
+
+ protected:
+  void RethrowIfFailed() {
+    if (exception_) std::rethrow_exception(std::move(exception_));
+  }
+
+ private:
+  CoRootState* root_{nullptr};
+  std::coroutine_handle<> continuation_;
+  std::exception_ptr exception_;
+};
+
+template <typename Promise>
+CoRootState& GetCoRoot(std::coroutine_handle<Promise> handle) noexcept {
+  static_assert(std::is_base_of_v<CoPromiseBase, Promise>,
+                "engine awaitables may only be awaited in engine::CoTask");
+  return handle.promise().GetRoot();
+}
+
+template <typename T>
+class CoPromise final : public CoPromiseBase {
+ public:
+  CoTask<T> get_return_object() noexcept;
+
+  template <typename U = T>
+  void return_value(U&& value) {
+    result_.emplace(std::forward<U>(value));
+  }
+
+  T GetResult() {
+    RethrowIfFailed();
+    return std::move(*result_);
+  }
+
+ private:
+  std::optional<T> result_;
+};
+
+template <>
+class CoPromise<void> final : public CoPromiseBase {
+ public:
+  CoTask<void> get_return_object() noexcept;
+
+  void return_void() const noexcept {}
+
+  void GetResult() { RethrowIfFailed(); }
+};
+
+template <typename T>
+class CoTaskAwaiter final {
+ public:
+  using Handle = std::coroutine_handle<CoPromise<T>>;
+
+  explicit CoTaskAwaiter(Handle handle) noexcept : handle_(handle) {
+    UASSERT_MSG(handle_, "Awaiting an empty engine::CoTask");
+  }
+
+  CoTaskAwaiter(CoTaskAwaiter&&) = delete;
+  CoTaskAwaiter& operator=(CoTaskAwaiter&&) = delete;
+
+  ~CoTaskAwaiter() { handle_.destroy(); }
+
+  bool await_ready() const noexcept { return false; }
+
+  template <typename Promise>
+  std::coroutine_handle<> await_suspend(
+      std::coroutine_handle<Promise> parent) noexcept {
+    handle_.promise().Start(GetCoRoot(parent), parent);
+    return handle_;
+  }
+
+  T await_resume() { return handle_.promise().GetResult(); }
+
+ private:
+  const Handle handle_;
+};
+
+class CoYieldAwaiter final {
+ public:
+  bool await_ready() const noexcept { return false; }
+
+  template <typename Promise>
+  void await_suspend(std::coroutine_handle<Promise> handle) {
+    root_ = &GetCoRoot(handle);
+    root_->Schedule(handle);
+  }
+
+  void await_resume() const { root_->ThrowIfCancelled(); }
+
+ private:
+  CoRootState* root_{nullptr};
+};
+
+class CoShouldCancelAwaiter final {
+ public:
+  bool await_ready() const noexcept { return false; }
+
+  template <typename Promise>
+  bool await_suspend(std::coroutine_handle<Promise> handle) noexcept {
+    root_ = &GetCoRoot(handle);
+    return false;
+  }
+
+  bool await_resume() const noexcept {
+    return root_->GetCancellationReason() != TaskCancellationReason::kNone;
+  }
+
+ private:
+  CoRootState* root_{nullptr};
+};
+
+template <typename T>
+class CoFutureAwaiter final {
+ public:
+  explicit CoFutureAwaiter(Future<T>& future) noexcept : future_(future) {}
+
+  bool await_ready() const noexcept { return false; }
+
+  template <typename Promise>
+  void await_suspend(std::coroutine_handle<Promise> handle) {
+    // Runs right away if the value is ready, the coroutine is rescheduled
+    // either way to keep the stack depth bounded
+    future_.SetContinuation(impl::MakeFutureContinuation(
+        [&root = GetCoRoot(handle), handle] { root.Schedule(handle); }));
+  }
+
+  T await_resume() { return future_.get(); }
+
+ private:
+  Future<T>& future_;
+};
+
+class CoDetached final {
+ public:
+  class promise_type final : public CoPromiseBase {
+   public:
+    CoDetached get_return_object() noexcept {
+      return CoDetached{
+          std::coroutine_handle<promise_type>::from_promise(*this)};
+    }
+
+    // The frame is destroyed right after the coroutine finishes
+    std::suspend_never final_suspend() const noexcept { return {}; }
+
+    void return_void() const noexcept {}
+  };
+
+  explicit CoDetached(std::coroutine_handle<promise_type> handle) noexcept
+      : handle_(handle) {}
+
+  void Start(CoRootState& root) && {
+    handle_.promise().Start(root, {});
+    root.Schedule(handle_);
+  }
+
+ private:
+  std::coroutine_handle<promise_type> handle_;
+};
+
+template <typename T>
+CoDetached RunCoRoot(std::shared_ptr<CoRootState> root, CoTask<T> task,
+                     Promise<T> promise) {
+  try {
+    root->ThrowIfCancelled();
+    if constexpr (std::is_void_v<T>) {
+      co_await std::move(task);
+      promise.set_value();
+    } else {
+      // The frame of `task` is destroyed before the result is published
+      auto result = co_await std::move(task);
+      promise.set_value(std::move(result));
+    }
+  } catch (...) {
+    promise.set_exception(std::current_exception());
+  }
+}
+
+}  // namespace impl
+
+// clang-format off
+
+/// @ingroup userver_concurrency
+///
+/// @brief A stackless C++20 coroutine that runs on a TaskProcessor without
+/// a stack of its own.
+///
+/// Each engine::Task owns a stackful coroutine from the coroutine pool, which
+/// is expensive for very small high-fanout operations such as per-key
+/// lookups. The frame of a CoTask holds just its own local variables, and
+/// switching between CoTasks does not switch stacks.
+///
+/// A CoTask is lazy: it starts when it is `co_await`-ed by another CoTask or
+/// when it is passed to engine::CoAsync. The CoTasks started by engine::CoAsync
+/// are resumed by the carrier tasks of the task processor. The carriers are
+/// ordinary tasks started on demand, at most one per worker thread, each of
+/// them resumes the ready CoTasks one after another.
+///
+/// Inside a CoTask the following may be `co_await`-ed:
+/// - another CoTask, it runs right away on the same carrier;
+/// - engine::CoYield() to let the other coroutines run;
+/// - engine::CoShouldCancel() to check the cancellation without suspending;
+/// - engine::CoWait(future) for an engine::Future, e.g. of another CoAsync,
+///   the CoTask is resumed once the value is available.
+///
+/// @warning A CoTask runs in the context of a carrier task, so any blocking
+/// call of the stackful engine API (engine::SleepFor, engine::Mutex, etc.)
+/// blocks the carrier with all the CoTasks queued to it. Task-local state,
+/// e.g. engine::TaskInheritedVariable, belongs to the carrier.
+///
+/// ## Example usage:
+///
+/// @code
+/// engine::CoTask<int> Lookup(const Cache& cache, int key) {
+///   co_return cache.Get(key);
+/// }
+///
+/// engine::CoTask<int> Sum(const Cache& cache, std::vector<int> keys) {
+///   int sum = 0;
+///   for (const auto key : keys) {
+///     sum += co_await Lookup(cache, key);
+///     co_await engine::CoYield();
+///   }
+///   co_return sum;
+/// }
+///
+/// auto handle = engine::CoAsync(Sum(cache, keys), deadline);
+/// const int sum = handle.Get();
+/// @endcode
+
+// clang-format on
+
+template <typename T>
+class [[nodiscard]] CoTask final {
+ public:
+  using promise_type = impl::CoPromise<T>;
+
+  CoTask(CoTask&& other) noexcept
+      : handle_(std::exchange(other.handle_, {})) {}
+
+  CoTask& operator=(CoTask&& other) noexcept {
+    if (this != &other) {
+      if (handle_) handle_.destroy();
+      handle_ = std::exchange(other.handle_, {});
+    }
+    return *this;
+  }
+
+  ~CoTask() {
+    if (handle_) handle_.destroy();
+  }
+
+  /// Starts the coroutine and resumes the awaiting one with its result
+  impl::CoTaskAwaiter<T> operator co_await() && noexcept {
+    return impl::CoTaskAwaiter<T>{std::exchange(handle_, {})};
+  }
+
+ private:
+  friend promise_type;
+
+  explicit CoTask(std::coroutine_handle<promise_type> handle) noexcept
+      : handle_(handle) {}
+
+  std::coroutine_handle<promise_type> handle_;
+};
+
+/// @brief A handle of a CoTask started by engine::CoAsync.
+///
+/// Like engine::TaskWithResult, the CoTask is cancelled and awaited by the
+/// destructor of the handle if it is not finished yet.
+template <typename T>
+class [[nodiscard]] CoTaskHandle final {
+ public:
+  /// Creates an invalid handle
+  CoTaskHandle() noexcept = default;
+
+  /// @cond
+  // For internal use only, use engine::CoAsync
+  CoTaskHandle(std::shared_ptr<impl::CoRootState> root,
+               Future<T>&& future) noexcept
+      : root_(std::move(root)), future_(std::move(future)) {}
+  /// @endcond
+
+  CoTaskHandle(CoTaskHandle&&) noexcept = default;
+  CoTaskHandle& operator=(CoTaskHandle&& other) noexcept {
+    if (this != &other) {
+      Abandon();
+      root_ = std::move(other.root_);
+      future_ = std::move(other.future_);
+    }
+    return *this;
+  }
+
+  ~CoTaskHandle() { Abandon(); }
+
+  /// Whether the handle refers to a CoTask
+  bool IsValid() const noexcept { return future_.valid(); }
+
+  /// Whether the CoTask has finished and its result is available
+  bool IsFinished() const {
+    UASSERT(IsValid());
+    return future_.wait_until(Deadline::Passed()) == FutureStatus::kReady;
+  }
+
+  /// @brief Requests the cancellation of the CoTask.
+  ///
+  /// The cancellation is observed by the CoTask on the next engine::CoYield()
+  /// or engine::CoShouldCancel().
+  void RequestCancel() noexcept {
+    UASSERT(IsValid());
+    root_->RequestCancel();
+  }
+
+  /// @brief Waits for the CoTask to finish
+  /// @returns FutureStatus::kCancelled if the current task is cancelled
+  [[nodiscard]] FutureStatus Wait() const { return future_.wait(); }
+
+  /// @brief Waits for the CoTask and retrieves its result, the handle becomes
+  /// invalid.
+  /// @throws the exception thrown by the CoTask
+  /// @throws WaitInterruptedException if the current task is cancelled
+  T Get() {
+    UASSERT(IsValid());
+    return future_.get();
+  }
+
+  /// @brief Future of the result, e.g. for engine::WaitAny, engine::WhenAll
+  /// or engine::CoWait
+  Future<T>& GetFuture() noexcept { return future_; }
+
+ private:
+  void Abandon() noexcept {
+    if (!IsValid()) return;
+    root_->RequestCancel();
+    const TaskCancellationBlocker block_cancel;
+    [[maybe_unused]] const auto status = future_.wait();
+  }
+
+  std::shared_ptr<impl::CoRootState> root_;
+  Future<T> future_;
+};
+
+/// @brief Starts the CoTask on the task processor.
+/// @param deadline the CoTask is cancelled once the deadline is reached
+template <typename T>
+CoTaskHandle<T> CoAsync(TaskProcessor& task_processor, CoTask<T> task,
+                        Deadline deadline = {}) {
+  auto root = std::make_shared<impl::CoRootState>(task_processor, deadline);
+  Promise<T> promise;
+  auto future = promise.get_future();
+  impl::RunCoRoot(root, std::move(task), std::move(promise)).Start(*root);
+  return CoTaskHandle<T>{std::move(root), std::move(future)};
+}
+
+/// @brief Starts the CoTask on the task processor of the current task
+template <typename T>
+CoTaskHandle<T> CoAsync(CoTask<T> task, Deadline deadline = {}) {
+  return CoAsync(current_task::GetTaskProcessor(), std::move(task), deadline);
+}
+
+/// @brief Lets the other coroutines of the task processor run, to be
+/// `co_await`-ed inside a CoTask.
+/// @throws WaitInterruptedException if the CoTask is cancelled
+inline impl::CoYieldAwaiter CoYield() noexcept { return {}; }
+
+/// @brief Returns whether the CoTask is cancelled, to be `co_await`-ed inside
+/// a CoTask. Does not suspend.
+inline impl::CoShouldCancelAwaiter CoShouldCancel() noexcept { return {}; }
+
+/// @brief Suspends the CoTask until the value of the future is available and
+/// returns it, to be `co_await`-ed inside a CoTask.
+///
+/// No carrier is occupied while waiting. The wait is not interrupted by
+/// the cancellation of the CoTask.
+template <typename T>
+impl::CoFutureAwaiter<T> CoWait(Future<T>& future) noexcept {
+  return impl::CoFutureAwaiter<T>{future};
+}
+
+/// @overload
+template <typename T>
+impl::CoFutureAwaiter<T> CoWait(CoTaskHandle<T>& handle) noexcept {
+  return impl::CoFutureAwaiter<T>{handle.GetFuture()};
+}
+
+namespace impl {
+
+template <typename T>
+CoTask<T> CoPromise<T>::get_return_object() noexcept {
+  return CoTask<T>{std::coroutine_handle<CoPromise>::from_promise(*this)};
+}
+
+inline CoTask<void> CoPromise<void>::get_return_object() noexcept {
+  return CoTask<void>{std::coroutine_handle<CoPromise>::from_promise(*this)};
+}
+
+}  // namespace impl
+
+}  // namespace engine
+
+USERVER_NAMESPACE_END
+
+#endif
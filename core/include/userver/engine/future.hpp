@@ -3,11 +3,18 @@
 /// @file userver/engine/future.hpp
 /// @brief @copybrief engine::Future
 
+#include <atomic>
 #include <chrono>
+#include <cstddef>
 #include <exception>
+#include <functional>
 #include <future>
 #include <memory>
+#include <optional>
+#include <type_traits>
+#include <vector>
 
+#include <userver/engine/async.hpp>
 #include <userver/engine/deadline.hpp>
 #include <userver/engine/future_status.hpp>
 #include <userver/engine/impl/future_state.hpp>
@@ -35,6 +42,25 @@ namespace engine {
 template <typename T>
 class Promise;
 
+/// @cond
+namespace impl {
+
+template <typename T, typename Function>
+struct ContinuationResult {
+  using type = std::invoke_result_t<Function&, T>;
+};
+
+template <typename Function>
+struct ContinuationResult<void, Function> {
+  using type = std::invoke_result_t<Function&>;
+};
+
+template <typename T, typename Function>
+using ContinuationResultType = typename ContinuationResult<T, Function>::type;
+
+}  // namespace impl
+/// @endcond
+
 /// @ingroup userver_concurrency
 ///
 /// @brief std::future replacement for asynchronous tasks that works in pair
@@ -101,11 +127,44 @@ class Future final {
   /// @throw std::future_error if Future holds no state.
   FutureStatus wait_until(Deadline deadline) const;
 
+  /// @brief Attaches a continuation that is invoked with the value right in
+  /// the thread that makes the value available.
+  ///
+  /// No task or coroutine stack is allocated for the continuation, so `f`
+  /// must be short and must not block: it may run in a non-coroutine thread.
+  /// If the value is already available, `f` is invoked immediately. If the
+  /// Future holds an exception, `f` is not invoked and the exception is
+  /// propagated to the returned Future. Exceptions thrown by `f` are stored in
+  /// the returned Future.
+  /// @returns Future for the result of `f`
+  /// @throw std::future_error if Future holds no state.
+  template <typename Function>
+  Future<impl::ContinuationResultType<T, Function>> ThenInline(
+      Function&& f) &&;
+
+  /// @brief Attaches a continuation that is invoked with the value in a new
+  /// critical task on `task_processor`.
+  ///
+  /// The task is only started once the value is available, so unlike
+  /// `utils::Async` with `get()` inside no coroutine sits waiting for it.
+  /// Exceptions are propagated as in ThenInline.
+  /// @returns Future for the result of `f`
+  /// @throw std::future_error if Future holds no state.
+  template <typename Function>
+  Future<impl::ContinuationResultType<T, Function>> Then(
+      TaskProcessor& task_processor, Function&& f) &&;
+
   /// @cond
   // Internal helper for WaitAny/WaitAll
   impl::ContextAccessor* TryGetContextAccessor() noexcept {
     return state_ ? state_->TryGetContextAccessor() : nullptr;
   }
+
+  // Internal helper for WhenAll/WhenAny
+  void SetContinuation(std::unique_ptr<impl::FutureContinuation> continuation) {
+    CheckValid();
+    state_->SetContinuation(std::move(continuation));
+  }
   /// @endcond
 
  private:
@@ -180,6 +239,116 @@ class Promise<void> final {
   std::shared_ptr<impl::FutureState<void>> state_;
 };
 
+/// @brief Returns a Future that becomes ready once all the `futures` are
+/// ready.
+///
+/// The values are collected in the order of `futures`, the first stored
+/// exception (in the same order) is propagated instead. No coroutine waits
+/// for the `futures`, the result is set by the thread that completes the last
+/// of them.
+/// @returns Future<std::vector<T>>, or Future<void> for void `T`
+/// @throw std::future_error if any of `futures` holds no state.
+template <typename T>
+auto WhenAll(std::vector<Future<T>> futures);
+
+/// @brief Returns a Future for the index of the first of `futures` to become
+/// ready.
+///
+/// The `futures` are not consumed, so the value of the ready one may be
+/// retrieved from it after that. No continuation may be attached to `futures`
+/// afterwards.
+/// @throw std::future_error if any of `futures` holds no state.
+template <typename T>
+Future<std::size_t> WhenAny(std::vector<Future<T>>& futures);
+
+/// @cond
+namespace impl {
+
+template <typename Function>
+class FutureContinuationImpl final : public FutureContinuation {
+ public:
+  explicit FutureContinuationImpl(Function&& f) : f_(std::move(f)) {}
+
+  void OnReady() noexcept override { f_(); }
+
+ private:
+  Function f_;
+};
+
+template <typename Function>
+std::unique_ptr<FutureContinuation> MakeFutureContinuation(Function&& f) {
+  return std::make_unique<FutureContinuationImpl<std::decay_t<Function>>>(
+      std::forward<Function>(f));
+}
+
+// Passes the value of a ready `state` to `f` and stores the result in `promise`
+template <typename T, typename Result, typename Function>
+void InvokeContinuation(FutureState<T>& state, Promise<Result>& promise,
+                        Function& f) noexcept {
+  try {
+    if constexpr (std::is_void_v<T>) {
+      state.Get();
+      if constexpr (std::is_void_v<Result>) {
+        std::invoke(f);
+        promise.set_value();
+      } else {
+        promise.set_value(std::invoke(f));
+      }
+    } else {
+      if constexpr (std::is_void_v<Result>) {
+        std::invoke(f, state.Get());
+        promise.set_value();
+      } else {
+        promise.set_value(std::invoke(f, state.Get()));
+      }
+    }
+  } catch (...) {
+    promise.set_exception(std::current_exception());
+  }
+}
+
+template <typename T>
+struct WhenAllState final {
+  using Result = std::conditional_t<std::is_void_v<T>, void, std::vector<T>>;
+
+  void OnReady() noexcept {
+    if (remaining.fetch_sub(1, std::memory_order_acq_rel) != 1) return;
+
+    try {
+      if constexpr (std::is_void_v<T>) {
+        for (auto& future : futures) future.get();
+        promise.set_value();
+      } else {
+        Result values;
+        values.reserve(futures.size());
+        for (auto& future : futures) values.push_back(future.get());
+        promise.set_value(std::move(values));
+      }
+    } catch (...) {
+      promise.set_exception(std::current_exception());
+    }
+    // Breaks the reference cycle through the continuations
+    futures.clear();
+  }
+
+  std::vector<Future<T>> futures;
+  std::atomic<std::size_t> remaining{0};
+  Promise<Result> promise;
+};
+
+struct WhenAnyState final {
+  void OnReady(std::size_t index) noexcept {
+    if (is_set.exchange(true, std::memory_order_acq_rel)) return;
+    promise.set_value(index);
+  }
+
+  std::atomic<bool> is_set{false};
+  Promise<std::size_t> promise;
+};
+
+}  // namespace impl
+/// @endcond
+
 template <typename T>
 bool Future<T>::valid() const noexcept {
   return !!state_;
@@ -217,6 +386,44 @@ FutureStatus Future<T>::wait_until(Deadline deadline) const {
   return state_->WaitUntil(deadline);
 }
 
+template <typename T>
+template <typename Function>
+Future<impl::ContinuationResultType<T, Function>> Future<T>::ThenInline(
+    Function&& f) && {
+  CheckValid();
+  Promise<impl::ContinuationResultType<T, Function>> promise;
+  auto future = promise.get_future();
+  auto state = std::exchange(state_, nullptr);
+  state->SetContinuation(impl::MakeFutureContinuation(
+      [state, promise = std::move(promise),
+       f = std::forward<Function>(f)]() mutable {
+        impl::InvokeContinuation(*state, promise, f);
+      }));
+  return future;
+}
+
+template <typename T>
+template <typename Function>
+Future<impl::ContinuationResultType<T, Function>> Future<T>::Then(
+    TaskProcessor& task_processor, Function&& f) && {
+  CheckValid();
+  Promise<impl::ContinuationResultType<T, Function>> promise;
+  auto future = promise.get_future();
+  auto state = std::exchange(state_, nullptr);
+  state->SetContinuation(impl::MakeFutureContinuation(
+      [state, &task_processor, promise = std::move(promise),
+       f = std::forward<Function>(f)]() mutable {
+        engine::CriticalAsyncNoSpan(
+            task_processor,
+            [state = std::move(state), promise = std::move(promise),
+             f = std::move(f)]() mutable {
+              impl::InvokeContinuation(*state, promise, f);
+            })
+            .Detach();
+      }));
+  return future;
+}
+
 template <typename T>
 Future<T>::Future(std::shared_ptr<impl::FutureState<T>> state)
     : state_(std::move(state)) {
@@ -303,6 +510,51 @@ inline void Promise<void>::set_exception(std::exception_ptr ex) {
   state_->SetException(std::move(ex));
 }
 
+template <typename T>
+auto WhenAll(std::vector<Future<T>> futures) {
+  for (const auto& future : futures) {
+    if (!future.valid()) throw std::future_error(std::future_errc::no_state);
+  }
+
+  auto all = std::make_shared<impl::WhenAllState<T>>();
+  auto result = all->promise.get_future();
+  if (futures.empty()) {
+    if constexpr (std::is_void_v<T>) {
+      all->promise.set_value();
+    } else {
+      all->promise.set_value({});
+    }
+    return result;
+  }
+
+  all->remaining.store(futures.size(), std::memory_order_relaxed);
+  all->futures = std::move(futures);
+  // The last continuation clears `all->futures`, possibly before
+  // SetContinuation returns, so the vector is not touched after the last call
+  const auto size = all->futures.size();
+  for (std::size_t i = 0; i < size; ++i) {
+    all->futures[i].SetContinuation(
+        impl::MakeFutureContinuation([all] { all->OnReady(); }));
+  }
+  return result;
+}
+
+template <typename T>
+Future<std::size_t> WhenAny(std::vector<Future<T>>& futures) {
+  if (futures.empty()) throw std::future_error(std::future_errc::no_state);
+  for (const auto& future : futures) {
+    if (!future.valid()) throw std::future_error(std::future_errc::no_state);
+  }
+
+  auto any = std::make_shared<impl::WhenAnyState>();
+  auto result = any->promise.get_future();
+  for (std::size_t i = 0; i < futures.size(); ++i) {
+    futures[i].SetContinuation(
+        impl::MakeFutureContinuation([any, i] { any->OnReady(i); }));
+  }
+  return result;
+}
+
 }  // namespace engine
 
 USERVER_NAMESPACE_END
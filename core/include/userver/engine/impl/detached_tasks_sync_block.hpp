@@ -37,8 +37,9 @@ class DetachedTasksSyncBlock final {
   static void Dispose(Token& token) noexcept;
 
  private:
+  struct Shard;
   struct Impl;
-  utils::FastPimpl<Impl, 96, 16> impl_;
+  utils::FastPimpl<Impl, 32, 8> impl_;
 };
 
 }  // namespace engine::impl
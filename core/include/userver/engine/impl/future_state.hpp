@@ -1,7 +1,9 @@
 #pragma once
 
 #include <atomic>
+#include <cstdint>
 #include <exception>
+#include <memory>
 
 #include <userver/engine/deadline.hpp>
 #include <userver/engine/future_status.hpp>
@@ -13,6 +15,16 @@ USERVER_NAMESPACE_BEGIN
 
 namespace engine::impl {
 
+/// Callback that is invoked once the future state becomes ready
+class FutureContinuation {
+ public:
+  virtual ~FutureContinuation() = default;
+
+  /// Called exactly once, either from the thread that makes the state ready
+  /// or from the one that sets the continuation if the state is ready already.
+  virtual void OnReady() noexcept = 0;
+};
+
 class FutureStateBase : private ContextAccessor {
  public:
   bool IsReady() const noexcept final;
@@ -25,6 +37,10 @@ class FutureStateBase : private ContextAccessor {
   // Internal helper for WaitAny/WaitAll
   ContextAccessor* TryGetContextAccessor() noexcept { return this; }
 
+  // Internal helper for continuations and WhenAll/WhenAny, at most one
+  // continuation may be set
+  void SetContinuation(std::unique_ptr<FutureContinuation> continuation);
+
  protected:
   FutureStateBase() noexcept;
   ~FutureStateBase();
@@ -40,10 +56,16 @@ class FutureStateBase : private ContextAccessor {
   void RemoveWaiter(TaskContext& waiter) noexcept final;
   void AfterWait() noexcept final;
 
+  void RunContinuation() noexcept;
+
   FastPimplWaitListLight finish_waiters_;
   std::atomic<bool> is_ready_;
   std::atomic<bool> is_result_store_locked_;
   std::atomic<bool> is_future_created_;
+  // Whoever of SetContinuation and ReleaseResultStore comes second runs the
+  // continuation
+  std::atomic<std::uint8_t> continuation_flags_;
+  std::unique_ptr<FutureContinuation> continuation_;
 };
 
 template <typename T>
@@ -24,16 +24,18 @@ struct TaskConfig final {
   Task::Importance importance{Task::Importance::kNormal};
   Task::WaitMode wait_mode{Task::WaitMode::kSingleWaiter};
   engine::Deadline deadline;
+  Task::Priority priority{Task::Priority::kNormal};
 };
 
 [[nodiscard]] TaskContext& PlacementNewTaskContext(
-    std::byte* storage, TaskConfig config,
+    std::byte* storage, std::size_t total_size, TaskConfig config,
     utils::impl::WrappedCallBase& payload);
 
 // Never returns nullptr, may throw.
 std::byte* AllocateFusedTaskContext(std::size_t total_size);
 
-void DeleteFusedTaskContext(std::byte* storage) noexcept;
+void DeleteFusedTaskContext(std::byte* storage,
+                            std::size_t total_size) noexcept;
 
 // The allocations for TaskContext and WrappedCall are manually fused. The
 // layout is as follows:
@@ -59,7 +61,7 @@ TaskContextHolder MakeTask(TaskConfig config, Function&& f, Args&&... args) {
 
   std::byte* const storage = AllocateFusedTaskContext(total_size);
   utils::FastScopeGuard delete_guard{
-      [&]() noexcept { DeleteFusedTaskContext(storage); }};
+      [&]() noexcept { DeleteFusedTaskContext(storage, total_size); }};
 
   std::byte* const payload_storage = storage + task_context_size;
 
@@ -68,7 +70,8 @@ TaskContextHolder MakeTask(TaskConfig config, Function&& f, Args&&... args) {
   utils::FastScopeGuard destroy_payload_guard{
       [&]() noexcept { std::destroy_at(&payload); }};
 
-  auto& context = PlacementNewTaskContext(storage, config, payload);
+  auto& context =
+      PlacementNewTaskContext(storage, total_size, config, payload);
 
   destroy_payload_guard.Release();
   delete_guard.Release();
@@ -0,0 +1,43 @@
+#pragma once
+
+#include <cstddef>
+#include <vector>
+
+#include <userver/engine/task/task_processor_fwd.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace engine::impl {
+
+class TaskContext;
+
+/// While alive, the tasks of `task_processor` that are started by the current
+/// task are not queued one by one. They are pushed to the task queue at once
+/// on destruction of the batch instead, with a single wakeup of the workers.
+///
+/// At most `max_size` tasks are deferred, the rest are queued immediately.
+///
+/// @warning The deferred tasks do not run until the batch is destroyed, so the
+/// current task must not wait for them while the batch is alive.
+class TaskStartBatch final {
+ public:
+  TaskStartBatch(TaskProcessor& task_processor, std::size_t max_size);
+
+  TaskStartBatch(TaskStartBatch&&) = delete;
+  TaskStartBatch& operator=(TaskStartBatch&&) = delete;
+
+  ~TaskStartBatch();
+
+  // Returns false if the context should be scheduled as usual
+  bool TryDefer(TaskContext& context) noexcept;
+
+ private:
+  TaskProcessor& task_processor_;
+  TaskContext& owner_;
+  TaskStartBatch* const previous_;
+  std::vector<TaskContext*> contexts_;
+};
+
+}  // namespace engine::impl
+
+USERVER_NAMESPACE_END
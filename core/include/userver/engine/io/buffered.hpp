@@ -5,6 +5,7 @@
 
 #include <functional>
 #include <string>
+#include <string_view>
 
 #include <userver/compiler/select.hpp>
 #include <userver/engine/deadline.hpp>
@@ -69,6 +70,12 @@ class BufferedReader final {
   /// Returns the first byte of the buffer or EOF (-1).
   int Peek(Deadline deadline = {});
 
+  /// @brief Buffers at least `num_bytes` bytes and returns a view of the
+  /// buffered bytes without consuming them.
+  /// @note May return less bytes than requested in case of EOF.
+  /// @warning The view is invalidated by any other call to the reader.
+  std::string_view PeekAll(size_t num_bytes, Deadline deadline = {});
+
   /// Discards the specified number of bytes from the buffer.
   void Discard(size_t num_bytes, Deadline deadline = {});
 
@@ -81,6 +81,17 @@ class WritableBase {
     return result;
   }
 
+  /// @brief Sends exactly list_size IoData.
+  /// @note Can return less than the total size if stream is closed by peer.
+  [[nodiscard]] virtual size_t WriteAll(const IoData* list, size_t list_size,
+                                        Deadline deadline) {
+    size_t result{0};
+    for (size_t i = 0; i < list_size; ++i) {
+      result += WriteAll(list[i].data, list[i].len, deadline);
+    }
+    return result;
+  }
+
   /// For internal use only
   impl::ContextAccessor* TryGetContextAccessor() { return ca_; }
 
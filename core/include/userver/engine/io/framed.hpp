@@ -0,0 +1,80 @@
+#pragma once
+
+/// @file userver/engine/io/framed.hpp
+/// @brief Length-prefixed framed stream wrappers
+
+#include <cstddef>
+#include <optional>
+#include <string>
+#include <string_view>
+
+#include <userver/engine/deadline.hpp>
+#include <userver/engine/io/buffered.hpp>
+#include <userver/engine/io/common.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace engine::io {
+
+/// Size of the frame header: payload length as a 32-bit big-endian integer
+inline constexpr std::size_t kFrameHeaderSize = 4;
+
+/// @brief Reader of length-prefixed frames.
+///
+/// Reads the stream ahead into an internal buffer and returns the frames as
+/// views of that buffer, without copying the payload.
+class FramedReader final {
+ public:
+  /// Creates a reader that rejects the frames larger than `max_frame_size`.
+  FramedReader(ReadableBasePtr source, std::size_t max_frame_size);
+
+  /// Whether the underlying source is valid.
+  bool IsValid() const;
+
+  /// @brief Reads the next frame payload.
+  /// @returns std::nullopt on EOF at the frame boundary.
+  /// @throws IoException on a truncated or an oversized frame.
+  /// @throws IoTimeout on timeout, the frame is not consumed and may be read
+  /// again.
+  /// @warning The view is invalidated by the next call to the reader.
+  std::optional<std::string_view> ReadFrame(Deadline deadline = {});
+
+ private:
+  BufferedReader reader_;
+  const std::size_t max_frame_size_;
+  std::size_t consumed_bytes_{0};
+};
+
+/// @brief Writer of length-prefixed frames.
+///
+/// Small frames are coalesced in an internal buffer and are sent with a single
+/// write on Flush. Large frames are sent from the caller memory directly.
+class FramedWriter final {
+ public:
+  /// @brief Creates a writer over `sink`.
+  /// @note `sink` must outlive the writer.
+  explicit FramedWriter(WritableBase& sink);
+
+  /// @brief Appends a frame to the buffer without sending it.
+  /// @note Does not flush the buffer, even if it grows large.
+  void Append(std::string_view payload);
+
+  /// Size of the data appended but not yet flushed.
+  std::size_t GetBufferedSize() const { return buffer_.size(); }
+
+  /// @brief Sends the buffered frames.
+  /// @throws IoException if the stream was closed by peer.
+  void Flush(Deadline deadline = {});
+
+  /// @brief Sends the buffered frames followed by the new one.
+  /// @throws IoException if the stream was closed by peer.
+  void WriteFrame(std::string_view payload, Deadline deadline = {});
+
+ private:
+  WritableBase& sink_;
+  std::string buffer_;
+};
+
+}  // namespace engine::io
+
+USERVER_NAMESPACE_END
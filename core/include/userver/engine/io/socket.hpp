@@ -5,6 +5,8 @@
 
 #include <sys/socket.h>
 
+#include <cstddef>
+#include <cstdint>
 #include <initializer_list>
 
 #include <userver/engine/deadline.hpp>
@@ -28,6 +30,43 @@ enum class SocketType {
   kUdp = kDgram,
 };
 
+/// @brief A datagram to send with Socket::SendMany
+struct OutgoingDatagram {
+  const void* data{nullptr};
+  std::size_t len{0};
+
+  /// Destination address, the connected peer is used if not set.
+  /// Sockaddr domain must match the socket's domain.
+  const Sockaddr* dest_addr{nullptr};
+
+  /// @brief Non-zero value makes the kernel split the datagram into datagrams
+  /// of `segment_size` bytes each, the last one may be shorter (UDP GSO).
+  /// @note Linux only, throws IoException on other platforms.
+  std::uint16_t segment_size{0};
+};
+
+/// @brief A buffer for a datagram received with Socket::RecvMany
+struct IncomingDatagram {
+  void* buf{nullptr};
+  std::size_t len{0};
+
+  /// Number of received bytes, filled by Socket::RecvMany
+  std::size_t bytes_received{0};
+
+  /// Source address, filled by Socket::RecvMany
+  Sockaddr src_addr;
+
+  /// Whether the datagram did not fit into `len` bytes and was truncated
+  bool is_truncated{false};
+
+  /// @brief Size of the coalesced datagrams if the kernel merged several
+  /// datagrams of the same source into this one, 0 otherwise.
+  ///
+  /// The kernel does so only with the `UDP_GRO` socket option enabled, e.g.
+  /// `socket.SetOption(SOL_UDP, UDP_GRO, 1)` (Linux only).
+  std::uint16_t segment_size{0};
+};
+
 /// @brief Socket representation.
 ///
 /// It is not thread-safe to concurrently read from socket. It is not
@@ -94,6 +133,11 @@ class [[nodiscard]] Socket final : public RwBase {
     return SendAll(list, deadline);
   }
 
+  [[nodiscard]] size_t WriteAll(const IoData* list, std::size_t list_size,
+                                Deadline deadline) override {
+    return SendAll(list, list_size, deadline);
+  }
+
   /// @brief Sends exactly list_size IoData to the socket.
   /// @note Can return less than len if socket is closed by peer.
   [[nodiscard]] size_t SendAll(const IoData* list, std::size_t list_size,
@@ -108,6 +152,27 @@ class [[nodiscard]] Socket final : public RwBase {
   /// @note Can return less than len if socket is closed by peer.
   [[nodiscard]] size_t SendAll(const void* buf, size_t len, Deadline deadline);
 
+  /// @brief Sends `len` bytes of the file starting at `offset` without
+  /// copying them through the userspace (sendfile).
+  /// @note Can return less than len if socket is closed by peer or the file
+  /// is shorter.
+  /// @note Reading a file that is not in the page cache blocks the thread.
+  [[nodiscard]] size_t SendFile(int file_fd, size_t offset, size_t len,
+                                Deadline deadline);
+
+  /// @brief Makes SendAll send the buffers of at least `threshold` bytes in
+  /// total without copying them into the kernel (MSG_ZEROCOPY), 0 disables.
+  ///
+  /// Such SendAll returns only once the kernel reports that it no longer
+  /// reads the buffers, which happens once the peer acknowledges the data. It
+  /// keeps waiting for that even if the deadline is reached or the task is
+  /// cancelled, so that the buffers are not modified while being sent.
+  ///
+  /// Zero-copy pays off only for large buffers. It is silently disabled for
+  /// the socket if it is not supported (non-Linux, not TCP) or if the kernel
+  /// ends up copying the data anyway (e.g. for the loopback).
+  void SetZeroCopySendThreshold(size_t threshold);
+
   /// @brief Accepts a connection from a listening socket.
   /// @see engine::io::Listen
   [[nodiscard]] Socket Accept(Deadline);
@@ -127,6 +192,23 @@ class [[nodiscard]] Socket final : public RwBase {
   [[nodiscard]] size_t SendAllTo(const Sockaddr& dest_addr, const void* buf,
                                  size_t len, Deadline deadline);
 
+  /// @brief Sends the datagrams in as few syscalls as possible (sendmmsg).
+  /// @returns the number of sent datagrams, less than `count` only if an
+  /// error occurred after some of the datagrams had been sent.
+  /// @note IoInterrupted::BytesTransferred() of the thrown exceptions is the
+  /// number of sent datagrams.
+  /// @note Not for SocketType::kStream connections.
+  [[nodiscard]] std::size_t SendMany(const OutgoingDatagram* datagrams,
+                                     std::size_t count, Deadline deadline);
+
+  /// @brief Waits for at least one datagram and receives the already arrived
+  /// ones into the buffers in as few syscalls as possible (recvmmsg).
+  /// @returns the number of received datagrams, their sizes and source
+  /// addresses are stored into `datagrams`.
+  /// @note Not for SocketType::kStream connections.
+  [[nodiscard]] std::size_t RecvMany(IncomingDatagram* datagrams,
+                                     std::size_t count, Deadline deadline);
+
   /// File descriptor corresponding to this socket.
   int Fd() const;
 
@@ -173,11 +255,17 @@ class [[nodiscard]] Socket final : public RwBase {
   }
 
  private:
+  size_t SendAllZeroCopy(struct iovec* list, std::size_t list_size,
+                         Deadline deadline);
+
   AddrDomain domain_{AddrDomain::kUnspecified};
 
   impl::FdControlHolder fd_control_;
   Sockaddr peername_;
   Sockaddr sockname_;
+
+  size_t zero_copy_send_threshold_{0};
+  std::uint32_t zero_copy_next_id_{0};
 };
 
 }  // namespace engine::io
@@ -3,6 +3,7 @@
 /// @file userver/engine/io/tls_wrapper.hpp
 /// @brief TLS socket wrappers
 
+#include <memory>
 #include <string>
 #include <vector>
 
@@ -17,6 +18,33 @@ USERVER_NAMESPACE_BEGIN
 
 namespace engine::io {
 
+/// @brief Server side TLS settings that are shared between connections.
+///
+/// Owns the TLS session cache and the session ticket keys. Clients that
+/// reconnect to a server that uses the same context may resume their
+/// sessions instead of going through a full handshake.
+///
+/// Thread safe.
+class TlsServerContext final {
+ public:
+  /// @param alpn_protocols application protocols that the server agrees to
+  /// negotiate via ALPN, in order of preference
+  TlsServerContext(const crypto::Certificate& cert,
+                   const crypto::PrivateKey& key,
+                   const std::vector<crypto::Certificate>& cert_authorities = {},
+                   const std::vector<std::string>& alpn_protocols = {});
+  ~TlsServerContext();
+
+  TlsServerContext(TlsServerContext&&) noexcept;
+  TlsServerContext& operator=(TlsServerContext&&) noexcept;
+
+ private:
+  friend class TlsWrapper;
+
+  class Impl;
+  std::unique_ptr<Impl> impl_;
+};
+
 /// Class for TLS communications over a Socket.
 ///
 /// Not thread safe. E.g. you MAY NOT read and write concurrently from multiple
@@ -38,11 +66,20 @@ class [[nodiscard]] TlsWrapper final : public RwBase {
       Deadline deadline,
       const std::vector<crypto::Certificate>& cert_authorities = {});
 
-  /// Starts a TLS server on an opened socket
+  /// @brief Starts a TLS server on an opened socket
+  /// @param alpn_protocols application protocols that the server agrees to
+  /// negotiate via ALPN, in order of preference
   static TlsWrapper StartTlsServer(
       Socket&& socket, const crypto::Certificate& cert,
       const crypto::PrivateKey& key, Deadline deadline,
-      const std::vector<crypto::Certificate>& cert_authorities = {});
+      const std::vector<crypto::Certificate>& cert_authorities = {},
+      const std::vector<std::string>& alpn_protocols = {});
+
+  /// @brief Starts a TLS server on an opened socket, sessions may be resumed
+  /// across the connections that use the same context
+  static TlsWrapper StartTlsServer(Socket&& socket,
+                                   const TlsServerContext& context,
+                                   Deadline deadline);
 
   ~TlsWrapper() override;
 
@@ -77,6 +114,8 @@ class [[nodiscard]] TlsWrapper final : public RwBase {
   /// @brief Finishes TLS session and returns the socket.
   /// @warning Wrapper becomes invalid on entry and can only be used to retry
   ///   socket extraction if interrupted.
+  /// @note TLS records are read ahead, so the data that the peer sent right
+  ///   after its close_notify may be consumed by the wrapper.
   [[nodiscard]] Socket StopTls(Deadline deadline);
 
   /// @brief Receives at least one byte from the socket.
@@ -104,8 +143,20 @@ class [[nodiscard]] TlsWrapper final : public RwBase {
   [[nodiscard]] size_t WriteAll(std::initializer_list<IoData> list,
                                 Deadline deadline) override;
 
+  /// @brief Writes exactly list_size IoData to the socket, small buffers are
+  /// coalesced into TLS records.
+  /// @note Can return less than the total size if socket is closed by peer.
+  [[nodiscard]] size_t WriteAll(const IoData* list, std::size_t list_size,
+                                Deadline deadline) override;
+
   int GetRawFd();
 
+  /// The application protocol negotiated via ALPN, empty if none
+  std::string GetAlpnProtocol() const;
+
+  /// Whether the TLS session was resumed instead of a full handshake
+  bool IsSessionReused() const;
+
  private:
   explicit TlsWrapper(Socket&&);
 
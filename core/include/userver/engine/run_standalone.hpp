@@ -21,6 +21,12 @@ struct TaskProcessorPoolsConfig final {
   std::string ev_thread_name = "ev";
   bool ev_default_loop_disabled = false;
   bool defer_events = true;
+  /// Use io_uring instead of libev io watchers to wait for fd readiness, if
+  /// the kernel supports it
+  bool ev_io_uring_enabled = false;
+  /// Use a per-thread hierarchical timer wheel instead of libev timers for
+  /// task deadlines and sleeps
+  bool ev_timer_wheel_enabled = false;
 };
 
 /// @brief Runs a payload in a temporary coroutine engine instance.
@@ -0,0 +1,168 @@
+#pragma once
+
+/// @file userver/engine/striped_shared_mutex.hpp
+/// @brief @copybrief engine::StripedSharedMutex
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+
+#include <userver/concurrent/impl/striped_read_indicator.hpp>
+#include <userver/engine/condition_variable.hpp>
+#include <userver/engine/deadline.hpp>
+#include <userver/engine/mutex.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace engine {
+
+/// @ingroup userver_concurrency
+///
+/// @brief std::shared_mutex replacement for asynchronous tasks, optimized for
+/// read-mostly workloads.
+///
+/// Unlike engine::SharedMutex, the readers do not modify any shared state:
+/// they are counted by a concurrent::impl::StripedReadIndicator in per-CPU
+/// counters, so a shared lock costs a few non-contended operations. In
+/// exchange, a unique lock is much more expensive: it issues a heavy
+/// asymmetric fence and sums up the counters of all CPUs. It also takes
+/// `16 * N_CORES` bytes more memory than engine::SharedMutex.
+///
+/// Ignores task cancellations (succeeds even if the current task is cancelled).
+///
+/// Writers (unique locks) have priority over readers (shared locks): new
+/// shared locks wait for all the pending writers, the readers are woken up
+/// at once when the last writer unlocks.
+///
+/// Use it instead of engine::SharedMutex only for data that is read by many
+/// concurrent tasks and is rarely written.
+///
+/// @see @ref scripts/docs/en/userver/synchronization.md
+class StripedSharedMutex final {
+ public:
+  StripedSharedMutex();
+  ~StripedSharedMutex();
+
+  StripedSharedMutex(const StripedSharedMutex&) = delete;
+  StripedSharedMutex(StripedSharedMutex&&) = delete;
+  StripedSharedMutex& operator=(const StripedSharedMutex&) = delete;
+  StripedSharedMutex& operator=(StripedSharedMutex&&) = delete;
+
+  /// Locks the mutex for unique ownership. Blocks current coroutine if the
+  /// mutex is locked by another coroutine for reading or writing.
+  ///
+  /// @note The method waits for the mutex even if the current task is
+  /// cancelled.
+  void lock();
+
+  /// Unlocks the mutex for unique ownership. Before calling this method the
+  /// the mutex should be locked for unique ownership by current coroutine.
+  void unlock();
+
+  /// Tries to lock the mutex for unique ownership without blocking the
+  /// coroutine, returns true if succeeded.
+  [[nodiscard]] bool try_lock();
+
+  /// Tries to lock the mutex for unique ownership in specified duration.
+  ///
+  /// @returns true if the locking succeeded
+  template <typename Rep, typename Period>
+  [[nodiscard]] bool try_lock_for(const std::chrono::duration<Rep, Period>&);
+
+  /// Tries to lock the mutex for unique ownership till specified time point.
+  ///
+  /// @returns true if the locking succeeded
+  template <typename Clock, typename Duration>
+  [[nodiscard]] bool try_lock_until(
+      const std::chrono::time_point<Clock, Duration>&);
+
+  /// @overload
+  [[nodiscard]] bool try_lock_until(Deadline deadline);
+
+  /// Locks the mutex for shared ownership. Blocks current coroutine if the
+  /// mutex is locked or is waited for by a writer.
+  ///
+  /// @note The method waits for the mutex even if the current task is
+  /// cancelled.
+  void lock_shared();
+
+  /// Unlocks the mutex for shared ownership. Before calling this method the
+  /// mutex should be locked for shared ownership by current coroutine.
+  void unlock_shared();
+
+  /// Tries to lock the mutex for shared ownership without blocking the
+  /// coroutine, returns true if succeeded.
+  [[nodiscard]] bool try_lock_shared();
+
+  /// Tries to lock the mutex for shared ownership in specified duration.
+  ///
+  /// @returns true if the locking succeeded
+  template <typename Rep, typename Period>
+  [[nodiscard]] bool try_lock_shared_for(
+      const std::chrono::duration<Rep, Period>&);
+
+  /// Tries to lock the mutex for shared ownership till specified time point.
+  ///
+  /// @returns true if the locking succeeded
+  template <typename Clock, typename Duration>
+  [[nodiscard]] bool try_lock_shared_until(
+      const std::chrono::time_point<Clock, Duration>&);
+
+  /// @overload
+  [[nodiscard]] bool try_lock_shared_until(Deadline deadline);
+
+ private:
+  bool TryLockSharedOnce();
+
+  bool WaitForNoWriters(Deadline deadline);
+
+  bool WaitForNoReaders(Deadline deadline);
+
+  void DecWriters();
+
+  void NotifyWriter();
+
+  /* Locked by the readers. Writers wait for it to become free. */
+  concurrent::impl::StripedReadIndicator readers_;
+
+  /* Pending and active writers. Readers back off if it is not zero. */
+  std::atomic<std::size_t> writers_count_{0};
+
+  /* Serializes the writers. */
+  Mutex writer_mutex_;
+
+  /* Guards the waits of the readers for no writers and of the writer for
+   * no readers.
+   */
+  Mutex wait_mutex_;
+  ConditionVariable readers_cv_;
+  ConditionVariable writer_cv_;
+};
+
+template <typename Rep, typename Period>
+bool StripedSharedMutex::try_lock_for(
+    const std::chrono::duration<Rep, Period>& duration) {
+  return try_lock_until(Deadline::FromDuration(duration));
+}
+
+template <typename Rep, typename Period>
+bool StripedSharedMutex::try_lock_shared_for(
+    const std::chrono::duration<Rep, Period>& duration) {
+  return try_lock_shared_until(Deadline::FromDuration(duration));
+}
+
+template <typename Clock, typename Duration>
+bool StripedSharedMutex::try_lock_until(
+    const std::chrono::time_point<Clock, Duration>& until) {
+  return try_lock_until(Deadline::FromTimePoint(until));
+}
+
+template <typename Clock, typename Duration>
+bool StripedSharedMutex::try_lock_shared_until(
+    const std::chrono::time_point<Clock, Duration>& until) {
+  return try_lock_shared_until(Deadline::FromTimePoint(until));
+}
+
+}  // namespace engine
+
+USERVER_NAMESPACE_END
@@ -25,13 +25,15 @@ namespace engine::subprocess {
 /// @brief Creates a new OS subprocess and executes a command in it.
 class ProcessStarter {
  public:
-  /// @param task_processor will be used for executing asynchronous fork + exec.
+  /// @param task_processor will be used for executing asynchronous spawn.
   /// `main-task-processor is OK for this purpose.
   explicit ProcessStarter(TaskProcessor& task_processor);
 
   /// @param command the absolute path to the executable
   /// @param args exact args passed to the executable
   /// @param env redefines all environment variables
+  /// @throws std::system_error if the process could not be started, e.g. the
+  /// executable or the output files could not be opened
   ChildProcess Exec(
       const std::string& command, const std::vector<std::string>& args,
       const EnvironmentVariables& env,
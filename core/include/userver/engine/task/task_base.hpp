@@ -48,6 +48,29 @@ class [[nodiscard]] TaskBase {
     kCritical,
   };
 
+  /// @brief Task priority, affects the order in which the ready tasks of a
+  /// TaskProcessor are executed.
+  ///
+  /// Tasks of higher priority are generally executed first, but lower
+  /// priority tasks are guaranteed to get a share of the TaskProcessor, so
+  /// that they do not starve.
+  ///
+  /// Unlike Importance::kCritical, does not affect the cancellation of
+  /// the task on overload.
+  ///
+  /// @note Only honored by the global TaskProcessor task queue, the
+  /// work-stealing queue treats all the tasks as normal ones.
+  enum class Priority {
+    /// Latency-critical work, e.g. request handling
+    kCritical,
+
+    /// Normal task
+    kNormal,
+
+    /// Background work, e.g. cache updates or metrics serialization
+    kBackground,
+  };
+
   /// Task state
   enum class State {
     kInvalid,    ///< Unusable
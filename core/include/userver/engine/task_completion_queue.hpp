@@ -0,0 +1,211 @@
+#pragma once
+
+/// @file userver/engine/task_completion_queue.hpp
+/// @brief @copybrief engine::TaskCompletionQueue
+
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <optional>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <userver/engine/async.hpp>
+#include <userver/engine/deadline.hpp>
+#include <userver/engine/sleep.hpp>
+#include <userver/engine/task/task_with_result.hpp>
+#include <userver/utils/assert.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace engine {
+
+/// @cond
+namespace impl {
+
+class TaskCompletionChannel;
+
+// Reports the task completion from the dtor of the task payload, so that it
+// fires both after the function returns and when the task is cancelled before
+// it has started.
+class TaskCompletionNotifier final {
+ public:
+  TaskCompletionNotifier(std::shared_ptr<TaskCompletionChannel> channel,
+                         std::size_t index) noexcept;
+
+  TaskCompletionNotifier(TaskCompletionNotifier&&) noexcept = default;
+  TaskCompletionNotifier& operator=(TaskCompletionNotifier&&) = delete;
+  ~TaskCompletionNotifier();
+
+ private:
+  std::shared_ptr<TaskCompletionChannel> channel_;
+  std::size_t index_;
+};
+
+template <typename Function>
+struct NotifyingCall final {
+  template <typename... Args>
+  decltype(auto) operator()(Args&&... args) {
+    return std::invoke(std::move(function), std::forward<Args>(args)...);
+  }
+
+  TaskCompletionNotifier notifier;
+  Function function;
+};
+
+class TaskCompletionQueueBase {
+ protected:
+  TaskCompletionQueueBase();
+  TaskCompletionQueueBase(TaskCompletionQueueBase&&) noexcept;
+  TaskCompletionQueueBase& operator=(TaskCompletionQueueBase&&) noexcept;
+  ~TaskCompletionQueueBase();
+
+  TaskCompletionNotifier MakeNotifier(std::size_t index) const;
+
+  // Returns std::nullopt on timeout or cancellation
+  std::optional<std::size_t> PopUntil(Deadline deadline);
+
+  [[noreturn]] static void ThrowWaitInterrupted();
+
+ private:
+  std::shared_ptr<TaskCompletionChannel> channel_;
+};
+
+}  // namespace impl
+/// @endcond
+
+/// @ingroup userver_concurrency
+///
+/// @brief Starts tasks and delivers them back in the order of their
+/// completion.
+///
+/// Unlike engine::WaitAny, which subscribes to every task on each call and
+/// rescans all of them after a wakeup, each task reports its own completion
+/// once, so gathering the results of N tasks costs O(N) in total.
+///
+/// Destroying the queue cancels and waits for the tasks that were not
+/// delivered yet.
+///
+/// Not thread-safe: the tasks must be started and waited for by a single task.
+///
+/// ## Example usage:
+///
+/// @snippet engine/task_completion_queue_test.cpp  Sample TaskCompletionQueue
+template <typename T>
+class TaskCompletionQueue final : private impl::TaskCompletionQueueBase {
+ public:
+  struct Completion final {
+    /// Index of the task in the order of AsyncNoSpan calls
+    std::size_t index;
+    /// Finished task, its Get() returns without waiting
+    TaskWithResult<T> task;
+  };
+
+  TaskCompletionQueue() = default;
+
+  TaskCompletionQueue(TaskCompletionQueue&&) noexcept = default;
+  TaskCompletionQueue& operator=(TaskCompletionQueue&&) noexcept = default;
+
+  /// @brief Starts a task on `task_processor` as engine::AsyncNoSpan does
+  /// @returns the index of the task
+  template <typename Function, typename... Args>
+  std::size_t AsyncNoSpan(TaskProcessor& task_processor, Function&& f,
+                          Args&&... args);
+
+  /// @brief Starts a task on the current task processor as
+  /// engine::AsyncNoSpan does
+  /// @returns the index of the task
+  template <typename Function, typename... Args>
+  std::size_t AsyncNoSpan(Function&& f, Args&&... args);
+
+  /// @brief Waits for the next task to finish.
+  /// @returns the finished task, or `std::nullopt` if all the started tasks
+  /// were already delivered
+  /// @throws WaitInterruptedException if the current task has been cancelled
+  std::optional<Completion> WaitNext();
+
+  /// @brief Waits for the next task to finish until the `deadline`.
+  /// @returns the finished task, or `std::nullopt` if all the started tasks
+  /// were already delivered, the `deadline` has passed or the current task has
+  /// been cancelled
+  std::optional<Completion> WaitNextUntil(Deadline deadline);
+
+  /// Number of started tasks that were not delivered yet
+  std::size_t GetPendingCount() const noexcept { return pending_count_; }
+
+ private:
+  template <typename Task>
+  std::size_t AddTask(Task&& task);
+
+  Completion Extract(std::size_t index);
+
+  std::vector<TaskWithResult<T>> tasks_;
+  std::size_t pending_count_{0};
+};
+
+template <typename T>
+template <typename Function, typename... Args>
+std::size_t TaskCompletionQueue<T>::AsyncNoSpan(TaskProcessor& task_processor,
+                                                Function&& f, Args&&... args) {
+  const auto index = tasks_.size();
+  return AddTask(engine::AsyncNoSpan(
+      task_processor,
+      impl::NotifyingCall<std::decay_t<Function>>{MakeNotifier(index),
+                                                  std::forward<Function>(f)},
+      std::forward<Args>(args)...));
+}
+
+template <typename T>
+template <typename Function, typename... Args>
+std::size_t TaskCompletionQueue<T>::AsyncNoSpan(Function&& f, Args&&... args) {
+  return AsyncNoSpan(current_task::GetTaskProcessor(),
+                     std::forward<Function>(f), std::forward<Args>(args)...);
+}
+
+template <typename T>
+auto TaskCompletionQueue<T>::WaitNext() -> std::optional<Completion> {
+  auto completion = WaitNextUntil({});
+  if (!completion && pending_count_ != 0) ThrowWaitInterrupted();
+  return completion;
+}
+
+template <typename T>
+auto TaskCompletionQueue<T>::WaitNextUntil(Deadline deadline)
+    -> std::optional<Completion> {
+  while (pending_count_ != 0) {
+    const auto index = PopUntil(deadline);
+    if (!index) return std::nullopt;
+    // A task that failed to be added still reports its completion, skip it
+    if (*index < tasks_.size() && tasks_[*index].IsValid()) {
+      return Extract(*index);
+    }
+  }
+  return std::nullopt;
+}
+
+template <typename T>
+template <typename Task>
+std::size_t TaskCompletionQueue<T>::AddTask(Task&& task) {
+  static_assert(std::is_same_v<std::decay_t<Task>, TaskWithResult<T>>,
+                "The function result type does not match the queue type");
+  tasks_.push_back(std::forward<Task>(task));
+  ++pending_count_;
+  return tasks_.size() - 1;
+}
+
+template <typename T>
+auto TaskCompletionQueue<T>::Extract(std::size_t index) -> Completion {
+  UASSERT(index < tasks_.size());
+  UASSERT(tasks_[index].IsValid());
+  --pending_count_;
+  Completion completion{index, std::move(tasks_[index])};
+  // The payload is destroyed right before the task finishes, the remaining
+  // epilogue is short and does not depend on the current task
+  while (!completion.task.IsFinished()) engine::Yield();
+  return completion;
+}
+
+}  // namespace engine
+
+USERVER_NAMESPACE_END
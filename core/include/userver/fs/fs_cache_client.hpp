@@ -23,8 +23,10 @@ class FsCacheClient final {
   /// @param update_period time (0 - fill the cache only at startup), not used
   /// in Linux
   /// @param tp task processor to do filesystem operations
+  /// @param precompress whether to keep gzip and zstd compressed variants of
+  /// the files
   FsCacheClient(std::string_view dir, std::chrono::milliseconds update_period,
-                engine::TaskProcessor& tp);
+                engine::TaskProcessor& tp, bool precompress = false);
 
   /// @brief get file from memory
   /// @param path to file
@@ -36,6 +38,9 @@ class FsCacheClient final {
   void UpdateCache();
 
  private:
+  // Fills the entity tag and the compressed variants
+  FileInfoWithDataConstPtr PrepareFile(FileInfoWithData&& info) const;
+
 #ifdef __linux__
   void InotifyWork();
 
@@ -53,6 +58,7 @@ class FsCacheClient final {
   const std::string dir_;
   const std::chrono::milliseconds update_period_;
   engine::TaskProcessor& tp_;
+  const bool precompress_;
 #ifndef __linux__
   utils::PeriodicTask cache_updater_;
 #endif
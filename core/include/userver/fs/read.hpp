@@ -19,6 +19,14 @@ namespace fs {
 struct FileInfoWithData {
   std::string data;
   std::string extension;
+
+  /// Quoted strong entity tag of the `data`, filled by fs::FsCacheClient
+  std::string etag;
+
+  /// The `data` compressed with gzip and zstd, filled by fs::FsCacheClient
+  /// with the precompression enabled. Empty if compression does not pay off.
+  std::string gzip_data;
+  std::string zstd_data;
 };
 
 using FileInfoWithDataConstPtr = std::shared_ptr<const FileInfoWithData>;
@@ -3,6 +3,7 @@
 /// @file userver/logging/component.hpp
 /// @brief @copybrief components::Logging
 
+#include <optional>
 #include <string>
 #include <unordered_map>
 
@@ -10,6 +11,7 @@
 #include <userver/components/component_fwd.hpp>
 #include <userver/components/raw_component_base.hpp>
 #include <userver/concurrent/async_event_source.hpp>
+#include <userver/logging/stacktrace_cache.hpp>
 #include <userver/os_signals/component.hpp>
 
 #include <userver/utils/fast_pimpl.hpp>
@@ -47,13 +49,18 @@ namespace components {
 /// ---- | ----------- | -------------
 /// file_path | path to the log file | -
 /// level | log verbosity | info
-/// format | log output format, either `tskv` or `ltsv` | tskv
+/// format | log output format, one of `tskv`, `ltsv`, `raw` or `binary` | tskv
 /// flush_level | messages of this and higher levels get flushed to the file immediately | warning
-/// message_queue_size | the size of internal message queue, must be a power of 2 | 65536
+/// message_queue_size | the max number of messages buffered by each of the producer shards, must be a power of 2 | 65536
 /// overflow_behavior | message handling policy while the queue is full: `discard` drops messages, `block` waits until message gets into the queue | discard
 /// testsuite-capture | if exists, setups additional TCP log sink for testing purposes | {}
 /// fs-task-processor | task processor for disk I/O operations for this logger | fs-task-processor of the loggers component
 ///
+/// The component itself also accepts:
+/// Name | Description | Default value
+/// ---- | ----------- | -------------
+/// async-stacktrace-symbolization | log raw addresses of the not yet cached stacktrace frames and symbolize them in a background thread, see logging::stacktrace_cache::AsyncSymbolizationGuard | false
+///
 /// ### Logs output
 /// You can specify logger output, in `file_path` option:
 /// - Use `@stdout` to write your logs to standard output stream;
@@ -62,6 +69,13 @@ namespace components {
 /// - Use `%file_name%` to write your logs in file. Use USR1 signal or `OnLogRotate` handler to reopen files after log rotation;
 /// - Use `unix:%socket_name%` to write your logs to unix socket. Socket must be created before the service starts and closed by listener after service is shut down.
 ///
+/// ### Binary format
+/// The `binary` format writes length-prefixed records with interned keys and
+/// compresses them with zstd in the logger task, which makes the logs several
+/// times smaller and cheaper to write. The resulting files are zstd streams,
+/// use the `log_decoder` tool to convert them back to tskv. It is not
+/// supported by the testsuite-capture sink.
+///
 /// ### testsuite-capture options:
 /// Name | Description | Default value
 /// ---- | ----------- | -------------
@@ -117,6 +131,9 @@ class Logging final : public RawComponentBase {
   engine::TaskProcessor* fs_task_processor_{nullptr};
   std::unordered_map<std::string, std::shared_ptr<logging::impl::TpLogger>>
       loggers_;
+  // Logs from a background thread, must be stopped before the loggers
+  std::optional<logging::stacktrace_cache::AsyncSymbolizationGuard>
+      async_symbolization_;
   utils::PeriodicTask flush_task_;
   logging::impl::TcpSocketSink* socket_sink_{nullptr};
   alerts::Storage& alert_storage_;
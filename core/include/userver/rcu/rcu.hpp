@@ -3,9 +3,12 @@
 /// @file userver/rcu/rcu.hpp
 /// @brief @copybrief rcu::Variable
 
+#include <algorithm>
 #include <atomic>
+#include <cstddef>
 #include <cstdlib>
 #include <optional>
+#include <type_traits>
 #include <utility>
 
 #include <userver/concurrent/impl/asymmetric_fence.hpp>
@@ -57,9 +60,12 @@ class SnapshotRecordRetiredList final {
 
   bool IsEmpty() const noexcept { return head_ == nullptr; }
 
+  std::size_t GetSize() const noexcept { return size_; }
+
   void Push(SnapshotRecord<T>& record) noexcept {
     record.next_retired = head_;
     head_ = &record;
+    ++size_;
   }
 
   template <typename Predicate, typename Disposer>
@@ -71,6 +77,7 @@ class SnapshotRecordRetiredList final {
 
       if (predicate(*current)) {
         *ptr_to_current = std::exchange(current->next_retired, nullptr);
+        --size_;
         disposer(*current);
       } else {
         ptr_to_current = &current->next_retired;
@@ -80,6 +87,49 @@ class SnapshotRecordRetiredList final {
 
  private:
   SnapshotRecord<T>* head_{nullptr};
+  std::size_t size_{0};
+};
+
+}  // namespace impl
+
+/// @brief Reclamation policy of rcu::Variable that scans the old values on
+/// every assignment and frees the ones that are not read anymore.
+///
+/// Keeps the least memory, but the work per assignment grows with the number
+/// of old values that are still being read.
+struct EagerReclamation final {
+  static constexpr std::size_t GetScanThreshold(std::size_t) noexcept {
+    return 0;
+  }
+};
+
+/// @brief Reclamation policy of rcu::Variable that scans the old values only
+/// once their count has doubled since the previous scan.
+///
+/// The amortized work per assignment is bounded by a constant, at the cost of
+/// keeping up to `2 * still_read + kMinRetired` old values alive. Suitable for
+/// variables with a high rate of assignments.
+struct AmortizedReclamation final {
+  static constexpr std::size_t kMinRetired = 16;
+
+  static constexpr std::size_t GetScanThreshold(
+      std::size_t retired_after_scan) noexcept {
+    return std::max(kMinRetired, 2 * retired_after_scan);
+  }
+};
+
+namespace impl {
+
+template <typename RcuTraits, typename = void>
+struct ReclamationPolicyOf final {
+  using Type = EagerReclamation;
+};
+
+template <typename RcuTraits>
+struct ReclamationPolicyOf<
+    RcuTraits, std::void_t<typename RcuTraits::ReclamationPolicy>>
+    final {
+  using Type = typename RcuTraits::ReclamationPolicy;
 };
 
 }  // namespace impl
@@ -87,6 +137,8 @@ class SnapshotRecordRetiredList final {
 /// Default Rcu traits.
 /// - `MutexType` is a writer's mutex type that has to be used to protect
 /// structure on update
+/// - `ReclamationPolicy` (optional) is rcu::EagerReclamation or
+/// rcu::AmortizedReclamation, defaults to rcu::EagerReclamation
 template <typename T>
 struct DefaultRcuTraits {
   using MutexType = engine::Mutex;
@@ -280,6 +332,8 @@ template <typename T, typename RcuTraits>
 class Variable final {
  public:
   using MutexType = typename RcuTraits::MutexType;
+  using ReclamationPolicy =
+      typename impl::ReclamationPolicyOf<RcuTraits>::Type;
 
   /// Create a new `Variable` with an in-place constructed initial value.
   /// Asynchronous destruction is enabled by default.
@@ -398,7 +452,7 @@ class Variable final {
 
     UASSERT(old_snapshot);
     retired_list_.Push(*old_snapshot);
-    ScanRetiredList(lock);
+    if (retired_list_.GetSize() > scan_threshold_) ScanRetiredList(lock);
   }
 
   template <typename... Args>
@@ -435,6 +489,8 @@ class Variable final {
           return record.indicator.IsFree();
         },
         [&](impl::SnapshotRecord<T>& record) { DeleteSnapshot(record); });
+    scan_threshold_ =
+        ReclamationPolicy::GetScanThreshold(retired_list_.GetSize());
   }
 
   void DeleteSnapshot(impl::SnapshotRecord<T>& record) {
@@ -461,6 +517,8 @@ class Variable final {
   MutexType mutex_;
   impl::SnapshotRecordFreeList<T> free_list_;
   impl::SnapshotRecordRetiredList<T> retired_list_;
+  // The retired list is scanned once it grows over the threshold
+  std::size_t scan_threshold_{ReclamationPolicy::GetScanThreshold(0)};
   std::atomic<impl::SnapshotRecord<T>*> current_;
   utils::impl::WaitTokenStorage wait_token_storage_;
 };
@@ -21,6 +21,8 @@ namespace impl {
 template <typename RcuMapTraits>
 struct RcuTraitsFromRcuMapTraits {
   using MutexType = typename RcuMapTraits::MutexType;
+  using ReclamationPolicy =
+      typename ReclamationPolicyOf<RcuMapTraits>::Type;
 };
 }  // namespace impl
 
@@ -37,6 +39,8 @@ class MissingKeyException : public utils::TracefulException {
 /// type `Key`
 /// - `MutexType` is a writer's mutex type that has to be used to protect
 /// structure on update
+/// - `ReclamationPolicy` (optional) is rcu::EagerReclamation or
+/// rcu::AmortizedReclamation, defaults to rcu::EagerReclamation
 template <typename Key, typename Value>
 struct DefaultRcuMapTraits {
   using Hash = std::hash<Key>;
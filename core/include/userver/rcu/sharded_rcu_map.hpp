@@ -0,0 +1,245 @@
+#pragma once
+
+/// @file userver/rcu/sharded_rcu_map.hpp
+/// @brief @copybrief rcu::ShardedRcuMap
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <utility>
+
+#include <userver/rcu/rcu_map.hpp>
+#include <userver/utils/assert.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace rcu {
+
+/// @ingroup userver_concurrency userver_containers
+///
+/// @brief Map-like structure allowing RCU keyset updates, split into
+/// independent shards.
+///
+/// Every shard is an rcu::RcuMap with its own writer's mutex, so a keyset
+/// change copies only the shard of the key and writers of different shards
+/// do not wait for each other. Reads are as cheap as for rcu::RcuMap.
+/// Prefer it to rcu::RcuMap for large maps with frequent keyset changes.
+///
+/// Only the changes within a shard are atomic, a snapshot of the whole map
+/// may combine the states of the shards taken at different moments.
+/// @note No synchronization is provided for value access, it must be
+/// implemented by Value when necessary.
+///
+/// ## Example usage:
+///
+/// @snippet rcu/sharded_rcu_map_test.cpp  Sample rcu::ShardedRcuMap usage
+///
+/// @see @ref scripts/docs/en/userver/synchronization.md
+template <typename Key, typename Value, typename RcuMapTraits>
+class ShardedRcuMap final {
+ public:
+  using Shard = RcuMap<Key, Value, RcuMapTraits>;
+  using Hash = typename Shard::Hash;
+  using ValuePtr = typename Shard::ValuePtr;
+  using ConstValuePtr = typename Shard::ConstValuePtr;
+  using InsertReturnType = typename Shard::InsertReturnType;
+  using Snapshot = typename Shard::Snapshot;
+
+  static constexpr std::size_t kDefaultShardCount = 16;
+
+  explicit ShardedRcuMap(std::size_t shard_count = kDefaultShardCount);
+
+  ShardedRcuMap(const ShardedRcuMap&) = delete;
+  ShardedRcuMap(ShardedRcuMap&&) = delete;
+  ShardedRcuMap& operator=(const ShardedRcuMap&) = delete;
+  ShardedRcuMap& operator=(ShardedRcuMap&&) = delete;
+
+  /// Returns an estimated size of the map at some point in time
+  std::size_t SizeApprox() const;
+
+  /// @brief Returns a readonly value pointer by its key if exists
+  /// @throws MissingKeyException if the key is not present
+  const ConstValuePtr operator[](const Key& key) const;
+
+  /// @brief Returns a modifiable value pointer by key if exists or
+  /// default-creates one
+  /// @note Copies the shard if the key doesn't exist.
+  const ValuePtr operator[](const Key& key);
+
+  /// @see rcu::RcuMap::Insert
+  /// @note Copies the shard if the key doesn't exist.
+  InsertReturnType Insert(const Key& key, ValuePtr value);
+
+  /// @see rcu::RcuMap::Emplace
+  /// @note Copies the shard if the key doesn't exist.
+  template <typename... Args>
+  InsertReturnType Emplace(const Key& key, Args&&... args);
+
+  /// @see rcu::RcuMap::TryEmplace
+  /// @note Copies the shard if the key doesn't exist.
+  template <typename... Args>
+  InsertReturnType TryEmplace(const Key& key, Args&&... args);
+
+  /// @brief If a key equivalent to `key` already exists in the container,
+  /// replaces the associated value. Otherwise, inserts a new pair into the map.
+  /// @note Copies the shard.
+  template <typename RawKey>
+  void InsertOrAssign(RawKey&& key, ValuePtr value);
+
+  /// @brief Returns a readonly value pointer by its key or an empty pointer
+  const ConstValuePtr Get(const Key& key) const;
+
+  /// @brief Returns a modifiable value pointer by key or an empty pointer
+  const ValuePtr Get(const Key& key);
+
+  /// @brief Removes a key from the map
+  /// @returns whether the key was present
+  /// @note Copies the shard.
+  bool Erase(const Key& key);
+
+  /// @brief Removes a key from the map returning its value
+  /// @returns a value if the key was present, empty pointer otherwise
+  /// @note Copies the shard.
+  ValuePtr Pop(const Key& key);
+
+  /// Resets the map to an empty state, shard by shard
+  void Clear();
+
+  /// @brief Returns a readonly copy of the map
+  /// @note The shards are copied one by one, see the class description.
+  Snapshot GetSnapshot() const;
+
+  std::size_t GetShardCount() const noexcept { return shard_count_; }
+
+  /// @brief Returns the shard of the key, e.g. to start a transaction with
+  /// rcu::RcuMap::StartWrite
+  /// @warning Only the keys of this shard may be added to it
+  Shard& GetShard(const Key& key);
+
+ private:
+  std::size_t GetShardIndex(const Key& key) const;
+
+  const std::size_t shard_count_;
+  const std::unique_ptr<Shard[]> shards_;
+};
+
+template <typename K, typename V, typename RcuMapTraits>
+ShardedRcuMap<K, V, RcuMapTraits>::ShardedRcuMap(std::size_t shard_count)
+    : shard_count_(shard_count),
+      shards_(std::make_unique<Shard[]>(shard_count)) {
+  UINVARIANT(shard_count_ > 0, "ShardedRcuMap must have at least one shard");
+}
+
+template <typename K, typename V, typename RcuMapTraits>
+std::size_t ShardedRcuMap<K, V, RcuMapTraits>::SizeApprox() const {
+  std::size_t size = 0;
+  for (std::size_t i = 0; i < shard_count_; ++i) {
+    size += shards_[i].SizeApprox();
+  }
+  return size;
+}
+
+template <typename K, typename V, typename RcuMapTraits>
+// Protects from assignment to map[key]
+// NOLINTNEXTLINE(readability-const-return-type)
+const typename ShardedRcuMap<K, V, RcuMapTraits>::ConstValuePtr
+ShardedRcuMap<K, V, RcuMapTraits>::operator[](const K& key) const {
+  return std::as_const(shards_[GetShardIndex(key)])[key];
+}
+
+template <typename K, typename V, typename RcuMapTraits>
+// Protects from assignment to map[key]
+// NOLINTNEXTLINE(readability-const-return-type)
+const typename ShardedRcuMap<K, V, RcuMapTraits>::ValuePtr
+ShardedRcuMap<K, V, RcuMapTraits>::operator[](const K& key) {
+  return GetShard(key)[key];
+}
+
+template <typename K, typename V, typename RcuMapTraits>
+typename ShardedRcuMap<K, V, RcuMapTraits>::InsertReturnType
+ShardedRcuMap<K, V, RcuMapTraits>::Insert(const K& key, ValuePtr value) {
+  return GetShard(key).Insert(key, std::move(value));
+}
+
+template <typename K, typename V, typename RcuMapTraits>
+template <typename... Args>
+typename ShardedRcuMap<K, V, RcuMapTraits>::InsertReturnType
+ShardedRcuMap<K, V, RcuMapTraits>::Emplace(const K& key, Args&&... args) {
+  return GetShard(key).Emplace(key, std::forward<Args>(args)...);
+}
+
+template <typename K, typename V, typename RcuMapTraits>
+template <typename... Args>
+typename ShardedRcuMap<K, V, RcuMapTraits>::InsertReturnType
+ShardedRcuMap<K, V, RcuMapTraits>::TryEmplace(const K& key, Args&&... args) {
+  return GetShard(key).TryEmplace(key, std::forward<Args>(args)...);
+}
+
+template <typename K, typename V, typename RcuMapTraits>
+template <typename RawKey>
+void ShardedRcuMap<K, V, RcuMapTraits>::InsertOrAssign(RawKey&& key,
+                                                       ValuePtr value) {
+  auto& shard = GetShard(key);
+  shard.InsertOrAssign(std::forward<RawKey>(key), std::move(value));
+}
+
+template <typename K, typename V, typename RcuMapTraits>
+// Protects from assignment to map[key]
+// NOLINTNEXTLINE(readability-const-return-type)
+const typename ShardedRcuMap<K, V, RcuMapTraits>::ConstValuePtr
+ShardedRcuMap<K, V, RcuMapTraits>::Get(const K& key) const {
+  return std::as_const(shards_[GetShardIndex(key)]).Get(key);
+}
+
+template <typename K, typename V, typename RcuMapTraits>
+// Protects from assignment to map[key]
+// NOLINTNEXTLINE(readability-const-return-type)
+const typename ShardedRcuMap<K, V, RcuMapTraits>::ValuePtr
+ShardedRcuMap<K, V, RcuMapTraits>::Get(const K& key) {
+  return GetShard(key).Get(key);
+}
+
+template <typename K, typename V, typename RcuMapTraits>
+bool ShardedRcuMap<K, V, RcuMapTraits>::Erase(const K& key) {
+  return GetShard(key).Erase(key);
+}
+
+template <typename K, typename V, typename RcuMapTraits>
+typename ShardedRcuMap<K, V, RcuMapTraits>::ValuePtr
+ShardedRcuMap<K, V, RcuMapTraits>::Pop(const K& key) {
+  return GetShard(key).Pop(key);
+}
+
+template <typename K, typename V, typename RcuMapTraits>
+void ShardedRcuMap<K, V, RcuMapTraits>::Clear() {
+  for (std::size_t i = 0; i < shard_count_; ++i) shards_[i].Clear();
+}
+
+template <typename K, typename V, typename RcuMapTraits>
+typename ShardedRcuMap<K, V, RcuMapTraits>::Snapshot
+ShardedRcuMap<K, V, RcuMapTraits>::GetSnapshot() const {
+  Snapshot result;
+  for (std::size_t i = 0; i < shard_count_; ++i) {
+    const auto& shard = shards_[i];
+    result.insert(shard.begin(), shard.end());
+  }
+  return result;
+}
+
+template <typename K, typename V, typename RcuMapTraits>
+auto ShardedRcuMap<K, V, RcuMapTraits>::GetShard(const K& key) -> Shard& {
+  return shards_[GetShardIndex(key)];
+}
+
+template <typename K, typename V, typename RcuMapTraits>
+std::size_t ShardedRcuMap<K, V, RcuMapTraits>::GetShardIndex(
+    const K& key) const {
+  // The shard maps use the same hash, so its high bits are taken for the
+  // shard to keep the low bits, used for the buckets, well distributed
+  const std::uint64_t hash = Hash{}(key);
+  return ((hash * 0x9E3779B97F4A7C15ULL) >> 32) % shard_count_;
+}
+
+}  // namespace rcu
+
+USERVER_NAMESPACE_END
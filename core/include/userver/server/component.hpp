@@ -74,10 +74,14 @@ namespace components {
 /// handler-defaults.deadline_propagation_enabled | when `false`, disables HTTP handler deadline propagation | true
 /// handler-defaults.deadline_expired_status_code | the HTTP status code to return if the request deadline expires | 498
 /// connection.in_buffer_size | size of the buffer to preallocate for request receive: bigger values use more RAM and less CPU | 32 * 1024
-/// connection.requests_queue_size_threshold | drop requests from handlers that allow throttling if there's more pending requests than allowed by this value | 100
+/// connection.requests_queue_size_threshold | drop requests from handlers that allow throttling if there's more pending requests than allowed by this value; also the max number of pipelined HTTP/1.1 requests of a connection that are handled concurrently | 100
 /// connection.keepalive_timeout | timeout in seconds to drop connection if there's not data received from it | 600
 /// connection.stream_close_check_delay | delay in microseconds of the start of stream close check routine; do not set if not sure what it is doing | 20ms
-/// shards | how many concurrent tasks harvest data from a single socket; do not set if not sure what it is doing | -
+/// connection.zero_copy_send_threshold | responses of at least this size in bytes are sent with MSG_ZEROCOPY where supported (Linux, plain TCP without TLS), 0 to disable | 0
+/// connection.http2_enabled | accept HTTP/2 connections, negotiated via ALPN for TLS or with prior knowledge (h2c) otherwise | false
+/// connection.http2_max_concurrent_streams | max number of concurrent streams of an HTTP/2 connection | 100
+/// shards | how many concurrent tasks harvest data from a single socket; do not set if not sure what it is doing | event threads count of the task_processor
+/// shards_cpu_steering | on Linux distribute new TCP connections among the shards by the CPU that received them (CPU number modulo shards count) rather than by the kernel hash of the addresses | false
 /// middleware-pipeline-builder | name of a component to build a server-wide middleware pipeline | default-server-middleware-pipeline-builder
 ///
 /// @see @ref scripts/docs/en/userver/http_server.md
@@ -0,0 +1,82 @@
+#pragma once
+
+/// @file userver/server/handlers/cpu_profiler.hpp
+/// @brief @copybrief server::handlers::CpuProfiler
+
+#include <userver/server/handlers/http_handler_base.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace server::handlers {
+
+// clang-format off
+
+/// @ingroup userver_components userver_http_handlers
+///
+/// @brief Handler that collects a sampling CPU profile of the running service.
+///
+/// All the threads of the process are sampled with SIGPROF. Each sample is
+/// tagged with the task processor and the name of the current tracing::Span
+/// of the task that was running on the thread. The stacks of the coroutines
+/// are cut at the coroutine entry, so the samples of a task are not mixed with
+/// the engine internals.
+///
+/// The component has no service configuration except the
+/// @ref userver_http_handlers "common handler options". It is not a part of
+/// components::CommonServerComponentList and should be appended explicitly.
+///
+/// ## Static configuration example:
+///
+/// @code{.yaml}
+///     handler-cpu-profiler:
+///         path: /service/cpu-profiler
+///         method: GET
+///         task_processor: monitor-task-processor
+/// @endcode
+///
+/// ## Schema
+/// The request blocks for the profile duration and returns the stacks in the
+/// folded format of `flamegraph.pl`, with the task processor and the span name
+/// as the two outermost frames:
+/// @code
+/// $ curl 'localhost:1188/service/cpu-profiler?seconds=10' | flamegraph.pl > cpu.svg
+/// @endcode
+///
+/// URL arguments:
+/// * `seconds` - profile duration, 1 to 60, 5 by default
+/// * `frequency` - samples per second of CPU time per thread, 1 to 1000,
+///   99 by default
+///
+/// Only one profile may be collected at a time, a concurrent request gets
+/// `409 Conflict`. The samples above the internal limit are dropped, their
+/// count is reported in the `X-Dropped-Samples` header.
+///
+/// @note The span names are tracked only while a profile is being collected
+/// or when the per-span CPU accounting is enabled for the task processor. A
+/// task that was already running when the profile started is attributed to
+/// its next span only.
+
+// clang-format on
+
+class CpuProfiler final : public HttpHandlerBase {
+ public:
+  CpuProfiler(const components::ComponentConfig&,
+              const components::ComponentContext&);
+
+  /// @ingroup userver_component_names
+  /// @brief The default name of server::handlers::CpuProfiler
+  static constexpr std::string_view kName = "handler-cpu-profiler";
+
+  std::string HandleRequestThrow(const http::HttpRequest&,
+                                 request::RequestContext&) const override;
+
+  static yaml_config::Schema GetStaticConfigSchema();
+};
+
+}  // namespace server::handlers
+
+template <>
+inline constexpr bool components::kHasValidate<server::handlers::CpuProfiler> =
+    true;
+
+USERVER_NAMESPACE_END
@@ -36,7 +36,26 @@ namespace server::handlers {
 /// request_body_size_log_limit | trim request to this size before logging | 512
 /// response_data_size_log_limit | trim responses to this size before logging | 512
 /// max_requests_per_second | integer to limit RPS to this handler | <no limit>
+/// adaptive_concurrency_limit.enabled | reject the requests with 429 once the number of the concurrent requests to this handler reaches the limit that grows while the latency is stable and shrinks once the latency grows | false
+/// adaptive_concurrency_limit.initial_limit | the limit before any latency is measured | 20
+/// adaptive_concurrency_limit.min_limit | the limit never gets lower | 4
+/// adaptive_concurrency_limit.max_limit | the limit never gets higher | 1000
+/// adaptive_concurrency_limit.window_size | number of the finished requests the limit is recalculated after | 100
+/// adaptive_concurrency_limit.tolerance | how many times the recent latency may exceed the long-term one without decreasing the limit | 1.5
+/// adaptive_concurrency_limit.smoothing | weight of the new limit estimation in the limit | 0.2
 /// decompress_request | allow decompression of the requests | true
+/// response_compression.enabled | compress the responses with zstd or gzip if the request Accept-Encoding allows that; the streamed responses are compressed chunk by chunk | false
+/// response_compression.min_size | do not compress the non-streamed responses with a smaller body | 1024
+/// response_compression.gzip_level | gzip compression level | 6
+/// response_compression.zstd_level | zstd compression level | 3
+/// response_compression.content_types | media types of the responses to compress, 'type/*' matches all the subtypes | application/json, application/javascript, application/xml, image/svg+xml, text/*
+/// request_coalescing.enabled | execute the concurrent GET and HEAD requests with the same path, arguments and headers once and send the same response to all of them; the responses that are streamed or set cookies are not shared | false
+/// request_coalescing.args | names of the query arguments that are a part of the key | []
+/// request_coalescing.headers | names of the request headers that are a part of the key | []
+/// response_cache.enabled | serve the responses to GET and HEAD requests with the Cache-Control max-age or s-maxage from the cache until they expire, including the 304 responses to the conditional requests; the responses with cookies and to the requests with Authorization are not cached | false
+/// response_cache.ways | number of the independently locked LRU shards | 16
+/// response_cache.way_size | max number of the responses in a shard | 64
+/// response_cache.max_entry_size | do not cache the responses with a larger body | 65536
 /// throttling_enabled | allow throttling of the requests by components::Server , for more info see its `max_response_size_in_flight` and `requests_queue_size_threshold` options | true
 /// set-response-server-hostname | set to true to add the `X-YaTaxi-Server-Hostname` header with instance name, set to false to not add the header | <takes the value from components::Server config>
 /// monitor-handler | Overrides the in-code `is_monitor` flag that makes the handler run either on `server.listener` or on `server.listener-monitor` | --
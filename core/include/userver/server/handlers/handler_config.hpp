@@ -26,6 +26,54 @@ enum class UrlTrailingSlashOption {
   kDefault = kBoth,
 };
 
+/// Settings of the response compression, see
+/// server::handlers::HandlerBase for the static config options.
+struct ResponseCompressionConfig {
+  bool enabled{false};
+  size_t min_size{1024};
+  int gzip_level{6};
+  int zstd_level{3};
+  // Media types, 'type/*' matches all the subtypes
+  std::vector<std::string> content_types{
+      "application/json", "application/javascript", "application/xml",
+      "image/svg+xml",    "text/*",
+  };
+};
+
+/// Settings of the request coalescing, see
+/// server::handlers::HandlerBase for the static config options.
+struct RequestCoalescingConfig {
+  bool enabled{false};
+  // Names of the query arguments and of the headers that the response
+  // depends on in addition to the path
+  std::vector<std::string> args;
+  std::vector<std::string> headers;
+};
+
+/// Settings of the response cache, see
+/// server::handlers::HandlerBase for the static config options.
+struct ResponseCacheConfig {
+  bool enabled{false};
+  size_t ways{16};
+  size_t way_size{64};
+  size_t max_entry_size{64 * 1024};
+};
+
+/// Settings of the adaptive concurrency limit, see
+/// server::handlers::HandlerBase for the static config options.
+struct AdaptiveConcurrencyLimitConfig {
+  bool enabled{false};
+  size_t initial_limit{20};
+  size_t min_limit{4};
+  size_t max_limit{1000};
+  // Number of the finished requests the limit is recalculated after
+  size_t window_size{100};
+  // The ratio of the recent and long-term latencies that is not a slowdown
+  double tolerance{1.5};
+  // Weight of the new limit estimation
+  double smoothing{0.2};
+};
+
 struct HandlerConfig {
   std::variant<std::string, FallbackHandler> path;
   std::string task_processor;
@@ -37,12 +85,18 @@ struct HandlerConfig {
   UrlTrailingSlashOption url_trailing_slash{UrlTrailingSlashOption::kDefault};
   std::optional<size_t> max_requests_in_flight;
   std::optional<size_t> max_requests_per_second;
+  AdaptiveConcurrencyLimitConfig adaptive_concurrency_limit{};
   bool decompress_request{true};
+  ResponseCompressionConfig response_compression{};
+  RequestCoalescingConfig request_coalescing{};
+  ResponseCacheConfig response_cache{};
   bool throttling_enabled{true};
   bool response_body_stream{false};
+  bool request_body_stream{false};
   std::optional<bool> set_response_server_hostname;
   bool set_tracing_headers{true};
   bool deadline_propagation_enabled{true};
+  bool deadline_early_rejection_enabled{false};
   http::HttpStatus deadline_expired_status_code{498};
 };
 
@@ -0,0 +1,215 @@
+#pragma once
+
+/// @file userver/server/handlers/http_handler_flatbuf_view_base.hpp
+/// @brief @copybrief server::handlers::HttpHandlerFlatbufViewBase
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <type_traits>
+
+#include <flatbuffers/flatbuffers.h>
+
+#include <userver/server/handlers/http_handler_base.hpp>
+#include <userver/server/http/http_error.hpp>
+#include <userver/utils/assert.hpp>
+#include <userver/utils/log.hpp>
+#include <userver/yaml_config/schema.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace server::handlers {
+
+namespace impl {
+
+/// flatbuffers::Allocator that keeps the single buffer of a
+/// flatbuffers::FlatBufferBuilder in a std::string, so that the finished
+/// buffer can be taken as a response body without allocating a new one.
+class FlatbufStringAllocator final : public flatbuffers::Allocator {
+ public:
+  uint8_t* allocate(size_t size) override {
+    UASSERT_MSG(buffer_.empty(), "Only one buffer may be allocated at a time");
+    buffer_.resize(size);
+    return Data();
+  }
+
+  void deallocate(uint8_t* p, size_t /*size*/) override {
+    // The buffer could have been taken by TakeFinished
+    if (p == Data()) buffer_.clear();
+  }
+
+  uint8_t* reallocate_downward(uint8_t* old_p, size_t old_size,
+                               size_t new_size, size_t in_use_back,
+                               size_t in_use_front) override {
+    UASSERT(old_p == Data());
+    UASSERT(new_size > old_size);
+    std::string new_buffer(new_size, '\0');
+    auto* const new_p = reinterpret_cast<uint8_t*>(new_buffer.data());
+    std::memcpy(new_p + new_size - in_use_back, old_p + old_size - in_use_back,
+                in_use_back);
+    std::memcpy(new_p, old_p, in_use_front);
+    buffer_ = std::move(new_buffer);
+    return Data();
+  }
+
+  /// Moves the finished buffer of `builder` out. The builder must be destroyed
+  /// or reset afterwards.
+  std::string TakeFinished(const flatbuffers::FlatBufferBuilder& builder) {
+    const auto* const data = builder.GetBufferPointer();
+    UASSERT(data >= Data() && data + builder.GetSize() == Data() + GetSize());
+    const auto offset = static_cast<std::size_t>(data - Data());
+    std::string result = std::move(buffer_);
+    buffer_.clear();
+    // The builder fills the buffer from the back, the unused front part is
+    // dropped in place
+    result.erase(0, offset);
+    return result;
+  }
+
+ private:
+  uint8_t* Data() noexcept { return reinterpret_cast<uint8_t*>(buffer_.data()); }
+  std::size_t GetSize() const noexcept { return buffer_.size(); }
+
+  std::string buffer_;
+};
+
+}  // namespace impl
+
+// clang-format off
+
+/// @ingroup userver_components userver_http_handlers userver_base_classes
+///
+/// @brief Base for handlers that work with the Flatbuffer request and
+/// response bodies directly, without the object API.
+///
+/// Unlike server::handlers::HttpHandlerFlatbufBase, the request body is only
+/// verified, and the handler gets a `const InputType&` view right over it
+/// instead of an unpacked `InputType::NativeTableType`. The response is built
+/// by the handler into the provided flatbuffers::FlatBufferBuilder, whose
+/// buffer then becomes the response body without copying into a new string.
+/// The initial size of the builder follows the largest response so far (up to
+/// 256KiB), so that the buffer is rarely grown.
+///
+/// ## Example usage:
+///
+/// @snippet samples/flatbuf_service/flatbuf_service.cpp Flatbuf service sample - view component
+
+// clang-format on
+
+template <typename InputType, typename ReturnType>
+class HttpHandlerFlatbufViewBase : public HttpHandlerBase {
+  static_assert(std::is_base_of<flatbuffers::Table, InputType>::value,
+                "Input type should be auto-generated FlatBuffers table type");
+  static_assert(std::is_base_of<flatbuffers::Table, ReturnType>::value,
+                "Return type should be auto-generated FlatBuffers table type");
+
+ public:
+  HttpHandlerFlatbufViewBase(
+      const components::ComponentConfig& config,
+      const components::ComponentContext& component_context);
+
+  std::string HandleRequestThrow(const http::HttpRequest& request,
+                                 request::RequestContext& context) const final;
+
+  /// @brief Builds the response into `builder`.
+  /// @param input view over the verified request body, valid for the duration
+  /// of the request
+  /// @returns the root table of the response, `builder` is finished with it
+  virtual flatbuffers::Offset<ReturnType> HandleRequestFlatbufThrow(
+      const http::HttpRequest& request, const InputType& input,
+      flatbuffers::FlatBufferBuilder& builder,
+      request::RequestContext& context) const = 0;
+
+  static yaml_config::Schema GetStaticConfigSchema();
+
+ protected:
+  /// Override it if you need a custom request body logging.
+  std::string GetRequestBodyForLogging(
+      const http::HttpRequest& request, request::RequestContext& context,
+      const std::string& request_body) const override;
+
+  /// Override it if you need a custom response data logging.
+  std::string GetResponseDataForLogging(
+      const http::HttpRequest& request, request::RequestContext& context,
+      const std::string& response_data) const override;
+
+  void ParseRequestData(const http::HttpRequest& request,
+                        request::RequestContext& context) const final;
+
+ private:
+  static constexpr std::size_t kMinBuilderSize = 1024;
+  static constexpr std::size_t kMaxBuilderSize = 256 * 1024;
+
+  mutable std::atomic<std::size_t> builder_initial_size_{kMinBuilderSize};
+};
+
+template <typename InputType, typename ReturnType>
+HttpHandlerFlatbufViewBase<InputType, ReturnType>::HttpHandlerFlatbufViewBase(
+    const components::ComponentConfig& config,
+    const components::ComponentContext& component_context)
+    : HttpHandlerBase(config, component_context) {}
+
+template <typename InputType, typename ReturnType>
+std::string
+HttpHandlerFlatbufViewBase<InputType, ReturnType>::HandleRequestThrow(
+    const http::HttpRequest& request, request::RequestContext& context) const {
+  const auto& input =
+      *flatbuffers::GetRoot<InputType>(request.RequestBody().data());
+
+  impl::FlatbufStringAllocator allocator;
+  flatbuffers::FlatBufferBuilder builder(
+      builder_initial_size_.load(std::memory_order_relaxed), &allocator);
+  builder.Finish(HandleRequestFlatbufThrow(request, input, builder, context));
+
+  const std::size_t used_size = builder.GetSize();
+  if (used_size > builder_initial_size_.load(std::memory_order_relaxed)) {
+    builder_initial_size_.store(std::min(used_size, kMaxBuilderSize),
+                                std::memory_order_relaxed);
+  }
+
+  return allocator.TakeFinished(builder);
+}
+
+template <typename InputType, typename ReturnType>
+std::string
+HttpHandlerFlatbufViewBase<InputType, ReturnType>::GetRequestBodyForLogging(
+    const http::HttpRequest&, request::RequestContext&,
+    const std::string& request_body) const {
+  size_t limit = GetConfig().request_body_size_log_limit;
+  return utils::log::ToLimitedHex(request_body, limit);
+}
+
+template <typename InputType, typename ReturnType>
+std::string
+HttpHandlerFlatbufViewBase<InputType, ReturnType>::GetResponseDataForLogging(
+    const http::HttpRequest&, request::RequestContext&,
+    const std::string& response_data) const {
+  size_t limit = GetConfig().response_data_size_log_limit;
+  return utils::log::ToLimitedHex(response_data, limit);
+}
+
+template <typename InputType, typename ReturnType>
+void HttpHandlerFlatbufViewBase<InputType, ReturnType>::ParseRequestData(
+    const http::HttpRequest& request, request::RequestContext&) const {
+  const auto& body = request.RequestBody();
+  flatbuffers::Verifier verifier(reinterpret_cast<const uint8_t*>(body.data()),
+                                 body.size());
+  if (!verifier.VerifyBuffer<InputType>(nullptr)) {
+    throw ClientError(
+        InternalMessage{"Invalid FlatBuffers format in request body"});
+  }
+}
+
+template <typename InputType, typename ReturnType>
+yaml_config::Schema
+HttpHandlerFlatbufViewBase<InputType, ReturnType>::GetStaticConfigSchema() {
+  auto schema = HttpHandlerBase::GetStaticConfigSchema();
+  schema.UpdateDescription("HTTP handler flatbuf view base config");
+  return schema;
+}
+
+}  // namespace server::handlers
+
+USERVER_NAMESPACE_END
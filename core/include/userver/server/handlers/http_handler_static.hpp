@@ -19,6 +19,12 @@ namespace server::handlers {
 /// @brief Handler that returns HTTP 200 if file exist
 /// and returns file data with mapped content/type
 ///
+/// The file data is shared with the response without copying. The handler
+/// sets the ETag header and answers If-None-Match with HTTP 304, serves
+/// single byte ranges with HTTP 206 and, if components::FsCache has the
+/// `precompress` option enabled, sends the gzip or zstd compressed variant of
+/// the file according to the Accept-Encoding request header.
+///
 /// ## Dynamic config
 /// * @ref USERVER_FILES_CONTENT_TYPE_MAP
 ///
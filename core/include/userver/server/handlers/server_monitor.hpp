@@ -3,6 +3,8 @@
 /// @file userver/server/handlers/server_monitor.hpp
 /// @brief @copybrief server::handlers::ServerMonitor
 
+#include <memory>
+
 #include <userver/server/handlers/http_handler_base.hpp>
 #include <userver/utils/statistics/fwd.hpp>
 
@@ -43,6 +45,11 @@ enum class StatsFormat;
 ///   be a JSON dictionary in the form '{"label1":"value1", "label2":"value2"}'.
 /// * path - return metrics on for the following path
 /// * prefix - return metrics whose path starts from the specified prefix.
+///
+/// The rendered names and labels of the metrics are reused between the
+/// "prometheus" and "prometheus-untyped" scrapes. Enable the
+/// `response_compression` handler option to gzip or zstd the response for
+/// the scrapers that accept it.
 
 // clang-format on
 class ServerMonitor final : public HttpHandlerBase {
@@ -50,6 +57,8 @@ class ServerMonitor final : public HttpHandlerBase {
   ServerMonitor(const components::ComponentConfig& config,
                 const components::ComponentContext& component_context);
 
+  ~ServerMonitor() override;
+
   /// @ingroup userver_component_names
   /// @brief The default name of server::handlers::ServerMonitor
   static constexpr std::string_view kName = "handler-server-monitor";
@@ -69,6 +78,10 @@ class ServerMonitor final : public HttpHandlerBase {
   using CommonLabels = std::unordered_map<std::string, std::string>;
   const CommonLabels common_labels_;
   const std::optional<impl::StatsFormat> default_format_;
+
+  // Rendered metric names and labels reused by the Prometheus scrapes
+  struct PrometheusCache;
+  const std::unique_ptr<PrometheusCache> prometheus_cache_;
 };
 
 }  // namespace server::handlers
@@ -5,6 +5,7 @@
 
 #include <chrono>
 #include <functional>
+#include <memory_resource>
 #include <string>
 #include <unordered_map>
 #include <vector>
@@ -32,6 +33,7 @@ class HttpHandlerBase;
 namespace server::http {
 
 class HttpRequestImpl;
+class RequestBodyStream;
 
 /// @brief HTTP Request data
 class HttpRequest final {
@@ -203,8 +205,14 @@ class HttpRequest final {
   CookiesMapKeys GetCookieNames() const;
 
   /// @return HTTP body.
+  /// @note Empty for handlers with `request-body-stream: true`, read
+  /// GetBodyStream() instead.
   const std::string& RequestBody() const;
 
+  /// @return Stream to read the HTTP body while it is being received, see
+  /// server::http::RequestBodyStream.
+  RequestBodyStream& GetBodyStream() const;
+
   /// @return HTTP headers.
   const HeadersMap& RequestHeaders() const;
 
@@ -226,6 +234,15 @@ class HttpRequest final {
   /// @return true if the body of the request was compressed
   bool IsBodyCompressed() const;
 
+  /// @brief Returns a monotonic memory resource for the temporaries of the
+  /// handler, e.g. `std::pmr::string` or `std::pmr::vector`.
+  ///
+  /// The memory is released all at once when the request is destroyed, the
+  /// first kilobyte reuses the memory of the previous requests of the
+  /// connection. The resource is not thread-safe and must not be used by
+  /// several tasks concurrently.
+  std::pmr::memory_resource& GetMemoryResource() const;
+
   /// @cond
   void SetUpgradeWebsocket(
       std::function<void(std::unique_ptr<engine::io::RwBase>&&,
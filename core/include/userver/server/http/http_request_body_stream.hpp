@@ -0,0 +1,74 @@
+#pragma once
+
+/// @file userver/server/http/http_request_body_stream.hpp
+/// @brief @copybrief server::http::RequestBodyStream
+
+#include <memory>
+#include <stdexcept>
+#include <string>
+
+#include <userver/engine/deadline.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace server::http {
+
+class HttpRequestImpl;
+class HttpRequestConstructor;
+
+namespace impl {
+class RequestBodyStreamState;
+}  // namespace impl
+
+/// @brief Thrown by RequestBodyStream if the body can not be received
+/// completely: the connection was closed, the body is malformed or exceeds
+/// the `max_request_size` limit, or the deadline has passed.
+class RequestBodyStreamError : public std::runtime_error {
+ public:
+  using std::runtime_error::runtime_error;
+};
+
+/// @brief Body of the HTTP request that is read while it is being received.
+///
+/// For handlers with `request-body-stream: true` in the static config the
+/// handler is started right after the request headers are received, and the
+/// body chunks are passed to the stream as the connection reads them. At most
+/// 256KiB of the body are buffered: the connection stops reading from the
+/// socket until the handler takes the chunks. server::http::HttpRequest's
+/// RequestBody() is empty for such requests.
+///
+/// For other requests (and for HTTP/2) the stream yields the already received
+/// body as a single chunk.
+///
+/// Not thread-safe, should be read by a single task.
+class RequestBodyStream final {
+ public:
+  RequestBodyStream(RequestBodyStream&&) noexcept;
+  RequestBodyStream& operator=(RequestBodyStream&&) noexcept;
+  ~RequestBodyStream();
+
+  /// @brief Waits for the next part of the body and moves it into `chunk`
+  /// @returns `false` if the whole body was already read
+  /// @throws RequestBodyStreamError if the body could not be received
+  /// @throws engine::WaitInterruptedException on task cancellation
+  bool ReadChunk(std::string& chunk, engine::Deadline deadline = {});
+
+  /// @brief Waits for the rest of the body
+  /// @throws RequestBodyStreamError if the body could not be received
+  /// @throws engine::WaitInterruptedException on task cancellation
+  std::string ReadAll(engine::Deadline deadline = {});
+
+ private:
+  friend class HttpRequestImpl;
+  friend class HttpRequestConstructor;
+class HttpRequestConstructor;
+
+  explicit RequestBodyStream(
+      std::shared_ptr<impl::RequestBodyStreamState> state);
+
+  std::shared_ptr<impl::RequestBodyStreamState> state_;
+};
+
+}  // namespace server::http
+
+USERVER_NAMESPACE_END
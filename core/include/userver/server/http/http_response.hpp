@@ -142,6 +142,9 @@ class HttpResponse final : public request::ResponseBase {
   Queue::Producer GetBodyProducer();
 
  private:
+  // Serializes the response into HTTP/2 frames
+  friend class Http2Session;
+
   // Returns total size of the response
   std::size_t SetBodyStreamed(
       engine::io::RwBase& socket,
@@ -13,6 +13,8 @@ class HttpHandlerBase;
 
 namespace server::http {
 
+class ResponseCompressor;
+
 class ResponseBodyStream final {
  public:
   ResponseBodyStream(ResponseBodyStream&&) = default;
@@ -38,7 +40,13 @@ class ResponseBodyStream final {
       server::http::HttpResponse::Queue::Producer&& queue_producer,
       server::http::HttpResponse& http_response);
 
+  void SetCompressor(ResponseCompressor* compressor);
+
+  // Pushes the tail of the compressed body, if any
+  void FinishBody(engine::Deadline deadline);
+
   bool headers_ended_{false};
+  ResponseCompressor* compressor_{nullptr};
   HttpResponse::Queue::Producer queue_producer_;
   server::http::HttpResponse& http_response_;
 };
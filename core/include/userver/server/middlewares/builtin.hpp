@@ -24,8 +24,14 @@ inline constexpr std::string_view kBaggage = "userver-baggage-middleware";
 inline constexpr std::string_view kAuth = "userver-auth-middleware";
 inline constexpr std::string_view kDecompression =
     "userver-decompression-middleware";
+inline constexpr std::string_view kCompression =
+    "userver-compression-middleware";
+inline constexpr std::string_view kResponseCache =
+    "userver-response-cache-middleware";
 inline constexpr std::string_view kExceptionsHandling =
     "userver-exceptions-handling-middleware";
+inline constexpr std::string_view kRequestCoalescing =
+    "userver-request-coalescing-middleware";
 
 }  // namespace server::middlewares::builtin
 
@@ -0,0 +1,86 @@
+#pragma once
+
+/// @file userver/server/websocket/broadcast_group.hpp
+/// @brief @copybrief websocket::BroadcastGroup
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <unordered_map>
+
+#include <userver/concurrent/background_task_storage.hpp>
+#include <userver/concurrent/queue.hpp>
+#include <userver/engine/mutex.hpp>
+#include <userver/server/websocket/server.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace server::websocket {
+
+/// @brief Group of websocket connections that receive the same messages.
+///
+/// A message is encoded into frames once and the shared frames are queued to
+/// every member. Each member is sent its queue by a separate task, so a slow
+/// member does not delay the others. A member whose queue overflows is evicted
+/// from the group and stops receiving the broadcasts.
+///
+/// Thread safe.
+class BroadcastGroup final {
+ public:
+  struct Options final {
+    /// Max messages waiting to be sent to a member before it is evicted
+    std::size_t max_queued_messages{1024};
+    /// Max output fragment size, 0 - do not fragment
+    unsigned fragment_size{65536};
+  };
+
+  /// Member sender tasks are started in the current task processor
+  BroadcastGroup();
+  explicit BroadcastGroup(Options options);
+
+  BroadcastGroup(const BroadcastGroup&) = delete;
+  BroadcastGroup& operator=(const BroadcastGroup&) = delete;
+
+  /// Stops sending, the messages that are still queued are dropped
+  ~BroadcastGroup();
+
+  /// Adds a connection to the group, does nothing if it is already there
+  void Add(std::shared_ptr<WebSocketConnection> connection);
+
+  /// @brief Removes a connection from the group
+  /// @note The messages that were already queued are still sent.
+  void Remove(const WebSocketConnection& connection);
+
+  /// @brief Queues the message to every member of the group
+  /// @returns the number of members the message was queued to
+  std::size_t Broadcast(const Message& message);
+
+  /// @overload
+  std::size_t Broadcast(const PreparedMessage& message);
+
+  /// Current number of members
+  std::size_t GetSize() const;
+
+  /// Total number of members that were evicted due to a queue overflow
+  std::size_t GetEvictedCount() const noexcept;
+
+ private:
+  using Queue = concurrent::SpscQueue<PreparedMessage>;
+
+  struct Member final {
+    std::shared_ptr<WebSocketConnection> connection;
+    Queue::Producer producer;
+  };
+
+  const Options options_;
+  mutable engine::Mutex mutex_;
+  std::unordered_map<const WebSocketConnection*, Member> members_;
+  std::atomic<std::size_t> evicted_count_{0};
+
+  // tasks_ must be the last field for lifetime reasons
+  concurrent::BackgroundTaskStorage tasks_;
+};
+
+}  // namespace server::websocket
+
+USERVER_NAMESPACE_END
@@ -45,6 +45,29 @@ struct Message {
 
 class WebSocketConnectionImpl;
 
+/// @brief Message that is encoded into websocket frames in advance.
+///
+/// Copies share the encoded frames, so the same message may be sent to many
+/// connections without encoding it for each of them.
+class PreparedMessage final {
+ public:
+  /// Empty message, sending it does nothing
+  PreparedMessage() = default;
+
+  /// @param fragment_size max output fragment size, 0 - do not fragment
+  explicit PreparedMessage(const Message& message,
+                           unsigned fragment_size = 65536);
+
+  /// Size of the message payload, without the frame headers
+  std::size_t GetPayloadSize() const noexcept { return payload_size_; }
+
+ private:
+  friend class WebSocketConnectionImpl;
+
+  std::shared_ptr<const std::string> frames_;
+  std::size_t payload_size_{0};
+};
+
 struct Config final {
   unsigned max_remote_payload = 65536;
   unsigned fragment_size = 65536;  // 0 - do not fragment
@@ -91,6 +114,20 @@ class WebSocketConnection {
   virtual void Send(const Message& message) = 0;
   virtual void SendText(std::string_view message) = 0;
 
+  /// @brief Send several messages to websocket at once.
+  ///
+  /// The frames of all the messages are written to the socket with as few
+  /// writes as possible, which is much cheaper than a Send() per message.
+  /// @param messages messages to send, in order
+  /// @throws engine::io::IoException in case of socket errors
+  /// @note Same thread-safety guarantees as for Send().
+  virtual void SendMany(utils::span<const Message> messages) = 0;
+
+  /// @brief Send a message that was encoded in advance.
+  /// @throws engine::io::IoException in case of socket errors
+  /// @note Same thread-safety guarantees as for Send().
+  virtual void SendPrepared(const PreparedMessage& message) = 0;
+
   template <typename ContiguousContainer>
   void SendBinary(const ContiguousContainer& message) {
     static_assert(sizeof(typename ContiguousContainer::value_type) == 1,
@@ -5,6 +5,8 @@
 
 #include <userver/components/component_fwd.hpp>
 #include <userver/components/raw_component_base.hpp>
+#include <userver/tracing/tracer_fwd.hpp>
+#include <userver/utils/periodic_task.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
@@ -19,13 +21,21 @@ namespace components {
 /// Finds the components::Logging component and requests an optional
 /// "opentracing" logger to use for Opentracing.
 ///
+/// The 'batched' tracer buffers the Opentracing records of the finished
+/// spans and writes them to the logger every `export-period` from a
+/// background task, instead of writing them on span destruction.
+///
 /// The component must be configured in service config.
 ///
 /// ## Static options:
 /// Name | Description | Default value
 /// ---- | ----------- | -------------
 /// service-name | name of the service to write in traces | ''
-/// tracer | type of the tracer to trace, currently supported only 'native' | 'native'
+/// tracer | type of the tracer to trace, 'native' or 'batched' | 'native'
+/// export-period | how often the 'batched' tracer writes out the buffered spans | 100ms
+/// sampling-ratio | ratio of the traces to log, see tracing::MakeRatioSampler | 1.0
+/// tail-sampling-latency-threshold | if set, the traces dropped by sampling are kept if the root span takes longer or has an error, see tracing::TailSamplingSettings | tail sampling is disabled
+/// tail-sampling-max-buffer-size | max size of the buffered log records of a trace | 65536
 ///
 /// ## Static configuration example:
 ///
@@ -39,8 +49,13 @@ class Tracer final : public RawComponentBase {
   static constexpr std::string_view kName = "tracer";
 
   Tracer(const ComponentConfig& config, const ComponentContext& context);
+  ~Tracer() override;
 
   static yaml_config::Schema GetStaticConfigSchema();
+
+ private:
+  tracing::TracerPtr tracer_;
+  utils::PeriodicTask export_task_;
 };
 
 template <>
@@ -0,0 +1,65 @@
+#pragma once
+
+/// @file userver/tracing/sampler.hpp
+/// @brief @copybrief tracing::Sampler
+
+#include <chrono>
+#include <cstddef>
+#include <memory>
+#include <optional>
+#include <string_view>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace tracing {
+
+/// @ingroup userver_base_classes
+///
+/// @brief Base class for the head sampling of traces.
+///
+/// The sampler decides whether the spans of a trace are logged when the root
+/// span of the trace is created. The decision is inherited by the child
+/// spans and is propagated to other services in the tracing headers that
+/// support it (OpenTelemetry trace flags and b3 sampled). The decisions that
+/// came in the headers of a request are used instead of the sampler.
+class Sampler {
+ public:
+  virtual ~Sampler();
+
+  /// @returns true if the spans of the trace should be logged
+  virtual bool ShouldSample(std::string_view trace_id) const = 0;
+};
+
+/// @brief Makes a sampler that samples the `ratio` of traces.
+///
+/// The decision depends only on the trace id, so the services with the same
+/// ratio agree on it even without the propagated decision.
+std::shared_ptr<const Sampler> MakeRatioSampler(double ratio);
+
+/// @brief Settings of the tail sampling of the traces dropped by
+/// tracing::Sampler.
+///
+/// The log records of the spans of such traces are buffered until the root
+/// span finishes. The trace is kept if any of its spans has the
+/// tracing::kErrorFlag tag or if the root span took longer than
+/// `latency_threshold`, otherwise the records are discarded.
+struct TailSamplingSettings final {
+  std::chrono::milliseconds latency_threshold{std::chrono::seconds{1}};
+
+  /// Max total size of the buffered log records of a trace, the records
+  /// above the limit are discarded
+  std::size_t max_buffer_size{64 * 1024};
+};
+
+/// Sampling settings of tracing::Tracer
+struct SamplingSettings final {
+  /// Head sampler, nullptr to log all the traces
+  std::shared_ptr<const Sampler> sampler;
+
+  /// Tail sampling of the traces dropped by `sampler`, if set
+  std::optional<TailSamplingSettings> tail;
+};
+
+}  // namespace tracing
+
+USERVER_NAMESPACE_END
@@ -192,6 +192,11 @@ class Span final {
   /// global log levels to the default logger.
   bool ShouldLogDefault() const noexcept;
 
+  /// @returns false if the trace was dropped by the head sampling of the
+  /// tracer, see tracing::Sampler. The spans of such traces are logged only
+  /// if the trace is kept by the tail sampling.
+  bool IsSampled() const noexcept;
+
   /// Detach the Span from current engine::Task so it is not
   /// returned by CurrentSpan() any more.
   void DetachFromCoroStack();
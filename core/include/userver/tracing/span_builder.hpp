@@ -26,6 +26,10 @@ class SpanBuilder final {
   void SetParentLink(std::string parent_link);
   void AddTagFrozen(std::string key, logging::LogExtra::Value value);
   void AddNonInheritableTag(std::string key, logging::LogExtra::Value value);
+
+  /// Sets the sampling decision that came with the request, used only if the
+  /// tracer has a tracing::Sampler
+  void SetSampled(bool sampled);
   Span Build() &&;
 
  private:
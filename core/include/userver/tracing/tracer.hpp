@@ -3,6 +3,7 @@
 #include <memory>
 #include <unordered_set>
 
+#include <userver/tracing/sampler.hpp>
 #include <userver/tracing/span.hpp>
 #include <userver/tracing/tracer_fwd.hpp>
 
@@ -17,6 +18,10 @@ namespace tracing {
 
 struct NoLogSpans;
 
+namespace impl {
+class SpanExporter;
+}  // namespace impl
+
 class Tracer : public std::enable_shared_from_this<Tracer> {
  public:
   static void SetNoLogSpans(NoLogSpans&& spans);
@@ -39,22 +44,48 @@ class Tracer : public std::enable_shared_from_this<Tracer> {
 
   logging::LoggerPtr GetOptionalLogger() const { return optional_logger_; }
 
+  const SamplingSettings& GetSamplingSettings() const noexcept {
+    return sampling_;
+  }
+
+  /// @cond
+  // For internal use only. Returns the exporter that batches the
+  // opentracing records, nullptr if the records are logged at once.
+  virtual impl::SpanExporter* GetSpanExporter() const noexcept;
+  /// @endcond
+
  protected:
   explicit Tracer(std::string_view service_name,
-                  logging::LoggerPtr optional_logger)
+                  logging::LoggerPtr optional_logger,
+                  SamplingSettings sampling = {})
       : service_name_(service_name),
-        optional_logger_(std::move(optional_logger)) {}
+        optional_logger_(std::move(optional_logger)),
+        sampling_(std::move(sampling)) {}
 
   virtual ~Tracer();
 
  private:
   const std::string service_name_;
   const logging::LoggerPtr optional_logger_;
+  const SamplingSettings sampling_;
 };
 
-/// Make a tracer that could be set globally via tracing::Tracer::SetTracer
+/// @brief Make a tracer that could be set globally via
+/// tracing::Tracer::SetTracer
+///
+/// The "native" tracer writes the opentracing record of a span to the
+/// `logger` as soon as the span finishes. The "batched" tracer buffers the
+/// records in a compact binary form and writes them out in batches on
+/// tracing::FlushSpans, moving the formatting off the request path.
+///
+/// @see tracing::SamplingSettings
 TracerPtr MakeTracer(std::string_view service_name, logging::LoggerPtr logger,
-                     std::string_view tracer_type = "native");
+                     std::string_view tracer_type = "native",
+                     SamplingSettings sampling = {});
+
+/// Writes out the opentracing records buffered by the "batched" tracer,
+/// does nothing for the other tracers
+void FlushSpans(const Tracer& tracer) noexcept;
 
 }  // namespace tracing
 
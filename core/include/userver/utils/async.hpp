@@ -4,10 +4,13 @@
 /// @brief Utility functions to start asynchronous tasks.
 
 #include <functional>
+#include <iterator>
 #include <string>
 #include <utility>
+#include <vector>
 
 #include <userver/engine/async.hpp>
+#include <userver/engine/impl/task_start_batch.hpp>
 #include <userver/utils/fast_pimpl.hpp>
 #include <userver/utils/lazy_prvalue.hpp>
 
@@ -41,7 +44,7 @@ struct SpanWrapCall {
 
   struct Impl;
 
-  static constexpr std::size_t kImplSize = 4264;
+  static constexpr std::size_t kImplSize = 4272;
   static constexpr std::size_t kImplAlign = 8;
   utils::FastPimpl<Impl, kImplSize, kImplAlign> pimpl_;
 };
@@ -324,6 +327,27 @@ template <typename Function, typename... Args>
       std::forward<Function>(f), std::forward<Args>(args)...);
 }
 
+/// @overload
+/// @ingroup userver_concurrency
+///
+/// Tasks run in the order of their engine::Task::Priority, lower priority
+/// tasks are still guaranteed to get a share of the task processor.
+///
+/// @param task_processor Task processor to run on
+/// @param name Name of the task to show in logs
+/// @param priority Priority of the task in the task processor queue
+/// @param f Function to execute asynchronously
+/// @param args Arguments to pass to the function
+/// @returns engine::TaskWithResult
+template <typename Function, typename... Args>
+[[nodiscard]] auto Async(engine::TaskProcessor& task_processor,
+                         std::string name, engine::Task::Priority priority,
+                         Function&& f, Args&&... args) {
+  return engine::AsyncNoSpan(
+      task_processor, priority, impl::SpanLazyPrvalue(std::move(name)),
+      std::forward<Function>(f), std::forward<Args>(args)...);
+}
+
 /// @overload
 /// @ingroup userver_concurrency
 ///
@@ -415,6 +439,25 @@ template <typename Function, typename... Args>
                       std::forward<Args>(args)...);
 }
 
+/// @overload
+/// @ingroup userver_concurrency
+///
+/// Tasks run in the order of their engine::Task::Priority, lower priority
+/// tasks are still guaranteed to get a share of the task processor.
+///
+/// @param name Name of the task to show in logs
+/// @param priority Priority of the task in the task processor queue
+/// @param f Function to execute asynchronously
+/// @param args Arguments to pass to the function
+/// @returns engine::TaskWithResult
+template <typename Function, typename... Args>
+[[nodiscard]] auto Async(std::string name, engine::Task::Priority priority,
+                         Function&& f, Args&&... args) {
+  return utils::Async(engine::current_task::GetTaskProcessor(), std::move(name),
+                      priority, std::forward<Function>(f),
+                      std::forward<Args>(args)...);
+}
+
 /// @overload
 /// @ingroup userver_concurrency
 ///
@@ -500,6 +543,57 @@ template <typename Function, typename... Args>
       std::forward<Function>(f), std::forward<Args>(args)...);
 }
 
+/// @ingroup userver_concurrency
+///
+/// @brief Starts an asynchronous task per element of `range`, the task calls
+/// `f(element)`.
+///
+/// Works like utils::Async called in a loop, but the tasks are pushed to the
+/// task queue at once after all of them are created, with a single wakeup of
+/// the workers. Prefer it for fan-out workloads that spawn many subtasks at
+/// once. Use engine::GetAll to gather the results.
+///
+/// Task execution may be cancelled before the function starts execution
+/// in case of TaskProcessor overload.
+///
+/// @param task_processor Task processor to run on
+/// @param name Name of the tasks to show in logs
+/// @param range Forward range of the arguments, each element is copied into
+/// its task
+/// @param f Function to execute asynchronously, copied into each task
+/// @returns std::vector of engine::TaskWithResult in the order of `range`
+template <typename Range, typename Function>
+[[nodiscard]] auto AsyncBatch(engine::TaskProcessor& task_processor,
+                              const std::string& name, const Range& range,
+                              const Function& f) {
+  using std::begin;
+  using std::end;
+  using TaskType = decltype(utils::Async(task_processor, std::string{name}, f,
+                                         *begin(range)));
+
+  std::vector<TaskType> tasks;
+  tasks.reserve(std::distance(begin(range), end(range)));
+
+  // Declared after 'tasks' to start the created tasks before they are
+  // cancelled and awaited in case of an exception.
+  engine::impl::TaskStartBatch batch{task_processor, tasks.capacity()};
+  for (const auto& element : range) {
+    tasks.push_back(utils::Async(task_processor, name, f, element));
+  }
+  return tasks;
+}
+
+/// @overload
+/// @ingroup userver_concurrency
+///
+/// Tasks are started on the task processor of the current task.
+template <typename Range, typename Function>
+[[nodiscard]] auto AsyncBatch(const std::string& name, const Range& range,
+                              const Function& f) {
+  return utils::AsyncBatch(engine::current_task::GetTaskProcessor(), name,
+                           range, f);
+}
+
 }  // namespace utils
 
 USERVER_NAMESPACE_END
@@ -0,0 +1,186 @@
+#pragma once
+
+/// @file userver/utils/parallel.hpp
+/// @brief Parallel algorithms over random-access ranges that run on an
+/// engine::TaskProcessor
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <optional>
+#include <utility>
+#include <vector>
+
+#include <userver/engine/exception.hpp>
+#include <userver/engine/sleep.hpp>
+#include <userver/engine/task/cancel.hpp>
+#include <userver/engine/task/task_processor_fwd.hpp>
+#include <userver/engine/wait_all_checked.hpp>
+#include <userver/utils/async.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+/// @brief Parallel algorithms, see @ref utils/parallel.hpp
+///
+/// The range is split into chunks that are processed by a few tasks. Each
+/// task takes the next unprocessed chunk until there are none left, so a slow
+/// chunk does not stall the whole computation. The tasks yield between the
+/// chunks to let other tasks of the task processor run and stop on
+/// cancellation of the calling task.
+///
+/// All the functions must be called from a coroutine and block until the
+/// whole range is processed. If an element function throws, one of the
+/// exceptions is rethrown and the rest of the chunks may be left unprocessed.
+namespace utils::parallel {
+
+struct Options final {
+  /// Task processor to run on, the task processor of the current task if
+  /// nullptr
+  engine::TaskProcessor* task_processor{nullptr};
+
+  /// Max count of the tasks to start, the count of the task processor worker
+  /// threads if 0
+  std::size_t max_tasks{0};
+
+  /// Min count of the elements processed by a task in one go. Increase it for
+  /// very cheap element functions to reduce the synchronization overhead.
+  std::size_t min_chunk_size{1};
+};
+
+namespace impl {
+
+struct ChunkPlan final {
+  engine::TaskProcessor& task_processor;
+  std::size_t size;
+  std::size_t chunk_size;
+  std::size_t chunk_count;
+  std::size_t tasks_count;
+};
+
+ChunkPlan PlanChunks(std::size_t size, const Options& options);
+
+[[noreturn]] void ThrowInterrupted();
+
+// Calls `chunk_function(chunk_index, begin_index, end_index)` for each chunk
+template <typename ChunkFunction>
+void ForEachChunk(const ChunkPlan& plan, const ChunkFunction& chunk_function) {
+  if (plan.chunk_count == 0) return;
+
+  std::atomic<std::size_t> next_chunk{0};
+  const auto worker = [&] {
+    while (!engine::current_task::ShouldCancel()) {
+      const auto chunk = next_chunk.fetch_add(1, std::memory_order_relaxed);
+      if (chunk >= plan.chunk_count) return;
+
+      const auto begin = chunk * plan.chunk_size;
+      chunk_function(chunk, begin, std::min(plan.size, begin + plan.chunk_size));
+      engine::Yield();
+    }
+  };
+
+  {
+    std::vector<engine::TaskWithResult<void>> tasks;
+    tasks.reserve(plan.tasks_count);
+    for (std::size_t i = 0; i < plan.tasks_count; ++i) {
+      tasks.push_back(
+          utils::Async(plan.task_processor, "parallel", std::cref(worker)));
+    }
+    engine::WaitAllChecked(tasks);
+  }
+
+  // Some of the tasks could be cancelled (e.g. due to the task processor
+  // overload) before they have processed all the chunks
+  worker();
+  if (next_chunk.load(std::memory_order_relaxed) < plan.chunk_count) {
+    ThrowInterrupted();
+  }
+}
+
+}  // namespace impl
+
+/// @brief Calls `f(element)` for each element of [first, last)
+template <typename RandomIt, typename Function>
+void ForEach(RandomIt first, RandomIt last, const Function& f,
+             const Options& options = {}) {
+  impl::ForEachChunk(
+      impl::PlanChunks(last - first, options),
+      [&](std::size_t, std::size_t begin, std::size_t end) {
+        for (auto it = first + begin; it != first + end; ++it) f(*it);
+      });
+}
+
+/// @brief Stores `f(element)` for each element of [first, last) into the
+/// range starting at `d_first`
+template <typename RandomIt, typename OutputRandomIt, typename Function>
+void Transform(RandomIt first, RandomIt last, OutputRandomIt d_first,
+               const Function& f, const Options& options = {}) {
+  impl::ForEachChunk(
+      impl::PlanChunks(last - first, options),
+      [&](std::size_t, std::size_t begin, std::size_t end) {
+        auto out = d_first + begin;
+        for (auto it = first + begin; it != first + end; ++it, ++out) {
+          *out = f(*it);
+        }
+      });
+}
+
+/// @brief Reduces [first, last) with `init` using `op`
+///
+/// `op` must be associative, it is applied to the elements in the range order
+/// (unlike `std::reduce`, `op` need not be commutative).
+template <typename RandomIt, typename T, typename BinaryOp = std::plus<>>
+T Reduce(RandomIt first, RandomIt last, T init, const BinaryOp& op = {},
+         const Options& options = {}) {
+  const auto plan = impl::PlanChunks(last - first, options);
+  std::vector<std::optional<T>> partial_results(plan.chunk_count);
+
+  impl::ForEachChunk(
+      plan, [&](std::size_t chunk, std::size_t begin, std::size_t end) {
+        T result = first[begin];
+        for (auto it = first + begin + 1; it != first + end; ++it) {
+          result = op(std::move(result), *it);
+        }
+        partial_results[chunk].emplace(std::move(result));
+      });
+
+  for (auto& result : partial_results) {
+    init = op(std::move(init), std::move(*result));
+  }
+  return init;
+}
+
+/// @brief Sorts [first, last) with `comp`, the sort is not stable
+///
+/// The chunks are sorted in parallel, then merged pairwise in parallel.
+template <typename RandomIt, typename Compare = std::less<>>
+void Sort(RandomIt first, RandomIt last, const Compare& comp = {},
+          const Options& options = {}) {
+  const auto plan = impl::PlanChunks(last - first, options);
+  impl::ForEachChunk(plan,
+                     [&](std::size_t, std::size_t begin, std::size_t end) {
+                       std::sort(first + begin, first + end, comp);
+                     });
+
+  Options merge_options = options;
+  merge_options.min_chunk_size = 1;
+  for (std::size_t width = plan.chunk_size; width < plan.size; width *= 2) {
+    const auto merges_count = (plan.size + 2 * width - 1) / (2 * width);
+    impl::ForEachChunk(
+        impl::PlanChunks(merges_count, merge_options),
+        [&](std::size_t, std::size_t begin, std::size_t end) {
+          for (std::size_t merge = begin; merge < end; ++merge) {
+            const auto left = merge * 2 * width;
+            const auto middle = std::min(plan.size, left + width);
+            const auto right = std::min(plan.size, left + 2 * width);
+            std::inplace_merge(first + left, first + middle, first + right,
+                               comp);
+          }
+        });
+  }
+}
+
+}  // namespace utils::parallel
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,138 @@
+#pragma once
+
+/// @file userver/utils/statistics/hdr_histogram.hpp
+/// @brief @copybrief utils::statistics::HdrHistogram
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include <userver/concurrent/striped_counter.hpp>
+#include <userver/utils/statistics/fwd.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace utils::statistics {
+
+/// Bucket layout of utils::statistics::HdrHistogram
+struct HdrHistogramSettings final {
+  /// Values below `lowest_value` are counted in a single underflow bucket
+  double lowest_value{1.0};
+
+  /// Values from `highest_value` (rounded up to `lowest_value` times a power
+  /// of 2) are counted in a single overflow bucket
+  double highest_value{1e6};
+
+  /// Each power of 2 is split into `2^precision_bits` equal buckets, which
+  /// bounds the relative error of a value by `2^-precision_bits`
+  int precision_bits{5};
+};
+
+/// @brief A copy of the counters of utils::statistics::HdrHistogram.
+///
+/// Snapshots of the histograms with the same settings are summable, e.g. to
+/// get the distribution over a time window or over multiple histograms.
+class HdrHistogramSnapshot final {
+ public:
+  explicit HdrHistogramSnapshot(const HdrHistogramSettings& settings);
+
+  const HdrHistogramSettings& GetSettings() const noexcept;
+
+  /// Adds the counters of a snapshot with the same settings
+  void Add(const HdrHistogramSnapshot& other);
+
+  /// Returns the sum of all the counters
+  std::uint64_t GetTotalCount() const noexcept;
+
+  /// @brief Returns the upper bound of the bucket that contains the
+  /// `percent`th percentile, or 0 if the snapshot is empty.
+  ///
+  /// The result is within the relative error of the histogram from the
+  /// exact percentile, unless it is in the underflow bucket (the lowest
+  /// value is returned) or in the overflow bucket (the rounded up highest
+  /// value is returned).
+  double GetPercentile(double percent) const noexcept;
+
+  /// @cond
+  // For internal use only
+  std::vector<std::uint64_t>& GetCounters() noexcept { return counters_; }
+  const std::vector<std::uint64_t>& GetCounters() const noexcept {
+    return counters_;
+  }
+  double GetUpperBoundAt(std::size_t index) const noexcept;
+  /// @endcond
+
+ private:
+  HdrHistogramSettings settings_;
+  std::size_t octave_count_;
+  std::vector<std::uint64_t> counters_;
+};
+
+/// @brief A log-linear histogram of the "HDR" kind with a bounded relative
+/// error of the values and contention-free writes.
+///
+/// Unlike utils::statistics::Histogram, the bucket bounds are not
+/// configured one by one: each power of 2 between the lowest and the highest
+/// value is split into `2^precision_bits` buckets. Each bucket is a
+/// concurrent::StripedCounter, so that many threads may hammer on the same
+/// histogram. The price is memory: about `8 * N_CORES` bytes per bucket,
+/// keep the `precision_bits` and the range of values small.
+///
+/// A value `v` is counted in the bucket `[lo, hi)` with `lo <= v < hi`,
+/// which differs from utils::statistics::Histogram for the values on the
+/// bucket bounds.
+///
+/// The metric is written as utils::statistics::HistogramView with a bucket
+/// per power of 2, so that it is summable on the statistics server and fits
+/// into the portable number of buckets. Use GetSnapshot() for the
+/// full-precision percentiles.
+///
+/// ## Example usage:
+///
+/// @snippet utils/statistics/hdr_histogram_test.cpp  sample
+class HdrHistogram final {
+ public:
+  /// The highest value must not exceed 2^48 times the lowest one,
+  /// `precision_bits` must not exceed 10.
+  explicit HdrHistogram(const HdrHistogramSettings& settings = {});
+
+  HdrHistogram(HdrHistogram&&) noexcept;
+  HdrHistogram& operator=(HdrHistogram&&) noexcept;
+  ~HdrHistogram();
+
+  const HdrHistogramSettings& GetSettings() const noexcept;
+
+  /// Increments the bucket corresponding to the given value.
+  void Account(double value, std::uint64_t count = 1) noexcept;
+
+  /// Reads all the counters.
+  HdrHistogramSnapshot GetSnapshot() const;
+
+  /// Adds the counters of a snapshot with the same settings
+  void Add(const HdrHistogramSnapshot& snapshot) noexcept;
+
+  /// Resets all the counters to zero, the concurrent Account calls are not
+  /// lost.
+  friend void ResetMetric(HdrHistogram& histogram) noexcept;
+
+ private:
+  std::size_t GetIndex(double value) const noexcept;
+
+  HdrHistogramSettings settings_;
+  std::size_t octave_count_;
+  std::size_t counter_count_;
+  // 1 / lowest_value
+  double scale_;
+  std::unique_ptr<concurrent::StripedCounter[]> counters_;
+};
+
+/// Metric serialization support for HdrHistogramSnapshot.
+void DumpMetric(Writer& writer, const HdrHistogramSnapshot& snapshot);
+
+/// Metric serialization support for HdrHistogram.
+void DumpMetric(Writer& writer, const HdrHistogram& histogram);
+
+}  // namespace utils::statistics
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,95 @@
+#pragma once
+
+/// @file userver/utils/statistics/otlp_metrics_exporter.hpp
+/// @brief @copybrief components::OtlpMetricsExporter
+
+#include <chrono>
+#include <memory>
+#include <string>
+
+#include <userver/clients/http/client.hpp>
+#include <userver/components/component_base.hpp>
+#include <userver/components/component_fwd.hpp>
+#include <userver/utils/periodic_task.hpp>
+#include <userver/utils/statistics/fwd.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace utils::statistics::impl {
+class OtlpMetricsAggregator;
+}  // namespace utils::statistics::impl
+
+namespace components {
+
+// clang-format off
+
+/// @ingroup userver_components
+///
+/// @brief Component that periodically pushes the metrics of
+/// components::StatisticsStorage to an OpenTelemetry collector.
+///
+/// The metrics are sent as an OTLP/HTTP JSON ExportMetricsServiceRequest.
+/// utils::statistics::Rate metrics and histograms are sent with the delta
+/// temporality and only if they changed since the last delivered export,
+/// the other metrics are sent as gauges. If an export fails, the next one
+/// contains its deltas.
+///
+/// The metrics are pre-aggregated: if `label-allow-list` is set, the other
+/// labels are dropped and the series that become equal are summed.
+///
+/// The export runs on `task-processor`, a dedicated task processor with a
+/// few threads bounds the CPU that is spent on it.
+///
+/// ## Static options:
+/// Name | Description | Default value
+/// ---- | ----------- | -------------
+/// endpoint | URL of the OTLP/HTTP metrics receiver, e.g. `http://localhost:4318/v1/metrics` | -
+/// service-name | value of the `service.name` resource attribute | -
+/// export-period | period of the export | 15s
+/// timeout | timeout of the export request | 5s
+/// label-allow-list | labels to keep, all the labels are kept if not set | -
+/// http-client | name of the components::HttpClient component | http-client
+/// task-processor | task processor to run the export on | the task processor of the component
+///
+/// ## Static configuration example:
+///
+/// ```
+/// # yaml
+/// otlp-metrics-exporter:
+///     endpoint: http://localhost:4318/v1/metrics
+///     service-name: my-service
+///     export-period: 30s
+///     label-allow-list: [http_handler, http_code]
+///     task-processor: monitor-task-processor
+/// ```
+
+// clang-format on
+
+class OtlpMetricsExporter final : public ComponentBase {
+ public:
+  /// @ingroup userver_component_names
+  /// @brief The default name of components::OtlpMetricsExporter
+  static constexpr std::string_view kName = "otlp-metrics-exporter";
+
+  OtlpMetricsExporter(const ComponentConfig&, const ComponentContext&);
+  ~OtlpMetricsExporter() override;
+
+  static yaml_config::Schema GetStaticConfigSchema();
+
+ private:
+  void Export();
+
+  const utils::statistics::Storage& storage_;
+  clients::http::Client& http_client_;
+  const std::string endpoint_;
+  const std::chrono::milliseconds timeout_;
+  std::unique_ptr<utils::statistics::impl::OtlpMetricsAggregator> aggregator_;
+  utils::PeriodicTask export_task_;
+};
+
+template <>
+inline constexpr bool kHasValidate<OtlpMetricsExporter> = true;
+
+}  // namespace components
+
+USERVER_NAMESPACE_END
@@ -3,6 +3,7 @@
 /// @file userver/utils/statistics/prometheus.hpp
 /// @brief Statistics output in Prometheus format.
 
+#include <memory>
 #include <string>
 
 #include <userver/utils/statistics/storage.hpp>
@@ -24,17 +25,53 @@ std::string ToPrometheusName(std::string_view data);
 // Label names beginning with __ are reserved for internal use.
 std::string ToPrometheusLabel(std::string_view name);
 
+struct PrometheusCache;
+
 }  // namespace impl
 
+/// @brief The rendered metric names and labels that are reused by the
+/// subsequent calls of ToPrometheusFormat and ToPrometheusFormatUntyped,
+/// along with the output buffer.
+///
+/// Makes the repeated scrapes of the same metrics cheaper. The entries of
+/// the metrics that were not written for a number of calls are evicted.
+///
+/// Not thread-safe, a cache must not be used by the concurrent calls.
+class PrometheusFormatCache final {
+ public:
+  PrometheusFormatCache();
+  PrometheusFormatCache(PrometheusFormatCache&&) noexcept;
+  PrometheusFormatCache& operator=(PrometheusFormatCache&&) noexcept;
+  ~PrometheusFormatCache();
+
+ private:
+  friend std::string ToPrometheusFormat(const Storage&, const Request&,
+                                        PrometheusFormatCache&);
+  friend std::string ToPrometheusFormatUntyped(const Storage&, const Request&,
+                                               PrometheusFormatCache&);
+
+  std::unique_ptr<impl::PrometheusCache> impl_;
+};
+
 /// Output `statistics` in Prometheus format, each metric has `gauge` type.
 std::string ToPrometheusFormat(const utils::statistics::Storage& statistics,
                                const utils::statistics::Request& request = {});
 
+/// @overload
+std::string ToPrometheusFormat(const utils::statistics::Storage& statistics,
+                               const utils::statistics::Request& request,
+                               PrometheusFormatCache& cache);
+
 /// Output `statistics` in Prometheus format, without metric types.
 std::string ToPrometheusFormatUntyped(
     const utils::statistics::Storage& statistics,
     const utils::statistics::Request& request = {});
 
+/// @overload
+std::string ToPrometheusFormatUntyped(
+    const utils::statistics::Storage& statistics,
+    const utils::statistics::Request& request, PrometheusFormatCache& cache);
+
 }  // namespace utils::statistics
 
 USERVER_NAMESPACE_END
@@ -27,6 +27,7 @@ constexpr std::string_view kUpdatesEnabled = "updates-enabled";
 constexpr std::string_view kTaskProcessor = "task-processor";
 constexpr std::string_view kFailedUpdatesBeforeExpiration =
     "failed-updates-before-expiration";
+constexpr std::string_view kUpdatePriority = "update-priority";
 
 constexpr std::string_view kUpdateInterval = "update-interval";
 constexpr std::string_view kUpdateJitter = "update-jitter";
@@ -151,6 +152,7 @@ Config::Config(const yaml_config::YamlConfig& config,
       is_strong_period(config[kIsStrongPeriod].As<bool>(false)),
       failed_updates_before_expiration(config[kFailedUpdatesBeforeExpiration]
                                            .As<std::optional<std::uint64_t>>()),
+      update_priority(config[kUpdatePriority].As<std::uint32_t>(1)),
       first_update_mode(
           config[dump::kDump][kFirstUpdateMode].As<FirstUpdateMode>(
               FirstUpdateMode::kSkip)),
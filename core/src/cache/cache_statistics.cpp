@@ -1,5 +1,6 @@
 #include <userver/cache/cache_statistics.hpp>
 
+#include <engine/task/task_context.hpp>
 #include <userver/utils/assert.hpp>
 #include <userver/utils/datetime.hpp>
 #include <userver/utils/statistics/writer.hpp>
@@ -16,6 +17,7 @@ constexpr const char* kStatisticsNameIncremental = "incremental";
 constexpr const char* kStatisticsNameAny = "any";
 constexpr const char* kStatisticsNameCurrentDocumentsCount =
     "current-documents-count";
+constexpr const char* kStatisticsNameUpdateScheduler = "update-scheduler";
 
 template <typename Clock, typename Duration>
 std::int64_t TimeStampToMillisecondsFromNow(
@@ -88,6 +90,21 @@ void DumpMetric(utils::statistics::Writer& writer,
             stats.last_update_duration.load())
             .count();
   }
+
+  // Only for the task processors with the allocation accounting enabled
+  if (const auto allocated = stats.last_update_allocated_bytes.load()) {
+    auto memory = writer["memory"];
+    memory["last-update-allocated-bytes"] = allocated;
+    memory["last-update-retained-bytes"] =
+        stats.last_update_retained_bytes.load();
+  }
+}
+
+void DumpMetric(utils::statistics::Writer& writer,
+                const UpdateSchedulerStatistics& stats) {
+  writer["deferred_count"] = stats.deferred_count;
+  writer["deferral_time_ms"] = stats.deferral_time_ms;
+  writer["slot_wait_time_ms"] = stats.slot_wait_time_ms;
 }
 
 void DumpMetric(utils::statistics::Writer& writer, const Statistics& stats) {
@@ -102,6 +119,7 @@ void DumpMetric(utils::statistics::Writer& writer, const Statistics& stats) {
 
   writer[cache::kStatisticsNameCurrentDocumentsCount] =
       stats.documents_current_count;
+  writer[cache::kStatisticsNameUpdateScheduler] = stats.update_scheduler;
 }
 
 }  // namespace impl
@@ -115,6 +133,13 @@ UpdateStatisticsScope::UpdateStatisticsScope(impl::Statistics& stats,
       update_start_time_(utils::datetime::SteadyNow()) {
   update_stats_.last_update_start_time = update_start_time_;
   ++update_stats_.update_attempt_count;
+
+  // Allocations of the subtasks started by the update are not accounted
+  if (auto* context = engine::current_task::GetCurrentTaskContextUnchecked()) {
+    const auto counters = context->GetAllocationCounters();
+    update_start_allocated_bytes_ = counters.allocated_bytes;
+    update_start_deallocated_bytes_ = counters.deallocated_bytes;
+  }
 }
 
 UpdateStatisticsScope::~UpdateStatisticsScope() {
@@ -159,6 +184,7 @@ void UpdateStatisticsScope::DoFinish(impl::UpdateState new_state) {
   const auto update_stop_time = utils::datetime::SteadyNow();
   if (new_state == impl::UpdateState::kSuccess) {
     update_stats_.last_successful_update_start_time = update_start_time_;
+    AccountAllocations();
   }
   update_stats_.last_update_duration =
       std::chrono::duration_cast<std::chrono::milliseconds>(update_stop_time -
@@ -167,6 +193,23 @@ void UpdateStatisticsScope::DoFinish(impl::UpdateState new_state) {
   state_ = new_state;
 }
 
+void UpdateStatisticsScope::AccountAllocations() {
+  auto* context = engine::current_task::GetCurrentTaskContextUnchecked();
+  if (!context) return;
+
+  const auto counters = context->GetAllocationCounters();
+  const auto allocated =
+      counters.allocated_bytes - update_start_allocated_bytes_;
+  const auto deallocated =
+      counters.deallocated_bytes - update_start_deallocated_bytes_;
+  update_stats_.last_update_allocated_bytes = allocated;
+  // The data of the previous update may be freed within the update, so the
+  // value may be negative
+  update_stats_.last_update_retained_bytes =
+      static_cast<std::int64_t>(allocated) -
+      static_cast<std::int64_t>(deallocated);
+}
+
 }  // namespace cache
 
 USERVER_NAMESPACE_END
@@ -5,6 +5,7 @@
 #include <userver/components/component.hpp>
 #include <userver/components/dump_configurator.hpp>
 #include <userver/dynamic_config/source.hpp>
+#include <userver/engine/sleep.hpp>
 #include <userver/engine/task/cancel.hpp>
 #include <userver/logging/log.hpp>
 #include <userver/testsuite/cache_control.hpp>
@@ -34,6 +35,16 @@ T CheckNotNull(T ptr) {
   return ptr;
 }
 
+constexpr std::chrono::seconds kQueueWaitPollInterval{1};
+
+utils::statistics::Rate MillisecondsSince(
+    std::chrono::steady_clock::time_point start) {
+  const auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(
+      utils::datetime::SteadyNow() - start);
+  return utils::statistics::Rate{
+      static_cast<utils::statistics::Rate::ValueType>(elapsed.count())};
+}
+
 }  // namespace
 
 void CacheUpdateTrait::Impl::InvalidateAsync(UpdateType update_type) {
@@ -100,6 +111,7 @@ CacheUpdateTrait::Impl::Impl(CacheDependencies&& dependencies,
           dependencies.cache_control.IsPeriodicUpdateEnabled(static_config_,
                                                              name_)),
       periodic_task_flags_{utils::PeriodicTask::Flags::kChaotic},
+      queue_wait_meter_(task_processor_),
       dumpable_(customized_trait_) {
   if (dependencies.dump_config) {
     dumper_.emplace(*dependencies.dump_config,
@@ -274,6 +286,7 @@ void CacheUpdateTrait::Impl::OnConfigUpdate(
   const auto new_config = config_.Read();
   update_task_.SetSettings(GetPeriodicTaskSettings(*new_config));
   cleanup_task_.SetSettings({new_config->cleanup_interval});
+  impl::GetUpdateScheduler().SetConfig(config[impl::kUpdateSchedulerConfig]);
 }
 
 rcu::ReadablePtr<Config> CacheUpdateTrait::Impl::GetConfig() const {
@@ -331,6 +344,9 @@ void CacheUpdateTrait::Impl::DoPeriodicUpdate() {
   }
 
   const auto update_type = NextUpdateType(*config);
+  // The first update is not delayed, the service does not start without it
+  const auto slot = is_first_update ? impl::UpdateScheduler::Slot{}
+                                    : ScheduleUpdate(update_type, *config);
   try {
     DoUpdate(update_type, *config);
     // Note: "on update success" logic goes inside DoUpdate
@@ -342,6 +358,41 @@ void CacheUpdateTrait::Impl::DoPeriodicUpdate() {
   }
 }
 
+impl::UpdateScheduler::Slot CacheUpdateTrait::Impl::ScheduleUpdate(
+    UpdateType update_type, const Config& config) {
+  auto& scheduler = impl::GetUpdateScheduler();
+  const auto scheduler_config = scheduler.GetConfig();
+  if (!scheduler_config.enabled) return {};
+
+  auto& stats = statistics_.update_scheduler;
+  // Incremental updates are cheap, and delaying them makes the data stale
+  if (update_type == UpdateType::kFull &&
+      scheduler_config.max_queue_wait.count() != 0) {
+    const auto deferral_start = utils::datetime::SteadyNow();
+    const auto deferral_end = deferral_start + scheduler_config.max_deferral;
+    bool is_deferred = false;
+    while (queue_wait_meter_.Measure() > scheduler_config.max_queue_wait &&
+           utils::datetime::SteadyNow() < deferral_end) {
+      if (!is_deferred) {
+        LOG_INFO() << "Deferring full update of cache " << name_
+                   << " as the task processor is overloaded";
+        ++stats.deferred_count;
+        is_deferred = true;
+      }
+      engine::InterruptibleSleepFor(kQueueWaitPollInterval);
+      engine::current_task::CancellationPoint();
+    }
+    if (is_deferred) {
+      stats.deferral_time_ms += MillisecondsSince(deferral_start);
+    }
+  }
+
+  const auto wait_start = utils::datetime::SteadyNow();
+  auto slot = scheduler.Acquire(config.update_priority);
+  stats.slot_wait_time_ms += MillisecondsSince(wait_start);
+  return slot;
+}
+
 void CacheUpdateTrait::Impl::OnUpdateFailure(const Config& config) {
   const auto failed_updates_before_expiration =
       static_config_.failed_updates_before_expiration;
@@ -25,6 +25,8 @@
 #include <userver/dump/operations.hpp>
 #include <userver/testsuite/cache_control.hpp>
 
+#include <cache/update_scheduler.hpp>
+
 USERVER_NAMESPACE_BEGIN
 
 namespace cache {
@@ -85,6 +87,10 @@ class CacheUpdateTrait::Impl final {
 
   // Throws if `Update` throws
   void DoUpdate(UpdateType type, const Config& config);
+
+  // Waits until USERVER_CACHE_UPDATE_SCHEDULER allows the update to start
+  impl::UpdateScheduler::Slot ScheduleUpdate(UpdateType type,
+                                             const Config& config);
   void CheckUpdateState(impl::UpdateState update_state,
                         std::string_view update_type_str);
 
@@ -115,6 +121,7 @@ class CacheUpdateTrait::Impl final {
   std::chrono::steady_clock::time_point last_full_update_;
   std::optional<std::chrono::milliseconds> generated_full_update_jitter_;
   engine::Mutex update_mutex_;
+  impl::QueueWaitMeter queue_wait_meter_;
   DumpableEntityProxy dumpable_;
   std::uint64_t failed_updates_counter_{0};
   std::atomic<FirstUpdateInvalidation> first_update_invalidation_{
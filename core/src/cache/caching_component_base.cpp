@@ -80,6 +80,13 @@ properties:
             takes priority over static
         defaultDescription: 0
         minimum: 0
+    update-priority:
+        type: integer
+        description: |
+            weight of the cache updates in USERVER_CACHE_UPDATE_SCHEDULER,
+            a cache with a greater weight waits less for an update slot
+        defaultDescription: 1
+        minimum: 1
     dump:
         type: object
         description: Manages cache behavior after dump load
@@ -1,9 +1,13 @@
+#include <optional>
 #include <string>
+#include <unordered_map>
 
 #include <userver/utest/utest.hpp>
 
 #include <userver/cache/expirable_lru_cache.hpp>
 #include <userver/dump/operations_mock.hpp>
+#include <userver/engine/async.hpp>
+#include <userver/engine/single_use_event.hpp>
 #include <userver/engine/sleep.hpp>
 #include <userver/utils/mock_now.hpp>
 
@@ -88,6 +92,31 @@ std::shared_ptr<SimpleCache> CreateSimpleCachePtr() {
   return std::make_shared<SimpleCache>(1, 1);
 }
 
+class MapLowerTier final
+    : public cache::impl::LowerTier<SimpleCacheKey, SimpleCacheValue> {
+ public:
+  using Entry = cache::impl::ExpirableValue<SimpleCacheValue>;
+
+  void Store(const SimpleCacheKey& key, const Entry& entry) override {
+    entries_.insert_or_assign(key, entry);
+  }
+
+  std::optional<Entry> Load(const SimpleCacheKey& key) override {
+    const auto it = entries_.find(key);
+    if (it == entries_.end()) return std::nullopt;
+    return it->second;
+  }
+
+  void Remove(const SimpleCacheKey& key) override { entries_.erase(key); }
+
+  void Clear() override { entries_.clear(); }
+
+  std::size_t GetSize() const { return entries_.size(); }
+
+ private:
+  std::unordered_map<SimpleCacheKey, Entry> entries_;
+};
+
 }  // namespace
 
 UTEST(ExpirableLruCache, Hit) {
@@ -295,6 +324,62 @@ UTEST(ExpirableLruCache, InvalidateByKey) {
   EXPECT_EQ(Counter::One(), *counter);
 }
 
+UTEST(ExpirableLruCache, LowerTier) {
+  auto counter = std::make_shared<Counter>();
+  auto lower_tier = std::make_shared<MapLowerTier>();
+
+  auto cache = CreateSimpleCache();
+  cache.SetMaxLifetime(std::chrono::seconds(2));
+  cache.SetLowerTier(lower_tier);
+  utils::datetime::MockNowSet(std::chrono::system_clock::now());
+
+  EXPECT_EQ(1, cache.Get("a", UpdateValue(counter, 1)));
+  EXPECT_EQ(2, cache.Get("b", UpdateValue(counter, 2)));
+  EXPECT_EQ(1, lower_tier->GetSize());
+
+  // "a" is promoted back from the lower tier, evicting "b"
+  EXPECT_EQ(1, cache.Get("a", UpdateNever()));
+  EXPECT_EQ(2, cache.Get("b", UpdateNever()));
+
+  cache.InvalidateByKey("a");
+  counter->Flush();
+  EXPECT_EQ(3, cache.Get("a", UpdateValue(counter, 3)));
+  EXPECT_EQ(Counter::One(), *counter);
+
+  // The promoted entries keep the original update time
+  utils::datetime::MockSleep(std::chrono::seconds(3));
+  counter->Flush();
+  EXPECT_EQ(4, cache.Get("b", UpdateValue(counter, 4)));
+  EXPECT_EQ(Counter::One(), *counter);
+
+  cache.Invalidate();
+  EXPECT_EQ(0, lower_tier->GetSize());
+}
+
+UTEST(ExpirableLruCache, MaxBytes) {
+  SimpleCache cache(1, 10);
+  EXPECT_FALSE(cache.GetBytesApproximate().has_value());
+
+  cache.SetSizeEstimator([](const SimpleCacheKey& key, SimpleCacheValue) {
+    return key.size();
+  });
+  cache.SetWayMaxBytes(1000);
+  using TimePoint = std::chrono::steady_clock::time_point;
+  const auto kEntryBytes = std::string{"key-0"}.size() + sizeof(TimePoint);
+
+  cache.Put("key-0", 0);
+  cache.Put("key-1", 1);
+  EXPECT_EQ(2 * kEntryBytes, cache.GetBytesApproximate());
+
+  WriteAndReadFromDump(cache);
+  EXPECT_EQ(2 * kEntryBytes, cache.GetBytesApproximate());
+
+  cache.SetWayMaxBytes(kEntryBytes);
+  EXPECT_EQ(kEntryBytes, cache.GetBytesApproximate());
+  EXPECT_EQ(1, cache.GetOptionalNoUpdate("key-1"));
+  EXPECT_EQ(std::nullopt, cache.GetOptionalNoUpdate("key-0"));
+}
+
 UTEST(ExpirableLruCache, BackgroundUpdate) {
   auto counter = std::make_shared<Counter>();
 
@@ -330,6 +415,89 @@ UTEST(ExpirableLruCache, BackgroundUpdate) {
   EXPECT_EQ(2, cache.Get(key, UpdateNever()));
 }
 
+UTEST(ExpirableLruCache, CoalescedGet) {
+  auto cache = CreateSimpleCache();
+  SimpleCacheKey key = "my-key";
+
+  engine::SingleUseEvent update_started;
+  engine::SingleUseEvent update_finish;
+  auto counter = std::make_shared<Counter>();
+  auto leader = engine::AsyncNoSpan([&] {
+    return cache.Get(key, [&](const SimpleCacheKey&) {
+      ++(*counter);
+      update_started.Send();
+      update_finish.WaitNonCancellable();
+      return 1;
+    });
+  });
+  update_started.WaitNonCancellable();
+
+  auto waiter = engine::AsyncNoSpan([&] {
+    return cache.Get(key, UpdateNever(), SimpleCache::ReadMode::kSkipCache);
+  });
+  EngineYield();
+  EXPECT_EQ(1, cache.GetStatistics().total.coalesced);
+
+  update_finish.Send();
+  EXPECT_EQ(1, leader.Get());
+  EXPECT_EQ(1, waiter.Get());
+  EXPECT_EQ(Counter::One(), *counter);
+  EXPECT_EQ(1, cache.Get(key, UpdateNever()));
+}
+
+UTEST(ExpirableLruCache, CoalescedGetException) {
+  auto cache = CreateSimpleCache();
+  SimpleCacheKey key = "my-key";
+
+  engine::SingleUseEvent update_started;
+  engine::SingleUseEvent update_finish;
+  auto leader = engine::AsyncNoSpan([&] {
+    return cache.Get(key, [&](const SimpleCacheKey&) -> SimpleCacheValue {
+      update_started.Send();
+      update_finish.WaitNonCancellable();
+      throw std::runtime_error("update failed");
+    });
+  });
+  update_started.WaitNonCancellable();
+
+  auto waiter =
+      engine::AsyncNoSpan([&] { return cache.Get(key, UpdateNever()); });
+  EngineYield();
+
+  update_finish.Send();
+  UEXPECT_THROW(leader.Get(), std::runtime_error);
+  UEXPECT_THROW(waiter.Get(), std::runtime_error);
+
+  // The failed update is not remembered
+  auto counter = std::make_shared<Counter>();
+  EXPECT_EQ(2, cache.Get(key, UpdateValue(counter, 2)));
+  EXPECT_EQ(Counter::One(), *counter);
+}
+
+UTEST(ExpirableLruCache, StaleWhileRevalidate) {
+  auto cache = CreateSimpleCache();
+  cache.SetMaxLifetime(std::chrono::seconds(2));
+  cache.SetStaleWhileRevalidate(std::chrono::seconds(2));
+
+  SimpleCacheKey key = "my-key";
+
+  utils::datetime::MockNowSet(std::chrono::system_clock::now());
+  cache.Put(key, 1);
+
+  utils::datetime::MockSleep(std::chrono::seconds(3));
+  auto counter = std::make_shared<Counter>();
+  EXPECT_EQ(1, cache.GetOptional(key, UpdateValue(counter, 2)));
+  EngineYield();
+  EXPECT_EQ(Counter::One(), *counter);
+  EXPECT_EQ(2, cache.GetOptionalNoUpdate(key));
+
+  utils::datetime::MockSleep(std::chrono::seconds(5));
+  counter->Flush();
+  EXPECT_EQ(std::nullopt, cache.GetOptional(key, UpdateValue(counter, 3)));
+  EngineYield();
+  EXPECT_EQ(Counter::Zero(), *counter);
+}
+
 UTEST(ExpirableLruCache, Example) {
   /// [Sample ExpirableLruCache]
   using Key = std::string;
@@ -16,6 +16,8 @@
 #include <userver/yaml_config/yaml_config.hpp>
 
 #include <cache/cache_dependencies.hpp>
+#include <cache/update_scheduler.hpp>
+#include <dump/write_limiter.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
@@ -26,8 +28,11 @@ struct MockEnvironment final {
   explicit MockEnvironment(testsuite::impl::PeriodicUpdatesMode update_mode)
       : cache_control(update_mode, testsuite::CacheControl::UnitTests{}) {}
 
-  dynamic_config::StorageMock config_storage{{dump::kConfigSet, {}},
-                                             {cache::kCacheConfigSet, {}}};
+  dynamic_config::StorageMock config_storage{
+      {dump::kConfigSet, {}},
+      {dump::impl::kWriteLimitsConfig, {}},
+      {cache::kCacheConfigSet, {}},
+      {cache::impl::kUpdateSchedulerConfig, {}}};
   utils::statistics::Storage statistics_storage;
   alerts::Storage alerts_storage;
   fs::blocking::TempDirectory dump_root = fs::blocking::TempDirectory::Create();
@@ -0,0 +1,64 @@
+#include <cache/invalidation_batch.hpp>
+
+#include <utility>
+
+#include <userver/formats/json/serialize.hpp>
+#include <userver/formats/json/value.hpp>
+#include <userver/formats/json/value_builder.hpp>
+#include <userver/formats/parse/common_containers.hpp>
+#include <userver/formats/serialize/common_containers.hpp>
+#include <userver/utils/assert.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace cache::impl {
+
+std::string SerializeInvalidationMessage(const InvalidationMessage& message) {
+  formats::json::ValueBuilder builder{formats::common::Type::kObject};
+  builder["sender"] = message.sender;
+  builder["cache"] = message.cache_name;
+  builder["keys"] = message.keys;
+  return formats::json::ToString(builder.ExtractValue());
+}
+
+InvalidationMessage ParseInvalidationMessage(std::string_view data) {
+  const auto json = formats::json::FromString(data);
+  return {
+      json["sender"].As<std::string>(),
+      json["cache"].As<std::string>(),
+      json["keys"].As<std::vector<std::string>>(),
+  };
+}
+
+bool InvalidationBatch::Add(std::string_view cache_name, std::string key) {
+  auto it = keys_.find(std::string{cache_name});
+  if (it == keys_.end()) {
+    it = keys_.emplace(std::string{cache_name}, 0).first;
+  }
+  const bool is_inserted = it->second.insert(std::move(key)).second;
+  if (is_inserted) ++keys_count_;
+  return is_inserted;
+}
+
+std::vector<InvalidationMessage> InvalidationBatch::Extract(
+    std::string_view sender, std::size_t max_keys_per_message) {
+  UASSERT(max_keys_per_message > 0);
+  std::vector<InvalidationMessage> messages;
+  for (auto& [cache_name, keys] : keys_) {
+    while (!keys.empty()) {
+      auto& message = messages.emplace_back();
+      message.sender = sender;
+      message.cache_name = cache_name;
+      while (!keys.empty() && message.keys.size() < max_keys_per_message) {
+        message.keys.push_back(std::move(keys.extract(keys.begin()).value()));
+      }
+    }
+  }
+  keys_.clear();
+  keys_count_ = 0;
+  return messages;
+}
+
+}  // namespace cache::impl
+
+USERVER_NAMESPACE_END
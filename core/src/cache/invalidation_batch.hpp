@@ -0,0 +1,45 @@
+#pragma once
+
+#include <cstddef>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace cache::impl {
+
+struct InvalidationMessage final {
+  // Instance that has sent the message, to skip own messages
+  std::string sender;
+  std::string cache_name;
+  std::vector<std::string> keys;
+};
+
+std::string SerializeInvalidationMessage(const InvalidationMessage& message);
+
+/// @throws formats::json::Exception on malformed messages
+InvalidationMessage ParseInvalidationMessage(std::string_view data);
+
+/// Invalidated keys gathered between the sends, deduplicated per cache
+class InvalidationBatch final {
+ public:
+  /// @returns false if the key is already in the batch
+  bool Add(std::string_view cache_name, std::string key);
+
+  std::size_t GetKeysCount() const noexcept { return keys_count_; }
+
+  /// Moves the keys out into messages of at most `max_keys_per_message` keys
+  std::vector<InvalidationMessage> Extract(std::string_view sender,
+                                           std::size_t max_keys_per_message);
+
+ private:
+  std::unordered_map<std::string, std::unordered_set<std::string>> keys_;
+  std::size_t keys_count_{0};
+};
+
+}  // namespace cache::impl
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,65 @@
+#include <cache/invalidation_batch.hpp>
+
+#include <algorithm>
+
+#include <gtest/gtest.h>
+
+#include <userver/formats/json/exception.hpp>
+#include <userver/utest/assert_macros.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+TEST(CacheInvalidationBatch, Deduplicate) {
+  cache::impl::InvalidationBatch batch;
+  EXPECT_TRUE(batch.Add("a", "1"));
+  EXPECT_FALSE(batch.Add("a", "1"));
+  EXPECT_TRUE(batch.Add("a", "2"));
+  EXPECT_TRUE(batch.Add("b", "1"));
+  EXPECT_EQ(batch.GetKeysCount(), 3);
+
+  auto messages = batch.Extract("sender", 10);
+  EXPECT_EQ(batch.GetKeysCount(), 0);
+  ASSERT_EQ(messages.size(), 2);
+  std::sort(messages.begin(), messages.end(),
+            [](const auto& lhs, const auto& rhs) {
+              return lhs.cache_name < rhs.cache_name;
+            });
+
+  EXPECT_EQ(messages[0].sender, "sender");
+  EXPECT_EQ(messages[0].cache_name, "a");
+  std::sort(messages[0].keys.begin(), messages[0].keys.end());
+  EXPECT_EQ(messages[0].keys, (std::vector<std::string>{"1", "2"}));
+  EXPECT_EQ(messages[1].cache_name, "b");
+  EXPECT_EQ(messages[1].keys, std::vector<std::string>{"1"});
+
+  EXPECT_TRUE(batch.Extract("sender", 10).empty());
+  EXPECT_TRUE(batch.Add("a", "1"));
+}
+
+TEST(CacheInvalidationBatch, Split) {
+  cache::impl::InvalidationBatch batch;
+  for (int i = 0; i < 5; ++i) batch.Add("a", std::to_string(i));
+
+  const auto messages = batch.Extract("sender", 2);
+  ASSERT_EQ(messages.size(), 3);
+  EXPECT_EQ(messages[0].keys.size(), 2);
+  EXPECT_EQ(messages[1].keys.size(), 2);
+  EXPECT_EQ(messages[2].keys.size(), 1);
+}
+
+TEST(CacheInvalidationBatch, Message) {
+  const cache::impl::InvalidationMessage message{
+      "sender", "cache", {"key", "\"quoted\"\n"}};
+  const auto parsed = cache::impl::ParseInvalidationMessage(
+      cache::impl::SerializeInvalidationMessage(message));
+  EXPECT_EQ(parsed.sender, message.sender);
+  EXPECT_EQ(parsed.cache_name, message.cache_name);
+  EXPECT_EQ(parsed.keys, message.keys);
+
+  UEXPECT_THROW(cache::impl::ParseInvalidationMessage("{\"keys\": 1}"),
+                formats::json::Exception);
+  UEXPECT_THROW(cache::impl::ParseInvalidationMessage("not json"),
+                formats::json::Exception);
+}
+
+USERVER_NAMESPACE_END
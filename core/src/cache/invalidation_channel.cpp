@@ -0,0 +1,174 @@
+#include <userver/cache/invalidation_channel.hpp>
+
+#include <userver/components/component.hpp>
+#include <userver/components/statistics_storage.hpp>
+#include <userver/formats/json/exception.hpp>
+#include <userver/logging/log.hpp>
+#include <userver/utils/statistics/writer.hpp>
+#include <userver/utils/uuid4.hpp>
+#include <userver/yaml_config/merge_schemas.hpp>
+
+#include <cache/invalidation_batch.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace cache {
+
+namespace {
+
+constexpr std::chrono::milliseconds kDefaultFlushInterval{100};
+constexpr std::size_t kDefaultMaxBatchSize = 1000;
+
+}  // namespace
+
+InvalidationChannelBase::InvalidationChannelBase(
+    const components::ComponentConfig& config,
+    const components::ComponentContext& context)
+    : ComponentBase(config, context),
+      sender_id_(utils::generators::GenerateUuid()),
+      flush_interval_(config["flush-interval"].As<std::chrono::milliseconds>(
+          kDefaultFlushInterval)),
+      max_batch_size_(
+          config["max-batch-size"].As<std::size_t>(kDefaultMaxBatchSize)),
+      batch_(std::make_unique<impl::InvalidationBatch>()) {
+  if (max_batch_size_ == 0) {
+    throw std::runtime_error("'max-batch-size' must be positive");
+  }
+
+  statistics_holder_ =
+      context.FindComponent<components::StatisticsStorage>()
+          .GetStorage()
+          .RegisterWriter(
+              "cache-invalidation",
+              [this](utils::statistics::Writer& writer) {
+                WriteStatistics(writer);
+              },
+              {{"invalidation_channel",
+                components::GetCurrentComponentName(config)}});
+}
+
+InvalidationChannelBase::~InvalidationChannelBase() {
+  statistics_holder_.Unregister();
+}
+
+void InvalidationChannelBase::Publish(std::string_view cache_name,
+                                      std::string key) {
+  ++stats_.published_keys;
+  bool should_flush = false;
+  {
+    auto batch = batch_.Lock();
+    if (!(*batch)->Add(cache_name, std::move(key))) {
+      ++stats_.deduplicated_keys;
+      return;
+    }
+    should_flush = (*batch)->GetKeysCount() >= max_batch_size_;
+  }
+  if (should_flush && flush_task_.IsRunning()) flush_task_.ForceStepAsync();
+}
+
+void InvalidationChannelBase::Subscribe(std::string cache_name,
+                                        Callback callback) {
+  auto callbacks = callbacks_.Lock();
+  const auto [it, is_inserted] =
+      callbacks->emplace(std::move(cache_name), std::move(callback));
+  if (!is_inserted) {
+    throw std::runtime_error("Cache '" + it->first +
+                             "' is already subscribed to the invalidations");
+  }
+}
+
+void InvalidationChannelBase::Unsubscribe(const std::string& cache_name) {
+  auto callbacks = callbacks_.Lock();
+  callbacks->erase(cache_name);
+}
+
+yaml_config::Schema InvalidationChannelBase::GetStaticConfigSchema() {
+  return yaml_config::MergeSchemas<components::ComponentBase>(R"(
+type: object
+description: Base class for the LRU cache invalidation channels
+additionalProperties: false
+properties:
+    flush-interval:
+        type: string
+        description: how long the invalidated keys are gathered before sending
+        defaultDescription: 100ms
+    max-batch-size:
+        type: integer
+        description: max keys in a message, reaching it sends the keys right away
+        defaultDescription: 1000
+        minimum: 1
+)");
+}
+
+void InvalidationChannelBase::OnMessage(std::string_view message) {
+  impl::InvalidationMessage parsed;
+  try {
+    parsed = impl::ParseInvalidationMessage(message);
+  } catch (const formats::json::Exception& ex) {
+    ++stats_.malformed_messages;
+    LOG_LIMITED_WARNING() << "Malformed cache invalidation message: " << ex;
+    return;
+  }
+  if (parsed.sender == sender_id_) return;
+
+  // The callback is called under the lock, so that Unsubscribe() waits for
+  // the callbacks that are running
+  auto callbacks = callbacks_.Lock();
+  const auto it = callbacks->find(parsed.cache_name);
+  if (it == callbacks->end()) return;
+
+  stats_.received_keys += utils::statistics::Rate{parsed.keys.size()};
+  try {
+    it->second(parsed.keys);
+  } catch (const std::exception& ex) {
+    ++stats_.malformed_messages;
+    LOG_LIMITED_WARNING() << "Failed to invalidate the keys of cache '"
+                          << parsed.cache_name << "': " << ex;
+  }
+}
+
+void InvalidationChannelBase::OnAllComponentsLoaded() {
+  flush_task_.Start("cache-invalidation-flush", {flush_interval_},
+                    [this] { Flush(); });
+}
+
+void InvalidationChannelBase::OnAllComponentsAreStopping() {
+  flush_task_.Stop();
+  // The keys invalidated right before the stop
+  Flush();
+}
+
+void InvalidationChannelBase::Flush() {
+  std::vector<impl::InvalidationMessage> messages;
+  {
+    auto batch = batch_.Lock();
+    if ((*batch)->GetKeysCount() == 0) return;
+    messages = (*batch)->Extract(sender_id_, max_batch_size_);
+  }
+
+  for (const auto& message : messages) {
+    try {
+      DoPublish(impl::SerializeInvalidationMessage(message));
+      ++stats_.sent_messages;
+    } catch (const std::exception& ex) {
+      ++stats_.send_errors;
+      LOG_LIMITED_WARNING() << "Failed to send the invalidation of "
+                            << message.keys.size() << " keys of cache '"
+                            << message.cache_name << "': " << ex;
+    }
+  }
+}
+
+void InvalidationChannelBase::WriteStatistics(
+    utils::statistics::Writer& writer) const {
+  writer["published-keys"] = stats_.published_keys;
+  writer["deduplicated-keys"] = stats_.deduplicated_keys;
+  writer["sent-messages"] = stats_.sent_messages;
+  writer["send-errors"] = stats_.send_errors;
+  writer["received-keys"] = stats_.received_keys;
+  writer["malformed-messages"] = stats_.malformed_messages;
+}
+
+}  // namespace cache
+
+USERVER_NAMESPACE_END
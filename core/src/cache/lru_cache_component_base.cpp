@@ -1,5 +1,9 @@
 #include <userver/cache/lru_cache_component_base.hpp>
 
+#include <optional>
+
+#include <fmt/format.h>
+
 #include <userver/components/component_config.hpp>
 #include <userver/components/component_context.hpp>
 #include <userver/components/statistics_storage.hpp>
@@ -41,6 +45,43 @@ bool IsDumpSupportEnabled(const components::ComponentConfig& config) {
   return dump_support_enabled;
 }
 
+InvalidationChannelBase* FindInvalidationChannel(
+    const components::ComponentConfig& config,
+    const components::ComponentContext& context) {
+  const auto channel_name =
+      config["invalidation-channel"].As<std::optional<std::string>>();
+  if (!channel_name) return nullptr;
+  return &context.FindComponent<InvalidationChannelBase>(*channel_name);
+}
+
+void ThrowInvalidationUnsupported(const std::string& name) {
+  throw std::runtime_error(fmt::format(
+      "Keys of the cache '{}' can not be sent to the invalidation channel, "
+      "specialize cache::InvalidationKeyTraits for them",
+      name));
+}
+
+SpilloverStorageBase* FindSpilloverStorage(
+    const components::ComponentConfig& config,
+    const components::ComponentContext& context) {
+  const auto storage_name =
+      config["spillover-storage"].As<std::optional<std::string>>();
+  if (!storage_name) return nullptr;
+  return &context.FindComponent<SpilloverStorageBase>(*storage_name);
+}
+
+void ThrowSpilloverUnsupported(const std::string& name) {
+  throw std::runtime_error(fmt::format(
+      "Entries of the cache '{}' can not be stored in the spillover storage, "
+      "implement the dump serialization for its keys and values",
+      name));
+}
+
+void LogSpilloverLoadError(const std::string& name, const std::exception& ex) {
+  LOG_LIMITED_WARNING() << "Failed to deserialize the evicted entry of cache '"
+                        << name << "': " << ex;
+}
+
 yaml_config::Schema GetLruCacheComponentBaseSchema() {
   return yaml_config::MergeSchemas<dump::Dumper>(R"(
 type: object
@@ -50,6 +91,10 @@ properties:
     size:
         type: integer
         description: max amount of items to store in cache
+    max-bytes:
+        type: integer
+        description: max estimated size of the items in bytes (0 is unlimited)
+        defaultDescription: 0
     ways:
         type: integer
         description: number of ways for associative cache
@@ -57,14 +102,36 @@ properties:
         type: string
         description: TTL for cache entries (0 is unlimited)
         defaultDescription: 0
+    stale-while-revalidate:
+        type: string
+        description: period after the TTL during which the expired entries are returned and updated in background (0 is disabled)
+        defaultDescription: 0
     background-update:
         type: boolean
         description: enables asynchronous updates for expiring values
         defaultDescription: false
+    policy:
+        type: string
+        description: eviction policy of the cache
+        defaultDescription: lru
+        enum:
+          - lru
+          - slru
+          - tinylfu
     config-settings:
         type: boolean
         description: enables dynamic reconfiguration with CacheConfigSet
         defaultDescription: true
+    invalidation-channel:
+        type: string
+        description: |
+            name of the cache::InvalidationChannelBase component that delivers
+            InvalidateByKeyOnAllInstances() to all the instances of the service
+    spillover-storage:
+        type: string
+        description: |
+            name of the cache::SpilloverStorageBase component to store the
+            evicted entries in, requires the lru policy
 )");
 }
 
@@ -6,6 +6,8 @@
 #include <userver/dump/config.hpp>
 #include <userver/dynamic_config/value.hpp>
 #include <userver/utils/algo.hpp>
+#include <userver/utils/trivial_map.hpp>
+#include <userver/yaml_config/yaml_config.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
@@ -15,9 +17,21 @@ namespace {
 
 constexpr std::string_view kWays = "ways";
 constexpr std::string_view kSize = "size";
+constexpr std::string_view kMaxBytes = "max-bytes";
 constexpr std::string_view kLifetime = "lifetime";
 constexpr std::string_view kBackgroundUpdate = "background-update";
 constexpr std::string_view kLifetimeMs = "lifetime-ms";
+constexpr std::string_view kStaleWhileRevalidate = "stale-while-revalidate";
+constexpr std::string_view kStaleWhileRevalidateMs =
+    "stale-while-revalidate-ms";
+constexpr std::string_view kPolicy = "policy";
+
+constexpr utils::TrivialBiMap kCachePolicyMap([](auto selector) {
+  return selector()
+      .Case(CachePolicy::kLRU, "lru")
+      .Case(CachePolicy::kSLRU, "slru")
+      .Case(CachePolicy::kTinyLFU, "tinylfu");
+});
 
 }  // namespace
 
@@ -25,11 +39,18 @@ using dump::impl::ParseMs;
 
 LruCacheConfig::LruCacheConfig(const yaml_config::YamlConfig& config)
     : size(config[kSize].As<std::size_t>()),
+      max_bytes(config[kMaxBytes].As<std::size_t>(0)),
       lifetime(config[kLifetime].As<std::chrono::milliseconds>(0)),
       background_update(config[kBackgroundUpdate].As<bool>(false)
                             ? BackgroundUpdateMode::kEnabled
-                            : BackgroundUpdateMode::kDisabled) {
+                            : BackgroundUpdateMode::kDisabled),
+      stale_while_revalidate(
+          config[kStaleWhileRevalidate].As<std::chrono::milliseconds>(0)),
+      policy(config[kPolicy].As<CachePolicy>(CachePolicy::kLRU)) {
   if (size == 0) throw std::runtime_error("cache-size is non-positive");
+  if (max_bytes != 0 && policy != CachePolicy::kLRU) {
+    throw std::runtime_error("max-bytes requires the 'lru' policy");
+  }
 }
 
 LruCacheConfig::LruCacheConfig(const components::ComponentConfig& config)
@@ -37,10 +58,13 @@ LruCacheConfig::LruCacheConfig(const components::ComponentConfig& config)
 
 LruCacheConfig::LruCacheConfig(const formats::json::Value& value)
     : size(value[kSize].As<std::size_t>()),
+      max_bytes(value[kMaxBytes].As<std::size_t>(0)),
       lifetime(ParseMs(value[kLifetimeMs])),
       background_update(value[kBackgroundUpdate].As<bool>(false)
                             ? BackgroundUpdateMode::kEnabled
-                            : BackgroundUpdateMode::kDisabled) {
+                            : BackgroundUpdateMode::kDisabled),
+      stale_while_revalidate(ParseMs(value[kStaleWhileRevalidateMs],
+                                     std::chrono::milliseconds::zero())) {
   if (size == 0) throw std::runtime_error("cache-size is non-positive");
 }
 
@@ -49,6 +73,17 @@ std::size_t LruCacheConfig::GetWaySize(std::size_t ways) const {
   return way_size == 0 ? 1 : way_size;
 }
 
+std::size_t LruCacheConfig::GetWayMaxBytes(std::size_t ways) const {
+  if (max_bytes == 0) return 0;
+  const auto way_max_bytes = max_bytes / ways;
+  return way_max_bytes == 0 ? 1 : way_max_bytes;
+}
+
+CachePolicy Parse(const yaml_config::YamlConfig& config,
+                  formats::parse::To<CachePolicy>) {
+  return utils::ParseFromValueString(config, kCachePolicyMap);
+}
+
 LruCacheConfig Parse(const formats::json::Value& value,
                      formats::parse::To<LruCacheConfig>) {
   return LruCacheConfig{value};
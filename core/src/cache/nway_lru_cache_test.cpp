@@ -1,6 +1,11 @@
 #include <userver/utest/utest.hpp>
 
+#include <string>
+#include <vector>
+
 #include <userver/cache/nway_lru_cache.hpp>
+#include <userver/formats/json/serialize.hpp>
+#include <userver/formats/json/value.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
@@ -64,4 +69,137 @@ UTEST(NWayLRU, HashCombine) {
   }
 }
 
+UTEST(NWayLRU, Policies) {
+  for (const auto policy :
+       {cache::CachePolicy::kLRU, cache::CachePolicy::kSLRU,
+        cache::CachePolicy::kTinyLFU}) {
+    Cache cache(4, 10, {}, {}, policy);
+    for (int i = 0; i < 1000; ++i) {
+      cache.Put(i, i);
+      EXPECT_EQ(i, cache.Get(i));
+    }
+    EXPECT_LE(cache.GetSize(), 40);
+
+    cache.InvalidateByKey(999);
+    EXPECT_FALSE(cache.Get(999).has_value());
+
+    cache.UpdateWaySize(20);
+    for (int i = 0; i < 1000; ++i) cache.Put(i, i);
+    EXPECT_LE(cache.GetSize(), 80);
+
+    cache.Invalidate();
+    EXPECT_EQ(0, cache.GetSize());
+  }
+}
+
+UTEST(NWayLRU, MaxBytes) {
+  cache::NWayLRU<int, std::string> cache(1, 100);
+  cache.SetSizeEstimator(
+      [](int, const std::string& value) { return value.size(); });
+  cache.UpdateWayMaxBytes(100);
+
+  cache.Put(1, std::string(40, 'a'));
+  cache.Put(2, std::string(40, 'b'));
+  EXPECT_EQ(80, cache.GetBytes());
+
+  // Evicts the least recently used element to fit into the limit
+  cache.Get(1);
+  cache.Put(3, std::string(30, 'c'));
+  EXPECT_EQ(70, cache.GetBytes());
+  EXPECT_TRUE(cache.Get(1).has_value());
+  EXPECT_FALSE(cache.Get(2).has_value());
+
+  // Rewriting accounts for the old value
+  cache.Put(3, std::string(10, 'c'));
+  EXPECT_EQ(50, cache.GetBytes());
+
+  // Too large elements are not stored
+  cache.Put(4, std::string(101, 'd'));
+  EXPECT_FALSE(cache.Get(4).has_value());
+  EXPECT_EQ(50, cache.GetBytes());
+
+  cache.InvalidateByKey(1);
+  EXPECT_EQ(10, cache.GetBytes());
+  EXPECT_FALSE(
+      cache.Get(3, [](const std::string&) { return false; }).has_value());
+  EXPECT_EQ(0, cache.GetBytes());
+  EXPECT_EQ(0, cache.GetSize());
+}
+
+UTEST(NWayLRU, MaxBytesUpdate) {
+  cache::NWayLRU<int, std::string> cache(1, 10);
+  cache.SetSizeEstimator(
+      [](int, const std::string& value) { return value.size(); });
+  for (int i = 0; i < 10; ++i) cache.Put(i, std::string(10, 'a'));
+  EXPECT_EQ(0, cache.GetBytes());
+
+  cache.UpdateWayMaxBytes(50);
+  EXPECT_EQ(50, cache.GetBytes());
+  EXPECT_EQ(5, cache.GetSize());
+  EXPECT_TRUE(cache.Get(9).has_value());
+
+  // The entries limit still applies
+  cache.UpdateWaySize(2);
+  EXPECT_EQ(20, cache.GetBytes());
+  for (int i = 0; i < 10; ++i) cache.Put(i, std::string(1, 'a'));
+  EXPECT_EQ(2, cache.GetBytes());
+
+  cache.UpdateWayMaxBytes(0);
+  EXPECT_EQ(0, cache.GetBytes());
+  EXPECT_EQ(2, cache.GetSize());
+
+  cache::NWayLRU<int, std::string> slru(1, 10, {}, {},
+                                        cache::CachePolicy::kSLRU);
+  UEXPECT_THROW(slru.UpdateWayMaxBytes(50), std::logic_error);
+}
+
+UTEST(NWayLRU, EvictionCallback) {
+  cache::NWayLRU<int, int> cache(1, 2);
+  std::vector<std::pair<int, int>> evicted;
+  cache.SetEvictionCallback(
+      [&evicted](int key, int value) { evicted.emplace_back(key, value); });
+
+  cache.Put(1, 10);
+  cache.Put(2, 20);
+  cache.Put(2, 21);
+  EXPECT_TRUE(evicted.empty());
+
+  cache.Put(3, 30);
+  EXPECT_EQ(evicted, (std::vector<std::pair<int, int>>{{1, 10}}));
+
+  // Invalidations are not evictions
+  cache.InvalidateByKey(2);
+  cache.Invalidate();
+  EXPECT_EQ(evicted.size(), 1);
+
+  cache.Put(4, 40);
+  cache.Put(5, 50);
+  cache.UpdateWaySize(1);
+  EXPECT_EQ(evicted, (std::vector<std::pair<int, int>>{{1, 10}, {4, 40}}));
+
+  cache::NWayLRU<int, int> slru(1, 10, {}, {}, cache::CachePolicy::kSLRU);
+  UEXPECT_THROW(slru.SetEvictionCallback([](int, int) {}), std::logic_error);
+}
+
+TEST(CacheSizeEstimator, Default) {
+  EXPECT_EQ(sizeof(int), cache::EstimateSize(1));
+
+  std::string str(100, 'a');
+  EXPECT_EQ(sizeof(std::string) + str.capacity(), cache::EstimateSize(str));
+
+  const std::vector<std::string> strings{str, str};
+  EXPECT_EQ(sizeof(strings) + 2 * cache::EstimateSize(str),
+            cache::EstimateSize(strings));
+
+  EXPECT_EQ(cache::EstimateSize(1) + cache::EstimateSize(str) +
+                cache::DefaultSizeEstimator::kEntryOverhead,
+            cache::DefaultSizeEstimator{}(1, str));
+}
+
+TEST(CacheSizeEstimator, Json) {
+  const auto json = formats::json::FromString(R"({"key": [1, 2, 3]})");
+  EXPECT_EQ(formats::json::EstimateMemoryUsage(json),
+            cache::EstimateSize(json));
+}
+
 USERVER_NAMESPACE_END
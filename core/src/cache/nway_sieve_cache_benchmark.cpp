@@ -0,0 +1,56 @@
+#include <benchmark/benchmark.h>
+
+#include <atomic>
+#include <cstdint>
+
+#include <userver/cache/nway_lru_cache.hpp>
+#include <userver/cache/nway_sieve_cache.hpp>
+#include <userver/engine/run_standalone.hpp>
+#include <utils/impl/parallelize_benchmark.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+constexpr std::size_t kWays = 16;
+constexpr std::uint64_t kKeyCount = 10'000;
+
+}  // namespace
+
+// Every thread reads the keys of the full cache and replaces one key per
+// `state.range(1)` reads, the hot keys of the threads intersect
+template <typename Cache>
+void nway_cache_read_heavy(benchmark::State& state) {
+  const std::size_t threads_count = state.range(0);
+  const std::uint64_t reads_per_write = state.range(1);
+
+  engine::RunStandalone(threads_count, [&] {
+    Cache cache(kWays, kKeyCount / kWays * 2);
+    for (std::uint64_t key = 0; key < kKeyCount; ++key) cache.Put(key, key);
+    std::atomic<std::uint64_t> thread_index{0};
+
+    RunParallelBenchmark(state, [&](auto& range) {
+      std::uint64_t i = thread_index++ * 7919;
+      for ([[maybe_unused]] auto _ : range) {
+        const auto key = (i++ * 7919) % kKeyCount;
+        if (i % reads_per_write == 0) {
+          cache.Put(key, i);
+        } else {
+          benchmark::DoNotOptimize(cache.Get(key));
+        }
+      }
+    });
+  });
+}
+BENCHMARK_TEMPLATE(nway_cache_read_heavy,
+                   cache::NWayLRU<std::uint64_t, std::uint64_t>)
+    ->RangeMultiplier(2)
+    ->Ranges({{1, 32}, {100, 100}})
+    ->Args({32, 10'000});
+BENCHMARK_TEMPLATE(nway_cache_read_heavy,
+                   cache::NWaySieveCache<std::uint64_t, std::uint64_t>)
+    ->RangeMultiplier(2)
+    ->Ranges({{1, 32}, {100, 100}})
+    ->Args({32, 10'000});
+
+USERVER_NAMESPACE_END
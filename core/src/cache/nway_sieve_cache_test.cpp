@@ -0,0 +1,155 @@
+#include <userver/utest/utest.hpp>
+
+#include <atomic>
+#include <vector>
+
+#include <userver/cache/nway_sieve_cache.hpp>
+#include <userver/dump/common.hpp>
+#include <userver/dump/operations_mock.hpp>
+#include <userver/engine/async.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+using SieveCache = cache::NWaySieveCache<int, int>;
+
+UTEST(NWaySieveCache, Ctr) {
+  UEXPECT_NO_THROW(SieveCache(1, 10));
+  UEXPECT_NO_THROW(SieveCache(10, 10));
+  UEXPECT_THROW(SieveCache(0, 10), std::logic_error);
+  UEXPECT_THROW(SieveCache(1, 0), std::logic_error);
+}
+
+UTEST(NWaySieveCache, Set) {
+  SieveCache cache(1, 1);
+  EXPECT_EQ(0, cache.GetSize());
+
+  cache.Put(1, 1);
+  EXPECT_EQ(1, cache.GetSize());
+  cache.Put(1, 2);
+  EXPECT_EQ(1, cache.GetSize());
+  EXPECT_EQ(2, cache.Get(1));
+
+  cache.Put(2, 2);
+  EXPECT_EQ(2, cache.Get(2));
+  EXPECT_EQ(1, cache.GetSize());
+  EXPECT_FALSE(cache.Get(1).has_value());
+  EXPECT_EQ(-1, cache.GetOr(1, -1));
+}
+
+UTEST(NWaySieveCache, GetExpired) {
+  SieveCache cache(1, 2);
+  cache.Put(1, 1);
+  cache.Put(2, 2);
+
+  EXPECT_FALSE(cache.Get(1, [](int) { return false; }).has_value());
+  EXPECT_EQ(1, cache.GetSize());
+  EXPECT_FALSE(cache.Get(1).has_value());
+  EXPECT_EQ(2, cache.Get(2));
+}
+
+UTEST(NWaySieveCache, EvictsNotVisited) {
+  SieveCache cache(1, 3);
+  cache.Put(1, 1);
+  cache.Put(2, 2);
+  cache.Put(3, 3);
+
+  EXPECT_EQ(1, cache.Get(1));
+  EXPECT_EQ(3, cache.Get(3));
+
+  // The hand passes the visited 1 and stops at 2
+  cache.Put(4, 4);
+  EXPECT_FALSE(cache.Get(2).has_value());
+  EXPECT_EQ(1, cache.Get(1));
+  EXPECT_EQ(3, cache.Get(3));
+  EXPECT_EQ(4, cache.Get(4));
+
+  // All the elements are visited, the hand continues from 3, clears all the
+  // flags and evicts 3 on the second pass
+  cache.Put(5, 5);
+  EXPECT_EQ(3, cache.GetSize());
+  EXPECT_FALSE(cache.Get(3).has_value());
+  EXPECT_EQ(1, cache.Get(1));
+  EXPECT_EQ(4, cache.Get(4));
+  EXPECT_EQ(5, cache.Get(5));
+}
+
+UTEST(NWaySieveCache, Invalidate) {
+  SieveCache cache(4, 10);
+  for (int i = 0; i < 20; ++i) cache.Put(i, i);
+  EXPECT_EQ(20, cache.GetSize());
+
+  cache.InvalidateByKey(5);
+  cache.InvalidateByKey(100);
+  EXPECT_EQ(19, cache.GetSize());
+  EXPECT_FALSE(cache.Get(5).has_value());
+
+  cache.Invalidate();
+  EXPECT_EQ(0, cache.GetSize());
+
+  cache.Put(1, 1);
+  EXPECT_EQ(1, cache.Get(1));
+}
+
+UTEST(NWaySieveCache, UpdateWaySize) {
+  SieveCache cache(1, 10);
+  for (int i = 0; i < 10; ++i) cache.Put(i, i);
+
+  cache.UpdateWaySize(5);
+  EXPECT_EQ(5, cache.GetSize());
+
+  cache.UpdateWaySize(20);
+  for (int i = 0; i < 20; ++i) cache.Put(i, i);
+  EXPECT_EQ(20, cache.GetSize());
+}
+
+UTEST(NWaySieveCache, VisitAllAndDump) {
+  SieveCache cache(2, 10);
+  for (int i = 0; i < 10; ++i) cache.Put(i, i * 10);
+
+  dump::MockWriter writer;
+  cache.Write(writer);
+  writer.Finish();
+
+  SieveCache restored(4, 10);
+  dump::MockReader reader(std::move(writer).Extract());
+  restored.Read(reader);
+  reader.Finish();
+
+  int sum = 0;
+  restored.VisitAll([&sum](int key, int value) {
+    EXPECT_EQ(key * 10, value);
+    sum += key;
+  });
+  EXPECT_EQ(45, sum);
+  EXPECT_EQ(10, restored.GetSize());
+}
+
+UTEST_MT(NWaySieveCache, ConcurrentReadsAndWrites, 4) {
+  constexpr int kKeys = 100;
+  SieveCache cache(4, 10);
+  std::atomic<bool> stop{false};
+
+  std::vector<engine::TaskWithResult<void>> tasks;
+  for (int t = 0; t < 3; ++t) {
+    tasks.push_back(engine::AsyncNoSpan([&, t] {
+      for (int i = t; !stop; ++i) {
+        const auto key = i % kKeys;
+        const auto value = cache.Get(key);
+        if (value) {
+          EXPECT_EQ(key, *value);
+        } else {
+          cache.Put(key, key);
+        }
+      }
+    }));
+  }
+
+  for (int i = 0; i < 1000; ++i) {
+    cache.InvalidateByKey(i % kKeys);
+    EXPECT_LE(cache.GetSize(), 40);
+  }
+  stop = true;
+  for (auto& task : tasks) task.Get();
+}
+
+USERVER_NAMESPACE_END
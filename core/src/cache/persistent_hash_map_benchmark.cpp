@@ -0,0 +1,73 @@
+#include <userver/cache/persistent_hash_map.hpp>
+
+#include <cstdint>
+#include <unordered_map>
+
+#include <benchmark/benchmark.h>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+constexpr std::int64_t kChanges = 100;
+
+template <typename Map>
+Map MakeMap(std::int64_t size) {
+  Map map;
+  for (std::int64_t i = 0; i < size; ++i) map.insert_or_assign(i, i);
+  return map;
+}
+
+// An incremental cache update: copy the snapshot and apply a few changes
+template <typename Map>
+void IncrementalUpdate(benchmark::State& state) {
+  const auto size = state.range(0);
+  const auto snapshot = MakeMap<Map>(size);
+  std::int64_t key = 0;
+
+  for ([[maybe_unused]] auto _ : state) {
+    auto copy = snapshot;
+    for (std::int64_t i = 0; i < kChanges; ++i) {
+      copy.insert_or_assign(key, i);
+      key = (key + 7919) % size;
+    }
+    benchmark::DoNotOptimize(copy);
+  }
+}
+
+template <typename Map>
+void Find(benchmark::State& state) {
+  const auto size = state.range(0);
+  const auto map = MakeMap<Map>(size);
+  std::int64_t key = 0;
+
+  for ([[maybe_unused]] auto _ : state) {
+    benchmark::DoNotOptimize(map.find(key));
+    key = (key + 7919) % size;
+  }
+}
+
+}  // namespace
+
+void persistent_hash_map_incremental_update(benchmark::State& state) {
+  IncrementalUpdate<cache::PersistentHashMap<std::int64_t, std::int64_t>>(
+      state);
+}
+BENCHMARK(persistent_hash_map_incremental_update)->Range(1 << 10, 1 << 20);
+
+void unordered_map_incremental_update(benchmark::State& state) {
+  IncrementalUpdate<std::unordered_map<std::int64_t, std::int64_t>>(state);
+}
+BENCHMARK(unordered_map_incremental_update)->Range(1 << 10, 1 << 20);
+
+void persistent_hash_map_find(benchmark::State& state) {
+  Find<cache::PersistentHashMap<std::int64_t, std::int64_t>>(state);
+}
+BENCHMARK(persistent_hash_map_find)->Range(1 << 10, 1 << 20);
+
+void unordered_map_find(benchmark::State& state) {
+  Find<std::unordered_map<std::int64_t, std::int64_t>>(state);
+}
+BENCHMARK(unordered_map_find)->Range(1 << 10, 1 << 20);
+
+USERVER_NAMESPACE_END
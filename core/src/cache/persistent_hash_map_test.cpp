@@ -0,0 +1,162 @@
+#include <userver/cache/persistent_hash_map.hpp>
+
+#include <random>
+#include <string>
+#include <unordered_map>
+
+#include <gtest/gtest.h>
+
+#include <userver/dump/common.hpp>
+#include <userver/dump/test_helpers.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+using Map = cache::PersistentHashMap<int, std::string>;
+
+// Makes the trie as deep as it gets, with every key colliding
+struct ConstantHash final {
+  std::size_t operator()(int) const noexcept { return 42; }
+};
+
+// Keys that differ in the high bits only share all the upper levels
+struct ReversedHash final {
+  std::size_t operator()(int key) const noexcept {
+    return static_cast<std::size_t>(key) << (sizeof(std::size_t) * 8 - 8);
+  }
+};
+
+template <typename MapType>
+void ExpectSameContents(
+    const MapType& map, const std::unordered_map<int, std::string>& expected) {
+  ASSERT_EQ(map.size(), expected.size());
+  std::size_t iterated = 0;
+  for (const auto& [key, value] : map) {
+    ++iterated;
+    const auto it = expected.find(key);
+    ASSERT_NE(it, expected.end()) << key;
+    EXPECT_EQ(value, it->second) << key;
+  }
+  EXPECT_EQ(iterated, expected.size());
+  for (const auto& [key, value] : expected) {
+    const auto it = map.find(key);
+    ASSERT_NE(it, map.end()) << key;
+    EXPECT_EQ(it->second, value) << key;
+  }
+}
+
+template <typename MapType>
+void TestRandomOperations(MapType map) {
+  std::unordered_map<int, std::string> expected;
+  std::minstd_rand rng{42};
+  std::uniform_int_distribution<int> keys{0, 500};
+
+  for (int i = 0; i < 5000; ++i) {
+    const auto key = keys(rng);
+    if (rng() % 3 == 0) {
+      EXPECT_EQ(map.erase(key), expected.erase(key)) << key;
+    } else {
+      const auto value = std::to_string(i);
+      EXPECT_EQ(map.insert_or_assign(key, value),
+                expected.insert_or_assign(key, value).second)
+          << key;
+    }
+  }
+  ExpectSameContents(map, expected);
+
+  for (const auto& [key, value] : expected) EXPECT_EQ(map.erase(key), 1);
+  EXPECT_TRUE(map.empty());
+  EXPECT_EQ(map.begin(), map.end());
+}
+
+}  // namespace
+
+TEST(PersistentHashMap, Empty) {
+  const Map map;
+  EXPECT_TRUE(map.empty());
+  EXPECT_EQ(map.size(), 0);
+  EXPECT_EQ(map.begin(), map.end());
+  EXPECT_EQ(map.find(1), map.end());
+  EXPECT_THROW(map.at(1), std::out_of_range);
+}
+
+TEST(PersistentHashMap, InsertFindErase) {
+  Map map;
+  EXPECT_TRUE(map.insert({1, "one"}));
+  EXPECT_FALSE(map.insert({1, "uno"}));
+  EXPECT_EQ(map.at(1), "one");
+
+  EXPECT_FALSE(map.insert_or_assign(1, "uno"));
+  EXPECT_TRUE(map.insert_or_assign(2, "two"));
+  EXPECT_EQ(map.size(), 2);
+  EXPECT_EQ(map.at(1), "uno");
+  EXPECT_TRUE(map.contains(2));
+  EXPECT_EQ(map.count(3), 0);
+
+  EXPECT_EQ(map.erase(3), 0);
+  EXPECT_EQ(map.erase(1), 1);
+  EXPECT_EQ(map.size(), 1);
+  EXPECT_FALSE(map.contains(1));
+  EXPECT_EQ(map.find(2)->second, "two");
+}
+
+TEST(PersistentHashMap, CopiesAreIndependent) {
+  Map original;
+  for (int i = 0; i < 1000; ++i) original.insert_or_assign(i, "old");
+
+  auto copy = original;
+  copy.insert_or_assign(1, "new");
+  copy.insert_or_assign(1000, "added");
+  copy.erase(2);
+
+  EXPECT_EQ(original.size(), 1000);
+  EXPECT_EQ(original.at(1), "old");
+  EXPECT_FALSE(original.contains(1000));
+  EXPECT_TRUE(original.contains(2));
+
+  EXPECT_EQ(copy.size(), 1000);
+  EXPECT_EQ(copy.at(1), "new");
+  EXPECT_EQ(copy.at(1000), "added");
+  EXPECT_FALSE(copy.contains(2));
+  EXPECT_EQ(copy.at(3), "old");
+  EXPECT_NE(copy, original);
+}
+
+TEST(PersistentHashMap, FindThenIterate) {
+  Map map;
+  for (int i = 0; i < 100; ++i) map.insert_or_assign(i, std::to_string(i));
+
+  std::size_t visited = 0;
+  for (auto it = map.begin(); it != map.end(); ++it) {
+    ++visited;
+    // An iterator from find() continues the iteration from its element
+    std::size_t rest = 0;
+    for (auto found = map.find(it->first); found != map.end(); ++found) {
+      ++rest;
+    }
+    EXPECT_EQ(rest, map.size() - visited + 1);
+  }
+  EXPECT_EQ(visited, map.size());
+}
+
+TEST(PersistentHashMap, RandomOperations) { TestRandomOperations(Map{}); }
+
+TEST(PersistentHashMap, HashCollisions) {
+  TestRandomOperations(
+      cache::PersistentHashMap<int, std::string, ConstantHash>{});
+}
+
+TEST(PersistentHashMap, HighHashBits) {
+  TestRandomOperations(
+      cache::PersistentHashMap<int, std::string, ReversedHash>{});
+}
+
+TEST(PersistentHashMap, Dump) {
+  Map map;
+  for (int i = 0; i < 100; ++i) map.insert_or_assign(i, std::to_string(i));
+  dump::TestWriteReadCycle(map);
+  dump::TestWriteReadCycle(Map{});
+}
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,71 @@
+#include <cache/spillover_record.hpp>
+
+#include <cstdint>
+#include <limits>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace cache::impl {
+
+namespace {
+
+constexpr std::size_t kExpirationSize = sizeof(std::int64_t);
+constexpr auto kNeverExpires = std::numeric_limits<std::int64_t>::max();
+
+}  // namespace
+
+std::string MakeSpilloverKey(std::string_view cache_name,
+                             std::string_view key) {
+  auto result = MakeSpilloverKeyPrefix(cache_name);
+  result.append(key);
+  return result;
+}
+
+std::string MakeSpilloverKeyPrefix(std::string_view cache_name) {
+  std::string result;
+  result.reserve(cache_name.size() + 1);
+  result.append(cache_name);
+  result.push_back('\0');
+  return result;
+}
+
+std::string EncodeSpilloverValue(const SpilloverValue& value) {
+  const auto expiration =
+      value.expiration == std::chrono::system_clock::time_point::max()
+          ? kNeverExpires
+          : std::chrono::duration_cast<std::chrono::milliseconds>(
+                value.expiration.time_since_epoch())
+                .count();
+
+  // Big-endian, so that the records are portable between the machines
+  std::string result(kExpirationSize, '\0');
+  for (std::size_t i = 0; i < kExpirationSize; ++i) {
+    result[i] = static_cast<char>(static_cast<std::uint64_t>(expiration) >>
+                                  (8 * (kExpirationSize - 1 - i)));
+  }
+  result.append(value.value);
+  return result;
+}
+
+std::optional<SpilloverValue> DecodeSpilloverValue(std::string_view data) {
+  if (data.size() < kExpirationSize) return std::nullopt;
+
+  std::uint64_t expiration = 0;
+  for (std::size_t i = 0; i < kExpirationSize; ++i) {
+    expiration = (expiration << 8) | static_cast<unsigned char>(data[i]);
+  }
+
+  SpilloverValue result{data.substr(kExpirationSize), {}};
+  if (static_cast<std::int64_t>(expiration) == kNeverExpires) {
+    result.expiration = std::chrono::system_clock::time_point::max();
+  } else {
+    result.expiration = std::chrono::system_clock::time_point{
+        std::chrono::duration_cast<std::chrono::system_clock::duration>(
+            std::chrono::milliseconds{static_cast<std::int64_t>(expiration)})};
+  }
+  return result;
+}
+
+}  // namespace cache::impl
+
+USERVER_NAMESPACE_END
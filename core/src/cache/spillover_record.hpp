@@ -0,0 +1,31 @@
+#pragma once
+
+#include <chrono>
+#include <optional>
+#include <string>
+#include <string_view>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace cache::impl {
+
+// The records of all the caches share the storage, so the keys are prefixed
+// with the cache name
+std::string MakeSpilloverKey(std::string_view cache_name, std::string_view key);
+
+std::string MakeSpilloverKeyPrefix(std::string_view cache_name);
+
+struct SpilloverValue final {
+  std::string_view value;
+  // The record may be removed after that, time_point::max() to keep forever
+  std::chrono::system_clock::time_point expiration;
+};
+
+std::string EncodeSpilloverValue(const SpilloverValue& value);
+
+// Returns std::nullopt for malformed records
+std::optional<SpilloverValue> DecodeSpilloverValue(std::string_view data);
+
+}  // namespace cache::impl
+
+USERVER_NAMESPACE_END
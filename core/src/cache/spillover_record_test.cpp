@@ -0,0 +1,42 @@
+#include <cache/spillover_record.hpp>
+
+#include <gtest/gtest.h>
+
+USERVER_NAMESPACE_BEGIN
+
+TEST(CacheSpilloverRecord, Key) {
+  EXPECT_EQ(cache::impl::MakeSpilloverKey("cache", "key"),
+            std::string("cache\0key", 9));
+  // Keys of a cache never have the prefix of another cache
+  const auto prefix = cache::impl::MakeSpilloverKeyPrefix("a");
+  EXPECT_NE(cache::impl::MakeSpilloverKey("ab", "c").compare(0, prefix.size(),
+                                                             prefix),
+            0);
+}
+
+TEST(CacheSpilloverRecord, Value) {
+  const std::chrono::system_clock::time_point expiration{
+      std::chrono::milliseconds{1'700'000'000'123}};
+  const auto encoded = cache::impl::EncodeSpilloverValue(
+      {std::string_view{"v\0v", 3}, expiration});
+
+  const auto decoded = cache::impl::DecodeSpilloverValue(encoded);
+  ASSERT_TRUE(decoded);
+  EXPECT_EQ(decoded->value, std::string_view("v\0v", 3));
+  EXPECT_EQ(decoded->expiration, expiration);
+}
+
+TEST(CacheSpilloverRecord, NeverExpires) {
+  const auto never = std::chrono::system_clock::time_point::max();
+  const auto decoded = cache::impl::DecodeSpilloverValue(
+      cache::impl::EncodeSpilloverValue({"", never}));
+  ASSERT_TRUE(decoded);
+  EXPECT_EQ(decoded->value, "");
+  EXPECT_EQ(decoded->expiration, never);
+}
+
+TEST(CacheSpilloverRecord, Malformed) {
+  EXPECT_FALSE(cache::impl::DecodeSpilloverValue("short"));
+}
+
+USERVER_NAMESPACE_END
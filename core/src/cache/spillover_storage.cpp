@@ -0,0 +1,296 @@
+#include <userver/cache/spillover_storage.hpp>
+
+#include <algorithm>
+#include <mutex>
+
+#include <userver/components/component.hpp>
+#include <userver/components/statistics_storage.hpp>
+#include <userver/logging/log.hpp>
+#include <userver/utils/datetime.hpp>
+#include <userver/utils/statistics/writer.hpp>
+#include <userver/yaml_config/merge_schemas.hpp>
+
+#include <cache/spillover_record.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace cache {
+
+namespace {
+
+constexpr std::chrono::milliseconds kDefaultFlushInterval{100};
+constexpr std::size_t kDefaultMaxBatchSize = 1000;
+constexpr std::size_t kDefaultMaxPendingRecords = 100'000;
+constexpr std::chrono::milliseconds kDefaultCleanupInterval{
+    std::chrono::minutes{10}};
+
+// The key right after `key` in the key order
+std::string NextKey(std::string key) {
+  key.push_back('\0');
+  return key;
+}
+
+bool StartsWith(std::string_view str, std::string_view prefix) {
+  return str.substr(0, prefix.size()) == prefix;
+}
+
+}  // namespace
+
+SpilloverStorageBase::SpilloverStorageBase(
+    const components::ComponentConfig& config,
+    const components::ComponentContext& context)
+    : ComponentBase(config, context),
+      flush_interval_(config["flush-interval"].As<std::chrono::milliseconds>(
+          kDefaultFlushInterval)),
+      max_batch_size_(
+          config["max-batch-size"].As<std::size_t>(kDefaultMaxBatchSize)),
+      max_pending_records_(config["max-pending-records"].As<std::size_t>(
+          kDefaultMaxPendingRecords)),
+      cleanup_interval_(
+          config["cleanup-interval"].As<std::chrono::milliseconds>(
+              kDefaultCleanupInterval)) {
+  if (max_batch_size_ == 0) {
+    throw std::runtime_error("'max-batch-size' must be positive");
+  }
+
+  statistics_holder_ =
+      context.FindComponent<components::StatisticsStorage>()
+          .GetStorage()
+          .RegisterWriter(
+              "cache-spillover",
+              [this](utils::statistics::Writer& writer) {
+                WriteStatistics(writer);
+              },
+              {{"spillover_storage",
+                components::GetCurrentComponentName(config)}});
+}
+
+SpilloverStorageBase::~SpilloverStorageBase() {
+  statistics_holder_.Unregister();
+}
+
+void SpilloverStorageBase::Store(
+    std::string_view cache_name, std::string_view key, std::string value,
+    std::chrono::system_clock::time_point expiration) {
+  ++stats_.stored;
+  Schedule(impl::MakeSpilloverKey(cache_name, key),
+           impl::EncodeSpilloverValue({value, expiration}));
+}
+
+std::optional<std::string> SpilloverStorageBase::Load(
+    std::string_view cache_name, std::string_view key) {
+  const auto full_key = impl::MakeSpilloverKey(cache_name, key);
+
+  // std::nullopt in the pending records is a pending removal
+  std::optional<std::optional<std::string>> pending_data;
+  {
+    auto pending = pending_.Lock();
+    const auto it = pending->find(full_key);
+    if (it != pending->end()) pending_data = it->second;
+  }
+
+  std::optional<std::string> data;
+  if (pending_data) {
+    data = std::move(*pending_data);
+  } else {
+    try {
+      data = DoRead(full_key);
+    } catch (const std::exception& ex) {
+      ++stats_.read_errors;
+      LOG_LIMITED_WARNING() << "Failed to read the evicted entry of cache '"
+                            << cache_name << "': " << ex;
+      return std::nullopt;
+    }
+  }
+
+  const auto decoded =
+      data ? impl::DecodeSpilloverValue(*data) : std::nullopt;
+  if (!decoded || decoded->expiration < utils::datetime::Now()) {
+    ++stats_.misses;
+    return std::nullopt;
+  }
+  ++stats_.hits;
+  return std::string{decoded->value};
+}
+
+void SpilloverStorageBase::Remove(std::string_view cache_name,
+                                  std::string_view key) {
+  Schedule(impl::MakeSpilloverKey(cache_name, key), std::nullopt);
+}
+
+void SpilloverStorageBase::Clear(std::string_view cache_name) {
+  const auto prefix = impl::MakeSpilloverKeyPrefix(cache_name);
+
+  // Prevents the concurrent flush from writing the records back
+  std::lock_guard lock(write_mutex_);
+  {
+    auto pending = pending_.Lock();
+    for (auto it = pending->begin(); it != pending->end();) {
+      if (StartsWith(it->first, prefix)) {
+        it = pending->erase(it);
+      } else {
+        ++it;
+      }
+    }
+  }
+
+  std::string begin = prefix;
+  while (true) {
+    auto records = DoScan(begin, max_batch_size_);
+
+    std::vector<Record> removed;
+    for (auto& [key, value] : records) {
+      if (!StartsWith(key, prefix)) break;
+      removed.push_back({std::move(key), std::nullopt});
+    }
+    if (removed.empty()) break;
+
+    const bool is_last = removed.size() < records.size() ||
+                         records.size() < max_batch_size_;
+    begin = NextKey(removed.back().key);
+    DoWrite(std::move(removed));
+    if (is_last) break;
+  }
+}
+
+yaml_config::Schema SpilloverStorageBase::GetStaticConfigSchema() {
+  return yaml_config::MergeSchemas<components::ComponentBase>(R"(
+type: object
+description: Base class for the storages of the entries evicted from LRU caches
+additionalProperties: false
+properties:
+    flush-interval:
+        type: string
+        description: how long the evicted entries are gathered before writing
+        defaultDescription: 100ms
+    max-batch-size:
+        type: integer
+        description: max records in a write, reaching it writes the records right away
+        defaultDescription: 1000
+        minimum: 1
+    max-pending-records:
+        type: integer
+        description: max records waiting for a write, the evicted entries are dropped when it is reached
+        defaultDescription: 100000
+    cleanup-interval:
+        type: string
+        description: how often the expired records are removed
+        defaultDescription: 10m
+)");
+}
+
+void SpilloverStorageBase::OnAllComponentsLoaded() {
+  flush_task_.Start("cache-spillover-flush", {flush_interval_},
+                    [this] { Flush(); });
+  cleanup_task_.Start(
+      "cache-spillover-cleanup",
+      {cleanup_interval_, {utils::PeriodicTask::Flags::kChaotic}},
+      [this] { RemoveExpired(); });
+}
+
+void SpilloverStorageBase::OnAllComponentsAreStopping() {
+  cleanup_task_.Stop();
+  flush_task_.Stop();
+  // The entries evicted right before the stop, to be loaded after a restart
+  Flush();
+}
+
+void SpilloverStorageBase::Schedule(std::string key,
+                                    std::optional<std::string> value) {
+  bool should_flush = false;
+  {
+    auto pending = pending_.Lock();
+    const auto it = pending->find(key);
+    if (it != pending->end()) {
+      it->second = std::move(value);
+      return;
+    }
+    if (pending->size() >= max_pending_records_) {
+      ++stats_.dropped;
+      return;
+    }
+    pending->emplace(std::move(key), std::move(value));
+    should_flush = pending->size() >= max_batch_size_;
+  }
+  if (should_flush && flush_task_.IsRunning()) flush_task_.ForceStepAsync();
+}
+
+void SpilloverStorageBase::Flush() {
+  std::lock_guard lock(write_mutex_);
+
+  PendingRecords pending;
+  {
+    auto locked = pending_.Lock();
+    if (locked->empty()) return;
+    pending.swap(*locked);
+  }
+
+  std::vector<Record> records;
+  records.reserve(std::min(pending.size(), max_batch_size_));
+  for (auto& [key, value] : pending) {
+    records.push_back({key, std::move(value)});
+    if (records.size() == max_batch_size_) {
+      WriteRecords(std::move(records));
+      records.clear();
+    }
+  }
+  if (!records.empty()) WriteRecords(std::move(records));
+}
+
+void SpilloverStorageBase::WriteRecords(std::vector<Record> records) {
+  const auto size = records.size();
+  try {
+    DoWrite(std::move(records));
+    stats_.written += utils::statistics::Rate{size};
+  } catch (const std::exception& ex) {
+    stats_.write_errors += utils::statistics::Rate{size};
+    LOG_LIMITED_WARNING() << "Failed to write " << size
+                          << " evicted cache entries: " << ex;
+  }
+}
+
+void SpilloverStorageBase::RemoveExpired() {
+  const auto now = utils::datetime::Now();
+
+  std::string begin;
+  while (true) {
+    const auto records = DoScan(begin, max_batch_size_);
+    if (records.empty()) break;
+
+    std::vector<Record> expired;
+    for (const auto& [key, value] : records) {
+      const auto decoded = impl::DecodeSpilloverValue(value);
+      if (!decoded || decoded->expiration < now) {
+        expired.push_back({key, std::nullopt});
+      }
+    }
+    begin = NextKey(records.back().first);
+
+    if (!expired.empty()) {
+      stats_.expired += utils::statistics::Rate{expired.size()};
+      std::lock_guard lock(write_mutex_);
+      DoWrite(std::move(expired));
+    }
+    if (records.size() < max_batch_size_) break;
+  }
+}
+
+void SpilloverStorageBase::WriteStatistics(
+    utils::statistics::Writer& writer) const {
+  {
+    const auto pending = pending_.Lock();
+    writer["pending-records"] = pending->size();
+  }
+  writer["stored"] = stats_.stored;
+  writer["dropped"] = stats_.dropped;
+  writer["written"] = stats_.written;
+  writer["write-errors"] = stats_.write_errors;
+  writer["hits"] = stats_.hits;
+  writer["misses"] = stats_.misses;
+  writer["read-errors"] = stats_.read_errors;
+  writer["expired"] = stats_.expired;
+}
+
+}  // namespace cache
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,158 @@
+#include <cache/update_scheduler.hpp>
+
+#include <mutex>
+#include <utility>
+
+#include <userver/engine/exception.hpp>
+#include <userver/engine/task/cancel.hpp>
+#include <userver/formats/json/value.hpp>
+#include <userver/utils/assert.hpp>
+
+#include <engine/task/task_processor.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace cache::impl {
+
+UpdateSchedulerConfig Parse(const formats::json::Value& value,
+                            formats::parse::To<UpdateSchedulerConfig>) {
+  UpdateSchedulerConfig config;
+  config.enabled = value["enabled"].As<bool>(config.enabled);
+  config.max_concurrent_updates =
+      value["max-concurrent-updates"].As<std::size_t>(
+          config.max_concurrent_updates);
+  config.max_queue_wait = std::chrono::microseconds{
+      value["max-queue-wait-us"].As<std::chrono::microseconds::rep>(
+          config.max_queue_wait.count())};
+  config.max_deferral = std::chrono::milliseconds{
+      value["max-deferral-ms"].As<std::chrono::milliseconds::rep>(
+          config.max_deferral.count())};
+  return config;
+}
+
+const dynamic_config::Key<UpdateSchedulerConfig> kUpdateSchedulerConfig{
+    "USERVER_CACHE_UPDATE_SCHEDULER",
+    dynamic_config::DefaultAsJsonString{"{}"},
+};
+
+UpdateScheduler::Slot::Slot(UpdateScheduler& scheduler) noexcept
+    : scheduler_(&scheduler) {}
+
+UpdateScheduler::Slot::Slot(Slot&& other) noexcept
+    : scheduler_(std::exchange(other.scheduler_, nullptr)) {}
+
+UpdateScheduler::Slot& UpdateScheduler::Slot::operator=(Slot&& other) noexcept {
+  if (this != &other) {
+    if (scheduler_) scheduler_->Release();
+    scheduler_ = std::exchange(other.scheduler_, nullptr);
+  }
+  return *this;
+}
+
+UpdateScheduler::Slot::~Slot() {
+  if (scheduler_) scheduler_->Release();
+}
+
+void UpdateScheduler::SetConfig(const UpdateSchedulerConfig& config) {
+  const std::lock_guard lock(mutex_);
+  config_ = config;
+  Grant();
+}
+
+UpdateSchedulerConfig UpdateScheduler::GetConfig() const {
+  const std::lock_guard lock(mutex_);
+  return config_;
+}
+
+UpdateScheduler::Slot UpdateScheduler::Acquire(std::uint32_t weight) {
+  std::unique_lock lock(mutex_);
+  if (waiters_.empty() && HasFreeSlot()) {
+    ++active_count_;
+    return Slot{*this};
+  }
+
+  const auto it = waiters_.insert(
+      waiters_.end(), Waiter{weight, std::chrono::steady_clock::now()});
+  // The free slots may be already granted to the waiters that are not awake yet
+  Grant();
+  const bool is_granted = cv_.Wait(lock, [it] { return it->is_granted; });
+  waiters_.erase(it);
+  if (!is_granted) {
+    throw engine::WaitInterruptedException(
+        engine::current_task::CancellationReason());
+  }
+  return Slot{*this};
+}
+
+std::size_t UpdateScheduler::GetActiveCount() const {
+  const std::lock_guard lock(mutex_);
+  return active_count_;
+}
+
+bool UpdateScheduler::HasFreeSlot() const noexcept {
+  return !config_.enabled || config_.max_concurrent_updates == 0 ||
+         active_count_ < config_.max_concurrent_updates;
+}
+
+void UpdateScheduler::Grant() {
+  const auto now = std::chrono::steady_clock::now();
+  bool has_granted = false;
+  while (HasFreeSlot()) {
+    auto best = waiters_.end();
+    double best_score = 0;
+    for (auto it = waiters_.begin(); it != waiters_.end(); ++it) {
+      if (it->is_granted) continue;
+      const auto wait_time =
+          std::chrono::duration<double, std::milli>(now - it->since);
+      // +1 so that the weights also matter for the waiters that came just now
+      const double score = (wait_time.count() + 1) * it->weight;
+      if (best == waiters_.end() || score > best_score) {
+        best = it;
+        best_score = score;
+      }
+    }
+    if (best == waiters_.end()) break;
+
+    best->is_granted = true;
+    ++active_count_;
+    has_granted = true;
+  }
+  if (has_granted) cv_.NotifyAll();
+}
+
+void UpdateScheduler::Release() noexcept {
+  const std::lock_guard lock(mutex_);
+  UASSERT(active_count_ > 0);
+  --active_count_;
+  Grant();
+}
+
+UpdateScheduler& GetUpdateScheduler() {
+  static UpdateScheduler scheduler;
+  return scheduler;
+}
+
+QueueWaitMeter::QueueWaitMeter(engine::TaskProcessor& task_processor)
+    : task_processor_(task_processor) {
+  Measure();
+}
+
+std::chrono::microseconds QueueWaitMeter::Measure() {
+  const auto& counter = task_processor_.GetTaskCounter();
+  const auto wait_time_us =
+      counter.GetQueueWaitTimeUs(engine::Task::Priority::kNormal);
+  const auto samples =
+      counter.GetQueueWaitSamples(engine::Task::Priority::kNormal);
+
+  const auto delta_wait_time_us =
+      wait_time_us.value -
+      std::exchange(last_wait_time_us_, wait_time_us).value;
+  const auto delta_samples =
+      samples.value - std::exchange(last_samples_, samples).value;
+  if (delta_samples == 0) return std::chrono::microseconds{0};
+  return std::chrono::microseconds{delta_wait_time_us / delta_samples};
+}
+
+}  // namespace cache::impl
+
+USERVER_NAMESPACE_END
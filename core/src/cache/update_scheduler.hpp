@@ -0,0 +1,114 @@
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <list>
+
+#include <userver/dynamic_config/snapshot.hpp>
+#include <userver/engine/condition_variable.hpp>
+#include <userver/engine/mutex.hpp>
+#include <userver/engine/task/task_processor_fwd.hpp>
+#include <userver/formats/json_fwd.hpp>
+#include <userver/utils/statistics/rate.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace cache::impl {
+
+struct UpdateSchedulerConfig final {
+  bool enabled{false};
+  // Periodic updates of all the caches running at once
+  std::size_t max_concurrent_updates{4};
+  // Full updates are deferred while the average task queue wait time of the
+  // cache task processor is above this value, 0 - do not defer
+  std::chrono::microseconds max_queue_wait{0};
+  std::chrono::milliseconds max_deferral{std::chrono::seconds{60}};
+};
+
+UpdateSchedulerConfig Parse(const formats::json::Value& value,
+                            formats::parse::To<UpdateSchedulerConfig>);
+
+extern const dynamic_config::Key<UpdateSchedulerConfig>
+    kUpdateSchedulerConfig;
+
+/// @brief Limits the number of cache updates that run at once in the process.
+///
+/// Caches update on their own timers, so with many caches the updates
+/// periodically align and together compete with the request handling for
+/// CPU and for the databases. The scheduler makes the excess updates wait.
+/// A free slot goes to the waiter with the largest wait time multiplied by its
+/// weight, so a heavier cache goes first, but a light one is not starved.
+///
+/// Does nothing while disabled by the config.
+class UpdateScheduler final {
+ public:
+  class Slot final {
+   public:
+    Slot() noexcept = default;
+    Slot(Slot&& other) noexcept;
+    Slot& operator=(Slot&& other) noexcept;
+    ~Slot();
+
+   private:
+    friend class UpdateScheduler;
+    explicit Slot(UpdateScheduler& scheduler) noexcept;
+
+    UpdateScheduler* scheduler_{nullptr};
+  };
+
+  UpdateScheduler() = default;
+
+  UpdateScheduler(UpdateScheduler&&) = delete;
+  UpdateScheduler& operator=(UpdateScheduler&&) = delete;
+
+  void SetConfig(const UpdateSchedulerConfig& config);
+  UpdateSchedulerConfig GetConfig() const;
+
+  /// @brief Waits for a free update slot
+  /// @throws engine::WaitInterruptedException if the current task is cancelled
+  Slot Acquire(std::uint32_t weight);
+
+  std::size_t GetActiveCount() const;
+
+ private:
+  struct Waiter final {
+    std::uint32_t weight;
+    std::chrono::steady_clock::time_point since;
+    bool is_granted{false};
+  };
+
+  bool HasFreeSlot() const noexcept;
+  // Gives the free slots to the waiters
+  void Grant();
+  void Release() noexcept;
+
+  mutable engine::Mutex mutex_;
+  engine::ConditionVariable cv_;
+  UpdateSchedulerConfig config_;
+  std::size_t active_count_{0};
+  std::list<Waiter> waiters_;
+};
+
+/// The scheduler shared by all the caches of the process
+UpdateScheduler& GetUpdateScheduler();
+
+/// Measures the average task queue wait time of a task processor between the
+/// calls of Measure(). Not thread-safe.
+class QueueWaitMeter final {
+ public:
+  explicit QueueWaitMeter(engine::TaskProcessor& task_processor);
+
+  /// @returns the average queue wait time of the sampled tasks since the
+  /// previous call, zero if no tasks were sampled
+  std::chrono::microseconds Measure();
+
+ private:
+  engine::TaskProcessor& task_processor_;
+  utils::statistics::Rate last_wait_time_us_;
+  utils::statistics::Rate last_samples_;
+};
+
+}  // namespace cache::impl
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,112 @@
+#include <cache/update_scheduler.hpp>
+
+#include <vector>
+
+#include <userver/engine/async.hpp>
+#include <userver/engine/sleep.hpp>
+#include <userver/utest/utest.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+constexpr std::size_t kYieldCount = 10;
+
+cache::impl::UpdateSchedulerConfig MakeConfig(std::size_t max_concurrent) {
+  cache::impl::UpdateSchedulerConfig config;
+  config.enabled = true;
+  config.max_concurrent_updates = max_concurrent;
+  return config;
+}
+
+void YieldMany() {
+  for (std::size_t i = 0; i < kYieldCount; ++i) engine::Yield();
+}
+
+}  // namespace
+
+UTEST(CacheUpdateScheduler, Disabled) {
+  cache::impl::UpdateScheduler scheduler;
+  std::vector<cache::impl::UpdateScheduler::Slot> slots;
+  for (int i = 0; i < 10; ++i) slots.push_back(scheduler.Acquire(1));
+  EXPECT_EQ(scheduler.GetActiveCount(), 10);
+
+  slots.clear();
+  EXPECT_EQ(scheduler.GetActiveCount(), 0);
+}
+
+UTEST(CacheUpdateScheduler, ConcurrencyLimit) {
+  cache::impl::UpdateScheduler scheduler;
+  scheduler.SetConfig(MakeConfig(2));
+
+  auto first = scheduler.Acquire(1);
+  auto second = scheduler.Acquire(1);
+  auto task = engine::AsyncNoSpan(
+      [&] { auto task_slot = scheduler.Acquire(1); });
+
+  YieldMany();
+  EXPECT_FALSE(task.IsFinished());
+
+  first = {};
+  task.WaitFor(utest::kMaxTestWaitTime);
+  ASSERT_TRUE(task.IsFinished());
+  UEXPECT_NO_THROW(task.Get());
+  EXPECT_EQ(scheduler.GetActiveCount(), 1);
+}
+
+UTEST(CacheUpdateScheduler, ConfigUpdateGrantsSlots) {
+  cache::impl::UpdateScheduler scheduler;
+  scheduler.SetConfig(MakeConfig(1));
+
+  auto slot = scheduler.Acquire(1);
+  auto task = engine::AsyncNoSpan(
+      [&] { auto task_slot = scheduler.Acquire(1); });
+  YieldMany();
+  EXPECT_FALSE(task.IsFinished());
+
+  scheduler.SetConfig(MakeConfig(2));
+  task.WaitFor(utest::kMaxTestWaitTime);
+  EXPECT_TRUE(task.IsFinished());
+}
+
+UTEST(CacheUpdateScheduler, Weights) {
+  cache::impl::UpdateScheduler scheduler;
+  scheduler.SetConfig(MakeConfig(1));
+
+  auto slot = scheduler.Acquire(1);
+  std::vector<int> order;
+  auto light = engine::AsyncNoSpan([&] {
+    auto task_slot = scheduler.Acquire(1);
+    order.push_back(1);
+  });
+  YieldMany();
+  auto heavy = engine::AsyncNoSpan([&] {
+    auto task_slot = scheduler.Acquire(1000);
+    order.push_back(1000);
+  });
+  YieldMany();
+  EXPECT_TRUE(order.empty());
+
+  slot = {};
+  light.WaitFor(utest::kMaxTestWaitTime);
+  heavy.WaitFor(utest::kMaxTestWaitTime);
+  EXPECT_EQ(order, (std::vector<int>{1000, 1}));
+}
+
+UTEST(CacheUpdateScheduler, Cancel) {
+  cache::impl::UpdateScheduler scheduler;
+  scheduler.SetConfig(MakeConfig(1));
+
+  auto slot = scheduler.Acquire(1);
+  auto task = engine::AsyncNoSpan(
+      [&] { auto task_slot = scheduler.Acquire(1); });
+  YieldMany();
+
+  task.SyncCancel();
+  EXPECT_EQ(scheduler.GetActiveCount(), 1);
+
+  slot = {};
+  EXPECT_EQ(scheduler.GetActiveCount(), 0);
+}
+
+USERVER_NAMESPACE_END
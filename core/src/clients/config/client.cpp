@@ -1,9 +1,11 @@
 #include <userver/dynamic_config/client/client.hpp>
 
 #include <userver/clients/http/client.hpp>
+#include <userver/compression/zstd.hpp>
 #include <userver/formats/json/serialize.hpp>
 #include <userver/formats/json/string_builder.hpp>
 #include <userver/formats/json/value_builder.hpp>
+#include <userver/http/common_headers.hpp>
 #include <userver/logging/log.hpp>
 #include <userver/utils/algo.hpp>
 
@@ -12,6 +14,8 @@ USERVER_NAMESPACE_BEGIN
 namespace dynamic_config {
 namespace {
 constexpr std::string_view kConfigsValues = "/configs/values";
+constexpr std::string_view kZstd = "zstd";
+constexpr std::size_t kMaxDecompressedSize = 256 * 1024 * 1024;
 }  // namespace
 
 Client::Client(clients::http::Client& http_client, const ClientConfig& config)
@@ -19,8 +23,13 @@ Client::Client(clients::http::Client& http_client, const ClientConfig& config)
 
 Client::~Client() = default;
 
-std::string Client::FetchConfigsValues(std::string_view body) {
-  const auto timeout_ms = config_.timeout.count();
+std::string Client::FetchConfigsValues(std::string_view body,
+                                       bool is_long_poll) {
+  // The server holds a long poll request for up to long_poll_timeout
+  const auto timeout_ms =
+      (is_long_poll ? config_.timeout + config_.long_poll_timeout
+                    : config_.timeout)
+          .count();
   const auto retries = config_.retries;
   const auto url = config_.append_path_to_url
                        ? utils::StrCat(config_.config_url, kConfigsValues)
@@ -30,16 +39,35 @@ std::string Client::FetchConfigsValues(std::string_view body) {
   // of proxy runtime config.
   const auto proxy = http_client_.GetProxy();
 
+  clients::http::Headers headers;
+  if (config_.zstd_compression) {
+    headers.emplace(USERVER_NAMESPACE::http::headers::kAcceptEncoding, kZstd);
+  }
+  const auto decode_body =
+      [](clients::http::Response& response) -> std::string {
+    const auto& response_headers = response.headers();
+    const auto it = response_headers.find(
+        USERVER_NAMESPACE::http::headers::kContentEncoding);
+    if (it == response_headers.end()) return std::move(response).body();
+    if (it->second != kZstd) {
+      throw std::runtime_error("Unexpected Content-Encoding of configs: " +
+                               it->second);
+    }
+    return compression::zstd::Decompress(response.body_view(),
+                                         kMaxDecompressedSize);
+  };
+
   std::exception_ptr exception;
   try {
     auto reply = http_client_.CreateRequest()
                      .post(url, std::string{body})
+                     .headers(headers)
                      .timeout(timeout_ms)
                      .retry(retries)
                      .proxy(proxy)
                      .perform();
     reply->raise_for_status();
-    return std::move(*reply).body();
+    return decode_body(*reply);
   } catch (const clients::http::BaseException& /*e*/) {
     if (!config_.fallback_to_no_proxy || proxy.empty()) {
       throw;
@@ -51,13 +79,14 @@ std::string Client::FetchConfigsValues(std::string_view body) {
     auto no_proxy_reply = http_client_.CreateRequest()
                               .proxy({})
                               .post(url, std::string{body})
+                              .headers(headers)
                               .timeout(timeout_ms)
                               .retry(retries)
                               .perform();
 
     if (no_proxy_reply->IsOk()) {
       LOG_WARNING() << "Using non proxy response in config client";
-      return std::move(*no_proxy_reply).body();
+      return decode_body(*no_proxy_reply);
     }
   } catch (const clients::http::BaseException& e) {
     LOG_WARNING() << "Non proxy request in config client failed: " << e;
@@ -98,6 +127,10 @@ Client::JsonReply Client::FetchJson(
 formats::json::Value Client::FetchConfigs(
     const std::optional<Timestamp>& last_update,
     const std::vector<std::string>& fields_to_load) {
+  // Only the incremental requests may wait for the changes, the full ones
+  // must return the current configs right away
+  const bool is_long_poll =
+      last_update.has_value() && config_.long_poll_timeout.count() > 0;
   formats::json::StringBuilder body;
 
   {
@@ -112,6 +145,11 @@ formats::json::Value Client::FetchConfigs(
       WriteToStream(*last_update, body);
     }
 
+    if (is_long_poll) {
+      body.Key("wait_timeout_ms");
+      WriteToStream(config_.long_poll_timeout.count(), body);
+    }
+
     if (!config_.stage_name.empty()) {
       body.Key("stage_name");
       WriteToStream(config_.stage_name, body);
@@ -124,7 +162,7 @@ formats::json::Value Client::FetchConfigs(
   }
 
   LOG_TRACE() << "request body: " << body.GetStringView();
-  auto json = FetchConfigsValues(body.GetStringView());
+  auto json = FetchConfigsValues(body.GetStringView(), is_long_poll);
 
   return formats::json::FromString(json);
 }
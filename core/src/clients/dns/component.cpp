@@ -31,14 +31,20 @@ ResolverConfig ParseResolverConfig(
           config.network_custom_servers);
   config.cache_ways =
       component_config["cache-ways"].As<size_t>(config.cache_ways);
-  config.cache_size_per_way = component_config["cache_size_per_way"].As<size_t>(
+  config.cache_size_per_way = component_config["cache-size-per-way"].As<size_t>(
       config.cache_size_per_way);
   config.cache_max_reply_ttl =
-      component_config["cache_max_reply_ttl"].As<std::chrono::milliseconds>(
+      component_config["cache-max-reply-ttl"].As<std::chrono::milliseconds>(
           config.cache_max_reply_ttl);
   config.cache_failure_ttl =
-      component_config["cache_failure_ttl"].As<std::chrono::milliseconds>(
+      component_config["cache-failure-ttl"].As<std::chrono::milliseconds>(
           config.cache_failure_ttl);
+  config.cache_refresh_ahead =
+      component_config["cache-refresh-ahead"].As<std::chrono::milliseconds>(
+          config.cache_refresh_ahead);
+  config.cache_max_stale_time =
+      component_config["cache-max-stale-time"]
+          .As<std::optional<std::chrono::milliseconds>>();
   return config;
 }
 
@@ -119,6 +125,14 @@ properties:
         type: string
         description: TTL for network failures caching
         defaultDescription: 5s
+    cache-refresh-ahead:
+        type: string
+        description: used network cache entries are refreshed in background this long before they expire, never less than network-timeout
+        defaultDescription: 10s
+    cache-max-stale-time:
+        type: string
+        description: for how long an expired network cache entry may be served while it is being refreshed, e.g. during upstream DNS failures
+        defaultDescription: unlimited
 )");
 }
 
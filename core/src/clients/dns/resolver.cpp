@@ -3,7 +3,9 @@
 #include <arpa/inet.h>
 #include <netinet/in.h>
 #include <cctype>
+#include <algorithm>
 #include <chrono>
+#include <optional>
 #include <string_view>
 
 #include <clients/dns/file_resolver.hpp>
@@ -178,6 +180,7 @@ class Resolver::Impl {
   const std::chrono::milliseconds net_cache_update_margin_;
   const std::chrono::milliseconds net_cache_max_reply_ttl_;
   const std::chrono::milliseconds net_cache_failure_ttl_;
+  const std::optional<std::chrono::milliseconds> net_cache_max_stale_time_;
   cache::NWayLRU<std::string, NetCacheEntry> net_cache_;
   concurrent::MutexSet<std::string> net_cache_update_mutexes_;
   utils::impl::WaitTokenStorage wait_token_storage_;
@@ -189,9 +192,11 @@ Resolver::Impl::Impl(engine::TaskProcessor& fs_task_processor,
                      config.file_update_interval},
       net_resolver_{fs_task_processor, config.network_timeout,
                     config.network_attempts, config.network_custom_servers},
-      net_cache_update_margin_{config.network_timeout},
+      net_cache_update_margin_{
+          std::max(config.network_timeout, config.cache_refresh_ahead)},
       net_cache_max_reply_ttl_{config.cache_max_reply_ttl},
       net_cache_failure_ttl_{config.cache_failure_ttl},
+      net_cache_max_stale_time_{config.cache_max_stale_time},
       net_cache_{config.cache_ways, config.cache_size_per_way},
       net_cache_update_mutexes_(config.cache_ways) {}
 
@@ -234,6 +239,12 @@ Resolver::Impl::NetCacheResult Resolver::Impl::QueryNetCache(
     return result;
   }
 
+  if (net_cache_max_stale_time_ &&
+      cached->expiration + *net_cache_max_stale_time_ < now) {
+    // too stale to be served, has to be resolved in foreground
+    return result;
+  }
+
   result.addrs = cached->addrs;
   if (cached->expiration >= now) {
     ++source_counters_.cached;
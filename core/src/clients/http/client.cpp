@@ -3,6 +3,7 @@
 #include <chrono>
 #include <cstdlib>
 #include <limits>
+#include <vector>
 
 #include <moodycamel/concurrentqueue.h>
 
@@ -20,6 +21,7 @@
 #include <crypto/openssl.hpp>
 #include <curl-ev/multi.hpp>
 #include <curl-ev/ratelimit.hpp>
+#include <curl-ev/share.hpp>
 #include <engine/ev/thread_pool.hpp>
 #include <server/http/headers_propagator.hpp>
 
@@ -30,6 +32,7 @@ namespace {
 
 const std::string kIoThreadName = "curl";
 const auto kEasyReinitPeriod = std::chrono::minutes{1};
+const auto kWarmUpTimeout = std::chrono::seconds{5};
 
 // cURL accepts options as long, but we use size_t to avoid writing checks.
 // Clamp too high values to LONG_MAX, it shouldn't matter for these magnitudes.
@@ -54,6 +57,7 @@ Client::Client(ClientSettings settings,
       statistics_(settings.io_threads),
       fs_task_processor_(fs_task_processor),
       user_agent_(utils::GetUserverIdentifier()),
+      ssl_share_(std::make_shared<curl::share>()),
       connect_rate_limiter_(std::make_shared<curl::ConnectRateLimiter>()),
       tracing_manager_(GetTracingManager(settings)),
       headers_propagator_(settings.headers_propagator),
@@ -70,6 +74,7 @@ Client::Client(ClientSettings settings,
   thread_pool_ = std::make_unique<engine::ev::ThreadPool>(std::move(ev_config));
 
   ReinitEasy();
+  ssl_share_->set_share_ssl_session(true);
 
   multis_.reserve(io_threads);
 
@@ -88,9 +93,32 @@ Client::Client(ClientSettings settings,
                           [this] { ReinitEasy(); });
 
   SetConfig({});
+
+  if (settings.http2_multiplexing) {
+    SetMultiplexingEnabled(true);
+    for (auto& multi : multis_) {
+      multi->SetMaxConcurrentStreams(
+          ClampToLong(settings.http2_max_concurrent_streams));
+    }
+  }
+  if (settings.max_host_connections > 0) {
+    SetMaxHostConnections(settings.max_host_connections);
+  }
+
+  if (!settings.warmup_urls.empty()) {
+    warmup_task_.Start(
+        "http_warmup",
+        utils::PeriodicTask::Settings(settings.warmup_interval,
+                                      utils::PeriodicTask::Flags::kNow),
+        [this, urls = std::move(settings.warmup_urls),
+         connections = settings.warmup_connections] {
+          WarmUp(urls, connections);
+        });
+  }
 }
 
 Client::~Client() {
+  warmup_task_.Stop();
   easy_reinit_task_.Stop();
 
   // We have to destroy *this only when all the requests are finished, because
@@ -115,37 +143,68 @@ Client::~Client() {
 }
 
 Request Client::CreateRequest() {
-  auto request = [this] {
-    auto easy = TryDequeueIdle();
-    if (easy) {
-      auto idx = FindMultiIndex(easy->GetMulti());
-      auto wrapper = impl::EasyWrapper{std::move(easy), *this};
-      return Request{
-          std::move(wrapper),      statistics_[idx].CreateRequestStats(),
-          destination_statistics_, resolver_,
-          plugin_pipeline_,        *tracing_manager_.GetBase()};
-    } else {
-      auto i = utils::RandRange(multis_.size());
-      auto& multi = multis_[i];
-
-      try {
-        auto wrapper = engine::AsyncNoSpan(fs_task_processor_, [this, &multi] {
-                         return impl::EasyWrapper{
-                             easy_.Get()->GetBoundBlocking(*multi), *this};
-                       }).Get();
-        return Request{
-            std::move(wrapper),      statistics_[i].CreateRequestStats(),
-            destination_statistics_, resolver_,
-            plugin_pipeline_,        *tracing_manager_.GetBase()};
-      } catch (engine::WaitInterruptedException&) {
-        throw clients::http::CancelException("wait interrupted", {},
-                                             ErrorKind::kCancel);
-      } catch (engine::TaskCancelledException&) {
-        throw clients::http::CancelException("task cancelled", {},
-                                             ErrorKind::kCancel);
+  auto easy = TryDequeueIdle();
+  if (!easy) return CreateRequestOnMulti(utils::RandRange(multis_.size()));
+
+  const auto idx = FindMultiIndex(easy->GetMulti());
+  return SetupRequest(impl::EasyWrapper{std::move(easy), *this}, idx);
+}
+
+void Client::WarmUp(const std::vector<std::string>& urls,
+                    std::size_t connections) {
+  // Every IO thread has its own connection cache, so each of them gets its
+  // own connections. Concurrent requests on the same thread make curl open
+  // separate connections, unless they are multiplexed over HTTP/2.
+  std::vector<ResponseFuture> futures;
+  futures.reserve(multis_.size() * urls.size() * connections);
+  for (std::size_t idx = 0; idx < multis_.size(); ++idx) {
+    for (const auto& url : urls) {
+      for (std::size_t i = 0; i < connections; ++i) {
+        futures.push_back(CreateRequestOnMulti(idx)
+                              .head(url)
+                              .timeout(kWarmUpTimeout)
+                              .async_perform());
       }
     }
-  }();
+  }
+
+  for (auto& future : futures) {
+    try {
+      future.Get();
+    } catch (const std::exception& ex) {
+      LOG_LIMITED_WARNING() << "Failed to warm up a connection: " << ex;
+    }
+  }
+}
+
+Request Client::CreateRequestOnMulti(std::size_t multi_index) {
+  auto& multi = multis_[multi_index];
+  try {
+    auto wrapper = engine::AsyncNoSpan(fs_task_processor_, [this, &multi] {
+                     return impl::EasyWrapper{
+                         easy_.Get()->GetBoundBlocking(*multi), *this};
+                   }).Get();
+    return SetupRequest(std::move(wrapper), multi_index);
+  } catch (engine::WaitInterruptedException&) {
+    throw clients::http::CancelException("wait interrupted", {},
+                                         ErrorKind::kCancel);
+  } catch (engine::TaskCancelledException&) {
+    throw clients::http::CancelException("task cancelled", {},
+                                         ErrorKind::kCancel);
+  }
+}
+
+Request Client::SetupRequest(impl::EasyWrapper&& wrapper,
+                             std::size_t multi_index) {
+  // TLS sessions are resumed across connections and IO threads
+  wrapper.Easy().set_share(ssl_share_);
+
+  Request request{std::move(wrapper),
+                  statistics_[multi_index].CreateRequestStats(),
+                  destination_statistics_,
+                  resolver_,
+                  plugin_pipeline_,
+                  *tracing_manager_.GetBase()};
 
   if (testsuite_config_) {
     request.SetTestsuiteConfig(testsuite_config_);
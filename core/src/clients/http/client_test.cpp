@@ -679,6 +679,82 @@ UTEST(HttpClient, CancelPost) {
   task.Get();
 }
 
+UTEST(HttpClient, WarmUp) {
+  std::atomic<std::size_t> server_requests{0};
+  const utest::SimpleServer http_server{
+      [&server_requests](const HttpRequest& request) {
+        LOG_INFO() << "HTTP Server receive: " << request;
+        ++server_requests;
+        return HttpResponse{"HTTP/1.1 200 OK\r\nContent-Length: 0\r\n\r\n",
+                            HttpResponse::kWriteAndContinue};
+      }};
+  auto http_client_ptr = utest::CreateHttpClient();
+
+  http_client_ptr->WarmUp({http_server.GetBaseUrl()});
+  EXPECT_GT(server_requests.load(), 0);
+
+  // Every IO thread has a warm connection
+  const auto response = http_client_ptr->CreateRequest()
+                            .get(http_server.GetBaseUrl())
+                            .timeout(kTimeout)
+                            .perform();
+  EXPECT_EQ(response->status_code(), 200);
+  EXPECT_EQ(response->GetStats().open_socket_count, 0);
+}
+
+UTEST(HttpClient, StreamedBody) {
+  const utest::SimpleServer http_server{
+      [](const HttpRequest& request) -> HttpResponse {
+        LOG_INFO() << "HTTP Server receive: " << request;
+        // The body is sent with chunked transfer encoding
+        if (request.find("\r\n0\r\n\r\n") == std::string::npos) {
+          return {{}, HttpResponse::kTryReadMore};
+        }
+        const bool has_body = request.find("first") != std::string::npos &&
+                              request.find("second") != std::string::npos;
+        return {has_body ? "HTTP/1.1 200 OK\r\nContent-Length: 0\r\n\r\n"
+                         : "HTTP/1.1 400 Bad Request\r\nContent-Length: "
+                           "0\r\n\r\n",
+                HttpResponse::kWriteAndClose};
+      }};
+  auto http_client_ptr = utest::CreateHttpClient();
+
+  /// [Sample HTTP Client streamed body]
+  auto request = http_client_ptr->CreateRequest()
+                     .post()
+                     .url(http_server.GetBaseUrl())
+                     .timeout(kTimeout);
+  auto writer = request.stream_body();
+  auto future = request.async_perform();
+
+  EXPECT_TRUE(writer.Write("first"));
+  EXPECT_TRUE(writer.Write("second"));
+  writer.Finish();
+
+  const auto response = future.Get();
+  /// [Sample HTTP Client streamed body]
+  EXPECT_EQ(response->status_code(), 200);
+}
+
+UTEST(HttpClient, ResponseBodyBuffer) {
+  const utest::SimpleServer http_server{EchoCallback{}};
+  auto http_client_ptr = utest::CreateHttpClient();
+
+  std::string buffer;
+  buffer.reserve(4096);
+  const auto* const buffer_data = buffer.data();
+
+  auto response = http_client_ptr->CreateRequest()
+                      .post(http_server.GetBaseUrl(), kTestData)
+                      .response_body_buffer(std::move(buffer))
+                      .timeout(kTimeout)
+                      .perform();
+  EXPECT_EQ(response->body_view(), kTestData);
+
+  buffer = std::move(*response).body();
+  EXPECT_EQ(buffer.data(), buffer_data);
+}
+
 UTEST(HttpClient, CancelRetries) {
   using std::chrono::duration_cast;
   using std::chrono::milliseconds;
@@ -200,13 +200,49 @@ properties:
         description: set OS thread name to this value
         defaultDescription: ''
     threads:
-        type: integer
-        description: number of threads to process low level HTTP related IO system calls
+        type: string
+        description: |
+            number of threads to process low level HTTP related IO system calls,
+            or `auto` to use threads-cpu-ratio of the CPU limit
         defaultDescription: 8
+    threads-cpu-ratio:
+        type: number
+        description: threads count to CPU limit ratio for `threads: auto`
+        defaultDescription: 1.0
     defer-events:
         type: boolean
         description: whether to defer events execution to a periodic timer; might affect timings a bit, might boost performance, use with care
         defaultDescription: false
+    http2-multiplexing:
+        type: boolean
+        description: make concurrent HTTP/2 requests to the same host wait for and share a multiplexed connection instead of opening new ones
+        defaultDescription: false
+    http2-max-concurrent-streams:
+        type: integer
+        description: max number of concurrent streams on a single multiplexed HTTP/2 connection
+        defaultDescription: 100
+        minimum: 1
+    max-host-connections:
+        type: integer
+        description: max number of connections to a single host per IO thread, 0 for no limit
+        defaultDescription: 0
+        minimum: 0
+    warmup-urls:
+        type: array
+        description: connections to these URLs are opened at startup and kept warm by periodic HEAD requests
+        defaultDescription: '[]'
+        items:
+            type: string
+            description: URL to warm up connections to
+    warmup-connections:
+        type: integer
+        description: number of warm connections to each of warmup-urls per IO thread
+        defaultDescription: 1
+        minimum: 1
+    warmup-interval:
+        type: string
+        description: how often the warm connections are probed and reopened if needed
+        defaultDescription: 30s
     fs-task-processor:
         type: string
         description: task processor to run blocking HTTP related calls, like DNS resolving or hosts reading
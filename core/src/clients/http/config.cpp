@@ -5,6 +5,7 @@
 #include <userver/dynamic_config/value.hpp>
 #include <userver/formats/json/value.hpp>
 #include <userver/yaml_config/yaml_config.hpp>
+#include <utils/threads_count.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
@@ -52,9 +53,25 @@ ClientSettings Parse(const yaml_config::YamlConfig& value,
   ClientSettings result;
   result.thread_name_prefix =
       value["thread-name-prefix"].As<std::string>(result.thread_name_prefix);
-  result.io_threads = value["threads"].As<size_t>(result.io_threads);
+  result.io_threads = utils::ParseThreadsCount(
+      value["threads"], value["threads-cpu-ratio"].As<double>(1.0),
+      result.io_threads);
   result.defer_events = value["defer-events"].As<bool>(result.defer_events);
   result.deadline_propagation = ParseDeadlinePropagationConfig(value);
+  result.http2_multiplexing =
+      value["http2-multiplexing"].As<bool>(result.http2_multiplexing);
+  result.http2_max_concurrent_streams =
+      value["http2-max-concurrent-streams"].As<std::size_t>(
+          result.http2_max_concurrent_streams);
+  result.max_host_connections = value["max-host-connections"].As<std::size_t>(
+      result.max_host_connections);
+  result.warmup_urls =
+      value["warmup-urls"].As<std::vector<std::string>>(result.warmup_urls);
+  result.warmup_connections = value["warmup-connections"].As<std::size_t>(
+      result.warmup_connections);
+  result.warmup_interval =
+      value["warmup-interval"].As<std::chrono::milliseconds>(
+          result.warmup_interval);
   return result;
 }
 
@@ -59,6 +59,8 @@ UTEST(DestinationStatistics, Ok) {
         EXPECT_EQ(utils::statistics::Rate{0}, stats.error_count[i]);
       }
     }
+    // The first request to a destination always opens a new connection
+    EXPECT_EQ(utils::statistics::Rate{0}, stats.multi.socket_reused);
   }
 }
 
@@ -239,6 +239,13 @@ StreamedResponse Request::async_perform_stream_body(
                           queue->GetConsumer(), pimpl_);
 }
 
+RequestBodyWriter Request::stream_body(std::size_t max_buffered_bytes) {
+  auto upload = std::make_shared<impl::UploadState>(max_buffered_bytes,
+                                                    pimpl_->weak_from_this());
+  pimpl_->SetUpload(upload);
+  return RequestBodyWriter{std::move(upload)};
+}
+
 std::shared_ptr<Response> Request::perform(
     utils::impl::SourceLocation location) {
   return async_perform(location).Get();
@@ -377,6 +384,14 @@ Request Request::data(std::string data) && {
   return std::move(this->data(std::move(data)));
 }
 
+Request& Request::response_body_buffer(std::string buffer) & {
+  pimpl_->SetResponseBodyBuffer(std::move(buffer));
+  return *this;
+}
+Request Request::response_body_buffer(std::string buffer) && {
+  return std::move(this->response_body_buffer(std::move(buffer)));
+}
+
 Request& Request::form(Form&& form) & {
   pimpl_->easy().set_http_post(std::move(form).GetNative());
   pimpl_->easy().add_header(kHeaderExpect, "",
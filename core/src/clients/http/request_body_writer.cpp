@@ -0,0 +1,38 @@
+#include <userver/clients/http/request_body_writer.hpp>
+
+#include <userver/utils/assert.hpp>
+
+#include <clients/http/upload_state.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace clients::http {
+
+RequestBodyWriter::RequestBodyWriter(std::shared_ptr<impl::UploadState> state)
+    : state_(std::move(state)) {}
+
+RequestBodyWriter::RequestBodyWriter(RequestBodyWriter&&) noexcept = default;
+
+RequestBodyWriter& RequestBodyWriter::operator=(
+    RequestBodyWriter&& other) noexcept {
+  if (this != &other) {
+    Finish();
+    state_ = std::move(other.state_);
+  }
+  return *this;
+}
+
+RequestBodyWriter::~RequestBodyWriter() { Finish(); }
+
+bool RequestBodyWriter::Write(std::string chunk, engine::Deadline deadline) {
+  UASSERT(state_);
+  return state_->Write(std::move(chunk), deadline);
+}
+
+void RequestBodyWriter::Finish() {
+  if (state_) state_->Finish();
+}
+
+}  // namespace clients::http
+
+USERVER_NAMESPACE_END
@@ -1,9 +1,11 @@
 #include <clients/http/request_state.hpp>
 
 #include <algorithm>
+#include <charconv>
 #include <chrono>
 #include <map>
 #include <string_view>
+#include <utility>
 
 #include <cryptopp/osrng.h>
 #include <fmt/chrono.h>
@@ -56,6 +58,9 @@ constexpr Status kFakeHttpErrorCode{599};
 
 const std::string kTracingClientName = "external";
 
+/// Max body size to reserve from Content-Length, larger bodies grow as usual
+constexpr std::size_t kMaxBodyReserve = 16 * 1024 * 1024;
+
 const std::map<std::string, std::error_code> kTestsuiteActions = {
     {"timeout", {curl::errc::EasyErrorCode::kOperationTimedout}},
     {"network", {curl::errc::EasyErrorCode::kCouldNotConnect}}};
@@ -93,6 +98,11 @@ bool IsSetCookie(std::string_view key) {
   return equal(key, USERVER_NAMESPACE::http::headers::kSetCookie);
 }
 
+bool IsContentLength(std::string_view key) {
+  const utils::StrIcaseEqual equal;
+  return equal(key, USERVER_NAMESPACE::http::headers::kContentLength);
+}
+
 // Not a strict check, but OK for non-header line check
 bool IsHttpStatusLineStart(const char* ptr, size_t size) {
   return (size > 5 && memcmp(ptr, "HTTP/", 5) == 0);
@@ -405,6 +415,34 @@ void RequestState::DisableReplyDecoding() {
   easy().set_accept_encoding(nullptr);
 }
 
+void RequestState::SetUpload(std::shared_ptr<impl::UploadState> upload) {
+  upload_ = std::move(upload);
+  // Upload mode takes the body from the read function even if post data is
+  // set, the method is still taken from the custom request. Unknown size
+  // makes curl use chunked transfer encoding for HTTP/1.1.
+  easy().set_upload(true);
+  easy().set_in_file_size_large(-1);
+  easy().set_read_function(&impl::UploadState::ReadFunction);
+  easy().set_read_data(upload_.get());
+  easy().add_header(USERVER_NAMESPACE::http::headers::kExpect, "",
+                    curl::easy::EmptyHeaderAction::kDoNotSend,
+                    curl::easy::DuplicateHeaderAction::kReplace);
+}
+
+void RequestState::ResumeUpload() {
+  easy().GetThreadControl().RunInEvLoopAsync(
+      [holder = shared_from_this()] {
+        std::error_code ec;
+        holder->easy().unpause(ec);
+        if (ec) LOG_WARNING() << "Failed to resume the upload: " << ec.message();
+      });
+}
+
+void RequestState::SetResponseBodyBuffer(std::string&& buffer) {
+  buffer.clear();
+  response_body_buffer_ = std::move(buffer);
+}
+
 void RequestState::SetCancellationPolicy(CancellationPolicy cp) {
   cancellation_policy_ = cp;
 }
@@ -476,6 +514,7 @@ void RequestState::on_completed(std::shared_ptr<RequestState> holder,
     stream_data->headers_promise.set_value();
     LOG_DEBUG() << "Stream API, status code is set (with body)";
   }
+  if (holder->upload_) holder->upload_->Close();
 
   const auto status_code = static_cast<Status>(easy.get_response_code());
 
@@ -665,11 +704,25 @@ void RequestState::parse_header(char* ptr, size_t size) try {
   }
 
   std::string value(col_pos, end - col_pos);
+  if (IsContentLength(key)) ReserveBody(value);
   response_->headers().emplace(std::move(key), std::move(value));
 } catch (const std::exception& e) {
   LOG_ERROR() << "Failed to parse header: " << e.what();
 }
 
+void RequestState::ReserveBody(std::string_view content_length) {
+  // Streamed responses do not use the sink
+  if (!std::holds_alternative<FullBufferedData>(data_)) return;
+
+  std::size_t size = 0;
+  const auto* const end = content_length.data() + content_length.size();
+  const auto [ptr, ec] = std::from_chars(content_length.data(), end, size);
+  if (ec != std::errc{} || ptr != end) return;
+
+  // The body may be compressed, then it grows beyond the reserved size
+  response_->sink_string().reserve(std::min(size, kMaxBodyReserve));
+}
+
 void RequestState::SetLoggedUrl(std::string url) { log_url_ = std::move(url); }
 
 const std::string& RequestState::GetLoggedOriginalUrl() const noexcept {
@@ -828,6 +881,8 @@ void RequestState::HandleDeadlineAlreadyPassed() {
 
   auto exc = PrepareDeadlinePassedException(GetLoggedOriginalUrl(),
                                             easy().get_local_stats());
+  // The request is not performed, so the ev thread does not use the upload
+  if (upload_) upload_->Close();
 
   const utils::Overloaded visitor{
       [&exc](FullBufferedData& buffered_data) {
@@ -935,9 +990,14 @@ void RequestState::ResetDataForNewRequest() {
 
   response_ = std::make_shared<Response>();
   response_->SetStatusCode(Status::InternalServerError);
+  if (response_body_buffer_.capacity() > 0) {
+    response_->sink_string() = std::exchange(response_body_buffer_, {});
+  }
 
   is_cancelled_ = false;
   retry_.current = 1;
+  // A streamed body can not be sent again
+  if (upload_) retry_.retries = 1;
   remote_timeout_ = original_timeout_;
   deadline_ = server::request::GetTaskInheritedDeadline();
   deadline_expired_ = false;
@@ -30,6 +30,7 @@
 #include <clients/http/destination_statistics.hpp>
 #include <clients/http/easy_wrapper.hpp>
 #include <clients/http/testsuite.hpp>
+#include <clients/http/upload_state.hpp>
 #include <crypto/helpers.hpp>
 #include <engine/ev/watcher/timer_watcher.hpp>
 #include <server/http/headers_propagator.hpp>
@@ -117,6 +118,14 @@ class RequestState : public std::enable_shared_from_this<RequestState> {
 
   void DisableReplyDecoding();
 
+  /// set the buffer to store the response body into
+  void SetResponseBodyBuffer(std::string&& buffer);
+
+  /// stream the request body from the upload state instead of post data
+  void SetUpload(std::shared_ptr<impl::UploadState> upload);
+  /// continue sending the streamed body after curl was paused for it
+  void ResumeUpload();
+
   void SetCancellationPolicy(CancellationPolicy cp);
 
   CancellationPolicy GetCancellationPolicy() const;
@@ -152,6 +161,7 @@ class RequestState : public std::enable_shared_from_this<RequestState> {
   /// parse one header
   void parse_header(char* ptr, size_t size);
   void ParseSingleCookie(const char* ptr, size_t size);
+  void ReserveBody(std::string_view content_length);
   /// simply run perform_request if there is now errors from timer
   void on_retry_timer(std::error_code err);
   /// run curl async_request, called once per attempt
@@ -202,6 +212,8 @@ class RequestState : public std::enable_shared_from_this<RequestState> {
 
   /// response
   std::shared_ptr<Response> response_;
+  /// buffer for the body of the next response
+  std::string response_body_buffer_;
 
   /// the timeout value provided by user (or the default)
   std::chrono::milliseconds original_timeout_;
@@ -252,6 +264,8 @@ class RequestState : public std::enable_shared_from_this<RequestState> {
   };
 
   std::variant<FullBufferedData, StreamData> data_;
+
+  std::shared_ptr<impl::UploadState> upload_;
 };
 
 }  // namespace clients::http
@@ -75,6 +75,7 @@ void RequestStats::StoreTimeToStart(
 void RequestStats::AccountOpenSockets(size_t sockets) noexcept {
   UASSERT(stats_);
   stats_->socket_open_ += utils::statistics::Rate{sockets};
+  if (sockets == 0) ++stats_->socket_reused_;
 }
 
 void RequestStats::AccountTimeoutUpdatedByDeadline() noexcept {
@@ -178,6 +179,8 @@ void DumpMetric(utils::statistics::Writer& writer,
   writer["cancelled-by-deadline"] = stats.cancelled_by_deadline;
 
   writer["sockets"]["open"] = stats.multi.socket_open;
+  // The number of requests per connection is (open + reused) / open
+  writer["sockets"]["reused"] = stats.multi.socket_reused;
 }
 
 void DumpMetric(utils::statistics::Writer& writer,
@@ -220,6 +223,7 @@ InstanceStatistics::InstanceStatistics(const Statistics& other)
   for (size_t i = 0; i < error_count.size(); i++)
     error_count[i] = other.error_count_[i].Load();
   multi.socket_open = other.socket_open_.Load();
+  multi.socket_reused = other.socket_reused_.Load();
 }
 
 uint64_t InstanceStatistics::GetNotOkErrorCount() const {
@@ -52,12 +52,15 @@ struct MultiStats {
   utils::statistics::Rate socket_open;
   utils::statistics::Rate socket_close;
   utils::statistics::Rate socket_ratelimit;
+  // Requests served over an already open (possibly multiplexed) connection
+  utils::statistics::Rate socket_reused;
   double current_load{0};
 
   MultiStats& operator+=(const MultiStats& other) {
     socket_open += other.socket_open;
     socket_close += other.socket_close;
     socket_ratelimit += other.socket_ratelimit;
+    socket_reused += other.socket_reused;
     current_load += other.current_load;
     return *this;
   }
@@ -105,6 +108,7 @@ class Statistics {
   std::array<utils::statistics::RateCounter, kErrorGroupCount> error_count_;
   utils::statistics::RateCounter retries_;
   utils::statistics::RateCounter socket_open_{0};
+  utils::statistics::RateCounter socket_reused_{0};
   utils::statistics::RateCounter timeout_updated_by_deadline_;
   utils::statistics::RateCounter cancelled_by_deadline_;
   utils::statistics::HttpCodes reply_status_;
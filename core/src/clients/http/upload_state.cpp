@@ -0,0 +1,101 @@
+#include <clients/http/upload_state.hpp>
+
+#include <algorithm>
+#include <cstring>
+
+#include <userver/utils/assert.hpp>
+
+#include <clients/http/request_state.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace clients::http::impl {
+
+UploadState::UploadState(std::size_t max_buffered_bytes,
+                         std::weak_ptr<RequestState> request_state)
+    : max_buffered_bytes_(max_buffered_bytes),
+      request_state_(std::move(request_state)),
+      queue_(Queue::Create(max_buffered_bytes)),
+      producer_(queue_->GetProducer()),
+      consumer_(queue_->GetConsumer()) {
+  UINVARIANT(max_buffered_bytes_ > 0, "Upload buffer size must be positive");
+}
+
+bool UploadState::Write(std::string&& chunk, engine::Deadline deadline) {
+  UINVARIANT(producer_, "Write() after Finish()");
+  // An empty chunk would be taken by curl for the end of the body
+  if (chunk.empty()) return true;
+
+  // A chunk bigger than the queue capacity would never fit into it
+  std::size_t offset = 0;
+  while (offset < chunk.size()) {
+    const auto size = std::min(max_buffered_bytes_, chunk.size() - offset);
+    auto piece = (offset == 0 && size == chunk.size())
+                     ? std::move(chunk)
+                     : chunk.substr(offset, size);
+    if (!producer_->Push(std::move(piece), deadline)) return false;
+    offset += size;
+    ResumeIfPaused();
+  }
+  return true;
+}
+
+void UploadState::Finish() {
+  if (!producer_) return;
+  producer_.reset();
+  ResumeIfPaused();
+}
+
+std::size_t UploadState::ReadFunction(char* ptr, std::size_t size,
+                                      std::size_t nmemb,
+                                      void* userdata) noexcept {
+  return static_cast<UploadState*>(userdata)->Read(ptr, size * nmemb);
+}
+
+void UploadState::Close() noexcept { consumer_.reset(); }
+
+std::size_t UploadState::Read(char* ptr, std::size_t max_size) noexcept {
+  if (!consumer_) return CURL_READFUNC_ABORT;
+
+  if (chunk_offset_ == chunk_.size()) {
+    // Checked before popping, so that the chunks written right before
+    // Finish() are not lost
+    bool finished = consumer_->Queue()->NoMoreProducers();
+    if (!PopChunk()) {
+      if (finished) return 0;
+
+      // The writer checks the flag after pushing a chunk or finishing,
+      // so one of us sees the other's update
+      paused_ = true;
+      finished = consumer_->Queue()->NoMoreProducers();
+      if (!PopChunk()) {
+        if (!finished) return CURL_READFUNC_PAUSE;
+        paused_ = false;
+        return 0;
+      }
+      paused_ = false;
+    }
+  }
+
+  const auto size = std::min(max_size, chunk_.size() - chunk_offset_);
+  std::memcpy(ptr, chunk_.data() + chunk_offset_, size);
+  chunk_offset_ += size;
+  return size;
+}
+
+bool UploadState::PopChunk() noexcept {
+  chunk_.clear();
+  chunk_offset_ = 0;
+  return consumer_->PopNoblock(chunk_);
+}
+
+void UploadState::ResumeIfPaused() {
+  if (!paused_.exchange(false)) return;
+  if (auto request_state = request_state_.lock()) {
+    request_state->ResumeUpload();
+  }
+}
+
+}  // namespace clients::http::impl
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,61 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <optional>
+#include <string>
+
+#include <userver/concurrent/queue.hpp>
+#include <userver/engine/deadline.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace clients::http {
+class RequestState;
+}  // namespace clients::http
+
+namespace clients::http::impl {
+
+/// Shared state of a streamed request body. The producer side is used by
+/// RequestBodyWriter from a coroutine, the consumer side is used by curl
+/// from the ev thread of the request.
+class UploadState final {
+ public:
+  using Queue = concurrent::StringStreamQueue;
+
+  UploadState(std::size_t max_buffered_bytes,
+              std::weak_ptr<RequestState> request_state);
+
+  bool Write(std::string&& chunk, engine::Deadline deadline);
+  void Finish();
+
+  /// curl read callback, `userdata` is the UploadState
+  static std::size_t ReadFunction(char* ptr, std::size_t size,
+                                  std::size_t nmemb, void* userdata) noexcept;
+
+  /// Called from the ev thread when the request finishes, unblocks the writer
+  void Close() noexcept;
+
+ private:
+  std::size_t Read(char* ptr, std::size_t max_size) noexcept;
+  bool PopChunk() noexcept;
+  void ResumeIfPaused();
+
+  const std::size_t max_buffered_bytes_;
+  const std::weak_ptr<RequestState> request_state_;
+  std::shared_ptr<Queue> queue_;
+  std::optional<Queue::Producer> producer_;
+
+  // Accessed from the ev thread only
+  std::optional<Queue::Consumer> consumer_;
+  std::string chunk_;
+  std::size_t chunk_offset_{0};
+
+  // Set when curl is paused waiting for the next chunk
+  std::atomic<bool> paused_{false};
+};
+
+}  // namespace clients::http::impl
+
+USERVER_NAMESPACE_END
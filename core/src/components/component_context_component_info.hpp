@@ -1,6 +1,7 @@
 #pragma once
 
 #include <atomic>
+#include <chrono>
 #include <memory>
 #include <set>
 #include <string>
@@ -27,6 +28,15 @@ class StageSwitchingCancelledException : public std::runtime_error {
   explicit StageSwitchingCancelledException(const std::string& message);
 };
 
+/// Timings of the component construction, written only by the task that
+/// constructs the component
+struct ComponentLoadTimings final {
+  std::chrono::steady_clock::time_point started_at;
+  std::chrono::steady_clock::time_point finished_at;
+  // Time spent in FindComponent() waiting for the dependencies to load
+  std::chrono::steady_clock::duration dependencies_wait_time{};
+};
+
 class ComponentInfo final {
  public:
   explicit ComponentInfo(std::string name);
@@ -97,6 +107,9 @@ class ComponentInfo final {
 
   std::string GetDependencies() const;
 
+  ComponentLoadTimings& GetLoadTimings() { return load_timings_; }
+  const ComponentLoadTimings& GetLoadTimings() const { return load_timings_; }
+
  private:
   bool HasComponent() const;
   std::unique_ptr<RawComponentBase> ExtractComponent();
@@ -111,6 +124,7 @@ class ComponentInfo final {
   ComponentLifetimeStage stage_ = ComponentLifetimeStage::kNull;
   bool stage_switching_cancelled_{false};
   std::atomic<bool> on_loading_cancelled_called_{false};
+  ComponentLoadTimings load_timings_;
 };
 
 }  // namespace components::impl
@@ -12,6 +12,7 @@
 #include <userver/tracing/tracer.hpp>
 #include <userver/utils/assert.hpp>
 #include <userver/utils/async.hpp>
+#include <userver/utils/fast_scope_guard.hpp>
 
 #include <components/component_context_component_info.hpp>
 #include <components/impl/component_name_from_info.hpp>
@@ -28,6 +29,20 @@ const std::string kClearComponentsRootName = "clear_components";
 
 const std::chrono::seconds kPrintAddingComponentsPeriod{10};
 
+constexpr std::size_t kLoadProfileSlowestComponents = 10;
+
+std::chrono::milliseconds ToMilliseconds(
+    std::chrono::steady_clock::duration duration) {
+  return std::chrono::duration_cast<std::chrono::milliseconds>(duration);
+}
+
+// Time of the component construction not spent waiting for the dependencies
+std::chrono::steady_clock::duration GetOwnLoadTime(
+    const ComponentLoadTimings& timings) {
+  return timings.finished_at - timings.started_at -
+         timings.dependencies_wait_time;
+}
+
 template <class Container>
 std::string JoinNamesFromInfo(const Container& container,
                               std::string_view separator) {
@@ -118,7 +133,10 @@ RawComponentBase* ComponentContextImpl::AddComponent(
     throw std::runtime_error("trying to add component " + std::string{name} +
                              " multiple times");
 
+  auto& load_timings = component_info.GetLoadTimings();
+  load_timings.started_at = std::chrono::steady_clock::now();
   component_info.SetComponent(factory(context));
+  load_timings.finished_at = std::chrono::steady_clock::now();
   auto* component = component_info.GetComponent();
   if (component) {
     // Call the following command on logs to get the component dependencies:
@@ -133,6 +151,7 @@ RawComponentBase* ComponentContextImpl::AddComponent(
 
 void ComponentContextImpl::OnAllComponentsLoaded() {
   StopPrintAddingComponentsTask();
+  LogLoadProfile();
   tracing::Span span(kOnAllComponentsLoadedRootName);
   return ProcessAllComponentLifetimeStageSwitchings(
       {impl::ComponentLifetimeStage::kRunning,
@@ -410,6 +429,12 @@ RawComponentBase* ComponentContextImpl::DoFindComponent(std::string_view name) {
   }
   SearchingComponentScope finder(*this, this_component_name);
 
+  auto& load_timings = components_.at(this_component_name).GetLoadTimings();
+  const auto wait_start = std::chrono::steady_clock::now();
+  const utils::FastScopeGuard account_wait_guard{[&]() noexcept {
+    load_timings.dependencies_wait_time +=
+        std::chrono::steady_clock::now() - wait_start;
+  }};
   return component_info.WaitAndGetComponent();
 }
 
@@ -544,6 +569,82 @@ void ComponentContextImpl::PrintAddingComponents() const {
              << JoinNamesFromInfo(adding_components, ", ") << ']';
 }
 
+void ComponentContextImpl::LogLoadProfile() const {
+  if (components_.empty()) return;
+
+  const auto load_started_at =
+      std::min_element(components_.begin(), components_.end(),
+                       [](const auto& lhs, const auto& rhs) {
+                         return lhs.second.GetLoadTimings().started_at <
+                                rhs.second.GetLoadTimings().started_at;
+                       })
+          ->second.GetLoadTimings()
+          .started_at;
+  const auto finished_later = [](const impl::ComponentInfo* lhs,
+                                 const impl::ComponentInfo* rhs) {
+    return lhs->GetLoadTimings().finished_at <
+           rhs->GetLoadTimings().finished_at;
+  };
+
+  // The critical path ends with the component that finished loading last and
+  // goes through the dependencies that finished last, as each of them delayed
+  // the construction of its dependent component the most
+  std::vector<const impl::ComponentInfo*> critical_path;
+  const impl::ComponentInfo* current = nullptr;
+  for (const auto& [name, info] : components_) {
+    if (!current || finished_later(current, &info)) current = &info;
+  }
+  while (current) {
+    critical_path.push_back(current);
+    const impl::ComponentInfo* latest_dependency = nullptr;
+    current->ForEachItDependsOn([&](impl::ComponentNameFromInfo dependency) {
+      const auto* dependency_info = &components_.at(dependency);
+      if (!latest_dependency ||
+          finished_later(latest_dependency, dependency_info)) {
+        latest_dependency = dependency_info;
+      }
+    });
+    current = latest_dependency;
+  }
+  std::reverse(critical_path.begin(), critical_path.end());
+
+  std::string critical_path_str;
+  for (const auto* info : critical_path) {
+    if (!critical_path_str.empty()) critical_path_str += " -> ";
+    critical_path_str +=
+        fmt::format("{} (own {}ms)", info->Name().StringViewName(),
+                    ToMilliseconds(GetOwnLoadTime(info->GetLoadTimings()))
+                        .count());
+  }
+  LOG_INFO() << "Components load critical path took "
+             << ToMilliseconds(
+                    critical_path.back()->GetLoadTimings().finished_at -
+                    load_started_at)
+                    .count()
+             << "ms: " << critical_path_str;
+
+  std::vector<const impl::ComponentInfo*> slowest;
+  slowest.reserve(components_.size());
+  for (const auto& [name, info] : components_) slowest.push_back(&info);
+  const auto slowest_end =
+      slowest.begin() +
+      std::min(slowest.size(), kLoadProfileSlowestComponents);
+  std::partial_sort(slowest.begin(), slowest_end, slowest.end(),
+                    [](const auto* lhs, const auto* rhs) {
+                      return GetOwnLoadTime(lhs->GetLoadTimings()) >
+                             GetOwnLoadTime(rhs->GetLoadTimings());
+                    });
+
+  std::string slowest_str;
+  for (auto it = slowest.begin(); it != slowest_end; ++it) {
+    if (!slowest_str.empty()) slowest_str += ", ";
+    slowest_str += fmt::format(
+        "{} ({}ms)", (*it)->Name().StringViewName(),
+        ToMilliseconds(GetOwnLoadTime((*it)->GetLoadTimings())).count());
+  }
+  LOG_INFO() << "Components with the longest own load time: " << slowest_str;
+}
+
 }  // namespace components::impl
 
 USERVER_NAMESPACE_END
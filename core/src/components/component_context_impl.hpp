@@ -151,6 +151,7 @@ class ComponentContextImpl {
   void StartPrintAddingComponentsTask();
   void StopPrintAddingComponentsTask();
   void PrintAddingComponents() const;
+  void LogLoadProfile() const;
 
   const Manager& manager_;
 
@@ -89,6 +89,12 @@ void LoggingConfigurator::OnConfigUpdate(
         AddDynamicDebugLog(path, line, state);
       }
 
+      logging::RemoveLogBudgets();
+      for (const auto& [location, lines_per_second] : dd.budget_per_second) {
+        const auto [path, line] = logging::SplitLocation(location);
+        logging::SetLogBudget(path, line, lines_per_second);
+      }
+
       lock.Commit();
     }
   } catch (const std::exception& e) {
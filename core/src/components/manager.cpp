@@ -55,14 +55,14 @@ std::optional<size_t> GuessCpuLimit(const std::string& tp_name) {
     // TODO: hack for https://st.yandex-team.ru/TAXICOMMON-2132
     if (cpu < 3) cpu = 3;
 
-    LOG_INFO() << "Using CPU limit from env CPU_LIMIT (" << cpu
+    LOG_INFO() << "Using CPU limit (" << cpu
                << ") for worker_threads "
                << "of task processor '" << tp_name
                << "', ignoring config value ";
     return cpu;
   }
 
-  LOG_WARNING() << "CPU limit from env CPU_LIMIT (" << cpu_f
+  LOG_WARNING() << "CPU limit (" << *cpu_f
                 << ") looks very different from the estimated number of "
                    "hardware threads ("
                 << hw_threads_estimate
@@ -73,7 +73,9 @@ std::optional<size_t> GuessCpuLimit(const std::string& tp_name) {
 void ValidateConfigs(const components::ComponentList& component_list,
                      const components::ComponentConfigMap& component_config_map,
                      components::ValidationMode validation_condition) {
-  std::string validation_errors;
+  // Schemas of hundreds of components are parsed and checked independently,
+  // which takes a noticeable part of the startup if done sequentially
+  std::vector<engine::TaskWithResult<std::string>> tasks;
 
   for (const auto& adder : component_list) {
     const auto it = component_config_map.find(adder->GetComponentName());
@@ -81,13 +83,21 @@ void ValidateConfigs(const components::ComponentList& component_list,
         it != component_config_map.cend(),
         fmt::format("Component-config map does not have name of component '{}'",
                     adder->GetComponentName()));
-    try {
-      adder->ValidateStaticConfig(it->second, validation_condition);
-    } catch (const std::exception& exception) {
-      auto component_name = adder->GetComponentName();
-      validation_errors +=
-          fmt::format("\n\t{}: {}", component_name, exception.what());
-    }
+    tasks.push_back(engine::CriticalAsyncNoSpan(
+        [&adder, &config = it->second, validation_condition] {
+          try {
+            adder->ValidateStaticConfig(config, validation_condition);
+          } catch (const std::exception& exception) {
+            return fmt::format("\n\t{}: {}", adder->GetComponentName(),
+                               exception.what());
+          }
+          return std::string{};
+        }));
+  }
+
+  std::string validation_errors;
+  for (auto& task : tasks) {
+    validation_errors += task.Get();
   }
 
   if (!validation_errors.empty()) {
@@ -115,16 +115,35 @@ properties:
                     lead to inaccuracy in coro pool size estimation.
                     local_cache_size=0 disables local cache.
                 defaultDescription: 8
+            adaptive:
+                type: boolean
+                description: |
+                    Periodically shrink the pool toward the high-water mark of
+                    active coroutines observed during the last two
+                    adaptive_trim_interval periods (but not below
+                    initial_size), and return the unused pages of idle
+                    coroutine stacks to the OS with madvise(MADV_DONTNEED).
+                    Reduces RSS after traffic spikes.
+                defaultDescription: false
+            adaptive_trim_interval:
+                type: string
+                description: how often to trim the pool in adaptive mode
+                defaultDescription: 60s
     event_thread_pool:
         type: object
         description: event thread pool options
         additionalProperties: false
         properties:
             threads:
-                type: integer
+                type: string
                 description: >
                     number of threads to process low level IO system calls
-                    (number of ev loops to start in libev)
+                    (number of ev loops to start in libev), or `auto` to use
+                    threads_cpu_ratio of the CPU limit
+            threads_cpu_ratio:
+                type: number
+                description: threads count to CPU limit ratio for `threads: auto`
+                defaultDescription: 1.0
             dedicated_timer_threads:
                 type: integer
                 description: >
@@ -137,6 +156,43 @@ properties:
                 description: >
                     Whether to defer timer events to a per-thread periodic timer
                     or notify ev-loop right away
+            io_backend:
+                type: string
+                description: |
+                    How to wait for fd readiness in the ev threads.
+                    `libev` uses libev io watchers.
+                    `io-uring` submits poll requests into a per-thread
+                    io_uring in batches, once per ev-loop iteration. Falls
+                    back to `libev` if the kernel does not support io_uring.
+                defaultDescription: libev
+                enum:
+                  - libev
+                  - io-uring
+            timer_backend:
+                type: string
+                description: |
+                    How to run task deadlines and sleeps in the ev threads.
+                    `libev` uses a libev timer per task. `timer-wheel` uses a
+                    per-thread hierarchical timer wheel with 1ms resolution,
+                    that is cheaper to arm and fires expired timers in
+                    batches, but may delay them by up to 1ms.
+                defaultDescription: libev
+                enum:
+                  - libev
+                  - timer-wheel
+            cpu_set:
+                type: string
+                description: |
+                    CPUs to bind the ev threads to, in the cpuset(7) list
+                    format, e.g. `0-3,8`. CPUs of `numa_node` are used if
+                    `cpu_set` is not set.
+                defaultDescription: any CPU
+            numa_node:
+                type: integer
+                description: |
+                    NUMA node to bind the ev threads and their memory
+                    allocations to
+                defaultDescription: any node
     components:
         type: object
         description: 'dictionary of "component name": "options"'
@@ -154,11 +210,21 @@ properties:
                     type: string
                     description: set OS thread name to this value
                 worker_threads:
-                    type: integer
-                    description: threads count for the task processor
+                    type: string
+                    description: |
+                        threads count for the task processor, or `auto` to
+                        use worker-threads-cpu-ratio of the CPU limit
+                worker-threads-cpu-ratio:
+                    type: number
+                    description: |
+                        threads count to CPU limit ratio for
+                        `worker_threads: auto`
+                    defaultDescription: 1.0
                 guess-cpu-limit:
                     type: boolean
-                    description: .
+                    description: |
+                        use the CPU limit (but at least 3 threads) as the
+                        threads count of the default task processor
                     defaultDescription: false
                 os-scheduling:
                     type: string
@@ -178,6 +244,62 @@ properties:
                         tunes the number of spin-wait iterations in case of
                         an empty task queue before threads go to sleep
                     defaultDescription: 10000
+                task-processor-queue:
+                    type: string
+                    description: |
+                        Task queue mode for the task processor.
+                        `global-task-queue` makes all the workers share a
+                        single task queue.
+                        `work-stealing-task-queue` gives each worker a local
+                        queue for the tasks it spawns and wakes up, idle
+                        workers steal tasks from their siblings. This reduces
+                        contention on the shared queue with many workers and
+                        many short tasks.
+                    defaultDescription: global-task-queue
+                    enum:
+                      - global-task-queue
+                      - work-stealing-task-queue
+                cpu-set:
+                    type: string
+                    description: |
+                        CPUs to bind the worker threads to, in the cpuset(7)
+                        list format, e.g. `0-3,8`. CPUs of `numa-node` are used
+                        if `cpu-set` is not set.
+                    defaultDescription: any CPU
+                numa-node:
+                    type: integer
+                    description: |
+                        NUMA node to bind the worker threads and their memory
+                        allocations to, including the coroutine stacks
+                    defaultDescription: any node
+                span-cpu-stats-top-size:
+                    type: integer
+                    description: |
+                        enables accounting of the CPU time consumed by tasks
+                        per tracing span name and sets the number of the
+                        top spans to report in the `span-cpu` metrics
+                    defaultDescription: 0 (disabled)
+                wait-stats-sample-every:
+                    type: integer
+                    description: |
+                        enables accounting of the time tasks spend suspended
+                        per wait site, every N-th suspension of a task is
+                        measured and reported in the `wait` metrics
+                    defaultDescription: 0 (disabled)
+                blocking-detector-threshold:
+                    type: string
+                    description: |
+                        enables a watchdog that logs the stack of a worker
+                        thread that has been running a task without a context
+                        switch for longer than this duration
+                    defaultDescription: 0 (disabled)
+                account-allocations:
+                    type: boolean
+                    description: |
+                        enables accounting of the memory allocated by tasks,
+                        reported per HTTP handler and per cache update;
+                        requires jemalloc
+                    defaultDescription: false
                 task-trace:
                     type: object
                     description: .
@@ -1,6 +1,8 @@
 #include <components/manager_config.hpp>
 
+#include <engine/task/task_processor_config.hpp>
 #include <server/server_config.hpp>
+#include <userver/hostinfo/cpu_limit.hpp>
 #include <userver/server/handlers/handler_config.hpp>
 
 #include <algorithm>
@@ -245,4 +247,18 @@ TEST(ManagerConfig, HandlerConfig) {
   EXPECT_EQ(conf.task_processor, "main-task-processor");
 }
 
+TEST(ManagerConfig, AutoWorkerThreads) {
+  const auto config = yaml_config::YamlConfig{
+      formats::yaml::FromString(R"(
+        worker_threads: auto
+        worker-threads-cpu-ratio: 0.5
+      )"),
+      {},
+  }
+                          .As<engine::TaskProcessorConfig>();
+
+  EXPECT_EQ(config.worker_threads, hostinfo::CpuLimitThreads(0.5));
+  EXPECT_GE(config.worker_threads, 1);
+}
+
 USERVER_NAMESPACE_END
@@ -1,5 +1,11 @@
 #include <userver/components/manager_controller_component.hpp>
 
+#include <chrono>
+#include <cstdint>
+#include <initializer_list>
+#include <string_view>
+#include <utility>
+
 #include <components/manager_config.hpp>
 #include <components/manager_controller_component_config.hpp>
 #include <engine/task/task_processor.hpp>
@@ -8,6 +14,7 @@
 #include <userver/dynamic_config/storage/component.hpp>
 #include <userver/dynamic_config/value.hpp>
 #include <userver/logging/component.hpp>
+#include <userver/utils/statistics/rate.hpp>
 
 #include <components/manager.hpp>
 
@@ -15,6 +22,16 @@ USERVER_NAMESPACE_BEGIN
 
 namespace engine {
 
+namespace {
+
+constexpr std::pair<Task::Priority, std::string_view> kTaskPriorities[] = {
+    {Task::Priority::kCritical, "critical"},
+    {Task::Priority::kNormal, "normal"},
+    {Task::Priority::kBackground, "background"},
+};
+
+}  // namespace
+
 void DumpMetric(utils::statistics::Writer& writer,
                 const engine::TaskProcessor& task_processor) {
   const auto& counter = task_processor.GetTaskCounter();
@@ -43,11 +60,76 @@ void DumpMetric(utils::statistics::Writer& writer,
     context_switch["slow"] = counter.GetTaskSwitchSlow().value;
     context_switch["fast"] = counter.GetTaskSwitchFast().value;
     context_switch["spurious_wakeups"] = counter.GetSpuriousWakeups().value;
+    context_switch["numa_migrations"] = counter.GetNumaMigrations().value;
 
     context_switch["overloaded"] = counter.GetTasksOverloadSensor().value;
     context_switch["no_overloaded"] = counter.GetTasksNoOverloadSensor().value;
   }
 
+  // Only a sample of tasks is measured, average wait time is
+  // time_us / samples
+  if (auto queue_wait = writer["queue_wait"]) {
+    for (const auto& [priority, priority_name] : kTaskPriorities) {
+      const utils::statistics::LabelView label{"task_priority", priority_name};
+      queue_wait["time_us"].ValueWithLabels(
+          counter.GetQueueWaitTimeUs(priority).value, label);
+      queue_wait["samples"].ValueWithLabels(
+          counter.GetQueueWaitSamples(priority).value, label);
+    }
+  }
+
+  // Reported only with the `span-cpu-stats-top-size` static option set
+  if (const auto* span_cpu_stats = task_processor.GetSpanCpuStats()) {
+    using std::chrono::duration_cast;
+    using std::chrono::microseconds;
+
+    if (auto top = writer["span-cpu"]["top-by-cpu-time"]) {
+      for (const auto& [name, stats] : span_cpu_stats->GetTopByCpuTime()) {
+        const utils::statistics::LabelView label{"span_name", name};
+        top["cpu_time_us"].ValueWithLabels(
+            utils::statistics::Rate{static_cast<std::uint64_t>(
+                duration_cast<microseconds>(stats.cpu_time).count())},
+            label);
+        top["runs"].ValueWithLabels(utils::statistics::Rate{stats.runs},
+                                    label);
+      }
+    }
+
+    if (auto top = writer["span-cpu"]["top-by-max-run-time"]) {
+      for (const auto& [name, stats] : span_cpu_stats->GetTopByMaxRunTime()) {
+        top["max_run_time_us"].ValueWithLabels(
+            duration_cast<microseconds>(stats.max_run_time).count(),
+            {"span_name", name});
+      }
+    }
+  }
+
+  // Reported only with the `wait-stats-sample-every` static option set. Only a
+  // sample of waits is measured.
+  if (const auto* wait_stats = task_processor.GetWaitStats()) {
+    if (auto top = writer["wait"]["top-by-wait-time"]) {
+      for (const auto& stats : wait_stats->GetTopByWaitTime()) {
+        const std::initializer_list<utils::statistics::LabelView> labels{
+            {"wait_primitive", stats.primitive},
+            {"wait_call_site", stats.call_site}};
+        top["wait_time_us"].ValueWithLabels(
+            utils::statistics::Rate{
+                static_cast<std::uint64_t>(stats.wait_time.count())},
+            labels);
+        top["waits"].ValueWithLabels(utils::statistics::Rate{stats.waits},
+                                     labels);
+        top["wait_time_ms"].ValueWithLabels(stats.wait_time_ms.GetView(),
+                                            labels);
+      }
+    }
+  }
+
+  // Reported only with the `blocking-detector-threshold` static option set
+  if (const auto* blocking_detector = task_processor.GetBlockingDetector()) {
+    writer["blocking-detector"]["long_slices"] =
+        utils::statistics::Rate{blocking_detector->GetLongSlices()};
+  }
+
   writer["worker-threads"] = task_processor.GetWorkerCount();
 }
 
@@ -100,9 +182,18 @@ void ManagerControllerComponent::WriteStatistics(
   const auto& pools_ptr = components_manager_.GetTaskProcessorPools();
   auto& ev_thread_pool = pools_ptr->EventThreadPool();
   for (auto* thread : ev_thread_pool.NextThreads(ev_thread_pool.GetSize())) {
+    const utils::statistics::LabelView label{"ev_thread_name",
+                                             thread->GetName()};
     writer["ev-threads"]["cpu-load-percent"].ValueWithLabels(
-        thread->GetCurrentLoadPercent(),
-        {{"ev_thread_name", thread->GetName()}});
+        thread->GetCurrentLoadPercent(), label);
+
+    const auto payload_stats = thread->GetPayloadQueueStats();
+    writer["ev-threads"]["payloads"].ValueWithLabels(
+        utils::statistics::Rate{payload_stats.payloads}, label);
+    writer["ev-threads"]["payload-batches"].ValueWithLabels(
+        utils::statistics::Rate{payload_stats.batches}, label);
+    writer["ev-threads"]["wakeups"].ValueWithLabels(
+        utils::statistics::Rate{payload_stats.wakeups}, label);
   }
 
   // coroutines
@@ -9,6 +9,9 @@
 
 #include <netinet/tcp.h>
 
+#include <chrono>
+#include <functional>
+
 USERVER_NAMESPACE_BEGIN
 
 namespace components {
@@ -17,6 +20,32 @@ namespace {
 
 using server::net::ListenerConfig;
 
+void SetListenerOptions(engine::io::Socket& listen_sock,
+                        std::chrono::seconds defer_accept,
+                        int fast_open_queue) {
+  // MAC_COMPAT: TCP_DEFER_ACCEPT is Linux-only
+#ifdef TCP_DEFER_ACCEPT
+  if (defer_accept.count() > 0) {
+    listen_sock.SetOption(IPPROTO_TCP, TCP_DEFER_ACCEPT,
+                          static_cast<int>(defer_accept.count()));
+  }
+#else
+  if (defer_accept.count() > 0) {
+    LOG_WARNING() << "defer_accept is not supported on this platform";
+  }
+#endif
+
+#ifdef TCP_FASTOPEN
+  if (fast_open_queue > 0) {
+    listen_sock.SetOption(IPPROTO_TCP, TCP_FASTOPEN, fast_open_queue);
+  }
+#else
+  if (fast_open_queue > 0) {
+    LOG_WARNING() << "fast_open_queue is not supported on this platform";
+  }
+#endif
+}
+
 std::string SocketsTaskProcessorName(const ComponentConfig& config,
                                      const ListenerConfig& acceptor_config) {
   return config["sockets_task_processor"].As<std::string>(
@@ -62,6 +91,22 @@ properties:
       type: string
       description: task processor to process accepted sockets
       defaultDescription: value of `task_processor`
+  shards:
+      type: integer
+      description: how many listening sockets with their own accept loops share the port via SO_REUSEPORT
+      defaultDescription: 1
+  shards_cpu_steering:
+      type: boolean
+      description: on Linux distribute new TCP connections among the shards by the CPU that received them rather than by the kernel hash of the addresses
+      defaultDescription: false
+  defer_accept:
+      type: integer
+      description: on Linux wake up the acceptor only when data arrives on a new connection or after the given timeout in seconds (TCP_DEFER_ACCEPT), 0 - disabled
+      defaultDescription: 0
+  fast_open_queue:
+      type: integer
+      description: max pending TCP Fast Open requests, 0 - disabled (TCP_FASTOPEN)
+      defaultDescription: 0
 )");
 }
 
@@ -74,11 +119,27 @@ TcpAcceptorBase::TcpAcceptorBase(const ComponentConfig& config,
           context.GetTaskProcessor(acceptor_config.task_processor)),
       sockets_task_processor_(context.GetTaskProcessor(
           SocketsTaskProcessorName(config, acceptor_config))),
-      listen_sock_(server::net::CreateSocket(acceptor_config)) {}
+      // unix socket path can not be shared
+      acceptors_(acceptor_config.unix_socket_path.empty()
+                     ? acceptor_config.shards.value_or(1)
+                     : 1) {
+  const auto defer_accept =
+      config["defer_accept"].As<std::chrono::seconds>(std::chrono::seconds{0});
+  const auto fast_open_queue = config["fast_open_queue"].As<int>(0);
+
+  listen_socks_.reserve(acceptors_.size());
+  for (std::size_t i = 0; i < acceptors_.size(); ++i) {
+    auto& listen_sock =
+        listen_socks_.emplace_back(server::net::CreateSocket(acceptor_config));
+    if (acceptor_config.unix_socket_path.empty()) {
+      SetListenerOptions(listen_sock, defer_accept, fast_open_queue);
+    }
+  }
+}
 
-void TcpAcceptorBase::KeepAccepting() {
+void TcpAcceptorBase::KeepAccepting(engine::io::Socket& listen_sock) {
   while (!engine::current_task::ShouldCancel()) {
-    engine::io::Socket sock = listen_sock_.Accept({});
+    engine::io::Socket sock = listen_sock.Accept({});
 
     tasks_.Detach(engine::AsyncNoSpan(
         sockets_task_processor_,
@@ -95,14 +156,21 @@ void TcpAcceptorBase::KeepAccepting() {
 void TcpAcceptorBase::OnAllComponentsLoaded() {
   // Start handling after the derived object was fully constructed
 
-  // NOLINTNEXTLINE(cppcoreguidelines-slicing)
-  acceptor_ = engine::AsyncNoSpan(acceptor_task_processor_,
-                                  &TcpAcceptorBase::KeepAccepting, this);
+  for (std::size_t i = 0; i < acceptors_.size(); ++i) {
+    // NOLINTNEXTLINE(cppcoreguidelines-slicing)
+    acceptors_[i] = engine::AsyncNoSpan(acceptor_task_processor_,
+                                        &TcpAcceptorBase::KeepAccepting, this,
+                                        std::ref(listen_socks_[i]));
+  }
 }
 
 void TcpAcceptorBase::OnAllComponentsAreStopping() {
-  acceptor_ = {};  // Cancel and wait for finish
-  listen_sock_.Close();
+  for (auto& acceptor : acceptors_) {
+    acceptor = {};  // Cancel and wait for finish
+  }
+  for (auto& listen_sock : listen_socks_) {
+    listen_sock.Close();
+  }
   tasks_.CancelAndWait();
 }
 
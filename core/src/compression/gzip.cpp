@@ -1,16 +1,79 @@
 #include <compression/gzip.hpp>
 
+#include <algorithm>
+
+#include <zlib.h>
+
 #include <boost/iostreams/filter/gzip.hpp>
 #include <boost/iostreams/filtering_stream.hpp>
 
+#include <userver/utils/assert.hpp>
+
 USERVER_NAMESPACE_BEGIN
 
 namespace compression::gzip {
 
 namespace {
+
 constexpr auto kDecompressBufferSize = 1024;
+
+// 15 is the max window size, +16 selects the gzip wrapper instead of zlib
+constexpr int kGzipWindowBits = 15 + 16;
+constexpr int kMemLevel = 8;
+
+void CheckZlibResult(int result, const z_stream& stream) {
+  if (result != Z_OK && result != Z_STREAM_END && result != Z_BUF_ERROR) {
+    throw CompressionError(stream.msg ? stream.msg : zError(result));
+  }
+}
+
+// Deflates all of `data` with `flush`, appending the output to `out`
+void Deflate(z_stream& stream, std::string_view data, int flush,
+             std::string& out) {
+  // NOLINTNEXTLINE(cppcoreguidelines-pro-type-const-cast)
+  stream.next_in = reinterpret_cast<Bytef*>(const_cast<char*>(data.data()));
+  stream.avail_in = static_cast<uInt>(data.size());
+
+  do {
+    const auto old_size = out.size();
+    const auto chunk_size = std::max<std::size_t>(
+        deflateBound(&stream, stream.avail_in), kDecompressBufferSize);
+    out.resize(old_size + chunk_size);
+
+    stream.next_out = reinterpret_cast<Bytef*>(out.data() + old_size);
+    stream.avail_out = static_cast<uInt>(chunk_size);
+    const auto result = deflate(&stream, flush);
+    CheckZlibResult(result, stream);
+    out.resize(out.size() - stream.avail_out);
+
+    if (result == Z_STREAM_END) break;
+  } while (stream.avail_out == 0 || stream.avail_in != 0);
 }
 
+class DeflateStream final {
+ public:
+  explicit DeflateStream(int level) {
+    const auto result = deflateInit2(&stream_, level, Z_DEFLATED,
+                                     kGzipWindowBits, kMemLevel,
+                                     Z_DEFAULT_STRATEGY);
+    if (result != Z_OK) {
+      throw CompressionError(zError(result));
+    }
+  }
+
+  ~DeflateStream() { deflateEnd(&stream_); }
+
+  DeflateStream(DeflateStream&&) = delete;
+  DeflateStream& operator=(DeflateStream&&) = delete;
+
+  z_stream& Get() noexcept { return stream_; }
+
+ private:
+  z_stream stream_{};
+};
+
+}  // namespace
+
 std::string Decompress(std::string_view compressed, size_t max_size) {
   std::string decompressed;
 
@@ -42,6 +105,42 @@ std::string Decompress(std::string_view compressed, size_t max_size) {
   return decompressed;
 }
 
+struct Compressor::Impl final {
+  explicit Impl(int level) : stream(level) {}
+
+  DeflateStream stream;
+};
+
+std::string Compress(std::string_view data, int level) {
+  DeflateStream stream{level};
+  std::string compressed;
+  compressed.reserve(deflateBound(&stream.Get(), data.size()));
+  Deflate(stream.Get(), data, Z_FINISH, compressed);
+  return compressed;
+}
+
+Compressor::Compressor(int level) : impl_(std::make_unique<Impl>(level)) {}
+
+Compressor::~Compressor() = default;
+
+Compressor::Compressor(Compressor&&) noexcept = default;
+
+Compressor& Compressor::operator=(Compressor&&) noexcept = default;
+
+std::string Compressor::Compress(std::string_view data) {
+  UASSERT(impl_);
+  std::string compressed;
+  Deflate(impl_->stream.Get(), data, Z_SYNC_FLUSH, compressed);
+  return compressed;
+}
+
+std::string Compressor::Finish() {
+  UASSERT(impl_);
+  std::string compressed;
+  Deflate(impl_->stream.Get(), {}, Z_FINISH, compressed);
+  return compressed;
+}
+
 }  // namespace compression::gzip
 
 USERVER_NAMESPACE_END
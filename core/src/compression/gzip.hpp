@@ -1,5 +1,7 @@
 #pragma once
 
+#include <memory>
+#include <string>
 #include <string_view>
 
 #include <userver/compression/error.hpp>
@@ -12,6 +14,36 @@ namespace compression::gzip {
 /// @throws DecompressionError
 std::string Decompress(std::string_view compressed, size_t max_size);
 
+/// Compresses the string into a single gzip member.
+/// @throws CompressionError
+std::string Compress(std::string_view data, int level);
+
+/// @brief Incremental gzip compressor.
+///
+/// Each Compress() call flushes its output, so the concatenation of all the
+/// results received so far can be decompressed by the peer right away.
+class Compressor final {
+ public:
+  /// @throws CompressionError
+  explicit Compressor(int level);
+  ~Compressor();
+
+  Compressor(Compressor&&) noexcept;
+  Compressor& operator=(Compressor&&) noexcept;
+
+  /// Compresses the next part of the data.
+  /// @throws CompressionError
+  std::string Compress(std::string_view data);
+
+  /// Returns the end of the stream, the compressor may not be used after that.
+  /// @throws CompressionError
+  std::string Finish();
+
+ private:
+  struct Impl;
+  std::unique_ptr<Impl> impl_;
+};
+
 }  // namespace compression::gzip
 
 USERVER_NAMESPACE_END
@@ -29,4 +29,32 @@ TEST(Gzip, TestOverflow) {
                compression::TooBigError);
 }
 
+TEST(Gzip, CompressRoundTrip) {
+  std::string data;
+  for (int i = 0; i < 10'000; ++i) data += "chunk #" + std::to_string(i % 7);
+
+  const auto compressed = compression::gzip::Compress(data, 6);
+  EXPECT_LT(compressed.size(), data.size());
+  EXPECT_EQ(compression::gzip::Decompress(compressed, data.size()), data);
+
+  EXPECT_EQ(compression::gzip::Decompress(compression::gzip::Compress("", 1),
+                                          data.size()),
+            "");
+}
+
+TEST(Gzip, StreamingCompressor) {
+  std::string data;
+  for (int i = 0; i < 10'000; ++i) data += "chunk #" + std::to_string(i % 7);
+
+  compression::gzip::Compressor compressor{6};
+  std::string compressed;
+  for (std::size_t pos = 0; pos < data.size(); pos += 1000) {
+    compressed += compressor.Compress(std::string_view{data}.substr(pos, 1000));
+    EXPECT_FALSE(compressed.empty());
+  }
+  compressed += compressor.Finish();
+
+  EXPECT_EQ(compression::gzip::Decompress(compressed, data.size()), data);
+}
+
 USERVER_NAMESPACE_END
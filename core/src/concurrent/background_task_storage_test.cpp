@@ -1,6 +1,7 @@
 #include <userver/utest/utest.hpp>
 
 #include <atomic>
+#include <vector>
 
 #include <userver/concurrent/background_task_storage.hpp>
 #include <userver/concurrent/background_task_storage_fwd.hpp>
@@ -161,6 +162,31 @@ UTEST(BackgroundTaskStorage, CancelAndWait) {
   EXPECT_TRUE(finished);
 }
 
+UTEST_MT(BackgroundTaskStorage, CancelAndWaitFromManyThreads, 4) {
+  constexpr std::size_t kSpawners = 4;
+  constexpr std::size_t kTasksPerSpawner = 100;
+  std::atomic<std::size_t> finished{0};
+  engine::SingleConsumerEvent never_sent;
+  concurrent::BackgroundTaskStorage bts;
+
+  std::vector<engine::TaskWithResult<void>> spawners;
+  for (std::size_t i = 0; i < kSpawners; ++i) {
+    spawners.push_back(engine::AsyncNoSpan([&] {
+      for (std::size_t j = 0; j < kTasksPerSpawner; ++j) {
+        bts.CriticalAsyncDetach("", [&] {
+          EXPECT_FALSE(never_sent.WaitForEventFor(utest::kMaxTestWaitTime));
+          ++finished;
+        });
+      }
+    }));
+  }
+  for (auto& spawner : spawners) spawner.Get();
+  EXPECT_EQ(bts.ActiveTasksApprox(), kSpawners * kTasksPerSpawner);
+
+  bts.CancelAndWait();
+  EXPECT_EQ(finished, kSpawners * kTasksPerSpawner);
+}
+
 UTEST(BackgroundTaskStorage, CloseAndWaitDebug) {
   std::atomic<bool> finished{false};
   concurrent::BackgroundTaskStorage bts;
@@ -0,0 +1,267 @@
+#include <userver/concurrent/bounded_queue.hpp>
+
+#include <algorithm>
+#include <array>
+#include <memory>
+#include <optional>
+#include <vector>
+
+#include <userver/engine/mutex.hpp>
+#include <userver/engine/sleep.hpp>
+#include <userver/utest/utest.hpp>
+#include <userver/utils/async.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+constexpr std::size_t kProducersCount = 4;
+constexpr std::size_t kConsumersCount = 4;
+constexpr std::size_t kMessageCount = 1000;
+
+template <typename T>
+class BoundedQueue : public ::testing::Test {};
+
+using TestQueueTypes =
+    testing::Types<concurrent::BoundedMpmcQueue<std::unique_ptr<int>>,
+                   concurrent::BoundedMpscQueue<std::unique_ptr<int>>,
+                   concurrent::BoundedSpmcQueue<std::unique_ptr<int>>,
+                   concurrent::BoundedSpscQueue<std::unique_ptr<int>>>;
+
+}  // namespace
+
+TYPED_UTEST_SUITE(BoundedQueue, TestQueueTypes);
+
+TYPED_UTEST(BoundedQueue, Capacity) {
+  EXPECT_EQ(TypeParam::Create(0)->GetCapacity(), 2);
+  EXPECT_EQ(TypeParam::Create(4)->GetCapacity(), 4);
+  EXPECT_EQ(TypeParam::Create(5)->GetCapacity(), 8);
+}
+
+TYPED_UTEST(BoundedQueue, PushPopNoblock) {
+  auto queue = TypeParam::Create(4);
+  auto producer = queue->GetProducer();
+  auto consumer = queue->GetConsumer();
+
+  for (int i = 0; i < 4; ++i) {
+    EXPECT_TRUE(producer.PushNoblock(std::make_unique<int>(i)));
+  }
+  EXPECT_EQ(queue->GetSizeApproximate(), 4);
+
+  auto value = std::make_unique<int>(4);
+  EXPECT_FALSE(producer.PushNoblock(std::move(value)));
+  // Not moved from on failure
+  ASSERT_TRUE(value);
+
+  for (int i = 0; i < 4; ++i) {
+    std::unique_ptr<int> popped;
+    ASSERT_TRUE(consumer.PopNoblock(popped));
+    EXPECT_EQ(*popped, i);
+  }
+  std::unique_ptr<int> popped;
+  EXPECT_FALSE(consumer.PopNoblock(popped));
+  EXPECT_EQ(queue->GetSizeApproximate(), 0);
+}
+
+TYPED_UTEST(BoundedQueue, PushPopMany) {
+  auto queue = TypeParam::Create(4);
+  auto producer = queue->GetProducer();
+  auto consumer = queue->GetConsumer();
+
+  std::array<std::unique_ptr<int>, 3> values;
+  for (int round = 0; round < 3; ++round) {
+    for (int i = 0; i < 3; ++i) values[i] = std::make_unique<int>(round + i);
+    ASSERT_EQ(producer.PushMany(values), 3);
+
+    std::array<std::unique_ptr<int>, 4> popped;
+    ASSERT_EQ(consumer.PopMany(popped), 3);
+    for (int i = 0; i < 3; ++i) EXPECT_EQ(*popped[i], round + i);
+  }
+
+  // Only the pushed prefix is moved from
+  for (int i = 0; i < 3; ++i) values[i] = std::make_unique<int>(i);
+  ASSERT_TRUE(producer.PushNoblock(std::make_unique<int>(-1)));
+  EXPECT_EQ(producer.PushMany(values, engine::Deadline::Passed()), 3);
+  EXPECT_FALSE(values[2]);
+  values[0] = std::make_unique<int>(3);
+  EXPECT_EQ(producer.PushMany(utils::span{values.data(), 1},
+                              engine::Deadline::Passed()),
+            0);
+  EXPECT_TRUE(values[0]);
+}
+
+TYPED_UTEST(BoundedQueue, BlockingPush) {
+  auto queue = TypeParam::Create(2);
+  auto producer = queue->GetProducer();
+  auto consumer = queue->GetConsumer();
+
+  ASSERT_TRUE(producer.Push(std::make_unique<int>(0)));
+  ASSERT_TRUE(producer.Push(std::make_unique<int>(1)));
+
+  auto task = utils::Async("producer", [&producer] {
+    return producer.Push(std::make_unique<int>(2));
+  });
+  engine::SleepFor(std::chrono::milliseconds{10});
+  EXPECT_FALSE(task.IsFinished());
+
+  std::unique_ptr<int> value;
+  ASSERT_TRUE(consumer.Pop(value));
+  EXPECT_EQ(*value, 0);
+  EXPECT_TRUE(task.Get());
+}
+
+TYPED_UTEST(BoundedQueue, BlockingPop) {
+  auto queue = TypeParam::Create(2);
+  auto producer = queue->GetProducer();
+  auto consumer = queue->GetConsumer();
+
+  auto task = utils::Async("consumer", [&consumer] {
+    std::unique_ptr<int> value;
+    EXPECT_TRUE(consumer.Pop(value));
+    return *value;
+  });
+  engine::SleepFor(std::chrono::milliseconds{10});
+  EXPECT_FALSE(task.IsFinished());
+
+  ASSERT_TRUE(producer.Push(std::make_unique<int>(42)));
+  EXPECT_EQ(task.Get(), 42);
+}
+
+TYPED_UTEST(BoundedQueue, Deadline) {
+  auto queue = TypeParam::Create(2);
+  auto producer = queue->GetProducer();
+  auto consumer = queue->GetConsumer();
+
+  std::unique_ptr<int> value;
+  EXPECT_FALSE(consumer.Pop(
+      value, engine::Deadline::FromDuration(std::chrono::milliseconds{10})));
+
+  ASSERT_TRUE(producer.Push(std::make_unique<int>(0)));
+  ASSERT_TRUE(producer.Push(std::make_unique<int>(1)));
+  EXPECT_FALSE(producer.Push(
+      std::make_unique<int>(2),
+      engine::Deadline::FromDuration(std::chrono::milliseconds{10})));
+}
+
+TYPED_UTEST(BoundedQueue, ProducerIsDead) {
+  auto queue = TypeParam::Create(2);
+  auto consumer = queue->GetConsumer();
+  {
+    auto producer = queue->GetProducer();
+    ASSERT_TRUE(producer.Push(std::make_unique<int>(1)));
+  }
+
+  // The remaining items can be read
+  std::unique_ptr<int> value;
+  ASSERT_TRUE(consumer.Pop(value));
+  EXPECT_EQ(*value, 1);
+  EXPECT_FALSE(consumer.Pop(value));
+}
+
+TYPED_UTEST(BoundedQueue, ConsumerIsDead) {
+  auto queue = TypeParam::Create(2);
+  auto producer = queue->GetProducer();
+  (void)queue->GetConsumer();
+
+  EXPECT_FALSE(producer.Push(std::make_unique<int>(0)));
+}
+
+TYPED_UTEST(BoundedQueue, ConsumerDiesWhilePushing) {
+  auto queue = TypeParam::Create(2);
+  auto producer = queue->GetProducer();
+  std::optional consumer{queue->GetConsumer()};
+
+  ASSERT_TRUE(producer.Push(std::make_unique<int>(0)));
+  ASSERT_TRUE(producer.Push(std::make_unique<int>(1)));
+  auto task = utils::Async("producer", [&producer] {
+    return producer.Push(std::make_unique<int>(2));
+  });
+  engine::SleepFor(std::chrono::milliseconds{10});
+
+  consumer.reset();
+  EXPECT_FALSE(task.Get());
+}
+
+UTEST_MT(BoundedMpmcQueue, Mpmc, kProducersCount + kConsumersCount) {
+  using Queue = concurrent::BoundedMpmcQueue<std::size_t>;
+  // Small enough for the producers to block
+  auto queue = Queue::Create(16);
+
+  std::vector<engine::TaskWithResult<void>> producers_tasks;
+  producers_tasks.reserve(kProducersCount);
+  for (std::size_t i = 0; i < kProducersCount; ++i) {
+    producers_tasks.push_back(
+        utils::Async("producer", [producer = queue->GetProducer(), i] {
+          std::array<std::size_t, 3> batch{};
+          std::size_t message = i * kMessageCount;
+          while (message < (i + 1) * kMessageCount) {
+            // Mix single and batch pushes
+            if (message % 2 == 0) {
+              ASSERT_TRUE(producer.Push(std::size_t{message++}));
+              continue;
+            }
+            const auto count =
+                std::min(batch.size(), (i + 1) * kMessageCount - message);
+            for (std::size_t j = 0; j < count; ++j) batch[j] = message + j;
+            ASSERT_EQ(producer.PushMany(utils::span{batch.data(), count}),
+                      count);
+            message += count;
+          }
+        }));
+  }
+
+  std::vector<int> consumed_messages(kMessageCount * kProducersCount, 0);
+  engine::Mutex mutex;
+
+  std::vector<engine::TaskWithResult<void>> consumers_tasks;
+  consumers_tasks.reserve(kConsumersCount);
+  for (std::size_t i = 0; i < kConsumersCount; ++i) {
+    consumers_tasks.push_back(utils::Async(
+        "consumer",
+        [consumer = queue->GetConsumer(), &consumed_messages, &mutex] {
+          std::array<std::size_t, 4> values{};
+          while (const auto count = consumer.PopMany(values)) {
+            const std::lock_guard lock(mutex);
+            for (std::size_t j = 0; j < count; ++j) {
+              ++consumed_messages[values[j]];
+            }
+          }
+        }));
+  }
+
+  for (auto& task : producers_tasks) {
+    task.Get();
+  }
+  for (auto& task : consumers_tasks) {
+    task.Get();
+  }
+
+  ASSERT_TRUE(std::all_of(consumed_messages.begin(), consumed_messages.end(),
+                          [](int item) { return item == 1; }));
+  EXPECT_EQ(queue->GetSizeApproximate(), 0);
+}
+
+UTEST_MT(BoundedSpscQueue, Spsc, 1 + 1) {
+  using Queue = concurrent::BoundedSpscQueue<std::size_t>;
+  auto queue = Queue::Create(16);
+
+  auto producer_task =
+      utils::Async("producer", [producer = queue->GetProducer()] {
+        for (std::size_t message = 0; message < kMessageCount; ++message) {
+          ASSERT_TRUE(producer.Push(std::size_t{message}));
+        }
+      });
+
+  auto consumer = queue->GetConsumer();
+  std::size_t expected = 0;
+  std::array<std::size_t, 5> values{};
+  while (const auto count = consumer.PopMany(values)) {
+    for (std::size_t j = 0; j < count; ++j) {
+      ASSERT_EQ(values[j], expected++);
+    }
+  }
+  EXPECT_EQ(expected, kMessageCount);
+  producer_task.Get();
+}
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,195 @@
+#include <userver/concurrent/broadcast_channel.hpp>
+
+#include <string>
+#include <vector>
+
+#include <userver/engine/sleep.hpp>
+#include <userver/utest/utest.hpp>
+#include <userver/utils/async.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+using Channel = concurrent::BroadcastChannel<std::string>;
+using Status = concurrent::BroadcastReadStatus;
+using Policy = concurrent::BroadcastLagPolicy;
+
+constexpr std::size_t kSubscribersCount = 4;
+constexpr std::size_t kMessageCount = 1000;
+
+}  // namespace
+
+UTEST(BroadcastChannel, Capacity) {
+  EXPECT_EQ(Channel::Create(0)->GetCapacity(), 2);
+  EXPECT_EQ(Channel::Create(4)->GetCapacity(), 4);
+  EXPECT_EQ(Channel::Create(5)->GetCapacity(), 8);
+}
+
+UTEST(BroadcastChannel, FanOutSharesMessage) {
+  auto channel = Channel::Create(4);
+  auto first = channel->Subscribe();
+  auto second = channel->Subscribe();
+
+  channel->Publish("event");
+  EXPECT_EQ(channel->GetPublishedCount(), 1);
+
+  Channel::Message first_message;
+  Channel::Message second_message;
+  ASSERT_EQ(first.TryRead(first_message), Status::kOk);
+  ASSERT_EQ(second.TryRead(second_message), Status::kOk);
+  EXPECT_EQ(*first_message, "event");
+  // No copies per subscriber
+  EXPECT_EQ(first_message.get(), second_message.get());
+
+  EXPECT_EQ(first.TryRead(first_message), Status::kEmpty);
+}
+
+UTEST(BroadcastChannel, SubscriberReadsOnlyNewMessages) {
+  auto channel = Channel::Create(4);
+  channel->Publish("old");
+  auto subscriber = channel->Subscribe();
+  channel->Publish("new");
+
+  Channel::Message message;
+  ASSERT_EQ(subscriber.TryRead(message), Status::kOk);
+  EXPECT_EQ(*message, "new");
+  EXPECT_EQ(subscriber.TryRead(message), Status::kEmpty);
+}
+
+UTEST(BroadcastChannel, LagDrop) {
+  auto channel = Channel::Create(2);
+  auto subscriber = channel->Subscribe(Policy::kDrop);
+  for (int i = 0; i < 5; ++i) channel->Publish(std::to_string(i));
+
+  Channel::Message message;
+  ASSERT_EQ(subscriber.TryRead(message), Status::kOk);
+  EXPECT_EQ(*message, "3");
+  EXPECT_EQ(subscriber.GetLostCount(), 3);
+  ASSERT_EQ(subscriber.TryRead(message), Status::kOk);
+  EXPECT_EQ(*message, "4");
+}
+
+UTEST(BroadcastChannel, LagReport) {
+  auto channel = Channel::Create(2);
+  auto subscriber = channel->Subscribe(Policy::kReportLag);
+  for (int i = 0; i < 5; ++i) channel->Publish(std::to_string(i));
+
+  Channel::Message message;
+  ASSERT_EQ(subscriber.TryRead(message), Status::kLagged);
+  EXPECT_EQ(subscriber.GetLostCount(), 3);
+  ASSERT_EQ(subscriber.TryRead(message), Status::kOk);
+  EXPECT_EQ(*message, "3");
+  ASSERT_EQ(subscriber.TryRead(message), Status::kOk);
+  EXPECT_EQ(*message, "4");
+}
+
+UTEST(BroadcastChannel, LagDisconnect) {
+  auto channel = Channel::Create(2);
+  auto slow = channel->Subscribe(Policy::kDisconnect);
+  auto fast = channel->Subscribe(Policy::kDisconnect);
+
+  Channel::Message message;
+  for (int i = 0; i < 5; ++i) {
+    channel->Publish(std::to_string(i));
+    ASSERT_EQ(fast.TryRead(message), Status::kOk);
+  }
+
+  EXPECT_EQ(slow.TryRead(message), Status::kDisconnected);
+  channel->Publish("5");
+  EXPECT_EQ(slow.Read(message), Status::kDisconnected);
+  EXPECT_EQ(fast.Read(message), Status::kOk);
+}
+
+UTEST(BroadcastChannel, BlockingRead) {
+  auto channel = Channel::Create(2);
+  auto task =
+      utils::Async("subscriber", [subscriber = channel->Subscribe()]() mutable {
+        Channel::Message message;
+        EXPECT_EQ(subscriber.Read(message), Status::kOk);
+        return *message;
+      });
+  engine::SleepFor(std::chrono::milliseconds{10});
+  EXPECT_FALSE(task.IsFinished());
+
+  channel->Publish("event");
+  EXPECT_EQ(task.Get(), "event");
+}
+
+UTEST(BroadcastChannel, Deadline) {
+  auto channel = Channel::Create(2);
+  auto subscriber = channel->Subscribe();
+
+  Channel::Message message;
+  EXPECT_EQ(
+      subscriber.Read(message, engine::Deadline::FromDuration(
+                                   std::chrono::milliseconds{10})),
+      Status::kEmpty);
+}
+
+UTEST(BroadcastChannel, CloseDrainsMessages) {
+  auto channel = Channel::Create(2);
+  auto subscriber = channel->Subscribe();
+  channel->Publish("last");
+  channel->Close();
+
+  Channel::Message message;
+  ASSERT_EQ(subscriber.Read(message), Status::kOk);
+  EXPECT_EQ(*message, "last");
+  EXPECT_EQ(subscriber.Read(message), Status::kClosed);
+}
+
+UTEST(BroadcastChannel, CloseWakesUpSubscriber) {
+  auto channel = Channel::Create(2);
+  auto subscriber = channel->Subscribe();
+  auto task = utils::Async("subscriber", [&subscriber] {
+    Channel::Message message;
+    return subscriber.Read(message);
+  });
+  engine::SleepFor(std::chrono::milliseconds{10});
+
+  channel->Close();
+  EXPECT_EQ(task.Get(), Status::kClosed);
+}
+
+UTEST_MT(BroadcastChannel, FanOutMt, kSubscribersCount + 1) {
+  using IntChannel = concurrent::BroadcastChannel<std::size_t>;
+  // Small enough for the subscribers to lag
+  auto channel = IntChannel::Create(16);
+
+  std::vector<engine::TaskWithResult<void>> tasks;
+  tasks.reserve(kSubscribersCount);
+  for (std::size_t i = 0; i < kSubscribersCount; ++i) {
+    tasks.push_back(utils::Async(
+        "subscriber",
+        [subscriber = channel->Subscribe(Policy::kReportLag)]() mutable {
+          IntChannel::Message message;
+          std::size_t read_count = 0;
+          std::size_t min_expected = 0;
+          while (true) {
+            const auto status = subscriber.Read(message);
+            if (status == Status::kClosed) break;
+            if (status == Status::kLagged) continue;
+            ASSERT_EQ(status, Status::kOk);
+            // The messages are never reordered
+            ASSERT_GE(*message, min_expected);
+            min_expected = *message + 1;
+            ++read_count;
+          }
+          // Every message is either read or reported as lost
+          EXPECT_EQ(read_count + subscriber.GetLostCount(), kMessageCount);
+        }));
+  }
+
+  for (std::size_t message = 0; message < kMessageCount; ++message) {
+    channel->Publish(std::size_t{message});
+  }
+  channel->Close();
+
+  for (auto& task : tasks) {
+    task.Get();
+  }
+  EXPECT_EQ(channel->GetPublishedCount(), kMessageCount);
+}
+
+USERVER_NAMESPACE_END
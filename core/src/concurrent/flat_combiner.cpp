@@ -0,0 +1,37 @@
+#include <userver/concurrent/flat_combiner.hpp>
+
+#include <engine/impl/async_flat_combining_queue.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace concurrent::impl {
+
+struct FlatCombinerQueue::Impl final {
+  engine::impl::AsyncFlatCombiningQueue queue;
+};
+
+FlatCombinerQueue::FlatCombinerQueue() = default;
+
+FlatCombinerQueue::~FlatCombinerQueue() = default;
+
+void FlatCombinerQueue::Execute(FlatCombinerOperation& operation,
+                                void* state) noexcept {
+  auto consumer = impl_->queue.PushAndTryStartConsuming(operation);
+  if (!consumer.IsValid()) {
+    // Another task is combining, it will execute our operation
+    operation.done.WaitNonCancellable();
+    return;
+  }
+
+  std::move(consumer).ConsumeAndStop(
+      [&operation, state](SinglyLinkedBaseHook& node) noexcept {
+        auto& other = static_cast<FlatCombinerOperation&>(node);
+        other.Execute(state);
+        // The waiter may destroy the operation right after the Send
+        if (&other != &operation) other.done.Send();
+      });
+}
+
+}  // namespace concurrent::impl
+
+USERVER_NAMESPACE_END
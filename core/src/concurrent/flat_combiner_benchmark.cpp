@@ -0,0 +1,82 @@
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <mutex>
+
+#include <userver/concurrent/flat_combiner.hpp>
+#include <userver/engine/mutex.hpp>
+#include <userver/engine/run_standalone.hpp>
+#include <userver/utils/rand.hpp>
+#include <utils/impl/parallelize_benchmark.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+struct Stats {
+  void Account(std::uint64_t value) noexcept {
+    ++count;
+    sum += value;
+    max = std::max(max, value);
+  }
+
+  std::uint64_t count{0};
+  std::uint64_t sum{0};
+  std::uint64_t max{0};
+};
+
+std::uint64_t MakeValue() {
+  std::uint64_t value = 0;
+  for (int i = 0; i < 10; ++i) {
+    value += utils::Rand();
+  }
+  return value;
+}
+
+void SetCounters(benchmark::State& state, std::uint64_t total) {
+  const auto total_ops = static_cast<double>(total);
+  state.counters["ops"] =
+      benchmark::Counter(total_ops, benchmark::Counter::kIsRate);
+  state.counters["ops-per-thread"] = benchmark::Counter(
+      total_ops / state.range(0), benchmark::Counter::kIsRate);
+}
+
+}  // namespace
+
+void flat_combiner_stats(benchmark::State& state) {
+  engine::RunStandalone(state.range(0), [&] {
+    concurrent::FlatCombiner<Stats> stats;
+
+    RunParallelBenchmark(state, [&](auto& range) {
+      for ([[maybe_unused]] auto _ : range) {
+        const auto value = MakeValue();
+        stats.Execute([value](Stats& s) { s.Account(value); });
+      }
+    });
+
+    SetCounters(state, stats.GetUnsafe().count);
+  });
+}
+BENCHMARK(flat_combiner_stats)->RangeMultiplier(2)->Range(1, 32);
+
+void flat_combiner_mutex_stats(benchmark::State& state) {
+  engine::RunStandalone(state.range(0), [&] {
+    engine::Mutex mutex;
+    Stats stats;
+
+    RunParallelBenchmark(state, [&](auto& range) {
+      for ([[maybe_unused]] auto _ : range) {
+        const auto value = MakeValue();
+        std::lock_guard lock{mutex};
+        stats.Account(value);
+      }
+    });
+
+    SetCounters(state, stats.count);
+  });
+}
+BENCHMARK(flat_combiner_mutex_stats)->RangeMultiplier(2)->Range(1, 32);
+
+USERVER_NAMESPACE_END
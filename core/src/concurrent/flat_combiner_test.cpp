@@ -0,0 +1,74 @@
+#include <userver/concurrent/flat_combiner.hpp>
+
+#include <atomic>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include <userver/engine/async.hpp>
+#include <userver/engine/sleep.hpp>
+#include <userver/utest/utest.hpp>
+#include <userver/utils/fixed_array.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+constexpr std::size_t kTasks = 8;
+
+struct Stats {
+  std::uint64_t count{0};
+  std::uint64_t sum{0};
+};
+
+}  // namespace
+
+UTEST(FlatCombiner, Results) {
+  concurrent::FlatCombiner<std::vector<int>> combiner{3, 42};
+
+  EXPECT_EQ(combiner.Execute([](std::vector<int>& v) { return v.size(); }), 3);
+  combiner.Execute([](std::vector<int>& v) { v.push_back(1); });
+
+  std::string text = combiner.Execute([](std::vector<int>& v) {
+    return std::to_string(v.front()) + ',' + std::to_string(v.back());
+  });
+  EXPECT_EQ(text, "42,1");
+  EXPECT_EQ(combiner.GetUnsafe().size(), 4);
+}
+
+UTEST(FlatCombiner, Exception) {
+  concurrent::FlatCombiner<int> combiner{1};
+
+  EXPECT_THROW(combiner.Execute([](int&) -> int {
+    throw std::runtime_error("test");
+  }),
+               std::runtime_error);
+  EXPECT_EQ(combiner.Execute([](int& value) { return ++value; }), 2);
+}
+
+UTEST_MT(FlatCombiner, Contention, kTasks) {
+  constexpr std::uint64_t kIterations = 10000;
+  concurrent::FlatCombiner<Stats> combiner;
+
+  auto tasks = utils::GenerateFixedArray(kTasks, [&](std::size_t i) {
+    return engine::AsyncNoSpan([&, i] {
+      std::uint64_t last_count = 0;
+      for (std::uint64_t j = 0; j < kIterations; ++j) {
+        const auto count = combiner.Execute([i](Stats& stats) {
+          stats.sum += i;
+          return ++stats.count;
+        });
+        EXPECT_GT(count, last_count);
+        last_count = count;
+        if (j % 1000 == 0) engine::Yield();
+      }
+    });
+  });
+  for (auto& task : tasks) task.Get();
+
+  const auto& stats = combiner.GetUnsafe();
+  EXPECT_EQ(stats.count, kTasks * kIterations);
+  EXPECT_EQ(stats.sum, kTasks * (kTasks - 1) / 2 * kIterations);
+}
+
+USERVER_NAMESPACE_END
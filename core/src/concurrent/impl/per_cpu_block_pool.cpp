@@ -0,0 +1,132 @@
+#include <concurrent/impl/per_cpu_block_pool.hpp>
+
+#include <cstdint>
+#include <new>
+
+#include <userver/utils/assert.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace concurrent::impl {
+
+namespace {
+
+struct FreeBlock final {
+  FreeBlock* next{nullptr};
+};
+
+}  // namespace
+
+PerCpuBlockPool::PerCpuBlockPool(std::size_t block_size, std::size_t alignment,
+                                 std::size_t max_cached_per_cpu)
+    : block_size_(block_size),
+      alignment_(alignment),
+      max_cached_per_cpu_(max_cached_per_cpu) {
+  UINVARIANT(block_size_ >= sizeof(FreeBlock) &&
+                 alignment_ >= alignof(FreeBlock) &&
+                 block_size_ % alignment_ == 0,
+             "Invalid block size or alignment for PerCpuBlockPool");
+}
+
+void* PerCpuBlockPool::AllocateNew() {
+  return ::operator new(block_size_, std::align_val_t{alignment_});
+}
+
+void PerCpuBlockPool::DeallocateNow(void* block) noexcept {
+  ::operator delete(block, std::align_val_t{alignment_});
+}
+
+#ifdef USERVER_IMPL_HAS_RSEQ
+
+namespace {
+
+void AddToCount(StripedArray& counts, std::intptr_t value) noexcept {
+  // The count is updated on the CPU we are running on now, which may differ
+  // from the CPU of the list. It only makes the per-CPU counts approximate.
+  while (true) {
+    const auto cpu_id = rseq_cpu_start();
+    if (!IsCpuIdValid(cpu_id)) return;
+    const auto ret = rseq_addv(RSEQ_MO_RELAXED, RSEQ_PERCPU_CPU_ID,
+                               &counts[cpu_id], value, cpu_id);
+    if (rseq_likely(!ret)) return;
+  }
+}
+
+}  // namespace
+
+PerCpuBlockPool::~PerCpuBlockPool() {
+  for (auto& head : heads_.Elements()) {
+    auto* block = reinterpret_cast<FreeBlock*>(head);
+    while (block) {
+      auto* const next = block->next;
+      DeallocateNow(block);
+      block = next;
+    }
+    head = 0;
+  }
+}
+
+void* PerCpuBlockPool::Allocate() {
+  while (true) {
+    const auto cpu_id = rseq_cpu_start();
+    if (!IsCpuIdValid(cpu_id)) break;
+
+    std::intptr_t block = 0;
+    const auto ret = rseq_cmpnev_storeoffp_load(
+        RSEQ_MO_RELAXED, RSEQ_PERCPU_CPU_ID, &heads_[cpu_id], 0,
+        offsetof(FreeBlock, next), &block, cpu_id);
+    if (rseq_likely(!ret)) {
+      AddToCount(counts_, -1);
+      return reinterpret_cast<void*>(block);
+    }
+    // The list is empty
+    if (ret > 0) break;
+    // Otherwise the sequence was aborted by a preemption or a migration
+  }
+
+  return AllocateNew();
+}
+
+void PerCpuBlockPool::Deallocate(void* block) noexcept {
+  UASSERT(block);
+  auto* const free_block = ::new (block) FreeBlock{};
+
+  while (true) {
+    const auto cpu_id = rseq_cpu_start();
+    if (!IsCpuIdValid(cpu_id)) break;
+
+    const auto count = __atomic_load_n(&counts_[cpu_id], __ATOMIC_RELAXED);
+    if (count >= static_cast<std::intptr_t>(max_cached_per_cpu_)) break;
+
+    const auto head = __atomic_load_n(&heads_[cpu_id], __ATOMIC_RELAXED);
+    free_block->next = reinterpret_cast<FreeBlock*>(head);
+    const auto ret =
+        rseq_cmpeqv_storev(RSEQ_MO_RELAXED, RSEQ_PERCPU_CPU_ID,
+                           &heads_[cpu_id], head,
+                           reinterpret_cast<std::intptr_t>(free_block), cpu_id);
+    if (rseq_likely(!ret)) {
+      AddToCount(counts_, 1);
+      return;
+    }
+    // The head has changed, or the sequence was aborted
+  }
+
+  DeallocateNow(block);
+}
+
+#else
+
+PerCpuBlockPool::~PerCpuBlockPool() = default;
+
+void* PerCpuBlockPool::Allocate() { return AllocateNew(); }
+
+void PerCpuBlockPool::Deallocate(void* block) noexcept {
+  UASSERT(block);
+  DeallocateNow(block);
+}
+
+#endif
+
+}  // namespace concurrent::impl
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,63 @@
+#pragma once
+
+#include <cstddef>
+
+#include <concurrent/impl/rseq.hpp>
+
+#ifdef USERVER_IMPL_HAS_RSEQ
+#include <concurrent/impl/striped_array.hpp>
+#endif
+
+USERVER_NAMESPACE_BEGIN
+
+namespace concurrent::impl {
+
+/// A pool of same-sized memory blocks with a free list per CPU.
+///
+/// The per-CPU free lists are updated with rseq operations, so allocation and
+/// deallocation use neither atomic RMW operations nor locks, and a block
+/// freed on a CPU is reused by the next allocation on the same CPU while
+/// it is still in the cache. If rseq is unavailable, the blocks are allocated
+/// and freed with `::operator new` and `::operator delete` directly.
+///
+/// At most `max_cached_per_cpu` blocks (approximately, the per-CPU counters
+/// are not updated atomically with the lists) are kept per CPU, the rest are
+/// freed.
+class PerCpuBlockPool final {
+ public:
+  PerCpuBlockPool(std::size_t block_size, std::size_t alignment,
+                  std::size_t max_cached_per_cpu);
+
+  PerCpuBlockPool(PerCpuBlockPool&&) = delete;
+  PerCpuBlockPool& operator=(PerCpuBlockPool&&) = delete;
+
+  /// Must not be called concurrently with other methods
+  ~PerCpuBlockPool();
+
+  /// Never returns nullptr, may throw std::bad_alloc
+  void* Allocate();
+
+  /// Returns a block obtained from Allocate() of the same pool
+  void Deallocate(void* block) noexcept;
+
+  std::size_t GetBlockSize() const noexcept { return block_size_; }
+
+ private:
+  void* AllocateNew();
+  void DeallocateNow(void* block) noexcept;
+
+  const std::size_t block_size_;
+  const std::size_t alignment_;
+  const std::size_t max_cached_per_cpu_;
+
+#ifdef USERVER_IMPL_HAS_RSEQ
+  // Heads of the intrusive free lists
+  StripedArray heads_;
+  // Approximate lengths of the free lists
+  StripedArray counts_;
+#endif
+};
+
+}  // namespace concurrent::impl
+
+USERVER_NAMESPACE_END
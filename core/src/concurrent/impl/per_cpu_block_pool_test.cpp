@@ -0,0 +1,64 @@
+#include <concurrent/impl/per_cpu_block_pool.hpp>
+
+#include <cstdint>
+#include <cstring>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+constexpr std::size_t kBlockSize = 128;
+constexpr std::size_t kAlignment = 64;
+
+}  // namespace
+
+TEST(PerCpuBlockPool, AllocateDeallocate) {
+  concurrent::impl::PerCpuBlockPool pool{kBlockSize, kAlignment, 8};
+  EXPECT_EQ(pool.GetBlockSize(), kBlockSize);
+
+  std::vector<void*> blocks;
+  for (int i = 0; i < 32; ++i) {
+    auto* const block = pool.Allocate();
+    ASSERT_NE(block, nullptr);
+    EXPECT_EQ(reinterpret_cast<std::uintptr_t>(block) % kAlignment, 0);
+    std::memset(block, i, kBlockSize);
+    blocks.push_back(block);
+  }
+  for (auto* block : blocks) pool.Deallocate(block);
+  for (int i = 0; i < 32; ++i) pool.Deallocate(pool.Allocate());
+}
+
+TEST(PerCpuBlockPool, MultiThreaded) {
+  constexpr std::size_t kThreads = 4;
+  constexpr std::size_t kIterations = 10000;
+  concurrent::impl::PerCpuBlockPool pool{kBlockSize, kAlignment, 16};
+
+  std::vector<std::thread> threads;
+  for (std::size_t i = 0; i < kThreads; ++i) {
+    threads.emplace_back([&pool, i] {
+      std::vector<unsigned char*> blocks;
+      for (std::size_t j = 0; j < kIterations; ++j) {
+        auto* block = static_cast<unsigned char*>(pool.Allocate());
+        std::memset(block, static_cast<int>(i), kBlockSize);
+        blocks.push_back(block);
+        if (blocks.size() == 8) {
+          for (auto* b : blocks) {
+            // No one else has written to the block while we owned it
+            ASSERT_EQ(b[0], i);
+            ASSERT_EQ(b[kBlockSize - 1], i);
+            pool.Deallocate(b);
+          }
+          blocks.clear();
+        }
+      }
+      for (auto* b : blocks) pool.Deallocate(b);
+    });
+  }
+  for (auto& thread : threads) thread.join();
+}
+
+USERVER_NAMESPACE_END
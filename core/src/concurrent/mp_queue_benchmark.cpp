@@ -1,5 +1,6 @@
 #include <benchmark/benchmark.h>
 
+#include <userver/concurrent/bounded_queue.hpp>
 #include <userver/concurrent/mpsc_queue.hpp>
 #include <userver/concurrent/queue.hpp>
 #include <userver/engine/run_standalone.hpp>
@@ -31,6 +32,32 @@ auto GetConsumerTask(std::shared_ptr<QueueType> queue,
     }
   });
 }
+template <typename QueueType>
+auto GetBatchProducerTask(std::shared_ptr<QueueType> queue,
+                          std::atomic<bool>& run, std::size_t batch_size) {
+  return utils::Async("producer", [producer = queue->GetProducer(), &run,
+                                   batch_size] {
+    std::vector<std::size_t> batch(batch_size);
+    while (run) {
+      const auto res = producer.PushMany(batch);
+      benchmark::DoNotOptimize(res);
+    }
+  });
+}
+
+template <typename QueueType>
+auto GetBatchConsumerTask(std::shared_ptr<QueueType> queue,
+                          const std::atomic<bool>& run,
+                          std::size_t batch_size) {
+  return utils::Async("consumer", [consumer = queue->GetConsumer(), &run,
+                                   batch_size] {
+    std::vector<std::size_t> batch(batch_size);
+    while (run) {
+      const auto res = consumer.PopMany(batch);
+      benchmark::DoNotOptimize(res);
+    }
+  });
+}
 }  // namespace
 
 template <typename QueueType>
@@ -67,6 +94,43 @@ void producer_consumer(benchmark::State& state) {
   });
 }
 
+// Elements are pushed and popped in batches of state.range(3)
+template <typename QueueType>
+void producer_consumer_batch(benchmark::State& state) {
+  engine::RunStandalone(state.range(0) + state.range(1), [&] {
+    std::size_t ProducersCount = state.range(0);
+    std::size_t ConsumersCount = state.range(1);
+    std::size_t QueueSize = state.range(2);
+    std::size_t BatchSize = state.range(3);
+
+    std::atomic<bool> run{true};
+    auto queue = QueueType::Create(QueueSize);
+
+    std::vector<engine::TaskWithResult<void>> tasks;
+    tasks.reserve(ProducersCount + ConsumersCount - 1);
+    for (std::size_t i = 0; i < ProducersCount - 1; ++i) {
+      tasks.push_back(GetBatchProducerTask(queue, run, BatchSize));
+    }
+
+    for (std::size_t i = 0; i < ConsumersCount; ++i) {
+      tasks.push_back(GetBatchConsumerTask(queue, run, BatchSize));
+    }
+
+    // Current thread work
+    {
+      auto producer = queue->GetProducer();
+      std::vector<std::size_t> batch(BatchSize);
+      for ([[maybe_unused]] auto _ : state) {
+        const auto res = producer.PushMany(batch);
+        benchmark::DoNotOptimize(res);
+      }
+      state.SetItemsProcessed(state.iterations() * BatchSize);
+    }
+
+    run = false;
+  });
+}
+
 BENCHMARK_TEMPLATE(producer_consumer, concurrent::NonFifoMpmcQueue<std::size_t>)
     ->RangeMultiplier(2)
     ->Ranges({{1, 4}, {1, 4}, {128, 512}});
@@ -95,4 +159,35 @@ BENCHMARK_TEMPLATE(producer_consumer, concurrent::MpscQueue<std::size_t>)
     ->RangeMultiplier(2)
     ->Ranges({{1, 4}, {1, 1}, {1'000'000'000, 1'000'000'000}});
 
+BENCHMARK_TEMPLATE(producer_consumer, concurrent::SpscQueue<std::size_t>)
+    ->RangeMultiplier(2)
+    ->Ranges({{1, 1}, {1, 1}, {128, 512}});
+
+// Bounded ring-buffer queues, compare with the runs of the same size above
+
+BENCHMARK_TEMPLATE(producer_consumer,
+                   concurrent::BoundedMpmcQueue<std::size_t>)
+    ->RangeMultiplier(2)
+    ->Ranges({{1, 4}, {1, 4}, {128, 512}});
+
+BENCHMARK_TEMPLATE(producer_consumer,
+                   concurrent::BoundedMpscQueue<std::size_t>)
+    ->RangeMultiplier(2)
+    ->Ranges({{1, 4}, {1, 1}, {128, 512}});
+
+BENCHMARK_TEMPLATE(producer_consumer,
+                   concurrent::BoundedSpscQueue<std::size_t>)
+    ->RangeMultiplier(2)
+    ->Ranges({{1, 1}, {1, 1}, {128, 512}});
+
+BENCHMARK_TEMPLATE(producer_consumer_batch,
+                   concurrent::BoundedMpmcQueue<std::size_t>)
+    ->RangeMultiplier(4)
+    ->Ranges({{1, 4}, {1, 4}, {512, 512}, {1, 64}});
+
+BENCHMARK_TEMPLATE(producer_consumer_batch,
+                   concurrent::BoundedSpscQueue<std::size_t>)
+    ->RangeMultiplier(4)
+    ->Ranges({{1, 1}, {1, 1}, {512, 512}, {1, 64}});
+
 USERVER_NAMESPACE_END
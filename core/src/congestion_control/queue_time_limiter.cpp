@@ -0,0 +1,65 @@
+#include <congestion_control/queue_time_limiter.hpp>
+
+#include <userver/formats/json/value.hpp>
+#include <userver/logging/log.hpp>
+#include <userver/utils/atomic.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace congestion_control {
+
+QueueTimeLimiterConfig Parse(const formats::json::Value& value,
+                             formats::parse::To<QueueTimeLimiterConfig>) {
+  QueueTimeLimiterConfig result;
+  result.enabled = value["enabled"].As<bool>(result.enabled);
+  result.target = std::chrono::milliseconds{
+      value["target-ms"].As<std::chrono::milliseconds::rep>(
+          result.target.count())};
+  result.interval = std::chrono::milliseconds{
+      value["interval-ms"].As<std::chrono::milliseconds::rep>(
+          result.interval.count())};
+  return result;
+}
+
+bool QueueTimeLimiter::Admit(Clock::duration queue_time, Clock::time_point now,
+                             const QueueTimeLimiterConfig& config) noexcept {
+  auto interval_start = interval_start_.load(std::memory_order_relaxed);
+  if (now - interval_start >= config.interval &&
+      interval_start_.compare_exchange_strong(interval_start, now,
+                                              std::memory_order_relaxed)) {
+    // The winner of the race closes the interval, the queue times accounted
+    // concurrently may go to either interval
+    const auto min_queue_time = min_queue_time_.exchange(
+        Clock::duration::max(), std::memory_order_relaxed);
+    const bool is_standing = min_queue_time != Clock::duration::max() &&
+                             min_queue_time > config.target;
+    const bool was_standing =
+        is_queue_standing_.exchange(is_standing, std::memory_order_relaxed);
+    if (is_standing && !was_standing) {
+      LOG_WARNING() << "Standing request queue is detected, min queue time "
+                       "in the last interval is "
+                    << std::chrono::duration_cast<std::chrono::microseconds>(
+                           min_queue_time)
+                           .count()
+                    << "us, dropping the requests queued for longer than "
+                    << config.target.count() << "ms";
+    } else if (!is_standing && was_standing) {
+      LOG_WARNING() << "Standing request queue is gone";
+    }
+  }
+
+  utils::AtomicMin(min_queue_time_, queue_time);
+
+  const auto limit = is_queue_standing_.load(std::memory_order_relaxed)
+                         ? Clock::duration{config.target}
+                         : Clock::duration{config.interval};
+  return queue_time <= limit;
+}
+
+bool QueueTimeLimiter::IsQueueStanding() const noexcept {
+  return is_queue_standing_.load(std::memory_order_relaxed);
+}
+
+}  // namespace congestion_control
+
+USERVER_NAMESPACE_END
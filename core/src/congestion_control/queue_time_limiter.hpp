@@ -0,0 +1,57 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+
+#include <userver/formats/json_fwd.hpp>
+#include <userver/formats/parse/to.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace congestion_control {
+
+struct QueueTimeLimiterConfig final {
+  bool enabled{false};
+  /// Acceptable standing queue time
+  std::chrono::milliseconds target{5};
+  /// Window to detect a standing queue in, also the queue time limit for the
+  /// requests while there is no standing queue
+  std::chrono::milliseconds interval{100};
+};
+
+QueueTimeLimiterConfig Parse(const formats::json::Value& value,
+                             formats::parse::To<QueueTimeLimiterConfig>);
+
+/// @brief Drops requests that have been queued for too long, CoDel-style.
+///
+/// The queue time is the time from the request arrival to the start of its
+/// handling, it includes the wait in the task processor queue. A queue is
+/// standing if even the shortest queue time in the last `interval` exceeded
+/// `target`: short bursts are absorbed by the queue, but a standing queue only
+/// adds latency. While the queue is standing, the requests queued for longer
+/// than `target` are dropped, so the queue drains and the latency of the
+/// admitted requests stays bounded. Otherwise, only the requests queued for
+/// longer than `interval` are dropped.
+///
+/// This is the variant of CoDel from "Fail at Scale" by Ben Maurer, it does
+/// not need to control the dequeue order. Thread-safe.
+class QueueTimeLimiter final {
+ public:
+  using Clock = std::chrono::steady_clock;
+
+  /// Accounts the queue time of a request that has just been dequeued and
+  /// returns whether to handle the request
+  bool Admit(Clock::duration queue_time, Clock::time_point now,
+             const QueueTimeLimiterConfig& config) noexcept;
+
+  bool IsQueueStanding() const noexcept;
+
+ private:
+  std::atomic<Clock::time_point> interval_start_{Clock::time_point{}};
+  std::atomic<Clock::duration> min_queue_time_{Clock::duration::max()};
+  std::atomic<bool> is_queue_standing_{false};
+};
+
+}  // namespace congestion_control
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,94 @@
+#include <congestion_control/queue_time_limiter.hpp>
+
+#include <gtest/gtest.h>
+
+#include <userver/formats/json/serialize.hpp>
+#include <userver/formats/json/value.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+using Clock = congestion_control::QueueTimeLimiter::Clock;
+using std::chrono::milliseconds;
+
+const congestion_control::QueueTimeLimiterConfig kConfig{true, milliseconds{5},
+                                                         milliseconds{100}};
+
+// Feeds requests with the same queue time over the whole interval
+bool FeedInterval(congestion_control::QueueTimeLimiter& limiter,
+                  Clock::time_point& now, Clock::duration queue_time) {
+  bool all_admitted = true;
+  for (int i = 0; i < 10; ++i) {
+    all_admitted &= limiter.Admit(queue_time, now, kConfig);
+    now += milliseconds{10};
+  }
+  return all_admitted;
+}
+
+}  // namespace
+
+TEST(QueueTimeLimiter, Parse) {
+  const auto config =
+      formats::json::FromString(R"({"enabled": true, "target-ms": 10})")
+          .As<congestion_control::QueueTimeLimiterConfig>();
+  EXPECT_TRUE(config.enabled);
+  EXPECT_EQ(config.target, milliseconds{10});
+  EXPECT_EQ(config.interval, milliseconds{100});
+}
+
+TEST(QueueTimeLimiter, ShortQueue) {
+  congestion_control::QueueTimeLimiter limiter;
+  auto now = Clock::now();
+
+  for (int i = 0; i < 10; ++i) {
+    EXPECT_TRUE(FeedInterval(limiter, now, milliseconds{1}));
+    EXPECT_FALSE(limiter.IsQueueStanding());
+  }
+}
+
+TEST(QueueTimeLimiter, BurstIsAbsorbed) {
+  congestion_control::QueueTimeLimiter limiter;
+  auto now = Clock::now();
+  EXPECT_TRUE(FeedInterval(limiter, now, milliseconds{1}));
+
+  // A burst longer than the target, but some requests pass quickly
+  for (int i = 0; i < 10; ++i) {
+    EXPECT_TRUE(limiter.Admit(milliseconds{i == 5 ? 1 : 50}, now, kConfig));
+    now += milliseconds{10};
+  }
+  EXPECT_TRUE(FeedInterval(limiter, now, milliseconds{1}));
+  EXPECT_FALSE(limiter.IsQueueStanding());
+}
+
+TEST(QueueTimeLimiter, LongQueueTimeIsDropped) {
+  congestion_control::QueueTimeLimiter limiter;
+  auto now = Clock::now();
+
+  // Even without a standing queue
+  EXPECT_FALSE(limiter.Admit(milliseconds{150}, now, kConfig));
+  EXPECT_FALSE(limiter.IsQueueStanding());
+}
+
+TEST(QueueTimeLimiter, StandingQueue) {
+  congestion_control::QueueTimeLimiter limiter;
+  auto now = Clock::now();
+  EXPECT_TRUE(FeedInterval(limiter, now, milliseconds{1}));
+
+  // The queue time exceeds the target for the whole interval
+  EXPECT_TRUE(FeedInterval(limiter, now, milliseconds{20}));
+  EXPECT_FALSE(limiter.IsQueueStanding());
+
+  // The queue is standing, the requests above the target are dropped
+  EXPECT_FALSE(limiter.Admit(milliseconds{20}, now, kConfig));
+  EXPECT_TRUE(limiter.IsQueueStanding());
+  EXPECT_TRUE(limiter.Admit(milliseconds{3}, now, kConfig));
+  now += milliseconds{10};
+
+  // The queue drains
+  FeedInterval(limiter, now, milliseconds{3});
+  EXPECT_TRUE(limiter.Admit(milliseconds{20}, now, kConfig));
+  EXPECT_FALSE(limiter.IsQueueStanding());
+}
+
+USERVER_NAMESPACE_END
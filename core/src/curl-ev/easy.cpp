@@ -216,6 +216,11 @@ void easy::cancel(size_t request_num) {
   }
 }
 
+void easy::unpause(std::error_code& ec) {
+  ec = std::error_code{static_cast<errc::EasyErrorCode>(
+      native::curl_easy_pause(handle_, CURLPAUSE_CONT))};
+}
+
 void easy::do_ev_cancel(size_t request_num) {
   // RunInEvLoopAsync(do_ev_async_perform) and RunInEvLoopSync(do_ev_cancel) are
   // not synchronized. So we need to count last cancelled request to prevent its
@@ -604,7 +609,7 @@ void easy::set_share(std::shared_ptr<share> share) {
 void easy::set_share(std::shared_ptr<share> share, std::error_code& ec) {
   share_ = std::move(share);
 
-  if (share) {
+  if (share_) {
     ec = std::error_code{
         static_cast<errc::EasyErrorCode>(native::curl_easy_setopt(
             handle_, native::CURLOPT_SHARE, share_->native_handle()))};
@@ -222,6 +222,9 @@ class easy final : public std::enable_shared_from_this<easy> {
   void async_perform(handler_type handler);
   void cancel();
   void reset();
+  // Resumes a transfer paused by a read or write callback. Must be called
+  // from the ev thread of the multi.
+  void unpause(std::error_code& ec);
   void set_source(std::shared_ptr<std::istream> source);
   void set_source(std::shared_ptr<std::istream> source, std::error_code& ec);
   void set_sink(std::string* sink);
@@ -236,6 +239,7 @@ class easy final : public std::enable_shared_from_this<easy> {
   // behavior options
 
   IMPLEMENT_CURL_OPTION_BOOLEAN(set_verbose, native::CURLOPT_VERBOSE);
+  IMPLEMENT_CURL_OPTION_BOOLEAN(set_pipewait, native::CURLOPT_PIPEWAIT);
   IMPLEMENT_CURL_OPTION_BOOLEAN(set_header, native::CURLOPT_HEADER);
   IMPLEMENT_CURL_OPTION_BOOLEAN(set_no_progress, native::CURLOPT_NOPROGRESS);
   IMPLEMENT_CURL_OPTION_BOOLEAN(set_no_signal, native::CURLOPT_NOSIGNAL);
@@ -37,6 +37,8 @@ const char* GetSetterName(native::CURLMoption option) {
       return "SetMaxHostConnections";
     case native::CURLMOPT_MAXCONNECTS:
       return "SetConnectionCacheSize";
+    case native::CURLMOPT_MAX_CONCURRENT_STREAMS:
+      return "SetMaxConcurrentStreams";
     default:
       return "<unknown setter>";
   }
@@ -58,6 +60,8 @@ class multi::Impl final {
   easy_set_type easy_handles_;
   engine::ev::TimerWatcher timer_;
   int still_running_{0};
+  // Accessed from the ev thread only
+  bool multiplexing_enabled_{false};
 };
 
 multi::Impl::Impl(engine::ev::ThreadControl& thread_control, multi& object)
@@ -108,6 +112,13 @@ multi::~multi() {
 
 void multi::add(easy* easy_handle) {
   pimpl_->easy_handles_.insert(easy_handle);
+  if (pimpl_->multiplexing_enabled_) {
+    // Wait for a connection that can be multiplexed instead of opening
+    // a new one for every concurrent request to the same host
+    std::error_code ec;
+    easy_handle->set_pipewait(true, ec);
+    if (ec) LOG_WARNING() << "set_pipewait failed: " << ec.message();
+  }
   add_handle(easy_handle->native_handle());
 }
 
@@ -140,7 +151,10 @@ void multi::CheckRateLimit(const char* url_str, std::error_code& ec) {
 }
 
 void multi::SetMultiplexingEnabled(bool value) {
-  SetOptionAsync(native::CURLMOPT_PIPELINING, value ? 1 : 0);
+  SetOptionAsync(native::CURLMOPT_PIPELINING,
+                 value ? CURLPIPE_MULTIPLEX : CURLPIPE_NOTHING);
+  GetThreadControl().RunInEvLoopAsync(
+      [this, value] { pimpl_->multiplexing_enabled_ = value; });
 }
 
 void multi::SetMaxHostConnections(long value) {
@@ -151,6 +165,10 @@ void multi::SetConnectionCacheSize(long value) {
   SetOptionAsync(native::CURLMOPT_MAXCONNECTS, value);
 }
 
+void multi::SetMaxConcurrentStreams(long value) {
+  SetOptionAsync(native::CURLMOPT_MAX_CONCURRENT_STREAMS, value);
+}
+
 void multi::add_handle(native::CURL* native_easy) {
   std::error_code ec{static_cast<errc::MultiErrorCode>(
       native::curl_multi_add_handle(handle_, native_easy))};
@@ -0,0 +1,42 @@
+#include <userver/dump/blocked_filter_bloom.hpp>
+
+#include <string>
+
+#include <userver/dump/test_helpers.hpp>
+#include <userver/utest/utest.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+TEST(DumpBlockedFilterBloom, WriteRead) {
+  utils::BlockedFilterBloom<std::string> filter(1024);
+  filter.Add("foo");
+  filter.Add("bar");
+
+  const auto restored =
+      dump::FromBinary<utils::BlockedFilterBloom<std::string>>(
+          dump::ToBinary(filter));
+  EXPECT_EQ(restored.GetBytes(), filter.GetBytes());
+  EXPECT_TRUE(restored.Contains("foo"));
+  EXPECT_TRUE(restored.Contains("bar"));
+}
+
+TEST(DumpBlockedFilterBloom, Counting) {
+  utils::BlockedCountingFilterBloom<int> filter(256);
+  filter.Increment(1);
+  filter.Increment(1);
+
+  const auto restored =
+      dump::FromBinary<utils::BlockedCountingFilterBloom<int>>(
+          dump::ToBinary(filter));
+  EXPECT_EQ(restored.GetBytes(), filter.GetBytes());
+  EXPECT_LE(2, restored.Estimate(1));
+}
+
+TEST(DumpBlockedFilterBloom, InvalidSize) {
+  UEXPECT_THROW(
+      dump::FromBinary<utils::BlockedFilterBloom<int>>(
+          dump::ToBinary(std::string(63, '\0'))),
+      dump::Error);
+}
+
+USERVER_NAMESPACE_END
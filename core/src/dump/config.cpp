@@ -18,9 +18,13 @@ constexpr std::string_view kDumpFormatVersion = "format-version";
 constexpr std::string_view kMaxDumpCount = "max-count";
 constexpr std::string_view kWorldReadable = "world-readable";
 constexpr std::string_view kEncrypted = "encrypted";
+constexpr std::string_view kCompressed = "compressed";
+constexpr std::string_view kCompressionParallelism = "compression-parallelism";
+constexpr std::string_view kMmap = "mmap";
 
 constexpr auto kDefaultFsTaskProcessor = std::string_view{"fs-task-processor"};
 constexpr auto kDefaultMaxDumpCount = uint64_t{1};
+constexpr auto kDefaultCompressionParallelism = std::size_t{4};
 
 }  // namespace
 
@@ -67,6 +71,10 @@ Config::Config(std::string name, const yaml_config::YamlConfig& config,
           config[kMaxDumpAge].As<std::optional<std::chrono::milliseconds>>()),
       max_dump_age_set(config.HasMember(kMaxDumpAge)),
       dump_is_encrypted(config[kEncrypted].As<bool>(false)),
+      dump_is_compressed(config[kCompressed].As<bool>(false)),
+      compression_parallelism(config[kCompressionParallelism].As<std::size_t>(
+          kDefaultCompressionParallelism)),
+      use_mmap(config[kMmap].As<bool>(false)),
       static_dumps_enabled(config[kDumpsEnabled].As<bool>()),
       static_min_dump_interval(
           config[kMinDumpInterval].As<std::chrono::milliseconds>(0)) {
@@ -78,6 +86,10 @@ Config::Config(std::string name, const yaml_config::YamlConfig& config,
     throw std::logic_error(
         fmt::format("{}: {} must not be 0", this->name, kMaxDumpCount));
   }
+  if (compression_parallelism == 0) {
+    throw std::logic_error(fmt::format("{}: {} must not be 0", this->name,
+                                       kCompressionParallelism));
+  }
 }
 
 DynamicConfig::DynamicConfig(const Config& config, ConfigPatch&& patch)
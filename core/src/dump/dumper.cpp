@@ -31,6 +31,7 @@
 
 #include <dump/dump_locator.hpp>
 #include <dump/statistics.hpp>
+#include <dump/write_limiter.hpp>
 #include <userver/components/dump_configurator.hpp>
 #include <userver/dump/config.hpp>
 #include <userver/dump/factory.hpp>
@@ -396,6 +397,8 @@ rcu::ReadablePtr<DynamicConfig> Dumper::Impl::ReadConfigForPeriodicTask() {
 }
 
 void Dumper::Impl::OnConfigUpdate(const dynamic_config::Snapshot& config) {
+  impl::GetWriteLimiter().SetConfig(config[impl::kWriteLimitsConfig]);
+
   auto optional_patch = utils::FindOptional(config[kConfigSet], Name());
   auto patch = std::move(optional_patch).value_or(ConfigPatch{});
   DynamicConfig new_config{static_config_, std::move(patch)};
@@ -574,6 +577,19 @@ properties:
                 type: boolean
                 description: Whether to encrypt the dump
                 defaultDescription: false
+            compressed:
+                type: boolean
+                description: Whether to compress the dump with zstd
+                defaultDescription: false
+            compression-parallelism:
+                type: integer
+                description: Max number of dump blocks compressed or decompressed in parallel
+                defaultDescription: 4
+                minimum: 1
+            mmap:
+                type: boolean
+                description: Whether to read the dump by mapping the file into memory, see dump::MmapFileReader; ignored for encrypted dumps
+                defaultDescription: false
 )");
 }
 
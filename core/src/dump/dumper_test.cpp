@@ -6,6 +6,7 @@
 #include <vector>
 
 #include <dump/internal_helpers_test.hpp>
+#include <dump/write_limiter.hpp>
 #include <userver/components/component_base.hpp>
 #include <userver/dump/common.hpp>
 #include <userver/dump/common_containers.hpp>
@@ -106,7 +107,8 @@ class DumperFixture : public ::testing::Test {
   dump::Config config_;
   testsuite::DumpControl control_;
   utils::statistics::Storage statistics_storage_;
-  dynamic_config::StorageMock config_storage_{{dump::kConfigSet, {}}};
+  dynamic_config::StorageMock config_storage_{
+      {dump::kConfigSet, {}}, {dump::impl::kWriteLimitsConfig, {}}};
   DummyEntity dumpable_;
 };
 
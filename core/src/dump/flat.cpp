@@ -0,0 +1,149 @@
+#include <userver/dump/flat.hpp>
+
+#include <utility>
+
+#include <boost/crc.hpp>
+#include <fmt/format.h>
+
+#include <userver/dump/common.hpp>
+#include <userver/dump/operations_file.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace dump {
+
+namespace {
+
+constexpr std::size_t kSizeBytes = sizeof(std::uint64_t);
+
+std::uint32_t Checksum(std::string_view bytes) {
+  boost::crc_32_type crc;
+  crc.process_bytes(bytes.data(), bytes.size());
+  return crc.checksum();
+}
+
+}  // namespace
+
+FlatBuffer::FlatBuffer(std::string bytes) {
+  auto owner = std::make_shared<const std::string>(std::move(bytes));
+  bytes_ = *owner;
+  owner_ = std::move(owner);
+}
+
+FlatBuffer::FlatBuffer(std::shared_ptr<const void> owner,
+                       std::string_view bytes)
+    : owner_(std::move(owner)), bytes_(bytes) {}
+
+void FlatStringTable::Builder::Reserve(std::size_t count,
+                                       std::size_t total_size) {
+  ends_.reserve(count);
+  arena_.reserve(total_size);
+}
+
+void FlatStringTable::Builder::Add(std::string_view value) {
+  arena_.append(value);
+  ends_.push_back(arena_.size());
+}
+
+FlatStringTable FlatStringTable::Builder::Build() && {
+  const std::uint64_t size = ends_.size();
+  std::string bytes;
+  bytes.reserve(kSizeBytes * (ends_.size() + 1) + arena_.size());
+  bytes.append(reinterpret_cast<const char*>(&size), kSizeBytes);
+  bytes.append(reinterpret_cast<const char*>(ends_.data()),
+               kSizeBytes * ends_.size());
+  bytes.append(arena_);
+
+  ends_.clear();
+  arena_.clear();
+  return FlatStringTable{FlatBuffer{std::move(bytes)}};
+}
+
+FlatStringTable::FlatStringTable(FlatBuffer buffer)
+    : buffer_(std::move(buffer)),
+      size_(impl::ReadFlatSize(buffer_.GetBytes())) {
+  const auto bytes = buffer_.GetBytes();
+  if (bytes.empty()) return;
+
+  if (size_ > bytes.size() / kSizeBytes - 1) {
+    impl::ThrowInvalidFlatBuffer("FlatStringTable");
+  }
+  const auto header_size = kSizeBytes * (size_ + 1);
+  arena_ = bytes.data() + header_size;
+
+  // The contents are covered by the checksum, only the offsets are validated
+  std::uint64_t prev_end = 0;
+  for (std::size_t i = 0; i < size_; ++i) {
+    const auto end = GetEnd(i);
+    if (end < prev_end) impl::ThrowInvalidFlatBuffer("FlatStringTable");
+    prev_end = end;
+  }
+  if (prev_end != bytes.size() - header_size) {
+    impl::ThrowInvalidFlatBuffer("FlatStringTable");
+  }
+}
+
+std::string_view FlatStringTable::operator[](std::size_t index) const noexcept {
+  UASSERT(index < size_);
+  const auto begin = index == 0 ? 0 : GetEnd(index - 1);
+  return {arena_ + begin, static_cast<std::size_t>(GetEnd(index) - begin)};
+}
+
+std::uint64_t FlatStringTable::GetEnd(std::size_t index) const noexcept {
+  std::uint64_t end = 0;
+  std::memcpy(&end, buffer_.GetBytes().data() + kSizeBytes * (index + 1),
+              kSizeBytes);
+  return end;
+}
+
+namespace impl {
+
+void WriteFlatBuffer(Writer& writer, const FlatBuffer& buffer) {
+  const auto bytes = buffer.GetBytes();
+  writer.Write(bytes.size());
+  WriteStringViewUnsafe(writer, bytes);
+  WriteTrivial(writer, Checksum(bytes));
+}
+
+FlatBuffer ReadFlatBuffer(Reader& reader) {
+  const auto size = reader.Read<std::size_t>();
+
+  auto buffer = [&reader, size] {
+    if (auto* mmap_reader = dynamic_cast<MmapFileReader*>(&reader)) {
+      return mmap_reader->ReadShared(size);
+    }
+    return FlatBuffer{std::string{ReadStringViewUnsafe(reader, size)}};
+  }();
+
+  if (ReadTrivial<std::uint32_t>(reader) != Checksum(buffer.GetBytes())) {
+    throw Error("Checksum mismatch of a flat dump structure");
+  }
+  return buffer;
+}
+
+std::size_t ReadFlatSize(std::string_view bytes) {
+  if (bytes.empty()) return 0;
+  if (bytes.size() < kSizeBytes) ThrowInvalidFlatBuffer("flat structure");
+
+  std::uint64_t size = 0;
+  std::memcpy(&size, bytes.data(), kSizeBytes);
+  return size;
+}
+
+void ThrowInvalidFlatBuffer(std::string_view type) {
+  throw Error(fmt::format("Invalid {} in the dump", type));
+}
+
+}  // namespace impl
+
+void Write(Writer& writer, const FlatStringTable& value) {
+  impl::WriteFlatBuffer(writer, value.GetBuffer());
+}
+
+FlatStringTable Read(Reader& reader, To<FlatStringTable>) {
+  return FlatStringTable{impl::ReadFlatBuffer(reader)};
+}
+
+}  // namespace dump
+
+USERVER_NAMESPACE_END
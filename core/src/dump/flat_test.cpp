@@ -0,0 +1,121 @@
+#include <userver/dump/flat.hpp>
+
+#include <string>
+#include <vector>
+
+#include <boost/filesystem/operations.hpp>
+
+#include <userver/dump/common.hpp>
+#include <userver/dump/operations_file.hpp>
+#include <userver/dump/test_helpers.hpp>
+#include <userver/fs/blocking/temp_directory.hpp>
+#include <userver/tracing/span.hpp>
+#include <userver/utest/utest.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+const std::vector<std::string> kStrings{"foo", "", "bar",
+                                        std::string(1000, 'x'), ""};
+
+dump::FlatStringTable MakeTable(const std::vector<std::string>& values) {
+  dump::FlatStringTable::Builder builder;
+  for (const auto& value : values) builder.Add(value);
+  return std::move(builder).Build();
+}
+
+void ExpectEqual(const dump::FlatStringTable& table,
+                 const std::vector<std::string>& expected) {
+  ASSERT_EQ(table.size(), expected.size());
+  for (std::size_t i = 0; i < expected.size(); ++i) {
+    EXPECT_EQ(table[i], expected[i]);
+  }
+}
+
+}  // namespace
+
+TEST(DumpFlat, StringTable) {
+  const auto table = MakeTable(kStrings);
+  ExpectEqual(table, kStrings);
+  ExpectEqual(dump::FromBinary<dump::FlatStringTable>(dump::ToBinary(table)),
+              kStrings);
+}
+
+TEST(DumpFlat, EmptyStringTable) {
+  EXPECT_TRUE(dump::FromBinary<dump::FlatStringTable>(
+                  dump::ToBinary(dump::FlatStringTable{}))
+                  .empty());
+  EXPECT_TRUE(dump::FromBinary<dump::FlatStringTable>(
+                  dump::ToBinary(MakeTable({})))
+                  .empty());
+}
+
+TEST(DumpFlat, Array) {
+  const std::vector<std::int64_t> values{1, -2, 3, 1LL << 40};
+  const auto array = dump::FromBinary<dump::FlatArray<std::int64_t>>(
+      dump::ToBinary(dump::FlatArray<std::int64_t>{values}));
+
+  ASSERT_EQ(array.size(), values.size());
+  for (std::size_t i = 0; i < values.size(); ++i) {
+    EXPECT_EQ(array[i], values[i]);
+  }
+  EXPECT_EQ(array.ToVector(), values);
+}
+
+TEST(DumpFlat, ChecksumMismatch) {
+  auto data = dump::ToBinary(MakeTable(kStrings));
+  data[data.size() / 2] ^= 1;
+  EXPECT_THROW(dump::FromBinary<dump::FlatStringTable>(std::move(data)),
+               dump::Error);
+}
+
+TEST(DumpFlat, InvalidOffsets) {
+  std::string bytes(3 * sizeof(std::uint64_t), '\0');
+  const std::uint64_t header[] = {2, 5, 3};
+  std::memcpy(bytes.data(), header, sizeof(header));
+  bytes += "abcde";
+  EXPECT_THROW(dump::FlatStringTable{dump::FlatBuffer{bytes}}, dump::Error);
+}
+
+UTEST(DumpFlat, MmapFileReader) {
+  const auto dir = fs::blocking::TempDirectory::Create();
+  const auto path = dir.GetPath() + "/dump";
+
+  auto scope_time = tracing::Span::CurrentSpan().CreateScopeTime("dump");
+  dump::FileWriter writer(path, boost::filesystem::perms::owner_read,
+                          scope_time);
+  writer.Write(42);
+  writer.Write(MakeTable(kStrings));
+  writer.Write(std::string{"tail"});
+  writer.Finish();
+
+  dump::FlatStringTable table;
+  {
+    dump::MmapFileReader reader(path);
+    EXPECT_EQ(reader.Read<int>(), 42);
+    table = reader.Read<dump::FlatStringTable>();
+    EXPECT_EQ(reader.Read<std::string>(), "tail");
+    reader.Finish();
+  }
+
+  // The table keeps the mapping alive
+  boost::filesystem::remove(path);
+  ExpectEqual(table, kStrings);
+}
+
+UTEST(DumpFlat, MmapEmptyFile) {
+  const auto dir = fs::blocking::TempDirectory::Create();
+  const auto path = dir.GetPath() + "/dump";
+
+  auto scope_time = tracing::Span::CurrentSpan().CreateScopeTime("dump");
+  dump::FileWriter writer(path, boost::filesystem::perms::owner_read,
+                          scope_time);
+  writer.Finish();
+
+  dump::MmapFileReader reader(path);
+  EXPECT_THROW(reader.Read<int>(), dump::Error);
+  reader.Finish();
+}
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,193 @@
+#include <userver/dump/operations_compressed.hpp>
+
+#include <algorithm>
+#include <cstdint>
+#include <utility>
+
+#include <fmt/format.h>
+
+#include <userver/compression/zstd.hpp>
+#include <userver/dump/common.hpp>
+#include <userver/dump/unsafe.hpp>
+#include <userver/engine/async.hpp>
+#include <userver/utils/assert.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace dump {
+
+namespace {
+
+// Format:
+// 1. kMagic
+// 2. Blocks: uncompressed size (non-zero), size-prefixed zstd frame
+// 3. End marker: uncompressed size of 0
+constexpr std::string_view kMagic = "userver-zstd-dump\x01";
+
+// Large enough for a good compression ratio, small enough for the blocks of
+// a dump to be spread across the workers
+constexpr std::size_t kBlockSize = 1 << 20;
+
+// Dumps are written in the background, the speed matters more than the ratio
+constexpr int kCompressionLevel = 1;
+
+}  // namespace
+
+CompressedWriter::CompressedWriter(std::unique_ptr<Writer> base,
+                                   std::size_t parallelism)
+    : base_(std::move(base)), parallelism_(parallelism) {
+  UINVARIANT(base_, "No base writer");
+  UINVARIANT(parallelism_ > 0, "parallelism must be positive");
+  WriteStringViewUnsafe(*base_, kMagic);
+  block_.reserve(kBlockSize);
+}
+
+CompressedWriter::~CompressedWriter() = default;
+
+void CompressedWriter::WriteRaw(std::string_view data) {
+  while (!data.empty()) {
+    const auto size = std::min(data.size(), kBlockSize - block_.size());
+    block_.append(data.substr(0, size));
+    data.remove_prefix(size);
+    if (block_.size() == kBlockSize) SubmitBlock();
+  }
+}
+
+void CompressedWriter::Finish() {
+  if (!block_.empty()) SubmitBlock();
+  while (!in_flight_.empty()) WriteOldestBlock();
+
+  base_->Write(std::uint64_t{0});
+  base_->Finish();
+}
+
+void CompressedWriter::SubmitBlock() {
+  UASSERT(!block_.empty());
+  if (in_flight_.size() >= parallelism_) WriteOldestBlock();
+
+  // Runs in the current task processor, the blocking one of the dump
+  in_flight_.push_back(engine::AsyncNoSpan(
+      [block = std::move(block_)] {
+        try {
+          return Block{block.size(),
+                       compression::zstd::Compress(block, kCompressionLevel)};
+        } catch (const compression::CompressionError& ex) {
+          throw Error(
+              fmt::format("Failed to compress a dump block: {}", ex.what()));
+        }
+      }));
+
+  block_ = {};
+  block_.reserve(kBlockSize);
+}
+
+void CompressedWriter::WriteOldestBlock() {
+  UASSERT(!in_flight_.empty());
+  const auto block = in_flight_.front().Get();
+  in_flight_.pop_front();
+
+  base_->Write(std::uint64_t{block.size});
+  base_->Write(block.compressed);
+}
+
+CompressedReader::CompressedReader(std::unique_ptr<Reader> base,
+                                   std::size_t parallelism)
+    : base_(std::move(base)), parallelism_(parallelism) {
+  UINVARIANT(base_, "No base reader");
+  UINVARIANT(parallelism_ > 0, "parallelism must be positive");
+  if (ReadUnsafeAtMost(*base_, kMagic.size()) != kMagic) {
+    throw Error("The dump is not compressed or is corrupted");
+  }
+}
+
+CompressedReader::~CompressedReader() = default;
+
+std::string_view CompressedReader::ReadRaw(std::size_t max_size) {
+  if (block_.size() - block_pos_ < max_size) {
+    if (block_pos_ != block_.size()) return ReadAcrossBlocks(max_size);
+    if (!FetchBlock()) return {};
+    if (block_.size() < max_size) return ReadAcrossBlocks(max_size);
+  }
+
+  const std::string_view result{block_.data() + block_pos_, max_size};
+  block_pos_ += max_size;
+  return result;
+}
+
+std::string_view CompressedReader::ReadAcrossBlocks(std::size_t max_size) {
+  curr_chunk_.assign(block_, block_pos_);
+  block_pos_ = block_.size();
+
+  while (curr_chunk_.size() < max_size && FetchBlock()) {
+    const auto size = std::min(max_size - curr_chunk_.size(), block_.size());
+    curr_chunk_.append(block_, 0, size);
+    block_pos_ = size;
+  }
+  return curr_chunk_;
+}
+
+bool CompressedReader::FetchBlock() {
+  while (!is_base_exhausted_ && in_flight_.size() < parallelism_) {
+    const auto size = base_->Read<std::uint64_t>();
+    if (size == 0) {
+      is_base_exhausted_ = true;
+      break;
+    }
+    if (size > kBlockSize) {
+      throw Error(fmt::format("Invalid dump block size {}", size));
+    }
+
+    in_flight_.push_back(engine::AsyncNoSpan(
+        [size, compressed = base_->Read<std::string>()] {
+          std::string block;
+          try {
+            block = compression::zstd::Decompress(compressed, size);
+          } catch (const compression::DecompressionError& ex) {
+            throw Error(fmt::format("Failed to decompress a dump block: {}",
+                                    ex.what()));
+          }
+          if (block.size() != size) {
+            throw Error(fmt::format(
+                "Dump block size mismatch: expected={}, actual={}", size,
+                block.size()));
+          }
+          return block;
+        }));
+  }
+
+  if (in_flight_.empty()) return false;
+
+  block_ = in_flight_.front().Get();
+  in_flight_.pop_front();
+  block_pos_ = 0;
+  return true;
+}
+
+void CompressedReader::Finish() {
+  if (block_pos_ != block_.size() || FetchBlock()) {
+    throw Error("Unexpected extra data at the end of the compressed dump");
+  }
+  base_->Finish();
+}
+
+CompressedOperationsFactory::CompressedOperationsFactory(
+    std::unique_ptr<OperationsFactory> base, std::size_t parallelism)
+    : base_(std::move(base)), parallelism_(parallelism) {
+  UINVARIANT(base_, "No base operations factory");
+}
+
+std::unique_ptr<Reader> CompressedOperationsFactory::CreateReader(
+    std::string full_path) {
+  return std::make_unique<CompressedReader>(
+      base_->CreateReader(std::move(full_path)), parallelism_);
+}
+
+std::unique_ptr<Writer> CompressedOperationsFactory::CreateWriter(
+    std::string full_path, tracing::ScopeTime& scope) {
+  return std::make_unique<CompressedWriter>(
+      base_->CreateWriter(std::move(full_path), scope), parallelism_);
+}
+
+}  // namespace dump
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,120 @@
+#include <userver/utest/utest.hpp>
+
+#include <string>
+
+#include <boost/filesystem/operations.hpp>
+
+#include <userver/dump/common.hpp>
+#include <userver/dump/operations_compressed.hpp>
+#include <userver/dump/operations_file.hpp>
+#include <userver/fs/blocking/temp_directory.hpp>
+#include <userver/tracing/span.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+constexpr std::size_t kParallelism = 2;
+
+std::unique_ptr<dump::Writer> MakeWriter(const std::string& path,
+                                         tracing::ScopeTime& scope) {
+  return std::make_unique<dump::CompressedWriter>(
+      std::make_unique<dump::FileWriter>(
+          path, boost::filesystem::perms::owner_read, scope),
+      kParallelism);
+}
+
+std::unique_ptr<dump::Reader> MakeReader(const std::string& path) {
+  return std::make_unique<dump::CompressedReader>(
+      std::make_unique<dump::FileReader>(path), kParallelism);
+}
+
+// Strings of different sizes, so that some of them span several blocks
+std::string MakeString(int i) {
+  return std::string(static_cast<std::size_t>(i) * 10'007, 'a' + i % 26);
+}
+
+}  // namespace
+
+UTEST(DumpCompressedFile, Smoke) {
+  const auto dir = fs::blocking::TempDirectory::Create();
+  const auto path = dir.GetPath() + "/file";
+
+  auto scope_time = tracing::Span::CurrentSpan().CreateScopeTime("dump");
+  auto writer = MakeWriter(path, scope_time);
+  writer->Write(1);
+  UEXPECT_NO_THROW(writer->Finish());
+
+  auto reader = MakeReader(path);
+  EXPECT_EQ(reader->Read<int32_t>(), 1);
+
+  UEXPECT_THROW(reader->Read<int32_t>(), dump::Error);
+
+  UEXPECT_NO_THROW(reader->Finish());
+}
+
+UTEST(DumpCompressedFile, EmptyDump) {
+  const auto dir = fs::blocking::TempDirectory::Create();
+  const auto path = dir.GetPath() + "/file";
+
+  auto scope_time = tracing::Span::CurrentSpan().CreateScopeTime("dump");
+  auto writer = MakeWriter(path, scope_time);
+  UEXPECT_NO_THROW(writer->Finish());
+
+  auto reader = MakeReader(path);
+  UEXPECT_NO_THROW(reader->Finish());
+}
+
+UTEST_MT(DumpCompressedFile, ManyBlocks, 4) {
+  const auto dir = fs::blocking::TempDirectory::Create();
+  const auto path = dir.GetPath() + "/file";
+  constexpr int kCount = 100;
+
+  std::size_t total_size = 0;
+  auto scope_time = tracing::Span::CurrentSpan().CreateScopeTime("dump");
+  auto writer = MakeWriter(path, scope_time);
+  for (int i = 0; i < kCount; ++i) {
+    const auto value = MakeString(i);
+    writer->Write(value);
+    total_size += value.size();
+  }
+  UEXPECT_NO_THROW(writer->Finish());
+
+  EXPECT_LT(boost::filesystem::file_size(path), total_size / 100);
+
+  auto reader = MakeReader(path);
+  for (int i = 0; i < kCount; ++i) {
+    EXPECT_EQ(reader->Read<std::string>(), MakeString(i));
+  }
+  UEXPECT_NO_THROW(reader->Finish());
+}
+
+UTEST(DumpCompressedFile, UnreadData) {
+  const auto dir = fs::blocking::TempDirectory::Create();
+  const auto path = dir.GetPath() + "/file";
+
+  auto scope_time = tracing::Span::CurrentSpan().CreateScopeTime("dump");
+  auto writer = MakeWriter(path, scope_time);
+  writer->Write(MakeString(50));
+  writer->Write(MakeString(60));
+  UEXPECT_NO_THROW(writer->Finish());
+
+  auto reader = MakeReader(path);
+  EXPECT_EQ(reader->Read<std::string>(), MakeString(50));
+  UEXPECT_THROW(reader->Finish(), dump::Error);
+}
+
+UTEST(DumpCompressedFile, NotCompressed) {
+  const auto dir = fs::blocking::TempDirectory::Create();
+  const auto path = dir.GetPath() + "/file";
+
+  auto scope_time = tracing::Span::CurrentSpan().CreateScopeTime("dump");
+  dump::FileWriter writer(path, boost::filesystem::perms::owner_read,
+                          scope_time);
+  writer.Write(std::string(100, 'a'));
+  writer.Finish();
+
+  UEXPECT_THROW(MakeReader(path), dump::Error);
+}
+
+USERVER_NAMESPACE_END
@@ -13,6 +13,8 @@
 #include <userver/utils/assert.hpp>
 #include <userver/utils/cpu_relax.hpp>
 
+#include <dump/write_limiter.hpp>
+
 USERVER_NAMESPACE_BEGIN
 
 namespace dump {
@@ -77,6 +79,8 @@ EncryptedWriter::~EncryptedWriter() = default;
 
 void EncryptedWriter::WriteRaw(std::string_view data) {
   // 2. Data
+  // The sink writes the ciphertext on its own, so only the bandwidth is limited
+  impl::GetWriteLimiter().AcquireBytes(data.size());
   impl_->filter->Put(reinterpret_cast<const unsigned char*>(data.data()),
                      data.size());
   impl_->cpu_relax_.Relax(data.size());
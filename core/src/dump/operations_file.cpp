@@ -1,33 +1,77 @@
 #include <userver/dump/operations_file.hpp>
 
 #include <algorithm>
+#include <cerrno>
+#include <cstdio>
 #include <stdexcept>
+#include <system_error>
 #include <utility>
 
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+
 #include <fmt/format.h>
 
+#include <userver/fs/blocking/file_descriptor.hpp>
 #include <userver/fs/blocking/write.hpp>
 
+#include <dump/write_limiter.hpp>
+#include <utils/check_syscall.hpp>
+
 USERVER_NAMESPACE_BEGIN
 
 namespace dump {
 
 namespace {
+
 constexpr std::size_t kCheckTimeAfterBytes{1 << 15};
+
+// The data is written with a syscall per that much
+constexpr std::size_t kWriteBufferSize{1 << 20};
+
+int GetFileDescriptor(fs::blocking::CFile& file) {
+  return ::fileno(file.GetNative());
+}
+
+void SyncData(int fd) {
+#ifdef __linux__
+  utils::CheckSyscall(::fdatasync(fd), "calling ::fdatasync");
+#else
+  utils::CheckSyscall(::fsync(fd), "calling ::fsync");
+#endif
 }
 
+// Only clean pages are dropped, so must be called after the sync
+void DropPageCache([[maybe_unused]] int fd,
+                   [[maybe_unused]] std::uint64_t offset,
+                   [[maybe_unused]] std::uint64_t size) {
+#ifdef __linux__
+  // Advisory, the failures are harmless
+  ::posix_fadvise(fd, static_cast<off_t>(offset), static_cast<off_t>(size),
+                  POSIX_FADV_DONTNEED);
+#endif
+}
+
+}  // namespace
+
 FileWriter::FileWriter(std::string path, boost::filesystem::perms perms,
                        tracing::ScopeTime& scope)
     : final_path_(std::move(path)),
       path_(final_path_ + ".tmp"),
       perms_(perms),
-      cpu_relax_(kCheckTimeAfterBytes, &scope) {
+      cpu_relax_(kCheckTimeAfterBytes, &scope),
+      sync_interval_bytes_(
+          impl::GetWriteLimiter().GetConfig().sync_interval_bytes),
+      drop_page_cache_(impl::GetWriteLimiter().GetConfig().drop_page_cache) {
   constexpr fs::blocking::OpenMode mode{
       fs::blocking::OpenFlag::kWrite, fs::blocking::OpenFlag::kExclusiveCreate};
   const auto tmp_perms = perms_ | boost::filesystem::perms::owner_write;
 
   try {
     file_ = fs::blocking::CFile{path_, mode, tmp_perms};
+    // buffer_ is used instead, so that each write is a single syscall
+    std::setvbuf(file_.GetNative(), nullptr, _IONBF, 0);
   } catch (const std::exception& ex) {
     throw Error(fmt::format("Failed to open the dump file for write \"{}\": {}",
                             path_, ex.what()));
@@ -35,21 +79,58 @@ FileWriter::FileWriter(std::string path, boost::filesystem::perms perms,
 }
 
 void FileWriter::WriteRaw(std::string_view data) {
+  if (buffer_.capacity() < kWriteBufferSize) buffer_.reserve(kWriteBufferSize);
+  buffer_.append(data);
+  if (buffer_.size() >= kWriteBufferSize) WriteBuffer();
+  cpu_relax_.Relax(data.size());
+}
+
+void FileWriter::WriteBuffer() {
+  if (buffer_.empty()) return;
+
+  auto& limiter = impl::GetWriteLimiter();
+  limiter.AcquireOp();
+  limiter.AcquireBytes(buffer_.size());
+
   try {
-    file_.Write(data);
+    file_.Write(buffer_);
   } catch (const std::exception& ex) {
     throw Error(fmt::format("Failed to write to the dump file \"{}\": {}",
                             path_, ex.what()));
   }
-  cpu_relax_.Relax(data.size());
+  written_bytes_ += buffer_.size();
+  buffer_.clear();
+
+  // Without the periodic syncs the kernel may accumulate gigabytes of dirty
+  // pages and then write them back all at once, stalling the other writers
+  if (sync_interval_bytes_ != 0 &&
+      written_bytes_ - synced_bytes_ >= sync_interval_bytes_) {
+    Sync();
+  }
+}
+
+void FileWriter::Sync() {
+  const auto fd = GetFileDescriptor(file_);
+  try {
+    SyncData(fd);
+  } catch (const std::exception& ex) {
+    throw Error(fmt::format("Failed to sync the dump file \"{}\": {}", path_,
+                            ex.what()));
+  }
+  if (drop_page_cache_) {
+    DropPageCache(fd, synced_bytes_, written_bytes_ - synced_bytes_);
+  }
+  synced_bytes_ = written_bytes_;
 }
 
 void FileWriter::Finish() {
+  WriteBuffer();
   try {
     // Flush must be performed at some point before Rename, otherwise after a
     // system's hard reset the file might end up in a state where it is renamed,
     // but truncated.
     file_.Flush();
+    if (drop_page_cache_) DropPageCache(GetFileDescriptor(file_), 0, 0);
     std::move(file_).Close();
     fs::blocking::Chmod(path_, perms_);  // drop perms::owner_write
     fs::blocking::Rename(path_, final_path_);
@@ -116,11 +197,85 @@ void FileReader::Finish() {
   }
 }
 
-FileOperationsFactory::FileOperationsFactory(boost::filesystem::perms perms)
-    : perms_(perms) {}
+struct MmapFileReader::Mapping final {
+  Mapping() = default;
+  Mapping(const Mapping&) = delete;
+  Mapping& operator=(const Mapping&) = delete;
+
+  ~Mapping() {
+    if (data != nullptr) ::munmap(const_cast<char*>(data), size);
+  }
+
+  const char* data{nullptr};
+  std::size_t size{0};
+};
+
+MmapFileReader::MmapFileReader(std::string path) : path_(std::move(path)) {
+  try {
+    auto fd = fs::blocking::FileDescriptor::Open(
+        path_, fs::blocking::OpenFlag::kRead);
+    auto mapping = std::make_shared<Mapping>();
+    mapping->size = fd.GetSize();
+
+    // mmap fails for empty files
+    if (mapping->size != 0) {
+      void* data = ::mmap(nullptr, mapping->size, PROT_READ, MAP_PRIVATE,
+                          fd.GetNative(), 0);
+      if (data == MAP_FAILED) {
+        throw std::system_error(errno, std::system_category(),
+                                "Error while mapping the file");
+      }
+      mapping->data = static_cast<const char*>(data);
+    }
+
+    // The mapping stays valid after the file is closed
+    std::move(fd).Close();
+    mapping_ = std::move(mapping);
+  } catch (const std::exception& ex) {
+    throw Error(fmt::format(
+        "Failed to open the dump file for reading \"{}\". Reason: {}", path_,
+        ex.what()));
+  }
+}
+
+MmapFileReader::~MmapFileReader() = default;
+
+std::string_view MmapFileReader::ReadRaw(std::size_t max_size) {
+  const auto size = std::min(max_size, mapping_->size - position_);
+  const std::string_view result{mapping_->data + position_, size};
+  position_ += size;
+  return result;
+}
+
+FlatBuffer MmapFileReader::ReadShared(std::size_t size) {
+  if (mapping_->size - position_ < size) {
+    throw Error(
+        fmt::format("Unexpected end-of-file while trying to read from the dump "
+                    "file \"{}\": requested-size={}",
+                    path_, size));
+  }
+  FlatBuffer result{mapping_, {mapping_->data + position_, size}};
+  position_ += size;
+  return result;
+}
+
+void MmapFileReader::Finish() {
+  if (position_ != mapping_->size) {
+    throw Error(
+        fmt::format("Unexpected extra data at the end of the dump file \"{}\": "
+                    "file-size={}, position={}, unread-size={}",
+                    path_, mapping_->size, position_,
+                    mapping_->size - position_));
+  }
+}
+
+FileOperationsFactory::FileOperationsFactory(boost::filesystem::perms perms,
+                                             bool use_mmap)
+    : perms_(perms), use_mmap_(use_mmap) {}
 
 std::unique_ptr<Reader> FileOperationsFactory::CreateReader(
     std::string full_path) {
+  if (use_mmap_) return std::make_unique<MmapFileReader>(std::move(full_path));
   return std::make_unique<FileReader>(std::move(full_path));
 }
 
@@ -10,6 +10,8 @@
 #include <userver/tracing/span.hpp>
 #include <userver/utest/utest.hpp>
 
+#include <dump/write_limiter.hpp>
+
 USERVER_NAMESPACE_BEGIN
 
 namespace {
@@ -78,6 +80,35 @@ UTEST(DumpOperationsFile, EmptyStringDump) {
   reader.Finish();
 }
 
+UTEST(DumpOperationsFile, WriteLimited) {
+  const auto dir = fs::blocking::TempDirectory::Create();
+  const auto path = DumpFilePath(dir);
+
+  auto& limiter = dump::impl::GetWriteLimiter();
+  dump::impl::WriteLimitsConfig config;
+  config.bytes_per_second = 1 << 30;
+  config.ops_per_second = 1000;
+  config.sync_interval_bytes = 1 << 20;
+  config.drop_page_cache = true;
+  limiter.SetConfig(config);
+
+  // Several write syscalls and syncs
+  const std::string chunk(100'000, 'a');
+  constexpr std::size_t kChunks = 50;
+
+  auto scope_time = tracing::Span::CurrentSpan().CreateScopeTime("dump");
+  dump::FileWriter writer(path, boost::filesystem::perms::owner_read,
+                          scope_time);
+  for (std::size_t i = 0; i < kChunks; ++i) {
+    WriteStringViewUnsafe(writer, chunk);
+  }
+  writer.Finish();
+  limiter.SetConfig({});
+
+  EXPECT_EQ(fs::blocking::ReadFileContents(path),
+            std::string(chunk.size() * kChunks, 'a'));
+}
+
 TEST(DumpOperationsFile, Overread) {
   const auto file = fs::blocking::TempFile::Create();
   fs::blocking::RewriteFileContents(file.GetPath(), std::string(10, 'a'));
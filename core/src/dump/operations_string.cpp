@@ -0,0 +1,43 @@
+#include <userver/dump/operations_string.hpp>
+
+#include <algorithm>
+#include <utility>
+
+#include <fmt/format.h>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace dump {
+
+StringWriter::StringWriter() = default;
+
+void StringWriter::WriteRaw(std::string_view data) { data_.append(data); }
+
+void StringWriter::Finish() {
+  // nothing to do
+}
+
+std::string StringWriter::Extract() && { return std::move(data_); }
+
+StringReader::StringReader(std::string_view data)
+    : data_(data), unread_data_(data) {}
+
+std::string_view StringReader::ReadRaw(std::size_t max_size) {
+  const auto result_size = std::min(max_size, unread_data_.size());
+  const auto result = unread_data_.substr(0, result_size);
+  unread_data_ = unread_data_.substr(result_size);
+  return result;
+}
+
+void StringReader::Finish() {
+  if (!unread_data_.empty()) {
+    throw Error(fmt::format(
+        "Unexpected extra data at the end of the serialized value: size={}, "
+        "position={}, unread-size={}",
+        data_.size(), data_.size() - unread_data_.size(), unread_data_.size()));
+  }
+}
+
+}  // namespace dump
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,27 @@
+#include <userver/dump/operations_string.hpp>
+
+#include <map>
+#include <string>
+
+#include <gtest/gtest.h>
+
+#include <userver/dump/common.hpp>
+#include <userver/dump/common_containers.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+TEST(DumpOperationsString, RoundTrip) {
+  const std::map<std::string, int> value{{"a", 1}, {"bb", 2}};
+  const auto data = dump::WriteToString(value);
+  EXPECT_EQ((dump::ReadFromString<std::map<std::string, int>>(data)), value);
+}
+
+TEST(DumpOperationsString, Malformed) {
+  const auto data = dump::WriteToString(std::string(100, 'a'));
+  EXPECT_THROW(dump::ReadFromString<std::string>(data.substr(0, 50)),
+               dump::Error);
+  EXPECT_THROW(dump::ReadFromString<std::string>(data + "extra"),
+               dump::Error);
+}
+
+USERVER_NAMESPACE_END
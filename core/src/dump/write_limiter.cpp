@@ -0,0 +1,104 @@
+#include <dump/write_limiter.hpp>
+
+#include <algorithm>
+#include <chrono>
+
+#include <userver/engine/sleep.hpp>
+#include <userver/engine/task/cancel.hpp>
+#include <userver/formats/json/value.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace dump::impl {
+
+namespace {
+
+constexpr std::chrono::milliseconds kMinRefillInterval{10};
+constexpr std::chrono::milliseconds kPollInterval{10};
+
+// Allows bursts of up to 100ms worth of tokens
+constexpr std::size_t kBurstsPerSecond = 10;
+
+void Configure(utils::TokenBucket& bucket, std::size_t rate_per_second) {
+  if (rate_per_second == 0) {
+    bucket.SetMaxSize(-1UL);
+    bucket.SetInstantRefillPolicy();
+    return;
+  }
+
+  const auto interval =
+      std::max<std::chrono::steady_clock::duration>(
+          kMinRefillInterval, std::chrono::seconds{1} / rate_per_second);
+  const auto amount = std::max<std::size_t>(
+      1, rate_per_second * interval / std::chrono::seconds{1});
+  bucket.SetMaxSize(std::max(amount, rate_per_second / kBurstsPerSecond));
+  bucket.SetRefillPolicy({amount, interval});
+}
+
+void Acquire(utils::TokenBucket& bucket, std::size_t count) {
+  while (count != 0) {
+    const auto chunk = std::min(count, bucket.GetMaxSizeApprox());
+    while (!bucket.ObtainAll(chunk)) {
+      engine::InterruptibleSleepFor(kPollInterval);
+      engine::current_task::CancellationPoint();
+    }
+    count -= chunk;
+  }
+}
+
+}  // namespace
+
+WriteLimitsConfig Parse(const formats::json::Value& value,
+                        formats::parse::To<WriteLimitsConfig>) {
+  WriteLimitsConfig config;
+  config.bytes_per_second =
+      value["bytes-per-second"].As<std::size_t>(config.bytes_per_second);
+  config.ops_per_second =
+      value["ops-per-second"].As<std::size_t>(config.ops_per_second);
+  config.sync_interval_bytes =
+      value["sync-interval-bytes"].As<std::size_t>(config.sync_interval_bytes);
+  config.drop_page_cache =
+      value["drop-page-cache"].As<bool>(config.drop_page_cache);
+  return config;
+}
+
+const dynamic_config::Key<WriteLimitsConfig> kWriteLimitsConfig{
+    "USERVER_DUMPS_WRITE_LIMITS",
+    dynamic_config::DefaultAsJsonString{"{}"},
+};
+
+WriteLimiter::WriteLimiter()
+    : bytes_(utils::TokenBucket::MakeUnbounded()),
+      ops_(utils::TokenBucket::MakeUnbounded()) {}
+
+void WriteLimiter::SetConfig(const WriteLimitsConfig& config) {
+  const auto old_config = config_.Read();
+  if (old_config->bytes_per_second != config.bytes_per_second) {
+    Configure(bytes_, config.bytes_per_second);
+  }
+  if (old_config->ops_per_second != config.ops_per_second) {
+    Configure(ops_, config.ops_per_second);
+  }
+  config_.Assign(config);
+}
+
+WriteLimitsConfig WriteLimiter::GetConfig() const {
+  return config_.ReadCopy();
+}
+
+void WriteLimiter::AcquireBytes(std::size_t bytes) {
+  if (!bytes_.IsUnbounded()) Acquire(bytes_, bytes);
+}
+
+void WriteLimiter::AcquireOp() {
+  if (!ops_.IsUnbounded()) Acquire(ops_, 1);
+}
+
+WriteLimiter& GetWriteLimiter() {
+  static WriteLimiter limiter;
+  return limiter;
+}
+
+}  // namespace dump::impl
+
+USERVER_NAMESPACE_END
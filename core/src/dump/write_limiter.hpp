@@ -0,0 +1,57 @@
+#pragma once
+
+#include <cstddef>
+
+#include <userver/dynamic_config/snapshot.hpp>
+#include <userver/formats/json_fwd.hpp>
+#include <userver/rcu/rcu.hpp>
+#include <userver/utils/token_bucket.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace dump::impl {
+
+struct WriteLimitsConfig final {
+  // 0 - unlimited
+  std::size_t bytes_per_second{0};
+  // Write syscalls per second, 0 - unlimited
+  std::size_t ops_per_second{0};
+  // fdatasync the dump file each time that much is written, 0 - only at the
+  // end of the dump
+  std::size_t sync_interval_bytes{0};
+  // Drop the written pages from the page cache
+  bool drop_page_cache{false};
+};
+
+WriteLimitsConfig Parse(const formats::json::Value& value,
+                        formats::parse::To<WriteLimitsConfig>);
+
+extern const dynamic_config::Key<WriteLimitsConfig> kWriteLimitsConfig;
+
+/// Limits the bandwidth and the write syscalls of all the dump writes in the
+/// process, as all the dumps usually share the same disk
+class WriteLimiter final {
+ public:
+  WriteLimiter();
+
+  void SetConfig(const WriteLimitsConfig& config);
+  WriteLimitsConfig GetConfig() const;
+
+  /// Sleeps until `bytes` may be written
+  void AcquireBytes(std::size_t bytes);
+
+  /// Sleeps until one more write syscall may be done
+  void AcquireOp();
+
+ private:
+  rcu::Variable<WriteLimitsConfig> config_;
+  utils::TokenBucket bytes_;
+  utils::TokenBucket ops_;
+};
+
+/// The limiter shared by all the dumps of the process
+WriteLimiter& GetWriteLimiter();
+
+}  // namespace dump::impl
+
+USERVER_NAMESPACE_END
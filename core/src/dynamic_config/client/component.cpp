@@ -50,6 +50,9 @@ DynamicConfigClient::DynamicConfigClient(const ComponentConfig& config,
   client_config.config_url = config["config-url"].As<std::string>();
   client_config.fallback_to_no_proxy =
       config["fallback-to-no-proxy"].As<bool>(true);
+  client_config.long_poll_timeout =
+      config["long-poll-timeout"].As<std::chrono::milliseconds>(0);
+  client_config.zstd_compression = config["zstd-compression"].As<bool>(false);
 
   if (!client_config.stage_name.empty() &&
       client_config.get_configs_overrides_for_service) {
@@ -103,6 +106,16 @@ properties:
         type: boolean
         description: add default path '/configs/values' to 'config-url'
         defaultDescription: true
+    long-poll-timeout:
+        type: string
+        description: |
+          how long the server may hold an incremental request until the
+          configs change, 0 disables the long polling
+        defaultDescription: 0
+    zstd-compression:
+        type: boolean
+        description: ask the server for the zstd-compressed responses
+        defaultDescription: false
 )");
 }
 
@@ -2,10 +2,12 @@
 
 #include <vector>
 
+#include <userver/dynamic_config/impl/snapshot.hpp>
 #include <userver/dynamic_config/snapshot.hpp>
 #include <userver/dynamic_config/source.hpp>
 #include <userver/dynamic_config/storage_mock.hpp>
 #include <userver/dynamic_config/test_helpers.hpp>
+#include <userver/dynamic_config/value.hpp>
 #include <userver/formats/json/serialize.hpp>
 
 using namespace std::chrono_literals;
@@ -504,6 +506,33 @@ UTEST(DynamicConfig, JsonConfig) {
   EXPECT_EQ(snapshot[kJsonConfig], kJson);
 }
 
+const dynamic_config::Key<int> kSampleIntConfig{"SAMPLE_INT_CONFIG", 42};
+
+UTEST(DynamicConfig, ReparseOnlyChanged) {
+  using dynamic_config::impl::ConfigIdGetter;
+  using dynamic_config::impl::SnapshotData;
+
+  const auto docs_map = dynamic_config::impl::MakeDefaultDocsMap();
+  const SnapshotData config{docs_map, {}};
+
+  auto new_docs_map = docs_map;
+  new_docs_map.Set("SAMPLE_INT_CONFIG", formats::json::FromString("43"));
+  const SnapshotData new_config{new_docs_map, docs_map, config};
+
+  const auto int_id = ConfigIdGetter::Get(kSampleIntConfig);
+  EXPECT_EQ(new_config.Get<int>(int_id), 43);
+  EXPECT_FALSE(new_config.IsSameValue(int_id, config));
+
+  const auto struct_id = ConfigIdGetter::Get(kSampleStructConfig);
+  EXPECT_TRUE(new_config.IsSameValue(struct_id, config));
+  EXPECT_EQ(&new_config.Get<SampleStructConfig>(struct_id),
+            &config.Get<SampleStructConfig>(struct_id));
+
+  // Configs without a name are always parsed anew
+  const auto dummy_id = ConfigIdGetter::Get(kDummyConfig);
+  EXPECT_FALSE(new_config.IsSameValue(dummy_id, config));
+}
+
 }  // namespace
 
 USERVER_NAMESPACE_END
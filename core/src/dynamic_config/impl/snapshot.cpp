@@ -112,19 +112,57 @@ SnapshotData::SnapshotData(const std::vector<KeyValue>& config_variables) {
   user_configs_.resize(Registry().size());
 
   for (const auto& config_variable : config_variables) {
-    user_configs_[config_variable.GetId()] = config_variable.GetValue();
+    user_configs_[config_variable.GetId()] =
+        std::make_shared<const std::any>(config_variable.GetValue());
   }
 }
 
 SnapshotData::SnapshotData(const DocsMap& defaults,
                            const std::vector<KeyValue>& overrides)
     : SnapshotData(overrides) {
+  ParseMissing(defaults);
+}
+
+SnapshotData::SnapshotData(const SnapshotData& defaults,
+                           const std::vector<KeyValue>& overrides)
+    : SnapshotData(overrides) {
+  if (defaults.IsEmpty()) return;
+
+  for (const auto [id, factory] : utils::enumerate(Registry())) {
+    if (user_configs_[id]) continue;
+    user_configs_[id] = defaults.user_configs_[id];
+  }
+}
+
+SnapshotData::SnapshotData(const DocsMap& docs_map,
+                           const DocsMap& previous_docs_map,
+                           const SnapshotData& previous)
+    : SnapshotData(std::vector<KeyValue>{}) {
+  if (!previous.IsEmpty()) {
+    for (const auto [id, metadata] : utils::enumerate(Registry())) {
+      // Configs without a name may read any docs, they are always reparsed
+      const auto& name = metadata.name;
+      if (name.empty() || !docs_map.Has(name) ||
+          !previous_docs_map.Has(name)) {
+        continue;
+      }
+      // DocsMap::Get also marks the config as used
+      if (docs_map.Get(name) == previous_docs_map.Get(name)) {
+        user_configs_[id] = previous.user_configs_[id];
+      }
+    }
+  }
+  ParseMissing(docs_map);
+}
+
+void SnapshotData::ParseMissing(const DocsMap& docs_map) {
   utils::StreamingCpuRelax relax(1, nullptr);
   for (const auto [id, metadata] : utils::enumerate(Registry())) {
-    if (!user_configs_[id].has_value()) {
+    if (!user_configs_[id]) {
       relax.Relax(1);
       try {
-        user_configs_[id] = metadata.factory(defaults);
+        user_configs_[id] =
+            std::make_shared<const std::any>(metadata.factory(docs_map));
       } catch (const std::exception& ex) {
         throw ConfigParseError(
             fmt::format("{} while parsing dynamic config values. {}",
@@ -134,26 +172,21 @@ SnapshotData::SnapshotData(const DocsMap& defaults,
   }
 }
 
-SnapshotData::SnapshotData(const SnapshotData& defaults,
-                           const std::vector<KeyValue>& overrides)
-    : SnapshotData(overrides) {
-  if (defaults.IsEmpty()) return;
+bool SnapshotData::IsEmpty() const noexcept { return user_configs_.empty(); }
 
-  for (const auto [id, factory] : utils::enumerate(Registry())) {
-    if (user_configs_[id].has_value()) continue;
-    user_configs_[id] = defaults.user_configs_[id];
-  }
+bool SnapshotData::IsSameValue(ConfigId id,
+                               const SnapshotData& other) const noexcept {
+  UASSERT(id < user_configs_.size() && id < other.user_configs_.size());
+  return user_configs_[id] && user_configs_[id] == other.user_configs_[id];
 }
 
-bool SnapshotData::IsEmpty() const noexcept { return user_configs_.empty(); }
-
 const std::any& SnapshotData::DoGet(ConfigId id) const {
   UASSERT_MSG(id < user_configs_.size(), "SnapshotData is in an empty state.");
   const auto& config = user_configs_[id];
-  if (!config.has_value()) {
+  if (!config || !config->has_value()) {
     throw std::logic_error("This type is not registered as config");
   }
-  return config;
+  return *config;
 }
 
 }  // namespace dynamic_config::impl
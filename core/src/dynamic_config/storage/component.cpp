@@ -87,6 +87,9 @@ class DynamicConfig::Impl final {
   engine::TaskProcessor* fs_task_processor_;
 
   dynamic_config::impl::StorageData cache_;
+  // The source of the config in `cache_`, guarded by `set_config_mutex_`
+  dynamic_config::DocsMap parsed_docs_map_;
+  engine::Mutex set_config_mutex_;
   std::string fs_loading_error_msg_;
   dynamic_config::DocsMap fallback_config_;
 
@@ -181,7 +184,10 @@ void DynamicConfig::Impl::NotifyLoadingFailed(std::string_view updater,
 dynamic_config::impl::SnapshotData DynamicConfig::Impl::ParseConfig(
     const dynamic_config::DocsMap& value) {
   try {
-    dynamic_config::impl::SnapshotData config(value, {});
+    // Only the configs with a changed JSON are parsed, the rest are reused
+    const auto previous_config = cache_.Read();
+    dynamic_config::impl::SnapshotData config(value, parsed_docs_map_,
+                                              *previous_config);
     stats_.was_last_parse_successful = true;
     alert_storage_.StopAlertNow("config_parse_error");
     return config;
@@ -197,7 +203,9 @@ dynamic_config::impl::SnapshotData DynamicConfig::Impl::ParseConfig(
 }
 
 void DynamicConfig::Impl::DoSetConfig(const dynamic_config::DocsMap& value) {
+  const std::lock_guard lock(set_config_mutex_);
   auto config = ParseConfig(value);
+  parsed_docs_map_ = value;
 
   if (!value.GetConfigsExpectedToBeUsed(utils::InternalTag{}).empty()) {
     LOG_INFO() << "Some configs expected to be used are actually not needed: "
@@ -0,0 +1,151 @@
+#include <userver/engine/co_task.hpp>
+
+#if __cpp_impl_coroutine >= 201902L
+
+#include <atomic>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include <userver/engine/async.hpp>
+#include <userver/engine/exception.hpp>
+#include <userver/engine/future.hpp>
+#include <userver/engine/sleep.hpp>
+#include <userver/utest/utest.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+engine::CoTask<int> CoAdd(int lhs, int rhs) { co_return lhs + rhs; }
+
+engine::CoTask<int> CoSum(int count) {
+  int sum = 0;
+  for (int i = 0; i < count; ++i) {
+    sum = co_await CoAdd(sum, i);
+    co_await engine::CoYield();
+  }
+  co_return sum;
+}
+
+engine::CoTask<> CoThrow() {
+  co_await engine::CoYield();
+  throw std::runtime_error("test");
+}
+
+engine::CoTask<std::string> CoCatch() {
+  try {
+    co_await CoThrow();
+  } catch (const std::runtime_error& ex) {
+    co_return ex.what();
+  }
+  co_return "";
+}
+
+engine::CoTask<> CoYieldForever(std::atomic<bool>& started) {
+  started = true;
+  while (true) co_await engine::CoYield();
+}
+
+}  // namespace
+
+UTEST(CoTask, Result) {
+  EXPECT_EQ(engine::CoAsync(CoAdd(1, 2)).Get(), 3);
+  EXPECT_EQ(engine::CoAsync(CoSum(100)).Get(), 4950);
+}
+
+UTEST(CoTask, Exception) {
+  auto handle = engine::CoAsync(CoThrow());
+  EXPECT_THROW(handle.Get(), std::runtime_error);
+  EXPECT_FALSE(handle.IsValid());
+
+  EXPECT_EQ(engine::CoAsync(CoCatch()).Get(), "test");
+}
+
+UTEST(CoTask, Cancel) {
+  std::atomic<bool> started{false};
+  auto handle = engine::CoAsync(CoYieldForever(started));
+  while (!started) engine::Yield();
+
+  handle.RequestCancel();
+  try {
+    handle.Get();
+    FAIL() << "The cancellation was not observed";
+  } catch (const engine::WaitInterruptedException& ex) {
+    EXPECT_EQ(ex.Reason(), engine::TaskCancellationReason::kUserRequest);
+  }
+}
+
+UTEST(CoTask, Deadline) {
+  std::atomic<bool> started{false};
+  auto handle = engine::CoAsync(
+      CoYieldForever(started),
+      engine::Deadline::FromDuration(std::chrono::milliseconds{10}));
+  try {
+    handle.Get();
+    FAIL() << "The deadline was not observed";
+  } catch (const engine::WaitInterruptedException& ex) {
+    EXPECT_EQ(ex.Reason(), engine::TaskCancellationReason::kDeadline);
+  }
+}
+
+UTEST(CoTask, AbandonedHandleCancels) {
+  std::atomic<bool> started{false};
+  {
+    auto handle = engine::CoAsync(CoYieldForever(started));
+    while (!started) engine::Yield();
+  }
+  // The destructor waits for the coroutine to finish
+  SUCCEED();
+}
+
+UTEST(CoTask, WaitFuture) {
+  engine::Promise<int> promise;
+  auto future = promise.get_future();
+
+  auto handle = engine::CoAsync([](engine::Future<int>& future)
+                                    -> engine::CoTask<int> {
+    co_return co_await engine::CoWait(future) * 2;
+  }(future));
+
+  engine::Yield();
+  EXPECT_FALSE(handle.IsFinished());
+  promise.set_value(21);
+  EXPECT_EQ(handle.Get(), 42);
+}
+
+UTEST(CoTask, ShouldCancel) {
+  auto handle = engine::CoAsync([]() -> engine::CoTask<bool> {
+    co_return co_await engine::CoShouldCancel();
+  }());
+  EXPECT_FALSE(handle.Get());
+
+  handle = engine::CoAsync(
+      []() -> engine::CoTask<bool> {
+        co_return co_await engine::CoShouldCancel();
+      }(),
+      engine::Deadline::Passed());
+  EXPECT_THROW(handle.Get(), engine::WaitInterruptedException);
+}
+
+UTEST_MT(CoTask, FanOut, 4) {
+  constexpr int kCoroutines = 1000;
+
+  auto handle = engine::CoAsync([]() -> engine::CoTask<int> {
+    std::vector<engine::CoTaskHandle<int>> subtasks;
+    subtasks.reserve(kCoroutines);
+    for (int i = 0; i < kCoroutines; ++i) {
+      subtasks.push_back(engine::CoAsync(CoSum(i % 10)));
+    }
+    int total = 0;
+    for (auto& subtask : subtasks) total += co_await engine::CoWait(subtask);
+    co_return total;
+  }());
+
+  // sum(i) for i < n is n * (n - 1) / 2, i.e. 0 0 1 3 6 10 15 21 28 36
+  EXPECT_EQ(handle.Get(), 120 * kCoroutines / 10);
+}
+
+USERVER_NAMESPACE_END
+
+#endif
@@ -1,9 +1,12 @@
 #pragma once
 
+#include <sys/mman.h>
+
 #include <algorithm>  // for std::max
 #include <atomic>
 #include <cerrno>
 #include <cstddef>
+#include <cstdint>
 #include <iterator>
 #include <optional>
 #include <utility>
@@ -14,7 +17,11 @@
 
 #include <userver/logging/log.hpp>
 #include <userver/utils/assert.hpp>
+#include <userver/utils/atomic.hpp>
+#include <userver/utils/datetime/steady_coarse_clock.hpp>
+#include <userver/utils/fixed_array.hpp>
 
+#include <utils/numa.hpp>
 #include <utils/sys_info.hpp>
 
 #include "pool_config.hpp"
@@ -46,15 +53,34 @@ class Pool final {
   void RegisterThread();
   void AccountStackUsage();
 
+  // Calls Trim() once per PoolConfig::adaptive_trim_interval if the pool is
+  // adaptive, cheap otherwise. Must be called outside of coroutines.
+  void MaybeTrim();
+
+  // Destroys idle coroutines above the high-water mark of active coroutines
+  // observed since the previous Trim(), and returns the pages of the rest of
+  // idle stacks to the OS. Must be called outside of coroutines, calls must
+  // be serialized.
+  void Trim();
+
  private:
   static PoolConfig FixupConfig(PoolConfig&& config);
 
   Coroutine CreateCoroutine(bool quiet = false);
   void OnCoroutineDestruction() noexcept;
 
+  void UpdateHighWaterMark() noexcept;
+  void TrimStack(const Coroutine& coroutine) const noexcept;
+
   bool TryPopulateLocalCache();
   void DepopulateLocalCache();
 
+  template <typename Mover>
+  bool TryDequeueFromOtherNodes(Mover& mover);
+  std::size_t GetUsedCoroutinesSizeApprox() const;
+
+  moodycamel::ConcurrentQueue<Coroutine>& GetLocalUsedCoroutines();
+
   template <typename Token>
   Token& GetUsedPoolToken();
 
@@ -85,10 +111,17 @@ class Pool final {
   // The same could've been achieved with some LIFO container, but apparently
   // we don't have a container handy enough to not just use 2 queues.
   moodycamel::ConcurrentQueue<Coroutine> initial_coroutines_;
-  moodycamel::ConcurrentQueue<Coroutine> used_coroutines_;
+  // One queue per NUMA node. A thread puts coroutines into and takes them from
+  // the queue of its node, so that reused stacks stay node-local.
+  utils::FixedArray<moodycamel::ConcurrentQueue<Coroutine>> used_coroutines_;
 
   std::atomic<std::size_t> idle_coroutines_num_;
   std::atomic<std::size_t> total_coroutines_num_;
+
+  // Adaptive mode, see Trim()
+  std::atomic<std::size_t> active_high_water_mark_{0};
+  std::size_t previous_high_water_mark_{0};
+  std::atomic<utils::datetime::SteadyCoarseClock::time_point> next_trim_time_;
 };
 
 template <typename Task>
@@ -128,9 +161,11 @@ Pool<Task>::Pool(PoolConfig config, Executor executor)
       stack_allocator_(config_.stack_size),
       stack_usage_monitor_(config_.stack_size),
       initial_coroutines_(config_.initial_size),
-      used_coroutines_(config_.max_size),
+      used_coroutines_(utils::numa::GetNodesCount(), config_.max_size),
       idle_coroutines_num_(config_.initial_size),
-      total_coroutines_num_(0) {
+      total_coroutines_num_(0),
+      next_trim_time_(utils::datetime::SteadyCoarseClock::now() +
+                      config_.adaptive_trim_interval) {
   UASSERT(local_coroutine_move_size_ <= config_.local_cache_size);
   moodycamel::ProducerToken token(initial_coroutines_);
 
@@ -162,15 +197,25 @@ typename Pool<Task>::CoroutinePtr Pool<Task>::GetCoroutine() {
   // First try to dequeue from 'working set': if we can get a coroutine
   // from there we are happy, because we saved on minor-page-faulting (thus
   // increasing resident memory usage) a not-yet-de-virtualized coroutine stack.
-  if (!local_coro_buffer_.empty() || TryPopulateLocalCache()) {
+  if (!local_coro_buffer_.empty()) {
+    coroutine = std::move(local_coro_buffer_.back());
+    local_coro_buffer_.pop_back();
+    return CoroutinePtr(std::move(*coroutine), *this);
+  }
+
+  if (TryPopulateLocalCache()) {
     coroutine = std::move(local_coro_buffer_.back());
     local_coro_buffer_.pop_back();
   } else if (initial_coroutines_.try_dequeue(mover)) {
     --idle_coroutines_num_;
+  } else if (TryDequeueFromOtherNodes(mover)) {
+    // A remote stack is still cheaper than a new one
+    --idle_coroutines_num_;
   } else {
     coroutine.emplace(CreateCoroutine());
   }
 
+  if (config_.is_adaptive) UpdateHighWaterMark();
   return CoroutinePtr(std::move(*coroutine), *this);
 }
 
@@ -179,8 +224,9 @@ void Pool<Task>::PutCoroutine(CoroutinePtr&& coroutine_ptr) {
   if (config_.local_cache_size == 0) {
     const bool ok =
         // We only ever return coroutines into our 'working set'.
-        used_coroutines_.enqueue(GetUsedPoolToken<moodycamel::ProducerToken>(),
-                                 std::move(coroutine_ptr.Get()));
+        GetLocalUsedCoroutines().enqueue(
+            GetUsedPoolToken<moodycamel::ProducerToken>(),
+            std::move(coroutine_ptr.Get()));
     if (ok) {
       ++idle_coroutines_num_;
     }
@@ -199,7 +245,7 @@ PoolStats Pool<Task>::GetStats() const {
   PoolStats stats;
   stats.active_coroutines =
       total_coroutines_num_.load() -
-      (used_coroutines_.size_approx() + initial_coroutines_.size_approx());
+      (GetUsedCoroutinesSizeApprox() + initial_coroutines_.size_approx());
   stats.total_coroutines =
       std::max(total_coroutines_num_.load(), stats.active_coroutines);
   stats.max_stack_usage_pct = stack_usage_monitor_.GetMaxStackUsagePct();
@@ -222,7 +268,7 @@ void Pool<Task>::ClearLocalCache() {
         std::min(config_.max_size - current_idle_coroutines_num,
                  local_coro_buffer_.size());
 
-    const bool ok = used_coroutines_.enqueue_bulk(
+    const bool ok = GetLocalUsedCoroutines().enqueue_bulk(
         GetUsedPoolToken<moodycamel::ProducerToken>(),
         std::make_move_iterator(local_coro_buffer_.begin()),
         return_to_pool_from_local_cache_num);
@@ -277,7 +323,7 @@ template <typename Task>
 bool Pool<Task>::TryPopulateLocalCache() {
   if (local_coroutine_move_size_ == 0) return false;
 
-  const std::size_t dequeued_num = used_coroutines_.try_dequeue_bulk(
+  const std::size_t dequeued_num = GetLocalUsedCoroutines().try_dequeue_bulk(
       GetUsedPoolToken<moodycamel::ConsumerToken>(),
       std::back_inserter(local_coro_buffer_), local_coroutine_move_size_);
   if (dequeued_num == 0) return false;
@@ -296,7 +342,7 @@ void Pool<Task>::DepopulateLocalCache() {
         std::min(config_.max_size - current_idle_coroutines_num,
                  local_coroutine_move_size_);
 
-    const bool ok = used_coroutines_.enqueue_bulk(
+    const bool ok = GetLocalUsedCoroutines().enqueue_bulk(
         GetUsedPoolToken<moodycamel::ProducerToken>(),
         std::make_move_iterator(local_coro_buffer_.end() -
                                 return_to_pool_from_local_cache_num),
@@ -315,6 +361,153 @@ void Pool<Task>::DepopulateLocalCache() {
       local_coro_buffer_.end());
 }
 
+template <typename Task>
+void Pool<Task>::MaybeTrim() {
+  if (!config_.is_adaptive) return;
+
+  const auto now = utils::datetime::SteadyCoarseClock::now();
+  auto next_trim_time = next_trim_time_.load(std::memory_order_relaxed);
+  if (now < next_trim_time) return;
+
+  // Only one of the threads does the trimming
+  if (!next_trim_time_.compare_exchange_strong(
+          next_trim_time, now + config_.adaptive_trim_interval,
+          std::memory_order_relaxed)) {
+    return;
+  }
+  Trim();
+}
+
+template <typename Task>
+void Pool<Task>::Trim() {
+  const auto active_coroutines =
+      total_coroutines_num_.load() - std::min(idle_coroutines_num_.load(),
+                                              total_coroutines_num_.load());
+  // Take the previous period into account, so that the pool does not shrink
+  // right after a spike ends
+  const auto current_high_water_mark =
+      active_high_water_mark_.exchange(active_coroutines);
+  const auto high_water_mark = std::max(
+      current_high_water_mark,
+      std::exchange(previous_high_water_mark_, current_high_water_mark));
+  const auto target_size = std::max(high_water_mark, config_.initial_size);
+
+  const auto total_coroutines = total_coroutines_num_.load();
+  std::size_t to_destroy =
+      total_coroutines > target_size ? total_coroutines - target_size : 0;
+  std::size_t destroyed = 0;
+  std::size_t trimmed = 0;
+
+  std::vector<Coroutine> batch;
+  for (auto& queue : used_coroutines_) {
+    batch.clear();
+    const auto dequeued = queue.try_dequeue_bulk(std::back_inserter(batch),
+                                                 queue.size_approx());
+    if (dequeued == 0) continue;
+    idle_coroutines_num_.fetch_sub(dequeued);
+
+    // Used stacks are destroyed first, as they are the ones occupying memory
+    const auto destroy_count = std::min(to_destroy, batch.size());
+    batch.erase(batch.end() - destroy_count, batch.end());
+    total_coroutines_num_ -= destroy_count;
+    to_destroy -= destroy_count;
+    destroyed += destroy_count;
+
+    for (const auto& coroutine : batch) TrimStack(coroutine);
+    trimmed += batch.size();
+
+    if (queue.enqueue_bulk(std::make_move_iterator(batch.begin()),
+                           batch.size())) {
+      idle_coroutines_num_.fetch_add(batch.size());
+    } else {
+      total_coroutines_num_ -= batch.size();
+    }
+  }
+
+  // Never used coroutines are cheap, but still occupy a mapping each
+  for (; to_destroy > 0; --to_destroy) {
+    std::optional<Coroutine> coroutine;
+    if (!initial_coroutines_.try_dequeue(coroutine)) break;
+    --idle_coroutines_num_;
+    --total_coroutines_num_;
+    ++destroyed;
+  }
+
+  if (destroyed || trimmed) {
+    LOG_DEBUG() << "Trimmed the coroutine pool toward high-water mark "
+                << high_water_mark << ": destroyed " << destroyed
+                << " coroutines, trimmed " << trimmed << " idle stacks";
+  }
+}
+
+template <typename Task>
+void Pool<Task>::UpdateHighWaterMark() noexcept {
+  const auto total = total_coroutines_num_.load(std::memory_order_relaxed);
+  const auto idle = idle_coroutines_num_.load(std::memory_order_relaxed);
+  if (total <= idle) return;
+
+  const auto active = total - idle;
+  if (active > active_high_water_mark_.load(std::memory_order_relaxed)) {
+    utils::AtomicMax(active_high_water_mark_, active);
+  }
+}
+
+template <typename Task>
+void Pool<Task>::TrimStack(const Coroutine& coroutine) const noexcept {
+  const auto idle_usage = GetIdleStackUsageBytes();
+  // Not measured yet, no one has returned to the pool
+  if (idle_usage == 0) return;
+
+  const auto page_size = utils::sys_info::GetPageSize();
+  const auto round_up = [page_size](std::uintptr_t value) {
+    return (value + page_size - 1) & ~(page_size - 1);
+  };
+
+  // The stack grows down from the control block, see GetStackBegin() in
+  // stack_usage_monitor.cpp. Keep the pages used by the suspended coroutine
+  // and a page for the frames of the suspension itself.
+  const auto stack_begin =
+      round_up(reinterpret_cast<std::uintptr_t>(GetCoroCbPtr(coroutine)));
+  const auto keep_size = round_up(idle_usage) + 2 * page_size;
+  if (keep_size >= config_.stack_size) return;
+
+  const auto trim_end = stack_begin - keep_size;
+  const auto trim_begin = stack_begin - config_.stack_size;
+  // Stacks are private anonymous mappings, the pages are zero-filled on the
+  // next access.
+  ::madvise(reinterpret_cast<void*>(trim_begin), trim_end - trim_begin,
+            MADV_DONTNEED);
+}
+
+template <typename Task>
+template <typename Mover>
+bool Pool<Task>::TryDequeueFromOtherNodes(Mover& mover) {
+  if (used_coroutines_.size() == 1) return false;
+
+  const auto& local_queue = GetLocalUsedCoroutines();
+  for (auto& queue : used_coroutines_) {
+    if (&queue != &local_queue && queue.try_dequeue(mover)) return true;
+  }
+  return false;
+}
+
+template <typename Task>
+std::size_t Pool<Task>::GetUsedCoroutinesSizeApprox() const {
+  std::size_t size = 0;
+  for (const auto& queue : used_coroutines_) size += queue.size_approx();
+  return size;
+}
+
+template <typename Task>
+moodycamel::ConcurrentQueue<typename Pool<Task>::Coroutine>&
+Pool<Task>::GetLocalUsedCoroutines() {
+  // The node is determined once per thread: the thread-local tokens below are
+  // bound to a single queue. Worker threads are bound to their NUMA node
+  // before the first use of the pool, see TaskProcessorConfig::numa_node.
+  thread_local const std::size_t node = utils::numa::GetCurrentNode();
+  return used_coroutines_[node < used_coroutines_.size() ? node : 0];
+}
+
 template <typename Task>
 std::size_t Pool<Task>::GetStackSize() const {
   return config_.stack_size;
@@ -341,7 +534,7 @@ void Pool<Task>::AccountStackUsage() {
 template <typename Task>
 template <typename Token>
 Token& Pool<Task>::GetUsedPoolToken() {
-  thread_local Token token(used_coroutines_);
+  thread_local Token token(GetLocalUsedCoroutines());
   return token;
 }
 
@@ -12,6 +12,10 @@ PoolConfig Parse(const yaml_config::YamlConfig& value,
   config.stack_size = value["stack_size"].As<size_t>(config.stack_size);
   config.local_cache_size =
       value["local_cache_size"].As<size_t>(config.local_cache_size);
+  config.is_adaptive = value["adaptive"].As<bool>(config.is_adaptive);
+  config.adaptive_trim_interval =
+      value["adaptive_trim_interval"].As<std::chrono::milliseconds>(
+          config.adaptive_trim_interval);
   return config;
 }
 
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <chrono>
 #include <string>
 
 #include <userver/formats/yaml.hpp>
@@ -14,6 +15,11 @@ struct PoolConfig {
   std::size_t max_size = 4000;
   std::size_t stack_size = 256 * 1024ULL;
   std::size_t local_cache_size = 8;
+
+  // Periodically shrink the pool toward the recently observed high-water mark
+  // of active coroutines and return unused pages of idle stacks to the OS
+  bool is_adaptive = false;
+  std::chrono::milliseconds adaptive_trim_interval{std::chrono::seconds{60}};
 };
 
 PoolConfig Parse(const yaml_config::YamlConfig& value,
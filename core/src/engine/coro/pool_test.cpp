@@ -0,0 +1,82 @@
+#include <engine/coro/pool.hpp>
+
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <engine/task/task_context.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+using Pool = engine::coro::Pool<engine::impl::TaskContext>;
+
+void EmptyExecutor(Pool::TaskPipe& task_pipe) {
+  for ([[maybe_unused]] auto* context : task_pipe) {
+  }
+}
+
+engine::coro::PoolConfig MakeAdaptiveConfig() {
+  engine::coro::PoolConfig config;
+  config.initial_size = 2;
+  config.max_size = 100;
+  config.local_cache_size = 0;
+  config.is_adaptive = true;
+  return config;
+}
+
+void UseCoroutines(Pool& pool, std::size_t count) {
+  std::vector<Pool::CoroutinePtr> coroutines;
+  for (std::size_t i = 0; i < count; ++i) {
+    coroutines.push_back(pool.GetCoroutine());
+  }
+  for (auto& coroutine : coroutines) std::move(coroutine).ReturnToPool();
+}
+
+}  // namespace
+
+TEST(CoroPool, AdaptiveTrim) {
+  Pool pool{MakeAdaptiveConfig(), &EmptyExecutor};
+  UseCoroutines(pool, 20);
+  EXPECT_EQ(pool.GetStats().total_coroutines, 20);
+  EXPECT_EQ(pool.GetStats().active_coroutines, 0);
+
+  // The high-water mark of the current and the previous periods is kept
+  pool.Trim();
+  EXPECT_EQ(pool.GetStats().total_coroutines, 20);
+  pool.Trim();
+  EXPECT_EQ(pool.GetStats().total_coroutines, 20);
+
+  // Shrinks down to initial_size after two quiet periods
+  pool.Trim();
+  EXPECT_EQ(pool.GetStats().total_coroutines, 2);
+  EXPECT_EQ(pool.GetStats().active_coroutines, 0);
+}
+
+TEST(CoroPool, AdaptiveTrimKeepsActive) {
+  Pool pool{MakeAdaptiveConfig(), &EmptyExecutor};
+  UseCoroutines(pool, 20);
+
+  std::vector<Pool::CoroutinePtr> active;
+  for (std::size_t i = 0; i < 5; ++i) active.push_back(pool.GetCoroutine());
+
+  for (int i = 0; i < 3; ++i) pool.Trim();
+  EXPECT_GE(pool.GetStats().total_coroutines, 5);
+  EXPECT_LT(pool.GetStats().total_coroutines, 20);
+  EXPECT_EQ(pool.GetStats().active_coroutines, 5);
+
+  for (auto& coroutine : active) std::move(coroutine).ReturnToPool();
+}
+
+TEST(CoroPool, NonAdaptiveDoesNotTrim) {
+  auto config = MakeAdaptiveConfig();
+  config.is_adaptive = false;
+  Pool pool{config, &EmptyExecutor};
+  UseCoroutines(pool, 20);
+
+  for (int i = 0; i < 3; ++i) pool.MaybeTrim();
+  EXPECT_EQ(pool.GetStats().total_coroutines, 20);
+}
+
+USERVER_NAMESPACE_END
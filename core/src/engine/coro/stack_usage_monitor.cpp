@@ -2,7 +2,10 @@
 
 #include <coroutines/coroutine.hpp>
 
+#include <atomic>
+
 #include <engine/task/task_context.hpp>
+#include <userver/utils/atomic.hpp>
 
 // userfaultfd is linux-specific,
 // and we use x86-64-specific RSP to calculate stack offsets
@@ -695,6 +698,21 @@ __attribute__((noinline)) std::size_t GetCurrentTaskStackUsageBytes() noexcept {
          reinterpret_cast<std::uintptr_t>(stack_pointer);
 }
 
+namespace {
+std::atomic<std::size_t> idle_stack_usage_bytes{0};
+}  // namespace
+
+void AccountIdleStackUsage() noexcept {
+  // All the coroutines run the same function and become idle at the same
+  // point, so it is enough to measure once.
+  if (idle_stack_usage_bytes.load(std::memory_order_relaxed) != 0) return;
+  utils::AtomicMax(idle_stack_usage_bytes, GetCurrentTaskStackUsageBytes());
+}
+
+std::size_t GetIdleStackUsageBytes() noexcept {
+  return idle_stack_usage_bytes.load(std::memory_order_relaxed);
+}
+
 }  // namespace engine::coro
 
 USERVER_NAMESPACE_END
@@ -43,6 +43,19 @@ class StackUsageMonitor final {
 
 std::size_t GetCurrentTaskStackUsageBytes() noexcept;
 
+// Returns the control block of the coroutine, that resides at the beginning
+// of its stack
+const void* GetCoroCbPtr(
+    const boost::coroutines2::coroutine<impl::TaskContext*>::push_type&
+        coro) noexcept;
+
+// Must be called by the coroutine body right before it suspends to wait for
+// the next task. Idle coroutines use no more stack than that.
+void AccountIdleStackUsage() noexcept;
+
+// Returns 0 until some coroutine has become idle
+std::size_t GetIdleStackUsageBytes() noexcept;
+
 }  // namespace engine::coro
 
 USERVER_NAMESPACE_END
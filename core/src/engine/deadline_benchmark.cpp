@@ -1,8 +1,13 @@
 #include <benchmark/benchmark.h>
 
 #include <chrono>
+#include <vector>
 
+#include <userver/engine/async.hpp>
 #include <userver/engine/deadline.hpp>
+#include <userver/engine/run_standalone.hpp>
+#include <userver/engine/single_consumer_event.hpp>
+#include <userver/engine/sleep.hpp>
 
 #include <utils/gbench_auxilary.hpp>
 
@@ -47,6 +52,40 @@ void deadline_100s_interval_reached(benchmark::State& state) {
   deadline_is_reached(state, std::chrono::seconds{100});
 }
 
+// Tasks repeatedly wait for an event with a deadline, while `range(0)` other
+// tasks keep their deadlines armed. `range(1)` selects the timers
+// implementation: 0 is libev timers, 1 is the timer wheel.
+void deadline_armed_timers(benchmark::State& state) {
+  engine::TaskProcessorPoolsConfig config;
+  config.ev_timer_wheel_enabled = state.range(1) != 0;
+
+  engine::RunStandalone(1, config, [&] {
+    std::vector<engine::TaskWithResult<void>> sleepers;
+    sleepers.reserve(state.range(0));
+    for (std::int64_t i = 0; i < state.range(0); ++i) {
+      sleepers.push_back(engine::AsyncNoSpan([i] {
+        engine::InterruptibleSleepFor(std::chrono::seconds{10} +
+                                      std::chrono::microseconds{i});
+      }));
+    }
+    engine::Yield();
+
+    engine::SingleConsumerEvent event;
+    for ([[maybe_unused]] auto _ : state) {
+      const auto deadline =
+          engine::Deadline::FromDuration(std::chrono::seconds{20});
+      auto waiter = engine::AsyncNoSpan([&event, deadline] {
+        [[maybe_unused]] const bool sent = event.WaitForEventUntil(deadline);
+      });
+      engine::Yield();
+      event.Send();
+      waiter.Wait();
+    }
+
+    for (auto& sleeper : sleepers) sleeper.SyncCancel();
+  });
+}
+
 }  // namespace
 
 BENCHMARK(deadline_1us_interval_construction);
@@ -56,4 +95,8 @@ BENCHMARK(deadline_1us_interval_reached);
 BENCHMARK(deadline_20ms_interval_reached);
 BENCHMARK(deadline_100s_interval_reached);
 
+BENCHMARK(deadline_armed_timers)
+    ->ArgsProduct({{0, 100, 5000}, {0, 1}})
+    ->Unit(benchmark::kMicrosecond);
+
 USERVER_NAMESPACE_END
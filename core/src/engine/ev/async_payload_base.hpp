@@ -1,6 +1,7 @@
 #pragma once
 
 #include <atomic>
+#include <cstdint>
 #include <type_traits>
 #include <utility>
 
@@ -107,6 +108,14 @@ class MultiShotAsyncPayload : public AsyncPayloadBase {
   std::atomic<bool> is_in_queue_{false};
 };
 
+// Cumulative counters of the payloads passed to an ev thread. The achieved
+// batch size is `payloads / batches`, each wakeup signal is an eventfd write.
+struct PayloadQueueStats {
+  std::uint64_t payloads{0};
+  std::uint64_t batches{0};
+  std::uint64_t wakeups{0};
+};
+
 }  // namespace engine::ev
 
 USERVER_NAMESPACE_END
@@ -0,0 +1,252 @@
+#include <engine/ev/io_uring.hpp>
+
+#include <linux/io_uring.h>
+#include <sys/eventfd.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <stdexcept>
+
+#include <fmt/format.h>
+
+#include <userver/logging/log.hpp>
+#include <userver/utils/assert.hpp>
+#include <utils/check_syscall.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace engine::ev {
+
+namespace {
+
+int IoUringSetup(unsigned entries, io_uring_params& params) noexcept {
+  return static_cast<int>(::syscall(__NR_io_uring_setup, entries, &params));
+}
+
+int IoUringEnter(int ring_fd, unsigned to_submit) noexcept {
+  return static_cast<int>(::syscall(__NR_io_uring_enter, ring_fd, to_submit,
+                                    0, 0, nullptr, 0));
+}
+
+int IoUringRegister(int ring_fd, unsigned opcode, void* arg,
+                    unsigned nr_args) noexcept {
+  return static_cast<int>(
+      ::syscall(__NR_io_uring_register, ring_fd, opcode, arg, nr_args));
+}
+
+template <typename T>
+T* At(void* base, std::uint32_t offset) noexcept {
+  return reinterpret_cast<T*>(static_cast<char*>(base) + offset);
+}
+
+unsigned LoadAcquire(const unsigned* ptr) noexcept {
+  return __atomic_load_n(ptr, __ATOMIC_ACQUIRE);
+}
+
+void StoreRelease(unsigned* ptr, unsigned value) noexcept {
+  __atomic_store_n(ptr, value, __ATOMIC_RELEASE);
+}
+
+void* MapRing(int ring_fd, std::size_t size, std::uint64_t offset) {
+  void* ptr = ::mmap(nullptr, size, PROT_READ | PROT_WRITE,
+                     MAP_SHARED | MAP_POPULATE, ring_fd,
+                     static_cast<off_t>(offset));
+  if (ptr == MAP_FAILED) {
+    throw std::system_error(errno, std::system_category(),
+                            "Error while mapping io_uring");
+  }
+  return ptr;
+}
+
+bool DetectIoUringSupport() noexcept {
+  io_uring_params params{};
+  const int ring_fd = IoUringSetup(1, params);
+  if (ring_fd < 0) {
+    LOG_INFO() << "io_uring is not supported: "
+               << std::error_code(errno, std::system_category()).message();
+    return false;
+  }
+  ::close(ring_fd);
+
+  // Poll operations and registered eventfd are all we need, they are
+  // available since 5.1. IORING_FEAT_NODROP guarantees that completions are
+  // not lost on CQ overflow.
+  if (!(params.features & IORING_FEAT_NODROP)) {
+    LOG_INFO() << "io_uring is too old, IORING_FEAT_NODROP is missing";
+    return false;
+  }
+  return true;
+}
+
+}  // namespace
+
+bool IoUring::IsSupported() noexcept {
+  static const bool kIsSupported = DetectIoUringSupport();
+  return kIsSupported;
+}
+
+IoUring::IoUring(std::size_t entries) {
+  io_uring_params params{};
+  ring_fd_ = utils::CheckSyscall(IoUringSetup(entries, params),
+                                 "setting up io_uring with {} entries",
+                                 entries);
+
+  try {
+    sq_ring_size_ = params.sq_off.array + params.sq_entries * sizeof(unsigned);
+    cq_ring_size_ =
+        params.cq_off.cqes + params.cq_entries * sizeof(io_uring_cqe);
+    if (params.features & IORING_FEAT_SINGLE_MMAP) {
+      sq_ring_size_ = cq_ring_size_ = std::max(sq_ring_size_, cq_ring_size_);
+    }
+
+    sq_ring_ptr_ = MapRing(ring_fd_, sq_ring_size_, IORING_OFF_SQ_RING);
+    if (params.features & IORING_FEAT_SINGLE_MMAP) {
+      cq_ring_ptr_ = sq_ring_ptr_;
+    } else {
+      cq_ring_ptr_ = MapRing(ring_fd_, cq_ring_size_, IORING_OFF_CQ_RING);
+    }
+    sqes_size_ = params.sq_entries * sizeof(io_uring_sqe);
+    sqes_ = static_cast<io_uring_sqe*>(
+        MapRing(ring_fd_, sqes_size_, IORING_OFF_SQES));
+
+    sq_khead_ = At<unsigned>(sq_ring_ptr_, params.sq_off.head);
+    sq_ktail_ = At<unsigned>(sq_ring_ptr_, params.sq_off.tail);
+    sq_mask_ = *At<unsigned>(sq_ring_ptr_, params.sq_off.ring_mask);
+    sq_entries_ = params.sq_entries;
+
+    // SQ indirection array is never reordered, set it up once
+    auto* const sq_array = At<unsigned>(sq_ring_ptr_, params.sq_off.array);
+    for (unsigned i = 0; i < sq_entries_; ++i) sq_array[i] = i;
+    sqe_head_ = sqe_tail_ = *sq_ktail_;
+
+    cq_khead_ = At<unsigned>(cq_ring_ptr_, params.cq_off.head);
+    cq_ktail_ = At<unsigned>(cq_ring_ptr_, params.cq_off.tail);
+    cq_mask_ = *At<unsigned>(cq_ring_ptr_, params.cq_off.ring_mask);
+    cqes_ = At<io_uring_cqe>(cq_ring_ptr_, params.cq_off.cqes);
+
+    event_fd_ = utils::CheckSyscall(::eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC),
+                                    "creating eventfd for io_uring");
+    utils::CheckSyscall(
+        IoUringRegister(ring_fd_, IORING_REGISTER_EVENTFD, &event_fd_, 1),
+        "registering eventfd in io_uring");
+  } catch (const std::exception&) {
+    Cleanup();
+    throw;
+  }
+}
+
+IoUring::~IoUring() { Cleanup(); }
+
+void IoUring::Cleanup() noexcept {
+  if (sqes_) ::munmap(sqes_, sqes_size_);
+  if (cq_ring_ptr_ && cq_ring_ptr_ != sq_ring_ptr_) {
+    ::munmap(cq_ring_ptr_, cq_ring_size_);
+  }
+  if (sq_ring_ptr_) ::munmap(sq_ring_ptr_, sq_ring_size_);
+  if (event_fd_ != -1) ::close(event_fd_);
+  if (ring_fd_ != -1) ::close(ring_fd_);
+
+  sqes_ = nullptr;
+  cq_ring_ptr_ = sq_ring_ptr_ = nullptr;
+  event_fd_ = ring_fd_ = -1;
+}
+
+io_uring_sqe& IoUring::GetSqe() {
+  if (sqe_tail_ - LoadAcquire(sq_khead_) >= sq_entries_) {
+    Flush();
+    UINVARIANT(sqe_tail_ - LoadAcquire(sq_khead_) < sq_entries_,
+               "io_uring submission queue is overflown");
+  }
+
+  auto& sqe = sqes_[sqe_tail_ & sq_mask_];
+  ++sqe_tail_;
+  std::memset(&sqe, 0, sizeof(sqe));
+  return sqe;
+}
+
+void IoUring::PreparePollAdd(int fd, std::uint32_t poll_mask,
+                             IoUringCompletionHandler& handler) {
+  auto& sqe = GetSqe();
+  sqe.opcode = IORING_OP_POLL_ADD;
+  sqe.fd = fd;
+#if __BYTE_ORDER == __BIG_ENDIAN
+  poll_mask = __builtin_bswap32(poll_mask);
+#endif
+  sqe.poll32_events = poll_mask;
+  sqe.user_data = reinterpret_cast<std::uintptr_t>(&handler);
+}
+
+void IoUring::PreparePollRemove(IoUringCompletionHandler& handler) {
+  auto& sqe = GetSqe();
+  sqe.opcode = IORING_OP_POLL_REMOVE;
+  sqe.fd = -1;
+  sqe.addr = reinterpret_cast<std::uintptr_t>(&handler);
+  // Result of the removal itself is not interesting, the handler is notified
+  // by the completion of the poll operation.
+  sqe.user_data = 0;
+}
+
+void IoUring::Flush() noexcept {
+  if (sqe_head_ == sqe_tail_) return;
+
+  StoreRelease(sq_ktail_, sqe_tail_);
+  while (sqe_head_ != sqe_tail_) {
+    const int submitted = IoUringEnter(ring_fd_, sqe_tail_ - sqe_head_);
+    if (submitted > 0) {
+      sqe_head_ += static_cast<unsigned>(submitted);
+      continue;
+    }
+    if (submitted == 0) return;
+
+    const auto error = errno;
+    if (error == EINTR) continue;
+    if (error == EAGAIN || error == EBUSY) {
+      // The kernel is out of resources or the CQ is overflown. Entries stay
+      // in the SQ ring and are submitted by the next Flush().
+      LOG_LIMITED_WARNING() << "io_uring_enter is temporarily unavailable: "
+                            << std::error_code(error, std::system_category())
+                                   .message();
+      return;
+    }
+    UASSERT_MSG(false, fmt::format("io_uring_enter failed: {}", error));
+    LOG_ERROR() << "io_uring_enter failed: "
+                << std::error_code(error, std::system_category()).message();
+    return;
+  }
+}
+
+std::size_t IoUring::ProcessCompletions() noexcept {
+  eventfd_t value{};
+  [[maybe_unused]] const auto res = ::eventfd_read(event_fd_, &value);
+
+  std::size_t processed = 0;
+  auto head = *cq_khead_;
+  while (true) {
+    const auto tail = LoadAcquire(cq_ktail_);
+    if (head == tail) break;
+
+    for (; head != tail; ++head) {
+      const auto& cqe = cqes_[head & cq_mask_];
+      const auto user_data = cqe.user_data;
+      const auto result = cqe.res;
+
+      // Release the slot before calling the handler, it may submit new
+      // operations
+      StoreRelease(cq_khead_, head + 1);
+      ++processed;
+
+      if (user_data == 0) continue;
+      reinterpret_cast<IoUringCompletionHandler*>(user_data)
+          ->OnIoUringCompletion(result);
+    }
+  }
+  return processed;
+}
+
+}  // namespace engine::ev
+
+USERVER_NAMESPACE_END
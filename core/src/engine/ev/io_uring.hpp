@@ -0,0 +1,103 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+struct io_uring_cqe;
+struct io_uring_sqe;
+
+USERVER_NAMESPACE_BEGIN
+
+namespace engine::ev {
+
+/// Receives the result of an operation submitted into IoUring. The result is
+/// the `res` field of the completion, i.e. a non-negative value on success or
+/// a negated errno.
+class IoUringCompletionHandler {
+ public:
+  virtual void OnIoUringCompletion(int result) noexcept = 0;
+
+ protected:
+  ~IoUringCompletionHandler() = default;
+};
+
+/// @brief A minimal io_uring submission/completion queue pair.
+///
+/// Owned by an ev::Thread and only accessed from it, so neither the
+/// submission nor the completion side needs synchronization beyond what the
+/// kernel requires.
+///
+/// Submission queue entries are accumulated during an ev-loop iteration and
+/// submitted with a single io_uring_enter(2) by Flush(). Completions are
+/// signaled through an eventfd, that is watched by the ev-loop.
+class IoUring final {
+ public:
+  /// Whether the running kernel supports io_uring with the features we use.
+  /// The result is computed once.
+  static bool IsSupported() noexcept;
+
+  explicit IoUring(std::size_t entries);
+
+  IoUring(const IoUring&) = delete;
+  IoUring& operator=(const IoUring&) = delete;
+  ~IoUring();
+
+  /// Returns the eventfd that becomes readable each time completions arrive.
+  int GetEventFd() const noexcept { return event_fd_; }
+
+  /// Returns a zeroed submission queue entry. The entry is submitted on the
+  /// next Flush(). If the submission queue is full, flushes it first.
+  io_uring_sqe& GetSqe();
+
+  /// Prepares a IORING_OP_POLL_ADD for `fd`, `poll_mask` is a mask of POLLIN,
+  /// POLLOUT. The handler is notified with a mask of the happened events.
+  void PreparePollAdd(int fd, std::uint32_t poll_mask,
+                      IoUringCompletionHandler& handler);
+
+  /// Prepares a cancellation of a IORING_OP_POLL_ADD previously submitted with
+  /// `handler`. The poll operation is then completed with -ECANCELED, unless
+  /// it has already completed.
+  void PreparePollRemove(IoUringCompletionHandler& handler);
+
+  /// Submits all the prepared entries in one syscall.
+  void Flush() noexcept;
+
+  /// Reaps the arrived completions and notifies their handlers. Resets the
+  /// eventfd. Returns the number of processed completions.
+  std::size_t ProcessCompletions() noexcept;
+
+  std::size_t GetPendingSubmissionsCount() const noexcept {
+    return sqe_tail_ - sqe_head_;
+  }
+
+ private:
+  void Cleanup() noexcept;
+
+  int ring_fd_{-1};
+  int event_fd_{-1};
+
+  void* sq_ring_ptr_{nullptr};
+  std::size_t sq_ring_size_{0};
+  void* cq_ring_ptr_{nullptr};
+  std::size_t cq_ring_size_{0};
+  io_uring_sqe* sqes_{nullptr};
+  std::size_t sqes_size_{0};
+
+  unsigned* sq_khead_{nullptr};
+  unsigned* sq_ktail_{nullptr};
+  unsigned sq_mask_{0};
+  unsigned sq_entries_{0};
+
+  unsigned* cq_khead_{nullptr};
+  unsigned* cq_ktail_{nullptr};
+  unsigned cq_mask_{0};
+  io_uring_cqe* cqes_{nullptr};
+
+  // Entries in [sqe_head_, sqe_tail_) are prepared, but not yet submitted
+  unsigned sqe_head_{0};
+  unsigned sqe_tail_{0};
+};
+
+}  // namespace engine::ev
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,176 @@
+#include <engine/ev/io_uring.hpp>
+
+#include <poll.h>
+#include <unistd.h>
+
+#include <array>
+#include <string_view>
+
+#include <gtest/gtest.h>
+
+#include <userver/engine/async.hpp>
+#include <userver/engine/io/socket.hpp>
+#include <userver/engine/run_standalone.hpp>
+#include <userver/engine/sleep.hpp>
+#include <userver/internal/net/net_listener.hpp>
+#include <userver/utest/utest.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+class PollHandler final : public engine::ev::IoUringCompletionHandler {
+ public:
+  void OnIoUringCompletion(int result) noexcept override {
+    result_ = result;
+    ++calls_;
+  }
+
+  int GetResult() const { return result_; }
+  int GetCalls() const { return calls_; }
+
+ private:
+  int result_{0};
+  int calls_{0};
+};
+
+class Pipe final {
+ public:
+  Pipe() { EXPECT_EQ(::pipe(fds_.data()), 0); }
+  ~Pipe() {
+    ::close(fds_[0]);
+    ::close(fds_[1]);
+  }
+
+  int ReadFd() const { return fds_[0]; }
+  int WriteFd() const { return fds_[1]; }
+
+ private:
+  std::array<int, 2> fds_{-1, -1};
+};
+
+bool WaitForCompletion(engine::ev::IoUring& ring) {
+  pollfd pfd{ring.GetEventFd(), POLLIN, 0};
+  return ::poll(&pfd, 1, 10'000) == 1;
+}
+
+engine::TaskProcessorPoolsConfig MakeIoUringConfig() {
+  engine::TaskProcessorPoolsConfig config;
+  config.ev_io_uring_enabled = true;
+  return config;
+}
+
+}  // namespace
+
+TEST(IoUring, PollAdd) {
+  if (!engine::ev::IoUring::IsSupported()) GTEST_SKIP() << "No io_uring";
+
+  engine::ev::IoUring ring{8};
+  Pipe pipe;
+  PollHandler handler;
+
+  ring.PreparePollAdd(pipe.ReadFd(), POLLIN, handler);
+  EXPECT_EQ(ring.GetPendingSubmissionsCount(), 1);
+  ring.Flush();
+  EXPECT_EQ(ring.GetPendingSubmissionsCount(), 0);
+  EXPECT_EQ(handler.GetCalls(), 0);
+
+  ASSERT_EQ(::write(pipe.WriteFd(), "x", 1), 1);
+  ASSERT_TRUE(WaitForCompletion(ring));
+  EXPECT_EQ(ring.ProcessCompletions(), 1);
+  EXPECT_EQ(handler.GetCalls(), 1);
+  EXPECT_TRUE(handler.GetResult() & POLLIN);
+}
+
+TEST(IoUring, PollRemove) {
+  if (!engine::ev::IoUring::IsSupported()) GTEST_SKIP() << "No io_uring";
+
+  engine::ev::IoUring ring{8};
+  Pipe pipe;
+  PollHandler handler;
+
+  ring.PreparePollAdd(pipe.ReadFd(), POLLIN, handler);
+  ring.Flush();
+  ring.PreparePollRemove(handler);
+  ring.Flush();
+
+  // Completions of both the poll and the removal
+  std::size_t processed = 0;
+  while (processed < 2) {
+    ASSERT_TRUE(WaitForCompletion(ring));
+    processed += ring.ProcessCompletions();
+  }
+  EXPECT_EQ(handler.GetCalls(), 1);
+  EXPECT_EQ(handler.GetResult(), -ECANCELED);
+}
+
+TEST(IoUring, SubmissionQueueOverflow) {
+  if (!engine::ev::IoUring::IsSupported()) GTEST_SKIP() << "No io_uring";
+
+  engine::ev::IoUring ring{2};
+  Pipe pipe;
+  std::array<PollHandler, 16> handlers;
+
+  // Entries that do not fit into the SQ are submitted right away
+  for (auto& handler : handlers) {
+    ring.PreparePollAdd(pipe.ReadFd(), POLLIN, handler);
+  }
+  ring.Flush();
+
+  ASSERT_EQ(::write(pipe.WriteFd(), "x", 1), 1);
+  std::size_t processed = 0;
+  while (processed < handlers.size()) {
+    ASSERT_TRUE(WaitForCompletion(ring));
+    processed += ring.ProcessCompletions();
+  }
+  for (const auto& handler : handlers) EXPECT_EQ(handler.GetCalls(), 1);
+}
+
+TEST(IoUring, SocketPingPong) {
+  engine::RunStandalone(2, MakeIoUringConfig(), [] {
+    const auto deadline =
+        engine::Deadline::FromDuration(utest::kMaxTestWaitTime);
+    internal::net::TcpListener listener;
+    auto [server, client] = listener.MakeSocketPair(deadline);
+
+    auto echo = engine::AsyncNoSpan([&server = server, deadline] {
+      std::array<char, 16> buf{};
+      for (int i = 0; i < 100; ++i) {
+        const auto size = server.RecvSome(buf.data(), buf.size(), deadline);
+        ASSERT_GT(size, 0);
+        ASSERT_EQ(server.SendAll(buf.data(), size, deadline), size);
+      }
+    });
+
+    std::array<char, 4> buf{};
+    for (int i = 0; i < 100; ++i) {
+      ASSERT_EQ(client.SendAll("ping", 4, deadline), 4);
+      ASSERT_EQ(client.RecvAll(buf.data(), buf.size(), deadline), 4);
+      EXPECT_EQ(std::string_view(buf.data(), buf.size()), "ping");
+    }
+    echo.Get();
+  });
+}
+
+TEST(IoUring, SocketRecvTimeout) {
+  engine::RunStandalone(1, MakeIoUringConfig(), [] {
+    const auto deadline =
+        engine::Deadline::FromDuration(utest::kMaxTestWaitTime);
+    internal::net::TcpListener listener;
+    auto [server, client] = listener.MakeSocketPair(deadline);
+
+    std::array<char, 4> buf{};
+    const auto short_deadline =
+        engine::Deadline::FromDuration(std::chrono::milliseconds{10});
+    EXPECT_THROW(
+        [[maybe_unused]] auto size =
+            server.RecvSome(buf.data(), buf.size(), short_deadline),
+        engine::io::IoTimeout);
+
+    // The socket is still usable after a cancelled poll
+    ASSERT_EQ(client.SendAll("pong", 4, deadline), 4);
+    EXPECT_EQ(server.RecvAll(buf.data(), buf.size(), deadline), 4);
+  });
+}
+
+USERVER_NAMESPACE_END
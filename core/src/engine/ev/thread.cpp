@@ -1,5 +1,6 @@
 #include "thread.hpp"
 
+#include <algorithm>
 #include <chrono>
 #include <stdexcept>
 
@@ -19,6 +20,8 @@
 #include <utils/statistics/thread_statistics.hpp>
 
 #include "child_process_map.hpp"
+#include "io_uring.hpp"
+#include "timer_wheel.hpp"
 
 USERVER_NAMESPACE_BEGIN
 
@@ -60,26 +63,49 @@ void ReleaseEvDefaultLoop() {
 constexpr std::chrono::milliseconds kCpuStatsCollectInterval{1000};
 constexpr std::size_t kCpuStatsThrottle{16};
 
+// Submission queue size. More entries may be prepared during a single ev-loop
+// iteration, in that case IoUring flushes the queue in the middle of it.
+constexpr std::size_t kIoUringEntries{1024};
+
 }  // namespace
 
 Thread::Thread(const std::string& thread_name,
-               RegisterEventMode register_event_mode)
-    : Thread(thread_name, false, register_event_mode) {}
+               RegisterEventMode register_event_mode, IoBackend io_backend,
+               TimerBackend timer_backend, utils::numa::ThreadAffinity affinity)
+    : Thread(thread_name, false, register_event_mode, io_backend,
+             timer_backend, std::move(affinity)) {}
 
 Thread::Thread(const std::string& thread_name, UseDefaultEvLoop,
-               RegisterEventMode register_event_mode)
-    : Thread(thread_name, true, register_event_mode) {}
+               RegisterEventMode register_event_mode, IoBackend io_backend,
+               TimerBackend timer_backend, utils::numa::ThreadAffinity affinity)
+    : Thread(thread_name, true, register_event_mode, io_backend,
+             timer_backend, std::move(affinity)) {}
 
 Thread::Thread(const std::string& thread_name, bool use_ev_default_loop,
-               RegisterEventMode register_event_mode)
+               RegisterEventMode register_event_mode, IoBackend io_backend,
+               TimerBackend timer_backend,
+               utils::numa::ThreadAffinity affinity)
     : use_ev_default_loop_(use_ev_default_loop),
       register_event_mode_(register_event_mode),
       loop_(nullptr),
       lock_(loop_mutex_, std::defer_lock),
       name_{thread_name},
+      affinity_(std::move(affinity)),
       cpu_stats_storage_{kCpuStatsCollectInterval, kCpuStatsThrottle},
       is_running_(false) {
   if (use_ev_default_loop_) AcquireEvDefaultLoop(name_);
+  if (io_backend == IoBackend::kIoUring) {
+    if (IoUring::IsSupported()) {
+      io_uring_ = std::make_unique<IoUring>(kIoUringEntries);
+    } else {
+      LOG_WARNING() << "io_uring is not supported by the kernel, falling back "
+                       "to libev for thread_name="
+                    << name_;
+    }
+  }
+  if (timer_backend == TimerBackend::kTimerWheel) {
+    timer_wheel_ = std::make_unique<TimerWheel>();
+  }
   Start();
 }
 
@@ -92,7 +118,12 @@ Thread::~Thread() {
 void Thread::RunInEvLoopAsync(AsyncPayloadBase& payload) noexcept {
   RegisterInEvLoop(payload);
 
-  if (!IsInEvThread()) {
+  // acq_rel pairs with the reset in UpdateLoopWatcherImpl(): if the flag is
+  // already set, the ev thread is yet to drain the queue and will see
+  // the payload.
+  if (!IsInEvThread() &&
+      !is_wakeup_pending_.exchange(true, std::memory_order_acq_rel)) {
+    wakeups_.fetch_add(1, std::memory_order_relaxed);
     ev_async_send(loop_, &watch_update_);
   }
 }
@@ -135,6 +166,14 @@ std::uint8_t Thread::GetCurrentLoadPercent() const {
 
 const std::string& Thread::GetName() const { return name_; }
 
+PayloadQueueStats Thread::GetPayloadQueueStats() const noexcept {
+  PayloadQueueStats stats;
+  stats.payloads = payloads_.load(std::memory_order_relaxed);
+  stats.batches = payload_batches_.load(std::memory_order_relaxed);
+  stats.wakeups = wakeups_.load(std::memory_order_relaxed);
+  return stats;
+}
+
 void Thread::Start() {
   loop_ = use_ev_default_loop_ ? ev_default_loop(EVFLAG_AUTO)
                                : ev_loop_new(EVFLAG_AUTO);
@@ -183,9 +222,23 @@ void Thread::Start() {
     ev_child_start(loop_, &watch_child_);
   }
 
+  if (io_uring_) {
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-type-cstyle-cast)
+    ev_io_init(&watch_io_uring_, IoUringCompletionsWatcher,
+               io_uring_->GetEventFd(), EV_READ);
+    ev_io_start(loop_, &watch_io_uring_);
+  }
+
+  if (timer_wheel_) {
+    // Armed on demand to the next wakeup of the wheel
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-type-cstyle-cast)
+    ev_timer_init(&timer_wheel_driver_, TimerWheelWatcher, 0.0, 0.0);
+  }
+
   is_running_ = true;
   thread_ = std::thread([this] {
     utils::SetCurrentThreadName(name_);
+    utils::numa::BindCurrentThread(affinity_);
     RunEvLoop();
   });
 }
@@ -200,6 +253,8 @@ void Thread::StopEventLoop() {
 
   if (!use_ev_default_loop_) ev_loop_destroy(loop_);
   loop_ = nullptr;
+  io_uring_.reset();
+  timer_wheel_.reset();
 }
 
 void Thread::RunEvLoop() {
@@ -207,6 +262,10 @@ void Thread::RunEvLoop() {
     AcquireImpl();
     ev_run(loop_, EVRUN_ONCE);
     UpdateLoopWatcherImpl();
+    if (timer_wheel_) AdvanceTimerWheel();
+    // Submit all the io_uring operations prepared during this iteration at
+    // once
+    if (io_uring_) io_uring_->Flush();
     cpu_stats_storage_.Collect();
     ReleaseImpl();
   }
@@ -219,6 +278,8 @@ void Thread::RunEvLoop() {
     ev_timer_stop(loop_, &stats_timer_);
   }
   if (use_ev_default_loop_) ev_child_stop(loop_, &watch_child_);
+  if (io_uring_) ev_io_stop(loop_, &watch_io_uring_);
+  if (timer_wheel_) ev_timer_stop(loop_, &timer_wheel_driver_);
 }
 
 void Thread::UpdateLoopWatcher(struct ev_loop* loop, ev_async*, int) noexcept {
@@ -235,7 +296,14 @@ void Thread::UpdateTimersWatcher(struct ev_loop* loop, ev_timer*,
 }
 
 void Thread::UpdateLoopWatcherImpl() {
+  // Producers that push after this point signal the ev thread again
+  if (is_wakeup_pending_.load(std::memory_order_relaxed)) {
+    is_wakeup_pending_.exchange(false, std::memory_order_acq_rel);
+  }
+
+  std::uint64_t batch_size = 0;
   while (AsyncPayloadBase* payload = func_queue_.TryPop()) {
+    ++batch_size;
     LOG_TRACE() << "Thread::UpdateLoopWatcherImpl(), "
                 << compiler::GetTypeName(typeid(*payload));
     try {
@@ -244,6 +312,14 @@ void Thread::UpdateLoopWatcherImpl() {
       LOG_WARNING() << "exception in async thread func: " << ex;
     }
   }
+
+  if (batch_size != 0) {
+    payloads_.store(payloads_.load(std::memory_order_relaxed) + batch_size,
+                    std::memory_order_relaxed);
+    payload_batches_.store(
+        payload_batches_.load(std::memory_order_relaxed) + 1,
+        std::memory_order_relaxed);
+  }
 }
 
 void Thread::BreakLoopWatcher(struct ev_loop* loop, ev_async*, int) noexcept {
@@ -258,6 +334,50 @@ void Thread::BreakLoopWatcherImpl() {
   ev_break(loop_, EVBREAK_ALL);
 }
 
+void Thread::IoUringCompletionsWatcher(struct ev_loop* loop, ev_io*,
+                                       int) noexcept {
+  auto* ev_thread = static_cast<Thread*>(ev_userdata(loop));
+  UASSERT(ev_thread != nullptr);
+  UASSERT(ev_thread->io_uring_);
+  ev_thread->io_uring_->ProcessCompletions();
+}
+
+void Thread::TimerWheelWatcher(struct ev_loop* loop, ev_timer*,
+                               int) noexcept {
+  auto* ev_thread = static_cast<Thread*>(ev_userdata(loop));
+  UASSERT(ev_thread != nullptr);
+  UASSERT(ev_thread->timer_wheel_);
+  ev_thread->AdvanceTimerWheel();
+}
+
+void Thread::AdvanceTimerWheel() noexcept {
+  UASSERT(timer_wheel_);
+  const auto now = TimerWheel::Clock::now();
+  // All the timers expired during this iteration are fired at once
+  timer_wheel_->Advance(now);
+
+  const auto next_wakeup = timer_wheel_->GetNextWakeup();
+  if (!next_wakeup) {
+    ev_timer_stop(loop_, &timer_wheel_driver_);
+    return;
+  }
+  if (ev_is_active(&timer_wheel_driver_) &&
+      *next_wakeup == timer_wheel_next_wakeup_) {
+    return;
+  }
+
+  using LibEvDuration = std::chrono::duration<double>;
+  timer_wheel_next_wakeup_ = *next_wakeup;
+  const auto after = std::max(
+      std::chrono::duration_cast<LibEvDuration>(*next_wakeup - now).count(),
+      0.0);
+  ev_timer_stop(loop_, &timer_wheel_driver_);
+  ev_now_update(loop_);
+  // NOLINTNEXTLINE(cppcoreguidelines-pro-type-cstyle-cast)
+  ev_timer_set(&timer_wheel_driver_, after, 0.0);
+  ev_timer_start(loop_, &timer_wheel_driver_);
+}
+
 void Thread::ChildWatcher(struct ev_loop*, ev_child* w, int) noexcept {
   try {
     ChildWatcherImpl(w);
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <atomic>
+#include <chrono>
 #include <memory>
 #include <mutex>
 #include <string>
@@ -12,12 +13,17 @@
 
 #include <concurrent/impl/intrusive_mpsc_queue.hpp>
 #include <engine/ev/async_payload_base.hpp>
+#include <engine/ev/thread_pool_config.hpp>
+#include <utils/numa.hpp>
 #include <utils/statistics/thread_statistics.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
 namespace engine::ev {
 
+class IoUring;
+class TimerWheel;
+
 class Thread final {
  public:
   struct UseDefaultEvLoop {};
@@ -34,12 +40,24 @@ class Thread final {
     kDeferred
   };
 
-  Thread(const std::string& thread_name, RegisterEventMode);
-  Thread(const std::string& thread_name, UseDefaultEvLoop, RegisterEventMode);
+  Thread(const std::string& thread_name, RegisterEventMode,
+         IoBackend io_backend = IoBackend::kLibEv,
+         TimerBackend timer_backend = TimerBackend::kLibEv,
+         utils::numa::ThreadAffinity affinity = {});
+  Thread(const std::string& thread_name, UseDefaultEvLoop, RegisterEventMode,
+         IoBackend io_backend = IoBackend::kLibEv,
+         TimerBackend timer_backend = TimerBackend::kLibEv,
+         utils::numa::ThreadAffinity affinity = {});
   ~Thread();
 
   struct ev_loop* GetEvLoop() const { return loop_; }
 
+  // Returns nullptr if io_uring is not used by this thread
+  IoUring* GetIoUring() const noexcept { return io_uring_.get(); }
+
+  // Returns nullptr if the timer wheel is not used by this thread
+  TimerWheel* GetTimerWheel() const noexcept { return timer_wheel_.get(); }
+
   // Callbacks passed to RunInEvLoopAsync() are serialized.
   // All callbacks are guaranteed to execute.
   void RunInEvLoopAsync(AsyncPayloadBase& payload) noexcept;
@@ -55,9 +73,12 @@ class Thread final {
   std::uint8_t GetCurrentLoadPercent() const;
   const std::string& GetName() const;
 
+  PayloadQueueStats GetPayloadQueueStats() const noexcept;
+
  private:
   Thread(const std::string& thread_name, bool use_ev_default_loop,
-         RegisterEventMode register_event_mode);
+         RegisterEventMode register_event_mode, IoBackend io_backend,
+         TimerBackend timer_backend, utils::numa::ThreadAffinity affinity);
 
   void RegisterInEvLoop(AsyncPayloadBase& payload);
 
@@ -71,6 +92,10 @@ class Thread final {
   void UpdateLoopWatcherImpl();
   static void BreakLoopWatcher(struct ev_loop*, ev_async* w, int) noexcept;
   void BreakLoopWatcherImpl();
+  static void IoUringCompletionsWatcher(struct ev_loop*, ev_io* w,
+                                        int) noexcept;
+  static void TimerWheelWatcher(struct ev_loop*, ev_timer* w, int) noexcept;
+  void AdvanceTimerWheel() noexcept;
   static void ChildWatcher(struct ev_loop*, ev_child* w, int) noexcept;
   static void ChildWatcherImpl(ev_child* w);
 
@@ -80,6 +105,13 @@ class Thread final {
   void ReleaseImpl() noexcept;
 
   concurrent::impl::IntrusiveMpscQueue<AsyncPayloadBase> func_queue_;
+  // Set while the ev thread is signaled and has not drained func_queue_ yet,
+  // so that a single wakeup covers all the payloads pushed in the meantime.
+  std::atomic<bool> is_wakeup_pending_{false};
+  std::atomic<std::uint64_t> wakeups_{0};
+  // Written only by the ev thread
+  std::atomic<std::uint64_t> payloads_{0};
+  std::atomic<std::uint64_t> payload_batches_{0};
 
   bool use_ev_default_loop_;
   RegisterEventMode register_event_mode_;
@@ -94,8 +126,15 @@ class Thread final {
   ev_async watch_update_{};
   ev_async watch_break_{};
   ev_child watch_child_{};
+  ev_io watch_io_uring_{};
+  ev_timer timer_wheel_driver_{};
+
+  std::unique_ptr<IoUring> io_uring_;
+  std::unique_ptr<TimerWheel> timer_wheel_;
+  std::chrono::steady_clock::time_point timer_wheel_next_wakeup_{};
 
   const std::string name_;
+  const utils::numa::ThreadAffinity affinity_;
   utils::statistics::ThreadCpuStatsStorage cpu_stats_storage_;
 
   bool is_running_;
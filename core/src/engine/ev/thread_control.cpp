@@ -14,6 +14,14 @@ struct ev_loop* ThreadControlBase::GetEvLoop() const noexcept {
   return thread_.GetEvLoop();
 }
 
+IoUring* ThreadControlBase::GetIoUring() const noexcept {
+  return thread_.GetIoUring();
+}
+
+TimerWheel* ThreadControlBase::GetTimerWheel() const noexcept {
+  return thread_.GetTimerWheel();
+}
+
 void ThreadControlBase::RunPayloadInEvLoopAsync(
     AsyncPayloadBase& payload) noexcept {
   thread_.RunInEvLoopAsync(payload);
@@ -36,6 +44,10 @@ const std::string& ThreadControlBase::GetName() const {
   return thread_.GetName();
 }
 
+PayloadQueueStats ThreadControlBase::GetPayloadQueueStats() const noexcept {
+  return thread_.GetPayloadQueueStats();
+}
+
 // NOLINTNEXTLINE(readability-make-member-function-const)
 void ThreadControlBase::DoStart(ev_timer& w) noexcept {
   UASSERT(IsInEvThread());
@@ -102,11 +102,19 @@ class CallerOwnedPayloadBlocking final
 }  // namespace impl
 
 class Thread;
+class IoUring;
+class TimerWheel;
 
 class ThreadControlBase {
  public:
   struct ev_loop* GetEvLoop() const noexcept;
 
+  /// Returns nullptr if the thread does not use io_uring.
+  IoUring* GetIoUring() const noexcept;
+
+  /// Returns nullptr if the thread does not use the timer wheel.
+  TimerWheel* GetTimerWheel() const noexcept;
+
   /// Fast non allocating function to execute a `func(*data)` in EvLoop.
   void RunPayloadInEvLoopAsync(AsyncPayloadBase& payload) noexcept;
 
@@ -136,6 +144,8 @@ class ThreadControlBase {
   std::uint8_t GetCurrentLoadPercent() const;
   const std::string& GetName() const;
 
+  PayloadQueueStats GetPayloadQueueStats() const noexcept;
+
  protected:
   explicit ThreadControlBase(Thread& thread) noexcept;
 
@@ -30,6 +30,8 @@ ThreadPool::ThreadPool(ThreadPoolConfig config, bool use_ev_default_loop)
     : use_ev_default_loop_(use_ev_default_loop) {
   const auto register_timer_event_mode =
       GetRegisterEventMode(config.defer_events);
+  const auto affinity =
+      utils::numa::MakeThreadAffinity(config.cpu_set, config.numa_node);
 
   {
     default_threads_.threads =
@@ -38,8 +40,11 @@ ThreadPool::ThreadPool(ThreadPoolConfig config, bool use_ev_default_loop)
               fmt::format("{}_{}", config.thread_name, index);
           return (use_ev_default_loop && index == 0)
                      ? Thread(thread_name, Thread::kUseDefaultEvLoop,
-                              register_timer_event_mode)
-                     : Thread(thread_name, register_timer_event_mode);
+                              register_timer_event_mode, config.io_backend,
+                              config.timer_backend, affinity)
+                     : Thread(thread_name, register_timer_event_mode,
+                              config.io_backend, config.timer_backend,
+                              affinity);
         });
 
     default_threads_.thread_controls = utils::GenerateFixedArray(
@@ -50,9 +55,10 @@ ThreadPool::ThreadPool(ThreadPoolConfig config, bool use_ev_default_loop)
 
   {
     timer_threads_.threads = utils::GenerateFixedArray(
-        config.dedicated_timer_threads, [](std::size_t index) {
+        config.dedicated_timer_threads, [&](std::size_t index) {
           return Thread{fmt::format("ev-timer_{}", index),
-                        Thread::RegisterEventMode::kDeferred};
+                        Thread::RegisterEventMode::kDeferred, IoBackend::kLibEv,
+                        config.timer_backend, affinity};
         });
 
     // Although we expect to always have a dedicated timer thread[s]
@@ -1,18 +1,51 @@
 #include "thread_pool_config.hpp"
 
+#include <userver/utils/trivial_map.hpp>
+#include <userver/yaml_config/yaml_config.hpp>
+#include <utils/threads_count.hpp>
+
 USERVER_NAMESPACE_BEGIN
 
 namespace engine::ev {
 
+IoBackend Parse(const yaml_config::YamlConfig& value,
+                formats::parse::To<IoBackend>) {
+  static constexpr utils::TrivialBiMap kMap([](auto selector) {
+    return selector()
+        .Case(IoBackend::kLibEv, "libev")
+        .Case(IoBackend::kIoUring, "io-uring");
+  });
+
+  return utils::ParseFromValueString(value, kMap);
+}
+
+TimerBackend Parse(const yaml_config::YamlConfig& value,
+                   formats::parse::To<TimerBackend>) {
+  static constexpr utils::TrivialBiMap kMap([](auto selector) {
+    return selector()
+        .Case(TimerBackend::kLibEv, "libev")
+        .Case(TimerBackend::kTimerWheel, "timer-wheel");
+  });
+
+  return utils::ParseFromValueString(value, kMap);
+}
+
 ThreadPoolConfig Parse(const yaml_config::YamlConfig& value,
                        formats::parse::To<ThreadPoolConfig>) {
   ThreadPoolConfig config;
-  config.threads = value["threads"].As<std::size_t>(config.threads);
+  config.threads = utils::ParseThreadsCount(
+      value["threads"], value["threads_cpu_ratio"].As<double>(1.0),
+      config.threads);
   config.dedicated_timer_threads =
       value["dedicated_timer_threads"].As<std::size_t>(
           config.dedicated_timer_threads);
   config.thread_name = value["thread_name"].As<std::string>(config.thread_name);
   config.defer_events = value["defer_events"].As<bool>(config.defer_events);
+  config.io_backend = value["io_backend"].As<IoBackend>(config.io_backend);
+  config.timer_backend =
+      value["timer_backend"].As<TimerBackend>(config.timer_backend);
+  config.cpu_set = value["cpu_set"].As<std::string>(config.cpu_set);
+  config.numa_node = value["numa_node"].As<std::optional<std::size_t>>();
   return config;
 }
 
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <optional>
 #include <string>
 
 #include <userver/formats/yaml.hpp>
@@ -9,12 +10,32 @@ USERVER_NAMESPACE_BEGIN
 
 namespace engine::ev {
 
+enum class IoBackend {
+  kLibEv,
+  kIoUring,
+};
+
+IoBackend Parse(const yaml_config::YamlConfig& value,
+                formats::parse::To<IoBackend>);
+
+enum class TimerBackend {
+  kLibEv,
+  kTimerWheel,
+};
+
+TimerBackend Parse(const yaml_config::YamlConfig& value,
+                   formats::parse::To<TimerBackend>);
+
 struct ThreadPoolConfig {
   std::size_t threads = 2;
   std::size_t dedicated_timer_threads = 0;
   std::string thread_name = "event-worker";
   bool ev_default_loop_disabled = false;
   bool defer_events = false;
+  IoBackend io_backend = IoBackend::kLibEv;
+  TimerBackend timer_backend = TimerBackend::kLibEv;
+  std::string cpu_set;
+  std::optional<std::size_t> numa_node;
 };
 
 ThreadPoolConfig Parse(const yaml_config::YamlConfig& value,
@@ -0,0 +1,45 @@
+#include <engine/ev/thread.hpp>
+
+#include <atomic>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <engine/ev/thread_control.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+TEST(EvThread, PayloadQueueStats) {
+  engine::ev::Thread thread{"ev-test",
+                            engine::ev::Thread::RegisterEventMode::kImmediate};
+  engine::ev::ThreadControl thread_control{thread};
+
+  constexpr std::size_t kProducers = 4;
+  constexpr std::size_t kPayloadsPerProducer = 1000;
+  std::atomic<std::size_t> performed{0};
+
+  std::vector<std::thread> producers;
+  for (std::size_t i = 0; i < kProducers; ++i) {
+    producers.emplace_back([&] {
+      for (std::size_t j = 0; j < kPayloadsPerProducer; ++j) {
+        thread_control.RunInEvLoopAsync([&performed] { ++performed; });
+      }
+    });
+  }
+  for (auto& producer : producers) producer.join();
+
+  // Payloads are serialized, all the previous ones are performed by now
+  thread_control.RunInEvLoopBlocking([] {});
+  EXPECT_EQ(performed.load(), kProducers * kPayloadsPerProducer);
+
+  const auto stats = thread_control.GetPayloadQueueStats();
+  EXPECT_EQ(stats.payloads, kProducers * kPayloadsPerProducer + 1);
+  EXPECT_GE(stats.batches, 1);
+  EXPECT_LE(stats.batches, stats.payloads);
+  // A single wakeup covers all the payloads pushed before the queue is drained
+  EXPECT_LE(stats.wakeups, stats.payloads);
+  EXPECT_GE(stats.wakeups, 1);
+}
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,146 @@
+#include <engine/ev/timer_wheel.hpp>
+
+#include <algorithm>
+
+#include <userver/utils/assert.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace engine::ev {
+
+TimerWheel::TimerWheel(Clock::time_point now) noexcept
+    : current_tick_(ToTick(now)) {}
+
+TimerWheel::~TimerWheel() {
+  for (auto& level : levels_) {
+    for (auto& slot : level) slot.clear();
+  }
+}
+
+void TimerWheel::Schedule(TimerWheelEntry& entry,
+                          Clock::time_point deadline) noexcept {
+  Cancel(entry);
+  // Rounding up, so that the timer never fires before its deadline
+  const auto expiry_tick =
+      ToTick(deadline + kTickDuration - Clock::duration{1});
+  entry.expiry_tick_ = std::max(expiry_tick, current_tick_ + 1);
+  Insert(entry);
+}
+
+void TimerWheel::Cancel(TimerWheelEntry& entry) noexcept {
+  entry.hook_.unlink();
+}
+
+std::size_t TimerWheel::Advance(Clock::time_point now) noexcept {
+  const auto now_tick = ToTick(now);
+  if (now_tick <= current_tick_) return 0;
+
+  if (IsEmpty()) {
+    current_tick_ = now_tick;
+    return 0;
+  }
+
+  std::size_t fired = 0;
+  while (current_tick_ < now_tick) {
+    ++current_tick_;
+    // Entries of the upper levels are moved down once the lower level wraps
+    for (std::size_t level = 1; level < kLevels; ++level) {
+      const auto mask = (std::uint64_t{1} << (kSlotBits * level)) - 1;
+      if ((current_tick_ & mask) != 0) break;
+      Cascade(level);
+    }
+    fired += ExpireCurrentSlot();
+  }
+  return fired;
+}
+
+std::optional<TimerWheel::Clock::time_point> TimerWheel::GetNextWakeup()
+    const noexcept {
+  const auto& lowest_level = levels_[0];
+  for (std::uint64_t tick = current_tick_ + 1; tick <= current_tick_ + kSlots;
+       ++tick) {
+    if (!lowest_level[tick % kSlots].empty()) return FromTick(tick);
+  }
+
+  for (std::size_t level = 1; level < kLevels; ++level) {
+    for (const auto& slot : levels_[level]) {
+      if (!slot.empty()) {
+        // Upper levels cascade only on the lowest level wraps
+        return FromTick((current_tick_ | (kSlots - 1)) + 1);
+      }
+    }
+  }
+  return std::nullopt;
+}
+
+bool TimerWheel::IsEmpty() const noexcept {
+  for (const auto& level : levels_) {
+    for (const auto& slot : level) {
+      if (!slot.empty()) return false;
+    }
+  }
+  return true;
+}
+
+std::uint64_t TimerWheel::ToTick(Clock::time_point time_point) noexcept {
+  return time_point.time_since_epoch() / kTickDuration;
+}
+
+TimerWheel::Clock::time_point TimerWheel::FromTick(
+    std::uint64_t tick) noexcept {
+  return Clock::time_point{
+      std::chrono::duration_cast<Clock::duration>(tick * kTickDuration)};
+}
+
+void TimerWheel::Insert(TimerWheelEntry& entry) noexcept {
+  UASSERT(!entry.IsScheduled());
+  UASSERT(entry.expiry_tick_ >= current_tick_);
+
+  // The lowest level that the entry fits into without wrapping around
+  for (std::size_t level = 0; level < kLevels; ++level) {
+    const auto shift = kSlotBits * level;
+    const auto expiry_position = entry.expiry_tick_ >> shift;
+    if (expiry_position - (current_tick_ >> shift) < kSlots) {
+      levels_[level][expiry_position % kSlots].push_back(entry);
+      return;
+    }
+  }
+
+  // Too far in the future, parking in the farthest slot. The entry is
+  // reinserted on cascade until it fits.
+  constexpr auto kTopShift = kSlotBits * (kLevels - 1);
+  levels_[kLevels - 1][((current_tick_ >> kTopShift) + kSlots - 1) % kSlots]
+      .push_back(entry);
+}
+
+void TimerWheel::Cascade(std::size_t level) noexcept {
+  auto& slot = levels_[level][(current_tick_ >> (kSlotBits * level)) % kSlots];
+  Slot entries;
+  entries.swap(slot);
+  while (!entries.empty()) {
+    auto& entry = entries.front();
+    entries.pop_front();
+    Insert(entry);
+  }
+}
+
+std::size_t TimerWheel::ExpireCurrentSlot() noexcept {
+  // Callbacks may schedule and cancel entries, including the ones from this
+  // slot
+  Slot expired;
+  expired.swap(levels_[0][current_tick_ % kSlots]);
+
+  std::size_t fired = 0;
+  while (!expired.empty()) {
+    auto& entry = expired.front();
+    expired.pop_front();
+    UASSERT(entry.expiry_tick_ <= current_tick_);
+    entry.OnTimerWheelExpired();
+    ++fired;
+  }
+  return fired;
+}
+
+}  // namespace engine::ev
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,102 @@
+#pragma once
+
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+
+#include <boost/intrusive/list.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace engine::ev {
+
+class TimerWheel;
+
+/// A timer scheduled into a TimerWheel. Is unscheduled automatically on
+/// destruction.
+class TimerWheelEntry {
+ public:
+  /// Called from TimerWheel::Advance() once the deadline is reached. The entry
+  /// is already unscheduled at that point and may be scheduled again.
+  virtual void OnTimerWheelExpired() noexcept = 0;
+
+  bool IsScheduled() const noexcept { return hook_.is_linked(); }
+
+ protected:
+  TimerWheelEntry() = default;
+  ~TimerWheelEntry() = default;
+
+ private:
+  friend class TimerWheel;
+
+  using Hook = boost::intrusive::list_member_hook<
+      boost::intrusive::link_mode<boost::intrusive::auto_unlink>>;
+
+  Hook hook_;
+  std::uint64_t expiry_tick_{0};
+};
+
+/// @brief Hierarchical timing wheel with a coarse fixed resolution.
+///
+/// Scheduling and cancellation are O(1), expired timers are fired in batches
+/// by Advance(). Timers never fire earlier than their deadline, but may fire
+/// up to one tick later.
+///
+/// Owned by an ev::Thread and only accessed from it, it is not thread-safe.
+class TimerWheel final {
+ public:
+  using Clock = std::chrono::steady_clock;
+
+  static constexpr std::chrono::milliseconds kTickDuration{1};
+
+  explicit TimerWheel(Clock::time_point now = Clock::now()) noexcept;
+
+  TimerWheel(const TimerWheel&) = delete;
+  TimerWheel& operator=(const TimerWheel&) = delete;
+  ~TimerWheel();
+
+  /// (Re)schedules the `entry` to expire at `deadline`. Already reached
+  /// deadlines expire on the next tick.
+  void Schedule(TimerWheelEntry& entry, Clock::time_point deadline) noexcept;
+
+  /// Unschedules the `entry`, does nothing if it is not scheduled.
+  static void Cancel(TimerWheelEntry& entry) noexcept;
+
+  /// Fires all the timers that expired by `now`. Returns the number of fired
+  /// timers.
+  std::size_t Advance(Clock::time_point now) noexcept;
+
+  /// Returns a time point not later than the earliest expiry, the wheel
+  /// should be advanced at that point. Returns std::nullopt if no timers are
+  /// scheduled.
+  std::optional<Clock::time_point> GetNextWakeup() const noexcept;
+
+  bool IsEmpty() const noexcept;
+
+ private:
+  static constexpr std::size_t kSlotBits = 6;
+  static constexpr std::size_t kSlots = std::size_t{1} << kSlotBits;
+  static constexpr std::size_t kLevels = 4;
+
+  using Slot = boost::intrusive::list<
+      TimerWheelEntry,
+      boost::intrusive::member_hook<TimerWheelEntry, TimerWheelEntry::Hook,
+                                    &TimerWheelEntry::hook_>,
+      boost::intrusive::constant_time_size<false>>;
+
+  static std::uint64_t ToTick(Clock::time_point time_point) noexcept;
+  static Clock::time_point FromTick(std::uint64_t tick) noexcept;
+
+  void Insert(TimerWheelEntry& entry) noexcept;
+  void Cascade(std::size_t level) noexcept;
+  std::size_t ExpireCurrentSlot() noexcept;
+
+  std::array<std::array<Slot, kSlots>, kLevels> levels_;
+  std::uint64_t current_tick_;
+};
+
+}  // namespace engine::ev
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,235 @@
+#include <engine/ev/timer_wheel.hpp>
+
+#include <chrono>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <userver/engine/async.hpp>
+#include <userver/engine/run_standalone.hpp>
+#include <userver/engine/single_consumer_event.hpp>
+#include <userver/engine/sleep.hpp>
+#include <userver/utest/utest.hpp>
+
+using namespace std::chrono_literals;
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+using Clock = engine::ev::TimerWheel::Clock;
+
+class TestEntry final : public engine::ev::TimerWheelEntry {
+ public:
+  void OnTimerWheelExpired() noexcept override { ++calls_; }
+
+  int GetCalls() const { return calls_; }
+
+ private:
+  int calls_{0};
+};
+
+class RescheduleEntry final : public engine::ev::TimerWheelEntry {
+ public:
+  RescheduleEntry(engine::ev::TimerWheel& wheel, Clock::time_point deadline)
+      : wheel_(wheel), deadline_(deadline) {}
+
+  void OnTimerWheelExpired() noexcept override {
+    if (++calls_ == 1) wheel_.Schedule(*this, deadline_);
+  }
+
+  int GetCalls() const { return calls_; }
+
+ private:
+  engine::ev::TimerWheel& wheel_;
+  const Clock::time_point deadline_;
+  int calls_{0};
+};
+
+engine::TaskProcessorPoolsConfig MakeTimerWheelConfig() {
+  engine::TaskProcessorPoolsConfig config;
+  config.ev_timer_wheel_enabled = true;
+  return config;
+}
+
+}  // namespace
+
+TEST(TimerWheel, Empty) {
+  const auto start = Clock::now();
+  engine::ev::TimerWheel wheel{start};
+  EXPECT_TRUE(wheel.IsEmpty());
+  EXPECT_FALSE(wheel.GetNextWakeup());
+  EXPECT_EQ(wheel.Advance(start + 1h), 0);
+}
+
+TEST(TimerWheel, NeverFiresEarly) {
+  const auto start = Clock::now();
+  engine::ev::TimerWheel wheel{start};
+
+  TestEntry entry;
+  wheel.Schedule(entry, start + 10ms + 1us);
+  EXPECT_TRUE(entry.IsScheduled());
+  EXPECT_FALSE(wheel.IsEmpty());
+
+  const auto wakeup = wheel.GetNextWakeup();
+  ASSERT_TRUE(wakeup);
+  EXPECT_GE(*wakeup, start + 10ms);
+  EXPECT_LE(*wakeup, start + 12ms);
+
+  EXPECT_EQ(wheel.Advance(start + 10ms), 0);
+  EXPECT_EQ(entry.GetCalls(), 0);
+
+  EXPECT_EQ(wheel.Advance(start + 12ms), 1);
+  EXPECT_EQ(entry.GetCalls(), 1);
+  EXPECT_FALSE(entry.IsScheduled());
+  EXPECT_TRUE(wheel.IsEmpty());
+}
+
+TEST(TimerWheel, PassedDeadline) {
+  const auto start = Clock::now();
+  engine::ev::TimerWheel wheel{start};
+
+  TestEntry entry;
+  wheel.Schedule(entry, start - 1s);
+  EXPECT_EQ(wheel.Advance(start), 0);
+  EXPECT_EQ(wheel.Advance(start + 1ms), 1);
+  EXPECT_EQ(entry.GetCalls(), 1);
+}
+
+TEST(TimerWheel, Cancel) {
+  const auto start = Clock::now();
+  engine::ev::TimerWheel wheel{start};
+
+  TestEntry entry;
+  wheel.Schedule(entry, start + 5ms);
+  engine::ev::TimerWheel::Cancel(entry);
+  EXPECT_FALSE(entry.IsScheduled());
+  EXPECT_TRUE(wheel.IsEmpty());
+
+  EXPECT_EQ(wheel.Advance(start + 1s), 0);
+  EXPECT_EQ(entry.GetCalls(), 0);
+
+  // Cancelling an unscheduled entry is a noop
+  engine::ev::TimerWheel::Cancel(entry);
+}
+
+TEST(TimerWheel, Reschedule) {
+  const auto start = Clock::now();
+  engine::ev::TimerWheel wheel{start};
+
+  TestEntry entry;
+  wheel.Schedule(entry, start + 5ms);
+  wheel.Schedule(entry, start + 1s);
+
+  EXPECT_EQ(wheel.Advance(start + 100ms), 0);
+  EXPECT_EQ(wheel.Advance(start + 1s + 2ms), 1);
+  EXPECT_EQ(entry.GetCalls(), 1);
+}
+
+TEST(TimerWheel, RescheduleFromCallback) {
+  const auto start = Clock::now();
+  engine::ev::TimerWheel wheel{start};
+
+  RescheduleEntry entry{wheel, start + 50ms};
+  wheel.Schedule(entry, start + 5ms);
+
+  EXPECT_EQ(wheel.Advance(start + 10ms), 1);
+  EXPECT_TRUE(entry.IsScheduled());
+  EXPECT_EQ(wheel.Advance(start + 52ms), 1);
+  EXPECT_EQ(entry.GetCalls(), 2);
+}
+
+TEST(TimerWheel, Cascade) {
+  const auto start = Clock::now();
+  engine::ev::TimerWheel wheel{start};
+
+  // Deadlines that land into all the levels of the wheel and beyond
+  const std::vector<Clock::duration> timeouts{
+      1ms, 63ms, 64ms, 65ms, 4095ms, 4097ms, 5min, 5h, 30h};
+  std::vector<TestEntry> entries(timeouts.size());
+  for (std::size_t i = 0; i < timeouts.size(); ++i) {
+    wheel.Schedule(entries[i], start + timeouts[i]);
+  }
+
+  auto now = start;
+  std::size_t fired = 0;
+  while (auto wakeup = wheel.GetNextWakeup()) {
+    ASSERT_GT(*wakeup, now);
+    now = *wakeup;
+    fired += wheel.Advance(now);
+
+    for (std::size_t i = 0; i < timeouts.size(); ++i) {
+      const auto is_reached = start + timeouts[i] <= now;
+      // An entry fires once the deadline is reached, not earlier and at most
+      // a tick later
+      if (!is_reached) {
+        EXPECT_EQ(entries[i].GetCalls(), 0) << i;
+      } else if (now - (start + timeouts[i]) >= 2ms) {
+        EXPECT_EQ(entries[i].GetCalls(), 1) << i;
+      }
+    }
+  }
+
+  EXPECT_EQ(fired, timeouts.size());
+  for (const auto& entry : entries) EXPECT_EQ(entry.GetCalls(), 1);
+}
+
+TEST(TimerWheel, ManyEntriesSameTick) {
+  const auto start = Clock::now();
+  engine::ev::TimerWheel wheel{start};
+
+  std::vector<TestEntry> entries(100);
+  for (auto& entry : entries) wheel.Schedule(entry, start + 200ms);
+
+  EXPECT_EQ(wheel.Advance(start + 202ms), entries.size());
+  for (const auto& entry : entries) EXPECT_EQ(entry.GetCalls(), 1);
+}
+
+TEST(TimerWheel, DestroyedEntryIsUnscheduled) {
+  const auto start = Clock::now();
+  engine::ev::TimerWheel wheel{start};
+
+  {
+    TestEntry entry;
+    wheel.Schedule(entry, start + 5ms);
+  }
+  EXPECT_TRUE(wheel.IsEmpty());
+  EXPECT_EQ(wheel.Advance(start + 10ms), 0);
+}
+
+TEST(TimerWheel, EngineSleepAndDeadline) {
+  engine::RunStandalone(2, MakeTimerWheelConfig(), [] {
+    const auto start = Clock::now();
+    engine::SleepFor(10ms);
+    EXPECT_GE(Clock::now() - start, 10ms);
+
+    engine::SingleConsumerEvent event;
+    EXPECT_FALSE(event.WaitForEventFor(5ms));
+    EXPECT_GE(Clock::now() - start, 15ms);
+
+    auto task = engine::AsyncNoSpan(engine::Deadline::FromDuration(5ms), [] {
+      engine::InterruptibleSleepFor(utest::kMaxTestWaitTime);
+    });
+    task.WaitFor(utest::kMaxTestWaitTime);
+    ASSERT_TRUE(task.IsFinished());
+    EXPECT_EQ(task.CancellationReason(),
+              engine::TaskCancellationReason::kDeadline);
+  });
+}
+
+TEST(TimerWheel, EngineManySleepers) {
+  engine::RunStandalone(2, MakeTimerWheelConfig(), [] {
+    std::vector<engine::TaskWithResult<void>> tasks;
+    for (int i = 0; i < 100; ++i) {
+      tasks.push_back(engine::AsyncNoSpan([i] {
+        const auto start = Clock::now();
+        const auto timeout = std::chrono::milliseconds{i % 10};
+        engine::SleepFor(timeout);
+        EXPECT_GE(Clock::now() - start, timeout);
+      }));
+    }
+    for (auto& task : tasks) task.Get();
+  });
+}
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,186 @@
+#include <engine/ev/watcher/io_uring_watcher.hpp>
+
+#include <poll.h>
+
+#include <cerrno>
+
+#include <ev.h>
+
+#include <userver/engine/single_use_event.hpp>
+#include <userver/utils/assert.hpp>
+#include <userver/utils/fast_scope_guard.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace engine::ev {
+
+namespace {
+
+std::uint32_t ToPollMask(int ev_events) noexcept {
+  std::uint32_t mask = 0;
+  if (ev_events & EV_READ) mask |= POLLIN;
+  if (ev_events & EV_WRITE) mask |= POLLOUT;
+  return mask;
+}
+
+int ToEvEvents(int poll_result, int requested_ev_events) noexcept {
+  // Errors and hangups are reported as readiness for all the requested
+  // events, the following syscall would report the actual error.
+  if (poll_result < 0 || (poll_result & (POLLERR | POLLHUP | POLLNVAL))) {
+    return requested_ev_events;
+  }
+
+  int ev_events = 0;
+  if (poll_result & (POLLIN | POLLRDHUP)) ev_events |= EV_READ;
+  if (poll_result & POLLOUT) ev_events |= EV_WRITE;
+  return (ev_events & requested_ev_events) ? (ev_events & requested_ev_events)
+                                           : requested_ev_events;
+}
+
+IoUring& GetIoUringChecked(const ThreadControl& thread_control) {
+  auto* const io_uring = thread_control.GetIoUring();
+  UINVARIANT(io_uring, "io_uring is not enabled for ev thread " +
+                           thread_control.GetName());
+  return *io_uring;
+}
+
+}  // namespace
+
+IoUringWatcher::IoUringWatcher(const ThreadControl& thread_control, void* data,
+                               Callback callback)
+    : thread_control_(thread_control),
+      io_uring_(GetIoUringChecked(thread_control_)),
+      data_(data),
+      callback_(callback) {
+  UASSERT(callback_);
+}
+
+IoUringWatcher::~IoUringWatcher() {
+  Stop();
+  UASSERT(!IsActive());
+}
+
+void IoUringWatcher::Set(int fd, int ev_events) {
+  UASSERT(!is_running_);
+  fd_ = fd;
+  ev_events_ = ev_events;
+}
+
+void IoUringWatcher::Stop() {
+  if (!IsActive()) return;
+
+  // Make sure that ~IoUringWatcher() does not return while we are working
+  // with *this in the ev thread.
+  ++pending_op_count_;
+  utils::FastScopeGuard guard([this]() noexcept { --pending_op_count_; });
+
+  SingleUseEvent stopped;
+  bool should_wait = false;
+  thread_control_.RunInEvLoopSync([this, &stopped, &should_wait] {
+    StopImpl();
+    if (is_polling_) {
+      stop_event_ = &stopped;
+      should_wait = true;
+    }
+  });
+
+  // The poll operation references *this until its completion arrives
+  if (should_wait) stopped.WaitNonCancellable();
+}
+
+void IoUringWatcher::StartAsync() { PushAsyncOp(AsyncOpType::kStart); }
+
+void IoUringWatcher::StopAsync() {
+  if (!IsActive()) return;
+  PushAsyncOp(AsyncOpType::kStop);
+}
+
+void IoUringWatcher::DoPerformAndRelease() {
+  utils::FastScopeGuard release_guard([this]() noexcept {
+    // Same as for Watcher: as long as pending_op_count_ != 0, the owner
+    // will not destroy *this immediately.
+    --pending_op_count_;
+  });
+
+  const auto op = pending_async_op_.exchange({}, std::memory_order_relaxed);
+  switch (op) {
+    case AsyncOpType::kNone:
+      break;
+    case AsyncOpType::kStart:
+      StartImpl();
+      break;
+    case AsyncOpType::kStop:
+      StopImpl();
+      break;
+    default:
+      UINVARIANT(false, "Invalid AsyncOpType value");
+  }
+}
+
+void IoUringWatcher::PushAsyncOp(AsyncOpType op) {
+  pending_async_op_.store(op, std::memory_order_relaxed);
+  if (this->PrepareEnqueue()) {
+    ++pending_op_count_;
+    thread_control_.RunPayloadInEvLoopDeferred(*this, {});
+  }
+}
+
+bool IoUringWatcher::IsActive() const noexcept {
+  return pending_op_count_ != 0 || is_running_;
+}
+
+void IoUringWatcher::StartImpl() {
+  UASSERT(thread_control_.IsInEvThread());
+  UASSERT(fd_ != -1);
+
+  if (is_polling_) {
+    // A cancelled poll is still in flight, start a new one once it completes
+    if (is_remove_requested_) should_restart_ = true;
+    return;
+  }
+
+  io_uring_.PreparePollAdd(fd_, ToPollMask(ev_events_), *this);
+  is_polling_ = true;
+  is_running_ = true;
+}
+
+void IoUringWatcher::StopImpl() {
+  UASSERT(thread_control_.IsInEvThread());
+  should_restart_ = false;
+
+  if (!is_polling_) {
+    is_running_ = false;
+    return;
+  }
+
+  if (!is_remove_requested_) {
+    io_uring_.PreparePollRemove(*this);
+    is_remove_requested_ = true;
+  }
+}
+
+void IoUringWatcher::OnIoUringCompletion(int result) noexcept {
+  UASSERT(thread_control_.IsInEvThread());
+  UASSERT(is_polling_);
+  is_polling_ = false;
+
+  const bool was_cancelled = std::exchange(is_remove_requested_, false);
+  if (std::exchange(should_restart_, false)) {
+    StartImpl();
+    return;
+  }
+
+  is_running_ = false;
+  if (auto* const stop_event = std::exchange(stop_event_, nullptr)) {
+    // The watcher may be destroyed right after this call
+    stop_event->Send();
+    return;
+  }
+
+  if (was_cancelled || result == -ECANCELED) return;
+  callback_(data_, ToEvEvents(result, ev_events_));
+}
+
+}  // namespace engine::ev
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,86 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+
+#include <engine/ev/async_payload_base.hpp>
+#include <engine/ev/io_uring.hpp>
+#include <engine/ev/thread_control.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace engine {
+class SingleUseEvent;
+}  // namespace engine
+
+namespace engine::ev {
+
+/// @brief An io_uring based alternative to Watcher<ev_io>.
+///
+/// Waits for fd readiness with IORING_OP_POLL_ADD submitted from the bound
+/// ev thread. Follows the rules of Watcher: usable from coroutines and from
+/// the bound ev thread, Start/Stop operations are serialized on the ev thread.
+///
+/// The watcher is one-shot: it is already stopped when the callback is called.
+/// The callback is called on the ev thread with a mask of EV_READ/EV_WRITE.
+class IoUringWatcher final : public MultiShotAsyncPayload<IoUringWatcher>,
+                             private IoUringCompletionHandler {
+ public:
+  using Callback = void (*)(void* data, int ev_events) noexcept;
+
+  /// The ev thread must have io_uring enabled, see
+  /// ThreadControlBase::GetIoUring().
+  IoUringWatcher(const ThreadControl& thread_control, void* data,
+                 Callback callback);
+
+  ~IoUringWatcher();
+
+  /// Must not be called while the watcher is running.
+  void Set(int fd, int ev_events);
+
+  /// Synchronously stop the watcher, waiting for the kernel to acknowledge
+  /// the cancellation. Can be used from coroutines only.
+  void Stop();
+
+  /// Asynchronously start waiting.
+  void StartAsync();
+
+  /// Asynchronously stop waiting. Beware of dangling references!
+  void StopAsync();
+
+ private:
+  friend class MultiShotAsyncPayload<IoUringWatcher>;
+
+  enum class AsyncOpType : std::uint32_t { kNone, kStart, kStop };
+
+  void DoPerformAndRelease();
+  void PushAsyncOp(AsyncOpType op);
+  bool IsActive() const noexcept;
+
+  // Must be called on the bound ev thread
+  void StartImpl();
+  void StopImpl();
+  void OnIoUringCompletion(int result) noexcept override;
+
+  ThreadControl thread_control_;
+  IoUring& io_uring_;
+  void* const data_;
+  const Callback callback_;
+
+  int fd_{-1};
+  int ev_events_{0};
+
+  // Accessed only from the bound ev thread
+  bool is_polling_{false};
+  bool is_remove_requested_{false};
+  bool should_restart_{false};
+  SingleUseEvent* stop_event_{nullptr};
+
+  std::atomic<bool> is_running_{false};
+  std::atomic<AsyncOpType> pending_async_op_{{}};
+  std::atomic<std::size_t> pending_op_count_{0};
+};
+
+}  // namespace engine::ev
+
+USERVER_NAMESPACE_END
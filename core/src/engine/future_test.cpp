@@ -405,4 +405,131 @@ TYPED_UTEST(Future, AssignmentSendsBrokenPromise) {
   }
 }
 
+UTEST(Future, ThenInline) {
+  engine::Promise<int> promise;
+  auto future = promise.get_future()
+                    .ThenInline([](int value) { return value * 2; })
+                    .ThenInline([](int value) { return std::to_string(value); });
+  EXPECT_NE(future.wait_for(std::chrono::seconds{0}),
+            engine::FutureStatus::kReady);
+
+  promise.set_value(21);
+  EXPECT_EQ(future.wait_for(std::chrono::seconds{0}),
+            engine::FutureStatus::kReady);
+  EXPECT_EQ(future.get(), "42");
+}
+
+UTEST(Future, ThenInlineReady) {
+  engine::Promise<void> promise;
+  promise.set_value();
+
+  bool is_called = false;
+  auto future =
+      promise.get_future().ThenInline([&is_called] { is_called = true; });
+  EXPECT_TRUE(is_called);
+  UEXPECT_NO_THROW(future.get());
+}
+
+UTEST(Future, ThenInlineException) {
+  engine::Promise<int> promise;
+  bool is_called = false;
+  auto future = promise.get_future().ThenInline([&is_called](int) {
+    is_called = true;
+    return 0;
+  });
+  promise.set_exception(MyException::Create());
+  UEXPECT_THROW(future.get(), MyException);
+  EXPECT_FALSE(is_called);
+
+  auto throwing_future = engine::Promise<void>{}.get_future().ThenInline(
+      [] { throw MyException{}; });
+  UEXPECT_THROW(throwing_future.get(), std::future_error);
+
+  engine::Promise<void> void_promise;
+  auto rethrowing_future =
+      void_promise.get_future().ThenInline([] { throw MyException{}; });
+  void_promise.set_value();
+  UEXPECT_THROW(rethrowing_future.get(), MyException);
+}
+
+UTEST_MT(Future, ThenInlineFromOtherThread, 2) {
+  engine::Promise<int> promise;
+  auto future = promise.get_future().ThenInline([](int value) {
+    EXPECT_FALSE(engine::current_task::IsTaskProcessorThread());
+    return value + 1;
+  });
+
+  std::thread([promise = std::move(promise)]() mutable {
+    promise.set_value(1);
+  }).join();
+  EXPECT_EQ(future.get(), 2);
+}
+
+UTEST_MT(Future, Then, 2) {
+  auto& task_processor = engine::current_task::GetTaskProcessor();
+  engine::Promise<int> promise;
+  auto future = promise.get_future().Then(task_processor, [](int value) {
+    EXPECT_TRUE(engine::current_task::IsTaskProcessorThread());
+    return value + 1;
+  });
+
+  std::thread([promise = std::move(promise)]() mutable {
+    promise.set_value(1);
+  }).join();
+  EXPECT_EQ(future.get(), 2);
+}
+
+UTEST_MT(Future, WhenAll, 4) {
+  constexpr std::size_t kFuturesCount = 10;
+  std::vector<engine::Promise<int>> promises(kFuturesCount);
+  std::vector<engine::Future<int>> futures;
+  for (auto& promise : promises) futures.push_back(promise.get_future());
+  auto all = engine::WhenAll(std::move(futures));
+
+  std::vector<engine::TaskWithResult<void>> tasks;
+  for (std::size_t i = 0; i < kFuturesCount; ++i) {
+    tasks.push_back(engine::AsyncNoSpan(
+        [&promises, i] { promises[i].set_value(static_cast<int>(i)); }));
+  }
+
+  const auto values = all.get();
+  ASSERT_EQ(values.size(), kFuturesCount);
+  for (std::size_t i = 0; i < kFuturesCount; ++i) {
+    EXPECT_EQ(values[i], static_cast<int>(i));
+  }
+  for (auto& task : tasks) task.Get();
+}
+
+UTEST(Future, WhenAllVoidException) {
+  engine::Promise<void> first;
+  engine::Promise<void> second;
+  std::vector<engine::Future<void>> futures;
+  futures.push_back(first.get_future());
+  futures.push_back(second.get_future());
+  auto all = engine::WhenAll(std::move(futures));
+
+  second.set_exception(MyException::Create());
+  EXPECT_NE(all.wait_for(std::chrono::seconds{0}),
+            engine::FutureStatus::kReady);
+  first.set_value();
+  UEXPECT_THROW(all.get(), MyException);
+
+  UEXPECT_NO_THROW(
+      engine::WhenAll(std::vector<engine::Future<void>>{}).get());
+}
+
+UTEST(Future, WhenAny) {
+  std::vector<engine::Promise<std::string>> promises(3);
+  std::vector<engine::Future<std::string>> futures;
+  for (auto& promise : promises) futures.push_back(promise.get_future());
+  auto any = engine::WhenAny(futures);
+
+  promises[1].set_value("second");
+  EXPECT_EQ(any.get(), 1);
+  EXPECT_EQ(futures[1].get(), "second");
+
+  promises[0].set_value("first");
+  EXPECT_EQ(futures[0].get(), "first");
+}
+
 USERVER_NAMESPACE_END
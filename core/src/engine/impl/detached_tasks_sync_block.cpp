@@ -1,10 +1,16 @@
 #include <userver/engine/impl/detached_tasks_sync_block.hpp>
 
+#include <algorithm>
 #include <atomic>
+#include <memory>
 #include <optional>
+#include <thread>
 
+#include <userver/compiler/thread_local.hpp>
+#include <userver/concurrent/impl/interference_shield.hpp>
 #include <userver/utils/assert.hpp>
 #include <userver/utils/impl/wait_token_storage.hpp>
+#include <userver/utils/span.hpp>
 
 #include <concurrent/intrusive_walkable_pool.hpp>
 #include <engine/task/task_context.hpp>
@@ -13,10 +19,36 @@ USERVER_NAMESPACE_BEGIN
 
 namespace engine::impl {
 
+namespace {
+
+// Tasks are registered in a shard picked by the current thread, so that
+// threads that detach tasks at a high rate do not contend on the same free
+// list and token counter.
+constexpr std::size_t kMaxShardCount = 16;
+
+std::size_t GetShardCount() noexcept {
+  static const std::size_t shard_count = std::clamp<std::size_t>(
+      std::thread::hardware_concurrency(), 1, kMaxShardCount);
+  return shard_count;
+}
+
+std::atomic<std::size_t> next_thread_shard_index{0};
+
+compiler::ThreadLocal local_shard_index = [] {
+  return next_thread_shard_index.fetch_add(1, std::memory_order_relaxed);
+};
+
+std::size_t GetLocalShardIndex() noexcept {
+  auto shard_index = local_shard_index.Use();
+  return *shard_index;
+}
+
+}  // namespace
+
 struct DetachedTasksSyncBlock::Token final {
-  explicit Token(DetachedTasksSyncBlock& owner) : owner(owner) {}
+  explicit Token(Shard& shard) : shard(shard) {}
 
-  DetachedTasksSyncBlock& owner;
+  Shard& shard;
 
   concurrent::impl::IntrusiveWalkablePoolHook<Token> pool_hook{};
 
@@ -27,32 +59,51 @@ struct DetachedTasksSyncBlock::Token final {
   utils::impl::WaitTokenStorage::Token wait_token{};
 };
 
-struct DetachedTasksSyncBlock::Impl final {
+struct DetachedTasksSyncBlock::Shard final {
   std::optional<utils::impl::WaitTokenStorage> wait_tokens{};
   concurrent::impl::IntrusiveWalkablePool<
       Token, concurrent::impl::MemberHook<&Token::pool_hook>>
       cancel_tokens{};
+};
+
+struct DetachedTasksSyncBlock::Impl final {
+  using ShieldedShard = concurrent::impl::InterferenceShield<Shard>;
+
+  utils::span<ShieldedShard> Shards() noexcept {
+    return {shards.get(), shard_count};
+  }
+
+  utils::span<const ShieldedShard> Shards() const noexcept {
+    return {shards.get(), shard_count};
+  }
+
+  const std::size_t shard_count{GetShardCount()};
+  const std::unique_ptr<ShieldedShard[]> shards{
+      std::make_unique<ShieldedShard[]>(shard_count)};
   std::atomic<TaskCancellationReason> cancel_new_tasks{
       TaskCancellationReason::kNone};
 };
 
 DetachedTasksSyncBlock::DetachedTasksSyncBlock(StopMode stop_mode) {
   if (stop_mode == StopMode::kCancelAndWait) {
-    impl_->wait_tokens.emplace();
+    for (auto& shard : impl_->Shards()) shard->wait_tokens.emplace();
   }
 }
 
 DetachedTasksSyncBlock::~DetachedTasksSyncBlock() = default;
 
 void DetachedTasksSyncBlock::Add(TaskContext& context) {
-  auto& token = impl_->cancel_tokens.Acquire([this] { return Token(*this); });
+  auto& shard = *impl_->shards[GetLocalShardIndex() % impl_->shard_count];
+  auto& token =
+      shard.cancel_tokens.Acquire([&shard] { return Token(shard); });
   UASSERT(token.task == nullptr);
+  UASSERT(&token.shard == &shard);
 
   boost::intrusive_ptr<TaskContext> context_copy(&context);
 
   token.task.store(context_copy.detach());
-  if (impl_->wait_tokens) {
-    token.wait_token = impl_->wait_tokens->GetToken();
+  if (shard.wait_tokens) {
+    token.wait_token = shard.wait_tokens->GetToken();
   }
 
   context.SetDetached(token);
@@ -75,40 +126,45 @@ void DetachedTasksSyncBlock::Dispose(Token& token) noexcept {
                                                     /*add_ref=*/false);
   }
   [[maybe_unused]] const auto wait_token = std::move(token.wait_token);
-  token.owner.impl_->cancel_tokens.Release(token);
+  token.shard.cancel_tokens.Release(token);
 }
 
 void DetachedTasksSyncBlock::RequestCancellation(
     TaskCancellationReason reason) noexcept {
   impl_->cancel_new_tasks.store(reason);
 
-  impl_->cancel_tokens.Walk([&](Token& token) {
-    auto* const context_ptr = token.task.exchange(nullptr);
+  for (auto& shard : impl_->Shards()) {
+    shard->cancel_tokens.Walk([&](Token& token) {
+      auto* const context_ptr = token.task.exchange(nullptr);
 
-    if (context_ptr != nullptr) {
-      boost::intrusive_ptr<TaskContext> context(context_ptr,
-                                                /*add_ref=*/false);
-      context->RequestCancel(reason);
-    }
-  });
-
-  if (impl_->wait_tokens) {
-    impl_->wait_tokens->WaitForAllTokens();
+      if (context_ptr != nullptr) {
+        boost::intrusive_ptr<TaskContext> context(context_ptr,
+                                                  /*add_ref=*/false);
+        context->RequestCancel(reason);
+      }
+    });
   }
+
+  WaitAllTasksCompleteDebug();
 }
 
 void DetachedTasksSyncBlock::WaitAllTasksCompleteDebug() noexcept {
-  if (impl_->wait_tokens) {
-    impl_->wait_tokens->WaitForAllTokens();
+  for (auto& shard : impl_->Shards()) {
+    if (shard->wait_tokens) {
+      shard->wait_tokens->WaitForAllTokens();
+    }
   }
 }
 
 std::int64_t DetachedTasksSyncBlock::ActiveTasksApprox() const noexcept {
-  UASSERT_MSG(impl_->wait_tokens,
-              "Task count is only available for StopMode::kCancelAndWait");
-  if (!impl_->wait_tokens) return 0;
-
-  return impl_->wait_tokens->AliveTokensApprox();
+  std::int64_t result = 0;
+  for (const auto& shard : impl_->Shards()) {
+    UASSERT_MSG(shard->wait_tokens,
+                "Task count is only available for StopMode::kCancelAndWait");
+    if (!shard->wait_tokens) return 0;
+    result += shard->wait_tokens->AliveTokensApprox();
+  }
+  return result;
 }
 
 }  // namespace engine::impl
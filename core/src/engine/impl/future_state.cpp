@@ -7,15 +7,24 @@
 #include <engine/task/task_context.hpp>
 #include <userver/engine/exception.hpp>
 #include <userver/engine/task/cancel.hpp>
+#include <userver/utils/assert.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
 namespace engine::impl {
 
+namespace {
+
+constexpr std::uint8_t kReadyFlag = 1;
+constexpr std::uint8_t kHasContinuationFlag = 2;
+
+}  // namespace
+
 FutureStateBase::FutureStateBase() noexcept
     : is_ready_(false),
       is_result_store_locked_(false),
-      is_future_created_(false) {}
+      is_future_created_(false),
+      continuation_flags_(0) {}
 
 FutureStateBase::~FutureStateBase() = default;
 
@@ -41,6 +50,18 @@ bool FutureStateBase::IsFutureCreated() const noexcept {
   return is_future_created_.load(std::memory_order_relaxed);
 }
 
+void FutureStateBase::SetContinuation(
+    std::unique_ptr<FutureContinuation> continuation) {
+  UASSERT(continuation);
+  UINVARIANT(!(continuation_flags_.load(std::memory_order_relaxed) &
+               kHasContinuationFlag),
+             "Only one continuation may be set for a future");
+  continuation_ = std::move(continuation);
+  const auto old_flags =
+      continuation_flags_.fetch_or(kHasContinuationFlag, std::memory_order_acq_rel);
+  if (old_flags & kReadyFlag) RunContinuation();
+}
+
 void FutureStateBase::LockResultStore() {
   if (is_result_store_locked_.exchange(true, std::memory_order_relaxed)) {
     throw std::future_error(std::future_errc::promise_already_satisfied);
@@ -50,6 +71,10 @@ void FutureStateBase::LockResultStore() {
 void FutureStateBase::ReleaseResultStore() {
   is_ready_.store(true);
   finish_waiters_->WakeupOne();
+
+  const auto old_flags =
+      continuation_flags_.fetch_or(kReadyFlag, std::memory_order_acq_rel);
+  if (old_flags & kHasContinuationFlag) RunContinuation();
 }
 
 void FutureStateBase::WaitForResult() {
@@ -75,6 +100,13 @@ void FutureStateBase::RemoveWaiter(TaskContext& context) noexcept {
 
 void FutureStateBase::AfterWait() noexcept {}
 
+void FutureStateBase::RunContinuation() noexcept {
+  // The continuation may hold the last reference to this state, it must not be
+  // touched after the continuation is destroyed.
+  const auto continuation = std::move(continuation_);
+  continuation->OnReady();
+}
+
 }  // namespace engine::impl
 
 USERVER_NAMESPACE_END
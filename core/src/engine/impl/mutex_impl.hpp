@@ -1,14 +1,18 @@
 #pragma once
 
+#include <algorithm>
 #include <atomic>
+#include <cstdint>
 
 #include <userver/engine/deadline.hpp>
 
 #include <userver/utils/assert.hpp>
 
+#include <compiler/relax_cpu.hpp>
 #include <engine/impl/wait_list.hpp>
 #include <engine/impl/wait_list_light.hpp>
 #include <engine/task/task_context.hpp>
+#include <engine/task/task_processor.hpp>
 #include <userver/compiler/impl/tsan.hpp>
 
 USERVER_NAMESPACE_BEGIN
@@ -38,9 +42,17 @@ class MutexImpl {
   class MutexWaitStrategy;
 
   bool LockFastPath(TaskContext&) noexcept;
+  bool LockSpinPath(TaskContext&) noexcept;
   bool LockSlowPath(TaskContext&, Deadline);
 
+  // Bounds of the spinning before parking, a relax is ~10-150 CPU cycles
+  static constexpr std::int32_t kMinSpins = 8;
+  static constexpr std::int32_t kMaxSpins = 128;
+
   std::atomic<TaskContext*> owner_;
+  // Running estimate of the spins it takes to acquire the contended lock,
+  // tracks the hold times. Fits into the padding before lock_waiters_.
+  std::atomic<std::int32_t> spin_estimate_{0};
   Waiters lock_waiters_;
 };
 
@@ -119,6 +131,37 @@ bool MutexImpl<Waiters>::LockFastPath(TaskContext& current) noexcept {
                                         std::memory_order_acquire);
 }
 
+// Short critical sections are released sooner than a context switch and
+// a wakeup take, so it pays off to wait for them without parking.
+template <class Waiters>
+bool MutexImpl<Waiters>::LockSpinPath(TaskContext& current) noexcept {
+  // The owner cannot be running if the only worker runs the current task.
+  // Other owners are not checked, their contexts may be gone already.
+  if (current.GetTaskProcessor().GetWorkerCount() < 2) return false;
+
+  const auto estimate = spin_estimate_.load(std::memory_order_relaxed);
+  const auto max_spins = std::min(kMaxSpins, estimate * 2 + kMinSpins);
+  compiler::RelaxCpu relax;
+  for (std::int32_t spins = 1; spins <= max_spins; ++spins) {
+    relax();
+    if (owner_.load(std::memory_order_relaxed) != nullptr) continue;
+
+    TaskContext* expected = nullptr;
+    if (owner_.compare_exchange_weak(expected, &current,
+                                     std::memory_order_acquire,
+                                     std::memory_order_relaxed)) {
+      spin_estimate_.store(estimate + (spins - estimate) / 8,
+                           std::memory_order_relaxed);
+      return true;
+    }
+  }
+
+  // The lock is held for long, spin less next time
+  spin_estimate_.store(std::max(estimate - estimate / 8 - 1, 0),
+                       std::memory_order_relaxed);
+  return false;
+}
+
 template <class Waiters>
 bool MutexImpl<Waiters>::LockSlowPath(TaskContext& current, Deadline deadline) {
   TaskContext* expected = nullptr;
@@ -193,7 +236,8 @@ bool MutexImpl<Waiters>::try_lock_until(Deadline deadline) {
 #endif
 
   auto& current = current_task::GetCurrentTaskContext();
-  const auto result = LockFastPath(current) || LockSlowPath(current, deadline);
+  const auto result = LockFastPath(current) || LockSpinPath(current) ||
+                      LockSlowPath(current, deadline);
 
 #if USERVER_IMPL_HAS_TSAN
   __tsan_mutex_post_lock(
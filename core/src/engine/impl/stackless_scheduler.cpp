@@ -0,0 +1,73 @@
+#include <engine/impl/stackless_scheduler.hpp>
+
+#include <engine/task/task_processor.hpp>
+#include <userver/engine/async.hpp>
+#include <userver/engine/sleep.hpp>
+#include <userver/utils/assert.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace engine::impl {
+
+namespace {
+
+// Lets the stackful tasks of the task processor run between the coroutines
+constexpr std::size_t kResumesBeforeYield = 64;
+
+}  // namespace
+
+StacklessScheduler::StacklessScheduler(TaskProcessor& task_processor,
+                                       std::size_t max_carriers)
+    : task_processor_(task_processor), max_carriers_(max_carriers) {
+  UASSERT(max_carriers_ > 0);
+}
+
+void StacklessScheduler::Schedule(CoResumeFunc resume, void* frame) {
+  UASSERT(resume && frame);
+  queue_.enqueue(Item{resume, frame});
+  // Pairs with the check in RunCarrier: either a leaving carrier sees the new
+  // item, or we see that the carrier has left.
+  pending_.fetch_add(1);
+  if (TryAddCarrier()) StartCarrier();
+}
+
+bool StacklessScheduler::TryAddCarrier() noexcept {
+  auto carriers = carriers_.load();
+  while (carriers < max_carriers_) {
+    if (carriers_.compare_exchange_weak(carriers, carriers + 1)) return true;
+  }
+  return false;
+}
+
+void StacklessScheduler::StartCarrier() {
+  try {
+    engine::CriticalAsyncNoSpan(task_processor_, [this] { RunCarrier(); })
+        .Detach();
+  } catch (...) {
+    carriers_.fetch_sub(1);
+    throw;
+  }
+}
+
+void StacklessScheduler::RunCarrier() noexcept {
+  std::size_t resumes = 0;
+  do {
+    Item item;
+    while (pending_.load() != 0) {
+      if (!queue_.try_dequeue(item)) continue;
+      pending_.fetch_sub(1);
+      item.resume(item.frame);
+      if (++resumes % kResumesBeforeYield == 0) engine::Yield();
+    }
+    carriers_.fetch_sub(1);
+  } while (pending_.load() != 0 && TryAddCarrier());
+}
+
+void ScheduleStackless(TaskProcessor& task_processor, CoResumeFunc resume,
+                       void* frame) {
+  task_processor.GetStacklessScheduler().Schedule(resume, frame);
+}
+
+}  // namespace engine::impl
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,48 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+
+#include <moodycamel/concurrentqueue.h>
+
+#include <userver/engine/co_task.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace engine::impl {
+
+// Resumes the stackless coroutines of a TaskProcessor. The coroutines are
+// resumed one after another by the carrier tasks, which are started on demand
+// and exit once the queue is empty.
+class StacklessScheduler final {
+ public:
+  StacklessScheduler(TaskProcessor& task_processor, std::size_t max_carriers);
+
+  StacklessScheduler(const StacklessScheduler&) = delete;
+  StacklessScheduler& operator=(const StacklessScheduler&) = delete;
+
+  void Schedule(CoResumeFunc resume, void* frame);
+
+ private:
+  struct Item final {
+    CoResumeFunc resume{nullptr};
+    void* frame{nullptr};
+  };
+
+  bool TryAddCarrier() noexcept;
+
+  void StartCarrier();
+
+  void RunCarrier() noexcept;
+
+  TaskProcessor& task_processor_;
+  const std::size_t max_carriers_;
+  moodycamel::ConcurrentQueue<Item> queue_;
+  // Scheduled, but not yet dequeued coroutines
+  std::atomic<std::size_t> pending_{0};
+  std::atomic<std::size_t> carriers_{0};
+};
+
+}  // namespace engine::impl
+
+USERVER_NAMESPACE_END
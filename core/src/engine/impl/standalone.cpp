@@ -6,6 +6,8 @@
 #include <engine/task/task_processor_config.hpp>
 #include <engine/task/task_processor_pools.hpp>
 #include <userver/engine/async.hpp>
+#include <userver/engine/task/task.hpp>
+#include <userver/utils/assert.hpp>
 
 #include <userver/tracing/span.hpp>
 
@@ -25,6 +27,12 @@ std::shared_ptr<TaskProcessorPools> MakeTaskProcessorPools(
   ev_config.thread_name = pools_config.ev_thread_name;
   ev_config.ev_default_loop_disabled = pools_config.ev_default_loop_disabled;
   ev_config.defer_events = pools_config.defer_events;
+  ev_config.io_backend = pools_config.ev_io_uring_enabled
+                             ? ev::IoBackend::kIoUring
+                             : ev::IoBackend::kLibEv;
+  ev_config.timer_backend = pools_config.ev_timer_wheel_enabled
+                                ? ev::TimerBackend::kTimerWheel
+                                : ev::TimerBackend::kLibEv;
 
   return std::make_shared<TaskProcessorPools>(std::move(coro_config),
                                               std::move(ev_config));
@@ -37,6 +45,11 @@ TaskProcessorHolder TaskProcessorHolder::Make(
   config.worker_threads = threads_num;
   config.thread_name = std::move(thread_name);
 
+  return Make(std::move(config), std::move(pools));
+}
+
+TaskProcessorHolder TaskProcessorHolder::Make(
+    TaskProcessorConfig config, std::shared_ptr<TaskProcessorPools> pools) {
   return TaskProcessorHolder(
       std::make_unique<TaskProcessor>(std::move(config), std::move(pools)));
 }
@@ -58,6 +71,20 @@ void RunOnTaskProcessorSync(TaskProcessor& tp,
   task.Get();
 }
 
+void RunStandalone(TaskProcessorConfig config,
+                   const TaskProcessorPoolsConfig& pools_config,
+                   utils::function_ref<void()> payload) {
+  UINVARIANT(!engine::current_task::IsTaskProcessorThread(),
+             "RunStandalone must not be used alongside a running engine");
+  UINVARIANT(config.worker_threads != 0,
+             "Unable to run anything using 0 threads");
+
+  auto task_processor_holder = TaskProcessorHolder::Make(
+      std::move(config), MakeTaskProcessorPools(pools_config));
+
+  RunOnTaskProcessorSync(*task_processor_holder, payload);
+}
+
 }  // namespace engine::impl
 
 USERVER_NAMESPACE_END
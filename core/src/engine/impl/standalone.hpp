@@ -20,6 +20,10 @@
 
 USERVER_NAMESPACE_BEGIN
 
+namespace engine {
+struct TaskProcessorConfig;
+}  // namespace engine
+
 namespace engine::impl {
 
 class TaskProcessorPools;
@@ -33,6 +37,9 @@ class TaskProcessorHolder final {
                                   std::string thread_name,
                                   std::shared_ptr<TaskProcessorPools> pools);
 
+  static TaskProcessorHolder Make(TaskProcessorConfig config,
+                                  std::shared_ptr<TaskProcessorPools> pools);
+
   explicit TaskProcessorHolder(std::unique_ptr<TaskProcessor>&&);
 
   TaskProcessorHolder(TaskProcessorHolder&&) noexcept = default;
@@ -49,6 +56,13 @@ class TaskProcessorHolder final {
 void RunOnTaskProcessorSync(TaskProcessor& tp,
                             utils::function_ref<void()> user_cb);
 
+/// Same as engine::RunStandalone, but allows to tune the TaskProcessor, e.g.
+/// to select the task queue type in benchmarks. `config.thread_name` should
+/// be set.
+void RunStandalone(TaskProcessorConfig config,
+                   const TaskProcessorPoolsConfig& pools_config,
+                   utils::function_ref<void()> payload);
+
 }  // namespace engine::impl
 
 USERVER_NAMESPACE_END
@@ -1,5 +1,6 @@
 #include <userver/engine/impl/task_context_factory.hpp>
 
+#include <concurrent/impl/per_cpu_block_pool.hpp>
 #include <engine/task/task_context.hpp>
 #include <userver/utils/assert.hpp>
 
@@ -12,19 +13,52 @@ std::size_t GetTaskContextSize() noexcept { return sizeof(TaskContext); }
 static_assert(kTaskContextAlignment >= alignof(TaskContext));
 static_assert(sizeof(TaskContext) % kTaskContextAlignment == 0);
 
-TaskContext& PlacementNewTaskContext(std::byte* storage, TaskConfig config,
+namespace {
+
+// Fused allocations with payloads up to this size are reused through
+// per-CPU free lists, larger ones go straight to the allocator.
+constexpr std::size_t kPooledPayloadSize = 256;
+constexpr std::size_t kMaxPooledPerCpu = 64;
+
+static_assert(kPooledPayloadSize % kTaskContextAlignment == 0);
+
+concurrent::impl::PerCpuBlockPool& GetTaskContextPool() {
+  // Intentionally leaked: tasks may be destroyed during static destruction
+  static auto& pool = *new concurrent::impl::PerCpuBlockPool(
+      sizeof(TaskContext) + kPooledPayloadSize, kTaskContextAlignment,
+      kMaxPooledPerCpu);
+  return pool;
+}
+
+bool IsPooled(std::size_t total_size) noexcept {
+  return total_size <= sizeof(TaskContext) + kPooledPayloadSize;
+}
+
+}  // namespace
+
+TaskContext& PlacementNewTaskContext(std::byte* storage,
+                                     std::size_t total_size, TaskConfig config,
                                      utils::impl::WrappedCallBase& payload) {
-  return *new (storage) TaskContext{config.task_processor, config.importance,
-                                    config.wait_mode, config.deadline, payload};
+  return *new (storage) TaskContext{
+      config.task_processor, config.importance, config.priority,
+      config.wait_mode, config.deadline, payload, total_size};
 }
 
 std::byte* AllocateFusedTaskContext(std::size_t total_size) {
+  if (IsPooled(total_size)) {
+    return static_cast<std::byte*>(GetTaskContextPool().Allocate());
+  }
   return static_cast<std::byte*>(
       ::operator new[](total_size, std::align_val_t{kTaskContextAlignment}));
 }
 
-void DeleteFusedTaskContext(std::byte* storage) noexcept {
+void DeleteFusedTaskContext(std::byte* storage,
+                            std::size_t total_size) noexcept {
   UASSERT(storage);
+  if (IsPooled(total_size)) {
+    GetTaskContextPool().Deallocate(storage);
+    return;
+  }
   ::operator delete[](storage, std::align_val_t{kTaskContextAlignment});
 }
 
@@ -37,16 +37,20 @@ std::string BufferedReader::ReadSome(size_t max_bytes, Deadline deadline) {
 }
 
 std::string BufferedReader::ReadAll(size_t num_bytes, Deadline deadline) {
+  const auto buffered = PeekAll(num_bytes, deadline);
+  std::string result(buffered.substr(0, num_bytes));
+  buffer_->ReportRead(result.size());
+  return result;
+}
+
+std::string_view BufferedReader::PeekAll(size_t num_bytes, Deadline deadline) {
   if (buffer_->AvailableReadBytes() < num_bytes) {
     buffer_->Reserve(num_bytes - buffer_->AvailableReadBytes());
     while (buffer_->AvailableReadBytes() < num_bytes) {
       if (!FillBuffer(deadline)) break;
     }
   }
-  std::string result(buffer_->ReadPtr(),
-                     std::min(num_bytes, buffer_->AvailableReadBytes()));
-  buffer_->ReportRead(result.size());
-  return result;
+  return {buffer_->ReadPtr(), buffer_->AvailableReadBytes()};
 }
 
 std::string BufferedReader::ReadLine(Deadline deadline) {
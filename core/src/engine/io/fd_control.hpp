@@ -88,6 +88,15 @@ class Direction final {
                     TransferMode mode, Deadline deadline,
                     const Context&... context);
 
+  // (IoFunc*)(int fd, std::size_t first, std::size_t count), e.g. a sendmmsg
+  // wrapper, that returns the number of processed items. The items are
+  // e.g. datagrams or bytes of a file, including the ones reported via
+  // IoInterrupted::BytesTransferred().
+  template <typename IoFunc, typename... Context>
+  std::size_t PerformIoBatch(SingleUserGuard& guard, IoFunc&& io_func,
+                             std::size_t count, TransferMode mode,
+                             Deadline deadline, const Context&... context);
+
   engine::impl::ContextAccessor* TryGetContextAccessor() noexcept;
 
  private:
@@ -253,6 +262,29 @@ size_t Direction::PerformIo(SingleUserGuard&, IoFunc&& io_func, void* buf,
   return pos - begin;
 }
 
+template <typename IoFunc, typename... Context>
+std::size_t Direction::PerformIoBatch(SingleUserGuard&, IoFunc&& io_func,
+                                      std::size_t count, TransferMode mode,
+                                      Deadline deadline,
+                                      const Context&... context) {
+  std::size_t processed = 0;
+  while (processed < count) {
+    const auto chunk_count = io_func(Fd(), processed, count - processed);
+
+    if (chunk_count > 0) {
+      processed += chunk_count;
+      if (mode == TransferMode::kOnce) {
+        break;
+      }
+    } else if (!chunk_count ||
+               TryHandleError(errno, processed, mode, deadline, context...) ==
+                   ErrorMode::kFatal) {
+      break;
+    }
+  }
+  return processed;
+}
+
 }  // namespace engine::io::impl
 
 USERVER_NAMESPACE_END
@@ -1,6 +1,9 @@
 #include <userver/engine/io/fd_poller.hpp>
 
+#include <memory>
+
 #include <engine/ev/watcher.hpp>
+#include <engine/ev/watcher/io_uring_watcher.hpp>
 #include <engine/impl/future_utils.hpp>
 #include <engine/impl/wait_list_light.hpp>
 #include <engine/task/task_context.hpp>
@@ -81,7 +84,14 @@ struct FdPoller::Impl final : public engine::impl::ContextAccessor {
 
   void StopWatcher();
 
+  // Dispatch between the libev and io_uring watchers
+  void StartWatcherAsync();
+  void StopWatcherAsync();
+  void StopWatcherSync();
+
   static void IoWatcherCb(struct ev_loop*, ev_io*, int) noexcept;
+  static void IoUringWatcherCb(void* data, int ev_events) noexcept;
+  void OnEvents(int ev_events) noexcept;
   void WakeupWaiters();
 
   void ResetReady() noexcept { waiters_->GetAndResetSignal(); }
@@ -94,17 +104,17 @@ struct FdPoller::Impl final : public engine::impl::ContextAccessor {
     if (waiters_->GetSignalOrAppend(&waiter)) {
       return engine::impl::EarlyWakeup{true};
     }
-    watcher_.StartAsync();
+    StartWatcherAsync();
     return engine::impl::EarlyWakeup{false};
   }
 
   void RemoveWaiter(engine::impl::TaskContext& waiter) noexcept override {
     waiters_->Remove(waiter);
     // we need to stop watcher manually to avoid racy wakeups later
-    watcher_.StopAsync();
+    StopWatcherAsync();
   }
 
-  void AfterWait() noexcept override { watcher_.Stop(); }
+  void AfterWait() noexcept override { StopWatcherSync(); }
 
   void RethrowErrorResult() const override {}
 
@@ -112,6 +122,8 @@ struct FdPoller::Impl final : public engine::impl::ContextAccessor {
   std::atomic<FdPoller::State> state_{FdPoller::State::kInvalid};
   engine::impl::FastPimplWaitListLight waiters_;
   ev::Watcher<ev_io> watcher_;
+  // Replaces watcher_ if the ev thread uses io_uring
+  std::unique_ptr<ev::IoUringWatcher> io_uring_watcher_;
   std::atomic<FdPoller::Kind> events_that_happened_{};
 };
 
@@ -119,6 +131,11 @@ void FdPoller::Impl::WakeupWaiters() { waiters_->SetSignalAndWakeupOne(); }
 
 FdPoller::Impl::Impl() : watcher_(current_task::GetEventThread(), this) {
   watcher_.Init(&IoWatcherCb);
+  auto& ev_thread = current_task::GetEventThread();
+  if (ev_thread.GetIoUring()) {
+    io_uring_watcher_ = std::make_unique<ev::IoUringWatcher>(
+        ev_thread, this, &IoUringWatcherCb);
+  }
 }
 
 FdPoller::Impl::~Impl() = default;
@@ -136,7 +153,7 @@ engine::impl::TaskContext::WakeupSource FdPoller::Impl::DoWait(
    * Manually call Stop() here to be sure that after DoWait() no waiter_'s
    * callback (IoWatcherCb) is running.
    */
-  watcher_.Stop();
+  StopWatcherSync();
   return ret;
 }
 
@@ -155,7 +172,31 @@ void FdPoller::Impl::Invalidate() {
 
 void FdPoller::Impl::StopWatcher() {
   UASSERT(IsValid());
-  watcher_.Stop();
+  StopWatcherSync();
+}
+
+void FdPoller::Impl::StartWatcherAsync() {
+  if (io_uring_watcher_) {
+    io_uring_watcher_->StartAsync();
+  } else {
+    watcher_.StartAsync();
+  }
+}
+
+void FdPoller::Impl::StopWatcherAsync() {
+  if (io_uring_watcher_) {
+    io_uring_watcher_->StopAsync();
+  } else {
+    watcher_.StopAsync();
+  }
+}
+
+void FdPoller::Impl::StopWatcherSync() {
+  if (io_uring_watcher_) {
+    io_uring_watcher_->Stop();
+  } else {
+    watcher_.Stop();
+  }
 }
 
 void FdPoller::Impl::IoWatcherCb(struct ev_loop*, ev_io* watcher,
@@ -172,10 +213,18 @@ void FdPoller::Impl::IoWatcherCb(struct ev_loop*, ev_io* watcher,
    * before watcher_ is stopped.
    */
   self->watcher_.Stop();
+  self->OnEvents(ev_events);
+}
+
+void FdPoller::Impl::IoUringWatcherCb(void* data, int ev_events) noexcept {
+  // io_uring watcher is already stopped at this point
+  static_cast<FdPoller::Impl*>(data)->OnEvents(ev_events);
+}
 
-  self->events_that_happened_.store(GetUserMode(ev_events),
-                                    std::memory_order_relaxed);
-  self->WakeupWaiters();
+void FdPoller::Impl::OnEvents(int ev_events) noexcept {
+  events_that_happened_.store(GetUserMode(ev_events),
+                              std::memory_order_relaxed);
+  WakeupWaiters();
 }
 
 bool FdPoller::Impl::IsValid() const noexcept {
@@ -248,6 +297,7 @@ void FdPoller::Impl::Reset(int fd, Kind kind) {
   UASSERT(fd_ == fd || fd_ == -1);
   fd_ = fd;
   watcher_.Set(fd_, GetEvMode(kind));
+  if (io_uring_watcher_) io_uring_watcher_->Set(fd_, GetEvMode(kind));
   state_ = State::kReadyToUse;
 }
 
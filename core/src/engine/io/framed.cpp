@@ -0,0 +1,121 @@
+#include <userver/engine/io/framed.hpp>
+
+#include <array>
+#include <cstdint>
+#include <limits>
+#include <utility>
+
+#include <fmt/format.h>
+
+#include <userver/engine/io/exception.hpp>
+#include <userver/utils/assert.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace engine::io {
+namespace {
+
+// Frames up to this size are copied into the coalescing buffer
+constexpr std::size_t kMaxCopiedPayloadSize = 4096;
+
+using FrameHeader = std::array<char, kFrameHeaderSize>;
+
+FrameHeader MakeHeader(std::size_t payload_size) {
+  if (payload_size > std::numeric_limits<std::uint32_t>::max()) {
+    throw IoException(
+        fmt::format("Frame of {} bytes is too large", payload_size));
+  }
+  FrameHeader header;
+  for (std::size_t i = 0; i < kFrameHeaderSize; ++i) {
+    const auto shift = 8 * (kFrameHeaderSize - 1 - i);
+    header[i] = static_cast<char>(payload_size >> shift);
+  }
+  return header;
+}
+
+std::size_t ParseHeader(std::string_view data) {
+  UASSERT(data.size() >= kFrameHeaderSize);
+  std::size_t payload_size = 0;
+  for (std::size_t i = 0; i < kFrameHeaderSize; ++i) {
+    payload_size = (payload_size << 8) | static_cast<unsigned char>(data[i]);
+  }
+  return payload_size;
+}
+
+void CheckWritten(std::size_t written, std::size_t expected) {
+  if (written != expected) {
+    throw IoException(fmt::format(
+        "Stream closed by peer after {} of {} bytes of frames were sent",
+        written, expected));
+  }
+}
+
+}  // namespace
+
+FramedReader::FramedReader(ReadableBasePtr source, std::size_t max_frame_size)
+    : reader_(std::move(source)), max_frame_size_(max_frame_size) {}
+
+bool FramedReader::IsValid() const { return reader_.IsValid(); }
+
+std::optional<std::string_view> FramedReader::ReadFrame(Deadline deadline) {
+  // The previous frame is consumed lazily to keep its view valid
+  reader_.Discard(std::exchange(consumed_bytes_, 0));
+
+  const auto header = reader_.PeekAll(kFrameHeaderSize, deadline);
+  if (header.empty()) return std::nullopt;
+  if (header.size() < kFrameHeaderSize) {
+    throw IoException("Stream closed in the middle of a frame header");
+  }
+
+  const auto payload_size = ParseHeader(header);
+  if (payload_size > max_frame_size_) {
+    throw IoException(fmt::format("Frame of {} bytes exceeds the limit of {}",
+                                  payload_size, max_frame_size_));
+  }
+
+  const auto frame_size = kFrameHeaderSize + payload_size;
+  const auto frame = reader_.PeekAll(frame_size, deadline);
+  if (frame.size() < frame_size) {
+    throw IoException(fmt::format(
+        "Stream closed after {} of {} bytes of a frame payload",
+        frame.size() - kFrameHeaderSize, payload_size));
+  }
+
+  consumed_bytes_ = frame_size;
+  return frame.substr(kFrameHeaderSize, payload_size);
+}
+
+FramedWriter::FramedWriter(WritableBase& sink) : sink_(sink) {}
+
+void FramedWriter::Append(std::string_view payload) {
+  const auto header = MakeHeader(payload.size());
+  buffer_.append(header.data(), header.size());
+  buffer_.append(payload);
+}
+
+void FramedWriter::Flush(Deadline deadline) {
+  if (buffer_.empty()) return;
+  CheckWritten(sink_.WriteAll(buffer_.data(), buffer_.size(), deadline),
+               buffer_.size());
+  buffer_.clear();
+}
+
+void FramedWriter::WriteFrame(std::string_view payload, Deadline deadline) {
+  if (payload.size() <= kMaxCopiedPayloadSize) {
+    Append(payload);
+    Flush(deadline);
+    return;
+  }
+
+  const auto header = MakeHeader(payload.size());
+  const IoData list[] = {{buffer_.data(), buffer_.size()},
+                         {header.data(), header.size()},
+                         {payload.data(), payload.size()}};
+  const auto total_size = buffer_.size() + header.size() + payload.size();
+  CheckWritten(sink_.WriteAll(list, std::size(list), deadline), total_size);
+  buffer_.clear();
+}
+
+}  // namespace engine::io
+
+USERVER_NAMESPACE_END
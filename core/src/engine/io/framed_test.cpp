@@ -0,0 +1,128 @@
+#include <gtest/gtest.h>
+
+#include <cstdlib>
+#include <deque>
+#include <string>
+
+#include <userver/engine/io/common.hpp>
+#include <userver/engine/io/framed.hpp>
+#include <userver/utest/assert_macros.hpp>
+#include <userver/utils/rand.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+using FramedReader = engine::io::FramedReader;
+using FramedWriter = engine::io::FramedWriter;
+
+constexpr std::size_t kMaxFrameSize = 1 << 20;
+
+class ReadableMock : public engine::io::ReadableBase {
+ public:
+  bool IsValid() const override { return true; }
+
+  bool WaitReadable(engine::Deadline) override { std::abort(); }
+
+  size_t ReadSome(void* buf, size_t len, engine::Deadline) override {
+    if (!len || buffer_.empty()) return 0;
+
+    auto chars_to_copy = utils::RandRange(std::min(len, buffer_.size())) + 1;
+    std::copy(buffer_.begin(), buffer_.begin() + chars_to_copy,
+              reinterpret_cast<char*>(buf));
+    buffer_.erase(buffer_.begin(), buffer_.begin() + chars_to_copy);
+    return chars_to_copy;
+  }
+
+  size_t ReadAll(void*, size_t, engine::Deadline) override { std::abort(); }
+
+  void Feed(const std::string& str) {
+    buffer_.insert(buffer_.end(), str.begin(), str.end());
+  }
+
+ private:
+  std::deque<char> buffer_;
+};
+
+class WritableMock : public engine::io::WritableBase {
+ public:
+  bool WaitWriteable(engine::Deadline) override { std::abort(); }
+
+  size_t WriteAll(const void* buf, size_t len, engine::Deadline) override {
+    ++writes_count;
+    data.append(static_cast<const char*>(buf), len);
+    return len;
+  }
+
+  size_t WriteAll(const engine::io::IoData* list, size_t list_size,
+                  engine::Deadline) override {
+    ++writes_count;
+    size_t result = 0;
+    for (size_t i = 0; i < list_size; ++i) {
+      data.append(static_cast<const char*>(list[i].data), list[i].len);
+      result += list[i].len;
+    }
+    return result;
+  }
+
+  std::string data;
+  std::size_t writes_count{0};
+};
+
+}  // namespace
+
+TEST(Framed, RoundTrip) {
+  const std::string large(100'000, 'x');
+
+  WritableMock sink;
+  FramedWriter writer(sink);
+  writer.Append("first");
+  writer.Append("");
+  writer.Append("third");
+  EXPECT_EQ(writer.GetBufferedSize(), 3 * engine::io::kFrameHeaderSize + 10);
+  EXPECT_EQ(sink.writes_count, 0);
+  writer.WriteFrame(large);
+  EXPECT_EQ(sink.writes_count, 1);
+  EXPECT_EQ(writer.GetBufferedSize(), 0);
+  writer.WriteFrame("last");
+  EXPECT_EQ(sink.writes_count, 2);
+
+  auto source = std::make_shared<ReadableMock>();
+  source->Feed(sink.data);
+  FramedReader reader(source, kMaxFrameSize);
+  EXPECT_EQ(reader.ReadFrame(), "first");
+  EXPECT_EQ(reader.ReadFrame(), "");
+  EXPECT_EQ(reader.ReadFrame(), "third");
+  EXPECT_EQ(reader.ReadFrame(), large);
+  EXPECT_EQ(reader.ReadFrame(), "last");
+  EXPECT_EQ(reader.ReadFrame(), std::nullopt);
+}
+
+TEST(Framed, HeaderIsBigEndian) {
+  auto source = std::make_shared<ReadableMock>();
+  source->Feed(std::string("\0\0\0\3abc", 7));
+  FramedReader reader(source, kMaxFrameSize);
+  EXPECT_EQ(reader.ReadFrame(), "abc");
+  EXPECT_EQ(reader.ReadFrame(), std::nullopt);
+}
+
+TEST(Framed, TooLarge) {
+  auto source = std::make_shared<ReadableMock>();
+  source->Feed(std::string("\0\0\1\0", 4));
+  FramedReader reader(source, 255);
+  UEXPECT_THROW(reader.ReadFrame(), engine::io::IoException);
+}
+
+TEST(Framed, Truncated) {
+  auto source = std::make_shared<ReadableMock>();
+  source->Feed(std::string("\0\0\0\5ab", 6));
+  FramedReader reader(source, kMaxFrameSize);
+  UEXPECT_THROW(reader.ReadFrame(), engine::io::IoException);
+
+  auto header_source = std::make_shared<ReadableMock>();
+  header_source->Feed(std::string("\0\0", 2));
+  FramedReader header_reader(header_source, kMaxFrameSize);
+  UEXPECT_THROW(header_reader.ReadFrame(), engine::io::IoException);
+}
+
+USERVER_NAMESPACE_END
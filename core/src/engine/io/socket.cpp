@@ -3,13 +3,25 @@
 #include <fcntl.h>
 #include <sys/socket.h>
 #include <sys/uio.h>
+#include <time.h>
 #include <unistd.h>
 
+#ifdef __linux__
+#include <linux/errqueue.h>
+#include <netinet/in.h>
+#include <netinet/udp.h>
+#include <sys/sendfile.h>
+#endif
+
+#include <algorithm>
+#include <array>
 #include <cerrno>
+#include <cstring>
 #include <string>
 #include <vector>
 
 #include <userver/engine/io/exception.hpp>
+#include <userver/engine/sleep.hpp>
 #include <userver/engine/task/cancel.hpp>
 #include <userver/logging/log.hpp>
 #include <userver/utils/assert.hpp>
@@ -106,6 +118,292 @@ class SendToWrapper {
   const Sockaddr& dest_addr_;
 };
 
+#ifdef __linux__
+using MultiMsgHdr = struct ::mmsghdr;
+#else
+struct MultiMsgHdr {
+  struct ::msghdr msg_hdr;
+  unsigned int msg_len;
+};
+#endif
+
+constexpr int kSendMsgFlags =
+// MAC_COMPAT: does not support MSG_NOSIGNAL
+#ifdef MSG_NOSIGNAL
+    MSG_NOSIGNAL |
+#endif
+    0;
+
+[[nodiscard]] int SendMultiMsg(int fd, MultiMsgHdr* msgs, unsigned int count) {
+#ifdef __linux__
+  return ::sendmmsg(fd, msgs, count, kSendMsgFlags);
+#else
+  // MAC_COMPAT: no sendmmsg
+  for (unsigned int i = 0; i < count; ++i) {
+    const auto ret = ::sendmsg(fd, &msgs[i].msg_hdr, kSendMsgFlags);
+    if (ret == -1) return i ? static_cast<int>(i) : -1;
+    msgs[i].msg_len = ret;
+  }
+  return static_cast<int>(count);
+#endif
+}
+
+[[nodiscard]] int RecvMultiMsg(int fd, MultiMsgHdr* msgs, unsigned int count) {
+#ifdef __linux__
+  return ::recvmmsg(fd, msgs, count, 0, nullptr);
+#else
+  // MAC_COMPAT: no recvmmsg
+  for (unsigned int i = 0; i < count; ++i) {
+    const auto ret = ::recvmsg(fd, &msgs[i].msg_hdr, 0);
+    if (ret == -1) return i ? static_cast<int>(i) : -1;
+    msgs[i].msg_len = ret;
+  }
+  return static_cast<int>(count);
+#endif
+}
+
+// Enough for a single UDP_SEGMENT or UDP_GRO control message
+union DatagramControl {
+  char buf[CMSG_SPACE(sizeof(int))];
+  struct ::cmsghdr align;
+};
+
+class SendManyWrapper {
+ public:
+  explicit SendManyWrapper(const OutgoingDatagram* datagrams)
+      : datagrams_(datagrams) {}
+
+  [[nodiscard]] ssize_t operator()(int fd, std::size_t first,
+                                   std::size_t count) {
+    count = std::min(count, kMaxStackSizeVector);
+    for (std::size_t i = 0; i < count; ++i) {
+      Fill(datagrams_[first + i], i);
+    }
+    return SendMultiMsg(fd, headers_.data(), count);
+  }
+
+ private:
+  void Fill(const OutgoingDatagram& datagram, std::size_t index) {
+    auto& iov = iovecs_[index];
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-type-const-cast)
+    iov.iov_base = const_cast<void*>(datagram.data);
+    iov.iov_len = datagram.len;
+
+    auto& header = headers_[index].msg_hdr;
+    header = {};
+    header.msg_iov = &iov;
+    header.msg_iovlen = 1;
+    if (datagram.dest_addr) {
+      const auto& dest_addr = *datagram.dest_addr;
+      // NOLINTNEXTLINE(cppcoreguidelines-pro-type-const-cast)
+      header.msg_name = const_cast<struct sockaddr*>(dest_addr.Data());
+      header.msg_namelen = dest_addr.Size();
+    }
+
+#ifdef UDP_SEGMENT
+    if (datagram.segment_size) {
+      auto& control = controls_[index];
+      header.msg_control = control.buf;
+      header.msg_controllen = CMSG_SPACE(sizeof(std::uint16_t));
+      auto* cmsg = CMSG_FIRSTHDR(&header);
+      cmsg->cmsg_level = SOL_UDP;
+      cmsg->cmsg_type = UDP_SEGMENT;
+      cmsg->cmsg_len = CMSG_LEN(sizeof(std::uint16_t));
+      std::memcpy(CMSG_DATA(cmsg), &datagram.segment_size,
+                  sizeof(datagram.segment_size));
+    }
+#endif
+  }
+
+  const OutgoingDatagram* const datagrams_;
+  std::array<MultiMsgHdr, kMaxStackSizeVector> headers_{};
+  std::array<struct ::iovec, kMaxStackSizeVector> iovecs_{};
+  std::array<DatagramControl, kMaxStackSizeVector> controls_{};
+};
+
+class RecvManyWrapper {
+ public:
+  explicit RecvManyWrapper(IncomingDatagram* datagrams)
+      : datagrams_(datagrams) {}
+
+  [[nodiscard]] ssize_t operator()(int fd, std::size_t first,
+                                   std::size_t count) {
+    count = std::min(count, kMaxStackSizeVector);
+    for (std::size_t i = 0; i < count; ++i) {
+      Fill(datagrams_[first + i], i);
+    }
+
+    const auto ret = RecvMultiMsg(fd, headers_.data(), count);
+    for (int i = 0; i < ret; ++i) {
+      Parse(datagrams_[first + i], i);
+    }
+    return ret;
+  }
+
+ private:
+  void Fill(IncomingDatagram& datagram, std::size_t index) {
+    auto& iov = iovecs_[index];
+    iov.iov_base = datagram.buf;
+    iov.iov_len = datagram.len;
+
+    auto& header = headers_[index].msg_hdr;
+    header = {};
+    header.msg_iov = &iov;
+    header.msg_iovlen = 1;
+    header.msg_name = datagram.src_addr.Data();
+    header.msg_namelen = datagram.src_addr.Capacity();
+    header.msg_control = controls_[index].buf;
+    header.msg_controllen = sizeof(controls_[index].buf);
+  }
+
+  void Parse(IncomingDatagram& datagram, std::size_t index) {
+    const auto& header = headers_[index].msg_hdr;
+    if (header.msg_namelen > datagram.src_addr.Capacity()) {
+      throw IoException()
+          << "Peer address does not fit into AddrStorage, family="
+          << datagram.src_addr.Data()->sa_family
+          << ", addrlen=" << header.msg_namelen;
+    }
+    datagram.bytes_received = headers_[index].msg_len;
+    datagram.is_truncated = (header.msg_flags & MSG_TRUNC) != 0;
+    datagram.segment_size = 0;
+
+#ifdef UDP_GRO
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-type-const-cast)
+    auto* mutable_header = const_cast<struct ::msghdr*>(&header);
+    for (auto* cmsg = CMSG_FIRSTHDR(mutable_header); cmsg;
+         cmsg = CMSG_NXTHDR(mutable_header, cmsg)) {
+      if (cmsg->cmsg_level == SOL_UDP && cmsg->cmsg_type == UDP_GRO) {
+        int segment_size = 0;
+        std::memcpy(&segment_size, CMSG_DATA(cmsg), sizeof(segment_size));
+        datagram.segment_size = static_cast<std::uint16_t>(segment_size);
+      }
+    }
+#endif
+  }
+
+  IncomingDatagram* const datagrams_;
+  std::array<MultiMsgHdr, kMaxStackSizeVector> headers_{};
+  std::array<struct ::iovec, kMaxStackSizeVector> iovecs_{};
+  std::array<DatagramControl, kMaxStackSizeVector> controls_{};
+};
+
+class SendFileWrapper {
+ public:
+  SendFileWrapper(int file_fd, std::size_t offset)
+      : file_fd_(file_fd), offset_(offset) {}
+
+  [[nodiscard]] ssize_t operator()(int fd, std::size_t first,
+                                   std::size_t count) const {
+#ifdef __linux__
+    auto offset = static_cast<off_t>(offset_ + first);
+    return ::sendfile(fd, file_fd_, &offset, count);
+#else
+    // MAC_COMPAT: sendfile has a different signature and semantics, reading
+    // through the userspace. The bytes that were read but not sent are
+    // re-read on the next call.
+    std::array<char, 16 * 1024> buf;
+    const auto bytes_read = ::pread(file_fd_, buf.data(),
+                                    std::min(count, buf.size()),
+                                    static_cast<off_t>(offset_ + first));
+    if (bytes_read <= 0) return bytes_read;
+    return ::send(fd, buf.data(), bytes_read, kSendMsgFlags);
+#endif
+  }
+
+ private:
+  const int file_fd_;
+  const std::size_t offset_;
+};
+
+#ifdef SO_ZEROCOPY
+
+constexpr std::chrono::microseconds kMinZeroCopyPollInterval{20};
+constexpr std::chrono::microseconds kMaxZeroCopyPollInterval{1000};
+
+std::size_t GetTotalSize(const struct iovec* list, std::size_t list_size) {
+  std::size_t total_size = 0;
+  for (std::size_t i = 0; i < list_size; ++i) total_size += list[i].iov_len;
+  return total_size;
+}
+
+class ZeroCopySendWrapper {
+ public:
+  explicit ZeroCopySendWrapper(std::uint32_t& next_id) : next_id_(next_id) {}
+
+  [[nodiscard]] ssize_t operator()(int fd, struct iovec* list,
+                                   std::size_t list_size) const {
+    struct ::msghdr header {};
+    header.msg_iov = list;
+    header.msg_iovlen = list_size;
+
+    auto ret = ::sendmsg(fd, &header, kSendMsgFlags | MSG_ZEROCOPY);
+    if (ret > 0) {
+      // The kernel numbers the successful zero-copy sends sequentially
+      ++next_id_;
+    } else if (ret == -1 && errno == ENOBUFS) {
+      // Out of the per-socket memory for the pinned pages, copying instead
+      ret = ::sendmsg(fd, &header, kSendMsgFlags);
+    }
+    return ret;
+  }
+
+ private:
+  std::uint32_t& next_id_;
+};
+
+// Returns whether the kernel has copied the data of any of the sends
+bool WaitZeroCopyCompletions(int fd, std::uint32_t pending) {
+  bool is_copied = false;
+  auto poll_interval = kMinZeroCopyPollInterval;
+
+  while (pending > 0) {
+    union {
+      char buf[CMSG_SPACE(sizeof(struct ::sock_extended_err) +
+                          sizeof(struct ::sockaddr_in6))];
+      struct ::cmsghdr align;
+    } control;
+    struct ::msghdr header {};
+    header.msg_control = control.buf;
+    header.msg_controllen = sizeof(control.buf);
+
+    if (::recvmsg(fd, &header, MSG_ERRQUEUE) == -1) {
+      if (errno == EINTR) continue;
+      if (errno != EAGAIN && errno != EWOULDBLOCK) {
+        LOG_WARNING() << "Failed to read zero-copy completions, fd=" << fd
+                      << ", errno=" << errno;
+        break;
+      }
+      // The completions arrive once the peer acknowledges the data, there is
+      // no readiness notification to wait for without disturbing the reader
+      engine::SleepFor(poll_interval);
+      poll_interval = std::min(poll_interval * 2, kMaxZeroCopyPollInterval);
+      continue;
+    }
+
+    for (auto* cmsg = CMSG_FIRSTHDR(&header); cmsg;
+         cmsg = CMSG_NXTHDR(&header, cmsg)) {
+      const bool is_recverr =
+          (cmsg->cmsg_level == SOL_IP && cmsg->cmsg_type == IP_RECVERR) ||
+          (cmsg->cmsg_level == SOL_IPV6 && cmsg->cmsg_type == IPV6_RECVERR);
+      if (!is_recverr) continue;
+
+      struct ::sock_extended_err error {};
+      std::memcpy(&error, CMSG_DATA(cmsg), sizeof(error));
+      if (error.ee_origin != SO_EE_ORIGIN_ZEROCOPY || error.ee_errno != 0) {
+        continue;
+      }
+      // The range of the completed sends is inclusive
+      const std::uint32_t completed = error.ee_data - error.ee_info + 1;
+      pending -= std::min(pending, completed);
+      if (error.ee_code & SO_EE_CODE_ZEROCOPY_COPIED) is_copied = true;
+    }
+  }
+  return is_copied;
+}
+
+#endif
+
 void FillIoSendData(const IoData* data, struct iovec* dst, std::size_t count) {
   UASSERT(data);
   UASSERT(count > 0);
@@ -269,6 +567,14 @@ size_t Socket::SendAll(const struct iovec* list, std::size_t list_size,
   UASSERT(list);
   UASSERT(list_size > 0);
   UINVARIANT(list_size <= IOV_MAX, "To big array of IoData for SendAll");
+#ifdef SO_ZEROCOPY
+  if (zero_copy_send_threshold_ &&
+      GetTotalSize(list, list_size) >= zero_copy_send_threshold_) {
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-type-const-cast)
+    return SendAllZeroCopy(const_cast<struct iovec*>(list), list_size,
+                           deadline);
+  }
+#endif
   auto& dir = fd_control_->Write();
   dir.ResetReady();
   impl::Direction::SingleUserGuard guard(dir);
@@ -282,6 +588,13 @@ size_t Socket::SendAll(const void* buf, size_t len, Deadline deadline) {
   if (!IsValid()) {
     throw IoException("Attempt to SendAll to closed socket");
   }
+#ifdef SO_ZEROCOPY
+  if (zero_copy_send_threshold_ && len >= zero_copy_send_threshold_) {
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-type-const-cast)
+    struct ::iovec iov{const_cast<void*>(buf), len};
+    return SendAllZeroCopy(&iov, 1, deadline);
+  }
+#endif
   auto& dir = fd_control_->Write();
   dir.ResetReady();
   impl::Direction::SingleUserGuard guard(dir);
@@ -330,6 +643,123 @@ size_t Socket::SendAllTo(const Sockaddr& dest_addr, const void* buf, size_t len,
                        "SendAllTo to ", dest_addr);
 }
 
+size_t Socket::SendFile(int file_fd, size_t offset, size_t len,
+                        Deadline deadline) {
+  if (!IsValid()) {
+    throw IoException("Attempt to SendFile to closed socket");
+  }
+  auto& dir = fd_control_->Write();
+  dir.ResetReady();
+  impl::Direction::SingleUserGuard guard(dir);
+  return dir.PerformIoBatch(guard, SendFileWrapper{file_fd, offset}, len,
+                            impl::TransferMode::kWhole, deadline,
+                            "SendFile to ", peername_);
+}
+
+void Socket::SetZeroCopySendThreshold(size_t threshold) {
+  UASSERT(IsValid());
+#ifdef SO_ZEROCOPY
+  if (threshold && !zero_copy_send_threshold_) {
+    const int enable = 1;
+    if (::setsockopt(Fd(), SOL_SOCKET, SO_ZEROCOPY, &enable, sizeof(enable)) ==
+        -1) {
+      LOG_DEBUG() << "Zero-copy send is not supported, fd=" << Fd()
+                  << ", errno=" << errno;
+      return;
+    }
+  }
+  zero_copy_send_threshold_ = threshold;
+#else
+  // MAC_COMPAT: no MSG_ZEROCOPY, SendAll keeps copying
+  static_cast<void>(threshold);
+#endif
+}
+
+size_t Socket::SendAllZeroCopy(struct iovec* list, std::size_t list_size,
+                               Deadline deadline) {
+#ifdef SO_ZEROCOPY
+  auto& dir = fd_control_->Write();
+  dir.ResetReady();
+  impl::Direction::SingleUserGuard guard(dir);
+
+  const auto first_id = zero_copy_next_id_;
+  const auto wait_completions = [&] {
+    // The buffers must stay intact until the kernel releases them, even if
+    // the send has failed midway
+    if (WaitZeroCopyCompletions(Fd(), zero_copy_next_id_ - first_id)) {
+      LOG_DEBUG() << "The kernel copies the zero-copy sends, disabling "
+                     "zero-copy for fd="
+                  << Fd();
+      zero_copy_send_threshold_ = 0;
+    }
+  };
+
+  size_t sent_bytes = 0;
+  try {
+    sent_bytes = dir.PerformIoV(guard, ZeroCopySendWrapper{zero_copy_next_id_},
+                                list, list_size, impl::TransferMode::kWhole,
+                                deadline, "SendAll (zero-copy) to ", peername_);
+  } catch (...) {
+    wait_completions();
+    throw;
+  }
+  wait_completions();
+  return sent_bytes;
+#else
+  UINVARIANT(false, "Zero-copy send is not supported");
+  static_cast<void>(list);
+  static_cast<void>(list_size);
+  static_cast<void>(deadline);
+  return 0;
+#endif
+}
+
+std::size_t Socket::SendMany(const OutgoingDatagram* datagrams,
+                             std::size_t count, Deadline deadline) {
+  if (!IsValid()) {
+    throw IoException("Attempt to SendMany to closed socket");
+  }
+  if (count == 0) return 0;
+  UASSERT(datagrams);
+
+  for (std::size_t i = 0; i < count; ++i) {
+    const auto* dest_addr = datagrams[i].dest_addr;
+    if (dest_addr && dest_addr->Domain() != domain_) {
+      throw AddrException(fmt::format(
+          "Socket address domain ({}) does not match address domain ({})",
+          static_cast<int>(domain_), static_cast<int>(dest_addr->Domain())));
+    }
+#ifndef UDP_SEGMENT
+    if (datagrams[i].segment_size) {
+      throw IoException("UDP segmentation offload is not supported");
+    }
+#endif
+  }
+
+  auto& dir = fd_control_->Write();
+  dir.ResetReady();
+  impl::Direction::SingleUserGuard guard(dir);
+  return dir.PerformIoBatch(guard, SendManyWrapper{datagrams}, count,
+                            impl::TransferMode::kWhole, deadline,
+                            "SendMany to ", peername_);
+}
+
+std::size_t Socket::RecvMany(IncomingDatagram* datagrams, std::size_t count,
+                             Deadline deadline) {
+  if (!IsValid()) {
+    throw IoException("Attempt to RecvMany from closed socket");
+  }
+  if (count == 0) return 0;
+  UASSERT(datagrams);
+
+  auto& dir = fd_control_->Read();
+  dir.ResetReady();
+  impl::Direction::SingleUserGuard guard(dir);
+  return dir.PerformIoBatch(guard, RecvManyWrapper{datagrams}, count,
+                            impl::TransferMode::kOnce, deadline,
+                            "RecvMany from ", peername_);
+}
+
 Socket Socket::Accept(Deadline deadline) {
   if (!IsValid()) {
     throw IoException("Attempt to Accept from closed socket");
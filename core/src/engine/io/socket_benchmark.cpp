@@ -2,7 +2,9 @@
 
 #include <array>
 #include <chrono>
+#include <cstdint>
 #include <string>
+#include <vector>
 
 #include <userver/engine/async.hpp>
 #include <userver/engine/condition_variable.hpp>
@@ -138,4 +140,145 @@ BENCHMARK(socket_send_all_v);
 // TODO(TAXICOMMON-5510) flaky, sometimes throws engine::io::IoTimeout
 // BENCHMARK(socket_send_all_range)->RangeMultiplier(10)->Range(10, 10000);
 
+// Every iteration waits for readiness on both sides, so the numbers are
+// dominated by the poller. Arg(0) is libev, Arg(1) is io_uring.
+void socket_ping_pong(benchmark::State& state) {
+  engine::TaskProcessorPoolsConfig config;
+  config.ev_io_uring_enabled = state.range(0) != 0;
+
+  engine::RunStandalone(2, config, [&]() {
+    const auto test_deadline = Deadline::FromDuration(kDeadlineMaxTime);
+    internal::net::TcpListener listener;
+    auto [server, client] = listener.MakeSocketPair(test_deadline);
+    auto task_echo = engine::AsyncNoSpan(
+        [test_deadline](auto&& server) {
+          std::array<char, 128> buf = {};
+          while (true) {
+            const auto size =
+                server.RecvSome(buf.data(), buf.size(), test_deadline);
+            if (size == 0) break;
+            [[maybe_unused]] const auto sent =
+                server.SendAll(buf.data(), size, test_deadline);
+          }
+        },
+        std::move(server));
+
+    std::array<char, 4> buf = {};
+    for ([[maybe_unused]] auto _ : state) {
+      auto bytes = client.SendAll("ping", 4, test_deadline);
+      bytes += client.RecvAll(buf.data(), buf.size(), test_deadline);
+      benchmark::DoNotOptimize(bytes);
+    }
+    client.Close();
+    task_echo.Get();
+  });
+}
+BENCHMARK(socket_ping_pong)->Arg(0)->Arg(1);
+
+// Datagrams are sent to a socket nobody reads from, the kernel drops them
+// once the receive buffer is full. Arg is the number of datagrams per
+// iteration.
+void socket_udp_send_all_to(benchmark::State& state) {
+  engine::RunStandalone([&]() {
+    const auto test_deadline = Deadline::FromDuration(kDeadlineMaxTime);
+    internal::net::UdpListener listener;
+    engine::io::Socket client{listener.addr.Domain(),
+                              internal::net::UdpListener::kType};
+    const auto count = static_cast<std::size_t>(state.range(0));
+    for ([[maybe_unused]] auto _ : state) {
+      std::size_t bytes = 0;
+      for (std::size_t i = 0; i < count; ++i) {
+        bytes += client.SendAllTo(listener.addr, "datagram", 8, test_deadline);
+      }
+      benchmark::DoNotOptimize(bytes);
+    }
+    state.SetItemsProcessed(state.iterations() * count);
+  });
+}
+BENCHMARK(socket_udp_send_all_to)->RangeMultiplier(4)->Range(1, 64);
+
+void socket_udp_send_many(benchmark::State& state) {
+  engine::RunStandalone([&]() {
+    const auto test_deadline = Deadline::FromDuration(kDeadlineMaxTime);
+    internal::net::UdpListener listener;
+    engine::io::Socket client{listener.addr.Domain(),
+                              internal::net::UdpListener::kType};
+    const std::vector<engine::io::OutgoingDatagram> datagrams(
+        state.range(0), {"datagram", 8, &listener.addr});
+    for ([[maybe_unused]] auto _ : state) {
+      const auto sent =
+          client.SendMany(datagrams.data(), datagrams.size(), test_deadline);
+      benchmark::DoNotOptimize(sent);
+    }
+    state.SetItemsProcessed(state.iterations() * datagrams.size());
+  });
+}
+BENCHMARK(socket_udp_send_many)->RangeMultiplier(4)->Range(1, 64);
+
+// A buffer of 40 datagrams is split by the kernel (UDP GSO), Arg is the size
+// of a datagram
+void socket_udp_send_segmented(benchmark::State& state) {
+  engine::RunStandalone([&]() {
+    const auto test_deadline = Deadline::FromDuration(kDeadlineMaxTime);
+    internal::net::UdpListener listener;
+    engine::io::Socket client{listener.addr.Domain(),
+                              internal::net::UdpListener::kType};
+    const auto segment_size = static_cast<std::uint16_t>(state.range(0));
+    const std::string payload(segment_size * 40, 'a');
+    const engine::io::OutgoingDatagram datagram{
+        payload.data(), payload.size(), &listener.addr, segment_size};
+    for ([[maybe_unused]] auto _ : state) {
+      const auto sent = client.SendMany(&datagram, 1, test_deadline);
+      benchmark::DoNotOptimize(sent);
+    }
+    state.SetBytesProcessed(state.iterations() * payload.size());
+  });
+}
+BENCHMARK(socket_udp_send_segmented)->Arg(512)->Arg(1400);
+
+// Arg(0) receives the datagrams one by one, Arg(1) with RecvMany
+void socket_udp_recv_many(benchmark::State& state) {
+  constexpr std::size_t kDatagrams = 32;
+
+  engine::RunStandalone([&]() {
+    const auto test_deadline = Deadline::FromDuration(kDeadlineMaxTime);
+    internal::net::UdpListener listener;
+    engine::io::Socket client{listener.addr.Domain(),
+                              internal::net::UdpListener::kType};
+    const std::vector<engine::io::OutgoingDatagram> outgoing(
+        kDatagrams, {"datagram", 8, &listener.addr});
+
+    std::array<std::array<char, 16>, kDatagrams> buffers{};
+    std::array<engine::io::IncomingDatagram, kDatagrams> incoming;
+    for (std::size_t i = 0; i < kDatagrams; ++i) {
+      incoming[i].buf = buffers[i].data();
+      incoming[i].len = buffers[i].size();
+    }
+
+    for ([[maybe_unused]] auto _ : state) {
+      state.PauseTiming();
+      [[maybe_unused]] const auto sent =
+          client.SendMany(outgoing.data(), outgoing.size(), test_deadline);
+      state.ResumeTiming();
+
+      std::size_t received = 0;
+      while (received < kDatagrams) {
+        if (state.range(0) == 0) {
+          const auto result = listener.socket.RecvSomeFrom(
+              buffers[received].data(), buffers[received].size(),
+              test_deadline);
+          benchmark::DoNotOptimize(result);
+          ++received;
+        } else {
+          received += listener.socket.RecvMany(incoming.data() + received,
+                                               kDatagrams - received,
+                                               test_deadline);
+        }
+      }
+    }
+    state.SetItemsProcessed(state.iterations() * kDatagrams);
+  });
+}
+BENCHMARK(socket_udp_recv_many)->Arg(0)->Arg(1);
+
 USERVER_NAMESPACE_END
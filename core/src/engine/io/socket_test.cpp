@@ -5,10 +5,16 @@
 #include <sys/socket.h>
 #include <unistd.h>
 
+#ifdef __linux__
+#include <netinet/udp.h>
+#endif
+
 #include <array>
 #include <cerrno>
 #include <cstdlib>
+#include <string>
 #include <string_view>
+#include <vector>
 
 #include <userver/engine/async.hpp>
 #include <userver/engine/condition_variable.hpp>
@@ -18,6 +24,9 @@
 #include <userver/engine/single_consumer_event.hpp>
 #include <userver/engine/sleep.hpp>
 #include <userver/engine/wait_any.hpp>
+#include <userver/fs/blocking/file_descriptor.hpp>
+#include <userver/fs/blocking/temp_file.hpp>
+#include <userver/fs/blocking/write.hpp>
 #include <userver/internal/net/net_listener.hpp>
 
 USERVER_NAMESPACE_BEGIN
@@ -492,4 +501,174 @@ UTEST(Socket, WriteALot) {
   }
 }
 
+UTEST(Socket, SendFile) {
+  const auto deadline = Deadline::FromDuration(utest::kMaxTestWaitTime);
+  TcpListener listener;
+  auto sockets = listener.MakeSocketPair(deadline);
+
+  std::string contents;
+  for (int i = 0; i < 100000; ++i) contents += static_cast<char>('a' + i % 26);
+  const auto file = fs::blocking::TempFile::Create();
+  fs::blocking::RewriteFileContents(file.GetPath(), contents);
+  const auto fd = fs::blocking::FileDescriptor::Open(
+      file.GetPath(), fs::blocking::OpenFlag::kRead);
+
+  constexpr std::size_t kOffset = 10;
+  const auto len = contents.size() - kOffset;
+  auto read_task = engine::AsyncNoSpan([&] {
+    std::string received(len, '\0');
+    EXPECT_EQ(sockets.second.RecvAll(received.data(), len, deadline), len);
+    return received;
+  });
+
+  EXPECT_EQ(sockets.first.SendFile(fd.GetNative(), kOffset, len, deadline),
+            len);
+  EXPECT_EQ(read_task.Get(), contents.substr(kOffset));
+
+  // Stops at the end of the file
+  EXPECT_EQ(sockets.first.SendFile(fd.GetNative(), contents.size() - 1,
+                                   contents.size(), deadline),
+            1);
+}
+
+UTEST(Socket, SendAllZeroCopyThreshold) {
+  const auto deadline = Deadline::FromDuration(utest::kMaxTestWaitTime);
+  TcpListener listener;
+  auto sockets = listener.MakeSocketPair(deadline);
+  sockets.first.SetZeroCopySendThreshold(1024);
+
+  // The loopback copies the zero-copy sends, the data must arrive intact
+  // regardless
+  const std::string small(100, 's');
+  std::string large;
+  for (int i = 0; i < 1000000; ++i) large += static_cast<char>('a' + i % 26);
+
+  auto read_task = engine::AsyncNoSpan([&] {
+    std::string received(small.size() + large.size() * 2, '\0');
+    EXPECT_EQ(sockets.second.RecvAll(received.data(), received.size(),
+                                     deadline),
+              received.size());
+    return received;
+  });
+
+  EXPECT_EQ(sockets.first.SendAll(small.data(), small.size(), deadline),
+            small.size());
+  EXPECT_EQ(sockets.first.SendAll(large.data(), large.size(), deadline),
+            large.size());
+  const std::array<io::IoData, 2> halves{{
+      {large.data(), large.size() / 2},
+      {large.data() + large.size() / 2, large.size() - large.size() / 2},
+  }};
+  EXPECT_EQ(sockets.first.SendAll(halves.data(), halves.size(), deadline),
+            large.size());
+  EXPECT_EQ(read_task.Get(), small + large + large);
+}
+
+UTEST(Socket, SendManyRecvMany) {
+  const auto deadline = Deadline::FromDuration(utest::kMaxTestWaitTime);
+  constexpr std::size_t kDatagrams = 100;
+
+  UdpListener listener;
+  engine::io::Socket& socket = listener.socket;
+  const auto& addr = socket.Getsockname();
+
+  std::vector<std::string> payloads;
+  std::vector<io::OutgoingDatagram> outgoing;
+  for (std::size_t i = 0; i < kDatagrams; ++i) {
+    payloads.push_back(std::to_string(i));
+  }
+  for (const auto& payload : payloads) {
+    outgoing.push_back({payload.data(), payload.size(), &addr});
+  }
+  EXPECT_EQ(socket.SendMany(outgoing.data(), outgoing.size(), deadline),
+            kDatagrams);
+
+  std::vector<std::array<char, 16>> buffers(kDatagrams);
+  std::vector<io::IncomingDatagram> incoming(kDatagrams);
+  for (std::size_t i = 0; i < kDatagrams; ++i) {
+    incoming[i].buf = buffers[i].data();
+    incoming[i].len = buffers[i].size();
+  }
+
+  std::size_t received = 0;
+  while (received < kDatagrams) {
+    const auto count = socket.RecvMany(incoming.data() + received,
+                                       kDatagrams - received, deadline);
+    ASSERT_GT(count, 0);
+    received += count;
+  }
+
+  for (std::size_t i = 0; i < kDatagrams; ++i) {
+    const auto& datagram = incoming[i];
+    EXPECT_FALSE(datagram.is_truncated);
+    EXPECT_EQ(std::string_view(buffers[i].data(), datagram.bytes_received),
+              payloads[i]);
+    EXPECT_EQ(fmt::to_string(datagram.src_addr), fmt::to_string(addr));
+  }
+}
+
+UTEST(Socket, RecvManyTruncated) {
+  const auto deadline = Deadline::FromDuration(utest::kMaxTestWaitTime);
+
+  UdpListener listener;
+  engine::io::Socket& socket = listener.socket;
+  EXPECT_EQ(socket.SendAllTo(socket.Getsockname(), "123456", 6, deadline), 6);
+
+  std::array<char, 4> buf{};
+  io::IncomingDatagram datagram;
+  datagram.buf = buf.data();
+  datagram.len = buf.size();
+  EXPECT_EQ(socket.RecvMany(&datagram, 1, deadline), 1);
+  EXPECT_TRUE(datagram.is_truncated);
+  EXPECT_EQ(std::string_view(buf.data(), buf.size()), "1234");
+}
+
+UTEST(Socket, RecvManyTimeout) {
+  UdpListener listener;
+  io::IncomingDatagram datagram;
+  std::array<char, 4> buf{};
+  datagram.buf = buf.data();
+  datagram.len = buf.size();
+  const auto deadline = Deadline::FromDuration(std::chrono::milliseconds{10});
+  UEXPECT_THROW([[maybe_unused]] auto ret =
+                    listener.socket.RecvMany(&datagram, 1, deadline),
+                io::IoTimeout);
+}
+
+#ifdef UDP_SEGMENT
+UTEST(Socket, SendManySegmented) {
+  const auto deadline = Deadline::FromDuration(utest::kMaxTestWaitTime);
+  constexpr std::uint16_t kSegmentSize = 100;
+
+  UdpListener listener;
+  engine::io::Socket& socket = listener.socket;
+  const auto& addr = socket.Getsockname();
+
+  const std::string payload(kSegmentSize * 3 - 1, 'x');
+  io::OutgoingDatagram outgoing{payload.data(), payload.size(), &addr,
+                                kSegmentSize};
+  try {
+    EXPECT_EQ(socket.SendMany(&outgoing, 1, deadline), 1);
+  } catch (const io::IoSystemError& ex) {
+    GTEST_SKIP() << "UDP GSO is not supported: " << ex.what();
+  }
+
+  std::array<std::array<char, kSegmentSize>, 3> buffers{};
+  std::array<io::IncomingDatagram, 3> incoming;
+  for (std::size_t i = 0; i < incoming.size(); ++i) {
+    incoming[i].buf = buffers[i].data();
+    incoming[i].len = buffers[i].size();
+  }
+
+  std::size_t received = 0;
+  while (received < incoming.size()) {
+    received += socket.RecvMany(incoming.data() + received,
+                                incoming.size() - received, deadline);
+  }
+  EXPECT_EQ(incoming[0].bytes_received, kSegmentSize);
+  EXPECT_EQ(incoming[1].bytes_received, kSegmentSize);
+  EXPECT_EQ(incoming[2].bytes_received, kSegmentSize - 1);
+}
+#endif
+
 USERVER_NAMESPACE_END
@@ -219,6 +219,11 @@ SslCtx MakeSslCtx() {
   SSL_CTX_set_options(ssl_ctx.get(), options);
   SSL_CTX_set_mode(ssl_ctx.get(), SSL_MODE_ENABLE_PARTIAL_WRITE);
   SSL_CTX_clear_mode(ssl_ctx.get(), SSL_MODE_AUTO_RETRY);
+  // Without read-ahead every record takes two socket reads: one for the 5-byte
+  // header and one for the body. With it, OpenSSL reads as much as fits into
+  // its buffer, possibly several records at once. The buffered data is seen
+  // by SSL_has_pending, so the readiness checks stay correct.
+  SSL_CTX_set_read_ahead(ssl_ctx.get(), 1);
   if (1 != SSL_CTX_set_default_verify_paths(ssl_ctx.get())) {
     LOG_LIMITED_WARNING() << crypto::FormatSslError(
         "Failed create an SSL context: SSL_CTX_set_default_verify_paths");
@@ -231,8 +236,115 @@ enum InterruptAction {
   kFail,
 };
 
+// Protocols in the ALPN wire format, in order of preference
+std::string MakeAlpnProtocolList(const std::vector<std::string>& protocols) {
+  std::string result;
+  for (const auto& protocol : protocols) {
+    UINVARIANT(!protocol.empty() && protocol.size() < 256,
+               "Invalid ALPN protocol name");
+    result += static_cast<char>(protocol.size());
+    result += protocol;
+  }
+  return result;
+}
+
+int SelectAlpnProtocol(SSL*, const unsigned char** out, unsigned char* outlen,
+                       const unsigned char* in, unsigned int inlen,
+                       void* arg) {
+  const auto& protocols = *static_cast<const std::string*>(arg);
+  unsigned char* selected = nullptr;
+  if (SSL_select_next_proto(
+          &selected, outlen,
+          // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
+          reinterpret_cast<const unsigned char*>(protocols.data()),
+          protocols.size(), in, inlen) != OPENSSL_NPN_NEGOTIATED) {
+    // Proceeding without ALPN
+    return SSL_TLSEXT_ERR_NOACK;
+  }
+  *out = selected;
+  return SSL_TLSEXT_ERR_OK;
+}
+
 }  // namespace
 
+class TlsServerContext::Impl final {
+ public:
+  Impl(const crypto::Certificate& cert, const crypto::PrivateKey& key,
+       const std::vector<crypto::Certificate>& cert_authorities,
+       const std::vector<std::string>& alpn_protocols)
+      : ssl_ctx(MakeSslCtx()),
+        alpn_protocol_list(MakeAlpnProtocolList(alpn_protocols)) {
+    if (!cert_authorities.empty()) {
+      auto* store = SSL_CTX_get_cert_store(ssl_ctx.get());
+      for (const auto& ca : cert_authorities) {
+        if (1 != X509_STORE_add_cert(store, ca.GetNative())) {
+          throw TlsException(crypto::FormatSslError(
+              "Failed to set up server TLS wrapper: X509_STORE_add_cert"));
+        }
+      }
+      SSL_CTX_set_verify(ssl_ctx.get(),
+                         SSL_VERIFY_PEER | SSL_VERIFY_FAIL_IF_NO_PEER_CERT,
+                         nullptr);
+      LOG_INFO() << "Client SSL cert will be verified";
+    } else {
+      LOG_INFO() << "Client SSL cert will not be verified";
+    }
+
+    if (1 != SSL_CTX_use_certificate(ssl_ctx.get(), cert.GetNative())) {
+      throw TlsException(crypto::FormatSslError(
+          "Failed to set up server TLS wrapper: SSL_CTX_use_certificate"));
+    }
+
+    if (1 != SSL_CTX_use_PrivateKey(ssl_ctx.get(), key.GetNative())) {
+      throw TlsException(crypto::FormatSslError(
+          "Failed to set up server TLS wrapper: SSL_CTX_use_PrivateKey"));
+    }
+
+    // Session cache and ticket keys live in the SSL_CTX. Session id context
+    // is required for resumption when client certificates are verified.
+    SSL_CTX_set_session_cache_mode(ssl_ctx.get(), SSL_SESS_CACHE_SERVER);
+    if (1 != SSL_CTX_set_session_id_context(
+                 ssl_ctx.get(),
+                 // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
+                 reinterpret_cast<const unsigned char*>(kSessionIdContext),
+                 sizeof(kSessionIdContext) - 1)) {
+      throw TlsException(crypto::FormatSslError(
+          "Failed to set up server TLS wrapper: "
+          "SSL_CTX_set_session_id_context"));
+    }
+
+    if (!alpn_protocol_list.empty()) {
+      // NOLINTNEXTLINE(cppcoreguidelines-pro-type-const-cast)
+      SSL_CTX_set_alpn_select_cb(ssl_ctx.get(), &SelectAlpnProtocol,
+                                 const_cast<std::string*>(&alpn_protocol_list));
+    }
+  }
+
+  ~Impl() {
+    // SSL_CTX may outlive us in the connections that hold a reference to it
+    SSL_CTX_set_alpn_select_cb(ssl_ctx.get(), nullptr, nullptr);
+  }
+
+  static constexpr char kSessionIdContext[] = "userver";
+
+  SslCtx ssl_ctx;
+  const std::string alpn_protocol_list;
+};
+
+TlsServerContext::TlsServerContext(
+    const crypto::Certificate& cert, const crypto::PrivateKey& key,
+    const std::vector<crypto::Certificate>& cert_authorities,
+    const std::vector<std::string>& alpn_protocols)
+    : impl_(std::make_unique<Impl>(cert, key, cert_authorities,
+                                   alpn_protocols)) {}
+
+TlsServerContext::~TlsServerContext() = default;
+
+TlsServerContext::TlsServerContext(TlsServerContext&&) noexcept = default;
+
+TlsServerContext& TlsServerContext::operator=(TlsServerContext&&) noexcept =
+    default;
+
 class TlsWrapper::ReadContextAccessor final
     : public engine::impl::ContextAccessor {
  public:
@@ -269,7 +381,7 @@ class TlsWrapper::Impl {
     SyncBioData(SSL_get_rbio(ssl.get()), &other.bio_data);
   }
 
-  void SetUp(SslCtx&& ssl_ctx) {
+  void SetUp(SSL_CTX* ssl_ctx) {
     Bio socket_bio{BIO_new(GetSocketBioMethod())};
     if (!socket_bio) {
       throw TlsException(
@@ -279,7 +391,7 @@ class TlsWrapper::Impl {
     SyncBioData(socket_bio.get(), nullptr);
     BIO_set_init(socket_bio.get(), 1);
 
-    ssl.reset(SSL_new(ssl_ctx.get()));
+    ssl.reset(SSL_new(ssl_ctx));
     if (!ssl) {
       throw TlsException(
           crypto::FormatSslError("Failed to set up TLS wrapper: SSL_new"));
@@ -444,7 +556,7 @@ TlsWrapper TlsWrapper::StartTlsClient(Socket&& socket,
   }
 
   TlsWrapper wrapper{std::move(socket)};
-  wrapper.impl_->SetUp(std::move(ssl_ctx));
+  wrapper.impl_->SetUp(ssl_ctx.get());
   if (!server_name.empty()) {
     // cast in openssl1.0 macro expansion
     // NOLINTNEXTLINE(cppcoreguidelines-pro-type-cstyle-cast)
@@ -516,7 +628,7 @@ TlsWrapper TlsWrapper::StartTlsClient(
   }
 
   TlsWrapper wrapper{std::move(socket)};
-  wrapper.impl_->SetUp(std::move(ssl_ctx));
+  wrapper.impl_->SetUp(ssl_ctx.get());
   if (!server_name.empty()) {
     // cast in openssl1.0 macro expansion
     // NOLINTNEXTLINE(cppcoreguidelines-pro-type-cstyle-cast)
@@ -545,37 +657,18 @@ TlsWrapper TlsWrapper::StartTlsClient(
 TlsWrapper TlsWrapper::StartTlsServer(
     Socket&& socket, const crypto::Certificate& cert,
     const crypto::PrivateKey& key, Deadline deadline,
-    const std::vector<crypto::Certificate>& cert_authorities) {
-  auto ssl_ctx = MakeSslCtx();
-
-  if (!cert_authorities.empty()) {
-    auto* store = SSL_CTX_get_cert_store(ssl_ctx.get());
-    for (const auto& ca : cert_authorities) {
-      if (1 != X509_STORE_add_cert(store, ca.GetNative())) {
-        throw TlsException(crypto::FormatSslError(
-            "Failed to set up server TLS wrapper: X509_STORE_add_cert"));
-      }
-    }
-    SSL_CTX_set_verify(ssl_ctx.get(),
-                       SSL_VERIFY_PEER | SSL_VERIFY_FAIL_IF_NO_PEER_CERT,
-                       nullptr);
-    LOG_INFO() << "Client SSL cert will be verified";
-  } else {
-    LOG_INFO() << "Client SSL cert will not be verified";
-  }
-
-  if (1 != SSL_CTX_use_certificate(ssl_ctx.get(), cert.GetNative())) {
-    throw TlsException(crypto::FormatSslError(
-        "Failed to set up server TLS wrapper: SSL_CTX_use_certificate"));
-  }
-
-  if (1 != SSL_CTX_use_PrivateKey(ssl_ctx.get(), key.GetNative())) {
-    throw TlsException(crypto::FormatSslError(
-        "Failed to set up server TLS wrapper: SSL_CTX_use_PrivateKey"));
-  }
+    const std::vector<crypto::Certificate>& cert_authorities,
+    const std::vector<std::string>& alpn_protocols) {
+  return StartTlsServer(
+      std::move(socket),
+      TlsServerContext{cert, key, cert_authorities, alpn_protocols}, deadline);
+}
 
+TlsWrapper TlsWrapper::StartTlsServer(Socket&& socket,
+                                      const TlsServerContext& context,
+                                      Deadline deadline) {
   TlsWrapper wrapper{std::move(socket)};
-  wrapper.impl_->SetUp(std::move(ssl_ctx));
+  wrapper.impl_->SetUp(context.impl_->ssl_ctx.get());
   wrapper.impl_->bio_data.current_deadline = deadline;
 
   auto ret = SSL_accept(wrapper.impl_->ssl.get());
@@ -653,13 +746,20 @@ size_t TlsWrapper::SendAll(const void* buf, size_t len, Deadline deadline) {
 
 [[nodiscard]] size_t TlsWrapper::WriteAll(std::initializer_list<IoData> list,
                                           Deadline deadline) {
+  return WriteAll(list.begin(), list.size(), deadline);
+}
+
+[[nodiscard]] size_t TlsWrapper::WriteAll(const IoData* list,
+                                          std::size_t list_size,
+                                          Deadline deadline) {
+  const auto* const list_end = list + list_size;
   static constexpr std::size_t kBufSize = 4'096;
   std::byte buf[kBufSize];
 
   std::size_t sent_bytes = 0;
   std::size_t remaining_cap = kBufSize;
-  auto fits_in_buf_begin = list.begin();
-  for (auto it = fits_in_buf_begin; it != list.end(); ++it) {
+  const auto* fits_in_buf_begin = list;
+  for (auto it = fits_in_buf_begin; it != list_end; ++it) {
     if (it->len > remaining_cap) {
       if (it - fits_in_buf_begin >= 2) {
         for (auto* ins_pos = buf; fits_in_buf_begin != it;
@@ -689,7 +789,7 @@ size_t TlsWrapper::SendAll(const void* buf, size_t len, Deadline deadline) {
   }
 
   auto ins_pos = buf;
-  for (auto ins_it = fits_in_buf_begin; ins_it != list.end(); ++ins_it) {
+  for (auto ins_it = fits_in_buf_begin; ins_it != list_end; ++ins_it) {
     ins_pos = std::copy_n(static_cast<const std::byte*>(ins_it->data),
                           ins_it->len, ins_pos);
   }
@@ -737,6 +837,19 @@ Socket TlsWrapper::StopTls(Deadline deadline) {
 
 int TlsWrapper::GetRawFd() { return impl_->bio_data.socket.Fd(); }
 
+std::string TlsWrapper::GetAlpnProtocol() const {
+  const unsigned char* protocol = nullptr;
+  unsigned int size = 0;
+  SSL_get0_alpn_selected(impl_->ssl.get(), &protocol, &size);
+  if (!protocol) return {};
+  // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
+  return {reinterpret_cast<const char*>(protocol), size};
+}
+
+bool TlsWrapper::IsSessionReused() const {
+  return impl_->ssl && SSL_session_reused(impl_->ssl.get()) == 1;
+}
+
 }  // namespace engine::io
 
 USERVER_NAMESPACE_END
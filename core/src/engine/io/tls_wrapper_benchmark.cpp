@@ -181,4 +181,48 @@ BENCHMARK(tls_write_all_default)
     ->Range(1 << 6, 1 << 12)
     ->Unit(benchmark::kNanosecond);
 
+// Throughput of the TLS data path: the server streams messages of the given
+// size, the client receives them with buffers of the same size
+[[maybe_unused]] void tls_read_throughput(benchmark::State& state) {
+  engine::RunStandalone(2, [&]() {
+    const auto deadline = Deadline::FromDuration(kDeadlineMaxTime);
+
+    TcpListener tcp_listener;
+    auto [server, client] = tcp_listener.MakeSocketPair(deadline);
+
+    const std::string payload(state.range(0), 'x');
+    auto server_task = engine::AsyncNoSpan(
+        [&payload, deadline](auto&& server) {
+          auto tls_server = io::TlsWrapper::StartTlsServer(
+              std::forward<decltype(server)>(server),
+              crypto::Certificate::LoadFromString(cert),
+              crypto::PrivateKey::LoadFromString(key), deadline);
+
+          while (tls_server.SendAll(payload.data(), payload.size(),
+                                    deadline) == payload.size()) {
+            /* sending msgs */
+          }
+        },
+        std::move(server));
+
+    auto tls_client =
+        io::TlsWrapper::StartTlsClient(std::move(client), {}, deadline);
+
+    std::vector<char> buf(payload.size());
+    for ([[maybe_unused]] auto _ : state) {
+      benchmark::DoNotOptimize(
+          tls_client.RecvAll(buf.data(), buf.size(), deadline));
+    }
+    state.SetBytesProcessed(state.iterations() * state.range(0));
+
+    // the server is blocked on a full socket buffer at this point
+    server_task.SyncCancel();
+  });
+}
+
+BENCHMARK(tls_read_throughput)
+    ->RangeMultiplier(4)
+    ->Range(1 << 6, 1 << 16)
+    ->Unit(benchmark::kMicrosecond);
+
 USERVER_NAMESPACE_END
@@ -686,4 +686,36 @@ UTEST(TlsWrapper, PeerDisconnect) {
   server_task.Get();
 }
 
+UTEST_MT(TlsWrapper, SharedServerContext, 2) {
+  const auto test_deadline = Deadline::FromDuration(utest::kMaxTestWaitTime);
+
+  const io::TlsServerContext server_context{
+      crypto::Certificate::LoadFromString(cert),
+      crypto::PrivateKey::LoadFromString(key)};
+
+  for (int i = 0; i < 3; ++i) {
+    TcpListener tcp_listener;
+    auto [server, client] = tcp_listener.MakeSocketPair(test_deadline);
+
+    auto server_task = engine::AsyncNoSpan(
+        [&server_context, test_deadline](auto&& server) {
+          auto tls_server = io::TlsWrapper::StartTlsServer(
+              std::forward<decltype(server)>(server), server_context,
+              test_deadline);
+          // client does not keep its sessions
+          EXPECT_FALSE(tls_server.IsSessionReused());
+          EXPECT_EQ(1, tls_server.SendAll("1", 1, test_deadline));
+        },
+        std::move(server));
+
+    auto tls_client =
+        io::TlsWrapper::StartTlsClient(std::move(client), {}, test_deadline);
+    char c = 0;
+    EXPECT_EQ(1, tls_client.RecvAll(&c, 1, test_deadline));
+    EXPECT_EQ('1', c);
+
+    server_task.Get();
+  }
+}
+
 USERVER_NAMESPACE_END
@@ -1,12 +1,14 @@
 #include <benchmark/benchmark.h>
 
+#include <algorithm>
 #include <atomic>
 #include <cstddef>
+#include <cstdint>
 #include <mutex>
 #include <thread>
 #include <vector>
 
-#include <concurrent/impl/interference_shield.hpp>
+#include <userver/concurrent/impl/interference_shield.hpp>
 #include <userver/engine/async.hpp>
 #include <userver/engine/mutex.hpp>
 #include <userver/engine/run_standalone.hpp>
@@ -125,6 +127,49 @@ void generic_contention_with_payload(benchmark::State& state) {
       total_lock_unlock_count / state.range(0), benchmark::Counter::kIsRate);
 }
 
+// A few counters are updated under the lock, as in statistics aggregation or
+// cache way lookups, while the most of the time is spent out of it
+template <typename Mutex>
+void generic_contention_short_section(benchmark::State& state) {
+  struct Stats {
+    std::uint64_t count{0};
+    std::uint64_t sum{0};
+    std::uint64_t max{0};
+  };
+
+  std::atomic<std::uint64_t> lock_unlock_count{0};
+  concurrent::impl::InterferenceShield<Mutex> m;
+  Stats stats;
+
+  RunParallelBenchmark(state, [&](auto& range) {
+    std::uint64_t local_lock_unlock_count = 0;
+
+    for ([[maybe_unused]] auto _ : range) {
+      std::uint64_t value = 0;
+      for (int i = 0; i < 10; ++i) {
+        value += utils::Rand();
+      }
+
+      m->lock();
+      ++stats.count;
+      stats.sum += value;
+      stats.max = std::max(stats.max, value);
+      m->unlock();
+      ++local_lock_unlock_count;
+    }
+
+    lock_unlock_count += local_lock_unlock_count;
+  });
+  benchmark::DoNotOptimize(stats);
+
+  const auto total_lock_unlock_count =
+      static_cast<double>(lock_unlock_count.load());
+  state.counters["locks"] =
+      benchmark::Counter(total_lock_unlock_count, benchmark::Counter::kIsRate);
+  state.counters["locks-per-thread"] = benchmark::Counter(
+      total_lock_unlock_count / state.range(0), benchmark::Counter::kIsRate);
+}
+
 //////// Benchmarks
 
 // Note: We intentionally do not run std::* benchmarks from RunStandalone to
@@ -189,6 +234,16 @@ void single_waiting_task_mutex_contention_with_payload(
   });
 }
 
+void mutex_coro_contention_short_section(benchmark::State& state) {
+  engine::RunStandalone(state.range(0), [&] {
+    generic_contention_short_section<engine::Mutex>(state);
+  });
+}
+
+void mutex_std_contention_short_section(benchmark::State& state) {
+  generic_contention_short_section<std::mutex>(state);
+}
+
 }  // namespace
 
 BENCHMARK(mutex_coro_lock);
@@ -207,4 +262,11 @@ BENCHMARK(mutex_coro_contention_with_payload)->RangeMultiplier(2)->Range(1, 32);
 BENCHMARK(mutex_std_contention_with_payload)->RangeMultiplier(2)->Range(1, 32);
 BENCHMARK(single_waiting_task_mutex_contention_with_payload)->Range(1, 2);
 
+BENCHMARK(mutex_coro_contention_short_section)
+    ->RangeMultiplier(2)
+    ->Range(1, 32);
+BENCHMARK(mutex_std_contention_short_section)
+    ->RangeMultiplier(2)
+    ->Range(1, 32);
+
 USERVER_NAMESPACE_END
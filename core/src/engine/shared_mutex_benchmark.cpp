@@ -1,16 +1,30 @@
 #include <benchmark/benchmark.h>
 
+#include <atomic>
+#include <shared_mutex>
+
 #include <userver/engine/async.hpp>
 #include <userver/engine/run_standalone.hpp>
 #include <userver/engine/shared_mutex.hpp>
+#include <userver/engine/sleep.hpp>
+#include <userver/engine/striped_shared_mutex.hpp>
 #include <utils/impl/parallelize_benchmark.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
+namespace {
+
+void ReaderThreadsArgs(benchmark::internal::Benchmark* b) {
+  b->DenseRange(1, 6)->Arg(16)->Arg(64)->Arg(128);
+}
+
+}  // namespace
+
+template <typename Mutex>
 void shared_mutex_benchmark(benchmark::State& state) {
   engine::RunStandalone(state.range(0), [&] {
     int variable = 0;
-    engine::SharedMutex mutex;
+    Mutex mutex;
 
     auto initial_lock_holder = engine::AsyncNoSpan([&] {
       // ensure the locks are actually needed
@@ -26,6 +40,44 @@ void shared_mutex_benchmark(benchmark::State& state) {
     });
   });
 }
-BENCHMARK(shared_mutex_benchmark)->DenseRange(1, 6);
+BENCHMARK_TEMPLATE(shared_mutex_benchmark, engine::SharedMutex)
+    ->Apply(ReaderThreadsArgs);
+BENCHMARK_TEMPLATE(shared_mutex_benchmark, engine::StripedSharedMutex)
+    ->Apply(ReaderThreadsArgs);
+
+// Read-mostly load: a writer takes the lock once a millisecond
+template <typename Mutex>
+void shared_mutex_rare_writes_benchmark(benchmark::State& state) {
+  engine::RunStandalone(state.range(0), [&] {
+    int variable = 0;
+    Mutex mutex;
+    std::atomic<bool> keep_writing{true};
+
+    auto writer = engine::AsyncNoSpan([&] {
+      while (keep_writing) {
+        {
+          std::unique_lock lock(mutex);
+          ++variable;
+        }
+        engine::SleepFor(std::chrono::milliseconds{1});
+      }
+    });
+
+    RunParallelBenchmark(state, [&](auto& range) {
+      for ([[maybe_unused]] auto _ : range) {
+        std::shared_lock lock(mutex);
+        benchmark::DoNotOptimize(variable);
+      }
+    });
+
+    keep_writing = false;
+    writer.Get();
+  });
+}
+BENCHMARK_TEMPLATE(shared_mutex_rare_writes_benchmark, engine::SharedMutex)
+    ->Apply(ReaderThreadsArgs);
+BENCHMARK_TEMPLATE(shared_mutex_rare_writes_benchmark,
+                   engine::StripedSharedMutex)
+    ->Apply(ReaderThreadsArgs);
 
 USERVER_NAMESPACE_END
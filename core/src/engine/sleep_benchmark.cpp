@@ -9,8 +9,21 @@ using namespace std::chrono_literals;
 
 USERVER_NAMESPACE_BEGIN
 
+namespace {
+
+// The last argument of the benchmarks selects the timers implementation:
+// 0 is libev timers, 1 is the timer wheel.
+engine::TaskProcessorPoolsConfig MakeTimersConfig(benchmark::State& state,
+                                                  std::size_t arg_index) {
+  engine::TaskProcessorPoolsConfig config;
+  config.ev_timer_wheel_enabled = state.range(arg_index) != 0;
+  return config;
+}
+
+}  // namespace
+
 void sleep_benchmark_us(benchmark::State& state) {
-  engine::RunStandalone([&] {
+  engine::RunStandalone(1, MakeTimersConfig(state, 1), [&] {
     const std::chrono::microseconds sleep_duration{state.range(0)};
     for ([[maybe_unused]] auto _ : state) {
       const auto deadline = engine::Deadline::FromDuration(sleep_duration);
@@ -20,7 +33,7 @@ void sleep_benchmark_us(benchmark::State& state) {
 }
 BENCHMARK(sleep_benchmark_us)
     ->RangeMultiplier(2)
-    ->Range(1, 1024 * 128)
+    ->Ranges({{1, 1024 * 128}, {0, 1}})
     ->Unit(benchmark::kMicrosecond);
 
 void run_in_ev_loop_benchmark(benchmark::State& state) {
@@ -47,7 +60,7 @@ BENCHMARK(successful_wait_for_benchmark);
 
 void unreached_task_deadline_benchmark(benchmark::State& state,
                                        bool has_task_deadline) {
-  engine::RunStandalone([&] {
+  engine::RunStandalone(1, MakeTimersConfig(state, 0), [&] {
     for ([[maybe_unused]] auto _ : state) {
       const auto sleep_deadline = engine::Deadline::FromDuration(20s);
       const auto task_deadline_raw = engine::Deadline::FromDuration(40s);
@@ -63,8 +76,12 @@ void unreached_task_deadline_benchmark(benchmark::State& state,
     }
   });
 }
-BENCHMARK_CAPTURE(unreached_task_deadline_benchmark, no_task_deadline, false);
+BENCHMARK_CAPTURE(unreached_task_deadline_benchmark, no_task_deadline, false)
+    ->Arg(0)
+    ->Arg(1);
 BENCHMARK_CAPTURE(unreached_task_deadline_benchmark, unreached_task_deadline,
-                  true);
+                  true)
+    ->Arg(0)
+    ->Arg(1);
 
 USERVER_NAMESPACE_END
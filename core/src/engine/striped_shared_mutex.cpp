@@ -0,0 +1,141 @@
+#include <userver/engine/striped_shared_mutex.hpp>
+
+#include <mutex>
+
+#include <userver/concurrent/impl/asymmetric_fence.hpp>
+#include <userver/engine/task/cancel.hpp>
+#include <userver/utils/assert.hpp>
+#include <userver/utils/scope_guard.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace engine {
+
+/* Readers and writers synchronize like in Dekker's algorithm:
+ *
+ * [reader] readers_.DoLock      [writer] writers_count_ += 1
+ * [reader] light fence          [writer] heavy fence
+ * [reader] load writers_count_  [writer] readers_.IsFree
+ *
+ * The pair of the asymmetric fences works as seq_cst fences, so either the
+ * reader sees the writer and backs off, or the writer sees the reader and
+ * waits for it. The unlock of a reader is ordered with the wait of the
+ * writer the same way.
+ */
+
+StripedSharedMutex::StripedSharedMutex() = default;
+
+StripedSharedMutex::~StripedSharedMutex() {
+  UASSERT_MSG(writers_count_.load() == 0,
+              "StripedSharedMutex is destroyed while being locked");
+}
+
+void StripedSharedMutex::lock() {
+  const auto ok = try_lock_until(Deadline{});
+  UASSERT(ok);
+}
+
+void StripedSharedMutex::unlock() {
+  writer_mutex_.unlock();
+  DecWriters();
+}
+
+bool StripedSharedMutex::try_lock() {
+  return try_lock_until(Deadline::Passed());
+}
+
+bool StripedSharedMutex::try_lock_until(Deadline deadline) {
+  writers_count_.fetch_add(1, std::memory_order_seq_cst);
+  utils::ScopeGuard stop_wait([this] { DecWriters(); });
+
+  if (!writer_mutex_.try_lock_until(deadline)) return false;
+  utils::ScopeGuard unlock_writer([this] { writer_mutex_.unlock(); });
+
+  concurrent::impl::AsymmetricThreadFenceHeavy();
+  if (!WaitForNoReaders(deadline)) return false;
+
+  unlock_writer.Release();
+  stop_wait.Release();
+  return true;
+}
+
+void StripedSharedMutex::lock_shared() {
+  const auto ok = try_lock_shared_until(Deadline{});
+  UASSERT(ok);
+}
+
+void StripedSharedMutex::unlock_shared() {
+  readers_.DoUnlock();
+  concurrent::impl::AsymmetricThreadFenceLight();
+  if (writers_count_.load(std::memory_order_seq_cst) != 0) NotifyWriter();
+}
+
+bool StripedSharedMutex::try_lock_shared() { return TryLockSharedOnce(); }
+
+bool StripedSharedMutex::try_lock_shared_until(Deadline deadline) {
+  while (!TryLockSharedOnce()) {
+    if (!WaitForNoWriters(deadline)) return false;
+  }
+  return true;
+}
+
+bool StripedSharedMutex::TryLockSharedOnce() {
+  /* Fast path: do not touch the counters while there is a writer */
+  if (writers_count_.load(std::memory_order_relaxed) != 0) return false;
+
+  readers_.DoLock();
+  concurrent::impl::AsymmetricThreadFenceLight();
+  if (writers_count_.load(std::memory_order_seq_cst) == 0) return true;
+
+  /* A writer has come, it may already be waiting for us */
+  unlock_shared();
+  return false;
+}
+
+bool StripedSharedMutex::WaitForNoWriters(Deadline deadline) {
+  TaskCancellationBlocker blocker;
+  std::unique_lock lock(wait_mutex_);
+  return readers_cv_.WaitUntil(lock, deadline, [this] {
+    return writers_count_.load(std::memory_order_seq_cst) == 0;
+  });
+}
+
+bool StripedSharedMutex::WaitForNoReaders(Deadline deadline) {
+  /* Fast path */
+  if (readers_.IsFree()) return true;
+
+  TaskCancellationBlocker blocker;
+  std::unique_lock lock(wait_mutex_);
+  return writer_cv_.WaitUntil(lock, deadline,
+                              [this] { return readers_.IsFree(); });
+}
+
+void StripedSharedMutex::DecWriters() {
+  const auto writers_left =
+      writers_count_.fetch_sub(1, std::memory_order_seq_cst);
+  UASSERT_MSG(writers_left > 0, "unlock without lock");
+
+  /* The next writer keeps the readers waiting. Otherwise all the readers
+   * are woken up at once.
+   */
+  if (writers_left == 1) {
+    TaskCancellationBlocker blocker;
+    {
+      std::lock_guard lock(wait_mutex_);
+    }
+    readers_cv_.NotifyAll();
+  }
+}
+
+void StripedSharedMutex::NotifyWriter() {
+  TaskCancellationBlocker blocker;
+  {
+    /* The writer has either not checked the readers yet, or is asleep */
+    std::lock_guard lock(wait_mutex_);
+  }
+  writer_cv_.NotifyAll();
+}
+
+}  // namespace engine
+
+USERVER_NAMESPACE_END
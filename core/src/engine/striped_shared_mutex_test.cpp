@@ -0,0 +1,199 @@
+#include <userver/utest/utest.hpp>
+
+#include <atomic>
+#include <shared_mutex>
+#include <vector>
+
+#include <userver/engine/sleep.hpp>
+#include <userver/engine/striped_shared_mutex.hpp>
+#include <userver/utils/async.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+UTEST(StripedSharedMutex, SharedLockUnlockDouble) {
+  engine::StripedSharedMutex mutex;
+  mutex.lock_shared();
+  mutex.unlock_shared();
+
+  mutex.lock_shared();
+  mutex.unlock_shared();
+}
+
+UTEST(StripedSharedMutex, SharedLockParallel) {
+  engine::StripedSharedMutex mutex;
+  std::shared_lock first(mutex);
+  auto reader = utils::Async("", [&mutex] {
+    std::shared_lock second(mutex);
+    return true;
+  });
+  EXPECT_TRUE(reader.Get());
+}
+
+UTEST(StripedSharedMutex, SharedAndUniqueLock) {
+  engine::StripedSharedMutex mutex;
+
+  std::unique_lock lock(mutex);
+  auto reader = utils::Async("", [&mutex] { std::shared_lock lock(mutex); });
+
+  reader.WaitFor(std::chrono::milliseconds(50));
+  EXPECT_FALSE(reader.IsFinished());
+
+  lock.unlock();
+
+  reader.WaitFor(std::chrono::milliseconds(50));
+  EXPECT_TRUE(reader.IsFinished());
+  UEXPECT_NO_THROW(reader.Get());
+}
+
+UTEST(StripedSharedMutex, UniqueAndSharedLock) {
+  engine::StripedSharedMutex mutex;
+
+  std::shared_lock lock(mutex);
+  auto writer = utils::Async("", [&mutex] { std::unique_lock lock(mutex); });
+
+  writer.WaitFor(std::chrono::milliseconds(50));
+  EXPECT_FALSE(writer.IsFinished());
+
+  lock.unlock();
+
+  writer.WaitFor(std::chrono::milliseconds(50));
+  EXPECT_TRUE(writer.IsFinished());
+  UEXPECT_NO_THROW(writer.Get());
+}
+
+UTEST(StripedSharedMutex, WritersDontStarve) {
+  engine::StripedSharedMutex mutex;
+  std::atomic<int> counter{0};
+  std::atomic<int> loaded{-1};
+
+  std::shared_lock lock(mutex);
+  auto writer = utils::Async("", [&mutex, &counter, &loaded] {
+    std::unique_lock lock(mutex);
+    loaded = counter.load();
+  });
+
+  writer.WaitFor(std::chrono::milliseconds(50));
+  EXPECT_FALSE(writer.IsFinished());
+
+  // New readers wait for the pending writer
+  EXPECT_FALSE(mutex.try_lock_shared());
+  std::vector<engine::TaskWithResult<void>> readers;
+  readers.reserve(10);
+  for (int i = 0; i < 10; i++) {
+    readers.push_back(utils::Async("", [&counter, &mutex] {
+      std::shared_lock lock(mutex);
+      counter++;
+    }));
+  }
+
+  writer.WaitFor(std::chrono::milliseconds(50));
+  EXPECT_FALSE(writer.IsFinished());
+
+  lock.unlock();
+
+  writer.Get();
+  EXPECT_EQ(loaded.load(), 0);
+  for (auto& reader : readers) reader.Get();
+  EXPECT_EQ(counter.load(), 10);
+}
+
+UTEST(StripedSharedMutex, TryLock) {
+  engine::StripedSharedMutex mutex;
+
+  for (int i = 0; i < 10; i++) {
+    ASSERT_TRUE(mutex.try_lock());
+    mutex.unlock();
+  }
+
+  {
+    // mutex must be free of writers
+    ASSERT_TRUE(mutex.try_lock_shared());
+    mutex.unlock_shared();
+  }
+}
+
+UTEST(StripedSharedMutex, TryLockFail) {
+  engine::StripedSharedMutex mutex;
+
+  {
+    std::unique_lock lock(mutex);
+    auto task = utils::Async("", [&mutex] { return mutex.try_lock(); });
+    EXPECT_FALSE(task.Get());
+  }
+  {
+    std::shared_lock lock(mutex);
+    auto task = utils::Async("", [&mutex] {
+      return mutex.try_lock_for(std::chrono::milliseconds{10});
+    });
+    EXPECT_FALSE(task.Get());
+  }
+
+  // A failed writer does not block the readers
+  ASSERT_TRUE(mutex.try_lock_shared());
+  mutex.unlock_shared();
+}
+
+UTEST(StripedSharedMutex, TryLockSharedFor) {
+  engine::StripedSharedMutex mutex;
+
+  std::unique_lock lock(mutex);
+  auto task = utils::Async("", [&mutex] {
+    return mutex.try_lock_shared_for(std::chrono::milliseconds{10});
+  });
+  EXPECT_FALSE(task.Get());
+}
+
+UTEST(StripedSharedMutex, Cancellation) {
+  engine::StripedSharedMutex mutex;
+
+  std::unique_lock lock(mutex);
+  // Critical, so that the body runs despite the cancellation
+  auto reader = utils::CriticalAsync("", [&mutex] {
+    std::shared_lock lock(mutex);
+    return true;
+  });
+  reader.RequestCancel();
+  engine::SleepFor(std::chrono::milliseconds{10});
+
+  // The cancelled task still waits for the lock
+  EXPECT_FALSE(reader.IsFinished());
+  lock.unlock();
+  EXPECT_TRUE(reader.Get());
+}
+
+UTEST_MT(StripedSharedMutex, ExclusionMt, 4) {
+  constexpr int kWritersCount = 2;
+  constexpr int kReadersCount = 4;
+  constexpr int kIterations = 1000;
+
+  engine::StripedSharedMutex mutex;
+  // Only modified under the unique lock, both are equal outside of it
+  int first = 0;
+  int second = 0;
+
+  std::vector<engine::TaskWithResult<void>> tasks;
+  for (int i = 0; i < kWritersCount; ++i) {
+    tasks.push_back(utils::Async("writer", [&] {
+      for (int j = 0; j < kIterations; ++j) {
+        std::unique_lock lock(mutex);
+        ++first;
+        engine::Yield();
+        ++second;
+      }
+    }));
+  }
+  for (int i = 0; i < kReadersCount; ++i) {
+    tasks.push_back(utils::Async("reader", [&] {
+      for (int j = 0; j < kIterations; ++j) {
+        std::shared_lock lock(mutex);
+        ASSERT_EQ(first, second);
+      }
+    }));
+  }
+
+  for (auto& task : tasks) task.Get();
+  EXPECT_EQ(first, kWritersCount * kIterations);
+  EXPECT_EQ(second, kWritersCount * kIterations);
+}
+
+USERVER_NAMESPACE_END
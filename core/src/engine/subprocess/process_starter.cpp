@@ -1,13 +1,13 @@
 #include <userver/engine/subprocess/process_starter.hpp>
 
+#include <fcntl.h>
+#include <spawn.h>
 #include <sys/types.h>
 #include <sys/wait.h>
 #include <unistd.h>
 
 #include <csignal>
-#include <cstdio>
-#include <cstring>
-#include <iostream>
+#include <system_error>
 
 #include <fmt/format.h>
 #include <boost/range/adaptor/transformed.hpp>
@@ -22,52 +22,87 @@
 #include <userver/logging/log.hpp>
 #include <userver/tracing/span.hpp>
 #include <userver/utils/algo.hpp>
-#include <utils/check_syscall.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
 namespace engine::subprocess {
 namespace {
 
-void DoExecve(const std::string& command, const std::vector<std::string>& args,
-              const EnvironmentVariables& env,
-              const std::optional<std::string>& stdout_file,
-              const std::optional<std::string>& stderr_file) {
-  if (stdout_file) {
-    if (!std::freopen(stdout_file->c_str(), "a", stdout)) {
-      utils::CheckSyscall(-1, "freopen stdout to {}", *stdout_file);
+// posix_spawn() creates the child with vfork semantics, so unlike fork() it
+// does not copy the page tables of the parent. That matters for a process
+// with a large RSS, because the spawn is done in the ev thread.
+class Spawner final {
+ public:
+  Spawner(const std::string& command, const std::vector<std::string>& args,
+          const EnvironmentVariables& env,
+          const std::optional<std::string>& stdout_file,
+          const std::optional<std::string>& stderr_file)
+      : command_(command) {
+    argv_ptrs_.reserve(args.size() + 2);
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-type-const-cast)
+    argv_ptrs_.push_back(const_cast<char*>(command_.c_str()));
+    for (const auto& arg : args) {
+      // NOLINTNEXTLINE(cppcoreguidelines-pro-type-const-cast)
+      argv_ptrs_.push_back(const_cast<char*>(arg.c_str()));
     }
-  }
-  if (stderr_file) {
-    if (!std::freopen(stderr_file->c_str(), "a", stderr)) {
-      utils::CheckSyscall(-1, "freopen stderr to {}", *stdout_file);
+    argv_ptrs_.push_back(nullptr);
+
+    envp_buf_.reserve(env.size());
+    envp_ptrs_.reserve(env.size() + 1);
+    for (const auto& [key, value] : env) {
+      envp_buf_.emplace_back(utils::StrCat(key, "=", value));
+      // NOLINTNEXTLINE(cppcoreguidelines-pro-type-const-cast)
+      envp_ptrs_.push_back(const_cast<char*>(envp_buf_.back().c_str()));
+    }
+    envp_ptrs_.push_back(nullptr);
+
+    CheckSpawnResult(posix_spawn_file_actions_init(&file_actions_),
+                     "posix_spawn_file_actions_init");
+    // same as freopen(file, "a", stream)
+    constexpr int kAppendFlags = O_WRONLY | O_CREAT | O_APPEND;
+    constexpr mode_t kMode = 0666;
+    if (stdout_file) {
+      CheckSpawnResult(
+          posix_spawn_file_actions_addopen(&file_actions_, STDOUT_FILENO,
+                                           stdout_file->c_str(), kAppendFlags,
+                                           kMode),
+          "posix_spawn_file_actions_addopen stdout");
+    }
+    if (stderr_file) {
+      CheckSpawnResult(
+          posix_spawn_file_actions_addopen(&file_actions_, STDERR_FILENO,
+                                           stderr_file->c_str(), kAppendFlags,
+                                           kMode),
+          "posix_spawn_file_actions_addopen stderr");
     }
   }
-  std::vector<char*> argv_ptrs;
-  std::vector<std::string> envp_buf;
-  std::vector<char*> envp_ptrs;
-  argv_ptrs.reserve(args.size() + 2);
-  envp_buf.reserve(env.size());
-  envp_ptrs.reserve(env.size() + 1);
-
-  // NOLINTNEXTLINE(cppcoreguidelines-pro-type-const-cast)
-  argv_ptrs.push_back(const_cast<char*>(command.c_str()));
-  for (const auto& arg : args) {
-    // NOLINTNEXTLINE(cppcoreguidelines-pro-type-const-cast)
-    argv_ptrs.push_back(const_cast<char*>(arg.c_str()));
+
+  ~Spawner() { posix_spawn_file_actions_destroy(&file_actions_); }
+
+  Spawner(const Spawner&) = delete;
+  Spawner& operator=(const Spawner&) = delete;
+
+  pid_t Spawn() const {
+    pid_t pid{};
+    CheckSpawnResult(posix_spawn(&pid, command_.c_str(), &file_actions_,
+                                 nullptr, argv_ptrs_.data(), envp_ptrs_.data()),
+                     "posix_spawn");
+    return pid;
   }
-  argv_ptrs.push_back(nullptr);
 
-  for (const auto& [key, value] : env) {
-    envp_buf.emplace_back(utils::StrCat(key, "=", value));
-    // NOLINTNEXTLINE(cppcoreguidelines-pro-type-const-cast)
-    envp_ptrs.push_back(const_cast<char*>(envp_buf.back().c_str()));
+ private:
+  static void CheckSpawnResult(int result, const char* context) {
+    if (result != 0) {
+      throw std::system_error(result, std::generic_category(), context);
+    }
   }
-  envp_ptrs.push_back(nullptr);
 
-  utils::CheckSyscall(
-      execve(command.c_str(), argv_ptrs.data(), envp_ptrs.data()), "execve");
-}
+  const std::string& command_;
+  std::vector<char*> argv_ptrs_;
+  std::vector<std::string> envp_buf_;
+  std::vector<char*> envp_ptrs_;
+  posix_spawn_file_actions_t file_actions_{};
+};
 
 }  // namespace
 
@@ -85,47 +120,39 @@ ChildProcess ProcessStarter::Exec(
   Promise<ChildProcess> promise;
   auto future = promise.get_future();
 
+  // arguments are prepared here to keep the ev thread work minimal
+  const Spawner spawner{command, args, env, stdout_file, stderr_file};
+  const auto keys =
+      env | boost::adaptors::transformed([](const auto& key_value) {
+        return key_value.first;
+      });
+  LOG_DEBUG() << fmt::format(
+      "do posix_spawn(), command={}, args=[\'{}\'], env=[{}]", command,
+      fmt::join(args, "' '"), fmt::join(keys, ", "));
+
   thread_control_.RunInEvLoopAsync([&, promise = std::move(promise)]() mutable {
-    const auto keys =
-        env | boost::adaptors::transformed([](const auto& key_value) {
-          return key_value.first + '=' + key_value.second;
-        });
-    LOG_DEBUG() << fmt::format(
-        "do fork() + execve(), command={}, args=[\'{}\'], env=[]",
-        fmt::join(args, "' '"), fmt::join(keys, ", "));
-
-    const auto pid = utils::CheckSyscall(fork(), "fork");
-    if (pid) {
-      // in parent thread
-      span.AddTag("child-process-pid", pid);
-      LOG_DEBUG() << "Started child process with pid=" << pid;
-      Promise<ChildProcessStatus> exec_result_promise;
-      auto res = ChildProcessMapSet(
-          pid, ev::ChildProcessMapValue(std::move(exec_result_promise)));
-      if (res.second) {
-        promise.set_value(ChildProcess{
-            ChildProcessImpl{pid, res.first->status_promise.get_future()}});
-      } else {
-        const auto msg = fmt::format(
-            "process with pid={} already exists in child_process_map", pid);
-        LOG_ERROR() << msg << ", send SIGKILL";
-        ChildProcessImpl(pid, Future<ChildProcessStatus>{}).SendSignal(SIGKILL);
-        promise.set_exception(std::make_exception_ptr(std::runtime_error(msg)));
-      }
+    pid_t pid{};
+    try {
+      pid = spawner.Spawn();
+    } catch (const std::exception&) {
+      promise.set_exception(std::current_exception());
+      return;
+    }
+
+    span.AddTag("child-process-pid", pid);
+    LOG_DEBUG() << "Started child process with pid=" << pid;
+    Promise<ChildProcessStatus> exec_result_promise;
+    auto res = ChildProcessMapSet(
+        pid, ev::ChildProcessMapValue(std::move(exec_result_promise)));
+    if (res.second) {
+      promise.set_value(ChildProcess{
+          ChildProcessImpl{pid, res.first->status_promise.get_future()}});
     } else {
-      // in child thread
-      try {
-        try {
-          DoExecve(command, args, env, stdout_file, stderr_file);
-        } catch (const std::exception& ex) {
-          std::cerr << "Cannot execute child: " << ex.what();
-        }
-      } catch (...) {
-        // must not do anything in a child
-        std::abort();
-      }
-      // on success execve does not return
-      std::abort();
+      const auto msg = fmt::format(
+          "process with pid={} already exists in child_process_map", pid);
+      LOG_ERROR() << msg << ", send SIGKILL";
+      ChildProcessImpl(pid, Future<ChildProcessStatus>{}).SendSignal(SIGKILL);
+      promise.set_exception(std::make_exception_ptr(std::runtime_error(msg)));
     }
   });
 
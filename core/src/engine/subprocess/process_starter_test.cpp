@@ -23,6 +23,7 @@
 #include <userver/engine/subprocess/process_starter.hpp>
 #include <userver/engine/task/task.hpp>
 #include <userver/fs/blocking/file_descriptor.hpp>
+#include <userver/fs/blocking/read.hpp>
 #include <userver/fs/blocking/temp_file.hpp>
 #include <userver/logging/format.hpp>
 #include <userver/logging/log.hpp>
@@ -66,6 +67,31 @@ UTEST(Subprocess, False) {
   EXPECT_NE(0, status.GetExitCode());
 }
 
+UTEST(Subprocess, MissingExecutable) {
+  engine::subprocess::ProcessStarter starter(
+      engine::current_task::GetTaskProcessor());
+
+  UEXPECT_THROW(starter.Exec("/nonexistent/executable", {}), std::system_error);
+}
+
+UTEST(Subprocess, StdoutFile) {
+  engine::subprocess::ProcessStarter starter(
+      engine::current_task::GetTaskProcessor());
+  const auto file = fs::blocking::TempFile::Create();
+
+  for (const auto* word : {"foo", "bar"}) {
+    auto status = starter.Exec("/bin/echo", {word},
+                               engine::subprocess::EnvironmentVariablesUpdate{{}},
+                               file.GetPath())
+                      .Get();
+    ASSERT_TRUE(status.IsExited());
+    EXPECT_EQ(0, status.GetExitCode());
+  }
+
+  // the file is appended to
+  EXPECT_EQ(fs::blocking::ReadFileContents(file.GetPath()), "foo\nbar\n");
+}
+
 UTEST(Subprocess, CheckLogClosesFds) {
   auto file = fs::blocking::TempFile::Create("/tmp", kLogFilePart);
   auto logger = logging::MakeFileLogger("to_file", file.GetPath(),
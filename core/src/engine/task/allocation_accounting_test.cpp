@@ -0,0 +1,88 @@
+#include <engine/task/task_context.hpp>
+
+#include <string>
+
+#include <gtest/gtest.h>
+
+#include <engine/impl/standalone.hpp>
+#include <engine/task/task_processor_config.hpp>
+#include <userver/engine/sleep.hpp>
+#include <userver/utils/async.hpp>
+#include <userver/utils/function_ref.hpp>
+#include <utils/jemalloc.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+constexpr std::size_t kAllocationSize = 1024 * 1024;
+
+void RunWithAllocationAccounting(utils::function_ref<void()> payload) {
+  engine::TaskProcessorConfig config;
+  config.worker_threads = 1;
+  config.thread_name = "alloc-worker";
+  config.account_allocations = true;
+  engine::impl::RunStandalone(std::move(config), {}, payload);
+}
+
+std::string MakeData() {
+  std::string data(kAllocationSize, 'x');
+  // Prevents the compiler from eliding the allocation
+  auto* ptr = data.data();
+  asm volatile("" : "+rm"(ptr));
+  return data;
+}
+
+bool HasThreadAllocationCounters() {
+  const auto data = MakeData();
+  return utils::jemalloc::GetThreadAllocationCounters().allocated_bytes != 0;
+}
+
+utils::jemalloc::AllocationCounters GetCounters() {
+  return engine::current_task::GetCurrentTaskContext().GetAllocationCounters();
+}
+
+}  // namespace
+
+TEST(AllocationAccounting, Disabled) {
+  engine::impl::RunStandalone(engine::TaskProcessorConfig{}, {}, [] {
+    const auto data = MakeData();
+    engine::Yield();
+    EXPECT_EQ(GetCounters().allocated_bytes, 0U);
+    EXPECT_EQ(GetCounters().deallocated_bytes, 0U);
+  });
+}
+
+TEST(AllocationAccounting, AcrossContextSwitches) {
+  if (!HasThreadAllocationCounters()) GTEST_SKIP() << "Requires jemalloc";
+
+  RunWithAllocationAccounting([] {
+    const auto start = GetCounters();
+    {
+      const auto first = MakeData();
+      engine::Yield();
+      const auto second = MakeData();
+      engine::Yield();
+      EXPECT_GE(GetCounters().allocated_bytes - start.allocated_bytes,
+                2 * kAllocationSize);
+    }
+    EXPECT_GE(GetCounters().deallocated_bytes - start.deallocated_bytes,
+              2 * kAllocationSize);
+  });
+}
+
+TEST(AllocationAccounting, OtherTasksExcluded) {
+  if (!HasThreadAllocationCounters()) GTEST_SKIP() << "Requires jemalloc";
+
+  RunWithAllocationAccounting([] {
+    const auto start = GetCounters();
+    utils::Async("allocate", [] {
+      const auto data = MakeData();
+      EXPECT_GE(GetCounters().allocated_bytes, kAllocationSize);
+    }).Get();
+    EXPECT_LT(GetCounters().allocated_bytes - start.allocated_bytes,
+              kAllocationSize);
+  });
+}
+
+USERVER_NAMESPACE_END
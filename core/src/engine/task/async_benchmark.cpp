@@ -3,7 +3,10 @@
 #include <array>
 #include <thread>
 
+#include <engine/impl/standalone.hpp>
+#include <engine/task/task_processor_config.hpp>
 #include <userver/engine/async.hpp>
+#include <userver/engine/get_all.hpp>
 #include <userver/engine/impl/task_local_storage.hpp>
 #include <userver/engine/run_standalone.hpp>
 #include <userver/utils/async.hpp>
@@ -44,6 +47,25 @@ void async_comparisons_coro(benchmark::State& state) {
 }
 BENCHMARK(async_comparisons_coro)->RangeMultiplier(2)->Range(1, 32);
 
+void async_comparisons_coro_work_stealing(benchmark::State& state) {
+  engine::TaskProcessorConfig config;
+  config.worker_threads = state.range(0);
+  config.thread_name = "bench-worker";
+  config.task_processor_queue = engine::TaskQueueType::kWorkStealingTaskQueue;
+
+  engine::impl::RunStandalone(std::move(config), {}, [&] {
+    std::uint64_t constructed_joined_count = 0;
+    for ([[maybe_unused]] auto _ : state) {
+      engine::AsyncNoSpan([] {}).Wait();
+      ++constructed_joined_count;
+    }
+    benchmark::DoNotOptimize(constructed_joined_count);
+  });
+}
+BENCHMARK(async_comparisons_coro_work_stealing)
+    ->RangeMultiplier(2)
+    ->Range(1, 32);
+
 void wrap_call_single(benchmark::State& state) {
   engine::RunStandalone([&] {
     for ([[maybe_unused]] auto _ : state) {
@@ -99,4 +121,32 @@ void async_comparisons_coro_spanned(benchmark::State& state) {
 }
 BENCHMARK(async_comparisons_coro_spanned)->RangeMultiplier(2)->Range(1, 32);
 
+void async_fan_out_loop(benchmark::State& state) {
+  engine::RunStandalone(4, [&] {
+    const std::vector<int> requests(state.range(0));
+    for ([[maybe_unused]] auto _ : state) {
+      std::vector<engine::TaskWithResult<int>> tasks;
+      tasks.reserve(requests.size());
+      for (const auto request : requests) {
+        tasks.push_back(utils::Async("", [](int x) { return x; }, request));
+      }
+      benchmark::DoNotOptimize(engine::GetAll(tasks));
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+  });
+}
+BENCHMARK(async_fan_out_loop)->RangeMultiplier(10)->Range(10, 1000);
+
+void async_fan_out_batch(benchmark::State& state) {
+  engine::RunStandalone(4, [&] {
+    const std::vector<int> requests(state.range(0));
+    for ([[maybe_unused]] auto _ : state) {
+      auto tasks = utils::AsyncBatch("", requests, [](int x) { return x; });
+      benchmark::DoNotOptimize(engine::GetAll(tasks));
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+  });
+}
+BENCHMARK(async_fan_out_batch)->RangeMultiplier(10)->Range(10, 1000);
+
 USERVER_NAMESPACE_END
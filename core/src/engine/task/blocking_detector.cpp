@@ -0,0 +1,195 @@
+#include <engine/task/blocking_detector.hpp>
+
+#include <execinfo.h>
+#include <signal.h>
+
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <string_view>
+
+#include <boost/stacktrace/stacktrace.hpp>
+
+#include <engine/task/task_context.hpp>
+#include <userver/logging/log.hpp>
+#include <userver/logging/log_extra.hpp>
+#include <userver/logging/stacktrace_cache.hpp>
+#include <userver/utils/assert.hpp>
+#include <userver/utils/thread_name.hpp>
+#include <utils/check_syscall.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace engine::impl {
+
+namespace {
+
+// Ignored by default, so a late signal can do no harm
+constexpr int kCaptureSignal = SIGURG;
+
+constexpr std::chrono::milliseconds kMinCheckPeriod{1};
+constexpr std::chrono::milliseconds kMaxCheckPeriod{1000};
+constexpr std::chrono::milliseconds kCaptureTimeout{10};
+
+// Used by the signal handler, so it may not be a compiler::ThreadLocal
+thread_local BlockingDetector::Worker* local_worker = nullptr;
+
+std::int64_t Now() noexcept {
+  return std::chrono::duration_cast<std::chrono::nanoseconds>(
+             std::chrono::steady_clock::now().time_since_epoch())
+      .count();
+}
+
+void OnCaptureSignal(int) {
+  using Worker = BlockingDetector::Worker;
+
+  const auto saved_errno = errno;
+  auto* worker = local_worker;
+  if (worker && worker->is_capture_requested.exchange(false)) {
+    worker->frames_count = ::backtrace(worker->frames, Worker::kMaxFrames);
+
+    worker->span_name_size = 0;
+    if (auto* context = current_task::GetCurrentTaskContextUnchecked()) {
+      const auto span_name = context->GetSpanNameForProfiler();
+      worker->span_name_size =
+          std::min(span_name.size(), Worker::kMaxSpanNameSize);
+      std::memcpy(worker->span_name, span_name.data(), worker->span_name_size);
+    }
+    worker->is_capture_done.store(true, std::memory_order_release);
+  }
+  errno = saved_errno;
+}
+
+void InstallSignalHandler() {
+  static const bool kInstalled = [] {
+    struct sigaction action {};
+    action.sa_handler = &OnCaptureSignal;
+    action.sa_flags = SA_RESTART;
+    utils::CheckSyscall(sigemptyset(&action.sa_mask),
+                        "initializing signal set");
+    utils::CheckSyscall(sigaction(kCaptureSignal, &action, nullptr),
+                        "setting the blocking detector signal handler");
+    // The first call loads the unwinder and is not async-signal-safe
+    void* frame = nullptr;
+    ::backtrace(&frame, 1);
+    return true;
+  }();
+  static_cast<void>(kInstalled);
+}
+
+bool WaitForCapture(const BlockingDetector::Worker& worker) {
+  const auto deadline = std::chrono::steady_clock::now() + kCaptureTimeout;
+  while (!worker.is_capture_done.load(std::memory_order_acquire)) {
+    if (std::chrono::steady_clock::now() > deadline) return false;
+    std::this_thread::sleep_for(std::chrono::microseconds{100});
+  }
+  return true;
+}
+
+}  // namespace
+
+BlockingDetector::BlockingDetector(std::string task_processor_name,
+                                   std::size_t thread_count,
+                                   std::chrono::microseconds threshold)
+    : task_processor_name_(std::move(task_processor_name)),
+      threshold_(threshold),
+      workers_(thread_count) {
+  UASSERT(threshold_.count() > 0);
+  InstallSignalHandler();
+  watchdog_ = std::thread([this] {
+    utils::SetCurrentThreadName("blocking-watch");
+    Run();
+  });
+}
+
+BlockingDetector::~BlockingDetector() {
+  {
+    const std::lock_guard lock{mutex_};
+    is_stopping_ = true;
+  }
+  stop_cv_.notify_all();
+  watchdog_.join();
+}
+
+void BlockingDetector::RegisterThread(std::size_t thread_index) noexcept {
+  auto& worker = *workers_[thread_index];
+  worker.thread = ::pthread_self();
+  worker.is_registered.store(true, std::memory_order_release);
+  local_worker = &worker;
+}
+
+void BlockingDetector::StartSlice() noexcept {
+  UASSERT(local_worker);
+  local_worker->slice_started.store(Now(), std::memory_order_release);
+}
+
+void BlockingDetector::StopSlice() noexcept {
+  UASSERT(local_worker);
+  local_worker->slice_started.store(0, std::memory_order_release);
+}
+
+std::uint64_t BlockingDetector::GetLongSlices() const noexcept {
+  return long_slices_.load(std::memory_order_relaxed);
+}
+
+void BlockingDetector::Run() {
+  const auto check_period = std::clamp<std::chrono::microseconds>(
+      threshold_ / 2, kMinCheckPeriod, kMaxCheckPeriod);
+
+  std::unique_lock lock{mutex_};
+  while (!stop_cv_.wait_for(lock, check_period,
+                            [this] { return is_stopping_; })) {
+    const auto now = Now();
+    for (std::size_t i = 0; i < workers_.size(); ++i) {
+      Check(*workers_[i], i, now);
+    }
+  }
+}
+
+void BlockingDetector::Check(Worker& worker, std::size_t thread_index,
+                             std::int64_t now) {
+  if (!worker.is_registered.load(std::memory_order_acquire)) return;
+
+  const auto slice_started =
+      worker.slice_started.load(std::memory_order_acquire);
+  if (slice_started == 0 || slice_started == worker.reported_slice) return;
+
+  const std::chrono::nanoseconds slice_duration{now - slice_started};
+  if (slice_duration < threshold_) return;
+
+  worker.reported_slice = slice_started;
+  long_slices_.fetch_add(1, std::memory_order_relaxed);
+
+  worker.is_capture_done.store(false, std::memory_order_relaxed);
+  worker.is_capture_requested.store(true, std::memory_order_release);
+  const bool is_captured =
+      ::pthread_kill(worker.thread, kCaptureSignal) == 0 &&
+      WaitForCapture(worker) &&
+      // The stack belongs to another slice otherwise
+      worker.slice_started.load(std::memory_order_acquire) == slice_started;
+  worker.is_capture_requested.store(false, std::memory_order_relaxed);
+
+  logging::LogExtra extra;
+  extra.Extend("task_processor", task_processor_name_);
+  extra.Extend("worker_index", thread_index);
+  if (is_captured) {
+    extra.Extend("span_name",
+                 std::string{worker.span_name, worker.span_name_size});
+    extra.Extend("stacktrace",
+                 logging::stacktrace_cache::to_string(
+                     boost::stacktrace::stacktrace::from_dump(
+                         worker.frames, worker.frames_count * sizeof(void*))));
+  }
+
+  LOG_ERROR() << "A task has been running for "
+              << std::chrono::duration_cast<std::chrono::milliseconds>(
+                     slice_duration)
+                     .count()
+              << "ms without a context switch, the worker thread is likely "
+                 "blocked by a syscall or a non-coroutine mutex"
+              << extra;
+}
+
+}  // namespace engine::impl
+
+USERVER_NAMESPACE_END
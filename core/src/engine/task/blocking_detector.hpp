@@ -0,0 +1,86 @@
+#pragma once
+
+#include <pthread.h>
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <thread>
+
+#include <userver/concurrent/impl/interference_shield.hpp>
+#include <userver/utils/fixed_array.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace engine::impl {
+
+/// @brief Watchdog that detects the worker threads of a TaskProcessor that
+/// have been running the same task without a context switch for too long.
+///
+/// Such a task is likely blocked in a syscall or on a non-coroutine
+/// synchronization primitive. The stack of the worker is captured at the
+/// moment of detection with a signal and is logged along with the current
+/// span name of the task.
+class BlockingDetector final {
+ public:
+  BlockingDetector(std::string task_processor_name, std::size_t thread_count,
+                   std::chrono::microseconds threshold);
+
+  BlockingDetector(const BlockingDetector&) = delete;
+  BlockingDetector& operator=(const BlockingDetector&) = delete;
+  ~BlockingDetector();
+
+  // Must be called from each worker thread before it starts processing tasks
+  void RegisterThread(std::size_t thread_index) noexcept;
+
+  // Must be called from a thread bound with RegisterThread
+  void StartSlice() noexcept;
+  void StopSlice() noexcept;
+
+  /// Number of the detected execution slices that exceeded the threshold
+  std::uint64_t GetLongSlices() const noexcept;
+
+  // Shared between the worker thread, its signal handler and the watchdog
+  struct Worker final {
+    static constexpr std::size_t kMaxFrames = 64;
+    static constexpr std::size_t kMaxSpanNameSize = 64;
+
+    std::atomic<bool> is_registered{false};
+    pthread_t thread{};
+
+    // steady_clock time in nanoseconds, 0 if no task is running
+    std::atomic<std::int64_t> slice_started{0};
+
+    // Only used by the watchdog, not to report a slice twice
+    std::int64_t reported_slice{0};
+
+    std::atomic<bool> is_capture_requested{false};
+    std::atomic<bool> is_capture_done{false};
+    int frames_count{0};
+    void* frames[kMaxFrames]{};
+    std::size_t span_name_size{0};
+    char span_name[kMaxSpanNameSize]{};
+  };
+
+ private:
+  void Run();
+  void Check(Worker& worker, std::size_t thread_index, std::int64_t now);
+
+  const std::string task_processor_name_;
+  const std::chrono::microseconds threshold_;
+  utils::FixedArray<concurrent::impl::InterferenceShield<Worker>> workers_;
+  std::atomic<std::uint64_t> long_slices_{0};
+
+  std::mutex mutex_;
+  std::condition_variable stop_cv_;
+  bool is_stopping_{false};
+  std::thread watchdog_;
+};
+
+}  // namespace engine::impl
+
+USERVER_NAMESPACE_END
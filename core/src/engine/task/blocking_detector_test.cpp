@@ -0,0 +1,66 @@
+#include <engine/task/blocking_detector.hpp>
+
+#include <chrono>
+#include <thread>
+
+#include <gtest/gtest.h>
+
+#include <engine/impl/standalone.hpp>
+#include <engine/task/task_processor.hpp>
+#include <engine/task/task_processor_config.hpp>
+#include <userver/engine/sleep.hpp>
+#include <userver/engine/task/task.hpp>
+#include <userver/utils/async.hpp>
+#include <userver/utils/function_ref.hpp>
+
+using namespace std::chrono_literals;
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+void RunWithBlockingDetector(utils::function_ref<void()> payload) {
+  engine::TaskProcessorConfig config;
+  config.worker_threads = 1;
+  config.thread_name = "blocking-worker";
+  config.blocking_detector_threshold = 20ms;
+  engine::impl::RunStandalone(std::move(config), {}, payload);
+}
+
+const engine::impl::BlockingDetector& GetDetector() {
+  const auto* detector =
+      engine::current_task::GetTaskProcessor().GetBlockingDetector();
+  EXPECT_TRUE(detector);
+  return *detector;
+}
+
+}  // namespace
+
+TEST(BlockingDetector, Disabled) {
+  engine::impl::RunStandalone(engine::TaskProcessorConfig{}, {}, [] {
+    const auto& task_processor = engine::current_task::GetTaskProcessor();
+    EXPECT_FALSE(task_processor.GetBlockingDetector());
+  });
+}
+
+TEST(BlockingDetector, DetectsBlockingCall) {
+  RunWithBlockingDetector([] {
+    utils::Async("blocker", [] {
+      // NOLINTNEXTLINE(concurrency-mt-unsafe)
+      std::this_thread::sleep_for(200ms);
+    }).Get();
+
+    // The slice is reported once, however long it is
+    EXPECT_EQ(GetDetector().GetLongSlices(), 1);
+  });
+}
+
+TEST(BlockingDetector, IgnoresSuspendedTasks) {
+  RunWithBlockingDetector([] {
+    utils::Async("sleeper", [] { engine::SleepFor(200ms); }).Get();
+
+    EXPECT_EQ(GetDetector().GetLongSlices(), 0);
+  });
+}
+
+USERVER_NAMESPACE_END
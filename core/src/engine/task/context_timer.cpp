@@ -7,6 +7,7 @@
 #include <userver/utils/assert.hpp>
 
 #include <engine/ev/data_pipe_to_ev.hpp>
+#include <engine/ev/timer_wheel.hpp>
 #include <engine/task/task_context.hpp>
 
 USERVER_NAMESPACE_BEGIN
@@ -38,7 +39,8 @@ class TimerArmer : public ev::MultiShotAsyncPayload<TimerArmer<Derived>> {
 
 // NOLINTNEXTLINE(fuchsia-multiple-inheritance)
 class ContextTimer::Impl final : public TimerArmer<Impl>,
-                                 public Finalizer<Impl> {
+                                 public Finalizer<Impl>,
+                                 public ev::TimerWheelEntry {
  public:
   struct Params {
     Action action{};
@@ -61,6 +63,8 @@ class ContextTimer::Impl final : public TimerArmer<Impl>,
   void DoArmTimerInEvThread();
   void DoFinalizeInEvThread();
 
+  void OnTimerWheelExpired() noexcept override;
+
  private:
   void StopTimerInEvThread() noexcept;
 
@@ -84,6 +88,7 @@ ContextTimer::Impl::Impl() {
 ContextTimer::Impl::~Impl() {
   // NOLINTNEXTLINE(cppcoreguidelines-pro-type-cstyle-cast)
   UASSERT(!ev_is_active(&timer_));
+  UASSERT(!IsScheduled());
 }
 
 bool ContextTimer::Impl::WasStarted() const noexcept {
@@ -136,20 +141,25 @@ void ContextTimer::Impl::DoArmTimerInEvThread() {
 
   params_ = std::move(*params);
 
+  UASSERT(thread_control_);
   using LibEvDuration = std::chrono::duration<double>;
-  const auto time_left =
-      std::chrono::duration_cast<LibEvDuration>(params_.deadline.TimeLeft())
-          .count();
+  const auto time_left = params_.deadline.TimeLeft();
+  const auto time_left_seconds =
+      std::chrono::duration_cast<LibEvDuration>(time_left).count();
 
-  LOG_TRACE() << "time_left=" << time_left;
-  if (time_left <= 0.0) {
+  LOG_TRACE() << "time_left=" << time_left_seconds;
+  if (time_left_seconds <= 0.0) {
     // Optimization for small deadlines or high load
     DoOnTimer();
     return;
   }
 
-  timer_.repeat = time_left;
-  UASSERT(thread_control_);
+  if (auto* const timer_wheel = thread_control_->GetTimerWheel()) {
+    timer_wheel->Schedule(*this, ev::TimerWheel::Clock::now() + time_left);
+    return;
+  }
+
+  timer_.repeat = time_left_seconds;
   thread_control_->Again(timer_);
 }
 
@@ -170,7 +180,11 @@ void ContextTimer::Impl::InvokeTimerFunction(const Params& params,
 
 void ContextTimer::Impl::StopTimerInEvThread() noexcept {
   UASSERT(!engine::current_task::IsTaskProcessorThread());
-  thread_control_->Stop(timer_);
+  if (thread_control_->GetTimerWheel()) {
+    ev::TimerWheel::Cancel(*this);
+  } else {
+    thread_control_->Stop(timer_);
+  }
 }
 
 void ContextTimer::Impl::DoFinalizeInEvThread() {
@@ -193,6 +207,8 @@ void ContextTimer::Impl::OnTimer(struct ev_loop*, ev_timer* w, int) noexcept {
   ev_timer->DoOnTimer();
 }
 
+void ContextTimer::Impl::OnTimerWheelExpired() noexcept { DoOnTimer(); }
+
 void ContextTimer::Impl::DoOnTimer() {
   UASSERT(!engine::current_task::IsTaskProcessorThread());
 
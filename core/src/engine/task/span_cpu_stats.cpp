@@ -0,0 +1,139 @@
+#include <engine/task/span_cpu_stats.hpp>
+
+#include <time.h>
+
+#include <algorithm>
+
+#include <userver/compiler/thread_local.hpp>
+#include <userver/utils/assert.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace engine::impl {
+
+namespace {
+
+struct LocalSpanCpuStatsData final {
+  SpanCpuStatsStorage* storage{nullptr};
+  std::size_t thread_index{};
+};
+
+compiler::ThreadLocal local_span_cpu_stats_data = [] {
+  return LocalSpanCpuStatsData{};
+};
+
+}  // namespace
+
+SpanCpuStatsStorage::SpanCpuStatsStorage(std::size_t thread_count,
+                                         std::size_t top_size)
+    : top_size_(top_size), shards_(thread_count) {
+  UASSERT(top_size_ > 0);
+}
+
+void SpanCpuStatsStorage::AccountCpuTime(std::string_view name,
+                                         std::chrono::nanoseconds cpu_time) {
+  if (cpu_time <= std::chrono::nanoseconds::zero()) return;
+
+  auto& shard = GetLocalShard();
+  // Only contended while the statistics are being collected
+  const std::lock_guard lock{shard.mutex};
+  GetStats(shard, name).cpu_time += cpu_time;
+}
+
+void SpanCpuStatsStorage::AccountRun(std::string_view name,
+                                     std::chrono::nanoseconds cpu_time,
+                                     std::chrono::nanoseconds run_time) {
+  auto& shard = GetLocalShard();
+  const std::lock_guard lock{shard.mutex};
+  auto& stats = GetStats(shard, name);
+  if (cpu_time > std::chrono::nanoseconds::zero()) stats.cpu_time += cpu_time;
+  stats.max_run_time = std::max(stats.max_run_time, run_time);
+  ++stats.runs;
+}
+
+std::vector<NamedSpanCpuStats> SpanCpuStatsStorage::GetTopByCpuTime() const {
+  return GetTop([](const SpanCpuStats& lhs, const SpanCpuStats& rhs) {
+    return lhs.cpu_time < rhs.cpu_time;
+  });
+}
+
+std::vector<NamedSpanCpuStats> SpanCpuStatsStorage::GetTopByMaxRunTime()
+    const {
+  return GetTop([](const SpanCpuStats& lhs, const SpanCpuStats& rhs) {
+    return lhs.max_run_time < rhs.max_run_time;
+  });
+}
+
+SpanCpuStatsStorage::Shard& SpanCpuStatsStorage::GetLocalShard() noexcept {
+  auto local_data = local_span_cpu_stats_data.Use();
+  UASSERT(local_data->storage == this);
+  return *shards_[local_data->thread_index];
+}
+
+SpanCpuStats& SpanCpuStatsStorage::GetStats(Shard& shard,
+                                            std::string_view name) {
+  if (name.empty()) name = kNoSpanName;
+
+  if (auto* stats = utils::impl::FindTransparentOrNullptr(shard.stats, name)) {
+    return *stats;
+  }
+  if (shard.stats.size() >= kMaxNamesPerThread) {
+    name = kOverflowName;
+    if (auto* stats =
+            utils::impl::FindTransparentOrNullptr(shard.stats, name)) {
+      return *stats;
+    }
+  }
+  return shard.stats[std::string{name}];
+}
+
+std::vector<NamedSpanCpuStats> SpanCpuStatsStorage::Collect() const {
+  utils::impl::TransparentMap<std::string, SpanCpuStats> merged;
+  for (const auto& shard : shards_) {
+    const std::lock_guard lock{shard->mutex};
+    for (const auto& [name, stats] : shard->stats) {
+      auto& merged_stats = merged[name];
+      merged_stats.cpu_time += stats.cpu_time;
+      merged_stats.max_run_time =
+          std::max(merged_stats.max_run_time, stats.max_run_time);
+      merged_stats.runs += stats.runs;
+    }
+  }
+
+  std::vector<NamedSpanCpuStats> result;
+  result.reserve(merged.size());
+  for (auto& [name, stats] : merged) result.push_back({name, stats});
+  return result;
+}
+
+std::vector<NamedSpanCpuStats> SpanCpuStatsStorage::GetTop(
+    bool (*less)(const SpanCpuStats&, const SpanCpuStats&)) const {
+  auto result = Collect();
+  const auto top_size = std::min(top_size_, result.size());
+  std::partial_sort(
+      result.begin(), result.begin() + top_size, result.end(),
+      [less](const NamedSpanCpuStats& lhs, const NamedSpanCpuStats& rhs) {
+        return less(rhs.stats, lhs.stats);
+      });
+  result.resize(top_size);
+  return result;
+}
+
+void SetLocalSpanCpuStatsStorage(SpanCpuStatsStorage& storage,
+                                 std::size_t thread_index) {
+  auto local_data = local_span_cpu_stats_data.Use();
+  *local_data = {&storage, thread_index};
+}
+
+std::chrono::nanoseconds GetCurrentThreadCpuTime() noexcept {
+  struct timespec ts {};
+  if (::clock_gettime(CLOCK_THREAD_CPUTIME_ID, &ts) != 0) {
+    // Shouldn't really happen
+    return {};
+  }
+  return std::chrono::seconds{ts.tv_sec} + std::chrono::nanoseconds{ts.tv_nsec};
+}
+
+}  // namespace engine::impl
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,96 @@
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <userver/concurrent/impl/interference_shield.hpp>
+#include <userver/utils/fixed_array.hpp>
+#include <userver/utils/impl/transparent_hash.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace engine::impl {
+
+struct SpanCpuStats final {
+  // CPU time consumed by tasks while the span was the current one
+  std::chrono::nanoseconds cpu_time{0};
+
+  // The longest CPU time consumed by a task between two context switches,
+  // attributed to the span that was current at the context switch
+  std::chrono::nanoseconds max_run_time{0};
+
+  // Number of execution slices that ended within the span
+  std::uint64_t runs{0};
+};
+
+struct NamedSpanCpuStats final {
+  std::string name;
+  SpanCpuStats stats;
+};
+
+/// @brief CPU time consumed by the tasks of a TaskProcessor, grouped by the
+/// name of the current tracing::Span.
+///
+/// Each worker thread accounts into its own shard, shards are merged on
+/// statistics collection.
+class SpanCpuStatsStorage final {
+ public:
+  // Name for the CPU time consumed by tasks outside of any span
+  static constexpr std::string_view kNoSpanName = "<no-span>";
+
+  // Name for the CPU time of the spans that did not fit into the shard
+  static constexpr std::string_view kOverflowName = "<other>";
+
+  // Limits the memory consumption in case there are spans with unique names
+  static constexpr std::size_t kMaxNamesPerThread = 1000;
+
+  SpanCpuStatsStorage(std::size_t thread_count, std::size_t top_size);
+
+  // Must be called from a thread bound with SetLocalSpanCpuStatsStorage
+  void AccountCpuTime(std::string_view name, std::chrono::nanoseconds cpu_time);
+
+  // Must be called from a thread bound with SetLocalSpanCpuStatsStorage
+  void AccountRun(std::string_view name, std::chrono::nanoseconds cpu_time,
+                  std::chrono::nanoseconds run_time);
+
+  /// Up to `top_size` spans with the most consumed CPU time, sorted
+  std::vector<NamedSpanCpuStats> GetTopByCpuTime() const;
+
+  /// Up to `top_size` spans with the longest runs without a context switch,
+  /// sorted
+  std::vector<NamedSpanCpuStats> GetTopByMaxRunTime() const;
+
+ private:
+  struct Shard final {
+    mutable std::mutex mutex;
+    utils::impl::TransparentMap<std::string, SpanCpuStats> stats;
+  };
+
+  Shard& GetLocalShard() noexcept;
+
+  // Must be called with the `shard.mutex` locked
+  static SpanCpuStats& GetStats(Shard& shard, std::string_view name);
+
+  std::vector<NamedSpanCpuStats> Collect() const;
+
+  std::vector<NamedSpanCpuStats> GetTop(
+      bool (*less)(const SpanCpuStats&, const SpanCpuStats&)) const;
+
+  const std::size_t top_size_;
+  utils::FixedArray<concurrent::impl::InterferenceShield<Shard>> shards_;
+};
+
+void SetLocalSpanCpuStatsStorage(SpanCpuStatsStorage& storage,
+                                 std::size_t thread_index);
+
+// CPU time consumed by the current thread
+std::chrono::nanoseconds GetCurrentThreadCpuTime() noexcept;
+
+}  // namespace engine::impl
+
+USERVER_NAMESPACE_END
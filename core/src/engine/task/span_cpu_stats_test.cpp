@@ -0,0 +1,117 @@
+#include <engine/task/span_cpu_stats.hpp>
+
+#include <chrono>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <engine/impl/standalone.hpp>
+#include <engine/task/task_processor.hpp>
+#include <engine/task/task_processor_config.hpp>
+#include <userver/engine/sleep.hpp>
+#include <userver/engine/task/task.hpp>
+#include <userver/tracing/span.hpp>
+#include <userver/utils/async.hpp>
+#include <userver/utils/function_ref.hpp>
+
+using namespace std::chrono_literals;
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+constexpr std::size_t kTopSize = 2;
+
+void RunWithSpanCpuStats(utils::function_ref<void()> payload) {
+  engine::TaskProcessorConfig config;
+  config.worker_threads = 1;
+  config.thread_name = "span-cpu-worker";
+  config.span_cpu_stats_top_size = kTopSize;
+  engine::impl::RunStandalone(std::move(config), {}, payload);
+}
+
+void BurnCpu(std::chrono::nanoseconds duration) {
+  const auto start = engine::impl::GetCurrentThreadCpuTime();
+  while (engine::impl::GetCurrentThreadCpuTime() - start < duration) {
+  }
+}
+
+const engine::impl::SpanCpuStatsStorage& GetStorage() {
+  const auto* storage =
+      engine::current_task::GetTaskProcessor().GetSpanCpuStats();
+  EXPECT_TRUE(storage);
+  return *storage;
+}
+
+std::vector<std::string> GetNames(
+    const std::vector<engine::impl::NamedSpanCpuStats>& top) {
+  std::vector<std::string> names;
+  for (const auto& entry : top) names.push_back(entry.name);
+  return names;
+}
+
+}  // namespace
+
+TEST(SpanCpuStats, Disabled) {
+  engine::impl::RunStandalone(engine::TaskProcessorConfig{}, {}, [] {
+    EXPECT_FALSE(engine::current_task::GetTaskProcessor().GetSpanCpuStats());
+  });
+}
+
+TEST(SpanCpuStats, TopByCpuTime) {
+  RunWithSpanCpuStats([] {
+    utils::Async("light", [] { BurnCpu(1ms); }).Get();
+    utils::Async("heavy", [] {
+      for (int i = 0; i < 10; ++i) {
+        BurnCpu(2ms);
+        engine::Yield();
+      }
+    }).Get();
+    utils::Async("medium", [] { BurnCpu(5ms); }).Get();
+
+    const auto top = GetStorage().GetTopByCpuTime();
+    ASSERT_EQ(GetNames(top), (std::vector<std::string>{"heavy", "medium"}));
+    EXPECT_GE(top[0].stats.cpu_time, 20ms);
+    EXPECT_GE(top[0].stats.runs, 10);
+  });
+}
+
+TEST(SpanCpuStats, TopByMaxRunTime) {
+  RunWithSpanCpuStats([] {
+    utils::Async("yielding", [] {
+      for (int i = 0; i < 10; ++i) {
+        BurnCpu(1ms);
+        engine::Yield();
+      }
+    }).Get();
+    utils::Async("hog", [] { BurnCpu(5ms); }).Get();
+
+    const auto top = GetStorage().GetTopByMaxRunTime();
+    ASSERT_FALSE(top.empty());
+    EXPECT_EQ(top[0].name, "hog");
+    EXPECT_GE(top[0].stats.max_run_time, 5ms);
+  });
+}
+
+TEST(SpanCpuStats, NestedSpans) {
+  RunWithSpanCpuStats([] {
+    utils::Async("outer", [] {
+      BurnCpu(1ms);
+      {
+        tracing::Span inner{"inner"};
+        BurnCpu(10ms);
+      }
+      BurnCpu(1ms);
+    }).Get();
+
+    // The CPU time of the nested span is not attributed to the outer one
+    const auto top = GetStorage().GetTopByCpuTime();
+    ASSERT_EQ(GetNames(top), (std::vector<std::string>{"inner", "outer"}));
+    EXPECT_GE(top[0].stats.cpu_time, 10ms);
+    EXPECT_GE(top[1].stats.cpu_time, 2ms);
+    EXPECT_LT(top[1].stats.cpu_time, 10ms);
+  });
+}
+
+USERVER_NAMESPACE_END
@@ -2,9 +2,12 @@
 
 #include <atomic>
 #include <thread>
+#include <vector>
 
 #include <engine/impl/standalone.hpp>
+#include <engine/task/task_processor_config.hpp>
 #include <userver/engine/async.hpp>
+#include <userver/engine/co_task.hpp>
 #include <userver/engine/run_standalone.hpp>
 #include <userver/engine/sleep.hpp>
 #include <userver/engine/task/cancel.hpp>
@@ -14,6 +17,25 @@
 
 USERVER_NAMESPACE_BEGIN
 
+namespace {
+
+void RunStandaloneWithQueue(std::size_t worker_threads,
+                            engine::TaskQueueType queue_type,
+                            utils::function_ref<void()> payload) {
+  engine::TaskProcessorConfig config;
+  config.worker_threads = worker_threads;
+  config.thread_name = "bench-worker";
+  config.task_processor_queue = queue_type;
+  engine::impl::RunStandalone(std::move(config), {}, payload);
+}
+
+constexpr auto kGlobalQueue =
+    static_cast<std::int64_t>(engine::TaskQueueType::kGlobalTaskQueue);
+constexpr auto kWorkStealingQueue =
+    static_cast<std::int64_t>(engine::TaskQueueType::kWorkStealingTaskQueue);
+
+}  // namespace
+
 void engine_task_create(benchmark::State& state) {
   // We use 2 threads to ensure that detached tasks are deallocated,
   // otherwise this benchmark OOMs after some time.
@@ -128,4 +150,118 @@ BENCHMARK(engine_multiple_tasks_multiple_threads)
     ->Arg(6)
     ->Arg(12);
 
+// Compares the task queue types on many short tasks spawned from many
+// coroutines, e.g. handlers that spawn subtasks.
+void engine_multiple_tasks_multiple_threads_queue_type(
+    benchmark::State& state) {
+  const auto queue_type = static_cast<engine::TaskQueueType>(state.range(1));
+  RunStandaloneWithQueue(state.range(0), queue_type, [&] {
+    std::atomic<std::uint64_t> tasks_count_total = 0;
+    RunParallelBenchmark(state, [&](auto& range) {
+      std::uint64_t tasks_count = 0;
+      for ([[maybe_unused]] auto _ : range) {
+        engine::AsyncNoSpan([] {}).Wait();
+        tasks_count++;
+      }
+      tasks_count_total += tasks_count;
+      benchmark::DoNotOptimize(tasks_count);
+    });
+    benchmark::DoNotOptimize(tasks_count_total);
+  });
+}
+BENCHMARK(engine_multiple_tasks_multiple_threads_queue_type)
+    ->ArgsProduct({{1, 2, 4, 6, 12, 32}, {kGlobalQueue, kWorkStealingQueue}});
+
+void engine_task_yield_multiple_threads_queue_type(benchmark::State& state) {
+  const auto queue_type = static_cast<engine::TaskQueueType>(state.range(1));
+  RunStandaloneWithQueue(state.range(0), queue_type, [&] {
+    std::atomic<std::uint64_t> total_yields{0};
+
+    RunParallelBenchmark(state, [&](auto& range) {
+      std::uint64_t yields_performed = 0;
+      for ([[maybe_unused]] auto _ : range) {
+        engine::Yield();
+        ++yields_performed;
+      }
+      total_yields += yields_performed;
+    });
+
+    state.counters["yields"] =
+        benchmark::Counter(total_yields, benchmark::Counter::kIsRate);
+  });
+}
+BENCHMARK(engine_task_yield_multiple_threads_queue_type)
+    ->ArgsProduct({{1, 2, 4, 6, 12, 32}, {kGlobalQueue, kWorkStealingQueue}});
+
+void engine_task_fan_out_queue_type(benchmark::State& state) {
+  constexpr std::size_t kSubtasksCount = 16;
+  const auto queue_type = static_cast<engine::TaskQueueType>(state.range(1));
+  RunStandaloneWithQueue(state.range(0), queue_type, [&] {
+    RunParallelBenchmark(state, [&](auto& range) {
+      std::vector<engine::TaskWithResult<void>> subtasks;
+      subtasks.reserve(kSubtasksCount);
+      for ([[maybe_unused]] auto _ : range) {
+        for (std::size_t i = 0; i < kSubtasksCount; ++i) {
+          subtasks.push_back(engine::AsyncNoSpan([] {}));
+        }
+        for (auto& subtask : subtasks) subtask.Wait();
+        subtasks.clear();
+      }
+    });
+  });
+}
+BENCHMARK(engine_task_fan_out_queue_type)
+    ->ArgsProduct({{1, 2, 4, 6, 12, 32}, {kGlobalQueue, kWorkStealingQueue}});
+
+namespace {
+
+constexpr std::size_t kFanOutSubtasksCount = 16;
+
+}  // namespace
+
+void engine_task_fan_out(benchmark::State& state) {
+  engine::RunStandalone(state.range(0), [&] {
+    RunParallelBenchmark(state, [&](auto& range) {
+      std::vector<engine::TaskWithResult<std::size_t>> subtasks;
+      subtasks.reserve(kFanOutSubtasksCount);
+      for ([[maybe_unused]] auto _ : range) {
+        for (std::size_t i = 0; i < kFanOutSubtasksCount; ++i) {
+          subtasks.push_back(engine::AsyncNoSpan([i] { return i; }));
+        }
+        for (auto& subtask : subtasks) benchmark::DoNotOptimize(subtask.Get());
+        subtasks.clear();
+      }
+    });
+  });
+}
+BENCHMARK(engine_task_fan_out)->RangeMultiplier(2)->Range(1, 32);
+
+#if __cpp_impl_coroutine >= 201902L
+
+namespace {
+
+engine::CoTask<std::size_t> CoIdentity(std::size_t value) { co_return value; }
+
+}  // namespace
+
+// Same as engine_task_fan_out, but the subtasks are stackless coroutines
+void engine_co_task_fan_out(benchmark::State& state) {
+  engine::RunStandalone(state.range(0), [&] {
+    RunParallelBenchmark(state, [&](auto& range) {
+      std::vector<engine::CoTaskHandle<std::size_t>> subtasks;
+      subtasks.reserve(kFanOutSubtasksCount);
+      for ([[maybe_unused]] auto _ : range) {
+        for (std::size_t i = 0; i < kFanOutSubtasksCount; ++i) {
+          subtasks.push_back(engine::CoAsync(CoIdentity(i)));
+        }
+        for (auto& subtask : subtasks) benchmark::DoNotOptimize(subtask.Get());
+        subtasks.clear();
+      }
+    });
+  });
+}
+BENCHMARK(engine_co_task_fan_out)->RangeMultiplier(2)->Range(1, 32);
+
+#endif
+
 USERVER_NAMESPACE_END
@@ -1,6 +1,7 @@
 #include "task_context.hpp"
 
 #include <exception>
+#include <optional>
 #include <utility>
 
 #include <fmt/format.h>
@@ -25,6 +26,7 @@
 #include <engine/task/coro_unwinder.hpp>
 #include <engine/task/cxxabi_eh_globals.hpp>
 #include <engine/task/task_processor.hpp>
+#include <utils/cpu_profiler.hpp>
 #include <utils/impl/assert_extra.hpp>
 
 USERVER_NAMESPACE_BEGIN
@@ -108,13 +110,16 @@ auto* const kFinishedDetachedToken =
 }  // namespace
 
 TaskContext::TaskContext(TaskProcessor& task_processor,
-                         Task::Importance importance, Task::WaitMode wait_type,
-                         Deadline deadline,
-                         utils::impl::WrappedCallBase& payload)
+                         Task::Importance importance, Task::Priority priority,
+                         Task::WaitMode wait_type, Deadline deadline,
+                         utils::impl::WrappedCallBase& payload,
+                         std::size_t allocation_size)
     : task_processor_(task_processor),
       task_counter_token_(task_processor_.GetTaskCounter()),
       is_critical_(importance == Task::Importance::kCritical),
+      priority_(priority),
       payload_(&payload),
+      allocation_size_(allocation_size),
       finish_waiters_(wait_type),
       cancel_deadline_(deadline),
       trace_csw_left_(task_processor_.GetTaskTraceMaxCswForNewTask()) {
@@ -319,6 +324,15 @@ TaskContext::WakeupSource TaskContext::Sleep(WaitStrategy& wait_strategy,
                             (!IsCancellable() || deadline < cancel_deadline_);
   if (has_deadline) ArmDeadlineTimer(deadline, sleep_epoch);
 
+  // Only a sample of waits is measured
+  auto* wait_stats = task_processor_.GetWaitStats();
+  std::optional<WaitSite> wait_site;
+  std::chrono::steady_clock::time_point wait_started;
+  if (wait_stats && wait_stats->ShouldSample()) {
+    wait_site.emplace(WaitStatsStorage::CaptureSite());
+    wait_started = std::chrono::steady_clock::now();
+  }
+
   yield_reason_ = YieldReason::kTaskWaiting;
   UASSERT(task_pipe_);
   TraceStateTransition(Task::State::kSuspended);
@@ -337,6 +351,11 @@ TaskContext::WakeupSource TaskContext::Sleep(WaitStrategy& wait_strategy,
   if (has_deadline) ArmCancellationTimer();
   wait_strategy.DisableWakeups();
 
+  if (wait_site) {
+    wait_stats->AccountWait(*wait_site,
+                            std::chrono::steady_clock::now() - wait_started);
+  }
+
   const auto old_sleep_state = sleep_state_.Exchange<std::memory_order_acq_rel>(
       MakeNextEpochSleepState(sleep_epoch));
   wakeup_source_ = GetPrimaryWakeupSource(old_sleep_state.flags);
@@ -528,6 +547,8 @@ void TaskContext::CoroFunc(TaskPipe& task_pipe) {
 
     context->task_pipe_ = nullptr;
     context->TsanAcquireBarrier();
+
+    coro::AccountIdleStackUsage();
   }
 }
 
@@ -668,13 +689,35 @@ void TaskContext::SetState(Task::State new_state) {
 
 void TaskContext::Schedule() {
   UASSERT(state_ != Task::State::kQueued);
+  const bool is_start = state_ == Task::State::kNew;
   SetState(Task::State::kQueued);
   TraceStateTransition(Task::State::kQueued);
+
+  if (is_start) {
+    auto* const spawner = current_task::GetCurrentTaskContextUnchecked();
+    auto* const batch = spawner ? spawner->GetTaskStartBatch() : nullptr;
+    if (batch && batch->TryDefer(*this)) return;
+  }
+
   task_processor_.Schedule(this);
   // NOTE: may be executed at this point
 }
 
 void TaskContext::ProfilerStartExecution() {
+  if (auto* blocking_detector = task_processor_.GetBlockingDetector()) {
+    blocking_detector->StartSlice();
+  }
+
+  if (IsSpanCpuStatsEnabled()) {
+    run_cpu_time_started_ = GetCurrentThreadCpuTime();
+    span_cpu_time_started_ = run_cpu_time_started_;
+  }
+
+  if (task_processor_.ShouldAccountAllocations()) {
+    run_allocation_counters_started_ =
+        utils::jemalloc::GetThreadAllocationCounters();
+  }
+
   auto threshold_us = task_processor_.GetProfilerThreshold();
   if (threshold_us.count() > 0) {
     execute_started_ = std::chrono::steady_clock::now();
@@ -684,6 +727,21 @@ void TaskContext::ProfilerStartExecution() {
 }
 
 void TaskContext::ProfilerStopExecution() {
+  if (auto* blocking_detector = task_processor_.GetBlockingDetector()) {
+    blocking_detector->StopSlice();
+  }
+
+  if (auto* span_cpu_stats = task_processor_.GetSpanCpuStats()) {
+    const auto now = GetCurrentThreadCpuTime();
+    span_cpu_stats->AccountRun(span_cpu_stats_name_,
+                               now - span_cpu_time_started_,
+                               now - run_cpu_time_started_);
+  }
+
+  if (task_processor_.ShouldAccountAllocations()) {
+    allocation_counters_ = GetAllocationCounters();
+  }
+
   auto threshold_us = task_processor_.GetProfilerThreshold();
   if (threshold_us.count() <= 0) return;
 
@@ -709,6 +767,55 @@ void TaskContext::ProfilerStopExecution() {
   }
 }
 
+bool TaskContext::IsSpanCpuStatsEnabled() const noexcept {
+  return task_processor_.GetSpanCpuStats() != nullptr;
+}
+
+utils::jemalloc::AllocationCounters TaskContext::GetAllocationCounters()
+    const noexcept {
+  if (!task_processor_.ShouldAccountAllocations()) return {};
+
+  // The thread counters only grow, the current execution slice is added
+  const auto now = utils::jemalloc::GetThreadAllocationCounters();
+  return {
+      allocation_counters_.allocated_bytes + now.allocated_bytes -
+          run_allocation_counters_started_.allocated_bytes,
+      allocation_counters_.deallocated_bytes + now.deallocated_bytes -
+          run_allocation_counters_started_.deallocated_bytes,
+  };
+}
+
+bool TaskContext::IsSpanNameTracked() const noexcept {
+  return IsSpanCpuStatsEnabled() ||
+         task_processor_.GetBlockingDetector() != nullptr ||
+         utils::cpu_profiler::IsRunning();
+}
+
+void TaskContext::SwitchSpanCpuStatsName(std::string_view name) {
+  UASSERT(IsCurrent());
+  if (name == span_cpu_stats_name_) return;
+
+  if (auto* span_cpu_stats = task_processor_.GetSpanCpuStats()) {
+    const auto now = GetCurrentThreadCpuTime();
+    span_cpu_stats->AccountCpuTime(span_cpu_stats_name_,
+                                   now - span_cpu_time_started_);
+    span_cpu_time_started_ = now;
+  }
+
+  // The CPU profiler signal handler may interrupt the assignment
+  span_name_updating_.store(true, std::memory_order_relaxed);
+  std::atomic_signal_fence(std::memory_order_seq_cst);
+  span_cpu_stats_name_.assign(name);
+  std::atomic_signal_fence(std::memory_order_seq_cst);
+  span_name_updating_.store(false, std::memory_order_relaxed);
+}
+
+std::string_view TaskContext::GetSpanNameForProfiler() const noexcept {
+  if (span_name_updating_.load(std::memory_order_relaxed)) return {};
+  std::atomic_signal_fence(std::memory_order_seq_cst);
+  return span_cpu_stats_name_;
+}
+
 void TaskContext::TraceStateTransition(Task::State state) {
   if (trace_csw_left_ == 0) return;
   --trace_csw_left_;
@@ -756,9 +863,10 @@ void intrusive_ptr_release(TaskContext* p) noexcept {
   if (p->intrusive_refcount_.fetch_sub(1, std::memory_order_seq_cst) == 1) {
     p->ResetPayload();
 
+    const auto allocation_size = p->allocation_size_;
     std::destroy_at(p);
 
-    DeleteFusedTaskContext(reinterpret_cast<std::byte*>(p));
+    DeleteFusedTaskContext(reinterpret_cast<std::byte*>(p), allocation_size);
   }
 }
 
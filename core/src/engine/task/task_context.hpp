@@ -2,7 +2,11 @@
 
 #include <atomic>
 #include <cstdint>
+#include <limits>
 #include <memory>
+#include <string>
+#include <string_view>
+#include <utility>
 #include <vector>
 
 #include <ev.h>
@@ -20,12 +24,14 @@
 #include <userver/engine/impl/context_accessor.hpp>
 #include <userver/engine/impl/detached_tasks_sync_block.hpp>
 #include <userver/engine/impl/task_local_storage.hpp>
+#include <userver/engine/impl/task_start_batch.hpp>
 #include <userver/engine/impl/wait_list_fwd.hpp>
 #include <userver/engine/task/cancel.hpp>
 #include <userver/engine/task/task.hpp>
 #include <userver/engine/task/task_processor_fwd.hpp>
 #include <userver/utils/flags.hpp>
 #include <userver/utils/impl/wrapped_call_base.hpp>
+#include <utils/jemalloc.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
@@ -79,8 +85,9 @@ class TaskContext final : public ContextAccessor {
     kBootstrap = static_cast<uint32_t>(SleepFlags::kWakeupByBootstrap),
   };
 
-  TaskContext(TaskProcessor&, Task::Importance, Task::WaitMode, Deadline,
-              utils::impl::WrappedCallBase& payload);
+  TaskContext(TaskProcessor&, Task::Importance, Task::Priority, Task::WaitMode,
+              Deadline, utils::impl::WrappedCallBase& payload,
+              std::size_t allocation_size);
 
   ~TaskContext() noexcept;
 
@@ -101,6 +108,8 @@ class TaskContext final : public ContextAccessor {
   // exceeding these limits causes task to become cancelled
   bool IsCritical() const;
 
+  Task::Priority GetPriority() const noexcept { return priority_; }
+
   // whether task is allowed to be awaited from multiple coroutines
   // simultaneously
   bool IsSharedWaitAllowed() const;
@@ -122,6 +131,14 @@ class TaskContext final : public ContextAccessor {
   TaskProcessor& GetTaskProcessor() { return task_processor_; }
   void DoStep();
 
+  // The batch that defers the start of the tasks spawned by this task
+  TaskStartBatch* GetTaskStartBatch() const noexcept {
+    return task_start_batch_;
+  }
+  void SetTaskStartBatch(TaskStartBatch* batch) noexcept {
+    task_start_batch_ = batch;
+  }
+
   // normally non-blocking, causes wakeup
   void RequestCancel(TaskCancellationReason);
 
@@ -171,11 +188,40 @@ class TaskContext final : public ContextAccessor {
     task_queue_wait_timepoint_ = tp;
   }
 
+  static constexpr std::uint16_t kNoNumaNode =
+      std::numeric_limits<std::uint16_t>::max();
+
+  // Returns the NUMA node the task has previously been running on,
+  // kNoNumaNode if it has not been running yet
+  std::uint16_t ExchangeNumaNode(std::uint16_t node) noexcept {
+    return std::exchange(numa_node_, node);
+  }
+
   void SetCancelDeadline(Deadline deadline);
 
   bool HasLocalStorage() const noexcept;
   task_local::Storage& GetLocalStorage() noexcept;
 
+  bool IsSpanCpuStatsEnabled() const noexcept;
+
+  // Whether the current span name should be reported with
+  // SwitchSpanCpuStatsName, for the per-span CPU accounting, the blocking
+  // detector or the CPU profiler
+  bool IsSpanNameTracked() const noexcept;
+
+  // Attributes the CPU time consumed since the previous switch of the name to
+  // the previous name. Must be called from the task itself.
+  void SwitchSpanCpuStatsName(std::string_view name);
+
+  // Bytes allocated and deallocated by the task so far, zeros if the
+  // allocation accounting is disabled for the TaskProcessor. Must be called
+  // from the task itself.
+  utils::jemalloc::AllocationCounters GetAllocationCounters() const noexcept;
+
+  // Async-signal-safe, must be called from the thread that runs the task.
+  // Returns an empty string if the name is being updated.
+  std::string_view GetSpanNameForProfiler() const noexcept;
+
   // ContextAccessor implementation
   bool IsReady() const noexcept override;
   EarlyWakeup TryAppendWaiter(TaskContext& waiter) override;
@@ -219,11 +265,15 @@ class TaskContext final : public ContextAccessor {
   TaskProcessor& task_processor_;
   TaskCounter::Token task_counter_token_;
   const bool is_critical_;
+  const Task::Priority priority_;
   bool is_cancellable_{true};
   bool within_sleep_{false};
+  std::uint16_t numa_node_{kNoNumaNode};
   EhGlobals eh_globals_;
 
   utils::impl::WrappedCallBase* payload_;
+  // Size of the fused TaskContext + payload allocation
+  const std::size_t allocation_size_;
 
   std::atomic<Task::State> state_{Task::State::kNew};
   std::atomic<DetachedTasksSyncBlock::Token*> detached_token_{nullptr};
@@ -239,6 +289,17 @@ class TaskContext final : public ContextAccessor {
   std::chrono::steady_clock::time_point execute_started_;
   std::chrono::steady_clock::time_point last_state_change_timepoint_;
 
+  // Only used with the per-span CPU accounting, the blocking detector or the
+  // CPU profiler enabled
+  std::string span_cpu_stats_name_;
+  std::atomic<bool> span_name_updating_{false};
+  std::chrono::nanoseconds span_cpu_time_started_{};
+  std::chrono::nanoseconds run_cpu_time_started_{};
+
+  // Only used with the allocation accounting enabled
+  utils::jemalloc::AllocationCounters allocation_counters_{};
+  utils::jemalloc::AllocationCounters run_allocation_counters_started_{};
+
   std::size_t trace_csw_left_;
 
   AtomicSleepState sleep_state_{
@@ -251,6 +312,8 @@ class TaskContext final : public ContextAccessor {
 
   std::optional<task_local::Storage> local_storage_{};
 
+  TaskStartBatch* task_start_batch_{nullptr};
+
   // refcounter for task abandoning (cancellation) in engine::SharedTask
   std::atomic<std::size_t> shared_task_usages_{1};
 
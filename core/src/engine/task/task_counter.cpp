@@ -1,5 +1,6 @@
 #include <engine/task/task_counter.hpp>
 
+#include <algorithm>
 #include <thread>
 
 #include <userver/compiler/thread_local.hpp>
@@ -113,6 +114,10 @@ Rate TaskCounter::GetSpuriousWakeups() const noexcept {
   return GetApproximate(LocalCounterId::kSpuriousWakeups);
 }
 
+Rate TaskCounter::GetNumaMigrations() const noexcept {
+  return GetApproximate(LocalCounterId::kNumaMigrations);
+}
+
 void TaskCounter::AccountTaskCancel() noexcept {
   Increment(LocalCounterId::kCancelled);
 }
@@ -145,6 +150,29 @@ void TaskCounter::AccountSpuriousWakeup() noexcept {
   Increment(LocalCounterId::kSpuriousWakeups);
 }
 
+void TaskCounter::AccountNumaMigration() noexcept {
+  Increment(LocalCounterId::kNumaMigrations);
+}
+
+Rate TaskCounter::GetQueueWaitTimeUs(Task::Priority priority) const noexcept {
+  return GetApproximate(
+      OfPriority(LocalCounterId::kQueueWaitTimeCritical, priority));
+}
+
+Rate TaskCounter::GetQueueWaitSamples(Task::Priority priority) const noexcept {
+  return GetApproximate(
+      OfPriority(LocalCounterId::kQueueWaitSamplesCritical, priority));
+}
+
+void TaskCounter::AccountQueueWait(
+    Task::Priority priority, std::chrono::microseconds wait_time) noexcept {
+  const auto wait_time_us =
+      std::max<std::chrono::microseconds::rep>(wait_time.count(), 0);
+  Add(OfPriority(LocalCounterId::kQueueWaitTimeCritical, priority),
+      Rate{static_cast<Rate::ValueType>(wait_time_us)});
+  Increment(OfPriority(LocalCounterId::kQueueWaitSamplesCritical, priority));
+}
+
 Rate TaskCounter::GetApproximate(LocalCounterId id) const noexcept {
   Rate total;
   for (const auto& local_counters_block : local_counters_) {
@@ -158,12 +186,22 @@ Rate TaskCounter::GetApproximate(GlobalCounterId id) const noexcept {
   return total;
 }
 
-void TaskCounter::Increment(LocalCounterId id) noexcept {
+TaskCounter::LocalCounterId TaskCounter::OfPriority(
+    LocalCounterId critical_id, Task::Priority priority) noexcept {
+  static_assert(static_cast<std::size_t>(Task::Priority::kCritical) == 0);
+  static_assert(static_cast<std::size_t>(Task::Priority::kBackground) == 2);
+  return static_cast<LocalCounterId>(static_cast<std::size_t>(critical_id) +
+                                     static_cast<std::size_t>(priority));
+}
+
+void TaskCounter::Increment(LocalCounterId id) noexcept { Add(id, Rate{1}); }
+
+void TaskCounter::Add(LocalCounterId id, Rate value) noexcept {
   auto local_data = local_task_counter_data.Use();
   UASSERT(local_data->local_counter == this);
   auto& counter = (*local_counters_[local_data->task_processor_thread_index])
       [static_cast<std::size_t>(id)];
-  counter.Store(counter.Load() + Rate{1});
+  counter.Store(counter.Load() + value);
 }
 
 void TaskCounter::Increment(GlobalCounterId id) noexcept {
@@ -1,14 +1,16 @@
 #pragma once
 
 #include <array>
+#include <chrono>
 #include <cstddef>
 
 #include <boost/range/adaptor/transformed.hpp>
 
-#include <concurrent/impl/interference_shield.hpp>
 #include <userver/concurrent/impl/asymmetric_fence.hpp>
+#include <userver/concurrent/impl/interference_shield.hpp>
 #include <userver/concurrent/impl/striped_read_indicator.hpp>
 #include <userver/concurrent/striped_counter.hpp>
+#include <userver/engine/task/task.hpp>
 #include <userver/utils/fixed_array.hpp>
 #include <userver/utils/statistics/rate_counter.hpp>
 
@@ -69,6 +71,14 @@ class TaskCounter final {
 
   Rate GetSpuriousWakeups() const noexcept;
 
+  Rate GetNumaMigrations() const noexcept;
+
+  // Total queue wait time of the sampled tasks of the priority
+  Rate GetQueueWaitTimeUs(Task::Priority priority) const noexcept;
+
+  // Number of tasks of the priority, whose queue wait time was sampled
+  Rate GetQueueWaitSamples(Task::Priority priority) const noexcept;
+
   void AccountTaskCancel() noexcept;
 
   void AccountTaskCancelOverload() noexcept;
@@ -85,6 +95,11 @@ class TaskCounter final {
 
   void AccountSpuriousWakeup() noexcept;
 
+  void AccountNumaMigration() noexcept;
+
+  void AccountQueueWait(Task::Priority priority,
+                        std::chrono::microseconds wait_time) noexcept;
+
  private:
   // Counters that may be mutated from outside the bound TaskProcessor.
   enum class GlobalCounterId : std::size_t {
@@ -104,6 +119,14 @@ class TaskCounter final {
     kSpuriousWakeups,
     kOverloadSensor,
     kNoOverloadSensor,
+    kNumaMigrations,
+    // One per Task::Priority
+    kQueueWaitTimeCritical,
+    kQueueWaitTimeNormal,
+    kQueueWaitTimeBackground,
+    kQueueWaitSamplesCritical,
+    kQueueWaitSamplesNormal,
+    kQueueWaitSamplesBackground,
 
     kCountersSize,
   };
@@ -125,8 +148,13 @@ class TaskCounter final {
 
   Rate GetApproximate(GlobalCounterId) const noexcept;
 
+  static LocalCounterId OfPriority(LocalCounterId critical_id,
+                                   Task::Priority priority) noexcept;
+
   void Increment(LocalCounterId) noexcept;
 
+  void Add(LocalCounterId, Rate value) noexcept;
+
   void Increment(GlobalCounterId) noexcept;
 
   GlobalCounterPack global_counters_;
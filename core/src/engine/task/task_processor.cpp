@@ -13,8 +13,10 @@
 #include <userver/utils/rand.hpp>
 #include <userver/utils/thread_name.hpp>
 #include <userver/utils/threads.hpp>
+#include <utils/numa.hpp>
 #include <utils/statistics/thread_statistics.hpp>
 
+#include <engine/impl/stackless_scheduler.hpp>
 #include <engine/task/counted_coroutine_ptr.hpp>
 #include <engine/task/task_context.hpp>
 #include <engine/task/task_processor_pools.hpp>
@@ -24,6 +26,9 @@ USERVER_NAMESPACE_BEGIN
 namespace engine {
 namespace {
 
+// Number of the wait sites with the most wait time to report
+constexpr std::size_t kWaitStatsTopSize = 20;
+
 template <class Value>
 struct OverloadActionAndValue final {
   TaskProcessorSettings::OverloadAction action;
@@ -72,6 +77,19 @@ void EmitMagicNanosleep() {
   nanosleep(&ts, nullptr);
 }
 
+using TaskQueueVariant = std::variant<TaskQueue, WorkStealingTaskQueue>;
+
+TaskQueueVariant MakeTaskQueue(const TaskProcessorConfig& config) {
+  switch (config.task_processor_queue) {
+    case TaskQueueType::kGlobalTaskQueue:
+      return TaskQueueVariant{std::in_place_type<TaskQueue>, config};
+    case TaskQueueType::kWorkStealingTaskQueue:
+      return TaskQueueVariant{std::in_place_type<WorkStealingTaskQueue>,
+                              config};
+  }
+  UINVARIANT(false, "Unexpected value of task_processor_queue");
+}
+
 void TaskProcessorThreadStartedHook() {
   utils::impl::AssertStaticRegistrationFinished();
   utils::WithDefaultRandom([](auto&) {});
@@ -85,15 +103,40 @@ void TaskProcessorThreadStartedHook() {
 
 TaskProcessor::TaskProcessor(TaskProcessorConfig config,
                              std::shared_ptr<impl::TaskProcessorPools> pools)
-    : task_queue_(config),
+    : task_queue_(MakeTaskQueue(config)),
       task_counter_(config.worker_threads),
       config_(std::move(config)),
-      pools_(std::move(pools)) {
+      worker_affinity_(
+          utils::numa::MakeThreadAffinity(config_.cpu_set, config_.numa_node)),
+      track_numa_migrations_(utils::numa::GetNodesCount() > 1),
+      span_cpu_stats_(config_.span_cpu_stats_top_size > 0
+                          ? std::make_unique<impl::SpanCpuStatsStorage>(
+                                config_.worker_threads,
+                                config_.span_cpu_stats_top_size)
+                          : nullptr),
+      wait_stats_(config_.wait_stats_sample_every > 0
+                      ? std::make_unique<impl::WaitStatsStorage>(
+                            config_.worker_threads,
+                            config_.wait_stats_sample_every, kWaitStatsTopSize)
+                      : nullptr),
+      blocking_detector_(config_.blocking_detector_threshold.count() > 0
+                             ? std::make_unique<impl::BlockingDetector>(
+                                   config_.name, config_.worker_threads,
+                                   config_.blocking_detector_threshold)
+                             : nullptr),
+      pools_(std::move(pools)),
+      stackless_scheduler_(std::make_unique<impl::StacklessScheduler>(
+          *this, config_.worker_threads)) {
   utils::impl::FinishStaticRegistration();
   try {
     LOG_INFO() << "creating task_processor " << Name() << " "
                << "worker_threads=" << config_.worker_threads
-               << " thread_name=" << config_.thread_name;
+               << " thread_name=" << config_.thread_name
+               << " work_stealing="
+               << std::holds_alternative<WorkStealingTaskQueue>(task_queue_)
+               << " cpu_set=" << config_.cpu_set << " numa_node="
+               << (config_.numa_node ? std::to_string(*config_.numa_node)
+                                     : "none");
     concurrent::impl::Latch workers_left{
         static_cast<std::ptrdiff_t>(config_.worker_threads)};
     workers_.reserve(config_.worker_threads);
@@ -124,7 +167,7 @@ void TaskProcessor::Cleanup() noexcept {
   // Some tasks may be bound but not scheduled yet
   task_counter_.WaitForExhaustionBlocking();
 
-  task_queue_.StopProcessing();
+  std::visit([](auto& queue) { queue.StopProcessing(); }, task_queue_);
 
   for (auto& w : workers_) {
     w.join();
@@ -140,9 +183,25 @@ void TaskProcessor::InitiateShutdown() {
 
 void TaskProcessor::Schedule(impl::TaskContext* context) {
   UASSERT(context);
+  PrepareForQueue(*context);
+  std::visit([context](auto& queue) { queue.Push(context); }, task_queue_);
+}
+
+void TaskProcessor::Schedule(utils::span<impl::TaskContext* const> contexts) {
+  for (auto* const context : contexts) {
+    UASSERT(context);
+    PrepareForQueue(*context);
+    // The reference is adopted by the queue
+    intrusive_ptr_add_ref(context);
+  }
+  std::visit([contexts](auto& queue) { queue.PushBulk(contexts); },
+             task_queue_);
+}
+
+void TaskProcessor::PrepareForQueue(impl::TaskContext& context) {
   const auto [action, max_queue_length] =
       GetOverloadActionAndValue(action_bit_and_max_task_queue_wait_length_);
-  if (max_queue_length && !context->IsCritical()) {
+  if (max_queue_length && !context.IsCritical()) {
     UASSERT(max_queue_length > 0);
     if (const auto overload_size = GetOverloadByLength(max_queue_length)) {
       LOG_LIMITED_WARNING()
@@ -150,15 +209,13 @@ void TaskProcessor::Schedule(impl::TaskContext* context) {
           << overload_size << " >= "
           << "task_queue_size_threshold=" << max_queue_length
           << " task_processor=" << Name();
-      HandleOverload(*context, action);
+      HandleOverload(context, action);
     }
   }
   if (is_shutting_down_)
-    context->RequestCancel(TaskCancellationReason::kShutdown);
-
-  SetTaskQueueWaitTimepoint(context);
+    context.RequestCancel(TaskCancellationReason::kShutdown);
 
-  task_queue_.Push(context);
+  SetTaskQueueWaitTimepoint(&context);
 }
 
 void TaskProcessor::Adopt(impl::TaskContext& context) {
@@ -169,6 +226,12 @@ ev::ThreadPool& TaskProcessor::EventThreadPool() {
   return pools_->EventThreadPool();
 }
 
+std::size_t TaskProcessor::GetTaskQueueSize() const {
+  return std::visit(
+      [](const auto& queue) { return queue.GetSizeApproximate(); },
+      task_queue_);
+}
+
 impl::CountedCoroutinePtr TaskProcessor::GetCoroutine() {
   return {pools_->GetCoroPool().GetCoroutine(), *this};
 }
@@ -272,6 +335,9 @@ void RegisterThreadStartedHook(std::function<void()> func) {
 }
 
 void TaskProcessor::PrepareWorkerThread(std::size_t index) noexcept {
+  // Bind before any allocations of the thread, so that they are node-local
+  utils::numa::BindCurrentThread(worker_affinity_);
+
   switch (config_.os_scheduling) {
     case OsScheduling::kNormal:
       break;
@@ -288,6 +354,15 @@ void TaskProcessor::PrepareWorkerThread(std::size_t index) noexcept {
   utils::SetCurrentThreadName(fmt::format("{}_{}", config_.thread_name, index));
 
   impl::SetLocalTaskCounterData(task_counter_, index);
+  if (span_cpu_stats_) {
+    impl::SetLocalSpanCpuStatsStorage(*span_cpu_stats_, index);
+  }
+  if (wait_stats_) {
+    impl::SetLocalWaitStatsStorage(*wait_stats_, index);
+  }
+  if (blocking_detector_) {
+    blocking_detector_->RegisterThread(index);
+  }
 
   pools_->GetCoroPool().RegisterThread();
 
@@ -299,12 +374,18 @@ void TaskProcessor::FinalizeWorkerThread() noexcept {
 }
 
 void TaskProcessor::ProcessTasks() noexcept {
+  std::visit([this](auto& queue) { ProcessTasks(queue); }, task_queue_);
+}
+
+template <typename Queue>
+void TaskProcessor::ProcessTasks(Queue& task_queue) noexcept {
   while (true) {
-    auto context = task_queue_.PopBlocking();
+    auto context = task_queue.PopBlocking();
     if (!context) break;
 
     GetTaskCounter().AccountTaskSwitchSlow();
     CheckWaitTime(*context);
+    AccountNumaMigration(*context);
 
     bool has_failed = false;
     try {
@@ -315,6 +396,7 @@ void TaskProcessor::ProcessTasks() noexcept {
     }
 
     pools_->GetCoroPool().AccountStackUsage();
+    pools_->GetCoroPool().MaybeTrim();
 
     if (has_failed || context->IsFinished()) {
       context->FinishDetached();
@@ -327,16 +409,24 @@ void TaskProcessor::CheckWaitTime(impl::TaskContext& context) {
       GetOverloadActionAndValue(action_bit_and_max_task_queue_wait_time_);
   const auto sensor_wait_time = sensor_task_queue_wait_time_.load();
 
+  const auto wait_timepoint = context.GetQueueWaitTimepoint();
+  const bool has_wait_time =
+      wait_timepoint != std::chrono::steady_clock::time_point();
+  const auto wait_time = has_wait_time
+                             ? std::chrono::steady_clock::now() - wait_timepoint
+                             : std::chrono::steady_clock::duration{};
+  const auto wait_time_us =
+      std::chrono::duration_cast<std::chrono::microseconds>(wait_time);
+  if (has_wait_time) {
+    GetTaskCounter().AccountQueueWait(context.GetPriority(), wait_time_us);
+  }
+
   if (max_wait_time.count() == 0 && sensor_wait_time.count() == 0) {
     SetTaskQueueWaitTimeOverloaded(false);
     return;
   }
 
-  const auto wait_timepoint = context.GetQueueWaitTimepoint();
-  if (wait_timepoint != std::chrono::steady_clock::time_point()) {
-    const auto wait_time = std::chrono::steady_clock::now() - wait_timepoint;
-    const auto wait_time_us =
-        std::chrono::duration_cast<std::chrono::microseconds>(wait_time);
+  if (has_wait_time) {
     LOG_TRACE() << "queue wait time = " << wait_time_us.count() << "us";
 
     SetTaskQueueWaitTimeOverloaded(max_wait_time.count() &&
@@ -358,6 +448,20 @@ void TaskProcessor::CheckWaitTime(impl::TaskContext& context) {
   }
 }
 
+void TaskProcessor::AccountNumaMigration(impl::TaskContext& context) noexcept {
+  if (!track_numa_migrations_) return;
+
+  const auto node = utils::numa::GetCurrentNode();
+  if (node == utils::numa::kUnknownNode) return;
+
+  const auto previous_node =
+      context.ExchangeNumaNode(static_cast<std::uint16_t>(node));
+  if (previous_node != impl::TaskContext::kNoNumaNode &&
+      previous_node != node) {
+    GetTaskCounter().AccountNumaMigration();
+  }
+}
+
 void TaskProcessor::SetTaskQueueWaitTimeOverloaded(bool new_value) noexcept {
   auto& atomic = overloaded_cache_->overloaded_by_wait_time;
   // The check helps to reduce contention.
@@ -5,18 +5,25 @@
 #include <functional>
 #include <memory>
 #include <thread>
+#include <variant>
 #include <vector>
 
 #include <boost/smart_ptr/intrusive_ptr.hpp>
 
-#include <concurrent/impl/interference_shield.hpp>
+#include <engine/task/blocking_detector.hpp>
+#include <engine/task/span_cpu_stats.hpp>
 #include <engine/task/task_counter.hpp>
 #include <engine/task/task_processor_config.hpp>
 #include <engine/task/task_queue.hpp>
+#include <engine/task/wait_stats.hpp>
+#include <engine/task/work_stealing_queue/task_queue.hpp>
+#include <utils/numa.hpp>
 #include <utils/statistics/thread_statistics.hpp>
 
+#include <userver/concurrent/impl/interference_shield.hpp>
 #include <userver/engine/impl/detached_tasks_sync_block.hpp>
 #include <userver/logging/logger.hpp>
+#include <userver/utils/span.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
@@ -26,6 +33,7 @@ namespace impl {
 class TaskContext;
 class TaskProcessorPools;
 class CountedCoroutinePtr;
+class StacklessScheduler;
 }  // namespace impl
 
 namespace ev {
@@ -41,6 +49,9 @@ class TaskProcessor final {
 
   void Schedule(impl::TaskContext*);
 
+  // Queues all the contexts at once, with a single wakeup of the workers
+  void Schedule(utils::span<impl::TaskContext* const> contexts);
+
   void Adopt(impl::TaskContext& context);
 
   impl::CountedCoroutinePtr GetCoroutine();
@@ -55,10 +66,41 @@ class TaskProcessor final {
 
   impl::TaskCounter& GetTaskCounter() noexcept { return task_counter_; }
 
+  impl::StacklessScheduler& GetStacklessScheduler() noexcept {
+    return *stackless_scheduler_;
+  }
+
   const impl::TaskCounter& GetTaskCounter() const { return task_counter_; }
 
-  std::size_t GetTaskQueueSize() const {
-    return task_queue_.GetSizeApproximate();
+  std::size_t GetTaskQueueSize() const;
+
+  // nullptr if the per-span CPU accounting is disabled
+  impl::SpanCpuStatsStorage* GetSpanCpuStats() noexcept {
+    return span_cpu_stats_.get();
+  }
+
+  const impl::SpanCpuStatsStorage* GetSpanCpuStats() const noexcept {
+    return span_cpu_stats_.get();
+  }
+
+  // nullptr if the wait time accounting is disabled
+  impl::WaitStatsStorage* GetWaitStats() noexcept { return wait_stats_.get(); }
+
+  const impl::WaitStatsStorage* GetWaitStats() const noexcept {
+    return wait_stats_.get();
+  }
+
+  // nullptr if the detection of the blocked worker threads is disabled
+  impl::BlockingDetector* GetBlockingDetector() noexcept {
+    return blocking_detector_.get();
+  }
+
+  const impl::BlockingDetector* GetBlockingDetector() const noexcept {
+    return blocking_detector_.get();
+  }
+
+  bool ShouldAccountAllocations() const noexcept {
+    return config_.account_allocations;
   }
 
   std::size_t GetWorkerCount() const { return workers_.size(); }
@@ -96,10 +138,17 @@ class TaskProcessor final {
 
   void ProcessTasks() noexcept;
 
+  template <typename Queue>
+  void ProcessTasks(Queue& task_queue) noexcept;
+
   void CheckWaitTime(impl::TaskContext& context);
 
+  void AccountNumaMigration(impl::TaskContext& context) noexcept;
+
   void SetTaskQueueWaitTimeOverloaded(bool new_value) noexcept;
 
+  void PrepareForQueue(impl::TaskContext& context);
+
   void HandleOverload(impl::TaskContext& context,
                       TaskProcessorSettings::OverloadAction);
 
@@ -112,11 +161,17 @@ class TaskProcessor final {
   concurrent::impl::InterferenceShield<impl::DetachedTasksSyncBlock>
       detached_contexts_{impl::DetachedTasksSyncBlock::StopMode::kCancel};
   concurrent::impl::InterferenceShield<OverloadedCache> overloaded_cache_;
-  TaskQueue task_queue_;
+  std::variant<TaskQueue, WorkStealingTaskQueue> task_queue_;
   impl::TaskCounter task_counter_;
 
   const TaskProcessorConfig config_;
+  const utils::numa::ThreadAffinity worker_affinity_;
+  const bool track_numa_migrations_;
+  const std::unique_ptr<impl::SpanCpuStatsStorage> span_cpu_stats_;
+  const std::unique_ptr<impl::WaitStatsStorage> wait_stats_;
+  const std::unique_ptr<impl::BlockingDetector> blocking_detector_;
   const std::shared_ptr<impl::TaskProcessorPools> pools_;
+  const std::unique_ptr<impl::StacklessScheduler> stackless_scheduler_;
   std::vector<std::thread> workers_;
   logging::LoggerPtr task_trace_logger_{nullptr};
 
@@ -8,6 +8,7 @@
 #include <userver/utils/text_light.hpp>
 #include <userver/utils/trivial_map.hpp>
 #include <userver/yaml_config/yaml_config.hpp>
+#include <utils/threads_count.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
@@ -45,17 +46,47 @@ OsScheduling Parse(const yaml_config::YamlConfig& value,
   return utils::ParseFromValueString(value, kMap);
 }
 
+TaskQueueType Parse(const yaml_config::YamlConfig& value,
+                    formats::parse::To<TaskQueueType>) {
+  static constexpr utils::TrivialBiMap kMap([](auto selector) {
+    return selector()
+        .Case(TaskQueueType::kGlobalTaskQueue, "global-task-queue")
+        .Case(TaskQueueType::kWorkStealingTaskQueue,
+              "work-stealing-task-queue");
+  });
+
+  return utils::ParseFromValueString(value, kMap);
+}
+
 TaskProcessorConfig Parse(const yaml_config::YamlConfig& value,
                           formats::parse::To<TaskProcessorConfig>) {
   TaskProcessorConfig config;
   config.should_guess_cpu_limit =
       value["guess-cpu-limit"].As<bool>(config.should_guess_cpu_limit);
-  config.worker_threads = value["worker_threads"].As<std::size_t>();
+  config.worker_threads = utils::ParseThreadsCount(
+      value["worker_threads"],
+      value["worker-threads-cpu-ratio"].As<double>(1.0));
   config.thread_name = value["thread_name"].As<std::string>({});
   config.os_scheduling =
       value["os-scheduling"].As<OsScheduling>(config.os_scheduling);
   config.spinning_iterations =
       value["spinning-iterations"].As<int>(config.spinning_iterations);
+  config.task_processor_queue = value["task-processor-queue"].As<TaskQueueType>(
+      config.task_processor_queue);
+  config.cpu_set = value["cpu-set"].As<std::string>(config.cpu_set);
+  config.numa_node = value["numa-node"].As<std::optional<std::size_t>>();
+  config.span_cpu_stats_top_size =
+      value["span-cpu-stats-top-size"].As<std::size_t>(
+          config.span_cpu_stats_top_size);
+  config.wait_stats_sample_every =
+      value["wait-stats-sample-every"].As<std::size_t>(
+          config.wait_stats_sample_every);
+  config.blocking_detector_threshold =
+      value["blocking-detector-threshold"].As<std::chrono::milliseconds>(
+          std::chrono::duration_cast<std::chrono::milliseconds>(
+              config.blocking_detector_threshold));
+  config.account_allocations =
+      value["account-allocations"].As<bool>(config.account_allocations);
 
   const auto task_trace = value["task-trace"];
   if (!task_trace.IsMissing()) {
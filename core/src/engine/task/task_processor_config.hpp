@@ -3,6 +3,7 @@
 #include <chrono>
 #include <cstddef>
 #include <cstdint>
+#include <optional>
 #include <string>
 
 #include <userver/formats/json_fwd.hpp>
@@ -21,6 +22,14 @@ enum class OsScheduling {
 OsScheduling Parse(const yaml_config::YamlConfig& value,
                    formats::parse::To<OsScheduling>);
 
+enum class TaskQueueType {
+  kGlobalTaskQueue,
+  kWorkStealingTaskQueue,
+};
+
+TaskQueueType Parse(const yaml_config::YamlConfig& value,
+                    formats::parse::To<TaskQueueType>);
+
 struct TaskProcessorConfig {
   std::string name;
 
@@ -29,6 +38,21 @@ struct TaskProcessorConfig {
   std::string thread_name;
   OsScheduling os_scheduling{OsScheduling::kNormal};
   int spinning_iterations{1000};
+  TaskQueueType task_processor_queue{TaskQueueType::kGlobalTaskQueue};
+  std::string cpu_set;
+  std::optional<std::size_t> numa_node;
+
+  // 0 disables the per-span CPU accounting
+  std::size_t span_cpu_stats_top_size{0};
+
+  // 0 disables the wait time accounting
+  std::size_t wait_stats_sample_every{0};
+
+  // 0 disables the detection of the blocked worker threads
+  std::chrono::microseconds blocking_detector_threshold{0};
+
+  // Enables the per-task accounting of the allocated memory
+  bool account_allocations{false};
 
   std::size_t task_trace_every{1000};
   std::size_t task_trace_max_csw{0};
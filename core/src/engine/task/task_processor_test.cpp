@@ -1,10 +1,15 @@
 #include <engine/task/task_processor.hpp>
 
+#include <atomic>
+#include <vector>
+
 #include <engine/task/task_processor_config.hpp>
 #include <userver/engine/async.hpp>
+#include <userver/engine/sleep.hpp>
 #include <userver/engine/task/task_base.hpp>
 #include <userver/engine/task/task_with_result.hpp>
 #include <userver/utest/utest.hpp>
+#include <userver/utils/async.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
@@ -47,4 +52,56 @@ UTEST(TaskProcessor, Overload) {
   }
 }
 
+UTEST(TaskProcessor, Priorities) {
+  constexpr std::size_t kTasksPerPriority = 10;
+  std::vector<engine::Task::Priority> order;
+  std::vector<engine::TaskWithResult<void>> tasks;
+
+  const auto spawn = [&](engine::Task::Priority priority) {
+    tasks.push_back(engine::AsyncNoSpan(
+        priority, [&order, priority] { order.push_back(priority); }));
+  };
+  for (std::size_t i = 0; i < kTasksPerPriority; ++i) {
+    spawn(engine::Task::Priority::kBackground);
+  }
+  for (std::size_t i = 0; i < kTasksPerPriority; ++i) {
+    spawn(engine::Task::Priority::kNormal);
+  }
+  spawn(engine::Task::Priority::kCritical);
+
+  for (auto& task : tasks) task.Wait();
+  ASSERT_EQ(order.size(), 2 * kTasksPerPriority + 1);
+
+  // Every 4th pop prefers normal tasks, every 16th prefers background ones
+  std::size_t critical_position = 0;
+  while (order[critical_position] != engine::Task::Priority::kCritical) {
+    ++critical_position;
+  }
+  EXPECT_LE(critical_position, 2);
+
+  std::size_t early_background = 0;
+  for (std::size_t i = 0; i <= kTasksPerPriority; ++i) {
+    if (order[i] == engine::Task::Priority::kBackground) ++early_background;
+  }
+  EXPECT_LE(early_background, 1);
+}
+
+UTEST(TaskProcessor, PrioritiesNoStarvation) {
+  std::atomic<bool> background_finished{false};
+
+  auto background = utils::Async(
+      "background", engine::Task::Priority::kBackground,
+      [&background_finished] { background_finished = true; });
+
+  // Keeps the only worker busy with critical tasks
+  auto critical = engine::AsyncNoSpan(
+      engine::Task::Priority::kCritical, [&background_finished] {
+        while (!background_finished) engine::Yield();
+      });
+
+  critical.WaitFor(utest::kMaxTestWaitTime);
+  ASSERT_TRUE(critical.IsFinished());
+  background.Get();
+}
+
 USERVER_NAMESPACE_END
@@ -7,59 +7,116 @@ USERVER_NAMESPACE_BEGIN
 namespace engine {
 
 namespace {
+
 constexpr std::size_t kSemaphoreInitialCount = 0;
+
+constexpr std::size_t ToIndex(Task::Priority priority) noexcept {
+  return static_cast<std::size_t>(priority);
 }
 
+static_assert(ToIndex(Task::Priority::kCritical) == 0);
+static_assert(ToIndex(Task::Priority::kNormal) == 1);
+static_assert(ToIndex(Task::Priority::kBackground) == 2);
+
+// Every kNormalFirstPeriod-th pop prefers normal tasks over critical ones,
+// every kBackgroundFirstPeriod-th pop prefers background tasks over the rest.
+// So under a flood of higher priority tasks, normal tasks still get 1/4 of
+// the pops and background tasks get 1/16.
+constexpr std::size_t kNormalFirstPeriod = 4;
+constexpr std::size_t kBackgroundFirstPeriod = 16;
+
+using PopOrder = std::array<std::size_t, 3>;
+
+constexpr PopOrder kCriticalFirst{0, 1, 2};
+constexpr PopOrder kNormalFirst{1, 0, 2};
+constexpr PopOrder kBackgroundFirst{2, 0, 1};
+
+const PopOrder& GetPopOrder(std::size_t pops_count) noexcept {
+  if (pops_count % kBackgroundFirstPeriod == 0) return kBackgroundFirst;
+  if (pops_count % kNormalFirstPeriod == 0) return kNormalFirst;
+  return kCriticalFirst;
+}
+
+}  // namespace
+
 TaskQueue::TaskQueue(const TaskProcessorConfig& config)
     : queue_semaphore_(kSemaphoreInitialCount, config.spinning_iterations) {}
 
 void TaskQueue::Push(boost::intrusive_ptr<impl::TaskContext>&& context) {
   UASSERT(context);
-  DoPush(context.get());
+  DoPush(context.get(), context->GetPriority());
   context.detach();
 }
 
+void TaskQueue::PushBulk(utils::span<impl::TaskContext* const> contexts) {
+  // Contexts of the same priority usually go in a row
+  std::size_t begin = 0;
+  while (begin < contexts.size()) {
+    const auto priority = contexts[begin]->GetPriority();
+    std::size_t end = begin + 1;
+    while (end < contexts.size() && contexts[end]->GetPriority() == priority) {
+      ++end;
+    }
+    queues_[ToIndex(priority)].enqueue_bulk(contexts.begin() + begin,
+                                            end - begin);
+    begin = end;
+  }
+  queue_semaphore_.signal(contexts.size());
+}
+
 boost::intrusive_ptr<impl::TaskContext> TaskQueue::PopBlocking() {
   // Current thread handles only a single TaskProcessor, so it's safe to store
-  // a token for the task processor in a thread-local variable.
-  thread_local moodycamel::ConsumerToken token(queue_);
-
-  boost::intrusive_ptr<impl::TaskContext> context{DoPopBlocking(token),
+  // tokens for the task processor in a thread-local variable.
+  thread_local ConsumerTokens tokens{
+      moodycamel::ConsumerToken{queues_[0]},
+      moodycamel::ConsumerToken{queues_[1]},
+      moodycamel::ConsumerToken{queues_[2]},
+  };
+
+  boost::intrusive_ptr<impl::TaskContext> context{DoPopBlocking(tokens),
                                                   /* add_ref= */ false};
 
   if (!context) {
     // return "stop" token back
-    DoPush(nullptr);
+    DoPush(nullptr, Task::Priority::kCritical);
   }
 
   return context;
 }
 
-void TaskQueue::StopProcessing() { DoPush(nullptr); }
+void TaskQueue::StopProcessing() { DoPush(nullptr, Task::Priority::kCritical); }
 
 std::size_t TaskQueue::GetSizeApproximate() const noexcept {
-  return queue_.size_approx();
+  std::size_t size = 0;
+  for (const auto& queue : queues_) size += queue.size_approx();
+  return size;
 }
 
-void TaskQueue::DoPush(impl::TaskContext* context) {
+void TaskQueue::DoPush(impl::TaskContext* context, Task::Priority priority) {
+  UASSERT(ToIndex(priority) < kPrioritiesCount);
   // This piece of code is copy-pasted from
   // moodycamel::BlockingConcurrentQueue::enqueue
-  queue_.enqueue(context);
+  queues_[ToIndex(priority)].enqueue(context);
   queue_semaphore_.signal();
 }
 
-impl::TaskContext* TaskQueue::DoPopBlocking(moodycamel::ConsumerToken& token) {
+impl::TaskContext* TaskQueue::DoPopBlocking(ConsumerTokens& tokens) {
+  // Only accessed by the owning worker thread
+  thread_local std::size_t pops_count = 0;
+
   impl::TaskContext* context{};
 
-  // This piece of code is copy-pasted from
+  // This piece of code is adapted from
   // moodycamel::BlockingConcurrentQueue::wait_dequeue
   queue_semaphore_.wait();
-  while (!queue_.try_dequeue(token, context)) {
+  const auto& pop_order = GetPopOrder(++pops_count);
+  while (true) {
+    for (const auto index : pop_order) {
+      if (queues_[index].try_dequeue(tokens[index], context)) return context;
+    }
     // Can happen when another consumer steals our item in exchange for another
     // item in a Moodycamel sub-queue that we have already passed.
   }
-
-  return context;
 }
 
 }  // namespace engine
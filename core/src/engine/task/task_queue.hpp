@@ -1,10 +1,15 @@
 #pragma once
 
+#include <array>
+#include <cstddef>
+
 #include <moodycamel/blockingconcurrentqueue.h>
 #include <moodycamel/lightweightsemaphore.h>
 #include <boost/smart_ptr/intrusive_ptr.hpp>
 
 #include <engine/task/task_processor_config.hpp>
+#include <userver/engine/task/task.hpp>
+#include <userver/utils/span.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
@@ -14,12 +19,21 @@ namespace impl {
 class TaskContext;
 }  // namespace impl
 
+/// @brief Global task queue of a TaskProcessor.
+///
+/// Tasks of each Task::Priority are queued separately. Consumers generally
+/// pop the highest priority task available, but periodically start from
+/// the lower priorities, so that a flood of higher priority tasks cannot
+/// starve the rest.
 class TaskQueue final {
  public:
   explicit TaskQueue(const TaskProcessorConfig& config);
 
   void Push(boost::intrusive_ptr<impl::TaskContext>&& context);
 
+  // Adopts a reference to each of the contexts
+  void PushBulk(utils::span<impl::TaskContext* const> contexts);
+
   // Returns nullptr as a stop signal
   boost::intrusive_ptr<impl::TaskContext> PopBlocking();
 
@@ -28,11 +42,17 @@ class TaskQueue final {
   std::size_t GetSizeApproximate() const noexcept;
 
  private:
-  void DoPush(impl::TaskContext* context);
+  static constexpr std::size_t kPrioritiesCount = 3;
+
+  using Queue = moodycamel::ConcurrentQueue<impl::TaskContext*>;
+  using ConsumerTokens =
+      std::array<moodycamel::ConsumerToken, kPrioritiesCount>;
+
+  void DoPush(impl::TaskContext* context, Task::Priority priority);
 
-  impl::TaskContext* DoPopBlocking(moodycamel::ConsumerToken& token);
+  impl::TaskContext* DoPopBlocking(ConsumerTokens& tokens);
 
-  moodycamel::ConcurrentQueue<impl::TaskContext*> queue_;
+  std::array<Queue, kPrioritiesCount> queues_;
   moodycamel::LightweightSemaphore queue_semaphore_;
 };
 
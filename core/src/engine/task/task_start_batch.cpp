@@ -0,0 +1,37 @@
+#include <userver/engine/impl/task_start_batch.hpp>
+
+#include <engine/task/task_context.hpp>
+#include <engine/task/task_processor.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace engine::impl {
+
+TaskStartBatch::TaskStartBatch(TaskProcessor& task_processor,
+                               std::size_t max_size)
+    : task_processor_(task_processor),
+      owner_(current_task::GetCurrentTaskContext()),
+      previous_(owner_.GetTaskStartBatch()) {
+  contexts_.reserve(max_size);
+  owner_.SetTaskStartBatch(this);
+}
+
+TaskStartBatch::~TaskStartBatch() {
+  UASSERT(owner_.IsCurrent());
+  UASSERT(owner_.GetTaskStartBatch() == this);
+  owner_.SetTaskStartBatch(previous_);
+  if (!contexts_.empty()) task_processor_.Schedule(contexts_);
+}
+
+bool TaskStartBatch::TryDefer(TaskContext& context) noexcept {
+  if (&context.GetTaskProcessor() != &task_processor_ ||
+      contexts_.size() == contexts_.capacity()) {
+    return false;
+  }
+  contexts_.push_back(&context);
+  return true;
+}
+
+}  // namespace engine::impl
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,221 @@
+#include <engine/task/wait_stats.hpp>
+
+#include <execinfo.h>
+
+#include <algorithm>
+#include <map>
+#include <utility>
+
+#include <boost/container_hash/hash.hpp>
+#include <boost/stacktrace/frame.hpp>
+
+#include <userver/compiler/thread_local.hpp>
+#include <userver/utils/assert.hpp>
+#include <userver/utils/statistics/histogram_aggregator.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace engine::impl {
+
+namespace {
+
+constexpr double kWaitTimeBoundsMs[] = {1, 5, 10, 50, 100, 500, 1000, 5000};
+
+// Frames of the capturing code itself
+constexpr std::string_view kCaptureFrames[] = {
+    "WaitStatsStorage::CaptureSite",
+    "TaskContext::Sleep",
+};
+
+// The rest of the stack belongs to the coroutine trampoline
+constexpr std::string_view kStartOfCoroutine = "utils::impl::WrappedCallImpl<";
+
+struct LocalWaitStatsData final {
+  WaitStatsStorage* storage{nullptr};
+  std::size_t thread_index{};
+};
+
+compiler::ThreadLocal local_wait_stats_data = [] {
+  return LocalWaitStatsData{};
+};
+
+bool Contains(std::string_view name, std::string_view part) {
+  return name.find(part) != std::string_view::npos;
+}
+
+bool IsCaptureFrame(std::string_view name) {
+  return std::any_of(
+      std::begin(kCaptureFrames), std::end(kCaptureFrames),
+      [name](std::string_view frame) { return Contains(name, frame); });
+}
+
+bool IsEngineFrame(std::string_view name) {
+  return name.substr(0, 5) == "std::" || Contains(name, "engine::");
+}
+
+// "ns::Foo<int>::Bar(int, char) const" -> "ns::Foo<int>::Bar"
+std::string StripParameters(std::string name) {
+  auto end = name.rfind(')');
+  if (end == std::string::npos) return name;
+
+  int depth = 0;
+  for (auto pos = end + 1; pos-- > 0;) {
+    if (name[pos] == ')') {
+      ++depth;
+    } else if (name[pos] == '(' && --depth == 0) {
+      name.resize(pos);
+      break;
+    }
+  }
+  return name;
+}
+
+struct MergedWaitStats final {
+  std::uint64_t waits{0};
+  std::chrono::nanoseconds wait_time{0};
+  utils::statistics::HistogramAggregator wait_time_ms{kWaitTimeBoundsMs};
+};
+
+}  // namespace
+
+bool operator==(const WaitSite& lhs, const WaitSite& rhs) noexcept {
+  return lhs.frames == rhs.frames;
+}
+
+std::size_t WaitSiteHash::operator()(const WaitSite& site) const noexcept {
+  return boost::hash_range(site.frames.begin(), site.frames.end());
+}
+
+WaitStatsStorage::WaitStatsStorage(std::size_t thread_count,
+                                   std::size_t sample_every,
+                                   std::size_t top_size)
+    : sample_every_(sample_every), top_size_(top_size), shards_(thread_count) {
+  UASSERT(sample_every_ > 0);
+  UASSERT(top_size_ > 0);
+}
+
+bool WaitStatsStorage::ShouldSample() noexcept {
+  auto& shard = GetLocalShard();
+  if (shard.waits_till_sample > 0) {
+    --shard.waits_till_sample;
+    return false;
+  }
+  shard.waits_till_sample = sample_every_ - 1;
+  return true;
+}
+
+WaitSite WaitStatsStorage::CaptureSite() noexcept {
+  WaitSite site;
+  ::backtrace(site.frames.data(), site.frames.size());
+  return site;
+}
+
+void WaitStatsStorage::AccountWait(const WaitSite& site,
+                                   std::chrono::nanoseconds wait_time) {
+  auto& shard = GetLocalShard();
+  // Only contended while the statistics are being collected
+  const std::lock_guard lock{shard.mutex};
+
+  auto it = shard.stats.find(site);
+  if (it == shard.stats.end()) {
+    const auto& key =
+        shard.stats.size() < kMaxSitesPerThread ? site : WaitSite{};
+    it = shard.stats
+             .try_emplace(key, SiteStats{0, {},
+                                         utils::statistics::Histogram{
+                                             kWaitTimeBoundsMs}})
+             .first;
+  }
+
+  auto& stats = it->second;
+  ++stats.waits;
+  stats.wait_time += wait_time;
+  stats.wait_time_ms.Account(
+      std::chrono::duration<double, std::milli>(wait_time).count());
+}
+
+std::vector<NamedWaitStats> WaitStatsStorage::GetTopByWaitTime() const {
+  auto result = Collect();
+  const auto top_size = std::min(top_size_, result.size());
+  std::partial_sort(result.begin(), result.begin() + top_size, result.end(),
+                    [](const NamedWaitStats& lhs, const NamedWaitStats& rhs) {
+                      return lhs.wait_time > rhs.wait_time;
+                    });
+  result.erase(result.begin() + top_size, result.end());
+  return result;
+}
+
+WaitStatsStorage::Shard& WaitStatsStorage::GetLocalShard() noexcept {
+  auto local_data = local_wait_stats_data.Use();
+  UASSERT(local_data->storage == this);
+  return *shards_[local_data->thread_index];
+}
+
+std::vector<NamedWaitStats> WaitStatsStorage::Collect() const {
+  std::map<std::pair<std::string, std::string>, MergedWaitStats> merged;
+  {
+    const std::lock_guard names_lock{names_mutex_};
+    for (const auto& shard : shards_) {
+      const std::lock_guard lock{shard->mutex};
+      for (const auto& [site, stats] : shard->stats) {
+        std::string primitive{kOverflowName};
+        std::string call_site{kOverflowName};
+
+        const auto frames_end =
+            std::find(site.frames.begin(), site.frames.end(), nullptr);
+        auto frame = site.frames.begin();
+        while (frame != frames_end && IsCaptureFrame(GetFrameName(*frame))) {
+          ++frame;
+        }
+        if (frame != frames_end) {
+          primitive = GetFrameName(*frame);
+          call_site = kUnknownName;
+          for (++frame; frame != frames_end; ++frame) {
+            const auto& name = GetFrameName(*frame);
+            if (Contains(name, kStartOfCoroutine)) break;
+            if (!IsEngineFrame(name)) {
+              call_site = name;
+              break;
+            }
+          }
+        }
+
+        auto& merged_stats =
+            merged[{std::move(primitive), std::move(call_site)}];
+        merged_stats.waits += stats.waits;
+        merged_stats.wait_time += stats.wait_time;
+        merged_stats.wait_time_ms.Add(stats.wait_time_ms.GetView());
+      }
+    }
+  }
+
+  std::vector<NamedWaitStats> result;
+  result.reserve(merged.size());
+  for (auto& [key, stats] : merged) {
+    result.push_back(NamedWaitStats{
+        key.first, key.second, stats.waits,
+        std::chrono::duration_cast<std::chrono::microseconds>(stats.wait_time),
+        utils::statistics::Histogram{stats.wait_time_ms.GetView()}});
+  }
+  return result;
+}
+
+const std::string& WaitStatsStorage::GetFrameName(void* address) const {
+  auto [it, inserted] = frame_names_.try_emplace(address);
+  if (inserted) {
+    auto name = boost::stacktrace::frame(address).name();
+    it->second =
+        name.empty() ? std::string{kUnknownName} : StripParameters(name);
+  }
+  return it->second;
+}
+
+void SetLocalWaitStatsStorage(WaitStatsStorage& storage,
+                              std::size_t thread_index) {
+  auto local_data = local_wait_stats_data.Use();
+  *local_data = {&storage, thread_index};
+}
+
+}  // namespace engine::impl
+
+USERVER_NAMESPACE_END
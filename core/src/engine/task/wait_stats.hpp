@@ -0,0 +1,113 @@
+#pragma once
+
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+#include <userver/concurrent/impl/interference_shield.hpp>
+#include <userver/utils/fixed_array.hpp>
+#include <userver/utils/statistics/histogram.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace engine::impl {
+
+// Return addresses of the task stack at the start of a wait
+struct WaitSite final {
+  static constexpr std::size_t kMaxFrames = 16;
+
+  std::array<void*, kMaxFrames> frames{};
+};
+
+bool operator==(const WaitSite& lhs, const WaitSite& rhs) noexcept;
+
+struct WaitSiteHash final {
+  std::size_t operator()(const WaitSite& site) const noexcept;
+};
+
+struct NamedWaitStats final {
+  // The function that suspended the task, e.g. a mutex lock slow path
+  std::string primitive;
+
+  // The innermost function outside of the engine and the standard library
+  std::string call_site;
+
+  // The sampled waits only
+  std::uint64_t waits{0};
+  std::chrono::microseconds wait_time{0};
+  utils::statistics::Histogram wait_time_ms;
+};
+
+/// @brief Time spent by the tasks of a TaskProcessor being suspended, grouped
+/// by the wait site.
+///
+/// Only every `sample_every`-th suspension is measured, its stack is captured
+/// and is symbolized on statistics collection. Each worker thread accounts into
+/// its own shard, shards are merged on statistics collection.
+class WaitStatsStorage final {
+ public:
+  // Name for the waits that did not fit into the shard
+  static constexpr std::string_view kOverflowName = "<other>";
+
+  // Name for the frames that could not be symbolized
+  static constexpr std::string_view kUnknownName = "<unknown>";
+
+  // Limits the memory consumption in case of unbounded recursion or JIT
+  static constexpr std::size_t kMaxSitesPerThread = 1000;
+
+  WaitStatsStorage(std::size_t thread_count, std::size_t sample_every,
+                   std::size_t top_size);
+
+  // Must be called from a thread bound with SetLocalWaitStatsStorage
+  bool ShouldSample() noexcept;
+
+  static WaitSite CaptureSite() noexcept;
+
+  // Must be called from a thread bound with SetLocalWaitStatsStorage
+  void AccountWait(const WaitSite& site, std::chrono::nanoseconds wait_time);
+
+  /// Up to `top_size` wait sites with the most total wait time, sorted
+  std::vector<NamedWaitStats> GetTopByWaitTime() const;
+
+ private:
+  struct SiteStats final {
+    std::uint64_t waits{0};
+    std::chrono::nanoseconds wait_time{0};
+    utils::statistics::Histogram wait_time_ms;
+  };
+
+  struct Shard final {
+    // Only used by the owning thread
+    std::size_t waits_till_sample{0};
+
+    mutable std::mutex mutex;
+    std::unordered_map<WaitSite, SiteStats, WaitSiteHash> stats;
+  };
+
+  Shard& GetLocalShard() noexcept;
+
+  std::vector<NamedWaitStats> Collect() const;
+
+  // Must be called with the `names_mutex_` locked
+  const std::string& GetFrameName(void* address) const;
+
+  const std::size_t sample_every_;
+  const std::size_t top_size_;
+  utils::FixedArray<concurrent::impl::InterferenceShield<Shard>> shards_;
+
+  mutable std::mutex names_mutex_;
+  mutable std::unordered_map<void*, std::string> frame_names_;
+};
+
+void SetLocalWaitStatsStorage(WaitStatsStorage& storage,
+                              std::size_t thread_index);
+
+}  // namespace engine::impl
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,80 @@
+#include <engine/task/wait_stats.hpp>
+
+#include <chrono>
+#include <cstdint>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <engine/impl/standalone.hpp>
+#include <engine/task/task_processor.hpp>
+#include <engine/task/task_processor_config.hpp>
+#include <userver/engine/sleep.hpp>
+#include <userver/engine/task/task.hpp>
+#include <userver/utils/async.hpp>
+#include <userver/utils/function_ref.hpp>
+
+using namespace std::chrono_literals;
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+void RunWithWaitStats(std::size_t sample_every,
+                      utils::function_ref<void()> payload) {
+  engine::TaskProcessorConfig config;
+  config.worker_threads = 1;
+  config.thread_name = "wait-stats-worker";
+  config.wait_stats_sample_every = sample_every;
+  engine::impl::RunStandalone(std::move(config), {}, payload);
+}
+
+const engine::impl::WaitStatsStorage& GetStorage() {
+  const auto* storage = engine::current_task::GetTaskProcessor().GetWaitStats();
+  EXPECT_TRUE(storage);
+  return *storage;
+}
+
+std::uint64_t GetTotalWaits(
+    const std::vector<engine::impl::NamedWaitStats>& top) {
+  std::uint64_t waits = 0;
+  for (const auto& entry : top) waits += entry.waits;
+  return waits;
+}
+
+}  // namespace
+
+TEST(WaitStats, Disabled) {
+  engine::impl::RunStandalone(engine::TaskProcessorConfig{}, {}, [] {
+    EXPECT_FALSE(engine::current_task::GetTaskProcessor().GetWaitStats());
+  });
+}
+
+TEST(WaitStats, Sleep) {
+  RunWithWaitStats(1, [] {
+    utils::Async("sleeper", [] { engine::SleepFor(20ms); }).Get();
+
+    const auto top = GetStorage().GetTopByWaitTime();
+    ASSERT_FALSE(top.empty());
+    EXPECT_FALSE(top[0].primitive.empty());
+    EXPECT_FALSE(top[0].call_site.empty());
+    EXPECT_GE(top[0].wait_time, 20ms);
+    EXPECT_GE(top[0].wait_time_ms.GetView().GetTotalCount(), 1);
+  });
+}
+
+TEST(WaitStats, Sampling) {
+  RunWithWaitStats(3, [] {
+    // The waits of the main task are sampled too, measure the difference
+    const auto waits_before = GetTotalWaits(GetStorage().GetTopByWaitTime());
+    utils::Async("sleeper", [] {
+      for (int i = 0; i < 30; ++i) engine::SleepFor(1ms);
+    }).Get();
+    const auto waits_after = GetTotalWaits(GetStorage().GetTopByWaitTime());
+
+    EXPECT_GE(waits_after - waits_before, 10);
+    EXPECT_LE(waits_after - waits_before, 11);
+  });
+}
+
+USERVER_NAMESPACE_END
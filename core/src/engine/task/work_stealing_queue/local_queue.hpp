@@ -0,0 +1,85 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+#include <userver/concurrent/impl/interference_shield.hpp>
+#include <userver/utils/assert.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace engine::impl {
+
+/// @brief Bounded single-producer multi-consumer ring buffer of pointers.
+///
+/// Only the owning worker pushes, any worker (including the owner) may pop.
+/// Pop takes items in FIFO order, so the owner and the thieves compete only on
+/// `head_`, while `tail_` is written by the owner alone.
+///
+/// Null pointers may not be stored in the queue.
+template <typename T, std::size_t Capacity>
+class LocalQueue final {
+  static_assert(Capacity > 1 && (Capacity & (Capacity - 1)) == 0,
+                "Capacity must be a power of 2");
+
+ public:
+  LocalQueue() {
+    for (auto& item : buffer_) item.store(nullptr, std::memory_order_relaxed);
+  }
+
+  LocalQueue(const LocalQueue&) = delete;
+  LocalQueue& operator=(const LocalQueue&) = delete;
+
+  static constexpr std::size_t GetCapacity() noexcept { return Capacity; }
+
+  /// Must only be called from the owning thread. Returns `false` if the queue
+  /// is full.
+  [[nodiscard]] bool TryPush(T* item) noexcept {
+    UASSERT(item);
+    const auto tail = tail_->load(std::memory_order_relaxed);
+    const auto head = head_->load(std::memory_order_acquire);
+    if (tail - head >= Capacity) return false;
+
+    buffer_[tail & kMask].store(item, std::memory_order_relaxed);
+    tail_->store(tail + 1, std::memory_order_release);
+    return true;
+  }
+
+  /// May be called from any thread. Returns `nullptr` if the queue is empty.
+  T* TryPop() noexcept {
+    auto head = head_->load(std::memory_order_acquire);
+    while (true) {
+      const auto tail = tail_->load(std::memory_order_acquire);
+      if (head == tail) return nullptr;
+
+      // The slot can't be overwritten by the owner until `head_` is moved past
+      // it, so the value is valid if the CAS succeeds.
+      auto* const item = buffer_[head & kMask].load(std::memory_order_relaxed);
+      if (head_->compare_exchange_weak(head, head + 1,
+                                       std::memory_order_acq_rel,
+                                       std::memory_order_acquire)) {
+        UASSERT(item);
+        return item;
+      }
+    }
+  }
+
+  std::size_t GetSizeApproximate() const noexcept {
+    const auto head = head_->load(std::memory_order_relaxed);
+    const auto tail = tail_->load(std::memory_order_relaxed);
+    return tail > head ? static_cast<std::size_t>(tail - head) : 0;
+  }
+
+ private:
+  static constexpr std::uint64_t kMask = Capacity - 1;
+
+  std::array<std::atomic<T*>, Capacity> buffer_;
+  concurrent::impl::InterferenceShield<std::atomic<std::uint64_t>> head_{0};
+  concurrent::impl::InterferenceShield<std::atomic<std::uint64_t>> tail_{0};
+};
+
+}  // namespace engine::impl
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,97 @@
+#include <engine/task/work_stealing_queue/local_queue.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+struct Item final {
+  std::size_t value{0};
+};
+
+constexpr std::size_t kCapacity = 8;
+using Queue = engine::impl::LocalQueue<Item, kCapacity>;
+
+}  // namespace
+
+TEST(WorkStealingLocalQueue, Empty) {
+  Queue queue;
+  EXPECT_EQ(queue.TryPop(), nullptr);
+  EXPECT_EQ(queue.GetSizeApproximate(), 0);
+}
+
+TEST(WorkStealingLocalQueue, Fifo) {
+  Queue queue;
+  std::vector<Item> items(kCapacity);
+
+  for (auto& item : items) EXPECT_TRUE(queue.TryPush(&item));
+  EXPECT_EQ(queue.GetSizeApproximate(), kCapacity);
+
+  Item extra;
+  EXPECT_FALSE(queue.TryPush(&extra));
+
+  for (auto& item : items) EXPECT_EQ(queue.TryPop(), &item);
+  EXPECT_EQ(queue.TryPop(), nullptr);
+}
+
+TEST(WorkStealingLocalQueue, WrapAround) {
+  Queue queue;
+  std::vector<Item> items(kCapacity * 3);
+
+  for (std::size_t i = 0; i < items.size(); ++i) {
+    ASSERT_TRUE(queue.TryPush(&items[i]));
+    ASSERT_EQ(queue.TryPop(), &items[i]);
+  }
+  EXPECT_EQ(queue.GetSizeApproximate(), 0);
+}
+
+TEST(WorkStealingLocalQueue, ConcurrentSteal) {
+  constexpr std::size_t kThieves = 3;
+  constexpr std::size_t kItems = 100'000;
+
+  engine::impl::LocalQueue<Item, 256> queue;
+  std::vector<Item> items(kItems);
+  std::vector<std::atomic<std::size_t>> popped_count(kItems);
+  std::atomic<bool> producer_done{false};
+
+  const auto consume = [&] {
+    while (true) {
+      auto* const item = queue.TryPop();
+      if (item) {
+        ++popped_count[item->value];
+      } else if (producer_done) {
+        return;
+      }
+    }
+  };
+
+  std::vector<std::thread> thieves;
+  for (std::size_t i = 0; i < kThieves; ++i) thieves.emplace_back(consume);
+
+  for (std::size_t i = 0; i < kItems; ++i) {
+    items[i].value = i;
+    while (!queue.TryPush(&items[i])) {
+      // The owner pops too, as TaskProcessor workers do
+      auto* const item = queue.TryPop();
+      if (item) ++popped_count[item->value];
+    }
+  }
+  producer_done = true;
+  // Drain the rest, thieves may have already exited
+  consume();
+
+  for (auto& thief : thieves) thief.join();
+
+  for (std::size_t i = 0; i < kItems; ++i) {
+    ASSERT_EQ(popped_count[i].load(), 1) << "item " << i;
+  }
+}
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,205 @@
+#include <engine/task/work_stealing_queue/task_queue.hpp>
+
+#include <algorithm>
+
+#include <engine/task/task_context.hpp>
+#include <userver/utils/rand.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace engine {
+
+namespace {
+
+constexpr std::size_t kSemaphoreInitialCount = 0;
+
+// Check the global queue before the local one once in a while, otherwise
+// tasks scheduled from ev-threads could starve behind the local ones.
+constexpr std::size_t kGlobalQueueCheckPeriod = 61;
+
+// A pair of tasks that wake each other up would otherwise occupy the LIFO
+// slot forever.
+constexpr std::size_t kMaxConsecutiveLifoPops = 3;
+
+// Current thread handles only a single TaskProcessor, so it's safe to store
+// the consumer of the task processor in a thread-local variable.
+thread_local const void* local_queue_owner = nullptr;
+thread_local void* local_consumer = nullptr;
+
+}  // namespace
+
+WorkStealingTaskQueue::WorkStealingTaskQueue(const TaskProcessorConfig& config)
+    : consumers_(config.worker_threads),
+      queue_semaphore_(kSemaphoreInitialCount, config.spinning_iterations) {}
+
+void WorkStealingTaskQueue::Push(
+    boost::intrusive_ptr<impl::TaskContext>&& context) {
+  UASSERT(context);
+  DoPush(context.get());
+  context.detach();
+}
+
+void WorkStealingTaskQueue::PushBulk(
+    utils::span<impl::TaskContext* const> contexts) {
+  global_queue_.enqueue_bulk(contexts.begin(), contexts.size());
+  queue_semaphore_.signal(contexts.size());
+}
+
+boost::intrusive_ptr<impl::TaskContext> WorkStealingTaskQueue::PopBlocking() {
+  thread_local moodycamel::ConsumerToken token(global_queue_);
+
+  auto* consumer = GetLocalConsumer();
+  if (!consumer) {
+    const auto index = registered_consumers_.fetch_add(1);
+    UINVARIANT(index < consumers_.size(),
+               "More threads are popping from WorkStealingTaskQueue than "
+               "there are TaskProcessor workers");
+    consumer = &consumers_[index];
+    local_queue_owner = this;
+    local_consumer = consumer;
+  }
+
+  boost::intrusive_ptr<impl::TaskContext> context{
+      DoPopBlocking(*consumer, token), /* add_ref= */ false};
+
+  if (!context) {
+    // return "stop" token back
+    global_queue_.enqueue(nullptr);
+    queue_semaphore_.signal();
+  }
+
+  return context;
+}
+
+void WorkStealingTaskQueue::StopProcessing() {
+  global_queue_.enqueue(nullptr);
+  queue_semaphore_.signal();
+}
+
+std::size_t WorkStealingTaskQueue::GetSizeApproximate() const noexcept {
+  std::size_t size = global_queue_.size_approx();
+  for (const auto& consumer : consumers_) {
+    size += consumer.local_queue.GetSizeApproximate();
+    if (consumer.lifo_slot->load(std::memory_order_relaxed)) ++size;
+  }
+  return size;
+}
+
+WorkStealingTaskQueue::Consumer*
+WorkStealingTaskQueue::GetLocalConsumer() noexcept {
+  if (local_queue_owner != this) return nullptr;
+  return static_cast<Consumer*>(local_consumer);
+}
+
+void WorkStealingTaskQueue::DoPush(impl::TaskContext* context) {
+  UASSERT(context);
+  auto* const consumer = GetLocalConsumer();
+  if (consumer) {
+    // Freshly spawned or woken up tasks are likely to touch the same data as
+    // the current task, so we'd like to run them next on the same thread.
+    auto* const previous = consumer->lifo_slot->exchange(context);
+    if (previous && !consumer->local_queue.TryPush(previous)) {
+      global_queue_.enqueue(previous);
+    }
+  } else {
+    global_queue_.enqueue(context);
+  }
+  queue_semaphore_.signal();
+}
+
+impl::TaskContext* WorkStealingTaskQueue::DoPopBlocking(
+    Consumer& consumer, moodycamel::ConsumerToken& token) {
+  // Each successful wait() accounts for exactly one task (or a stop token)
+  // in one of the queues. The item may be in transit between the queues for
+  // a short period of time, so we spin until it's found.
+  queue_semaphore_.wait();
+
+  ++consumer.pops_count;
+  const bool check_global_first =
+      consumer.pops_count % kGlobalQueueCheckPeriod == 0;
+
+  while (true) {
+    impl::TaskContext* context{};
+
+    if (check_global_first && global_queue_.try_dequeue(token, context)) {
+      consumer.consecutive_lifo_pops = 0;
+      return context;
+    }
+
+    context = TryPopLocal(consumer);
+    if (context) return context;
+
+    if (global_queue_.try_dequeue(token, context)) {
+      consumer.consecutive_lifo_pops = 0;
+      return context;
+    }
+
+    context = TrySteal(consumer);
+    if (context) return context;
+  }
+}
+
+impl::TaskContext* WorkStealingTaskQueue::TryPopLocal(
+    Consumer& consumer) noexcept {
+  if (consumer.consecutive_lifo_pops < kMaxConsecutiveLifoPops) {
+    auto* const context = consumer.lifo_slot->exchange(nullptr);
+    if (context) {
+      ++consumer.consecutive_lifo_pops;
+      return context;
+    }
+  }
+
+  consumer.consecutive_lifo_pops = 0;
+  auto* context = consumer.local_queue.TryPop();
+  if (!context) context = consumer.lifo_slot->exchange(nullptr);
+  return context;
+}
+
+impl::TaskContext* WorkStealingTaskQueue::TrySteal(Consumer& thief) noexcept {
+  const auto consumers_count = consumers_.size();
+  if (consumers_count < 2) return nullptr;
+
+  const auto start = utils::RandRange(consumers_count);
+  for (std::size_t i = 0; i < consumers_count; ++i) {
+    auto& victim = consumers_[(start + i) % consumers_count];
+    if (&victim == &thief) continue;
+
+    auto* const context = TryStealFrom(thief, victim);
+    if (context) {
+      thief.consecutive_lifo_pops = 0;
+      return context;
+    }
+  }
+  return nullptr;
+}
+
+impl::TaskContext* WorkStealingTaskQueue::TryStealFrom(
+    Consumer& thief, Consumer& victim) noexcept {
+  auto* const first = victim.local_queue.TryPop();
+  if (!first) {
+    // The victim may be busy running a long task, don't let the task in its
+    // LIFO slot wait for it.
+    return victim.lifo_slot->exchange(nullptr);
+  }
+
+  // Steal up to a half of the victim's tasks at once to amortize the cost of
+  // stealing. Our local queue is empty at this point, because we only steal
+  // after failing to pop from it.
+  const auto to_steal =
+      std::min(victim.local_queue.GetSizeApproximate() / 2,
+               decltype(thief.local_queue)::GetCapacity() / 2);
+  for (std::size_t i = 0; i < to_steal; ++i) {
+    auto* const context = victim.local_queue.TryPop();
+    if (!context) break;
+    if (!thief.local_queue.TryPush(context)) {
+      global_queue_.enqueue(context);
+      break;
+    }
+  }
+
+  return first;
+}
+
+}  // namespace engine
+
+USERVER_NAMESPACE_END
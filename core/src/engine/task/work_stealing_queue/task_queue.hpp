@@ -0,0 +1,88 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+#include <moodycamel/concurrentqueue.h>
+#include <moodycamel/lightweightsemaphore.h>
+#include <boost/smart_ptr/intrusive_ptr.hpp>
+
+#include <engine/task/task_processor_config.hpp>
+#include <engine/task/work_stealing_queue/local_queue.hpp>
+#include <userver/concurrent/impl/interference_shield.hpp>
+#include <userver/utils/fixed_array.hpp>
+#include <userver/utils/span.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace engine {
+
+namespace impl {
+class TaskContext;
+}  // namespace impl
+
+/// @brief Task queue with per-worker local queues and work stealing.
+///
+/// Tasks scheduled from a worker thread of the owning TaskProcessor go to the
+/// worker's LIFO slot, the previous occupant of the slot is moved to the
+/// worker's local queue. Tasks scheduled from other threads (ev-threads,
+/// other task processors) go to the shared global queue. Idle workers steal
+/// from their siblings.
+///
+/// The number of available tasks is tracked by a single semaphore, so that
+/// a woken worker is guaranteed to find some task in one of the queues.
+class WorkStealingTaskQueue final {
+ public:
+  explicit WorkStealingTaskQueue(const TaskProcessorConfig& config);
+
+  void Push(boost::intrusive_ptr<impl::TaskContext>&& context);
+
+  // Adopts a reference to each of the contexts. The contexts go to the global
+  // queue, so that a batch is spread across the workers.
+  void PushBulk(utils::span<impl::TaskContext* const> contexts);
+
+  // Returns nullptr as a stop signal
+  boost::intrusive_ptr<impl::TaskContext> PopBlocking();
+
+  void StopProcessing();
+
+  std::size_t GetSizeApproximate() const noexcept;
+
+ private:
+  static constexpr std::size_t kLocalQueueCapacity = 256;
+
+  struct Consumer final {
+    impl::LocalQueue<impl::TaskContext, kLocalQueueCapacity> local_queue;
+    concurrent::impl::InterferenceShield<std::atomic<impl::TaskContext*>>
+        lifo_slot{nullptr};
+
+    // Only accessed by the owning worker thread
+    std::size_t pops_count{0};
+    std::size_t consecutive_lifo_pops{0};
+  };
+
+  Consumer* GetLocalConsumer() noexcept;
+
+  void DoPush(impl::TaskContext* context);
+
+  impl::TaskContext* DoPopBlocking(Consumer& consumer,
+                                   moodycamel::ConsumerToken& token);
+
+  impl::TaskContext* TryPopLocal(Consumer& consumer) noexcept;
+
+  impl::TaskContext* TryPopGlobal(moodycamel::ConsumerToken& token) noexcept;
+
+  impl::TaskContext* TrySteal(Consumer& thief) noexcept;
+
+  impl::TaskContext* TryStealFrom(Consumer& thief, Consumer& victim) noexcept;
+
+  utils::FixedArray<Consumer> consumers_;
+  std::atomic<std::size_t> registered_consumers_{0};
+  moodycamel::ConcurrentQueue<impl::TaskContext*> global_queue_;
+  moodycamel::LightweightSemaphore queue_semaphore_;
+};
+
+}  // namespace engine
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,89 @@
+#include <engine/task/work_stealing_queue/task_queue.hpp>
+
+#include <atomic>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <engine/impl/standalone.hpp>
+#include <engine/task/task_processor_config.hpp>
+#include <userver/engine/async.hpp>
+#include <userver/engine/sleep.hpp>
+#include <userver/engine/task/task_with_result.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+void RunWorkStealing(std::size_t worker_threads,
+                     utils::function_ref<void()> payload) {
+  engine::TaskProcessorConfig config;
+  config.worker_threads = worker_threads;
+  config.thread_name = "ws-worker";
+  config.task_processor_queue = engine::TaskQueueType::kWorkStealingTaskQueue;
+  engine::impl::RunStandalone(std::move(config), {}, payload);
+}
+
+}  // namespace
+
+TEST(WorkStealingTaskQueue, SingleThread) {
+  RunWorkStealing(1, [] {
+    std::atomic<int> counter{0};
+    auto task = engine::AsyncNoSpan([&] { ++counter; });
+    task.Get();
+    EXPECT_EQ(counter, 1);
+  });
+}
+
+TEST(WorkStealingTaskQueue, FanOut) {
+  constexpr std::size_t kSubtasks = 10'000;
+
+  RunWorkStealing(4, [] {
+    std::atomic<std::size_t> counter{0};
+    std::vector<engine::TaskWithResult<void>> tasks;
+    tasks.reserve(kSubtasks);
+    for (std::size_t i = 0; i < kSubtasks; ++i) {
+      tasks.push_back(engine::AsyncNoSpan([&] {
+        engine::Yield();
+        ++counter;
+      }));
+    }
+    for (auto& task : tasks) task.Get();
+    EXPECT_EQ(counter, kSubtasks);
+  });
+}
+
+TEST(WorkStealingTaskQueue, LongTaskDoesNotBlockLifoSlot) {
+  RunWorkStealing(2, [] {
+    std::atomic<bool> subtask_done{false};
+
+    auto blocker = engine::AsyncNoSpan([&] {
+      // Lands into our LIFO slot. Another worker has to steal it while we
+      // are spinning here.
+      auto subtask = engine::AsyncNoSpan([&] { subtask_done = true; });
+      while (!subtask_done) {
+      }
+      subtask.Get();
+    });
+    blocker.Get();
+    EXPECT_TRUE(subtask_done);
+  });
+}
+
+TEST(WorkStealingTaskQueue, NestedWaits) {
+  RunWorkStealing(3, [] {
+    std::vector<engine::TaskWithResult<int>> tasks;
+    for (int i = 0; i < 100; ++i) {
+      tasks.push_back(engine::AsyncNoSpan([i] {
+        auto nested = engine::AsyncNoSpan([i] {
+          engine::SleepFor(std::chrono::milliseconds{1});
+          return i;
+        });
+        return nested.Get();
+      }));
+    }
+    for (int i = 0; i < 100; ++i) EXPECT_EQ(tasks[i].Get(), i);
+  });
+}
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,71 @@
+#include <userver/engine/task_completion_queue.hpp>
+
+#include <moodycamel/concurrentqueue.h>
+
+#include <userver/engine/exception.hpp>
+#include <userver/engine/single_consumer_event.hpp>
+#include <userver/engine/task/cancel.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace engine::impl {
+
+class TaskCompletionChannel final {
+ public:
+  void Push(std::size_t index) {
+    queue_.enqueue(index);
+    event_.Send();
+  }
+
+  std::optional<std::size_t> PopUntil(Deadline deadline) {
+    std::size_t index{};
+    if (!event_.WaitUntil(deadline,
+                          [&] { return queue_.try_dequeue(index); })) {
+      return std::nullopt;
+    }
+    return index;
+  }
+
+ private:
+  moodycamel::ConcurrentQueue<std::size_t> queue_;
+  SingleConsumerEvent event_;
+};
+
+TaskCompletionNotifier::TaskCompletionNotifier(
+    std::shared_ptr<TaskCompletionChannel> channel, std::size_t index) noexcept
+    : channel_(std::move(channel)), index_(index) {}
+
+TaskCompletionNotifier::~TaskCompletionNotifier() {
+  if (channel_) channel_->Push(index_);
+}
+
+TaskCompletionQueueBase::TaskCompletionQueueBase()
+    : channel_(std::make_shared<TaskCompletionChannel>()) {}
+
+TaskCompletionQueueBase::TaskCompletionQueueBase(
+    TaskCompletionQueueBase&&) noexcept = default;
+
+TaskCompletionQueueBase& TaskCompletionQueueBase::operator=(
+    TaskCompletionQueueBase&&) noexcept = default;
+
+TaskCompletionQueueBase::~TaskCompletionQueueBase() = default;
+
+TaskCompletionNotifier TaskCompletionQueueBase::MakeNotifier(
+    std::size_t index) const {
+  UASSERT(channel_);
+  return TaskCompletionNotifier{channel_, index};
+}
+
+std::optional<std::size_t> TaskCompletionQueueBase::PopUntil(
+    Deadline deadline) {
+  UASSERT(channel_);
+  return channel_->PopUntil(deadline);
+}
+
+void TaskCompletionQueueBase::ThrowWaitInterrupted() {
+  throw WaitInterruptedException(current_task::CancellationReason());
+}
+
+}  // namespace engine::impl
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,54 @@
+#include <userver/engine/task_completion_queue.hpp>
+
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include <userver/engine/async.hpp>
+#include <userver/engine/run_standalone.hpp>
+#include <userver/engine/wait_any.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+void task_completion_wait_any(benchmark::State& state) {
+  engine::RunStandalone(4, [&] {
+    const auto task_count = static_cast<std::size_t>(state.range(0));
+    for ([[maybe_unused]] auto _ : state) {
+      std::vector<engine::TaskWithResult<std::size_t>> tasks;
+      tasks.reserve(task_count);
+      for (std::size_t i = 0; i < task_count; ++i) {
+        tasks.push_back(engine::AsyncNoSpan([i] { return i; }));
+      }
+
+      std::size_t sum = 0;
+      while (const auto index = engine::WaitAny(tasks)) {
+        sum += tasks[*index].Get();
+      }
+      benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+  });
+}
+BENCHMARK(task_completion_wait_any)->RangeMultiplier(4)->Range(16, 4096);
+
+void task_completion_queue(benchmark::State& state) {
+  engine::RunStandalone(4, [&] {
+    const auto task_count = static_cast<std::size_t>(state.range(0));
+    for ([[maybe_unused]] auto _ : state) {
+      engine::TaskCompletionQueue<std::size_t> queue;
+      for (std::size_t i = 0; i < task_count; ++i) {
+        queue.AsyncNoSpan([i] { return i; });
+      }
+
+      std::size_t sum = 0;
+      while (auto completion = queue.WaitNext()) {
+        sum += completion->task.Get();
+      }
+      benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+  });
+}
+BENCHMARK(task_completion_queue)->RangeMultiplier(4)->Range(16, 4096);
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,113 @@
+#include <userver/utest/utest.hpp>
+
+#include <algorithm>
+#include <stdexcept>
+#include <vector>
+
+#include <userver/engine/single_consumer_event.hpp>
+#include <userver/engine/task/cancel.hpp>
+#include <userver/engine/task_completion_queue.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+UTEST(TaskCompletionQueue, Sample) {
+  /// [Sample TaskCompletionQueue]
+  engine::TaskCompletionQueue<int> queue;
+  for (int i = 0; i < 10; ++i) {
+    queue.AsyncNoSpan([i] { return i * i; });
+  }
+
+  int sum = 0;
+  while (auto completion = queue.WaitNext()) {
+    sum += completion->task.Get();
+  }
+  EXPECT_EQ(sum, 285);
+  /// [Sample TaskCompletionQueue]
+}
+
+UTEST(TaskCompletionQueue, CompletionOrder) {
+  constexpr std::size_t kTaskCount = 4;
+  std::vector<engine::SingleConsumerEvent> events(kTaskCount);
+
+  engine::TaskCompletionQueue<std::size_t> queue;
+  for (std::size_t i = 0; i < kTaskCount; ++i) {
+    EXPECT_EQ(queue.AsyncNoSpan([&events, i] {
+      EXPECT_TRUE(events[i].WaitForEvent());
+      return i;
+    }),
+              i);
+  }
+  EXPECT_EQ(queue.GetPendingCount(), kTaskCount);
+
+  for (std::size_t i = kTaskCount; i-- > 0;) {
+    events[i].Send();
+    auto completion = queue.WaitNext();
+    ASSERT_TRUE(completion);
+    EXPECT_EQ(completion->index, i);
+    EXPECT_TRUE(completion->task.IsFinished());
+    EXPECT_EQ(completion->task.Get(), i);
+  }
+  EXPECT_EQ(queue.GetPendingCount(), 0);
+  EXPECT_FALSE(queue.WaitNext());
+}
+
+UTEST(TaskCompletionQueue, Exception) {
+  engine::TaskCompletionQueue<void> queue;
+  queue.AsyncNoSpan([] { throw std::runtime_error("test"); });
+
+  auto completion = queue.WaitNext();
+  ASSERT_TRUE(completion);
+  UEXPECT_THROW(completion->task.Get(), std::runtime_error);
+}
+
+UTEST(TaskCompletionQueue, Deadline) {
+  engine::SingleConsumerEvent event;
+  engine::TaskCompletionQueue<void> queue;
+  queue.AsyncNoSpan([&event] { EXPECT_TRUE(event.WaitForEvent()); });
+
+  EXPECT_FALSE(queue.WaitNextUntil(engine::Deadline::Passed()));
+  EXPECT_EQ(queue.GetPendingCount(), 1);
+
+  event.Send();
+  EXPECT_TRUE(queue.WaitNextUntil(engine::Deadline::FromDuration(
+      utest::kMaxTestWaitTime)));
+}
+
+UTEST(TaskCompletionQueue, Cancelled) {
+  engine::SingleConsumerEvent event;
+  engine::TaskCompletionQueue<void> queue;
+  queue.AsyncNoSpan([&event] { (void)event.WaitForEvent(); });
+
+  engine::current_task::GetCancellationToken().RequestCancel();
+  UEXPECT_THROW(queue.WaitNext(), engine::WaitInterruptedException);
+  EXPECT_EQ(queue.GetPendingCount(), 1);
+}
+
+UTEST(TaskCompletionQueue, DestructionCancelsTasks) {
+  engine::SingleConsumerEvent event;
+  {
+    engine::TaskCompletionQueue<void> queue;
+    queue.AsyncNoSpan([&event] { (void)event.WaitForEvent(); });
+    queue.AsyncNoSpan([&event] { (void)event.WaitForEvent(); });
+  }
+}
+
+UTEST_MT(TaskCompletionQueue, ManyTasks, 4) {
+  constexpr std::size_t kTaskCount = 5000;
+  engine::TaskCompletionQueue<std::size_t> queue;
+  for (std::size_t i = 0; i < kTaskCount; ++i) {
+    queue.AsyncNoSpan([i] { return i; });
+  }
+
+  std::vector<bool> is_delivered(kTaskCount, false);
+  while (auto completion = queue.WaitNext()) {
+    EXPECT_EQ(completion->task.Get(), completion->index);
+    EXPECT_FALSE(is_delivered[completion->index]);
+    is_delivered[completion->index] = true;
+  }
+  EXPECT_EQ(static_cast<std::size_t>(std::count(is_delivered.begin(),
+                                                is_delivered.end(), true)),
+            kTaskCount);
+}
+
+USERVER_NAMESPACE_END
@@ -3,6 +3,9 @@
 #include <boost/filesystem.hpp>
 #include <boost/filesystem/operations.hpp>
 
+#include <compression/gzip.hpp>
+#include <userver/compression/zstd.hpp>
+#include <userver/crypto/hash.hpp>
 #include <userver/engine/task/task_processor_fwd.hpp>
 #include <userver/fs/read.hpp>
 #include <userver/rcu/rcu_map.hpp>
@@ -29,6 +32,23 @@ std::string GetNormalizeDirectory(std::string_view dir) {
 
 namespace fs {
 
+namespace {
+
+// Smaller files gain little from compression
+constexpr std::size_t kPrecompressMinSize = 1024;
+
+// The files are compressed once, so the levels are high
+constexpr int kGzipLevel = 9;
+constexpr int kZstdLevel = 15;
+
+// Keeps the compressed data only if it is noticeably smaller
+std::string KeepIfSmaller(std::string compressed, std::size_t original_size) {
+  if (compressed.size() >= original_size - original_size / 10) return {};
+  return compressed;
+}
+
+}  // namespace
+
 #ifdef __linux__
 namespace {
 
@@ -42,8 +62,11 @@ bool IsFilepathHidden(const std::string& path) {
 
 FsCacheClient::FsCacheClient(std::string_view dir,
                              std::chrono::milliseconds update_period,
-                             engine::TaskProcessor& tp)
-    : dir_(GetNormalizeDirectory(dir)), update_period_(update_period), tp_(tp) {
+                             engine::TaskProcessor& tp, bool precompress)
+    : dir_(GetNormalizeDirectory(dir)),
+      update_period_(update_period),
+      tp_(tp),
+      precompress_(precompress) {
   UpdateCache();
 
   if (update_period_ == std::chrono::milliseconds(0)) {
@@ -63,9 +86,29 @@ FsCacheClient::FsCacheClient(std::string_view dir,
 void FsCacheClient::UpdateCache() {
   auto map = fs::ReadRecursiveFilesInfoWithData(
       tp_, dir_, {fs::SettingsReadFile::kSkipHidden});
+  utils::Async(tp_, "fs_cache_prepare", [this, &map] {
+    for (auto& [path, info] : map) {
+      // The read infos are const, so the copy has to be made
+      info = PrepareFile(FileInfoWithData{*info});
+    }
+  }).Get();
   data_.Assign(std::move(map));
 }
 
+FileInfoWithDataConstPtr FsCacheClient::PrepareFile(
+    FileInfoWithData&& info) const {
+  info.etag = '"' + crypto::hash::Sha1(info.data) + '"';
+
+  if (precompress_ && info.data.size() >= kPrecompressMinSize) {
+    info.gzip_data = KeepIfSmaller(
+        compression::gzip::Compress(info.data, kGzipLevel), info.data.size());
+    info.zstd_data = KeepIfSmaller(
+        compression::zstd::Compress(info.data, kZstdLevel), info.data.size());
+  }
+
+  return std::make_shared<const FileInfoWithData>(std::move(info));
+}
+
 #ifdef __linux__
 void FsCacheClient::InotifyWork() {
   namespace sys_linux = engine::io::sys_linux;
@@ -115,9 +158,10 @@ void FsCacheClient::HandleCreate(const std::string& path) {
   FileInfoWithData info{};
   info.extension = boost::filesystem::path(path).extension().string();
   info.data = ReadFileContents(tp_, path);
-  data_.InsertOrAssign(
-      GetLexicallyRelative(path, dir_),
-      std::make_shared<const FileInfoWithData>(std::move(info)));
+  auto prepared = utils::Async(tp_, "fs_cache_prepare", [this, &info] {
+                    return PrepareFile(std::move(info));
+                  }).Get();
+  data_.InsertOrAssign(GetLexicallyRelative(path, dir_), std::move(prepared));
 }
 
 void FsCacheClient::HandleCreateDirectory(
@@ -1,5 +1,7 @@
 #include <userver/fs/read.hpp>
 
+#include <optional>
+
 #include <boost/filesystem.hpp>
 
 #include <userver/engine/async.hpp>
@@ -36,25 +38,35 @@ std::string ReadFileContents(engine::TaskProcessor& async_tp,
 FileInfoWithDataMap ReadRecursiveFilesInfoWithData(
     engine::TaskProcessor& async_tp, const std::string& path,
     utils::Flags<SettingsReadFile> flags) {
+  using DirectoryIterator = boost::filesystem::recursive_directory_iterator;
+
   FileInfoWithDataMap data{};
-  for (auto it =
-           utils::Async(
-               async_tp, "init",
-               [&path] {
-                 return boost::filesystem::recursive_directory_iterator(path);
-               })
-               .Get();
-       it != boost::filesystem::recursive_directory_iterator();
-       utils::Async(async_tp, "next", [&it] { ++it; }).Get()) {
-    // only files
-    if (it->status().type() != boost::filesystem::regular_file) continue;
-    if ((flags & SettingsReadFile::kSkipHidden) && IsHiddenFile(it->path()))
-      continue;
-    FileInfoWithData info{};
-    info.extension = it->path().extension().string();
-    info.data = ReadFileContents(async_tp, it->path().string());
+  auto it = utils::Async(async_tp, "init", [&path] {
+              return DirectoryIterator(path);
+            }).Get();
+
+  // Advancing to the next file and reading it is done in a single task to
+  // switch to `async_tp` once per file
+  const auto read_next_file = [&it, flags](bool advance) {
+    if (advance) ++it;
+    for (; it != DirectoryIterator(); ++it) {
+      // only files
+      if (it->status().type() != boost::filesystem::regular_file) continue;
+      if ((flags & SettingsReadFile::kSkipHidden) && IsHiddenFile(it->path()))
+        continue;
+
+      FileInfoWithData info{};
+      info.extension = it->path().extension().string();
+      info.data = fs::blocking::ReadFileContents(it->path().string());
+      return std::optional{std::move(info)};
+    }
+    return std::optional<FileInfoWithData>{};
+  };
+
+  for (auto info = utils::Async(async_tp, "next", read_next_file, false).Get();
+       info; info = utils::Async(async_tp, "next", read_next_file, true).Get()) {
     data[GetLexicallyRelative(it->path().string(), path)] =
-        std::make_shared<const FileInfoWithData>(std::move(info));
+        std::make_shared<const FileInfoWithData>(std::move(*info));
   }
   return data;
 }
@@ -4,6 +4,7 @@
 #include <stdexcept>
 
 #include <logging/config.hpp>
+#include <logging/dynamic_debug.hpp>
 #include <logging/impl/tcp_socket_sink.hpp>
 #include <logging/tp_logger.hpp>
 #include <logging/tp_logger_utils.hpp>
@@ -17,6 +18,7 @@
 #include <userver/logging/logger.hpp>
 #include <userver/os_signals/component.hpp>
 #include <userver/utils/algo.hpp>
+#include <userver/utils/statistics/rate.hpp>
 #include <userver/utils/statistics/writer.hpp>
 #include <userver/utils/thread_name.hpp>
 #include <userver/yaml_config/map_to_array.hpp>
@@ -105,6 +107,10 @@ void Logging::Init(const ComponentConfig& config,
     }
   }
 
+  if (config["async-stacktrace-symbolization"].As<bool>(false)) {
+    async_symbolization_.emplace();
+  }
+
   flush_task_.Start("log_flusher",
                     utils::PeriodicTask::Settings(
                         std::chrono::duration_cast<std::chrono::milliseconds>(
@@ -129,6 +135,7 @@ void Logging::Stop() noexcept {
   signal_subscriber_.Unsubscribe();
   /// [Signals sample - destr]
   flush_task_.Stop();
+  async_symbolization_.reset();
 
   // Loggers could be used from non coroutine environments and should be
   // available even after task processors are down.
@@ -220,6 +227,8 @@ void Logging::WriteStatistics(utils::statistics::Writer& writer) const {
     writer.ValueWithLabels(logger->GetStatistics(),
                            {"logger", logger->GetLoggerName()});
   }
+  writer["budget_dropped"] =
+      utils::statistics::Rate{logging::GetLogBudgetDroppedCount()};
 }
 
 void Logging::FlushLogs() {
@@ -238,6 +247,10 @@ properties:
     fs-task-processor:
         type: string
         description: task processor for disk I/O operations
+    async-stacktrace-symbolization:
+        type: boolean
+        description: log raw addresses of the not yet cached stacktrace frames and symbolize them in a background thread
+        defaultDescription: false
     loggers:
         type: object
         description: logger options
@@ -262,13 +275,14 @@ properties:
                       - tskv
                       - ltsv
                       - raw
+                      - binary
                 flush_level:
                     type: string
                     description: messages of this and higher levels get flushed to the file immediately
                     defaultDescription: warning
                 message_queue_size:
                     type: integer
-                    description: the size of internal message queue, must be a power of 2
+                    description: the max number of messages buffered by each of the producer shards, must be a power of 2
                     defaultDescription: 65536
                 overflow_behavior:
                     type: string
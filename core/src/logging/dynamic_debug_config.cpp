@@ -10,7 +10,8 @@ namespace logging {
 
 bool operator==(const DynamicDebugConfig& a, const DynamicDebugConfig& b) {
   return a.force_enabled == b.force_enabled &&
-         a.force_disabled == b.force_disabled;
+         a.force_disabled == b.force_disabled &&
+         a.budget_per_second == b.budget_per_second;
 }
 
 DynamicDebugConfig Parse(const formats::json::Value& value,
@@ -23,6 +24,9 @@ DynamicDebugConfig Parse(const formats::json::Value& value,
   result.force_disabled =
       value["force-disabled-level"]
           .As<std::unordered_map<std::string, logging::Level>>({});
+  result.budget_per_second =
+      value["budget-per-second"]
+          .As<std::unordered_map<std::string, std::size_t>>({});
 
   for (auto location : value["force-enabled"].As<std::vector<std::string>>()) {
     result.force_enabled[std::move(location)] = logging::Level::kTrace;
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <cstddef>
 #include <string>
 #include <unordered_map>
 
@@ -17,6 +18,7 @@ namespace logging {
 struct DynamicDebugConfig {
   std::unordered_map<std::string, logging::Level> force_enabled;
   std::unordered_map<std::string, logging::Level> force_disabled;
+  std::unordered_map<std::string, std::size_t> budget_per_second;
 };
 
 bool operator==(const DynamicDebugConfig& a, const DynamicDebugConfig& b);
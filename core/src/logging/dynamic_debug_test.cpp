@@ -303,4 +303,34 @@ TEST_F(LoggingTest, DynamicDebugDisableLevel) {
   EXPECT_THAT(GetStreamString(), testing::HasSubstr("unrelated"));
 }
 
+TEST_F(LoggingTest, DynamicDebugBudget) {
+  const std::string filename{USERVER_FILEPATH};
+  SetDefaultLoggerLevel(logging::Level::kInfo);
+
+  const auto do_log = [](std::string_view string) {
+#line 70001
+    LOG_INFO() << string;
+  };
+
+  const auto dropped_before = logging::GetLogBudgetDroppedCount();
+  logging::SetLogBudget(filename, 70001, 2);
+  for (int i = 0; i < 5; ++i) {
+    do_log("budgeted");
+  }
+  LOG_INFO() << "unrelated";
+  logging::RemoveLogBudgets();
+  do_log("unlimited");
+
+  const auto log = GetStreamString();
+  std::size_t budgeted_count = 0;
+  for (auto pos = log.find("budgeted"); pos != std::string::npos;
+       pos = log.find("budgeted", pos + 1)) {
+    ++budgeted_count;
+  }
+  EXPECT_EQ(budgeted_count, 2u);
+  EXPECT_EQ(logging::GetLogBudgetDroppedCount() - dropped_before, 3u);
+  EXPECT_THAT(log, testing::HasSubstr("unrelated"));
+  EXPECT_THAT(log, testing::HasSubstr("unlimited"));
+}
+
 USERVER_NAMESPACE_END
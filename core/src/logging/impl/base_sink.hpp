@@ -1,9 +1,12 @@
 #pragma once
 
 #include <atomic>
+#include <string_view>
+#include <vector>
 
 #include <logging/impl/reopen_mode.hpp>
 #include <userver/logging/level.hpp>
+#include <userver/utils/span.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
@@ -22,6 +25,9 @@ class BaseSink {
 
   void Log(const LogMessage& message);
 
+  /// Writes the messages that pass the sink level, in order
+  void LogBatch(utils::span<const LogMessage> messages);
+
   virtual void Flush();
 
   virtual void Reopen(ReopenMode);
@@ -35,8 +41,12 @@ class BaseSink {
 
   virtual void Write(std::string_view log) = 0;
 
+  /// Calls Write for each of the logs, may be overridden to write them at once
+  virtual void WriteBatch(utils::span<const std::string_view> logs);
+
  private:
   std::atomic<Level> level_{Level::kTrace};
+  std::vector<std::string_view> batch_;
 };
 
 }  // namespace logging::impl
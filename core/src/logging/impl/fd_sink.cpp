@@ -1,5 +1,9 @@
 #include "fd_sink.hpp"
 
+#include <algorithm>
+#include <cerrno>
+#include <system_error>
+
 USERVER_NAMESPACE_BEGIN
 
 namespace logging::impl {
@@ -8,6 +12,43 @@ FdSink::FdSink(fs::blocking::FileDescriptor fd) : fd_{std::move(fd)} {}
 
 void FdSink::Write(std::string_view log) { fd_.Write(log); }
 
+void FdSink::WriteBatch(utils::span<const std::string_view> logs) {
+  while (!logs.empty()) {
+    const auto count = std::min(logs.size(), iovecs_.size());
+    for (std::size_t i = 0; i < count; ++i) {
+      // NOLINTNEXTLINE(cppcoreguidelines-pro-type-const-cast)
+      iovecs_[i].iov_base = const_cast<char*>(logs[i].data());
+      iovecs_[i].iov_len = logs[i].size();
+    }
+
+    auto* iov = iovecs_.data();
+    auto iov_count = count;
+    while (iov_count > 0) {
+      const auto s = ::writev(fd_.GetNative(), iov, iov_count);
+      if (s < 0) {
+        if (errno == EAGAIN || errno == EINTR) continue;
+
+        const auto code = std::make_error_code(std::errc{errno});
+        throw std::system_error(code, "calling ::writev");
+      }
+
+      // Skip the fully written logs and the written part of a partial one
+      auto written = static_cast<std::size_t>(s);
+      while (iov_count > 0 && written >= iov->iov_len) {
+        written -= iov->iov_len;
+        ++iov;
+        --iov_count;
+      }
+      if (iov_count > 0) {
+        iov->iov_base = static_cast<char*>(iov->iov_base) + written;
+        iov->iov_len -= written;
+      }
+    }
+
+    logs = logs.subspan(count);
+  }
+}
+
 void FdSink::Flush() {
   if (fd_.IsOpen()) {
     fd_.FSync();
@@ -1,7 +1,10 @@
 #pragma once
 
+#include <array>
 #include <string_view>
 
+#include <sys/uio.h>
+
 #include <userver/fs/blocking/file_descriptor.hpp>
 
 #include "base_sink.hpp"
@@ -21,12 +24,15 @@ class FdSink : public BaseSink {
  protected:
   void Write(std::string_view log) final;
 
+  void WriteBatch(utils::span<const std::string_view> logs) final;
+
   fs::blocking::FileDescriptor& GetFd();
 
   void SetFd(fs::blocking::FileDescriptor&& fd);
 
  private:
   fs::blocking::FileDescriptor fd_;
+  std::array<::iovec, 64> iovecs_{};
 };
 
 class UnownedFdSink final : public FdSink {
@@ -1,3 +1,6 @@
+#include <string>
+#include <vector>
+
 #include <benchmark/benchmark.h>
 
 #include <userver/fs/blocking/temp_directory.hpp>
@@ -38,4 +41,26 @@ void check_buffered_file_sink(benchmark::State& state) {
 }
 BENCHMARK(check_buffered_file_sink);
 
+template <typename Sink>
+void check_batch_sink(benchmark::State& state) {
+  const auto temp_root = fs::blocking::TempDirectory::Create();
+  const std::string filename =
+      temp_root.GetPath() + "/temp_file_" + std::to_string(utils::Rand());
+  auto sink = Sink(filename);
+  const std::vector<logging::impl::LogMessage> batch(
+      state.range(0), {"message\n", logging::Level::kWarning});
+  for ([[maybe_unused]] auto _ : state) {
+    for (ssize_t i = 0; i < kCountLogs; i += state.range(0)) {
+      sink.LogBatch(batch);
+    }
+  }
+  sink.Flush();
+}
+BENCHMARK_TEMPLATE(check_batch_sink, logging::impl::FileSink)
+    ->RangeMultiplier(4)
+    ->Range(1, 256);
+BENCHMARK_TEMPLATE(check_batch_sink, logging::impl::BufferedFileSink)
+    ->RangeMultiplier(4)
+    ->Range(1, 256);
+
 USERVER_NAMESPACE_END
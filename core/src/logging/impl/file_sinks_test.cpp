@@ -1,6 +1,7 @@
 #include "file_sink.hpp"
 
 #include <functional>
+#include <vector>
 
 #include <userver/fs/blocking/temp_directory.hpp>
 #include <userver/fs/blocking/temp_file.hpp>
@@ -188,6 +189,31 @@ UTEST_P(FileSinks, TestValidWriteMultiInFile) {
             test::Messages("message", "message 2", "message 3"));
 }
 
+UTEST_P(FileSinks, TestWriteBatchInFile) {
+  // More messages than a single writev call of FdSink takes
+  constexpr std::size_t kMessages = 200;
+  std::vector<std::string> payloads;
+  std::vector<std::string> expected;
+  for (std::size_t i = 0; i < kMessages; ++i) {
+    payloads.push_back("message " + std::to_string(i) + '\n');
+  }
+
+  Sink().SetLevel(logging::Level::kInfo);
+  std::vector<logging::impl::LogMessage> messages;
+  for (std::size_t i = 0; i < kMessages; ++i) {
+    const auto level =
+        i % 3 == 0 ? logging::Level::kDebug : logging::Level::kWarning;
+    messages.push_back({payloads[i], level});
+    if (level == logging::Level::kWarning) {
+      expected.push_back("message " + std::to_string(i));
+    }
+  }
+
+  EXPECT_NO_THROW(Sink().LogBatch(messages));
+  EXPECT_NO_THROW(Sink().Flush());
+  EXPECT_EQ(test::ReadFromFile(Filename()), expected);
+}
+
 INSTANTIATE_UTEST_SUITE_P(/* no prefix */, FileSinks,
                           testing::Values(SinkFactory{"FileSink", MakeFileSink},
                                           SinkFactory{"BufferedFileSink",
@@ -0,0 +1,79 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+
+#include <logging/logging_test.hpp>
+#include <userver/compression/zstd.hpp>
+#include <userver/logging/impl/binary_format.hpp>
+#include <userver/logging/log.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+constexpr std::size_t kMaxDecompressedSize = 1024 * 1024;
+
+class LoggingBinaryTest : public LoggingTestBase {
+ protected:
+  LoggingBinaryTest() : LoggingTestBase(logging::Format::kBinary) {
+    SetDefaultLogger(GetStreamLogger());
+  }
+
+  std::string DecodedLog() const {
+    logging::LogFlush();
+    const auto records = compression::zstd::Decompress(GetStreamString(),
+                                                       kMaxDecompressedSize);
+    std::string tskv;
+    EXPECT_EQ(logging::impl::binary::DecodeToTskv(records, tskv),
+              records.size());
+    return tskv;
+  }
+};
+
+}  // namespace
+
+TEST_F(LoggingBinaryTest, Basic) {
+  LOG_INFO() << "This is the\ttext to log";
+
+  const auto log = DecodedLog();
+  EXPECT_EQ(log.rfind("tskv\ttimestamp=", 0), 0) << log;
+  EXPECT_NE(log.find("\tlevel=INFO\t"), std::string::npos) << log;
+  EXPECT_NE(log.find("\tmodule="), std::string::npos) << log;
+  EXPECT_NE(log.find("\tthread_id="), std::string::npos) << log;
+  EXPECT_NE(log.find("\ttext=This is the\\ttext to log\n"), std::string::npos)
+      << log;
+}
+
+TEST_F(LoggingBinaryTest, CustomKeys) {
+  const std::string long_value(300, 'x');
+  LOG_WARNING() << "text"
+                << logging::LogExtra{{"custom_key", long_value},
+                                     {"escaped.key", std::string{"a\nb"}}};
+
+  const auto log = DecodedLog();
+  EXPECT_NE(log.find("\tcustom_key=" + long_value), std::string::npos) << log;
+  EXPECT_NE(log.find("\tescaped_key=a\\nb"), std::string::npos) << log;
+}
+
+TEST_F(LoggingBinaryTest, ManyRecords) {
+  constexpr std::size_t kRecords = 1000;
+  for (std::size_t i = 0; i < kRecords; ++i) {
+    LOG_INFO() << "record " << i;
+  }
+
+  const auto log = DecodedLog();
+  EXPECT_EQ(static_cast<std::size_t>(std::count(log.begin(), log.end(), '\n')),
+            kRecords);
+  EXPECT_NE(log.find("\ttext=record 999\n"), std::string::npos);
+}
+
+TEST(LoggingBinaryFormat, TruncatedRecord) {
+  constexpr std::string_view kRecord{"\x03\x01\x02\x04", 4};
+
+  std::string tskv;
+  EXPECT_EQ(logging::impl::binary::DecodeToTskv(kRecord.substr(0, 3), tskv),
+            0);
+  EXPECT_TRUE(tskv.empty());
+}
+
+USERVER_NAMESPACE_END
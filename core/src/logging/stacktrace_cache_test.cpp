@@ -21,4 +21,22 @@ UTEST(StacktraceCache, StartOfCoroutine) {
   EXPECT_TRUE(utils::text::EndsWith(text, "[start of coroutine]\n")) << text;
 }
 
+TEST(StacktraceCache, AsyncSymbolization) {
+  logging::stacktrace_cache::StacktraceGuard guard(true);
+  // The topmost frame is unique to this call site, so it is not cached yet
+  auto st = boost::stacktrace::stacktrace();
+  {
+    logging::stacktrace_cache::AsyncSymbolizationGuard async_guard;
+    auto text = logging::stacktrace_cache::to_string(st);
+    EXPECT_TRUE(utils::text::StartsWith(
+        text, "[symbolized asynchronously, see stacktrace id="))
+        << text;
+  }
+
+  // The background thread has put the frames to the cache
+  logging::stacktrace_cache::AsyncSymbolizationGuard async_guard;
+  EXPECT_EQ(boost::stacktrace::to_string(st),
+            logging::stacktrace_cache::to_string(st));
+}
+
 USERVER_NAMESPACE_END
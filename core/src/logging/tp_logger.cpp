@@ -1,5 +1,10 @@
 #include "tp_logger.hpp"
 
+#include <cstdint>
+#include <functional>
+#include <thread>
+#include <utility>
+
 #include <fmt/format.h>
 
 #include <engine/task/task_context.hpp>
@@ -14,12 +19,30 @@ USERVER_NAMESPACE_BEGIN
 
 namespace logging::impl {
 
+namespace {
+
+// Format::kBinary records are compressed in batches of up to this size
+constexpr std::size_t kMaxBinaryBatchSize = 64 * 1024;
+
+// The compression runs in the consumer task, so a fast level is used
+constexpr int kBinaryCompressionLevel = 1;
+
+constexpr std::size_t kMaxShardCount = 64;
+
+std::size_t GetShardCount() noexcept {
+  const std::size_t threads = std::thread::hardware_concurrency();
+  std::size_t count = 1;
+  while (count < threads && count < kMaxShardCount) count *= 2;
+  return count;
+}
+
+}  // namespace
+
 struct TpLogger::ActionVisitor final {
   TpLogger& logger;
 
-  void operator()(impl::async::Log&& log) const {
-    logger.AccountLogConsumed();
-    logger.BackendLog(std::move(log));
+  void operator()(impl::async::DrainShard&& drain) const noexcept {
+    logger.BackendDrainShard(drain.shard);
   }
 
   void operator()(impl::async::Stop&&) const noexcept {
@@ -45,8 +68,13 @@ struct TpLogger::ActionVisitor final {
 };
 
 TpLogger::TpLogger(Format format, std::string logger_name)
-    : LoggerBase(format), logger_name_(std::move(logger_name)) {
+    : LoggerBase(format),
+      logger_name_(std::move(logger_name)),
+      shards_(GetShardCount()) {
   SetLevel(logging::Level::kInfo);
+  for (std::size_t i = 0; i < shards_.size(); ++i) {
+    shards_[i]->drain_node.action = impl::async::DrainShard{i};
+  }
 }
 
 void TpLogger::StartConsumerTask(engine::TaskProcessor& task_processor,
@@ -132,21 +160,28 @@ void TpLogger::Log(Level level, std::string_view msg) {
     return;
   }
 
-  if (TryWaitFreeQueueCapacity()) {
-    // The queue might have concurrently become full, in which case the size
-    // will temporarily go over the max size. The actual number of log actions
-    // in queue_ will not typically go over max_size + n_threads.
-    produced_->fetch_add(1);
-
-    try {
-      Push(impl::async::Log{level, std::string{msg}});
-    } catch (const std::exception&) {
-      // failed to construct a Log action or a node in Push
-      produced_->fetch_sub(1);
-      throw;
+  impl::async::Log record{level, std::string{msg}};
+  auto& shard = GetCurrentShard();
+  bool should_schedule_drain = false;
+  {
+    std::unique_lock lock{shard.mutex};
+    if (!HasFreeShardCapacity(shard)) {
+      lock.unlock();
+      if (!TryWaitFreeShardCapacity(shard)) {
+        ++stats_.dropped;
+        return;
+      }
+      // The shard might have concurrently become full, in which case its size
+      // will temporarily go over the max size.
+      lock.lock();
     }
-  } else {
-    ++stats_.dropped;
+    shard.records.push_back(std::move(record));
+    should_schedule_drain = !std::exchange(shard.drain_scheduled, true);
+  }
+
+  // The records pushed before the drain node is consumed join the batch
+  if (should_schedule_drain) {
+    DoPush(shard.drain_node);
   }
 }
 
@@ -223,15 +258,24 @@ void TpLogger::BackendPerform(impl::async::Action&& action) noexcept {
   }
 }
 
-bool TpLogger::HasFreeQueueCapacity() noexcept {
-  return produced_->load() - consumed_->load() < max_queue_size_.load();
+TpLogger::Shard& TpLogger::GetCurrentShard() noexcept {
+  // A task always uses the same shard, so that its records stay in order
+  // after migrating to another thread
+  auto* const task = engine::current_task::GetCurrentTaskContextUnchecked();
+  const std::uint64_t key =
+      task ? reinterpret_cast<std::uintptr_t>(task)
+           : std::hash<std::thread::id>{}(std::this_thread::get_id());
+  // Fibonacci hashing spreads the aligned addresses over the shards
+  const auto hash = (key * 11400714819323198485ULL) >> 32;
+  return *shards_[hash % shards_.size()];
 }
 
-bool TpLogger::TryWaitFreeQueueCapacity() {
-  if (HasFreeQueueCapacity()) {
-    return true;
-  }
+bool TpLogger::HasFreeShardCapacity(const Shard& shard) const noexcept {
+  return shard.records.size() <
+         static_cast<std::size_t>(max_queue_size_.load());
+}
 
+bool TpLogger::TryWaitFreeShardCapacity(Shard& shard) {
   // Do not do blocking push if we are not in a coroutine context.
   if (overflow_policy_.load() != QueueOverflowBehavior::kBlock ||
       !engine::current_task::IsTaskProcessorThread()) {
@@ -240,8 +284,11 @@ bool TpLogger::TryWaitFreeQueueCapacity() {
 
   const engine::TaskCancellationBlocker block_cancel;
   std::unique_lock lock{capacity_waiters_mutex_};
-  [[maybe_unused]] const bool success = capacity_waiters_cv_.Wait(
-      lock, [this] { return HasFreeQueueCapacity(); });
+  [[maybe_unused]] const bool success =
+      capacity_waiters_cv_.Wait(lock, [this, &shard] {
+        const std::lock_guard shard_lock{shard.mutex};
+        return HasFreeShardCapacity(shard);
+      });
   UASSERT(success);
   return true;
 }
@@ -259,20 +306,61 @@ void TpLogger::DoPush(concurrent::impl::SinglyLinkedBaseHook& node) noexcept {
   }
 }
 
-void TpLogger::AccountLogConsumed() noexcept {
-  consumed_->store(consumed_->load(std::memory_order_relaxed) + 1,
-                   std::memory_order_relaxed);
+void TpLogger::BackendDrainShard(std::size_t shard_index) noexcept {
+  auto& shard = *shards_[shard_index];
+  {
+    const std::lock_guard lock{shard.mutex};
+    // Both vectors keep their capacity between the batches
+    std::swap(shard.records, drained_records_);
+    shard.drain_scheduled = false;
+  }
+
   if (overflow_policy_.load() == QueueOverflowBehavior::kBlock) {
     {
-      // Atomic consumed_ mutation doesn't need to be protected by lock.
       // With this lock in place, a waiter can check + wait either:
       // 1. before us locking, then we will notify the waiter, or
-      // 2. after us locking, then the waiter will receive our updates and
+      // 2. after us locking, then the waiter will see the drained shard and
       //    not fall asleep
       const std::lock_guard lock{capacity_waiters_mutex_};
     }
-    capacity_waiters_cv_.NotifyOne();
+    capacity_waiters_cv_.NotifyAll();
+  }
+
+  if (GetFormat() == Format::kBinary) {
+    for (auto& record : drained_records_) {
+      try {
+        BackendLog(std::move(record));
+      } catch (const std::exception& e) {
+        UASSERT_MSG(false, fmt::format(
+                               "Exception while doing an async logging: {}",
+                               e.what()));
+      }
+    }
+  } else {
+    BackendLogBatch();
+  }
+  drained_records_.clear();
+}
+
+void TpLogger::BackendLogBatch() noexcept {
+  bool should_flush = false;
+  for (const auto& record : drained_records_) {
+    drained_messages_.push_back(LogMessage{record.payload, record.level});
+    should_flush = should_flush || ShouldFlush(record.level);
+  }
+
+  for (const auto& sink : GetSinks()) {
+    try {
+      sink->LogBatch(drained_messages_);
+    } catch (const std::exception& e) {
+      UASSERT_MSG(false, "While writing a log batch caught an exception: " +
+                             std::string(e.what()));
+    }
   }
+  drained_messages_.clear();
+
+  // The batch is flushed after the last record that requires flushing
+  if (should_flush) BackendFlush();
 }
 
 void TpLogger::ConsumeNode(
@@ -280,6 +368,12 @@ void TpLogger::ConsumeNode(
   // NOLINTNEXTLINE(cppcoreguidelines-pro-type-static-cast-downcast)
   auto& action_node = static_cast<impl::async::ActionNode&>(node);
   if (&action_node == &stop_node_) return;
+  if (const auto* const drain =
+          std::get_if<impl::async::DrainShard>(&action_node.action)) {
+    // Drain nodes belong to the shards and are pushed again later
+    BackendPerform(impl::async::DrainShard{*drain});
+    return;
+  }
 
   BackendPerform(std::move(action_node.action));
   delete &action_node;
@@ -289,33 +383,100 @@ void TpLogger::ConsumeQueueOnce(Queue::Consumer& consumer) noexcept {
   while (auto* const node_base = consumer.TryPop()) {
     ConsumeNode(*node_base);
   }
+  FlushBinaryBatches();
 }
 
 void TpLogger::CleanUpQueue(Queue::Consumer&& consumer) noexcept {
-  std::move(consumer).ConsumeAndStop(
-      [this](auto& node) noexcept { ConsumeNode(node); });
+  // Same as Consumer::ConsumeAndStop, but the binary batches are written out
+  // before another task may become the consumer
+  do {
+    ConsumeQueueOnce(consumer);
+  } while (!consumer.TryStopConsuming());
 }
 
-void TpLogger::BackendLog(impl::async::Log&& action) const {
-  LogMessage message;
-  message.payload = action.payload;
-  message.level = action.level;
+void TpLogger::BackendLog(impl::async::Log&& action) {
+  if (GetFormat() == Format::kBinary) {
+    BatchBinaryRecord(action);
+  } else {
+    LogMessage message;
+    message.payload = action.payload;
+    message.level = action.level;
+
+    for (const auto& sink : GetSinks()) {
+      try {
+        sink->Log(message);
+      } catch (const std::exception& e) {
+        UASSERT_MSG(false,
+                    "While writing a log message caught an exception: " +
+                        std::string(e.what()));
+      }
+    }
+  }
 
-  for (const auto& sink : GetSinks()) {
+  if (ShouldFlush(action.level)) {
+    BackendFlush();
+  }
+}
+
+void TpLogger::BatchBinaryRecord(const impl::async::Log& action) {
+  const auto& sinks = GetSinks();
+  binary_batches_.resize(sinks.size());
+
+  for (std::size_t i = 0; i < sinks.size(); ++i) {
+    if (!sinks[i]->ShouldLog(action.level)) continue;
+
+    auto& batch = binary_batches_[i];
+    batch.records += action.payload;
+    if (batch.records.size() >= kMaxBinaryBatchSize) {
+      try {
+        WriteBinaryBatch(*sinks[i], batch);
+      } catch (const std::exception& e) {
+        UASSERT_MSG(false, "While writing a log batch caught an exception: " +
+                               std::string(e.what()));
+      }
+    }
+  }
+}
+
+void TpLogger::WriteBinaryBatch(BaseSink& sink, BinaryBatch& batch) {
+  if (batch.records.empty()) return;
+
+  utils::FastScopeGuard clear_guard(
+      [&batch]() noexcept { batch.records.clear(); });
+  if (!batch.compressor) batch.compressor.emplace(kBinaryCompressionLevel);
+  // The records are already filtered by the sink level
+  sink.Log(LogMessage{batch.compressor->Compress(batch.records), Level::kNone});
+}
+
+void TpLogger::FinishBinaryFrames() noexcept {
+  for (std::size_t i = 0; i < binary_batches_.size(); ++i) {
+    auto& batch = binary_batches_[i];
     try {
-      sink->Log(message);
+      WriteBinaryBatch(*sinks_[i], batch);
+      if (batch.compressor) {
+        sinks_[i]->Log(LogMessage{batch.compressor->Finish(), Level::kNone});
+      }
     } catch (const std::exception& e) {
-      UASSERT_MSG(false, "While writing a log message caught an exception: " +
+      UASSERT_MSG(false, "While finishing a log frame caught an exception: " +
                              std::string(e.what()));
     }
+    batch.compressor.reset();
   }
+}
 
-  if (ShouldFlush(message.level)) {
-    BackendFlush();
+void TpLogger::FlushBinaryBatches() noexcept {
+  for (std::size_t i = 0; i < binary_batches_.size(); ++i) {
+    try {
+      WriteBinaryBatch(*sinks_[i], binary_batches_[i]);
+    } catch (const std::exception& e) {
+      UASSERT_MSG(false, "While writing a log batch caught an exception: " +
+                             std::string(e.what()));
+    }
   }
 }
 
-void TpLogger::BackendFlush() const {
+void TpLogger::BackendFlush() {
+  FlushBinaryBatches();
   for (const auto& sink : GetSinks()) {
     try {
       sink->Flush();
@@ -326,7 +487,11 @@ void TpLogger::BackendFlush() const {
   }
 }
 
-void TpLogger::BackendReopen(ReopenMode reopen_mode) const {
+void TpLogger::BackendReopen(ReopenMode reopen_mode) {
+  // The pending records belong to the old files, and each file gets its own
+  // zstd frame
+  FinishBinaryFrames();
+
   std::string result_messages{};
   for (const auto& [index, sink] : utils::enumerate(GetSinks())) {
     try {
@@ -4,19 +4,23 @@
 #include <future>
 #include <limits>
 #include <memory>
+#include <mutex>
+#include <optional>
 #include <string>
 #include <string_view>
 #include <variant>
 #include <vector>
 
+#include <userver/compression/zstd.hpp>
+#include <userver/concurrent/impl/interference_shield.hpp>
 #include <userver/engine/condition_variable.hpp>
 #include <userver/engine/future.hpp>
 #include <userver/engine/mutex.hpp>
 #include <userver/engine/task/task.hpp>
 #include <userver/logging/format.hpp>
 #include <userver/logging/impl/logger_base.hpp>
+#include <userver/utils/fixed_array.hpp>
 
-#include <concurrent/impl/interference_shield.hpp>
 #include <engine/impl/async_flat_combining_queue.hpp>
 #include <logging/config.hpp>
 #include <logging/impl/base_sink.hpp>
@@ -53,7 +57,12 @@ struct ReopenCoro {
 
 struct Stop {};
 
-using Action = std::variant<Stop, Log, FlushCoro, FlushThreaded, ReopenCoro>;
+struct DrainShard {
+  std::size_t shard{};
+};
+
+using Action =
+    std::variant<Stop, DrainShard, FlushCoro, FlushThreaded, ReopenCoro>;
 
 struct ActionNode final : public concurrent::impl::SinglyLinkedBaseHook {
   Action action{Stop{}};
@@ -100,22 +109,50 @@ class TpLogger final : public LoggerBase {
   using Queue = engine::impl::AsyncFlatCombiningQueue;
   using QueueSize = std::int64_t;
 
+  // Records are buffered in shards and handed over to the consumer in
+  // batches, one queue node per batch. This keeps the producers from
+  // contending on the queue during log storms.
+  struct Shard final {
+    std::mutex mutex;
+    std::vector<impl::async::Log> records;
+    // Set while drain_node is in the queue
+    bool drain_scheduled{false};
+    impl::async::ActionNode drain_node;
+  };
+
   void ProcessingLoop();
-  bool HasFreeQueueCapacity() noexcept;
-  bool TryWaitFreeQueueCapacity();
+  Shard& GetCurrentShard() noexcept;
+  bool HasFreeShardCapacity(const Shard& shard) const noexcept;
+  bool TryWaitFreeShardCapacity(Shard& shard);
   void Push(impl::async::Action&& action);
   void DoPush(concurrent::impl::SinglyLinkedBaseHook& node) noexcept;
   void ConsumeNode(concurrent::impl::SinglyLinkedBaseHook& node) noexcept;
   void ConsumeQueueOnce(Queue::Consumer& consumer) noexcept;
   void CleanUpQueue(Queue::Consumer&& consumer) noexcept;
-  void AccountLogConsumed() noexcept;
+  void BackendDrainShard(std::size_t shard_index) noexcept;
   void BackendPerform(impl::async::Action&& action) noexcept;
-  void BackendLog(impl::async::Log&& action) const;
-  void BackendFlush() const;
-  void BackendReopen(ReopenMode reopen_mode) const;
+  void BackendLog(impl::async::Log&& action);
+  void BackendLogBatch() noexcept;
+  void BackendFlush();
+  void BackendReopen(ReopenMode reopen_mode);
+
+  // Format::kBinary records of a sink waiting for compression. The records
+  // of a file are compressed into a single zstd frame, flushed after each
+  // batch, so that the batches share the compression history.
+  struct BinaryBatch final {
+    std::string records;
+    std::optional<compression::zstd::Compressor> compressor;
+  };
+
+  void BatchBinaryRecord(const impl::async::Log& action);
+  static void WriteBinaryBatch(BaseSink& sink, BinaryBatch& batch);
+  void FlushBinaryBatches() noexcept;
+  void FinishBinaryFrames() noexcept;
 
   const std::string logger_name_;
   std::vector<impl::SinkPtr> sinks_;
+  // Accessed by the current queue consumer only
+  std::vector<BinaryBatch> binary_batches_;
   mutable statistics::LogStatistics stats_{};
 
   engine::Mutex capacity_waiters_mutex_;
@@ -131,8 +168,10 @@ class TpLogger final : public LoggerBase {
   impl::async::ActionNode stop_node_;
 
   Queue queue_;
-  concurrent::impl::InterferenceShield<std::atomic<QueueSize>> produced_{0};
-  concurrent::impl::InterferenceShield<std::atomic<QueueSize>> consumed_{0};
+  utils::FixedArray<concurrent::impl::InterferenceShield<Shard>> shards_;
+  // Accessed by the current queue consumer only
+  std::vector<impl::async::Log> drained_records_;
+  std::vector<LogMessage> drained_messages_;
 };
 
 }  // namespace logging::impl
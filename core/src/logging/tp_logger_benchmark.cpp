@@ -1,8 +1,11 @@
 #include <logging/tp_logger.hpp>
 
+#include <vector>
+
 #include <benchmark/benchmark.h>
 
 #include <logging/impl/null_sink.hpp>
+#include <userver/engine/async.hpp>
 #include <userver/engine/run_standalone.hpp>
 #include <userver/logging/log.hpp>
 #include <userver/logging/logger.hpp>
@@ -96,4 +99,34 @@ BENCHMARK_DEFINE_F(TpLoggerBenchmark, LogCheckSpan)
 }
 BENCHMARK_REGISTER_F(TpLoggerBenchmark, LogCheckSpan);
 
+BENCHMARK_DEFINE_F(TpLoggerBenchmark, LogMultiProducer)
+(benchmark::State& state) {
+  constexpr std::size_t kRecordsPerProducer = 1000;
+  const auto producers = static_cast<std::size_t>(state.range(0));
+
+  engine::RunStandalone(producers + 1, [&] {
+    auto scope = StartAsyncLoggerScope();
+    std::vector<engine::TaskWithResult<void>> tasks;
+    tasks.reserve(producers);
+    for ([[maybe_unused]] auto _ : state) {
+      for (std::size_t i = 0; i < producers; ++i) {
+        tasks.push_back(engine::AsyncNoSpan([] {
+          for (std::size_t j = 0; j < kRecordsPerProducer; ++j) {
+            LOG_INFO() << j;
+          }
+        }));
+      }
+      for (auto& task : tasks) task.Get();
+      tasks.clear();
+    }
+    state.SetItemsProcessed(state.iterations() * producers *
+                            kRecordsPerProducer);
+  });
+}
+// Run benchmarks to log from 1 to 16 concurrent producers
+BENCHMARK_REGISTER_F(TpLoggerBenchmark, LogMultiProducer)
+    ->RangeMultiplier(2)
+    ->Range(1, 16)
+    ->UseRealTime();
+
 USERVER_NAMESPACE_END
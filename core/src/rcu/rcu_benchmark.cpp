@@ -9,6 +9,8 @@
 #include <userver/engine/sleep.hpp>
 #include <userver/engine/task/task_with_result.hpp>
 #include <userver/rcu/rcu.hpp>
+#include <userver/rcu/rcu_map.hpp>
+#include <userver/rcu/sharded_rcu_map.hpp>
 #include <userver/utils/async.hpp>
 #include <utils/impl/parallelize_benchmark.hpp>
 
@@ -135,4 +137,87 @@ void rcu_of_shared_ptr(benchmark::State& state) {
 }
 BENCHMARK(rcu_of_shared_ptr)->RangeMultiplier(2)->Range(1, 32);
 
+template <typename Policy>
+struct ReclamationRcuTraits {
+  using MutexType = engine::Mutex;
+  using ReclamationPolicy = Policy;
+};
+
+// Assignments while readers keep some old values alive, which makes the
+// eager reclamation scan them on every assignment
+template <typename ReclamationPolicy>
+void rcu_write_with_readers(benchmark::State& state) {
+  const std::size_t readers_count = state.range(0);
+  const std::size_t kept_readable_pointers_count = state.range(1);
+
+  engine::RunStandalone(std::min(readers_count + 1, std::size_t{6}), [&] {
+    std::atomic<bool> run{true};
+    rcu::Variable<std::uint64_t, ReclamationRcuTraits<ReclamationPolicy>> var{
+        rcu::DestructionType::kSync, 0};
+
+    std::vector<engine::TaskWithResult<void>> tasks;
+    tasks.reserve(readers_count);
+    for (std::size_t j = 0; j < readers_count; j++) {
+      tasks.push_back(utils::Async("reader", [&] {
+        std::queue<decltype(var.Read())> pointers;
+        while (run) {
+          pointers.push(var.Read());
+          if (pointers.size() > kept_readable_pointers_count) pointers.pop();
+          engine::Yield();
+        }
+      }));
+    }
+
+    std::uint64_t i = 0;
+    for ([[maybe_unused]] auto _ : state) {
+      var.Assign(++i);
+    }
+
+    run = false;
+    for (auto& task : tasks) {
+      task.Get();
+    }
+  });
+}
+BENCHMARK_TEMPLATE(rcu_write_with_readers, rcu::EagerReclamation)
+    ->RangeMultiplier(4)
+    ->Ranges({{1, 4}, {1, 64}});
+BENCHMARK_TEMPLATE(rcu_write_with_readers, rcu::AmortizedReclamation)
+    ->RangeMultiplier(4)
+    ->Ranges({{1, 4}, {1, 64}});
+
+// Every thread performs one keyset change per `kReadsPerWrite` lookups
+template <typename Map>
+void rcu_map_mixed(benchmark::State& state) {
+  constexpr std::uint64_t kKeyCount = 10'000;
+  constexpr std::uint64_t kReadsPerWrite = 8;
+  const std::size_t threads_count = state.range(0);
+
+  engine::RunStandalone(threads_count, [&] {
+    Map map;
+    for (std::uint64_t key = 0; key < kKeyCount; ++key) map.Emplace(key, key);
+    std::atomic<std::uint64_t> thread_index{0};
+
+    RunParallelBenchmark(state, [&](auto& range) {
+      // Threads start at different keys to avoid updating the same ones
+      std::uint64_t i = thread_index++ * kKeyCount / threads_count;
+      for ([[maybe_unused]] auto _ : range) {
+        const auto key = i++ % kKeyCount;
+        if (i % (kReadsPerWrite + 1) == 0) {
+          map.InsertOrAssign(key, std::make_shared<std::uint64_t>(i));
+        } else {
+          benchmark::DoNotOptimize(map.Get(key));
+        }
+      }
+    });
+  });
+}
+BENCHMARK_TEMPLATE(rcu_map_mixed, rcu::RcuMap<std::uint64_t, std::uint64_t>)
+    ->RangeMultiplier(2)
+    ->Range(1, 8);
+BENCHMARK_TEMPLATE(rcu_map_mixed,
+                   rcu::ShardedRcuMap<std::uint64_t, std::uint64_t>)
+    ->RangeMultiplier(2)
+    ->Range(1, 8);
+
 USERVER_NAMESPACE_END
@@ -21,6 +21,11 @@ struct StdMutexRcuTraits {
   using MutexType = std::mutex;
 };
 
+struct AmortizedRcuTraits {
+  using MutexType = engine::Mutex;
+  using ReclamationPolicy = rcu::AmortizedReclamation;
+};
+
 }  // namespace
 
 UTEST(Rcu, Ctr) { rcu::Variable<X> ptr; }
@@ -308,6 +313,34 @@ UTEST(Rcu, Cleanup) {
   EXPECT_EQ(count.load(), 1);
 }
 
+UTEST(Rcu, AmortizedReclamation) {
+  static std::atomic<size_t> count{0};
+  struct X {
+    X() { count++; }
+    X(X&&) noexcept { count++; }
+    X(const X&) { count++; }
+    ~X() { count--; }
+  };
+  constexpr auto kMinRetired = rcu::AmortizedReclamation::kMinRetired;
+
+  {
+    rcu::Variable<X, AmortizedRcuTraits> ptr{rcu::DestructionType::kSync};
+    const auto reader = ptr.Read();
+
+    // Old values are kept until the retired list grows over the threshold
+    for (std::size_t i = 0; i < kMinRetired; ++i) ptr.Assign(X{});
+    EXPECT_EQ(count.load(), kMinRetired + 1);
+
+    // The value held by `reader` survives the scan
+    ptr.Assign(X{});
+    EXPECT_EQ(count.load(), 2);
+
+    ptr.Cleanup();
+    EXPECT_EQ(count.load(), 2);
+  }
+  EXPECT_EQ(count.load(), 0);
+}
+
 UTEST(Rcu, ParallelCleanup) {
   rcu::Variable<int> ptr(1);
 
@@ -0,0 +1,110 @@
+#include <userver/rcu/sharded_rcu_map.hpp>
+
+#include <array>
+#include <atomic>
+#include <string>
+
+#include <userver/engine/sleep.hpp>
+#include <userver/utest/utest.hpp>
+#include <userver/utils/async.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+UTEST(ShardedRcuMap, Empty) {
+  rcu::ShardedRcuMap<std::string, int> map;
+  const auto& cmap = map;
+
+  EXPECT_EQ(map.GetShardCount(), decltype(map)::kDefaultShardCount);
+  EXPECT_EQ(0, map.SizeApprox());
+  EXPECT_TRUE(map.GetSnapshot().empty());
+  UEXPECT_THROW(cmap["any"], rcu::MissingKeyException);
+  EXPECT_FALSE(map.Get("any"));
+  EXPECT_FALSE(cmap.Get("any"));
+  EXPECT_FALSE(map.Erase("any"));
+  EXPECT_FALSE(map.Pop("any"));
+}
+
+UTEST(ShardedRcuMap, Modify) {
+  rcu::ShardedRcuMap<int, int> map{4};
+  const auto& cmap = map;
+
+  for (int i = 0; i < 100; ++i) *map[i] = i;
+  EXPECT_EQ(100, map.SizeApprox());
+  for (int i = 0; i < 100; ++i) EXPECT_EQ(i, *cmap[i]);
+
+  EXPECT_FALSE(map.Insert(1, std::make_shared<int>(-1)).inserted);
+  EXPECT_EQ(1, *map.Get(1));
+  EXPECT_TRUE(map.Emplace(100, 100).inserted);
+  EXPECT_FALSE(map.TryEmplace(100, -1).inserted);
+  map.InsertOrAssign(100, std::make_shared<int>(-100));
+  EXPECT_EQ(-100, *map.Get(100));
+
+  EXPECT_TRUE(map.Erase(100));
+  EXPECT_EQ(5, *map.Pop(5));
+  EXPECT_FALSE(map.Get(5));
+  EXPECT_EQ(99, map.SizeApprox());
+
+  const auto snapshot = map.GetSnapshot();
+  EXPECT_EQ(99, snapshot.size());
+  EXPECT_EQ(42, *snapshot.at(42));
+
+  map.Clear();
+  EXPECT_EQ(0, map.SizeApprox());
+  EXPECT_EQ(42, *snapshot.at(42));
+}
+
+UTEST(ShardedRcuMap, Transaction) {
+  rcu::ShardedRcuMap<int, int> map;
+
+  auto& shard = map.GetShard(1);
+  auto txn = shard.StartWrite();
+  (*txn)[1] = std::make_shared<int>(1);
+  EXPECT_FALSE(map.Get(1));
+  txn.Commit();
+  EXPECT_EQ(1, *map.Get(1));
+}
+
+UTEST_MT(ShardedRcuMap, ConcurrentUpdates, 4) {
+  rcu::ShardedRcuMap<int, std::atomic<int>> map;
+  std::array<engine::TaskWithResult<void>, 4> workers;
+  std::atomic<bool> stop_flag{false};
+
+  for (std::size_t i = 0; i < workers.size(); ++i) {
+    workers[i] = utils::Async("writer", [i, &map, &stop_flag] {
+      const int base = static_cast<int>(i) * 1000;
+      while (!stop_flag) {
+        for (int key = base; key < base + 100; ++key) {
+          ASSERT_TRUE(map.Emplace(key, key).inserted);
+        }
+        for (int key = base; key < base + 100; ++key) {
+          ASSERT_EQ(key, map.Get(key)->load());
+          ASSERT_TRUE(map.Erase(key));
+        }
+      }
+    });
+  }
+
+  engine::SleepFor(std::chrono::milliseconds(100));
+  stop_flag = true;
+  for (auto& worker : workers) worker.Get();
+
+  EXPECT_EQ(0, map.SizeApprox());
+}
+
+UTEST(ShardedRcuMap, SampleShardedRcuMap) {
+  /// [Sample rcu::ShardedRcuMap usage]
+  struct Session {
+    std::atomic<int> requests{0};
+  };
+  rcu::ShardedRcuMap<std::string, Session> sessions;
+
+  // Only the shard of the key is copied on insertion
+  sessions["user-1"]->requests++;
+  sessions.Emplace("user-2");
+  ASSERT_EQ(sessions["user-1"]->requests.load(), 1);
+  ASSERT_EQ(sessions["user-2"]->requests.load(), 0);
+  ASSERT_EQ(sessions.SizeApprox(), 2);
+  /// [Sample rcu::ShardedRcuMap usage]
+}
+
+USERVER_NAMESPACE_END
@@ -178,7 +178,7 @@ properties:
                         defaultDescription: 32 * 1024
                     requests_queue_size_threshold:
                         type: integer
-                        description: drop requests from handlers that allow throttling if there's more pending requests than allowed by this value
+                        description: drop requests from handlers that allow throttling if there's more pending requests than allowed by this value; also the max number of pipelined HTTP/1.1 requests of a connection that are handled concurrently
                         defaultDescription: 100
                     keepalive_timeout:
                         type: integer
@@ -188,9 +188,26 @@ properties:
                         type: integer
                         description: delay in microseconds of the start of abort check routine
                         defaultDescription: 20ms
+                    zero_copy_send_threshold:
+                        type: integer
+                        description: responses of at least this size in bytes are sent with MSG_ZEROCOPY where supported, 0 to disable
+                        defaultDescription: 0
+                    http2_enabled:
+                        type: boolean
+                        description: accept HTTP/2 connections, negotiated via ALPN for TLS or with prior knowledge otherwise
+                        defaultDescription: false
+                    http2_max_concurrent_streams:
+                        type: integer
+                        description: max number of concurrent streams of an HTTP/2 connection
+                        defaultDescription: 100
             shards:
                 type: integer
                 description: how many concurrent tasks harvest data from a single socket; do not set if not sure what it is doing
+                defaultDescription: event threads count of the task_processor
+            shards_cpu_steering:
+                type: boolean
+                description: on Linux distribute new TCP connections among the shards by the CPU that received them rather than by the kernel hash of the addresses
+                defaultDescription: false
     listener-monitor:
         type: object
         description: describes the special monitoring socket, used for getting statistics and processing utility requests that should succeed even is the main socket is under heavy pressure
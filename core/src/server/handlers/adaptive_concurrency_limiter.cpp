@@ -0,0 +1,96 @@
+#include <server/handlers/adaptive_concurrency_limiter.hpp>
+
+#include <algorithm>
+#include <cmath>
+
+#include <userver/utils/assert.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace server::handlers {
+
+namespace {
+
+// The long-term latency follows the recent one slowly, so that a gradual
+// degradation is noticed as well
+constexpr double kLongLatencyWeight = 0.01;
+
+// The limit never drops faster than by half per window
+constexpr double kMinGradient = 0.5;
+
+}  // namespace
+
+AdaptiveConcurrencyLimiter::AdaptiveConcurrencyLimiter(
+    const AdaptiveConcurrencyLimitConfig& config)
+    : config_(config),
+      limit_(std::clamp(config.initial_limit, config.min_limit,
+                        config.max_limit)),
+      estimated_limit_(static_cast<double>(limit_.load())) {
+  UINVARIANT(config_.min_limit > 0 && config_.min_limit <= config_.max_limit,
+             "Invalid adaptive concurrency limits");
+  UINVARIANT(config_.window_size > 0, "Invalid adaptive concurrency window");
+}
+
+bool AdaptiveConcurrencyLimiter::TryAcquire() noexcept {
+  auto in_flight = in_flight_.load(std::memory_order_relaxed);
+  do {
+    if (in_flight >= limit_.load(std::memory_order_relaxed)) return false;
+  } while (!in_flight_.compare_exchange_weak(in_flight, in_flight + 1,
+                                             std::memory_order_relaxed));
+  return true;
+}
+
+void AdaptiveConcurrencyLimiter::Release(
+    std::chrono::microseconds latency) noexcept {
+  // Counts the released request as well, it was in flight during the window
+  const auto in_flight = in_flight_.fetch_sub(1, std::memory_order_relaxed);
+  UASSERT(in_flight > 0);
+
+  const std::lock_guard lock{window_mutex_};
+  window_latency_sum_us_ += static_cast<double>(latency.count());
+  window_max_in_flight_ = std::max(window_max_in_flight_, in_flight);
+  if (++window_samples_ < config_.window_size) return;
+
+  UpdateLimit(window_latency_sum_us_ / window_samples_, window_max_in_flight_);
+  window_latency_sum_us_ = 0;
+  window_samples_ = 0;
+  window_max_in_flight_ = 0;
+}
+
+std::size_t AdaptiveConcurrencyLimiter::GetLimit() const noexcept {
+  return limit_.load(std::memory_order_relaxed);
+}
+
+std::size_t AdaptiveConcurrencyLimiter::GetInFlight() const noexcept {
+  return in_flight_.load(std::memory_order_relaxed);
+}
+
+void AdaptiveConcurrencyLimiter::UpdateLimit(double recent_latency_us,
+                                             std::size_t max_in_flight) {
+  // Sub-microsecond handlers have nothing to measure
+  recent_latency_us = std::max(recent_latency_us, 1.0);
+  long_latency_us_ =
+      long_latency_us_ == 0
+          ? recent_latency_us
+          : long_latency_us_ * (1 - kLongLatencyWeight) +
+                recent_latency_us * kLongLatencyWeight;
+
+  const auto gradient =
+      std::clamp(config_.tolerance * long_latency_us_ / recent_latency_us,
+                 kMinGradient, 1.0);
+  const auto limit = estimated_limit_;
+  // The limit is not probed upwards while far from being reached
+  if (gradient == 1.0 && max_in_flight * 2 < limit) return;
+
+  const auto new_limit = limit * gradient + std::sqrt(limit);
+  estimated_limit_ = std::clamp(
+      limit * (1 - config_.smoothing) + new_limit * config_.smoothing,
+      static_cast<double>(config_.min_limit),
+      static_cast<double>(config_.max_limit));
+  limit_.store(static_cast<std::size_t>(estimated_limit_),
+               std::memory_order_relaxed);
+}
+
+}  // namespace server::handlers
+
+USERVER_NAMESPACE_END
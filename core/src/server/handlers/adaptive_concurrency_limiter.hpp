@@ -0,0 +1,54 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <mutex>
+
+#include <userver/server/handlers/handler_config.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace server::handlers {
+
+/// @brief Limits the number of the concurrent requests to a handler, the
+/// limit follows the ratio of the long-term and the recent latencies.
+///
+/// While the latency stays within `tolerance` of the long-term one the limit
+/// grows by its square root each window, once the handler (or its
+/// downstream) slows down the limit shrinks proportionally, like the
+/// gradient limiter of Netflix concurrency-limits.
+class AdaptiveConcurrencyLimiter final {
+ public:
+  explicit AdaptiveConcurrencyLimiter(
+      const AdaptiveConcurrencyLimitConfig& config);
+
+  /// Returns false if the limit is reached, otherwise the request must be
+  /// finished with Release().
+  bool TryAcquire() noexcept;
+
+  void Release(std::chrono::microseconds latency) noexcept;
+
+  std::size_t GetLimit() const noexcept;
+
+  std::size_t GetInFlight() const noexcept;
+
+ private:
+  void UpdateLimit(double recent_latency_us, std::size_t max_in_flight);
+
+  const AdaptiveConcurrencyLimitConfig config_;
+  std::atomic<std::size_t> limit_;
+  std::atomic<std::size_t> in_flight_{0};
+
+  std::mutex window_mutex_;
+  double window_latency_sum_us_{0};
+  std::size_t window_samples_{0};
+  std::size_t window_max_in_flight_{0};
+  double long_latency_us_{0};
+  // The fractional limit, so that the small limits can grow when smoothed
+  double estimated_limit_;
+};
+
+}  // namespace server::handlers
+
+USERVER_NAMESPACE_END
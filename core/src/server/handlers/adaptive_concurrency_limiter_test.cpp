@@ -0,0 +1,85 @@
+#include <server/handlers/adaptive_concurrency_limiter.hpp>
+
+#include <gtest/gtest.h>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+using server::handlers::AdaptiveConcurrencyLimitConfig;
+using server::handlers::AdaptiveConcurrencyLimiter;
+
+AdaptiveConcurrencyLimitConfig MakeConfig() {
+  AdaptiveConcurrencyLimitConfig config;
+  config.enabled = true;
+  config.initial_limit = 10;
+  config.min_limit = 2;
+  config.max_limit = 100;
+  config.window_size = 10;
+  return config;
+}
+
+// Keeps `concurrency` requests in flight while finishing `requests` ones
+void RunRequests(AdaptiveConcurrencyLimiter& limiter, std::size_t concurrency,
+                 std::size_t requests, std::chrono::microseconds latency) {
+  std::size_t in_flight = 0;
+  for (std::size_t i = 0; i < requests; ++i) {
+    while (in_flight < concurrency && limiter.TryAcquire()) ++in_flight;
+    ASSERT_GT(in_flight, 0);
+    limiter.Release(latency);
+    --in_flight;
+  }
+  for (; in_flight > 0; --in_flight) limiter.Release(latency);
+}
+
+}  // namespace
+
+TEST(AdaptiveConcurrencyLimiter, Acquire) {
+  auto config = MakeConfig();
+  config.initial_limit = 2;
+  AdaptiveConcurrencyLimiter limiter{config};
+
+  EXPECT_TRUE(limiter.TryAcquire());
+  EXPECT_TRUE(limiter.TryAcquire());
+  EXPECT_FALSE(limiter.TryAcquire());
+  EXPECT_EQ(limiter.GetInFlight(), 2);
+
+  limiter.Release(std::chrono::microseconds{100});
+  EXPECT_EQ(limiter.GetInFlight(), 1);
+  EXPECT_TRUE(limiter.TryAcquire());
+}
+
+TEST(AdaptiveConcurrencyLimiter, GrowsWhileLatencyIsStable) {
+  AdaptiveConcurrencyLimiter limiter{MakeConfig()};
+  RunRequests(limiter, 1000, 1000, std::chrono::milliseconds{10});
+  EXPECT_GT(limiter.GetLimit(), 10);
+  EXPECT_LE(limiter.GetLimit(), 100);
+}
+
+TEST(AdaptiveConcurrencyLimiter, NotProbedWhileUnused) {
+  AdaptiveConcurrencyLimiter limiter{MakeConfig()};
+  RunRequests(limiter, 1, 1000, std::chrono::milliseconds{10});
+  EXPECT_EQ(limiter.GetLimit(), 10);
+}
+
+TEST(AdaptiveConcurrencyLimiter, ShrinksOnSlowdown) {
+  AdaptiveConcurrencyLimiter limiter{MakeConfig()};
+  RunRequests(limiter, 1000, 200, std::chrono::milliseconds{10});
+  const auto stable_limit = limiter.GetLimit();
+
+  RunRequests(limiter, 1000, 200, std::chrono::milliseconds{200});
+  EXPECT_LT(limiter.GetLimit(), stable_limit);
+  EXPECT_GE(limiter.GetLimit(), 2);
+}
+
+TEST(AdaptiveConcurrencyLimiter, MinLimit) {
+  auto config = MakeConfig();
+  config.min_limit = 5;
+  config.smoothing = 1;
+  AdaptiveConcurrencyLimiter limiter{config};
+  RunRequests(limiter, 1000, 100, std::chrono::milliseconds{1});
+  RunRequests(limiter, 1000, 300, std::chrono::seconds{10});
+  EXPECT_EQ(limiter.GetLimit(), 5);
+}
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,78 @@
+#include <userver/server/handlers/cpu_profiler.hpp>
+
+#include <fmt/format.h>
+
+#include <userver/logging/log.hpp>
+#include <userver/utils/from_string.hpp>
+#include <userver/yaml_config/schema.hpp>
+#include <utils/cpu_profiler.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace server::handlers {
+
+namespace {
+
+constexpr unsigned kDefaultSeconds = 5;
+constexpr unsigned kMaxSeconds = 60;
+constexpr unsigned kDefaultFrequency = 99;
+constexpr unsigned kMaxFrequency = 1000;
+
+unsigned GetArgInRange(const http::HttpRequest& request, const std::string& arg,
+                       unsigned default_value, unsigned max_value) {
+  if (!request.HasArg(arg)) return default_value;
+
+  unsigned value = 0;
+  try {
+    value = utils::FromString<unsigned>(request.GetArg(arg));
+  } catch (const std::exception& ex) {
+    throw ClientError(ExternalBody{
+        fmt::format("invalid '{}' value: {}", arg, ex.what())});
+  }
+  if (value == 0 || value > max_value) {
+    throw ClientError(ExternalBody{
+        fmt::format("'{}' must be in [1, {}]", arg, max_value)});
+  }
+  return value;
+}
+
+}  // namespace
+
+CpuProfiler::CpuProfiler(const components::ComponentConfig& config,
+                         const components::ComponentContext& component_context)
+    : HttpHandlerBase(config, component_context, /*is_monitor = */ true) {}
+
+std::string CpuProfiler::HandleRequestThrow(const http::HttpRequest& request,
+                                            request::RequestContext&) const {
+  utils::cpu_profiler::Options options;
+  options.duration = std::chrono::seconds{
+      GetArgInRange(request, "seconds", kDefaultSeconds, kMaxSeconds)};
+  options.frequency_hz =
+      GetArgInRange(request, "frequency", kDefaultFrequency, kMaxFrequency);
+
+  utils::cpu_profiler::Profile profile;
+  try {
+    profile = utils::cpu_profiler::Collect(options);
+  } catch (const utils::cpu_profiler::ProfilerBusyError& ex) {
+    request.SetResponseStatus(server::http::HttpStatus::kConflict);
+    return std::string{ex.what()} + "\n";
+  }
+
+  LOG_INFO() << "Collected a CPU profile of " << profile.samples
+             << " samples, dropped " << profile.dropped_samples;
+  auto& response = request.GetHttpResponse();
+  response.SetContentType("text/plain; charset=utf-8");
+  response.SetHeader(std::string_view{"X-Dropped-Samples"},
+                     std::to_string(profile.dropped_samples));
+  return std::move(profile.collapsed_stacks);
+}
+
+yaml_config::Schema CpuProfiler::GetStaticConfigSchema() {
+  auto schema = HttpHandlerBase::GetStaticConfigSchema();
+  schema.UpdateDescription("handler-cpu-profiler config");
+  return schema;
+}
+
+}  // namespace server::handlers
+
+USERVER_NAMESPACE_END
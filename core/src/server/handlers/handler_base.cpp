@@ -91,10 +91,130 @@ properties:
         type: integer
         description: integer to limit RPS to this handler
         defaultDescription: <no limit>
+    adaptive_concurrency_limit:
+        type: object
+        description: limit of the concurrent requests to this handler that adapts to the latency of the handler
+        additionalProperties: false
+        properties:
+            enabled:
+                type: boolean
+                description: reject the requests with 429 once the adaptive concurrency limit is reached
+                defaultDescription: false
+            initial_limit:
+                type: integer
+                description: the limit before any latency is measured
+                defaultDescription: 20
+                minimum: 1
+            min_limit:
+                type: integer
+                description: the limit never gets lower
+                defaultDescription: 4
+                minimum: 1
+            max_limit:
+                type: integer
+                description: the limit never gets higher
+                defaultDescription: 1000
+                minimum: 1
+            window_size:
+                type: integer
+                description: number of the finished requests the limit is recalculated after
+                defaultDescription: 100
+                minimum: 1
+            tolerance:
+                type: number
+                description: how many times the recent latency may exceed the long-term one without decreasing the limit
+                defaultDescription: 1.5
+                minimum: 1
+            smoothing:
+                type: number
+                description: weight of the new limit estimation in the limit
+                defaultDescription: 0.2
+                minimum: 0
+                maximum: 1
     decompress_request:
         type: boolean
         description: allow decompression of the requests
         defaultDescription: false
+    response_compression:
+        type: object
+        description: compression of the responses according to the Accept-Encoding request header
+        additionalProperties: false
+        properties:
+            enabled:
+                type: boolean
+                description: compress the responses with zstd or gzip if the client accepts them
+                defaultDescription: false
+            min_size:
+                type: integer
+                description: do not compress the non-streamed responses with a smaller body
+                defaultDescription: 1024
+                minimum: 0
+            gzip_level:
+                type: integer
+                description: gzip compression level
+                defaultDescription: 6
+                minimum: 1
+                maximum: 9
+            zstd_level:
+                type: integer
+                description: zstd compression level
+                defaultDescription: 3
+                minimum: 1
+                maximum: 22
+            content_types:
+                type: array
+                description: media types of the responses to compress, 'type/*' matches all the subtypes
+                defaultDescription: '[application/json, application/javascript, application/xml, image/svg+xml, text/*]'
+                items:
+                    type: string
+                    description: media type
+    request_coalescing:
+        type: object
+        description: sharing of a single execution between the concurrent GET and HEAD requests with the same path, arguments and headers
+        additionalProperties: false
+        properties:
+            enabled:
+                type: boolean
+                description: execute the concurrent requests with the same key once and send the same response to all of them
+                defaultDescription: false
+            args:
+                type: array
+                description: names of the query arguments that are a part of the key
+                defaultDescription: '[]'
+                items:
+                    type: string
+                    description: argument name
+            headers:
+                type: array
+                description: names of the request headers that are a part of the key
+                defaultDescription: '[]'
+                items:
+                    type: string
+                    description: header name
+    response_cache:
+        type: object
+        description: caching of the responses to GET and HEAD requests according to their Cache-Control header
+        additionalProperties: false
+        properties:
+            enabled:
+                type: boolean
+                description: serve the responses with the Cache-Control max-age or s-maxage from the cache until they expire
+                defaultDescription: false
+            ways:
+                type: integer
+                description: number of the independently locked LRU shards
+                defaultDescription: 16
+                minimum: 1
+            way_size:
+                type: integer
+                description: max number of the responses in a shard
+                defaultDescription: 64
+                minimum: 1
+            max_entry_size:
+                type: integer
+                description: do not cache the responses with a larger body
+                defaultDescription: 65536
+                minimum: 0
     throttling_enabled:
         type: boolean
         description: allow throttling of the requests by components::Server , for more info see its `max_response_size_in_flight` and `requests_queue_size_threshold` options
@@ -107,6 +227,10 @@ properties:
         type: boolean
         description: TODO
         defaultDescription: false
+    request-body-stream:
+        type: boolean
+        description: start the handler right after the request headers are received and pass the body via server::http::RequestBodyStream as it arrives (HTTP/1.x only)
+        defaultDescription: false
     monitor-handler:
         type: boolean
         description: overrides the in-code `is_monitor` flag that makes the handler run either on 'server.listener' or on 'server.listener-monitor'
@@ -132,6 +256,15 @@ properties:
             Deadline propagation is disabled if disabled statically OR
             dynamically.
         defaultDescription: true
+    deadline_early_rejection_enabled:
+        type: boolean
+        description: |
+            When set to `true`, a request is rejected with
+            `deadline_expired_status_code` before the handling if its
+            propagated deadline leaves less time than the median timing of
+            the handler, as the request would likely be cancelled by the
+            deadline anyway.
+        defaultDescription: false
     deadline_expired_status_code:
         type: integer
         description: the HTTP status code to return if the request deadline expires
@@ -31,6 +31,61 @@ FallbackHandler Parse(const yaml_config::YamlConfig& yaml,
   return FallbackHandlerFromString(value);
 }
 
+ResponseCompressionConfig Parse(const yaml_config::YamlConfig& value,
+                                formats::parse::To<ResponseCompressionConfig>) {
+  ResponseCompressionConfig config;
+  config.enabled = value["enabled"].As<bool>(config.enabled);
+  config.min_size = value["min_size"].As<size_t>(config.min_size);
+  config.gzip_level = value["gzip_level"].As<int>(config.gzip_level);
+  config.zstd_level = value["zstd_level"].As<int>(config.zstd_level);
+  config.content_types = value["content_types"].As<std::vector<std::string>>(
+      config.content_types);
+  return config;
+}
+
+RequestCoalescingConfig Parse(const yaml_config::YamlConfig& value,
+                              formats::parse::To<RequestCoalescingConfig>) {
+  RequestCoalescingConfig config;
+  config.enabled = value["enabled"].As<bool>(config.enabled);
+  config.args = value["args"].As<std::vector<std::string>>(config.args);
+  config.headers =
+      value["headers"].As<std::vector<std::string>>(config.headers);
+  return config;
+}
+
+ResponseCacheConfig Parse(const yaml_config::YamlConfig& value,
+                          formats::parse::To<ResponseCacheConfig>) {
+  ResponseCacheConfig config;
+  config.enabled = value["enabled"].As<bool>(config.enabled);
+  config.ways = value["ways"].As<size_t>(config.ways);
+  config.way_size = value["way_size"].As<size_t>(config.way_size);
+  config.max_entry_size =
+      value["max_entry_size"].As<size_t>(config.max_entry_size);
+  return config;
+}
+
+AdaptiveConcurrencyLimitConfig Parse(
+    const yaml_config::YamlConfig& value,
+    formats::parse::To<AdaptiveConcurrencyLimitConfig>) {
+  AdaptiveConcurrencyLimitConfig config;
+  config.enabled = value["enabled"].As<bool>(config.enabled);
+  config.initial_limit =
+      value["initial_limit"].As<size_t>(config.initial_limit);
+  config.min_limit = value["min_limit"].As<size_t>(config.min_limit);
+  config.max_limit = value["max_limit"].As<size_t>(config.max_limit);
+  config.window_size = value["window_size"].As<size_t>(config.window_size);
+  config.tolerance = value["tolerance"].As<double>(config.tolerance);
+  config.smoothing = value["smoothing"].As<double>(config.smoothing);
+
+  if (config.min_limit == 0 || config.min_limit > config.max_limit) {
+    throw std::runtime_error(fmt::format(
+        "adaptive_concurrency_limit min_limit={} should be positive and not "
+        "greater than max_limit={} at {}",
+        config.min_limit, config.max_limit, value.GetPath()));
+  }
+  return config;
+}
+
 HandlerConfig ParseHandlerConfigsWithDefaults(
     const yaml_config::YamlConfig& value,
     const server::ServerConfig& server_config, bool is_monitor) {
@@ -82,12 +137,24 @@ HandlerConfig ParseHandlerConfigsWithDefaults(
           kLogRequestDataSizeDefaultLimit);
   config.max_requests_per_second =
       value["max_requests_per_second"].As<std::optional<size_t>>();
+  config.adaptive_concurrency_limit =
+      value["adaptive_concurrency_limit"].As<AdaptiveConcurrencyLimitConfig>(
+          AdaptiveConcurrencyLimitConfig{});
   config.decompress_request = value["decompress_request"].As<bool>(true);
+  config.response_compression =
+      value["response_compression"].As<ResponseCompressionConfig>(
+          ResponseCompressionConfig{});
+  config.request_coalescing =
+      value["request_coalescing"].As<RequestCoalescingConfig>(
+          RequestCoalescingConfig{});
+  config.response_cache = value["response_cache"].As<ResponseCacheConfig>(
+      ResponseCacheConfig{});
   config.throttling_enabled = value["throttling_enabled"].As<bool>(true);
   config.set_response_server_hostname =
       value["set-response-server-hostname"].As<std::optional<bool>>();
 
   config.response_body_stream = value["response-body-stream"].As<bool>(false);
+  config.request_body_stream = value["request-body-stream"].As<bool>(false);
 
   if (config.max_requests_per_second &&
       config.max_requests_per_second.value() <= 0) {
@@ -103,6 +170,9 @@ HandlerConfig ParseHandlerConfigsWithDefaults(
       value["deadline_propagation_enabled"].As<bool>(
           handler_defaults.deadline_propagation_enabled);
 
+  config.deadline_early_rejection_enabled =
+      value["deadline_early_rejection_enabled"].As<bool>(false);
+
   config.deadline_expired_status_code =
       value["deadline_expired_status_code"].As<http::HttpStatus>(
           handler_defaults.deadline_expired_status_code);
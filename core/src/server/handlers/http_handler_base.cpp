@@ -209,6 +209,8 @@ void HttpHandlerBase::HandleRequestStream(
   auto& http_response = http_request.GetHttpResponse();
   server::http::ResponseBodyStream response_body_stream{
       response.GetBodyProducer(), http_response};
+  response_body_stream.SetCompressor(
+      context.GetInternalContext().GetResponseCompressor());
 
   // Just in case HandleStreamRequest() throws an exception.
   // Though it can be changed in HandleStreamRequest().
@@ -248,6 +250,8 @@ void HttpHandlerBase::HandleRequestStream(
                                 }));
     }
   }
+
+  response_body_stream.FinishBody(engine::Deadline());
 }
 
 void HttpHandlerBase::HandleHttpRequest(
@@ -264,7 +268,11 @@ void HttpHandlerBase::HandleHttpRequest(
     HandleRequestStream(http_request, context);
   } else {
     // !IsBodyStreamed()
-    response.SetData(HandleRequestThrow(http_request, context));
+    auto data = HandleRequestThrow(http_request, context);
+    // The handler may have provided the body via SetSharedData()
+    if (!data.empty() || !response.HasSharedData()) {
+      response.SetData(std::move(data));
+    }
   }
 }
 
@@ -2,6 +2,7 @@
 
 #include <algorithm>
 
+#include <engine/task/task_context.hpp>
 #include <userver/server/request/task_inherited_data.hpp>
 
 USERVER_NAMESPACE_BEGIN
@@ -10,6 +11,9 @@ namespace server::handlers {
 
 namespace {
 
+constexpr std::chrono::seconds kTypicalTimingUpdatePeriod{1};
+constexpr unsigned int kMinRequestsForTypicalTiming = 100;
+
 struct HttpHandlerStatisticsHelper {
   const HttpHandlerStatisticsSnapshot& snapshot;
 };
@@ -25,6 +29,40 @@ void DumpMetric(utils::statistics::Writer& writer,
   writer["deadline-received"] = stats.deadline_received;
   writer["cancelled-by-deadline"] = stats.cancelled_by_deadline;
   writer["timings"] = stats.timings;
+
+  // Only for the handlers that reject requests by the deadline budget
+  if (stats.rejected_by_deadline_budget.value != 0) {
+    writer["rejected-by-deadline-budget"] = stats.rejected_by_deadline_budget;
+  }
+
+  // Only for the handlers that compress responses
+  if (stats.compressed_responses.value != 0) {
+    auto compression = writer["compression"];
+    compression["responses"] = stats.compressed_responses;
+    compression["input-bytes"] = stats.compression_input_bytes;
+    compression["output-bytes"] = stats.compression_output_bytes;
+    compression["cpu-time-us"] = stats.compression_cpu_time_us;
+  }
+
+  // Only for the handlers that coalesce requests
+  if (stats.coalesced_requests.value != 0) {
+    writer["coalescing"]["hits"] = stats.coalesced_requests;
+  }
+
+  // Only for the handlers that cache responses
+  if (stats.response_cache_hits.value != 0 ||
+      stats.response_cache_misses.value != 0) {
+    auto response_cache = writer["response-cache"];
+    response_cache["hits"] = stats.response_cache_hits;
+    response_cache["misses"] = stats.response_cache_misses;
+    response_cache["bytes"] = stats.response_cache_bytes;
+  }
+
+  // Only for the task processors with the allocation accounting enabled.
+  // Divide by `rps` to get the bytes allocated per request.
+  if (stats.allocated_bytes.value != 0) {
+    writer["memory"]["allocated-bytes"] = stats.allocated_bytes;
+  }
 }
 
 }  // namespace
@@ -34,8 +72,43 @@ void HttpHandlerMethodStatistics::Account(
   reply_codes_.Account(
       static_cast<utils::statistics::HttpCodes::Code>(stats.code));
   timings_.GetCurrentCounter().Account(stats.timing.count());
+  if (!stats.cancelled_by_deadline) {
+    handled_timings_.GetCurrentCounter().Account(stats.timing.count());
+  }
   if (stats.deadline.IsReachable()) ++deadline_received_;
   if (stats.cancelled_by_deadline) ++cancelled_by_deadline_;
+  if (stats.allocated_bytes != 0) {
+    allocated_bytes_ += utils::statistics::Rate{stats.allocated_bytes};
+  }
+}
+
+void HttpHandlerMethodStatistics::AccountCompression(
+    std::size_t input_bytes, std::size_t output_bytes,
+    std::chrono::microseconds cpu_time) noexcept {
+  using Rate = utils::statistics::Rate;
+  compression_input_bytes_ += Rate{input_bytes};
+  compression_output_bytes_ += Rate{output_bytes};
+  compression_cpu_time_us_ +=
+      Rate{static_cast<Rate::ValueType>(cpu_time.count())};
+}
+
+std::chrono::milliseconds HttpHandlerMethodStatistics::GetTypicalTiming()
+    const {
+  const auto now = std::chrono::steady_clock::now();
+  auto updated_at = typical_timing_updated_at_.load(std::memory_order_relaxed);
+  if (now - updated_at >= kTypicalTimingUpdatePeriod &&
+      typical_timing_updated_at_.compare_exchange_strong(
+          updated_at, now, std::memory_order_relaxed)) {
+    // The current epoch is included to react to the changes faster
+    const auto timings = handled_timings_.GetStatsForPeriod(
+        HandledRecentPeriod::Duration::min(), true);
+    const std::chrono::milliseconds typical_timing{
+        timings.Count() < kMinRequestsForTypicalTiming
+            ? 0
+            : timings.GetPercentile(50)};
+    typical_timing_.store(typical_timing, std::memory_order_relaxed);
+  }
+  return typical_timing_.load(std::memory_order_relaxed);
 }
 
 std::size_t HttpHandlerMethodStatistics::GetInFlight() const noexcept {
@@ -58,8 +131,18 @@ HttpHandlerStatisticsSnapshot::HttpHandlerStatisticsSnapshot(
       finished(stats.finished_.Load()),
       too_many_requests_in_flight(stats.too_many_requests_in_flight_.Load()),
       rate_limit_reached(stats.rate_limit_reached_.Load()),
+      rejected_by_deadline_budget(stats.rejected_by_deadline_budget_.Load()),
       deadline_received(stats.deadline_received_.Load()),
-      cancelled_by_deadline(stats.cancelled_by_deadline_.Load()) {}
+      cancelled_by_deadline(stats.cancelled_by_deadline_.Load()),
+      compressed_responses(stats.compressed_responses_.Load()),
+      compression_input_bytes(stats.compression_input_bytes_.Load()),
+      compression_output_bytes(stats.compression_output_bytes_.Load()),
+      compression_cpu_time_us(stats.compression_cpu_time_us_.Load()),
+      coalesced_requests(stats.coalesced_requests_.Load()),
+      response_cache_hits(stats.response_cache_hits_.Load()),
+      response_cache_misses(stats.response_cache_misses_.Load()),
+      response_cache_bytes(stats.response_cache_bytes_.load()),
+      allocated_bytes(stats.allocated_bytes_.Load()) {}
 
 void HttpHandlerStatisticsSnapshot::Add(
     const HttpHandlerStatisticsSnapshot& other) {
@@ -69,8 +152,18 @@ void HttpHandlerStatisticsSnapshot::Add(
   finished += other.finished;
   too_many_requests_in_flight += other.too_many_requests_in_flight;
   rate_limit_reached += other.rate_limit_reached;
+  rejected_by_deadline_budget += other.rejected_by_deadline_budget;
   deadline_received += other.deadline_received;
   cancelled_by_deadline += other.cancelled_by_deadline;
+  compressed_responses += other.compressed_responses;
+  compression_input_bytes += other.compression_input_bytes;
+  compression_output_bytes += other.compression_output_bytes;
+  compression_cpu_time_us += other.compression_cpu_time_us;
+  coalesced_requests += other.coalesced_requests;
+  response_cache_hits += other.response_cache_hits;
+  response_cache_misses += other.response_cache_misses;
+  response_cache_bytes += other.response_cache_bytes;
+  allocated_bytes += other.allocated_bytes;
 }
 
 void DumpMetric(utils::statistics::Writer& writer,
@@ -98,6 +191,9 @@ HttpHandlerStatisticsScope::HttpHandlerStatisticsScope(
     : stats_(stats),
       method_(method),
       start_time_(std::chrono::steady_clock::now()),
+      start_allocation_counters_(
+          engine::current_task::GetCurrentTaskContext()
+              .GetAllocationCounters()),
       response_(response) {
   stats_.ForMethod(method).IncrementInFlight();
 }
@@ -112,6 +208,10 @@ HttpHandlerStatisticsScope::~HttpHandlerStatisticsScope() {
       finish_time - start_time_);
   stats.deadline = data ? data->deadline : engine::Deadline{};
   stats.cancelled_by_deadline = cancelled_by_deadline_;
+  stats.allocated_bytes = engine::current_task::GetCurrentTaskContext()
+                              .GetAllocationCounters()
+                              .allocated_bytes -
+                          start_allocation_counters_.allocated_bytes;
   stats_.ForMethod(method_).Account(stats);
   stats_.ForMethod(method_).DecrementInFlight();
 }
@@ -1,8 +1,10 @@
 #pragma once
 
 #include <array>
+#include <atomic>
 #include <chrono>
 #include <cstddef>
+#include <cstdint>
 #include <type_traits>
 
 #include <server/http/handler_methods.hpp>
@@ -13,6 +15,7 @@
 #include <userver/utils/statistics/rate.hpp>
 #include <userver/utils/statistics/rate_counter.hpp>
 #include <userver/utils/statistics/recentperiod.hpp>
+#include <utils/jemalloc.hpp>
 #include <utils/statistics/http_codes.hpp>
 
 USERVER_NAMESPACE_BEGIN
@@ -25,6 +28,8 @@ struct HttpHandlerStatisticsEntry final {
   std::chrono::milliseconds timing{};
   engine::Deadline deadline{};
   bool cancelled_by_deadline{false};
+  // 0 if the allocation accounting is disabled for the task processor
+  std::uint64_t allocated_bytes{0};
 };
 
 struct HttpHandlerStatisticsSnapshot;
@@ -47,6 +52,34 @@ class HttpHandlerMethodStatistics final {
 
   void IncrementRateLimitReached() noexcept { ++rate_limit_reached_; }
 
+  void IncrementRejectedByDeadlineBudget() noexcept {
+    ++rejected_by_deadline_budget_;
+  }
+
+  /// Median timing of the recent requests that were not cancelled by deadline,
+  /// so that the deadline rejections do not skew it. Recomputed at most once a
+  /// second, zero while there are too few requests to tell.
+  std::chrono::milliseconds GetTypicalTiming() const;
+
+  void IncrementCompressedResponses() noexcept { ++compressed_responses_; }
+
+  void IncrementCoalescedRequests() noexcept { ++coalesced_requests_; }
+
+  void IncrementResponseCacheHits() noexcept { ++response_cache_hits_; }
+
+  void IncrementResponseCacheMisses() noexcept { ++response_cache_misses_; }
+
+  void AddResponseCacheBytes(std::size_t bytes) noexcept {
+    response_cache_bytes_ += bytes;
+  }
+
+  void SubtractResponseCacheBytes(std::size_t bytes) noexcept {
+    response_cache_bytes_ -= bytes;
+  }
+
+  void AccountCompression(std::size_t input_bytes, std::size_t output_bytes,
+                          std::chrono::microseconds cpu_time) noexcept;
+
  private:
   friend struct HttpHandlerStatisticsSnapshot;
 
@@ -55,14 +88,37 @@ class HttpHandlerMethodStatistics final {
       utils::statistics::RecentPeriod<Percentile, Percentile,
                                       utils::datetime::SteadyClock>;
 
+  // Coarse, as only the median is needed
+  using HandledPercentile =
+      utils::statistics::Percentile<200, unsigned int, 76, 50>;
+  using HandledRecentPeriod =
+      utils::statistics::RecentPeriod<HandledPercentile, HandledPercentile,
+                                      utils::datetime::SteadyClock>;
+
   RecentPeriod timings_;
+  HandledRecentPeriod handled_timings_{std::chrono::seconds{10},
+                                       std::chrono::seconds{30}};
+  mutable std::atomic<std::chrono::milliseconds> typical_timing_{
+      std::chrono::milliseconds{0}};
+  mutable std::atomic<std::chrono::steady_clock::time_point>
+      typical_timing_updated_at_{std::chrono::steady_clock::time_point{}};
   utils::statistics::HttpCodes reply_codes_;
   utils::statistics::RateCounter started_;
   utils::statistics::RateCounter finished_;
   utils::statistics::RateCounter too_many_requests_in_flight_;
   utils::statistics::RateCounter rate_limit_reached_;
+  utils::statistics::RateCounter rejected_by_deadline_budget_;
   utils::statistics::RateCounter deadline_received_;
   utils::statistics::RateCounter cancelled_by_deadline_;
+  utils::statistics::RateCounter compressed_responses_;
+  utils::statistics::RateCounter compression_input_bytes_;
+  utils::statistics::RateCounter compression_output_bytes_;
+  utils::statistics::RateCounter compression_cpu_time_us_;
+  utils::statistics::RateCounter coalesced_requests_;
+  utils::statistics::RateCounter response_cache_hits_;
+  utils::statistics::RateCounter response_cache_misses_;
+  std::atomic<std::size_t> response_cache_bytes_{0};
+  utils::statistics::RateCounter allocated_bytes_;
 };
 
 void DumpMetric(utils::statistics::Writer& writer,
@@ -82,8 +138,18 @@ struct HttpHandlerStatisticsSnapshot final {
   utils::statistics::Rate finished;
   utils::statistics::Rate too_many_requests_in_flight;
   utils::statistics::Rate rate_limit_reached;
+  utils::statistics::Rate rejected_by_deadline_budget;
   utils::statistics::Rate deadline_received;
   utils::statistics::Rate cancelled_by_deadline;
+  utils::statistics::Rate compressed_responses;
+  utils::statistics::Rate compression_input_bytes;
+  utils::statistics::Rate compression_output_bytes;
+  utils::statistics::Rate compression_cpu_time_us;
+  utils::statistics::Rate coalesced_requests;
+  utils::statistics::Rate response_cache_hits;
+  utils::statistics::Rate response_cache_misses;
+  std::size_t response_cache_bytes{0};
+  utils::statistics::Rate allocated_bytes;
 };
 
 void DumpMetric(utils::statistics::Writer& writer,
@@ -154,6 +220,7 @@ class HttpHandlerStatisticsScope final {
   HttpHandlerStatistics& stats_;
   const http::HttpMethod method_;
   const std::chrono::steady_clock::time_point start_time_;
+  const utils::jemalloc::AllocationCounters start_allocation_counters_;
   server::http::HttpResponse& response_;
   bool cancelled_by_deadline_{false};
 };
@@ -0,0 +1,49 @@
+#include <server/handlers/http_handler_base_statistics.hpp>
+
+#include <memory>
+
+#include <gtest/gtest.h>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+using server::handlers::HttpHandlerMethodStatistics;
+using server::handlers::HttpHandlerStatisticsEntry;
+
+void AccountRequests(HttpHandlerMethodStatistics& stats, int count,
+                     std::chrono::milliseconds timing,
+                     bool cancelled_by_deadline = false) {
+  HttpHandlerStatisticsEntry entry;
+  entry.code = server::http::HttpStatus::kOk;
+  entry.timing = timing;
+  entry.cancelled_by_deadline = cancelled_by_deadline;
+  for (int i = 0; i < count; ++i) stats.Account(entry);
+}
+
+}  // namespace
+
+TEST(HttpHandlerStatistics, TypicalTiming) {
+  auto stats = std::make_unique<HttpHandlerMethodStatistics>();
+  AccountRequests(*stats, 60, std::chrono::milliseconds{10});
+  AccountRequests(*stats, 40, std::chrono::milliseconds{500});
+
+  EXPECT_EQ(stats->GetTypicalTiming(), std::chrono::milliseconds{10});
+}
+
+TEST(HttpHandlerStatistics, TypicalTimingTooFewRequests) {
+  auto stats = std::make_unique<HttpHandlerMethodStatistics>();
+  AccountRequests(*stats, 10, std::chrono::milliseconds{10});
+
+  EXPECT_EQ(stats->GetTypicalTiming(), std::chrono::milliseconds::zero());
+}
+
+TEST(HttpHandlerStatistics, TypicalTimingSkipsCancelledByDeadline) {
+  auto stats = std::make_unique<HttpHandlerMethodStatistics>();
+  AccountRequests(*stats, 100, std::chrono::milliseconds{20});
+  AccountRequests(*stats, 200, std::chrono::milliseconds{1}, true);
+
+  EXPECT_EQ(stats->GetTypicalTiming(), std::chrono::milliseconds{20});
+}
+
+USERVER_NAMESPACE_END
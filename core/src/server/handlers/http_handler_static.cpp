@@ -1,9 +1,20 @@
 #include <userver/server/handlers/http_handler_static.hpp>
 
+#include <memory>
+#include <optional>
+#include <string>
+
+#include <fmt/format.h>
+
+#include <server/http/byte_range.hpp>
+#include <server/http/entity_tag.hpp>
+#include <server/http/response_compressor.hpp>
 #include <userver/components/component_config.hpp>
 #include <userver/components/component_context.hpp>
 #include <userver/dynamic_config/storage/component.hpp>
 #include <userver/dynamic_config/value.hpp>
+#include <userver/http/common_headers.hpp>
+#include <userver/utils/assert.hpp>
 #include <userver/yaml_config/merge_schemas.hpp>
 
 USERVER_NAMESPACE_BEGIN
@@ -33,6 +44,76 @@ const dynamic_config::Key<dynamic_config::ValueDict<std::string>>
 )"},
     };
 
+namespace headers = USERVER_NAMESPACE::http::headers;
+
+// Representations have distinct strong entity tags, RFC 9110, 8.8.3
+std::string MakeEncodedEtag(std::string_view etag, std::string_view encoding) {
+  UASSERT(etag.size() >= 2 && etag.back() == '"');
+  return fmt::format("{}-{}\"", etag.substr(0, etag.size() - 1), encoding);
+}
+
+struct Representation final {
+  std::shared_ptr<const std::string> data;
+  std::string etag;
+  std::string_view encoding;
+};
+
+Representation SelectRepresentation(const fs::FileInfoWithDataConstPtr& file,
+                                    const http::HttpRequest& request) {
+  // Ranges are served from the identity representation only
+  if (request.HasHeader(headers::kRange)) {
+    return {{file, &file->data}, file->etag, {}};
+  }
+
+  const auto encoding = http::NegotiateContentEncoding(
+      request.GetHeader(headers::kAcceptEncoding), !file->gzip_data.empty(),
+      !file->zstd_data.empty());
+  if (!encoding) return {{file, &file->data}, file->etag, {}};
+
+  switch (*encoding) {
+    case http::ContentEncoding::kGzip:
+      return {{file, &file->gzip_data}, MakeEncodedEtag(file->etag, "gzip"),
+              "gzip"};
+    case http::ContentEncoding::kZstd:
+      return {{file, &file->zstd_data}, MakeEncodedEtag(file->etag, "zstd"),
+              "zstd"};
+  }
+  UINVARIANT(false, "Unexpected content encoding");
+}
+
+// Returns the body of the partial response or nullopt to send the whole file
+std::optional<std::string> HandleRange(const http::HttpRequest& request,
+                                       const fs::FileInfoWithData& file) {
+  const auto& range_header = request.GetHeader(headers::kRange);
+  if (range_header.empty() || request.GetMethod() != http::HttpMethod::kGet) {
+    return std::nullopt;
+  }
+
+  // The range is applicable only to the version the client has
+  const auto& if_range = request.GetHeader(headers::kIfRange);
+  if (!if_range.empty() && if_range != file.etag) return std::nullopt;
+
+  auto& response = request.GetHttpResponse();
+  const auto range = http::ParseByteRange(range_header, file.data.size());
+  switch (range.status) {
+    case http::ByteRange::Status::kNone:
+      return std::nullopt;
+    case http::ByteRange::Status::kUnsatisfiable:
+      response.SetStatus(http::HttpStatus::kRangeNotSatisfiable);
+      response.SetHeader(headers::kContentRange,
+                         fmt::format("bytes */{}", file.data.size()));
+      return std::string{};
+    case http::ByteRange::Status::kSatisfiable:
+      response.SetStatus(http::HttpStatus::kPartialContent);
+      response.SetHeader(
+          headers::kContentRange,
+          fmt::format("bytes {}-{}/{}", range.offset,
+                      range.offset + range.size - 1, file.data.size()));
+      return file.data.substr(range.offset, range.size);
+  }
+  UINVARIANT(false, "Unexpected range status");
+}
+
 }  // namespace
 
 HttpHandlerStatic::HttpHandlerStatic(
@@ -50,14 +131,43 @@ std::string HttpHandlerStatic::HandleRequestThrow(
     const http::HttpRequest& request, request::RequestContext&) const {
   LOG_DEBUG() << "Handler: " << request.GetRequestPath();
   const auto file = storage_.TryGetFile(request.GetRequestPath());
-  if (file) {
+  if (!file) {
+    request.GetResponse().SetStatusNotFound();
+    return "File not found";
+  }
+
+  auto& response = request.GetHttpResponse();
+  {
     const auto config = config_.GetSnapshot();
-    request.GetHttpResponse().SetContentType(
-        config[kContentTypeMap][file->extension]);
-    return file->data;
+    response.SetContentType(config[kContentTypeMap][file->extension]);
+  }
+  response.SetHeader(headers::kAcceptRanges, "bytes");
+  if (!file->gzip_data.empty() || !file->zstd_data.empty()) {
+    response.SetHeader(headers::kVary, std::string{headers::kAcceptEncoding});
+  }
+
+  auto representation = SelectRepresentation(file, request);
+  if (!file->etag.empty()) {
+    response.SetHeader(headers::kETag, representation.etag);
+
+    const auto& if_none_match = request.GetHeader(headers::kIfNoneMatch);
+    if (!if_none_match.empty() &&
+        http::IsEtagMatching(if_none_match, representation.etag)) {
+      response.SetStatus(http::HttpStatus::kNotModified);
+      return {};
+    }
+  }
+
+  if (auto partial_body = HandleRange(request, *file)) {
+    return std::move(*partial_body);
+  }
+
+  if (!representation.encoding.empty()) {
+    response.SetContentEncoding(std::string{representation.encoding});
   }
-  request.GetResponse().SetStatusNotFound();
-  return "File not found";
+  // The cached file is shared with the response instead of being copied
+  response.SetSharedData(std::move(representation.data));
+  return {};
 }
 
 yaml_config::Schema HttpHandlerStatic::GetStaticConfigSchema() {
@@ -33,6 +33,18 @@ const dynamic_config::Key<CcCustomStatus> kCcCustomStatus{
 const dynamic_config::Key<bool> kStreamApiEnabled{
     "USERVER_HANDLER_STREAM_API_ENABLED", false};
 
+const dynamic_config::Key<
+    USERVER_NAMESPACE::congestion_control::QueueTimeLimiterConfig>
+    kQueueTimeCcConfig{
+        "USERVER_QUEUE_TIME_CCONTROL",
+        dynamic_config::DefaultAsJsonString{"{}"},
+    };
+
+const dynamic_config::Key<http::AdaptiveLifoConfig> kAdaptiveLifoConfig{
+    "USERVER_ADAPTIVE_LIFO",
+    dynamic_config::DefaultAsJsonString{"{}"},
+};
+
 }  // namespace server::handlers
 
 USERVER_NAMESPACE_END
@@ -2,6 +2,8 @@
 
 #include <chrono>
 
+#include <congestion_control/queue_time_limiter.hpp>
+#include <server/http/adaptive_lifo_queue.hpp>
 #include <userver/dynamic_config/snapshot.hpp>
 #include <userver/server/http/http_status.hpp>
 
@@ -27,6 +29,12 @@ extern const dynamic_config::Key<CcCustomStatus> kCcCustomStatus;
 
 extern const dynamic_config::Key<bool> kStreamApiEnabled;
 
+extern const dynamic_config::Key<
+    USERVER_NAMESPACE::congestion_control::QueueTimeLimiterConfig>
+    kQueueTimeCcConfig;
+
+extern const dynamic_config::Key<http::AdaptiveLifoConfig> kAdaptiveLifoConfig;
+
 }  // namespace server::handlers
 
 USERVER_NAMESPACE_END
@@ -1,6 +1,7 @@
 #include <userver/server/handlers/server_monitor.hpp>
 
 #include <userver/components/component.hpp>
+#include <userver/concurrent/variable.hpp>
 #include <userver/components/statistics_storage.hpp>
 #include <userver/formats/json/serialize.hpp>
 #include <userver/server/handlers/exceptions.hpp>
@@ -60,6 +61,12 @@ std::optional<StatsFormat> ParseFormat(std::string_view format) {
 
 }  // namespace
 
+// A scrape that finds the cache busy with a concurrent scrape formats the
+// metrics without it
+struct ServerMonitor::PrometheusCache final {
+  concurrent::Variable<utils::statistics::PrometheusFormatCache> cache;
+};
+
 ServerMonitor::ServerMonitor(
     const components::ComponentConfig& config,
     const components::ComponentContext& component_context)
@@ -68,7 +75,10 @@ ServerMonitor::ServerMonitor(
           component_context.FindComponent<components::StatisticsStorage>()
               .GetStorage()),
       common_labels_{config["common-labels"].As<CommonLabels>({})},
-      default_format_{ParseFormat(config["format"].As<std::string>({}))} {}
+      default_format_{ParseFormat(config["format"].As<std::string>({}))},
+      prometheus_cache_(std::make_unique<PrometheusCache>()) {}
+
+ServerMonitor::~ServerMonitor() = default;
 
 std::string ServerMonitor::HandleRequestThrow(const http::HttpRequest& request,
                                               request::RequestContext&) const {
@@ -113,13 +123,25 @@ std::string ServerMonitor::HandleRequestThrow(const http::HttpRequest& request,
       return utils::statistics::ToGraphiteFormat(statistics_storage_,
                                                  statistics_request);
 
-    case StatsFormat::kPrometheus:
-      return utils::statistics::ToPrometheusFormat(statistics_storage_,
-                                                   statistics_request);
+    case StatsFormat::kPrometheus: {
+      auto cache = prometheus_cache_->cache.UniqueLock(std::try_to_lock);
+      if (!cache) {
+        return utils::statistics::ToPrometheusFormat(statistics_storage_,
+                                                     statistics_request);
+      }
+      return utils::statistics::ToPrometheusFormat(
+          statistics_storage_, statistics_request, **cache);
+    }
 
-    case StatsFormat::kPrometheusUntyped:
-      return utils::statistics::ToPrometheusFormatUntyped(statistics_storage_,
-                                                          statistics_request);
+    case StatsFormat::kPrometheusUntyped: {
+      auto cache = prometheus_cache_->cache.UniqueLock(std::try_to_lock);
+      if (!cache) {
+        return utils::statistics::ToPrometheusFormatUntyped(
+            statistics_storage_, statistics_request);
+      }
+      return utils::statistics::ToPrometheusFormatUntyped(
+          statistics_storage_, statistics_request, **cache);
+    }
 
     case StatsFormat::kJson:
       request.GetHttpResponse().SetContentType("application/json");
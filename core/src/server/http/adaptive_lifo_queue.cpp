@@ -0,0 +1,103 @@
+#include <server/http/adaptive_lifo_queue.hpp>
+
+#include <algorithm>
+#include <mutex>
+
+#include <userver/engine/single_consumer_event.hpp>
+#include <userver/formats/json/value.hpp>
+#include <userver/utils/assert.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace server::http {
+
+AdaptiveLifoConfig Parse(const formats::json::Value& value,
+                         formats::parse::To<AdaptiveLifoConfig>) {
+  AdaptiveLifoConfig result;
+  result.enabled = value["enabled"].As<bool>(result.enabled);
+  result.max_concurrent_requests =
+      value["max-concurrent-requests"].As<std::size_t>(
+          result.max_concurrent_requests);
+  result.lifo_queue_size =
+      value["lifo-queue-size"].As<std::size_t>(result.lifo_queue_size);
+  result.lifo_queue_age = std::chrono::milliseconds{
+      value["lifo-queue-age-ms"].As<std::chrono::milliseconds::rep>(
+          result.lifo_queue_age.count())};
+  return result;
+}
+
+struct AdaptiveLifoQueue::Waiter final {
+  engine::SingleConsumerEvent event;
+  std::chrono::steady_clock::time_point enqueued_at;
+  // Guarded by mutex_
+  bool is_admitted{false};
+};
+
+AdaptiveLifoQueue::EnterResult AdaptiveLifoQueue::Enter(
+    engine::Deadline deadline, const AdaptiveLifoConfig& config) {
+  std::unique_lock lock(mutex_);
+  if (waiters_.empty() && in_flight_ < config.max_concurrent_requests) {
+    ++in_flight_;
+    return EnterResult::kAdmitted;
+  }
+  if (deadline.IsReached()) return EnterResult::kDeadlineExpired;
+
+  Waiter waiter;
+  waiter.enqueued_at = std::chrono::steady_clock::now();
+  waiters_.push_back(&waiter);
+  lock.unlock();
+
+  [[maybe_unused]] const bool is_signaled =
+      waiter.event.WaitForEventUntil(deadline);
+
+  // Leave() wakes up the waiter under the lock, so the waiter may only be
+  // destroyed after the lock is taken
+  lock.lock();
+  if (waiter.is_admitted) return EnterResult::kAdmitted;
+  UASSERT(!is_signaled);
+
+  const auto it = std::find(waiters_.begin(), waiters_.end(), &waiter);
+  UASSERT(it != waiters_.end());
+  waiters_.erase(it);
+  return deadline.IsReached() ? EnterResult::kDeadlineExpired
+                              : EnterResult::kCancelled;
+}
+
+void AdaptiveLifoQueue::Leave(const AdaptiveLifoConfig& config) {
+  const std::lock_guard lock(mutex_);
+  UASSERT(in_flight_ > 0);
+  --in_flight_;
+
+  const auto now = std::chrono::steady_clock::now();
+  // The limit may have been raised, admit as many requests as it allows
+  while (!waiters_.empty() && in_flight_ < config.max_concurrent_requests) {
+    Waiter* waiter = nullptr;
+    if (IsOverloaded(now, config)) {
+      waiter = waiters_.back();
+      waiters_.pop_back();
+    } else {
+      waiter = waiters_.front();
+      waiters_.pop_front();
+    }
+    waiter->is_admitted = true;
+    waiter->event.Send();
+    ++in_flight_;
+  }
+}
+
+std::size_t AdaptiveLifoQueue::GetQueueSize() const {
+  const std::lock_guard lock(mutex_);
+  return waiters_.size();
+}
+
+bool AdaptiveLifoQueue::IsOverloaded(
+    std::chrono::steady_clock::time_point now,
+    const AdaptiveLifoConfig& config) const {
+  UASSERT(!waiters_.empty());
+  return waiters_.size() > config.lifo_queue_size ||
+         now - waiters_.front()->enqueued_at > config.lifo_queue_age;
+}
+
+}  // namespace server::http
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,67 @@
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+#include <deque>
+
+#include <userver/engine/deadline.hpp>
+#include <userver/engine/mutex.hpp>
+#include <userver/formats/json_fwd.hpp>
+#include <userver/formats/parse/to.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace server::http {
+
+struct AdaptiveLifoConfig final {
+  bool enabled{false};
+  /// Requests handled concurrently, the other ones wait in the queue
+  std::size_t max_concurrent_requests{1000};
+  /// The queue is served newest-first if more requests wait...
+  std::size_t lifo_queue_size{100};
+  /// ...or if the oldest request has waited for longer
+  std::chrono::milliseconds lifo_queue_age{50};
+};
+
+AdaptiveLifoConfig Parse(const formats::json::Value& value,
+                         formats::parse::To<AdaptiveLifoConfig>);
+
+/// @brief Admission queue of the requests with adaptive LIFO order.
+///
+/// At most `max_concurrent_requests` requests are handled at once, the other
+/// ones wait in the queue. Normally the queue is FIFO, but under overload the
+/// oldest requests are likely to time out anyway, so when the queue grows
+/// beyond the thresholds the newest requests are served first. A waiting
+/// request is shed when its deadline passes, before any handler work.
+class AdaptiveLifoQueue final {
+ public:
+  enum class EnterResult {
+    kAdmitted,
+    kDeadlineExpired,
+    kCancelled,
+  };
+
+  /// Waits for the request turn, Leave() must be called after the handling
+  /// if the request is admitted
+  EnterResult Enter(engine::Deadline deadline,
+                    const AdaptiveLifoConfig& config);
+
+  /// Passes the turn to a waiting request
+  void Leave(const AdaptiveLifoConfig& config);
+
+  std::size_t GetQueueSize() const;
+
+ private:
+  struct Waiter;
+
+  bool IsOverloaded(std::chrono::steady_clock::time_point now,
+                    const AdaptiveLifoConfig& config) const;
+
+  mutable engine::Mutex mutex_;
+  std::deque<Waiter*> waiters_;
+  std::size_t in_flight_{0};
+};
+
+}  // namespace server::http
+
+USERVER_NAMESPACE_END
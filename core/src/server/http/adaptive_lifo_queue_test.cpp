@@ -0,0 +1,158 @@
+#include <server/http/adaptive_lifo_queue.hpp>
+
+#include <vector>
+
+#include <userver/engine/async.hpp>
+#include <userver/engine/sleep.hpp>
+#include <userver/engine/task/task_with_result.hpp>
+#include <userver/formats/json/serialize.hpp>
+#include <userver/formats/json/value.hpp>
+#include <userver/utest/utest.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+using server::http::AdaptiveLifoConfig;
+using server::http::AdaptiveLifoQueue;
+using EnterResult = AdaptiveLifoQueue::EnterResult;
+
+AdaptiveLifoConfig MakeConfig(std::size_t max_concurrent_requests,
+                              std::size_t lifo_queue_size) {
+  AdaptiveLifoConfig config;
+  config.enabled = true;
+  config.max_concurrent_requests = max_concurrent_requests;
+  config.lifo_queue_size = lifo_queue_size;
+  config.lifo_queue_age = std::chrono::hours{1};
+  return config;
+}
+
+void WaitForQueueSize(const AdaptiveLifoQueue& queue, std::size_t size) {
+  while (queue.GetQueueSize() != size) engine::Yield();
+}
+
+// Enqueues `count` waiters one by one, each one records its index once
+// admitted and leaves immediately
+std::vector<engine::TaskWithResult<void>> EnqueueWaiters(
+    AdaptiveLifoQueue& queue, const AdaptiveLifoConfig& config,
+    std::vector<int>& order, int count) {
+  std::vector<engine::TaskWithResult<void>> tasks;
+  for (int i = 0; i < count; ++i) {
+    tasks.push_back(engine::AsyncNoSpan([&queue, &config, &order, i] {
+      EXPECT_EQ(queue.Enter({}, config), EnterResult::kAdmitted);
+      order.push_back(i);
+      queue.Leave(config);
+    }));
+    WaitForQueueSize(queue, i + 1);
+  }
+  return tasks;
+}
+
+}  // namespace
+
+TEST(AdaptiveLifoQueue, Parse) {
+  const auto config =
+      formats::json::FromString(
+          R"({"enabled": true, "max-concurrent-requests": 10})")
+          .As<AdaptiveLifoConfig>();
+  EXPECT_TRUE(config.enabled);
+  EXPECT_EQ(config.max_concurrent_requests, 10);
+  EXPECT_EQ(config.lifo_queue_size, 100);
+  EXPECT_EQ(config.lifo_queue_age, std::chrono::milliseconds{50});
+}
+
+UTEST(AdaptiveLifoQueue, FifoWithoutOverload) {
+  AdaptiveLifoQueue queue;
+  const auto config = MakeConfig(1, 10);
+  ASSERT_EQ(queue.Enter({}, config), EnterResult::kAdmitted);
+
+  std::vector<int> order;
+  auto tasks = EnqueueWaiters(queue, config, order, 3);
+  queue.Leave(config);
+  for (auto& task : tasks) task.Get();
+
+  EXPECT_EQ(order, (std::vector<int>{0, 1, 2}));
+}
+
+UTEST(AdaptiveLifoQueue, LifoOnOverload) {
+  AdaptiveLifoQueue queue;
+  const auto config = MakeConfig(1, 1);
+  ASSERT_EQ(queue.Enter({}, config), EnterResult::kAdmitted);
+
+  std::vector<int> order;
+  auto tasks = EnqueueWaiters(queue, config, order, 3);
+  queue.Leave(config);
+  for (auto& task : tasks) task.Get();
+
+  // Newest first while the queue is longer than lifo_queue_size
+  EXPECT_EQ(order, (std::vector<int>{2, 1, 0}));
+}
+
+UTEST(AdaptiveLifoQueue, LifoOnQueueAge) {
+  AdaptiveLifoQueue queue;
+  auto config = MakeConfig(1, 10);
+  config.lifo_queue_age = std::chrono::milliseconds{1};
+  ASSERT_EQ(queue.Enter({}, config), EnterResult::kAdmitted);
+
+  std::vector<int> order;
+  auto tasks = EnqueueWaiters(queue, config, order, 2);
+  engine::SleepFor(std::chrono::milliseconds{10});
+  queue.Leave(config);
+  for (auto& task : tasks) task.Get();
+
+  EXPECT_EQ(order, (std::vector<int>{1, 0}));
+}
+
+UTEST(AdaptiveLifoQueue, DeadlineExpired) {
+  AdaptiveLifoQueue queue;
+  const auto config = MakeConfig(1, 10);
+  ASSERT_EQ(queue.Enter({}, config), EnterResult::kAdmitted);
+
+  EXPECT_EQ(
+      queue.Enter(engine::Deadline::FromDuration(std::chrono::milliseconds{10}),
+                  config),
+      EnterResult::kDeadlineExpired);
+  EXPECT_EQ(queue.Enter(engine::Deadline::Passed(), config),
+            EnterResult::kDeadlineExpired);
+  EXPECT_EQ(queue.GetQueueSize(), 0);
+
+  queue.Leave(config);
+  EXPECT_EQ(queue.Enter(engine::Deadline::Passed(), config),
+            EnterResult::kAdmitted);
+  queue.Leave(config);
+}
+
+UTEST(AdaptiveLifoQueue, Cancelled) {
+  AdaptiveLifoQueue queue;
+  const auto config = MakeConfig(1, 10);
+  ASSERT_EQ(queue.Enter({}, config), EnterResult::kAdmitted);
+
+  auto task = engine::AsyncNoSpan([&] { return queue.Enter({}, config); });
+  WaitForQueueSize(queue, 1);
+  task.RequestCancel();
+  EXPECT_EQ(task.Get(), EnterResult::kCancelled);
+  EXPECT_EQ(queue.GetQueueSize(), 0);
+
+  queue.Leave(config);
+}
+
+UTEST_MT(AdaptiveLifoQueue, RaisedLimitAdmitsWaiters, 2) {
+  AdaptiveLifoQueue queue;
+  const auto config = MakeConfig(1, 10);
+  ASSERT_EQ(queue.Enter({}, config), EnterResult::kAdmitted);
+  ASSERT_EQ(queue.Enter({}, MakeConfig(2, 10)), EnterResult::kAdmitted);
+
+  std::vector<engine::TaskWithResult<EnterResult>> tasks;
+  for (int i = 0; i < 3; ++i) {
+    tasks.push_back(
+        engine::AsyncNoSpan([&] { return queue.Enter({}, config); }));
+  }
+  WaitForQueueSize(queue, 3);
+
+  // A single Leave() admits as many requests as the new limit allows
+  queue.Leave(MakeConfig(4, 10));
+  for (auto& task : tasks) EXPECT_EQ(task.Get(), EnterResult::kAdmitted);
+  EXPECT_EQ(queue.GetQueueSize(), 0);
+}
+
+USERVER_NAMESPACE_END
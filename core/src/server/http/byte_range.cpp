@@ -0,0 +1,70 @@
+#include <server/http/byte_range.hpp>
+
+#include <algorithm>
+#include <charconv>
+#include <optional>
+
+#include <userver/utils/text_light.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace server::http {
+
+namespace {
+
+constexpr std::string_view kBytesUnit = "bytes=";
+
+std::optional<std::size_t> ParsePosition(std::string_view value) {
+  std::size_t result = 0;
+  const auto* end = value.data() + value.size();
+  const auto [ptr, ec] = std::from_chars(value.data(), end, result);
+  if (value.empty() || ec != std::errc{} || ptr != end) return std::nullopt;
+  return result;
+}
+
+ByteRange MakeSatisfiable(std::size_t first, std::size_t last) {
+  return {ByteRange::Status::kSatisfiable, first, last - first + 1};
+}
+
+}  // namespace
+
+ByteRange ParseByteRange(std::string_view header, std::size_t content_size) {
+  constexpr ByteRange kNone{};
+  constexpr ByteRange kUnsatisfiable{ByteRange::Status::kUnsatisfiable};
+
+  if (!utils::text::ICaseStartsWith(header, kBytesUnit)) return kNone;
+  const auto spec = header.substr(kBytesUnit.size());
+  // Multiple ranges require multipart/byteranges, the whole content is fine
+  if (spec.find(',') != std::string_view::npos) return kNone;
+
+  const auto dash_pos = spec.find('-');
+  if (dash_pos == std::string_view::npos) return kNone;
+  const auto first_str = spec.substr(0, dash_pos);
+  const auto last_str = spec.substr(dash_pos + 1);
+
+  if (first_str.empty()) {
+    // Suffix range: the last N bytes
+    const auto suffix_size = ParsePosition(last_str);
+    if (!suffix_size) return kNone;
+    if (*suffix_size == 0 || content_size == 0) return kUnsatisfiable;
+    return MakeSatisfiable(content_size - std::min(*suffix_size, content_size),
+                           content_size - 1);
+  }
+
+  const auto first = ParsePosition(first_str);
+  if (!first) return kNone;
+
+  std::size_t last = content_size - 1;
+  if (!last_str.empty()) {
+    const auto parsed_last = ParsePosition(last_str);
+    if (!parsed_last || *parsed_last < *first) return kNone;
+    last = std::min(*parsed_last, last);
+  }
+
+  if (*first >= content_size) return kUnsatisfiable;
+  return MakeSatisfiable(*first, last);
+}
+
+}  // namespace server::http
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,29 @@
+#pragma once
+
+#include <cstddef>
+#include <string_view>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace server::http {
+
+struct ByteRange final {
+  enum class Status {
+    // No range, a malformed one or several: the whole content is sent
+    kNone,
+    kSatisfiable,
+    kUnsatisfiable,
+  };
+
+  Status status{Status::kNone};
+  std::size_t offset{0};
+  std::size_t size{0};
+};
+
+/// Parses the Range request header value with a single range of bytes of the
+/// content of size `content_size`, see RFC 9110, 14.1.2.
+ByteRange ParseByteRange(std::string_view header, std::size_t content_size);
+
+}  // namespace server::http
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,61 @@
+#include <server/http/byte_range.hpp>
+
+#include <gtest/gtest.h>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+using server::http::ByteRange;
+using server::http::ParseByteRange;
+
+constexpr std::size_t kSize = 1000;
+
+void ExpectRange(std::string_view header, std::size_t offset,
+                 std::size_t size) {
+  const auto range = ParseByteRange(header, kSize);
+  EXPECT_EQ(range.status, ByteRange::Status::kSatisfiable) << header;
+  EXPECT_EQ(range.offset, offset) << header;
+  EXPECT_EQ(range.size, size) << header;
+}
+
+void ExpectStatus(std::string_view header, ByteRange::Status status,
+                  std::size_t content_size = kSize) {
+  EXPECT_EQ(ParseByteRange(header, content_size).status, status) << header;
+}
+
+}  // namespace
+
+TEST(ByteRange, Satisfiable) {
+  ExpectRange("bytes=0-499", 0, 500);
+  ExpectRange("bytes=500-999", 500, 500);
+  ExpectRange("bytes=500-", 500, 500);
+  ExpectRange("bytes=900-5000", 900, 100);
+  ExpectRange("bytes=-100", 900, 100);
+  ExpectRange("bytes=-5000", 0, kSize);
+  ExpectRange("Bytes=0-0", 0, 1);
+}
+
+TEST(ByteRange, Unsatisfiable) {
+  using Status = ByteRange::Status;
+  ExpectStatus("bytes=1000-", Status::kUnsatisfiable);
+  ExpectStatus("bytes=1000-2000", Status::kUnsatisfiable);
+  ExpectStatus("bytes=-0", Status::kUnsatisfiable);
+  ExpectStatus("bytes=0-", Status::kUnsatisfiable, 0);
+  ExpectStatus("bytes=-10", Status::kUnsatisfiable, 0);
+}
+
+TEST(ByteRange, Ignored) {
+  using Status = ByteRange::Status;
+  ExpectStatus("", Status::kNone);
+  ExpectStatus("items=0-10", Status::kNone);
+  ExpectStatus("bytes=", Status::kNone);
+  ExpectStatus("bytes=10", Status::kNone);
+  ExpectStatus("bytes=abc-", Status::kNone);
+  ExpectStatus("bytes=10-5", Status::kNone);
+  ExpectStatus("bytes=0-10,20-30", Status::kNone);
+  ExpectStatus("bytes=-", Status::kNone);
+  ExpectStatus("bytes= 0-10", Status::kNone);
+}
+
+USERVER_NAMESPACE_END
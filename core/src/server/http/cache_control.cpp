@@ -0,0 +1,77 @@
+#include <server/http/cache_control.hpp>
+
+#include <charconv>
+#include <cstdint>
+
+#include <userver/utils/str_icase.hpp>
+#include <userver/utils/text_light.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace server::http {
+
+namespace {
+
+std::string_view TrimSpaces(std::string_view value) {
+  while (!value.empty() && utils::text::IsAsciiSpace(value.front())) {
+    value.remove_prefix(1);
+  }
+  while (!value.empty() && utils::text::IsAsciiSpace(value.back())) {
+    value.remove_suffix(1);
+  }
+  return value;
+}
+
+std::optional<std::chrono::seconds> ParseDeltaSeconds(std::string_view value) {
+  // The quoted form is not allowed, but is widely used, RFC 9111, 5.2
+  if (value.size() >= 2 && value.front() == '"' && value.back() == '"') {
+    value = value.substr(1, value.size() - 2);
+  }
+
+  std::uint32_t seconds = 0;
+  const auto* end = value.data() + value.size();
+  const auto [ptr, ec] = std::from_chars(value.data(), end, seconds);
+  if (ec != std::errc{} || ptr != end) return std::nullopt;
+  return std::chrono::seconds{seconds};
+}
+
+}  // namespace
+
+std::optional<std::chrono::seconds> CacheControl::GetSharedFreshnessLifetime()
+    const {
+  if (no_store || no_cache || is_private) return std::nullopt;
+
+  const auto& lifetime = s_maxage ? s_maxage : max_age;
+  if (!lifetime || lifetime->count() == 0) return std::nullopt;
+  return lifetime;
+}
+
+CacheControl ParseCacheControl(std::string_view header) {
+  const utils::StrIcaseEqual equal;
+  CacheControl result;
+
+  for (const auto item : utils::text::SplitIntoStringViewVector(header, ",")) {
+    const auto value_pos = item.find('=');
+    const auto name = TrimSpaces(item.substr(0, value_pos));
+
+    if (equal(name, "no-store")) {
+      result.no_store = true;
+    } else if (equal(name, "no-cache")) {
+      result.no_cache = true;
+    } else if (equal(name, "private")) {
+      result.is_private = true;
+    } else if (value_pos != std::string_view::npos) {
+      const auto value = TrimSpaces(item.substr(value_pos + 1));
+      if (equal(name, "max-age")) {
+        result.max_age = ParseDeltaSeconds(value);
+      } else if (equal(name, "s-maxage")) {
+        result.s_maxage = ParseDeltaSeconds(value);
+      }
+    }
+  }
+  return result;
+}
+
+}  // namespace server::http
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,31 @@
+#pragma once
+
+#include <chrono>
+#include <optional>
+#include <string_view>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace server::http {
+
+/// The Cache-Control directives that are relevant for a shared cache, see
+/// RFC 9111, 5.2.
+struct CacheControl final {
+  bool no_store{false};
+  bool no_cache{false};
+  bool is_private{false};
+  std::optional<std::chrono::seconds> max_age;
+  std::optional<std::chrono::seconds> s_maxage;
+
+  /// The time the response may be served from a shared cache for, empty if
+  /// it may not be stored or has to be revalidated.
+  std::optional<std::chrono::seconds> GetSharedFreshnessLifetime() const;
+};
+
+/// Parses the Cache-Control header value, ignores the unknown and the
+/// malformed directives.
+CacheControl ParseCacheControl(std::string_view header);
+
+}  // namespace server::http
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,45 @@
+#include <server/http/cache_control.hpp>
+
+#include <gtest/gtest.h>
+
+USERVER_NAMESPACE_BEGIN
+
+using server::http::ParseCacheControl;
+using std::chrono::seconds;
+
+TEST(CacheControl, Empty) {
+  const auto cache_control = ParseCacheControl("");
+  EXPECT_FALSE(cache_control.no_store);
+  EXPECT_FALSE(cache_control.max_age);
+  EXPECT_FALSE(cache_control.GetSharedFreshnessLifetime());
+}
+
+TEST(CacheControl, MaxAge) {
+  EXPECT_EQ(ParseCacheControl("max-age=60").GetSharedFreshnessLifetime(),
+            seconds{60});
+  EXPECT_EQ(ParseCacheControl("public, Max-Age = 5").max_age, seconds{5});
+  EXPECT_EQ(ParseCacheControl("max-age=\"7\"").max_age, seconds{7});
+  EXPECT_EQ(ParseCacheControl("max-age=10, s-maxage=20")
+                .GetSharedFreshnessLifetime(),
+            seconds{20});
+}
+
+TEST(CacheControl, Malformed) {
+  EXPECT_FALSE(ParseCacheControl("max-age").max_age);
+  EXPECT_FALSE(ParseCacheControl("max-age=").max_age);
+  EXPECT_FALSE(ParseCacheControl("max-age=-1").max_age);
+  EXPECT_FALSE(ParseCacheControl("max-age=1x").max_age);
+  EXPECT_FALSE(ParseCacheControl("max-age=99999999999").max_age);
+}
+
+TEST(CacheControl, NotStored) {
+  EXPECT_FALSE(ParseCacheControl("max-age=0").GetSharedFreshnessLifetime());
+  EXPECT_FALSE(
+      ParseCacheControl("max-age=60, no-store").GetSharedFreshnessLifetime());
+  EXPECT_FALSE(
+      ParseCacheControl("no-cache, max-age=60").GetSharedFreshnessLifetime());
+  EXPECT_FALSE(ParseCacheControl("private=\"Authorization\", max-age=60")
+                   .GetSharedFreshnessLifetime());
+}
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,22 @@
+#include <server/http/entity_tag.hpp>
+
+#include <userver/utils/text_light.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace server::http {
+
+bool IsEtagMatching(std::string_view if_none_match, std::string_view etag) {
+  for (auto tag : utils::text::SplitIntoStringViewVector(if_none_match, ",")) {
+    while (!tag.empty() && tag.front() == ' ') tag.remove_prefix(1);
+    while (!tag.empty() && tag.back() == ' ') tag.remove_suffix(1);
+    if (tag == "*") return true;
+    if (utils::text::StartsWith(tag, "W/")) tag.remove_prefix(2);
+    if (tag == etag) return true;
+  }
+  return false;
+}
+
+}  // namespace server::http
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,15 @@
+#pragma once
+
+#include <string_view>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace server::http {
+
+/// Whether the If-None-Match request header value matches the entity tag of
+/// the response, uses the weak comparison, see RFC 9110, 13.1.2.
+bool IsEtagMatching(std::string_view if_none_match, std::string_view etag);
+
+}  // namespace server::http
+
+USERVER_NAMESPACE_END
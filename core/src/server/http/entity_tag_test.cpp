@@ -0,0 +1,22 @@
+#include <server/http/entity_tag.hpp>
+
+#include <gtest/gtest.h>
+
+USERVER_NAMESPACE_BEGIN
+
+using server::http::IsEtagMatching;
+
+TEST(EntityTag, Matching) {
+  EXPECT_TRUE(IsEtagMatching("\"abc\"", "\"abc\""));
+  EXPECT_TRUE(IsEtagMatching("\"x\", \"abc\"", "\"abc\""));
+  EXPECT_TRUE(IsEtagMatching("W/\"abc\"", "\"abc\""));
+  EXPECT_TRUE(IsEtagMatching("*", "\"abc\""));
+}
+
+TEST(EntityTag, NotMatching) {
+  EXPECT_FALSE(IsEtagMatching("", "\"abc\""));
+  EXPECT_FALSE(IsEtagMatching("\"abcd\"", "\"abc\""));
+  EXPECT_FALSE(IsEtagMatching("abc", "\"abc\""));
+}
+
+USERVER_NAMESPACE_END
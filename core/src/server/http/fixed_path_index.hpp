@@ -1,7 +1,6 @@
 #pragma once
 
 #include <string>
-#include <unordered_map>
 
 #include <userver/engine/task/task_processor_fwd.hpp>
 
@@ -9,6 +8,7 @@
 #include <server/http/handler_method_index.hpp>
 #include <userver/server/handlers/http_handler_base.hpp>
 #include <userver/server/http/http_method.hpp>
+#include <userver/utils/impl/flat_hash_map.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
@@ -25,7 +25,8 @@ class FixedPathIndex final {
   void AddHandler(std::string path, const handlers::HttpHandlerBase& handler,
                   engine::TaskProcessor& task_processor);
 
-  std::unordered_map<std::string, HandlerMethodIndex> handler_method_index_map_;
+  utils::impl::FlatHashMap<std::string, HandlerMethodIndex>
+      handler_method_index_map_;
 };
 
 }  // namespace server::http::impl
@@ -0,0 +1,552 @@
+#include "http2_session.hpp"
+
+#include <algorithm>
+#include <cstring>
+#include <deque>
+#include <iterator>
+#include <stdexcept>
+#include <vector>
+
+#include <fmt/compile.h>
+#include <fmt/format.h>
+
+#include <userver/http/common_headers.hpp>
+#include <userver/logging/log.hpp>
+#include <userver/server/http/http_method.hpp>
+#include <userver/utils/assert.hpp>
+
+#include <server/http/http_cached_date.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace server::http {
+
+namespace {
+
+// The same as for HTTP/1.1, see HttpResponse::SendResponse
+constexpr std::string_view kDefaultContentType = "application/octet-stream";
+
+constexpr std::size_t kFrameHeaderSize = 9;
+
+bool IsBodyForbiddenForStatus(HttpStatus status) {
+  return status == HttpStatus::kNoContent ||
+         status == HttpStatus::kNotModified ||
+         (static_cast<int>(status) >= 100 && static_cast<int>(status) < 200);
+}
+
+// RFC 9113, section 8.2.2
+bool IsConnectionSpecificHeader(std::string_view lowercase_name) {
+  return lowercase_name == "connection" || lowercase_name == "keep-alive" ||
+         lowercase_name == "proxy-connection" ||
+         lowercase_name == "transfer-encoding" || lowercase_name == "upgrade";
+}
+
+std::string ToLowerAscii(std::string_view str) {
+  std::string result{str};
+  for (auto& c : result) {
+    if (c >= 'A' && c <= 'Z') c = static_cast<char>(c - 'A' + 'a');
+  }
+  return result;
+}
+
+std::uint8_t* ToBytes(std::string_view str) {
+  // NOLINTNEXTLINE(cppcoreguidelines-pro-type-const-cast,cppcoreguidelines-pro-type-reinterpret-cast)
+  return reinterpret_cast<std::uint8_t*>(const_cast<char*>(str.data()));
+}
+
+nghttp2_nv MakeHeaderField(std::string_view name, std::string_view value) {
+  // nghttp2 copies the header fields on submission
+  return {ToBytes(name), ToBytes(value), name.size(), value.size(),
+          NGHTTP2_NV_FLAG_NONE};
+}
+
+HttpResponse& GetHttpResponse(request::RequestBase& request) {
+  // NOLINTNEXTLINE(cppcoreguidelines-pro-type-static-cast-downcast)
+  return static_cast<HttpResponse&>(request.GetResponse());
+}
+
+}  // namespace
+
+void Http2Session::SessionDeleter::operator()(
+    nghttp2_session* session) const noexcept {
+  nghttp2_session_del(session);
+}
+
+Http2Session::Http2Session(const HandlerInfoIndex& handler_info_index,
+                           const request::HttpRequestConfig& request_config,
+                           std::uint32_t max_concurrent_streams,
+                           OnNewRequestCb&& on_new_request_cb,
+                           OnStreamClosedCb&& on_stream_closed_cb,
+                           net::ParserStats& stats,
+                           request::ResponseDataAccounter& data_accounter)
+    : handler_info_index_(handler_info_index),
+      request_constructor_config_{request_config},
+      on_new_request_cb_(std::move(on_new_request_cb)),
+      on_stream_closed_cb_(std::move(on_stream_closed_cb)),
+      stats_(stats),
+      data_accounter_(data_accounter) {
+  nghttp2_session_callbacks* callbacks = nullptr;
+  if (nghttp2_session_callbacks_new(&callbacks) != 0) {
+    throw std::bad_alloc();
+  }
+  nghttp2_session_callbacks_set_on_begin_headers_callback(callbacks,
+                                                          &OnBeginHeaders);
+  nghttp2_session_callbacks_set_on_header_callback(callbacks, &OnHeader);
+  nghttp2_session_callbacks_set_on_data_chunk_recv_callback(callbacks,
+                                                            &OnDataChunkRecv);
+  nghttp2_session_callbacks_set_on_frame_recv_callback(callbacks,
+                                                       &OnFrameRecv);
+  nghttp2_session_callbacks_set_on_frame_send_callback(callbacks,
+                                                       &OnFrameSend);
+  nghttp2_session_callbacks_set_on_stream_close_callback(callbacks,
+                                                         &OnStreamClose);
+
+  nghttp2_session* session = nullptr;
+  const auto ret = nghttp2_session_server_new(&session, callbacks, this);
+  nghttp2_session_callbacks_del(callbacks);
+  if (ret != 0) {
+    throw std::runtime_error(fmt::format(
+        "Failed to create an HTTP/2 session: {}", nghttp2_strerror(ret)));
+  }
+  session_.reset(session);
+
+  const nghttp2_settings_entry settings[]{
+      {NGHTTP2_SETTINGS_MAX_CONCURRENT_STREAMS, max_concurrent_streams},
+  };
+  const auto settings_ret = nghttp2_submit_settings(
+      session_.get(), NGHTTP2_FLAG_NONE, settings, std::size(settings));
+  if (settings_ret != 0) {
+    throw std::runtime_error(
+        fmt::format("Failed to submit HTTP/2 settings: {}",
+                    nghttp2_strerror(settings_ret)));
+  }
+}
+
+Http2Session::~Http2Session() {
+  // The stream callbacks are not called on the session destruction
+  session_.reset();
+  for (const auto& [stream_id, stream] : streams_) {
+    if (stream.request_constructor) stats_.parsing_request_count.Subtract(1);
+  }
+}
+
+bool Http2Session::Parse(const char* data, size_t size) {
+  const auto ret = nghttp2_session_mem_recv(
+      session_.get(),
+      // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
+      reinterpret_cast<const std::uint8_t*>(data), size);
+  if (ret < 0) {
+    LOG_WARNING() << "HTTP/2 session error: "
+                  << nghttp2_strerror(static_cast<int>(ret));
+    // Sends GOAWAY, if it was not sent yet
+    nghttp2_session_terminate_session(session_.get(), NGHTTP2_PROTOCOL_ERROR);
+    return false;
+  }
+  return true;
+}
+
+void Http2Session::SubmitResponse(std::int32_t stream_id) {
+  auto* stream = FindStream(stream_id);
+  // The stream may have been reset by the peer
+  if (!stream || !stream->request || stream->is_response_submitted) return;
+  stream->is_response_submitted = true;
+
+  auto& response = GetHttpResponse(*stream->request);
+  const auto& request = response.request_;
+  const bool is_streamed = HasStreamedBody(response);
+  const bool is_body_forbidden = IsBodyForbiddenForStatus(response.status_);
+  const bool is_head_request = request.GetMethod() == HttpMethod::kHead;
+
+  if (is_body_forbidden && !response.GetData().empty()) {
+    LOG_LIMITED_WARNING()
+        << "Non-empty body provided for response with HTTP code "
+        << static_cast<int>(response.status_)
+        << " which does not allow one, it will be dropped";
+  }
+
+  // Storage for the header fields that are not stored in the response as is,
+  // the references must stay valid until the submission
+  std::deque<std::string> storage;
+  std::vector<nghttp2_nv> fields;
+  fields.reserve(response.headers_.size() + response.cookies_.size() + 4);
+
+  const auto& status =
+      storage.emplace_back(fmt::format(FMT_COMPILE("{}"),
+                                       static_cast<int>(response.status_)));
+  fields.push_back(MakeHeaderField(":status", status));
+
+  const auto end = response.headers_.end();
+  if (response.headers_.find(USERVER_NAMESPACE::http::headers::kDate) ==
+      end) {
+    fields.push_back(MakeHeaderField("date", impl::GetCachedDate()));
+  }
+  if (response.headers_.find(
+          USERVER_NAMESPACE::http::headers::kContentType) == end) {
+    fields.push_back(MakeHeaderField("content-type", kDefaultContentType));
+  }
+  for (const auto& [name, value] : response.headers_) {
+    auto lowercase_name = ToLowerAscii(name);
+    if (lowercase_name == "content-length" ||
+        IsConnectionSpecificHeader(lowercase_name)) {
+      continue;
+    }
+    const auto& field_name = storage.emplace_back(std::move(lowercase_name));
+    fields.push_back(MakeHeaderField(field_name, value));
+  }
+  for (const auto& [name, cookie] : response.cookies_) {
+    fields.push_back(
+        MakeHeaderField("set-cookie", storage.emplace_back(cookie.ToString())));
+  }
+  if (!is_streamed && !is_body_forbidden) {
+    fields.push_back(MakeHeaderField(
+        "content-length",
+        storage.emplace_back(
+            fmt::format(FMT_COMPILE("{}"), response.GetData().size()))));
+  }
+
+  nghttp2_data_provider data_provider{};
+  data_provider.read_callback = &ReadBody;
+  const bool has_body =
+      !is_head_request && !is_body_forbidden &&
+      (is_streamed || !response.GetData().empty());
+  if (has_body && !is_streamed) stream->body = response.GetData();
+  if (!has_body) stream->is_body_finished = true;
+
+  const auto ret = nghttp2_submit_response(
+      session_.get(), stream_id, fields.data(), fields.size(),
+      has_body ? &data_provider : nullptr);
+  if (ret != 0) {
+    LOG_ERROR() << "Failed to submit an HTTP/2 response: "
+                << nghttp2_strerror(ret);
+    nghttp2_submit_rst_stream(session_.get(), NGHTTP2_FLAG_NONE, stream_id,
+                              NGHTTP2_INTERNAL_ERROR);
+  }
+}
+
+void Http2Session::AppendBodyPart(std::int32_t stream_id, std::string&& part) {
+  auto* stream = FindStream(stream_id);
+  if (!stream || stream->is_body_finished || part.empty()) return;
+
+  const bool was_empty = stream->body_parts.empty();
+  stream->body_parts.push_back(std::move(part));
+  if (was_empty) nghttp2_session_resume_data(session_.get(), stream_id);
+}
+
+void Http2Session::FinishBody(std::int32_t stream_id) {
+  auto* stream = FindStream(stream_id);
+  if (!stream || stream->is_body_finished) return;
+
+  stream->is_body_finished = true;
+  nghttp2_session_resume_data(session_.get(), stream_id);
+}
+
+std::string_view Http2Session::GetPendingOutput() {
+  const std::uint8_t* data = nullptr;
+  const auto size = nghttp2_session_mem_send(session_.get(), &data);
+  if (size < 0) {
+    LOG_ERROR() << "Failed to serialize HTTP/2 frames: "
+                << nghttp2_strerror(static_cast<int>(size));
+    nghttp2_session_terminate_session(session_.get(), NGHTTP2_INTERNAL_ERROR);
+    return {};
+  }
+  // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
+  return {reinterpret_cast<const char*>(data), static_cast<std::size_t>(size)};
+}
+
+bool Http2Session::IsAlive() const {
+  return nghttp2_session_want_read(session_.get()) ||
+         nghttp2_session_want_write(session_.get());
+}
+
+void Http2Session::Shutdown() {
+  // Lets the streams that are already open finish
+  nghttp2_submit_goaway(
+      session_.get(), NGHTTP2_FLAG_NONE,
+      nghttp2_session_get_last_proc_stream_id(session_.get()),
+      NGHTTP2_NO_ERROR, nullptr, 0);
+}
+
+bool Http2Session::HasStreamedBody(const HttpResponse& response) {
+  // e.g. a CustomHandlerException replaces the stream with a ready body
+  return response.IsBodyStreamed() && response.GetData().empty();
+}
+
+bool Http2Session::PopStreamedBodyPart(HttpResponse& response,
+                                       std::string& part) {
+  UASSERT(response.body_stream_);
+  while (response.body_stream_->Pop(part)) {
+    if (!part.empty()) return true;
+  }
+  response.body_stream_producer_.reset();
+  response.body_stream_.reset();
+  return false;
+}
+
+int Http2Session::OnBeginHeaders(nghttp2_session*, const nghttp2_frame* frame,
+                                 void* user_data) {
+  if (frame->hd.type != NGHTTP2_HEADERS ||
+      frame->headers.cat != NGHTTP2_HCAT_REQUEST) {
+    return 0;
+  }
+
+  auto* self = static_cast<Http2Session*>(user_data);
+  UASSERT(self != nullptr);
+  try {
+    auto& stream = self->streams_[frame->hd.stream_id];
+    stream.request_constructor.emplace(self->request_constructor_config_,
+                                       self->handler_info_index_,
+                                       self->data_accounter_,
+                                       stream.raw_headers,
+                                       self->request_pool_);
+    stream.request_constructor->SetHttpMajor(2);
+    stream.request_constructor->SetHttpMinor(0);
+    self->stats_.parsing_request_count.Add(1);
+  } catch (const std::exception& ex) {
+    LOG_ERROR() << "Failed to start an HTTP/2 stream: " << ex;
+    return NGHTTP2_ERR_CALLBACK_FAILURE;
+  }
+  return 0;
+}
+
+int Http2Session::OnHeader(nghttp2_session*, const nghttp2_frame* frame,
+                           const std::uint8_t* name, std::size_t name_size,
+                           const std::uint8_t* value, std::size_t value_size,
+                           std::uint8_t, void* user_data) {
+  // Trailers are ignored
+  if (frame->hd.type != NGHTTP2_HEADERS ||
+      frame->headers.cat != NGHTTP2_HCAT_REQUEST) {
+    return 0;
+  }
+
+  auto* self = static_cast<Http2Session*>(user_data);
+  UASSERT(self != nullptr);
+  auto* stream = self->FindStream(frame->hd.stream_id);
+  if (!stream || !stream->request_constructor) return 0;
+
+  // NOLINTBEGIN(cppcoreguidelines-pro-type-reinterpret-cast)
+  return self->OnHeaderImpl(
+      *stream, {reinterpret_cast<const char*>(name), name_size},
+      {reinterpret_cast<const char*>(value), value_size});
+  // NOLINTEND(cppcoreguidelines-pro-type-reinterpret-cast)
+}
+
+int Http2Session::OnDataChunkRecv(nghttp2_session*, std::uint8_t,
+                                  std::int32_t stream_id,
+                                  const std::uint8_t* data, std::size_t size,
+                                  void* user_data) {
+  auto* self = static_cast<Http2Session*>(user_data);
+  UASSERT(self != nullptr);
+  auto* stream = self->FindStream(stream_id);
+  if (!stream || !stream->request_constructor || stream->is_malformed) {
+    return 0;
+  }
+
+  try {
+    if (!self->CompleteUrl(*stream)) return 0;
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
+    stream->request_constructor->AppendBody(reinterpret_cast<const char*>(data),
+                                            size);
+  } catch (const std::exception& ex) {
+    LOG_WARNING() << "can't append body: " << ex;
+    stream->is_malformed = true;
+  }
+  return 0;
+}
+
+int Http2Session::OnFrameRecv(nghttp2_session*, const nghttp2_frame* frame,
+                              void* user_data) {
+  if (frame->hd.type != NGHTTP2_HEADERS && frame->hd.type != NGHTTP2_DATA) {
+    return 0;
+  }
+  if (!(frame->hd.flags & NGHTTP2_FLAG_END_STREAM)) return 0;
+
+  auto* self = static_cast<Http2Session*>(user_data);
+  UASSERT(self != nullptr);
+  auto* stream = self->FindStream(frame->hd.stream_id);
+  if (!stream || !stream->request_constructor) return 0;
+
+  try {
+    self->FinalizeRequest(frame->hd.stream_id, *stream);
+  } catch (const std::exception& ex) {
+    LOG_ERROR() << "Failed to finalize an HTTP/2 request: " << ex;
+    return NGHTTP2_ERR_CALLBACK_FAILURE;
+  }
+  return 0;
+}
+
+int Http2Session::OnFrameSend(nghttp2_session*, const nghttp2_frame* frame,
+                              void* user_data) {
+  if (frame->hd.type != NGHTTP2_HEADERS && frame->hd.type != NGHTTP2_DATA) {
+    return 0;
+  }
+
+  auto* self = static_cast<Http2Session*>(user_data);
+  UASSERT(self != nullptr);
+  if (auto* stream = self->FindStream(frame->hd.stream_id)) {
+    stream->bytes_sent += kFrameHeaderSize + frame->hd.length;
+  }
+  return 0;
+}
+
+int Http2Session::OnStreamClose(nghttp2_session*, std::int32_t stream_id,
+                                std::uint32_t error_code, void* user_data) {
+  auto* self = static_cast<Http2Session*>(user_data);
+  UASSERT(self != nullptr);
+  const auto it = self->streams_.find(stream_id);
+  if (it == self->streams_.end()) return 0;
+
+  auto& stream = it->second;
+  if (stream.request_constructor) {
+    self->stats_.parsing_request_count.Subtract(1);
+  }
+  const auto request = std::move(stream.request);
+  const bool is_sent =
+      error_code == NGHTTP2_NO_ERROR && stream.is_response_submitted;
+  const auto bytes_sent = stream.bytes_sent;
+  self->streams_.erase(it);
+  if (!request) return 0;
+
+  if (is_sent) {
+    GetHttpResponse(*request).SetSent(bytes_sent,
+                                      std::chrono::steady_clock::now());
+  }
+  try {
+    self->on_stream_closed_cb_(stream_id, is_sent);
+  } catch (const std::exception& ex) {
+    LOG_ERROR() << "Failed to close an HTTP/2 stream: " << ex;
+    return NGHTTP2_ERR_CALLBACK_FAILURE;
+  }
+  return 0;
+}
+
+ssize_t Http2Session::ReadBody(nghttp2_session*, std::int32_t stream_id,
+                               std::uint8_t* buf, std::size_t size,
+                               std::uint32_t* data_flags, nghttp2_data_source*,
+                               void* user_data) {
+  auto* self = static_cast<Http2Session*>(user_data);
+  UASSERT(self != nullptr);
+  auto* stream = self->FindStream(stream_id);
+  if (!stream) return NGHTTP2_ERR_TEMPORAL_CALLBACK_FAILURE;
+
+  std::size_t copied = 0;
+  if (!stream->body.empty()) {
+    copied = std::min(size, stream->body.size() - stream->body_offset);
+    std::memcpy(buf, stream->body.data() + stream->body_offset, copied);
+    stream->body_offset += copied;
+    if (stream->body_offset == stream->body.size()) {
+      stream->is_body_finished = true;
+      *data_flags |= NGHTTP2_DATA_FLAG_EOF;
+    }
+  } else {
+    while (copied < size && !stream->body_parts.empty()) {
+      const auto& part = stream->body_parts.front();
+      const auto part_copied =
+          std::min(size - copied, part.size() - stream->body_offset);
+      std::memcpy(buf + copied, part.data() + stream->body_offset,
+                  part_copied);
+      copied += part_copied;
+      stream->body_offset += part_copied;
+      if (stream->body_offset == part.size()) {
+        stream->body_parts.pop_front();
+        stream->body_offset = 0;
+      }
+    }
+    if (stream->body_parts.empty()) {
+      if (stream->is_body_finished) {
+        *data_flags |= NGHTTP2_DATA_FLAG_EOF;
+      } else if (copied == 0) {
+        return NGHTTP2_ERR_DEFERRED;
+      }
+    }
+  }
+  return static_cast<ssize_t>(copied);
+}
+
+int Http2Session::OnHeaderImpl(Stream& stream, std::string_view name,
+                               std::string_view value) {
+  if (stream.is_malformed) return 0;
+
+  auto& request_constructor = *stream.request_constructor;
+  try {
+    // nghttp2 makes sure that the pseudo-headers go first
+    if (!name.empty() && name.front() == ':') {
+      if (name == ":method") {
+        request_constructor.SetMethod(HttpMethodFromString(value));
+      } else if (name == ":path") {
+        request_constructor.AppendUrl(value.data(), value.size());
+      } else if (name == ":authority") {
+        stream.authority = value;
+      }
+      // :scheme is of no use to the handlers
+      return 0;
+    }
+
+    if (!CompleteUrl(stream)) return 0;
+    // :authority replaces the host header
+    if (name == "host" && !stream.authority.empty()) return 0;
+
+    request_constructor.AppendHeaderField(name.data(), name.size());
+    request_constructor.AppendHeaderValue(value.data(), value.size());
+  } catch (const std::exception& ex) {
+    LOG_WARNING() << "can't append header: " << ex;
+    stream.is_malformed = true;
+  }
+  return 0;
+}
+
+bool Http2Session::CompleteUrl(Stream& stream) {
+  if (stream.is_malformed) return false;
+  if (stream.is_url_complete) return true;
+  stream.is_url_complete = true;
+
+  auto& request_constructor = *stream.request_constructor;
+  try {
+    request_constructor.ParseUrl();
+    if (!stream.authority.empty()) {
+      const std::string_view host = USERVER_NAMESPACE::http::headers::kHost;
+      request_constructor.AppendHeaderField(host.data(), host.size());
+      request_constructor.AppendHeaderValue(stream.authority.data(),
+                                            stream.authority.size());
+    }
+  } catch (const std::exception& ex) {
+    LOG_WARNING() << "can't parse url: " << ex;
+    stream.is_malformed = true;
+    return false;
+  }
+  return true;
+}
+
+void Http2Session::FinalizeRequest(std::int32_t stream_id, Stream& stream) {
+  if (CompleteUrl(stream)) {
+    try {
+      // Flushes the last header field
+      stream.request_constructor->AppendHeaderField("", 0);
+    } catch (const std::exception& ex) {
+      LOG_WARNING() << "can't append header: " << ex;
+    }
+  }
+
+  // Malformed requests are finalized as well to respond with an error,
+  // the status was set by the request constructor
+  auto request = stream.request_constructor->Finalize();
+  stream.request_constructor.reset();
+  stats_.parsing_request_count.Subtract(1);
+
+  if (!request) {
+    LOG_ERROR() << "request is null after Finalize()";
+    nghttp2_submit_rst_stream(session_.get(), NGHTTP2_FLAG_NONE, stream_id,
+                              NGHTTP2_INTERNAL_ERROR);
+    return;
+  }
+  stream.request = request;
+  on_new_request_cb_(stream_id, std::move(request));
+}
+
+Http2Session::Stream* Http2Session::FindStream(std::int32_t stream_id) {
+  const auto it = streams_.find(stream_id);
+  return it == streams_.end() ? nullptr : &it->second;
+}
+
+}  // namespace server::http
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,159 @@
+#pragma once
+
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+
+#include <sys/types.h>
+
+#include <nghttp2/nghttp2.h>
+
+#include <server/net/stats.hpp>
+#include <server/request/request_parser.hpp>
+
+#include <userver/server/http/http_response.hpp>
+#include <userver/server/request/request_config.hpp>
+
+#include "http_request_constructor.hpp"
+
+USERVER_NAMESPACE_BEGIN
+
+namespace server::http {
+
+/// @brief Server side of an HTTP/2 connection.
+///
+/// Keeps the HPACK and the flow control state of the connection, turns the
+/// received streams into requests and the responses into frames. Performs no
+/// I/O: the received bytes are fed with Parse(), the frames to send are taken
+/// with GetPendingOutput(). Not thread-safe.
+class Http2Session final : public request::RequestParser {
+ public:
+  using OnNewRequestCb = std::function<void(
+      std::int32_t stream_id, std::shared_ptr<request::RequestBase>&&)>;
+
+  // Called for every stream that had a request, `is_sent` is false if the
+  // stream was reset before the whole response was sent
+  using OnStreamClosedCb =
+      std::function<void(std::int32_t stream_id, bool is_sent)>;
+
+  static constexpr std::string_view kClientPreface =
+      "PRI * HTTP/2.0\r\n\r\nSM\r\n\r\n";
+
+  Http2Session(const HandlerInfoIndex& handler_info_index,
+               const request::HttpRequestConfig& request_config,
+               std::uint32_t max_concurrent_streams,
+               OnNewRequestCb&& on_new_request_cb,
+               OnStreamClosedCb&& on_stream_closed_cb, net::ParserStats& stats,
+               request::ResponseDataAccounter& data_accounter);
+
+  ~Http2Session() override;
+
+  Http2Session(Http2Session&&) = delete;
+  Http2Session& operator=(Http2Session&&) = delete;
+
+  /// Consumes the received bytes starting with the client connection preface.
+  /// Returns false on a connection error, the pending output still has to be
+  /// sent before closing the connection.
+  bool Parse(const char* data, size_t size) override;
+
+  /// Queues the headers and the body of the response of the stream. If the
+  /// body is streamed, its parts are provided with AppendBodyPart() and
+  /// FinishBody() afterwards.
+  void SubmitResponse(std::int32_t stream_id);
+
+  void AppendBodyPart(std::int32_t stream_id, std::string&& part);
+  void FinishBody(std::int32_t stream_id);
+
+  /// Returns the frames to send, an empty string if there are none. The data
+  /// stays valid until the next call to any of the methods.
+  std::string_view GetPendingOutput();
+
+  /// Whether the connection should be kept open
+  bool IsAlive() const;
+
+  /// Stops accepting new streams
+  void Shutdown();
+
+  /// Whether the response body is sent via AppendBodyPart() and FinishBody()
+  static bool HasStreamedBody(const HttpResponse& response);
+
+  /// Blocks until the next part of a streamed body is available, returns
+  /// false once the body ends.
+  static bool PopStreamedBodyPart(HttpResponse& response, std::string& part);
+
+ private:
+  struct Stream final {
+    // Streams are interleaved, so the header block is kept per stream
+    HttpRequestConstructor::RawHeaders raw_headers;
+    std::optional<HttpRequestConstructor> request_constructor;
+    std::string authority;
+    bool is_url_complete{false};
+    // The request is answered with the error status set by the constructor
+    bool is_malformed{false};
+
+    std::shared_ptr<request::RequestBase> request;
+    bool is_response_submitted{false};
+
+    // Body that is not streamed, points into the response data
+    std::string_view body;
+    // Parts of a streamed body that were not sent yet
+    std::deque<std::string> body_parts;
+    bool is_body_finished{false};
+    // Position within `body` or within the first of `body_parts`
+    std::size_t body_offset{0};
+
+    std::size_t bytes_sent{0};
+  };
+
+  static int OnBeginHeaders(nghttp2_session* session,
+                            const nghttp2_frame* frame, void* user_data);
+  static int OnHeader(nghttp2_session* session, const nghttp2_frame* frame,
+                      const std::uint8_t* name, std::size_t name_size,
+                      const std::uint8_t* value, std::size_t value_size,
+                      std::uint8_t flags, void* user_data);
+  static int OnDataChunkRecv(nghttp2_session* session, std::uint8_t flags,
+                             std::int32_t stream_id, const std::uint8_t* data,
+                             std::size_t size, void* user_data);
+  static int OnFrameRecv(nghttp2_session* session, const nghttp2_frame* frame,
+                         void* user_data);
+  static int OnFrameSend(nghttp2_session* session, const nghttp2_frame* frame,
+                         void* user_data);
+  static int OnStreamClose(nghttp2_session* session, std::int32_t stream_id,
+                           std::uint32_t error_code, void* user_data);
+  static ssize_t ReadBody(nghttp2_session* session, std::int32_t stream_id,
+                          std::uint8_t* buf, std::size_t size,
+                          std::uint32_t* data_flags,
+                          nghttp2_data_source* source, void* user_data);
+
+  int OnHeaderImpl(Stream& stream, std::string_view name,
+                   std::string_view value);
+  bool CompleteUrl(Stream& stream);
+  void FinalizeRequest(std::int32_t stream_id, Stream& stream);
+
+  Stream* FindStream(std::int32_t stream_id);
+
+  struct SessionDeleter final {
+    void operator()(nghttp2_session* session) const noexcept;
+  };
+
+  const HandlerInfoIndex& handler_info_index_;
+  const HttpRequestConstructor::Config request_constructor_config_;
+  OnNewRequestCb on_new_request_cb_;
+  OnStreamClosedCb on_stream_closed_cb_;
+  net::ParserStats& stats_;
+  request::ResponseDataAccounter& data_accounter_;
+
+  const std::shared_ptr<HttpRequestPool> request_pool_{
+      std::make_shared<HttpRequestPool>()};
+  std::unordered_map<std::int32_t, Stream> streams_;
+  std::unique_ptr<nghttp2_session, SessionDeleter> session_;
+};
+
+}  // namespace server::http
+
+USERVER_NAMESPACE_END
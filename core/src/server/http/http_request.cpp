@@ -164,6 +164,10 @@ const std::string& HttpRequest::RequestBody() const {
   return impl_.RequestBody();
 }
 
+RequestBodyStream& HttpRequest::GetBodyStream() const {
+  return impl_.GetBodyStream();
+}
+
 const HttpRequest::HeadersMap& HttpRequest::RequestHeaders() const {
   return impl_.GetHeaders();
 }
@@ -188,6 +192,10 @@ void HttpRequest::SetResponseStatus(HttpStatus status) const {
 
 bool HttpRequest::IsBodyCompressed() const { return impl_.IsBodyCompressed(); }
 
+std::pmr::memory_resource& HttpRequest::GetMemoryResource() const {
+  return impl_.GetMemoryResource();
+}
+
 void HttpRequest::SetUpgradeWebsocket(
     std::function<void(std::unique_ptr<engine::io::RwBase>&&,
                        engine::io::Sockaddr&&)>
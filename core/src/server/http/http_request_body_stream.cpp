@@ -0,0 +1,64 @@
+#include <userver/server/http/http_request_body_stream.hpp>
+
+#include <userver/engine/exception.hpp>
+#include <userver/engine/task/cancel.hpp>
+#include <userver/utils/assert.hpp>
+
+#include <server/http/request_body_stream_state.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace server::http {
+
+RequestBodyStream::RequestBodyStream(
+    std::shared_ptr<impl::RequestBodyStreamState> state)
+    : state_(std::move(state)) {
+  UASSERT(state_);
+}
+
+RequestBodyStream::RequestBodyStream(RequestBodyStream&&) noexcept = default;
+
+RequestBodyStream& RequestBodyStream::operator=(RequestBodyStream&&) noexcept =
+    default;
+
+RequestBodyStream::~RequestBodyStream() = default;
+
+bool RequestBodyStream::ReadChunk(std::string& chunk,
+                                  engine::Deadline deadline) {
+  using PopResult = impl::RequestBodyStreamState::PopResult;
+
+  switch (state_->Pop(chunk, deadline)) {
+    case PopResult::kChunk:
+      return true;
+    case PopResult::kEnd:
+      return false;
+    case PopResult::kAborted:
+      throw RequestBodyStreamError(
+          "Request body was not received completely");
+    case PopResult::kTimeout:
+      if (engine::current_task::ShouldCancel()) {
+        throw engine::WaitInterruptedException(
+            engine::current_task::CancellationReason());
+      }
+      throw RequestBodyStreamError("Timed out while reading request body");
+  }
+
+  UINVARIANT(false, "Unexpected PopResult");
+}
+
+std::string RequestBodyStream::ReadAll(engine::Deadline deadline) {
+  std::string body;
+  std::string chunk;
+  while (ReadChunk(chunk, deadline)) {
+    if (body.empty()) {
+      body = std::move(chunk);
+    } else {
+      body += chunk;
+    }
+  }
+  return body;
+}
+
+}  // namespace server::http
+
+USERVER_NAMESPACE_END
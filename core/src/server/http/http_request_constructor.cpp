@@ -11,7 +11,6 @@
 #include <userver/utils/encoding/hex.hpp>
 #include <userver/utils/exception.hpp>
 
-#include "multipart_form_data_parser.hpp"
 
 USERVER_NAMESPACE_BEGIN
 
@@ -19,11 +18,6 @@ namespace server::http {
 
 namespace {
 
-inline void Strip(const char*& begin, const char*& end) {
-  while (begin < end && isspace(*begin)) ++begin;
-  while (begin < end && isspace(end[-1])) --end;
-}
-
 void StripDuplicateStartingSlashes(std::string& s) {
   if (s.empty() || s[0] != '/') return;
 
@@ -47,12 +41,24 @@ struct HttpRequestConstructor::HttpParserUrl {
   http_parser_url parsed_url;
 };
 
+void HttpRequestConstructor::RawHeaders::Clear() {
+  block_.clear();
+  entries_.clear();
+}
+
 HttpRequestConstructor::HttpRequestConstructor(
     Config config, const HandlerInfoIndex& handler_info_index,
-    request::ResponseDataAccounter& data_accounter)
+    request::ResponseDataAccounter& data_accounter, RawHeaders& raw_headers,
+    const std::shared_ptr<HttpRequestPool>& request_pool)
     : config_(config),
       handler_info_index_(handler_info_index),
-      request_(std::make_shared<HttpRequestImpl>(data_accounter)) {}
+      raw_headers_(raw_headers),
+      request_(std::allocate_shared<HttpRequestImpl>(
+          HttpRequestPool::Allocator<HttpRequestImpl>{request_pool},
+          data_accounter)) {
+  // The previous request could have been dropped without Finalize()
+  raw_headers_.Clear();
+}
 
 HttpRequestConstructor::~HttpRequestConstructor() = default;
 
@@ -121,6 +127,7 @@ void HttpRequestConstructor::ParseUrl() {
     config_.parse_args_from_body =
         handler_config.request_config.parse_args_from_body;
     if (handler_config.decompress_request) config_.decompress_request = true;
+    body_stream_requested_ = handler_config.request_body_stream;
 
     request_->SetTaskProcessor(handler_info->task_processor);
     request_->SetHttpHandler(handler_info->handler);
@@ -147,22 +154,31 @@ void HttpRequestConstructor::AppendHeaderField(const char* data, size_t size) {
     AddHeader();
     header_value_flag_ = false;
   }
-  header_field_flag_ = true;
+  if (!header_field_flag_) {
+    header_field_flag_ = true;
+    header_ = {};
+    header_.field_offset = raw_headers_.block_.size();
+  }
 
   AccountHeadersSize(size);
   AccountRequestSize(size);
 
-  header_field_.append(data, size);
+  raw_headers_.block_.append(data, size);
+  header_.field_size += size;
 }
 
 void HttpRequestConstructor::AppendHeaderValue(const char* data, size_t size) {
   UASSERT(header_field_flag_);
-  header_value_flag_ = true;
+  if (!header_value_flag_) {
+    header_value_flag_ = true;
+    header_.value_offset = raw_headers_.block_.size();
+  }
 
   AccountHeadersSize(size);
   AccountRequestSize(size);
 
-  header_value_.append(data, size);
+  raw_headers_.block_.append(data, size);
+  header_.value_size += size;
 }
 
 void HttpRequestConstructor::AppendBody(const char* data, size_t size) {
@@ -174,9 +190,28 @@ void HttpRequestConstructor::SetIsFinal(bool is_final) {
   request_->is_final_ = is_final;
 }
 
+bool HttpRequestConstructor::IsBodyStreamRequested() const {
+  return body_stream_requested_ && status_ == Status::kOk;
+}
+
+std::shared_ptr<impl::RequestBodyStreamState>
+HttpRequestConstructor::StartBodyStream(std::size_t max_buffered_size) {
+  UASSERT(request_);
+  UASSERT(request_->request_body_.empty());
+  auto state = std::make_shared<impl::RequestBodyStreamState>(max_buffered_size);
+  request_->body_stream_.emplace(RequestBodyStream{state});
+  return state;
+}
+
+std::size_t HttpRequestConstructor::GetRemainingRequestSize() const {
+  UASSERT(request_size_ <= config_.max_request_size);
+  return config_.max_request_size - request_size_;
+}
+
 std::shared_ptr<request::RequestBase> HttpRequestConstructor::Finalize() {
   LOG_TRACE() << "method=" << request_->GetMethodStr();
 
+  MaterializeHeaders();
   FinalizeImpl();
 
   CheckStatus();
@@ -214,25 +249,6 @@ void HttpRequestConstructor::FinalizeImpl() {
 
   LOG_TRACE() << "request_args:" << request_->request_args_;
   LOG_TRACE() << "headers:" << request_->headers_;
-
-  try {
-    ParseCookies();
-  } catch (const std::exception& ex) {
-    LOG_WARNING() << "can't parse cookies: " << ex;
-    SetStatus(Status::kParseCookiesError);
-    return;
-  }
-
-  LOG_TRACE() << "cookies:" << request_->cookies_;
-
-  const auto& content_type =
-      request_->GetHeader(USERVER_NAMESPACE::http::headers::kContentType);
-  if (IsMultipartFormDataContentType(content_type)) {
-    if (!ParseMultipartFormData(content_type, request_->RequestBody(),
-                                request_->form_data_args_)) {
-      SetStatus(Status::kParseMultipartFormDataError);
-    }
-  }
 }
 
 void HttpRequestConstructor::ParseArgs(const HttpParserUrl& url) {
@@ -255,63 +271,29 @@ void HttpRequestConstructor::ParseArgs(const char* data, size_t size) {
 
 void HttpRequestConstructor::AddHeader() {
   UASSERT(header_field_flag_);
+  raw_headers_.entries_.push_back(header_);
+  header_field_flag_ = false;
+}
+
+void HttpRequestConstructor::MaterializeHeaders() {
+  const std::string_view block = raw_headers_.block_;
+  auto& headers = request_->headers_;
+  headers.reserve(raw_headers_.entries_.size());
 
   try {
-    request_->headers_.InsertOrAppend(std::move(header_field_),
-                                      std::move(header_value_));
+    for (const auto& entry : raw_headers_.entries_) {
+      headers.InsertOrAppend(
+          std::string{block.substr(entry.field_offset, entry.field_size)},
+          std::string{block.substr(entry.value_offset, entry.value_size)});
+    }
   } catch (const USERVER_NAMESPACE::http::headers::HeaderMap::
                TooManyHeadersException&) {
     SetStatus(Status::kHeadersTooLarge);
-    utils::LogErrorAndThrow(fmt::format(
+    LOG_ERROR() << fmt::format(
         "HeaderMap reached its maximum capacity, already contains {} headers",
-        request_->headers_.size()));
-  }
-  header_field_.clear();
-  header_value_.clear();
-}
-
-void HttpRequestConstructor::ParseCookies() {
-  const std::string& cookie =
-      request_->GetHeader(USERVER_NAMESPACE::http::headers::kCookie);
-  const char* data = cookie.data();
-  size_t size = cookie.size();
-  const char* end = data + size;
-  const char* key_begin = data;
-  const char* key_end = data;
-  bool parse_key = true;
-  for (const char* ptr = data; ptr <= end; ++ptr) {
-    if (ptr == end || *ptr == ';') {
-      const char* value_begin = nullptr;
-      const char* value_end = nullptr;
-      if (parse_key) {
-        key_end = ptr;
-        value_begin = value_end = ptr;
-      } else {
-        value_begin = key_end + 1;
-        value_end = ptr;
-        Strip(value_begin, value_end);
-        if (value_begin + 2 <= value_end && *value_begin == '"' &&
-            value_end[-1] == '"') {
-          ++value_begin;
-          --value_end;
-        }
-      }
-      Strip(key_begin, key_end);
-      if (key_begin < key_end) {
-        request_->cookies_.emplace(std::piecewise_construct,
-                                   std::tie(key_begin, key_end),
-                                   std::tie(value_begin, value_end));
-      }
-      parse_key = true;
-      key_begin = ptr + 1;
-      continue;
-    }
-    if (*ptr == '=' && parse_key) {
-      parse_key = false;
-      key_end = ptr;
-      continue;
-    }
+        headers.size());
   }
+  raw_headers_.Clear();
 }
 
 void HttpRequestConstructor::SetStatus(HttpRequestConstructor::Status status) {
@@ -397,17 +379,6 @@ void HttpRequestConstructor::CheckStatus() const {
       request_->GetHttpResponse().SetData("invalid args");
       request_->GetHttpResponse().SetReady();
       break;
-    case Status::kParseCookiesError:
-      request_->SetResponseStatus(HttpStatus::kBadRequest);
-      request_->GetHttpResponse().SetData("invalid cookies");
-      request_->GetHttpResponse().SetReady();
-      break;
-    case Status::kParseMultipartFormDataError:
-      request_->SetResponseStatus(HttpStatus::kBadRequest);
-      request_->GetHttpResponse().SetData(
-          "invalid body of multipart/form-data request");
-      request_->GetHttpResponse().SetReady();
-      break;
   }
 }
 
@@ -1,6 +1,8 @@
 #pragma once
 
 #include <memory>
+#include <string>
+#include <vector>
 
 #include <userver/http/parser/http_request_parse_args.hpp>
 #include <userver/server/http/http_method.hpp>
@@ -9,6 +11,8 @@
 #include <server/request/request_constructor.hpp>
 
 #include "handler_info_index.hpp"
+#include "request_body_stream_state.hpp"
+#include "http_request_pool.hpp"
 #include "http_request_impl.hpp"
 
 USERVER_NAMESPACE_BEGIN
@@ -27,15 +31,38 @@ class HttpRequestConstructor final : public request::RequestConstructor {
     kHeadersTooLarge,
     kRequestTooLarge,
     kParseArgsError,
-    kParseCookiesError,
-    kParseMultipartFormDataError,
   };
 
   using Config = server::request::HttpRequestConfig;
 
+  /// @brief Header block of the request being constructed.
+  ///
+  /// Header fields and values are appended to a single buffer and are turned
+  /// into the request headers at once by Finalize(). The buffer is owned by
+  /// the connection to reuse its memory between the requests.
+  class RawHeaders final {
+   public:
+    void Clear();
+
+   private:
+    friend class HttpRequestConstructor;
+
+    struct Entry final {
+      std::size_t field_offset{0};
+      std::size_t field_size{0};
+      std::size_t value_offset{0};
+      std::size_t value_size{0};
+    };
+
+    std::string block_;
+    std::vector<Entry> entries_;
+  };
+
   HttpRequestConstructor(Config config,
                          const HandlerInfoIndex& handler_info_index,
-                         request::ResponseDataAccounter& data_accounter);
+                         request::ResponseDataAccounter& data_accounter,
+                         RawHeaders& raw_headers,
+                         const std::shared_ptr<HttpRequestPool>& request_pool);
 
   ~HttpRequestConstructor() override;
 
@@ -54,6 +81,16 @@ class HttpRequestConstructor final : public request::RequestConstructor {
 
   void SetIsFinal(bool is_final);
 
+  /// Whether the matched handler wants to read the body while it is received
+  bool IsBodyStreamRequested() const;
+
+  /// Makes the request body streamed, must be called before Finalize()
+  std::shared_ptr<impl::RequestBodyStreamState> StartBodyStream(
+      std::size_t max_buffered_size);
+
+  /// Size of the body that is allowed by 'max_request_size'
+  std::size_t GetRemainingRequestSize() const;
+
   std::shared_ptr<request::RequestBase> Finalize() override;
 
  private:
@@ -64,7 +101,7 @@ class HttpRequestConstructor final : public request::RequestConstructor {
   void ParseArgs(const HttpParserUrl& url);
   void ParseArgs(const char* data, size_t size);
   void AddHeader();
-  void ParseCookies();
+  void MaterializeHeaders();
 
   void SetStatus(Status status);
   void AccountRequestSize(size_t size);
@@ -77,8 +114,8 @@ class HttpRequestConstructor final : public request::RequestConstructor {
   const HandlerInfoIndex& handler_info_index_;
 
   utils::FastPimpl<HttpParserUrl, 60, 8> parsed_url_pimpl_;
-  std::string header_field_;
-  std::string header_value_;
+  RawHeaders& raw_headers_;
+  RawHeaders::Entry header_;
   bool header_field_flag_ = false;
   bool header_value_flag_ = false;
 
@@ -86,6 +123,7 @@ class HttpRequestConstructor final : public request::RequestConstructor {
   size_t url_size_ = 0;
   size_t headers_size_ = 0;
   bool url_parsed_ = false;
+  bool body_stream_requested_ = false;
   Status status_ = Status::kOk;
 
   std::shared_ptr<HttpRequestImpl> request_;
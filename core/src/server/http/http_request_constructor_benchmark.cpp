@@ -1,5 +1,7 @@
 #include <benchmark/benchmark.h>
 
+#include <fmt/format.h>
+
 #include <server/http/http_request_constructor.hpp>
 #include <utils/gbench_auxilary.hpp>
 
@@ -16,9 +18,50 @@ void http_request_constructor_url_decode(benchmark::State& state) {
   for ([[maybe_unused]] auto _ : state)
     benchmark::DoNotOptimize(USERVER_NAMESPACE::http::parser::UrlDecode(input));
 }
+
+void http_request_constructor_headers(benchmark::State& state) {
+  static const server::http::HandlerInfoIndex kHandlerInfoIndex;
+  static constexpr server::request::HttpRequestConfig kRequestConfig{
+      /*.max_url_size = */ 8192,
+      /*.max_request_size = */ 1024 * 1024,
+      /*.max_headers_size = */ 65536,
+      /*.parse_args_from_body = */ false,
+      /*.testing_mode = */ true,
+      /*.decompress_request = */ false,
+  };
+  server::request::ResponseDataAccounter accounter;
+  server::http::HttpRequestConstructor::RawHeaders raw_headers;
+  const auto request_pool = std::make_shared<server::http::HttpRequestPool>();
+
+  constexpr std::string_view kUrl = "/v1/handler?arg1=value1&arg2=value2";
+  std::vector<std::pair<std::string, std::string>> headers;
+  for (int64_t i = 0; i < state.range(0); i++) {
+    headers.emplace_back(fmt::format("X-Test-Header-{}", i),
+                         fmt::format("some-long-header-value-{}", i));
+  }
+  headers.emplace_back("Cookie", "session=0123456789abcdef; theme=dark");
+
+  for ([[maybe_unused]] auto _ : state) {
+    server::http::HttpRequestConstructor constructor{
+        kRequestConfig, kHandlerInfoIndex, accounter, raw_headers,
+        request_pool};
+    constructor.SetMethod(server::http::HttpMethod::kGet);
+    constructor.AppendUrl(kUrl.data(), kUrl.size());
+    constructor.ParseUrl();
+    for (const auto& [field, value] : headers) {
+      constructor.AppendHeaderField(field.data(), field.size());
+      constructor.AppendHeaderValue(value.data(), value.size());
+    }
+    constructor.AppendHeaderField("", 0);
+    benchmark::DoNotOptimize(constructor.Finalize());
+  }
+}
+
 }  // namespace
 BENCHMARK(http_request_constructor_url_decode)
     ->RangeMultiplier(2)
     ->Range(1, 1024);
 
+BENCHMARK(http_request_constructor_headers)->RangeMultiplier(2)->Range(1, 32);
+
 USERVER_NAMESPACE_END
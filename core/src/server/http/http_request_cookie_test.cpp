@@ -4,6 +4,7 @@
 
 #include <fmt/format.h>
 
+#include <userver/http/common_headers.hpp>
 #include <userver/server/http/http_request.hpp>
 
 #include <server/http/http_request_parser.hpp>
@@ -68,6 +69,29 @@ UTEST_P(HttpRequestCookies, Test) {
   EXPECT_EQ(parsed, true);
 }
 
+UTEST(HttpRequestCookies, RemovedHeader) {
+  bool parsed = false;
+  auto parser = server::CreateTestParser(
+      [&parsed](std::shared_ptr<server::request::RequestBase>&& request) {
+        parsed = true;
+        auto& http_request_impl =
+            dynamic_cast<server::http::HttpRequestImpl&>(*request);
+        server::http::HttpRequest http_request(http_request_impl);
+
+        // Cookies are parsed lazily, but still come from the original header
+        http_request.RemoveHeader(http::headers::kCookie);
+        EXPECT_FALSE(http_request.HasHeader(http::headers::kCookie));
+        EXPECT_EQ(http_request.CookieCount(), 2);
+        EXPECT_EQ(http_request.GetCookie("a"), "b");
+        EXPECT_EQ(http_request.GetCookie("c"), "d");
+      });
+
+  const std::string_view request =
+      "GET / HTTP/1.1\r\nCookie: a=b; c=\"d\"\r\n\r\n";
+  parser.Parse(request.data(), request.size());
+  EXPECT_TRUE(parsed);
+}
+
 UTEST(HttpRequestCookiesHashDos, HashDos) {
   bool parsed = false;
   auto parser = server::CreateTestParser(
@@ -5,6 +5,7 @@
 
 #include <server/handlers/http_handler_base_statistics.hpp>
 #include <server/handlers/http_server_settings.hpp>
+#include <server/middlewares/deadline_propagation.hpp>
 #include <server/request/task_inherited_request_impl.hpp>
 #include <userver/components/statistics_storage.hpp>
 #include <userver/dynamic_config/storage/component.hpp>
@@ -13,8 +14,11 @@
 #include <userver/http/common_headers.hpp>
 #include <userver/logging/component.hpp>
 #include <userver/server/http/http_response.hpp>
+#include <userver/server/handlers/impl/deadline_propagation_config.hpp>
 #include <userver/server/request/task_inherited_request.hpp>
 #include <userver/utils/assert.hpp>
+#include <userver/utils/scope_guard.hpp>
+#include <userver/utils/statistics/rate_counter.hpp>
 #include "http_request_impl.hpp"
 
 USERVER_NAMESPACE_BEGIN
@@ -79,6 +83,130 @@ namespace {
 utils::statistics::MetricTag<std::atomic<size_t>> kCcStatusCodeIsCustom{
     "congestion-control.rps.is-custom-status-activated"};
 
+utils::statistics::MetricTag<utils::statistics::RateCounter>
+    kQueueTimeCcDropped{"congestion-control.queue-time.dropped"};
+
+utils::statistics::MetricTag<utils::statistics::RateCounter>
+    kAdaptiveLifoShed{"congestion-control.adaptive-lifo.shed"};
+
+void RejectQueuedForTooLong(HttpRequestImpl& http_request,
+                            std::chrono::steady_clock::duration queue_time) {
+  auto& http_response = http_request.GetHttpResponse();
+  SetThrottleReason(
+      http_response, "queue-time-congestion-control",
+      std::string{USERVER_NAMESPACE::http::headers::ratelimit_reason::kCC});
+  http_response.SetStatus(HttpStatus::kTooManyRequests);
+
+  LOG_LIMITED_ERROR()
+      << "Request throttled (queue time congestion control, "
+         "configured via USERVER_QUEUE_TIME_CCONTROL), queue_time="
+      << std::chrono::duration_cast<std::chrono::milliseconds>(queue_time)
+             .count()
+      << "ms, url=" << http_request.GetUrl();
+}
+
+void RejectShedFromLifoQueue(HttpRequestImpl& http_request,
+                             AdaptiveLifoQueue::EnterResult result,
+                             HttpStatus deadline_expired_status_code) {
+  auto& http_response = http_request.GetHttpResponse();
+  if (result == AdaptiveLifoQueue::EnterResult::kDeadlineExpired) {
+    http_response.SetStatus(deadline_expired_status_code);
+    http_response.SetData("Deadline expired");
+    http_response.SetHeader(
+        USERVER_NAMESPACE::http::headers::kXYaTaxiDeadlineExpired, "1");
+    LOG_LIMITED_WARNING()
+        << "Request deadline expired while waiting in the adaptive LIFO "
+           "queue, url="
+        << http_request.GetUrl();
+  } else {
+    // The connection is closed, no one is waiting for the response
+    http_response.SetStatus(HttpStatus::kClientClosedRequest);
+  }
+}
+
+/// Congestion control of a request that runs before any handler work
+struct RequestAdmission final {
+  /// Returns false if the request is rejected, its response is set
+  bool Enter(HttpRequestImpl& http_request) const {
+    if (lifo_queue) {
+      const auto result = lifo_queue->Enter(deadline, lifo_config);
+      if (result != AdaptiveLifoQueue::EnterResult::kAdmitted) {
+        ++*lifo_shed;
+        RejectShedFromLifoQueue(http_request, result,
+                                deadline_expired_status_code);
+        return false;
+      }
+    }
+
+    if (queue_time_limiter) {
+      // Measured from the request arrival, includes the task processor queue
+      // and the adaptive LIFO queue
+      const auto now = std::chrono::steady_clock::now();
+      const auto queue_time = now - http_request.StartTime();
+      if (!queue_time_limiter->Admit(queue_time, now, queue_time_config)) {
+        ++*queue_time_dropped;
+        RejectQueuedForTooLong(http_request, queue_time);
+        if (lifo_queue) lifo_queue->Leave(lifo_config);
+        return false;
+      }
+    }
+    return true;
+  }
+
+  void Leave() const {
+    if (lifo_queue) lifo_queue->Leave(lifo_config);
+  }
+
+  USERVER_NAMESPACE::congestion_control::QueueTimeLimiter* queue_time_limiter{
+      nullptr};
+  USERVER_NAMESPACE::congestion_control::QueueTimeLimiterConfig
+      queue_time_config;
+  utils::statistics::RateCounter* queue_time_dropped{nullptr};
+
+  AdaptiveLifoQueue* lifo_queue{nullptr};
+  AdaptiveLifoConfig lifo_config;
+  utils::statistics::RateCounter* lifo_shed{nullptr};
+  // From the deadline propagation headers
+  engine::Deadline deadline;
+  HttpStatus deadline_expired_status_code{HttpStatus::kTooManyRequests};
+};
+
+RequestAdmission MakeRequestAdmission(
+    const HttpRequestImpl& http_request,
+    const handlers::HttpHandlerBase& handler,
+    const dynamic_config::Snapshot& config,
+    USERVER_NAMESPACE::congestion_control::QueueTimeLimiter& queue_time_limiter,
+    AdaptiveLifoQueue& lifo_queue, utils::statistics::MetricsStorage& metrics) {
+  RequestAdmission admission;
+
+  const auto& queue_time_config = config[handlers::kQueueTimeCcConfig];
+  if (queue_time_config.enabled) {
+    admission.queue_time_limiter = &queue_time_limiter;
+    admission.queue_time_config = queue_time_config;
+    admission.queue_time_dropped = &metrics.GetMetric(kQueueTimeCcDropped);
+  }
+
+  const auto& lifo_config = config[handlers::kAdaptiveLifoConfig];
+  if (lifo_config.enabled) {
+    admission.lifo_queue = &lifo_queue;
+    admission.lifo_config = lifo_config;
+    admission.lifo_shed = &metrics.GetMetric(kAdaptiveLifoShed);
+    admission.deadline_expired_status_code =
+        handler.GetConfig().deadline_expired_status_code;
+    if (handler.GetConfig().deadline_propagation_enabled &&
+        config[handlers::impl::kDeadlinePropagationEnabled]) {
+      const auto timeout =
+          middlewares::ParseClientTimeout(http_request.GetHeader(
+              USERVER_NAMESPACE::http::headers::kXYaTaxiClientTimeoutMs));
+      if (timeout) {
+        admission.deadline = engine::Deadline::FromTimePoint(
+            http_request.StartTime() + *timeout);
+      }
+    }
+  }
+  return admission;
+}
+
 }  // namespace
 
 engine::TaskWithResult<void> HttpRequestHandler::StartRequestTask(
@@ -164,12 +292,30 @@ engine::TaskWithResult<void> HttpRequestHandler::StartRequestTask(
     http_response.SetStreamBody();
   }
 
-  auto payload = [request = std::move(request), handler] {
+  RequestAdmission admission;
+  if (!is_monitor_ && throttling_enabled) {
+    admission = MakeRequestAdmission(http_request, *handler,
+                                     config_source_.GetSnapshot(),
+                                     queue_time_limiter_, lifo_queue_,
+                                     *metrics_);
+  }
+
+  auto payload = [request = std::move(request), handler,
+                  admission = std::move(admission)] {
     server::request::kTaskInheritedRequest.Set(
         std::static_pointer_cast<HttpRequestImpl>(request));
 
     request->SetTaskStartTime();
 
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-type-static-cast-downcast)
+    if (!admission.Enter(static_cast<HttpRequestImpl&>(*request))) {
+      const auto now = std::chrono::steady_clock::now();
+      request->SetResponseNotifyTime(now);
+      request->GetResponse().SetReady(now);
+      return;
+    }
+    utils::ScopeGuard leave_guard([&admission] { admission.Leave(); });
+
     request::RequestContext context;
     handler->HandleRequest(*request, context);
 
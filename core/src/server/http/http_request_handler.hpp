@@ -2,6 +2,8 @@
 
 #include <optional>
 
+#include <congestion_control/queue_time_limiter.hpp>
+#include <server/http/adaptive_lifo_queue.hpp>
 #include <server/http/request_handler_base.hpp>
 #include <userver/components/component_context.hpp>
 #include <userver/engine/mutex.hpp>
@@ -67,6 +69,9 @@ class HttpRequestHandler final : public RequestHandlerBase {
   mutable utils::TokenBucket rate_limit_;
   std::atomic<HttpStatus> cc_status_code_{HttpStatus::kTooManyRequests};
   std::chrono::steady_clock::time_point cc_enabled_tp_;
+  mutable USERVER_NAMESPACE::congestion_control::QueueTimeLimiter
+      queue_time_limiter_;
+  mutable AdaptiveLifoQueue lifo_queue_;
   utils::statistics::MetricsStoragePtr metrics_;
   dynamic_config::Source config_source_;
 };
@@ -40,6 +40,36 @@ void http_request_headers_insert(benchmark::State& state) {
   }
 }
 
+// The way HttpRequestConstructor fills the headers from the raw header block
+void http_request_headers_materialize(benchmark::State& state) {
+  constexpr std::string_view kValue = "some-long-header-value";
+  std::string block;
+  std::vector<std::pair<std::string_view, std::string_view>> entries;
+  for (int i = 0; i < state.range(0); i++) {
+    block += kHeadersArray[i];
+    block += kValue;
+  }
+  std::size_t offset = 0;
+  for (int i = 0; i < state.range(0); i++) {
+    const std::string_view name = kHeadersArray[i];
+    const std::string_view view = block;
+    entries.emplace_back(view.substr(offset, name.size()),
+                         view.substr(offset + name.size(), kValue.size()));
+    offset += name.size() + kValue.size();
+  }
+
+  for ([[maybe_unused]] auto _ : state) {
+    server::http::HttpRequest::HeadersMap map;
+    map.reserve(entries.size());
+
+    for (const auto& [name, value] : entries) {
+      map.InsertOrAppend(std::string{name}, std::string{value});
+    }
+
+    benchmark::DoNotOptimize(map);
+  }
+}
+
 void http_request_headers_get(benchmark::State& state) {
   server::http::HttpRequest::HeadersMap map;
   for (const auto& header : kHeadersArray) map[header] = "1";
@@ -56,6 +86,10 @@ BENCHMARK(http_request_headers_insert)
     ->RangeMultiplier(2)
     ->Range(1, kHeadersCount);
 
+BENCHMARK(http_request_headers_materialize)
+    ->RangeMultiplier(2)
+    ->Range(1, kHeadersCount);
+
 BENCHMARK(http_request_headers_get);
 
 USERVER_NAMESPACE_END
@@ -1,12 +1,18 @@
 #include "http_request_impl.hpp"
 
+#include <cctype>
+#include <tuple>
+
 #include <server/handlers/http_handler_base_statistics.hpp>
+#include <server/http/request_body_stream_state.hpp>
 #include <userver/engine/io/socket.hpp>
 #include <userver/engine/task/task.hpp>
 #include <userver/http/common_headers.hpp>
 #include <userver/http/parser/http_request_parse_args.hpp>
 #include <userver/logging/impl/logger_base.hpp>
+#include <userver/logging/log.hpp>
 #include <userver/logging/logger.hpp>
+#include <userver/server/handlers/exceptions.hpp>
 #include <userver/utils/datetime.hpp>
 #include <userver/utils/encoding/tskv.hpp>
 
@@ -67,6 +73,53 @@ std::string EscapeForAccessTskvLog(const std::string& str) {
 const std::string kEmptyString{};
 const std::vector<std::string> kEmptyVector{};
 
+inline void Strip(const char*& begin, const char*& end) {
+  while (begin < end && isspace(*begin)) ++begin;
+  while (begin < end && isspace(end[-1])) --end;
+}
+
+void ParseCookies(const std::string& cookie,
+                  server::http::HttpRequest::CookiesMap& cookies) {
+  const char* data = cookie.data();
+  size_t size = cookie.size();
+  const char* end = data + size;
+  const char* key_begin = data;
+  const char* key_end = data;
+  bool parse_key = true;
+  for (const char* ptr = data; ptr <= end; ++ptr) {
+    if (ptr == end || *ptr == ';') {
+      const char* value_begin = nullptr;
+      const char* value_end = nullptr;
+      if (parse_key) {
+        key_end = ptr;
+        value_begin = value_end = ptr;
+      } else {
+        value_begin = key_end + 1;
+        value_end = ptr;
+        Strip(value_begin, value_end);
+        if (value_begin + 2 <= value_end && *value_begin == '"' &&
+            value_end[-1] == '"') {
+          ++value_begin;
+          --value_end;
+        }
+      }
+      Strip(key_begin, key_end);
+      if (key_begin < key_end) {
+        cookies.emplace(std::piecewise_construct, std::tie(key_begin, key_end),
+                        std::tie(value_begin, value_end));
+      }
+      parse_key = true;
+      key_begin = ptr + 1;
+      continue;
+    }
+    if (*ptr == '=' && parse_key) {
+      parse_key = false;
+      key_end = ptr;
+      continue;
+    }
+  }
+}
+
 }  // namespace
 
 namespace server::http {
@@ -132,7 +185,7 @@ const FormDataArg& HttpRequestImpl::GetFormDataArg(
   static const FormDataArg kEmptyFormDataArg{};
 
   const auto* ptr =
-      utils::impl::FindTransparentOrNullptr(form_data_args_, arg_name);
+      utils::impl::FindTransparentOrNullptr(ParsedFormDataArgs(), arg_name);
   if (!ptr) return kEmptyFormDataArg;
   return ptr->at(0);
 }
@@ -142,25 +195,26 @@ const std::vector<FormDataArg>& HttpRequestImpl::GetFormDataArgVector(
   static const std::vector<FormDataArg> kEmptyFormDataArgVector{};
 
   const auto* ptr =
-      utils::impl::FindTransparentOrNullptr(form_data_args_, arg_name);
+      utils::impl::FindTransparentOrNullptr(ParsedFormDataArgs(), arg_name);
   if (!ptr) return kEmptyFormDataArgVector;
   return *ptr;
 }
 
 bool HttpRequestImpl::HasFormDataArg(std::string_view arg_name) const {
   const auto* ptr =
-      utils::impl::FindTransparentOrNullptr(form_data_args_, arg_name);
+      utils::impl::FindTransparentOrNullptr(ParsedFormDataArgs(), arg_name);
   return !!ptr;
 }
 
 size_t HttpRequestImpl::FormDataArgCount() const {
-  return form_data_args_.size();
+  return ParsedFormDataArgs().size();
 }
 
 std::vector<std::string> HttpRequestImpl::FormDataArgNames() const {
+  const auto& form_data_args = ParsedFormDataArgs();
   std::vector<std::string> res;
-  res.reserve(form_data_args_.size());
-  for (const auto& [name, _] : form_data_args_) res.push_back(name);
+  res.reserve(form_data_args.size());
+  for (const auto& [name, _] : form_data_args) res.push_back(name);
   return res;
 }
 
@@ -216,11 +270,19 @@ bool HttpRequestImpl::HasHeader(
 size_t HttpRequestImpl::HeaderCount() const { return headers_.size(); }
 
 void HttpRequestImpl::RemoveHeader(std::string_view header_name) {
+  if (utils::StrIcaseEqual{}(header_name,
+                             USERVER_NAMESPACE::http::headers::kCookie)) {
+    ParsedCookies();
+  }
   headers_.erase(header_name);
 }
 
 void HttpRequestImpl::RemoveHeader(
     const USERVER_NAMESPACE::http::headers::PredefinedHeader& header_name) {
+  if (utils::StrIcaseEqual{}(header_name,
+                             USERVER_NAMESPACE::http::headers::kCookie)) {
+    ParsedCookies();
+  }
   headers_.erase(header_name);
 }
 
@@ -234,25 +296,54 @@ const HttpRequest::HeadersMap& HttpRequestImpl::GetHeaders() const {
 
 const std::string& HttpRequestImpl::GetCookie(
     const std::string& cookie_name) const {
-  auto it = cookies_.find(cookie_name);
-  if (it == cookies_.end()) return kEmptyString;
+  const auto& cookies = ParsedCookies();
+  auto it = cookies.find(cookie_name);
+  if (it == cookies.end()) return kEmptyString;
   return it->second;
 }
 
 bool HttpRequestImpl::HasCookie(const std::string& cookie_name) const {
-  return cookies_.count(cookie_name);
+  return ParsedCookies().count(cookie_name);
 }
 
-size_t HttpRequestImpl::CookieCount() const { return cookies_.size(); }
+size_t HttpRequestImpl::CookieCount() const { return ParsedCookies().size(); }
 
 HttpRequest::CookiesMapKeys HttpRequestImpl::GetCookieNames() const {
-  return HttpRequest::CookiesMapKeys{cookies_};
+  return HttpRequest::CookiesMapKeys{ParsedCookies()};
 }
 
 const HttpRequest::CookiesMap& HttpRequestImpl::GetCookies() const {
+  return ParsedCookies();
+}
+
+const HttpRequest::CookiesMap& HttpRequestImpl::ParsedCookies() const {
+  std::call_once(cookies_parsed_, [this] {
+    ParseCookies(GetHeader(USERVER_NAMESPACE::http::headers::kCookie),
+                 cookies_);
+    LOG_TRACE() << "cookies:" << cookies_;
+  });
   return cookies_;
 }
 
+const FormDataArgs& HttpRequestImpl::ParsedFormDataArgs() const {
+  // An exception leaves the flag unset, so each access reports the error
+  std::call_once(form_data_args_parsed_, [this] {
+    const auto& content_type =
+        GetHeader(USERVER_NAMESPACE::http::headers::kContentType);
+    if (!IsMultipartFormDataContentType(content_type)) return;
+
+    if (!ParseMultipartFormData(content_type, request_body_,
+                                form_data_args_)) {
+      form_data_args_.clear();
+      throw handlers::RequestParseError(
+          handlers::InternalMessage{"Failed to parse multipart/form-data body"},
+          handlers::ExternalBody{
+              "invalid body of multipart/form-data request"});
+    }
+  });
+  return form_data_args_;
+}
+
 void HttpRequestImpl::SetRequestBody(std::string body) {
   request_body_ = std::move(body);
 }
@@ -267,6 +358,14 @@ void HttpRequestImpl::ParseArgsFromBody() {
       });
 }
 
+RequestBodyStream& HttpRequestImpl::GetBodyStream() const {
+  if (!body_stream_) {
+    body_stream_.emplace(RequestBodyStream{
+        impl::RequestBodyStreamState::FromBody(request_body_)});
+  }
+  return *body_stream_;
+}
+
 bool HttpRequestImpl::IsBodyCompressed() const {
   const auto& encoding =
       GetHeader(USERVER_NAMESPACE::http::headers::kContentEncoding);
@@ -1,7 +1,12 @@
 #pragma once
 
+#include <array>
 #include <chrono>
+#include <cstddef>
 #include <memory>
+#include <memory_resource>
+#include <mutex>
+#include <optional>
 #include <string>
 #include <unordered_map>
 #include <vector>
@@ -10,12 +15,15 @@
 
 #include <userver/server/http/http_method.hpp>
 #include <userver/server/http/http_request.hpp>
+#include <userver/server/http/http_request_body_stream.hpp>
 #include <userver/server/http/http_response.hpp>
 #include <userver/server/request/request_base.hpp>
 #include <userver/utils/datetime/wall_coarse_clock.hpp>
 #include <userver/utils/impl/transparent_hash.hpp>
 #include <userver/utils/str_icase.hpp>
 
+#include <server/http/multipart_form_data_parser.hpp>
+
 USERVER_NAMESPACE_BEGIN
 
 namespace server {
@@ -85,6 +93,7 @@ class HttpRequestImpl final : public request::RequestBase {
   const std::string& RequestBody() const { return request_body_; }
   void SetRequestBody(std::string body);
   void ParseArgsFromBody();
+  RequestBodyStream& GetBodyStream() const;
   void SetResponseStatus(HttpStatus status) const {
     response_.SetStatus(status);
   }
@@ -136,27 +145,38 @@ class HttpRequestImpl final : public request::RequestBase {
 
   void SetHttpHandlerStatistics(handlers::HttpRequestStatistics&);
 
+  std::pmr::memory_resource& GetMemoryResource() const { return arena_; }
+
   friend class HttpRequestConstructor;
 
  private:
+  // Cookies are parsed from the Cookie header on the first access
+  const HttpRequest::CookiesMap& ParsedCookies() const;
+  // multipart/form-data body is parsed on the first access to the form data,
+  // the values are views into request_body_
+  const FormDataArgs& ParsedFormDataArgs() const;
+
   HttpMethod method_{HttpMethod::kUnknown};
   unsigned short http_major_{1};
   unsigned short http_minor_{1};
   std::string url_;
   std::string request_path_;
   std::string request_body_;
+  // Set by the parser for the handlers with a streamed body, lazily
+  // initialized from request_body_ otherwise
+  mutable std::optional<RequestBodyStream> body_stream_;
   std::string path_suffix_;
   utils::impl::TransparentMap<std::string, std::vector<std::string>,
                               utils::StrCaseHash>
       request_args_;
-  utils::impl::TransparentMap<std::string, std::vector<FormDataArg>,
-                              utils::StrCaseHash>
-      form_data_args_;
+  mutable std::once_flag form_data_args_parsed_;
+  mutable FormDataArgs form_data_args_;
   std::vector<std::string> path_args_;
   utils::impl::TransparentMap<std::string, size_t, utils::StrCaseHash>
       path_args_by_name_index_;
   HttpRequest::HeadersMap headers_;
-  HttpRequest::CookiesMap cookies_;
+  mutable std::once_flag cookies_parsed_;
+  mutable HttpRequest::CookiesMap cookies_;
   bool is_final_{false};
   UpgradeCallback upgrade_websocket_cb_;
 
@@ -164,6 +184,13 @@ class HttpRequestImpl final : public request::RequestBase {
   engine::TaskProcessor* task_processor_{nullptr};
   const handlers::HttpHandlerBase* handler_{nullptr};
   handlers::HttpRequestStatistics* request_statistics_{nullptr};
+
+  // The request memory is reused by the connection, so is the initial buffer
+  static constexpr std::size_t kArenaInitialSize = 1024;
+  alignas(std::max_align_t) std::array<std::byte, kArenaInitialSize>
+      arena_buffer_;
+  mutable std::pmr::monotonic_buffer_resource arena_{arena_buffer_.data(),
+                                                     arena_buffer_.size()};
 };
 
 }  // namespace http
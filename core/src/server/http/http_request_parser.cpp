@@ -11,6 +11,10 @@ namespace server::http {
 
 namespace {
 
+// Received but not yet read part of a streamed request body, the connection
+// does not read from the socket while it is exceeded
+constexpr std::size_t kMaxBufferedBodyStreamSize = 256 * 1024;
+
 HttpMethod ConvertHttpMethod(llhttp_method method) {
   switch (method) {
     case HTTP_DELETE:
@@ -63,6 +67,8 @@ HttpRequestParser::HttpRequestParser(
   parser_.data = this;
 }
 
+HttpRequestParser::~HttpRequestParser() { AbortBodyStream(); }
+
 bool HttpRequestParser::Parse(const char* data, size_t size) {
   const auto err = llhttp_execute(&parser_, data, size);
   if (err != HPE_OK) {
@@ -70,7 +76,12 @@ bool HttpRequestParser::Parse(const char* data, size_t size) {
         static_cast<size_t>(llhttp_get_error_pos(&parser_) - data + 1);
     LOG_WARNING() << "parsed=" << parsed << " size=" << size
                   << " error_description=" << llhttp_errno_name(err);
-    FinalizeRequest();
+    if (body_stream_) {
+      // The request is already passed to the handler
+      AbortBodyStream();
+    } else {
+      FinalizeRequest();
+    }
     return false;
   }
   if (parser_.upgrade) {
@@ -182,10 +193,22 @@ int HttpRequestParser::OnHeadersCompleteImpl(llhttp_t* p) {
     return -1;
   }
   LOG_TRACE() << "headers complete";
+  if (request_constructor_->IsBodyStreamRequested()) return StartBodyStream(p);
   return 0;
 }
 
 int HttpRequestParser::OnBodyImpl(llhttp_t* p, const char* data, size_t size) {
+  if (body_stream_) {
+    if (size > body_stream_remaining_size_) {
+      LOG_WARNING() << "streamed request body is too large (enforced by "
+                       "'max_request_size' handler limit in config.yaml)";
+      return -1;
+    }
+    body_stream_remaining_size_ -= size;
+    body_stream_->Push(std::string_view(data, size));
+    return 0;
+  }
+
   UASSERT(request_constructor_);
   if (!CheckUrlComplete(p)) return -1;
   LOG_TRACE() << "body: '" << std::string_view(data, size) << "'";
@@ -199,6 +222,14 @@ int HttpRequestParser::OnBodyImpl(llhttp_t* p, const char* data, size_t size) {
 }
 
 int HttpRequestParser::OnMessageCompleteImpl(llhttp_t* p) {
+  if (body_stream_) {
+    LOG_TRACE() << "streamed body complete";
+    body_stream_->Finish();
+    body_stream_.reset();
+    body_stream_request_ = nullptr;
+    return 0;
+  }
+
   UASSERT(request_constructor_);
   if (p->upgrade) {
     return -1;  // error
@@ -213,7 +244,7 @@ int HttpRequestParser::OnMessageCompleteImpl(llhttp_t* p) {
 void HttpRequestParser::CreateRequestConstructor() {
   stats_.parsing_request_count.Add(1);
   request_constructor_.emplace(request_constructor_config_, handler_info_index_,
-                               data_accounter_);
+                               data_accounter_, raw_headers_, request_pool_);
   url_complete_ = false;
 }
 
@@ -244,6 +275,7 @@ bool HttpRequestParser::FinalizeRequestImpl() {
   if (!request_constructor_) CreateRequestConstructor();
 
   if (auto request = request_constructor_->Finalize()) {
+    if (body_stream_) body_stream_request_ = request.get();
     on_new_request_cb_(std::move(request));
   } else {
     LOG_ERROR() << "request is null after Finalize()";
@@ -252,6 +284,34 @@ bool HttpRequestParser::FinalizeRequestImpl() {
   return true;
 }
 
+int HttpRequestParser::StartBodyStream(llhttp_t* p) {
+  UASSERT(request_constructor_);
+  UASSERT(!body_stream_);
+  request_constructor_->SetIsFinal(!llhttp_should_keep_alive(p));
+  body_stream_remaining_size_ =
+      request_constructor_->GetRemainingRequestSize();
+  body_stream_ =
+      request_constructor_->StartBodyStream(kMaxBufferedBodyStreamSize);
+  if (!FinalizeRequest()) {
+    AbortBodyStream();
+    return -1;
+  }
+  return 0;
+}
+
+void HttpRequestParser::AbortBodyStream() {
+  if (!body_stream_) return;
+  body_stream_->Abort();
+  body_stream_.reset();
+  body_stream_request_ = nullptr;
+}
+
+impl::RequestBodyStreamState* HttpRequestParser::GetReceivingBodyStream(
+    const request::RequestBase& request) const {
+  if (&request != body_stream_request_) return nullptr;
+  return body_stream_.get();
+}
+
 }  // namespace server::http
 
 USERVER_NAMESPACE_END
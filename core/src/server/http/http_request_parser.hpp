@@ -31,8 +31,18 @@ class HttpRequestParser final : public request::RequestParser {
   HttpRequestParser(HttpRequestParser&&) = delete;
   HttpRequestParser& operator=(HttpRequestParser&&) = delete;
 
+  ~HttpRequestParser() override;
+
   bool Parse(const char* data, size_t size) override;
 
+  /// @brief Returns the body stream of `request` if its body is still being
+  /// received, nullptr otherwise.
+  ///
+  /// The connection must wait for the stream to drain before reading more
+  /// data for it, and discard the stream once the request is handled.
+  impl::RequestBodyStreamState* GetReceivingBodyStream(
+      const request::RequestBase& request) const;
+
  private:
   static int OnMessageBegin(llhttp_t* p);
   static int OnUrl(llhttp_t* p, const char* data, size_t size);
@@ -57,6 +67,9 @@ class HttpRequestParser final : public request::RequestParser {
   bool FinalizeRequest();
   bool FinalizeRequestImpl();
 
+  int StartBodyStream(llhttp_t* p);
+  void AbortBodyStream();
+
   const HandlerInfoIndex& handler_info_index_;
   const HttpRequestConstructor::Config request_constructor_config_;
 
@@ -65,8 +78,16 @@ class HttpRequestParser final : public request::RequestParser {
   OnNewRequestCb on_new_request_cb_;
 
   llhttp_t parser_{};
+  HttpRequestConstructor::RawHeaders raw_headers_;
+  const std::shared_ptr<HttpRequestPool> request_pool_{
+      std::make_shared<HttpRequestPool>()};
   std::optional<HttpRequestConstructor> request_constructor_;
 
+  // Body of the request that is already passed to on_new_request_cb_
+  std::shared_ptr<impl::RequestBodyStreamState> body_stream_;
+  const request::RequestBase* body_stream_request_{nullptr};
+  std::size_t body_stream_remaining_size_{0};
+
   static const llhttp_settings_t parser_settings;
   net::ParserStats& stats_;
   request::ResponseDataAccounter& data_accounter_;
@@ -1,5 +1,8 @@
 #include <server/http/http_request_parser.hpp>
 
+#include <memory_resource>
+#include <vector>
+
 #include <server/http/create_parser_test.hpp>
 #include <userver/utest/utest.hpp>
 
@@ -298,4 +301,29 @@ UTEST(HttpRequestParserParser, BodyContentLengthTooLong) {
   EXPECT_EQ(parsed, false);
 }
 
+UTEST(HttpRequestParserParser, PooledRequests) {
+  std::vector<std::shared_ptr<server::request::RequestBase>> requests;
+  auto parser = server::CreateTestParser(
+      [&requests](std::shared_ptr<server::request::RequestBase>&& request) {
+        requests.push_back(std::move(request));
+      });
+
+  parser.Parse(kHttpRequestSmall.data(), kHttpRequestSmall.size());
+  ASSERT_EQ(requests.size(), 1);
+  const auto* first_request = requests.front().get();
+  requests.clear();
+
+  // The memory of the freed request is reused by the next one
+  parser.Parse(kHttpRequestSmall.data(), kHttpRequestSmall.size());
+  ASSERT_EQ(requests.size(), 1);
+  EXPECT_EQ(requests.front().get(), first_request);
+
+  auto& http_request_impl =
+      // NOLINTNEXTLINE(cppcoreguidelines-pro-type-static-cast-downcast)
+      static_cast<server::http::HttpRequestImpl&>(*requests.front());
+  std::pmr::vector<int> values{&http_request_impl.GetMemoryResource()};
+  values.resize(1000, 42);
+  EXPECT_EQ(values.back(), 42);
+}
+
 USERVER_NAMESPACE_END
@@ -0,0 +1,44 @@
+#include <server/http/http_request_pool.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace server::http {
+
+HttpRequestPool::~HttpRequestPool() {
+  for (auto& block : blocks_) {
+    ::operator delete(block.load(std::memory_order_acquire));
+  }
+}
+
+void* HttpRequestPool::Allocate(std::size_t size) {
+  std::size_t block_size = 0;
+  // The first allocation defines the size of the cached blocks
+  if (block_size_.compare_exchange_strong(block_size, size,
+                                          std::memory_order_relaxed) ||
+      block_size == size) {
+    for (auto& block : blocks_) {
+      if (auto* cached = block.exchange(nullptr, std::memory_order_acquire)) {
+        return cached;
+      }
+    }
+  }
+  return ::operator new(size);
+}
+
+void HttpRequestPool::Deallocate(void* block, std::size_t size) noexcept {
+  if (size == block_size_.load(std::memory_order_relaxed)) {
+    for (auto& slot : blocks_) {
+      void* expected = nullptr;
+      if (slot.compare_exchange_strong(expected, block,
+                                       std::memory_order_release,
+                                       std::memory_order_relaxed)) {
+        return;
+      }
+    }
+  }
+  ::operator delete(block);
+}
+
+}  // namespace server::http
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,83 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <new>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace server::http {
+
+/// @brief Per-connection cache of the memory of the requests.
+///
+/// The requests of a connection are allocated with Allocator and a freed
+/// request leaves its memory to the next one instead of returning it to the
+/// global heap. Only the blocks of the size of the first allocation are cached.
+///
+/// Thread-safe: the requests are freed by the handler tasks on any thread.
+class HttpRequestPool final {
+ public:
+  template <typename T>
+  class Allocator;
+
+  HttpRequestPool() = default;
+  ~HttpRequestPool();
+
+  HttpRequestPool(HttpRequestPool&&) = delete;
+  HttpRequestPool& operator=(HttpRequestPool&&) = delete;
+
+  void* Allocate(std::size_t size);
+  void Deallocate(void* block, std::size_t size) noexcept;
+
+ private:
+  static constexpr std::size_t kMaxCachedBlocks = 4;
+
+  std::atomic<std::size_t> block_size_{0};
+  std::array<std::atomic<void*>, kMaxCachedBlocks> blocks_{};
+};
+
+/// Allocator for std::allocate_shared that keeps the pool alive until the
+/// last of its requests is freed
+template <typename T>
+class HttpRequestPool::Allocator final {
+ public:
+  using value_type = T;
+
+  explicit Allocator(std::shared_ptr<HttpRequestPool> pool) noexcept
+      : pool_(std::move(pool)) {}
+
+  template <typename U>
+  Allocator(const Allocator<U>& other) noexcept : pool_(other.pool_) {}
+
+  T* allocate(std::size_t n) {
+    static_assert(alignof(T) <= __STDCPP_DEFAULT_NEW_ALIGNMENT__,
+                  "Over-aligned types are not supported");
+    return static_cast<T*>(pool_->Allocate(n * sizeof(T)));
+  }
+
+  void deallocate(T* p, std::size_t n) noexcept {
+    pool_->Deallocate(p, n * sizeof(T));
+  }
+
+  template <typename U>
+  bool operator==(const Allocator<U>& other) const noexcept {
+    return pool_ == other.pool_;
+  }
+
+  template <typename U>
+  bool operator!=(const Allocator<U>& other) const noexcept {
+    return pool_ != other.pool_;
+  }
+
+ private:
+  template <typename U>
+  friend class Allocator;
+
+  std::shared_ptr<HttpRequestPool> pool_;
+};
+
+}  // namespace server::http
+
+USERVER_NAMESPACE_END
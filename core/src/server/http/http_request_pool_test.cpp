@@ -0,0 +1,60 @@
+#include <server/http/http_request_pool.hpp>
+
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+struct Request {
+  Request() = default;
+  explicit Request(std::string data) : data(std::move(data)) {}
+
+  std::string data;
+};
+
+using Allocator = server::http::HttpRequestPool::Allocator<Request>;
+
+}  // namespace
+
+TEST(HttpRequestPool, ReusesMemory) {
+  auto pool = std::make_shared<server::http::HttpRequestPool>();
+
+  auto first = std::allocate_shared<Request>(Allocator{pool});
+  const auto* first_address = first.get();
+  first.reset();
+
+  auto second = std::allocate_shared<Request>(Allocator{pool});
+  EXPECT_EQ(second.get(), first_address);
+}
+
+TEST(HttpRequestPool, ManyRequests) {
+  auto pool = std::make_shared<server::http::HttpRequestPool>();
+
+  std::vector<std::shared_ptr<Request>> requests;
+  for (int i = 0; i < 16; ++i) {
+    requests.push_back(
+        std::allocate_shared<Request>(Allocator{pool}, std::to_string(i)));
+  }
+  requests.clear();
+
+  for (int i = 0; i < 16; ++i) {
+    requests.push_back(std::allocate_shared<Request>(Allocator{pool}));
+  }
+  EXPECT_EQ(requests.size(), 16);
+}
+
+TEST(HttpRequestPool, OutlivesConnection) {
+  auto pool = std::make_shared<server::http::HttpRequestPool>();
+  auto request = std::allocate_shared<Request>(Allocator{pool}, "data");
+
+  // The request keeps the pool alive
+  pool.reset();
+  EXPECT_EQ(request->data, "data");
+  request.reset();
+}
+
+USERVER_NAMESPACE_END
@@ -2,6 +2,7 @@
 
 #include <array>
 
+#include <boost/container/small_vector.hpp>
 #include <cctz/time_zone.h>
 #include <fmt/compile.h>
 
@@ -41,6 +42,72 @@ constexpr std::string_view kKeepAlive = "keep-alive";
 
 const std::string kHostname = hostinfo::blocking::GetRealHostName();
 
+// Limits the amount of the buffered body parts and the size of the iovec
+constexpr std::size_t kMaxChunksPerWrite = 16;
+
+// Frames the parts of the streamed body as chunks and sends the pending ones
+// with a single vectored write, without copying the parts
+class ChunkedBodyWriter final {
+ public:
+  explicit ChunkedBodyWriter(engine::io::RwBase& socket) : socket_(socket) {}
+
+  void SetHeaders(std::string_view headers) { pending_headers_ = headers; }
+
+  void AddChunk(std::string&& part) {
+    UASSERT(!part.empty());
+    // The CRLF after the previous chunk is sent along with the next one
+    sizes_.push_back(
+        is_first_chunk_
+            ? fmt::format(FMT_COMPILE("{:x}\r\n"), part.size())
+            : fmt::format(FMT_COMPILE("\r\n{:x}\r\n"), part.size()));
+    parts_.push_back(std::move(part));
+    is_first_chunk_ = false;
+  }
+
+  std::size_t GetPendingChunksCount() const { return parts_.size(); }
+
+  bool HasPendingData() const {
+    return !pending_headers_.empty() || !parts_.empty();
+  }
+
+  std::size_t Flush() { return Write({}); }
+
+  std::size_t Finish() {
+    return Write(is_first_chunk_ ? std::string_view{"0\r\n\r\n"}
+                                 : std::string_view{"\r\n0\r\n\r\n"});
+  }
+
+ private:
+  std::size_t Write(std::string_view tail) {
+    io_data_.clear();
+    if (!pending_headers_.empty()) {
+      io_data_.push_back({pending_headers_.data(), pending_headers_.size()});
+    }
+    for (std::size_t i = 0; i < parts_.size(); ++i) {
+      io_data_.push_back({sizes_[i].data(), sizes_[i].size()});
+      io_data_.push_back({parts_[i].data(), parts_[i].size()});
+    }
+    if (!tail.empty()) io_data_.push_back({tail.data(), tail.size()});
+
+    const auto sent_bytes =
+        socket_.WriteAll(io_data_.data(), io_data_.size(), engine::Deadline{});
+
+    pending_headers_ = {};
+    sizes_.clear();
+    parts_.clear();
+    return sent_bytes;
+  }
+
+  engine::io::RwBase& socket_;
+  std::string_view pending_headers_;
+  boost::container::small_vector<std::string, kMaxChunksPerWrite> sizes_;
+  boost::container::small_vector<std::string, kMaxChunksPerWrite> parts_;
+  // headers, a size and a part per chunk, the terminating chunk
+  boost::container::small_vector<engine::io::IoData, kMaxChunksPerWrite * 2 + 2>
+      io_data_;
+  bool is_first_chunk_{true};
+};
+
 void CheckHeaderName(std::string_view name) {
   static constexpr auto init = []() {
     std::array<uint8_t, 256> res{};  // zero initialize
@@ -370,40 +437,42 @@ std::size_t HttpResponse::SetBodyStreamed(
   // headers end marker
   header.append(kCrlf);
 
-  // send HTTP headers
-  size_t sent_bytes = socket.WriteAll(header.data(), header.size(), {});
-  header.clear();
-  header.shrink_to_fit();  // free memory before time-consuming operation
-
   if (is_body_forbidden) {
-    return sent_bytes;
+    return socket.WriteAll(header.data(), header.size(), {});
   }
 
-  // Transmit HTTP response body
+  // The headers are sent right away, together with the parts of the body that
+  // are already available. The parts produced while the previous write was in
+  // progress are coalesced into the next write.
+  ChunkedBodyWriter writer{socket};
+  writer.SetHeaders(header);
+
+  std::size_t sent_bytes = 0;
   std::string body_part;
-  // First chunk must be sent without kCrlf
-  // because kCrlf was sent with headers
-  bool first_chunk_processed = false;
-  while (body_stream_->Pop(body_part)) {
+  while (true) {
+    while (writer.GetPendingChunksCount() < kMaxChunksPerWrite &&
+           body_stream_->PopNoblock(body_part)) {
+      if (!body_part.empty()) writer.AddChunk(std::move(body_part));
+    }
+
+    if (writer.HasPendingData()) {
+      const bool has_headers = !header.empty();
+      sent_bytes += writer.Flush();
+      if (has_headers) {
+        header.clear();
+        header.shrink_to_fit();  // free memory before time-consuming operation
+      }
+      continue;
+    }
+
+    if (!body_stream_->Pop(body_part)) break;
     if (body_part.empty()) {
       LOG_DEBUG() << "Zero size body_part in http_response.cpp";
       continue;
     }
-
-    auto size = first_chunk_processed
-                    ? fmt::format("\r\n{:x}\r\n", body_part.size())
-                    : fmt::format("{:x}\r\n", body_part.size());
-    sent_bytes += socket.WriteAll(
-        {{size.data(), size.size()}, {body_part.data(), body_part.size()}},
-        engine::Deadline{});
-
-    first_chunk_processed = true;
+    writer.AddChunk(std::move(body_part));
   }
-
-  const std::string_view terminating_chunk{
-      first_chunk_processed ? "\r\n0\r\n\r\n" : "0\r\n\r\n"};
-  sent_bytes +=
-      socket.WriteAll(terminating_chunk.data(), terminating_chunk.size(), {});
+  sent_bytes += writer.Finish();
 
   // TODO: exceptions?
   body_stream_producer_.reset();
@@ -1,8 +1,11 @@
 #include <benchmark/benchmark.h>
 
 #include <fmt/compile.h>
+#include <memory>
 #include <sstream>
 
+#include <userver/engine/io/common.hpp>
+#include <userver/engine/run_standalone.hpp>
 #include <userver/http/common_headers.hpp>
 #include <userver/server/http/http_response.hpp>
 #include <userver/server/http/http_status.hpp>
@@ -122,6 +125,78 @@ void http_headers_serialization_ostreams(benchmark::State& state) {
   }
 }
 
+// Counts the written bytes, a vectored write is a single "syscall"
+class NullSocket final : public engine::io::RwBase {
+ public:
+  bool IsValid() const override { return true; }
+  bool WaitReadable(engine::Deadline) override { return false; }
+  size_t ReadSome(void*, size_t, engine::Deadline) override { return 0; }
+  size_t ReadAll(void*, size_t, engine::Deadline) override { return 0; }
+  bool WaitWriteable(engine::Deadline) override { return true; }
+
+  size_t WriteAll(const void*, size_t len, engine::Deadline) override {
+    ++writes_;
+    return len;
+  }
+
+  size_t WriteAll(const engine::io::IoData* list, size_t list_size,
+                  engine::Deadline) override {
+    ++writes_;
+    size_t result = 0;
+    for (size_t i = 0; i < list_size; ++i) result += list[i].len;
+    return result;
+  }
+
+  std::size_t GetWrites() const { return writes_; }
+
+ private:
+  std::size_t writes_{0};
+};
+
+void http_response_send_body(benchmark::State& state) {
+  engine::RunStandalone([&] {
+    server::request::ResponseDataAccounter accounter{};
+    const auto body = std::make_shared<const std::string>(state.range(0), 'a');
+    NullSocket socket;
+
+    for ([[maybe_unused]] auto _ : state) {
+      const server::http::HttpRequestImpl request_impl{accounter};
+      auto& response = request_impl.GetHttpResponse();
+      for (const auto& [name, value] : kHeaders) {
+        response.SetHeader(std::string{name}, value);
+      }
+      response.SetSharedData(body);
+      response.SendResponse(socket);
+    }
+    state.counters["writes"] = benchmark::Counter(
+        socket.GetWrites(), benchmark::Counter::kAvgIterations);
+  });
+}
+
+void http_response_send_streamed_body(benchmark::State& state) {
+  engine::RunStandalone([&] {
+    server::request::ResponseDataAccounter accounter{};
+    const std::string part(1024, 'a');
+    NullSocket socket;
+
+    for ([[maybe_unused]] auto _ : state) {
+      const server::http::HttpRequestImpl request_impl{accounter};
+      auto& response = request_impl.GetHttpResponse();
+      response.SetStreamBody();
+      {
+        auto producer = response.GetBodyProducer();
+        for (int64_t i = 0; i < state.range(0); ++i) {
+          [[maybe_unused]] const auto pushed =
+              producer.Push(std::string{part}, {});
+        }
+      }
+      response.SendResponse(socket);
+    }
+    state.counters["writes"] = benchmark::Counter(
+        socket.GetWrites(), benchmark::Counter::kAvgIterations);
+  });
+}
+
 void HttpResponseSetHeaderBenchmark(benchmark::State& state) {
   server::request::ResponseDataAccounter accounter{};
   const server::http::HttpRequestImpl request_impl{accounter};
@@ -154,5 +229,7 @@ BENCHMARK(http_headers_serialization_inplace);
 BENCHMARK(http_headers_serialization_no_ostreams);
 BENCHMARK(http_headers_serialization_ostreams);
 BENCHMARK(HttpResponseSetHeaderBenchmark);
+BENCHMARK(http_response_send_body)->RangeMultiplier(16)->Range(64, 1 << 20);
+BENCHMARK(http_response_send_streamed_body)->RangeMultiplier(4)->Range(1, 64);
 
 USERVER_NAMESPACE_END
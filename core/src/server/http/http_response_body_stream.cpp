@@ -1,5 +1,6 @@
 #include <userver/server/http/http_response_body_stream.hpp>
 
+#include <server/http/response_compressor.hpp>
 #include <userver/utils/assert.hpp>
 
 USERVER_NAMESPACE_BEGIN
@@ -16,6 +17,11 @@ void ResponseBodyStream::PushBodyChunk(std::string&& chunk,
                                        engine::Deadline deadline) {
   UASSERT_MSG(headers_ended_,
               "SetEndOfHeaders() was not called before PushBodyChunk()");
+  if (compressor_) {
+    chunk = compressor_->CompressChunk(chunk);
+    // An empty chunk would end the chunked body
+    if (chunk.empty()) return;
+  }
   const auto success = queue_producer_.Push(std::move(chunk), deadline);
   UASSERT(success);
 }
@@ -31,6 +37,10 @@ void ResponseBodyStream::SetHeader(std::string_view name,
 }
 
 void ResponseBodyStream::SetEndOfHeaders() {
+  if (compressor_ && !headers_ended_ &&
+      !compressor_->StartStream(http_response_)) {
+    compressor_ = nullptr;
+  }
   headers_ended_ = true;
   http_response_.SetHeadersEnd();
 }
@@ -43,6 +53,21 @@ void ResponseBodyStream::SetStatusCode(HttpStatus status) {
   http_response_.SetStatus(status);
 }
 
+void ResponseBodyStream::SetCompressor(ResponseCompressor* compressor) {
+  UASSERT(!headers_ended_);
+  compressor_ = compressor;
+}
+
+void ResponseBodyStream::FinishBody(engine::Deadline deadline) {
+  if (!compressor_ || !headers_ended_) return;
+
+  auto tail = compressor_->FinishStream();
+  compressor_ = nullptr;
+  if (tail.empty()) return;
+  const auto success = queue_producer_.Push(std::move(tail), deadline);
+  UASSERT(success);
+}
+
 }  // namespace server::http
 
 USERVER_NAMESPACE_END
@@ -117,6 +117,43 @@ UTEST_P(HttpResponseBody, ForbiddenBody) {
 INSTANTIATE_UTEST_SUITE_P(HttpResponseForbiddenBody, HttpResponseBody,
                           testing::Values(100, 101, 150, 199, 304, 204));
 
+UTEST(HttpResponse, StreamedBody) {
+  const auto test_deadline =
+      engine::Deadline::FromDuration(utest::kMaxTestWaitTime);
+
+  server::request::ResponseDataAccounter accounter;
+  server::http::HttpRequestImpl request{accounter};
+  server::http::HttpResponse response{request, accounter};
+  response.SetStatus(server::http::HttpStatus::kOk);
+  response.SetStreamBody();
+
+  {
+    auto producer = response.GetBodyProducer();
+    ASSERT_TRUE(producer.Push("hello", test_deadline));
+    ASSERT_TRUE(producer.Push("", test_deadline));
+    ASSERT_TRUE(producer.Push("world!", test_deadline));
+  }
+
+  auto [server, client] =
+      internal::net::TcpListener{}.MakeSocketPair(test_deadline);
+  auto send_task = engine::AsyncNoSpan(
+      [](auto&& response, auto&& socket) { response.SendResponse(socket); },
+      std::ref(response), std::move(server));
+
+  std::vector<char> buffer(4096, '\0');
+  const auto reply_size =
+      client.RecvAll(buffer.data(), buffer.size(), test_deadline);
+
+  std::string_view reply{buffer.data(), reply_size};
+  EXPECT_TRUE(reply.find(fmt::format("\r\n{}: chunked\r\n",
+                                     http::headers::kTransferEncoding)) !=
+              std::string_view::npos);
+  constexpr std::string_view kExpectedBody =
+      "\r\n\r\n5\r\nhello\r\n6\r\nworld!\r\n0\r\n\r\n";
+  ASSERT_GE(reply.size(), kExpectedBody.size());
+  EXPECT_EQ(reply.substr(reply.size() - kExpectedBody.size()), kExpectedBody);
+}
+
 TEST(HttpResponse, GetHeaderDoesntThrow) {
   server::request::ResponseDataAccounter accounter{};
   const server::http::HttpRequestImpl request_impl{accounter};
@@ -1,12 +1,14 @@
 #include "multipart_form_data_parser.hpp"
 
+#include <algorithm>
+#include <array>
+#include <functional>
+
 #include <boost/algorithm/string/predicate.hpp>
 
 #include <userver/logging/log.hpp>
 #include <userver/utils/assert.hpp>
 
-#include <array>
-
 USERVER_NAMESPACE_BEGIN
 
 namespace server::http {
@@ -262,40 +264,37 @@ bool ParseMultipartFormDataHeaders(std::string_view& body,
   return SkipCrLf(body, crlf);
 }
 
-size_t FindBoundaryEnd(std::string_view body, std::string_view boundary,
-                       std::string_view crlf) {
-  size_t pos = 0;
-  while (pos < body.size()) {
-    if (body[pos] == crlf.front()) {
-      if (pos + crlf.size() < body.size() &&
-          body.substr(pos, crlf.size()) == crlf) {
-        pos += crlf.size();
-        if (pos < body.size() && body[pos] == '-') {
-          ++pos;
-          if (pos < body.size() && body[pos] == '-') {
-            ++pos;
-            size_t idx = 0;
-            while (idx < boundary.size() && pos + idx < body.size() &&
-                   body[pos + idx] == boundary[idx])
-              ++idx;
-            pos += idx;
-            if (idx == boundary.size()) return pos;
-          }
-        }
-      } else
-        ++pos;
-    } else
-      ++pos;
+// Finds the "<CRLF>--<boundary>" delimiters. Boyer-Moore-Horspool skips
+// most of the bytes of large part values instead of checking each of them.
+class DelimiterSearcher final {
+ public:
+  DelimiterSearcher(std::string_view boundary, std::string_view crlf)
+      : delimiter_(std::string{crlf} + "--" + std::string{boundary}),
+        searcher_(delimiter_.begin(), delimiter_.end()) {}
+
+  DelimiterSearcher(DelimiterSearcher&&) = delete;
+  DelimiterSearcher& operator=(DelimiterSearcher&&) = delete;
+
+  // Returns the position right after the boundary
+  size_t FindBoundaryEnd(std::string_view body) const {
+    const auto it = std::search(body.begin(), body.end(), searcher_);
+    if (it == body.end()) return std::string_view::npos;
+    return static_cast<size_t>(it - body.begin()) + delimiter_.size();
   }
-  return std::string_view::npos;
-}
+
+  size_t DelimiterSize() const { return delimiter_.size(); }
+
+ private:
+  const std::string delimiter_;
+  const std::boyer_moore_horspool_searcher<std::string::const_iterator>
+      searcher_;
+};
 
 bool ParseMultipartFormDataValue(std::string_view& body,
-                                 std::string_view boundary,
+                                 const DelimiterSearcher& delimiter_searcher,
                                  FormDataArgInfo&& arg_info,
                                  std::optional<std::string>& charset,
-                                 FormDataArgs& form_data_args,
-                                 std::string_view crlf) {
+                                 FormDataArgs& form_data_args) {
   static const std::string kCharset = "_charset_";
 
   if (arg_info.arg.content_disposition.empty()) {
@@ -303,12 +302,12 @@ bool ParseMultipartFormDataValue(std::string_view& body,
     return false;
   }
 
-  size_t pos = FindBoundaryEnd(body, boundary, crlf);
+  size_t pos = delimiter_searcher.FindBoundaryEnd(body);
   if (pos == std::string_view::npos) {
     LOG_WARNING() << "Unexpected end of form-data part value";
     return false;
   }
-  arg_info.arg.value = body.substr(0, pos - boundary.size() - 2 - crlf.size());
+  arg_info.arg.value = body.substr(0, pos - delimiter_searcher.DelimiterSize());
   if (arg_info.name == kCharset) {
     charset = arg_info.arg.value;
   } else {
@@ -328,15 +327,20 @@ bool ParseMultipartFormDataBody(std::string_view body,
                                 bool strict_cr_lf) {
   LOG_TRACE() << "body=" << body << ", body.size()=" << body.size();
   std::string_view crlf = "\r\n";
-  if (boundary.size() + 2 <= body.size() && body[0] == '-' && body[1] == '-' &&
-      body.substr(2, boundary.size()) == boundary) {
+  const bool starts_with_boundary =
+      boundary.size() + 2 <= body.size() && body[0] == '-' && body[1] == '-' &&
+      body.substr(2, boundary.size()) == boundary;
+  if (starts_with_boundary) {
     body.remove_prefix(2 + boundary.size());
-    if (!strict_cr_lf) crlf = AutoDetectCrLf(body, crlf);
   } else {
     while (!body.empty() && body.front() != kCr && body.front() != kLf)
       body.remove_prefix(1);
-    if (!strict_cr_lf) crlf = AutoDetectCrLf(body, crlf);
-    size_t pos = FindBoundaryEnd(body, boundary, crlf);
+  }
+  if (!strict_cr_lf) crlf = AutoDetectCrLf(body, crlf);
+
+  const DelimiterSearcher delimiter_searcher{boundary, crlf};
+  if (!starts_with_boundary) {
+    size_t pos = delimiter_searcher.FindBoundaryEnd(body);
     if (pos == std::string_view::npos) {
       LOG_WARNING() << "Unexpected request body end";
       return false;
@@ -381,8 +385,9 @@ bool ParseMultipartFormDataBody(std::string_view body,
     if (!ParseMultipartFormDataHeaders(body, arg_info, crlf)) return false;
     LOG_TRACE() << "ParseMultipartFormDataHeaders finished, body=" << body
                 << ", body.size()=" << body.size();
-    if (!ParseMultipartFormDataValue(body, boundary, std::move(arg_info),
-                                     charset, form_data_args, crlf)) {
+    if (!ParseMultipartFormDataValue(body, delimiter_searcher,
+                                     std::move(arg_info), charset,
+                                     form_data_args)) {
       return false;
     }
   }
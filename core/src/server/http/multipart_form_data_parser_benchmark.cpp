@@ -0,0 +1,58 @@
+#include <benchmark/benchmark.h>
+
+#include <string>
+
+#include <server/http/multipart_form_data_parser.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+constexpr std::string_view kBoundary =
+    "------------------------8099aaf9723cd601";
+
+std::string MakeContentType() {
+  return "multipart/form-data; boundary=" + std::string{kBoundary};
+}
+
+// A text field and a file of `file_size` bytes. The file content is full of
+// '\r', '\n' and '-' to stress the boundary search.
+std::string MakeBody(std::size_t file_size) {
+  std::string file;
+  file.reserve(file_size);
+  while (file.size() < file_size) file += "line of a file\r\n---\r\n";
+  file.resize(file_size);
+
+  std::string body;
+  body += "--";
+  body += kBoundary;
+  body += "\r\nContent-Disposition: form-data; name=\"text\"\r\n\r\n";
+  body += "value\r\n--";
+  body += kBoundary;
+  body +=
+      "\r\nContent-Disposition: form-data; name=\"file\"; "
+      "filename=\"a.bin\"\r\nContent-Type: application/octet-stream\r\n\r\n";
+  body += file;
+  body += "\r\n--";
+  body += kBoundary;
+  body += "--\r\n";
+  return body;
+}
+
+}  // namespace
+
+void MultipartFormDataParse(benchmark::State& state) {
+  const auto content_type = MakeContentType();
+  const auto body = MakeBody(state.range(0));
+
+  for ([[maybe_unused]] auto _ : state) {
+    server::http::FormDataArgs form_data_args;
+    benchmark::DoNotOptimize(
+        ParseMultipartFormData(content_type, body, form_data_args));
+    benchmark::DoNotOptimize(form_data_args);
+  }
+  state.SetBytesProcessed(state.iterations() * body.size());
+}
+BENCHMARK(MultipartFormDataParse)->RangeMultiplier(16)->Range(1 << 10, 1 << 24);
+
+USERVER_NAMESPACE_END
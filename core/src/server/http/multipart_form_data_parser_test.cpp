@@ -532,4 +532,25 @@ TEST(MultipartFormDataParser, ParseErrors) {
   EXPECT_TRUE(form_data_args.empty());
 }
 
+TEST(MultipartFormDataParser, BoundaryPrefixInValue) {
+  namespace sh = server::http;
+  const std::string kContentType = "multipart/form-data; boundary=zzzz";
+  const std::string kValue = "a\r\n--zzz\r\n--zz--\r\n-\r\n--z\r\n--zzz";
+  const std::string kFormData =
+      "--zzzz\r\n"
+      "Content-Disposition: form-data; name=\"arg\"\r\n"
+      "\r\n" +
+      kValue +
+      "\r\n"
+      "--zzzz--\r\n";
+
+  sh::FormDataArgs form_data_args;
+  ASSERT_TRUE(ParseMultipartFormData(kContentType, kFormData, form_data_args));
+  ASSERT_EQ(form_data_args["arg"].size(), 1);
+  EXPECT_EQ(form_data_args["arg"].front().value, kValue);
+  // Values are views into the body
+  EXPECT_EQ(form_data_args["arg"].front().value.data(),
+            kFormData.data() + kFormData.find(kValue));
+}
+
 USERVER_NAMESPACE_END
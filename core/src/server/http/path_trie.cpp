@@ -0,0 +1,23 @@
+#include <server/http/path_trie.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace server::http::impl {
+
+PathSegments SplitPathSegments(std::string_view path) {
+  PathSegments segments;
+  std::size_t begin = 0;
+  while (true) {
+    const auto end = path.find('/', begin);
+    if (end == std::string_view::npos) {
+      segments.push_back(path.substr(begin));
+      return segments;
+    }
+    segments.push_back(path.substr(begin, end - begin));
+    begin = end + 1;
+  }
+}
+
+}  // namespace server::http::impl
+
+USERVER_NAMESPACE_END
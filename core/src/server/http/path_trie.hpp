@@ -0,0 +1,266 @@
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <limits>
+#include <map>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <boost/container/small_vector.hpp>
+
+#include <userver/utils/assert.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace server::http::impl {
+
+inline constexpr std::size_t kPathSegmentsInplace = 16;
+
+/// Request path split by '/', views into the path
+using PathSegments =
+    boost::container::small_vector<std::string_view, kPathSegmentsInplace>;
+
+/// Splits the path by '/' without allocating for paths of up to
+/// kPathSegmentsInplace segments. "/a/b" results in {"", "a", "b"}.
+PathSegments SplitPathSegments(std::string_view path);
+
+/// Segment that matches any path suffix, including an empty one
+inline constexpr std::string_view kAnySuffixSegment = "*";
+
+/// @brief Index of route patterns made of fixed segments at known positions.
+///
+/// Values are stored for (fixed segments, route length) pairs and are found by
+/// the segments of a request path. Routes are added into a tree of std::map
+/// nodes, which is compiled into flat arrays after each change, so that
+/// matching does not chase map nodes and does not allocate.
+///
+/// Matching preference, from the most to the least preferred:
+/// - routes with a fixed segment at the smallest position, recursively
+/// - routes of exactly the path length at the current node
+/// - routes that end with kAnySuffixSegment at the largest position
+template <typename Value>
+class PathTrie final {
+ public:
+  struct FixedSegment final {
+    std::size_t position;
+    std::string segment;
+  };
+
+  PathTrie() { Compile(); }
+
+  PathTrie(PathTrie&&) = delete;
+  PathTrie& operator=(PathTrie&&) = delete;
+
+  /// @returns the value for routes with `fixed_segments` (sorted by position)
+  /// and `length` segments in total, default-constructed on first access.
+  /// The reference is stable.
+  Value& Emplace(std::vector<FixedSegment>&& fixed_segments,
+                 std::size_t length);
+
+  /// @brief Finds the best route for `path` that is accepted by
+  /// `accept(value, any_suffix_position)`.
+  ///
+  /// `any_suffix_position` is std::nullopt for routes of the same length as
+  /// the path, and the position of kAnySuffixSegment otherwise.
+  /// @returns whether any route was accepted
+  template <typename Accept>
+  bool Match(const PathSegments& path, const Accept& accept) const {
+    return MatchNode(0, path, accept);
+  }
+
+ private:
+  using Index = std::uint32_t;
+  static constexpr Index kNoNode = std::numeric_limits<Index>::max();
+
+  struct BuildNode final {
+    // by segment position, then by segment
+    std::map<std::size_t, std::map<std::string, BuildNode, std::less<>>> next;
+    // by route length
+    std::map<std::size_t, Value> values;
+  };
+
+  struct Node final {
+    Index groups_begin;
+    Index groups_end;
+    Index values_begin;
+    Index values_end;
+  };
+
+  // Edges with the same segment position
+  struct Group final {
+    std::size_t position;
+    Index edges_begin;
+    Index edges_end;
+    Index any_suffix_child;
+  };
+
+  struct Edge final {
+    std::string_view segment;
+    Index child;
+  };
+
+  struct LengthValue final {
+    std::size_t length;
+    const Value* value;
+  };
+
+  // Segments are compared by size first, it is cheaper than comparing bytes
+  static bool SegmentLess(std::string_view lhs, std::string_view rhs) noexcept {
+    if (lhs.size() != rhs.size()) return lhs.size() < rhs.size();
+    return lhs < rhs;
+  }
+
+  void Compile();
+  Index CompileNode(const BuildNode& build_node);
+
+  template <typename Accept>
+  bool MatchNode(Index node_index, const PathSegments& path,
+                 const Accept& accept) const;
+
+  const Value* FindValue(const Node& node, std::size_t length,
+                         bool exact) const noexcept;
+
+  BuildNode root_;
+
+  std::vector<Node> nodes_;
+  std::vector<Group> groups_;
+  std::vector<Edge> edges_;
+  std::vector<LengthValue> values_;
+};
+
+template <typename Value>
+Value& PathTrie<Value>::Emplace(std::vector<FixedSegment>&& fixed_segments,
+                                std::size_t length) {
+  BuildNode* node = &root_;
+  for (auto& fixed : fixed_segments) {
+    node = &node->next[fixed.position][std::move(fixed.segment)];
+  }
+  auto& value = node->values[length];
+  Compile();
+  return value;
+}
+
+template <typename Value>
+void PathTrie<Value>::Compile() {
+  nodes_.clear();
+  groups_.clear();
+  edges_.clear();
+  values_.clear();
+  [[maybe_unused]] const auto root_index = CompileNode(root_);
+  UASSERT(root_index == 0);
+}
+
+template <typename Value>
+auto PathTrie<Value>::CompileNode(const BuildNode& build_node) -> Index {
+  const auto node_index = static_cast<Index>(nodes_.size());
+  nodes_.emplace_back();
+
+  const auto values_begin = static_cast<Index>(values_.size());
+  for (const auto& [length, value] : build_node.values) {
+    values_.push_back({length, &value});
+  }
+  const auto values_end = static_cast<Index>(values_.size());
+
+  // Groups and edges of a node are contiguous, children are compiled after
+  const auto groups_begin = static_cast<Index>(groups_.size());
+  for (const auto& [position, edges] : build_node.next) {
+    const auto edges_begin = static_cast<Index>(edges_.size());
+    for (const auto& [segment, child] : edges) {
+      edges_.push_back({segment, kNoNode});
+    }
+    const auto edges_end = static_cast<Index>(edges_.size());
+    std::sort(edges_.begin() + edges_begin, edges_.begin() + edges_end,
+              [](const Edge& lhs, const Edge& rhs) {
+                return SegmentLess(lhs.segment, rhs.segment);
+              });
+    groups_.push_back({position, edges_begin, edges_end, kNoNode});
+  }
+  const auto groups_end = static_cast<Index>(groups_.size());
+
+  auto group_index = groups_begin;
+  for (const auto& [position, edges] : build_node.next) {
+    // groups_ and edges_ grow in the recursive calls, no references are held
+    const auto edges_begin = groups_[group_index].edges_begin;
+    const auto edges_end = groups_[group_index].edges_end;
+    for (auto edge_index = edges_begin; edge_index < edges_end; ++edge_index) {
+      const auto segment = edges_[edge_index].segment;
+      const auto child_index = CompileNode(edges.find(segment)->second);
+      edges_[edge_index].child = child_index;
+      if (segment == kAnySuffixSegment) {
+        groups_[group_index].any_suffix_child = child_index;
+      }
+    }
+    ++group_index;
+  }
+
+  nodes_[node_index] = {groups_begin, groups_end, values_begin, values_end};
+  return node_index;
+}
+
+template <typename Value>
+template <typename Accept>
+bool PathTrie<Value>::MatchNode(Index node_index, const PathSegments& path,
+                                const Accept& accept) const {
+  const auto& node = nodes_[node_index];
+
+  for (auto group_index = node.groups_begin; group_index < node.groups_end;
+       ++group_index) {
+    const auto& group = groups_[group_index];
+    if (group.position >= path.size()) break;
+
+    const auto segment = path[group.position];
+    const auto edges_end = edges_.begin() + group.edges_end;
+    const auto it = std::lower_bound(
+        edges_.begin() + group.edges_begin, edges_end, segment,
+        [](const Edge& edge, std::string_view segment) {
+          return SegmentLess(edge.segment, segment);
+        });
+    if (it != edges_end && it->segment == segment &&
+        MatchNode(it->child, path, accept)) {
+      return true;
+    }
+  }
+
+  if (const auto* value = FindValue(node, path.size(), /*exact=*/true)) {
+    if (accept(*value, std::optional<std::size_t>{})) return true;
+  }
+
+  for (auto group_index = node.groups_end; group_index > node.groups_begin;) {
+    --group_index;
+    const auto& group = groups_[group_index];
+    if (group.position >= path.size() || group.any_suffix_child == kNoNode) {
+      continue;
+    }
+    const auto* value =
+        FindValue(nodes_[group.any_suffix_child], path.size(), /*exact=*/false);
+    if (value && accept(*value, std::optional<std::size_t>{group.position})) {
+      return true;
+    }
+  }
+
+  return false;
+}
+
+template <typename Value>
+const Value* PathTrie<Value>::FindValue(const Node& node, std::size_t length,
+                                        bool exact) const noexcept {
+  const auto begin = values_.begin() + node.values_begin;
+  const auto end = values_.begin() + node.values_end;
+  // The first value with a greater length
+  auto it = std::upper_bound(
+      begin, end, length,
+      [](std::size_t length, const LengthValue& value) {
+        return length < value.length;
+      });
+  if (it == begin) return nullptr;
+  --it;
+  if (exact && it->length != length) return nullptr;
+  return it->value;
+}
+
+}  // namespace server::http::impl
+
+USERVER_NAMESPACE_END
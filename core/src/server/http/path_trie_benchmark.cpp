@@ -0,0 +1,71 @@
+#include <benchmark/benchmark.h>
+
+#include <string>
+#include <vector>
+
+#include <server/http/path_trie.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+using Trie = server::http::impl::PathTrie<int>;
+
+constexpr std::size_t kServices = 50;
+constexpr std::size_t kResources = 30;
+
+// 1500 routes like /service-N/v1/resource-M/{id}/action
+void FillTrie(Trie& trie) {
+  int value = 0;
+  for (std::size_t service = 0; service < kServices; ++service) {
+    for (std::size_t resource = 0; resource < kResources; ++resource) {
+      trie.Emplace({{0, ""},
+                    {1, "service-" + std::to_string(service)},
+                    {2, "v1"},
+                    {3, "resource-" + std::to_string(resource)},
+                    {5, "action"}},
+                   6) = value++;
+    }
+  }
+}
+
+std::vector<std::string> MakePaths() {
+  std::vector<std::string> paths;
+  for (std::size_t i = 0; i < 1024; ++i) {
+    paths.push_back("/service-" + std::to_string(i * 7 % kServices) +
+                    "/v1/resource-" + std::to_string(i * 13 % kResources) +
+                    '/' + std::to_string(i) + "/action");
+  }
+  return paths;
+}
+
+}  // namespace
+
+void path_trie_split(benchmark::State& state) {
+  const auto paths = MakePaths();
+  std::size_t i = 0;
+  for ([[maybe_unused]] auto _ : state) {
+    benchmark::DoNotOptimize(
+        server::http::impl::SplitPathSegments(paths[i++ % paths.size()]));
+  }
+}
+BENCHMARK(path_trie_split);
+
+void path_trie_match(benchmark::State& state) {
+  Trie trie;
+  FillTrie(trie);
+  const auto paths = MakePaths();
+  std::size_t i = 0;
+  for ([[maybe_unused]] auto _ : state) {
+    int result = -1;
+    trie.Match(server::http::impl::SplitPathSegments(paths[i++ % paths.size()]),
+               [&](int value, std::optional<std::size_t>) {
+                 result = value;
+                 return true;
+               });
+    benchmark::DoNotOptimize(result);
+  }
+}
+BENCHMARK(path_trie_match);
+
+USERVER_NAMESPACE_END
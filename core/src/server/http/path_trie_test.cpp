@@ -0,0 +1,90 @@
+#include <server/http/path_trie.hpp>
+
+#include <gtest/gtest.h>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+using server::http::impl::PathSegments;
+using server::http::impl::SplitPathSegments;
+using Trie = server::http::impl::PathTrie<int>;
+
+struct Match final {
+  int value{0};
+  std::optional<std::size_t> any_suffix_position;
+};
+
+std::optional<Match> FindFirst(const Trie& trie, std::string_view path) {
+  std::optional<Match> result;
+  trie.Match(SplitPathSegments(path),
+             [&](int value, std::optional<std::size_t> any_suffix_position) {
+               result = Match{value, any_suffix_position};
+               return true;
+             });
+  return result;
+}
+
+}  // namespace
+
+TEST(PathTrie, Split) {
+  EXPECT_EQ(SplitPathSegments("/a/bc"), (PathSegments{"", "a", "bc"}));
+  EXPECT_EQ(SplitPathSegments("/a/"), (PathSegments{"", "a", ""}));
+  EXPECT_EQ(SplitPathSegments(""), (PathSegments{""}));
+  EXPECT_EQ(SplitPathSegments("a//b"), (PathSegments{"a", "", "b"}));
+}
+
+TEST(PathTrie, FixedAndWildcards) {
+  Trie trie;
+  // /v1/{id}
+  trie.Emplace({{0, ""}, {1, "v1"}}, 3) = 1;
+  // /v1/{id}/info
+  trie.Emplace({{0, ""}, {1, "v1"}, {3, "info"}}, 4) = 2;
+  // /v1/me
+  trie.Emplace({{0, ""}, {1, "v1"}, {2, "me"}}, 3) = 3;
+
+  EXPECT_EQ(FindFirst(trie, "/v1/42")->value, 1);
+  EXPECT_EQ(FindFirst(trie, "/v1/42/info")->value, 2);
+  EXPECT_EQ(FindFirst(trie, "/v1/me")->value, 3);
+  EXPECT_EQ(FindFirst(trie, "/v1/me/info")->value, 2);
+  EXPECT_FALSE(FindFirst(trie, "/v2/42"));
+  EXPECT_FALSE(FindFirst(trie, "/v1/42/other"));
+  EXPECT_FALSE(FindFirst(trie, "/v1"));
+}
+
+TEST(PathTrie, AnySuffix) {
+  Trie trie;
+  // /static/*
+  trie.Emplace({{0, ""}, {1, "static"}, {2, "*"}}, 3) = 1;
+  // /static/{file}
+  trie.Emplace({{0, ""}, {1, "static"}}, 3) = 2;
+
+  EXPECT_EQ(FindFirst(trie, "/static/a")->value, 2);
+  EXPECT_FALSE(FindFirst(trie, "/static/a")->any_suffix_position);
+
+  const auto match = FindFirst(trie, "/static/a/b/c");
+  ASSERT_TRUE(match);
+  EXPECT_EQ(match->value, 1);
+  EXPECT_EQ(match->any_suffix_position, 2);
+
+  EXPECT_FALSE(FindFirst(trie, "/static"));
+}
+
+TEST(PathTrie, FallsBackIfNotAccepted) {
+  Trie trie;
+  trie.Emplace({{0, ""}, {1, "a"}, {2, "b"}}, 3) = 1;
+  trie.Emplace({{0, ""}, {1, "a"}}, 3) = 2;
+  trie.Emplace({{0, ""}, {1, "*"}}, 2) = 3;
+
+  std::vector<int> visited;
+  const bool matched =
+      trie.Match(SplitPathSegments("/a/b"),
+                 [&](int value, std::optional<std::size_t>) {
+                   visited.push_back(value);
+                   return value == 3;
+                 });
+  EXPECT_TRUE(matched);
+  EXPECT_EQ(visited, (std::vector<int>{1, 2, 3}));
+}
+
+USERVER_NAMESPACE_END
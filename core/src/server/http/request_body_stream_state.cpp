@@ -0,0 +1,115 @@
+#include <server/http/request_body_stream_state.hpp>
+
+#include <limits>
+#include <mutex>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace server::http::impl {
+
+RequestBodyStreamState::RequestBodyStreamState(std::size_t max_buffered_size)
+    : max_buffered_size_(max_buffered_size) {}
+
+std::shared_ptr<RequestBodyStreamState> RequestBodyStreamState::FromBody(
+    std::string body) {
+  auto state = std::make_shared<RequestBodyStreamState>(
+      std::numeric_limits<std::size_t>::max());
+  if (!body.empty()) {
+    state->buffered_size_ = body.size();
+    state->chunks_.push_back(std::move(body));
+  }
+  state->state_ = State::kFinished;
+  return state;
+}
+
+void RequestBodyStreamState::Push(std::string_view chunk) {
+  if (chunk.empty()) return;
+  {
+    const std::lock_guard lock{mutex_};
+    if (state_ != State::kReceiving) return;
+    chunks_.emplace_back(chunk);
+    buffered_size_ += chunk.size();
+  }
+  data_event_.Send();
+}
+
+void RequestBodyStreamState::Finish() {
+  {
+    const std::lock_guard lock{mutex_};
+    if (state_ != State::kReceiving) return;
+    state_ = State::kFinished;
+  }
+  data_event_.Send();
+}
+
+void RequestBodyStreamState::Abort() {
+  {
+    const std::lock_guard lock{mutex_};
+    if (state_ != State::kReceiving) return;
+    state_ = State::kAborted;
+  }
+  data_event_.Send();
+}
+
+void RequestBodyStreamState::Discard() {
+  const std::lock_guard lock{mutex_};
+  state_ = State::kDiscarded;
+  chunks_.clear();
+  buffered_size_ = 0;
+  NotifyDrained();
+}
+
+bool RequestBodyStreamState::IsFull() {
+  const std::lock_guard lock{mutex_};
+  return buffered_size_ >= max_buffered_size_;
+}
+
+engine::Future<void> RequestBodyStreamState::GetDrainedWakeup() {
+  engine::Promise<void> promise;
+  auto future = promise.get_future();
+
+  const std::lock_guard lock{mutex_};
+  if (buffered_size_ >= max_buffered_size_) {
+    drained_.emplace(std::move(promise));
+  } else {
+    promise.set_value();
+  }
+  return future;
+}
+
+auto RequestBodyStreamState::Pop(std::string& chunk, engine::Deadline deadline)
+    -> PopResult {
+  while (true) {
+    {
+      const std::lock_guard lock{mutex_};
+      if (!chunks_.empty()) {
+        chunk = std::move(chunks_.front());
+        chunks_.pop_front();
+        buffered_size_ -= chunk.size();
+        if (buffered_size_ < max_buffered_size_) NotifyDrained();
+        return PopResult::kChunk;
+      }
+      switch (state_) {
+        case State::kReceiving:
+          break;
+        case State::kFinished:
+          return PopResult::kEnd;
+        case State::kAborted:
+        case State::kDiscarded:
+          return PopResult::kAborted;
+      }
+    }
+    if (!data_event_.WaitForEventUntil(deadline)) return PopResult::kTimeout;
+  }
+}
+
+void RequestBodyStreamState::NotifyDrained() {
+  if (drained_) {
+    drained_->set_value();
+    drained_.reset();
+  }
+}
+
+}  // namespace server::http::impl
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,65 @@
+#pragma once
+
+#include <cstddef>
+#include <deque>
+#include <memory>
+#include <optional>
+#include <string>
+#include <string_view>
+
+#include <userver/engine/deadline.hpp>
+#include <userver/engine/future.hpp>
+#include <userver/engine/mutex.hpp>
+#include <userver/engine/single_consumer_event.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace server::http::impl {
+
+/// Chunks of a request body passed from the connection task to the handler.
+/// Pushing never blocks, the connection applies the backpressure itself by
+/// waiting for GetDrainedWakeup() before reading more from the socket.
+class RequestBodyStreamState final {
+ public:
+  enum class PopResult { kChunk, kEnd, kAborted, kTimeout };
+
+  explicit RequestBodyStreamState(std::size_t max_buffered_size);
+
+  /// Creates a finished stream of a body that is already received
+  static std::shared_ptr<RequestBodyStreamState> FromBody(std::string body);
+
+  // Connection side
+  void Push(std::string_view chunk);
+  /// The whole body was pushed
+  void Finish();
+  /// The body will not be received completely
+  void Abort();
+  /// Nobody is going to read the body, the pushed chunks are dropped
+  void Discard();
+
+  bool IsFull();
+  /// The future becomes ready once the stream is not full
+  engine::Future<void> GetDrainedWakeup();
+
+  // Handler side
+  PopResult Pop(std::string& chunk, engine::Deadline deadline);
+
+ private:
+  enum class State { kReceiving, kFinished, kAborted, kDiscarded };
+
+  void NotifyDrained();
+
+  const std::size_t max_buffered_size_;
+
+  engine::Mutex mutex_;
+  std::deque<std::string> chunks_;
+  std::size_t buffered_size_{0};
+  State state_{State::kReceiving};
+  std::optional<engine::Promise<void>> drained_;
+
+  engine::SingleConsumerEvent data_event_;
+};
+
+}  // namespace server::http::impl
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,124 @@
+#include <server/http/request_body_stream_state.hpp>
+
+#include <userver/engine/async.hpp>
+#include <userver/engine/wait_any.hpp>
+#include <userver/utest/utest.hpp>
+
+#include <server/http/http_request_impl.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+using server::http::impl::RequestBodyStreamState;
+using PopResult = RequestBodyStreamState::PopResult;
+
+std::string ReadAll(RequestBodyStreamState& state) {
+  std::string body;
+  std::string chunk;
+  while (true) {
+    const auto result = state.Pop(chunk, {});
+    if (result == PopResult::kEnd) return body;
+    EXPECT_EQ(result, PopResult::kChunk);
+    body += chunk;
+  }
+}
+
+}  // namespace
+
+UTEST(RequestBodyStreamState, PushAndPop) {
+  RequestBodyStreamState state{1024};
+  state.Push("foo");
+  state.Push("");
+  state.Push("bar");
+  state.Finish();
+  state.Push("ignored");
+
+  std::string chunk;
+  EXPECT_EQ(state.Pop(chunk, {}), PopResult::kChunk);
+  EXPECT_EQ(chunk, "foo");
+  EXPECT_EQ(state.Pop(chunk, {}), PopResult::kChunk);
+  EXPECT_EQ(chunk, "bar");
+  EXPECT_EQ(state.Pop(chunk, {}), PopResult::kEnd);
+  EXPECT_EQ(state.Pop(chunk, {}), PopResult::kEnd);
+}
+
+UTEST(RequestBodyStreamState, Abort) {
+  RequestBodyStreamState state{1024};
+  state.Push("foo");
+  state.Abort();
+
+  std::string chunk;
+  EXPECT_EQ(state.Pop(chunk, {}), PopResult::kChunk);
+  EXPECT_EQ(state.Pop(chunk, {}), PopResult::kAborted);
+}
+
+UTEST(RequestBodyStreamState, Timeout) {
+  RequestBodyStreamState state{1024};
+  std::string chunk;
+  EXPECT_EQ(state.Pop(chunk, engine::Deadline::FromDuration(
+                                 std::chrono::milliseconds{10})),
+            PopResult::kTimeout);
+}
+
+UTEST(RequestBodyStreamState, FlowControl) {
+  RequestBodyStreamState state{8};
+
+  auto reader = engine::AsyncNoSpan([&state] { return ReadAll(state); });
+
+  std::string expected;
+  for (int i = 0; i < 100; ++i) {
+    while (state.IsFull()) {
+      auto drained = state.GetDrainedWakeup();
+      ASSERT_TRUE(engine::WaitAny(drained));
+    }
+    const auto chunk = std::to_string(i) + ',';
+    expected += chunk;
+    state.Push(chunk);
+  }
+  state.Finish();
+
+  EXPECT_EQ(reader.Get(), expected);
+}
+
+UTEST_MT(RequestBodyStreamState, ProducerBlocksOnFullBuffer, 2) {
+  RequestBodyStreamState state{4};
+  state.Push("12345");
+  EXPECT_TRUE(state.IsFull());
+
+  auto drained = state.GetDrainedWakeup();
+  EXPECT_EQ(drained.wait_for(std::chrono::milliseconds{10}),
+            engine::FutureStatus::kTimeout);
+
+  std::string chunk;
+  EXPECT_EQ(state.Pop(chunk, {}), PopResult::kChunk);
+  EXPECT_EQ(drained.wait_for(utest::kMaxTestWaitTime),
+            engine::FutureStatus::kReady);
+  EXPECT_FALSE(state.IsFull());
+}
+
+UTEST(RequestBodyStreamState, Discard) {
+  RequestBodyStreamState state{4};
+  state.Push("12345");
+  auto drained = state.GetDrainedWakeup();
+
+  state.Discard();
+  EXPECT_EQ(drained.wait_for(utest::kMaxTestWaitTime),
+            engine::FutureStatus::kReady);
+  state.Push("67890");
+  EXPECT_FALSE(state.IsFull());
+}
+
+UTEST(RequestBodyStream, BufferedBody) {
+  server::request::ResponseDataAccounter accounter;
+  server::http::HttpRequestImpl request{accounter};
+  request.SetRequestBody("body");
+
+  auto& stream = request.GetBodyStream();
+  EXPECT_EQ(stream.ReadAll(), "body");
+
+  std::string chunk;
+  EXPECT_FALSE(stream.ReadChunk(chunk));
+}
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,222 @@
+#include <server/http/response_compressor.hpp>
+
+#include <chrono>
+#include <cstdlib>
+#include <type_traits>
+#include <utility>
+
+#include <engine/task/span_cpu_stats.hpp>
+#include <server/handlers/http_handler_base_statistics.hpp>
+#include <userver/http/common_headers.hpp>
+#include <userver/server/http/http_response.hpp>
+#include <userver/utils/assert.hpp>
+#include <userver/utils/str_icase.hpp>
+#include <userver/utils/text_light.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace server::http {
+
+namespace {
+
+std::string_view TrimSpaces(std::string_view value) {
+  while (!value.empty() && utils::text::IsAsciiSpace(value.front())) {
+    value.remove_prefix(1);
+  }
+  while (!value.empty() && utils::text::IsAsciiSpace(value.back())) {
+    value.remove_suffix(1);
+  }
+  return value;
+}
+
+// Parses 'coding;q=0.5', a missing or a malformed quality value means 1
+std::pair<std::string_view, double> ParseCoding(std::string_view item) {
+  const auto params_pos = item.find(';');
+  const auto coding = TrimSpaces(item.substr(0, params_pos));
+  double quality = 1.0;
+
+  if (params_pos != std::string_view::npos) {
+    auto params = TrimSpaces(item.substr(params_pos + 1));
+    if (params.size() > 2 && (params[0] == 'q' || params[0] == 'Q') &&
+        params[1] == '=') {
+      const std::string value{params.substr(2)};
+      char* end = nullptr;
+      const auto parsed = std::strtod(value.c_str(), &end);
+      if (end != value.c_str()) quality = parsed;
+    }
+  }
+
+  return {coding, quality};
+}
+
+bool IsStatusWithBody(HttpStatus status) {
+  const auto code = static_cast<int>(status);
+  return code >= 200 && status != HttpStatus::kNoContent &&
+         status != HttpStatus::kNotModified;
+}
+
+}  // namespace
+
+std::optional<ContentEncoding> NegotiateContentEncoding(
+    std::string_view accept_encoding, bool is_gzip_available,
+    bool is_zstd_available) {
+  std::optional<double> zstd_quality;
+  std::optional<double> gzip_quality;
+  std::optional<double> any_quality;
+
+  for (const auto item :
+       utils::text::SplitIntoStringViewVector(accept_encoding, ",")) {
+    const auto [coding, quality] = ParseCoding(item);
+    if (utils::StrIcaseEqual{}(coding, "zstd")) {
+      zstd_quality = quality;
+    } else if (utils::StrIcaseEqual{}(coding, "gzip") ||
+               utils::StrIcaseEqual{}(coding, "x-gzip")) {
+      gzip_quality = quality;
+    } else if (coding == "*") {
+      any_quality = quality;
+    }
+  }
+
+  const auto zstd =
+      is_zstd_available ? zstd_quality.value_or(any_quality.value_or(0)) : 0;
+  const auto gzip =
+      is_gzip_available ? gzip_quality.value_or(any_quality.value_or(0)) : 0;
+  if (zstd <= 0 && gzip <= 0) return std::nullopt;
+  return zstd >= gzip ? ContentEncoding::kZstd : ContentEncoding::kGzip;
+}
+
+bool IsCompressibleContentType(std::string_view content_type,
+                               const std::vector<std::string>& content_types) {
+  const auto media_type =
+      TrimSpaces(content_type.substr(0, content_type.find(';')));
+  if (media_type.empty()) return false;
+
+  for (const std::string_view allowed : content_types) {
+    if (utils::text::EndsWith(allowed, "/*")) {
+      const auto prefix = allowed.substr(0, allowed.size() - 1);
+      if (utils::text::ICaseStartsWith(media_type, prefix)) return true;
+    } else if (utils::StrIcaseEqual{}(media_type, allowed)) {
+      return true;
+    }
+  }
+  return false;
+}
+
+ResponseCompressor::ResponseCompressor(
+    const handlers::ResponseCompressionConfig& config, ContentEncoding encoding,
+    handlers::HttpHandlerMethodStatistics& stats)
+    : config_(config), encoding_(encoding), stats_(stats) {}
+
+void ResponseCompressor::CompressBody(HttpResponse& response) {
+  UASSERT(!response.IsBodyStreamed());
+  const auto& body = response.GetData();
+  if (body.size() < config_.min_size || !IsEligible(response)) return;
+
+  auto compressed = Account(body.size(), [this, &body] {
+    switch (encoding_) {
+      case ContentEncoding::kGzip:
+        return compression::gzip::Compress(body, config_.gzip_level);
+      case ContentEncoding::kZstd:
+        return compression::zstd::Compress(body, config_.zstd_level);
+    }
+    UINVARIANT(false, "Unexpected content encoding");
+  });
+  // Incompressible data, e.g. already compressed by the handler
+  if (compressed.size() >= body.size()) return;
+
+  stats_.IncrementCompressedResponses();
+  SetHeaders(response);
+  response.SetData(std::move(compressed));
+}
+
+bool ResponseCompressor::StartStream(HttpResponse& response) {
+  UASSERT(std::holds_alternative<std::monostate>(stream_compressor_));
+  if (!IsEligible(response)) return false;
+
+  switch (encoding_) {
+    case ContentEncoding::kGzip:
+      stream_compressor_.emplace<compression::gzip::Compressor>(
+          config_.gzip_level);
+      break;
+    case ContentEncoding::kZstd:
+      stream_compressor_.emplace<compression::zstd::Compressor>(
+          config_.zstd_level);
+      break;
+  }
+
+  stats_.IncrementCompressedResponses();
+  SetHeaders(response);
+  return true;
+}
+
+std::string ResponseCompressor::CompressChunk(std::string_view chunk) {
+  return Account(chunk.size(), [this, chunk] {
+    return std::visit(
+        [chunk](auto& compressor) -> std::string {
+          if constexpr (std::is_same_v<std::decay_t<decltype(compressor)>,
+                                       std::monostate>) {
+            UINVARIANT(false, "StartStream() was not called");
+          } else {
+            return compressor.Compress(chunk);
+          }
+        },
+        stream_compressor_);
+  });
+}
+
+std::string ResponseCompressor::FinishStream() {
+  return Account(0, [this] {
+    return std::visit(
+        [](auto& compressor) -> std::string {
+          if constexpr (std::is_same_v<std::decay_t<decltype(compressor)>,
+                                       std::monostate>) {
+            UINVARIANT(false, "StartStream() was not called");
+          } else {
+            return compressor.Finish();
+          }
+        },
+        stream_compressor_);
+  });
+}
+
+bool ResponseCompressor::IsEligible(const HttpResponse& response) const {
+  namespace headers = USERVER_NAMESPACE::http::headers;
+  return IsStatusWithBody(response.GetStatus()) &&
+         !response.HasHeader(headers::kContentEncoding) &&
+         // Content-Range refers to the uncompressed content
+         !response.HasHeader(headers::kContentRange) &&
+         IsCompressibleContentType(response.GetHeader(headers::kContentType),
+                                   config_.content_types);
+}
+
+void ResponseCompressor::SetHeaders(HttpResponse& response) const {
+  namespace headers = USERVER_NAMESPACE::http::headers;
+  response.SetContentEncoding(encoding_ == ContentEncoding::kGzip ? "gzip"
+                                                                  : "zstd");
+
+  const auto& vary = response.GetHeader(headers::kVary);
+  if (vary.empty()) {
+    response.SetHeader(headers::kVary, std::string{headers::kAcceptEncoding});
+  } else if (vary != "*") {
+    response.SetHeader(headers::kVary,
+                       vary + ", " + std::string{headers::kAcceptEncoding});
+  }
+}
+
+template <typename Func>
+std::string ResponseCompressor::Account(std::size_t input_size, Func&& func) {
+  // Compression is CPU bound, the thread CPU time excludes the preemption
+  const auto cpu_time_start = engine::impl::GetCurrentThreadCpuTime();
+  auto result = func();
+  const auto cpu_time =
+      engine::impl::GetCurrentThreadCpuTime() - cpu_time_start;
+
+  stats_.AccountCompression(
+      input_size, result.size(),
+      std::chrono::duration_cast<std::chrono::microseconds>(cpu_time));
+  return result;
+}
+
+}  // namespace server::http
+
+USERVER_NAMESPACE_END
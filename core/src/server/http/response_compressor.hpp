@@ -0,0 +1,78 @@
+#pragma once
+
+#include <optional>
+#include <string>
+#include <string_view>
+#include <variant>
+#include <vector>
+
+#include <compression/gzip.hpp>
+#include <userver/compression/zstd.hpp>
+#include <userver/server/handlers/handler_config.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace server::handlers {
+class HttpHandlerMethodStatistics;
+}  // namespace server::handlers
+
+namespace server::http {
+
+class HttpResponse;
+
+enum class ContentEncoding {
+  kGzip,
+  kZstd,
+};
+
+/// Picks the encoding with the highest quality value from the Accept-Encoding
+/// request header among the available ones, zstd wins the ties.
+std::optional<ContentEncoding> NegotiateContentEncoding(
+    std::string_view accept_encoding, bool is_gzip_available = true,
+    bool is_zstd_available = true);
+
+/// Whether the media type of the Content-Type header value matches any of the
+/// `content_types`, 'type/*' matches all the subtypes.
+bool IsCompressibleContentType(std::string_view content_type,
+                               const std::vector<std::string>& content_types);
+
+/// @brief Compresses the body of a single response with the negotiated
+/// encoding and accounts the work in the handler statistics.
+class ResponseCompressor final {
+ public:
+  ResponseCompressor(const handlers::ResponseCompressionConfig& config,
+                     ContentEncoding encoding,
+                     handlers::HttpHandlerMethodStatistics& stats);
+
+  /// Replaces the non-streamed body with the compressed one if the response
+  /// is eligible and becomes smaller.
+  void CompressBody(HttpResponse& response);
+
+  /// Sets the headers of the compressed streamed response and returns true if
+  /// the response is eligible, must be called at the end of headers.
+  bool StartStream(HttpResponse& response);
+
+  /// Compresses the next chunk of the streamed body, the result may be empty.
+  std::string CompressChunk(std::string_view chunk);
+
+  /// Returns the tail of the compressed streamed body.
+  std::string FinishStream();
+
+ private:
+  bool IsEligible(const HttpResponse& response) const;
+  void SetHeaders(HttpResponse& response) const;
+
+  template <typename Func>
+  std::string Account(std::size_t input_size, Func&& func);
+
+  const handlers::ResponseCompressionConfig& config_;
+  const ContentEncoding encoding_;
+  handlers::HttpHandlerMethodStatistics& stats_;
+  std::variant<std::monostate, compression::gzip::Compressor,
+               compression::zstd::Compressor>
+      stream_compressor_;
+};
+
+}  // namespace server::http
+
+USERVER_NAMESPACE_END
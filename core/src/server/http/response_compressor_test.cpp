@@ -0,0 +1,63 @@
+#include <server/http/response_compressor.hpp>
+
+#include <gtest/gtest.h>
+
+USERVER_NAMESPACE_BEGIN
+
+using server::http::ContentEncoding;
+using server::http::IsCompressibleContentType;
+using server::http::NegotiateContentEncoding;
+
+TEST(ResponseCompressor, NegotiateContentEncoding) {
+  EXPECT_EQ(NegotiateContentEncoding(""), std::nullopt);
+  EXPECT_EQ(NegotiateContentEncoding("identity"), std::nullopt);
+  EXPECT_EQ(NegotiateContentEncoding("br, deflate"), std::nullopt);
+
+  EXPECT_EQ(NegotiateContentEncoding("gzip"), ContentEncoding::kGzip);
+  EXPECT_EQ(NegotiateContentEncoding("GZip"), ContentEncoding::kGzip);
+  EXPECT_EQ(NegotiateContentEncoding("x-gzip"), ContentEncoding::kGzip);
+  EXPECT_EQ(NegotiateContentEncoding("zstd"), ContentEncoding::kZstd);
+  EXPECT_EQ(NegotiateContentEncoding("gzip, deflate, br, zstd"),
+            ContentEncoding::kZstd);
+  EXPECT_EQ(NegotiateContentEncoding("*"), ContentEncoding::kZstd);
+}
+
+TEST(ResponseCompressor, NegotiateContentEncodingQuality) {
+  EXPECT_EQ(NegotiateContentEncoding("zstd;q=0.5, gzip"),
+            ContentEncoding::kGzip);
+  EXPECT_EQ(NegotiateContentEncoding("zstd ; q=0.8 , gzip;q=0.3"),
+            ContentEncoding::kZstd);
+  EXPECT_EQ(NegotiateContentEncoding("zstd;q=0, gzip;q=0"), std::nullopt);
+  EXPECT_EQ(NegotiateContentEncoding("gzip;q=0, *"), ContentEncoding::kZstd);
+  EXPECT_EQ(NegotiateContentEncoding("zstd;q=0, *;q=0.1"),
+            ContentEncoding::kGzip);
+  EXPECT_EQ(NegotiateContentEncoding("*;q=0"), std::nullopt);
+  EXPECT_EQ(NegotiateContentEncoding("gzip;q=abc"), ContentEncoding::kGzip);
+}
+
+TEST(ResponseCompressor, NegotiateContentEncodingAvailable) {
+  EXPECT_EQ(NegotiateContentEncoding("zstd, gzip;q=0.1", true, false),
+            ContentEncoding::kGzip);
+  EXPECT_EQ(NegotiateContentEncoding("zstd", true, false), std::nullopt);
+  EXPECT_EQ(NegotiateContentEncoding("gzip, zstd;q=0.1", false, true),
+            ContentEncoding::kZstd);
+  EXPECT_EQ(NegotiateContentEncoding("*", false, false), std::nullopt);
+}
+
+TEST(ResponseCompressor, IsCompressibleContentType) {
+  const std::vector<std::string> types{"application/json", "text/*"};
+
+  EXPECT_TRUE(IsCompressibleContentType("application/json", types));
+  EXPECT_TRUE(IsCompressibleContentType("Application/JSON", types));
+  EXPECT_TRUE(
+      IsCompressibleContentType("application/json; charset=utf-8", types));
+  EXPECT_TRUE(IsCompressibleContentType("text/plain", types));
+  EXPECT_TRUE(IsCompressibleContentType("text/html;charset=utf-8", types));
+
+  EXPECT_FALSE(IsCompressibleContentType("", types));
+  EXPECT_FALSE(IsCompressibleContentType("image/png", types));
+  EXPECT_FALSE(IsCompressibleContentType("application/json-seq", types));
+  EXPECT_FALSE(IsCompressibleContentType("textual/plain", types));
+}
+
+USERVER_NAMESPACE_END
@@ -9,8 +9,6 @@ USERVER_NAMESPACE_BEGIN
 namespace server::http::impl {
 namespace {
 
-const std::string kAnySuffixMark{"*"};
-
 constexpr char kWildcardStart = '{';
 constexpr char kWildcardFinish = '}';
 
@@ -29,23 +27,9 @@ std::string ExtractWildcardName(const std::string& str) {
   return str.substr(1, str.size() - 2);
 }
 
-bool GetFromHandlerMethodIndex(const WildcardPathIndex::Node& node,
-                               HttpMethod method,
-                               const std::vector<std::string>& path,
-                               MatchRequestResult& match_result,
-                               bool limit_path_length) {
-  const auto& index_map = node.handler_method_index_map;
-  decltype(index_map.begin()) it;
-  if (limit_path_length) {
-    it = index_map.find(path.size());
-  } else {
-    it = index_map.upper_bound(path.size());
-    if (it == index_map.begin()) return false;
-    --it;
-  }
-  if (it == index_map.end()) return false;
-  const auto& handler_method_index = it->second;
-
+bool GetFromHandlerMethodIndex(const HandlerMethodIndex& handler_method_index,
+                               HttpMethod method, const PathSegments& path,
+                               MatchRequestResult& match_result) {
   const auto* handler_info_data =
       handler_method_index.GetHandlerInfoData(method);
   if (!handler_info_data) {
@@ -60,7 +44,8 @@ bool GetFromHandlerMethodIndex(const WildcardPathIndex::Node& node,
           "matched path from handler has length greater than path from "
           "request");
     match_result.args_from_path.emplace_back(
-        arg.name, arg.index == path.size() ? std::string{} : path[arg.index]);
+        arg.name, arg.index == path.size() ? std::string_view{}
+                                           : path[arg.index]);
   }
   match_result.status = MatchRequestResult::Status::kOk;
   return true;
@@ -108,8 +93,31 @@ void WildcardPathIndex::AddHandler(const handlers::HttpHandlerBase& handler,
 
 bool WildcardPathIndex::MatchRequest(HttpMethod method, const std::string& path,
                                      MatchRequestResult& match_result) const {
-  return MatchRequest(root_, method, SplitBySlash(path), path.size(),
-                      match_result);
+  const auto path_segments = SplitPathSegments(path);
+  return trie_.Match(
+      path_segments, [&](const HandlerMethodIndex& handler_method_index,
+                         std::optional<std::size_t> any_suffix_position) {
+        if (!GetFromHandlerMethodIndex(handler_method_index, method,
+                                       path_segments, match_result)) {
+          return false;
+        }
+        if (!any_suffix_position) {
+          match_result.matched_path_length = path.size();
+          return true;
+        }
+
+        // "/some/.../path/*"
+        const auto asterisk_pos = *any_suffix_position;
+        match_result.matched_path_length = asterisk_pos;
+        for (size_t i = 0; i < asterisk_pos; i++) {
+          match_result.matched_path_length += path_segments[i].size();
+        }
+        for (size_t i = asterisk_pos; i < path_segments.size(); i++) {
+          match_result.args_from_path.emplace_back(std::string{},
+                                                   path_segments[i]);
+        }
+        return true;
+      });
 }
 
 void WildcardPathIndex::AddHandler(const std::string& path,
@@ -142,56 +150,13 @@ void WildcardPathIndex::AddPath(const handlers::HttpHandlerBase& handler,
                                 std::vector<PathItem>&& fixed_path,
                                 std::vector<PathItem> wildcards) {
   size_t length = fixed_path.size() + wildcards.size();
-  Node* cur = &root_;
-  for (auto& path_item : std::move(fixed_path)) {
-    cur = &cur->next[path_item.index][std::move(path_item.name)];
+  std::vector<PathTrie<HandlerMethodIndex>::FixedSegment> fixed_segments;
+  fixed_segments.reserve(fixed_path.size());
+  for (auto& path_item : fixed_path) {
+    fixed_segments.push_back({path_item.index, std::move(path_item.name)});
   }
-  cur->handler_method_index_map[length].AddHandler(handler, task_processor,
-                                                   std::move(wildcards));
-}
-
-bool WildcardPathIndex::MatchRequest(const Node& node, HttpMethod method,
-                                     const std::vector<std::string>& path,
-                                     size_t path_string_length,
-                                     MatchRequestResult& match_result) const {
-  for (const auto& next_item : node.next) {
-    if (next_item.first >= path.size()) break;
-    auto it = next_item.second.find(path[next_item.first]);
-    if (it != next_item.second.end()) {
-      if (MatchRequest(it->second, method, path, path_string_length,
-                       match_result))
-        return true;
-    }
-  }
-
-  // check for match without '*'
-  if (GetFromHandlerMethodIndex(node, method, path, match_result, true)) {
-    match_result.matched_path_length = path_string_length;
-    return true;
-  }
-
-  // check "/some/.../path/*"
-  auto node_next_it = node.next.lower_bound(path.size());
-  while (node_next_it != node.next.begin()) {
-    --node_next_it;
-    auto it = node_next_it->second.find(kAnySuffixMark);
-    if (it != node_next_it->second.end()) {
-      if (GetFromHandlerMethodIndex(it->second, method, path, match_result,
-                                    false)) {
-        size_t asterisk_pos = node_next_it->first;
-        match_result.matched_path_length = asterisk_pos;
-        for (size_t i = 0; i < asterisk_pos; i++) {
-          match_result.matched_path_length += path[i].size();
-        }
-        for (size_t i = asterisk_pos; i < path.size(); i++) {
-          match_result.args_from_path.emplace_back(std::string{}, path[i]);
-        }
-        return true;
-      }
-    }
-  }
-
-  return false;
+  trie_.Emplace(std::move(fixed_segments), length)
+      .AddHandler(handler, task_processor, std::move(wildcards));
 }
 
 PathItem WildcardPathIndex::ExtractFixedPathItem(size_t index,
@@ -0,0 +1,65 @@
+#include <server/middlewares/compression.hpp>
+
+#include <optional>
+
+#include <server/handlers/http_handler_base_statistics.hpp>
+#include <server/http/response_compressor.hpp>
+#include <server/request/internal_request_context.hpp>
+
+#include <userver/http/common_headers.hpp>
+#include <userver/server/handlers/http_handler_base.hpp>
+#include <userver/server/http/http_request.hpp>
+#include <userver/server/request/request_context.hpp>
+#include <userver/tracing/scope_time.hpp>
+#include <userver/utils/fast_scope_guard.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace server::middlewares {
+
+Compression::Compression(const handlers::HttpHandlerBase& handler)
+    : config_{handler.GetConfig().response_compression}, handler_{handler} {}
+
+void Compression::HandleRequest(http::HttpRequest& request,
+                                request::RequestContext& context) const {
+  // The body of a response to HEAD is never sent, so there is nothing to
+  // compress, while the headers must stay the same as for GET
+  if (!config_.enabled || request.GetMethod() == http::HttpMethod::kHead) {
+    Next(request, context);
+    return;
+  }
+
+  const auto encoding = http::NegotiateContentEncoding(
+      request.GetHeader(USERVER_NAMESPACE::http::headers::kAcceptEncoding));
+  if (!encoding) {
+    Next(request, context);
+    return;
+  }
+
+  http::ResponseCompressor compressor{
+      config_, *encoding,
+      handler_.GetHandlerStatistics().ForMethod(request.GetMethod())};
+
+  // Streamed responses are compressed chunk by chunk by the
+  // http::ResponseBodyStream
+  auto& internal_context = context.GetInternalContext();
+  internal_context.SetResponseCompressor(&compressor);
+  {
+    const utils::FastScopeGuard compressor_reset_guard{
+        [&internal_context]() noexcept {
+          internal_context.SetResponseCompressor(nullptr);
+        }};
+    Next(request, context);
+  }
+
+  auto& response = request.GetHttpResponse();
+  if (!response.IsBodyStreamed()) {
+    const auto scope_time = tracing::ScopeTime::CreateOptionalScopeTime(
+        "http_compress_response_body");
+    compressor.CompressBody(response);
+  }
+}
+
+}  // namespace server::middlewares
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,30 @@
+#pragma once
+
+#include <userver/server/handlers/handler_config.hpp>
+#include <userver/server/middlewares/builtin.hpp>
+#include <userver/server/middlewares/http_middleware_base.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace server::middlewares {
+
+class Compression final : public HttpMiddlewareBase {
+ public:
+  static constexpr std::string_view kName = builtin::kCompression;
+
+  explicit Compression(const handlers::HttpHandlerBase&);
+
+ private:
+  void HandleRequest(http::HttpRequest& request,
+                     request::RequestContext& context) const override;
+
+  const handlers::ResponseCompressionConfig config_;
+
+  const handlers::HttpHandlerBase& handler_;
+};
+
+using CompressionFactory = SimpleHttpMiddlewareFactory<Compression>;
+
+}  // namespace server::middlewares
+
+USERVER_NAMESPACE_END
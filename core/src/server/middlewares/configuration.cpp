@@ -8,12 +8,15 @@
 
 #include <server/middlewares/auth.hpp>
 #include <server/middlewares/baggage.hpp>
+#include <server/middlewares/compression.hpp>
 #include <server/middlewares/deadline_propagation.hpp>
 #include <server/middlewares/decompression.hpp>
 #include <server/middlewares/exceptions_handling.hpp>
 #include <server/middlewares/handler_adapter.hpp>
 #include <server/middlewares/handler_metrics.hpp>
 #include <server/middlewares/rate_limit.hpp>
+#include <server/middlewares/request_coalescing.hpp>
+#include <server/middlewares/response_cache.hpp>
 #include <server/middlewares/tracing.hpp>
 
 USERVER_NAMESPACE_BEGIN
@@ -42,6 +45,12 @@ MiddlewaresList DefaultPipeline() {
       std::string{builtin::kBaggage},
       std::string{builtin::kAuth},
       std::string{builtin::kDecompression},
+      // Compresses the response body formatted by the middlewares below,
+      // including the error bodies
+      std::string{builtin::kCompression},
+      // Stores the uncompressed responses, goes above the exceptions handling
+      // to see the final status of the response
+      std::string{builtin::kResponseCache},
 
       // Transforms CustomHandlerException into response as specified by the
       // exception, transforms std::exception into Http500 without context.
@@ -49,6 +58,12 @@ MiddlewaresList DefaultPipeline() {
       // Middlewares that call HttpHandlerBase::HandleCustomHandlerException or
       // fill the response manually on error (which is faster) should go above.
       std::string{builtin::kExceptionsHandling},
+
+      // Shares the response of the handler between the concurrent requests.
+      // Goes below the compression, which depends on the Accept-Encoding of
+      // each request, and below the exceptions handling, so that a failed
+      // execution is not shared.
+      std::string{builtin::kRequestCoalescing},
   };
 }
 /// [Middlewares sample - default pipeline]
@@ -62,8 +77,11 @@ components::ComponentList DefaultMiddlewareComponents() {
       .Append<AuthFactory>()
       .Append<DeadlinePropagationFactory>()
       .Append<DecompressionFactory>()
+      .Append<CompressionFactory>()
       .Append<SetAcceptEncodingFactory>()
       .Append<ExceptionsHandlingFactory>()
+      .Append<RequestCoalescingFactory>()
+      .Append<ResponseCacheFactory>()
       .Append<UnknownExceptionsHandlingFactory>()
       .Append<testsuite::ExceptionsHandlingMiddlewareFactory>();
 }
@@ -1,5 +1,6 @@
 #include <server/middlewares/deadline_propagation.hpp>
 
+#include <server/handlers/http_handler_base_statistics.hpp>
 #include <server/handlers/http_server_settings.hpp>
 #include <server/request/internal_request_context.hpp>
 
@@ -37,8 +38,23 @@ std::string GetHandlerPath(const handlers::HttpHandlerBase& handler) {
 
 std::optional<std::chrono::milliseconds> ParseTimeout(
     const http::HttpRequest& request) {
-  const auto& timeout_ms_str = request.GetHeader(
-      USERVER_NAMESPACE::http::headers::kXYaTaxiClientTimeoutMs);
+  return ParseClientTimeout(request.GetHeader(
+      USERVER_NAMESPACE::http::headers::kXYaTaxiClientTimeoutMs));
+}
+
+void SetFormattedErrorResponse(
+    http::HttpResponse& http_response,
+    handlers::FormattedErrorData&& formatted_error_data) {
+  http_response.SetData(std::move(formatted_error_data.external_body));
+  if (formatted_error_data.content_type) {
+    http_response.SetContentType(*std::move(formatted_error_data.content_type));
+  }
+}
+
+}  // namespace
+
+std::optional<std::chrono::milliseconds> ParseClientTimeout(
+    const std::string& timeout_ms_str) {
   if (timeout_ms_str.empty()) return std::nullopt;
 
   LOG_DEBUG() << "Got client timeout_ms=" << timeout_ms_str;
@@ -61,17 +77,6 @@ std::optional<std::chrono::milliseconds> ParseTimeout(
   return timeout;
 }
 
-void SetFormattedErrorResponse(
-    http::HttpResponse& http_response,
-    handlers::FormattedErrorData&& formatted_error_data) {
-  http_response.SetData(std::move(formatted_error_data.external_body));
-  if (formatted_error_data.content_type) {
-    http_response.SetContentType(*std::move(formatted_error_data.content_type));
-  }
-}
-
-}  // namespace
-
 struct DeadlinePropagation::RequestScope final {
   RequestScope(request::impl::InternalRequestContext& context)
       : config_snapshot{context.GetConfigSnapshot()},
@@ -87,6 +92,8 @@ DeadlinePropagation::DeadlinePropagation(
     : handler_{handler},
       deadline_propagation_enabled_{
           handler_.GetConfig().deadline_propagation_enabled},
+      deadline_early_rejection_enabled_{
+          handler_.GetConfig().deadline_early_rejection_enabled},
       deadline_expired_status_code_{
           handler_.GetConfig().deadline_expired_status_code},
       path_{GetHandlerPath(handler_)} {}
@@ -176,11 +183,33 @@ void DeadlinePropagation::SetupInheritedDeadline(
     return;
   }
 
+  if (IsDeadlineBudgetInsufficient(request, deadline)) {
+    handler_.GetHandlerStatistics()
+        .ForMethod(request.GetMethod())
+        .IncrementRejectedByDeadlineBudget();
+    HandleDeadlineExpired(request, dp_scope,
+                          "Insufficient time budget (deadline propagation)");
+    return;
+  }
+
   if (config_snapshot[handlers::kCancelHandleRequestByDeadline]) {
     engine::current_task::SetDeadline(deadline);
   }
 }
 
+bool DeadlinePropagation::IsDeadlineBudgetInsufficient(
+    const http::HttpRequest& request, engine::Deadline deadline) const {
+  if (!deadline_early_rejection_enabled_) return false;
+
+  const auto typical_timing = handler_.GetHandlerStatistics()
+                                  .GetByMethod(request.GetMethod())
+                                  .GetTypicalTiming();
+  // Not enough requests to tell yet
+  if (typical_timing == std::chrono::milliseconds::zero()) return false;
+
+  return deadline.TimeLeftApprox() < typical_timing;
+}
+
 void DeadlinePropagation::HandleDeadlineExpired(
     const http::HttpRequest& request, RequestScope& dp_scope,
     std::string internal_message) const {
@@ -1,6 +1,11 @@
 #pragma once
 
+#include <chrono>
+#include <optional>
+#include <string>
+
 #include <userver/dynamic_config/source.hpp>
+#include <userver/engine/deadline.hpp>
 #include <userver/server/http/http_status.hpp>
 #include <userver/server/middlewares/builtin.hpp>
 #include <userver/server/middlewares/http_middleware_base.hpp>
@@ -13,6 +18,11 @@ struct TaskInheritedData;
 
 namespace server::middlewares {
 
+/// Parses the value of the client timeout header, returns std::nullopt if it
+/// is empty or invalid
+std::optional<std::chrono::milliseconds> ParseClientTimeout(
+    const std::string& timeout_ms_str);
+
 class DeadlinePropagation final : public HttpMiddlewareBase {
  public:
   static constexpr std::string_view kName = builtin::kDeadlinePropagation;
@@ -32,6 +42,9 @@ class DeadlinePropagation final : public HttpMiddlewareBase {
                               request::TaskInheritedData& inherited_data,
                               RequestScope& dp_scope) const;
 
+  bool IsDeadlineBudgetInsufficient(const http::HttpRequest& request,
+                                    engine::Deadline deadline) const;
+
   void HandleDeadlineExpired(const http::HttpRequest& request,
                              RequestScope& dp_scope,
                              std::string internal_message) const;
@@ -42,6 +55,7 @@ class DeadlinePropagation final : public HttpMiddlewareBase {
 
   const handlers::HttpHandlerBase& handler_;
   const bool deadline_propagation_enabled_;
+  const bool deadline_early_rejection_enabled_;
   const http::HttpStatus deadline_expired_status_code_;
   const std::string path_;
 };
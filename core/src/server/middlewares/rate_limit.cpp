@@ -1,11 +1,14 @@
 #include <server/middlewares/rate_limit.hpp>
 
+#include <chrono>
+
 #include <server/handlers/http_handler_base_statistics.hpp>
 
 #include <userver/http/common_headers.hpp>
 #include <userver/server/handlers/exceptions.hpp>
 #include <userver/server/handlers/http_handler_base.hpp>
 #include <userver/server/http/http_status.hpp>
+#include <userver/utils/fast_scope_guard.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
@@ -26,13 +29,31 @@ RateLimit::RateLimit(const handlers::HttpHandlerBase& handler)
     rate_limit_.SetRefillPolicy(
         {1, utils::TokenBucket::Duration{std::chrono::seconds(1)} / max_rps});
   }
+
+  const auto& adaptive_config = handler.GetConfig().adaptive_concurrency_limit;
+  if (adaptive_config.enabled) {
+    adaptive_concurrency_limiter_.emplace(adaptive_config);
+  }
 }
 
 void RateLimit::HandleRequest(http::HttpRequest& request,
                               request::RequestContext& context) const {
-  if (CheckRateLimit(request)) {
+  if (!CheckRateLimit(request)) return;
+
+  if (!adaptive_concurrency_limiter_) {
     Next(request, context);
+    return;
   }
+
+  if (!CheckAdaptiveConcurrencyLimit(request)) return;
+  // The latency of the whole rest of the pipeline drives the limit
+  const auto start_time = std::chrono::steady_clock::now();
+  const utils::FastScopeGuard release_guard{[this, start_time]() noexcept {
+    adaptive_concurrency_limiter_->Release(
+        std::chrono::duration_cast<std::chrono::microseconds>(
+            std::chrono::steady_clock::now() - start_time));
+  }};
+  Next(request, context);
 }
 
 bool RateLimit::CheckRateLimit(const http::HttpRequest& request) const {
@@ -76,6 +97,25 @@ bool RateLimit::CheckRateLimit(const http::HttpRequest& request) const {
   return true;
 }
 
+bool RateLimit::CheckAdaptiveConcurrencyLimit(
+    const http::HttpRequest& request) const {
+  UASSERT(adaptive_concurrency_limiter_);
+  if (adaptive_concurrency_limiter_->TryAcquire()) return true;
+
+  auto& http_response = request.GetHttpResponse();
+  auto log_reason = fmt::format("reached adaptive concurrency limit={}",
+                                adaptive_concurrency_limiter_->GetLimit());
+  SetThrottleReason(
+      http_response, std::move(log_reason),
+      std::string{
+          USERVER_NAMESPACE::http::headers::ratelimit_reason::kInFlight});
+
+  statistics_.ForMethod(request.GetMethod()).IncrementTooManyRequestsInFlight();
+
+  FailProcessingAndSetResponse(request);
+  return false;
+}
+
 void RateLimit::FailProcessingAndSetResponse(
     const http::HttpRequest& request) const {
   const auto ex = handlers::ExceptionWithCode<
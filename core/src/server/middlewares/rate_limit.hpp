@@ -2,6 +2,7 @@
 
 #include <optional>
 
+#include <server/handlers/adaptive_concurrency_limiter.hpp>
 #include <userver/server/middlewares/builtin.hpp>
 #include <userver/server/middlewares/http_middleware_base.hpp>
 #include <userver/utils/token_bucket.hpp>
@@ -26,6 +27,8 @@ class RateLimit final : public HttpMiddlewareBase {
 
   bool CheckRateLimit(const http::HttpRequest& request) const;
 
+  bool CheckAdaptiveConcurrencyLimit(const http::HttpRequest& request) const;
+
   void FailProcessingAndSetResponse(const http::HttpRequest& request) const;
 
   mutable utils::TokenBucket rate_limit_;
@@ -33,6 +36,8 @@ class RateLimit final : public HttpMiddlewareBase {
 
   std::optional<std::size_t> max_requests_per_second_;
   std::optional<std::size_t> max_requests_in_flight_;
+  mutable std::optional<handlers::AdaptiveConcurrencyLimiter>
+      adaptive_concurrency_limiter_;
 
   const handlers::HttpHandlerBase& handler_;
 };
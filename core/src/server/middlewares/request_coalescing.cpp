@@ -0,0 +1,181 @@
+#include <server/middlewares/request_coalescing.hpp>
+
+#include <algorithm>
+#include <mutex>
+#include <optional>
+#include <utility>
+#include <vector>
+
+#include <server/handlers/http_handler_base_statistics.hpp>
+
+#include <userver/engine/condition_variable.hpp>
+#include <userver/engine/task/cancel.hpp>
+#include <userver/server/handlers/http_handler_base.hpp>
+#include <userver/server/http/http_request.hpp>
+#include <userver/server/request/task_inherited_data.hpp>
+#include <userver/utils/fast_scope_guard.hpp>
+#include <userver/utils/str_icase.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace server::middlewares {
+
+namespace {
+
+struct SharedResponse final {
+  http::HttpStatus status{http::HttpStatus::kOk};
+  // Only the headers set by the rest of the pipeline, the ones set before it
+  // (e.g. tracing headers) are specific to each request
+  std::vector<std::pair<std::string, std::string>> headers;
+  std::shared_ptr<const std::string> body;
+};
+
+// Length prefixes keep the key unambiguous for any values
+void AppendKeyPart(std::string& key, std::string_view part) {
+  key += std::to_string(part.size());
+  key += ':';
+  key += part;
+}
+
+std::optional<SharedResponse> MakeSharedResponse(
+    http::HttpResponse& response,
+    const std::vector<std::string>& initial_headers) {
+  // Streamed bodies can be consumed only once, cookies are usually private
+  const auto cookie_names = response.GetCookieNames();
+  if (response.IsBodyStreamed() || cookie_names.begin() != cookie_names.end()) {
+    return std::nullopt;
+  }
+
+  SharedResponse shared;
+  shared.status = response.GetStatus();
+  for (const auto& name : response.GetHeaderNames()) {
+    const auto is_initial =
+        std::any_of(initial_headers.begin(), initial_headers.end(),
+                    [&name](const std::string& initial) {
+                      return utils::StrIcaseEqual{}(name, initial);
+                    });
+    if (!is_initial) {
+      shared.headers.emplace_back(name, response.GetHeader(name));
+    }
+  }
+  shared.body = std::make_shared<const std::string>(response.GetData());
+  // The leader sends the same buffer as the followers
+  response.SetSharedData(shared.body);
+  return shared;
+}
+
+}  // namespace
+
+struct RequestCoalescing::Flight final {
+  engine::Mutex mutex;
+  engine::ConditionVariable cv;
+  bool is_done{false};
+  // Empty if the leader failed or its response can not be shared
+  std::optional<SharedResponse> response;
+};
+
+RequestCoalescing::RequestCoalescing(const handlers::HttpHandlerBase& handler)
+    : config_{handler.GetConfig().request_coalescing}, handler_{handler} {}
+
+RequestCoalescing::~RequestCoalescing() = default;
+
+void RequestCoalescing::HandleRequest(http::HttpRequest& request,
+                                      request::RequestContext& context) const {
+  // Only the safe methods may share the result of a single execution
+  const auto method = request.GetMethod();
+  if (!config_.enabled ||
+      (method != http::HttpMethod::kGet && method != http::HttpMethod::kHead)) {
+    Next(request, context);
+    return;
+  }
+
+  auto key = MakeKey(request);
+  std::shared_ptr<Flight> flight;
+  bool is_leader = false;
+  {
+    const std::lock_guard lock{flights_mutex_};
+    auto& entry = flights_[key];
+    if (!entry) {
+      entry = std::make_shared<Flight>();
+      is_leader = true;
+    }
+    flight = entry;
+  }
+
+  if (is_leader) {
+    Lead(request, context, key, *flight);
+    return;
+  }
+
+  std::unique_lock lock{flight->mutex};
+  // On timeout the response is set by the deadline propagation, the
+  // cancelled request is not answered anyway
+  if (!flight->cv.WaitUntil(lock, request::GetTaskInheritedDeadline(),
+                            [&flight] { return flight->is_done; })) {
+    return;
+  }
+  lock.unlock();
+
+  if (!flight->response) {
+    Next(request, context);
+    return;
+  }
+
+  const auto& shared = *flight->response;
+  auto& response = request.GetHttpResponse();
+  response.SetStatus(shared.status);
+  for (const auto& [name, value] : shared.headers) {
+    response.SetHeader(name, value);
+  }
+  response.SetSharedData(shared.body);
+  handler_.GetHandlerStatistics()
+      .ForMethod(method)
+      .IncrementCoalescedRequests();
+}
+
+std::string RequestCoalescing::MakeKey(const http::HttpRequest& request) const {
+  std::string key;
+  AppendKeyPart(key, request.GetMethodStr());
+  AppendKeyPart(key, request.GetRequestPath());
+  for (const auto& arg : config_.args) {
+    AppendKeyPart(key, request.GetArg(arg));
+  }
+  for (const auto& header : config_.headers) {
+    AppendKeyPart(key, request.GetHeader(header));
+  }
+  return key;
+}
+
+void RequestCoalescing::Lead(http::HttpRequest& request,
+                             request::RequestContext& context,
+                             const std::string& key, Flight& flight) const {
+  auto& response = request.GetHttpResponse();
+  const auto initial_header_names = response.GetHeaderNames();
+  const std::vector<std::string> initial_headers{initial_header_names.begin(),
+                                                 initial_header_names.end()};
+
+  std::optional<SharedResponse> shared;
+  const utils::FastScopeGuard complete_guard{[&]() noexcept {
+    {
+      // The requests that arrive from now on start a new flight
+      const std::lock_guard lock{flights_mutex_};
+      flights_.erase(key);
+    }
+    {
+      const std::lock_guard lock{flight.mutex};
+      flight.is_done = true;
+      flight.response = std::move(shared);
+    }
+    flight.cv.NotifyAll();
+  }};
+
+  Next(request, context);
+  // A cancelled leader may have an incomplete response
+  if (!engine::current_task::ShouldCancel()) {
+    shared = MakeSharedResponse(response, initial_headers);
+  }
+}
+
+}  // namespace server::middlewares
+
+USERVER_NAMESPACE_END
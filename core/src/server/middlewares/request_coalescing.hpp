@@ -0,0 +1,49 @@
+#pragma once
+
+#include <memory>
+#include <string>
+#include <unordered_map>
+
+#include <userver/engine/mutex.hpp>
+#include <userver/server/handlers/handler_config.hpp>
+#include <userver/server/middlewares/builtin.hpp>
+#include <userver/server/middlewares/http_middleware_base.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace server::middlewares {
+
+/// Concurrent GET and HEAD requests with the same key share a single
+/// execution of the rest of the pipeline, the followers get a copy of the
+/// response of the first request.
+class RequestCoalescing final : public HttpMiddlewareBase {
+ public:
+  static constexpr std::string_view kName = builtin::kRequestCoalescing;
+
+  explicit RequestCoalescing(const handlers::HttpHandlerBase&);
+  ~RequestCoalescing() override;
+
+ private:
+  struct Flight;
+
+  void HandleRequest(http::HttpRequest& request,
+                     request::RequestContext& context) const override;
+
+  std::string MakeKey(const http::HttpRequest& request) const;
+
+  void Lead(http::HttpRequest& request, request::RequestContext& context,
+            const std::string& key, Flight& flight) const;
+
+  const handlers::RequestCoalescingConfig config_;
+
+  const handlers::HttpHandlerBase& handler_;
+
+  mutable engine::Mutex flights_mutex_;
+  mutable std::unordered_map<std::string, std::shared_ptr<Flight>> flights_;
+};
+
+using RequestCoalescingFactory = SimpleHttpMiddlewareFactory<RequestCoalescing>;
+
+}  // namespace server::middlewares
+
+USERVER_NAMESPACE_END
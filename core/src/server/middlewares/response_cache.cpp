@@ -0,0 +1,226 @@
+#include <server/middlewares/response_cache.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <utility>
+#include <vector>
+
+#include <server/handlers/http_handler_base_statistics.hpp>
+#include <server/http/cache_control.hpp>
+#include <server/http/entity_tag.hpp>
+
+#include <userver/crypto/hash.hpp>
+#include <userver/engine/task/cancel.hpp>
+#include <userver/http/common_headers.hpp>
+#include <userver/server/handlers/http_handler_base.hpp>
+#include <userver/server/http/http_request.hpp>
+#include <userver/utils/datetime.hpp>
+#include <userver/utils/str_icase.hpp>
+#include <userver/utils/text_light.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace server::middlewares {
+
+namespace {
+
+namespace headers = USERVER_NAMESPACE::http::headers;
+
+using Headers = std::vector<std::pair<std::string, std::string>>;
+
+std::string MakeKey(const http::HttpRequest& request) {
+  std::string key;
+  key.reserve(request.GetMethodStr().size() + 1 + request.GetUrl().size());
+  key += request.GetMethodStr();
+  key += ' ';
+  key += request.GetUrl();
+  return key;
+}
+
+// Returns false for 'Vary: *', the response then can not be reused
+bool GetVaryingHeaders(const http::HttpRequest& request,
+                       std::string_view vary, Headers& varying_headers) {
+  for (auto name : utils::text::SplitIntoStringViewVector(vary, ",")) {
+    while (!name.empty() && name.front() == ' ') name.remove_prefix(1);
+    while (!name.empty() && name.back() == ' ') name.remove_suffix(1);
+    if (name.empty()) continue;
+    if (name == "*") return false;
+    varying_headers.emplace_back(name, request.GetHeader(name));
+  }
+  return true;
+}
+
+}  // namespace
+
+struct ResponseCache::Entry final {
+  Entry(handlers::HttpHandlerMethodStatistics& stats, std::size_t size)
+      : stats(stats), size(size) {
+    stats.AddResponseCacheBytes(size);
+  }
+
+  Entry(const Entry&) = delete;
+  Entry& operator=(const Entry&) = delete;
+
+  // Entries are released by the evictions within the cache as well
+  ~Entry() { stats.SubtractResponseCacheBytes(size); }
+
+  bool IsMatching(const http::HttpRequest& request) const {
+    return std::all_of(varying_headers.begin(), varying_headers.end(),
+                       [&request](const auto& header) {
+                         return request.GetHeader(header.first) ==
+                                header.second;
+                       });
+  }
+
+  handlers::HttpHandlerMethodStatistics& stats;
+  const std::size_t size;
+
+  // The request headers listed in the Vary response header, with the values
+  // of the request that has produced the response
+  Headers varying_headers;
+  http::HttpStatus status{http::HttpStatus::kOk};
+  // The headers set by the rest of the pipeline only
+  Headers headers;
+  std::shared_ptr<const std::string> body;
+  std::string etag;
+  std::chrono::steady_clock::time_point stored_at;
+  std::chrono::steady_clock::time_point expires_at;
+};
+
+ResponseCache::ResponseCache(const handlers::HttpHandlerBase& handler)
+    : config_{handler.GetConfig().response_cache},
+      handler_{handler},
+      cache_{config_.ways, config_.way_size} {}
+
+ResponseCache::~ResponseCache() = default;
+
+void ResponseCache::HandleRequest(http::HttpRequest& request,
+                                  request::RequestContext& context) const {
+  // The responses to the authorized requests are private, RFC 9111, 3.5
+  const auto method = request.GetMethod();
+  if (!config_.enabled ||
+      (method != http::HttpMethod::kGet && method != http::HttpMethod::kHead) ||
+      request.HasHeader(headers::kAuthorization)) {
+    Next(request, context);
+    return;
+  }
+
+  auto& stats = handler_.GetHandlerStatistics().ForMethod(method);
+  const auto request_cache_control =
+      http::ParseCacheControl(request.GetHeader(headers::kCacheControl));
+  auto key = MakeKey(request);
+  auto& response = request.GetHttpResponse();
+
+  if (!request_cache_control.no_cache && !request_cache_control.no_store) {
+    const auto now = utils::datetime::SteadyNow();
+    const auto entry = cache_.Get(key, [now](const EntryPtr& entry) {
+      return now < entry->expires_at;
+    });
+    if (entry && (*entry)->IsMatching(request)) {
+      stats.IncrementResponseCacheHits();
+      const auto& cached = **entry;
+      response.SetStatus(cached.status);
+      for (const auto& [name, value] : cached.headers) {
+        response.SetHeader(name, value);
+      }
+      response.SetHeader(
+          headers::kAge,
+          std::to_string(std::chrono::duration_cast<std::chrono::seconds>(
+                             now - cached.stored_at)
+                             .count()));
+      if (http::IsEtagMatching(request.GetHeader(headers::kIfNoneMatch),
+                               cached.etag)) {
+        response.SetStatus(http::HttpStatus::kNotModified);
+        return;
+      }
+      response.SetSharedData(cached.body);
+      return;
+    }
+  }
+
+  stats.IncrementResponseCacheMisses();
+  const auto initial_header_names = response.GetHeaderNames();
+  const std::vector<std::string> initial_headers{initial_header_names.begin(),
+                                                 initial_header_names.end()};
+  Next(request, context);
+
+  // A cancelled request may have an incomplete response
+  if (request_cache_control.no_store || engine::current_task::ShouldCancel()) {
+    return;
+  }
+  auto entry = MakeEntry(request, initial_headers);
+  if (!entry) return;
+
+  if (http::IsEtagMatching(request.GetHeader(headers::kIfNoneMatch),
+                           entry->etag)) {
+    response.SetStatus(http::HttpStatus::kNotModified);
+    response.SetData({});
+  }
+  cache_.Put(key, std::move(entry));
+}
+
+ResponseCache::EntryPtr ResponseCache::MakeEntry(
+    const http::HttpRequest& request,
+    const std::vector<std::string>& initial_headers) const {
+  auto& response = request.GetHttpResponse();
+  const auto cookie_names = response.GetCookieNames();
+  if (response.GetStatus() != http::HttpStatus::kOk ||
+      response.IsBodyStreamed() ||
+      cookie_names.begin() != cookie_names.end() ||
+      response.GetData().size() > config_.max_entry_size) {
+    return {};
+  }
+
+  const auto lifetime =
+      http::ParseCacheControl(response.GetHeader(headers::kCacheControl))
+          .GetSharedFreshnessLifetime();
+  if (!lifetime) return {};
+
+  Headers varying_headers;
+  if (!GetVaryingHeaders(request, response.GetHeader(headers::kVary),
+                         varying_headers)) {
+    return {};
+  }
+
+  // Makes the conditional requests possible for any cached response
+  if (!response.HasHeader(headers::kETag)) {
+    response.SetHeader(headers::kETag,
+                       '"' + crypto::hash::Sha1(response.GetData()) + '"');
+  }
+
+  Headers cached_headers;
+  for (const auto& name : response.GetHeaderNames()) {
+    const auto is_initial =
+        std::any_of(initial_headers.begin(), initial_headers.end(),
+                    [&name](const std::string& initial) {
+                      return utils::StrIcaseEqual{}(name, initial);
+                    });
+    if (!is_initial) {
+      cached_headers.emplace_back(name, response.GetHeader(name));
+    }
+  }
+
+  auto body = std::make_shared<const std::string>(response.GetData());
+  // The response sends the same buffer as the following cache hits
+  response.SetSharedData(body);
+
+  std::size_t size = sizeof(Entry) + body->size() + request.GetUrl().size();
+  for (const auto* part : {&varying_headers, &cached_headers}) {
+    for (const auto& [name, value] : *part) size += name.size() + value.size();
+  }
+
+  auto entry = std::make_shared<Entry>(
+      handler_.GetHandlerStatistics().ForMethod(request.GetMethod()), size);
+  entry->varying_headers = std::move(varying_headers);
+  entry->status = response.GetStatus();
+  entry->headers = std::move(cached_headers);
+  entry->body = std::move(body);
+  entry->etag = response.GetHeader(headers::kETag);
+  entry->stored_at = utils::datetime::SteadyNow();
+  entry->expires_at = entry->stored_at + *lifetime;
+  return entry;
+}
+
+}  // namespace server::middlewares
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,46 @@
+#pragma once
+
+#include <memory>
+#include <string>
+
+#include <userver/cache/nway_lru_cache.hpp>
+#include <userver/server/handlers/handler_config.hpp>
+#include <userver/server/middlewares/builtin.hpp>
+#include <userver/server/middlewares/http_middleware_base.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace server::middlewares {
+
+/// Stores the responses to GET and HEAD requests for the time allowed by
+/// their Cache-Control header and serves them, including the conditional
+/// requests with If-None-Match, without running the rest of the pipeline.
+class ResponseCache final : public HttpMiddlewareBase {
+ public:
+  static constexpr std::string_view kName = builtin::kResponseCache;
+
+  explicit ResponseCache(const handlers::HttpHandlerBase&);
+  ~ResponseCache() override;
+
+ private:
+  struct Entry;
+  using EntryPtr = std::shared_ptr<const Entry>;
+
+  void HandleRequest(http::HttpRequest& request,
+                     request::RequestContext& context) const override;
+
+  EntryPtr MakeEntry(const http::HttpRequest& request,
+                     const std::vector<std::string>& initial_headers) const;
+
+  const handlers::ResponseCacheConfig config_;
+
+  const handlers::HttpHandlerBase& handler_;
+
+  mutable cache::NWayLRU<std::string, EntryPtr> cache_;
+};
+
+using ResponseCacheFactory = SimpleHttpMiddlewareFactory<ResponseCache>;
+
+}  // namespace server::middlewares
+
+USERVER_NAMESPACE_END
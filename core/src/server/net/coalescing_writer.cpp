@@ -0,0 +1,92 @@
+#include <server/net/coalescing_writer.hpp>
+
+#include <boost/container/small_vector.hpp>
+
+#include <userver/utils/fast_scope_guard.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace server::net {
+
+namespace {
+
+// Enough for the headers and the body of several responses
+constexpr std::size_t kInplaceIoData = 16;
+
+}  // namespace
+
+CoalescingWriter::CoalescingWriter(engine::io::RwBase& stream,
+                                   std::size_t max_buffered_size)
+    : stream_(stream), max_buffered_size_(max_buffered_size) {}
+
+bool CoalescingWriter::IsValid() const { return stream_.IsValid(); }
+
+bool CoalescingWriter::WaitReadable(engine::Deadline deadline) {
+  return stream_.WaitReadable(deadline);
+}
+
+std::size_t CoalescingWriter::ReadSome(void* buf, std::size_t len,
+                                       engine::Deadline deadline) {
+  return stream_.ReadSome(buf, len, deadline);
+}
+
+std::size_t CoalescingWriter::ReadAll(void* buf, std::size_t len,
+                                      engine::Deadline deadline) {
+  return stream_.ReadAll(buf, len, deadline);
+}
+
+bool CoalescingWriter::WaitWriteable(engine::Deadline deadline) {
+  return stream_.WaitWriteable(deadline);
+}
+
+std::size_t CoalescingWriter::WriteAll(const void* buf, std::size_t len,
+                                       engine::Deadline deadline) {
+  const engine::io::IoData io_data{buf, len};
+  return WriteAll(&io_data, 1, deadline);
+}
+
+std::size_t CoalescingWriter::WriteAll(
+    std::initializer_list<engine::io::IoData> list, engine::Deadline deadline) {
+  return WriteAll(list.begin(), list.size(), deadline);
+}
+
+std::size_t CoalescingWriter::WriteAll(const engine::io::IoData* list,
+                                       std::size_t list_size,
+                                       engine::Deadline deadline) {
+  std::size_t total_size = 0;
+  for (std::size_t i = 0; i < list_size; ++i) total_size += list[i].len;
+
+  if (buffer_.size() + total_size <= max_buffered_size_) {
+    if (buffer_.capacity() < max_buffered_size_) {
+      buffer_.reserve(max_buffered_size_);
+    }
+    for (std::size_t i = 0; i < list_size; ++i) {
+      buffer_.append(static_cast<const char*>(list[i].data), list[i].len);
+    }
+    return total_size;
+  }
+
+  // The buffered data goes first, in the same write
+  boost::container::small_vector<engine::io::IoData, kInplaceIoData> io_data;
+  const auto buffered_size = buffer_.size();
+  if (buffered_size != 0) io_data.push_back({buffer_.data(), buffered_size});
+  io_data.insert(io_data.end(), list, list + list_size);
+
+  // The data is not resent after an error
+  const utils::FastScopeGuard clear_guard{
+      [this]() noexcept { buffer_.clear(); }};
+  const auto sent = stream_.WriteAll(io_data.data(), io_data.size(), deadline);
+  return sent > buffered_size ? sent - buffered_size : 0;
+}
+
+void CoalescingWriter::Flush(engine::Deadline deadline) {
+  if (buffer_.empty()) return;
+  const utils::FastScopeGuard clear_guard{
+      [this]() noexcept { buffer_.clear(); }};
+  [[maybe_unused]] const auto sent =
+      stream_.WriteAll(buffer_.data(), buffer_.size(), deadline);
+}
+
+}  // namespace server::net
+
+USERVER_NAMESPACE_END
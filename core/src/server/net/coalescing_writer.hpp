@@ -0,0 +1,58 @@
+#pragma once
+
+#include <cstddef>
+#include <string>
+
+#include <userver/engine/io/common.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace server::net {
+
+/// @brief Stream that gathers the writes into a buffer and sends them to the
+/// underlying stream with a single vectored write.
+///
+/// Used to send the responses to pipelined requests together. A write that
+/// does not fit into the buffer is sent along with the buffered data right
+/// away, the rest is sent on Flush(). Reads are passed through.
+///
+/// As the writes are deferred, the write errors are reported by the call that
+/// actually sends the data, that may be a later write or Flush().
+class CoalescingWriter final : public engine::io::RwBase {
+ public:
+  CoalescingWriter(engine::io::RwBase& stream, std::size_t max_buffered_size);
+
+  CoalescingWriter(CoalescingWriter&&) = delete;
+  CoalescingWriter& operator=(CoalescingWriter&&) = delete;
+
+  bool IsValid() const override;
+  [[nodiscard]] bool WaitReadable(engine::Deadline deadline) override;
+  [[nodiscard]] std::size_t ReadSome(void* buf, std::size_t len,
+                                     engine::Deadline deadline) override;
+  [[nodiscard]] std::size_t ReadAll(void* buf, std::size_t len,
+                                    engine::Deadline deadline) override;
+
+  [[nodiscard]] bool WaitWriteable(engine::Deadline deadline) override;
+  [[nodiscard]] std::size_t WriteAll(const void* buf, std::size_t len,
+                                     engine::Deadline deadline) override;
+  [[nodiscard]] std::size_t WriteAll(
+      std::initializer_list<engine::io::IoData> list,
+      engine::Deadline deadline) override;
+  [[nodiscard]] std::size_t WriteAll(const engine::io::IoData* list,
+                                     std::size_t list_size,
+                                     engine::Deadline deadline) override;
+
+  /// Sends the buffered data, does nothing if there is none
+  void Flush(engine::Deadline deadline);
+
+  std::size_t GetBufferedSize() const noexcept { return buffer_.size(); }
+
+ private:
+  engine::io::RwBase& stream_;
+  const std::size_t max_buffered_size_;
+  std::string buffer_;
+};
+
+}  // namespace server::net
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,73 @@
+#include <server/net/coalescing_writer.hpp>
+
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+// Records each write, a vectored write is recorded as a single one
+class RecordingStream final : public engine::io::RwBase {
+ public:
+  bool IsValid() const override { return true; }
+  bool WaitReadable(engine::Deadline) override { return false; }
+  size_t ReadSome(void*, size_t, engine::Deadline) override { return 0; }
+  size_t ReadAll(void*, size_t, engine::Deadline) override { return 0; }
+  bool WaitWriteable(engine::Deadline) override { return true; }
+
+  size_t WriteAll(const void* buf, size_t len, engine::Deadline) override {
+    writes.emplace_back(static_cast<const char*>(buf), len);
+    return len;
+  }
+
+  size_t WriteAll(const engine::io::IoData* list, size_t list_size,
+                  engine::Deadline) override {
+    auto& write = writes.emplace_back();
+    for (size_t i = 0; i < list_size; ++i) {
+      write.append(static_cast<const char*>(list[i].data), list[i].len);
+    }
+    return write.size();
+  }
+
+  // NOLINTNEXTLINE(misc-non-private-member-variables-in-classes)
+  std::vector<std::string> writes;
+};
+
+}  // namespace
+
+TEST(CoalescingWriter, Coalesce) {
+  RecordingStream stream;
+  server::net::CoalescingWriter writer{stream, 1024};
+
+  EXPECT_EQ(writer.WriteAll("abc", 3, {}), 3);
+  EXPECT_EQ(writer.WriteAll({{"de", 2}, {"f", 1}}, {}), 3);
+  EXPECT_TRUE(stream.writes.empty());
+  EXPECT_EQ(writer.GetBufferedSize(), 6);
+
+  writer.Flush({});
+  EXPECT_EQ(stream.writes, std::vector<std::string>{"abcdef"});
+  EXPECT_EQ(writer.GetBufferedSize(), 0);
+
+  writer.Flush({});
+  EXPECT_EQ(stream.writes.size(), 1);
+}
+
+TEST(CoalescingWriter, Overflow) {
+  RecordingStream stream;
+  server::net::CoalescingWriter writer{stream, 4};
+
+  EXPECT_EQ(writer.WriteAll("abc", 3, {}), 3);
+  // Does not fit, sent right away together with the buffered data
+  EXPECT_EQ(writer.WriteAll({{"de", 2}, {"f", 1}}, {}), 3);
+  EXPECT_EQ(stream.writes, std::vector<std::string>{"abcdef"});
+  EXPECT_EQ(writer.GetBufferedSize(), 0);
+
+  EXPECT_EQ(writer.WriteAll("ghijk", 5, {}), 5);
+  EXPECT_EQ(stream.writes, (std::vector<std::string>{"abcdef", "ghijk"}));
+  EXPECT_EQ(writer.GetBufferedSize(), 0);
+}
+
+USERVER_NAMESPACE_END
@@ -1,15 +1,24 @@
 #include "connection.hpp"
 
+#include <algorithm>
 #include <array>
+#include <deque>
+#include <optional>
+#include <string_view>
 #include <system_error>
+#include <unordered_map>
+#include <utility>
 #include <vector>
 
+#include <server/http/http2_session.hpp>
 #include <server/http/request_handler_base.hpp>
 
 #include <userver/engine/async.hpp>
 #include <userver/engine/exception.hpp>
+#include <userver/engine/future.hpp>
 #include <userver/engine/io/exception.hpp>
 #include <userver/engine/io/tls_wrapper.hpp>
+#include <userver/engine/mutex.hpp>
 #include <userver/engine/task/cancel.hpp>
 #include <userver/engine/wait_any.hpp>
 #include <userver/logging/log.hpp>
@@ -21,6 +30,66 @@ USERVER_NAMESPACE_BEGIN
 
 namespace server::net {
 
+namespace {
+
+// Responses to pipelined requests are written together until they exceed this
+// size, larger responses are sent right away
+constexpr std::size_t kMaxCoalescedResponsesSize = 64 * 1024;
+
+struct Http2Stream final {
+  std::shared_ptr<request::RequestBase> request;
+  // Waits for the handler and provides the response to the connection
+  engine::TaskWithResult<void> task;
+};
+
+}  // namespace
+
+// Passes the responses from the stream tasks to the connection task, that
+// owns the HTTP/2 session and performs all the socket I/O
+class Connection::Http2Events final {
+ public:
+  enum class Type { kResponseReady, kBodyPart, kBodyEnd };
+
+  struct Event final {
+    std::int32_t stream_id{0};
+    Type type{Type::kResponseReady};
+    std::string body_part{};
+  };
+
+  void Push(Event&& event) {
+    const std::lock_guard lock{mutex_};
+    events_.push_back(std::move(event));
+    if (wakeup_) {
+      wakeup_->set_value();
+      wakeup_.reset();
+    }
+  }
+
+  std::vector<Event> PopAll() {
+    const std::lock_guard lock{mutex_};
+    return std::exchange(events_, {});
+  }
+
+  // The future becomes ready once there are events to pop
+  engine::Future<void> GetWakeup() {
+    engine::Promise<void> promise;
+    auto future = promise.get_future();
+
+    const std::lock_guard lock{mutex_};
+    if (events_.empty()) {
+      wakeup_.emplace(std::move(promise));
+    } else {
+      promise.set_value();
+    }
+    return future;
+  }
+
+ private:
+  engine::Mutex mutex_;
+  std::vector<Event> events_;
+  std::optional<engine::Promise<void>> wakeup_;
+};
+
 Connection::Connection(
     const ConnectionConfig& config,
     const request::HttpRequestConfig& handler_defaults_config,
@@ -40,6 +109,14 @@ Connection::Connection(
   LOG_DEBUG() << "Incoming connection from " << Getpeername() << ", fd "
               << Fd();
 
+  if (config_.zero_copy_send_threshold) {
+    // TLS encrypts into its own buffers, zero-copy only pays off for plain TCP
+    auto* socket = dynamic_cast<engine::io::Socket*>(peer_socket_.get());
+    if (socket) {
+      socket->SetZeroCopySendThreshold(config_.zero_copy_send_threshold);
+    }
+  }
+
   ++stats_->active_connections;
   ++stats_->connections_created;
 }
@@ -47,7 +124,11 @@ Connection::Connection(
 void Connection::Process() {
   LOG_TRACE() << "Starting socket listener for fd " << Fd();
 
-  ListenForRequests();
+  if (config_.http2_enabled && IsHttp2Connection()) {
+    ListenForRequestsHttp2();
+  } else {
+    ListenForRequests();
+  }
 
   Shutdown();
 }
@@ -85,6 +166,14 @@ void Connection::ListenForRequests() noexcept {
           pending_requests.push_back(std::move(request_ptr));
         },
         stats_->parser_stats, data_accounter_);
+    CoalescingWriter response_writer{*peer_socket_, kMaxCoalescedResponsesSize};
+
+    request_parser_ = &request_parser;
+    response_writer_ = &response_writer;
+    const utils::FastScopeGuard parser_guard{[this]() noexcept {
+      request_parser_ = nullptr;
+      response_writer_ = nullptr;
+    }};
 
     pending_data_.resize(config_.in_buffer_size);
     while (is_accepting_requests_) {
@@ -137,9 +226,7 @@ void Connection::ListenForRequests() noexcept {
       }
       pending_data_size_ = 0;
 
-      for (auto&& request : pending_requests) {
-        ProcessRequest(std::move(request));
-      }
+      ProcessPipelinedRequests(pending_requests);
       pending_requests.resize(0);
       if (should_stop_accepting_requests) is_accepting_requests_ = false;
     }
@@ -164,13 +251,56 @@ void Connection::ListenForRequests() noexcept {
   }
 }
 
-void Connection::ProcessRequest(
-    std::shared_ptr<request::RequestBase>&& request_ptr) {
-  if (request_ptr->IsFinal()) {
-    is_accepting_requests_ = false;
+void Connection::ProcessPipelinedRequests(
+    std::vector<std::shared_ptr<request::RequestBase>>& requests) {
+  struct StartedRequest final {
+    std::shared_ptr<request::RequestBase> request;
+    engine::TaskWithResult<void> task;
+  };
+
+  // The handlers of pipelined requests run concurrently, while the responses
+  // are sent in the order of the requests. Responses that are ready by the
+  // time the previous one is sent are coalesced into a single write.
+  const auto max_started =
+      std::max<std::size_t>(config_.requests_queue_size_threshold, 1);
+  std::deque<StartedRequest> started;
+  std::size_t next = 0;
+
+  // Receiving a streamed request body may append pipelined requests
+  while (next < requests.size() || !started.empty()) {
+    while (next < requests.size() && started.size() < max_started &&
+           !(request_parser_ &&
+             request_parser_->GetReceivingBodyStream(*requests[next]))) {
+      auto request = std::move(requests[next++]);
+      AcceptRequest(*request);
+      auto task = request_handler_.StartRequestTask(request);
+      started.push_back({std::move(request), std::move(task)});
+    }
+
+    if (started.empty()) {
+      // The request body is still being received from the socket, the
+      // request is processed alone
+      ProcessRequest(std::move(requests[next++]));
+      continue;
+    }
+
+    auto& [request, task] = started.front();
+    WaitForRequestTask(request, task);
+    const bool can_coalesce = started.size() > 1 &&
+                              started[1].task.IsFinished() &&
+                              !request->IsUpgradeWebsocket();
+    SendResponse(*request, can_coalesce);
+
+    if (request->IsUpgradeWebsocket()) {
+      request->DoUpgrade(std::move(peer_socket_), std::move(remote_address_));
+    }
+    started.pop_front();
   }
+}
 
-  stats_->active_request_count.Add(1);
+void Connection::ProcessRequest(
+    std::shared_ptr<request::RequestBase>&& request_ptr) {
+  AcceptRequest(*request_ptr);
 
   auto task = HandleQueueItem(request_ptr);
   SendResponse(*request_ptr);
@@ -179,6 +309,14 @@ void Connection::ProcessRequest(
     request_ptr->DoUpgrade(std::move(peer_socket_), std::move(remote_address_));
 }
 
+void Connection::AcceptRequest(const request::RequestBase& request) {
+  if (request.IsFinal()) {
+    is_accepting_requests_ = false;
+  }
+
+  stats_->active_request_count.Add(1);
+}
+
 bool Connection::ReadSome() {
   if (pending_data_size_ == pending_data_.size()) return true;
 
@@ -203,17 +341,23 @@ bool Connection::ReadSome() {
 engine::TaskWithResult<void> Connection::HandleQueueItem(
     const std::shared_ptr<request::RequestBase>& request) noexcept {
   auto request_task = request_handler_.StartRequestTask(request);
+  WaitForRequestTask(request, request_task);
+  return request_task;
+}
 
+void Connection::WaitForRequestTask(
+    const std::shared_ptr<request::RequestBase>& request,
+    engine::TaskWithResult<void>& request_task) noexcept {
   if (engine::current_task::IsCancelRequested()) {
-    // We could've packed all remaining requests into a vector and cancel them
-    // in parallel. But pipelining is almost never used so why bother.
     request_task.SyncCancel();
     LOG_DEBUG() << "Request processing interrupted";
     is_response_chain_valid_ = false;
-    return request_task;  // avoids throwing and catching exception down below
+    return;  // avoids throwing and catching exception down below
   }
 
   try {
+    ReceiveBodyStream(*request, request_task);
+
     auto& response = request->GetResponse();
     if (response.IsBodyStreamed()) {
       // TODO: wait for TCP connection closure too
@@ -267,17 +411,66 @@ engine::TaskWithResult<void> Connection::HandleQueueItem(
     LOG_WARNING() << "Request failed with unhandled exception: " << e;
     request->MarkAsInternalServerError();
   }
-  return request_task;
 }
 
-void Connection::SendResponse(request::RequestBase& request) {
+void Connection::ReceiveBodyStream(const request::RequestBase& request,
+                                   engine::TaskWithResult<void>& request_task) {
+  if (!request_parser_) return;
+
+  // Reading from the socket stops while the handler does not keep up, so the
+  // flow control is left to TCP
+  while (auto* body_stream = request_parser_->GetReceivingBodyStream(request)) {
+    if (request_task.IsFinished()) {
+      // The rest of the body is still parsed, but nobody is going to read it
+      body_stream->Discard();
+      return;
+    }
+
+    std::optional<std::size_t> ready;
+    if (body_stream->IsFull()) {
+      auto drained = body_stream->GetDrainedWakeup();
+      ready = engine::WaitAny(drained, request_task);
+    } else {
+      engine::io::ReadableBase& peer_read = *peer_socket_;
+      ready = engine::WaitAny(peer_read, request_task);
+      if (ready == 0) {
+        if (!ReadSome()) {
+          LOG_DEBUG() << "Cancelling request due to closed socket";
+          request_task.RequestCancel();
+          is_accepting_requests_ = false;
+          return;
+        }
+        if (!request_parser_->Parse(pending_data_.data(), pending_data_size_)) {
+          LOG_DEBUG() << "Malformed request from " << Getpeername()
+                      << " on fd " << Fd();
+          is_accepting_requests_ = false;
+        }
+        pending_data_size_ = 0;
+      }
+    }
+
+    if (!ready) {
+      throw engine::WaitInterruptedException(
+          engine::current_task::CancellationReason());
+    }
+  }
+}
+
+void Connection::SendResponse(request::RequestBase& request,
+                              bool can_coalesce) {
   auto& response = request.GetResponse();
   UASSERT(!response.IsSent());
   request.SetStartSendResponseTime();
   if (is_response_chain_valid_ && peer_socket_) {
     try {
-      // Might be a stream reading or a fully constructed response
-      response.SendResponse(*peer_socket_);
+      if (response_writer_ && can_coalesce && !response.IsBodyStreamed()) {
+        // Sent along with the next response
+        response.SendResponse(*response_writer_);
+      } else {
+        if (response_writer_) response_writer_->Flush({});
+        // Might be a stream reading or a fully constructed response
+        response.SendResponse(*peer_socket_);
+      }
     } catch (const engine::io::IoSystemError& ex) {
       // working with raw values because std::errc compares error_category
       // default_error_category() fixed only in GCC 9.1 (PR libstdc++/60555)
@@ -294,6 +487,10 @@ void Connection::SendResponse(request::RequestBase& request) {
   } else {
     response.SetSendFailed(std::chrono::steady_clock::now());
   }
+  FinishRequest(request);
+}
+
+void Connection::FinishRequest(request::RequestBase& request) {
   request.SetFinishSendResponseTime();
   stats_->active_request_count.Subtract(1);
   stats_->requests_processed_count.Add(1);
@@ -302,6 +499,227 @@ void Connection::SendResponse(request::RequestBase& request) {
                           request_handler_.LoggerAccessTskv(), peer_name_);
 }
 
+bool Connection::IsHttp2Connection() noexcept {
+  auto* tls_socket = dynamic_cast<engine::io::TlsWrapper*>(peer_socket_.get());
+  if (tls_socket && tls_socket->GetAlpnProtocol() == "h2") return true;
+
+  // HTTP/2 with prior knowledge. A valid HTTP/1.1 request never starts with
+  // the client connection preface.
+  constexpr auto kPreface = http::Http2Session::kClientPreface;
+  try {
+    pending_data_.resize(config_.in_buffer_size);
+    const auto deadline =
+        engine::Deadline::FromDuration(config_.keepalive_timeout);
+    while (pending_data_size_ < kPreface.size()) {
+      const auto received = peer_socket_->ReadSome(
+          pending_data_.data() + pending_data_size_,
+          pending_data_.size() - pending_data_size_, deadline);
+      if (!received) break;
+      pending_data_size_ += received;
+
+      const std::string_view data{pending_data_.data(), pending_data_size_};
+      if (kPreface.substr(0, data.size()) != data.substr(0, kPreface.size())) {
+        return false;
+      }
+    }
+  } catch (const std::exception& ex) {
+    LOG_DEBUG() << "Error while receiving from peer " << Getpeername()
+                << " on fd " << Fd() << ": " << ex;
+    is_accepting_requests_ = false;
+    return false;
+  }
+  return pending_data_size_ >= kPreface.size();
+}
+
+void Connection::ListenForRequestsHttp2() noexcept {
+  using RequestBasePtr = std::shared_ptr<request::RequestBase>;
+
+  // Must outlive the stream tasks
+  Http2Events events;
+  std::unordered_map<std::int32_t, Http2Stream> streams;
+
+  const auto finish_stream = [this, &streams](std::int32_t stream_id,
+                                              bool is_sent) {
+    const auto it = streams.find(stream_id);
+    if (it == streams.end()) return;
+
+    // Cancels the handler if it is still running
+    auto request = std::move(it->second.request);
+    streams.erase(it);
+    if (!is_sent) {
+      request->GetResponse().SetSendFailed(std::chrono::steady_clock::now());
+    }
+    FinishRequest(*request);
+  };
+
+  try {
+    std::vector<std::pair<std::int32_t, RequestBasePtr>> new_requests;
+    std::vector<std::pair<std::int32_t, bool>> closed_streams;
+
+    http::Http2Session session(
+        request_handler_.GetHandlerInfoIndex(), handler_defaults_config_,
+        config_.http2_max_concurrent_streams,
+        [&new_requests](std::int32_t stream_id, RequestBasePtr&& request_ptr) {
+          new_requests.emplace_back(stream_id, std::move(request_ptr));
+        },
+        [&closed_streams](std::int32_t stream_id, bool is_sent) {
+          closed_streams.emplace_back(stream_id, is_sent);
+        },
+        stats_->parser_stats, data_accounter_);
+
+    pending_data_.resize(config_.in_buffer_size);
+    while (true) {
+      if (pending_data_size_ &&
+          !session.Parse(pending_data_.data(), pending_data_size_)) {
+        LOG_DEBUG() << "Malformed HTTP/2 frames from " << Getpeername()
+                    << " on fd " << Fd();
+      }
+      pending_data_size_ = 0;
+
+      for (auto& [stream_id, request_ptr] : new_requests) {
+        stats_->active_request_count.Add(1);
+        auto& stream = streams[stream_id];
+        stream.request = request_ptr;
+        stream.task = engine::CriticalAsyncNoSpan(
+            [this, &events, stream_id, request_ptr = std::move(request_ptr)] {
+              ProcessHttp2Stream(events, stream_id, request_ptr);
+            });
+      }
+      new_requests.clear();
+
+      for (auto& event : events.PopAll()) {
+        switch (event.type) {
+          case Http2Events::Type::kResponseReady:
+            if (const auto it = streams.find(event.stream_id);
+                it != streams.end()) {
+              it->second.request->SetStartSendResponseTime();
+            }
+            session.SubmitResponse(event.stream_id);
+            break;
+          case Http2Events::Type::kBodyPart:
+            session.AppendBodyPart(event.stream_id,
+                                   std::move(event.body_part));
+            break;
+          case Http2Events::Type::kBodyEnd:
+            session.FinishBody(event.stream_id);
+            break;
+        }
+      }
+
+      for (auto output = session.GetPendingOutput(); !output.empty();
+           output = session.GetPendingOutput()) {
+        [[maybe_unused]] const auto sent =
+            peer_socket_->WriteAll(output.data(), output.size(), {});
+      }
+
+      // Streams are closed on parsing and on sending
+      if (!closed_streams.empty()) {
+        for (const auto& [stream_id, is_sent] : closed_streams) {
+          finish_stream(stream_id, is_sent);
+        }
+        closed_streams.clear();
+        continue;
+      }
+      if (!session.IsAlive()) break;
+
+      auto wakeup = events.GetWakeup();
+      engine::io::ReadableBase& peer_read = *peer_socket_;
+      const auto deadline =
+          streams.empty()
+              ? engine::Deadline::FromDuration(config_.keepalive_timeout)
+              : engine::Deadline{};
+      const auto ready = engine::WaitAnyUntil(deadline, peer_read, wakeup);
+      if (!ready) {
+        if (engine::current_task::ShouldCancel()) {
+          LOG_TRACE() << "HTTP/2 connection on fd " << Fd()
+                      << " is cancelled";
+        } else {
+          LOG_INFO() << "Closing idle connection on timeout";
+        }
+        break;
+      }
+      if (*ready != 0) continue;
+
+      try {
+        pending_data_size_ = peer_socket_->ReadSome(
+            pending_data_.data(), pending_data_.size(),
+            engine::Deadline::Passed());
+      } catch (const engine::io::IoTimeout&) {
+        // Read only a part of SSL Record, not a EOF
+        continue;
+      }
+      if (!pending_data_size_) {
+        LOG_TRACE() << "Peer " << Getpeername() << " on fd " << Fd()
+                    << " closed connection";
+        break;
+      }
+    }
+  } catch (const engine::io::IoCancelled&) {
+    LOG_TRACE()
+        << "engine::io::IoCancelled thrown in ListenForRequestsHttp2()";
+  } catch (const engine::io::IoSystemError& ex) {
+    auto log_level =
+        ex.Code().value() == static_cast<int>(std::errc::connection_reset)
+            ? logging::Level::kInfo
+            : logging::Level::kError;
+    LOG(log_level) << "I/O error while serving HTTP/2 peer " << Getpeername()
+                   << " on fd " << Fd() << ": " << ex;
+  } catch (const std::exception& ex) {
+    LOG_ERROR() << "Error while serving HTTP/2 peer " << Getpeername()
+                << " on fd " << Fd() << ": " << ex;
+  }
+
+  while (!streams.empty()) {
+    finish_stream(streams.begin()->first, false);
+  }
+}
+
+void Connection::ProcessHttp2Stream(
+    Http2Events& events, std::int32_t stream_id,
+    const std::shared_ptr<request::RequestBase>& request) noexcept {
+  auto request_task = request_handler_.StartRequestTask(request);
+  // NOLINTNEXTLINE(cppcoreguidelines-pro-type-static-cast-downcast)
+  auto& response = static_cast<http::HttpResponse&>(request->GetResponse());
+
+  try {
+    if (response.IsBodyStreamed()) {
+      if (!response.WaitForHeadersEnd()) return;
+    } else {
+      request_task.Get();
+    }
+  } catch (const engine::TaskCancelledException& e) {
+    auto reason = e.Reason();
+    auto lvl = reason == engine::TaskCancellationReason::kUserRequest
+                   ? logging::Level::kWarning
+                   : logging::Level::kError;
+    LOG_LIMITED(lvl) << "Handler task was cancelled with reason: "
+                     << ToString(reason);
+    if (!response.IsReady()) {
+      response.SetReady();
+      response.SetStatusServiceUnavailable();
+    }
+  } catch (const engine::WaitInterruptedException&) {
+    // The stream was reset or the connection is closing
+    return;
+  } catch (const std::exception& e) {
+    LOG_WARNING() << "Request failed with unhandled exception: " << e;
+    request->MarkAsInternalServerError();
+  }
+
+  try {
+    events.Push({stream_id, Http2Events::Type::kResponseReady});
+    if (http::Http2Session::HasStreamedBody(response)) {
+      std::string part;
+      while (http::Http2Session::PopStreamedBodyPart(response, part)) {
+        events.Push({stream_id, Http2Events::Type::kBodyPart, std::move(part)});
+      }
+      events.Push({stream_id, Http2Events::Type::kBodyEnd});
+    }
+  } catch (const std::exception& e) {
+    LOG_WARNING() << "Failed to pass the HTTP/2 response: " << e;
+  }
+}
+
 std::string Connection::Getpeername() const { return peer_name_; }
 
 }  // namespace server::net
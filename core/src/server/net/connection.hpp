@@ -1,10 +1,13 @@
 #pragma once
 
+#include <cstdint>
 #include <memory>
 #include <string>
+#include <vector>
 
 #include <server/http/http_request_parser.hpp>
 #include <server/http/request_handler_base.hpp>
+#include <server/net/coalescing_writer.hpp>
 #include <server/net/connection_config.hpp>
 #include <server/net/stats.hpp>
 #include <server/request/request_parser.hpp>
@@ -34,16 +37,32 @@ class Connection final {
   int Fd() const;
 
  private:
+  class Http2Events;
+
   void Shutdown() noexcept;
 
   bool IsRequestTasksEmpty() const noexcept;
 
   void ListenForRequests() noexcept;
+  void ProcessPipelinedRequests(
+      std::vector<std::shared_ptr<request::RequestBase>>& requests);
   void ProcessRequest(std::shared_ptr<request::RequestBase>&& request_ptr);
+  void AcceptRequest(const request::RequestBase& request);
+
+  bool IsHttp2Connection() noexcept;
+  void ListenForRequestsHttp2() noexcept;
+  void ProcessHttp2Stream(
+      Http2Events& events, std::int32_t stream_id,
+      const std::shared_ptr<request::RequestBase>& request) noexcept;
 
   engine::TaskWithResult<void> HandleQueueItem(
       const std::shared_ptr<request::RequestBase>& request) noexcept;
-  void SendResponse(request::RequestBase& request);
+  void WaitForRequestTask(const std::shared_ptr<request::RequestBase>& request,
+                          engine::TaskWithResult<void>& request_task) noexcept;
+  void ReceiveBodyStream(const request::RequestBase& request,
+                         engine::TaskWithResult<void>& request_task);
+  void SendResponse(request::RequestBase& request, bool can_coalesce = false);
+  void FinishRequest(request::RequestBase& request);
 
   std::string Getpeername() const;
 
@@ -59,6 +78,12 @@ class Connection final {
   engine::io::Sockaddr remote_address_;
   std::string peer_name_;
 
+  // Set while ListenForRequests() runs, feeds the streamed request bodies
+  http::HttpRequestParser* request_parser_{nullptr};
+  // Set while ListenForRequests() runs, gathers the responses to pipelined
+  // requests
+  CoalescingWriter* response_writer_{nullptr};
+
   std::vector<char> pending_data_{};
   size_t pending_data_size_{0};
 
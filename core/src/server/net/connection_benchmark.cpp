@@ -0,0 +1,111 @@
+#include <benchmark/benchmark.h>
+
+#include <array>
+#include <chrono>
+#include <string>
+#include <string_view>
+
+#include <server/handlers/http_handler_base_statistics.hpp>
+#include <server/http/http_request_impl.hpp>
+#include <server/http/request_handler_base.hpp>
+#include <server/net/connection.hpp>
+#include <server/net/listener_config.hpp>
+#include <userver/engine/async.hpp>
+#include <userver/engine/run_standalone.hpp>
+#include <userver/internal/net/net_listener.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+constexpr auto kDeadlineMaxTime = std::chrono::seconds{60};
+constexpr std::string_view kStatusLine = "HTTP/1.1 404 Not Found\r\n";
+
+class NoopRequestHandler final : public server::http::RequestHandlerBase {
+ public:
+  engine::TaskWithResult<void> StartRequestTask(
+      std::shared_ptr<server::request::RequestBase> request) const override {
+    auto& http_request = dynamic_cast<server::http::HttpRequestImpl&>(*request);
+    static server::handlers::HttpRequestStatistics statistics;
+    http_request.SetHttpHandlerStatistics(statistics);
+    return engine::AsyncNoSpan([] {});
+  }
+
+  const server::http::HandlerInfoIndex& GetHandlerInfoIndex() const override {
+    return handler_info_index_;
+  }
+
+  const logging::LoggerPtr& LoggerAccess() const noexcept override {
+    return no_logger_;
+  }
+  const logging::LoggerPtr& LoggerAccessTskv() const noexcept override {
+    return no_logger_;
+  }
+
+ private:
+  logging::LoggerPtr no_logger_;
+  server::http::HandlerInfoIndex handler_info_index_;
+};
+
+std::size_t CountResponses(std::string_view data) {
+  std::size_t count = 0;
+  for (auto pos = data.find(kStatusLine); pos != std::string_view::npos;
+       pos = data.find(kStatusLine, pos + 1)) {
+    ++count;
+  }
+  return count;
+}
+
+}  // namespace
+
+// A client sends state.range(0) pipelined requests at once and waits for all
+// the responses
+void connection_pipelining(benchmark::State& state) {
+  engine::RunStandalone(2, [&] {
+    const auto deadline = engine::Deadline::FromDuration(kDeadlineMaxTime);
+    server::net::ListenerConfig config;
+    config.handler_defaults = server::request::HttpRequestConfig{};
+    internal::net::TcpListener listener;
+    auto [peer, client] = listener.MakeSocketPair(deadline);
+    auto stats = std::make_shared<server::net::Stats>();
+    server::request::ResponseDataAccounter data_accounter;
+    NoopRequestHandler handler;
+
+    auto task = engine::AsyncNoSpan([&, &peer = peer] {
+      server::net::Connection connection(
+          config.connection_config, config.handler_defaults,
+          std::make_unique<engine::io::Socket>(std::move(peer)), {}, handler,
+          stats, data_accounter);
+      connection.Process();
+    });
+
+    const auto pipeline_size = static_cast<std::size_t>(state.range(0));
+    std::string requests;
+    for (std::size_t i = 0; i < pipeline_size; ++i) {
+      requests += "GET /ping HTTP/1.1\r\nHost: localhost\r\n\r\n";
+    }
+
+    std::string responses;
+    std::array<char, 16 * 1024> buffer{};
+    for ([[maybe_unused]] auto _ : state) {
+      [[maybe_unused]] const auto sent =
+          client.SendAll(requests.data(), requests.size(), deadline);
+      responses.clear();
+      while (CountResponses(responses) < pipeline_size) {
+        const auto received =
+            client.RecvSome(buffer.data(), buffer.size(), deadline);
+        if (!received) {
+          state.SkipWithError("Connection closed");
+          break;
+        }
+        responses.append(buffer.data(), received);
+      }
+    }
+    state.SetItemsProcessed(state.iterations() * pipeline_size);
+
+    task.SyncCancel();
+  });
+}
+BENCHMARK(connection_pipelining)->RangeMultiplier(4)->Range(1, 64);
+
+USERVER_NAMESPACE_END
@@ -20,6 +20,14 @@ ConnectionConfig Parse(const yaml_config::YamlConfig& value,
           config.keepalive_timeout);
   config.abort_check_delay = utils::StringToDuration(
       value["stream_close_check_delay"].As<std::string>("20ms"));
+  config.zero_copy_send_threshold =
+      value["zero_copy_send_threshold"].As<size_t>(
+          config.zero_copy_send_threshold);
+  config.http2_enabled =
+      value["http2_enabled"].As<bool>(config.http2_enabled);
+  config.http2_max_concurrent_streams =
+      value["http2_max_concurrent_streams"].As<std::uint32_t>(
+          config.http2_max_concurrent_streams);
 
   return config;
 }
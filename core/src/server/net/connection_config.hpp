@@ -1,5 +1,7 @@
 #pragma once
 
+#include <chrono>
+#include <cstdint>
 #include <memory>
 #include <string>
 
@@ -14,6 +16,9 @@ struct ConnectionConfig {
   size_t requests_queue_size_threshold = 100;
   std::chrono::seconds keepalive_timeout{10 * 60};
   std::chrono::milliseconds abort_check_delay{20};
+  size_t zero_copy_send_threshold = 0;
+  bool http2_enabled = false;
+  std::uint32_t http2_max_concurrent_streams = 100;
 };
 
 ConnectionConfig Parse(const yaml_config::YamlConfig& value,
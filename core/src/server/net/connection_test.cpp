@@ -1,5 +1,9 @@
 #include <server/net/connection.hpp>
 
+#include <array>
+#include <string>
+#include <string_view>
+
 #include <fmt/format.h>
 
 #include <server/handlers/http_handler_base_statistics.hpp>
@@ -9,6 +13,7 @@
 #include <userver/clients/http/client.hpp>
 #include <userver/engine/io/sockaddr.hpp>
 #include <userver/engine/sleep.hpp>
+#include <userver/internal/net/net_listener.hpp>
 
 #include <userver/utest/http_client.hpp>
 #include <userver/utest/utest.hpp>
@@ -274,6 +279,50 @@ UTEST(ServerNetConnection, KeepAlive) {
   EXPECT_EQ(handler.asyncs_finished, 2);
 }
 
+UTEST(ServerNetConnection, Http2PriorKnowledge) {
+  net::ListenerConfig config = CreateConfig();
+  config.connection_config.http2_enabled = true;
+  auto request_socket = net::CreateSocket(config);
+
+  auto http_client_ptr = utest::CreateHttpClient();
+  http_client_ptr->SetMaxHostConnections(1);
+  const auto create_request = [&] {
+    return http_client_ptr->CreateRequest()
+        .get(HttpConnectionUriFromSocket(request_socket))
+        .http_version(clients::http::HttpVersion::k2PriorKnowledge)
+        .retry(1)
+        .timeout(utest::kMaxTestWaitTime)
+        .async_perform();
+  };
+  auto request = create_request();
+
+  auto peer = request_socket.Accept(Deadline::FromDuration(kAcceptTimeout));
+  ASSERT_TRUE(peer.IsValid());
+  auto stats = std::make_shared<net::Stats>();
+  server::request::ResponseDataAccounter data_accounter;
+  TestHttprequestHandler handler;
+
+  auto task = engine::AsyncNoSpan([&] {
+    net::Connection connection(
+        config.connection_config, config.handler_defaults,
+        std::make_unique<engine::io::Socket>(std::move(peer)), {}, handler,
+        stats, data_accounter);
+
+    connection.Process();
+  });
+  EXPECT_EQ(request.Get()->status_code(), 404);
+  EXPECT_EQ(handler.asyncs_finished, 1);
+
+  // The next stream goes over the same connection
+  request = create_request();
+  EXPECT_EQ(request.Get()->status_code(), 404);
+  EXPECT_EQ(handler.asyncs_finished, 2);
+
+  task.RequestCancel();
+  task.WaitFor(utest::kMaxTestWaitTime);
+  EXPECT_TRUE(task.IsFinished());
+}
+
 UTEST(ServerNetConnection, CancelMultipleInFlight) {
   constexpr std::size_t kInFlightRequests = 10;
   constexpr std::size_t kMaxAttempts = 10;
@@ -323,4 +372,55 @@ UTEST(ServerNetConnection, CancelMultipleInFlight) {
   FAIL() << "Failed to simulate cancellation of multiple requests";
 }
 
+UTEST(ServerNetConnection, Pipelining) {
+  constexpr std::size_t kRequests = 20;
+  net::ListenerConfig config = CreateConfig();
+  internal::net::TcpListener listener;
+  auto [peer, client] = listener.MakeSocketPair(
+      Deadline::FromDuration(utest::kMaxTestWaitTime));
+  auto stats = std::make_shared<net::Stats>();
+  server::request::ResponseDataAccounter data_accounter;
+  TestHttprequestHandler handler;
+
+  auto task = engine::AsyncNoSpan([&, &peer = peer] {
+    net::Connection connection(
+        config.connection_config, config.handler_defaults,
+        std::make_unique<engine::io::Socket>(std::move(peer)), {}, handler,
+        stats, data_accounter);
+
+    connection.Process();
+  });
+
+  std::string requests;
+  for (std::size_t i = 0; i < kRequests; ++i) {
+    requests += "GET /" + std::to_string(i) + " HTTP/1.1\r\nHost: a\r\n\r\n";
+  }
+  const auto deadline = Deadline::FromDuration(utest::kMaxTestWaitTime);
+  ASSERT_EQ(client.SendAll(requests.data(), requests.size(), deadline),
+            requests.size());
+
+  // All the responses are received over the same connection
+  constexpr std::string_view kStatusLine = "HTTP/1.1 404 Not Found\r\n";
+  std::string responses;
+  std::size_t responses_count = 0;
+  while (responses_count < kRequests) {
+    std::array<char, 4096> buffer{};
+    const auto received =
+        client.RecvSome(buffer.data(), buffer.size(), deadline);
+    ASSERT_NE(received, 0);
+    responses.append(buffer.data(), received);
+    responses_count = 0;
+    for (auto pos = responses.find(kStatusLine); pos != std::string::npos;
+         pos = responses.find(kStatusLine, pos + 1)) {
+      ++responses_count;
+    }
+  }
+  EXPECT_EQ(responses_count, kRequests);
+  EXPECT_EQ(handler.asyncs_finished, kRequests);
+
+  task.RequestCancel();
+  task.WaitFor(utest::kMaxTestWaitTime);
+  EXPECT_TRUE(task.IsFinished());
+}
+
 USERVER_NAMESPACE_END
@@ -1,6 +1,15 @@
 #include "create_socket.hpp"
 
+#include <sys/socket.h>
+
+#ifdef __linux__
+#include <linux/filter.h>
+#endif
+
+#include <cerrno>
+#include <cstdint>
 #include <string>
+#include <system_error>
 
 #include <fmt/format.h>
 #include <boost/filesystem/operations.hpp>
@@ -8,7 +17,9 @@
 #include <userver/engine/io/socket.hpp>
 #include <userver/fs/blocking/read.hpp>
 #include <userver/fs/blocking/write.hpp>
+#include <userver/logging/log.hpp>
 #include <userver/net/blocking/get_addr_info.hpp>
+#include <userver/utils/assert.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
@@ -35,6 +46,39 @@ engine::io::Socket CreateUnixSocket(const std::string& path, int backlog) {
   return socket;
 }
 
+// Makes the kernel pass the connection to the socket of the SO_REUSEPORT
+// group with the index of the CPU that received it, modulo `shards`. The
+// sockets are indexed in the order of the Listen() calls, so the program is
+// attached to each of them after the Listen(): attaching replaces the program
+// of the whole group with the same one.
+void AttachCpuSteering(engine::io::Socket& socket, std::size_t shards) {
+  UASSERT(shards > 0);
+// MAC_COMPAT: no SO_ATTACH_REUSEPORT_CBPF outside of Linux
+#ifdef SO_ATTACH_REUSEPORT_CBPF
+  struct sock_filter code[] = {
+      {BPF_LD | BPF_W | BPF_ABS, 0, 0,
+       static_cast<std::uint32_t>(SKF_AD_OFF + SKF_AD_CPU)},
+      {BPF_ALU | BPF_MOD | BPF_K, 0, 0, static_cast<std::uint32_t>(shards)},
+      {BPF_RET | BPF_A, 0, 0, 0},
+  };
+  struct sock_fprog program {};
+  program.len = sizeof(code) / sizeof(code[0]);
+  program.filter = code;
+
+  if (::setsockopt(socket.Fd(), SOL_SOCKET, SO_ATTACH_REUSEPORT_CBPF,
+                   &program, sizeof(program)) == -1) {
+    const auto error = errno;
+    LOG_WARNING() << "Failed to attach CPU steering program to listener fd="
+                  << socket.Fd() << ", connections are distributed by hash: "
+                  << std::error_code{error, std::system_category()}.message();
+  }
+#else
+  (void)socket;
+  LOG_WARNING() << "shards_cpu_steering is not supported on this platform, "
+                   "connections are distributed by the kernel hash";
+#endif
+}
+
 engine::io::Socket CreateIpv6Socket(const std::string& address, uint16_t port,
                                     int backlog) {
   std::vector<engine::io::Sockaddr> addrs;
@@ -66,10 +110,16 @@ engine::io::Socket CreateIpv6Socket(const std::string& address, uint16_t port,
 }  // namespace
 
 engine::io::Socket CreateSocket(const ListenerConfig& config) {
-  if (config.unix_socket_path.empty())
-    return CreateIpv6Socket(config.address, config.port, config.backlog);
-  else
+  if (config.unix_socket_path.empty()) {
+    auto socket =
+        CreateIpv6Socket(config.address, config.port, config.backlog);
+    if (config.shards_cpu_steering) {
+      AttachCpuSteering(socket, config.shards.value_or(1));
+    }
+    return socket;
+  } else {
     return CreateUnixSocket(config.unix_socket_path, config.backlog);
+  }
 }
 
 }  // namespace server::net
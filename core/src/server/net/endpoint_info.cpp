@@ -6,7 +6,18 @@ namespace server::net {
 
 EndpointInfo::EndpointInfo(const ListenerConfig& listener_config,
                            http::HttpRequestHandler& request_handler)
-    : listener_config(listener_config), request_handler(request_handler) {}
+    : listener_config(listener_config), request_handler(request_handler) {
+  if (listener_config.tls) {
+    static const std::vector<std::string> kHttp2AlpnProtocols{"h2",
+                                                              "http/1.1"};
+    tls_context.emplace(listener_config.tls_cert,
+                        listener_config.tls_private_key,
+                        listener_config.tls_certificate_authorities,
+                        listener_config.connection_config.http2_enabled
+                            ? kHttp2AlpnProtocols
+                            : std::vector<std::string>{});
+  }
+}
 
 std::string EndpointInfo::GetDescription() const {
   if (listener_config.unix_socket_path.empty())
@@ -1,10 +1,12 @@
 #pragma once
 
 #include <atomic>
+#include <optional>
 
 #include <server/http/http_request_handler.hpp>
 #include <server/net/connection.hpp>
 #include <server/net/listener_config.hpp>
+#include <userver/engine/io/tls_wrapper.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
@@ -18,6 +20,8 @@ struct EndpointInfo {
   const ListenerConfig& listener_config;
   http::HttpRequestHandler& request_handler;
   Connection::Type connection_type{Connection::Type::kRequest};
+  // shared by all the listener shards, so that TLS sessions may be resumed
+  std::optional<engine::io::TlsServerContext> tls_context;
 
   std::atomic<size_t> connection_count{0};
 };
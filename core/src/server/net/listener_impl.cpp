@@ -64,6 +64,7 @@ StatsAggregation ListenerImpl::GetStats() const {
 
 void ListenerImpl::AcceptConnection(engine::io::Socket& request_socket) {
   auto peer_socket = request_socket.Accept({});
+  ++stats_->connections_accepted;
 
   const auto new_connection_count = ++endpoint_info_->connection_count;
   utils::FastScopeGuard guard{
@@ -100,12 +101,12 @@ void ListenerImpl::ProcessConnection(engine::io::Socket peer_socket) {
   LOG_TRACE() << "Creating connection for fd " << fd;
   std::unique_ptr<engine::io::RwBase> socket;
   auto remote_address = peer_socket.Getpeername();
-  if (endpoint_info_->listener_config.tls) {
-    const auto& config = endpoint_info_->listener_config;
-    socket = std::make_unique<engine::io::TlsWrapper>(
-        engine::io::TlsWrapper::StartTlsServer(
-            std::move(peer_socket), config.tls_cert, config.tls_private_key, {},
-            config.tls_certificate_authorities));
+  if (endpoint_info_->tls_context) {
+    auto tls_socket = engine::io::TlsWrapper::StartTlsServer(
+        std::move(peer_socket), *endpoint_info_->tls_context, {});
+    ++stats_->tls_handshakes;
+    if (tls_socket.IsSessionReused()) ++stats_->tls_sessions_resumed;
+    socket = std::make_unique<engine::io::TlsWrapper>(std::move(tls_socket));
   } else {
     socket = std::make_unique<engine::io::Socket>(std::move(peer_socket));
   }
@@ -34,6 +34,10 @@ struct Stats {
   std::atomic<size_t> active_connections{0};
   std::atomic<size_t> connections_created{0};
   std::atomic<size_t> connections_closed{0};
+  // including the ones dropped due to max_connections
+  std::atomic<size_t> connections_accepted{0};
+  std::atomic<size_t> tls_handshakes{0};
+  std::atomic<size_t> tls_sessions_resumed{0};
 
   // per connection
   ParserStats parser_stats;
@@ -48,6 +52,9 @@ struct StatsAggregation final {
       : active_connections{stats.active_connections.load()},
         connections_created{stats.connections_created.load()},
         connections_closed{stats.connections_closed.load()},
+        connections_accepted_per_shard{stats.connections_accepted.load()},
+        tls_handshakes{stats.tls_handshakes.load()},
+        tls_sessions_resumed{stats.tls_sessions_resumed.load()},
         parser_stats{stats.parser_stats},
         active_request_count{stats.active_request_count.NonNegativeRead()},
         requests_processed_count{stats.requests_processed_count.Read()} {}
@@ -56,6 +63,12 @@ struct StatsAggregation final {
     active_connections += other.active_connections;
     connections_created += other.connections_created;
     connections_closed += other.connections_closed;
+    connections_accepted_per_shard.insert(
+        connections_accepted_per_shard.end(),
+        other.connections_accepted_per_shard.begin(),
+        other.connections_accepted_per_shard.end());
+    tls_handshakes += other.tls_handshakes;
+    tls_sessions_resumed += other.tls_sessions_resumed;
 
     parser_stats += other.parser_stats;
     active_request_count += other.active_request_count;
@@ -67,6 +80,10 @@ struct StatsAggregation final {
   std::size_t active_connections{0};
   std::size_t connections_created{0};
   std::size_t connections_closed{0};
+  // per listener shard, in the order of aggregation
+  std::vector<std::size_t> connections_accepted_per_shard;
+  std::size_t tls_handshakes{0};
+  std::size_t tls_sessions_resumed{0};
 
   // per connection
   ParserStatsAggregation parser_stats;
@@ -50,6 +50,16 @@ DeadlinePropagationContext& InternalRequestContext::GetDPContext() {
   return dp_context_;
 }
 
+void InternalRequestContext::SetResponseCompressor(
+    http::ResponseCompressor* compressor) {
+  response_compressor_ = compressor;
+}
+
+http::ResponseCompressor* InternalRequestContext::GetResponseCompressor()
+    const {
+  return response_compressor_;
+}
+
 }  // namespace server::request::impl
 
 USERVER_NAMESPACE_END
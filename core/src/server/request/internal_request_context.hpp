@@ -8,6 +8,10 @@
 
 USERVER_NAMESPACE_BEGIN
 
+namespace server::http {
+class ResponseCompressor;
+}  // namespace server::http
+
 namespace server::request::impl {
 
 class DeadlinePropagationContext final {
@@ -35,9 +39,14 @@ class InternalRequestContext final {
 
   DeadlinePropagationContext& GetDPContext();
 
+  // Set by the compression middleware for the duration of the handler call
+  void SetResponseCompressor(http::ResponseCompressor* compressor);
+  http::ResponseCompressor* GetResponseCompressor() const;
+
  private:
   std::optional<dynamic_config::Snapshot> config_snapshot_;
   DeadlinePropagationContext dp_context_{};
+  http::ResponseCompressor* response_compressor_{nullptr};
 };
 
 }  // namespace server::request::impl
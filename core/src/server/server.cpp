@@ -3,9 +3,11 @@
 #include <atomic>
 #include <shared_mutex>
 #include <stdexcept>
+#include <string>
 
 #include <userver/logging/log.hpp>
 #include <userver/utils/assert.hpp>
+#include <userver/utils/statistics/rate.hpp>
 
 #include <engine/ev/thread_pool.hpp>
 #include <engine/task/task_processor.hpp>
@@ -58,13 +60,15 @@ void PortInfo::Init(const ServerConfig& config,
                            config.logger_access_tskv, is_monitor,
                            config.server_name);
 
-  endpoint_info_ =
-      std::make_shared<net::EndpointInfo>(listener_config, *request_handler_);
-
   const auto& event_thread_pool = task_processor.EventThreadPool();
   size_t listener_shards = listener_config.shards ? *listener_config.shards
                                                   : event_thread_pool.GetSize();
 
+  auto resolved_listener_config = listener_config;
+  resolved_listener_config.shards = listener_shards;
+  endpoint_info_ = std::make_shared<net::EndpointInfo>(
+      std::move(resolved_listener_config), *request_handler_);
+
   listeners_.reserve(listener_shards);
   while (listener_shards--) {
     listeners_.emplace_back(endpoint_info_, task_processor, data_accounter_);
@@ -351,6 +355,20 @@ void Server::WriteMonitorData(utils::statistics::Writer& writer) const {
     conn_stats["active"] = server_stats.active_connections;
     conn_stats["opened"] = server_stats.connections_created;
     conn_stats["closed"] = server_stats.connections_closed;
+
+    const auto& accepted = server_stats.connections_accepted_per_shard;
+    for (std::size_t i = 0; i < accepted.size(); ++i) {
+      conn_stats["accepted"].ValueWithLabels(
+          utils::statistics::Rate{accepted[i]},
+          {"listener_shard", std::to_string(i)});
+    }
+  }
+
+  if (auto tls_stats = writer["tls"]) {
+    tls_stats["handshakes"] =
+        utils::statistics::Rate{server_stats.tls_handshakes};
+    tls_stats["resumed"] =
+        utils::statistics::Rate{server_stats.tls_sessions_resumed};
   }
 
   if (auto request_stats = writer["requests"]) {
@@ -0,0 +1,87 @@
+#include <userver/server/websocket/broadcast_group.hpp>
+
+#include <mutex>
+
+#include <userver/engine/io/exception.hpp>
+#include <userver/logging/log.hpp>
+#include <userver/utils/assert.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace server::websocket {
+
+BroadcastGroup::BroadcastGroup() : BroadcastGroup(Options{}) {}
+
+BroadcastGroup::BroadcastGroup(Options options) : options_(options) {}
+
+BroadcastGroup::~BroadcastGroup() {
+  {
+    const std::lock_guard lock(mutex_);
+    members_.clear();
+  }
+  tasks_.CancelAndWait();
+}
+
+void BroadcastGroup::Add(std::shared_ptr<WebSocketConnection> connection) {
+  UASSERT(connection);
+  const std::lock_guard lock(mutex_);
+  if (members_.count(connection.get())) return;
+
+  auto queue = Queue::Create(options_.max_queued_messages);
+  tasks_.AsyncDetach(
+      "ws_broadcast_sender",
+      [connection, consumer = queue->GetConsumer()] {
+        PreparedMessage message;
+        try {
+          while (consumer.Pop(message)) {
+            connection->SendPrepared(message);
+          }
+        } catch (const engine::io::IoException& e) {
+          LOG_DEBUG() << "Failed to send a broadcast message: " << e;
+        }
+      });
+
+  auto* const key = connection.get();
+  members_.emplace(key, Member{std::move(connection), queue->GetProducer()});
+}
+
+void BroadcastGroup::Remove(const WebSocketConnection& connection) {
+  const std::lock_guard lock(mutex_);
+  members_.erase(&connection);
+}
+
+std::size_t BroadcastGroup::Broadcast(const Message& message) {
+  return Broadcast(PreparedMessage{message, options_.fragment_size});
+}
+
+std::size_t BroadcastGroup::Broadcast(const PreparedMessage& message) {
+  const std::lock_guard lock(mutex_);
+  std::size_t queued = 0;
+  for (auto it = members_.begin(); it != members_.end();) {
+    if (it->second.producer.PushNoblock(PreparedMessage{message})) {
+      ++queued;
+      ++it;
+    } else {
+      // Either the member is too slow or its connection is gone
+      LOG_INFO() << "Evicting websocket connection "
+                 << it->second.connection->RemoteAddr().PrimaryAddressString()
+                 << " from the broadcast group";
+      ++evicted_count_;
+      it = members_.erase(it);
+    }
+  }
+  return queued;
+}
+
+std::size_t BroadcastGroup::GetSize() const {
+  const std::lock_guard lock(mutex_);
+  return members_.size();
+}
+
+std::size_t BroadcastGroup::GetEvictedCount() const noexcept {
+  return evicted_count_.load();
+}
+
+}  // namespace server::websocket
+
+USERVER_NAMESPACE_END
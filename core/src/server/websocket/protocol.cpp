@@ -40,13 +40,17 @@ union Mask32 {
 };
 
 void XorMaskInplace(uint8_t* dest, size_t len, Mask32 mask) {
-  auto* dest32 = reinterpret_cast<uint32_t*>(dest);
-  while (len >= sizeof(uint32_t)) {
-    *(dest32++) ^= mask.mask32;
-    len -= sizeof(uint32_t);
+  // both halves hold the mask in the memory order, regardless of endianness
+  const uint64_t mask64 = (uint64_t{mask.mask32} << 32) | mask.mask32;
+  while (len >= sizeof(uint64_t)) {
+    uint64_t chunk = 0;
+    std::memcpy(&chunk, dest, sizeof(chunk));
+    chunk ^= mask64;
+    std::memcpy(dest, &chunk, sizeof(chunk));
+    dest += sizeof(uint64_t);
+    len -= sizeof(uint64_t);
   }
-  auto* dest8 = reinterpret_cast<uint8_t*>(dest32);
-  for (unsigned i = 0; i < len; ++i) *(dest8++) ^= mask.mask8[i];
+  for (unsigned i = 0; i < len; ++i) *(dest++) ^= mask.mask8[i];
 }
 
 template <class T, class V>
@@ -200,9 +204,12 @@ CloseStatus ReadWSFrame(FrameParserState& frame, engine::io::ReadableBase& io,
                 {});
     if (engine::current_task::ShouldCancel()) return CloseStatus::kGoingAway;
 
+    // only the current frame is masked, previous fragments are already
+    // unmasked
     if (mask.mask32)
-      XorMaskInplace(reinterpret_cast<uint8_t*>(frame.payload->data()),
-                     frame.payload->size(), mask);
+      XorMaskInplace(
+          reinterpret_cast<uint8_t*>(frame.payload->data() + newPayloadOffset),
+          payload_len, mask);
   }
   char opcode = hdr.bits.opcode;
   char fin = hdr.bits.fin;
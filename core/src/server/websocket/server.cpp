@@ -1,5 +1,8 @@
 #include <userver/server/websocket/server.hpp>
 
+#include <algorithm>
+#include <vector>
+
 #include <userver/components/component.hpp>
 #include <userver/engine/mutex.hpp>
 #include <userver/logging/log.hpp>
@@ -25,12 +28,102 @@ inline void SendExactly(engine::io::WritableBase& writable,
 
 Message CloseMessage(CloseStatus status) { return {{}, status, false}; }
 
+// Both Socket (writev) and TlsWrapper (record coalescing) write a list of
+// buffers at once. Linux guarantees IOV_MAX of at least 1024.
+constexpr std::size_t kMaxIoDataPerWrite = 1024;
+
+using FrameHeader =
+    boost::container::small_vector<char, impl::kMaxFrameHeaderSize>;
+
+// Accumulates frames to write them to the socket in a single batch
+class FrameBatch final {
+ public:
+  void AddFrame(FrameHeader&& header, utils::span<const std::byte> payload) {
+    headers_.push_back(std::move(header));
+    payloads_.push_back(payload);
+  }
+
+  void AddDataFrames(utils::span<const std::byte> data, bool is_text,
+                     unsigned fragment_size) {
+    auto continuation = impl::frames::Continuation::kNo;
+    while (data.size() > fragment_size && fragment_size > 0) {
+      const auto fragment = data.first(fragment_size);
+      AddFrame(impl::frames::DataFrameHeader(fragment, is_text, continuation,
+                                             impl::frames::Final::kNo),
+               fragment);
+      continuation = impl::frames::Continuation::kYes;
+      data = data.last(data.size() - fragment_size);
+    }
+    AddFrame(impl::frames::DataFrameHeader(data, is_text, continuation,
+                                           impl::frames::Final::kYes),
+             data);
+  }
+
+  std::string Serialize() const {
+    std::string result;
+    std::size_t total_size = 0;
+    for (std::size_t i = 0; i < headers_.size(); ++i) {
+      total_size += headers_[i].size() + payloads_[i].size();
+    }
+    result.reserve(total_size);
+    for (std::size_t i = 0; i < headers_.size(); ++i) {
+      result.append(headers_[i].data(), headers_[i].size());
+      result.append(reinterpret_cast<const char*>(payloads_[i].data()),
+                    payloads_[i].size());
+    }
+    return result;
+  }
+
+  void Write(engine::io::WritableBase& writable) const {
+    // headers_ are not modified anymore, so the pointers stay valid
+    std::vector<engine::io::IoData> io_data;
+    io_data.reserve(headers_.size() * 2);
+    std::size_t total_size = 0;
+    for (std::size_t i = 0; i < headers_.size(); ++i) {
+      io_data.push_back({headers_[i].data(), headers_[i].size()});
+      total_size += headers_[i].size();
+      if (!payloads_[i].empty()) {
+        io_data.push_back({payloads_[i].data(), payloads_[i].size()});
+        total_size += payloads_[i].size();
+      }
+    }
+
+    std::size_t written = 0;
+    for (std::size_t pos = 0; pos < io_data.size(); pos += kMaxIoDataPerWrite) {
+      written += writable.WriteAll(
+          io_data.data() + pos,
+          std::min(kMaxIoDataPerWrite, io_data.size() - pos), {});
+    }
+    if (written != total_size)
+      throw(engine::io::IoException() << "Socket closed during transfer");
+  }
+
+ private:
+  std::vector<FrameHeader> headers_;
+  std::vector<utils::span<const std::byte>> payloads_;
+};
+
 utils::span<const std::byte> MakeBinarySpan(utils::span<const char> span) {
   return utils::as_bytes(span);
 }
 
 }  // namespace
 
+PreparedMessage::PreparedMessage(const Message& message,
+                                 unsigned fragment_size)
+    : payload_size_(message.data.size()) {
+  FrameBatch batch;
+  if (message.close_status.has_value()) {
+    const auto close_frame = impl::frames::CloseFrame(
+        static_cast<int>(message.close_status.value()));
+    batch.AddFrame(FrameHeader(close_frame.begin(), close_frame.end()), {});
+  } else {
+    batch.AddDataFrames(MakeBinarySpan(message.data), message.is_text,
+                        fragment_size);
+  }
+  frames_ = std::make_shared<const std::string>(batch.Serialize());
+}
+
 Config Parse(const yaml_config::YamlConfig& config,
              formats::parse::To<Config>) {
   return {
@@ -92,24 +185,12 @@ class WebSocketConnectionImpl final : public WebSocketConnection {
           static_cast<int>(message.close_status.value()));
       SendExactly(*io, close_frame, {});
     } else if (!message.data.empty()) {
-      utils::span<const std::byte> data_to_send{message.data};
-      auto continuation = impl::frames::Continuation::kNo;
-      while (data_to_send.size() > config.fragment_size &&
-             config.fragment_size > 0) {
-        const auto data_frame_header = impl::frames::DataFrameHeader(
-            data_to_send.first(config.fragment_size),
-            message.opcode == impl::WSOpcodes::kText, continuation,
-            impl::frames::Final::kNo);
-        SendExactly(*io, data_frame_header,
-                    data_to_send.first(config.fragment_size));
-        continuation = impl::frames::Continuation::kYes;
-        data_to_send =
-            data_to_send.last(data_to_send.size() - config.fragment_size);
-      }
-      const auto data_frame_header = impl::frames::DataFrameHeader(
-          data_to_send, message.opcode == impl::WSOpcodes::kText, continuation,
-          impl::frames::Final::kYes);
-      SendExactly(*io, data_frame_header, data_to_send);
+      // all the fragments of a message go in a single write
+      FrameBatch batch;
+      batch.AddDataFrames(message.data,
+                          message.opcode == impl::WSOpcodes::kText,
+                          config.fragment_size);
+      batch.Write(*io);
     }
   }
 
@@ -121,6 +202,42 @@ class WebSocketConnectionImpl final : public WebSocketConnection {
     SendExtended(mext);
   }
 
+  void SendMany(utils::span<const Message> messages) override {
+    FrameBatch batch;
+    for (const auto& message : messages) {
+      if (message.close_status.has_value()) {
+        const auto close_frame = impl::frames::CloseFrame(
+            static_cast<int>(message.close_status.value()));
+        batch.AddFrame(FrameHeader(close_frame.begin(), close_frame.end()),
+                       {});
+      } else if (!message.data.empty()) {
+        batch.AddDataFrames(MakeBinarySpan(message.data), message.is_text,
+                            config.fragment_size);
+      } else {
+        continue;
+      }
+      stats_.msg_sent++;
+      stats_.bytes_sent += message.data.size();
+    }
+
+    const std::unique_lock lock(write_mutex_);
+    LOG_TRACE() << "Write " << messages.size() << " messages";
+    batch.Write(*io);
+  }
+
+  void SendPrepared(const PreparedMessage& message) override {
+    if (!message.frames_) return;
+    stats_.msg_sent++;
+    stats_.bytes_sent += message.GetPayloadSize();
+
+    const std::unique_lock lock(write_mutex_);
+    LOG_TRACE() << "Write prepared message " << message.GetPayloadSize()
+                << " bytes";
+    const auto& frames = *message.frames_;
+    if (io->WriteAll(frames.data(), frames.size(), {}) != frames.size())
+      throw(engine::io::IoException() << "Socket closed during transfer");
+  }
+
   void SendText(std::string_view message) override {
     MessageExtended mext{MakeBinarySpan(message), impl::WSOpcodes::kText, {}};
     SendExtended(mext);
@@ -3,6 +3,7 @@
 #include <userver/components/component.hpp>
 #include <userver/logging/component.hpp>
 #include <userver/tracing/tracer.hpp>
+#include <userver/utils/periodic_task.hpp>
 #include <userver/yaml_config/merge_schemas.hpp>
 
 USERVER_NAMESPACE_BEGIN
@@ -11,14 +12,34 @@ namespace components {
 
 namespace {
 constexpr std::string_view kNativeTrace = "native";
+constexpr std::string_view kBatchedTrace = "batched";
+constexpr std::chrono::milliseconds kDefaultExportPeriod{100};
+
+tracing::SamplingSettings ParseSamplingSettings(const ComponentConfig& config) {
+  tracing::SamplingSettings sampling;
+  const auto ratio = config["sampling-ratio"].As<double>(1.0);
+  if (ratio < 1.0) sampling.sampler = tracing::MakeRatioSampler(ratio);
+
+  const auto threshold = config["tail-sampling-latency-threshold"];
+  if (!threshold.IsMissing()) {
+    tracing::TailSamplingSettings tail;
+    tail.latency_threshold = threshold.As<std::chrono::milliseconds>();
+    tail.max_buffer_size =
+        config["tail-sampling-max-buffer-size"].As<std::size_t>(
+            tail.max_buffer_size);
+    sampling.tail = tail;
+  }
+  return sampling;
 }
 
+}  // namespace
+
 Tracer::Tracer(const ComponentConfig& config, const ComponentContext& context) {
   auto& logging_component = context.FindComponent<Logging>();
   auto opentracing_logger = logging_component.GetLoggerOptional("opentracing");
   auto service_name = config["service-name"].As<std::string>({});
   const auto tracer_type = config["tracer"].As<std::string>(kNativeTrace);
-  if (tracer_type == kNativeTrace) {
+  if (tracer_type == kNativeTrace || tracer_type == kBatchedTrace) {
     if (service_name.empty() && opentracing_logger) {
       throw std::runtime_error(
           "Opentracing logger was set, but the `service-name` is empty. "
@@ -31,11 +52,27 @@ Tracer::Tracer(const ComponentConfig& config, const ComponentContext& context) {
       LOG_INFO() << "Opentracing logger is not registered";
     }
 
-    tracing::Tracer::SetTracer(tracing::MakeTracer(
-        std::move(service_name), std::move(opentracing_logger), tracer_type));
+    tracer_ = tracing::MakeTracer(std::move(service_name),
+                                  std::move(opentracing_logger), tracer_type,
+                                  ParseSamplingSettings(config));
+    tracing::Tracer::SetTracer(tracer_);
   } else {
     throw std::runtime_error("Tracer type is not supported: " + tracer_type);
   }
+
+  if (tracer_->GetSpanExporter()) {
+    const auto period = config["export-period"].As<std::chrono::milliseconds>(
+        kDefaultExportPeriod);
+    export_task_.Start(
+        "tracer-span-export",
+        utils::PeriodicTask::Settings{period, {}, logging::Level::kTrace},
+        [tracer = tracer_] { tracing::FlushSpans(*tracer); });
+  }
+}
+
+Tracer::~Tracer() {
+  export_task_.Stop();
+  if (tracer_) tracing::FlushSpans(*tracer_);
 }
 
 yaml_config::Schema Tracer::GetStaticConfigSchema() {
@@ -50,8 +87,36 @@ properties:
         defaultDescription: ''
     tracer:
         type: string
-        description: type of the tracer to trace, currently supported only 'native'
+        description: |
+            type of the tracer to trace, 'native' or 'batched'
         defaultDescription: 'native'
+        enum:
+          - native
+          - batched
+    export-period:
+        type: string
+        description: |
+            how often the 'batched' tracer writes out the buffered spans
+        defaultDescription: 100ms
+    sampling-ratio:
+        type: number
+        description: |
+            ratio of the traces to log, the decisions that came in the
+            OpenTelemetry and b3 headers of the requests are used instead
+        defaultDescription: 1.0
+        minimum: 0.0
+        maximum: 1.0
+    tail-sampling-latency-threshold:
+        type: string
+        description: |
+            if set, the spans of the traces dropped by sampling are buffered
+            and logged if the root span takes longer or has an error tag
+        defaultDescription: tail sampling is disabled
+    tail-sampling-max-buffer-size:
+        type: integer
+        description: max size of the buffered log records of a trace
+        defaultDescription: 65536
+        minimum: 0
 )");
 }
 
@@ -1,5 +1,7 @@
 #include <userver/tracing/manager.hpp>
 
+#include <charconv>
+
 #include <userver/engine/task/inherited_variable.hpp>
 #include <userver/http/common_headers.hpp>
 #include <userver/server/http/http_request.hpp>
@@ -17,6 +19,21 @@ constexpr std::string_view kSampledTag = "sampled";
 // default value for Sampled flag is '01' as we always write spans by
 // default
 constexpr std::string_view kDefaultOtelTraceFlags = "01";
+constexpr std::string_view kNotSampledOtelTraceFlags = "00";
+
+bool IsOtelSampled(std::string_view traceflags) {
+  unsigned flags = 0;
+  const auto [ptr, ec] = std::from_chars(
+      traceflags.data(), traceflags.data() + traceflags.size(), flags, 16);
+  if (ec != std::errc{} || ptr != traceflags.data() + traceflags.size()) {
+    return true;
+  }
+  return flags & 1;
+}
+
+bool IsB3Sampled(std::string_view sampled) {
+  return sampled != "0" && sampled != "false";
+}
 
 // The order matter for TryFillSpanBuilderFromRequest as it returns on first
 // success
@@ -55,6 +72,7 @@ bool B3TryFillSpanBuilderFromRequest(const server::http::HttpRequest& request,
   span_builder.SetTraceId(trace_id);
   span_builder.SetParentSpanId(request.GetHeader(b3::kSpanId));
   span_builder.AddTagFrozen(std::string{kSampledTag}, sampled);
+  span_builder.SetSampled(IsB3Sampled(sampled));
   return true;
 }
 
@@ -66,7 +84,9 @@ void B3FillWithTracingContext(const tracing::Span& span, T& target) {
   target.SetHeader(b3::kParentSpanId, span.GetParentId());
 
   const auto& sampled = server::request::GetTaskInheritedHeader(b3::kSampled);
-  if (!sampled.empty()) {
+  if (!span.IsSampled()) {
+    target.SetHeader(b3::kSampled, "0");
+  } else if (!sampled.empty()) {
     target.SetHeader(b3::kSampled, sampled);
   } else {
     target.SetHeader(b3::kSampled, "1");
@@ -99,6 +119,7 @@ bool OpenTelemetryTryFillSpanBuilderFromRequest(
   if (data.trace_flags.empty()) {
     data.trace_flags = std::string{kDefaultOtelTraceFlags};
   }
+  span_builder.SetSampled(IsOtelSampled(data.trace_flags));
 
   const auto& tracestate = request.GetHeader(opentelemetry::kTraceState);
   kOTelTracingHeadersInheritedData.Set({
@@ -114,7 +135,9 @@ void OpenTelemetryFillWithTracingContext(const tracing::Span& span, T& target,
   const auto* data = kOTelTracingHeadersInheritedData.GetOptional();
 
   std::string_view traceflags = kDefaultOtelTraceFlags;
-  if (data) {
+  if (!span.IsSampled()) {
+    traceflags = kNotSampledOtelTraceFlags;
+  } else if (data) {
     traceflags = data->traceflags;
   }
   auto traceparent_result = opentelemetry::BuildTraceParentHeader(
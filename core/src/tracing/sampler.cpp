@@ -0,0 +1,62 @@
+#include <userver/tracing/sampler.hpp>
+
+#include <charconv>
+#include <cstdint>
+#include <functional>
+
+#include <fmt/format.h>
+
+#include <userver/utils/assert.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace tracing {
+
+namespace {
+
+// Number of the trailing hex digits of the trace id used for the decision
+constexpr std::size_t kTraceIdHexDigits = 16;
+
+// Maps the trace id onto [0, 2^64) uniformly, the random trailing part of
+// the hex trace ids is used as is, like in OpenTelemetry
+std::uint64_t TraceIdToNumber(std::string_view trace_id) noexcept {
+  if (trace_id.size() >= kTraceIdHexDigits) {
+    const auto digits = trace_id.substr(trace_id.size() - kTraceIdHexDigits);
+    std::uint64_t value = 0;
+    const auto [ptr, ec] = std::from_chars(
+        digits.data(), digits.data() + digits.size(), value, 16);
+    if (ec == std::errc{} && ptr == digits.data() + digits.size()) {
+      return value;
+    }
+  }
+  return std::hash<std::string_view>{}(trace_id);
+}
+
+class RatioSampler final : public Sampler {
+ public:
+  explicit RatioSampler(double ratio) : ratio_(ratio) {}
+
+  bool ShouldSample(std::string_view trace_id) const override {
+    if (ratio_ >= 1.0) return true;
+    // 2^64 as double
+    constexpr double kRange = 18446744073709551616.0;
+    return static_cast<double>(TraceIdToNumber(trace_id)) < ratio_ * kRange;
+  }
+
+ private:
+  const double ratio_;
+};
+
+}  // namespace
+
+Sampler::~Sampler() = default;
+
+std::shared_ptr<const Sampler> MakeRatioSampler(double ratio) {
+  UINVARIANT(ratio >= 0.0 && ratio <= 1.0,
+             fmt::format("Sampling ratio must be in [0, 1], got {}", ratio));
+  return std::make_shared<RatioSampler>(ratio);
+}
+
+}  // namespace tracing
+
+USERVER_NAMESPACE_END
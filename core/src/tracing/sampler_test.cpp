@@ -0,0 +1,41 @@
+#include <userver/tracing/sampler.hpp>
+
+#include <gtest/gtest.h>
+
+#include <userver/utils/uuid4.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+TEST(TracingSampler, RatioBounds) {
+  const auto none = tracing::MakeRatioSampler(0.0);
+  const auto all = tracing::MakeRatioSampler(1.0);
+  for (const auto* trace_id :
+       {"00000000000000000000000000000000", "ffffffffffffffffffffffffffffffff",
+        "not-a-hex-trace-id"}) {
+    EXPECT_FALSE(none->ShouldSample(trace_id)) << trace_id;
+    EXPECT_TRUE(all->ShouldSample(trace_id)) << trace_id;
+  }
+}
+
+TEST(TracingSampler, RatioUsesTrailingHexDigits) {
+  const auto half = tracing::MakeRatioSampler(0.5);
+  EXPECT_TRUE(half->ShouldSample("ffffffffffffffff7fffffffffffffff"));
+  EXPECT_FALSE(half->ShouldSample("00000000000000008000000000000000"));
+}
+
+TEST(TracingSampler, RatioIsDeterministic) {
+  constexpr int kTraces = 10000;
+  const auto sampler = tracing::MakeRatioSampler(0.25);
+  const auto same_sampler = tracing::MakeRatioSampler(0.25);
+
+  int sampled = 0;
+  for (int i = 0; i < kTraces; ++i) {
+    const auto trace_id = utils::generators::GenerateUuid();
+    const bool decision = sampler->ShouldSample(trace_id);
+    EXPECT_EQ(decision, same_sampler->ShouldSample(trace_id));
+    sampled += decision;
+  }
+  EXPECT_NEAR(sampled, kTraces / 4, kTraces / 20);
+}
+
+USERVER_NAMESPACE_END
@@ -1,5 +1,6 @@
 #include <tracing/span_impl.hpp>
 
+#include <memory>
 #include <type_traits>
 
 #include <fmt/compile.h>
@@ -7,10 +8,12 @@
 
 #include <engine/task/task_context.hpp>
 #include <logging/log_helper_impl.hpp>
+#include <userver/compiler/thread_local.hpp>
 #include <userver/engine/task/local_variable.hpp>
 #include <userver/logging/impl/logger_base.hpp>
 #include <userver/logging/impl/tag_writer.hpp>
 #include <userver/tracing/span.hpp>
+#include <userver/tracing/tags.hpp>
 #include <userver/tracing/tracer.hpp>
 #include <userver/utils/assert.hpp>
 #include <userver/utils/encoding/hex.hpp>
@@ -59,9 +62,39 @@ TsBuffer StartTsToString(std::chrono::system_clock::time_point start) {
   return buffer;
 }
 
+// Span::Impl is ~4KB because of the inline LogExtra. The blocks of the
+// destroyed spans are kept for the next spans of the thread, so that the
+// creation of the short-lived spans on hot paths does not hit the allocator.
+struct SpanImplStoragePool final {
+  static constexpr std::size_t kMaxSize = 16;
+
+  using Storage =
+      std::aligned_storage_t<sizeof(Span::Impl), alignof(Span::Impl)>;
+
+  std::size_t size{0};
+  std::unique_ptr<Storage> blocks[kMaxSize]{};
+};
+
+compiler::ThreadLocal local_span_impl_storage_pool = [] {
+  return SpanImplStoragePool{};
+};
+
 // Maintain coro-local span stack to identify "current span" in O(1).
 engine::TaskLocalVariable<SpanStack> task_local_spans;
 
+// Lets the engine attribute the CPU time and the CPU profiler samples of the
+// task to the current span
+void SwitchSpanCpuStatsName() {
+  auto* current = engine::current_task::GetCurrentTaskContextUnchecked();
+  if (current == nullptr || !current->IsSpanNameTracked()) return;
+  if (!current->HasLocalStorage()) return;
+
+  const auto* spans_ptr = task_local_spans.GetOptional();
+  current->SwitchSpanCpuStatsName(
+      !spans_ptr || spans_ptr->empty() ? std::string_view{}
+                                       : spans_ptr->back().GetName());
+}
+
 std::string GenerateSpanId() {
   std::uniform_int_distribution<std::uint64_t> dist;
   const auto random_value = utils::WithDefaultRandom(dist);
@@ -72,6 +105,32 @@ std::string GenerateSpanId() {
 
 }  // namespace
 
+namespace impl {
+
+void* AllocateSpanImplStorage() {
+  {
+    auto pool = local_span_impl_storage_pool.Use();
+    if (pool->size != 0) return pool->blocks[--pool->size].release();
+  }
+  return new SpanImplStoragePool::Storage;
+}
+
+// May be called on a different thread than the one that allocated `storage`
+void DeallocateSpanImplStorage(void* storage) noexcept {
+  std::unique_ptr<SpanImplStoragePool::Storage> block{
+      static_cast<SpanImplStoragePool::Storage*>(storage)};
+  auto pool = local_span_impl_storage_pool.Use();
+  if (pool->size == SpanImplStoragePool::kMaxSize) return;
+  pool->blocks[pool->size++] = std::move(block);
+}
+
+}  // namespace impl
+
+void DeleteImpl(Span::Impl* impl) noexcept {
+  impl->~Impl();
+  impl::DeallocateSpanImplStorage(impl);
+}
+
 Span::Impl::Impl(std::string name, ReferenceType reference_type,
                  logging::Level log_level,
                  utils::impl::SourceLocation source_location)
@@ -96,19 +155,40 @@ Span::Impl::Impl(TracerPtr tracer, std::string name, const Span::Impl* parent,
   if (parent) {
     log_extra_inheritable_ = parent->log_extra_inheritable_;
     local_log_level_ = parent->local_log_level_;
+    is_sampled_ = parent->is_sampled_;
+    is_sampling_fixed_ = true;
+    tail_buffer_ = parent->tail_buffer_;
+  } else {
+    SampleHead();
   }
 }
 
 Span::Impl::~Impl() {
-  if (!ShouldLog()) {
-    return;
+  if (is_linked()) {
+    unlink();
+    SwitchSpanCpuStatsName();
   }
 
-  {
+  if (tail_buffer_ && HasErrorTag()) {
+    tail_buffer_->MarkError();
+  }
+
+  if (ShouldLog()) {
     const DetachLocalSpansScope ignore_local_span;
-    logging::LogHelper lh{logging::GetDefaultLogger(), log_level_,
-                          source_location_};
-    std::move(*this).PutIntoLogger(lh.GetTagWriterAfterText({}));
+    if (tail_buffer_) {
+      impl::TailSamplingLogger tail_logger{*tail_buffer_, nullptr};
+      logging::LogHelper lh{tail_logger, log_level_, source_location_};
+      std::move(*this).PutIntoLogger(lh.GetTagWriterAfterText({}));
+    } else {
+      logging::LogHelper lh{logging::GetDefaultLogger(), log_level_,
+                            source_location_};
+      std::move(*this).PutIntoLogger(lh.GetTagWriterAfterText({}));
+    }
+  }
+
+  if (owns_tail_buffer_) {
+    tail_buffer_->Finish(std::chrono::steady_clock::now() -
+                         start_steady_time_);
   }
 }
 
@@ -146,11 +226,15 @@ void Span::Impl::LogTo(logging::impl::TagWriter writer) {
   tracer_->LogSpanContextTo(*this, writer);
 }
 
-void Span::Impl::DetachFromCoroStack() { unlink(); }
+void Span::Impl::DetachFromCoroStack() {
+  unlink();
+  SwitchSpanCpuStatsName();
+}
 
 void Span::Impl::AttachToCoroStack() {
   UASSERT(!is_linked());
   task_local_spans->push_back(*this);
+  SwitchSpanCpuStatsName();
 }
 
 std::string Span::Impl::GetParentIdForLogging(const Span::Impl* parent) {
@@ -186,12 +270,63 @@ bool Span::Impl::ShouldLog() const {
    */
   return logging::impl::ShouldLogNoSpan(logging::GetDefaultLogger(),
                                         log_level_) &&
-         local_log_level_.value_or(logging::Level::kTrace) <= log_level_;
+         local_log_level_.value_or(logging::Level::kTrace) <= log_level_ &&
+         (is_sampled_ || tail_buffer_);
+}
+
+void Span::Impl::SetTraceId(std::string&& id) {
+  trace_id_ = std::move(id);
+  if (!is_sampling_fixed_) SampleHead();
+}
+
+void Span::Impl::SetSampled(bool sampled) {
+  if (!tracer_ || !tracer_->GetSamplingSettings().sampler) return;
+  is_sampled_ = sampled;
+  is_sampling_fixed_ = true;
+  UpdateTailSampling();
+}
+
+void Span::Impl::SampleHead() {
+  const auto* const sampler =
+      tracer_ ? tracer_->GetSamplingSettings().sampler.get() : nullptr;
+  is_sampled_ = !sampler || sampler->ShouldSample(trace_id_);
+  UpdateTailSampling();
+}
+
+void Span::Impl::UpdateTailSampling() {
+  const auto* const tail_settings =
+      tracer_ && tracer_->GetSamplingSettings().tail
+          ? &*tracer_->GetSamplingSettings().tail
+          : nullptr;
+  if (is_sampled_ || !tail_settings) {
+    tail_buffer_.reset();
+    owns_tail_buffer_ = false;
+  } else if (!owns_tail_buffer_) {
+    tail_buffer_ = std::make_shared<impl::TailSamplingBuffer>(*tail_settings);
+    owns_tail_buffer_ = true;
+  }
+}
+
+bool Span::Impl::HasErrorTag() const {
+  const auto is_error = [](const logging::LogExtra::Value& value) {
+    return std::visit(
+        [](const auto& v) {
+          if constexpr (std::is_same_v<std::decay_t<decltype(v)>,
+                                       std::string>) {
+            return v == "1" || v == "true";
+          } else {
+            return v != 0;
+          }
+        },
+        value);
+  };
+  return is_error(log_extra_inheritable_.GetValue(kErrorFlag)) ||
+         (log_extra_local_ && is_error(log_extra_local_->GetValue(kErrorFlag)));
 }
 
 void Span::OptionalDeleter::operator()(Span::Impl* impl) const noexcept {
   if (do_delete) {
-    std::default_delete<Impl>{}(impl);
+    DeleteImpl(impl);
   }
 }
 
@@ -382,6 +517,8 @@ void Span::LogTo(logging::impl::TagWriter writer) const& {
 
 bool Span::ShouldLogDefault() const noexcept { return pimpl_->ShouldLog(); }
 
+bool Span::IsSampled() const noexcept { return pimpl_->IsSampled(); }
+
 void Span::DetachFromCoroStack() {
   if (pimpl_) pimpl_->DetachFromCoroStack();
 }
@@ -49,6 +49,8 @@ void SpanBuilder::AddNonInheritableTag(std::string key,
   pimpl_->log_extra_local_->Extend(std::move(key), std::move(value));
 }
 
+void SpanBuilder::SetSampled(bool sampled) { pimpl_->SetSampled(sampled); }
+
 void SpanBuilder::SetParentLink(std::string parent_link) {
   AddTagFrozen(kParentLinkTag, std::move(parent_link));
 }
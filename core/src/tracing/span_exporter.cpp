@@ -0,0 +1,175 @@
+#include <tracing/span_exporter.hpp>
+
+#include <functional>
+#include <thread>
+
+#include <engine/task/task_context.hpp>
+#include <logging/log_helper_impl.hpp>
+#include <tracing/span_impl.hpp>
+#include <userver/logging/impl/binary_format.hpp>
+#include <userver/logging/impl/tag_writer.hpp>
+#include <userver/utils/assert.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace tracing::impl {
+
+namespace {
+
+namespace binary = logging::impl::binary;
+
+constexpr std::size_t kMaxShardCount = 64;
+
+// A shard that grows over the limit is flushed by the producer
+constexpr std::size_t kMaxShardBufferSize = 256 * 1024;
+
+std::size_t GetShardCount() noexcept {
+  const std::size_t threads = std::thread::hardware_concurrency();
+  std::size_t count = 1;
+  while (count < threads && count < kMaxShardCount) count *= 2;
+  return count;
+}
+
+// Record is `varint(level) varint(start time) varint(duration) str(name)
+// str(trace_id) str(span_id) str(parent_id) varint(tag count)
+// (str(key) str(type) str(value))*`, where str is `varint(size) data`
+void AppendVarint(std::string& out, std::uint64_t value) {
+  char buffer[binary::kMaxVarintSize];
+  out.append(buffer, binary::WriteVarint(buffer, value));
+}
+
+void AppendString(std::string& out, std::string_view value) {
+  AppendVarint(out, value.size());
+  out.append(value);
+}
+
+void AppendRecord(std::string& out, const SpanRecord& record) {
+  AppendVarint(out, static_cast<std::uint64_t>(record.level));
+  AppendVarint(out, static_cast<std::uint64_t>(record.start_time_us));
+  AppendVarint(out, static_cast<std::uint64_t>(record.duration_us));
+  AppendString(out, record.name);
+  AppendString(out, record.trace_id);
+  AppendString(out, record.span_id);
+  AppendString(out, record.parent_id);
+  AppendVarint(out, record.tags.size());
+  for (const auto& tag : record.tags) {
+    AppendString(out, tag.key);
+    AppendString(out, tag.type);
+    AppendString(out, tag.value);
+  }
+}
+
+class RecordReader final {
+ public:
+  explicit RecordReader(std::string_view records) : records_(records) {}
+
+  bool IsEmpty() const noexcept { return records_.empty(); }
+
+  std::uint64_t ReadVarint() noexcept {
+    std::uint64_t value = 0;
+    for (int shift = 0;; shift += 7) {
+      UASSERT(!records_.empty());
+      const auto byte = static_cast<unsigned char>(records_.front());
+      records_.remove_prefix(1);
+      value |= static_cast<std::uint64_t>(byte & 0x7F) << shift;
+      if (!(byte & 0x80)) return value;
+    }
+  }
+
+  std::string_view ReadString() noexcept {
+    const auto size = static_cast<std::size_t>(ReadVarint());
+    UASSERT(size <= records_.size());
+    const auto result = records_.substr(0, size);
+    records_.remove_prefix(size);
+    return result;
+  }
+
+  SpanRecord ReadRecord() {
+    SpanRecord record;
+    record.level = static_cast<logging::Level>(ReadVarint());
+    record.start_time_us = static_cast<std::int64_t>(ReadVarint());
+    record.duration_us = static_cast<std::int64_t>(ReadVarint());
+    record.name = ReadString();
+    record.trace_id = ReadString();
+    record.span_id = ReadString();
+    record.parent_id = ReadString();
+    const auto tag_count = ReadVarint();
+    for (std::uint64_t i = 0; i < tag_count; ++i) {
+      auto& tag = record.tags.emplace_back();
+      tag.key = ReadString();
+      tag.type = ReadString();
+      tag.value = std::string{ReadString()};
+    }
+    return record;
+  }
+
+ private:
+  std::string_view records_;
+};
+
+}  // namespace
+
+SpanExporter::SpanExporter(logging::LoggerPtr logger,
+                           std::string service_name)
+    : logger_(std::move(logger)),
+      service_name_(std::move(service_name)),
+      shards_(GetShardCount()) {
+  UASSERT(logger_);
+}
+
+SpanExporter::~SpanExporter() { Flush(); }
+
+void SpanExporter::Export(const SpanRecord& record) {
+  auto& shard = GetCurrentShard();
+  std::string full_records;
+  {
+    const std::lock_guard lock{shard.mutex};
+    AppendRecord(shard.records, record);
+    if (shard.records.size() < kMaxShardBufferSize) return;
+    full_records.swap(shard.records);
+  }
+  WriteRecords(full_records);
+}
+
+void SpanExporter::Flush() noexcept {
+  std::string records;
+  for (auto& shard : shards_) {
+    {
+      const std::lock_guard lock{shard->mutex};
+      // The capacity stays with the shard, `records` is reused
+      records.assign(shard->records);
+      shard->records.clear();
+    }
+    WriteRecords(records);
+  }
+}
+
+SpanExporter::Shard& SpanExporter::GetCurrentShard() noexcept {
+  auto* const task = engine::current_task::GetCurrentTaskContextUnchecked();
+  const std::uint64_t key =
+      task ? reinterpret_cast<std::uintptr_t>(task)
+           : std::hash<std::thread::id>{}(std::this_thread::get_id());
+  // Fibonacci hashing spreads the aligned addresses over the shards
+  const auto hash = (key * 11400714819323198485ULL) >> 32;
+  return *shards_[hash % shards_.size()];
+}
+
+void SpanExporter::WriteRecords(std::string_view records) const noexcept {
+  RecordReader reader{records};
+  while (!reader.IsEmpty()) {
+    try {
+      const auto record = reader.ReadRecord();
+      const DetachLocalSpansScope ignore_local_span;
+      logging::LogHelper lh(*logger_, record.level);
+      WriteSpanRecord(record, service_name_, lh.GetTagWriterAfterText({}));
+    } catch (const std::exception& e) {
+      UASSERT_MSG(false,
+                  "While exporting a span record caught an exception: " +
+                      std::string(e.what()));
+    }
+  }
+}
+
+}  // namespace tracing::impl
+
+USERVER_NAMESPACE_END
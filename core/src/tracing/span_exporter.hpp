@@ -0,0 +1,82 @@
+#pragma once
+
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <string_view>
+
+#include <boost/container/small_vector.hpp>
+
+#include <userver/concurrent/impl/interference_shield.hpp>
+#include <userver/logging/fwd.hpp>
+#include <userver/logging/level.hpp>
+#include <userver/utils/fixed_array.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace logging::impl {
+class TagWriter;
+}  // namespace logging::impl
+
+namespace tracing::impl {
+
+/// Opentracing record of a finished span
+struct SpanRecord final {
+  struct Tag final {
+    std::string_view key;
+    std::string_view type;
+    std::string value;
+  };
+
+  logging::Level level{logging::Level::kInfo};
+  std::int64_t start_time_us{0};
+  std::int64_t duration_us{0};
+  std::string_view name;
+  std::string_view trace_id;
+  std::string_view span_id;
+  std::string_view parent_id;
+  boost::container::small_vector<Tag, 4> tags;
+};
+
+/// Writes the opentracing tags of the record
+void WriteSpanRecord(const SpanRecord& record, std::string_view service_name,
+                     logging::impl::TagWriter writer);
+
+/// @brief Buffers the opentracing records of finished spans and writes them
+/// to the opentracing logger in batches.
+///
+/// Export() only appends a compact binary encoding of the record to one of
+/// the sharded buffers, the log records are formatted by Flush(). A buffer
+/// that grows over the limit is flushed by the producer itself.
+class SpanExporter final {
+ public:
+  SpanExporter(logging::LoggerPtr logger, std::string service_name);
+
+  SpanExporter(SpanExporter&&) = delete;
+  SpanExporter& operator=(SpanExporter&&) = delete;
+
+  /// Flushes the buffered records
+  ~SpanExporter();
+
+  void Export(const SpanRecord& record);
+
+  /// Writes out the records buffered so far
+  void Flush() noexcept;
+
+ private:
+  struct Shard final {
+    std::mutex mutex;
+    std::string records;
+  };
+
+  Shard& GetCurrentShard() noexcept;
+  void WriteRecords(std::string_view records) const noexcept;
+
+  const logging::LoggerPtr logger_;
+  const std::string service_name_;
+  utils::FixedArray<concurrent::impl::InterferenceShield<Shard>> shards_;
+};
+
+}  // namespace tracing::impl
+
+USERVER_NAMESPACE_END
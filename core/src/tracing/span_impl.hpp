@@ -8,7 +8,6 @@
 
 #include <boost/intrusive/list.hpp>
 
-#include <userver/formats/json/string_builder.hpp>
 #include <userver/logging/level.hpp>
 #include <userver/logging/log_extra.hpp>
 #include <userver/logging/log_filepath.hpp>
@@ -18,6 +17,8 @@
 #include <userver/tracing/tracer.hpp>
 #include <userver/utils/impl/source_location.hpp>
 
+#include <tracing/span_exporter.hpp>
+#include <tracing/tail_sampling.hpp>
 #include <tracing/time_storage.hpp>
 
 USERVER_NAMESPACE_BEGIN
@@ -62,26 +63,45 @@ class Span::Impl
   std::string GetSpanId() && noexcept { return std::move(span_id_); }
   std::string GetParentId() && noexcept { return std::move(parent_id_); }
 
-  void SetTraceId(std::string&& id) noexcept { trace_id_ = std::move(id); }
+  // Also repeats the head sampling of the root spans for the new trace id
+  void SetTraceId(std::string&& id);
   void SetSpanId(std::string&& id) noexcept { span_id_ = std::move(id); }
   void SetParentId(std::string&& id) noexcept { parent_id_ = std::move(id); }
 
   ReferenceType GetReferenceType() const noexcept { return reference_type_; }
 
+  bool IsSampled() const noexcept { return is_sampled_; }
+
+  // Applies the sampling decision that came with the request, ignored if the
+  // tracer has no head sampler
+  void SetSampled(bool sampled);
+
+  const std::string& GetName() const noexcept { return name_; }
+
   void DetachFromCoroStack();
   void AttachToCoroStack();
 
  private:
   void LogOpenTracing() const;
-  void DoLogOpenTracing(logging::impl::TagWriter writer) const;
-  static void AddOpentracingTags(formats::json::StringBuilder& output,
+  impl::SpanRecord MakeSpanRecord() const;
+  static void AddOpentracingTags(impl::SpanRecord& output,
                                  const logging::LogExtra& input);
 
   static std::string GetParentIdForLogging(const Span::Impl* parent);
   bool ShouldLog() const;
 
+  void SampleHead();
+  void UpdateTailSampling();
+  bool HasErrorTag() const;
+
   const std::string name_;
   const bool is_no_log_span_;
+  bool is_sampled_{true};
+  // Set if the decision was inherited from the parent or came with the
+  // request, and must not be repeated
+  bool is_sampling_fixed_{false};
+  // The span that decides on the tail sampling of the trace
+  bool owns_tail_buffer_{false};
   logging::Level log_level_;
   std::optional<logging::Level> local_log_level_;
 
@@ -102,6 +122,8 @@ class Span::Impl
   const ReferenceType reference_type_;
   utils::impl::SourceLocation source_location_;
 
+  std::shared_ptr<impl::TailSamplingBuffer> tail_buffer_;
+
   friend class Span;
   friend class SpanBuilder;
   friend class TagScope;
@@ -115,11 +137,27 @@ using SpanStack =
 
 const Span::Impl* GetParentSpanImpl();
 
+namespace impl {
+
+// Storage for Span::Impl from a small thread-local pool of freed blocks
+void* AllocateSpanImplStorage();
+void DeallocateSpanImplStorage(void* storage) noexcept;
+
+}  // namespace impl
+
 template <typename... Args>
 Span::Impl* AllocateImpl(Args&&... args) {
-  return new Span::Impl(std::forward<Args>(args)...);
+  void* const storage = impl::AllocateSpanImplStorage();
+  try {
+    return new (storage) Span::Impl(std::forward<Args>(args)...);
+  } catch (...) {
+    impl::DeallocateSpanImplStorage(storage);
+    throw;
+  }
 }
 
+void DeleteImpl(Span::Impl* impl) noexcept;
+
 class DetachLocalSpansScope final {
  public:
   DetachLocalSpansScope() noexcept;
@@ -1,7 +1,5 @@
 #include "span_impl.hpp"
 
-#include <boost/container/small_vector.hpp>
-
 #include <userver/formats/json/string_builder.hpp>
 #include <userver/logging/impl/tag_writer.hpp>
 #include <userver/logging/log_extra.hpp>
@@ -49,21 +47,18 @@ struct LogExtraValueVisitor {
   void operator()(int val) { string_value = std::to_string(val); }
 };
 
-void GetTagObject(formats::json::StringBuilder& builder, std::string_view key,
-                  const logging::LogExtra::Value& value,
-                  std::string_view type) {
+void GetTagObject(formats::json::StringBuilder& builder,
+                  const impl::SpanRecord::Tag& tag) {
   const formats::json::StringBuilder::ObjectGuard guard(builder);
-  LogExtraValueVisitor visitor;
-  std::visit(visitor, value);
 
   builder.Key("value");
-  builder.WriteString(visitor.string_value);
+  builder.WriteString(tag.value);
 
   builder.Key("type");
-  builder.WriteString(type);
+  builder.WriteString(tag.type);
 
   builder.Key("key");
-  builder.WriteString(key);
+  builder.WriteString(tag.key);
 }
 
 constexpr std::string_view kOperationName = "operation_name";
@@ -84,57 +79,87 @@ void Span::Impl::LogOpenTracing() const {
     return;
   }
 
+  auto* const exporter = tracer_->GetSpanExporter();
   auto logger = tracer_->GetOptionalLogger();
-  if (logger) {
-    const DetachLocalSpansScope ignore_local_span;
-    logging::LogHelper lh(*logger, log_level_);
-    DoLogOpenTracing(lh.GetTagWriterAfterText({}));
+  if (!exporter && !logger) {
+    return;
   }
+
+  const auto record = MakeSpanRecord();
+  if (exporter) {
+    exporter->Export(record);
+    return;
+  }
+
+  const DetachLocalSpansScope ignore_local_span;
+  logging::LogHelper lh(*logger, log_level_);
+  impl::WriteSpanRecord(record, tracer_->GetServiceName(),
+                        lh.GetTagWriterAfterText({}));
 }
 
-void Span::Impl::DoLogOpenTracing(logging::impl::TagWriter writer) const {
+impl::SpanRecord Span::Impl::MakeSpanRecord() const {
   const auto steady_now = std::chrono::steady_clock::now();
   const auto duration = steady_now - start_steady_time_;
-  const auto duration_microseconds =
-      std::chrono::duration_cast<std::chrono::microseconds>(duration).count();
-  auto start_time = std::chrono::duration_cast<std::chrono::microseconds>(
-                        start_system_time_.time_since_epoch())
-                        .count();
 
-  if (tracer_) {
-    writer.PutTag(jaeger::kServiceName, tracer_->GetServiceName());
-  }
-  writer.PutTag(jaeger::kTraceId, trace_id_);
-  writer.PutTag(jaeger::kParentId, parent_id_);
-  writer.PutTag(jaeger::kSpanId, span_id_);
-  writer.PutTag(jaeger::kStartTime, start_time);
-  writer.PutTag(jaeger::kStartTimeMillis, start_time / 1000);
-  writer.PutTag(jaeger::kDuration, duration_microseconds);
-  writer.PutTag(jaeger::kOperationName, name_);
-
-  formats::json::StringBuilder tags;
-  {
-    const formats::json::StringBuilder::ArrayGuard guard(tags);
-    AddOpentracingTags(tags, log_extra_inheritable_);
-    if (log_extra_local_) {
-      AddOpentracingTags(tags, *log_extra_local_);
-    }
+  impl::SpanRecord record;
+  record.level = log_level_;
+  record.start_time_us =
+      std::chrono::duration_cast<std::chrono::microseconds>(
+          start_system_time_.time_since_epoch())
+          .count();
+  record.duration_us =
+      std::chrono::duration_cast<std::chrono::microseconds>(duration).count();
+  record.name = name_;
+  record.trace_id = trace_id_;
+  record.span_id = span_id_;
+  record.parent_id = parent_id_;
+
+  AddOpentracingTags(record, log_extra_inheritable_);
+  if (log_extra_local_) {
+    AddOpentracingTags(record, *log_extra_local_);
   }
-  writer.PutTag("tags", tags.GetStringView());
+  return record;
 }
 
-void Span::Impl::AddOpentracingTags(formats::json::StringBuilder& output,
+void Span::Impl::AddOpentracingTags(impl::SpanRecord& output,
                                     const logging::LogExtra& input) {
   for (const auto& [key, value] : *input.extra_) {
     const auto tag_it = jaeger::kGetOpentracingTags.TryFind(key);
     if (tag_it) {
       const auto& tag = *tag_it;
-      jaeger::GetTagObject(output, tag.opentracing_name, value.GetValue(),
-                           tag.type);
+      jaeger::LogExtraValueVisitor visitor;
+      std::visit(visitor, value.GetValue());
+      output.tags.push_back({tag.opentracing_name, tag.type,
+                             std::move(visitor.string_value)});
     }
   }
 }
 
+namespace impl {
+
+void WriteSpanRecord(const SpanRecord& record, std::string_view service_name,
+                     logging::impl::TagWriter writer) {
+  writer.PutTag(jaeger::kServiceName, service_name);
+  writer.PutTag(jaeger::kTraceId, record.trace_id);
+  writer.PutTag(jaeger::kParentId, record.parent_id);
+  writer.PutTag(jaeger::kSpanId, record.span_id);
+  writer.PutTag(jaeger::kStartTime, record.start_time_us);
+  writer.PutTag(jaeger::kStartTimeMillis, record.start_time_us / 1000);
+  writer.PutTag(jaeger::kDuration, record.duration_us);
+  writer.PutTag(jaeger::kOperationName, record.name);
+
+  formats::json::StringBuilder tags;
+  {
+    const formats::json::StringBuilder::ArrayGuard guard(tags);
+    for (const auto& tag : record.tags) {
+      jaeger::GetTagObject(tags, tag);
+    }
+  }
+  writer.PutTag("tags", tags.GetStringView());
+}
+
+}  // namespace impl
+
 }  // namespace tracing
 
 USERVER_NAMESPACE_END
@@ -7,6 +7,8 @@
 #include <userver/engine/sleep.hpp>
 #include <userver/formats/json/serialize.hpp>
 #include <userver/tracing/span.hpp>
+#include <userver/tracing/span_builder.hpp>
+#include <userver/tracing/tags.hpp>
 #include <userver/tracing/tracer.hpp>
 #include <userver/utest/utest.hpp>
 #include <userver/utils/regex.hpp>
@@ -248,6 +250,110 @@ UTEST_F(OpentracingSpan, TagFormat) {
   }
 }
 
+UTEST_F(OpentracingSpan, BatchedTracer) {
+  auto tracer = tracing::MakeTracer(
+      "test_service", tracing::Tracer::GetTracer()->GetOptionalLogger(),
+      "batched");
+  {
+    tracing::Span span(tracer, "span_name", nullptr,
+                       tracing::ReferenceType::kChild);
+    span.AddTag("meta_code", 200);
+    span.AddTag("http.url", "http://example.com/example");
+  }
+  FlushOpentracing();
+  EXPECT_THAT(GetOtStreamString(), Not(HasSubstr("span_name")));
+
+  tracing::FlushSpans(*tracer);
+  FlushOpentracing();
+  const auto log_str = GetOtStreamString();
+  EXPECT_THAT(log_str, HasSubstr("service_name=test_service"));
+  EXPECT_THAT(log_str, HasSubstr("operation_name=span_name"));
+
+  const auto tags = GetTagsJson(log_str);
+  ASSERT_EQ(2, tags.GetSize());
+  for (const auto& tag : tags) {
+    CheckTagFormat(tag);
+    const auto key = tag["key"].As<std::string>();
+    if (key == "http.status_code") {
+      CheckTagTypeAndValue(tag, "int64", "200");
+    } else if (key == "http.url") {
+      CheckTagTypeAndValue(tag, "string", "http://example.com/example");
+    } else {
+      FAIL() << "Got unknown key in tags: " << key;
+    }
+  }
+}
+
+UTEST_F(Span, HeadSampling) {
+  auto tracer = tracing::MakeTracer("test_service", {}, "native",
+                                    {tracing::MakeRatioSampler(0.0), {}});
+  {
+    tracing::Span span(tracer, "dropped_span", nullptr,
+                       tracing::ReferenceType::kChild);
+    EXPECT_FALSE(span.IsSampled());
+    EXPECT_FALSE(span.ShouldLogDefault());
+
+    auto child = span.CreateChild("dropped_child");
+    EXPECT_FALSE(child.IsSampled());
+  }
+  logging::LogFlush();
+  EXPECT_THAT(GetStreamString(), Not(HasSubstr("dropped_")));
+
+  // The decision that came with the request overrides the sampler
+  tracing::Tracer::SetTracer(tracer);
+  {
+    tracing::SpanBuilder builder("request_span");
+    builder.SetSampled(true);
+    auto span = std::move(builder).Build();
+    EXPECT_TRUE(span.IsSampled());
+  }
+  tracing::Tracer::SetTracer(tracing::MakeTracer({}, {}));
+  logging::LogFlush();
+  EXPECT_THAT(GetStreamString(), HasSubstr("stopwatch_name=request_span"));
+}
+
+UTEST_F(Span, TailSamplingKeepsErrors) {
+  tracing::TailSamplingSettings tail;
+  tail.latency_threshold = std::chrono::hours{1};
+  auto tracer = tracing::MakeTracer("test_service", {}, "native",
+                                    {tracing::MakeRatioSampler(0.0), tail});
+  {
+    tracing::Span span(tracer, "fast_root", nullptr,
+                       tracing::ReferenceType::kChild);
+    { auto child = span.CreateChild("fast_child"); }
+  }
+  {
+    tracing::Span span(tracer, "failed_root", nullptr,
+                       tracing::ReferenceType::kChild);
+    {
+      auto child = span.CreateChild("failed_child");
+      child.AddTag(tracing::kErrorFlag, true);
+    }
+    logging::LogFlush();
+    EXPECT_THAT(GetStreamString(), Not(HasSubstr("failed_child")));
+  }
+  logging::LogFlush();
+
+  const auto logs = GetStreamString();
+  EXPECT_THAT(logs, Not(HasSubstr("fast_")));
+  EXPECT_THAT(logs, HasSubstr("stopwatch_name=failed_child"));
+  EXPECT_THAT(logs, HasSubstr("stopwatch_name=failed_root"));
+}
+
+UTEST_F(Span, TailSamplingKeepsSlowTraces) {
+  tracing::TailSamplingSettings tail;
+  tail.latency_threshold = std::chrono::milliseconds{10};
+  auto tracer = tracing::MakeTracer("test_service", {}, "native",
+                                    {tracing::MakeRatioSampler(0.0), tail});
+  {
+    tracing::Span span(tracer, "slow_root", nullptr,
+                       tracing::ReferenceType::kChild);
+    engine::SleepFor(std::chrono::milliseconds{20});
+  }
+  logging::LogFlush();
+  EXPECT_THAT(GetStreamString(), HasSubstr("stopwatch_name=slow_root"));
+}
+
 UTEST_F(Span, ScopeTime) {
   {
     tracing::Span span("span_name");
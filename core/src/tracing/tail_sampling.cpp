@@ -0,0 +1,89 @@
+#include <tracing/tail_sampling.hpp>
+
+#include <userver/logging/impl/tag_writer.hpp>
+#include <userver/logging/log.hpp>
+#include <userver/utils/assert.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace tracing::impl {
+
+namespace {
+
+logging::impl::LoggerBase& GetTargetLogger(const logging::LoggerPtr& target) {
+  return target ? *target : logging::GetDefaultLogger();
+}
+
+}  // namespace
+
+TailSamplingBuffer::TailSamplingBuffer(const TailSamplingSettings& settings)
+    : settings_(settings) {}
+
+void TailSamplingBuffer::Append(const logging::LoggerPtr& target,
+                                logging::Level level,
+                                std::string_view payload) {
+  {
+    const std::lock_guard lock{mutex_};
+    switch (state_) {
+      case State::kBuffering:
+        if (size_ + payload.size() <= settings_.max_buffer_size) {
+          size_ += payload.size();
+          records_.push_back(Record{target, level, std::string{payload}});
+        }
+        return;
+      case State::kDropped:
+        return;
+      case State::kKept:
+        break;
+    }
+  }
+  GetTargetLogger(target).Log(level, payload);
+}
+
+void TailSamplingBuffer::MarkError() noexcept {
+  const std::lock_guard lock{mutex_};
+  has_error_ = true;
+}
+
+void TailSamplingBuffer::Finish(
+    std::chrono::steady_clock::duration root_duration) noexcept {
+  std::vector<Record> records;
+  {
+    const std::lock_guard lock{mutex_};
+    UASSERT(state_ == State::kBuffering);
+    const bool keep =
+        has_error_ || root_duration >= settings_.latency_threshold;
+    state_ = keep ? State::kKept : State::kDropped;
+    records.swap(records_);
+    size_ = 0;
+    if (!keep) return;
+  }
+
+  for (const auto& record : records) {
+    try {
+      GetTargetLogger(record.target).Log(record.level, record.payload);
+    } catch (const std::exception& e) {
+      UASSERT_MSG(false, "While writing a kept span record caught an "
+                         "exception: " + std::string(e.what()));
+    }
+  }
+}
+
+TailSamplingLogger::TailSamplingLogger(TailSamplingBuffer& buffer,
+                                       logging::LoggerPtr target)
+    : LoggerBase(GetTargetLogger(target).GetFormat()),
+      buffer_(buffer),
+      target_(std::move(target)) {}
+
+void TailSamplingLogger::Log(logging::Level level, std::string_view msg) {
+  buffer_.Append(target_, level, msg);
+}
+
+void TailSamplingLogger::PrependCommonTags(
+    logging::impl::TagWriter writer) const {
+  GetTargetLogger(target_).PrependCommonTags(writer);
+}
+
+}  // namespace tracing::impl
+
+USERVER_NAMESPACE_END
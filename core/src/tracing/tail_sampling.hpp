@@ -0,0 +1,73 @@
+#pragma once
+
+#include <chrono>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <userver/logging/fwd.hpp>
+#include <userver/logging/impl/logger_base.hpp>
+#include <userver/tracing/sampler.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace tracing::impl {
+
+/// @brief Holds the log records of the spans of a trace dropped by the head
+/// sampler, until the root span decides whether to keep the trace.
+///
+/// Shared by the spans of the trace, the records of the spans that finish
+/// after the decision are written out or discarded at once.
+class TailSamplingBuffer final {
+ public:
+  explicit TailSamplingBuffer(const TailSamplingSettings& settings);
+
+  /// `target` is nullptr for the default logger
+  void Append(const logging::LoggerPtr& target, logging::Level level,
+              std::string_view payload);
+
+  void MarkError() noexcept;
+
+  /// Called by the root span of the trace
+  void Finish(std::chrono::steady_clock::duration root_duration) noexcept;
+
+ private:
+  struct Record final {
+    logging::LoggerPtr target;
+    logging::Level level;
+    std::string payload;
+  };
+
+  enum class State {
+    kBuffering,
+    kKept,
+    kDropped,
+  };
+
+  const TailSamplingSettings settings_;
+  std::mutex mutex_;
+  std::vector<Record> records_;
+  std::size_t size_{0};
+  bool has_error_{false};
+  State state_{State::kBuffering};
+};
+
+/// Logger that formats the records like `target` and appends them to the
+/// TailSamplingBuffer
+class TailSamplingLogger final : public logging::impl::LoggerBase {
+ public:
+  /// `target` is nullptr for the default logger
+  TailSamplingLogger(TailSamplingBuffer& buffer, logging::LoggerPtr target);
+
+  void Log(logging::Level level, std::string_view msg) override;
+  void PrependCommonTags(logging::impl::TagWriter writer) const override;
+
+ private:
+  TailSamplingBuffer& buffer_;
+  const logging::LoggerPtr target_;
+};
+
+}  // namespace tracing::impl
+
+USERVER_NAMESPACE_END
@@ -7,6 +7,7 @@
 #include <userver/utils/uuid4.hpp>
 
 #include <tracing/no_log_spans.hpp>
+#include <tracing/span_exporter.hpp>
 #include <tracing/span_impl.hpp>
 
 USERVER_NAMESPACE_BEGIN
@@ -19,22 +20,49 @@ constexpr std::string_view kTraceIdName = "trace_id";
 constexpr std::string_view kSpanIdName = "span_id";
 constexpr std::string_view kParentIdName = "parent_id";
 
-class NoopTracer final : public Tracer {
- public:
-  NoopTracer(std::string_view service_name, logging::LoggerPtr logger)
-      : Tracer(service_name, std::move(logger)) {}
-
-  void LogSpanContextTo(const Span::Impl&,
-                        logging::impl::TagWriter) const override;
-};
+constexpr std::string_view kNativeTracer = "native";
+constexpr std::string_view kBatchedTracer = "batched";
 
-void NoopTracer::LogSpanContextTo(const Span::Impl& span,
-                                  logging::impl::TagWriter writer) const {
+void PutSpanContext(const Span::Impl& span, logging::impl::TagWriter writer) {
   writer.PutTag(kTraceIdName, span.GetTraceId());
   writer.PutTag(kSpanIdName, span.GetSpanId());
   writer.PutTag(kParentIdName, span.GetParentId());
 }
 
+class NoopTracer final : public Tracer {
+ public:
+  NoopTracer(std::string_view service_name, logging::LoggerPtr logger,
+             SamplingSettings sampling)
+      : Tracer(service_name, std::move(logger), std::move(sampling)) {}
+
+  void LogSpanContextTo(const Span::Impl& span,
+                        logging::impl::TagWriter writer) const override {
+    PutSpanContext(span, writer);
+  }
+};
+
+class BatchedTracer final : public Tracer {
+ public:
+  BatchedTracer(std::string_view service_name, logging::LoggerPtr logger,
+                SamplingSettings sampling)
+      : Tracer(service_name, logger, std::move(sampling)),
+        exporter_(logger ? std::make_unique<impl::SpanExporter>(
+                               std::move(logger), std::string{service_name})
+                         : nullptr) {}
+
+  void LogSpanContextTo(const Span::Impl& span,
+                        logging::impl::TagWriter writer) const override {
+    PutSpanContext(span, writer);
+  }
+
+  impl::SpanExporter* GetSpanExporter() const noexcept override {
+    return exporter_.get();
+  }
+
+ private:
+  const std::unique_ptr<impl::SpanExporter> exporter_;
+};
+
 auto& GlobalNoLogSpans() {
   static rcu::Variable<NoLogSpans> spans{};
   return spans;
@@ -99,6 +127,10 @@ const std::string& Tracer::GetServiceName() const {
   return service_name_;
 }
 
+impl::SpanExporter* Tracer::GetSpanExporter() const noexcept {
+  return nullptr;
+}
+
 Span Tracer::CreateSpanWithoutParent(std::string name) {
   auto span =
       Span(shared_from_this(), std::move(name), nullptr, ReferenceType::kChild);
@@ -114,10 +146,22 @@ Span Tracer::CreateSpan(std::string name, const Span& parent,
 
 tracing::TracerPtr MakeTracer(std::string_view service_name,
                               logging::LoggerPtr logger,
-                              std::string_view tracer_type) {
-  UINVARIANT(tracer_type == "native",
-             "Only 'native' tracer type is available at the moment");
-  return std::make_shared<tracing::NoopTracer>(service_name, std::move(logger));
+                              std::string_view tracer_type,
+                              SamplingSettings sampling) {
+  if (tracer_type == kBatchedTracer) {
+    return std::make_shared<tracing::BatchedTracer>(
+        service_name, std::move(logger), std::move(sampling));
+  }
+  UINVARIANT(tracer_type == kNativeTracer,
+             "Only 'native' and 'batched' tracer types are available");
+  return std::make_shared<tracing::NoopTracer>(
+      service_name, std::move(logger), std::move(sampling));
+}
+
+void FlushSpans(const Tracer& tracer) noexcept {
+  if (auto* const exporter = tracer.GetSpanExporter()) {
+    exporter->Flush();
+  }
 }
 
 }  // namespace tracing
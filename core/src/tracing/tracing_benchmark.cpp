@@ -18,6 +18,17 @@ void tracing_noop_ctr(benchmark::State& state) {
 }
 BENCHMARK(tracing_noop_ctr);
 
+void tracing_child_ctr(benchmark::State& state) {
+  engine::RunStandalone([&] {
+    auto tracer = tracing::MakeTracer("test_service", {});
+    const auto parent = tracer->CreateSpanWithoutParent("parent");
+
+    for ([[maybe_unused]] auto _ : state)
+      benchmark::DoNotOptimize(parent.CreateChild("name"));
+  });
+}
+BENCHMARK(tracing_child_ctr);
+
 void tracing_happy_log(benchmark::State& state) {
   logging::DefaultLoggerGuard guard{logging::MakeNullLogger()};
 
@@ -52,6 +63,18 @@ void tracing_opentracing_ctr(benchmark::State& state) {
 }
 BENCHMARK(tracing_opentracing_ctr);
 
+void tracing_batched_opentracing_ctr(benchmark::State& state) {
+  auto logger = logging::MakeNullLogger();
+  engine::RunStandalone([&] {
+    auto tracer = tracing::MakeTracer("test_service", logger, "batched");
+    for ([[maybe_unused]] auto _ : state) {
+      benchmark::DoNotOptimize(GetSpanWithOpentracingHttpTags(tracer));
+    }
+    tracing::FlushSpans(*tracer);
+  });
+}
+BENCHMARK(tracing_batched_opentracing_ctr);
+
 }  // namespace
 
 USERVER_NAMESPACE_END
@@ -6,6 +6,7 @@
 #include <boost/range/numeric.hpp>
 
 #include <userver/concurrent/variable.hpp>
+#include <userver/engine/get_all.hpp>
 #include <userver/engine/task/task_with_result.hpp>
 #include <userver/utest/utest.hpp>
 
@@ -94,6 +95,28 @@ class AsyncRequestProcessor final {
 };
 /// [AsyncBackground component]
 
+UTEST_MT(UtilsAsync, AsyncBatch, 4) {
+  std::vector<int> requests(100);
+  for (std::size_t i = 0; i < requests.size(); ++i) {
+    requests[i] = static_cast<int>(i);
+  }
+
+  auto tasks = utils::AsyncBatch("batch", requests,
+                                 [](int request) { return request * 2; });
+  ASSERT_EQ(tasks.size(), requests.size());
+
+  const auto results = engine::GetAll(tasks);
+  for (std::size_t i = 0; i < requests.size(); ++i) {
+    EXPECT_EQ(results[i], requests[i] * 2);
+  }
+}
+
+UTEST(UtilsAsync, AsyncBatchEmpty) {
+  const std::vector<int> requests;
+  auto tasks = utils::AsyncBatch("batch", requests, [](int) {});
+  EXPECT_TRUE(tasks.empty());
+}
+
 UTEST(UtilsAsync, AsyncBackground) {
   AsyncRequestProcessor async_request_processor;
 
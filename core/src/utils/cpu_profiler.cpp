@@ -0,0 +1,239 @@
+#include <utils/cpu_profiler.hpp>
+
+#include <execinfo.h>
+#include <signal.h>
+#include <sys/time.h>
+
+#include <algorithm>
+#include <atomic>
+#include <cerrno>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <string_view>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+#include <boost/stacktrace/frame.hpp>
+#include <fmt/format.h>
+
+#include <engine/task/task_context.hpp>
+#include <engine/task/task_processor.hpp>
+#include <userver/engine/sleep.hpp>
+#include <userver/utils/assert.hpp>
+#include <userver/utils/fast_scope_guard.hpp>
+#include <utils/check_syscall.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace utils::cpu_profiler {
+namespace {
+
+// The signal handler frame and the signal trampoline frame
+constexpr int kSkippedFrames = 2;
+constexpr int kMaxFrames = 64;
+constexpr std::size_t kMaxSpanNameSize = 63;
+
+constexpr std::string_view kStartOfCoroutine = "utils::impl::WrappedCallImpl<";
+constexpr std::string_view kNoTaskProcessor = "[no task processor]";
+constexpr std::string_view kNoSpan = "[no span]";
+constexpr std::string_view kUnknownFrame = "[unknown]";
+
+struct Sample final {
+  const std::string* task_processor_name;
+  int frames_count;
+  std::uint8_t span_name_size;
+  char span_name[kMaxSpanNameSize];
+  void* frames[kMaxFrames];
+};
+
+struct Samples final {
+  explicit Samples(std::size_t capacity)
+      : data(std::make_unique<Sample[]>(capacity)), capacity(capacity) {}
+
+  std::unique_ptr<Sample[]> data;
+  const std::size_t capacity;
+  std::atomic<std::size_t> next{0};
+};
+
+std::atomic<bool> is_running{false};
+std::atomic<Samples*> current_samples{nullptr};
+std::atomic<int> handlers_running{0};
+bool is_handler_installed{false};  // protected by is_running
+
+void RecordSample(Sample& sample) noexcept {
+  sample.frames_count = ::backtrace(sample.frames, kMaxFrames);
+  sample.task_processor_name = nullptr;
+  sample.span_name_size = 0;
+
+  auto* context = engine::current_task::GetCurrentTaskContextUnchecked();
+  if (!context) return;
+
+  sample.task_processor_name = &context->GetTaskProcessor().Name();
+  const auto span_name = context->GetSpanNameForProfiler();
+  sample.span_name_size = std::min(span_name.size(), kMaxSpanNameSize);
+  std::memcpy(sample.span_name, span_name.data(), sample.span_name_size);
+}
+
+void OnSigprof(int) {
+  const auto saved_errno = errno;
+  // seq_cst pairs with the wait in SamplingScope destructor
+  handlers_running.fetch_add(1);
+  if (auto* samples = current_samples.load()) {
+    const auto index = samples->next.fetch_add(1, std::memory_order_relaxed);
+    if (index < samples->capacity) RecordSample(samples->data[index]);
+  }
+  handlers_running.fetch_sub(1);
+  errno = saved_errno;
+}
+
+void InstallHandler() {
+  // The handler is never uninstalled: restoring the default action would
+  // terminate the process on a SIGPROF that is still pending
+  if (is_handler_installed) return;
+
+  struct sigaction action {};
+  action.sa_handler = &OnSigprof;
+  action.sa_flags = SA_RESTART;
+  utils::CheckSyscall(sigemptyset(&action.sa_mask), "initializing signal set");
+  utils::CheckSyscall(sigaction(SIGPROF, &action, nullptr),
+                      "setting SIGPROF handler");
+  is_handler_installed = true;
+}
+
+void StartTimer(unsigned frequency_hz) {
+  const auto interval_us = 1'000'000 / frequency_hz;
+  itimerval timer{};
+  timer.it_interval.tv_sec = interval_us / 1'000'000;
+  timer.it_interval.tv_usec = interval_us % 1'000'000;
+  timer.it_value = timer.it_interval;
+  utils::CheckSyscall(setitimer(ITIMER_PROF, &timer, nullptr),
+                      "starting the profiling timer");
+}
+
+void StopTimer() noexcept {
+  const itimerval timer{};
+  [[maybe_unused]] const auto result = setitimer(ITIMER_PROF, &timer, nullptr);
+  UASSERT(result == 0);
+}
+
+class SamplingScope final {
+ public:
+  SamplingScope(Samples& samples, unsigned frequency_hz) {
+    InstallHandler();
+    current_samples.store(&samples);
+    try {
+      StartTimer(frequency_hz);
+    } catch (const std::exception&) {
+      current_samples.store(nullptr);
+      throw;
+    }
+  }
+
+  ~SamplingScope() {
+    StopTimer();
+    current_samples.store(nullptr);
+    // Some threads may still be recording the samples
+    while (handlers_running.load() != 0) std::this_thread::yield();
+  }
+};
+
+std::string SanitizeName(std::string_view name) {
+  // ';' separates the frames in the folded format
+  std::string result{name};
+  std::replace(result.begin(), result.end(), ';', ':');
+  return result;
+}
+
+Profile Fold(const Samples& samples) {
+  const auto total = samples.next.load();
+  const auto recorded = std::min(total, samples.capacity);
+
+  Profile profile;
+  profile.samples = recorded;
+  profile.dropped_samples = total - recorded;
+
+  std::unordered_map<void*, std::string> frame_names;
+  const auto get_frame_name = [&frame_names](void* address) -> const auto& {
+    auto [it, inserted] = frame_names.try_emplace(address);
+    if (inserted) {
+      auto name = boost::stacktrace::frame(address).name();
+      it->second = name.empty() ? std::string{kUnknownFrame}
+                                : SanitizeName(name);
+    }
+    return it->second;
+  };
+
+  std::unordered_map<std::string, std::size_t> stack_counts;
+  std::string stack;
+  for (std::size_t i = 0; i < recorded; ++i) {
+    const auto& sample = samples.data[i];
+
+    stack.clear();
+    stack += sample.task_processor_name
+                 ? SanitizeName(*sample.task_processor_name)
+                 : std::string{kNoTaskProcessor};
+    stack += ';';
+    stack += sample.span_name_size
+                 ? SanitizeName({sample.span_name, sample.span_name_size})
+                 : std::string{kNoSpan};
+
+    // The frames of the coroutine trampoline carry no information
+    int outermost = sample.frames_count - 1;
+    for (int j = kSkippedFrames; j < sample.frames_count; ++j) {
+      if (get_frame_name(sample.frames[j]).find(kStartOfCoroutine) !=
+          std::string::npos) {
+        outermost = j - 1;
+        break;
+      }
+    }
+    for (int j = outermost; j >= kSkippedFrames; --j) {
+      stack += ';';
+      stack += get_frame_name(sample.frames[j]);
+    }
+
+    ++stack_counts[stack];
+  }
+
+  std::vector<std::pair<std::string_view, std::size_t>> sorted_stacks(
+      stack_counts.begin(), stack_counts.end());
+  std::sort(sorted_stacks.begin(), sorted_stacks.end());
+  for (const auto& [folded_stack, count] : sorted_stacks) {
+    fmt::format_to(std::back_inserter(profile.collapsed_stacks), "{} {}\n",
+                   folded_stack, count);
+  }
+  return profile;
+}
+
+}  // namespace
+
+ProfilerBusyError::ProfilerBusyError()
+    : std::runtime_error("Another CPU profile is being collected") {}
+
+Profile Collect(const Options& options) {
+  UINVARIANT(options.frequency_hz > 0, "Sampling frequency must be positive");
+  UINVARIANT(options.max_samples > 0, "Max samples must be positive");
+
+  if (is_running.exchange(true)) throw ProfilerBusyError();
+  const utils::FastScopeGuard running_guard([]() noexcept {
+    is_running.store(false);
+  });
+
+  // The first call loads the unwinder and is not async-signal-safe
+  void* warmup_frame = nullptr;
+  ::backtrace(&warmup_frame, 1);
+
+  Samples samples{options.max_samples};
+  {
+    const SamplingScope sampling_scope{samples, options.frequency_hz};
+    engine::InterruptibleSleepFor(options.duration);
+  }
+  return Fold(samples);
+}
+
+bool IsRunning() noexcept { return is_running.load(); }
+
+}  // namespace utils::cpu_profiler
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,42 @@
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+#include <stdexcept>
+#include <string>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace utils::cpu_profiler {
+
+struct Options final {
+  std::chrono::milliseconds duration{5000};
+  unsigned frequency_hz{99};
+  std::size_t max_samples{20000};
+};
+
+struct Profile final {
+  // In the folded format of flamegraph.pl: one line per unique stack, the
+  // frames are separated by ';' and are followed by the number of samples.
+  // The two outermost frames are the task processor and the span name.
+  std::string collapsed_stacks;
+  std::size_t samples{0};
+  std::size_t dropped_samples{0};
+};
+
+class ProfilerBusyError final : public std::runtime_error {
+ public:
+  ProfilerBusyError();
+};
+
+// Samples the CPU stacks of all the threads of the process with SIGPROF for
+// the specified duration. Blocks the current task.
+// Throws ProfilerBusyError if another profile is being collected.
+Profile Collect(const Options& options);
+
+// Whether a profile is being collected, async-signal-safe
+bool IsRunning() noexcept;
+
+}  // namespace utils::cpu_profiler
+
+USERVER_NAMESPACE_END
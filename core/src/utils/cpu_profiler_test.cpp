@@ -0,0 +1,67 @@
+#include <userver/utest/utest.hpp>
+
+#include <atomic>
+#include <chrono>
+
+#include <userver/engine/async.hpp>
+#include <userver/engine/sleep.hpp>
+#include <userver/tracing/span.hpp>
+#include <userver/utest/assert_macros.hpp>
+#include <utils/cpu_profiler.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+utils::cpu_profiler::Options MakeOptions() {
+  utils::cpu_profiler::Options options;
+  options.duration = std::chrono::milliseconds{500};
+  options.frequency_hz = 1000;
+  return options;
+}
+
+}  // namespace
+
+UTEST_MT(CpuProfiler, TagsSamplesWithSpans, 2) {
+  std::atomic<bool> stop{false};
+  auto burner = engine::AsyncNoSpan([&stop] {
+    while (!utils::cpu_profiler::IsRunning()) engine::Yield();
+
+    const tracing::Span span{"cpu_burner"};
+    while (!stop.load()) {
+      // burn CPU without switching the context
+    }
+  });
+
+  const auto profile = utils::cpu_profiler::Collect(MakeOptions());
+  stop = true;
+  UEXPECT_NO_THROW(burner.Get());
+
+  EXPECT_FALSE(utils::cpu_profiler::IsRunning());
+  EXPECT_GT(profile.samples, 0);
+  EXPECT_NE(profile.collapsed_stacks.find(";cpu_burner;"), std::string::npos)
+      << profile.collapsed_stacks;
+}
+
+UTEST(CpuProfiler, Busy) {
+  auto profiling = engine::AsyncNoSpan(
+      [] { return utils::cpu_profiler::Collect(MakeOptions()); });
+  while (!utils::cpu_profiler::IsRunning()) engine::Yield();
+
+  UEXPECT_THROW(utils::cpu_profiler::Collect(MakeOptions()),
+                utils::cpu_profiler::ProfilerBusyError);
+  UEXPECT_NO_THROW(profiling.Get());
+}
+
+UTEST(CpuProfiler, Cancel) {
+  auto options = MakeOptions();
+  options.duration = std::chrono::minutes{1};
+  auto profiling = engine::AsyncNoSpan(
+      [&options] { return utils::cpu_profiler::Collect(options); });
+  while (!utils::cpu_profiler::IsRunning()) engine::Yield();
+
+  profiling.SyncCancel();
+  EXPECT_FALSE(utils::cpu_profiler::IsRunning());
+}
+
+USERVER_NAMESPACE_END
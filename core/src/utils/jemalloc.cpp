@@ -6,6 +6,7 @@
 #include <cerrno>
 #endif
 
+#include <userver/compiler/thread_local.hpp>
 #include <userver/utils/thread_name.hpp>
 
 USERVER_NAMESPACE_BEGIN
@@ -36,6 +37,27 @@ std::error_code MallCtl(const char* name) {
   return MakeErrorCode(rc);
 }
 
+template <typename T>
+T* MallCtlPtr(const char* name) noexcept {
+  T* result = nullptr;
+  std::size_t size = sizeof(result);
+  if (mallctl(name, &result, &size, nullptr, 0) != 0) return nullptr;
+  return result;
+}
+
+struct ThreadAllocationCountersPtrs final {
+  const std::uint64_t* allocated{nullptr};
+  const std::uint64_t* deallocated{nullptr};
+};
+
+// The counters stay at the same addresses for the lifetime of the thread
+compiler::ThreadLocal local_allocation_counters = [] {
+  return ThreadAllocationCountersPtrs{
+      MallCtlPtr<std::uint64_t>("thread.allocatedp"),
+      MallCtlPtr<std::uint64_t>("thread.deallocatedp"),
+  };
+};
+
 void MallocStatPrintCb(void* data, const char* msg) {
   auto* s = static_cast<std::string*>(data);
   *s += msg;
@@ -68,6 +90,13 @@ std::error_code StopBgThreads() {
   return MallCtl<bool>("background_thread", false);
 }
 
+AllocationCounters GetThreadAllocationCounters() noexcept {
+  auto local_ptrs = local_allocation_counters.Use();
+  const auto ptrs = *local_ptrs;
+  if (!ptrs.allocated || !ptrs.deallocated) return {};
+  return {*ptrs.allocated, *ptrs.deallocated};
+}
+
 }  // namespace utils::jemalloc
 
 USERVER_NAMESPACE_END
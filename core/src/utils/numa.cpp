@@ -0,0 +1,203 @@
+#include <utils/numa.hpp>
+
+#include <sched.h>
+
+#ifdef __linux__
+#include <linux/mempolicy.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+#include <algorithm>
+#include <climits>
+#include <stdexcept>
+
+#include <fmt/format.h>
+
+#include <userver/fs/blocking/read.hpp>
+#include <userver/logging/log.hpp>
+#include <userver/utils/from_string.hpp>
+#include <userver/utils/text_light.hpp>
+
+#include <utils/check_syscall.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace utils::numa {
+
+namespace {
+
+constexpr std::string_view kSysfsNodePath = "/sys/devices/system/node";
+
+struct Topology {
+  // Indexed by node id, nodes may be sparse
+  std::vector<std::vector<std::size_t>> node_cpus;
+  // Indexed by CPU id
+  std::vector<std::size_t> cpu_nodes;
+};
+
+std::vector<std::size_t> ReadCpuListFile(const std::string& path) {
+  return ParseCpuList(utils::text::Trim(fs::blocking::ReadFileContents(path)));
+}
+
+Topology ReadTopology() {
+  Topology topology;
+#ifdef __linux__
+  const auto online_path = fmt::format("{}/online", kSysfsNodePath);
+  if (!fs::blocking::FileExists(online_path)) return topology;
+
+  for (const auto node : ReadCpuListFile(online_path)) {
+    if (topology.node_cpus.size() <= node) {
+      topology.node_cpus.resize(node + 1);
+    }
+    auto cpus =
+        ReadCpuListFile(fmt::format("{}/node{}/cpulist", kSysfsNodePath, node));
+    for (const auto cpu : cpus) {
+      if (topology.cpu_nodes.size() <= cpu) {
+        topology.cpu_nodes.resize(cpu + 1, kUnknownNode);
+      }
+      topology.cpu_nodes[cpu] = node;
+    }
+    topology.node_cpus[node] = std::move(cpus);
+  }
+#endif
+  return topology;
+}
+
+const Topology& GetTopology() noexcept {
+  static const Topology kTopology = []() noexcept {
+    try {
+      return ReadTopology();
+    } catch (const std::exception& ex) {
+      LOG_WARNING() << "Failed to read NUMA topology, assuming a single node: "
+                    << ex;
+      return Topology{};
+    }
+  }();
+  return kTopology;
+}
+
+}  // namespace
+
+std::vector<std::size_t> ParseCpuList(std::string_view cpu_list) {
+  std::vector<std::size_t> result;
+  for (auto chunk : utils::text::SplitIntoStringViewVector(cpu_list, ",")) {
+    while (!chunk.empty() && chunk.front() == ' ') chunk.remove_prefix(1);
+    while (!chunk.empty() && chunk.back() == ' ') chunk.remove_suffix(1);
+    if (chunk.empty()) continue;
+
+    const auto dash_pos = chunk.find('-');
+    const auto first =
+        utils::FromString<std::size_t>(chunk.substr(0, dash_pos));
+    const auto last =
+        dash_pos == std::string_view::npos
+            ? first
+            : utils::FromString<std::size_t>(chunk.substr(dash_pos + 1));
+    if (last < first) {
+      throw std::runtime_error(
+          fmt::format("Invalid range '{}' in CPU list '{}'", chunk, cpu_list));
+    }
+    for (auto cpu = first; cpu <= last; ++cpu) result.push_back(cpu);
+  }
+
+  std::sort(result.begin(), result.end());
+  result.erase(std::unique(result.begin(), result.end()), result.end());
+  return result;
+}
+
+std::size_t GetNodesCount() noexcept {
+  return std::max<std::size_t>(GetTopology().node_cpus.size(), 1);
+}
+
+const std::vector<std::size_t>& GetNodeCpus(std::size_t node) {
+  const auto& node_cpus = GetTopology().node_cpus;
+  if (node >= node_cpus.size() || node_cpus[node].empty()) {
+    throw std::runtime_error(
+        fmt::format("NUMA node {} does not exist or has no CPUs", node));
+  }
+  return node_cpus[node];
+}
+
+std::size_t GetCpuNode(std::size_t cpu) noexcept {
+  const auto& cpu_nodes = GetTopology().cpu_nodes;
+  return cpu < cpu_nodes.size() ? cpu_nodes[cpu] : kUnknownNode;
+}
+
+std::size_t GetCurrentNode() noexcept {
+  if (GetNodesCount() == 1) return 0;
+#ifdef __linux__
+  // sched_getcpu() is served from vDSO/rseq and does not make a syscall
+  const int cpu = ::sched_getcpu();
+  if (cpu >= 0) return GetCpuNode(static_cast<std::size_t>(cpu));
+#endif
+  return kUnknownNode;
+}
+
+ThreadAffinity MakeThreadAffinity(std::string_view cpu_list,
+                                  std::optional<std::size_t> numa_node) {
+  ThreadAffinity affinity;
+  affinity.cpus = ParseCpuList(cpu_list);
+  if (affinity.cpus.empty() && !numa_node) return affinity;
+
+#ifndef __linux__
+  throw std::runtime_error("CPU and NUMA binding is supported only on Linux");
+#else
+  if (numa_node) {
+    const auto& node_cpus = GetNodeCpus(*numa_node);
+    if (affinity.cpus.empty()) {
+      affinity.cpus = node_cpus;
+    } else {
+      std::vector<std::size_t> intersection;
+      std::set_intersection(affinity.cpus.begin(), affinity.cpus.end(),
+                            node_cpus.begin(), node_cpus.end(),
+                            std::back_inserter(intersection));
+      if (intersection.empty()) {
+        throw std::runtime_error(
+            fmt::format("None of the CPUs '{}' belong to NUMA node {}",
+                        cpu_list, *numa_node));
+      }
+      affinity.cpus = std::move(intersection);
+    }
+    affinity.memory_node = numa_node;
+  }
+
+  if (affinity.cpus.back() >= CPU_SETSIZE) {
+    throw std::runtime_error(fmt::format("CPU {} is out of supported range",
+                                         affinity.cpus.back()));
+  }
+  return affinity;
+#endif
+}
+
+void BindCurrentThread(const ThreadAffinity& affinity) {
+  if (affinity.IsEmpty()) return;
+
+#ifdef __linux__
+  if (!affinity.cpus.empty()) {
+    cpu_set_t cpu_set;
+    CPU_ZERO(&cpu_set);
+    for (const auto cpu : affinity.cpus) CPU_SET(cpu, &cpu_set);
+    utils::CheckSyscall(::sched_setaffinity(0, sizeof(cpu_set), &cpu_set),
+                        "binding thread to CPUs");
+  }
+
+  if (affinity.memory_node) {
+    // Preferred rather than bound, so that we don't get OOM-killed when
+    // the node runs out of memory.
+    constexpr std::size_t kBitsPerMask = sizeof(unsigned long) * CHAR_BIT;
+    std::vector<unsigned long> node_mask(*affinity.memory_node / kBitsPerMask +
+                                         1);
+    node_mask[*affinity.memory_node / kBitsPerMask] |=
+        1UL << (*affinity.memory_node % kBitsPerMask);
+    // The kernel expects the mask size in bits plus one
+    utils::CheckSyscall(
+        ::syscall(SYS_set_mempolicy, MPOL_PREFERRED, node_mask.data(),
+                  node_mask.size() * kBitsPerMask + 1),
+        "setting preferred NUMA node {}", *affinity.memory_node);
+  }
+#endif
+}
+
+}  // namespace utils::numa
+
+USERVER_NAMESPACE_END
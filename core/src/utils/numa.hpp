@@ -0,0 +1,58 @@
+#pragma once
+
+#include <cstddef>
+#include <optional>
+#include <string_view>
+#include <vector>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace utils::numa {
+
+/// Value of GetCurrentNode() and GetCpuNode() for unknown nodes
+inline constexpr std::size_t kUnknownNode = static_cast<std::size_t>(-1);
+
+/// Parses a CPU list in the format of cpuset(7): "0-3,8,10-11".
+/// @throws std::runtime_error on invalid input
+std::vector<std::size_t> ParseCpuList(std::string_view cpu_list);
+
+/// Returns the number of NUMA nodes on the machine, 1 if the topology is
+/// unknown. The topology is read once from sysfs.
+std::size_t GetNodesCount() noexcept;
+
+/// Returns the CPUs of the NUMA node.
+/// @throws std::runtime_error if there is no such node
+const std::vector<std::size_t>& GetNodeCpus(std::size_t node);
+
+/// Returns the NUMA node of the CPU, or kUnknownNode
+std::size_t GetCpuNode(std::size_t cpu) noexcept;
+
+/// Returns the NUMA node the current thread is running on, or kUnknownNode.
+/// Cheap enough to be called on each task switch.
+std::size_t GetCurrentNode() noexcept;
+
+/// CPUs to run a thread on and a NUMA node to allocate its memory from.
+struct ThreadAffinity {
+  /// Empty means any CPU
+  std::vector<std::size_t> cpus;
+  std::optional<std::size_t> memory_node;
+
+  bool IsEmpty() const noexcept { return cpus.empty() && !memory_node; }
+};
+
+/// Builds an affinity that binds threads to `cpu_list` CPUs (see
+/// ParseCpuList) that belong to the `numa_node`. Any of the arguments may be
+/// empty. If `numa_node` is set, memory of the thread is preferably allocated
+/// from it.
+/// @throws std::runtime_error on invalid configuration, e.g. if
+/// no CPUs are left or the NUMA node does not exist.
+ThreadAffinity MakeThreadAffinity(std::string_view cpu_list,
+                                  std::optional<std::size_t> numa_node);
+
+/// Binds the current thread according to `affinity`.
+/// @throws std::system_error
+void BindCurrentThread(const ThreadAffinity& affinity);
+
+}  // namespace utils::numa
+
+USERVER_NAMESPACE_END
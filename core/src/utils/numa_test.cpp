@@ -0,0 +1,66 @@
+#include <utils/numa.hpp>
+
+#include <stdexcept>
+#include <thread>
+
+#include <gtest/gtest.h>
+
+USERVER_NAMESPACE_BEGIN
+
+using Cpus = std::vector<std::size_t>;
+
+TEST(Numa, ParseCpuList) {
+  EXPECT_EQ(utils::numa::ParseCpuList(""), Cpus{});
+  EXPECT_EQ(utils::numa::ParseCpuList("3"), Cpus{3});
+  EXPECT_EQ(utils::numa::ParseCpuList("0-3"), (Cpus{0, 1, 2, 3}));
+  EXPECT_EQ(utils::numa::ParseCpuList("8, 0-1,10-11"),
+            (Cpus{0, 1, 8, 10, 11}));
+  EXPECT_EQ(utils::numa::ParseCpuList("1,1,0-1"), (Cpus{0, 1}));
+}
+
+TEST(Numa, ParseCpuListInvalid) {
+  EXPECT_THROW(utils::numa::ParseCpuList("a"), std::exception);
+  EXPECT_THROW(utils::numa::ParseCpuList("3-1"), std::runtime_error);
+  EXPECT_THROW(utils::numa::ParseCpuList("1-"), std::exception);
+  EXPECT_THROW(utils::numa::ParseCpuList("-1"), std::exception);
+}
+
+TEST(Numa, Topology) {
+  const auto nodes_count = utils::numa::GetNodesCount();
+  ASSERT_GE(nodes_count, 1);
+
+  const auto node = utils::numa::GetCurrentNode();
+  if (node != utils::numa::kUnknownNode) {
+    EXPECT_LT(node, nodes_count);
+  }
+}
+
+TEST(Numa, MakeThreadAffinity) {
+  EXPECT_TRUE(utils::numa::MakeThreadAffinity("", std::nullopt).IsEmpty());
+
+  const auto affinity = utils::numa::MakeThreadAffinity("0", std::nullopt);
+  EXPECT_EQ(affinity.cpus, Cpus{0});
+  EXPECT_FALSE(affinity.memory_node);
+
+  EXPECT_THROW(utils::numa::MakeThreadAffinity("", 100500),
+               std::runtime_error);
+}
+
+TEST(Numa, BindCurrentThreadToNode) {
+  try {
+    utils::numa::GetNodeCpus(0);
+  } catch (const std::runtime_error&) {
+    GTEST_SKIP() << "NUMA topology is not available";
+  }
+
+  std::thread([] {
+    const auto affinity = utils::numa::MakeThreadAffinity("", 0);
+    EXPECT_EQ(affinity.cpus, utils::numa::GetNodeCpus(0));
+    EXPECT_EQ(affinity.memory_node, 0);
+
+    utils::numa::BindCurrentThread(affinity);
+    EXPECT_EQ(utils::numa::GetCurrentNode(), 0);
+  }).join();
+}
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,42 @@
+#include <userver/utils/parallel.hpp>
+
+#include <engine/task/task_processor.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace utils::parallel::impl {
+
+namespace {
+
+// Each task gets a few chunks on average, so that the tasks that finish early
+// take over the work of the slow ones
+constexpr std::size_t kChunksPerTask = 4;
+
+}  // namespace
+
+ChunkPlan PlanChunks(std::size_t size, const Options& options) {
+  auto& task_processor = options.task_processor
+                             ? *options.task_processor
+                             : engine::current_task::GetTaskProcessor();
+  if (size == 0) return {task_processor, 0, 0, 0, 0};
+
+  const auto max_tasks = std::max<std::size_t>(
+      options.max_tasks ? options.max_tasks : task_processor.GetWorkerCount(),
+      1);
+  const auto max_chunks = max_tasks * kChunksPerTask;
+  const auto chunk_size = std::max<std::size_t>(
+      options.min_chunk_size, (size + max_chunks - 1) / max_chunks);
+  const auto chunk_count = (size + chunk_size - 1) / chunk_size;
+
+  return {task_processor, size, chunk_size, chunk_count,
+          std::min(max_tasks, chunk_count)};
+}
+
+void ThrowInterrupted() {
+  throw engine::WaitInterruptedException(
+      engine::current_task::CancellationReason());
+}
+
+}  // namespace utils::parallel::impl
+
+USERVER_NAMESPACE_END
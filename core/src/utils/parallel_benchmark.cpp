@@ -0,0 +1,93 @@
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <numeric>
+#include <vector>
+
+#if __has_include(<execution>)
+#include <execution>
+#endif
+
+#include <userver/engine/run_standalone.hpp>
+#include <userver/utils/parallel.hpp>
+#include <userver/utils/rand.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+constexpr std::size_t kWorkers = 4;
+
+std::vector<int> MakeRandomVector(std::size_t size) {
+  std::vector<int> result(size);
+  for (auto& value : result) value = utils::RandRange(1'000'000);
+  return result;
+}
+
+}  // namespace
+
+void parallel_sort(benchmark::State& state) {
+  engine::RunStandalone(kWorkers, [&] {
+    const auto values = MakeRandomVector(state.range(0));
+    for ([[maybe_unused]] auto _ : state) {
+      state.PauseTiming();
+      auto copy = values;
+      state.ResumeTiming();
+      utils::parallel::Sort(copy.begin(), copy.end());
+      benchmark::DoNotOptimize(copy);
+    }
+  });
+}
+BENCHMARK(parallel_sort)->RangeMultiplier(10)->Range(1'000, 1'000'000);
+
+void parallel_reduce(benchmark::State& state) {
+  engine::RunStandalone(kWorkers, [&] {
+    std::vector<std::uint64_t> values(state.range(0));
+    std::iota(values.begin(), values.end(), 0);
+    for ([[maybe_unused]] auto _ : state) {
+      benchmark::DoNotOptimize(utils::parallel::Reduce(
+          values.begin(), values.end(), std::uint64_t{0}));
+    }
+  });
+}
+BENCHMARK(parallel_reduce)->RangeMultiplier(10)->Range(1'000, 1'000'000);
+
+#if defined(__cpp_lib_execution) && defined(__cpp_lib_parallel_algorithm)
+
+void std_execution_sort(benchmark::State& state) {
+  const auto values = MakeRandomVector(state.range(0));
+  for ([[maybe_unused]] auto _ : state) {
+    state.PauseTiming();
+    auto copy = values;
+    state.ResumeTiming();
+    std::sort(std::execution::par, copy.begin(), copy.end());
+    benchmark::DoNotOptimize(copy);
+  }
+}
+BENCHMARK(std_execution_sort)->RangeMultiplier(10)->Range(1'000, 1'000'000);
+
+void std_execution_reduce(benchmark::State& state) {
+  std::vector<std::uint64_t> values(state.range(0));
+  std::iota(values.begin(), values.end(), 0);
+  for ([[maybe_unused]] auto _ : state) {
+    benchmark::DoNotOptimize(std::reduce(std::execution::par, values.begin(),
+                                         values.end(), std::uint64_t{0}));
+  }
+}
+BENCHMARK(std_execution_reduce)->RangeMultiplier(10)->Range(1'000, 1'000'000);
+
+#endif
+
+void sequential_sort(benchmark::State& state) {
+  const auto values = MakeRandomVector(state.range(0));
+  for ([[maybe_unused]] auto _ : state) {
+    state.PauseTiming();
+    auto copy = values;
+    state.ResumeTiming();
+    std::sort(copy.begin(), copy.end());
+    benchmark::DoNotOptimize(copy);
+  }
+}
+BENCHMARK(sequential_sort)->RangeMultiplier(10)->Range(1'000, 1'000'000);
+
+USERVER_NAMESPACE_END
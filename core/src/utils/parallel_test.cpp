@@ -0,0 +1,96 @@
+#include <userver/utils/parallel.hpp>
+
+#include <cstdint>
+#include <numeric>
+#include <string>
+#include <vector>
+
+#include <userver/utest/utest.hpp>
+#include <userver/utils/rand.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+constexpr std::size_t kWorkers = 4;
+constexpr std::size_t kSize = 10'000;
+
+std::vector<int> MakeRandomVector(std::size_t size) {
+  std::vector<int> result(size);
+  for (auto& value : result) value = utils::RandRange(1'000'000);
+  return result;
+}
+
+}  // namespace
+
+UTEST_MT(UtilsParallel, ForEach, kWorkers) {
+  std::vector<int> values(kSize, 1);
+  utils::parallel::ForEach(values.begin(), values.end(),
+                           [](int& value) { value *= 2; });
+  EXPECT_EQ(values, std::vector<int>(kSize, 2));
+}
+
+UTEST_MT(UtilsParallel, Transform, kWorkers) {
+  std::vector<int> values(kSize);
+  std::iota(values.begin(), values.end(), 0);
+
+  std::vector<std::string> strings(kSize);
+  utils::parallel::Transform(values.begin(), values.end(), strings.begin(),
+                             [](int value) { return std::to_string(value); });
+  for (std::size_t i = 0; i < kSize; ++i) {
+    ASSERT_EQ(strings[i], std::to_string(i));
+  }
+}
+
+UTEST_MT(UtilsParallel, Reduce, kWorkers) {
+  std::vector<std::uint64_t> values(kSize);
+  std::iota(values.begin(), values.end(), 1);
+
+  EXPECT_EQ(utils::parallel::Reduce(values.begin(), values.end(),
+                                    std::uint64_t{0}),
+            kSize * (kSize + 1) / 2);
+
+  // Non-commutative operation keeps the order of the elements
+  std::vector<std::string> strings{"a", "b", "c", "d", "e", "f", "g"};
+  utils::parallel::Options options;
+  options.max_tasks = 3;
+  EXPECT_EQ(utils::parallel::Reduce(strings.begin(), strings.end(),
+                                    std::string{">"}, std::plus<>{}, options),
+            ">abcdefg");
+}
+
+UTEST_MT(UtilsParallel, Sort, kWorkers) {
+  for (const std::size_t size : {0, 1, 2, 7, 100, 1000, 12345}) {
+    auto values = MakeRandomVector(size);
+    auto expected = values;
+    std::sort(expected.begin(), expected.end());
+
+    utils::parallel::Sort(values.begin(), values.end());
+    EXPECT_EQ(values, expected) << "size=" << size;
+  }
+}
+
+UTEST_MT(UtilsParallel, Exception, kWorkers) {
+  std::vector<int> values(kSize);
+  std::iota(values.begin(), values.end(), 0);
+  UEXPECT_THROW(utils::parallel::ForEach(values.begin(), values.end(),
+                                         [](int value) {
+                                           if (value == 5000) {
+                                             throw std::runtime_error("test");
+                                           }
+                                         }),
+                std::runtime_error);
+}
+
+UTEST_MT(UtilsParallel, OtherTaskProcessorOptions, kWorkers) {
+  std::vector<int> values(kSize, 1);
+  utils::parallel::Options options;
+  options.task_processor = &engine::current_task::GetTaskProcessor();
+  options.max_tasks = 2;
+  options.min_chunk_size = 1000;
+  utils::parallel::ForEach(
+      values.begin(), values.end(), [](int& value) { ++value; }, options);
+  EXPECT_EQ(values, std::vector<int>(kSize, 2));
+}
+
+USERVER_NAMESPACE_END
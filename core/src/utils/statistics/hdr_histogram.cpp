@@ -0,0 +1,213 @@
+#include <userver/utils/statistics/hdr_histogram.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <limits>
+
+#include <userver/utils/assert.hpp>
+#include <userver/utils/statistics/histogram.hpp>
+#include <userver/utils/statistics/writer.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace utils::statistics {
+
+namespace {
+
+constexpr int kMaxPrecisionBits = 10;
+constexpr std::size_t kMaxOctaveCount = 48;
+
+constexpr int kDoubleMantissaBits = std::numeric_limits<double>::digits - 1;
+constexpr int kDoubleExponentBias =
+    std::numeric_limits<double>::max_exponent - 1;
+
+std::size_t GetOctaveCount(const HdrHistogramSettings& settings) {
+  UINVARIANT(std::isnormal(settings.lowest_value) &&
+                 settings.lowest_value > 0 &&
+                 settings.highest_value > settings.lowest_value,
+             "HdrHistogram requires 0 < lowest_value < highest_value");
+  UINVARIANT(settings.precision_bits >= 0 &&
+                 settings.precision_bits <= kMaxPrecisionBits,
+             "HdrHistogram precision_bits must be in [0, 10]");
+
+  const auto octaves =
+      std::ceil(std::log2(settings.highest_value / settings.lowest_value));
+  UINVARIANT(octaves <= kMaxOctaveCount,
+             "HdrHistogram highest_value / lowest_value must not exceed 2^48");
+  return std::max(static_cast<std::size_t>(octaves), std::size_t{1});
+}
+
+// The underflow bucket, the octaves, the overflow bucket
+std::size_t GetCounterCount(std::size_t octave_count, int precision_bits) {
+  return 2 + (octave_count << precision_bits);
+}
+
+}  // namespace
+
+HdrHistogramSnapshot::HdrHistogramSnapshot(
+    const HdrHistogramSettings& settings)
+    : settings_(settings),
+      octave_count_(GetOctaveCount(settings)),
+      counters_(GetCounterCount(octave_count_, settings.precision_bits)) {}
+
+const HdrHistogramSettings& HdrHistogramSnapshot::GetSettings()
+    const noexcept {
+  return settings_;
+}
+
+void HdrHistogramSnapshot::Add(const HdrHistogramSnapshot& other) {
+  UINVARIANT(settings_.lowest_value == other.settings_.lowest_value &&
+                 counters_.size() == other.counters_.size(),
+             "Only the HdrHistogram snapshots with the same settings can be "
+             "added");
+  for (std::size_t i = 0; i < counters_.size(); ++i) {
+    counters_[i] += other.counters_[i];
+  }
+}
+
+std::uint64_t HdrHistogramSnapshot::GetTotalCount() const noexcept {
+  std::uint64_t total = 0;
+  for (const auto counter : counters_) total += counter;
+  return total;
+}
+
+double HdrHistogramSnapshot::GetPercentile(double percent) const noexcept {
+  const auto total = GetTotalCount();
+  if (total == 0) return 0;
+
+  const auto target = std::max(
+      static_cast<std::uint64_t>(std::ceil(percent / 100 * total)),
+      std::uint64_t{1});
+  std::uint64_t sum = 0;
+  for (std::size_t i = 0; i + 1 < counters_.size(); ++i) {
+    sum += counters_[i];
+    if (sum >= target) return GetUpperBoundAt(i);
+  }
+  return std::ldexp(settings_.lowest_value,
+                    static_cast<int>(octave_count_));
+}
+
+double HdrHistogramSnapshot::GetUpperBoundAt(std::size_t index) const noexcept {
+  UASSERT(index < counters_.size());
+  if (index == 0) return settings_.lowest_value;
+  if (index + 1 == counters_.size()) {
+    return std::numeric_limits<double>::infinity();
+  }
+
+  const std::size_t sub_bucket_count = std::size_t{1}
+                                       << settings_.precision_bits;
+  const auto octave = (index - 1) / sub_bucket_count;
+  const auto sub_bucket = (index - 1) % sub_bucket_count;
+  return std::ldexp(
+      settings_.lowest_value *
+          (1 + static_cast<double>(sub_bucket + 1) / sub_bucket_count),
+      static_cast<int>(octave));
+}
+
+HdrHistogram::HdrHistogram(const HdrHistogramSettings& settings)
+    : settings_(settings),
+      octave_count_(GetOctaveCount(settings)),
+      counter_count_(GetCounterCount(octave_count_, settings.precision_bits)),
+      scale_(1 / settings.lowest_value),
+      counters_(
+          std::make_unique<concurrent::StripedCounter[]>(counter_count_)) {}
+
+HdrHistogram::HdrHistogram(HdrHistogram&&) noexcept = default;
+
+HdrHistogram& HdrHistogram::operator=(HdrHistogram&&) noexcept = default;
+
+HdrHistogram::~HdrHistogram() = default;
+
+const HdrHistogramSettings& HdrHistogram::GetSettings() const noexcept {
+  return settings_;
+}
+
+// NOLINTNEXTLINE(readability-make-member-function-const)
+void HdrHistogram::Account(double value, std::uint64_t count) noexcept {
+  counters_[GetIndex(value)].Add(count);
+}
+
+HdrHistogramSnapshot HdrHistogram::GetSnapshot() const {
+  HdrHistogramSnapshot snapshot{settings_};
+  auto& counters = snapshot.GetCounters();
+  UASSERT(counters.size() == counter_count_);
+  for (std::size_t i = 0; i < counter_count_; ++i) {
+    counters[i] = counters_[i].Read();
+  }
+  return snapshot;
+}
+
+// NOLINTNEXTLINE(readability-make-member-function-const)
+void HdrHistogram::Add(const HdrHistogramSnapshot& snapshot) noexcept {
+  const auto& counters = snapshot.GetCounters();
+  UASSERT(counters.size() == counter_count_);
+  for (std::size_t i = 0; i < counter_count_ && i < counters.size(); ++i) {
+    counters_[i].Add(counters[i]);
+  }
+}
+
+void ResetMetric(HdrHistogram& histogram) noexcept {
+  for (std::size_t i = 0; i < histogram.counter_count_; ++i) {
+    auto& counter = histogram.counters_[i];
+    counter.Subtract(counter.Read());
+  }
+}
+
+// The octave and the top mantissa bits of the scaled value are the octave and
+// the sub-bucket, so there are no floating point operations except for the
+// scaling.
+std::size_t HdrHistogram::GetIndex(double value) const noexcept {
+  const double scaled = value * scale_;
+  // Also catches NaN
+  if (!(scaled >= 1.0)) return 0;
+
+  std::uint64_t bits = 0;
+  static_assert(sizeof(bits) == sizeof(scaled));
+  std::memcpy(&bits, &scaled, sizeof(bits));
+
+  const auto octave = static_cast<std::size_t>(
+      (bits >> kDoubleMantissaBits) - kDoubleExponentBias);
+  if (octave >= octave_count_) return counter_count_ - 1;
+
+  const auto precision_bits = settings_.precision_bits;
+  const auto sub_bucket =
+      (bits >> (kDoubleMantissaBits - precision_bits)) &
+      ((std::uint64_t{1} << precision_bits) - 1);
+  return 1 + (octave << precision_bits) + sub_bucket;
+}
+
+void DumpMetric(Writer& writer, const HdrHistogramSnapshot& snapshot) {
+  const auto& settings = snapshot.GetSettings();
+  const auto& counters = snapshot.GetCounters();
+  const std::size_t sub_bucket_count = std::size_t{1}
+                                       << settings.precision_bits;
+  const auto octave_count = (counters.size() - 2) / sub_bucket_count;
+
+  // Bucket per octave and the underflow bucket
+  std::vector<double> bounds;
+  bounds.reserve(octave_count + 1);
+  for (std::size_t i = 0; i <= octave_count; ++i) {
+    bounds.push_back(std::ldexp(settings.lowest_value, static_cast<int>(i)));
+  }
+
+  Histogram histogram{bounds};
+  histogram.Account(bounds[0], counters[0]);
+  for (std::size_t i = 0; i < octave_count; ++i) {
+    std::uint64_t sum = 0;
+    for (std::size_t j = 0; j < sub_bucket_count; ++j) {
+      sum += counters[1 + i * sub_bucket_count + j];
+    }
+    histogram.Account(bounds[i + 1], sum);
+  }
+  histogram.Account(std::numeric_limits<double>::infinity(), counters.back());
+  writer = histogram;
+}
+
+void DumpMetric(Writer& writer, const HdrHistogram& histogram) {
+  writer = histogram.GetSnapshot();
+}
+
+}  // namespace utils::statistics
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,117 @@
+#include <userver/utils/statistics/hdr_histogram.hpp>
+
+#include <limits>
+
+#include <userver/utest/utest.hpp>
+#include <userver/utils/statistics/fmt.hpp>
+#include <userver/utils/statistics/storage.hpp>
+#include <userver/utils/statistics/testing.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+utils::statistics::HdrHistogramSettings SmallSettings() {
+  return {/*lowest_value=*/1, /*highest_value=*/100, /*precision_bits=*/2};
+}
+
+UTEST(StatisticsHdrHistogram, Sample) {
+  /// [sample]
+  utils::statistics::Storage storage;
+
+  utils::statistics::HdrHistogram histogram{{/*lowest_value=*/1,
+                                             /*highest_value=*/100,
+                                             /*precision_bits=*/2}};
+
+  auto statistics_holder = storage.RegisterWriter(
+      "test", [&](utils::statistics::Writer& writer) { writer = histogram; });
+
+  histogram.Account(0.5);
+  histogram.Account(1.2);
+  histogram.Account(3);
+  histogram.Account(10, 2);  // Account 2 times
+  histogram.Account(500);
+
+  // Written with a bucket per power of 2
+  const utils::statistics::Snapshot snapshot{storage};
+  EXPECT_EQ(fmt::to_string(snapshot.SingleMetric("test")),
+            "[1]=1,[2]=1,[4]=1,[8]=0,[16]=2,[32]=0,[64]=0,[128]=0,[inf]=1");
+
+  // Percentiles have the precision of 2^-precision_bits, 10 is counted in
+  // the bucket [10, 12)
+  EXPECT_EQ(histogram.GetSnapshot().GetPercentile(60), 12.0);
+  /// [sample]
+}
+
+UTEST(StatisticsHdrHistogram, RelativeError) {
+  utils::statistics::HdrHistogram histogram{{/*lowest_value=*/1,
+                                             /*highest_value=*/10000,
+                                             /*precision_bits=*/5}};
+  for (int i = 1; i <= 1000; ++i) histogram.Account(i);
+
+  const auto snapshot = histogram.GetSnapshot();
+  EXPECT_EQ(snapshot.GetTotalCount(), 1000);
+  for (const double percent : {1.0, 50.0, 90.0, 99.0, 100.0}) {
+    const auto exact = percent * 10;
+    const auto result = snapshot.GetPercentile(percent);
+    EXPECT_GE(result, exact) << percent;
+    EXPECT_LE(result, exact * (1 + 1.0 / 32)) << percent;
+  }
+}
+
+UTEST(StatisticsHdrHistogram, ValueOnBucketBorder) {
+  utils::statistics::HdrHistogram histogram{SmallSettings()};
+  histogram.Account(2);
+  EXPECT_EQ(histogram.GetSnapshot().GetPercentile(100), 2.5);
+}
+
+UTEST(StatisticsHdrHistogram, UnderflowAndOverflow) {
+  utils::statistics::HdrHistogram histogram{SmallSettings()};
+  histogram.Account(-1);
+  histogram.Account(0);
+  EXPECT_EQ(histogram.GetSnapshot().GetPercentile(100), 1.0);
+
+  histogram.Account(1e9);
+  histogram.Account(std::numeric_limits<double>::infinity());
+  histogram.Account(std::numeric_limits<double>::quiet_NaN());
+  const auto snapshot = histogram.GetSnapshot();
+  EXPECT_EQ(snapshot.GetTotalCount(), 5);
+  EXPECT_EQ(snapshot.GetPercentile(100), 128.0);
+  EXPECT_EQ(snapshot.GetPercentile(20), 1.0);
+}
+
+UTEST(StatisticsHdrHistogram, AddAndReset) {
+  utils::statistics::HdrHistogram histogram{SmallSettings()};
+  histogram.Account(3, 2);
+
+  auto snapshot = histogram.GetSnapshot();
+  snapshot.Add(histogram.GetSnapshot());
+  EXPECT_EQ(snapshot.GetTotalCount(), 4);
+
+  utils::statistics::HdrHistogram other{SmallSettings()};
+  other.Add(snapshot);
+  EXPECT_EQ(other.GetSnapshot().GetTotalCount(), 4);
+
+  ResetMetric(other);
+  EXPECT_EQ(other.GetSnapshot().GetTotalCount(), 0);
+  EXPECT_EQ(other.GetSnapshot().GetPercentile(50), 0.0);
+}
+
+UTEST_DEATH(StatisticsHdrHistogramDeathTest, InvalidSettings) {
+  EXPECT_UINVARIANT_FAILURE_MSG(
+      (utils::statistics::HdrHistogram{{0, 100, 2}}),
+      "HdrHistogram requires 0 < lowest_value < highest_value");
+  EXPECT_UINVARIANT_FAILURE_MSG(
+      (utils::statistics::HdrHistogram{{10, 5, 2}}),
+      "HdrHistogram requires 0 < lowest_value < highest_value");
+  EXPECT_UINVARIANT_FAILURE_MSG(
+      (utils::statistics::HdrHistogram{{1, 100, 11}}),
+      "HdrHistogram precision_bits must be in [0, 10]");
+  EXPECT_UINVARIANT_FAILURE_MSG(
+      (utils::statistics::HdrHistogram{{1e-9, 1e9, 2}}),
+      "HdrHistogram highest_value / lowest_value must not exceed 2^48");
+}
+
+}  // namespace
+
+USERVER_NAMESPACE_END
@@ -5,6 +5,7 @@
 
 #include <userver/utils/algo.hpp>
 #include <userver/utils/rand.hpp>
+#include <userver/utils/statistics/hdr_histogram.hpp>
 #include <utils/gbench_auxilary.hpp>
 
 USERVER_NAMESPACE_BEGIN
@@ -35,4 +36,56 @@ void HistogramAccount(benchmark::State& state) {
 // poorly (fixed).
 BENCHMARK(HistogramAccount)->DenseRange(10, 50, 10);
 
+void HdrHistogramAccount(benchmark::State& state) {
+  auto values_raw = std::vector<double>(1024);
+  for (auto& value : values_raw) {
+    value = utils::RandRange(0.0, 1e6);
+  }
+  const auto values = Launder(std::move(values_raw));
+
+  utils::statistics::HdrHistogram histogram{{/*lowest_value=*/1,
+                                             /*highest_value=*/1e6,
+                                             /*precision_bits=*/5}};
+
+  while (state.KeepRunningBatch(values.size())) {
+    for (const auto value : values) {
+      histogram.Account(value);
+    }
+  }
+}
+BENCHMARK(HdrHistogramAccount);
+
+// Many threads writing the same metric, which is the usual case for latency
+// histograms
+template <typename Metric>
+void HistogramAccountContended(benchmark::State& state, Metric& metric) {
+  auto values_raw = std::vector<double>(1024);
+  for (auto& value : values_raw) {
+    value = utils::RandRange(0.0, 50.0);
+  }
+  const auto values = Launder(std::move(values_raw));
+
+  while (state.KeepRunningBatch(values.size())) {
+    for (const auto value : values) {
+      metric.Account(value);
+    }
+  }
+}
+
+void HistogramAccountContended(benchmark::State& state) {
+  static const auto bounds = utils::AsContainer<std::vector<double>>(
+      boost::irange(std::int64_t{1}, std::int64_t{51}));
+  static utils::statistics::Histogram histogram{bounds};
+  HistogramAccountContended(state, histogram);
+}
+BENCHMARK(HistogramAccountContended)->ThreadRange(1, 8);
+
+void HdrHistogramAccountContended(benchmark::State& state) {
+  static utils::statistics::HdrHistogram histogram{{/*lowest_value=*/1,
+                                                    /*highest_value=*/64,
+                                                    /*precision_bits=*/3}};
+  HistogramAccountContended(state, histogram);
+}
+BENCHMARK(HdrHistogramAccountContended)->ThreadRange(1, 8);
+
 USERVER_NAMESPACE_END
@@ -0,0 +1,359 @@
+#include <utils/statistics/otlp_metrics.hpp>
+
+#include <algorithm>
+#include <string_view>
+
+#include <userver/formats/json/string_builder.hpp>
+#include <userver/logging/log.hpp>
+#include <userver/utils/algo.hpp>
+#include <userver/utils/overloaded.hpp>
+#include <userver/utils/statistics/storage.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace utils::statistics::impl {
+
+namespace {
+
+// AGGREGATION_TEMPORALITY_DELTA of opentelemetry.proto.metrics.v1
+constexpr int kDeltaTemporality = 1;
+
+// 64-bit integers are strings in the JSON mapping of protobuf
+void WriteUInt64String(formats::json::StringBuilder& builder,
+                       std::uint64_t value) {
+  builder.WriteString(std::to_string(value));
+}
+
+void WriteTime(formats::json::StringBuilder& builder, std::string_view key,
+               std::chrono::system_clock::time_point time) {
+  builder.Key(key);
+  WriteUInt64String(
+      builder,
+      std::chrono::duration_cast<std::chrono::nanoseconds>(
+          time.time_since_epoch())
+          .count());
+}
+
+void WriteStringAttribute(formats::json::StringBuilder& builder,
+                          std::string_view key, std::string_view value) {
+  const formats::json::StringBuilder::ObjectGuard attribute_guard{builder};
+  builder.Key("key");
+  builder.WriteString(key);
+  builder.Key("value");
+  const formats::json::StringBuilder::ObjectGuard value_guard{builder};
+  builder.Key("stringValue");
+  builder.WriteString(value);
+}
+
+std::uint64_t Delta(std::uint64_t current, std::uint64_t committed) {
+  // A counter that went down was reset
+  return current >= committed ? current - committed : current;
+}
+
+std::uint64_t DeltaAt(const std::vector<std::uint64_t>& current,
+                      const std::vector<std::uint64_t>& committed,
+                      std::size_t index) {
+  return Delta(current[index],
+               index < committed.size() ? committed[index] : 0);
+}
+
+}  // namespace
+
+class OtlpMetricsAggregator::Builder final : public BaseFormatBuilder {
+ public:
+  explicit Builder(OtlpMetricsAggregator& aggregator)
+      : aggregator_(aggregator) {}
+
+  void HandleMetric(std::string_view path, LabelsSpan labels,
+                    const MetricValue& value) override {
+    const auto kind = value.Visit(utils::Overloaded{
+        [](std::int64_t) { return Kind::kGauge; },
+        [](double) { return Kind::kGauge; },
+        [](Rate) { return Kind::kSum; },
+        [](HistogramView) { return Kind::kHistogram; },
+    });
+
+    auto it = aggregator_.metrics_.find(path);
+    if (it == aggregator_.metrics_.end()) {
+      it = aggregator_.metrics_.emplace(std::string{path}, Metric{kind, {}})
+               .first;
+    }
+    auto& metric = it->second;
+    if (metric.kind != kind) {
+      LOG_LIMITED_WARNING() << "Metric '" << path
+                            << "' has values of different types, skipping "
+                               "some of them in the OTLP export";
+      return;
+    }
+
+    auto& series = GetSeries(metric, labels);
+    value.Visit(utils::Overloaded{
+        [&series](std::int64_t x) {
+          if (series.is_double_gauge) {
+            series.double_gauge += x;
+          } else {
+            series.int_gauge += x;
+          }
+        },
+        [&series](double x) {
+          if (!series.is_double_gauge) {
+            series.is_double_gauge = true;
+            series.double_gauge = series.int_gauge;
+          }
+          series.double_gauge += x;
+        },
+        [&series](Rate x) {
+          series.current.resize(1);
+          series.current[0] += x.value;
+        },
+        [&series, path](HistogramView x) { AddHistogram(series, path, x); },
+    });
+    series.has_value = true;
+  }
+
+ private:
+  Series& GetSeries(Metric& metric, LabelsSpan labels) {
+    const auto& allow_list = aggregator_.settings_.label_allow_list;
+    const auto is_kept = [&allow_list](const auto& label) {
+      return !allow_list ||
+             allow_list->find(std::string{label.Name()}) != allow_list->end();
+    };
+
+    key_.clear();
+    for (const auto& label : labels) {
+      if (!is_kept(label)) continue;
+      key_.append(label.Name());
+      key_.push_back('\0');
+      key_.append(label.Value());
+      key_.push_back('\0');
+    }
+
+    auto it = metric.series.find(key_);
+    if (it == metric.series.end()) {
+      Series series;
+      for (const auto& label : labels) {
+        if (!is_kept(label)) continue;
+        series.attributes.emplace_back(label.Name(), label.Value());
+      }
+      it = metric.series.emplace(key_, std::move(series)).first;
+    }
+
+    auto& series = it->second;
+    if (series.last_render != aggregator_.render_) {
+      // The first of the summed values of this export
+      series.last_render = aggregator_.render_;
+      series.int_gauge = 0;
+      series.double_gauge = 0;
+      series.is_double_gauge = false;
+      series.has_value = false;
+      std::fill(series.current.begin(), series.current.end(), 0);
+    }
+    return series;
+  }
+
+  static void AddHistogram(Series& series, std::string_view path,
+                           HistogramView histogram) {
+    const auto bucket_count = histogram.GetBucketCount();
+    bool is_same_bounds = series.bounds.size() == bucket_count;
+    for (std::size_t i = 0; is_same_bounds && i < bucket_count; ++i) {
+      is_same_bounds = series.bounds[i] == histogram.GetUpperBoundAt(i);
+    }
+
+    if (!is_same_bounds) {
+      if (series.has_value) {
+        LOG_LIMITED_WARNING()
+            << "Histograms of the series of '" << path
+            << "' have different bounds, skipping some of them in the OTLP "
+               "export";
+        return;
+      }
+      // The first histogram of the series, or the bounds were changed
+      series.bounds.resize(bucket_count);
+      for (std::size_t i = 0; i < bucket_count; ++i) {
+        series.bounds[i] = histogram.GetUpperBoundAt(i);
+      }
+      series.current.assign(bucket_count + 1, 0);
+      series.committed.clear();
+    }
+
+    for (std::size_t i = 0; i < bucket_count; ++i) {
+      series.current[i] += histogram.GetValueAt(i);
+    }
+    series.current[bucket_count] += histogram.GetValueAtInf();
+  }
+
+  OtlpMetricsAggregator& aggregator_;
+  std::string key_;
+};
+
+OtlpMetricsAggregator::OtlpMetricsAggregator(OtlpMetricsSettings settings,
+                                             TimePoint start_time)
+    : settings_(std::move(settings)),
+      committed_time_(start_time),
+      render_time_(start_time) {}
+
+OtlpMetricsAggregator::~OtlpMetricsAggregator() = default;
+
+std::string OtlpMetricsAggregator::Render(const Storage& storage,
+                                          TimePoint now) {
+  ++render_;
+  render_time_ = now;
+  {
+    Builder builder{*this};
+    storage.VisitMetrics(builder);
+  }
+
+  // The series that are gone are not reported anymore
+  for (auto& [path, metric] : metrics_) {
+    utils::EraseIf(metric.series, [this](const auto& item) {
+      return item.second.last_render != render_;
+    });
+  }
+  utils::EraseIf(metrics_,
+                 [](const auto& item) { return item.second.series.empty(); });
+
+  formats::json::StringBuilder builder;
+  {
+    const formats::json::StringBuilder::ObjectGuard request_guard{builder};
+    builder.Key("resourceMetrics");
+    const formats::json::StringBuilder::ArrayGuard resources_guard{builder};
+    const formats::json::StringBuilder::ObjectGuard resource_metrics_guard{
+        builder};
+
+    builder.Key("resource");
+    {
+      const formats::json::StringBuilder::ObjectGuard resource_guard{builder};
+      builder.Key("attributes");
+      const formats::json::StringBuilder::ArrayGuard attributes_guard{builder};
+      WriteStringAttribute(builder, "service.name", settings_.service_name);
+    }
+
+    builder.Key("scopeMetrics");
+    const formats::json::StringBuilder::ArrayGuard scopes_guard{builder};
+    const formats::json::StringBuilder::ObjectGuard scope_metrics_guard{
+        builder};
+    builder.Key("scope");
+    {
+      const formats::json::StringBuilder::ObjectGuard scope_guard{builder};
+      builder.Key("name");
+      builder.WriteString("userver");
+    }
+
+    builder.Key("metrics");
+    const formats::json::StringBuilder::ArrayGuard metrics_guard{builder};
+    std::vector<const Series*> changed;
+    for (const auto& [path, metric] : metrics_) {
+      changed.clear();
+      for (const auto& [key, series] : metric.series) {
+        bool is_changed = metric.kind == Kind::kGauge;
+        for (std::size_t i = 0; !is_changed && i < series.current.size();
+             ++i) {
+          is_changed = DeltaAt(series.current, series.committed, i) != 0;
+        }
+        if (is_changed) changed.push_back(&series);
+      }
+      if (changed.empty()) continue;
+
+      const formats::json::StringBuilder::ObjectGuard metric_guard{builder};
+      builder.Key("name");
+      builder.WriteString(path);
+
+      switch (metric.kind) {
+        case Kind::kGauge:
+          builder.Key("gauge");
+          break;
+        case Kind::kSum:
+          builder.Key("sum");
+          break;
+        case Kind::kHistogram:
+          builder.Key("histogram");
+          break;
+      }
+      const formats::json::StringBuilder::ObjectGuard data_guard{builder};
+      if (metric.kind == Kind::kSum) {
+        builder.Key("isMonotonic");
+        builder.WriteBool(true);
+      }
+      if (metric.kind != Kind::kGauge) {
+        builder.Key("aggregationTemporality");
+        builder.WriteInt64(kDeltaTemporality);
+      }
+
+      builder.Key("dataPoints");
+      const formats::json::StringBuilder::ArrayGuard points_guard{builder};
+      for (const auto* series : changed) {
+        WritePoint(builder, metric.kind, *series);
+      }
+    }
+  }
+  return builder.GetString();
+}
+
+void OtlpMetricsAggregator::WritePoint(formats::json::StringBuilder& builder,
+                                       Kind kind, const Series& series) const {
+  const formats::json::StringBuilder::ObjectGuard point_guard{builder};
+  builder.Key("attributes");
+  {
+    const formats::json::StringBuilder::ArrayGuard attributes_guard{builder};
+    for (const auto& [key, value] : series.attributes) {
+      WriteStringAttribute(builder, key, value);
+    }
+  }
+
+  if (kind != Kind::kGauge) {
+    WriteTime(builder, "startTimeUnixNano", committed_time_);
+  }
+  WriteTime(builder, "timeUnixNano", render_time_);
+
+  const auto delta_at = [&series](std::size_t i) {
+    return DeltaAt(series.current, series.committed, i);
+  };
+  switch (kind) {
+    case Kind::kGauge:
+      if (series.is_double_gauge) {
+        builder.Key("asDouble");
+        builder.WriteDouble(series.double_gauge);
+      } else {
+        builder.Key("asInt");
+        builder.WriteString(std::to_string(series.int_gauge));
+      }
+      break;
+    case Kind::kSum:
+      builder.Key("asInt");
+      WriteUInt64String(builder, delta_at(0));
+      break;
+    case Kind::kHistogram: {
+      std::uint64_t count = 0;
+      builder.Key("bucketCounts");
+      {
+        const formats::json::StringBuilder::ArrayGuard counts_guard{builder};
+        for (std::size_t i = 0; i < series.current.size(); ++i) {
+          const auto delta = delta_at(i);
+          count += delta;
+          WriteUInt64String(builder, delta);
+        }
+      }
+      builder.Key("explicitBounds");
+      {
+        const formats::json::StringBuilder::ArrayGuard bounds_guard{builder};
+        for (const auto bound : series.bounds) builder.WriteDouble(bound);
+      }
+      builder.Key("count");
+      WriteUInt64String(builder, count);
+      break;
+    }
+  }
+}
+
+void OtlpMetricsAggregator::Commit() {
+  for (auto& [path, metric] : metrics_) {
+    for (auto& [key, series] : metric.series) {
+      if (series.last_render == render_) series.committed = series.current;
+    }
+  }
+  committed_time_ = render_time_;
+}
+
+}  // namespace utils::statistics::impl
+
+USERVER_NAMESPACE_END
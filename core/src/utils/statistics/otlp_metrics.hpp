@@ -0,0 +1,95 @@
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <map>
+#include <optional>
+#include <string>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+#include <userver/utils/statistics/fwd.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace formats::json {
+class StringBuilder;
+}  // namespace formats::json
+
+namespace utils::statistics::impl {
+
+struct OtlpMetricsSettings final {
+  std::string service_name;
+
+  // Labels that are kept, the series that differ only in the other labels
+  // are summed. All the labels are kept if not set.
+  std::optional<std::unordered_set<std::string>> label_allow_list;
+};
+
+/// @brief Pre-aggregates the metrics of utils::statistics::Storage and
+/// renders them as an OTLP/HTTP JSON ExportMetricsServiceRequest.
+///
+/// Rates and histograms are written with the delta temporality: the
+/// difference from the last committed export, the series without changes
+/// are omitted. Gauges are written as is. The series that become equal
+/// after dropping the labels outside of the allow-list are summed.
+///
+/// Not thread-safe.
+class OtlpMetricsAggregator final {
+ public:
+  using TimePoint = std::chrono::system_clock::time_point;
+
+  OtlpMetricsAggregator(OtlpMetricsSettings settings, TimePoint start_time);
+  ~OtlpMetricsAggregator();
+
+  /// Reads the metrics and renders the deltas since the last Commit()
+  std::string Render(const Storage& storage, TimePoint now);
+
+  /// Marks the last rendered export as delivered, the next one is rendered
+  /// relative to it
+  void Commit();
+
+ private:
+  class Builder;
+
+  enum class Kind { kGauge, kSum, kHistogram };
+
+  struct Series final {
+    std::vector<std::pair<std::string, std::string>> attributes;
+    std::uint64_t last_render{0};
+    // Whether a value was added in the last render
+    bool has_value{false};
+
+    // kGauge
+    std::int64_t int_gauge{0};
+    double double_gauge{0};
+    bool is_double_gauge{false};
+
+    // kSum and kHistogram: the cumulative values of the current and of the
+    // last committed export, the last counter is the histogram overflow
+    std::vector<double> bounds;
+    std::vector<std::uint64_t> current;
+    std::vector<std::uint64_t> committed;
+  };
+
+  struct Metric final {
+    Kind kind{Kind::kGauge};
+    // The key is the names and values of the kept labels delimited by '\0'
+    std::map<std::string, Series, std::less<>> series;
+  };
+
+  void WritePoint(formats::json::StringBuilder& builder, Kind kind,
+                  const Series& series) const;
+
+  const OtlpMetricsSettings settings_;
+  std::map<std::string, Metric, std::less<>> metrics_;
+  std::uint64_t render_{0};
+  TimePoint committed_time_;
+  TimePoint render_time_;
+};
+
+}  // namespace utils::statistics::impl
+
+USERVER_NAMESPACE_END
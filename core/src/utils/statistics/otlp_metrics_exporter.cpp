@@ -0,0 +1,123 @@
+#include <userver/utils/statistics/otlp_metrics_exporter.hpp>
+
+#include <optional>
+#include <unordered_set>
+#include <vector>
+
+#include <userver/clients/http/component.hpp>
+#include <userver/components/component.hpp>
+#include <userver/components/statistics_storage.hpp>
+#include <userver/http/common_headers.hpp>
+#include <userver/yaml_config/merge_schemas.hpp>
+
+#include <utils/statistics/otlp_metrics.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace components {
+
+namespace {
+
+utils::statistics::impl::OtlpMetricsSettings ParseSettings(
+    const ComponentConfig& config) {
+  utils::statistics::impl::OtlpMetricsSettings settings;
+  settings.service_name = config["service-name"].As<std::string>();
+  if (!config["label-allow-list"].IsMissing()) {
+    const auto labels =
+        config["label-allow-list"].As<std::vector<std::string>>();
+    settings.label_allow_list.emplace(labels.begin(), labels.end());
+  }
+  return settings;
+}
+
+utils::PeriodicTask::Settings MakeExportSettings(
+    const ComponentConfig& config, const ComponentContext& context) {
+  utils::PeriodicTask::Settings settings{
+      config["export-period"].As<std::chrono::milliseconds>(
+          std::chrono::seconds{15}),
+      {},
+      logging::Level::kDebug};
+  const auto task_processor =
+      config["task-processor"].As<std::optional<std::string>>();
+  if (task_processor) {
+    settings.task_processor = &context.GetTaskProcessor(*task_processor);
+  }
+  return settings;
+}
+
+}  // namespace
+
+OtlpMetricsExporter::OtlpMetricsExporter(const ComponentConfig& config,
+                                         const ComponentContext& context)
+    : ComponentBase(config, context),
+      storage_(context.FindComponent<StatisticsStorage>().GetStorage()),
+      http_client_(context
+                       .FindComponent<HttpClient>(
+                           config["http-client"].As<std::string>(
+                               HttpClient::kName))
+                       .GetHttpClient()),
+      endpoint_(config["endpoint"].As<std::string>()),
+      timeout_(config["timeout"].As<std::chrono::milliseconds>(
+          std::chrono::seconds{5})),
+      aggregator_(
+          std::make_unique<utils::statistics::impl::OtlpMetricsAggregator>(
+              ParseSettings(config), std::chrono::system_clock::now())) {
+  export_task_.Start("otlp-metrics-export",
+                     MakeExportSettings(config, context), [this] { Export(); });
+}
+
+OtlpMetricsExporter::~OtlpMetricsExporter() { export_task_.Stop(); }
+
+void OtlpMetricsExporter::Export() {
+  auto body = aggregator_->Render(storage_, std::chrono::system_clock::now());
+  auto response =
+      http_client_.CreateRequest()
+          .post(endpoint_, std::move(body))
+          .headers({{USERVER_NAMESPACE::http::headers::kContentType,
+                     "application/json"}})
+          .timeout(timeout_)
+          .perform();
+  response->raise_for_status();
+  aggregator_->Commit();
+}
+
+yaml_config::Schema OtlpMetricsExporter::GetStaticConfigSchema() {
+  return yaml_config::MergeSchemas<ComponentBase>(R"(
+type: object
+description: Component that periodically pushes the metrics to an OpenTelemetry collector
+additionalProperties: false
+properties:
+    endpoint:
+        type: string
+        description: URL of the OTLP/HTTP metrics receiver
+    service-name:
+        type: string
+        description: value of the service.name resource attribute
+    export-period:
+        type: string
+        description: period of the export
+        defaultDescription: 15s
+    timeout:
+        type: string
+        description: timeout of the export request
+        defaultDescription: 5s
+    label-allow-list:
+        type: array
+        description: labels to keep, all the labels are kept if not set
+        items:
+            type: string
+            description: label name
+    http-client:
+        type: string
+        description: name of the components::HttpClient component
+        defaultDescription: http-client
+    task-processor:
+        type: string
+        description: task processor to run the export on
+        defaultDescription: the task processor of the component
+)");
+}
+
+}  // namespace components
+
+USERVER_NAMESPACE_END
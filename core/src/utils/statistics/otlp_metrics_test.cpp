@@ -0,0 +1,123 @@
+#include <utils/statistics/otlp_metrics.hpp>
+
+#include <userver/formats/json/inline.hpp>
+#include <userver/formats/json/serialize.hpp>
+#include <userver/utest/utest.hpp>
+#include <userver/utils/statistics/histogram.hpp>
+#include <userver/utils/statistics/storage.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+using utils::statistics::impl::OtlpMetricsAggregator;
+
+const OtlpMetricsAggregator::TimePoint kStart{std::chrono::seconds{100}};
+
+formats::json::Value GetMetrics(const std::string& request) {
+  const auto json = formats::json::FromString(request);
+  return json["resourceMetrics"][0]["scopeMetrics"][0]["metrics"];
+}
+
+formats::json::Value FindMetric(const formats::json::Value& metrics,
+                                std::string_view name) {
+  for (const auto& metric : metrics) {
+    if (metric["name"].As<std::string>() == name) return metric;
+  }
+  return {};
+}
+
+formats::json::Value MakeAttribute(std::string_view key,
+                                   std::string_view value) {
+  return formats::json::MakeObject(
+      "key", key, "value", formats::json::MakeObject("stringValue", value));
+}
+
+}  // namespace
+
+UTEST(OtlpMetrics, Deltas) {
+  utils::statistics::Storage storage;
+  utils::statistics::Rate requests{10};
+  utils::statistics::Histogram timings{std::vector<double>{1, 10}};
+  timings.Account(5, 3);
+  auto holder =
+      storage.RegisterWriter("test", [&](utils::statistics::Writer& writer) {
+        writer["requests"] = requests;
+        writer["timings"] = timings;
+      });
+
+  OtlpMetricsAggregator aggregator{{"my-service", {}}, kStart};
+  {
+    const auto request =
+        aggregator.Render(storage, kStart + std::chrono::seconds{1});
+    const auto json = formats::json::FromString(request);
+    EXPECT_EQ(json["resourceMetrics"][0]["resource"]["attributes"][0],
+              MakeAttribute("service.name", "my-service"));
+
+    const auto metrics = GetMetrics(request);
+    const auto sum = FindMetric(metrics, "test.requests")["sum"];
+    EXPECT_EQ(sum["aggregationTemporality"].As<int>(), 1);
+    EXPECT_TRUE(sum["isMonotonic"].As<bool>());
+    EXPECT_EQ(sum["dataPoints"][0]["asInt"].As<std::string>(), "10");
+    EXPECT_EQ(sum["dataPoints"][0]["startTimeUnixNano"].As<std::string>(),
+              "100000000000");
+    EXPECT_EQ(sum["dataPoints"][0]["timeUnixNano"].As<std::string>(),
+              "101000000000");
+
+    const auto histogram =
+        FindMetric(metrics, "test.timings")["histogram"]["dataPoints"][0];
+    EXPECT_EQ(histogram["count"].As<std::string>(), "3");
+    EXPECT_EQ(histogram["bucketCounts"],
+              formats::json::MakeArray("0", "3", "0"));
+    EXPECT_EQ(histogram["explicitBounds"], formats::json::MakeArray(1.0, 10.0));
+  }
+  aggregator.Commit();
+
+  requests.value += 5;
+  {
+    const auto metrics = GetMetrics(
+        aggregator.Render(storage, kStart + std::chrono::seconds{2}));
+    const auto points =
+        FindMetric(metrics, "test.requests")["sum"]["dataPoints"];
+    EXPECT_EQ(points[0]["asInt"].As<std::string>(), "5");
+    EXPECT_EQ(points[0]["startTimeUnixNano"].As<std::string>(),
+              "101000000000");
+    // Unchanged since the last export
+    EXPECT_TRUE(FindMetric(metrics, "test.timings").IsNull());
+  }
+
+  // Not committed, the next export contains the deltas of this one
+  requests.value += 1;
+  {
+    const auto metrics = GetMetrics(
+        aggregator.Render(storage, kStart + std::chrono::seconds{3}));
+    const auto points =
+        FindMetric(metrics, "test.requests")["sum"]["dataPoints"];
+    EXPECT_EQ(points[0]["asInt"].As<std::string>(), "6");
+  }
+}
+
+UTEST(OtlpMetrics, LabelAllowList) {
+  utils::statistics::Storage storage;
+  auto holder =
+      storage.RegisterWriter("test", [&](utils::statistics::Writer& writer) {
+        writer.ValueWithLabels(1, {{"host", "a"}, {"kind", "x"}});
+        writer.ValueWithLabels(2, {{"host", "b"}, {"kind", "x"}});
+        writer.ValueWithLabels(4, {{"host", "c"}, {"kind", "y"}});
+      });
+
+  OtlpMetricsAggregator aggregator{{"my-service", {{"kind"}}}, kStart};
+  const auto metrics = GetMetrics(aggregator.Render(storage, kStart));
+  ASSERT_EQ(metrics.GetSize(), 1);
+
+  const auto points = metrics[0]["gauge"]["dataPoints"];
+  ASSERT_EQ(points.GetSize(), 2);
+  EXPECT_EQ(points[0]["attributes"],
+            formats::json::MakeArray(MakeAttribute("kind", "x")));
+  EXPECT_EQ(points[0]["asInt"].As<std::string>(), "3");
+  EXPECT_EQ(points[1]["attributes"],
+            formats::json::MakeArray(MakeAttribute("kind", "y")));
+  EXPECT_EQ(points[1]["asInt"].As<std::string>(), "4");
+}
+
+USERVER_NAMESPACE_END
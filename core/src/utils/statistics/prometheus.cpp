@@ -7,6 +7,7 @@
 #include <fmt/compile.h>
 #include <fmt/format.h>
 
+#include <userver/utils/algo.hpp>
 #include <userver/utils/impl/transparent_hash.hpp>
 #include <userver/utils/overloaded.hpp>
 #include <userver/utils/statistics/fmt.hpp>
@@ -18,14 +19,75 @@ namespace utils::statistics {
 
 namespace impl {
 
+// The rendered names and labels of the metrics are kept between the scrapes,
+// so that the steady state of scraping does not convert the names and does
+// not allocate except for the result.
+struct PrometheusCache final {
+  struct Name final {
+    std::string prometheus_name;
+    std::uint64_t last_scrape{0};
+  };
+
+  // `prometheus_name{labels}` of a metric path with labels
+  struct Series final {
+    std::string prefix;
+    std::uint64_t last_scrape{0};
+  };
+
+  // Entries that were not written for this number of scrapes are evicted
+  static constexpr std::uint64_t kMaxUnusedScrapes = 16;
+
+  void StartScrape() {
+    ++scrape;
+    buf.clear();
+  }
+
+  void FinishScrape() {
+    if (scrape % kMaxUnusedScrapes != 0) return;
+    const auto is_unused = [this](const auto& item) {
+      return scrape - item.second.last_scrape >= kMaxUnusedScrapes;
+    };
+    utils::EraseIf(names, is_unused);
+    utils::EraseIf(series, is_unused);
+  }
+
+  utils::impl::TransparentMap<std::string, Name> names;
+  // The key is the path and the names and values of the labels delimited
+  // by '\0'
+  utils::impl::TransparentMap<std::string, Series> series;
+  std::string series_key;
+  fmt::memory_buffer buf;
+  std::uint64_t scrape{0};
+};
+
 namespace {
 
 enum class Typed { kYes, kNo };
 
+template <typename Output>
+void AppendLabels(Output& out, utils::statistics::LabelsSpan labels) {
+  bool sep = false;
+  for (const auto& label : labels) {
+    if (sep) {
+      out.push_back(',');
+    }
+    fmt::format_to(std::back_inserter(out), FMT_COMPILE("{}=\""),
+                   impl::ToPrometheusLabel(label.Name()));
+    const auto& value = label.Value();
+    std::replace_copy(value.cbegin(), value.cend(), std::back_inserter(out),
+                      '"', '\'');
+    out.push_back('"');
+    sep = true;
+  }
+}
+
 template <Typed IsTyped>
 class FormatBuilder final : public utils::statistics::BaseFormatBuilder {
  public:
-  explicit FormatBuilder() = default;
+  explicit FormatBuilder(PrometheusCache& cache)
+      : cache_(cache), buf_(cache.buf) {
+    cache_.StartScrape();
+  }
 
   void HandleMetric(std::string_view path, utils::statistics::LabelsSpan labels,
                     const MetricValue& value) override {
@@ -34,12 +96,20 @@ class FormatBuilder final : public utils::statistics::BaseFormatBuilder {
       return;
     }
 
-    DumpMetricNameAndType(path, value);
-    DumpLabels(labels);
+    auto& name = GetName(path);
+    if (name.last_scrape != cache_.scrape) {
+      name.last_scrape = cache_.scrape;
+      DumpMetricType(name.prometheus_name, value);
+    }
+    buf_.append(GetSeriesPrefix(path, labels, name.prometheus_name));
     fmt::format_to(std::back_inserter(buf_), FMT_COMPILE(" {}\n"), value);
   }
 
-  std::string Release() { return fmt::to_string(buf_); }
+  std::string Release() {
+    std::string result(buf_.data(), buf_.size());
+    cache_.FinishScrape();
+    return result;
+  }
 
  private:
   void AppendHistogramMetric(std::string_view metric_suffix,
@@ -57,7 +127,7 @@ class FormatBuilder final : public utils::statistics::BaseFormatBuilder {
       if (!upper_bound.empty()) {
         fmt::format_to(std::back_inserter(buf_), ",");
       }
-      DumpLabelsRaw(labels);
+      AppendLabels(buf_, labels);
     }
     fmt::format_to(std::back_inserter(buf_), FMT_COMPILE("}} {}\n"), value);
   }
@@ -67,7 +137,7 @@ class FormatBuilder final : public utils::statistics::BaseFormatBuilder {
                        const MetricValue& value) {
     static constexpr std::string_view kBucket = "bucket";
 
-    const auto prometheus_name = impl::ToPrometheusName(path);
+    const std::string_view prometheus_name = GetName(path).prometheus_name;
     DumpMetricType(prometheus_name, value);
 
     auto histogram = value.AsHistogram();
@@ -87,17 +157,43 @@ class FormatBuilder final : public utils::statistics::BaseFormatBuilder {
                           fmt::to_string(histogram.GetTotalCount()), labels);
   }
 
-  void DumpMetricNameAndType(std::string_view name, const MetricValue& value) {
-    if (const auto* const converted =
-            utils::impl::FindTransparentOrNullptr(metrics_, name)) {
-      buf_.append(*converted);
-      return;
+  PrometheusCache::Name& GetName(std::string_view path) {
+    if (auto* const name =
+            utils::impl::FindTransparentOrNullptr(cache_.names, path)) {
+      return *name;
     }
+    return cache_.names
+        .emplace(path, PrometheusCache::Name{
+                           impl::ToPrometheusName(path)})
+        .first->second;
+  }
 
-    auto prometheus_name = impl::ToPrometheusName(name);
-    DumpMetricType(prometheus_name, value);
-    buf_.append(prometheus_name);
-    metrics_.emplace(name, std::move(prometheus_name));
+  std::string_view GetSeriesPrefix(std::string_view path,
+                                   utils::statistics::LabelsSpan labels,
+                                   std::string_view prometheus_name) {
+    auto& key = cache_.series_key;
+    key.assign(path);
+    for (const auto& label : labels) {
+      key.push_back('\0');
+      key.append(label.Name());
+      key.push_back('\0');
+      key.append(label.Value());
+    }
+
+    auto* series =
+        utils::impl::FindTransparentOrNullptr(cache_.series, key);
+    if (!series) {
+      std::string prefix{prometheus_name};
+      prefix.push_back('{');
+      AppendLabels(prefix, labels);
+      prefix.push_back('}');
+      series = &cache_.series
+                    .emplace(key, PrometheusCache::Series{
+                                      std::move(prefix)})
+                    .first->second;
+    }
+    series->last_scrape = cache_.scrape;
+    return series->prefix;
   }
 
   void DumpMetricType([[maybe_unused]] std::string_view prometheus_name,
@@ -122,30 +218,8 @@ class FormatBuilder final : public utils::statistics::BaseFormatBuilder {
                    prometheus_name, type);
   }
 
-  void DumpLabelsRaw(utils::statistics::LabelsSpan labels) {
-    bool sep = false;
-    for (const auto& label : labels) {
-      if (sep) {
-        buf_.push_back(',');
-      }
-      fmt::format_to(std::back_inserter(buf_), FMT_COMPILE("{}=\""),
-                     impl::ToPrometheusLabel(label.Name()));
-      const auto& value = label.Value();
-      std::replace_copy(value.cbegin(), value.cend(), std::back_inserter(buf_),
-                        '"', '\'');
-      buf_.push_back('"');
-      sep = true;
-    }
-  }
-
-  void DumpLabels(utils::statistics::LabelsSpan labels) {
-    buf_.push_back('{');
-    DumpLabelsRaw(labels);
-    buf_.push_back('}');
-  }
-
-  fmt::memory_buffer buf_;
-  utils::impl::TransparentMap<std::string, std::string> metrics_;
+  PrometheusCache& cache_;
+  fmt::memory_buffer& buf_;
 };
 
 }  // namespace
@@ -182,9 +256,27 @@ std::string ToPrometheusLabel(std::string_view name) {
 
 }  // namespace impl
 
+PrometheusFormatCache::PrometheusFormatCache()
+    : impl_(std::make_unique<impl::PrometheusCache>()) {}
+
+PrometheusFormatCache::PrometheusFormatCache(
+    PrometheusFormatCache&&) noexcept = default;
+
+PrometheusFormatCache& PrometheusFormatCache::operator=(
+    PrometheusFormatCache&&) noexcept = default;
+
+PrometheusFormatCache::~PrometheusFormatCache() = default;
+
 std::string ToPrometheusFormat(const utils::statistics::Storage& statistics,
                                const utils::statistics::Request& request) {
-  impl::FormatBuilder<impl::Typed::kYes> builder{};
+  PrometheusFormatCache cache;
+  return ToPrometheusFormat(statistics, request, cache);
+}
+
+std::string ToPrometheusFormat(const utils::statistics::Storage& statistics,
+                               const utils::statistics::Request& request,
+                               PrometheusFormatCache& cache) {
+  impl::FormatBuilder<impl::Typed::kYes> builder{*cache.impl_};
   statistics.VisitMetrics(builder, request);
   return builder.Release();
 }
@@ -192,7 +284,14 @@ std::string ToPrometheusFormat(const utils::statistics::Storage& statistics,
 std::string ToPrometheusFormatUntyped(
     const utils::statistics::Storage& statistics,
     const utils::statistics::Request& request) {
-  impl::FormatBuilder<impl::Typed::kNo> builder{};
+  PrometheusFormatCache cache;
+  return ToPrometheusFormatUntyped(statistics, request, cache);
+}
+
+std::string ToPrometheusFormatUntyped(
+    const utils::statistics::Storage& statistics,
+    const utils::statistics::Request& request, PrometheusFormatCache& cache) {
+  impl::FormatBuilder<impl::Typed::kNo> builder{*cache.impl_};
   statistics.VisitMetrics(builder, request);
   return builder.Release();
 }
@@ -409,6 +409,38 @@ child{application="processing"} 8
   }
 }
 
+UTEST(MetricsPrometheus, Cache) {
+  utils::statistics::Storage storage;
+  int scrape = 0;
+  auto holder =
+      storage.RegisterWriter("test", [&](utils::statistics::Writer& writer) {
+        writer["gauge"].ValueWithLabels(scrape, {"kind", "a"});
+        writer["gauge"].ValueWithLabels(scrape * 2, {"kind", "b"});
+        // The labels of this metric change and its old cache entries are
+        // evicted
+        writer["rate"].ValueWithLabels(utils::statistics::Rate{42},
+                                       {"scrape", std::to_string(scrape)});
+      });
+
+  const auto request =
+      utils::statistics::Request::MakeWithPrefix({}, {{"app", "test"}});
+  utils::statistics::PrometheusFormatCache cache;
+  for (; scrape < 40; ++scrape) {
+    EXPECT_EQ(ToPrometheusFormat(storage, request, cache),
+              ToPrometheusFormat(storage, request));
+    EXPECT_EQ(ToPrometheusFormatUntyped(storage, request, cache),
+              ToPrometheusFormatUntyped(storage, request));
+  }
+
+  const auto expected = R"(# TYPE test_gauge gauge
+test_gauge{app="test",kind="a"} 40
+test_gauge{app="test",kind="b"} 80
+# TYPE test_rate counter
+test_rate{app="test",scrape="40"} 42
+)";
+  EXPECT_EQ(ToPrometheusFormat(storage, request, cache), expected);
+}
+
 }  // namespace utils::statistics::impl
 
 USERVER_NAMESPACE_END
@@ -0,0 +1,41 @@
+#include <utils/threads_count.hpp>
+
+#include <string>
+
+#include <userver/hostinfo/cpu_limit.hpp>
+#include <userver/logging/log.hpp>
+#include <userver/yaml_config/yaml_config.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace utils {
+
+namespace {
+
+constexpr std::string_view kAutoThreads = "auto";
+
+}  // namespace
+
+std::size_t ParseThreadsCount(const yaml_config::YamlConfig& value,
+                              double cpu_ratio) {
+  if (value.IsString() && value.As<std::string>() == kAutoThreads) {
+    const auto threads = hostinfo::CpuLimitThreads(cpu_ratio);
+    LOG_INFO() << "Using " << threads << " threads for '" << value.GetPath()
+               << "' (CPU limit "
+               << (hostinfo::CpuLimit() ? std::to_string(*hostinfo::CpuLimit())
+                                        : "is unknown")
+               << ", ratio " << cpu_ratio << ')';
+    return threads;
+  }
+  return value.As<std::size_t>();
+}
+
+std::size_t ParseThreadsCount(const yaml_config::YamlConfig& value,
+                              double cpu_ratio, std::size_t default_value) {
+  if (value.IsMissing()) return default_value;
+  return ParseThreadsCount(value, cpu_ratio);
+}
+
+}  // namespace utils
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,23 @@
+#pragma once
+
+#include <cstddef>
+
+#include <userver/yaml_config/fwd.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace utils {
+
+/// Parses a threads count static config option that is either a number or
+/// `auto`. `auto` is resolved into hostinfo::CpuLimitThreads(cpu_ratio).
+/// @throws yaml_config::Exception if the option is missing or invalid
+std::size_t ParseThreadsCount(const yaml_config::YamlConfig& value,
+                              double cpu_ratio);
+
+/// @overload Returns `default_value` if the option is missing
+std::size_t ParseThreadsCount(const yaml_config::YamlConfig& value,
+                              double cpu_ratio, std::size_t default_value);
+
+}  // namespace utils
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,58 @@
+#include <string>
+
+#include <google/protobuf/arena.h>
+#include <google/protobuf/struct.pb.h>
+
+#include <userver/utils/assert.hpp>
+
+#include <benchmark/benchmark.h>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+// A deeply nested message, similar to the requests parsed by CallData
+std::string MakeSerializedStruct(std::size_t fields_count) {
+  google::protobuf::Struct message;
+  for (std::size_t i = 0; i < fields_count; ++i) {
+    auto& field = (*message.mutable_fields())["field" + std::to_string(i)];
+    auto& list = *field.mutable_list_value();
+    for (int j = 0; j < 4; ++j) {
+      auto& inner = *list.add_values()->mutable_struct_value();
+      (*inner.mutable_fields())["name"].set_string_value("value");
+      (*inner.mutable_fields())["number"].set_number_value(j);
+    }
+  }
+  return message.SerializeAsString();
+}
+
+}  // namespace
+
+void ParseNestedMessageHeap(benchmark::State& state) {
+  const auto serialized = MakeSerializedStruct(state.range(0));
+
+  for ([[maybe_unused]] auto _ : state) {
+    google::protobuf::Struct message;
+    const bool parsed = message.ParseFromString(serialized);
+    UINVARIANT(parsed, "Failed to parse");
+    benchmark::DoNotOptimize(message);
+  }
+}
+
+void ParseNestedMessageArena(benchmark::State& state) {
+  const auto serialized = MakeSerializedStruct(state.range(0));
+
+  for ([[maybe_unused]] auto _ : state) {
+    google::protobuf::Arena arena;
+    auto* message =
+        google::protobuf::Arena::Create<google::protobuf::Struct>(&arena);
+    const bool parsed = message->ParseFromString(serialized);
+    UINVARIANT(parsed, "Failed to parse");
+    benchmark::DoNotOptimize(message);
+  }
+}
+
+BENCHMARK(ParseNestedMessageHeap)->RangeMultiplier(4)->Range(4, 256);
+BENCHMARK(ParseNestedMessageArena)->RangeMultiplier(4)->Range(4, 256);
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,145 @@
+#include <atomic>
+#include <cstddef>
+#include <utility>
+
+#include <userver/dynamic_config/test_helpers.hpp>
+#include <userver/engine/async.hpp>
+#include <userver/engine/get_all.hpp>
+#include <userver/engine/run_standalone.hpp>
+#include <userver/engine/task/task_with_result.hpp>
+#include <userver/ugrpc/tests/service.hpp>
+#include <userver/utils/assert.hpp>
+#include <userver/utils/fixed_array.hpp>
+
+#include <tests/unit_test_client.usrv.pb.hpp>
+#include <tests/unit_test_service.usrv.pb.hpp>
+
+#include <benchmark/benchmark.h>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace ugrpc {
+
+namespace {
+
+// Measures the server side: every async operation of a call is a round-trip
+// through the completion queue thread and a wake-up of the handler coroutine.
+// Arguments: worker threads, concurrent clients, listeners per queue.
+
+class RpsService final : public sample::ugrpc::UnitTestServiceBase {
+ public:
+  void SayHello(SayHelloCall& call,
+                sample::ugrpc::GreetingRequest&& request) override {
+    sample::ugrpc::GreetingResponse response;
+    response.set_name(std::move(*request.mutable_name()));
+    call.Finish(response);
+  }
+
+  void Chat(ChatCall& call) override {
+    sample::ugrpc::StreamGreetingRequest request;
+    sample::ugrpc::StreamGreetingResponse response;
+    while (call.Read(request)) {
+      response.set_number(request.number());
+      call.Write(response);
+    }
+    call.Finish();
+  }
+};
+
+constexpr std::size_t kMessagesPerStream = 64;
+
+server::ServerConfig MakeServerConfig(std::size_t listeners_per_queue) {
+  server::ServerConfig config;
+  config.listeners_per_queue = listeners_per_queue;
+  return config;
+}
+
+template <typename Payload>
+void RunClients(benchmark::State& state, Payload payload) {
+  const auto threads = state.range(0);
+  const auto clients_count = static_cast<std::size_t>(state.range(1));
+  const auto listeners_per_queue = static_cast<std::size_t>(state.range(2));
+
+  engine::RunStandalone(threads, [&] {
+    tests::Service<RpsService> service(dynamic_config::MakeDefaultStorage({}),
+                                       MakeServerConfig(listeners_per_queue));
+    auto clients = utils::GenerateFixedArray(clients_count, [&](auto) {
+      return service.MakeClient<sample::ugrpc::UnitTestServiceClient>();
+    });
+
+    std::size_t operations = 0;
+    for ([[maybe_unused]] auto _ : state) {
+      std::atomic<std::size_t> batch_operations{0};
+      auto tasks = utils::GenerateFixedArray(clients_count, [&](auto i) {
+        return engine::AsyncNoSpan([&, i] {
+          batch_operations += payload(clients[i]);
+        });
+      });
+      engine::GetAll(tasks);
+      operations += batch_operations;
+    }
+
+    state.counters["rps"] =
+        benchmark::Counter(operations, benchmark::Counter::kIsRate);
+  });
+}
+
+std::size_t UnaryPayload(sample::ugrpc::UnitTestServiceClient& client) {
+  static constexpr std::size_t kRepetitions = 64;
+  sample::ugrpc::GreetingRequest request;
+  request.set_name("userver");
+  for (std::size_t i = 0; i < kRepetitions; ++i) {
+    auto response = client.SayHello(request).Finish();
+    benchmark::DoNotOptimize(response);
+  }
+  return kRepetitions;
+}
+
+std::size_t StreamPayload(sample::ugrpc::UnitTestServiceClient& client) {
+  auto call = client.Chat();
+  sample::ugrpc::StreamGreetingRequest request;
+  sample::ugrpc::StreamGreetingResponse response;
+  for (std::size_t i = 0; i < kMessagesPerStream; ++i) {
+    request.set_number(static_cast<int>(i));
+    const bool written = call.Write(request);
+    const bool read = call.Read(response);
+    UINVARIANT(written && read, "Behavior broken");
+  }
+  const bool done = call.WritesDone();
+  UINVARIANT(done && !call.Read(response), "Behavior broken");
+  return kMessagesPerStream;
+}
+
+void ApplyArguments(benchmark::internal::Benchmark* b) {
+  for (const auto threads : {2, 4}) {
+    for (const auto clients : {1, 16, 64}) {
+      for (const auto listeners : {1, 4}) {
+        b->Args({threads, clients, listeners});
+      }
+    }
+  }
+}
+
+}  // namespace
+
+void ServerUnaryRps(benchmark::State& state) {
+  RunClients(state, UnaryPayload);
+}
+
+BENCHMARK(ServerUnaryRps)
+    ->Apply(ApplyArguments)
+    ->ArgNames({"threads", "clients", "listeners"})
+    ->Unit(benchmark::kMillisecond);
+
+void ServerStreamRps(benchmark::State& state) {
+  RunClients(state, StreamPayload);
+}
+
+BENCHMARK(ServerStreamRps)
+    ->Apply(ApplyArguments)
+    ->ArgNames({"threads", "clients", "listeners"})
+    ->Unit(benchmark::kMillisecond);
+
+}  // namespace ugrpc
+
+USERVER_NAMESPACE_END
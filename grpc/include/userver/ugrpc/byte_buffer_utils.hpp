@@ -0,0 +1,60 @@
+#pragma once
+
+/// @file userver/ugrpc/byte_buffer_utils.hpp
+/// @brief Utilities for the opaque grpc::ByteBuffer messages of the generic
+/// gRPC services and clients
+
+#include <cstddef>
+
+#include <google/protobuf/message.h>
+#include <grpcpp/support/byte_buffer.h>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace ugrpc {
+
+/// @brief Serialize the message for sending it through a generic service or
+/// client
+/// @throws std::runtime_error if the message cannot be serialized
+grpc::ByteBuffer SerializeToByteBuffer(
+    const google::protobuf::Message& message);
+
+/// @brief Parse the message directly from the slices of `buffer`, without
+/// flattening or consuming them
+///
+/// Allows a proxy to look into the request only as deep as needed for routing:
+/// declare a message with just the routing fields, keeping their numbers from
+/// the full message, and parse the request into it. The rest of the fields are
+/// kept as raw unknown field bytes, without building the nested messages. The
+/// `buffer` can still be forwarded as-is afterwards.
+///
+/// @returns `false` if `buffer` does not contain a valid serialized message
+[[nodiscard]] bool ParseFromByteBuffer(const grpc::ByteBuffer& buffer,
+                                       google::protobuf::Message& message);
+
+namespace impl {
+
+inline std::size_t GetMessageSize(const google::protobuf::Message& message) {
+  return message.ByteSizeLong();
+}
+
+inline std::size_t GetMessageSize(const grpc::ByteBuffer& buffer) {
+  return buffer.Length();
+}
+
+inline const google::protobuf::Message* ToBaseMessage(
+    const google::protobuf::Message& message) noexcept {
+  return &message;
+}
+
+// Opaque messages are not visible to the middleware hooks
+inline const google::protobuf::Message* ToBaseMessage(
+    const grpc::ByteBuffer&) noexcept {
+  return nullptr;
+}
+
+}  // namespace impl
+
+}  // namespace ugrpc
+
+USERVER_NAMESPACE_END
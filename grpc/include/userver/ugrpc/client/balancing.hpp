@@ -0,0 +1,46 @@
+#pragma once
+
+/// @file userver/ugrpc/client/balancing.hpp
+/// @brief @copybrief ugrpc::client::BalancingSettings
+
+#include <chrono>
+#include <cstddef>
+
+#include <userver/formats/parse/to.hpp>
+#include <userver/yaml_config/fwd.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace ugrpc::client {
+
+/// How an RPC picks one of the channels of an endpoint
+enum class BalancingPolicy {
+  /// A random channel
+  kRandom,
+  /// The less loaded of two random channels, by the number of RPCs in flight
+  /// weighted by the smoothed latency of the channel
+  kPowerOfTwoChoices,
+};
+
+BalancingPolicy Parse(const yaml_config::YamlConfig& value,
+                      formats::parse::To<BalancingPolicy>);
+
+/// @brief Balancing of RPCs across the channels of an endpoint
+///
+/// Only makes a difference if ClientFactorySettings::channel_count is greater
+/// than one. The statistics are shared by all the clients of the endpoint.
+struct BalancingSettings final {
+  BalancingPolicy policy{BalancingPolicy::kRandom};
+
+  /// With kPowerOfTwoChoices, a channel is not picked for `ejection_duration`
+  /// after this number of consecutive RPCs failed with UNAVAILABLE, INTERNAL,
+  /// UNKNOWN or DATA_LOSS. Zero disables the ejection.
+  std::size_t ejection_errors{5};
+
+  /// How long an ejected channel is not picked
+  std::chrono::milliseconds ejection_duration{std::chrono::seconds{10}};
+};
+
+}  // namespace ugrpc::client
+
+USERVER_NAMESPACE_END
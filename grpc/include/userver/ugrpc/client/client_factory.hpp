@@ -17,6 +17,7 @@
 #include <userver/utils/statistics/fwd.hpp>
 #include <userver/yaml_config/fwd.hpp>
 
+#include <userver/ugrpc/client/balancing.hpp>
 #include <userver/ugrpc/client/impl/channel_cache.hpp>
 #include <userver/ugrpc/client/impl/client_data.hpp>
 #include <userver/ugrpc/client/middlewares/base.hpp>
@@ -48,6 +49,9 @@ struct ClientFactorySettings final {
   /// Number of underlying channels that will be created for every client
   /// in this factory.
   std::size_t channel_count{1};
+
+  /// Balancing of RPCs across the `channel_count` channels of an endpoint
+  BalancingSettings balancing{};
 };
 
 /// @brief Creates generated gRPC clients. Has a minimal built-in channel cache:
@@ -47,6 +47,9 @@ namespace ugrpc::client {
 /// auth-type | authentication method, see above | -
 /// default-service-config | default service config, see above | -
 /// channel-count | Number of underlying grpc::Channel objects | 1
+/// balancing-policy | how an RPC picks a channel of the endpoint: 'random' or 'p2c' (the less loaded of two random channels) | random
+/// outlier-ejection-errors | with 'p2c', consecutive server errors after which a channel is ejected, 0 to disable | 5
+/// outlier-ejection-duration | with 'p2c', how long an ejected channel is not picked | 10s
 /// middlewares | middlewares names to use | []
 ///
 ///
@@ -0,0 +1,70 @@
+#pragma once
+
+/// @file userver/ugrpc/client/generic_client.hpp
+/// @brief @copybrief ugrpc::client::GenericClient
+
+#include <memory>
+#include <string_view>
+
+#include <grpcpp/client_context.h>
+#include <grpcpp/support/byte_buffer.h>
+
+#include <userver/ugrpc/client/impl/client_data.hpp>
+#include <userver/ugrpc/client/qos.hpp>
+#include <userver/ugrpc/client/rpc.hpp>
+#include <userver/ugrpc/impl/static_metadata.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace ugrpc::client {
+
+/// @brief Allows to call any method of any gRPC service by its name, passing
+/// the messages through as opaque grpc::ByteBuffer without parsing
+///
+/// Created by ClientFactory::MakeClient, same as the code-generated clients.
+/// The client middlewares, deadline propagation, tracing and the `qos`
+/// passed to the call work as usual. The per-method QOS from the dynamic
+/// config is not applied, and the statistics of all the generic RPCs of the
+/// client are accounted together under the `Generic/Generic` method.
+///
+/// Use ugrpc::SerializeToByteBuffer and ugrpc::ParseFromByteBuffer to convert
+/// the messages, if needed. See ugrpc::server::GenericServiceBase for
+/// an example of a proxy.
+class GenericClient final {
+ public:
+  /// For internal use only
+  explicit GenericClient(impl::ClientParams&& client_params);
+
+  /// @brief Initiate a single request -> single response RPC
+  /// @param call_name the full name of the method: "package.Service/Method"
+  client::UnaryCall<grpc::ByteBuffer> UnaryCall(
+      std::string_view call_name, const grpc::ByteBuffer& request,
+      std::unique_ptr<grpc::ClientContext> context =
+          std::make_unique<grpc::ClientContext>(),
+      const Qos& qos = {}) const;
+
+  /// @brief Initiate an RPC with streaming requests and/or responses
+  ///
+  /// gRPC does not distinguish the streaming RPC kinds on the wire, so any of
+  /// them can be performed through a bidirectional stream.
+  ///
+  /// @param call_name the full name of the method: "package.Service/Method"
+  client::BidirectionalStream<grpc::ByteBuffer, grpc::ByteBuffer>
+  BidirectionalStream(std::string_view call_name,
+                      std::unique_ptr<grpc::ClientContext> context =
+                          std::make_unique<grpc::ClientContext>(),
+                      const Qos& qos = {}) const;
+
+  /// For internal use only
+  static ugrpc::impl::StaticServiceMetadata GetMetadata();
+
+ private:
+  template <typename Client>
+  friend impl::ClientData& impl::GetClientData(Client& client);
+
+  impl::ClientData impl_;
+};
+
+}  // namespace ugrpc::client
+
+USERVER_NAMESPACE_END
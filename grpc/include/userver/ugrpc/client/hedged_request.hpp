@@ -0,0 +1,187 @@
+#pragma once
+
+/// @file userver/ugrpc/client/hedged_request.hpp
+/// @brief @copybrief ugrpc::client::HedgedUnaryCall
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <exception>
+#include <memory>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include <grpcpp/client_context.h>
+
+#include <userver/utils/hedged_request.hpp>
+#include <userver/utils/retry_budget.hpp>
+
+#include <userver/ugrpc/client/exceptions.hpp>
+#include <userver/ugrpc/client/impl/client_data.hpp>
+#include <userver/ugrpc/client/qos.hpp>
+#include <userver/ugrpc/client/rpc.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace ugrpc::client {
+
+namespace impl {
+
+/// A started attempt of a hedged unary call
+template <typename Response>
+struct UnaryAttempt final {
+  explicit UnaryAttempt(UnaryCall<Response>&& call)
+      : call(std::move(call)),
+        response(std::make_unique<Response>()),
+        future(this->call.FinishAsync(*response)) {}
+
+  engine::impl::ContextAccessor* TryGetContextAccessor() noexcept {
+    return future.TryGetContextAccessor();
+  }
+
+  UnaryCall<Response> call;
+  std::unique_ptr<Response> response;
+  UnaryFuture future;
+};
+
+/// Hedging settings of the call, resolved from the Qos and the dynamic config
+const std::optional<HedgingQos>& GetHedging(CallAnyBase& call);
+
+utils::hedging::HedgingSettings MakeHedgingSettings(
+    const HedgingQos& hedging, const grpc::ClientContext& context);
+
+bool IsRetryable(const HedgingQos& hedging, grpc::StatusCode code) noexcept;
+
+[[noreturn]] void ThrowHedgingTimeout(std::string_view call_name);
+
+/// RequestStrategy for utils::hedging
+template <typename Response, typename StartAttempt>
+class UnaryHedgingStrategy final {
+ public:
+  UnaryHedgingStrategy(UnaryAttempt<Response>&& first, StartAttempt start,
+                       const HedgingQos& hedging, utils::RetryBudget& budget,
+                       std::exception_ptr& error)
+      : first_(std::move(first)),
+        start_(std::move(start)),
+        hedging_(&hedging),
+        budget_(&budget),
+        error_(&error) {}
+
+  std::optional<UnaryAttempt<Response>> Create(std::size_t /*attempt*/) {
+    if (first_) {
+      ++in_flight_;
+      ++started_;
+      return std::exchange(first_, std::nullopt);
+    }
+    if (!budget_->CanRetry()) return std::nullopt;
+    ++in_flight_;
+    ++started_;
+    return UnaryAttempt<Response>{start_()};
+  }
+
+  std::optional<std::chrono::milliseconds> ProcessReply(
+      UnaryAttempt<Response>&& attempt) {
+    --in_flight_;
+    try {
+      attempt.future.Get();
+      budget_->AccountOk();
+      reply_ = std::move(*attempt.response);
+      return std::nullopt;
+    } catch (const ErrorWithStatus& ex) {
+      *error_ = std::current_exception();
+      if (!IsRetryable(*hedging_, ex.GetStatus().error_code())) {
+        return std::nullopt;
+      }
+      budget_->AccountFail();
+    } catch (const RpcError& ex) {
+      *error_ = std::current_exception();
+      return std::nullopt;
+    }
+
+    // Keep waiting for the attempts in flight or start the next one right away
+    const bool can_start =
+        started_ < hedging_->attempts && budget_->CanRetry();
+    if (in_flight_ == 0 && !can_start) return std::nullopt;
+    return std::chrono::milliseconds{0};
+  }
+
+  std::optional<Response> ExtractReply() { return std::move(reply_); }
+
+  // The attempt is cancelled and waited for on destruction
+  void Finish(UnaryAttempt<Response>&& attempt) {
+    --in_flight_;
+    attempt.call.GetContext().TryCancel();
+  }
+
+ private:
+  std::optional<UnaryAttempt<Response>> first_;
+  StartAttempt start_;
+  const HedgingQos* hedging_;
+  utils::RetryBudget* budget_;
+  std::size_t started_{0};
+  std::size_t in_flight_{0};
+  std::optional<Response> reply_;
+  // The strategy is moved into utils::hedging, so the error is stored outside
+  std::exception_ptr* error_;
+};
+
+}  // namespace impl
+
+/// @brief Performs a unary RPC with hedging: if no response arrives within
+/// HedgingQos::delay, another attempt is started, and the first successful
+/// response wins. The losing attempts are cancelled.
+///
+/// Hedging settings are taken from `qos.hedging`, or from the client QOS
+/// dynamic config of the method if `qos.hedging` is not set. Without any
+/// hedging settings, a plain single attempt is made.
+///
+/// Additional attempts are capped by the utils::RetryBudget shared by all
+/// the clients of the endpoint.
+///
+/// @code
+/// auto response = ugrpc::client::HedgedUnaryCall(
+///     client, &GreeterServiceClient::SayHello, request);
+/// @endcode
+///
+/// @throws ugrpc::client::RpcError of the last failed attempt
+/// @throws ugrpc::client::RpcCancelledError on task cancellation
+template <typename Client, typename Request, typename Response>
+Response HedgedUnaryCall(
+    Client& client,
+    UnaryCall<Response> (Client::*method)(
+        const Request&, std::unique_ptr<grpc::ClientContext>, const Qos&)
+        const,
+    const Request& request, const Qos& qos = {}) {
+  auto start = [&client, method, &request, &qos] {
+    return (client.*method)(request, std::make_unique<grpc::ClientContext>(),
+                            qos);
+  };
+
+  impl::UnaryAttempt<Response> first{start()};
+  const std::string call_name{first.call.GetCallName()};
+  const auto hedging = impl::GetHedging(first.call);
+  if (!hedging || hedging->attempts <= 1) {
+    first.future.Get();
+    return std::move(*first.response);
+  }
+
+  const auto settings =
+      impl::MakeHedgingSettings(*hedging, first.call.GetContext());
+  std::exception_ptr error;
+  auto reply = utils::hedging::HedgeRequest(
+      impl::UnaryHedgingStrategy<Response, decltype(start)>{
+          std::move(first), start, *hedging,
+          impl::GetClientData(client).GetRetryBudget(), error},
+      settings);
+
+  if (reply) return std::move(*reply);
+  if (error) std::rethrow_exception(error);
+  impl::ThrowHedgingTimeout(call_name);
+}
+
+}  // namespace ugrpc::client
+
+USERVER_NAMESPACE_END
@@ -19,6 +19,7 @@
 #include <userver/ugrpc/client/exceptions.hpp>
 #include <userver/ugrpc/client/impl/async_method_invocation.hpp>
 #include <userver/ugrpc/client/impl/call_params.hpp>
+#include <userver/ugrpc/client/impl/channel_balancer.hpp>
 #include <userver/ugrpc/impl/async_method_invocation.hpp>
 #include <userver/ugrpc/impl/statistics_scope.hpp>
 
@@ -103,6 +104,10 @@ class RpcData final {
 
   ugrpc::impl::RpcStatisticsScope& GetStatsScope() noexcept;
 
+  ChannelBalancer::Lease& GetChannelLease() noexcept;
+
+  const std::optional<HedgingQos>& GetHedging() const noexcept;
+
   void SetWritesFinished() noexcept;
 
   bool AreWritesFinished() const noexcept;
@@ -156,6 +161,7 @@ class RpcData final {
  private:
   std::unique_ptr<grpc::ClientContext> context_;
   std::string client_name_;
+  std::string owned_call_name_;
   std::string_view call_name_;
   bool writes_finished_{false};
   bool is_finished_{false};
@@ -166,6 +172,8 @@ class RpcData final {
   grpc::CompletionQueue& queue_;
   RpcConfigValues config_values_;
   const Middlewares& mws_;
+  ChannelBalancer::Lease channel_lease_;
+  std::optional<HedgingQos> hedging_;
 
   // This data is common for all types of grpc calls - unary and streaming
   // However, in unary call the call is finished as soon as grpc core
@@ -1,5 +1,7 @@
 #pragma once
 
+#include <optional>
+#include <string>
 #include <string_view>
 
 #include <grpcpp/client_context.h>
@@ -7,6 +9,7 @@
 
 #include <userver/dynamic_config/snapshot.hpp>
 
+#include <userver/ugrpc/client/impl/channel_balancer.hpp>
 #include <userver/ugrpc/client/impl/client_data.hpp>
 #include <userver/ugrpc/client/middlewares/fwd.hpp>
 #include <userver/ugrpc/client/qos.hpp>
@@ -24,10 +27,15 @@ struct CallParams {
   std::unique_ptr<grpc::ClientContext> context;
   ugrpc::impl::MethodStatistics& statistics;
   const Middlewares& mws;
+  ChannelBalancer::Lease channel_lease;
+  std::optional<HedgingQos> hedging;
+  // Overrides 'call_name' for the calls without static metadata, e.g. generic
+  std::string owned_call_name{};
 };
 
 CallParams DoCreateCallParams(const ClientData&, std::size_t method_id,
-                              std::unique_ptr<grpc::ClientContext>);
+                              std::unique_ptr<grpc::ClientContext>,
+                              std::optional<HedgingQos>&& hedging);
 
 template <typename ClientQosConfig>
 CallParams CreateCallParams(const ClientData& client_data,
@@ -46,10 +54,12 @@ CallParams CreateCallParams(const ClientData& client_data,
   ApplyQos(*client_context, qos, client_data.GetTestsuiteControl());
 
   // If user qos was empty update timeout from config
-  ApplyQos(*client_context, config[client_qos][method_name],
-           client_data.GetTestsuiteControl());
+  const auto& config_qos = config[client_qos][method_name];
+  ApplyQos(*client_context, config_qos, client_data.GetTestsuiteControl());
 
-  return DoCreateCallParams(client_data, method_id, std::move(client_context));
+  auto hedging = qos.hedging ? qos.hedging : config_qos.hedging;
+  return DoCreateCallParams(client_data, method_id, std::move(client_context),
+                            std::move(hedging));
 }
 
 }  // namespace ugrpc::client::impl
@@ -0,0 +1,80 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+
+#include <grpcpp/support/status.h>
+
+#include <userver/utils/fixed_array.hpp>
+
+#include <userver/ugrpc/client/balancing.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace ugrpc::client::impl {
+
+/// Tracks the load and the health of the channels of an endpoint and picks a
+/// channel for each RPC. Thread-safe.
+class ChannelBalancer final {
+ public:
+  class Lease;
+
+  ChannelBalancer(std::size_t channel_count, const BalancingSettings& settings);
+
+  ChannelBalancer(ChannelBalancer&&) = delete;
+  ChannelBalancer& operator=(ChannelBalancer&&) = delete;
+
+  /// Picks a channel for a new RPC and accounts the RPC as in flight on it
+  Lease Acquire();
+
+ private:
+  using Clock = std::chrono::steady_clock;
+
+  struct ChannelState final {
+    std::atomic<std::size_t> in_flight{0};
+    std::atomic<std::int64_t> latency_ewma_us{0};
+    std::atomic<std::size_t> consecutive_errors{0};
+    // Clock ticks since epoch
+    std::atomic<Clock::rep> ejected_until{0};
+  };
+
+  std::size_t Pick() const;
+  bool IsEjected(const ChannelState& channel, Clock::time_point now) const;
+  void Release(std::size_t index) noexcept;
+  void OnFinished(std::size_t index, Clock::duration latency,
+                  grpc::StatusCode code) noexcept;
+
+  const BalancingSettings settings_;
+  utils::FixedArray<ChannelState> channels_;
+};
+
+/// Keeps the RPC accounted as in flight on the channel until destroyed
+class ChannelBalancer::Lease final {
+ public:
+  Lease() noexcept = default;
+  Lease(Lease&&) noexcept;
+  Lease& operator=(Lease&&) noexcept;
+  ~Lease();
+
+  std::size_t GetChannelIndex() const noexcept { return index_; }
+
+  /// Reports the final status of the RPC, must be called at most once
+  void OnFinished(grpc::StatusCode code) noexcept;
+
+ private:
+  friend class ChannelBalancer;
+
+  // 'balancer' is null if the RPCs are not accounted
+  Lease(ChannelBalancer* balancer, std::size_t index) noexcept;
+
+  ChannelBalancer* balancer_{nullptr};
+  std::size_t index_{0};
+  Clock::time_point start_{};
+  bool finished_{false};
+};
+
+}  // namespace ugrpc::client::impl
+
+USERVER_NAMESPACE_END
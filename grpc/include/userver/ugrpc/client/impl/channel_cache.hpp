@@ -12,6 +12,10 @@
 
 #include <userver/concurrent/variable.hpp>
 #include <userver/utils/fixed_array.hpp>
+#include <userver/utils/retry_budget.hpp>
+
+#include <userver/ugrpc/client/balancing.hpp>
+#include <userver/ugrpc/client/impl/channel_balancer.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
@@ -21,7 +25,8 @@ class ChannelCache final {
  public:
   ChannelCache(std::shared_ptr<grpc::ChannelCredentials>&& credentials,
                const grpc::ChannelArguments& channel_args,
-               std::size_t channel_count);
+               std::size_t channel_count,
+               const BalancingSettings& balancing_settings);
 
   ~ChannelCache();
 
@@ -36,9 +41,13 @@ class ChannelCache final {
     CountedChannel(const std::string& endpoint,
                    const std::shared_ptr<grpc::ChannelCredentials>& credentials,
                    const grpc::ChannelArguments& channel_args,
-                   std::size_t count);
+                   std::size_t count,
+                   const BalancingSettings& balancing_settings);
 
     utils::FixedArray<std::shared_ptr<grpc::Channel>> channels;
+    ChannelBalancer balancer;
+    // Caps the additional attempts of hedged calls to the endpoint
+    utils::RetryBudget retry_budget;
     std::uint64_t counter{0};
   };
 
@@ -47,6 +56,7 @@ class ChannelCache final {
   const std::shared_ptr<grpc::ChannelCredentials> credentials_;
   const grpc::ChannelArguments channel_args_;
   const std::size_t channel_count_;
+  const BalancingSettings balancing_settings_;
   concurrent::Variable<Map> channels_;
 };
 
@@ -67,6 +77,10 @@ class ChannelCache::Token final {
   const std::shared_ptr<grpc::Channel>& GetChannel(std::size_t index) const
       noexcept;
 
+  ChannelBalancer& GetBalancer() const noexcept;
+
+  utils::RetryBudget& GetRetryBudget() const noexcept;
+
  private:
   ChannelCache* cache_{nullptr};
   const std::string* endpoint_{nullptr};
@@ -13,6 +13,7 @@
 #include <userver/ugrpc/client/middlewares/fwd.hpp>
 #include <userver/ugrpc/impl/static_metadata.hpp>
 #include <userver/ugrpc/impl/statistics.hpp>
+#include <userver/utils/assert.hpp>
 #include <userver/utils/fixed_array.hpp>
 #include <userver/utils/rand.hpp>
 
@@ -56,10 +57,20 @@ class ClientData final {
   ClientData(const ClientData&) = delete;
   ClientData& operator=(const ClientData&) = delete;
 
+  /// Picks a channel for a new RPC, see BalancingSettings
+  ChannelBalancer::Lease AcquireChannel() const {
+    return params_.channel_token.GetBalancer().Acquire();
+  }
+
+  utils::RetryBudget& GetRetryBudget() const {
+    return params_.channel_token.GetRetryBudget();
+  }
+
   template <typename Service>
-  Stub<Service>& NextStub() const {
-    return *static_cast<Stub<Service>*>(
-        stubs_[utils::RandRange(stubs_.size())].get());
+  Stub<Service>& GetStub(const ChannelBalancer::Lease& channel_lease) const {
+    const auto index = channel_lease.GetChannelIndex();
+    UASSERT(index < stubs_.size());
+    return *static_cast<Stub<Service>*>(stubs_[index].get());
   }
 
   grpc::CompletionQueue& GetQueue() const { return params_.queue; }
@@ -1,9 +1,11 @@
 #pragma once
 
 #include <chrono>
+#include <cstddef>
 #include <optional>
 #include <string>
 #include <unordered_map>
+#include <vector>
 
 #include <grpcpp/client_context.h>
 
@@ -17,10 +19,35 @@ class GrpcControl;
 
 namespace ugrpc::client {
 
+/// @brief Hedging of unary calls, only used by ugrpc::client::HedgedUnaryCall
+struct HedgingQos final {
+  /// Maximum number of attempts, including the first one
+  std::size_t attempts{1};
+
+  /// A new attempt is started if none of the previous ones has finished
+  /// during this delay
+  std::chrono::milliseconds delay{50};
+
+  /// A new attempt is started right away after a failure with one of these
+  /// codes. Other errors are returned to the caller.
+  std::vector<grpc::StatusCode> retryable_codes{grpc::StatusCode::UNAVAILABLE};
+};
+
 struct Qos final {
   std::optional<std::chrono::milliseconds> timeout;
+  std::optional<HedgingQos> hedging{};
+
+  /// Compression of the request messages. The responses are compressed
+  /// according to the server settings.
+  std::optional<grpc_compression_algorithm> compression{};
 };
 
+HedgingQos Parse(const formats::json::Value& value,
+                 formats::parse::To<HedgingQos>);
+
+formats::json::Value Serialize(const HedgingQos& hedging,
+                               formats::serialize::To<formats::json::Value>);
+
 Qos Parse(const formats::json::Value& value, formats::parse::To<Qos>);
 
 formats::json::Value Serialize(const Qos& qos,
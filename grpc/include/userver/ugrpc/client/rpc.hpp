@@ -16,6 +16,7 @@
 #include <userver/utils/assert.hpp>
 #include <userver/utils/function_ref.hpp>
 
+#include <userver/ugrpc/byte_buffer_utils.hpp>
 #include <userver/ugrpc/client/exceptions.hpp>
 #include <userver/ugrpc/client/impl/async_methods.hpp>
 #include <userver/ugrpc/client/impl/call_params.hpp>
@@ -173,6 +174,9 @@ class [[nodiscard]] UnaryCall final : public CallAnyBase {
   ///
   /// `Finish` and `FinishAsync` should not be called together for the same RPC.
   ///
+  /// `response` may be created on a `google::protobuf::Arena`, then its nested
+  /// messages are parsed into the arena without separate heap allocations.
+  ///
   /// @returns the future for the single response
   UnaryFuture FinishAsync(Response& response);
 
@@ -488,7 +492,7 @@ UnaryCall<Response>::UnaryCall(
                                        &GetData().GetQueue());
         reader_->StartCall();
       },
-      &req);
+      ugrpc::impl::ToBaseMessage(req));
   GetData().SetWritesFinished();
 }
 
@@ -525,7 +529,7 @@ InputStream<Response>::InputStream(
                                        &GetData().GetQueue());
         impl::StartCall(*stream_, GetData());
       },
-      &req);
+      ugrpc::impl::ToBaseMessage(req));
   GetData().SetWritesFinished();
 }
 
@@ -0,0 +1,24 @@
+#pragma once
+
+/// @file userver/ugrpc/compression.hpp
+/// @brief Utilities for grpc_compression_algorithm
+
+#include <string_view>
+
+#include <grpc/compression.h>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace ugrpc {
+
+/// @brief Convert string to grpc_compression_algorithm, one of "identity",
+/// "deflate", "gzip"
+/// @throws std::runtime_error
+grpc_compression_algorithm CompressionAlgorithmFromString(std::string_view str);
+
+/// @brief Convert grpc_compression_algorithm to string
+std::string_view ToString(grpc_compression_algorithm algorithm) noexcept;
+
+}  // namespace ugrpc
+
+USERVER_NAMESPACE_END
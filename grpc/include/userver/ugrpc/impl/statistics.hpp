@@ -11,8 +11,8 @@
 #include <userver/utils/fixed_array.hpp>
 #include <userver/utils/statistics/fwd.hpp>
 #include <userver/utils/statistics/percentile.hpp>
-#include <userver/utils/statistics/rate_counter.hpp>
 #include <userver/utils/statistics/recentperiod.hpp>
+#include <userver/utils/statistics/striped_rate_counter.hpp>
 
 #include <userver/ugrpc/impl/static_metadata.hpp>
 
@@ -49,6 +49,12 @@ class MethodStatistics final {
 
   void AccountCancelled() noexcept;
 
+  // 'raw_bytes' is the size of the message before the compression
+  void AccountCompressedMessage(std::size_t raw_bytes) noexcept;
+
+  // The message was sent uncompressed, because it was too small
+  void AccountCompressionSkipped() noexcept;
+
   friend void DumpMetric(utils::statistics::Writer& writer,
                          const MethodStatistics& stats);
 
@@ -57,22 +63,28 @@ class MethodStatistics final {
  private:
   using Percentile =
       utils::statistics::Percentile<2000, std::uint32_t, 256, 100>;
-  using RateCounter = utils::statistics::RateCounter;
+  // Every RPC from every thread hits the same counters, per-core striping
+  // avoids bouncing their cache lines between the cores
+  using StripedRateCounter = utils::statistics::StripedRateCounter;
   // StatusCode enum cases have consecutive underlying values, starting from 0.
   // UNAUTHENTICATED currently has the largest value.
   static constexpr std::size_t kCodesCount =
       static_cast<std::size_t>(grpc::StatusCode::UNAUTHENTICATED) + 1;
 
   const StatisticsDomain domain_;
-  RateCounter started_{0};
-  std::array<RateCounter, kCodesCount> status_codes_{};
+  StripedRateCounter started_;
+  std::array<StripedRateCounter, kCodesCount> status_codes_{};
   utils::statistics::RecentPeriod<Percentile, Percentile> timings_;
-  RateCounter network_errors_{0};
-  RateCounter internal_errors_{0};
-  RateCounter cancelled_{0};
+  StripedRateCounter network_errors_;
+  StripedRateCounter internal_errors_;
+  StripedRateCounter cancelled_;
+
+  StripedRateCounter deadline_updated_;
+  StripedRateCounter deadline_cancelled_;
 
-  RateCounter deadline_updated_{0};
-  RateCounter deadline_cancelled_{0};
+  StripedRateCounter compressed_messages_;
+  StripedRateCounter compressed_raw_bytes_;
+  StripedRateCounter compression_skipped_;
 };
 
 class ServiceStatistics final {
@@ -2,6 +2,7 @@
 
 #include <atomic>
 #include <chrono>
+#include <cstddef>
 #include <optional>
 
 #include <grpcpp/support/status.h>
@@ -28,6 +29,10 @@ class RpcStatisticsScope final {
 
   void OnNetworkError();
 
+  void OnMessageCompressed(std::size_t raw_bytes);
+
+  void OnCompressionSkipped();
+
   void Flush();
 
  private:
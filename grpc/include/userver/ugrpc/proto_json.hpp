@@ -4,11 +4,15 @@
 /// @brief Utilities for conversion Protobuf -> Json
 /// @ingroup userver_formats_serialize userver_formats_parse
 
+#include <string_view>
+#include <type_traits>
+
 #include <google/protobuf/struct.pb.h>
 #include <google/protobuf/util/json_util.h>
 
 #include <userver/formats/json.hpp>
 #include <userver/formats/json/serialize.hpp>
+#include <userver/formats/json/string_builder.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
@@ -25,6 +29,22 @@ std::string ToString(const google::protobuf::Message& message);
 /// @throws formats::json::Exception
 std::string ToJsonString(const google::protobuf::Message& message);
 
+/// @brief Parses protobuf message from its Json-string representation
+///
+/// The message is filled directly from the string, without building an
+/// intermediate formats::json::Value.
+///
+/// @throws formats::json::ParseException
+void JsonStringToMessage(std::string_view json,
+                         google::protobuf::Message& message);
+
+namespace impl {
+
+void WriteMessageToStream(const google::protobuf::Message& message,
+                          formats::json::StringBuilder& sw);
+
+}  // namespace impl
+
 }  // namespace ugrpc
 
 namespace formats::serialize {
@@ -32,6 +52,14 @@ namespace formats::serialize {
 json::Value Serialize(const google::protobuf::Message& message,
                       To<json::Value>);
 
+/// @brief SAX serialization of protobuf messages, writes the message without
+/// building an intermediate formats::json::Value
+template <typename Message>
+std::enable_if_t<std::is_base_of_v<google::protobuf::Message, Message>>
+WriteToStream(const Message& message, json::StringBuilder& sw) {
+  ugrpc::impl::WriteMessageToStream(message, sw);
+}
+
 }  // namespace formats::serialize
 
 namespace formats::parse {
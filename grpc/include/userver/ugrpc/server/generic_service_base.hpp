@@ -0,0 +1,71 @@
+#pragma once
+
+/// @file userver/ugrpc/server/generic_service_base.hpp
+/// @brief @copybrief ugrpc::server::GenericServiceBase
+
+#include <grpcpp/support/byte_buffer.h>
+
+#include <userver/ugrpc/server/rpc.hpp>
+#include <userver/ugrpc/server/service_base.hpp>
+#include <userver/ugrpc/server/service_component_base.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace ugrpc::server {
+
+/// @brief Allows to handle RPCs of any method, e.g. to implement a proxy,
+/// passing the messages through as opaque grpc::ByteBuffer without parsing
+///
+/// The generic service receives all the RPCs that are not handled by the
+/// code-generated services registered on the same server. Only one generic
+/// service may be registered per server.
+///
+/// All RPCs are bidirectional streams at this level: a unary request arrives
+/// as a stream with a single message, and a unary response must be sent with
+/// `WriteAndFinish`.
+///
+/// The server middlewares, deadline propagation, tracing and access logs work
+/// as usual, with the call name taken from the incoming request. The
+/// middleware request and response hooks are not called for the opaque
+/// messages; use ugrpc::ParseFromByteBuffer to look into the fields needed for
+/// routing. The statistics of all the generic RPCs are accounted together
+/// under the `Generic/Generic` method, because the method names are
+/// controlled by the clients.
+///
+/// ## Example
+/// @code
+/// class UnaryProxy final : public ugrpc::server::GenericServiceBase {
+///  public:
+///   explicit UnaryProxy(ugrpc::client::GenericClient& client)
+///       : client_(client) {}
+///
+///   void Handle(Call& call) override {
+///     grpc::ByteBuffer request;
+///     if (!call.Read(request)) return;
+///     auto response = client_.UnaryCall(call.GetCallName(), request).Finish();
+///     call.WriteAndFinish(response);
+///   }
+///
+///  private:
+///   ugrpc::client::GenericClient& client_;
+/// };
+/// @endcode
+class GenericServiceBase : public ServiceBase {
+ public:
+  /// Inherits from both GenericServiceBase and ServiceComponentBase
+  using Component = impl::ServiceComponentBase<GenericServiceBase>;
+
+  using Call = BidirectionalStream<grpc::ByteBuffer, grpc::ByteBuffer>;
+
+  /// @brief Handles an RPC of any method, see GetCallName, GetServiceName
+  /// and GetMethodName of the `call`
+  virtual void Handle(Call& call) = 0;
+
+ private:
+  std::unique_ptr<impl::ServiceWorker> MakeWorker(
+      impl::ServiceSettings&& settings) final;
+};
+
+}  // namespace ugrpc::server
+
+USERVER_NAMESPACE_END
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <cstddef>
 #include <memory>
 #include <string_view>
 #include <utility>
@@ -8,6 +9,7 @@
 #include <grpcpp/impl/codegen/async_unary_call.h>
 #include <grpcpp/impl/codegen/status.h>
 
+#include <userver/ugrpc/byte_buffer_utils.hpp>
 #include <userver/ugrpc/server/exceptions.hpp>
 #include <userver/ugrpc/server/impl/async_method_invocation.hpp>
 
@@ -104,6 +106,25 @@ void Write(GrpcStream& stream, const Response& response,
   ThrowOnError(Wait(write), call_name, "Write");
 }
 
+/// Messages of a batch write are corked until this many bytes are buffered
+inline constexpr std::size_t kBatchWriteFlushBytes = 64 * 1024;
+
+/// Lets gRPC coalesce the messages of a batch write. The last message of the
+/// batch and every kBatchWriteFlushBytes of messages are flushed.
+template <typename Response>
+grpc::WriteOptions MakeBatchWriteOptions(const Response& response,
+                                         bool is_last,
+                                         std::size_t& buffered_bytes) {
+  grpc::WriteOptions options{};
+  buffered_bytes += ugrpc::impl::GetMessageSize(response);
+  if (is_last || buffered_bytes >= kBatchWriteFlushBytes) {
+    buffered_bytes = 0;
+    return options;
+  }
+  options.set_buffer_hint();
+  return options;
+}
+
 template <typename GrpcStream, typename Response>
 void WriteAndFinish(GrpcStream& stream, const Response& response,
                     grpc::WriteOptions options, const grpc::Status& status,
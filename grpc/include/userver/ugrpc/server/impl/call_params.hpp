@@ -2,6 +2,7 @@
 
 #include <string_view>
 
+#include <google/protobuf/arena.h>
 #include <grpcpp/completion_queue.h>
 #include <grpcpp/server_context.h>
 
@@ -11,6 +12,7 @@
 #include <userver/utils/any_storage.hpp>
 
 #include <userver/ugrpc/impl/statistics_scope.hpp>
+#include <userver/ugrpc/server/impl/compression_settings.hpp>
 #include <userver/ugrpc/server/middlewares/fwd.hpp>
 #include <userver/ugrpc/server/storage_context.hpp>
 
@@ -28,6 +30,8 @@ struct CallParams {
   tracing::Span& call_span;
   utils::AnyStorage<StorageContext>& storage_context;
   const Middlewares& middlewares;
+  google::protobuf::Arena& arena;
+  const CompressionSettings compression;
 };
 
 }  // namespace ugrpc::server::impl
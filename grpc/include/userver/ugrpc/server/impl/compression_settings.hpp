@@ -0,0 +1,28 @@
+#pragma once
+
+#include <cstddef>
+#include <string_view>
+
+#include <grpc/compression.h>
+
+#include <userver/dynamic_config/fwd.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace ugrpc::server::impl {
+
+/// Compression of the response messages of a method, see
+/// USERVER_GRPC_SERVER_COMPRESSION
+struct CompressionSettings final {
+  grpc_compression_algorithm algorithm{GRPC_COMPRESS_NONE};
+
+  /// Smaller messages are sent uncompressed
+  std::size_t min_message_size{1024};
+};
+
+CompressionSettings GetCompressionSettings(
+    const dynamic_config::Snapshot& config, std::string_view call_name);
+
+}  // namespace ugrpc::server::impl
+
+USERVER_NAMESPACE_END
@@ -8,6 +8,7 @@
 #include <type_traits>
 #include <utility>
 
+#include <google/protobuf/arena.h>
 #include <grpcpp/completion_queue.h>
 #include <grpcpp/impl/service_type.h>
 #include <grpcpp/server_context.h>
@@ -179,10 +180,14 @@ class CallData final {
     auto& access_tskv_logger =
         method_data_.service_data.settings.access_tskv_logger;
     utils::AnyStorage<StorageContext> storage_context;
-    Call responder(CallParams{context_, call_name, service_name, method_name,
-                              statistics_scope, *access_tskv_logger,
-                              span_->Get(), storage_context, middlewares},
-                   raw_responder_);
+    const auto config =
+        method_data_.service_data.settings.config_source.GetSnapshot();
+    Call responder(
+        CallParams{context_, call_name, service_name, method_name,
+                   statistics_scope, *access_tskv_logger, span_->Get(),
+                   storage_context, middlewares, arena_,
+                   GetCompressionSettings(config, call_name)},
+        raw_responder_);
     auto do_call = [&] {
       if constexpr (std::is_same_v<InitialRequest, NoInitialRequest>) {
         (service.*service_method)(responder);
@@ -198,9 +203,7 @@ class CallData final {
       }
 
       MiddlewareCallContext middleware_context(
-          middlewares, responder, do_call,
-          method_data_.service_data.settings.config_source.GetSnapshot(),
-          initial_request);
+          middlewares, responder, do_call, config, initial_request);
       responder.RunMiddlewarePipeline(middleware_context);
     } catch (
         const USERVER_NAMESPACE::server::handlers::CustomHandlerException& ex) {
@@ -219,7 +222,11 @@ class CallData final {
   MethodData<GrpcppService, CallTraits> method_data_;
 
   grpc::ServerContext context_{};
-  InitialRequest initial_request_{};
+  // Nested messages of the request are parsed into the arena blocks instead of
+  // separate heap allocations. Must outlive everything allocated on it.
+  google::protobuf::Arena arena_{};
+  InitialRequest& initial_request_{
+      *google::protobuf::Arena::Create<InitialRequest>(&arena_)};
   RawCall raw_responder_{&context_};
   ugrpc::impl::AsyncMethodInvocation prepare_;
   std::optional<tracing::InPlaceSpan> span_{};
@@ -234,12 +241,17 @@ class ServiceWorkerImpl final : public ServiceWorker {
                     Service& service, ServiceMethods... service_methods)
       : service_data_(settings, metadata),
         start_{[this, &service, service_methods...] {
-          for (size_t i = 0; i < service_data_.settings.queue.GetSize(); i++) {
-            std::size_t method_id = 0;
-            (CallData<GrpcppService, CallTraits<ServiceMethods>>::ListenAsync(
-                 {service_data_, static_cast<int>(i), method_id++, service,
-                  service_methods}),
-             ...);
+          const auto& settings = service_data_.settings;
+          for (size_t i = 0; i < settings.queue.GetSize(); i++) {
+            // Every listener re-posts itself after matching a call, so the
+            // number of posted requests stays the same
+            for (size_t j = 0; j < settings.listeners_per_queue; j++) {
+              std::size_t method_id = 0;
+              (CallData<GrpcppService, CallTraits<ServiceMethods>>::
+                   ListenAsync({service_data_, static_cast<int>(i),
+                                method_id++, service, service_methods}),
+               ...);
+            }
           }
         }} {}
 
@@ -247,7 +259,9 @@ class ServiceWorkerImpl final : public ServiceWorker {
     service_data_.wait_tokens.WaitForAllTokens();
   }
 
-  grpc::Service& GetService() override { return service_data_.async_service; }
+  void Register(grpc::ServerBuilder& builder) override {
+    builder.RegisterService(&service_data_.async_service);
+  }
 
   const ugrpc::impl::StaticServiceMetadata& GetMetadata() const override {
     return service_data_.metadata;
@@ -5,9 +5,11 @@
 
 #include <grpcpp/impl/codegen/proto_utils.h>
 #include <grpcpp/server_context.h>
+#include <grpcpp/support/byte_buffer.h>
 #include <boost/range/adaptor/reversed.hpp>
 
 #include <userver/utils/assert.hpp>
+#include <userver/utils/span.hpp>
 
 #include <userver/ugrpc/impl/deadline_timepoint.hpp>
 #include <userver/ugrpc/impl/internal_tag_fwd.hpp>
@@ -86,6 +88,15 @@ class CallAnyBase {
     return params_.storage_context;
   }
 
+  /// @brief Returns the arena that lives until the end of the call
+  ///
+  /// The initial request (if any) is allocated on it. Creating the response
+  /// and other per-call messages on it with
+  /// `google::protobuf::Arena::Create<Message>(&call.GetArena())` saves the
+  /// allocations of nested messages, which are freed all at once with the
+  /// arena.
+  google::protobuf::Arena& GetArena() { return params_.arena; }
+
   virtual bool IsFinished() const = 0;
 
   /// @cond
@@ -107,7 +118,28 @@ class CallAnyBase {
 
   void ApplyResponseHook(google::protobuf::Message* response);
 
+  // Compresses the single response if it is large enough. Must be called
+  // before the initial metadata is sent.
+  void ApplyCompression(const google::protobuf::Message& response);
+
+  // Must be called before the initial metadata is sent
+  void EnableStreamCompression();
+
+  // Sends a stream response uncompressed if it is too small
+  void ApplyCompression(const google::protobuf::Message& response,
+                        grpc::WriteOptions& options);
+
+  // Messages of the generic calls are opaque for the middleware hooks
+  void ApplyRequestHook(grpc::ByteBuffer*) {}
+
+  void ApplyResponseHook(grpc::ByteBuffer*) {}
+
+  void ApplyCompression(const grpc::ByteBuffer& response,
+                        grpc::WriteOptions& options);
+
  private:
+  bool ShouldCompress(std::size_t response_size);
+
   impl::CallParams params_;
   MiddlewareCallContext* middleware_call_context_{nullptr};
 };
@@ -235,6 +267,16 @@ class OutputStream final : public CallAnyBase {
   /// @throws ugrpc::server::RpcError on an RPC error
   void Write(Response&& response);
 
+  /// @brief Write a batch of outgoing messages
+  ///
+  /// gRPC is allowed to coalesce the messages into fewer network writes, the
+  /// stream is flushed after the last message of the batch. Each message still
+  /// waits for the flow control window, same as with `Write`.
+  ///
+  /// @param responses the messages to write, in order
+  /// @throws ugrpc::server::RpcError on an RPC error
+  void WriteMany(utils::span<Response> responses);
+
   /// @brief Complete the RPC successfully
   ///
   /// `Finish` must not be called multiple times.
@@ -318,6 +360,16 @@ class BidirectionalStream : public CallAnyBase {
   /// @throws ugrpc::server::RpcError on an RPC error
   void Write(Response&& response);
 
+  /// @brief Write a batch of outgoing messages
+  ///
+  /// gRPC is allowed to coalesce the messages into fewer network writes, the
+  /// stream is flushed after the last message of the batch. Each message still
+  /// waits for the flow control window, same as with `Write`.
+  ///
+  /// @param responses the messages to write, in order
+  /// @throws ugrpc::server::RpcError on an RPC error
+  void WriteMany(utils::span<Response> responses);
+
   /// @brief Complete the RPC successfully
   ///
   /// `Finish` must not be called multiple times.
@@ -395,6 +447,7 @@ void UnaryCall<Response>::Finish(Response& response) {
   is_finished_ = true;
 
   ApplyResponseHook(&response);
+  ApplyCompression(response);
 
   LogFinish(grpc::Status::OK);
   impl::Finish(stream_, response, grpc::Status::OK, GetCallName());
@@ -456,6 +509,7 @@ void InputStream<Request, Response>::Finish(Response& response) {
   LogFinish(grpc::Status::OK);
 
   ApplyResponseHook(&response);
+  ApplyCompression(response);
 
   impl::Finish(stream_, response, grpc::Status::OK, GetCallName());
   Statistics().OnExplicitFinish(grpc::StatusCode::OK);
@@ -483,7 +537,9 @@ bool InputStream<Request, Response>::IsFinished() const {
 template <typename Response>
 OutputStream<Response>::OutputStream(impl::CallParams&& call_params,
                                      impl::RawWriter<Response>& stream)
-    : CallAnyBase(std::move(call_params)), stream_(stream) {}
+    : CallAnyBase(std::move(call_params)), stream_(stream) {
+  EnableStreamCompression();
+}
 
 template <typename Response>
 OutputStream<Response>::~OutputStream() {
@@ -511,10 +567,29 @@ void OutputStream<Response>::Write(Response& response) {
   grpc::WriteOptions write_options{};
 
   ApplyResponseHook(&response);
+  ApplyCompression(response, write_options);
 
   impl::Write(stream_, response, write_options, GetCallName());
 }
 
+template <typename Response>
+void OutputStream<Response>::WriteMany(utils::span<Response> responses) {
+  UINVARIANT(state_ != State::kFinished,
+             "'WriteMany' called on a finished stream");
+
+  impl::SendInitialMetadataIfNew(stream_, GetCallName(), state_);
+
+  std::size_t buffered_bytes = 0;
+  for (std::size_t i = 0; i < responses.size(); ++i) {
+    auto& response = responses[i];
+    ApplyResponseHook(&response);
+    auto write_options = impl::MakeBatchWriteOptions(
+        response, i + 1 == responses.size(), buffered_bytes);
+    ApplyCompression(response, write_options);
+    impl::Write(stream_, response, write_options, GetCallName());
+  }
+}
+
 template <typename Response>
 void OutputStream<Response>::Finish() {
   UINVARIANT(state_ != State::kFinished,
@@ -558,6 +633,7 @@ void OutputStream<Response>::WriteAndFinish(Response& response) {
   LogFinish(status);
 
   ApplyResponseHook(&response);
+  ApplyCompression(response, write_options);
 
   impl::WriteAndFinish(stream_, response, write_options, status, GetCallName());
 }
@@ -571,7 +647,9 @@ template <typename Request, typename Response>
 BidirectionalStream<Request, Response>::BidirectionalStream(
     impl::CallParams&& call_params,
     impl::RawReaderWriter<Request, Response>& stream)
-    : CallAnyBase(std::move(call_params)), stream_(stream) {}
+    : CallAnyBase(std::move(call_params)), stream_(stream) {
+  EnableStreamCompression();
+}
 
 template <typename Request, typename Response>
 BidirectionalStream<Request, Response>::~BidirectionalStream() {
@@ -607,6 +685,7 @@ void BidirectionalStream<Request, Response>::Write(Response& response) {
   grpc::WriteOptions write_options{};
 
   ApplyResponseHook(&response);
+  ApplyCompression(response, write_options);
 
   try {
     impl::Write(stream_, response, write_options, GetCallName());
@@ -616,6 +695,27 @@ void BidirectionalStream<Request, Response>::Write(Response& response) {
   }
 }
 
+template <typename Request, typename Response>
+void BidirectionalStream<Request, Response>::WriteMany(
+    utils::span<Response> responses) {
+  UINVARIANT(!is_finished_, "'WriteMany' called on a finished stream");
+
+  std::size_t buffered_bytes = 0;
+  try {
+    for (std::size_t i = 0; i < responses.size(); ++i) {
+      auto& response = responses[i];
+      ApplyResponseHook(&response);
+      auto write_options = impl::MakeBatchWriteOptions(
+          response, i + 1 == responses.size(), buffered_bytes);
+      ApplyCompression(response, write_options);
+      impl::Write(stream_, response, write_options, GetCallName());
+    }
+  } catch (const RpcInterruptedError&) {
+    is_finished_ = true;
+    throw;
+  }
+}
+
 template <typename Request, typename Response>
 void BidirectionalStream<Request, Response>::Finish() {
   UINVARIANT(!is_finished_, "'Finish' called on a finished stream");
@@ -658,6 +758,7 @@ void BidirectionalStream<Request, Response>::WriteAndFinish(
   LogFinish(status);
 
   ApplyResponseHook(&response);
+  ApplyCompression(response, write_options);
 
   impl::WriteAndFinish(stream_, response, write_options, status, GetCallName());
 }
@@ -3,6 +3,7 @@
 /// @file userver/ugrpc/server/server.hpp
 /// @brief @copybrief ugrpc::server::Server
 
+#include <cstddef>
 #include <functional>
 #include <memory>
 #include <unordered_map>
@@ -42,6 +43,14 @@ struct ServerConfig final {
   /// of worker threads for best RPS.
   int completion_queue_num{2};
 
+  /// Number of requests of each RPC method posted to each completion queue in
+  /// advance. With a single posted request, the next call of the method can
+  /// only be matched after the previous one has been woken up and has posted
+  /// a new request. More listeners let the gRPC core match a burst of calls
+  /// without waiting for that round-trip, for the cost of a few idle
+  /// coroutines per method.
+  std::size_t listeners_per_queue{1};
+
   /// Optional grpc-core channel args
   /// @see https://grpc.github.io/grpc/core/group__grpc__arg__keys.html
   std::unordered_map<std::string, std::string> channel_args{};
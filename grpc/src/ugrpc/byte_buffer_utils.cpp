@@ -0,0 +1,40 @@
+#include <userver/ugrpc/byte_buffer_utils.hpp>
+
+#include <stdexcept>
+
+#include <grpcpp/impl/codegen/proto_utils.h>
+#include <grpcpp/support/proto_buffer_reader.h>
+#include <grpcpp/support/proto_buffer_writer.h>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace ugrpc {
+
+grpc::ByteBuffer SerializeToByteBuffer(
+    const google::protobuf::Message& message) {
+  grpc::ByteBuffer buffer;
+  bool own_buffer = false;
+  const auto status =
+      grpc::GenericSerialize<grpc::ProtoBufferWriter,
+                             google::protobuf::Message>(message, &buffer,
+                                                        &own_buffer);
+  if (!status.ok()) {
+    throw std::runtime_error("Failed to serialize '" +
+                             message.GetTypeName() +
+                             "': " + status.error_message());
+  }
+  return buffer;
+}
+
+bool ParseFromByteBuffer(const grpc::ByteBuffer& buffer,
+                         google::protobuf::Message& message) {
+  // The copy references the same slices, ProtoBufferReader reads them in place
+  grpc::ByteBuffer view{buffer};
+  grpc::ProtoBufferReader reader{&view};
+  if (!reader.status().ok()) return false;
+  return message.ParseFromZeroCopyStream(&reader);
+}
+
+}  // namespace ugrpc
+
+USERVER_NAMESPACE_END
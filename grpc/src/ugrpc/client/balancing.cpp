@@ -0,0 +1,23 @@
+#include <userver/ugrpc/client/balancing.hpp>
+
+#include <userver/utils/trivial_map.hpp>
+#include <userver/yaml_config/yaml_config.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace ugrpc::client {
+
+BalancingPolicy Parse(const yaml_config::YamlConfig& value,
+                      formats::parse::To<BalancingPolicy>) {
+  constexpr utils::TrivialBiMap kMap([](auto selector) {
+    return selector()
+        .Case(BalancingPolicy::kRandom, "random")
+        .Case(BalancingPolicy::kPowerOfTwoChoices, "p2c");
+  });
+
+  return utils::ParseFromValueString(value, kMap);
+}
+
+}  // namespace ugrpc::client
+
+USERVER_NAMESPACE_END
@@ -32,7 +32,8 @@ ClientFactory::ClientFactory(ClientFactorySettings&& settings,
       channel_cache_(testsuite_grpc.IsTlsEnabled()
                          ? settings.credentials
                          : grpc::InsecureChannelCredentials(),
-                     settings.channel_args, settings.channel_count),
+                     settings.channel_args, settings.channel_count,
+                     settings.balancing),
       client_statistics_storage_(statistics_storage,
                                  ugrpc::impl::StatisticsDomain::kClient),
       config_source_(source),
@@ -46,7 +47,8 @@ ClientFactory::ClientFactory(ClientFactorySettings&& settings,
         std::make_unique<impl::ChannelCache>(
             testsuite_grpc.IsTlsEnabled() ? creds
                                           : grpc::InsecureChannelCredentials(),
-            settings.channel_args, settings.channel_count));
+            settings.channel_args, settings.channel_count,
+            settings.balancing));
   }
 }
 
@@ -119,6 +119,26 @@ properties:
         description: |
             Number of channels created for each endpoint.
         defaultDescription: 1
+    balancing-policy:
+        type: string
+        description: |
+            how an RPC picks one of the channels of the endpoint, 'p2c' picks
+            the less loaded of two random channels by RPCs in flight and latency
+        defaultDescription: random
+        enum:
+          - random
+          - p2c
+    outlier-ejection-errors:
+        type: integer
+        description: |
+            with 'p2c', number of consecutive server errors after which a
+            channel is not picked for outlier-ejection-duration, 0 to disable
+        defaultDescription: 5
+        minimum: 0
+    outlier-ejection-duration:
+        type: string
+        description: with 'p2c', how long an ejected channel is not picked
+        defaultDescription: 10s
     middlewares:
         type: array
         items:
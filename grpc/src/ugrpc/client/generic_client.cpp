@@ -0,0 +1,104 @@
+#include <userver/ugrpc/client/generic_client.hpp>
+
+#include <optional>
+#include <string>
+#include <utility>
+
+#include <grpcpp/generic/generic_stub.h>
+
+#include <userver/utils/text_light.hpp>
+
+#include <userver/ugrpc/client/impl/call_params.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace ugrpc::client {
+
+namespace {
+
+// The method names are chosen by the user at runtime, so all the calls are
+// accounted under a single method to keep the number of metrics bounded
+constexpr std::string_view kGenericMethodFullNames[] = {"Generic/Generic"};
+
+constexpr std::string_view kGenericServiceName = "Generic";
+
+struct GenericService final {
+  using Stub = grpc::GenericStub;
+
+  static std::unique_ptr<Stub> NewStub(std::shared_ptr<grpc::Channel> channel) {
+    return std::make_unique<Stub>(std::move(channel));
+  }
+};
+
+// Binds the method name, so that the calls can be prepared the same way as
+// with the code-generated stubs
+class GenericStubMethod final {
+ public:
+  GenericStubMethod(grpc::GenericStub& stub, std::string_view call_name)
+      : stub_(stub), method_("/" + std::string{call_name}) {}
+
+  impl::RawResponseReader<grpc::ByteBuffer> PrepareUnaryCall(
+      grpc::ClientContext* context, const grpc::ByteBuffer& request,
+      grpc::CompletionQueue* queue) {
+    return stub_.PrepareUnaryCall(context, method_, request, queue);
+  }
+
+  impl::RawReaderWriter<grpc::ByteBuffer, grpc::ByteBuffer> PrepareCall(
+      grpc::ClientContext* context, grpc::CompletionQueue* queue) {
+    return stub_.PrepareCall(context, method_, queue);
+  }
+
+ private:
+  grpc::GenericStub& stub_;
+  const std::string method_;
+};
+
+impl::CallParams CreateGenericCallParams(
+    const impl::ClientData& client_data, std::string_view call_name,
+    std::unique_ptr<grpc::ClientContext> context, const Qos& qos) {
+  UINVARIANT(!call_name.empty() && !utils::text::StartsWith(call_name, "/"),
+             "Expected a call name in the 'package.Service/Method' format");
+  ApplyQos(*context, qos, client_data.GetTestsuiteControl());
+
+  auto hedging = qos.hedging;
+  auto call_params = impl::DoCreateCallParams(
+      client_data, 0, std::move(context), std::move(hedging));
+  call_params.owned_call_name = std::string{call_name};
+  return call_params;
+}
+
+}  // namespace
+
+GenericClient::GenericClient(impl::ClientParams&& client_params)
+    : impl_(std::move(client_params), GetMetadata(),
+            std::in_place_type<GenericService>) {}
+
+client::UnaryCall<grpc::ByteBuffer> GenericClient::UnaryCall(
+    std::string_view call_name, const grpc::ByteBuffer& request,
+    std::unique_ptr<grpc::ClientContext> context, const Qos& qos) const {
+  auto call_params =
+      CreateGenericCallParams(impl_, call_name, std::move(context), qos);
+  GenericStubMethod stub{
+      impl_.GetStub<GenericService>(call_params.channel_lease), call_name};
+  return {std::move(call_params), stub, &GenericStubMethod::PrepareUnaryCall,
+          request};
+}
+
+client::BidirectionalStream<grpc::ByteBuffer, grpc::ByteBuffer>
+GenericClient::BidirectionalStream(std::string_view call_name,
+                                   std::unique_ptr<grpc::ClientContext> context,
+                                   const Qos& qos) const {
+  auto call_params =
+      CreateGenericCallParams(impl_, call_name, std::move(context), qos);
+  GenericStubMethod stub{
+      impl_.GetStub<GenericService>(call_params.channel_lease), call_name};
+  return {std::move(call_params), stub, &GenericStubMethod::PrepareCall};
+}
+
+ugrpc::impl::StaticServiceMetadata GenericClient::GetMetadata() {
+  return {kGenericServiceName, kGenericMethodFullNames};
+}
+
+}  // namespace ugrpc::client
+
+USERVER_NAMESPACE_END
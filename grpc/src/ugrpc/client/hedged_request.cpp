@@ -0,0 +1,66 @@
+#include <userver/ugrpc/client/hedged_request.hpp>
+
+#include <cstdint>
+
+#include <userver/engine/task/cancel.hpp>
+
+#include <ugrpc/impl/internal_tag.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace ugrpc::client::impl {
+
+namespace {
+
+// Attempts are bounded by their own deadlines, this is only a safety net
+constexpr std::chrono::milliseconds kTimeoutSlack{100};
+constexpr std::chrono::hours kNoTimeout{100};
+
+}  // namespace
+
+const std::optional<HedgingQos>& GetHedging(CallAnyBase& call) {
+  return call.GetData(ugrpc::impl::InternalTag{}).GetHedging();
+}
+
+utils::hedging::HedgingSettings MakeHedgingSettings(
+    const HedgingQos& hedging, const grpc::ClientContext& context) {
+  utils::hedging::HedgingSettings settings;
+  settings.max_attempts = hedging.attempts;
+  settings.hedging_delay = hedging.delay;
+
+  const auto now = std::chrono::system_clock::now();
+  const auto deadline = context.deadline();
+  if (now + kNoTimeout < deadline) {
+    settings.timeout_all = kNoTimeout;
+  } else {
+    // Every attempt gets the same timeout, the last one starts after
+    // (attempts - 1) hedging delays
+    const auto last_start =
+        hedging.delay * static_cast<std::int64_t>(hedging.attempts - 1);
+    settings.timeout_all =
+        std::chrono::duration_cast<std::chrono::milliseconds>(deadline - now) +
+        last_start + kTimeoutSlack;
+  }
+  return settings;
+}
+
+bool IsRetryable(const HedgingQos& hedging, grpc::StatusCode code) noexcept {
+  return std::find(hedging.retryable_codes.begin(),
+                   hedging.retryable_codes.end(),
+                   code) != hedging.retryable_codes.end();
+}
+
+void ThrowHedgingTimeout(std::string_view call_name) {
+  if (engine::current_task::ShouldCancel()) {
+    throw RpcCancelledError(call_name, "HedgedUnaryCall");
+  }
+  throw DeadlineExceededError(
+      call_name,
+      grpc::Status{grpc::StatusCode::DEADLINE_EXCEEDED,
+                   "No attempt of the hedged call has finished in time"},
+      std::nullopt, std::nullopt);
+}
+
+}  // namespace ugrpc::client::impl
+
+USERVER_NAMESPACE_END
@@ -36,6 +36,7 @@ void FinishAsyncMethodInvocation::Notify(bool ok) noexcept {
       }
 
       rpc_data_.GetStatsScope().Flush();
+      rpc_data_.GetChannelLease().OnFinished(status_.error_code());
 
       parsed_gstatus_ = ParsedGStatus::ProcessStatus(status_);
     } catch (const std::exception& e) {
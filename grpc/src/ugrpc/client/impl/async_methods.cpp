@@ -89,11 +89,15 @@ void FutureImpl::ClearData() noexcept { data_ = nullptr; }
 RpcData::RpcData(impl::CallParams&& params)
     : context_(std::move(params.context)),
       client_name_(params.call_name),
-      call_name_(params.call_name),
+      owned_call_name_(std::move(params.owned_call_name)),
+      call_name_(owned_call_name_.empty() ? params.call_name
+                                          : std::string_view{owned_call_name_}),
       stats_scope_(params.statistics),
       queue_(params.queue),
       config_values_(params.config),
-      mws_(params.mws) {
+      mws_(params.mws),
+      channel_lease_(std::move(params.channel_lease)),
+      hedging_(std::move(params.hedging)) {
   UASSERT(context_);
   UASSERT(!client_name_.empty());
   SetupSpan(span_, *context_, call_name_);
@@ -161,6 +165,16 @@ ugrpc::impl::RpcStatisticsScope& RpcData::GetStatsScope() noexcept {
   return stats_scope_;
 }
 
+ChannelBalancer::Lease& RpcData::GetChannelLease() noexcept {
+  UASSERT(context_);
+  return channel_lease_;
+}
+
+const std::optional<HedgingQos>& RpcData::GetHedging() const noexcept {
+  UASSERT(context_);
+  return hedging_;
+}
+
 void RpcData::SetFinished() noexcept {
   UASSERT(context_);
   UINVARIANT(!is_finished_, "Tried to finish already finished call");
@@ -6,14 +6,17 @@ namespace ugrpc::client::impl {
 
 CallParams DoCreateCallParams(const ClientData& client_data,
                               std::size_t method_id,
-                              std::unique_ptr<grpc::ClientContext> context) {
+                              std::unique_ptr<grpc::ClientContext> context,
+                              std::optional<HedgingQos>&& hedging) {
   return CallParams{client_data.GetClientName(),
                     client_data.GetQueue(),
                     client_data.GetConfigSnapshot(),
                     client_data.GetMetadata().method_full_names[method_id],
                     std::move(context),
                     client_data.GetStatistics(method_id),
-                    client_data.GetMiddlewares()};
+                    client_data.GetMiddlewares(),
+                    client_data.AcquireChannel(),
+                    std::move(hedging)};
 }
 
 }  // namespace ugrpc::client::impl
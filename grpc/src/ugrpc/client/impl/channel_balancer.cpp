@@ -0,0 +1,144 @@
+#include <userver/ugrpc/client/impl/channel_balancer.hpp>
+
+#include <algorithm>
+#include <utility>
+
+#include <userver/logging/log.hpp>
+#include <userver/utils/assert.hpp>
+#include <userver/utils/rand.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace ugrpc::client::impl {
+
+namespace {
+
+// The weight of a new latency sample is 1/kEwmaWeight
+constexpr std::int64_t kEwmaWeight = 8;
+
+bool IsServerError(grpc::StatusCode code) {
+  switch (code) {
+    case grpc::StatusCode::UNAVAILABLE:
+    case grpc::StatusCode::INTERNAL:
+    case grpc::StatusCode::UNKNOWN:
+    case grpc::StatusCode::DATA_LOSS:
+      return true;
+    default:
+      return false;
+  }
+}
+
+}  // namespace
+
+ChannelBalancer::ChannelBalancer(std::size_t channel_count,
+                                 const BalancingSettings& settings)
+    : settings_(settings), channels_(channel_count) {
+  UINVARIANT(channel_count > 0, "Channels count must be greater than zero");
+}
+
+ChannelBalancer::Lease ChannelBalancer::Acquire() {
+  const auto index = Pick();
+  if (settings_.policy == BalancingPolicy::kRandom) return {nullptr, index};
+
+  channels_[index].in_flight.fetch_add(1, std::memory_order_relaxed);
+  return {this, index};
+}
+
+std::size_t ChannelBalancer::Pick() const {
+  const auto size = channels_.size();
+  if (size == 1) return 0;
+  if (settings_.policy == BalancingPolicy::kRandom) {
+    return utils::RandRange(size);
+  }
+
+  const auto first = utils::RandRange(size);
+  const auto second = (first + 1 + utils::RandRange(size - 1)) % size;
+
+  const auto now = Clock::now();
+  const bool first_ejected = IsEjected(channels_[first], now);
+  const bool second_ejected = IsEjected(channels_[second], now);
+  if (first_ejected != second_ejected) return first_ejected ? second : first;
+
+  const auto cost = [](const ChannelState& channel) {
+    const auto in_flight = channel.in_flight.load(std::memory_order_relaxed);
+    const auto latency =
+        channel.latency_ewma_us.load(std::memory_order_relaxed);
+    return static_cast<std::int64_t>(in_flight + 1) * (latency + 1);
+  };
+  return cost(channels_[first]) <= cost(channels_[second]) ? first : second;
+}
+
+bool ChannelBalancer::IsEjected(const ChannelState& channel,
+                                Clock::time_point now) const {
+  return channel.ejected_until.load(std::memory_order_relaxed) >
+         now.time_since_epoch().count();
+}
+
+void ChannelBalancer::Release(std::size_t index) noexcept {
+  channels_[index].in_flight.fetch_sub(1, std::memory_order_relaxed);
+}
+
+void ChannelBalancer::OnFinished(std::size_t index, Clock::duration latency,
+                                 grpc::StatusCode code) noexcept {
+  auto& channel = channels_[index];
+
+  if (!IsServerError(code)) {
+    const auto sample =
+        std::chrono::duration_cast<std::chrono::microseconds>(latency).count();
+    const auto old = channel.latency_ewma_us.load(std::memory_order_relaxed);
+    // Concurrent updates may lose a sample, which is fine for an estimate
+    channel.latency_ewma_us.store(
+        old == 0 ? sample : old + (sample - old) / kEwmaWeight,
+        std::memory_order_relaxed);
+    channel.consecutive_errors.store(0, std::memory_order_relaxed);
+    return;
+  }
+
+  if (settings_.ejection_errors == 0) return;
+  const auto errors =
+      channel.consecutive_errors.fetch_add(1, std::memory_order_relaxed) + 1;
+  if (errors < settings_.ejection_errors) return;
+
+  channel.consecutive_errors.store(0, std::memory_order_relaxed);
+  const auto ejected_until = Clock::now() + settings_.ejection_duration;
+  channel.ejected_until.store(ejected_until.time_since_epoch().count(),
+                              std::memory_order_relaxed);
+  LOG_LIMITED_WARNING() << "gRPC channel #" << index << " is ejected for "
+                        << settings_.ejection_duration.count() << "ms after "
+                        << errors << " consecutive errors";
+}
+
+ChannelBalancer::Lease::Lease(ChannelBalancer* balancer,
+                              std::size_t index) noexcept
+    : balancer_(balancer), index_(index) {
+  if (balancer_) start_ = Clock::now();
+}
+
+ChannelBalancer::Lease::Lease(Lease&& other) noexcept
+    : balancer_(std::exchange(other.balancer_, nullptr)),
+      index_(other.index_),
+      start_(other.start_),
+      finished_(other.finished_) {}
+
+ChannelBalancer::Lease& ChannelBalancer::Lease::operator=(
+    Lease&& other) noexcept {
+  std::swap(balancer_, other.balancer_);
+  std::swap(index_, other.index_);
+  std::swap(start_, other.start_);
+  std::swap(finished_, other.finished_);
+  return *this;
+}
+
+ChannelBalancer::Lease::~Lease() {
+  if (balancer_) balancer_->Release(index_);
+}
+
+void ChannelBalancer::Lease::OnFinished(grpc::StatusCode code) noexcept {
+  UASSERT(!finished_);
+  if (!balancer_ || std::exchange(finished_, true)) return;
+  balancer_->OnFinished(index_, Clock::now() - start_, code);
+}
+
+}  // namespace ugrpc::client::impl
+
+USERVER_NAMESPACE_END
@@ -55,10 +55,22 @@ std::size_t ChannelCache::Token::GetChannelCount() const noexcept {
   return counted_channel_->channels.size();
 }
 
+ChannelBalancer& ChannelCache::Token::GetBalancer() const noexcept {
+  UASSERT(counted_channel_);
+  return counted_channel_->balancer;
+}
+
+utils::RetryBudget& ChannelCache::Token::GetRetryBudget() const noexcept {
+  UASSERT(counted_channel_);
+  return counted_channel_->retry_budget;
+}
+
 ChannelCache::CountedChannel::CountedChannel(
     const std::string& endpoint,
     const std::shared_ptr<grpc::ChannelCredentials>& credentials,
-    const grpc::ChannelArguments& channel_args, std::size_t count) {
+    const grpc::ChannelArguments& channel_args, std::size_t count,
+    const BalancingSettings& balancing_settings)
+    : balancer(count, balancing_settings) {
   const auto endpoint_string = ugrpc::impl::ToGrpcString(endpoint);
   channels = utils::GenerateFixedArray(count, [&](std::size_t) {
     return grpc::CreateCustomChannel(endpoint_string, credentials,
@@ -69,10 +81,12 @@ ChannelCache::CountedChannel::CountedChannel(
 
 ChannelCache::ChannelCache(
     std::shared_ptr<grpc::ChannelCredentials>&& credentials,
-    const grpc::ChannelArguments& channel_args, std::size_t channel_count)
+    const grpc::ChannelArguments& channel_args, std::size_t channel_count,
+    const BalancingSettings& balancing_settings)
     : credentials_(std::move(credentials)),
       channel_args_(channel_args),
-      channel_count_(channel_count) {
+      channel_count_(channel_count),
+      balancing_settings_(balancing_settings) {
   UINVARIANT(channel_count > 0, "Channels count must be greater than zero");
 }
 
@@ -80,8 +94,9 @@ ChannelCache::~ChannelCache() = default;
 
 ChannelCache::Token ChannelCache::Get(const std::string& endpoint) {
   auto channels = channels_.Lock();
-  const auto [it, _] = channels->try_emplace(endpoint, endpoint, credentials_,
-                                             channel_args_, channel_count_);
+  const auto [it, _] =
+      channels->try_emplace(endpoint, endpoint, credentials_, channel_args_,
+                            channel_count_, balancing_settings_);
   return {*this, it->first, it->second};
 }
 
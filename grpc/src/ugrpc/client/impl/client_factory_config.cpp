@@ -68,6 +68,14 @@ ClientFactoryConfig Parse(const yaml_config::YamlConfig& value,
       value["native-log-level"].As<logging::Level>(config.native_log_level);
   config.channel_count =
       value["channel-count"].As<std::size_t>(config.channel_count);
+  config.balancing.policy =
+      value["balancing-policy"].As<BalancingPolicy>(config.balancing.policy);
+  config.balancing.ejection_errors =
+      value["outlier-ejection-errors"].As<std::size_t>(
+          config.balancing.ejection_errors);
+  config.balancing.ejection_duration =
+      value["outlier-ejection-duration"].As<std::chrono::milliseconds>(
+          config.balancing.ejection_duration);
 
   return config;
 }
@@ -95,6 +103,7 @@ ClientFactorySettings MakeFactorySettings(
       config.channel_args,
       config.native_log_level,
       config.channel_count,
+      config.balancing,
   };
 }
 
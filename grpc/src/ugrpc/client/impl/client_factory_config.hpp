@@ -26,6 +26,9 @@ struct ClientFactoryConfig final {
   /// Number of underlying channels that will be created for every client
   /// in this factory.
   std::size_t channel_count{1};
+
+  /// Balancing of RPCs across the channels of an endpoint
+  BalancingSettings balancing{};
 };
 
 ClientFactoryConfig Parse(const yaml_config::YamlConfig& value,
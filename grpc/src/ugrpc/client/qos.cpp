@@ -8,11 +8,45 @@
 #include <userver/formats/parse/common_containers.hpp>
 #include <userver/formats/serialize/common_containers.hpp>
 #include <userver/testsuite/grpc_control.hpp>
+#include <userver/ugrpc/compression.hpp>
+#include <userver/ugrpc/status_codes.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
 namespace ugrpc::client {
 
+HedgingQos Parse(const formats::json::Value& value,
+                 formats::parse::To<HedgingQos>) {
+  HedgingQos result;
+  result.attempts = value["attempts"].As<std::size_t>(result.attempts);
+  result.delay = std::chrono::milliseconds{
+      value["delay-ms"].As<std::chrono::milliseconds::rep>(
+          result.delay.count())};
+
+  const auto codes = value["retryable-status-codes"];
+  if (!codes.IsMissing()) {
+    result.retryable_codes.clear();
+    for (const auto& code : codes) {
+      result.retryable_codes.push_back(
+          StatusCodeFromString(code.As<std::string>()));
+    }
+  }
+  return result;
+}
+
+formats::json::Value Serialize(const HedgingQos& hedging,
+                               formats::serialize::To<formats::json::Value>) {
+  formats::json::ValueBuilder result{formats::common::Type::kObject};
+  result["attempts"] = hedging.attempts;
+  result["delay-ms"] = hedging.delay.count();
+  formats::json::ValueBuilder codes{formats::common::Type::kArray};
+  for (const auto code : hedging.retryable_codes) {
+    codes.PushBack(std::string{ToString(code)});
+  }
+  result["retryable-status-codes"] = std::move(codes);
+  return result.ExtractValue();
+}
+
 Qos Parse(const formats::json::Value& value, formats::parse::To<Qos>) {
   Qos result;
   const auto ms =
@@ -20,6 +54,12 @@ Qos Parse(const formats::json::Value& value, formats::parse::To<Qos>) {
   if (ms) {
     result.timeout = std::chrono::milliseconds{*ms};
   }
+  result.hedging = value["hedging"].As<std::optional<HedgingQos>>();
+  const auto compression =
+      value["compression"].As<std::optional<std::string>>();
+  if (compression) {
+    result.compression = CompressionAlgorithmFromString(*compression);
+  }
   return result;
 }
 
@@ -27,11 +67,21 @@ formats::json::Value Serialize(const Qos& qos,
                                formats::serialize::To<formats::json::Value>) {
   formats::json::ValueBuilder result{formats::common::Type::kObject};
   result["timeout-ms"] = qos.timeout;
+  if (qos.hedging) result["hedging"] = *qos.hedging;
+  if (qos.compression) {
+    result["compression"] = std::string{ToString(*qos.compression)};
+  }
   return result.ExtractValue();
 }
 
 void ApplyQos(grpc::ClientContext& context, const Qos& qos,
               const testsuite::GrpcControl& testsuite_control) {
+  // The first applied Qos wins, same as for the timeout
+  if (qos.compression &&
+      context.compression_algorithm() == GRPC_COMPRESS_NONE) {
+    context.set_compression_algorithm(*qos.compression);
+  }
+
   if (!qos.timeout) return;
 
   auto deadline = context.deadline();
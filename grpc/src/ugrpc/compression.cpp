@@ -0,0 +1,48 @@
+#include <userver/ugrpc/compression.hpp>
+
+#include <stdexcept>
+
+#include <fmt/format.h>
+
+#include <userver/utils/assert.hpp>
+#include <userver/utils/trivial_map.hpp>
+#include <userver/utils/underlying_value.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace ugrpc {
+
+// The names are the same as in the 'grpc-encoding' header
+constexpr utils::TrivialBiMap kCompressionAlgorithmsMap([](auto selector) {
+  return selector()
+      .Case(GRPC_COMPRESS_NONE, "identity")
+      .Case(GRPC_COMPRESS_DEFLATE, "deflate")
+      .Case(GRPC_COMPRESS_GZIP, "gzip");
+});
+
+grpc_compression_algorithm CompressionAlgorithmFromString(
+    std::string_view str) {
+  const auto algorithm = kCompressionAlgorithmsMap.TryFindBySecond(str);
+  if (algorithm) {
+    return *algorithm;
+  }
+
+  throw std::runtime_error(
+      fmt::format("Invalid grpc compression algorithm: {}, expected one of {}",
+                  str, kCompressionAlgorithmsMap.DescribeSecond()));
+}
+
+std::string_view ToString(grpc_compression_algorithm algorithm) noexcept {
+  const auto str = kCompressionAlgorithmsMap.TryFindByFirst(algorithm);
+  if (str) {
+    return *str;
+  }
+
+  UASSERT_MSG(false, fmt::format("Invalid grpc compression algorithm: {}",
+                                 utils::UnderlyingValue(algorithm)));
+  return "<invalid compression algorithm>";
+}
+
+}  // namespace ugrpc
+
+USERVER_NAMESPACE_END
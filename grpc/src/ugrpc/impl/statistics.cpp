@@ -78,6 +78,16 @@ void MethodStatistics::AccountDeadlinePropagated() noexcept {
 
 void MethodStatistics::AccountCancelled() noexcept { ++cancelled_; }
 
+void MethodStatistics::AccountCompressedMessage(
+    std::size_t raw_bytes) noexcept {
+  ++compressed_messages_;
+  compressed_raw_bytes_.Add(utils::statistics::Rate{raw_bytes});
+}
+
+void MethodStatistics::AccountCompressionSkipped() noexcept {
+  ++compression_skipped_;
+}
+
 void DumpMetric(utils::statistics::Writer& writer,
                 const MethodStatistics& stats) {
   if (stats.domain_ == StatisticsDomain::kClient && !stats.started_.Load()) {
@@ -150,6 +160,16 @@ void DumpMetric(utils::statistics::Writer& writer,
       AsRateAndGauge{stats.deadline_updated_.Load()};
   writer["cancelled-by-deadline-propagation"] =
       AsRateAndGauge{deadline_cancelled_value};
+
+  // Only written for the methods with compression enabled
+  const auto compressed_messages_value = stats.compressed_messages_.Load();
+  const auto compression_skipped_value = stats.compression_skipped_.Load();
+  if (compressed_messages_value || compression_skipped_value) {
+    auto compression = writer["compression"];
+    compression["compressed-messages"] = compressed_messages_value;
+    compression["compressed-raw-bytes"] = stats.compressed_raw_bytes_.Load();
+    compression["skipped-messages"] = compression_skipped_value;
+  }
 }
 
 std::uint64_t MethodStatistics::GetStarted() const noexcept {
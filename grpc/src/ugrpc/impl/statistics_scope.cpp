@@ -32,6 +32,14 @@ void RpcStatisticsScope::OnDeadlinePropagated() {
   statistics_.AccountDeadlinePropagated();
 }
 
+void RpcStatisticsScope::OnMessageCompressed(std::size_t raw_bytes) {
+  statistics_.AccountCompressedMessage(raw_bytes);
+}
+
+void RpcStatisticsScope::OnCompressionSkipped() {
+  statistics_.AccountCompressionSkipped();
+}
+
 void RpcStatisticsScope::OnCancelled() {
   // If the task is cancelled, then this is what typically happens:
   //
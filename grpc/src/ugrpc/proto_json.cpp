@@ -3,6 +3,8 @@
 #include <grpcpp/support/config.h>
 #include <boost/container/small_vector.hpp>
 
+#include <fmt/format.h>
+
 #include <userver/utils/assert.hpp>
 
 USERVER_NAMESPACE_BEGIN
@@ -43,6 +45,27 @@ std::string ToJsonString(const google::protobuf::Message& message) {
   return result;
 }
 
+void JsonStringToMessage(std::string_view json,
+                         google::protobuf::Message& message) {
+  const auto status = google::protobuf::util::JsonStringToMessage(
+      {json.data(), json.size()}, &message);
+
+  if (!status.ok()) {
+    throw formats::json::ParseException(
+        fmt::format("Cannot parse protobuf message '{}' from json: {}",
+                    message.GetTypeName(), status.ToString()));
+  }
+}
+
+namespace impl {
+
+void WriteMessageToStream(const google::protobuf::Message& message,
+                          formats::json::StringBuilder& sw) {
+  sw.WriteRawString(ToJsonString(message));
+}
+
+}  // namespace impl
+
 }  // namespace ugrpc
 
 namespace formats::serialize {
@@ -0,0 +1,16 @@
+#include <userver/ugrpc/server/generic_service_base.hpp>
+
+#include <ugrpc/server/impl/generic_service_worker.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace ugrpc::server {
+
+std::unique_ptr<impl::ServiceWorker> GenericServiceBase::MakeWorker(
+    impl::ServiceSettings&& settings) {
+  return impl::MakeGenericServiceWorker(std::move(settings), *this);
+}
+
+}  // namespace ugrpc::server
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,192 @@
+#include <ugrpc/server/impl/generic_service_worker.hpp>
+
+#include <optional>
+#include <string>
+#include <string_view>
+
+#include <google/protobuf/arena.h>
+#include <grpcpp/generic/async_generic_service.h>
+
+#include <userver/engine/async.hpp>
+#include <userver/engine/task/cancel.hpp>
+#include <userver/tracing/in_place_span.hpp>
+#include <userver/utils/fast_scope_guard.hpp>
+#include <userver/utils/impl/wait_token_storage.hpp>
+#include <userver/utils/lazy_prvalue.hpp>
+
+#include <userver/ugrpc/impl/statistics.hpp>
+#include <userver/ugrpc/impl/statistics_scope.hpp>
+#include <userver/ugrpc/server/impl/async_method_invocation.hpp>
+#include <userver/ugrpc/server/impl/call_params.hpp>
+#include <userver/ugrpc/server/impl/service_worker_impl.hpp>
+#include <userver/ugrpc/server/middlewares/base.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace ugrpc::server::impl {
+
+namespace {
+
+// The method names of generic RPCs are controlled by the clients, so they are
+// all accounted under a single method to keep the number of metrics bounded
+constexpr std::string_view kGenericMethodFullNames[] = {"Generic/Generic"};
+
+const ugrpc::impl::StaticServiceMetadata kGenericMetadata{
+    "Generic", kGenericMethodFullNames};
+
+struct GenericServiceData final {
+  GenericServiceData(const ServiceSettings& settings,
+                     GenericServiceBase& service)
+      : settings(settings),
+        service(service),
+        statistics(settings.statistics_storage
+                       .GetServiceStatistics(kGenericMetadata)
+                       .GetMethodStatistics(0)) {}
+
+  const ServiceSettings settings;
+  GenericServiceBase& service;
+  grpc::AsyncGenericService async_service;
+  utils::impl::WaitTokenStorage wait_tokens;
+  ugrpc::impl::MethodStatistics& statistics;
+};
+
+class GenericCallData final {
+ public:
+  GenericCallData(GenericServiceData& service_data, int queue_num)
+      : wait_token_(service_data.wait_tokens.GetToken()),
+        service_data_(service_data),
+        queue_num_(queue_num) {}
+
+  void operator()() && {
+    // See the comments in CallData, the order of calls is the same
+    RpcFinishedEvent notify_when_done(
+        engine::current_task::GetCancellationToken(), context_);
+
+    context_.AsyncNotifyWhenDone(notify_when_done.GetTag());
+
+    auto& queue = service_data_.settings.queue.GetQueue(queue_num_);
+    service_data_.async_service.RequestCall(&context_, &raw_stream_, &queue,
+                                            &queue, prepare_.GetTag());
+
+    if (Wait(prepare_) != impl::AsyncMethodInvocation::WaitStatus::kOk) {
+      // the CompletionQueue is shutting down
+      return;
+    }
+
+    ListenAsync(service_data_, queue_num_);
+
+    HandleRpc();
+
+    notify_when_done.Wait();
+  }
+
+  static void ListenAsync(GenericServiceData& service_data, int queue_num) {
+    engine::CriticalAsyncNoSpan(service_data.settings.task_processor,
+                                utils::LazyPrvalue([&] {
+                                  return GenericCallData(service_data,
+                                                         queue_num);
+                                }))
+        .Detach();
+  }
+
+ private:
+  void HandleRpc() {
+    // "/package.Service/Method" -> "package.Service/Method"
+    std::string_view call_name = context_.method();
+    if (!call_name.empty() && call_name.front() == '/') {
+      call_name.remove_prefix(1);
+    }
+    const auto slash_pos = call_name.find('/');
+    const auto service_name = call_name.substr(0, slash_pos);
+    const auto method_name = slash_pos == std::string_view::npos
+                                 ? std::string_view{}
+                                 : call_name.substr(slash_pos + 1);
+
+    const auto& middlewares = service_data_.settings.middlewares;
+
+    SetupSpan(span_, context_, call_name);
+    utils::FastScopeGuard destroy_span([&]() noexcept { span_.reset(); });
+
+    ugrpc::impl::RpcStatisticsScope statistics_scope(service_data_.statistics);
+
+    auto& access_tskv_logger = service_data_.settings.access_tskv_logger;
+    utils::AnyStorage<StorageContext> storage_context;
+    const auto config = service_data_.settings.config_source.GetSnapshot();
+    GenericServiceBase::Call responder(
+        CallParams{context_, call_name, service_name, method_name,
+                   statistics_scope, *access_tskv_logger, span_->Get(),
+                   storage_context, middlewares, arena_,
+                   GetCompressionSettings(config, call_name)},
+        raw_stream_);
+    auto do_call = [&] { service_data_.service.Handle(responder); };
+
+    try {
+      MiddlewareCallContext middleware_context(middlewares, responder, do_call,
+                                               config, nullptr);
+      responder.RunMiddlewarePipeline(middleware_context);
+    } catch (
+        const USERVER_NAMESPACE::server::handlers::CustomHandlerException& ex) {
+      ReportCustomError(ex, responder, span_->Get());
+    } catch (const RpcInterruptedError& ex) {
+      ReportNetworkError(ex, call_name, span_->Get(), statistics_scope);
+    } catch (const std::exception& ex) {
+      ReportHandlerError(ex, call_name, span_->Get(), statistics_scope);
+    }
+  }
+
+  // 'wait_token_' must be the first field, because its lifetime keeps
+  // GenericServiceData alive during server shutdown.
+  const utils::impl::WaitTokenStorage::Token wait_token_;
+
+  GenericServiceData& service_data_;
+  const int queue_num_;
+
+  grpc::GenericServerContext context_{};
+  google::protobuf::Arena arena_{};
+  grpc::GenericServerAsyncReaderWriter raw_stream_{&context_};
+  ugrpc::impl::AsyncMethodInvocation prepare_;
+  std::optional<tracing::InPlaceSpan> span_{};
+};
+
+class GenericServiceWorker final : public ServiceWorker {
+ public:
+  GenericServiceWorker(ServiceSettings&& settings, GenericServiceBase& service)
+      : service_data_(settings, service) {}
+
+  ~GenericServiceWorker() override {
+    service_data_.wait_tokens.WaitForAllTokens();
+  }
+
+  void Register(grpc::ServerBuilder& builder) override {
+    builder.RegisterAsyncGenericService(&service_data_.async_service);
+  }
+
+  const ugrpc::impl::StaticServiceMetadata& GetMetadata() const override {
+    return kGenericMetadata;
+  }
+
+  void Start() override {
+    const auto& settings = service_data_.settings;
+    for (std::size_t i = 0; i < settings.queue.GetSize(); i++) {
+      // Every listener re-posts itself after matching a call, so the number of
+      // posted requests stays the same
+      for (std::size_t j = 0; j < settings.listeners_per_queue; j++) {
+        GenericCallData::ListenAsync(service_data_, static_cast<int>(i));
+      }
+    }
+  }
+
+ private:
+  GenericServiceData service_data_;
+};
+
+}  // namespace
+
+std::unique_ptr<ServiceWorker> MakeGenericServiceWorker(
+    ServiceSettings&& settings, GenericServiceBase& service) {
+  return std::make_unique<GenericServiceWorker>(std::move(settings), service);
+}
+
+}  // namespace ugrpc::server::impl
+
+USERVER_NAMESPACE_END
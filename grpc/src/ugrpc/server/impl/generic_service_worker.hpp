@@ -0,0 +1,17 @@
+#pragma once
+
+#include <memory>
+
+#include <userver/ugrpc/server/generic_service_base.hpp>
+#include <userver/ugrpc/server/impl/service_worker.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace ugrpc::server::impl {
+
+std::unique_ptr<ServiceWorker> MakeGenericServiceWorker(
+    ServiceSettings&& settings, GenericServiceBase& service);
+
+}  // namespace ugrpc::server::impl
+
+USERVER_NAMESPACE_END
@@ -1,6 +1,8 @@
 #include "server_configs.hpp"
 
 #include <userver/formats/json/value.hpp>
+#include <userver/formats/parse/common_containers.hpp>
+#include <userver/ugrpc/compression.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
@@ -9,6 +11,31 @@ namespace ugrpc::server::impl {
 const dynamic_config::Key<bool> kServerCancelTaskByDeadline{
     "USERVER_GRPC_SERVER_CANCEL_TASK_BY_DEADLINE", true};
 
+CompressionSettings Parse(const formats::json::Value& value,
+                          formats::parse::To<CompressionSettings>) {
+  CompressionSettings result;
+  result.algorithm = ugrpc::CompressionAlgorithmFromString(
+      value["algorithm"].As<std::string>());
+  result.min_message_size =
+      value["min-message-size"].As<std::size_t>(result.min_message_size);
+  return result;
+}
+
+const dynamic_config::Key<dynamic_config::ValueDict<CompressionSettings>>
+    kServerCompression{"USERVER_GRPC_SERVER_COMPRESSION",
+                       dynamic_config::DefaultAsJsonString{R"(
+{
+  "__default__": {
+    "algorithm": "identity"
+  }
+}
+)"}};
+
+CompressionSettings GetCompressionSettings(
+    const dynamic_config::Snapshot& config, std::string_view call_name) {
+  return config[kServerCompression][call_name];
+}
+
 }  // namespace ugrpc::server::impl
 
 USERVER_NAMESPACE_END
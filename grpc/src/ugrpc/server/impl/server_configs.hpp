@@ -1,6 +1,10 @@
 #pragma once
 
 #include <userver/dynamic_config/snapshot.hpp>
+#include <userver/dynamic_config/value.hpp>
+#include <userver/formats/json_fwd.hpp>
+
+#include <userver/ugrpc/server/impl/compression_settings.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
@@ -8,6 +12,13 @@ namespace ugrpc::server::impl {
 
 extern const dynamic_config::Key<bool> kServerCancelTaskByDeadline;
 
+CompressionSettings Parse(const formats::json::Value& value,
+                          formats::parse::To<CompressionSettings>);
+
+// Keyed by the full method name: "package.Service/Method"
+extern const dynamic_config::Key<dynamic_config::ValueDict<CompressionSettings>>
+    kServerCompression;
+
 }  // namespace ugrpc::server::impl
 
 USERVER_NAMESPACE_END
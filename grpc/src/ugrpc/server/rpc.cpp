@@ -152,6 +152,46 @@ void CallAnyBase::ApplyResponseHook(google::protobuf::Message* response) {
   }
 }
 
+void CallAnyBase::ApplyCompression(const google::protobuf::Message& response) {
+  if (ShouldCompress(response.ByteSizeLong())) {
+    params_.context.set_compression_algorithm(params_.compression.algorithm);
+  }
+}
+
+void CallAnyBase::EnableStreamCompression() {
+  if (params_.compression.algorithm != GRPC_COMPRESS_NONE) {
+    params_.context.set_compression_algorithm(params_.compression.algorithm);
+  }
+}
+
+void CallAnyBase::ApplyCompression(const google::protobuf::Message& response,
+                                   grpc::WriteOptions& options) {
+  if (params_.compression.algorithm != GRPC_COMPRESS_NONE &&
+      !ShouldCompress(response.ByteSizeLong())) {
+    options.set_no_compression();
+  }
+}
+
+void CallAnyBase::ApplyCompression(const grpc::ByteBuffer& response,
+                                   grpc::WriteOptions& options) {
+  if (params_.compression.algorithm != GRPC_COMPRESS_NONE &&
+      !ShouldCompress(response.Length())) {
+    options.set_no_compression();
+  }
+}
+
+bool CallAnyBase::ShouldCompress(std::size_t response_size) {
+  const auto& compression = params_.compression;
+  if (compression.algorithm == GRPC_COMPRESS_NONE) return false;
+
+  if (response_size < compression.min_message_size) {
+    params_.statistics.OnCompressionSkipped();
+    return false;
+  }
+  params_.statistics.OnMessageCompressed(response_size);
+  return true;
+}
+
 void CallAnyBase::RunMiddlewarePipeline(
     MiddlewareCallContext& md_call_context) {
   middleware_call_context_ = &md_call_context;
@@ -121,6 +121,7 @@ class Server::Impl final {
   ugrpc::impl::StatisticsStorage statistics_storage_;
   const dynamic_config::Source config_source_;
   logging::LoggerPtr access_tskv_logger_;
+  const std::size_t listeners_per_queue_;
 };
 
 Server::Impl::Impl(ServerConfig&& config,
@@ -129,7 +130,9 @@ Server::Impl::Impl(ServerConfig&& config,
     : statistics_storage_(statistics_storage,
                           ugrpc::impl::StatisticsDomain::kServer),
       config_source_(config_source),
-      access_tskv_logger_(std::move(config.access_tskv_logger)) {
+      access_tskv_logger_(std::move(config.access_tskv_logger)),
+      listeners_per_queue_(config.listeners_per_queue) {
+  UINVARIANT(listeners_per_queue_ > 0, "listeners_per_queue must be positive");
   LOG_INFO() << "Configuring the gRPC server";
   ugrpc::impl::SetupNativeLogging();
   ugrpc::impl::UpdateNativeLogLevel(config.native_log_level);
@@ -200,6 +203,7 @@ void Server::Impl::AddService(ServiceBase& service, ServiceConfig&& config) {
       std::move(config.middlewares),
       access_tskv_logger_,
       config_source_,
+      listeners_per_queue_,
   }));
 }
 
@@ -290,7 +294,7 @@ void Server::Impl::DoStart() {
               "Multiple services have been registered "
               "for the same gRPC method");
   for (auto& worker : service_workers_) {
-    server_builder_->RegisterService(&worker->GetService());
+    worker->Register(*server_builder_);
   }
 
   server_ = server_builder_->BuildAndStart();
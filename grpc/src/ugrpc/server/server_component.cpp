@@ -54,6 +54,13 @@ properties:
             completion queue count to create. Should be ~2 times less than worker
             threads for best RPS.
         minimum: 1
+    listeners-per-queue:
+        type: integer
+        description: |
+            count of requests of each method posted to each completion queue
+            in advance, more listeners help to handle bursts of calls
+        defaultDescription: 1
+        minimum: 1
     channel-args:
         type: object
         description: a map of channel arguments, see gRPC Core docs
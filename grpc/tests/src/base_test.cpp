@@ -9,6 +9,7 @@
 #include <userver/engine/sleep.hpp>
 #include <userver/engine/task/task_with_result.hpp>
 #include <userver/utils/algo.hpp>
+#include <userver/utils/fixed_array.hpp>
 
 #include <tests/unit_test_client.usrv.pb.hpp>
 #include <tests/unit_test_service.usrv.pb.hpp>
@@ -419,4 +420,75 @@ UTEST_F(GrpcWriteAndFinish, BidirectionalStream) {
   EXPECT_FALSE(is.Read(in));
 }
 
+namespace {
+
+class ArenaService final : public sample::ugrpc::UnitTestServiceBase {
+ public:
+  void SayHello(SayHelloCall& call,
+                sample::ugrpc::GreetingRequest&& request) override {
+    EXPECT_EQ(request.GetArena(), &call.GetArena());
+
+    auto& response =
+        *google::protobuf::Arena::Create<sample::ugrpc::GreetingResponse>(
+            &call.GetArena());
+    response.set_name("Hello " + request.name());
+    call.Finish(response);
+  }
+};
+
+}  // namespace
+
+using GrpcArena = ugrpc::tests::ServiceFixture<ArenaService>;
+
+UTEST_F(GrpcArena, UnaryRPC) {
+  auto client = MakeClient<sample::ugrpc::UnitTestServiceClient>();
+  sample::ugrpc::GreetingRequest out;
+  out.set_name("userver");
+  auto call = client.SayHello(out);
+
+  // Responses may be parsed into arena messages on the client side too
+  google::protobuf::Arena arena;
+  auto& in =
+      *google::protobuf::Arena::Create<sample::ugrpc::GreetingResponse>(
+          &arena);
+  auto future = call.FinishAsync(in);
+  UEXPECT_NO_THROW(future.Get());
+  EXPECT_EQ("Hello userver", in.name());
+}
+
+namespace {
+
+ugrpc::server::ServerConfig MakeManyListenersServerConfig() {
+  ugrpc::server::ServerConfig config;
+  config.listeners_per_queue = 4;
+  return config;
+}
+
+class GrpcManyListeners
+    : public ugrpc::tests::ServiceFixture<UnitTestService> {
+ protected:
+  GrpcManyListeners()
+      : ugrpc::tests::ServiceFixture<UnitTestService>(
+            dynamic_config::MakeDefaultStorage({}),
+            MakeManyListenersServerConfig()) {}
+};
+
+}  // namespace
+
+UTEST_F_MT(GrpcManyListeners, ConcurrentUnaryRPC, 2) {
+  constexpr std::size_t kCallsCount = 16;
+  auto client = MakeClient<sample::ugrpc::UnitTestServiceClient>();
+
+  auto tasks = utils::GenerateFixedArray(kCallsCount, [&client](auto) {
+    return engine::AsyncNoSpan([&client] {
+      sample::ugrpc::GreetingRequest out;
+      out.set_name("userver");
+      auto call = client.SayHello(out, PrepareClientContext());
+      return call.Finish().name();
+    });
+  });
+
+  for (auto& task : tasks) EXPECT_EQ("Hello userver", task.Get());
+}
+
 USERVER_NAMESPACE_END
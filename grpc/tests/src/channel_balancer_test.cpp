@@ -0,0 +1,77 @@
+#include <userver/utest/utest.hpp>
+
+#include <chrono>
+#include <vector>
+
+#include <userver/ugrpc/client/impl/channel_balancer.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+using ugrpc::client::BalancingPolicy;
+using ugrpc::client::BalancingSettings;
+using ugrpc::client::impl::ChannelBalancer;
+
+constexpr std::size_t kIterations = 100;
+
+BalancingSettings MakeP2CSettings() {
+  BalancingSettings settings;
+  settings.policy = BalancingPolicy::kPowerOfTwoChoices;
+  settings.ejection_errors = 2;
+  settings.ejection_duration = std::chrono::minutes{1};
+  return settings;
+}
+
+}  // namespace
+
+UTEST(GrpcChannelBalancer, PicksLessLoadedChannel) {
+  ChannelBalancer balancer(2, MakeP2CSettings());
+
+  const auto busy = balancer.Acquire();
+  for (std::size_t i = 0; i < kIterations; ++i) {
+    const auto lease = balancer.Acquire();
+    EXPECT_NE(lease.GetChannelIndex(), busy.GetChannelIndex());
+  }
+}
+
+UTEST(GrpcChannelBalancer, EjectsFailingChannel) {
+  ChannelBalancer balancer(2, MakeP2CSettings());
+
+  const auto failing_index = balancer.Acquire().GetChannelIndex();
+  std::size_t errors = 0;
+  while (errors < 2) {
+    auto lease = balancer.Acquire();
+    if (lease.GetChannelIndex() == failing_index) {
+      lease.OnFinished(grpc::StatusCode::UNAVAILABLE);
+      ++errors;
+    } else {
+      lease.OnFinished(grpc::StatusCode::OK);
+    }
+  }
+
+  std::vector<ChannelBalancer::Lease> leases;
+  for (std::size_t i = 0; i < kIterations; ++i) {
+    leases.push_back(balancer.Acquire());
+    EXPECT_NE(leases.back().GetChannelIndex(), failing_index);
+  }
+}
+
+UTEST(GrpcChannelBalancer, ClientErrorsDoNotEject) {
+  ChannelBalancer balancer(2, MakeP2CSettings());
+
+  for (std::size_t i = 0; i < kIterations; ++i) {
+    balancer.Acquire().OnFinished(grpc::StatusCode::NOT_FOUND);
+  }
+
+  std::vector<std::size_t> picked(2);
+  std::vector<ChannelBalancer::Lease> leases;
+  for (std::size_t i = 0; i < kIterations; ++i) {
+    leases.push_back(balancer.Acquire());
+    ++picked[leases.back().GetChannelIndex()];
+  }
+  EXPECT_GT(picked[0], 0u);
+  EXPECT_GT(picked[1], 0u);
+}
+
+USERVER_NAMESPACE_END
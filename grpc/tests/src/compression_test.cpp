@@ -0,0 +1,121 @@
+#include <userver/utest/utest.hpp>
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <string_view>
+
+#include <fmt/format.h>
+
+#include <ugrpc/server/impl/server_configs.hpp>
+#include <userver/ugrpc/client/qos.hpp>
+#include <userver/ugrpc/compression.hpp>
+
+#include <tests/unit_test_client.usrv.pb.hpp>
+#include <tests/unit_test_service.usrv.pb.hpp>
+#include <userver/ugrpc/tests/service_fixtures.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+constexpr std::size_t kMinMessageSize = 100;
+const std::string kLargeName(10 * kMinMessageSize, 'a');
+
+class CompressionService final : public sample::ugrpc::UnitTestServiceBase {
+ public:
+  void SayHello(SayHelloCall& call,
+                sample::ugrpc::GreetingRequest&& request) override {
+    sample::ugrpc::GreetingResponse response;
+    response.set_name(std::move(*request.mutable_name()));
+    call.Finish(response);
+  }
+
+  void ReadMany(ReadManyCall& call,
+                sample::ugrpc::StreamGreetingRequest&& request) override {
+    sample::ugrpc::StreamGreetingResponse response;
+    response.set_name("small");
+    call.Write(response);
+    response.set_name(request.name());
+    call.Write(response);
+    call.Finish();
+  }
+};
+
+class GrpcCompression
+    : public ugrpc::tests::ServiceFixture<CompressionService> {
+ protected:
+  GrpcCompression() {
+    ugrpc::server::impl::CompressionSettings compression;
+    compression.algorithm = GRPC_COMPRESS_GZIP;
+    compression.min_message_size = kMinMessageSize;
+
+    ExtendDynamicConfig({
+        {ugrpc::server::impl::kServerCompression,
+         {{"__default__", compression}}},
+    });
+  }
+
+  std::uint64_t GetServerMetric(std::string_view method,
+                                const std::string& path) {
+    const auto statistics = GetStatistics(
+        "grpc.server.by-destination",
+        {{"grpc_destination",
+          fmt::format("sample.ugrpc.UnitTestService/{}", method)}});
+    return statistics.SingleMetric(path).AsRate().value;
+  }
+};
+
+}  // namespace
+
+UTEST_F(GrpcCompression, Unary) {
+  auto client = MakeClient<sample::ugrpc::UnitTestServiceClient>();
+
+  ugrpc::client::Qos qos;
+  qos.compression = GRPC_COMPRESS_DEFLATE;
+
+  sample::ugrpc::GreetingRequest request;
+  request.set_name(kLargeName);
+  auto response =
+      client.SayHello(request, std::make_unique<grpc::ClientContext>(), qos)
+          .Finish();
+  EXPECT_EQ(response.name(), kLargeName);
+
+  request.set_name("small");
+  response =
+      client.SayHello(request, std::make_unique<grpc::ClientContext>(), qos)
+          .Finish();
+  EXPECT_EQ(response.name(), "small");
+
+  EXPECT_EQ(GetServerMetric("SayHello", "compression.compressed-messages"), 1u);
+  EXPECT_GE(GetServerMetric("SayHello", "compression.compressed-raw-bytes"),
+            kLargeName.size());
+  EXPECT_EQ(GetServerMetric("SayHello", "compression.skipped-messages"), 1u);
+}
+
+UTEST_F(GrpcCompression, OutputStream) {
+  auto client = MakeClient<sample::ugrpc::UnitTestServiceClient>();
+
+  sample::ugrpc::StreamGreetingRequest request;
+  request.set_name(kLargeName);
+  auto stream = client.ReadMany(request);
+
+  sample::ugrpc::StreamGreetingResponse response;
+  ASSERT_TRUE(stream.Read(response));
+  EXPECT_EQ(response.name(), "small");
+  ASSERT_TRUE(stream.Read(response));
+  EXPECT_EQ(response.name(), kLargeName);
+  EXPECT_FALSE(stream.Read(response));
+
+  EXPECT_EQ(GetServerMetric("ReadMany", "compression.compressed-messages"), 1u);
+  EXPECT_EQ(GetServerMetric("ReadMany", "compression.skipped-messages"), 1u);
+}
+
+TEST(GrpcCompressionAlgorithm, FromString) {
+  EXPECT_EQ(ugrpc::CompressionAlgorithmFromString("gzip"), GRPC_COMPRESS_GZIP);
+  EXPECT_EQ(ugrpc::ToString(GRPC_COMPRESS_DEFLATE), "deflate");
+  EXPECT_THROW(ugrpc::CompressionAlgorithmFromString("zstd"),
+               std::runtime_error);
+}
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,116 @@
+#include <userver/utest/utest.hpp>
+
+#include <userver/ugrpc/byte_buffer_utils.hpp>
+#include <userver/ugrpc/client/generic_client.hpp>
+#include <userver/ugrpc/server/generic_service_base.hpp>
+
+#include <tests/unit_test_client.usrv.pb.hpp>
+#include <tests/unit_test_service.usrv.pb.hpp>
+#include <userver/ugrpc/tests/service_fixtures.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+constexpr std::string_view kSayHelloCallName =
+    "sample.ugrpc.UnitTestService/SayHello";
+
+class UnitTestService final : public sample::ugrpc::UnitTestServiceBase {
+ public:
+  void SayHello(SayHelloCall& call,
+                sample::ugrpc::GreetingRequest&& request) override {
+    sample::ugrpc::GreetingResponse response;
+    response.set_name("Hello " + request.name());
+    call.Finish(response);
+  }
+
+  void Chat(ChatCall& call) override {
+    sample::ugrpc::StreamGreetingRequest request;
+    sample::ugrpc::StreamGreetingResponse response;
+    while (call.Read(request)) {
+      response.set_number(request.number());
+      response.set_name("Hello " + request.name());
+      call.Write(response);
+    }
+    call.Finish();
+  }
+};
+
+class GenericEchoService final : public ugrpc::server::GenericServiceBase {
+ public:
+  void Handle(Call& call) override {
+    EXPECT_EQ(call.GetCallName(), kSayHelloCallName);
+    EXPECT_EQ(call.GetServiceName(), "sample.ugrpc.UnitTestService");
+    EXPECT_EQ(call.GetMethodName(), "SayHello");
+
+    grpc::ByteBuffer request_bytes;
+    ASSERT_TRUE(call.Read(request_bytes));
+
+    sample::ugrpc::GreetingRequest request;
+    ASSERT_TRUE(ugrpc::ParseFromByteBuffer(request_bytes, request));
+
+    sample::ugrpc::GreetingResponse response;
+    response.set_name("Generic " + request.name());
+    call.WriteAndFinish(ugrpc::SerializeToByteBuffer(response));
+  }
+};
+
+}  // namespace
+
+using GenericClientTest = ugrpc::tests::ServiceFixture<UnitTestService>;
+
+UTEST_F(GenericClientTest, UnaryCall) {
+  auto client = MakeClient<ugrpc::client::GenericClient>();
+
+  sample::ugrpc::GreetingRequest request;
+  request.set_name("userver");
+  auto call =
+      client.UnaryCall(kSayHelloCallName, ugrpc::SerializeToByteBuffer(request));
+  EXPECT_EQ(call.GetCallName(), kSayHelloCallName);
+
+  const auto response_bytes = call.Finish();
+  sample::ugrpc::GreetingResponse response;
+  ASSERT_TRUE(ugrpc::ParseFromByteBuffer(response_bytes, response));
+  EXPECT_EQ(response.name(), "Hello userver");
+}
+
+UTEST_F(GenericClientTest, BidirectionalStream) {
+  auto client = MakeClient<ugrpc::client::GenericClient>();
+  auto call =
+      client.BidirectionalStream("sample.ugrpc.UnitTestService/Chat");
+
+  sample::ugrpc::StreamGreetingRequest request;
+  sample::ugrpc::StreamGreetingResponse response;
+  grpc::ByteBuffer response_bytes;
+  for (int i = 0; i < 3; ++i) {
+    request.set_number(i);
+    request.set_name("userver");
+    ASSERT_TRUE(call.Write(ugrpc::SerializeToByteBuffer(request)));
+    ASSERT_TRUE(call.Read(response_bytes));
+    ASSERT_TRUE(ugrpc::ParseFromByteBuffer(response_bytes, response));
+    EXPECT_EQ(response.number(), i);
+    EXPECT_EQ(response.name(), "Hello userver");
+  }
+  ASSERT_TRUE(call.WritesDone());
+  EXPECT_FALSE(call.Read(response_bytes));
+}
+
+UTEST_F(GenericClientTest, UnknownMethod) {
+  auto client = MakeClient<ugrpc::client::GenericClient>();
+  auto call = client.UnaryCall("sample.ugrpc.UnitTestService/Unknown",
+                               grpc::ByteBuffer{});
+  UEXPECT_THROW(static_cast<void>(call.Finish()),
+                ugrpc::client::UnimplementedError);
+}
+
+using GenericServiceTest = ugrpc::tests::ServiceFixture<GenericEchoService>;
+
+UTEST_F(GenericServiceTest, TypedClient) {
+  auto client = MakeClient<sample::ugrpc::UnitTestServiceClient>();
+  sample::ugrpc::GreetingRequest request;
+  request.set_name("userver");
+  const auto response = client.SayHello(request).Finish();
+  EXPECT_EQ(response.name(), "Generic userver");
+}
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,120 @@
+#include <userver/utest/utest.hpp>
+
+#include <atomic>
+#include <chrono>
+
+#include <userver/engine/sleep.hpp>
+
+#include <userver/ugrpc/client/exceptions.hpp>
+#include <userver/ugrpc/client/hedged_request.hpp>
+
+#include <tests/unit_test_client.usrv.pb.hpp>
+#include <tests/unit_test_service.usrv.pb.hpp>
+#include <userver/ugrpc/tests/service_fixtures.hpp>
+
+using namespace std::chrono_literals;
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+using Client = sample::ugrpc::UnitTestServiceClient;
+
+// The first call is slow, the others answer right away
+class SlowFirstService final : public sample::ugrpc::UnitTestServiceBase {
+ public:
+  void SayHello(SayHelloCall& call,
+                sample::ugrpc::GreetingRequest&& request) override {
+    if (calls_++ == 0) engine::InterruptibleSleepFor(1s);
+    sample::ugrpc::GreetingResponse response;
+    response.set_name("Hello " + request.name());
+    call.Finish(response);
+  }
+
+  std::size_t GetCalls() const { return calls_; }
+
+ private:
+  std::atomic<std::size_t> calls_{0};
+};
+
+// The first call fails with UNAVAILABLE, the others succeed
+class UnavailableFirstService final
+    : public sample::ugrpc::UnitTestServiceBase {
+ public:
+  void SayHello(SayHelloCall& call,
+                sample::ugrpc::GreetingRequest&& request) override {
+    if (calls_++ == 0) {
+      call.FinishWithError({grpc::StatusCode::UNAVAILABLE, "overloaded"});
+      return;
+    }
+    sample::ugrpc::GreetingResponse response;
+    response.set_name("Hello " + request.name());
+    call.Finish(response);
+  }
+
+ private:
+  std::atomic<std::size_t> calls_{0};
+};
+
+ugrpc::client::Qos MakeHedgingQos(std::size_t attempts) {
+  ugrpc::client::HedgingQos hedging;
+  hedging.attempts = attempts;
+  hedging.delay = 20ms;
+
+  ugrpc::client::Qos qos;
+  qos.timeout = 5s;
+  qos.hedging = hedging;
+  return qos;
+}
+
+sample::ugrpc::GreetingRequest MakeRequest() {
+  sample::ugrpc::GreetingRequest request;
+  request.set_name("userver");
+  return request;
+}
+
+}  // namespace
+
+using GrpcHedgingSlow = ugrpc::tests::ServiceFixture<SlowFirstService>;
+
+UTEST_F(GrpcHedgingSlow, SecondAttemptWins) {
+  auto client = MakeClient<Client>();
+
+  const auto response = ugrpc::client::HedgedUnaryCall(
+      client, &Client::SayHello, MakeRequest(), MakeHedgingQos(2));
+  EXPECT_EQ(response.name(), "Hello userver");
+  EXPECT_EQ(GetService().GetCalls(), 2u);
+}
+
+UTEST_F(GrpcHedgingSlow, NoHedgingWithoutSettings) {
+  auto client = MakeClient<Client>();
+
+  ugrpc::client::Qos qos;
+  qos.timeout = 100ms;
+  UEXPECT_THROW(ugrpc::client::HedgedUnaryCall(client, &Client::SayHello,
+                                               MakeRequest(), qos),
+                ugrpc::client::DeadlineExceededError);
+  EXPECT_EQ(GetService().GetCalls(), 1u);
+}
+
+using GrpcHedgingUnavailable =
+    ugrpc::tests::ServiceFixture<UnavailableFirstService>;
+
+UTEST_F(GrpcHedgingUnavailable, RetriesRetryableError) {
+  auto client = MakeClient<Client>();
+
+  const auto response = ugrpc::client::HedgedUnaryCall(
+      client, &Client::SayHello, MakeRequest(), MakeHedgingQos(2));
+  EXPECT_EQ(response.name(), "Hello userver");
+}
+
+UTEST_F(GrpcHedgingUnavailable, RethrowsLastError) {
+  auto client = MakeClient<Client>();
+
+  const auto qos = MakeHedgingQos(1);
+  UEXPECT_THROW(ugrpc::client::HedgedUnaryCall(client, &Client::SayHello,
+                                               MakeRequest(), qos),
+                ugrpc::client::UnavailableError);
+}
+
+USERVER_NAMESPACE_END
@@ -3,6 +3,12 @@
 #include <userver/utest/parameter_names.hpp>
 #include <userver/utest/utest.hpp>
 
+#include <vector>
+
+#include <userver/formats/json/inline.hpp>
+
+#include <tests/messages.pb.h>
+
 USERVER_NAMESPACE_BEGIN
 
 namespace {
@@ -174,4 +180,41 @@ INSTANTIATE_TEST_SUITE_P(
     /*no prefix*/, SerializationTest, testing::ValuesIn(TestParams()),
     utest::PrintTestName());
 
+TEST(ProtoJson, WriteToStream) {
+  sample::ugrpc::StreamGreetingResponse message;
+  message.set_number(42);
+  message.set_name("userver");
+  const std::vector<sample::ugrpc::StreamGreetingResponse> messages{message,
+                                                                   message};
+
+  formats::json::StringBuilder sb;
+  WriteToStream(messages, sb);
+
+  const auto expected = formats::json::MakeArray(ugrpc::MessageToJson(message),
+                                                 ugrpc::MessageToJson(message));
+  EXPECT_EQ(formats::json::FromString(sb.GetString()), expected);
+}
+
+TEST(ProtoJson, JsonStringToMessage) {
+  sample::ugrpc::StreamGreetingResponse message;
+  ugrpc::JsonStringToMessage(R"({"number":42,"name":"userver"})", message);
+  EXPECT_EQ(message.number(), 42);
+  EXPECT_EQ(message.name(), "userver");
+
+  sample::ugrpc::StreamGreetingResponse round_trip;
+  ugrpc::JsonStringToMessage(ugrpc::ToJsonString(message), round_trip);
+  EXPECT_EQ(round_trip.number(), 42);
+  EXPECT_EQ(round_trip.name(), "userver");
+}
+
+TEST(ProtoJson, JsonStringToMessageError) {
+  sample::ugrpc::StreamGreetingResponse message;
+  EXPECT_THROW(ugrpc::JsonStringToMessage(R"({"number":"abc"})", message),
+               formats::json::ParseException);
+  EXPECT_THROW(ugrpc::JsonStringToMessage(R"({"unknown":1})", message),
+               formats::json::ParseException);
+  EXPECT_THROW(ugrpc::JsonStringToMessage("{", message),
+               formats::json::ParseException);
+}
+
 USERVER_NAMESPACE_END
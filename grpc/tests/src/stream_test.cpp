@@ -59,4 +59,67 @@ UTEST_F_MT(GrpcBidirectionalStream, BidirectionalStreamTest, 2) {
   ASSERT_EQ(responses.size(), kMessagesCount);
 }
 
+namespace {
+
+constexpr std::size_t kBatchSize = 1000;
+
+std::vector<sample::ugrpc::StreamGreetingResponse> MakeBatch() {
+  std::vector<sample::ugrpc::StreamGreetingResponse> batch(kBatchSize);
+  for (std::size_t i = 0; i < batch.size(); ++i) {
+    batch[i].set_number(static_cast<int>(i));
+  }
+  return batch;
+}
+
+class UnitTestServiceBatch final : public sample::ugrpc::UnitTestServiceBase {
+ public:
+  void ReadMany(ReadManyCall& call,
+                sample::ugrpc::StreamGreetingRequest&& /*request*/) override {
+    auto batch = MakeBatch();
+    call.WriteMany(batch);
+    call.Finish();
+  }
+
+  void Chat(ChatCall& call) override {
+    sample::ugrpc::StreamGreetingRequest request;
+    while (call.Read(request)) {
+      auto batch = MakeBatch();
+      call.WriteMany(batch);
+    }
+    call.Finish();
+  }
+};
+
+}  // namespace
+
+using GrpcBatchWrite = ugrpc::tests::ServiceFixture<UnitTestServiceBatch>;
+
+UTEST_F(GrpcBatchWrite, OutputStream) {
+  auto client = MakeClient<sample::ugrpc::UnitTestServiceClient>();
+  const sample::ugrpc::StreamGreetingRequest request;
+  auto stream = client.ReadMany(request);
+
+  sample::ugrpc::StreamGreetingResponse response;
+  std::size_t count = 0;
+  while (stream.Read(response)) {
+    EXPECT_EQ(response.number(), static_cast<int>(count));
+    ++count;
+  }
+  EXPECT_EQ(count, kBatchSize);
+}
+
+UTEST_F(GrpcBatchWrite, BidirectionalStream) {
+  auto client = MakeClient<sample::ugrpc::UnitTestServiceClient>();
+  auto stream = client.Chat();
+
+  ASSERT_TRUE(stream.Write({}));
+  sample::ugrpc::StreamGreetingResponse response;
+  for (std::size_t i = 0; i < kBatchSize; ++i) {
+    ASSERT_TRUE(stream.Read(response));
+    EXPECT_EQ(response.number(), static_cast<int>(i));
+  }
+  ASSERT_TRUE(stream.WritesDone());
+  EXPECT_FALSE(stream.Read(response));
+}
+
 USERVER_NAMESPACE_END
@@ -41,6 +41,9 @@ class Consumer;
 /// enable_auto_commit                 | whether to automatically and periodically commit offsets | false
 /// auto_offset_reset                  | action to take when there is no initial offset in offset store | --
 /// max_batch_size                     | maximum batch size for one callback call | --
+/// max_batch_bytes                    | maximum total size of keys and payloads of messages in one callback call, 0 means unlimited | 0
+/// queued_max_messages_kbytes         | maximum kilobytes of messages prefetched in background for each assigned partition | 65536
+/// max_parallel_partitions            | maximum number of partitions of a polled batch processed concurrently | 1
 /// env_pod_name                       | environment variable to substitute `{pod_name}` substring in `group_id` | none
 /// security_protocol                  | protocol used to communicate with brokers | --
 /// sasl_mechanisms                    | SASL mechanism to use for authentication | none
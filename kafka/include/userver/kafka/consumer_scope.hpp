@@ -46,6 +46,12 @@ class Consumer;
 /// @note Each `ConsumerScope` instance is not thread-safe. To speed up the topic
 /// messages processing, create more consumers with the same `group_id`.
 ///
+/// With `max_parallel_partitions` greater than 1 in the static config, a polled
+/// batch is split by partitions and the callback is invoked on the parts
+/// concurrently, in order within each partition. The next batch is polled when
+/// all the parts are processed, and `AsyncCommit` called from the callbacks
+/// commits the offsets only after that.
+///
 /// @see https://docs.confluent.io/platform/current/clients/consumer.html for
 /// basic consumer concepts
 /// @see
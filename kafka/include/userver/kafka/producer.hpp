@@ -2,10 +2,14 @@
 
 #include <chrono>
 #include <cstdint>
+#include <optional>
+#include <string_view>
+#include <vector>
 
 #include <userver/engine/task/task.hpp>
 #include <userver/engine/task/task_processor_fwd.hpp>
 #include <userver/engine/task/task_with_result.hpp>
+#include <userver/utils/span.hpp>
 #include <userver/utils/statistics/writer.hpp>
 
 USERVER_NAMESPACE_BEGIN
@@ -19,6 +23,15 @@ class ProducerImpl;
 
 }  // namespace impl
 
+/// @brief Message of `Producer::SendBatch`. Refers to the data, that must be
+/// alive until the batch is sent.
+struct ProducerMessage final {
+  std::string_view key;
+  std::string_view payload;
+  /// Partition chosen by internal Kafka partitioner if not set
+  std::optional<std::uint32_t> partition{};
+};
+
 /// @ingroup userver_clients
 ///
 /// @brief Apache Kafka Producer Client.
@@ -110,6 +123,25 @@ class Producer final {
       std::string topic_name, std::string key, std::string message,
       std::optional<std::uint32_t> partition = std::nullopt) const;
 
+  /// @brief Sends all the `messages` to topic `topic_name` at once and
+  /// asynchronously waits until each of them is delivered or the delivery
+  /// error occurred. Retries the transient delivery failures of the messages
+  /// as `Producer::Send` does.
+  ///
+  /// No keys and payloads are copied and the delivery of the whole batch is
+  /// awaited with a single future, so it is much cheaper than calling
+  /// `Producer::SendAsync` for each message.
+  ///
+  /// If the local producer queue is full, waits for it to be freed for a
+  /// limited time.
+  ///
+  /// @returns the delivery flags of the messages, in the order of `messages`
+  /// @warning The order messages are written to a partition may differ from
+  /// the order of `messages`, if some of them are retried
+  [[nodiscard]] std::vector<bool> SendBatch(
+      const std::string& topic_name,
+      utils::span<const ProducerMessage> messages) const;
+
   /// @brief Dumps per topic messages produce statistics.
   /// @see impl/stats.hpp
   void DumpMetric(utils::statistics::Writer& writer) const;
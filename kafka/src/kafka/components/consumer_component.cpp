@@ -20,9 +20,11 @@ ConsumerComponent::ConsumerComponent(
                     config, context, impl::EntityType::kConsumer),
                 config["topics"].As<std::vector<std::string>>(),
                 config["max_batch_size"].As<size_t>(),
+                config["max_batch_bytes"].As<size_t>(0),
                 config["poll_timeout"].As<std::chrono::milliseconds>(
                     impl::Consumer::kDefaultPollTimeout),
                 config["enable_auto_commit"].As<bool>(false),
+                config["max_parallel_partitions"].As<std::size_t>(1),
                 context.GetTaskProcessor("consumer-task-processor"),
                 context.GetTaskProcessor("main-task-processor")) {
   auto& storage =
@@ -96,6 +98,31 @@ properties:
     max_batch_size:
         type: integer
         description: maximum batch size for one callback call
+    max_batch_bytes:
+        type: integer
+        description: |
+            maximum total size of the keys and payloads
+            of the messages in one callback call, 0 means unlimited.
+            A batch always contains at least one message
+        defaultDescription: 0
+        minimum: 0
+    queued_max_messages_kbytes:
+        type: integer
+        description: |
+            maximum number of kilobytes of the messages
+            prefetched in background for each assigned partition
+        defaultDescription: 65536
+        minimum: 1
+    max_parallel_partitions:
+        type: integer
+        description: |
+            maximum number of partitions of a polled batch
+            processed concurrently. If greater than 1,
+            the callback is called on the messages of each
+            partition separately, the order is preserved
+            within a partition only
+        defaultDescription: 1
+        minimum: 1
     security_protocol:
         type: string
         description: protocol used to communicate with brokers
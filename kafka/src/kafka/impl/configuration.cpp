@@ -43,6 +43,8 @@ constexpr std::string_view kGroupIdField = "group_id";
 constexpr std::string_view kEnvPodNameField = "env_pod_name";
 constexpr std::string_view kEnableAutoCommitField = "enable_auto_commit";
 constexpr std::string_view kAutoOffsetResetField = "auto_offset_reset";
+constexpr std::string_view kQueuedMaxMessagesKbytesField =
+    "queued_max_messages_kbytes";
 
 constexpr std::string_view kPodNameSubstr = "{pod_name}";
 
@@ -233,6 +235,12 @@ void Configuration::SetConsumerOptions(
                 config[kEnableAutoCommitField].As<std::string>("false"));
   ConfSetOption(conf_, "auto.offset.reset",
                 config[kAutoOffsetResetField].As<std::string>());
+  if (config.HasMember(kQueuedMaxMessagesKbytesField)) {
+    /// @note `librdkafka` prefetches messages for each assigned partition in
+    /// background, the option caps the prefetched bytes per partition
+    ConfSetOption(conf_, "queued.max.messages.kbytes",
+                  config[kQueuedMaxMessagesKbytesField].As<std::string>());
+  }
 }
 
 void Configuration::SetProducerOptions(
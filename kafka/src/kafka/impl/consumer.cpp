@@ -1,7 +1,12 @@
 #include <kafka/impl/consumer.hpp>
 
+#include <exception>
+#include <map>
 #include <string_view>
+#include <utility>
 
+#include <userver/engine/semaphore.hpp>
+#include <userver/engine/task/task_with_result.hpp>
 #include <userver/formats/json/value_builder.hpp>
 #include <userver/testsuite/testpoint.hpp>
 #include <userver/tracing/span.hpp>
@@ -18,15 +23,19 @@ namespace kafka::impl {
 Consumer::Consumer(std::unique_ptr<Configuration> configuration,
                    const std::vector<std::string>& topics,
                    std::size_t max_batch_size,
+                   std::size_t max_batch_bytes,
                    std::chrono::milliseconds poll_timeout,
                    bool enable_auto_commit,
+                   std::size_t max_parallel_partitions,
                    engine::TaskProcessor& consumer_task_processor,
                    engine::TaskProcessor& main_task_processor)
     : component_name_(configuration->GetComponentName()),
       topics_(topics),
       max_batch_size_(max_batch_size),
+      max_batch_bytes_(max_batch_bytes),
       poll_timeout(poll_timeout),
       enable_auto_commit_(enable_auto_commit),
+      max_parallel_partitions_(max_parallel_partitions),
       consumer_task_processor_(consumer_task_processor),
       main_task_processor_(main_task_processor),
       consumer_(std::make_unique<ConsumerImpl>(std::move(configuration))) {}
@@ -65,7 +74,8 @@ void Consumer::StartMessageProcessing(ConsumerScope::Callback callback) {
 
         while (!engine::current_task::ShouldCancel()) {
           auto polled_messages = consumer_->PollBatch(
-              max_batch_size_, engine::Deadline::FromDuration(poll_timeout));
+              max_batch_size_, max_batch_bytes_,
+              engine::Deadline::FromDuration(poll_timeout));
 
           if (polled_messages.empty() || engine::current_task::ShouldCancel()) {
             /// @note Message batch may be not empty. It may be polled by
@@ -74,16 +84,15 @@ void Consumer::StartMessageProcessing(ConsumerScope::Callback callback) {
           }
           TESTPOINT(fmt::format("tp_{}_polled", component_name_), {});
 
-          auto batch_processing_task =
-              utils::Async(main_task_processor_, "messages_processing",
-                           callback, utils::span{polled_messages});
           try {
-            batch_processing_task.Get();
+            ProcessMessages(callback, std::move(polled_messages));
 
-            consumer_->AccountMessageBatchProcessingSucceeded(polled_messages);
+            if (commit_requested_.exchange(false)) {
+              consumer_->AsyncCommit();
+            }
             TESTPOINT(fmt::format("tp_{}", component_name_), {});
           } catch (const std::exception& e) {
-            consumer_->AccountMessageBatchProcessingFailed(polled_messages);
+            commit_requested_.store(false);
 
             const std::string error_text = e.what();
             LOG_ERROR() << fmt::format(
@@ -108,9 +117,78 @@ void Consumer::StartMessageProcessing(ConsumerScope::Callback callback) {
       });
 }
 
+/// @note Messages are taken by value to be destroyed on return, even if the
+/// callback throws
+void Consumer::ProcessMessages(const ConsumerScope::Callback& callback,
+                               std::vector<Message> messages) {
+  if (max_parallel_partitions_ > 1) {
+    ProcessPartitionsInParallel(callback, std::move(messages));
+    return;
+  }
+
+  auto batch_processing_task =
+      utils::Async(main_task_processor_, "messages_processing", callback,
+                   MessageBatchView{messages});
+  try {
+    batch_processing_task.Get();
+  } catch (const std::exception&) {
+    consumer_->AccountMessageBatchProcessingFailed(messages);
+    throw;
+  }
+  consumer_->AccountMessageBatchProcessingSucceeded(messages);
+}
+
+void Consumer::ProcessPartitionsInParallel(
+    const ConsumerScope::Callback& callback, std::vector<Message> messages) {
+  /// @note Messages of a partition keep their polling order
+  std::vector<std::vector<Message>> partitions_messages;
+  std::map<std::pair<std::string_view, int>, std::size_t> partition_indices;
+  for (auto& message : messages) {
+    const auto [it, inserted] = partition_indices.emplace(
+        std::make_pair(std::string_view{message.GetTopic()},
+                       message.GetPartition()),
+        partitions_messages.size());
+    if (inserted) partitions_messages.emplace_back();
+    partitions_messages[it->second].push_back(std::move(message));
+  }
+
+  engine::Semaphore workers{max_parallel_partitions_};
+  std::vector<engine::TaskWithResult<void>> processing_tasks;
+  processing_tasks.reserve(partitions_messages.size());
+  for (const auto& partition_messages : partitions_messages) {
+    processing_tasks.push_back(utils::Async(
+        main_task_processor_, "partition_messages_processing",
+        [&callback, &workers, &partition_messages] {
+          const engine::SemaphoreLock lock{workers};
+          callback(MessageBatchView{partition_messages});
+        }));
+  }
+
+  /// @note All the partitions are waited for, so that the offsets are never
+  /// committed ahead of an unprocessed message
+  std::exception_ptr processing_error;
+  for (std::size_t i = 0; i < processing_tasks.size(); ++i) {
+    try {
+      processing_tasks[i].Get();
+      consumer_->AccountMessageBatchProcessingSucceeded(partitions_messages[i]);
+    } catch (const std::exception&) {
+      consumer_->AccountMessageBatchProcessingFailed(partitions_messages[i]);
+      if (!processing_error) processing_error = std::current_exception();
+    }
+  }
+  if (processing_error) std::rethrow_exception(processing_error);
+}
+
 void Consumer::AsyncCommit() {
   UINVARIANT(processing_.load(), "Message processing is not currently started");
 
+  if (max_parallel_partitions_ > 1) {
+    /// @note Other partitions of the batch may be still processed, so commit
+    /// is postponed until the whole batch is processed
+    commit_requested_.store(true);
+    return;
+  }
+
   utils::Async(consumer_task_processor_, "consumer_committing", [this] {
     ExtendCurrentSpan();
 
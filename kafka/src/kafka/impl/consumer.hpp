@@ -1,6 +1,9 @@
 #pragma once
 
+#include <atomic>
 #include <chrono>
+#include <string>
+#include <vector>
 
 #include <userver/engine/task/task.hpp>
 #include <userver/engine/task/task_processor_fwd.hpp>
@@ -26,15 +29,21 @@ class Consumer final {
   /// @param topics stands for topics list that consumer subscribes to
   /// after `ConsumerScope::Start` called
   /// @param max_batch_size stands for max polled message batches size
+  /// @param max_batch_bytes stands for max total size of keys and payloads of
+  /// a polled batch, 0 means unlimited
   /// @param poll_timeout is a timeout for one message batch polling loop
   /// @param enable_auto_commit enables automatic periodically offsets
   /// committing. Note: if enabled, `AsyncCommit` should not be called manually
+  /// @param max_parallel_partitions stands for max number of partitions of a
+  /// polled batch processed concurrently. If greater than 1, the batch is split
+  /// by partitions and the callback is invoked on each part in a separate task
   /// @param consumer_task_processor -- task processor for message batches
   /// polling
   /// All callbacks are invoked in `main_task_processor`
   Consumer(std::unique_ptr<Configuration> configuration,
            const std::vector<std::string>& topics, std::size_t max_batch_size,
-           std::chrono::milliseconds poll_timeout, bool enable_auto_commit,
+           std::size_t max_batch_bytes, std::chrono::milliseconds poll_timeout, bool enable_auto_commit,
+           std::size_t max_parallel_partitions,
            engine::TaskProcessor& consumer_task_processor,
            engine::TaskProcessor& main_task_processor);
 
@@ -67,18 +76,33 @@ class Consumer final {
   /// understanding
   void AsyncCommit();
 
+  /// @brief Invokes `callback` on `messages` in `main_task_processor_` and
+  /// accounts the processing statistics. Rethrows the callback exception.
+  void ProcessMessages(const ConsumerScope::Callback& callback,
+                       std::vector<Message> messages);
+
+  /// @brief Invokes `callback` on the messages of each partition concurrently,
+  /// no more than `max_parallel_partitions_` at once.
+  void ProcessPartitionsInParallel(const ConsumerScope::Callback& callback,
+                                   std::vector<Message> messages);
+
   /// @brief Adds consumer name to current span.
   void ExtendCurrentSpan() const;
 
  private:
   std::atomic<bool> processing_{false};
+  /// @note Set by `AsyncCommit` in parallel mode, the offsets are committed by
+  /// the polling task after all the partitions of the batch are processed
+  std::atomic<bool> commit_requested_{false};
 
   const std::string component_name_;
 
   const std::vector<std::string> topics_;
   const std::size_t max_batch_size_{};
+  const std::size_t max_batch_bytes_{};
   const std::chrono::milliseconds poll_timeout{};
   const bool enable_auto_commit_{};
+  const std::size_t max_parallel_partitions_{};
 
   engine::TaskProcessor& consumer_task_processor_;
   engine::TaskProcessor& main_task_processor_;
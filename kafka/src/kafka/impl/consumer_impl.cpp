@@ -1,10 +1,14 @@
 #include <kafka/impl/consumer_impl.hpp>
 
+#include <algorithm>
 #include <chrono>
+#include <limits>
+#include <utility>
 
 #include <userver/logging/log.hpp>
 #include <userver/testsuite/testpoint.hpp>
 #include <userver/tracing/span.hpp>
+#include <userver/utils/assert.hpp>
 #include <userver/utils/span.hpp>
 
 #include <kafka/impl/configuration.hpp>
@@ -37,13 +41,46 @@ std::optional<std::chrono::milliseconds> RetrieveTimestamp(
   return std::chrono::milliseconds{timestamp};
 }
 
+std::size_t GetMessageBytes(const rd_kafka_message_t& message) {
+  return message.len + message.key_len;
+}
+
+/// @brief Accounts the message size in `in_flight_bytes` statistics until the
+/// message is destroyed.
+class InFlightBytesHolder final {
+ public:
+  using Counter = utils::statistics::RelaxedCounter<std::int64_t>;
+
+  InFlightBytesHolder(Counter& counter, std::size_t bytes)
+      : counter_(&counter), bytes_(static_cast<std::int64_t>(bytes)) {
+    *counter_ += bytes_;
+  }
+
+  InFlightBytesHolder(InFlightBytesHolder&& other) noexcept
+      : counter_(std::exchange(other.counter_, nullptr)),
+        bytes_(other.bytes_) {}
+  InFlightBytesHolder& operator=(InFlightBytesHolder&&) = delete;
+
+  ~InFlightBytesHolder() {
+    if (counter_) {
+      *counter_ -= bytes_;
+    }
+  }
+
+ private:
+  Counter* counter_;
+  std::int64_t bytes_;
+};
+
 }  // namespace
 
 struct Message::Data final {
-  Data(MessageHolder message_holder)
+  Data(MessageHolder message_holder,
+       InFlightBytesHolder::Counter& in_flight_bytes)
       : message(std::move(message_holder)),
         topic(rd_kafka_topic_name(message->rkt)),
-        timestamp(RetrieveTimestamp(message.get())) {}
+        timestamp(RetrieveTimestamp(message.get())),
+        in_flight(in_flight_bytes, GetMessageBytes(*message)) {}
 
   Data(Data&& other) = default;
 
@@ -51,10 +88,14 @@ struct Message::Data final {
 
   const std::string topic;
   std::optional<std::chrono::milliseconds> timestamp;
+
+  InFlightBytesHolder in_flight;
 };
 
 Message::~Message() = default;
 
+Message::Message(Message&&) = default;
+
 const std::string& Message::GetTopic() const { return data_->topic; }
 
 std::string_view Message::GetKey() const {
@@ -87,6 +128,9 @@ namespace impl {
 
 namespace {
 
+/// Max number of messages taken from the consumer queue at once
+constexpr std::size_t kMaxPollChunkSize{1024};
+
 void ErrorCallback(rd_kafka_t* consumer, int error_code, const char* reason,
                    void* opaque_ptr) {
   UASSERT(consumer);
@@ -179,10 +223,18 @@ ConsumerImpl::ConsumerHolder::ConsumerHolder(
 
   /// @note makes available to call `rd_kafka_consumer_poll`
   rd_kafka_poll_set_consumer(Handle());
+
+  queue_ = QueueHolder{rd_kafka_queue_get_consumer(Handle()),
+                       &rd_kafka_queue_destroy};
+  UINVARIANT(queue_, "Consumer queue is not available after poll forwarding");
 }
 
 rd_kafka_t* ConsumerImpl::ConsumerHolder::Handle() { return handle_.get(); }
 
+rd_kafka_queue_t* ConsumerImpl::ConsumerHolder::Queue() {
+  return queue_.get();
+}
+
 void ConsumerImpl::AssignPartitions(
     const rd_kafka_topic_partition_list_t* partitions) {
   LOG_INFO() << "Assigning new partitions to consumer";
@@ -360,13 +412,85 @@ std::optional<Message> ConsumerImpl::PollMessage(engine::Deadline deadline) {
   if (message == nullptr) {
     return std::nullopt;
   }
+  return TakePolledMessage(message.release());
+}
+
+ConsumerImpl::MessageBatch ConsumerImpl::PollBatch(std::size_t max_batch_size,
+                                                   std::size_t max_batch_bytes,
+                                                   engine::Deadline deadline) {
+  if (max_batch_bytes == 0) {
+    max_batch_bytes = std::numeric_limits<std::size_t>::max();
+  }
+
+  MessageBatch batch;
+  std::size_t batch_bytes{0};
+
+  std::vector<rd_kafka_message_t*> polled(
+      std::min(max_batch_size, kMaxPollChunkSize));
+
+  while (batch.size() < max_batch_size && batch_bytes < max_batch_bytes &&
+         !deadline.IsReached()) {
+    std::size_t chunk_size =
+        std::min(max_batch_size - batch.size(), polled.size());
+    if (!batch.empty()) {
+      /// @note Not to overshoot the bytes budget, polls no more messages than
+      /// fit in the remaining budget if they are of the average size
+      const auto average_bytes =
+          std::max<std::size_t>(batch_bytes / batch.size(), 1);
+      chunk_size = std::clamp<std::size_t>(
+          (max_batch_bytes - batch_bytes) / average_bytes, 1, chunk_size);
+    }
+
+    const auto poll_timeout{
+        std::chrono::duration_cast<std::chrono::milliseconds>(
+            deadline.TimeLeft())};
+    LOG_DEBUG() << fmt::format("Polling up to {} messages for {}ms",
+                               chunk_size, poll_timeout.count());
+
+    const auto polled_count = rd_kafka_consume_batch_queue(
+        consumer_->Queue(), static_cast<int>(poll_timeout.count()),
+        polled.data(), chunk_size);
+    if (polled_count < 0) {
+      LOG_WARNING() << fmt::format(
+          "Failed to poll messages: {}",
+          rd_kafka_err2str(rd_kafka_last_error()));
+      break;
+    }
+    if (polled_count == 0) {
+      break;
+    }
+
+    for (std::size_t i = 0; i < static_cast<std::size_t>(polled_count); ++i) {
+      auto message = TakePolledMessage(polled[i]);
+      if (message.has_value()) {
+        batch_bytes += message->GetKey().size() + message->GetPayload().size();
+        batch.push_back(std::move(*message));
+      }
+    }
+  }
+
+  stats_.local_queue_messages =
+      static_cast<std::int64_t>(rd_kafka_queue_length(consumer_->Queue()));
+
+  if (!batch.empty()) {
+    LOG_INFO() << fmt::format("Polled batch of {} messages ({} bytes)",
+                              batch.size(), batch_bytes);
+  }
+
+  return batch;
+}
+
+std::optional<Message> ConsumerImpl::TakePolledMessage(
+    rd_kafka_message_t* raw_message) {
+  MessageHolder message{raw_message, &rd_kafka_message_destroy};
   if (message->err != RD_KAFKA_RESP_ERR_NO_ERROR) {
     LOG_WARNING() << fmt::format("Consumed message with error: {}",
                                  rd_kafka_err2str(message->err));
     return std::nullopt;
   }
 
-  Message polled_message{Message::DataStorage{std::move(message)}};
+  Message polled_message{
+      Message::DataStorage{std::move(message), stats_.in_flight_bytes}};
 
   AccountPolledMessageStat(polled_message);
 
@@ -379,25 +503,6 @@ std::optional<Message> ConsumerImpl::PollMessage(engine::Deadline deadline) {
   return polled_message;
 }
 
-ConsumerImpl::MessageBatch ConsumerImpl::PollBatch(std::size_t max_batch_size,
-                                                   engine::Deadline deadline) {
-  MessageBatch batch;
-
-  while (batch.size() < max_batch_size) {
-    auto message = PollMessage(deadline);
-    if (!message.has_value()) {
-      break;
-    }
-    batch.push_back(std::move(*message));
-  }
-
-  if (!batch.empty()) {
-    LOG_INFO() << fmt::format("Polled batch of {} messages", batch.size());
-  }
-
-  return batch;
-}
-
 const Stats& ConsumerImpl::GetStats() const { return stats_; }
 
 std::shared_ptr<TopicStats> ConsumerImpl::GetTopicStats(
@@ -408,6 +513,8 @@ std::shared_ptr<TopicStats> ConsumerImpl::GetTopicStats(
 void ConsumerImpl::AccountPolledMessageStat(const Message& polled_message) {
   auto topic_stats = GetTopicStats(polled_message.GetTopic());
   ++topic_stats->messages_counts.messages_total;
+  topic_stats->messages_counts.bytes_total +=
+      polled_message.GetKey().size() + polled_message.GetPayload().size();
 
   const auto message_timestamp = polled_message.GetTimestamp();
   if (message_timestamp) {
@@ -52,9 +52,14 @@ class ConsumerImpl final {
   /// @note Must be called periodically to maintain consumer group membership
   std::optional<Message> PollMessage(engine::Deadline deadline);
 
-  /// @brief Effectively calls `PollMessage` until `deadline` is reached
-  /// and no more than `max_batch_size` messages polled.
-  MessageBatch PollBatch(std::size_t max_batch_size, engine::Deadline deadline);
+  /// @brief Takes the messages prefetched by `librdkafka` in bulk until
+  /// `deadline` is reached, `max_batch_size` messages are polled or
+  /// their keys and payloads size reaches `max_batch_bytes`.
+  /// @note `max_batch_bytes` equal to 0 means no bytes limit. The batch may
+  /// exceed the limit by one chunk tail, but always has at least one message
+  MessageBatch PollBatch(std::size_t max_batch_size,
+                         std::size_t max_batch_bytes,
+                         engine::Deadline deadline);
 
   const Stats& GetStats() const;
 
@@ -88,6 +93,10 @@ class ConsumerImpl final {
 
   void AccountPolledMessageStat(const Message& polled_message);
 
+  /// @brief Takes ownership of `raw_message` and wraps it into `Message`.
+  /// Returns `std::nullopt` for error events.
+  std::optional<Message> TakePolledMessage(rd_kafka_message_t* raw_message);
+
  private:
   const std::string component_name_;
   Stats stats_;
@@ -129,10 +138,18 @@ class ConsumerImpl final {
 
     rd_kafka_t* Handle();
 
+    /// @brief The consumer queue all the partitions are forwarded to.
+    rd_kafka_queue_t* Queue();
+
    private:
     using HandleHolder =
         std::unique_ptr<rd_kafka_t, decltype(&rd_kafka_destroy)>;
+    using QueueHolder =
+        std::unique_ptr<rd_kafka_queue_t, decltype(&rd_kafka_queue_destroy)>;
+
     HandleHolder handle_{nullptr, rd_kafka_destroy};
+    /// @note Must be destroyed before the `handle_`
+    QueueHolder queue_{nullptr, rd_kafka_queue_destroy};
   };
   std::optional<ConsumerHolder> consumer_;
 };
@@ -1,5 +1,9 @@
 #include <kafka/impl/delivery_waiter.hpp>
 
+#include <utility>
+
+#include <userver/utils/assert.hpp>
+
 USERVER_NAMESPACE_BEGIN
 
 namespace kafka::impl {
@@ -30,22 +34,74 @@ bool DeliveryResult::IsSuccess() const {
           *message_status_ == RD_KAFKA_MSG_STATUS_PERSISTED);
 }
 
-DeliveryWaiter::DeliveryWaiter(std::uint32_t current_retry,
+DeliveryWaiter& DeliveryWaiter::MessageHandle::GetWaiter() const {
+  return *waiter_;
+}
+
+void DeliveryWaiter::MessageHandle::SetDeliveryResult(
+    DeliveryResult delivery_result) const {
+  waiter_->SetDeliveryResult(index_, std::move(delivery_result));
+}
+
+DeliveryWaiter::MessageHandle::MessageHandle(DeliveryWaiter& waiter,
+                                             std::size_t index)
+    : waiter_(&waiter), index_(index) {}
+
+std::shared_ptr<DeliveryWaiter> DeliveryWaiter::Create(
+    std::size_t messages_count, std::uint32_t current_retry,
+    std::uint32_t max_retries) {
+  UASSERT(messages_count > 0);
+
+  std::shared_ptr<DeliveryWaiter> waiter{
+      new DeliveryWaiter(messages_count, current_retry, max_retries)};
+  waiter->self_ = waiter;
+  return waiter;
+}
+
+DeliveryWaiter::DeliveryWaiter(std::size_t messages_count,
+                               std::uint32_t current_retry,
                                std::uint32_t max_retries)
-    : current_retry_(current_retry), max_retries_(max_retries) {}
+    : current_retry_(current_retry),
+      max_retries_(max_retries),
+      delivery_results_(messages_count),
+      messages_left_(messages_count) {
+  handles_.reserve(messages_count);
+  for (std::size_t i = 0; i < messages_count; ++i) {
+    handles_.push_back(MessageHandle{*this, i});
+  }
+}
 
-engine::Future<DeliveryResult> DeliveryWaiter::GetFuture() {
+engine::Future<void> DeliveryWaiter::GetFuture() {
   return wait_handle_.get_future();
 }
 
+DeliveryWaiter::MessageHandle* DeliveryWaiter::GetMessageHandle(
+    std::size_t index) {
+  return &handles_.at(index);
+}
+
 bool DeliveryWaiter::FirstSend() const { return current_retry_ == 0; }
 
 bool DeliveryWaiter::LastRetry() const {
   return current_retry_ == max_retries_;
 }
 
-void DeliveryWaiter::SetDeliveryResult(DeliveryResult delivery_result) {
-  wait_handle_.set_value(std::move(delivery_result));
+void DeliveryWaiter::SetDeliveryResult(std::size_t index,
+                                       DeliveryResult delivery_result) {
+  UASSERT(!delivery_results_[index].has_value());
+  delivery_results_[index].emplace(std::move(delivery_result));
+
+  if (--messages_left_ == 0) {
+    /// @note `this` may be destroyed right after the promise is set
+    const auto self = std::move(self_);
+    wait_handle_.set_value();
+  }
+}
+
+const DeliveryResult& DeliveryWaiter::GetDeliveryResult(
+    std::size_t index) const {
+  UASSERT(delivery_results_[index].has_value());
+  return *delivery_results_[index];
 }
 
 }  // namespace kafka::impl
@@ -1,6 +1,11 @@
 #pragma once
 
+#include <atomic>
+#include <cstddef>
 #include <cstdint>
+#include <memory>
+#include <optional>
+#include <vector>
 
 #include <userver/engine/future.hpp>
 
@@ -31,25 +36,65 @@ class DeliveryResult {
   const std::optional<rd_kafka_msg_status_t> message_status_;
 };
 
-/// @brief State for waiting delivery callback invoked after producer send
-/// called
-class DeliveryWaiter {
+/// @brief State for waiting delivery callbacks of a batch of messages invoked
+/// after producer send called
+///
+/// @note Owns itself until all the delivery results are set, because
+/// `librdkafka` may invoke the delivery callback after the sender stopped
+/// waiting
+class DeliveryWaiter final {
  public:
-  DeliveryWaiter(std::uint32_t current_retry, std::uint32_t max_retries);
+  /// @brief Per message `opaque` argument of `rd_kafka_producev`
+  class MessageHandle final {
+   public:
+    DeliveryWaiter& GetWaiter() const;
 
-  engine::Future<DeliveryResult> GetFuture();
+    void SetDeliveryResult(DeliveryResult delivery_result) const;
+
+   private:
+    friend class DeliveryWaiter;
+
+    MessageHandle(DeliveryWaiter& waiter, std::size_t index);
+
+    DeliveryWaiter* waiter_;
+    std::size_t index_;
+  };
+
+  static std::shared_ptr<DeliveryWaiter> Create(std::size_t messages_count,
+                                                std::uint32_t current_retry,
+                                                std::uint32_t max_retries);
+
+  DeliveryWaiter(const DeliveryWaiter&) = delete;
+  DeliveryWaiter& operator=(const DeliveryWaiter&) = delete;
+
+  /// @brief Future is ready when the delivery results of all the messages
+  /// are set
+  engine::Future<void> GetFuture();
+
+  MessageHandle* GetMessageHandle(std::size_t index);
 
   bool FirstSend() const;
 
   bool LastRetry() const;
 
-  void SetDeliveryResult(DeliveryResult delivery_result);
+  void SetDeliveryResult(std::size_t index, DeliveryResult delivery_result);
+
+  /// @note Must be called only after the future is ready
+  const DeliveryResult& GetDeliveryResult(std::size_t index) const;
 
  private:
+  DeliveryWaiter(std::size_t messages_count, std::uint32_t current_retry,
+                 std::uint32_t max_retries);
+
   const std::uint32_t current_retry_;
   const std::uint32_t max_retries_;
 
-  engine::Promise<DeliveryResult> wait_handle_;
+  std::vector<MessageHandle> handles_;
+  std::vector<std::optional<DeliveryResult>> delivery_results_;
+  std::atomic<std::size_t> messages_left_;
+
+  engine::Promise<void> wait_handle_;
+  std::shared_ptr<DeliveryWaiter> self_;
 };
 
 }  // namespace kafka::impl
@@ -1,5 +1,7 @@
 #include <kafka/impl/producer_impl.hpp>
 
+#include <userver/engine/sleep.hpp>
+#include <userver/engine/task/cancel.hpp>
 #include <userver/tracing/span.hpp>
 #include <userver/utils/trivial_map.hpp>
 
@@ -8,6 +10,8 @@
 #include <kafka/impl/error_buffer.hpp>
 #include <kafka/impl/stats.hpp>
 
+#include <algorithm>
+#include <numeric>
 #include <utility>
 
 USERVER_NAMESPACE_BEGIN
@@ -103,10 +107,12 @@ void ProducerImpl::DeliveryReportCallbackProxy(
 
   const char* topic_name = rd_kafka_topic_name(message->rkt);
 
-  auto* complete_handle = static_cast<DeliveryWaiter*>(message->_private);
+  auto* message_handle =
+      static_cast<DeliveryWaiter::MessageHandle*>(message->_private);
+  const auto& complete_handle = message_handle->GetWaiter();
 
   auto& topic_stats = stats_.topics_stats[topic_name];
-  if (complete_handle->FirstSend()) {
+  if (complete_handle.FirstSend()) {
     ++topic_stats->messages_counts.messages_total;
   }
 
@@ -132,14 +138,14 @@ void ProducerImpl::DeliveryReportCallbackProxy(
         "{} by offset {} in {}ms",
         topic_name, message->partition, message->offset,
         message_latency_ms.count());
-  } else if (complete_handle->LastRetry()) {
+  } else if (complete_handle.LastRetry()) {
     ++topic_stats->messages_counts.messages_error;
     LOG_WARNING() << fmt::format("Failed to delivery message to topic '{}': {}",
                                  topic_name, rd_kafka_err2str(message->err));
   }
 
-  complete_handle->SetDeliveryResult(std::move(delivery_result));
-  delete complete_handle;
+  /// @note Waiter may be destroyed after the last result is set
+  message_handle->SetDeliveryResult(std::move(delivery_result));
 }
 
 ProducerImpl::ProducerImpl(std::unique_ptr<Configuration> configuration)
@@ -183,6 +189,71 @@ void ProducerImpl::Send(const std::string& topic_name, std::string_view key,
   }
 }
 
+std::vector<bool> ProducerImpl::SendBatch(
+    const std::string& topic_name, utils::span<const ProducerMessage> messages,
+    const std::uint32_t max_retries) const {
+  LOG_INFO() << fmt::format(
+      "Batch of {} messages to topic '{}' is requested to send",
+      messages.size(), topic_name);
+
+  std::vector<bool> delivered(messages.size(), false);
+
+  std::vector<std::size_t> pending_indices(messages.size());
+  std::iota(pending_indices.begin(), pending_indices.end(), std::size_t{0});
+
+  for (std::uint32_t current_retry = 0;
+       current_retry <= max_retries && !pending_indices.empty();
+       ++current_retry) {
+    const auto waiter = DeliveryWaiter::Create(pending_indices.size(),
+                                               current_retry, max_retries);
+    auto wait_handle = waiter->GetFuture();
+
+    const auto queue_full_deadline =
+        engine::Deadline::FromDuration(kQueueFullTimeout);
+    for (std::size_t i = 0; i < pending_indices.size(); ++i) {
+      auto* message_handle = waiter->GetMessageHandle(i);
+      const auto enqueue_error =
+          EnqueueMessage(topic_name, messages[pending_indices[i]],
+                         message_handle, queue_full_deadline);
+      if (enqueue_error != RD_KAFKA_RESP_ERR_NO_ERROR) {
+        message_handle->SetDeliveryResult(DeliveryResult{enqueue_error});
+      }
+    }
+
+    /// wait until delivery report callback is invoked for each message:
+    /// @see DeliveryCallbackProxy
+    wait_handle.get();
+
+    std::vector<std::size_t> retryable_indices;
+    for (std::size_t i = 0; i < pending_indices.size(); ++i) {
+      const auto& delivery_result = waiter->GetDeliveryResult(i);
+      if (delivery_result.IsSuccess()) {
+        delivered[pending_indices[i]] = true;
+      } else if (delivery_result.IsRetryable()) {
+        retryable_indices.push_back(pending_indices[i]);
+      }
+    }
+
+    if (!retryable_indices.empty() && current_retry != max_retries) {
+      LOG_WARNING() << fmt::format(
+          "Send of {} messages failed, but errors may be transient, "
+          "retrying... (retries left: {})",
+          retryable_indices.size(), max_retries - current_retry);
+    }
+    pending_indices = std::move(retryable_indices);
+  }
+
+  const auto delivered_count = static_cast<std::size_t>(
+      std::count(delivered.begin(), delivered.end(), true));
+  if (delivered_count != messages.size()) {
+    LOG_WARNING() << fmt::format(
+        "Failed to deliver {} of {} messages to topic '{}'",
+        messages.size() - delivered_count, messages.size(), topic_name);
+  }
+
+  return delivered;
+}
+
 void ProducerImpl::Poll(std::chrono::milliseconds poll_timeout) const {
   rd_kafka_poll(producer_.Handle(), static_cast<int>(poll_timeout.count()));
 }
@@ -193,9 +264,29 @@ DeliveryResult ProducerImpl::SendImpl(const std::string& topic_name,
                                       std::optional<std::uint32_t> partition,
                                       std::uint32_t current_retry,
                                       std::uint32_t max_retries) const {
-  auto waiter = std::make_unique<DeliveryWaiter>(current_retry, max_retries);
+  const auto waiter = DeliveryWaiter::Create(1, current_retry, max_retries);
   auto wait_handle = waiter->GetFuture();
 
+  auto* message_handle = waiter->GetMessageHandle(0);
+  const auto enqueue_error = EnqueueMessage(
+      topic_name, ProducerMessage{key, message, partition}, message_handle,
+      engine::Deadline::FromDuration(kQueueFullTimeout));
+  if (enqueue_error != RD_KAFKA_RESP_ERR_NO_ERROR) {
+    /// @note Releases the waiter, no delivery callback is invoked
+    message_handle->SetDeliveryResult(DeliveryResult{enqueue_error});
+  }
+
+  /// wait until delivery report callback is invoked:
+  /// @see DeliveryCallbackProxy
+  wait_handle.get();
+
+  return waiter->GetDeliveryResult(0);
+}
+
+rd_kafka_resp_err_t ProducerImpl::EnqueueMessage(
+    const std::string& topic_name, const ProducerMessage& message,
+    DeliveryWaiter::MessageHandle* handle,
+    engine::Deadline queue_full_deadline) const {
   /// `rd_kafka_producev` does not block at all. It only enqueues
   /// the message to the local queue to be send in future by `librdkafka`
   /// internal thread
@@ -207,45 +298,55 @@ DeliveryResult ProducerImpl::SendImpl(const std::string& topic_name,
   /// https://github.com/confluentinc/librdkafka/blob/master/src/rdkafka.h#L4698
   /// for understanding of `msgflags` argument
   ///
-  /// It is safe to release the `waiter` because (i)
-  /// `rd_kafka_producev` does not throws, therefore it owns the `waiter`,
-  /// (ii) delivery report callback fries its memory
+  /// `handle` is owned by the `DeliveryWaiter`, that is alive until the
+  /// delivery callbacks of all its messages are invoked
   ///
   /// const qualifier remove for `message` is required because of
   /// the `librdkafka` API requirements. If `msgflags` set to
   /// `RD_KAFKA_MSG_F_FREE`, produce implementation fries the message
   /// data, though not const pointer is required
 
+  while (true) {
 #ifdef __clang__
 #pragma clang diagnostic push
 #pragma clang diagnostic ignored "-Wgnu-statement-expression"
 #endif
 
-  // NOLINTBEGIN(clang-analyzer-cplusplus.NewDeleteLeaks,cppcoreguidelines-pro-type-const-cast)
-  const rd_kafka_resp_err_t enqueue_error = rd_kafka_producev(
-      producer_.Handle(), RD_KAFKA_V_TOPIC(topic_name.c_str()),
-      RD_KAFKA_V_KEY(key.data(), key.size()),
-      RD_KAFKA_V_VALUE(const_cast<char*>(message.data()), message.size()),
-      RD_KAFKA_V_MSGFLAGS(0),
-      RD_KAFKA_V_PARTITION(partition.value_or(RD_KAFKA_PARTITION_UA)),
-      RD_KAFKA_V_OPAQUE(waiter.release()), RD_KAFKA_V_END);
-  // NOLINTEND(clang-analyzer-cplusplus.NewDeleteLeaks,cppcoreguidelines-pro-type-const-cast)
+    // NOLINTBEGIN(cppcoreguidelines-pro-type-const-cast)
+    const rd_kafka_resp_err_t enqueue_error = rd_kafka_producev(
+        producer_.Handle(), RD_KAFKA_V_TOPIC(topic_name.c_str()),
+        RD_KAFKA_V_KEY(message.key.data(), message.key.size()),
+        RD_KAFKA_V_VALUE(const_cast<char*>(message.payload.data()),
+                         message.payload.size()),
+        RD_KAFKA_V_MSGFLAGS(0),
+        RD_KAFKA_V_PARTITION(
+            message.partition.value_or(RD_KAFKA_PARTITION_UA)),
+        RD_KAFKA_V_OPAQUE(handle), RD_KAFKA_V_END);
+    // NOLINTEND(cppcoreguidelines-pro-type-const-cast)
 
 #ifdef __clang__
 #pragma clang diagnostic pop
 #endif
 
-  if (enqueue_error != RD_KAFKA_RESP_ERR_NO_ERROR) {
+    if (enqueue_error == RD_KAFKA_RESP_ERR_NO_ERROR) {
+      return enqueue_error;
+    }
+
+    /// @note The local queue is freed by the delivery reports served in the
+    /// polling task, so it is worth waiting for a while instead of failing
+    if (enqueue_error == RD_KAFKA_RESP_ERR__QUEUE_FULL &&
+        !queue_full_deadline.IsReached() &&
+        !engine::current_task::ShouldCancel()) {
+      engine::InterruptibleSleepFor(kQueueFullRetryDelay);
+      continue;
+    }
+
     LOG_WARNING() << fmt::format(
         "Failed to enqueue message to Kafka local queue: {}",
         rd_kafka_err2str(enqueue_error));
 
-    return DeliveryResult{enqueue_error};
+    return enqueue_error;
   }
-
-  /// wait until delivery report callback is invoked:
-  /// @see DeliveryCallbackProxy
-  return wait_handle.get();
 }
 
 const Stats& ProducerImpl::GetStats() const { return stats_; }
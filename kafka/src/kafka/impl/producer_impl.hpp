@@ -4,6 +4,11 @@
 #include <cstdint>
 #include <memory>
 #include <optional>
+#include <vector>
+
+#include <userver/engine/deadline.hpp>
+#include <userver/kafka/producer.hpp>
+#include <userver/utils/span.hpp>
 
 #include <kafka/impl/delivery_waiter.hpp>
 #include <kafka/impl/stats.hpp>
@@ -19,6 +24,10 @@ class Configuration;
 class ProducerImpl final {
  public:
   static constexpr std::chrono::milliseconds kCoolDownFlushTimeout{2000};
+  /// @brief How long enqueueing waits for the local queue to be freed by
+  /// delivery reports if it is full
+  static constexpr std::chrono::milliseconds kQueueFullTimeout{2000};
+  static constexpr std::chrono::milliseconds kQueueFullRetryDelay{10};
 
   explicit ProducerImpl(std::unique_ptr<Configuration> configuration);
 
@@ -29,6 +38,14 @@ class ProducerImpl final {
             std::string_view message, std::optional<std::uint32_t> partition,
             std::uint32_t max_retries) const;
 
+  /// @brief Sends the messages and waits for their delivery.
+  /// Retries the retryable failures of the messages at most `max_retries`
+  /// times.
+  /// @returns the delivery flags of the messages
+  std::vector<bool> SendBatch(const std::string& topic_name,
+                              utils::span<const ProducerMessage> messages,
+                              std::uint32_t max_retries) const;
+
   /// @brief Polls for delivery events for `poll_timeout_` milliseconds
   void Poll(std::chrono::milliseconds poll_timeout) const;
 
@@ -49,6 +66,13 @@ class ProducerImpl final {
                           std::uint32_t current_retry,
                           std::uint32_t max_retries) const;
 
+  /// @brief Enqueues the message to the local queue, waiting for the queue to
+  /// be freed until `queue_full_deadline` if it is full.
+  rd_kafka_resp_err_t EnqueueMessage(
+      const std::string& topic_name, const ProducerMessage& message,
+      DeliveryWaiter::MessageHandle* handle,
+      engine::Deadline queue_full_deadline) const;
+
  private:
   Stats stats_;
 
@@ -27,9 +27,15 @@ void DumpMetric(utils::statistics::Writer& writer, const Stats& stats) {
         topic_stats->messages_counts.messages_success.Load(), label);
     writer[topic]["messages_error"].ValueWithLabels(
         topic_stats->messages_counts.messages_error.Load(), label);
+    writer[topic]["bytes_total"].ValueWithLabels(
+        topic_stats->messages_counts.bytes_total.Load(), label);
   }
   writer["connections_error"].ValueWithLabels(
       stats.connections_error.Load(), {kSolomonLabel, "component_name"});
+  writer["in_flight_bytes"].ValueWithLabels(
+      stats.in_flight_bytes.Load(), {kSolomonLabel, "component_name"});
+  writer["local_queue_messages"].ValueWithLabels(
+      stats.local_queue_messages.Load(), {kSolomonLabel, "component_name"});
 }
 
 }  // namespace kafka::impl
@@ -16,6 +16,7 @@ struct MessagesCounts final {
   utils::statistics::RelaxedCounter<uint64_t> messages_total = 0;
   utils::statistics::RelaxedCounter<uint64_t> messages_success = 0;
   utils::statistics::RelaxedCounter<uint64_t> messages_error = 0;
+  utils::statistics::RelaxedCounter<uint64_t> bytes_total = 0;
 };
 
 struct TopicStats final {
@@ -28,6 +29,11 @@ struct TopicStats final {
 struct Stats final {
   rcu::RcuMap<std::string, TopicStats> topics_stats;
   utils::statistics::RelaxedCounter<uint64_t> connections_error = 0;
+
+  /// Keys and payloads size of the polled messages that are not destroyed yet
+  utils::statistics::RelaxedCounter<std::int64_t> in_flight_bytes = 0;
+  /// Messages and events prefetched by `librdkafka` and not polled yet
+  utils::statistics::RelaxedCounter<std::int64_t> local_queue_messages = 0;
 };
 
 void DumpMetric(utils::statistics::Writer& writer, const Stats& stats);
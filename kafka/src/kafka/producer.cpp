@@ -99,6 +99,33 @@ engine::TaskWithResult<void> Producer::SendAsync(
       });
 }
 
+std::vector<bool> Producer::SendBatch(
+    const std::string& topic_name,
+    utils::span<const ProducerMessage> messages) const {
+  if (messages.empty()) {
+    return {};
+  }
+
+  InitProducerAndStartPollingIfFirstSend();
+
+  return utils::Async(producer_task_processor_, "producer_send_batch",
+                      [this, &topic_name, messages] {
+                        ExtendCurrentSpan();
+
+                        auto delivered = producer_->SendBatch(
+                            topic_name, messages, send_retries_);
+
+                        for (std::size_t i = 0; i < messages.size(); ++i) {
+                          if (delivered[i]) {
+                            SendToTestPoint(topic_name, messages[i].key,
+                                            messages[i].payload);
+                          }
+                        }
+                        return delivered;
+                      })
+      .Get();
+}
+
 void Producer::DumpMetric(utils::statistics::Writer& writer) const {
   if (!first_send_.load()) {
     impl::DumpMetric(writer, producer_->GetStats());
@@ -3,7 +3,12 @@
 /// @file userver/cache/base_mongo_cache.hpp
 /// @brief @copybrief components::MongoCache
 
+#include <atomic>
 #include <chrono>
+#include <memory>
+#include <optional>
+#include <string>
+#include <vector>
 
 #include <fmt/format.h>
 
@@ -11,14 +16,22 @@
 #include <userver/cache/caching_component_base.hpp>
 #include <userver/cache/mongo_cache_type_traits.hpp>
 #include <userver/components/component_context.hpp>
+#include <userver/dump/common.hpp>
+#include <userver/dump/operations.hpp>
+#include <userver/formats/bson/binary.hpp>
 #include <userver/formats/bson/document.hpp>
 #include <userver/formats/bson/inline.hpp>
 #include <userver/formats/bson/value_builder.hpp>
+#include <userver/rcu/rcu.hpp>
+#include <userver/storages/mongo/change_stream.hpp>
 #include <userver/storages/mongo/collection.hpp>
+#include <userver/storages/mongo/exception.hpp>
 #include <userver/storages/mongo/operations.hpp>
 #include <userver/storages/mongo/options.hpp>
 #include <userver/tracing/span.hpp>
+#include <userver/utils/async.hpp>
 #include <userver/utils/cpu_relax.hpp>
+#include <userver/utils/scope_guard.hpp>
 #include <userver/yaml_config/merge_schemas.hpp>
 
 USERVER_NAMESPACE_BEGIN
@@ -34,6 +47,32 @@ namespace impl {
 
 std::chrono::milliseconds GetMongoCacheUpdateCorrection(const ComponentConfig&);
 
+std::size_t GetMongoCacheFullUpdatePartitions(const ComponentConfig&);
+
+// Returns filters of disjoint _id ranges covering the whole collection
+std::vector<formats::bson::Document> SplitMongoCacheFullUpdate(
+    storages::mongo::Collection collection, std::size_t partitions,
+    bool is_secondary_preferred);
+
+struct MongoCacheChangeStreamSettings {
+  std::chrono::milliseconds max_await_time{100};
+  std::size_t max_batch_size{10000};
+};
+
+std::optional<MongoCacheChangeStreamSettings> GetMongoCacheChangeStreamSettings(
+    const ComponentConfig&);
+
+storages::mongo::ChangeStream OpenMongoCacheChangeStream(
+    const storages::mongo::Collection& collection,
+    const MongoCacheChangeStreamSettings& settings,
+    const std::optional<formats::bson::Document>& resume_token,
+    bool is_secondary_preferred);
+
+enum class MongoCacheChangeKind { kUpsert, kDelete, kInvalidate, kSkip };
+
+MongoCacheChangeKind GetMongoCacheChangeKind(
+    const formats::bson::Document& event);
+
 }
 
 // clang-format off
@@ -52,6 +91,29 @@ std::chrono::milliseconds GetMongoCacheUpdateCorrection(const ComponentConfig&);
 /// Name | Description | Default value
 /// ---- | ----------- | -------------
 /// update-correction | adjusts incremental updates window to overlap with previous update | 0
+/// full-update-partitions | number of `_id` ranges read concurrently on full updates, requires the default find operation | 1
+/// change-stream.enabled | apply the events of the change stream of the collection on incremental updates instead of querying it, see below | false
+/// change-stream.max-await-time | time the server waits for new events on an incremental update | 100ms
+/// change-stream.max-batch-size | maximum number of events applied by an incremental update | 10000
+///
+/// ### Change stream updates
+/// With `change-stream.enabled` every full update opens a change stream of
+/// the collection before reading it, and the incremental updates apply the
+/// inserts, updates and deletes from the stream, so no polling queries and
+/// no update field are required. With a short `update-interval` the cache
+/// lags behind the collection by a fraction of a second.
+///
+/// Requirements:
+/// * a replica set or a sharded cluster of MongoDB 6.0+;
+/// * `changeStreamPreAndPostImages` enabled for the collection, deletes are
+///   applied by the key of the document before the change. A delete without
+///   it, or an `invalidate`, `drop` or `rename` event, leads to a full update;
+/// * the default find operation.
+///
+/// The resume token of the stream is stored in the cache dumps along with
+/// the data, so after a restart the cache continues from the dumped state
+/// while the oplog still has it. The dump format changes when the mode is
+/// toggled, so `dump.format-version` should be bumped.
 ///
 /// ## Traits example:
 /// All fields below (except for function overrides) are mandatory.
@@ -139,6 +201,31 @@ class MongoCache
               const std::chrono::system_clock::time_point& now,
               cache::UpdateStatisticsScope& stats_scope) override;
 
+  void UpdateFullPartitioned(cache::UpdateStatisticsScope& stats_scope);
+
+  void ResumeChangeStream();
+
+  // Returns false if the stream cannot be continued and a full update is
+  // required
+  bool ApplyChangeStream(cache::UpdateStatisticsScope& stats_scope);
+  bool ApplyChange(const formats::bson::Document& event,
+                   typename MongoCacheTraits::DataType& data,
+                   cache::UpdateStatisticsScope& stats_scope) const;
+
+  void SetData(std::unique_ptr<typename MongoCacheTraits::DataType> data);
+  std::optional<formats::bson::Document> GetResumeToken() const;
+
+  void WriteContents(dump::Writer& writer,
+                     const typename MongoCacheTraits::DataType& contents)
+      const override;
+  std::unique_ptr<const typename MongoCacheTraits::DataType> ReadContents(
+      dump::Reader& reader) const override;
+
+  std::vector<typename MongoCacheTraits::ObjectType> ReadPartition(
+      const formats::bson::Document& filter,
+      std::atomic<std::size_t>& doc_count,
+      std::atomic<std::size_t>& parse_failures) const;
+
   typename MongoCacheTraits::ObjectType DeserializeObject(
       const formats::bson::Document& doc) const;
 
@@ -154,7 +241,18 @@ class MongoCache
   const std::shared_ptr<CollectionsType> mongo_collections_;
   const storages::mongo::Collection* const mongo_collection_;
   const std::chrono::system_clock::duration correction_;
+  const std::size_t full_update_partitions_;
+  const std::optional<impl::MongoCacheChangeStreamSettings>
+      change_stream_settings_;
   std::size_t cpu_relax_iterations_{0};
+
+  // Resume token of the events applied to the data
+  struct ResumePoint {
+    const typename MongoCacheTraits::DataType* data{nullptr};
+    formats::bson::Document token;
+  };
+  mutable rcu::Variable<ResumePoint> resume_point_;
+  std::optional<storages::mongo::ChangeStream> change_stream_;
 };
 
 template <class MongoCacheTraits>
@@ -172,7 +270,9 @@ MongoCache<MongoCacheTraits>::MongoCache(const ComponentConfig& config,
               .template GetCollectionForLibrary<CollectionsType>()),
       mongo_collection_(std::addressof(
           mongo_collections_.get()->*MongoCacheTraits::kMongoCollectionsField)),
-      correction_(impl::GetMongoCacheUpdateCorrection(config)) {
+      correction_(impl::GetMongoCacheUpdateCorrection(config)),
+      full_update_partitions_(impl::GetMongoCacheFullUpdatePartitions(config)),
+      change_stream_settings_(impl::GetMongoCacheChangeStreamSettings(config)) {
   [[maybe_unused]] mongo_cache::impl::CheckTraits<MongoCacheTraits>
       check_traits;
 
@@ -180,7 +280,8 @@ MongoCache<MongoCacheTraits>::MongoCache(const ComponentConfig& config,
           typename MongoCacheTraits::DataType>::GetAllowedUpdateTypes() ==
           cache::AllowedUpdateTypes::kFullAndIncremental &&
       !mongo_cache::impl::kHasUpdateFieldName<MongoCacheTraits> &&
-      !mongo_cache::impl::kHasFindOperation<MongoCacheTraits>) {
+      !mongo_cache::impl::kHasFindOperation<MongoCacheTraits> &&
+      !change_stream_settings_) {
     throw std::logic_error(fmt::format(
         "Incremental update support is requested in config but no update field "
         "name is specified in traits of '{}' cache",
@@ -192,6 +293,20 @@ MongoCache<MongoCacheTraits>::MongoCache(const ComponentConfig& config,
         "config for '{}' cache",
         components::GetCurrentComponentName(config)));
   }
+  if (full_update_partitions_ > 1 &&
+      mongo_cache::impl::kHasFindOperation<MongoCacheTraits>) {
+    throw std::logic_error(fmt::format(
+        "Full update partitioning is requested in config for '{}' cache, but "
+        "it supports only the default find operation",
+        components::GetCurrentComponentName(config)));
+  }
+  if (change_stream_settings_ &&
+      mongo_cache::impl::kHasFindOperation<MongoCacheTraits>) {
+    throw std::logic_error(fmt::format(
+        "Change stream updates are requested in config for '{}' cache, but "
+        "they support only the default find operation",
+        components::GetCurrentComponentName(config)));
+  }
 
   this->StartPeriodicUpdates();
 }
@@ -209,8 +324,32 @@ void MongoCache<MongoCacheTraits>::Update(
     cache::UpdateStatisticsScope& stats_scope) {
   namespace sm = storages::mongo;
 
+  if (change_stream_settings_) {
+    if (type == cache::UpdateType::kIncremental) {
+      if (!change_stream_) ResumeChangeStream();
+      if (change_stream_ && ApplyChangeStream(stats_scope)) return;
+      // The stream cannot be continued, reread the whole collection
+      type = cache::UpdateType::kFull;
+    }
+    // Opened before the read, the events that happen during it are applied
+    // again by the next incremental update
+    change_stream_.reset();
+    change_stream_ = impl::OpenMongoCacheChangeStream(
+        *mongo_collection_, *change_stream_settings_, std::nullopt,
+        MongoCacheTraits::kIsSecondaryPreferred);
+  }
+
+  if (type == cache::UpdateType::kFull && full_update_partitions_ > 1) {
+    UpdateFullPartitioned(stats_scope);
+    return;
+  }
+
   const auto* collection = mongo_collection_;
   auto find_op = GetFindOperation(type, last_update, now, correction_);
+  if (type == cache::UpdateType::kFull) {
+    // Full updates scan the whole collection, overlap parsing with fetching
+    find_op.SetOption(sm::options::PrefetchBatches{});
+  }
   auto cursor = collection->Execute(find_op);
   if (type == cache::UpdateType::kIncremental && !cursor) {
     // Don't touch the cache at all
@@ -270,8 +409,256 @@ void MongoCache<MongoCacheTraits>::Update(
   scope.Reset();
 
   const auto size = new_cache->size();
-  this->Set(std::move(new_cache));
+  SetData(std::move(new_cache));
+  stats_scope.Finish(size);
+}
+
+template <class MongoCacheTraits>
+void MongoCache<MongoCacheTraits>::UpdateFullPartitioned(
+    cache::UpdateStatisticsScope& stats_scope) {
+  auto scope = tracing::Span::CurrentSpan().CreateScopeTime("split");
+  const auto filters = impl::SplitMongoCacheFullUpdate(
+      *mongo_collection_, full_update_partitions_,
+      MongoCacheTraits::kIsSecondaryPreferred);
+
+  scope.Reset(kFetchAndParseStage);
+  std::atomic<std::size_t> doc_count{0};
+  std::atomic<std::size_t> parse_failures{0};
+  // Accounts documents of all partitions even if some of them failed
+  const utils::ScopeGuard stats_guard([&] {
+    stats_scope.IncreaseDocumentsReadCount(doc_count);
+    stats_scope.IncreaseDocumentsParseFailures(parse_failures);
+  });
+
+  std::vector<engine::TaskWithResult<
+      std::vector<typename MongoCacheTraits::ObjectType>>>
+      tasks;
+  tasks.reserve(filters.size());
+  for (const auto& filter : filters) {
+    tasks.push_back(utils::Async("mongo-cache-partition", [&, this] {
+      return ReadPartition(filter, doc_count, parse_failures);
+    }));
+  }
+
+  auto new_cache = GetData(cache::UpdateType::kFull);
+  for (auto& task : tasks) {
+    for (auto& object : task.Get()) {
+      auto key = (object.*MongoCacheTraits::kKeyField);
+      if (new_cache->count(key) == 0) {
+        (*new_cache)[key] = std::move(object);
+      } else {
+        LOG_LIMITED_ERROR() << "Found duplicate key for 2 items in cache "
+                            << MongoCacheTraits::kName << ", key=" << key;
+      }
+    }
+  }
+
+  scope.Reset();
+
+  const auto size = new_cache->size();
+  SetData(std::move(new_cache));
+  stats_scope.Finish(size);
+}
+
+template <class MongoCacheTraits>
+void MongoCache<MongoCacheTraits>::ResumeChangeStream() {
+  // E.g. the data is loaded from a dump
+  auto token = GetResumeToken();
+  if (!token) return;
+
+  try {
+    change_stream_ = impl::OpenMongoCacheChangeStream(
+        *mongo_collection_, *change_stream_settings_, std::move(token),
+        MongoCacheTraits::kIsSecondaryPreferred);
+  } catch (const storages::mongo::MongoException& e) {
+    LOG_WARNING() << "Failed to resume change stream of cache "
+                  << MongoCacheTraits::kName << ": " << e;
+  }
+}
+
+template <class MongoCacheTraits>
+bool MongoCache<MongoCacheTraits>::ApplyChangeStream(
+    cache::UpdateStatisticsScope& stats_scope) {
+  UASSERT(change_stream_);
+  // The events are consumed, the stream is of no use if they are not applied
+  utils::ScopeGuard reset_guard([this] { change_stream_.reset(); });
+
+  std::vector<formats::bson::Document> events;
+  try {
+    while (events.size() < change_stream_settings_->max_batch_size) {
+      auto event = change_stream_->Next();
+      if (!event) break;
+      events.push_back(std::move(*event));
+    }
+  } catch (const storages::mongo::MongoException& e) {
+    LOG_WARNING() << "Failed to read change stream of cache "
+                  << MongoCacheTraits::kName << ": " << e;
+    return false;
+  }
+
+  if (events.empty()) {
+    LOG_INFO() << "No changes in cache " << MongoCacheTraits::kName;
+    // Keeps the dumped token fresh, the oplog may not have the older one
+    const auto data = this->Get();
+    resume_point_.Assign({data.Get(), change_stream_->GetResumeToken()});
+    reset_guard.Release();
+    stats_scope.FinishNoChanges();
+    return true;
+  }
+
+  auto scope = tracing::Span::CurrentSpan().CreateScopeTime("copy_data");
+  auto new_cache = GetData(cache::UpdateType::kIncremental);
+  scope.Reset(kFetchAndParseStage);
+
+  stats_scope.IncreaseDocumentsReadCount(events.size());
+  for (const auto& event : events) {
+    if (!ApplyChange(event, *new_cache, stats_scope)) return false;
+  }
+  scope.Reset();
+
+  reset_guard.Release();
+  const auto size = new_cache->size();
+  SetData(std::move(new_cache));
   stats_scope.Finish(size);
+  return true;
+}
+
+template <class MongoCacheTraits>
+bool MongoCache<MongoCacheTraits>::ApplyChange(
+    const formats::bson::Document& event,
+    typename MongoCacheTraits::DataType& data,
+    cache::UpdateStatisticsScope& stats_scope) const {
+  using Kind = impl::MongoCacheChangeKind;
+
+  const auto kind = impl::GetMongoCacheChangeKind(event);
+  if (kind == Kind::kSkip) return true;
+  if (kind == Kind::kInvalidate) {
+    LOG_WARNING() << "Change stream of cache " << MongoCacheTraits::kName
+                  << " is invalidated by '"
+                  << event["operationType"].template As<std::string>()
+                  << "' event";
+    return false;
+  }
+
+  const auto before = event["fullDocumentBeforeChange"];
+  if (kind == Kind::kDelete && !before.IsDocument()) {
+    LOG_WARNING() << "Delete event of cache " << MongoCacheTraits::kName
+                  << " has no document before the change, enable "
+                     "changeStreamPreAndPostImages for the collection";
+    return false;
+  }
+
+  try {
+    // The key of the document may have been changed
+    if (before.IsDocument()) {
+      data.erase(DeserializeObject(before).*MongoCacheTraits::kKeyField);
+    }
+    if (kind == Kind::kUpsert) {
+      const auto doc = event["fullDocument"];
+      // The document is deleted since, the delete event follows
+      if (!doc.IsDocument()) return true;
+
+      auto object = DeserializeObject(doc);
+      auto key = (object.*MongoCacheTraits::kKeyField);
+      data[key] = std::move(object);
+    }
+  } catch (const std::exception& e) {
+    LOG_LIMITED_ERROR() << "Failed to deserialize cache item of cache "
+                        << MongoCacheTraits::kName << ", _id="
+                        << event["documentKey"]["_id"]
+                               .template ConvertTo<std::string>()
+                        << ", what(): " << e;
+    stats_scope.IncreaseDocumentsParseFailures(1);
+
+    if (!MongoCacheTraits::kAreInvalidDocumentsSkipped) throw;
+  }
+  return true;
+}
+
+template <class MongoCacheTraits>
+void MongoCache<MongoCacheTraits>::SetData(
+    std::unique_ptr<typename MongoCacheTraits::DataType> data) {
+  const auto* data_ptr = data.get();
+  this->Set(std::move(data));
+  if (change_stream_) {
+    resume_point_.Assign({data_ptr, change_stream_->GetResumeToken()});
+  }
+}
+
+template <class MongoCacheTraits>
+std::optional<formats::bson::Document>
+MongoCache<MongoCacheTraits>::GetResumeToken() const {
+  const auto data = this->Get();
+  const auto point = resume_point_.Read();
+  if (point->data != data.Get() || point->token.IsEmpty()) return std::nullopt;
+  return point->token;
+}
+
+template <class MongoCacheTraits>
+void MongoCache<MongoCacheTraits>::WriteContents(
+    dump::Writer& writer,
+    const typename MongoCacheTraits::DataType& contents) const {
+  if (change_stream_settings_) {
+    // The data is alive, so a matching pointer cannot belong to other data
+    const auto point = resume_point_.Read();
+    if (point->data != &contents) {
+      throw dump::Error(fmt::format(
+          "Resume token of the data of cache {} is not known yet", kName));
+    }
+    writer.Write(formats::bson::ToBinaryString(point->token).GetView());
+  }
+  CachingComponentBase<
+      typename MongoCacheTraits::DataType>::WriteContents(writer, contents);
+}
+
+template <class MongoCacheTraits>
+std::unique_ptr<const typename MongoCacheTraits::DataType>
+MongoCache<MongoCacheTraits>::ReadContents(dump::Reader& reader) const {
+  if (!change_stream_settings_) {
+    return CachingComponentBase<
+        typename MongoCacheTraits::DataType>::ReadContents(reader);
+  }
+
+  auto token = formats::bson::FromBinaryString(reader.Read<std::string>());
+  auto data = CachingComponentBase<
+      typename MongoCacheTraits::DataType>::ReadContents(reader);
+  resume_point_.Assign({data.get(), std::move(token)});
+  return data;
+}
+
+template <class MongoCacheTraits>
+std::vector<typename MongoCacheTraits::ObjectType>
+MongoCache<MongoCacheTraits>::ReadPartition(
+    const formats::bson::Document& filter, std::atomic<std::size_t>& doc_count,
+    std::atomic<std::size_t>& parse_failures) const {
+  namespace sm = storages::mongo;
+
+  sm::operations::Find find_op(filter);
+  if (MongoCacheTraits::kIsSecondaryPreferred) {
+    find_op.SetOption(sm::options::ReadPreference::kSecondaryPreferred);
+  }
+  find_op.SetOption(sm::options::PrefetchBatches{});
+  auto cursor = mongo_collection_->Execute(find_op);
+
+  std::vector<typename MongoCacheTraits::ObjectType> objects;
+  utils::CpuRelax relax{cpu_relax_iterations_, nullptr};
+  for (const auto& doc : cursor) {
+    ++doc_count;
+    relax.Relax();
+
+    try {
+      objects.push_back(DeserializeObject(doc));
+    } catch (const std::exception& e) {
+      LOG_LIMITED_ERROR() << "Failed to deserialize cache item of cache "
+                          << MongoCacheTraits::kName << ", _id="
+                          << doc["_id"].template ConvertTo<std::string>()
+                          << ", what(): " << e;
+      ++parse_failures;
+
+      if (!MongoCacheTraits::kAreInvalidDocumentsSkipped) throw;
+    }
+  }
+  return objects;
 }
 
 template <class MongoCacheTraits>
@@ -58,8 +58,11 @@ class BsonBuilder {
 
   BsonHolder Extract();
 
+  /// Appends the value to the document being built by other means
+  static void AppendInto(bson_t*, std::string_view key, const Value&);
+
  private:
-  void AppendInto(bson_t*, std::string_view key, const ValueImpl&);
+  static void AppendInto(bson_t*, std::string_view key, const ValueImpl&);
 
   static constexpr std::size_t kSize = compiler::SelectSize()  //
                                            .For64Bit(8)
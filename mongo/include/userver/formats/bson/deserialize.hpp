@@ -0,0 +1,219 @@
+#pragma once
+
+/// @file userver/formats/bson/deserialize.hpp
+/// @brief @copybrief formats::bson::Deserialize
+
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <bson/bson.h>
+#include <boost/pfr/core.hpp>
+#include <boost/pfr/tuple_size.hpp>
+
+#include <userver/formats/bson/document.hpp>
+#include <userver/formats/bson/exception.hpp>
+#include <userver/formats/bson/types.hpp>
+#include <userver/formats/bson/value.hpp>
+#include <userver/formats/json/aggregate_field_names.hpp>
+#include <userver/formats/parse/common.hpp>
+#include <userver/formats/parse/to.hpp>
+#include <userver/utils/meta.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace formats::bson {
+
+namespace impl {
+
+// Path to the value being parsed, only turned into a string on errors
+class IterPath final {
+ public:
+  using ParseException = formats::bson::ParseException;
+
+  IterPath() = default;
+  IterPath(const IterPath& parent, std::string_view key)
+      : parent_(&parent), key_(key) {}
+  IterPath(const IterPath& parent, std::size_t index)
+      : parent_(&parent), index_(index), is_index_(true) {}
+
+  std::string GetPath() const;
+
+ private:
+  const IterPath* parent_{nullptr};
+  std::string_view key_;
+  std::size_t index_{0};
+  bool is_index_{false};
+};
+
+bool ParseIter(const bson_iter_t& it, const IterPath& path, parse::To<bool>);
+int64_t ParseIter(const bson_iter_t& it, const IterPath& path,
+                  parse::To<int64_t>);
+uint64_t ParseIter(const bson_iter_t& it, const IterPath& path,
+                   parse::To<uint64_t>);
+double ParseIter(const bson_iter_t& it, const IterPath& path,
+                 parse::To<double>);
+std::string ParseIter(const bson_iter_t& it, const IterPath& path,
+                      parse::To<std::string>);
+std::chrono::system_clock::time_point ParseIter(
+    const bson_iter_t& it, const IterPath& path,
+    parse::To<std::chrono::system_clock::time_point>);
+Oid ParseIter(const bson_iter_t& it, const IterPath& path, parse::To<Oid>);
+Binary ParseIter(const bson_iter_t& it, const IterPath& path,
+                 parse::To<Binary>);
+
+// Copies the element into a formats::bson::Value for the types without a
+// fast path
+Value ParseIterValue(const bson_iter_t& it);
+
+void RecurseDocument(const bson_iter_t& it, const IterPath& path,
+                     bson_iter_t& child);
+void RecurseArray(const bson_iter_t& it, const IterPath& path,
+                  bson_iter_t& child);
+
+[[noreturn]] void ThrowMemberMissing(const IterPath& path,
+                                     std::string_view name);
+
+template <typename T>
+void ParseIterInto(const bson_iter_t& it, const IterPath& path, T& result);
+
+template <typename T, std::size_t... I>
+constexpr std::array<bool, sizeof...(I)> GetRequiredFields(
+    std::index_sequence<I...>) {
+  return {!meta::kIsOptional<boost::pfr::tuple_element_t<I, T>>...};
+}
+
+template <typename T>
+struct AggregateFields final {
+  static constexpr auto& kNames = json::AggregateFieldNames<T>::kValue;
+  static constexpr std::size_t kSize = boost::pfr::tuple_size_v<T>;
+  static constexpr auto kIndices = std::make_index_sequence<kSize>{};
+  static_assert(std::size(kNames) == kSize,
+                "formats::json::AggregateFieldNames must name every member "
+                "of the aggregate");
+
+  static constexpr auto kRequired = GetRequiredFields<T>(kIndices);
+
+  static std::size_t Find(std::string_view name) {
+    for (std::size_t i = 0; i < kSize; ++i) {
+      if (kNames[i] == name) return i;
+    }
+    return kSize;
+  }
+
+  template <std::size_t... I>
+  static void ParseField(std::size_t index, const bson_iter_t& it,
+                         const IterPath& path, T& result,
+                         std::index_sequence<I...>) {
+    ((index == I ? ParseIterInto(it, path, boost::pfr::get<I>(result))
+                 : void()),
+     ...);
+  }
+};
+
+template <typename T>
+void ParseAggregate(bson_iter_t& it, const IterPath& path, T& result) {
+  using Fields = AggregateFields<T>;
+
+  std::array<bool, Fields::kSize> seen{};
+  while (bson_iter_next(&it)) {
+    const std::string_view key(bson_iter_key(&it));
+    const auto index = Fields::Find(key);
+    if (index == Fields::kSize) continue;
+
+    Fields::ParseField(index, it, IterPath(path, key), result,
+                       Fields::kIndices);
+    seen[index] = true;
+  }
+
+  for (std::size_t i = 0; i < Fields::kSize; ++i) {
+    if (!seen[i] && Fields::kRequired[i]) {
+      ThrowMemberMissing(path, Fields::kNames[i]);
+    }
+  }
+}
+
+template <typename T>
+inline constexpr bool kHasIterFastPath =
+    std::is_same_v<T, bool> || std::is_same_v<T, double> ||
+    std::is_same_v<T, std::string> ||
+    std::is_same_v<T, std::chrono::system_clock::time_point> ||
+    std::is_same_v<T, Oid> || std::is_same_v<T, Binary>;
+
+template <typename T>
+void ParseIterInto(const bson_iter_t& it, const IterPath& path, T& result) {
+  if constexpr (meta::kIsOptional<T>) {
+    if (bson_iter_type(&it) == BSON_TYPE_NULL) {
+      result.reset();
+    } else {
+      ParseIterInto(it, path, result.emplace());
+    }
+  } else if constexpr (json::impl::kHasAggregateFieldNames<T>) {
+    bson_iter_t child;
+    RecurseDocument(it, path, child);
+    result = T{};
+    ParseAggregate(child, path, result);
+  } else if constexpr (meta::kIsVector<T> &&
+                       !std::is_same_v<T, std::vector<bool>>) {
+    bson_iter_t child;
+    RecurseArray(it, path, child);
+    result.clear();
+    while (bson_iter_next(&child)) {
+      const IterPath item_path(path, result.size());
+      ParseIterInto(child, item_path, result.emplace_back());
+    }
+  } else if constexpr (kHasIterFastPath<T>) {
+    result = ParseIter(it, path, parse::To<T>{});
+  } else if constexpr (meta::kIsInteger<T>) {
+    using IntT = std::conditional_t<std::is_signed_v<T>, int64_t, uint64_t>;
+    result = parse::impl::NarrowToInt<T>(
+        ParseIter(it, path, parse::To<IntT>{}), path);
+  } else {
+    result = ParseIterValue(it).As<T>();
+  }
+}
+
+}  // namespace impl
+
+/// @brief Parses the BSON document directly into the aggregate T, without
+/// building a formats::bson::Value tree for the document.
+///
+/// The field names are taken from formats::json::AggregateFieldNames, so
+/// the same specialization serves JSON and BSON.
+///
+/// The fields are read straight from the document bytes for aggregates with
+/// formats::json::AggregateFieldNames, bool, integers, double, std::string,
+/// std::chrono::system_clock::time_point, formats::bson::Oid,
+/// formats::bson::Binary, std::optional and std::vector, nested in any
+/// combination. A value of any other type is copied into a
+/// formats::bson::Value first and converted with its `Parse` overload.
+///
+/// std::optional members may be missing or null, other members are
+/// required. Unknown fields are skipped.
+///
+/// @throws formats::bson::BsonException on a type mismatch or a missing
+/// member, the message contains the path to the offending value
+template <typename T>
+T Deserialize(const Document& document) {
+  static_assert(json::impl::kHasAggregateFieldNames<T>,
+                "Specialize formats::json::AggregateFieldNames for the type");
+
+  bson_iter_t it;
+  if (!bson_iter_init(&it, document.GetBson().get())) {
+    throw ParseException("Malformed BSON document");
+  }
+  T result{};
+  impl::ParseAggregate(it, impl::IterPath{}, result);
+  return result;
+}
+
+}  // namespace formats::bson
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,134 @@
+#pragma once
+
+/// @file userver/formats/bson/document_builder.hpp
+/// @brief @copybrief formats::bson::DocumentBuilder
+
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <string_view>
+
+#include <userver/formats/bson/document.hpp>
+#include <userver/formats/bson/types.hpp>
+#include <userver/formats/bson/value.hpp>
+#include <userver/formats/serialize/to.hpp>
+#include <userver/formats/serialize/write_to_stream.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace formats::bson {
+
+// clang-format off
+
+/// @ingroup userver_containers userver_formats userver_formats_serialize_sax
+///
+/// @brief SAX like builder of a BSON document, writes the values straight
+/// into the document bytes. Use with caution and only in performance critical
+/// parts of your code.
+///
+/// Unlike formats::bson::ValueBuilder, it does not build a mutable tree of
+/// values: the nested documents and arrays are written into the buffer of
+/// the root document, so a document is built with a few reallocations of a
+/// single buffer. The nesting levels and the key buffer are reused between
+/// the documents built by the same builder.
+///
+/// Prefer using WriteToStream functions to add data to the DocumentBuilder.
+/// The root must be an object started with an ObjectGuard.
+///
+/// ## Example usage:
+///
+/// @snippet formats/bson/document_builder_test.cpp  Sample formats::bson::DocumentBuilder usage
+///
+/// @see @ref scripts/docs/en/userver/formats.md
+
+// clang-format on
+
+class DocumentBuilder final : public serialize::SaxStream {
+ public:
+  // Required by the WriteToStream fallback to Serialize
+  using Value = formats::bson::Value;
+
+  DocumentBuilder();
+  ~DocumentBuilder();
+
+  /// Construct this guard on new object start and its destructor will end the
+  /// object
+  class ObjectGuard final {
+   public:
+    explicit ObjectGuard(DocumentBuilder& builder);
+    ~ObjectGuard();
+
+   private:
+    DocumentBuilder& builder_;
+  };
+
+  /// Construct this guard on new array start and its destructor will end the
+  /// array
+  class ArrayGuard final {
+   public:
+    explicit ArrayGuard(DocumentBuilder& builder);
+    ~ArrayGuard();
+
+   private:
+    DocumentBuilder& builder_;
+  };
+
+  /// @brief Returns the built document and resets the builder to build
+  /// the next one.
+  /// @note The root object must be ended.
+  Document Extract();
+
+  void WriteNull();
+  void WriteBool(bool value);
+  void WriteInt32(int32_t value);
+  void WriteInt64(int64_t value);
+  /// @throws BsonException if the value does not fit into int64_t
+  void WriteUInt64(uint64_t value);
+  void WriteDouble(double value);
+  /// @throws BsonException if the value is not a valid UTF-8
+  void WriteString(std::string_view value);
+  void WriteDateTime(std::chrono::system_clock::time_point value);
+  void WriteOid(const Oid& value);
+  void WriteBinary(const Binary& value);
+  void WriteDecimal128(const Decimal128& value);
+  void WriteTimestamp(const Timestamp& value);
+
+  /// ONLY for objects/dicts: write key
+  void Key(std::string_view key);
+
+  void WriteValue(const Value& value);
+
+ private:
+  struct Impl;
+
+  void StartObject();
+  void StartArray();
+  void End() noexcept;
+
+  std::unique_ptr<Impl> impl_;
+};
+
+void WriteToStream(bool value, DocumentBuilder& builder);
+void WriteToStream(int value, DocumentBuilder& builder);
+void WriteToStream(unsigned value, DocumentBuilder& builder);
+void WriteToStream(long value, DocumentBuilder& builder);
+void WriteToStream(unsigned long value, DocumentBuilder& builder);
+void WriteToStream(long long value, DocumentBuilder& builder);
+void WriteToStream(unsigned long long value, DocumentBuilder& builder);
+void WriteToStream(double value, DocumentBuilder& builder);
+void WriteToStream(const char* value, DocumentBuilder& builder);
+void WriteToStream(std::string_view value, DocumentBuilder& builder);
+void WriteToStream(const std::string& value, DocumentBuilder& builder);
+void WriteToStream(std::chrono::system_clock::time_point value,
+                   DocumentBuilder& builder);
+void WriteToStream(const Oid& value, DocumentBuilder& builder);
+void WriteToStream(const Binary& value, DocumentBuilder& builder);
+void WriteToStream(const Decimal128& value, DocumentBuilder& builder);
+void WriteToStream(const Timestamp& value, DocumentBuilder& builder);
+void WriteToStream(const Value& value, DocumentBuilder& builder);
+void WriteToStream(const Document& value, DocumentBuilder& builder);
+
+}  // namespace formats::bson
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,68 @@
+#pragma once
+
+/// @file userver/formats/bson/serialize_aggregate.hpp
+/// @brief SAX serialization of aggregates with
+/// formats::json::AggregateFieldNames into formats::bson::DocumentBuilder
+/// @ingroup userver_formats_serialize_sax
+
+#include <cstddef>
+#include <optional>
+#include <type_traits>
+#include <utility>
+
+#include <boost/pfr/core.hpp>
+#include <boost/pfr/tuple_size.hpp>
+
+#include <userver/formats/bson/document_builder.hpp>
+#include <userver/formats/json/aggregate_field_names.hpp>
+#include <userver/utils/meta_light.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace formats::bson {
+
+namespace impl {
+
+template <typename T, std::size_t I>
+void WriteAggregateField(const T& value, DocumentBuilder& builder) {
+  const auto& field = boost::pfr::get<I>(value);
+  if constexpr (meta::kIsInstantiationOf<std::optional,
+                                         std::decay_t<decltype(field)>>) {
+    if (!field) return;
+  }
+
+  builder.Key(json::AggregateFieldNames<T>::kValue[I]);
+  WriteToStream(field, builder);
+}
+
+template <typename T, std::size_t... I>
+void WriteAggregateFields(const T& value, DocumentBuilder& builder,
+                          std::index_sequence<I...>) {
+  (impl::WriteAggregateField<T, I>(value, builder), ...);
+}
+
+}  // namespace impl
+
+/// @brief Writes the aggregate as a BSON document with the field names of
+/// formats::json::AggregateFieldNames, without building a
+/// formats::bson::Value.
+///
+/// Members that are empty std::optional are omitted, other members are
+/// written with their WriteToStream overloads. The document is read back
+/// with formats::bson::Deserialize.
+template <typename T>
+std::enable_if_t<json::impl::kHasAggregateFieldNames<T>> WriteToStream(
+    const T& value, DocumentBuilder& builder) {
+  constexpr std::size_t kSize = boost::pfr::tuple_size_v<T>;
+  static_assert(std::size(json::AggregateFieldNames<T>::kValue) == kSize,
+                "formats::json::AggregateFieldNames must name every member "
+                "of the aggregate");
+
+  DocumentBuilder::ObjectGuard guard(builder);
+  impl::WriteAggregateFields(value, builder,
+                             std::make_index_sequence<kSize>{});
+}
+
+}  // namespace formats::bson
+
+USERVER_NAMESPACE_END
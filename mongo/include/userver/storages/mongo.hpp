@@ -9,6 +9,7 @@
 #include <userver/storages/mongo/exception.hpp>
 #include <userver/storages/mongo/options.hpp>
 #include <userver/storages/mongo/pool.hpp>
+#include <userver/storages/mongo/write_coalescer.hpp>
 #include <userver/storages/mongo/write_result.hpp>
 
 USERVER_NAMESPACE_BEGIN
@@ -0,0 +1,53 @@
+#pragma once
+
+/// @file userver/storages/mongo/change_stream.hpp
+/// @brief @copybrief storages::mongo::ChangeStream
+
+#include <memory>
+#include <optional>
+
+#include <userver/formats/bson/document.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace storages::mongo {
+namespace impl {
+class ChangeStreamImpl;
+}  // namespace impl
+
+/// @brief Change stream of a MongoDB collection
+///
+/// Returned by Collection::Watch(). Holds a connection of the pool while
+/// alive. The driver transparently resumes the stream once on a resumable
+/// error, e.g. on a primary step down.
+///
+/// @see https://www.mongodb.com/docs/manual/changeStreams/
+class ChangeStream {
+ public:
+  explicit ChangeStream(std::unique_ptr<impl::ChangeStreamImpl>&&);
+  ~ChangeStream();
+
+  ChangeStream(ChangeStream&&) noexcept;
+  ChangeStream& operator=(ChangeStream&&) noexcept;
+
+  /// @brief Returns the next change event, waiting for it on the server for
+  /// up to options::MaxAwaitTime
+  /// @returns std::nullopt if there were no new events
+  /// @throws MongoException if the stream cannot be continued, e.g. after
+  /// an `invalidate` event or if the oplog no longer has the resume point
+  std::optional<formats::bson::Document> Next();
+
+  /// @brief Returns the token to resume the stream after the last returned
+  /// event with options::ResumeAfter
+  ///
+  /// After an empty batch the token may point past the last event, so it
+  /// should be saved when all the returned events are processed.
+  formats::bson::Document GetResumeToken() const;
+
+ private:
+  std::unique_ptr<impl::ChangeStreamImpl> impl_;
+};
+
+}  // namespace storages::mongo
+
+USERVER_NAMESPACE_END
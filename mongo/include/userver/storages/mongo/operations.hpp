@@ -95,6 +95,7 @@ class Find {
   void SetOption(const options::Hint&);
   void SetOption(options::AllowPartialResults);
   void SetOption(options::Tailable);
+  void SetOption(options::PrefetchBatches);
   void SetOption(const options::Comment&);
   void SetOption(const options::MaxServerTime&);
 
@@ -339,6 +340,37 @@ class Aggregate {
   utils::FastPimpl<Impl, kSize, kAlignment, false> impl_;
 };
 
+/// @brief Opens a change stream of the collection, requires a replica set
+/// @see https://www.mongodb.com/docs/manual/changeStreams/
+class Watch {
+ public:
+  /// @param pipeline an array of aggregation stages to filter or transform
+  /// the events, e.g. `$match`
+  explicit Watch(formats::bson::Value pipeline = {});
+  ~Watch();
+
+  Watch(const Watch&);
+  Watch(Watch&&) noexcept;
+  Watch& operator=(const Watch&);
+  Watch& operator=(Watch&&) noexcept;
+
+  void SetOption(const options::ReadPreference&);
+  void SetOption(options::ReadPreference::Mode);
+  void SetOption(const options::ResumeAfter&);
+  void SetOption(options::FullDocumentLookup);
+  void SetOption(options::FullDocumentBeforeChange);
+  void SetOption(const options::MaxAwaitTime&);
+
+ private:
+  friend class storages::mongo::impl::cdriver::CDriverCollectionImpl;
+
+  class Impl;
+  static constexpr size_t kSize = 120;
+  static constexpr size_t kAlignment = 8;
+  // MAC_COMPAT: std::string size differs
+  utils::FastPimpl<Impl, kSize, kAlignment, false> impl_;
+};
+
 class Drop {
  public:
   Drop();
@@ -276,6 +276,14 @@ class SuppressServerExceptions {};
 /// @see https://docs.mongodb.com/manual/core/tailable-cursors/
 class Tailable {};
 
+/// @brief Enables fetching of the next cursor batch in background while
+/// the current one is being iterated
+///
+/// Documents of a fetched batch share a single buffer that is kept alive
+/// while any of them is referenced. Useful for large scans, e.g. full cache
+/// updates.
+class PrefetchBatches {};
+
 /// Sets a comment for the operation, which would be visible in profile data
 class Comment {
  public:
@@ -300,6 +308,41 @@ class MaxServerTime {
   std::chrono::milliseconds value_;
 };
 
+/// @brief Resumes a change stream right after the event with the token
+/// @see storages::mongo::ChangeStream::GetResumeToken
+class ResumeAfter {
+ public:
+  explicit ResumeAfter(formats::bson::Document token)
+      : token_(std::move(token)) {}
+
+  const formats::bson::Document& Value() const { return token_; }
+
+ private:
+  formats::bson::Document token_;
+};
+
+/// @brief Makes update events of a change stream carry the current version
+/// of the whole document in the `fullDocument` field
+class FullDocumentLookup {};
+
+/// @brief Makes change stream events carry the version of the document
+/// before the change in the `fullDocumentBeforeChange` field, if the
+/// collection has `changeStreamPreAndPostImages` enabled (MongoDB 6.0+)
+class FullDocumentBeforeChange {};
+
+/// @brief Specifies the time the server waits for new change stream events
+/// before returning an empty batch
+class MaxAwaitTime {
+ public:
+  explicit MaxAwaitTime(const std::chrono::milliseconds& value)
+      : value_(value) {}
+
+  const std::chrono::milliseconds& Value() const { return value_; }
+
+ private:
+  std::chrono::milliseconds value_;
+};
+
 }  // namespace storages::mongo::options
 
 USERVER_NAMESPACE_END
@@ -0,0 +1,82 @@
+#pragma once
+
+/// @file userver/storages/mongo/write_coalescer.hpp
+/// @brief @copybrief storages::mongo::WriteCoalescer
+
+#include <chrono>
+#include <cstddef>
+#include <memory>
+
+#include <userver/formats/bson/document.hpp>
+#include <userver/storages/mongo/bulk_ops.hpp>
+#include <userver/storages/mongo/collection.hpp>
+#include <userver/storages/mongo/write_result.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace storages::mongo {
+
+struct WriteCoalescerSettings final {
+  /// Maximum time a write waits for other writes to join its batch
+  std::chrono::milliseconds max_delay{1};
+  /// A batch is executed right away once it has that many writes
+  std::size_t max_batch_size{1000};
+};
+
+/// @brief Merges single-document writes issued concurrently to a collection
+/// into unordered bulk operations.
+///
+/// The first write of a batch waits up to `max_delay` for other tasks to
+/// append their writes and then executes all of them in a single round-trip.
+/// Each caller gets its own result and its own server error, as if the write
+/// was executed by itself. Network errors fail all the writes of a batch.
+///
+/// Writes of a batch are unordered, so use it only for writes that are
+/// independent from each other.
+///
+/// @note MongoDB does not report per-update counters of bulk operations, so
+/// the results of updates contain upserted ids only. Use
+/// Collection::UpdateOne() if matched or modified counts are needed.
+class WriteCoalescer final {
+ public:
+  explicit WriteCoalescer(Collection collection,
+                          WriteCoalescerSettings settings = {});
+  ~WriteCoalescer();
+
+  WriteCoalescer(WriteCoalescer&&) = delete;
+  WriteCoalescer& operator=(WriteCoalescer&&) = delete;
+
+  /// Inserts a single document into the collection
+  WriteResult InsertOne(formats::bson::Document document);
+
+  /// @brief Updates a single matching document
+  /// @see options::Upsert
+  template <typename... Options>
+  WriteResult UpdateOne(formats::bson::Document selector,
+                        formats::bson::Document update, Options&&... options);
+
+  /// @name Prepared sub-operation executors
+  /// @{
+  WriteResult Execute(const bulk_ops::InsertOne&);
+  WriteResult Execute(const bulk_ops::Update&);
+  /// @}
+
+ private:
+  class Impl;
+
+  std::unique_ptr<Impl> impl_;
+};
+
+template <typename... Options>
+WriteResult WriteCoalescer::UpdateOne(formats::bson::Document selector,
+                                      formats::bson::Document update,
+                                      Options&&... options) {
+  bulk_ops::Update update_subop(bulk_ops::Update::Mode::kSingle,
+                                std::move(selector), std::move(update));
+  (update_subop.SetOption(std::forward<Options>(options)), ...);
+  return Execute(update_subop);
+}
+
+}  // namespace storages::mongo
+
+USERVER_NAMESPACE_END
@@ -1,17 +1,151 @@
 #include <userver/cache/base_mongo_cache.hpp>
 
+#include <algorithm>
+#include <cstdint>
+#include <vector>
+
 #include <userver/components/component_config.hpp>
+#include <userver/formats/bson/inline.hpp>
+#include <userver/logging/log.hpp>
 #include <userver/yaml_config/merge_schemas.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
 namespace components::impl {
 
+namespace {
+
+// More samples give more even partitions at the cost of a bigger $sample
+constexpr std::size_t kSamplesPerPartition = 16;
+
+// Range queries only match values of the same BSON type bracket, so split
+// points must share it. Returns 0 for the values that cannot be split by.
+int GetTypeBracket(const formats::bson::Value& value) {
+  if (value.IsInt32() || value.IsInt64() || value.IsDouble()) return 1;
+  if (value.IsString()) return 2;
+  if (value.IsOid()) return 3;
+  return 0;
+}
+
+}  // namespace
+
 std::chrono::milliseconds GetMongoCacheUpdateCorrection(
     const ComponentConfig& config) {
   return config["update-correction"].As<std::chrono::milliseconds>(0);
 }
 
+std::size_t GetMongoCacheFullUpdatePartitions(const ComponentConfig& config) {
+  return std::max<std::size_t>(
+      config["full-update-partitions"].As<std::size_t>(1), 1);
+}
+
+std::vector<formats::bson::Document> SplitMongoCacheFullUpdate(
+    storages::mongo::Collection collection, std::size_t partitions,
+    bool is_secondary_preferred) {
+  namespace bson = formats::bson;
+  namespace sm = storages::mongo;
+
+  std::vector<bson::Document> filters;
+  if (partitions <= 1) {
+    filters.emplace_back();
+    return filters;
+  }
+
+  const auto sample_size =
+      static_cast<std::int64_t>(partitions * kSamplesPerPartition);
+  sm::operations::Aggregate sample_op(bson::MakeArray(
+      bson::MakeDoc("$sample", bson::MakeDoc("size", sample_size)),
+      bson::MakeDoc("$project", bson::MakeDoc("_id", 1)),
+      bson::MakeDoc("$sort", bson::MakeDoc("_id", 1))));
+  if (is_secondary_preferred) {
+    sample_op.SetOption(sm::options::ReadPreference::kSecondaryPreferred);
+  }
+  auto cursor = collection.Execute(sample_op);
+
+  std::vector<bson::Value> samples;
+  for (const auto& doc : cursor) samples.push_back(doc["_id"]);
+
+  const auto type_bracket = samples.empty() ? 0 : GetTypeBracket(samples[0]);
+  const bool can_split =
+      samples.size() >= partitions && type_bracket != 0 &&
+      std::all_of(samples.begin(), samples.end(), [&](const auto& sample) {
+        return GetTypeBracket(sample) == type_bracket;
+      });
+  if (!can_split) {
+    LOG_INFO() << "Cannot split full update of mongo cache into " << partitions
+               << " partitions by " << samples.size()
+               << " _id samples, reading it at once";
+    filters.emplace_back();
+    return filters;
+  }
+
+  std::vector<bson::Value> bounds;
+  bounds.reserve(partitions - 1);
+  for (std::size_t i = 1; i < partitions; ++i) {
+    bounds.push_back(samples[i * samples.size() / partitions]);
+  }
+
+  filters.reserve(partitions);
+  filters.push_back(bson::MakeDoc("_id", bson::MakeDoc("$lt", bounds.front())));
+  for (std::size_t i = 1; i < bounds.size(); ++i) {
+    filters.push_back(bson::MakeDoc(
+        "_id", bson::MakeDoc("$gte", bounds[i - 1], "$lt", bounds[i])));
+  }
+  // Documents with _id of other types are matched by the last partition only
+  filters.push_back(bson::MakeDoc(
+      "_id", bson::MakeDoc("$not", bson::MakeDoc("$lt", bounds.back()))));
+  return filters;
+}
+
+std::optional<MongoCacheChangeStreamSettings>
+GetMongoCacheChangeStreamSettings(const ComponentConfig& config) {
+  const auto change_stream = config["change-stream"];
+  if (!change_stream["enabled"].As<bool>(false)) return std::nullopt;
+
+  MongoCacheChangeStreamSettings settings;
+  settings.max_await_time =
+      change_stream["max-await-time"].As<std::chrono::milliseconds>(
+          settings.max_await_time);
+  settings.max_batch_size = std::max<std::size_t>(
+      change_stream["max-batch-size"].As<std::size_t>(settings.max_batch_size),
+      1);
+  return settings;
+}
+
+storages::mongo::ChangeStream OpenMongoCacheChangeStream(
+    const storages::mongo::Collection& collection,
+    const MongoCacheChangeStreamSettings& settings,
+    const std::optional<formats::bson::Document>& resume_token,
+    bool is_secondary_preferred) {
+  namespace sm = storages::mongo;
+
+  sm::operations::Watch watch_op;
+  watch_op.SetOption(sm::options::FullDocumentLookup{});
+  watch_op.SetOption(sm::options::FullDocumentBeforeChange{});
+  watch_op.SetOption(sm::options::MaxAwaitTime{settings.max_await_time});
+  if (resume_token) {
+    watch_op.SetOption(sm::options::ResumeAfter{*resume_token});
+  }
+  if (is_secondary_preferred) {
+    watch_op.SetOption(sm::options::ReadPreference::kSecondaryPreferred);
+  }
+  return collection.Execute(watch_op);
+}
+
+MongoCacheChangeKind GetMongoCacheChangeKind(
+    const formats::bson::Document& event) {
+  const auto type = event["operationType"].As<std::string>();
+  if (type == "insert" || type == "update" || type == "replace") {
+    return MongoCacheChangeKind::kUpsert;
+  }
+  if (type == "delete") return MongoCacheChangeKind::kDelete;
+  if (type == "invalidate" || type == "drop" || type == "rename" ||
+      type == "dropDatabase") {
+    return MongoCacheChangeKind::kInvalidate;
+  }
+  return MongoCacheChangeKind::kSkip;
+}
+
 std::string GetMongoCacheSchema() {
   return R"(
 type: object
@@ -22,6 +156,29 @@ properties:
         type: string
         description: adjusts incremental updates window to overlap with previous update
         defaultDescription: 0
+    full-update-partitions:
+        type: integer
+        description: number of _id ranges read concurrently on full updates
+        defaultDescription: 1
+        minimum: 1
+    change-stream:
+        type: object
+        description: settings of incremental updates from the change stream of the collection
+        additionalProperties: false
+        properties:
+            enabled:
+                type: boolean
+                description: apply the change stream events on incremental updates instead of querying the collection
+                defaultDescription: false
+            max-await-time:
+                type: string
+                description: time the server waits for new events on an incremental update
+                defaultDescription: 100ms
+            max-batch-size:
+                type: integer
+                description: maximum number of events applied by an incremental update
+                defaultDescription: 10000
+                minimum: 1
 )";
 }
 
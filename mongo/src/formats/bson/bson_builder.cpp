@@ -172,17 +172,22 @@ BsonBuilder& BsonBuilder::Append(std::string_view key, const bson_t* sub_bson) {
   return *this;
 }
 
+void BsonBuilder::AppendInto(bson_t* dest, std::string_view key,
+                             const Value& value) {
+  value.impl_->CheckNotMissing();
+  AppendInto(dest, key, *value.impl_);
+}
+
 void BsonBuilder::AppendInto(bson_t* dest, std::string_view key,
                              const ValueImpl& value) {
   class Visitor {
    public:
-    Visitor(BsonBuilder& builder, bson_t* dest, std::string_view key)
-        : builder_(builder), dest_(dest), key_(key) {}
+    Visitor(bson_t* dest, std::string_view key) : dest_(dest), key_(key) {}
 
     void operator()(const ParsedDocument& doc) const {
       SubdocBson subdoc_bson(dest_, key_.data(), key_.size());
       for (const auto& [key, elem] : doc) {
-        builder_.AppendInto(subdoc_bson.Get(), key, *elem);
+        AppendInto(subdoc_bson.Get(), key, *elem);
       }
     }
 
@@ -190,13 +195,12 @@ void BsonBuilder::AppendInto(bson_t* dest, std::string_view key,
       SubarrayBson subarray_bson(dest_, key_.data(), key_.size());
       ArrayIndexer indexer;
       for (const auto& elem : array) {
-        builder_.AppendInto(subarray_bson.Get(), indexer.GetKey(), *elem);
+        AppendInto(subarray_bson.Get(), indexer.GetKey(), *elem);
         indexer.Advance();
       }
     }
 
    private:
-    BsonBuilder& builder_;
     bson_t* dest_;
     std::string_view key_;
   };
@@ -206,7 +210,7 @@ void BsonBuilder::AppendInto(bson_t* dest, std::string_view key,
   if (!parsed_ptr) {
     bson_append_value(dest, key.data(), key.size(), &value.bson_value_);
   } else {
-    std::visit(Visitor(*this, dest, key), *parsed_ptr);
+    std::visit(Visitor(dest, key), *parsed_ptr);
   }
 }
 
@@ -0,0 +1,184 @@
+#include <userver/formats/bson/deserialize.hpp>
+
+#include <cmath>
+#include <limits>
+#include <vector>
+
+#include <formats/bson/wrappers.hpp>
+#include <userver/formats/common/path.hpp>
+#include <userver/utils/algo.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace formats::bson::impl {
+
+namespace {
+
+constexpr std::int64_t kMaxIntDouble{std::int64_t{1}
+                                     << std::numeric_limits<double>::digits};
+
+[[noreturn]] void ThrowTypeMismatch(const bson_iter_t& it,
+                                    bson_type_t expected,
+                                    const IterPath& path) {
+  throw TypeMismatchException(bson_iter_type(&it), expected, path.GetPath());
+}
+
+}  // namespace
+
+std::string IterPath::GetPath() const {
+  std::vector<const IterPath*> chain;
+  for (const auto* item = this; item->parent_; item = item->parent_) {
+    chain.push_back(item);
+  }
+  if (chain.empty()) return common::kPathRoot;
+
+  std::string path;
+  for (auto it = chain.rbegin(); it != chain.rend(); ++it) {
+    if ((*it)->is_index_) {
+      common::AppendPath(path, (*it)->index_);
+    } else {
+      common::AppendPath(path, (*it)->key_);
+    }
+  }
+  return path;
+}
+
+bool ParseIter(const bson_iter_t& it, const IterPath& path, parse::To<bool>) {
+  if (bson_iter_type(&it) != BSON_TYPE_BOOL) {
+    ThrowTypeMismatch(it, BSON_TYPE_BOOL, path);
+  }
+  return bson_iter_bool(&it);
+}
+
+int64_t ParseIter(const bson_iter_t& it, const IterPath& path,
+                  parse::To<int64_t>) {
+  switch (bson_iter_type(&it)) {
+    case BSON_TYPE_INT32:
+      return bson_iter_int32(&it);
+    case BSON_TYPE_INT64:
+      return bson_iter_int64(&it);
+    case BSON_TYPE_DOUBLE: {
+      const auto as_double = bson_iter_double(&it);
+      double int_part = 0.0;
+      const auto frac_part = std::modf(as_double, &int_part);
+      if (frac_part || std::abs(as_double) >= kMaxIntDouble) {
+        throw ConversionException(
+            utils::StrCat("Conversion ", std::to_string(as_double),
+                          " to integer causes precision change"),
+            path.GetPath());
+      }
+      return static_cast<int64_t>(as_double);
+    }
+    default:
+      ThrowTypeMismatch(it, BSON_TYPE_INT64, path);
+  }
+}
+
+uint64_t ParseIter(const bson_iter_t& it, const IterPath& path,
+                   parse::To<uint64_t>) {
+  const auto value = ParseIter(it, path, parse::To<int64_t>{});
+  if (value < 0) {
+    throw ConversionException(
+        utils::StrCat("Cannot convert to unsigned value from negative value ",
+                      std::to_string(value)),
+        path.GetPath());
+  }
+  return static_cast<uint64_t>(value);
+}
+
+double ParseIter(const bson_iter_t& it, const IterPath& path,
+                 parse::To<double>) {
+  switch (bson_iter_type(&it)) {
+    case BSON_TYPE_DOUBLE:
+      return bson_iter_double(&it);
+    case BSON_TYPE_INT32:
+      return bson_iter_int32(&it);
+    case BSON_TYPE_INT64: {
+      const auto as_int = bson_iter_int64(&it);
+      if (as_int == std::numeric_limits<int64_t>::min() ||
+          std::abs(as_int) > kMaxIntDouble) {
+        throw ConversionException(
+            utils::StrCat("Conversion of ", std::to_string(as_int),
+                          " to double causes precision loss"),
+            path.GetPath());
+      }
+      return static_cast<double>(as_int);
+    }
+    default:
+      ThrowTypeMismatch(it, BSON_TYPE_DOUBLE, path);
+  }
+}
+
+std::string ParseIter(const bson_iter_t& it, const IterPath& path,
+                      parse::To<std::string>) {
+  if (bson_iter_type(&it) != BSON_TYPE_UTF8) {
+    ThrowTypeMismatch(it, BSON_TYPE_UTF8, path);
+  }
+  uint32_t size = 0;
+  const char* data = bson_iter_utf8(&it, &size);
+  return {data, size};
+}
+
+std::chrono::system_clock::time_point ParseIter(
+    const bson_iter_t& it, const IterPath& path,
+    parse::To<std::chrono::system_clock::time_point>) {
+  if (bson_iter_type(&it) != BSON_TYPE_DATE_TIME) {
+    ThrowTypeMismatch(it, BSON_TYPE_DATE_TIME, path);
+  }
+  return std::chrono::system_clock::time_point(
+      std::chrono::milliseconds(bson_iter_date_time(&it)));
+}
+
+Oid ParseIter(const bson_iter_t& it, const IterPath& path, parse::To<Oid>) {
+  if (bson_iter_type(&it) != BSON_TYPE_OID) {
+    ThrowTypeMismatch(it, BSON_TYPE_OID, path);
+  }
+  return *bson_iter_oid(&it);
+}
+
+Binary ParseIter(const bson_iter_t& it, const IterPath& path,
+                 parse::To<Binary>) {
+  if (bson_iter_type(&it) != BSON_TYPE_BINARY) {
+    ThrowTypeMismatch(it, BSON_TYPE_BINARY, path);
+  }
+  bson_subtype_t subtype{};
+  uint32_t size = 0;
+  const uint8_t* data = nullptr;
+  bson_iter_binary(&it, &subtype, &size, &data);
+  return Binary(std::string(reinterpret_cast<const char*>(data), size));
+}
+
+Value ParseIterValue(const bson_iter_t& it) {
+  const std::string_view key(bson_iter_key(&it));
+  MutableBson bson;
+  bson_append_iter(bson.Get(), key.data(), key.size(), &it);
+  return Document(bson.Extract())[std::string{key}];
+}
+
+void RecurseDocument(const bson_iter_t& it, const IterPath& path,
+                     bson_iter_t& child) {
+  if (bson_iter_type(&it) != BSON_TYPE_DOCUMENT) {
+    ThrowTypeMismatch(it, BSON_TYPE_DOCUMENT, path);
+  }
+  if (!bson_iter_recurse(&it, &child)) {
+    throw ParseException("Malformed BSON document at " + path.GetPath());
+  }
+}
+
+void RecurseArray(const bson_iter_t& it, const IterPath& path,
+                  bson_iter_t& child) {
+  if (bson_iter_type(&it) != BSON_TYPE_ARRAY) {
+    ThrowTypeMismatch(it, BSON_TYPE_ARRAY, path);
+  }
+  if (!bson_iter_recurse(&it, &child)) {
+    throw ParseException("Malformed BSON array at " + path.GetPath());
+  }
+}
+
+void ThrowMemberMissing(const IterPath& path, std::string_view name) {
+  throw MemberMissingException(IterPath(path, name).GetPath());
+}
+
+}  // namespace formats::bson::impl
+
+USERVER_NAMESPACE_END
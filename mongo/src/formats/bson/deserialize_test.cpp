@@ -0,0 +1,131 @@
+#include <userver/formats/bson/deserialize.hpp>
+
+#include <chrono>
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <userver/formats/bson.hpp>
+#include <userver/formats/bson/serialize_aggregate.hpp>
+#include <userver/utest/assert_macros.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+struct Car {
+  std::string number;
+  std::optional<std::string> color;
+  int age{};
+};
+
+struct Driver {
+  std::string uuid;
+  std::vector<Car> cars;
+  std::optional<double> score;
+  std::vector<std::optional<std::int64_t>> grades;
+  std::chrono::system_clock::time_point updated;
+  formats::bson::Document raw;
+};
+
+}  // namespace
+
+template <>
+struct formats::json::AggregateFieldNames<Car> {
+  static constexpr std::array<std::string_view, 3> kValue{"number", "color",
+                                                          "age"};
+};
+
+template <>
+struct formats::json::AggregateFieldNames<Driver> {
+  static constexpr std::array<std::string_view, 6> kValue{
+      "uuid", "cars", "score", "grades", "updated", "raw"};
+};
+
+namespace {
+
+const auto kUpdated =
+    std::chrono::system_clock::time_point{} + std::chrono::milliseconds{42};
+
+}  // namespace
+
+TEST(BsonDeserialize, Aggregate) {
+  const auto doc = formats::bson::MakeDoc(
+      "uuid", "abc", "unknown", formats::bson::MakeDoc("x", 1), "cars",
+      formats::bson::MakeArray(
+          formats::bson::MakeDoc("number", "A001", "age", 3),
+          formats::bson::MakeDoc("number", "B002", "color", "red", "age",
+                                 std::int64_t{5})),
+      "score", nullptr, "grades",
+      formats::bson::MakeArray(1, nullptr, 2.0), "updated", kUpdated, "raw",
+      formats::bson::MakeDoc("k", "v"));
+
+  const auto driver = formats::bson::Deserialize<Driver>(doc);
+  EXPECT_EQ(driver.uuid, "abc");
+  ASSERT_EQ(driver.cars.size(), 2);
+  EXPECT_EQ(driver.cars[0].number, "A001");
+  EXPECT_EQ(driver.cars[0].color, std::nullopt);
+  EXPECT_EQ(driver.cars[0].age, 3);
+  EXPECT_EQ(driver.cars[1].color, "red");
+  EXPECT_EQ(driver.cars[1].age, 5);
+  EXPECT_EQ(driver.score, std::nullopt);
+  EXPECT_EQ(driver.grades,
+            (std::vector<std::optional<std::int64_t>>{1, std::nullopt, 2}));
+  EXPECT_EQ(driver.updated, kUpdated);
+  EXPECT_EQ(driver.raw, formats::bson::MakeDoc("k", "v"));
+}
+
+TEST(BsonDeserialize, MatchesValueParse) {
+  const auto doc = formats::bson::MakeDoc("number", "C003", "age", 7);
+  const auto car = formats::bson::Deserialize<Car>(doc);
+  EXPECT_EQ(car.number, doc["number"].As<std::string>());
+  EXPECT_EQ(car.age, doc["age"].As<int>());
+}
+
+TEST(BsonDeserialize, Errors) {
+  UEXPECT_THROW_MSG(
+      formats::bson::Deserialize<Car>(formats::bson::MakeDoc("age", 1)),
+      formats::bson::MemberMissingException, "number");
+  UEXPECT_THROW_MSG(formats::bson::Deserialize<Car>(formats::bson::MakeDoc(
+                        "number", "A", "age", "old")),
+                    formats::bson::TypeMismatchException, "age");
+  UEXPECT_THROW_MSG(formats::bson::Deserialize<Car>(formats::bson::MakeDoc(
+                        "number", "A", "age", std::int64_t{1} << 40)),
+                    formats::bson::ParseException, "age");
+  UEXPECT_THROW_MSG(
+      formats::bson::Deserialize<Driver>(formats::bson::MakeDoc(
+          "uuid", "u", "cars",
+          formats::bson::MakeArray(formats::bson::MakeDoc("number", 1)),
+          "grades", formats::bson::MakeArray(), "updated", kUpdated, "raw",
+          formats::bson::MakeDoc())),
+      formats::bson::TypeMismatchException, "cars[0].number");
+}
+
+TEST(BsonDeserialize, RoundTrip) {
+  const Driver driver{
+      "uuid",
+      {{"A001", "blue", 2}},
+      0.5,
+      {std::nullopt, 3},
+      kUpdated,
+      formats::bson::MakeDoc("k", formats::bson::MakeArray(1)),
+  };
+
+  formats::bson::DocumentBuilder builder;
+  WriteToStream(driver, builder);
+  const auto parsed =
+      formats::bson::Deserialize<Driver>(builder.Extract());
+
+  EXPECT_EQ(parsed.uuid, driver.uuid);
+  ASSERT_EQ(parsed.cars.size(), 1);
+  EXPECT_EQ(parsed.cars[0].color, "blue");
+  EXPECT_EQ(parsed.score, driver.score);
+  EXPECT_EQ(parsed.grades, driver.grades);
+  EXPECT_EQ(parsed.updated, driver.updated);
+  EXPECT_EQ(parsed.raw, driver.raw);
+}
+
+USERVER_NAMESPACE_END
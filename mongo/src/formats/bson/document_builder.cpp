@@ -0,0 +1,299 @@
+#include <userver/formats/bson/document_builder.hpp>
+
+#include <vector>
+
+#include <bson/bson.h>
+
+#include <formats/bson/int_utils.hpp>
+#include <formats/bson/wrappers.hpp>
+#include <userver/formats/bson/bson_builder.hpp>
+#include <userver/formats/bson/exception.hpp>
+#include <userver/utils/assert.hpp>
+#include <userver/utils/text.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace formats::bson {
+
+namespace {
+
+enum class LevelKind { kDocument, kArray };
+
+// Nested document or array being written into the buffer of its parent
+struct Level final {
+  // NOLINTNEXTLINE(cppcoreguidelines-pro-type-member-init)
+  bson_t bson;
+  LevelKind kind{LevelKind::kDocument};
+  impl::ArrayIndexer indexer;
+};
+
+}  // namespace
+
+struct DocumentBuilder::Impl {
+  impl::MutableBson root;
+  bool is_root_started{false};
+  bool is_root_ended{false};
+
+  // The child bson_t refers to its parent, so the levels must not move
+  std::vector<std::unique_ptr<Level>> levels;
+  std::size_t depth{0};
+
+  std::string key;
+  bool has_key{false};
+
+  bson_t* Current() {
+    return depth == 0 ? root.Get() : &levels[depth - 1]->bson;
+  }
+
+  Level& PushLevel(LevelKind kind) {
+    if (depth == levels.size()) levels.push_back(std::make_unique<Level>());
+    auto& level = *levels[depth++];
+    level.kind = kind;
+    level.indexer = impl::ArrayIndexer{};
+    return level;
+  }
+
+  std::string_view NextKey() {
+    UINVARIANT(is_root_started && !is_root_ended,
+               "The values must be written inside the root object");
+    if (depth != 0 && levels[depth - 1]->kind == LevelKind::kArray) {
+      auto& indexer = levels[depth - 1]->indexer;
+      const auto index_key = indexer.GetKey();
+      indexer.Advance();
+      return index_key;
+    }
+
+    UINVARIANT(has_key, "Key() must be called before writing a document value");
+    has_key = false;
+    return key;
+  }
+};
+
+DocumentBuilder::DocumentBuilder() : impl_(std::make_unique<Impl>()) {}
+
+DocumentBuilder::~DocumentBuilder() = default;
+
+DocumentBuilder::ObjectGuard::ObjectGuard(DocumentBuilder& builder)
+    : builder_(builder) {
+  builder_.StartObject();
+}
+
+DocumentBuilder::ObjectGuard::~ObjectGuard() { builder_.End(); }
+
+DocumentBuilder::ArrayGuard::ArrayGuard(DocumentBuilder& builder)
+    : builder_(builder) {
+  builder_.StartArray();
+}
+
+DocumentBuilder::ArrayGuard::~ArrayGuard() { builder_.End(); }
+
+Document DocumentBuilder::Extract() {
+  UINVARIANT(impl_->depth == 0 && !(impl_->is_root_started &&
+                                    !impl_->is_root_ended),
+             "The root object must be ended before the extraction");
+  Document result(impl_->root.Extract());
+  impl_->root = impl::MutableBson();
+  impl_->is_root_started = false;
+  impl_->is_root_ended = false;
+  return result;
+}
+
+void DocumentBuilder::WriteNull() {
+  const auto key = impl_->NextKey();
+  bson_append_null(impl_->Current(), key.data(), key.size());
+}
+
+void DocumentBuilder::WriteBool(bool value) {
+  const auto key = impl_->NextKey();
+  bson_append_bool(impl_->Current(), key.data(), key.size(), value);
+}
+
+void DocumentBuilder::WriteInt32(int32_t value) {
+  const auto key = impl_->NextKey();
+  bson_append_int32(impl_->Current(), key.data(), key.size(), value);
+}
+
+void DocumentBuilder::WriteInt64(int64_t value) {
+  const auto key = impl_->NextKey();
+  bson_append_int64(impl_->Current(), key.data(), key.size(), value);
+}
+
+void DocumentBuilder::WriteUInt64(uint64_t value) {
+  WriteInt64(impl::ToInt64(value));
+}
+
+void DocumentBuilder::WriteDouble(double value) {
+  const auto key = impl_->NextKey();
+  bson_append_double(impl_->Current(), key.data(), key.size(), value);
+}
+
+void DocumentBuilder::WriteString(std::string_view value) {
+  if (!utils::text::utf8::IsValid(
+          reinterpret_cast<const unsigned char*>(value.data()), value.size())) {
+    throw BsonException("BSON strings must be valid UTF-8");
+  }
+  const auto key = impl_->NextKey();
+  bson_append_utf8(impl_->Current(), key.data(), key.size(), value.data(),
+                   value.size());
+}
+
+void DocumentBuilder::WriteDateTime(
+    std::chrono::system_clock::time_point value) {
+  const auto key = impl_->NextKey();
+  bson_append_date_time(impl_->Current(), key.data(), key.size(),
+                        std::chrono::duration_cast<std::chrono::milliseconds>(
+                            value.time_since_epoch())
+                            .count());
+}
+
+void DocumentBuilder::WriteOid(const Oid& value) {
+  const auto key = impl_->NextKey();
+  bson_append_oid(impl_->Current(), key.data(), key.size(), value.GetNative());
+}
+
+void DocumentBuilder::WriteBinary(const Binary& value) {
+  const auto key = impl_->NextKey();
+  bson_append_binary(impl_->Current(), key.data(), key.size(),
+                     BSON_SUBTYPE_BINARY, value.Data(), value.Size());
+}
+
+void DocumentBuilder::WriteDecimal128(const Decimal128& value) {
+  const auto key = impl_->NextKey();
+  bson_append_decimal128(impl_->Current(), key.data(), key.size(),
+                         value.GetNative());
+}
+
+void DocumentBuilder::WriteTimestamp(const Timestamp& value) {
+  const auto key = impl_->NextKey();
+  bson_append_timestamp(impl_->Current(), key.data(), key.size(),
+                        value.GetTimestamp(), value.GetIncrement());
+}
+
+void DocumentBuilder::Key(std::string_view key) {
+  UASSERT_MSG(impl_->depth == 0 ||
+                  impl_->levels[impl_->depth - 1]->kind == LevelKind::kDocument,
+              "Key() is only allowed inside of objects");
+  impl_->key.assign(key);
+  impl_->has_key = true;
+}
+
+void DocumentBuilder::WriteValue(const Value& value) {
+  const auto key = impl_->NextKey();
+  impl::BsonBuilder::AppendInto(impl_->Current(), key, value);
+}
+
+void DocumentBuilder::StartObject() {
+  if (!impl_->is_root_started) {
+    impl_->is_root_started = true;
+    return;
+  }
+
+  const auto key = impl_->NextKey();
+  auto* parent = impl_->Current();
+  auto& level = impl_->PushLevel(LevelKind::kDocument);
+  bson_append_document_begin(parent, key.data(), key.size(), &level.bson);
+}
+
+void DocumentBuilder::StartArray() {
+  UINVARIANT(impl_->is_root_started,
+             "The root of a BSON document must be an object");
+
+  const auto key = impl_->NextKey();
+  auto* parent = impl_->Current();
+  auto& level = impl_->PushLevel(LevelKind::kArray);
+  bson_append_array_begin(parent, key.data(), key.size(), &level.bson);
+}
+
+void DocumentBuilder::End() noexcept {
+  if (impl_->depth == 0) {
+    UASSERT(impl_->is_root_started && !impl_->is_root_ended);
+    impl_->is_root_ended = true;
+    return;
+  }
+
+  auto& level = *impl_->levels[--impl_->depth];
+  auto* parent = impl_->Current();
+  if (level.kind == LevelKind::kArray) {
+    bson_append_array_end(parent, &level.bson);
+  } else {
+    bson_append_document_end(parent, &level.bson);
+  }
+  bson_destroy(&level.bson);
+}
+
+void WriteToStream(bool value, DocumentBuilder& builder) {
+  builder.WriteBool(value);
+}
+
+void WriteToStream(int value, DocumentBuilder& builder) {
+  builder.WriteInt32(value);
+}
+
+void WriteToStream(unsigned value, DocumentBuilder& builder) {
+  builder.WriteInt64(value);
+}
+
+void WriteToStream(long value, DocumentBuilder& builder) {
+  builder.WriteInt64(value);
+}
+
+void WriteToStream(unsigned long value, DocumentBuilder& builder) {
+  builder.WriteUInt64(value);
+}
+
+void WriteToStream(long long value, DocumentBuilder& builder) {
+  builder.WriteInt64(value);
+}
+
+void WriteToStream(unsigned long long value, DocumentBuilder& builder) {
+  builder.WriteUInt64(value);
+}
+
+void WriteToStream(double value, DocumentBuilder& builder) {
+  builder.WriteDouble(value);
+}
+
+void WriteToStream(const char* value, DocumentBuilder& builder) {
+  builder.WriteString(value);
+}
+
+void WriteToStream(std::string_view value, DocumentBuilder& builder) {
+  builder.WriteString(value);
+}
+
+void WriteToStream(const std::string& value, DocumentBuilder& builder) {
+  builder.WriteString(value);
+}
+
+void WriteToStream(std::chrono::system_clock::time_point value,
+                   DocumentBuilder& builder) {
+  builder.WriteDateTime(value);
+}
+
+void WriteToStream(const Oid& value, DocumentBuilder& builder) {
+  builder.WriteOid(value);
+}
+
+void WriteToStream(const Binary& value, DocumentBuilder& builder) {
+  builder.WriteBinary(value);
+}
+
+void WriteToStream(const Decimal128& value, DocumentBuilder& builder) {
+  builder.WriteDecimal128(value);
+}
+
+void WriteToStream(const Timestamp& value, DocumentBuilder& builder) {
+  builder.WriteTimestamp(value);
+}
+
+void WriteToStream(const Value& value, DocumentBuilder& builder) {
+  builder.WriteValue(value);
+}
+
+void WriteToStream(const Document& value, DocumentBuilder& builder) {
+  builder.WriteValue(value);
+}
+
+}  // namespace formats::bson
+
+USERVER_NAMESPACE_END
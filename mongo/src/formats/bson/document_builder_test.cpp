@@ -0,0 +1,154 @@
+#include <userver/formats/bson/document_builder.hpp>
+
+#include <chrono>
+#include <cstdint>
+#include <map>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <userver/formats/bson.hpp>
+#include <userver/formats/bson/serialize_aggregate.hpp>
+#include <userver/utest/assert_macros.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+struct Item {
+  std::int64_t id{};
+  std::string name;
+  std::optional<std::vector<std::string>> tags;
+};
+
+struct Response {
+  std::vector<Item> items;
+  std::map<std::string, double> weights;
+  std::optional<bool> flag;
+  formats::bson::Value raw;
+};
+
+}  // namespace
+
+template <>
+struct formats::json::AggregateFieldNames<Item> {
+  static constexpr std::array<std::string_view, 3> kValue{"id", "name",
+                                                          "tags"};
+};
+
+template <>
+struct formats::json::AggregateFieldNames<Response> {
+  static constexpr std::array<std::string_view, 4> kValue{"items", "weights",
+                                                          "flag", "raw"};
+};
+
+TEST(BsonDocumentBuilder, Example) {
+  /// [Sample formats::bson::DocumentBuilder usage]
+  formats::bson::DocumentBuilder builder;
+  {
+    formats::bson::DocumentBuilder::ObjectGuard guard(builder);
+    builder.Key("name");
+    WriteToStream("value", builder);
+    builder.Key("list");
+    WriteToStream(std::vector<int>{1, 2}, builder);
+  }
+  const formats::bson::Document doc = builder.Extract();
+  /// [Sample formats::bson::DocumentBuilder usage]
+
+  EXPECT_EQ(doc, formats::bson::MakeDoc("name", "value", "list",
+                                        formats::bson::MakeArray(1, 2)));
+}
+
+TEST(BsonDocumentBuilder, MatchesValueBuilder) {
+  const auto time_point = std::chrono::system_clock::time_point{} +
+                          std::chrono::milliseconds{1234};
+  const formats::bson::Oid oid;
+
+  formats::bson::DocumentBuilder builder;
+  {
+    formats::bson::DocumentBuilder::ObjectGuard guard(builder);
+    builder.Key("null");
+    builder.WriteNull();
+    builder.Key("bool");
+    WriteToStream(true, builder);
+    builder.Key("int");
+    WriteToStream(1, builder);
+    builder.Key("int64");
+    WriteToStream(std::int64_t{-2}, builder);
+    builder.Key("double");
+    WriteToStream(1.5, builder);
+    builder.Key("time");
+    WriteToStream(time_point, builder);
+    builder.Key("oid");
+    WriteToStream(oid, builder);
+    builder.Key("nested");
+    {
+      formats::bson::DocumentBuilder::ObjectGuard nested(builder);
+      builder.Key("array");
+      formats::bson::DocumentBuilder::ArrayGuard array(builder);
+      WriteToStream("a", builder);
+      {
+        formats::bson::DocumentBuilder::ArrayGuard inner(builder);
+      }
+      builder.WriteValue(formats::bson::MakeDoc("x", 1));
+    }
+  }
+
+  const auto expected = formats::bson::MakeDoc(
+      "null", nullptr, "bool", true, "int", 1, "int64", std::int64_t{-2},
+      "double", 1.5, "time", time_point, "oid", oid, "nested",
+      formats::bson::MakeDoc(
+          "array",
+          formats::bson::MakeArray("a", formats::bson::MakeArray(),
+                                   formats::bson::MakeDoc("x", 1))));
+  EXPECT_EQ(builder.Extract(), expected);
+}
+
+TEST(BsonDocumentBuilder, Reuse) {
+  formats::bson::DocumentBuilder builder;
+  for (int i = 0; i < 3; ++i) {
+    {
+      formats::bson::DocumentBuilder::ObjectGuard guard(builder);
+      builder.Key("a");
+      formats::bson::DocumentBuilder::ArrayGuard array(builder);
+      WriteToStream(i, builder);
+    }
+    EXPECT_EQ(builder.Extract(),
+              formats::bson::MakeDoc("a", formats::bson::MakeArray(i)));
+  }
+
+  EXPECT_EQ(builder.Extract(), formats::bson::MakeDoc());
+}
+
+TEST(BsonDocumentBuilder, InvalidString) {
+  formats::bson::DocumentBuilder builder;
+  formats::bson::DocumentBuilder::ObjectGuard guard(builder);
+  builder.Key("s");
+  UEXPECT_THROW(builder.WriteString("\xff"), formats::bson::BsonException);
+}
+
+TEST(BsonDocumentBuilder, Aggregate) {
+  const Response response{
+      {{1, "first", std::vector<std::string>{"a"}}, {2, "second", {}}},
+      {{"w", 0.5}},
+      std::nullopt,
+      formats::bson::MakeDoc("k", "v"),
+  };
+
+  formats::bson::DocumentBuilder builder;
+  WriteToStream(response, builder);
+
+  const auto expected = formats::bson::MakeDoc(
+      "items",
+      formats::bson::MakeArray(
+          formats::bson::MakeDoc("id", std::int64_t{1}, "name", "first",
+                                 "tags", formats::bson::MakeArray("a")),
+          formats::bson::MakeDoc("id", std::int64_t{2}, "name", "second")),
+      "weights", formats::bson::MakeDoc("w", 0.5), "raw",
+      formats::bson::MakeDoc("k", "v"));
+  EXPECT_EQ(builder.Extract(), expected);
+}
+
+USERVER_NAMESPACE_END
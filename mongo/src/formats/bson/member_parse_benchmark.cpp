@@ -1,6 +1,7 @@
 #include <benchmark/benchmark.h>
 
 #include <userver/formats/bson.hpp>
+#include <userver/formats/bson/deserialize.hpp>
 #include <userver/formats/bson/serialize.hpp>
 #include <userver/formats/json.hpp>
 
@@ -202,10 +203,38 @@ models::Profile Parse(const formats::bson::Value& val, To<models::Profile>) {
   return profile;
 }
 
+// Same fields as in ProfileCar and Profile, parsed with
+// formats::bson::Deserialize
+struct AggregateCar {
+  std::string number;
+  std::optional<std::string> model;
+  std::optional<std::string> mark_code;
+  std::optional<int> age;
+  std::optional<double> price;
+};
+
+struct AggregateProfile {
+  std::string uuid;
+  std::string license;
+  AggregateCar car;
+};
+
 }  // namespace models
 
 }  // anonymous namespace
 
+template <>
+struct formats::json::AggregateFieldNames<models::AggregateCar> {
+  static constexpr std::array<std::string_view, 5> kValue{
+      "number", "model", "mark_code", "age", "price"};
+};
+
+template <>
+struct formats::json::AggregateFieldNames<models::AggregateProfile> {
+  static constexpr std::array<std::string_view, 3> kValue{
+      "uuid", "driver_license", "car"};
+};
+
 void bson_parse_full(benchmark::State& state) {
   static unsigned i = 0;
 
@@ -233,4 +262,17 @@ void bson_parse_access(benchmark::State& state) {
 }
 BENCHMARK(bson_parse_access);
 
+void bson_deserialize_aggregate(benchmark::State& state) {
+  static unsigned i = 0;
+
+  for (auto _ : state) {
+    auto bson = formats::bson::Document(bench_bson_data[++i % kBenchRows]);
+
+    const auto res =
+        formats::bson::Deserialize<models::AggregateProfile>(bson);
+    benchmark::DoNotOptimize(res);
+  }
+}
+BENCHMARK(bson_deserialize_aggregate);
+
 USERVER_NAMESPACE_END
@@ -15,6 +15,7 @@
 #include <userver/utils/text.hpp>
 
 #include <formats/bson/wrappers.hpp>
+#include <storages/mongo/cdriver/change_stream_impl.hpp>
 #include <storages/mongo/cdriver/cursor_impl.hpp>
 #include <storages/mongo/cdriver/pool_impl.hpp>
 #include <storages/mongo/cdriver/wrappers.hpp>
@@ -268,7 +269,7 @@ Cursor CDriverCollectionImpl::Execute(const operations::Find& operation) const {
       impl::GetNative(options), operation.impl_->read_prefs.Get()));
   return Cursor(std::make_unique<impl::cdriver::CDriverCursorImpl>(
       std::move(context.client), std::move(cdriver_cursor),
-      std::move(context.stats)));
+      std::move(context.stats), operation.impl_->prefetch));
 }
 
 WriteResult CDriverCollectionImpl::Execute(
@@ -538,6 +539,38 @@ Cursor CDriverCollectionImpl::Execute(const operations::Aggregate& operation) {
       std::move(context.stats)));
 }
 
+ChangeStream CDriverCollectionImpl::Execute(
+    const operations::Watch& operation) const {
+  auto context = MakeRequestContext("mongo_watch", operation);
+
+  // The stream copies the collection with its read preference
+  if (operation.impl_->read_prefs) {
+    mongoc_collection_set_read_prefs(context.collection.get(),
+                                     operation.impl_->read_prefs.Get());
+  }
+
+  auto pipeline_doc = operation.impl_->pipeline.GetInternalArrayDocument();
+  const bson_t* native_pipeline_bson_ptr = pipeline_doc.GetBson().get();
+  stats::OperationStopwatch stopwatch(context.stats);
+  impl::cdriver::ChangeStreamPtr cdriver_stream(mongoc_collection_watch(
+      context.collection.get(), native_pipeline_bson_ptr,
+      impl::GetNative(operation.impl_->options)));
+
+  // The initial aggregate is run on creation
+  MongoError error;
+  const bson_t* error_reply = nullptr;
+  if (mongoc_change_stream_error_document(cdriver_stream.get(),
+                                          error.GetNative(), &error_reply)) {
+    stopwatch.AccountError(error.GetKind());
+    error.Throw("Error opening change stream");
+  }
+  stopwatch.AccountSuccess();
+
+  return ChangeStream(std::make_unique<impl::cdriver::CDriverChangeStreamImpl>(
+      std::move(context.client), std::move(cdriver_stream),
+      std::move(context.stats)));
+}
+
 void CDriverCollectionImpl::Execute(const operations::Drop& operation) {
   auto context = MakeRequestContext("mongo_drop", operation);
 
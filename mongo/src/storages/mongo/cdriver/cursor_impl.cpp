@@ -1,12 +1,16 @@
 #include <storages/mongo/cdriver/cursor_impl.hpp>
 
 #include <stdexcept>
+#include <string>
+#include <vector>
 
 #include <bson/bson.h>
 #include <mongoc/mongoc.h>
 
 #include <userver/storages/mongo/mongo_error.hpp>
 #include <userver/utils/assert.hpp>
+#include <userver/utils/async.hpp>
+#include <userver/utils/scope_guard.hpp>
 
 #include <formats/bson/wrappers.hpp>
 
@@ -21,16 +25,60 @@ int mongoc_cursor_get_batch_num(const T*...) noexcept {
   return -1;
 }
 
+// Keeps documents of a fetched chunk in a single buffer instead of allocating
+// each of them separately
+class ChunkBuilder final {
+ public:
+  void Append(const bson_t* bson) {
+    offsets_.push_back(data_.size());
+    data_.append(reinterpret_cast<const char*>(bson_get_data(bson)),
+                 bson->len);
+  }
+
+  template <typename Container>
+  void ExtractTo(Container& documents) && {
+    if (offsets_.empty()) return;
+
+    auto storage = std::make_shared<Storage>();
+    storage->data = std::move(data_);
+    storage->docs.resize(offsets_.size());
+    for (size_t i = 0; i < offsets_.size(); ++i) {
+      const auto end =
+          i + 1 < offsets_.size() ? offsets_[i + 1] : storage->data.size();
+      [[maybe_unused]] const bool is_valid = bson_init_static(
+          &storage->docs[i],
+          reinterpret_cast<const uint8_t*>(storage->data.data()) + offsets_[i],
+          end - offsets_[i]);
+      UASSERT(is_valid);
+      documents.emplace_back(formats::bson::impl::BsonHolder(
+          storage, &storage->docs[i]));
+    }
+  }
+
+ private:
+  struct Storage {
+    std::string data;
+    std::vector<bson_t> docs;
+  };
+
+  std::string data_;
+  std::vector<size_t> offsets_;
+};
+
 }  // namespace
 
 namespace storages::mongo::impl::cdriver {
 
 CDriverCursorImpl::CDriverCursorImpl(
     cdriver::CDriverPoolImpl::BoundClientPtr client, cdriver::CursorPtr cursor,
-    std::shared_ptr<stats::OperationStatisticsItem> find_stats)
+    std::shared_ptr<stats::OperationStatisticsItem> find_stats, bool prefetch)
     : client_(std::move(client)),
       cursor_(std::move(cursor)),
-      find_stats_(std::move(find_stats)) {
+      find_stats_(std::move(find_stats)),
+      // Chunks are delimited by batch numbers, fall back to one by one
+      // iteration if they are not available
+      prefetch_(prefetch && cursor_ &&
+                mongoc_cursor_get_batch_num(cursor_.get()) != -1) {
   if (cursor_) {
     // Precondition: we've got a valid cursor (it could be errored-out right
     // away due to stream selection error, for example).
@@ -44,10 +92,13 @@ CDriverCursorImpl::CDriverCursorImpl(
   Next();
 }
 
-bool CDriverCursorImpl::IsValid() const { return cursor_ || current_; }
+bool CDriverCursorImpl::IsValid() const {
+  return current_ || !buffered_.empty() || prefetch_task_.IsValid() || cursor_;
+}
 
 bool CDriverCursorImpl::HasMore() const {
-  return cursor_ && mongoc_cursor_more(cursor_.get());
+  // cursor is owned by the prefetch task while it is running
+  return !buffered_.empty() || prefetch_task_.IsValid() || CursorHasMore();
 }
 
 const formats::bson::Document& CDriverCursorImpl::Current() const {
@@ -59,22 +110,59 @@ void CDriverCursorImpl::Next() {
   if (!IsValid()) throw std::logic_error("Advancing cursor past the end");
 
   current_ = std::nullopt;
-  if (!HasMore()) {
-    UASSERT(!cursor_ && !client_);
-    return;
+  if (buffered_.empty()) {
+    if (!prefetch_task_.IsValid() && !CursorHasMore()) {
+      UASSERT(!cursor_ && !client_);
+      return;
+    }
+
+    const utils::ScopeGuard release_guard([this] { ReleaseIfExhausted(); });
+    if (prefetch_task_.IsValid()) {
+      buffered_ = prefetch_task_.Get();
+    } else {
+      buffered_ = FetchChunk();
+    }
+
+    if (prefetch_ && CursorHasMore()) {
+      prefetch_task_ = utils::Async("mongo-cursor-prefetch",
+                                    [this] { return FetchChunk(); });
+    }
   }
 
+  if (!buffered_.empty()) {
+    current_.emplace(std::move(buffered_.front()));
+    buffered_.pop_front();
+  }
+}
+
+bool CDriverCursorImpl::CursorHasMore() const {
+  UASSERT(!prefetch_task_.IsValid());
+  return cursor_ && mongoc_cursor_more(cursor_.get());
+}
+
+void CDriverCursorImpl::ReleaseIfExhausted() {
+  if (!prefetch_task_.IsValid() && !CursorHasMore()) {
+    cursor_.reset();
+    client_.reset();
+  }
+}
+
+CDriverCursorImpl::Chunk CDriverCursorImpl::FetchChunk() const {
   UASSERT(client_ && cursor_);
   const auto batch_num_before = mongoc_cursor_get_batch_num(cursor_.get());
   stats::OperationStopwatch cursor_next_sw(find_stats_, "find");
 
+  ChunkBuilder builder;
   const bson_t* current_bson = nullptr;
   MongoError error;
-  while (!mongoc_cursor_error(cursor_.get(), error.GetNative()) && HasMore()) {
+  while (!mongoc_cursor_error(cursor_.get(), error.GetNative()) &&
+         mongoc_cursor_more(cursor_.get())) {
     if (mongoc_cursor_next(cursor_.get(), &current_bson)) {
-      current_ = formats::bson::Document(
-          formats::bson::impl::MutableBson::CopyNative(current_bson).Extract());
-      break;
+      builder.Append(current_bson);
+      if (!prefetch_ ||
+          batch_num_before != mongoc_cursor_get_batch_num(cursor_.get())) {
+        break;
+      }
     }
   }
   if (batch_num_before == mongoc_cursor_get_batch_num(cursor_.get())) {
@@ -84,13 +172,13 @@ void CDriverCursorImpl::Next() {
   } else {
     cursor_next_sw.AccountError(error.GetKind());
   }
-  if (!HasMore()) {
-    cursor_.reset();
-    client_.reset();
-  }
   if (error) {
     error.Throw("Error iterating over query results");
   }
+
+  Chunk chunk;
+  std::move(builder).ExtractTo(chunk);
+  return chunk;
 }
 
 }  // namespace storages::mongo::impl::cdriver
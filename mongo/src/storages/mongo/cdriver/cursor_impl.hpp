@@ -1,8 +1,10 @@
 #pragma once
 
+#include <deque>
 #include <memory>
 #include <optional>
 
+#include <userver/engine/task/task_with_result.hpp>
 #include <userver/formats/bson/document.hpp>
 
 #include <storages/mongo/cdriver/pool_impl.hpp>
@@ -19,7 +21,8 @@ class CDriverCursorImpl final : public CursorImpl {
  public:
   CDriverCursorImpl(cdriver::CDriverPoolImpl::BoundClientPtr,
                     cdriver::CursorPtr,
-                    std::shared_ptr<stats::OperationStatisticsItem> find_stats);
+                    std::shared_ptr<stats::OperationStatisticsItem> find_stats,
+                    bool prefetch = false);
 
   bool IsValid() const override;
   bool HasMore() const override;
@@ -28,10 +31,24 @@ class CDriverCursorImpl final : public CursorImpl {
   void Next() override;
 
  private:
+  using Chunk = std::deque<formats::bson::Document>;
+
+  bool CursorHasMore() const;
+  void ReleaseIfExhausted();
+
+  // Reads the rest of the current batch and the first document of the next
+  // one. Must not be called concurrently with other cursor operations.
+  Chunk FetchChunk() const;
+
   std::optional<formats::bson::Document> current_;
+  Chunk buffered_;
   cdriver::CDriverPoolImpl::BoundClientPtr client_;
   cdriver::CursorPtr cursor_;
   const std::shared_ptr<stats::OperationStatisticsItem> find_stats_;
+  const bool prefetch_;
+
+  // Owns the cursor while running, must be destroyed before it
+  engine::TaskWithResult<Chunk> prefetch_task_;
 };
 
 }  // namespace storages::mongo::impl::cdriver
@@ -0,0 +1,26 @@
+#include <userver/storages/mongo/change_stream.hpp>
+
+#include <storages/mongo/change_stream_impl.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace storages::mongo {
+
+ChangeStream::ChangeStream(std::unique_ptr<impl::ChangeStreamImpl>&& impl)
+    : impl_(std::move(impl)) {}
+
+ChangeStream::~ChangeStream() = default;
+ChangeStream::ChangeStream(ChangeStream&&) noexcept = default;
+ChangeStream& ChangeStream::operator=(ChangeStream&&) noexcept = default;
+
+std::optional<formats::bson::Document> ChangeStream::Next() {
+  return impl_->Next();
+}
+
+formats::bson::Document ChangeStream::GetResumeToken() const {
+  return impl_->GetResumeToken();
+}
+
+}  // namespace storages::mongo
+
+USERVER_NAMESPACE_END
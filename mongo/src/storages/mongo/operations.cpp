@@ -3,6 +3,7 @@
 #include <mongoc/mongoc.h>
 
 #include <userver/formats/bson/bson_builder.hpp>
+#include <userver/formats/bson/inline.hpp>
 #include <userver/formats/bson/value_builder.hpp>
 #include <userver/storages/mongo/exception.hpp>
 #include <userver/utils/assert.hpp>
@@ -302,6 +303,8 @@ void Find::SetOption(options::Tailable) {
   }
 }
 
+void Find::SetOption(options::PrefetchBatches) { impl_->prefetch = true; }
+
 void Find::SetOption(const options::Comment& comment) {
   AppendComment(impl::EnsureBuilder(impl_->options), impl_->has_comment_option,
                 comment);
@@ -647,6 +650,53 @@ void Aggregate::SetOption(const options::MaxServerTime& max_server_time) {
   AppendMaxServerTime(impl_->max_server_time, max_server_time);
 }
 
+Watch::Watch(formats::bson::Value pipeline) : impl_(std::move(pipeline)) {
+  if (impl_->pipeline.IsMissing() || impl_->pipeline.IsNull()) {
+    impl_->pipeline = formats::bson::MakeArray();
+  }
+  if (!impl_->pipeline.IsArray()) {
+    throw InvalidQueryArgumentException(
+        "Change stream pipeline is not an array");
+  }
+}
+
+Watch::~Watch() = default;
+
+Watch::Watch(const Watch& other) = default;
+Watch::Watch(Watch&&) noexcept = default;
+Watch& Watch::operator=(const Watch& rhs) = default;
+Watch& Watch::operator=(Watch&&) noexcept = default;
+
+void Watch::SetOption(const options::ReadPreference& read_prefs) {
+  impl_->read_prefs = MakeCDriverReadPrefs(read_prefs);
+}
+
+void Watch::SetOption(options::ReadPreference::Mode mode) {
+  impl_->read_prefs = MakeCDriverReadPrefs(mode);
+}
+
+void Watch::SetOption(const options::ResumeAfter& resume_after) {
+  static const std::string kOptionName = "resumeAfter";
+  impl::EnsureBuilder(impl_->options)
+      .Append(kOptionName, resume_after.Value().GetBson().get());
+}
+
+void Watch::SetOption(options::FullDocumentLookup) {
+  static const std::string kOptionName = "fullDocument";
+  impl::EnsureBuilder(impl_->options).Append(kOptionName, "updateLookup");
+}
+
+void Watch::SetOption(options::FullDocumentBeforeChange) {
+  static const std::string kOptionName = "fullDocumentBeforeChange";
+  impl::EnsureBuilder(impl_->options).Append(kOptionName, "whenAvailable");
+}
+
+void Watch::SetOption(const options::MaxAwaitTime& max_await_time) {
+  static const std::string kOptionName = "maxAwaitTimeMS";
+  AppendUint64Option(impl::EnsureBuilder(impl_->options), kOptionName,
+                     max_await_time.Value().count());
+}
+
 Drop::Drop() = default;
 Drop::~Drop() = default;
 
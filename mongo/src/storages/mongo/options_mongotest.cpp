@@ -1,6 +1,7 @@
 #include <algorithm>
 #include <chrono>
 #include <string>
+#include <vector>
 
 #include <storages/mongo/dynamic_config.hpp>
 #include <storages/mongo/util_mongotest.hpp>
@@ -627,6 +628,33 @@ UTEST_F(Options, Tailable) {
   UEXPECT_NO_THROW(coll.FindOne({}, mongo::options::Tailable{}));
 }
 
+UTEST_F(Options, PrefetchBatches) {
+  auto coll = GetDefaultPool().GetCollection("prefetch_batches");
+
+  // More than the default first batch of 101 documents
+  constexpr int kDocsCount = 1000;
+  std::vector<bson::Document> docs;
+  docs.reserve(kDocsCount);
+  for (int i = 0; i < kDocsCount; ++i) docs.push_back(bson::MakeDoc("_id", i));
+  coll.InsertMany(std::move(docs));
+
+  std::vector<bson::Document> found;
+  for (const auto& doc : coll.Find(
+           {}, mongo::options::Sort{{"_id", mongo::options::Sort::kAscending}},
+           mongo::options::PrefetchBatches{})) {
+    found.push_back(doc);
+  }
+
+  ASSERT_EQ(kDocsCount, static_cast<int>(found.size()));
+  for (int i = 0; i < kDocsCount; ++i) {
+    EXPECT_EQ(i, found[i]["_id"].As<int>());
+  }
+
+  auto cursor = coll.Find(bson::MakeDoc("_id", bson::MakeDoc("$lt", 0)),
+                          mongo::options::PrefetchBatches{});
+  EXPECT_FALSE(cursor);
+}
+
 UTEST_F(Options, Comment) {
   auto coll = GetDefaultPool().GetCollection("comment");
 
@@ -0,0 +1,148 @@
+#include <userver/storages/mongo/write_coalescer.hpp>
+
+#include <exception>
+#include <mutex>
+#include <optional>
+
+#include <userver/engine/condition_variable.hpp>
+#include <userver/engine/mutex.hpp>
+#include <userver/formats/bson/inline.hpp>
+#include <userver/storages/mongo/bulk.hpp>
+#include <userver/storages/mongo/exception.hpp>
+#include <userver/utils/assert.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace storages::mongo {
+namespace {
+
+enum class WriteKind { kInsert, kUpdate };
+
+struct Batch final {
+  operations::Bulk bulk{operations::Bulk::Mode::kUnordered};
+  std::size_t size{0};
+
+  bool is_done{false};
+  std::optional<WriteResult> result;
+  std::exception_ptr exception;
+};
+
+// Extracts the result of a single write from the result of its batch
+WriteResult MakeWriteResult(const WriteResult& batch_result, std::size_t index,
+                            WriteKind kind) {
+  namespace bson = formats::bson;
+
+  const auto wc_errors = batch_result.WriteConcernErrors();
+  if (!wc_errors.empty()) {
+    wc_errors.front().Throw("Error running coalesced write");
+  }
+
+  auto errors = batch_result.ServerErrors();
+  if (const auto it = errors.find(index); it != errors.end()) {
+    it->second.Throw(kind == WriteKind::kInsert ? "Error inserting document"
+                                                : "Error updating document");
+  }
+
+  if (kind == WriteKind::kInsert) {
+    return WriteResult(bson::MakeDoc("nInserted", 1));
+  }
+  auto upserted_ids = batch_result.UpsertedIds();
+  if (const auto it = upserted_ids.find(index); it != upserted_ids.end()) {
+    return WriteResult(bson::MakeDoc(
+        "nUpserted", 1, "upserted",
+        bson::MakeArray(bson::MakeDoc("index", 0, "_id", it->second))));
+  }
+  return WriteResult{};
+}
+
+}  // namespace
+
+class WriteCoalescer::Impl final {
+ public:
+  Impl(Collection collection, WriteCoalescerSettings settings)
+      : collection_(std::move(collection)), settings_(settings) {
+    UINVARIANT(settings_.max_batch_size > 0,
+               "max_batch_size must be positive");
+  }
+
+  template <typename Subop>
+  WriteResult Execute(const Subop& subop, WriteKind kind);
+
+ private:
+  void Flush(Batch& batch);
+
+  Collection collection_;
+  const WriteCoalescerSettings settings_;
+
+  engine::Mutex mutex_;
+  engine::ConditionVariable cv_;
+  std::shared_ptr<Batch> current_;
+};
+
+template <typename Subop>
+WriteResult WriteCoalescer::Impl::Execute(const Subop& subop, WriteKind kind) {
+  std::unique_lock lock(mutex_);
+  const bool is_leader = !current_;
+  if (is_leader) {
+    current_ = std::make_shared<Batch>();
+    current_->bulk.SetOption(options::SuppressServerExceptions{});
+  }
+  const auto batch = current_;
+  const auto index = batch->size++;
+  batch->bulk.Append(subop);
+  if (batch->size >= settings_.max_batch_size) {
+    // No more writes for this batch, wake its leader up
+    current_.reset();
+    cv_.NotifyAll();
+  }
+
+  if (is_leader) {
+    // Cancellation only makes the batch go earlier
+    [[maybe_unused]] const bool is_full = cv_.WaitFor(
+        lock, settings_.max_delay, [&] { return current_ != batch; });
+    if (current_ == batch) current_.reset();
+
+    lock.unlock();
+    Flush(*batch);
+    lock.lock();
+    batch->is_done = true;
+    cv_.NotifyAll();
+  } else if (!cv_.Wait(lock, [&] { return batch->is_done; })) {
+    throw CancelledException("Coalesced write was cancelled while waiting");
+  }
+  lock.unlock();
+
+  if (batch->exception) std::rethrow_exception(batch->exception);
+  UASSERT(batch->result);
+  return MakeWriteResult(*batch->result, index, kind);
+}
+
+void WriteCoalescer::Impl::Flush(Batch& batch) {
+  try {
+    batch.result = collection_.Execute(std::move(batch.bulk));
+  } catch (const std::exception&) {
+    batch.exception = std::current_exception();
+  }
+}
+
+WriteCoalescer::WriteCoalescer(Collection collection,
+                               WriteCoalescerSettings settings)
+    : impl_(std::make_unique<Impl>(std::move(collection), settings)) {}
+
+WriteCoalescer::~WriteCoalescer() = default;
+
+WriteResult WriteCoalescer::InsertOne(formats::bson::Document document) {
+  return Execute(bulk_ops::InsertOne(std::move(document)));
+}
+
+WriteResult WriteCoalescer::Execute(const bulk_ops::InsertOne& subop) {
+  return impl_->Execute(subop, WriteKind::kInsert);
+}
+
+WriteResult WriteCoalescer::Execute(const bulk_ops::Update& subop) {
+  return impl_->Execute(subop, WriteKind::kUpdate);
+}
+
+}  // namespace storages::mongo
+
+USERVER_NAMESPACE_END
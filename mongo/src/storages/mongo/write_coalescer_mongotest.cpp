@@ -0,0 +1,71 @@
+#include <userver/utest/utest.hpp>
+
+#include <vector>
+
+#include <storages/mongo/util_mongotest.hpp>
+#include <userver/engine/async.hpp>
+#include <userver/engine/task/task_with_result.hpp>
+#include <userver/formats/bson.hpp>
+#include <userver/storages/mongo.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace bson = formats::bson;
+namespace mongo = storages::mongo;
+
+namespace {
+class WriteCoalescer : public MongoPoolFixture {};
+}  // namespace
+
+UTEST_F_MT(WriteCoalescer, InsertOne, 4) {
+  auto coll = GetDefaultPool().GetCollection("coalesced_insert_one");
+  mongo::WriteCoalescer coalescer(coll, {std::chrono::milliseconds{50}, 100});
+
+  constexpr int kWritesCount = 20;
+  std::vector<engine::TaskWithResult<mongo::WriteResult>> tasks;
+  for (int i = 0; i < kWritesCount; ++i) {
+    tasks.push_back(engine::AsyncNoSpan([&coalescer, i] {
+      return coalescer.InsertOne(bson::MakeDoc("_id", i));
+    }));
+  }
+  for (auto& task : tasks) {
+    auto result = task.Get();
+    EXPECT_EQ(1, result.InsertedCount());
+    EXPECT_TRUE(result.ServerErrors().empty());
+  }
+  EXPECT_EQ(kWritesCount, coll.Count({}));
+
+  // Only the duplicate fails, the other writes of its batch are applied
+  auto duplicate = engine::AsyncNoSpan(
+      [&coalescer] { return coalescer.InsertOne(bson::MakeDoc("_id", 0)); });
+  auto unique = engine::AsyncNoSpan([&coalescer] {
+    return coalescer.InsertOne(bson::MakeDoc("_id", kWritesCount));
+  });
+  UEXPECT_THROW(duplicate.Get(), mongo::DuplicateKeyException);
+  EXPECT_EQ(1, unique.Get().InsertedCount());
+  EXPECT_EQ(kWritesCount + 1, coll.Count({}));
+}
+
+UTEST_F(WriteCoalescer, UpdateOne) {
+  auto coll = GetDefaultPool().GetCollection("coalesced_update_one");
+  mongo::WriteCoalescer coalescer(coll);
+
+  coll.InsertOne(bson::MakeDoc("_id", 1, "x", 1));
+
+  auto result = coalescer.UpdateOne(
+      bson::MakeDoc("_id", 1), bson::MakeDoc("$set", bson::MakeDoc("x", 2)));
+  EXPECT_TRUE(result.UpsertedIds().empty());
+  auto doc = coll.FindOne(bson::MakeDoc("_id", 1));
+  ASSERT_TRUE(doc);
+  EXPECT_EQ(2, (*doc)["x"].As<int>());
+
+  result = coalescer.UpdateOne(bson::MakeDoc("_id", 2),
+                               bson::MakeDoc("$set", bson::MakeDoc("x", 3)),
+                               mongo::options::Upsert{});
+  EXPECT_EQ(1, result.UpsertedCount());
+  auto upserted_ids = result.UpsertedIds();
+  ASSERT_EQ(1, upserted_ids.size());
+  EXPECT_EQ(2, upserted_ids[0].As<int>());
+}
+
+USERVER_NAMESPACE_END
@@ -2,6 +2,9 @@
 
 /// @file userver/storages/mysql/cursor_result_set.hpp
 
+#include <userver/engine/task/task_with_result.hpp>
+#include <userver/utils/async.hpp>
+
 #include <userver/storages/mysql/statement_result_set.hpp>
 
 USERVER_NAMESPACE_BEGIN
@@ -26,6 +29,10 @@ class CursorResultSet final {
   ///
   /// Usable when the result set is expected to be big enough to put too
   /// much memory pressure if fetched as a whole.
+  ///
+  /// The next batch is fetched in background while row_callback is executed
+  /// for the rows of the current one, so at most two batches are kept in
+  /// memory at once.
   // TODO : deadline?
   template <typename RowCallback>
   void ForEach(RowCallback&& row_callback, engine::Deadline deadline) &&;
@@ -53,18 +60,38 @@ void CursorResultSet<T>::ForEach(
     [[maybe_unused]] engine::Deadline deadline) && {
   using IntermediateStorage = std::vector<T>;
 
-  bool keep_going = true;
   auto extractor = impl::io::TypedExtractor<IntermediateStorage, T, RowTag>{};
 
-  while (keep_going) {
-    tracing::ScopeTime fetch{impl::tracing::kFetchScope};
-    keep_going = result_set_.FetchResult(extractor);
+  tracing::ScopeTime fetch{impl::tracing::kFetchScope};
+  bool keep_going = result_set_.FetchResult(extractor);
+  IntermediateStorage data{extractor.ExtractData()};
+
+  while (true) {
+    // The extractor is only touched by the prefetch task until it is joined,
+    // the rows of the current batch are already moved out of it.
+    engine::TaskWithResult<bool> prefetch;
+    if (keep_going) {
+      prefetch = utils::Async(impl::tracing::kFetchScope, [this, &extractor] {
+        return result_set_.FetchResult(extractor);
+      });
+    }
 
     fetch.Reset(impl::tracing::kForEachScope);
-    IntermediateStorage data{extractor.ExtractData()};
-    for (auto&& row : data) {
-      row_callback(std::move(row));
+    try {
+      for (auto&& row : data) {
+        row_callback(std::move(row));
+      }
+    } catch (const std::exception&) {
+      // Cancelling the fetch in the middle of I/O would break the connection
+      if (prefetch.IsValid()) prefetch.Wait();
+      throw;
     }
+
+    if (!prefetch.IsValid()) break;
+
+    fetch.Reset(impl::tracing::kFetchScope);
+    keep_going = prefetch.Get();
+    data = extractor.ExtractData();
   }
 }
 
@@ -82,6 +82,37 @@ UTEST(Cursor, StatementReuseWorks) {
   EXPECT_EQ(db_rows, rows_to_insert);
 }
 
+UTEST(Cursor, ThrowingCallbackKeepsConnectionUsable) {
+  ClusterWrapper cluster{};
+  TmpTable table{cluster, "Id INT NOT NULL, Value TEXT NOT NULL"};
+
+  constexpr std::size_t rows_count = 10;
+  for (std::size_t i = 0; i < rows_count; ++i) {
+    cluster->ExecuteDecompose(
+        ClusterHostType::kPrimary,
+        table.FormatWithTableName("INSERT INTO {}(Id, Value) VALUES(?, ?)"),
+        Row{static_cast<std::int32_t>(i), utils::generators::GenerateUuid()});
+  }
+
+  std::size_t rows_seen = 0;
+  EXPECT_THROW(
+      cluster
+          ->GetCursor<Row>(
+              ClusterHostType::kPrimary, 2,
+              table.FormatWithTableName("SELECT Id, Value FROM {}"))
+          .ForEach(
+              [&rows_seen](Row&&) {
+                if (++rows_seen == 3) throw std::runtime_error{"oops"};
+              },
+              cluster.GetDeadline()),
+      std::runtime_error);
+  EXPECT_EQ(rows_seen, 3);
+
+  const auto db_rows =
+      table.DefaultExecute("SELECT Id, Value FROM {}").AsVector<Row>();
+  EXPECT_EQ(db_rows.size(), rows_count);
+}
+
 }  // namespace storages::mysql::tests
 
 USERVER_NAMESPACE_END
@@ -7,9 +7,12 @@
 
 #include <chrono>
 #include <map>
+#include <memory>
+#include <optional>
 #include <string_view>
 #include <type_traits>
 #include <unordered_map>
+#include <vector>
 
 #include <fmt/format.h>
 
@@ -21,15 +24,19 @@
 #include <userver/storages/postgres/cluster.hpp>
 #include <userver/storages/postgres/component.hpp>
 #include <userver/storages/postgres/io/chrono.hpp>
+#include <userver/storages/postgres/replication.hpp>
 
 #include <userver/compiler/demangle.hpp>
+#include <userver/engine/task/task_with_result.hpp>
 #include <userver/logging/log.hpp>
 #include <userver/tracing/span.hpp>
 #include <userver/utils/assert.hpp>
+#include <userver/utils/async.hpp>
 #include <userver/utils/cpu_relax.hpp>
 #include <userver/utils/meta.hpp>
 #include <userver/utils/void_t.hpp>
 #include <userver/yaml_config/merge_schemas.hpp>
+#include <userver/yaml_config/yaml_config.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
@@ -66,6 +73,11 @@ namespace components {
 /// incremental-update-op-timeout | timeout for an incremental update | 1s
 /// update-correction | incremental update window adjustment | - (0 for caches with defined GetLastKnownUpdated)
 /// chunk-size | number of rows to request from PostgreSQL via portals, 0 to fetch all rows in one request without portals | 1000
+/// full-update-partitions | number of partitions to read in parallel on a full update, requires `kFullUpdatePartitionKey` in the cache policy | 1
+/// cdc.publication | name of the publication to receive the changes of the table from, enables the @ref pg_cc_cdc "CDC mode" | -
+/// cdc.table | the table of the cache as `schema.name` or `name`, the changes of the other tables of the publication are ignored | - (all the tables of the publication)
+/// cdc.batch-max-size | maximum number of the changes applied to the cache at once | 1000
+/// cdc.batch-interval | time to wait for more changes before applying them to the cache | 100ms
 ///
 /// @section pg_cc_cache_policy Cache policy
 ///
@@ -97,6 +109,58 @@ namespace components {
 ///
 /// @snippet cache/postgres_cache_test.cpp Pg Cache Policy Custom Container With Write Notification Example
 ///
+/// @section pg_cc_parallel_full_update Parallel full updates
+///
+/// Full updates of the big tables may be split into partitions that are read
+/// and parsed in parallel, each by its own transaction on its own connection.
+/// The partial results are merged into the cache container afterwards.
+/// The partitions are set in the policy either by an integer column
+/// `kFullUpdatePartitionKey`, then the rows are split by the remainder of its
+/// division by the `full-update-partitions` static option, or by a static
+/// member function `GetFullUpdatePartitions` that returns the conditions for
+/// the `where` clause of the partitions. The conditions must not intersect and
+/// must cover all the rows. Incremental updates are not partitioned.
+///
+/// @snippet cache/postgres_cache_test.cpp Pg Cache Policy Partitions Example
+///
+/// For std::unordered_map and std::map containers the partitions are parsed
+/// into the containers of the same type and merged without copying the values,
+/// for the other containers the values are inserted after the parsing.
+///
+/// @section pg_cc_cdc Updates from a logical replication slot
+///
+/// Instead of polling the table with incremental updates, the cache may
+/// receive the row changes from a logical replication slot, including the
+/// deletes, and apply them in small batches as soon as they are committed.
+/// The mode is enabled by the `cdc.publication` static option, `kUpdatedField`
+/// may be empty then.
+///
+/// On a full update a temporary `pgoutput` replication slot is created over
+/// a dedicated replication connection to the master host, the full update
+/// query is run in the snapshot of the slot, and then a background task
+/// receives the changes committed after the snapshot, decodes them with the
+/// same parsers as the query results and updates the cache. Incremental
+/// updates do not query the database, they only check that the task is
+/// running and do a full update otherwise, e.g. after a connection failure.
+///
+/// Requirements and limitations:
+/// * PostgreSQL 14+, `wal_level = logical`, the user must have the
+///   REPLICATION attribute, a publication of the table must exist:
+///   `CREATE PUBLICATION my_cache_publication FOR TABLE my_table`;
+/// * a single shard;
+/// * the columns of the query must be the columns of the table with the same
+///   names, without casts or expressions;
+/// * `kWhere` is not applied to the changes, use a row filter of the
+///   publication (PostgreSQL 15+) with the same condition;
+/// * deletes are applied by the key of the replica identity of the table,
+///   the cache key must be computed from those columns only. Tables with
+///   TOASTed columns should have `REPLICA IDENTITY FULL`, otherwise
+///   an update that does not change such a column fails to apply and causes
+///   a full update;
+/// * the cache container must support `erase` by the key;
+/// * the full updates are not partitioned, and every full update creates a new
+///   replication slot, so `full-update-interval` should be large.
+///
 /// @section pg_cc_forward_declaration Forward Declaration
 ///
 /// To forward declare a cache you can forward declare a trait and
@@ -161,6 +225,19 @@ using HasWhere = decltype(T::kWhere);
 template <typename T>
 inline constexpr bool kHasWhere = meta::kIsDetected<HasWhere, T>;
 
+// Full update partitions
+template <typename T>
+using HasFullUpdatePartitionKey = decltype(T::kFullUpdatePartitionKey);
+template <typename T>
+inline constexpr bool kHasFullUpdatePartitionKey =
+    meta::kIsDetected<HasFullUpdatePartitionKey, T>;
+
+template <typename T>
+using HasGetFullUpdatePartitions = decltype(T::GetFullUpdatePartitions());
+template <typename T>
+inline constexpr bool kHasGetFullUpdatePartitions =
+    meta::kIsDetected<HasGetFullUpdatePartitions, T>;
+
 // Update field
 template <typename T>
 using HasUpdatedField = decltype(T::kUpdatedField);
@@ -229,6 +306,13 @@ std::unique_ptr<T> CopyContainer(
   }
 }
 
+// Values of a partition of the full update, the containers that can not be
+// merged by nodes are filled after the parsing
+template <typename T>
+using PartitionDataType =
+    std::conditional_t<kIsContainerCopiedByElement<DataCacheContainerType<T>>,
+                       DataCacheContainerType<T>, std::vector<ValueType<T>>>;
+
 template <typename Container, typename Value, typename KeyMember,
           typename... Args>
 void CacheInsertOrAssign(Container& container, Value&& value,
@@ -339,6 +423,11 @@ struct PolicyChecker {
       "`kUpdatedField`. If you don't want to use incremental updates, "
       "please set its value to `nullptr`");
   static_assert(CheckUpdatedFieldType<PostgreCachePolicy>());
+  static_assert(!(kHasFullUpdatePartitionKey<PostgreCachePolicy> &&
+                  kHasGetFullUpdatePartitions<PostgreCachePolicy>),
+                "The PosgreSQL cache policy must define "
+                "`kFullUpdatePartitionKey` or `GetFullUpdatePartitions`, "
+                "not both");
 
   static_assert(ClusterHostType<PostgreCachePolicy>() &
                     storages::postgres::kClusterHostRolesMask,
@@ -366,8 +455,73 @@ inline constexpr std::chrono::milliseconds kCpuRelaxInterval{2};
 inline constexpr std::string_view kCopyStage = "copy_data";
 inline constexpr std::string_view kFetchStage = "fetch";
 inline constexpr std::string_view kParseStage = "parse";
+inline constexpr std::string_view kFetchPartitionsStage = "fetch_partitions";
+inline constexpr std::string_view kMergeStage = "merge";
 
 inline constexpr std::size_t kDefaultChunkSize = 1000;
+
+// Change data capture from a logical replication slot
+inline constexpr std::size_t kDefaultCdcBatchMaxSize = 1000;
+inline constexpr std::chrono::milliseconds kDefaultCdcBatchInterval{100};
+inline constexpr std::chrono::seconds kCdcWaitInterval{1};
+
+struct CdcSettings {
+  std::string publication;
+  std::string table;
+  std::size_t batch_max_size{kDefaultCdcBatchMaxSize};
+  std::chrono::milliseconds batch_interval{kDefaultCdcBatchInterval};
+};
+
+std::optional<CdcSettings> ParseCdcSettings(
+    const yaml_config::YamlConfig& config);
+
+// Unique among the instances of the service, the slot names are per database
+std::string MakeCdcSlotName(std::string_view cache_name);
+
+std::vector<std::string> GetColumnNames(
+    const storages::postgres::ResultSet& res);
+
+// Indices of the query columns in the tables of the replication stream
+class CdcColumns final {
+ public:
+  CdcColumns(const CdcSettings& settings, std::vector<std::string> columns);
+
+  // Returns nullptr if the changes of the table are not cached
+  const std::vector<std::size_t>* Find(
+      const std::shared_ptr<const storages::postgres::ReplicationRelation>&
+          relation);
+
+ private:
+  struct Mapping {
+    std::shared_ptr<const storages::postgres::ReplicationRelation> relation;
+    std::optional<std::vector<std::size_t>> indices;
+  };
+
+  const CdcSettings& settings_;
+  const std::vector<std::string> columns_;
+  std::unordered_map<storages::postgres::Oid, Mapping> mappings_;
+};
+
+template <typename Row, std::size_t... I>
+void ReadCdcRow(const storages::postgres::ReplicationTuple& tuple,
+                const std::vector<std::size_t>& columns,
+                const storages::postgres::io::TypeBufferCategory& categories,
+                bool skip_nulls, Row& row, std::index_sequence<I...>) {
+  auto&& members = storages::postgres::io::RowType<Row>::GetTuple(row);
+  const auto read = [&](std::size_t column, auto& member) {
+    // The columns out of the replica identity are null in the old rows
+    if (skip_nulls && tuple.IsNull(column)) return;
+    tuple.ReadColumn(column, member, categories);
+  };
+  (read(columns[I], std::get<I>(members)), ...);
+}
+
+template <typename T>
+using HasCdcEraseImpl = decltype(std::declval<DataCacheContainerType<T>&>()
+                                     .erase(std::declval<KeyMemberType<T>>()));
+template <typename T>
+inline constexpr bool kHasCdcErase = meta::kIsDetected<HasCdcEraseImpl, T>;
+
 }  // namespace pg_cache::detail
 
 /// @ingroup userver_components
@@ -415,24 +569,56 @@ class PostgreCache final
 
   bool MayReturnNull() const override;
 
+  using PartitionData = pg_cache::detail::PartitionDataType<PolicyType>;
+
   CachedData GetDataSnapshot(cache::UpdateType type, tracing::ScopeTime& scope);
-  void CacheResults(storages::postgres::ResultSet res, CachedData& data_cache,
+
+  template <typename Container>
+  void CacheResults(storages::postgres::ResultSet res, Container& container,
                     cache::UpdateStatisticsScope& stats_scope,
-                    tracing::ScopeTime& scope);
+                    tracing::ScopeTime* scope);
+
+  std::size_t FetchPartitions(const std::vector<std::string>& partitions,
+                              std::chrono::milliseconds timeout,
+                              DataType& data_cache,
+                              cache::UpdateStatisticsScope& stats_scope,
+                              tracing::ScopeTime& scope);
+
+  std::vector<std::string> GetFullUpdatePartitions() const;
+
+  void UpdateCdc(cache::UpdateType type,
+                 cache::UpdateStatisticsScope& stats_scope);
+  void RunCdc(storages::postgres::ReplicationStream& stream,
+              std::vector<std::string> columns);
+  void ApplyCdcBatch(
+      const std::vector<storages::postgres::ReplicationTransaction>& batch,
+      pg_cache::detail::CdcColumns& columns,
+      const storages::postgres::io::TypeBufferCategory& categories);
+  RawValueType ReadCdcRow(
+      const storages::postgres::ReplicationTuple& tuple,
+      const std::vector<std::size_t>& columns,
+      const storages::postgres::io::TypeBufferCategory& categories,
+      bool skip_nulls) const;
+  void StopCdc() noexcept;
 
   static storages::postgres::Query GetAllQuery();
   static storages::postgres::Query GetDeltaQuery();
+  static storages::postgres::Query GetPartitionQuery(
+      const std::string& condition);
 
   std::chrono::milliseconds ParseCorrection(const ComponentConfig& config);
 
   std::vector<storages::postgres::ClusterPtr> clusters_;
 
+  const std::optional<pg_cache::detail::CdcSettings> cdc_;
   const std::chrono::system_clock::duration correction_;
   const std::chrono::milliseconds full_update_timeout_;
   const std::chrono::milliseconds incremental_update_timeout_;
   const std::size_t chunk_size_;
+  const std::size_t full_update_partitions_;
   std::size_t cpu_relax_iterations_parse_{0};
   std::size_t cpu_relax_iterations_copy_{0};
+  engine::TaskWithResult<void> cdc_task_;
 };
 
 template <typename PostgreCachePolicy>
@@ -442,6 +628,7 @@ template <typename PostgreCachePolicy>
 PostgreCache<PostgreCachePolicy>::PostgreCache(const ComponentConfig& config,
                                                const ComponentContext& context)
     : BaseType{config, context},
+      cdc_{pg_cache::detail::ParseCdcSettings(config)},
       correction_{ParseCorrection(config)},
       full_update_timeout_{
           config["full-update-op-timeout"].As<std::chrono::milliseconds>(
@@ -450,7 +637,8 @@ PostgreCache<PostgreCachePolicy>::PostgreCache(const ComponentConfig& config,
           config["incremental-update-op-timeout"].As<std::chrono::milliseconds>(
               pg_cache::detail::kDefaultIncrementalUpdateTimeout)},
       chunk_size_{config["chunk-size"].As<size_t>(
-          pg_cache::detail::kDefaultChunkSize)} {
+          pg_cache::detail::kDefaultChunkSize)},
+      full_update_partitions_{config["full-update-partitions"].As<size_t>(1)} {
   UINVARIANT(
       !chunk_size_ || storages::postgres::Portal::IsSupportedByDriver(),
       "Either set 'chunk-size' to 0, or enable PostgreSQL portals by building "
@@ -458,12 +646,20 @@ PostgreCache<PostgreCachePolicy>::PostgreCache(const ComponentConfig& config,
 
   if (this->GetAllowedUpdateTypes() ==
           cache::AllowedUpdateTypes::kFullAndIncremental &&
-      !kIncrementalUpdates) {
+      !kIncrementalUpdates && !cdc_) {
     throw std::logic_error(
         "Incremental update support is requested in config but no update field "
         "name is specified in traits of '" +
         config.Name() + "' cache");
   }
+  if (full_update_partitions_ == 0 ||
+      (full_update_partitions_ > 1 &&
+       !pg_cache::detail::kHasFullUpdatePartitionKey<PostgreCachePolicy>)) {
+    throw std::logic_error(
+        "'full-update-partitions' must be positive and requires "
+        "`kFullUpdatePartitionKey` in traits of '" +
+        config.Name() + "' cache");
+  }
   if (correction_.count() < 0) {
     throw std::logic_error(
         "Refusing to set forward (negative) update correction requested in "
@@ -482,6 +678,15 @@ PostgreCache<PostgreCachePolicy>::PostgreCache(const ComponentConfig& config,
   for (size_t i = 0; i < shard_count; ++i) {
     clusters_[i] = pg_cluster_comp.GetClusterForShard(i);
   }
+  if (cdc_ && shard_count != 1) {
+    throw std::logic_error("'cdc' requires a single shard of '" + pg_alias +
+                           "' for '" + config.Name() + "' cache");
+  }
+  if (cdc_ && !pg_cache::detail::kHasCdcErase<PostgreCachePolicy>) {
+    throw std::logic_error(
+        "'cdc' requires a cache container with erase by the key for '" +
+        config.Name() + "' cache");
+  }
 
   LOG_INFO() << "Cache " << kName << " full update query `"
              << GetAllQuery().Statement() << "` incremental update query `"
@@ -493,6 +698,7 @@ PostgreCache<PostgreCachePolicy>::PostgreCache(const ComponentConfig& config,
 template <typename PostgreCachePolicy>
 PostgreCache<PostgreCachePolicy>::~PostgreCache() {
   this->StopPeriodicUpdates();
+  StopCdc();
 }
 
 template <typename PostgreCachePolicy>
@@ -527,11 +733,49 @@ storages::postgres::Query PostgreCache<PostgreCachePolicy>::GetDeltaQuery() {
   }
 }
 
+template <typename PostgreCachePolicy>
+storages::postgres::Query PostgreCache<PostgreCachePolicy>::GetPartitionQuery(
+    const std::string& condition) {
+  storages::postgres::Query query = PolicyCheckerType::GetQuery();
+  if constexpr (pg_cache::detail::kHasWhere<PostgreCachePolicy>) {
+    return {fmt::format("{} where ({}) and ({})", query.Statement(),
+                        PostgreCachePolicy::kWhere, condition),
+            query.GetName()};
+  } else {
+    return {fmt::format("{} where {}", query.Statement(), condition),
+            query.GetName()};
+  }
+}
+
+template <typename PostgreCachePolicy>
+std::vector<std::string>
+PostgreCache<PostgreCachePolicy>::GetFullUpdatePartitions() const {
+  if constexpr (pg_cache::detail::kHasGetFullUpdatePartitions<
+                    PostgreCachePolicy>) {
+    return PostgreCachePolicy::GetFullUpdatePartitions();
+  } else if constexpr (pg_cache::detail::kHasFullUpdatePartitionKey<
+                           PostgreCachePolicy>) {
+    std::vector<std::string> partitions;
+    if (full_update_partitions_ <= 1) return partitions;
+
+    partitions.reserve(full_update_partitions_);
+    for (std::size_t i = 0; i < full_update_partitions_; ++i) {
+      partitions.push_back(
+          fmt::format("abs({} % {}) = {}",
+                      PostgreCachePolicy::kFullUpdatePartitionKey,
+                      full_update_partitions_, i));
+    }
+    return partitions;
+  } else {
+    return {};
+  }
+}
+
 template <typename PostgreCachePolicy>
 std::chrono::milliseconds PostgreCache<PostgreCachePolicy>::ParseCorrection(
     const ComponentConfig& config) {
   static constexpr std::string_view kUpdateCorrection = "update-correction";
-  if (pg_cache::detail::kHasCustomUpdated<PostgreCachePolicy> ||
+  if (pg_cache::detail::kHasCustomUpdated<PostgreCachePolicy> || cdc_ ||
       this->GetAllowedUpdateTypes() == cache::AllowedUpdateTypes::kOnlyFull) {
     return config[kUpdateCorrection].As<std::chrono::milliseconds>(0);
   } else {
@@ -558,6 +802,10 @@ void PostgreCache<PostgreCachePolicy>::Update(
     const std::chrono::system_clock::time_point& /*now*/,
     cache::UpdateStatisticsScope& stats_scope) {
   namespace pg = storages::postgres;
+  if (cdc_) {
+    UpdateCdc(type, stats_scope);
+    return;
+  }
   if constexpr (!kIncrementalUpdates) {
     type = cache::UpdateType::kFull;
   }
@@ -576,42 +824,45 @@ void PostgreCache<PostgreCachePolicy>::Update(
   scope.Reset(std::string{pg_cache::detail::kFetchStage});
 
   size_t changes = 0;
-  // Iterate clusters
-  for (auto& cluster : clusters_) {
-    if (chunk_size_ > 0) {
-      auto trx = cluster->Begin(
-          kClusterHostTypeFlags, pg::Transaction::RO,
-          pg::CommandControl{timeout, pg_cache::detail::kStatementTimeoutOff});
-      auto portal =
-          trx.MakePortal(query, GetLastUpdated(last_update, *data_cache));
-      while (portal) {
-        scope.Reset(std::string{pg_cache::detail::kFetchStage});
-        auto res = portal.Fetch(chunk_size_);
+  const auto partitions = (type == cache::UpdateType::kFull)
+                              ? GetFullUpdatePartitions()
+                              : std::vector<std::string>{};
+  if (partitions.size() > 1) {
+    changes = FetchPartitions(partitions, timeout, *data_cache, stats_scope,
+                              scope);
+  } else {
+    const pg::CommandControl cc{timeout,
+                                pg_cache::detail::kStatementTimeoutOff};
+    // Iterate clusters
+    for (auto& cluster : clusters_) {
+      if (chunk_size_ > 0) {
+        auto trx =
+            cluster->Begin(kClusterHostTypeFlags, pg::Transaction::RO, cc);
+        auto portal =
+            trx.MakePortal(query, GetLastUpdated(last_update, *data_cache));
+        while (portal) {
+          scope.Reset(std::string{pg_cache::detail::kFetchStage});
+          auto res = portal.Fetch(chunk_size_);
+          stats_scope.IncreaseDocumentsReadCount(res.Size());
+
+          scope.Reset(std::string{pg_cache::detail::kParseStage});
+          CacheResults(res, *data_cache, stats_scope, &scope);
+          changes += res.Size();
+        }
+        trx.Commit();
+      } else {
+        bool has_parameter = query.Statement().find('$') != std::string::npos;
+        auto res =
+            has_parameter
+                ? cluster->Execute(kClusterHostTypeFlags, cc, query,
+                                   GetLastUpdated(last_update, *data_cache))
+                : cluster->Execute(kClusterHostTypeFlags, cc, query);
         stats_scope.IncreaseDocumentsReadCount(res.Size());
 
         scope.Reset(std::string{pg_cache::detail::kParseStage});
-        CacheResults(res, data_cache, stats_scope, scope);
+        CacheResults(res, *data_cache, stats_scope, &scope);
         changes += res.Size();
       }
-      trx.Commit();
-    } else {
-      bool has_parameter = query.Statement().find('$') != std::string::npos;
-      auto res = has_parameter
-                     ? cluster->Execute(
-                           kClusterHostTypeFlags,
-                           pg::CommandControl{
-                               timeout, pg_cache::detail::kStatementTimeoutOff},
-                           query, GetLastUpdated(last_update, *data_cache))
-                     : cluster->Execute(
-                           kClusterHostTypeFlags,
-                           pg::CommandControl{
-                               timeout, pg_cache::detail::kStatementTimeoutOff},
-                           query);
-      stats_scope.IncreaseDocumentsReadCount(res.Size());
-
-      scope.Reset(std::string{pg_cache::detail::kParseStage});
-      CacheResults(res, data_cache, stats_scope, scope);
-      changes += res.Size();
     }
   }
 
@@ -656,24 +907,210 @@ void PostgreCache<PostgreCachePolicy>::Update(
   }
 }
 
+template <typename PostgreCachePolicy>
+void PostgreCache<PostgreCachePolicy>::UpdateCdc(
+    cache::UpdateType type, cache::UpdateStatisticsScope& stats_scope) {
+  namespace pg = storages::postgres;
+  if (type == cache::UpdateType::kIncremental && cdc_task_.IsValid() &&
+      !cdc_task_.IsFinished()) {
+    // The changes are applied by the replication task as they are committed
+    stats_scope.FinishNoChanges();
+    return;
+  }
+  StopCdc();
+
+  auto& cluster = clusters_.front();
+  auto stream = cluster->CreateReplicationStream(
+      {pg_cache::detail::MakeCdcSlotName(kName), {cdc_->publication}});
+
+  // The rows are read in the snapshot of the slot, so the changes from
+  // the stream apply right on top of them
+  const pg::CommandControl cc{full_update_timeout_,
+                              pg_cache::detail::kStatementTimeoutOff};
+  auto trx = cluster->Begin(
+      pg::ClusterHostType::kMaster,
+      pg::TransactionOptions{pg::IsolationLevel::kRepeatableRead,
+                             pg::TransactionOptions::kReadOnly},
+      cc);
+  trx.Execute(
+      fmt::format("set transaction snapshot '{}'", stream.GetSnapshotName()));
+
+  auto scope = tracing::Span::CurrentSpan().CreateScopeTime(
+      std::string{pg_cache::detail::kFetchStage});
+  auto data_cache = std::make_unique<DataType>();
+  std::vector<std::string> columns;
+  const auto cache_results = [&](pg::ResultSet res) {
+    stats_scope.IncreaseDocumentsReadCount(res.Size());
+    if (columns.empty()) columns = pg_cache::detail::GetColumnNames(res);
+    scope.Reset(std::string{pg_cache::detail::kParseStage});
+    CacheResults(std::move(res), *data_cache, stats_scope, &scope);
+  };
+  if (chunk_size_ > 0) {
+    auto portal = trx.MakePortal(GetAllQuery());
+    while (portal) {
+      scope.Reset(std::string{pg_cache::detail::kFetchStage});
+      cache_results(portal.Fetch(chunk_size_));
+    }
+  } else {
+    cache_results(trx.Execute(GetAllQuery()));
+  }
+  trx.Commit();
+  scope.Reset();
+
+  stats_scope.Finish(data_cache->size());
+  pg_cache::detail::OnWritesDone(*data_cache);
+  this->Set(std::move(data_cache));
+
+  stream.Start(engine::Deadline::FromDuration(full_update_timeout_));
+  cdc_task_ = utils::Async(
+      "pg_cache_cdc",
+      [this, stream = std::move(stream), columns = std::move(columns)]() mutable {
+        RunCdc(stream, std::move(columns));
+      });
+}
+
+template <typename PostgreCachePolicy>
+void PostgreCache<PostgreCachePolicy>::RunCdc(
+    storages::postgres::ReplicationStream& stream,
+    std::vector<std::string> columns) {
+  pg_cache::detail::CdcColumns cdc_columns{*cdc_, std::move(columns)};
+  try {
+    while (!engine::current_task::ShouldCancel()) {
+      std::vector<storages::postgres::ReplicationTransaction> batch;
+      std::size_t changes = 0;
+      auto deadline =
+          engine::Deadline::FromDuration(pg_cache::detail::kCdcWaitInterval);
+      while (changes < cdc_->batch_max_size) {
+        auto transaction = stream.WaitTransaction(deadline);
+        if (!transaction) break;
+        if (batch.empty()) {
+          deadline = engine::Deadline::FromDuration(cdc_->batch_interval);
+        }
+        changes += transaction->changes.size();
+        batch.push_back(std::move(*transaction));
+      }
+      if (batch.empty()) continue;
+
+      if (changes > 0) {
+        ApplyCdcBatch(batch, cdc_columns, stream.GetTypeBufferCategories());
+      }
+      stream.Confirm(batch.back().end_lsn);
+    }
+  } catch (const std::exception& e) {
+    if (engine::current_task::ShouldCancel()) return;
+    LOG_ERROR() << "Replication of the changes to cache '" << kName
+                << "' has failed, a full update is required: " << e;
+  }
+}
+
+template <typename PostgreCachePolicy>
+void PostgreCache<PostgreCachePolicy>::ApplyCdcBatch(
+    const std::vector<storages::postgres::ReplicationTransaction>& batch,
+    pg_cache::detail::CdcColumns& columns,
+    const storages::postgres::io::TypeBufferCategory& categories) {
+  using Type = storages::postgres::ReplicationChange::Type;
+
+  tracing::Span span{"pg_cache_cdc_apply"};
+  auto scope = span.CreateScopeTime(std::string{pg_cache::detail::kCopyStage});
+  auto data_cache = GetDataSnapshot(cache::UpdateType::kIncremental, scope);
+  scope.Reset(std::string{pg_cache::detail::kParseStage});
+
+  const auto erase = [&](const storages::postgres::ReplicationTuple& row,
+                         const std::vector<std::size_t>& indices) {
+    if constexpr (pg_cache::detail::kHasCdcErase<PostgreCachePolicy>) {
+      const auto value = pg_cache::detail::ExtractValue<PostgreCachePolicy>(
+          ReadCdcRow(row, indices, categories, true));
+      data_cache->erase(std::invoke(PostgreCachePolicy::kKeyMember, value));
+    }
+  };
+
+  std::size_t changes = 0;
+  for (const auto& transaction : batch) {
+    for (const auto& change : transaction.changes) {
+      const auto* indices = columns.Find(change.relation);
+      if (!indices) continue;
+      ++changes;
+      if (change.type == Type::kTruncate) {
+        data_cache = std::make_unique<DataType>();
+        continue;
+      }
+
+      try {
+        if (change.old_row) erase(*change.old_row, *indices);
+        if (change.type != Type::kDelete) {
+          using pg_cache::detail::CacheInsertOrAssign;
+          CacheInsertOrAssign(
+              *data_cache,
+              pg_cache::detail::ExtractValue<PostgreCachePolicy>(
+                  ReadCdcRow(change.new_row, *indices, categories, false)),
+              PostgreCachePolicy::kKeyMember);
+        }
+      } catch (const storages::postgres::ResultSetError& e) {
+        LOG_ERROR() << "Error parsing replicated row in cache '" << kName
+                    << "' to '" << compiler::GetTypeName<ValueType>()
+                    << "': " << e.what();
+      }
+    }
+  }
+  if (changes == 0) return;
+
+  scope.Reset();
+  pg_cache::detail::OnWritesDone(*data_cache);
+  LOG_DEBUG() << "Applied " << changes << " replicated changes to cache '"
+              << kName << "'";
+  this->Set(std::move(data_cache));
+}
+
+template <typename PostgreCachePolicy>
+typename PostgreCache<PostgreCachePolicy>::RawValueType
+PostgreCache<PostgreCachePolicy>::ReadCdcRow(
+    const storages::postgres::ReplicationTuple& tuple,
+    const std::vector<std::size_t>& columns,
+    const storages::postgres::io::TypeBufferCategory& categories,
+    bool skip_nulls) const {
+  using RowType = storages::postgres::io::RowType<RawValueType>;
+  if (columns.size() != RowType::size) {
+    throw storages::postgres::InvalidTupleSizeRequested(columns.size(),
+                                                        RowType::size);
+  }
+  RawValueType row{};
+  pg_cache::detail::ReadCdcRow(tuple, columns, categories, skip_nulls, row,
+                               typename RowType::IndexSequence{});
+  return row;
+}
+
+template <typename PostgreCachePolicy>
+void PostgreCache<PostgreCachePolicy>::StopCdc() noexcept {
+  if (!cdc_task_.IsValid()) return;
+  cdc_task_.SyncCancel();
+  cdc_task_ = {};
+}
+
 template <typename PostgreCachePolicy>
 bool PostgreCache<PostgreCachePolicy>::MayReturnNull() const {
   return pg_cache::detail::MayReturnNull<PolicyType>();
 }
 
 template <typename PostgreCachePolicy>
+template <typename Container>
 void PostgreCache<PostgreCachePolicy>::CacheResults(
-    storages::postgres::ResultSet res, CachedData& data_cache,
-    cache::UpdateStatisticsScope& stats_scope, tracing::ScopeTime& scope) {
+    storages::postgres::ResultSet res, Container& container,
+    cache::UpdateStatisticsScope& stats_scope, tracing::ScopeTime* scope) {
   auto values = res.AsSetOf<RawValueType>(storages::postgres::kRowTag);
-  utils::CpuRelax relax{cpu_relax_iterations_parse_, &scope};
+  utils::CpuRelax relax{cpu_relax_iterations_parse_, scope};
   for (auto p = values.begin(); p != values.end(); ++p) {
     relax.Relax();
     try {
-      using pg_cache::detail::CacheInsertOrAssign;
-      CacheInsertOrAssign(
-          *data_cache, pg_cache::detail::ExtractValue<PostgreCachePolicy>(*p),
-          PostgreCachePolicy::kKeyMember);
+      if constexpr (std::is_same_v<Container, PartitionData> &&
+                    !std::is_same_v<Container, DataType>) {
+        container.push_back(
+            pg_cache::detail::ExtractValue<PostgreCachePolicy>(*p));
+      } else {
+        using pg_cache::detail::CacheInsertOrAssign;
+        CacheInsertOrAssign(
+            container, pg_cache::detail::ExtractValue<PostgreCachePolicy>(*p),
+            PostgreCachePolicy::kKeyMember);
+      }
     } catch (const std::exception& e) {
       stats_scope.IncreaseDocumentsParseFailures(1);
       LOG_ERROR() << "Error parsing data row in cache '" << kName << "' to '"
@@ -682,6 +1119,67 @@ void PostgreCache<PostgreCachePolicy>::CacheResults(
   }
 }
 
+template <typename PostgreCachePolicy>
+std::size_t PostgreCache<PostgreCachePolicy>::FetchPartitions(
+    const std::vector<std::string>& partitions,
+    std::chrono::milliseconds timeout, DataType& data_cache,
+    cache::UpdateStatisticsScope& stats_scope, tracing::ScopeTime& scope) {
+  namespace pg = storages::postgres;
+  scope.Reset(std::string{pg_cache::detail::kFetchPartitionsStage});
+
+  std::vector<engine::TaskWithResult<PartitionData>> tasks;
+  tasks.reserve(clusters_.size() * partitions.size());
+  for (const auto& cluster : clusters_) {
+    for (const auto& partition : partitions) {
+      tasks.push_back(utils::Async(
+          "pg_cache_partition",
+          [this, &cluster, &stats_scope, timeout,
+           query = GetPartitionQuery(partition)] {
+            const pg::CommandControl cc{timeout,
+                                        pg_cache::detail::kStatementTimeoutOff};
+            PartitionData partition_data;
+            if (chunk_size_ > 0) {
+              auto trx = cluster->Begin(kClusterHostTypeFlags,
+                                        pg::Transaction::RO, cc);
+              auto portal = trx.MakePortal(query);
+              while (portal) {
+                auto res = portal.Fetch(chunk_size_);
+                stats_scope.IncreaseDocumentsReadCount(res.Size());
+                CacheResults(res, partition_data, stats_scope, nullptr);
+              }
+              trx.Commit();
+            } else {
+              auto res = cluster->Execute(kClusterHostTypeFlags, cc, query);
+              stats_scope.IncreaseDocumentsReadCount(res.Size());
+              CacheResults(res, partition_data, stats_scope, nullptr);
+            }
+            return partition_data;
+          }));
+    }
+  }
+
+  std::size_t changes = 0;
+  for (auto& task : tasks) {
+    auto partition_data = task.Get();
+    scope.Reset(std::string{pg_cache::detail::kMergeStage});
+    changes += partition_data.size();
+    if constexpr (std::is_same_v<PartitionData, DataType>) {
+      // Moves the nodes, the rows of different partitions do not intersect
+      data_cache.merge(partition_data);
+    } else {
+      utils::CpuRelax relax{cpu_relax_iterations_parse_, &scope};
+      for (auto& value : partition_data) {
+        relax.Relax();
+        using pg_cache::detail::CacheInsertOrAssign;
+        CacheInsertOrAssign(data_cache, std::move(value),
+                            PostgreCachePolicy::kKeyMember);
+      }
+    }
+    scope.Reset(std::string{pg_cache::detail::kFetchPartitionsStage});
+  }
+  return changes;
+}
+
 template <typename PostgreCachePolicy>
 typename PostgreCache<PostgreCachePolicy>::CachedData
 PostgreCache<PostgreCachePolicy>::GetDataSnapshot(cache::UpdateType type,
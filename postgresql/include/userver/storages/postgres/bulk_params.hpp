@@ -0,0 +1,138 @@
+#pragma once
+
+/// @file userver/storages/postgres/bulk_params.hpp
+/// @brief @copybrief storages::postgres::BulkParams
+
+#include <array>
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+#include <userver/storages/postgres/io/field_buffer.hpp>
+#include <userver/storages/postgres/io/type_mapping.hpp>
+#include <userver/storages/postgres/io/type_traits.hpp>
+#include <userver/storages/postgres/parameter_store.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace storages::postgres {
+
+/// @ingroup userver_containers
+///
+/// @brief Builder of the array parameters for the bulk statements.
+///
+/// Each column of the rows becomes a one-dimensional array parameter, so that
+/// a batch of rows is passed to a single `UNNEST($1, $2, ...)` or
+/// `= ANY($1)` statement. The values are formatted straight into the binary
+/// arrays as the rows are added, there are no intermediate containers of the
+/// columns.
+///
+/// @snippet storages/postgres/tests/bulk_params_pgtest.cpp BulkParams
+///
+/// @note Currently only built-in/system types are supported, as with
+/// ParameterStore. The columns may be nullable.
+template <typename... Columns>
+class BulkParams final {
+  static_assert(sizeof...(Columns) > 0, "At least one column is required");
+  static_assert(
+      (io::IsTypeMappedToSystem<Columns>() && ...),
+      "Currently only built-in types can be used in BulkParams columns");
+
+ public:
+  BulkParams() { WriteHeaders(); }
+
+  /// Reserve the buffers for `rows` rows, `value_size` is the expected size
+  /// of a binary formatted value of a column
+  explicit BulkParams(std::size_t rows,
+                      std::size_t value_size = sizeof(Bigint)) {
+    Reserve(rows, value_size);
+    WriteHeaders();
+  }
+
+  /// Reserve the buffers for `rows` rows in total, `value_size` is the
+  /// expected size of a binary formatted value of a column
+  void Reserve(std::size_t rows, std::size_t value_size = sizeof(Bigint)) {
+    for (auto& buffer : buffers_) {
+      buffer.reserve(kHeaderSize + rows * (sizeof(Integer) + value_size));
+    }
+  }
+
+  /// Append a row, the values are in the order of the columns
+  BulkParams& AddRow(const Columns&... columns) {
+    std::size_t column = 0;
+    (io::WriteRawBinary(GetUserTypes(), buffers_[column++], columns), ...);
+    ++rows_;
+    return *this;
+  }
+
+  /// Returns the number of the added rows
+  std::size_t Size() const { return rows_; }
+
+  /// Returns whether no rows were added
+  bool IsEmpty() const { return rows_ == 0; }
+
+  /// Finish the arrays and move them into a parameter store, a parameter per
+  /// column. More parameters may be pushed into the store afterwards.
+  ParameterStore Build() && {
+    ParameterStore store;
+    BuildInto(store.data_, std::index_sequence_for<Columns...>{});
+    return store;
+  }
+
+ private:
+  using Buffer = std::vector<char>;
+
+  // Number of dimensions, flags, element oid, dimension size and lower bound
+  static constexpr std::size_t kHeaderSize = 5 * sizeof(Integer);
+  // Number of dimensions, flags and element oid of an empty array
+  static constexpr std::size_t kEmptyHeaderSize = 3 * sizeof(Integer);
+  static constexpr std::size_t kDimensionSizeOffset = 3 * sizeof(Integer);
+
+  static const UserTypes& GetUserTypes() {
+    return ParameterStore::kNoUserTypes;
+  }
+
+  void WriteHeaders() {
+    std::size_t column = 0;
+    (WriteHeader<Columns>(buffers_[column++]), ...);
+  }
+
+  template <typename Column>
+  static void WriteHeader(Buffer& buffer) {
+    const auto& types = GetUserTypes();
+    const auto elem_oid = io::CppToPg<Column>::GetOid(types);
+    io::WriteBuffer(types, buffer, static_cast<Integer>(1));  // dims
+    io::WriteBuffer(types, buffer, static_cast<Integer>(0));  // flags
+    io::WriteBuffer(types, buffer, static_cast<Integer>(elem_oid));
+    // The dimension size is written on build
+    io::WriteBuffer(types, buffer, static_cast<Integer>(0));
+    io::WriteBuffer(types, buffer, static_cast<Integer>(1));  // lbound
+  }
+
+  template <std::size_t... Indexes>
+  void BuildInto(detail::DynamicQueryParameters& params,
+                 std::index_sequence<Indexes...>) {
+    (FinishArray(buffers_[Indexes]), ...);
+    (params.WriteFormatted(io::CppToPg<Columns>::GetArrayOid(GetUserTypes()),
+                           std::move(buffers_[Indexes])),
+     ...);
+  }
+
+  void FinishArray(Buffer& buffer) const {
+    if (rows_ == 0) {
+      // An empty array has no dimensions
+      io::BufferWriter(static_cast<Integer>(0))(buffer.begin());
+      buffer.resize(kEmptyHeaderSize);
+      return;
+    }
+    io::BufferWriter(static_cast<Integer>(rows_))(buffer.begin() +
+                                                 kDimensionSizeOffset);
+  }
+
+  std::array<Buffer, sizeof...(Columns)> buffers_;
+  std::size_t rows_{0};
+};
+
+}  // namespace storages::postgres
+
+USERVER_NAMESPACE_END
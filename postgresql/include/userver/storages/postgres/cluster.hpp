@@ -20,6 +20,7 @@
 #include <userver/storages/postgres/options.hpp>
 #include <userver/storages/postgres/query.hpp>
 #include <userver/storages/postgres/query_queue.hpp>
+#include <userver/storages/postgres/replication.hpp>
 #include <userver/storages/postgres/statistics.hpp>
 #include <userver/storages/postgres/transaction.hpp>
 
@@ -170,6 +171,18 @@ class Cluster {
 
   /// @name Single-statement query in an auto-commit transaction
   /// @{
+  ///
+  /// If the automatic batching is enabled (see AutoBatchSettings), identical
+  /// statements of the concurrent calls with arguments of the built-in types
+  /// are coalesced into pipelined batches on a single connection. A batch is
+  /// executed with the execute timeout of its first statement, errors of a
+  /// statement are reported only to its caller.
+  ///
+  /// The results of the named queries listed in ResultCacheSettings are
+  /// cached for a short time if their arguments are of the built-in types or
+  /// passed in a ParameterStore. Calls with identical query name, host type
+  /// flags and arguments receive the cached result, which may be stale by up
+  /// to the TTL unless the writers send the invalidation notifications.
 
   /// @brief Execute a statement at host of specified type.
   /// @note You must specify at least one role from ClusterHostType here
@@ -211,6 +224,13 @@ class Cluster {
   /// which effectively decreases the number of usable connections
   NotifyScope Listen(std::string_view channel, OptionalCommandControl = {});
 
+  /// @brief Create a logical replication slot on the master host and
+  /// a stream of its changes
+  /// @warning Each ReplicationStream owns a dedicated replication connection,
+  /// which is not taken from the pool and is not limited by its size
+  ReplicationStream CreateReplicationStream(ReplicationSettings settings,
+                                            OptionalCommandControl = {});
+
   /// Replaces globally updated command control with a static user-provided one
   void SetDefaultCommandControl(CommandControl);
 
@@ -242,13 +262,34 @@ class Cluster {
  private:
   detail::NonTransaction Start(ClusterHostTypeFlags, OptionalCommandControl);
 
+  // Whether the statement goes through the automatic batching or the result
+  // cache, which require the parameters formatted beforehand
+  bool IsExecutedFormatted(const Query& query) const;
+  ResultSet ExecuteFormatted(ClusterHostTypeFlags, OptionalCommandControl,
+                             const Query& query,
+                             const detail::QueryParameters& params);
+
   OptionalCommandControl GetQueryCmdCtl(const std::string& query_name) const;
   OptionalCommandControl GetHandlersCmdCtl(
       OptionalCommandControl cmd_ctl) const;
 
+  // Only the built-in types are formatted beforehand, their formatting does
+  // not depend on the user types of the connection
+  static const UserTypes kNoUserTypes;
+
   detail::ClusterImplPtr pimpl_;
 };
 
+namespace detail {
+
+template <typename... Args>
+inline constexpr bool kIsFormattedWithoutUserTypes =
+    ((io::IsTypeMappedToSystem<Args>() ||
+      io::IsTypeMappedToSystemArray<Args>()) &&
+     ...);
+
+}  // namespace detail
+
 template <typename... Args>
 ResultSet Cluster::Execute(ClusterHostTypeFlags flags, const Query& query,
                            const Args&... args) {
@@ -263,6 +304,14 @@ ResultSet Cluster::Execute(ClusterHostTypeFlags flags,
     statement_cmd_ctl = GetQueryCmdCtl(query.GetName()->GetUnderlying());
   }
   statement_cmd_ctl = GetHandlersCmdCtl(statement_cmd_ctl);
+  if constexpr (detail::kIsFormattedWithoutUserTypes<Args...>) {
+    if (IsExecutedFormatted(query)) {
+      detail::StaticQueryParameters<sizeof...(args)> params;
+      params.Write(kNoUserTypes, args...);
+      return ExecuteFormatted(flags, statement_cmd_ctl, query,
+                              detail::QueryParameters{params});
+    }
+  }
   auto ntrx = Start(flags, statement_cmd_ctl);
   return ntrx.Execute(statement_cmd_ctl, query, args...);
 }
@@ -128,10 +128,22 @@ namespace components {
 /// ignore_unused_query_params| disable check for not-NULL query params that are not used in query          | false
 /// monitoring-dbalias      | name of the database for monitorings                                          | calculated from dbalias or dbconnection options
 /// max_prepared_cache_size | prepared statements cache size limit                                          | 200
+/// prepared-statements-warmup | number of the hottest statements of the cluster to prepare on new connections (0 - no warm-up) | 0
 /// max_statement_metrics   | limit of exported metrics for named statements                                | 0
+/// explain_threshold_ms    | duration of a named statement that makes it sampled with EXPLAIN (ANALYZE) (0 - disabled) | 0
+/// explain_interval_ms     | minimal interval between EXPLAIN (ANALYZE) samples of a statement             | 60000
 /// min_pool_size           | number of connections created initially                                       | 4
 /// max_pool_size           | maximum number of created connections for "connlimit_mode: manual"            | 15
 /// max_queue_size          | maximum number of clients waiting for a connection                            | 200
+/// auto_batch_enabled      | coalesce identical concurrent single statements into pipelined batches        | false
+/// auto_batch_window_us    | time in microseconds to wait for the statements of a batch (0 - just yield)   | 0
+/// auto_batch_max_size     | maximum number of statements in a batch                                       | 32
+/// result_cache_queries    | names of the read-only queries whose Cluster::Execute results are cached      | --
+/// result_cache_ttl_ms     | time to live of a cached result in milliseconds                               | 500
+/// result_cache_max_bytes  | total size of the cached results                                              | 16777216
+/// result_cache_invalidation_channel | LISTEN channel for invalidations, the payload is a query name, no payload drops all the results | --
+/// adaptive_pool_size      | grow and shrink the pool between min_pool_size and max_pool_size depending on the acquire wait time | false
+/// adaptive_grow_wait_ms   | 95th percentile of the acquire wait time in milliseconds that makes an adaptive pool grow | 5
 /// connecting_limit        | limit for concurrent establishing connections number per pool (0 - unlimited) | 0
 /// connlimit_mode          | max_connections setup mode (manual or auto), also see @ref scripts/docs/en/userver/pg_connlimit_mode_auto.md | auto
 /// error-injection         | artificial error injection settings, error_injection::Settings                | --
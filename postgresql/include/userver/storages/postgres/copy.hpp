@@ -0,0 +1,172 @@
+#pragma once
+
+/// @file userver/storages/postgres/copy.hpp
+/// @brief Streaming COPY in the binary format
+
+#include <cstddef>
+#include <optional>
+#include <string>
+#include <tuple>
+
+#include <userver/storages/postgres/io/field_buffer.hpp>
+#include <userver/storages/postgres/io/row_types.hpp>
+#include <userver/storages/postgres/io/type_traits.hpp>
+#include <userver/storages/postgres/io/user_types.hpp>
+#include <userver/storages/postgres/options.hpp>
+#include <userver/storages/postgres/postgres_fwd.hpp>
+#include <userver/storages/postgres/query.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace storages::postgres {
+
+/// @brief Writes the rows of a `COPY ... FROM STDIN (FORMAT binary)`
+/// statement.
+///
+/// The columns are written with the same binary formatters as the query
+/// parameters. The rows are sent to the database in chunks, sending a chunk
+/// suspends the coroutine while the socket is not writeable, so the memory
+/// consumption does not depend on the number of rows.
+///
+/// The network timeout of the command control is applied to every chunk, the
+/// statement timeout is applied to the whole COPY.
+///
+/// If the stream is destroyed without Finish(), the COPY is aborted when the
+/// connection is returned to the pool. No other statements may be run in the
+/// transaction until the COPY is finished.
+///
+/// @snippet storages/postgres/tests/copy_pgtest.cpp CopyIn
+class CopyInStream {
+ public:
+  /// @cond
+  CopyInStream(detail::Connection* conn, const Query& query,
+               OptionalCommandControl cmd_ctl);
+  /// @endcond
+
+  CopyInStream(CopyInStream&&) noexcept;
+  CopyInStream& operator=(CopyInStream&&) noexcept;
+
+  CopyInStream(const CopyInStream&) = delete;
+  CopyInStream& operator=(const CopyInStream&) = delete;
+
+  ~CopyInStream();
+
+  /// Write a row, the columns must be in the order of the COPY columns
+  template <typename... Columns>
+  void WriteRow(const Columns&... columns);
+
+  /// Write the rows of a container of row types, see @ref pg_user_row_types
+  template <typename Container>
+  void WriteRows(const Container& rows);
+
+  /// Send the rest of the rows and finish the COPY
+  /// @returns the number of the copied rows
+  std::size_t Finish();
+
+ private:
+  const UserTypes& GetUserTypes() const;
+  void SendChunkIfFull();
+
+  detail::Connection* conn_;
+  std::string buffer_;
+};
+
+/// @brief Reads the rows of a `COPY ... TO STDOUT (FORMAT binary)` statement.
+///
+/// The columns are read with the same binary parsers as the fields of a
+/// ResultSet. The rows are received from the database in chunks as they are
+/// read, so the memory consumption does not depend on the number of rows.
+///
+/// The network timeout of the command control is applied to every chunk, the
+/// statement timeout is applied to the whole COPY.
+///
+/// If the stream is destroyed before all the rows are read, the rest of them
+/// are discarded when the connection is returned to the pool. No other
+/// statements may be run in the transaction until all the rows are read.
+///
+/// @snippet storages/postgres/tests/copy_pgtest.cpp CopyOut
+class CopyOutStream {
+ public:
+  /// @cond
+  CopyOutStream(detail::Connection* conn, const Query& query,
+                OptionalCommandControl cmd_ctl);
+  /// @endcond
+
+  CopyOutStream(CopyOutStream&&) noexcept;
+  CopyOutStream& operator=(CopyOutStream&&) noexcept;
+
+  CopyOutStream(const CopyOutStream&) = delete;
+  CopyOutStream& operator=(const CopyOutStream&) = delete;
+
+  ~CopyOutStream();
+
+  /// Read the next row, the columns must be in the order of the COPY columns
+  /// @returns false if there are no more rows
+  template <typename... Columns>
+  bool ReadRow(Columns&... columns);
+
+  /// Read the rest of the rows into a container of row types, see
+  /// @ref pg_user_row_types
+  template <typename Container>
+  Container ReadRows();
+
+  /// @returns true if all the rows are read
+  bool Done() const { return done_; }
+
+ private:
+  const UserTypes& GetUserTypes() const;
+  std::optional<io::FieldBuffer> ReadRowBuffer(std::size_t columns_count);
+  void ReadHeader();
+  void EnsureBuffered(std::size_t size);
+
+  detail::Connection* conn_;
+  std::string buffer_;
+  std::size_t offset_{0};
+  bool done_{false};
+};
+
+template <typename... Columns>
+void CopyInStream::WriteRow(const Columns&... columns) {
+  const auto& types = GetUserTypes();
+  io::WriteBuffer(types, buffer_, static_cast<Smallint>(sizeof...(columns)));
+  (io::WriteRawBinary(types, buffer_, columns), ...);
+  SendChunkIfFull();
+}
+
+template <typename Container>
+void CopyInStream::WriteRows(const Container& rows) {
+  using Row = typename Container::value_type;
+  for (const auto& row : rows) {
+    std::apply([this](const auto&... columns) { WriteRow(columns...); },
+               io::RowType<Row>::GetTuple(row));
+  }
+}
+
+template <typename... Columns>
+bool CopyOutStream::ReadRow(Columns&... columns) {
+  auto row = ReadRowBuffer(sizeof...(columns));
+  if (!row) return false;
+
+  const auto& categories = GetUserTypes().GetTypeBufferCategories();
+  (row->ReadRaw(columns, categories, io::traits::kTypeBufferCategory<Columns>),
+   ...);
+  return true;
+}
+
+template <typename Container>
+Container CopyOutStream::ReadRows() {
+  using Row = typename Container::value_type;
+  Container rows;
+  auto inserter = io::traits::Inserter(rows);
+  Row row;
+  while (std::apply([this](auto&... columns) { return ReadRow(columns...); },
+                    io::RowType<Row>::GetTuple(row))) {
+    *inserter = std::move(row);
+    ++inserter;
+  }
+  return rows;
+}
+
+}  // namespace storages::postgres
+
+USERVER_NAMESPACE_END
@@ -5,6 +5,7 @@
 #include <optional>
 
 #include <userver/dynamic_config/source.hpp>
+#include <userver/storages/postgres/query.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
@@ -13,6 +14,7 @@ namespace storages::postgres::detail {
 class Connection;
 class ConnectionPool;
 class StatementStatsStorage;
+class QueryParameters;
 
 /// Pointer-like class that controls lifetime of a parent pool by keeping smart
 /// pointer to it.
@@ -32,6 +34,10 @@ class ConnectionPtr {
   Connection* operator->() const noexcept;
 
   const StatementStatsStorage* GetStatementStatsStorage() const;
+
+  /// Samples the plan of a slow statement on another connection of the pool
+  void ExplainStatement(const Query& query,
+                        const QueryParameters& params) const;
   std::optional<dynamic_config::Source> GetConfigSource() const;
 
  private:
@@ -170,6 +170,19 @@ class DynamicQueryParameters {
     (Write(types, args), ...);
   }
 
+  /// Write a parameter that is already formatted in the binary format
+  void WriteFormatted(Oid type, std::vector<char>&& buffer) {
+    param_types.push_back(type);
+    param_formats.push_back(io::kPgBinaryDataFormat);
+    param_lengths.push_back(buffer.size());
+    if (buffer.empty()) {
+      param_buffers.push_back(empty_buffer);
+    } else {
+      param_buffers.push_back(buffer.data());
+    }
+    parameters.push_back(std::move(buffer));
+  }
+
  private:
   template <typename T>
   void WriteParamType(const UserTypes& types, const T&) {
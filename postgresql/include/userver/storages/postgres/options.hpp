@@ -8,6 +8,7 @@
 #include <optional>
 #include <string>
 #include <unordered_map>
+#include <unordered_set>
 
 #include <userver/congestion_control/controllers/linear.hpp>
 #include <userver/storages/postgres/postgres_fwd.hpp>
@@ -113,22 +114,35 @@ struct CommandControl {
   TimeoutDuration execute{};
   /// PostgreSQL server-side timeout
   TimeoutDuration statement{};
+  /// Slaves lagging behind the master more than this are not used for the
+  /// command, zero means no limit. Applies to single statements and
+  /// transactions started via Cluster.
+  std::chrono::milliseconds max_replication_lag{0};
 
-  constexpr CommandControl(TimeoutDuration execute, TimeoutDuration statement)
-      : execute(execute), statement(statement) {}
+  constexpr CommandControl(TimeoutDuration execute, TimeoutDuration statement,
+                           std::chrono::milliseconds max_replication_lag = {})
+      : execute(execute),
+        statement(statement),
+        max_replication_lag(max_replication_lag) {}
 
   constexpr CommandControl WithExecuteTimeout(TimeoutDuration n) const
       noexcept {
-    return {n, statement};
+    return {n, statement, max_replication_lag};
   }
 
   constexpr CommandControl WithStatementTimeout(TimeoutDuration s) const
       noexcept {
-    return {execute, s};
+    return {execute, s, max_replication_lag};
+  }
+
+  constexpr CommandControl WithMaxReplicationLag(
+      std::chrono::milliseconds lag) const noexcept {
+    return {execute, statement, lag};
   }
 
   bool operator==(const CommandControl& rhs) const {
-    return execute == rhs.execute && statement == rhs.statement;
+    return execute == rhs.execute && statement == rhs.statement &&
+           max_replication_lag == rhs.max_replication_lag;
   }
 
   bool operator!=(const CommandControl& rhs) const { return !(*this == rhs); }
@@ -167,6 +181,9 @@ inline constexpr std::size_t kDefaultPoolMaxQueueSize = 200;
 /// Default limit for concurrent establishing connections number
 inline constexpr std::size_t kDefaultConnectingLimit = 0;
 
+/// Default acquire wait time that makes an adaptive pool grow
+inline constexpr std::chrono::milliseconds kDefaultPoolAdaptiveGrowWait{5};
+
 struct TopologySettings {
   std::chrono::milliseconds max_replication_lag{kDefaultMaxReplicationLag};
 };
@@ -187,10 +204,20 @@ struct PoolSettings {
   /// Limits number of concurrent establishing connections (0 - unlimited)
   std::size_t connecting_limit{kDefaultConnectingLimit};
 
+  /// Grow and shrink the pool between min_size and max_size depending on
+  /// the connection acquire wait time and the idle connections
+  bool adaptive_size{false};
+
+  /// 95th percentile of the acquire wait time that makes an adaptive pool
+  /// grow, the pool may shrink once it drops below the half of it
+  std::chrono::milliseconds adaptive_grow_wait{kDefaultPoolAdaptiveGrowWait};
+
   bool operator==(const PoolSettings& rhs) const {
     return min_size == rhs.min_size && max_size == rhs.max_size &&
            max_queue_size == rhs.max_queue_size &&
-           connecting_limit == rhs.connecting_limit;
+           connecting_limit == rhs.connecting_limit &&
+           adaptive_size == rhs.adaptive_size &&
+           adaptive_grow_wait == rhs.adaptive_grow_wait;
   }
 };
 
@@ -259,12 +286,17 @@ struct ConnectionSettings {
   /// Execute discard all after establishing a new connection
   DiscardOnConnectOptions discard_on_connect = kDiscardAll;
 
+  /// Number of the hottest statements of the cluster to prepare on a new
+  /// connection before it is put into the pool, 0 disables the warm-up
+  std::size_t prepared_statements_warmup = 0;
+
   /// Helps keep track of the changes in settings
   SettingsVersion version{0U};
 
   bool operator==(const ConnectionSettings& rhs) const {
     return !RequiresConnectionReset(rhs) &&
-           recent_errors_threshold == rhs.recent_errors_threshold;
+           recent_errors_threshold == rhs.recent_errors_threshold &&
+           prepared_statements_warmup == rhs.prepared_statements_warmup;
   }
 
   bool operator!=(const ConnectionSettings& rhs) const {
@@ -290,11 +322,62 @@ struct StatementMetricsSettings final {
   /// Store metrics in LRU of this size
   std::size_t max_statements{0};
 
+  /// Successful executions of a named statement that take longer are sampled
+  /// with `EXPLAIN (ANALYZE)` in a rolled back transaction and the plan is
+  /// logged, 0 disables the sampling
+  std::chrono::milliseconds explain_threshold{0};
+
+  /// Minimal interval between the samples of the same statement
+  std::chrono::milliseconds explain_interval{std::chrono::minutes{1}};
+
   bool operator==(const StatementMetricsSettings& other) const {
-    return max_statements == other.max_statements;
+    return max_statements == other.max_statements &&
+           explain_threshold == other.explain_threshold &&
+           explain_interval == other.explain_interval;
   }
 };
 
+/// Default maximum number of statements in an automatic batch
+inline constexpr std::size_t kDefaultAutoBatchMaxSize = 32;
+
+/// @brief Automatic batching of the statements of concurrent
+/// storages::postgres::Cluster::Execute calls
+struct AutoBatchSettings final {
+  /// Coalesce identical statements into pipelined batches
+  bool enabled{false};
+
+  /// Time to wait for identical statements from other tasks, if zero the
+  /// batch only collects the statements that are ready to run
+  std::chrono::microseconds window{0};
+
+  /// Maximum number of statements in a batch
+  std::size_t max_size{kDefaultAutoBatchMaxSize};
+};
+
+/// Default time to live of a cached result
+inline constexpr std::chrono::milliseconds kDefaultResultCacheTtl{500};
+
+/// Default memory budget of the result cache
+inline constexpr std::size_t kDefaultResultCacheMaxBytes = 16 * 1024 * 1024;
+
+/// @brief Client-side cache of the results of the named read-only statements
+/// executed via storages::postgres::Cluster::Execute
+struct ResultCacheSettings final {
+  /// Names of the queries with cached results, the cache is disabled if empty
+  std::unordered_set<std::string> queries{};
+
+  /// Time to live of a cached result
+  std::chrono::milliseconds ttl{kDefaultResultCacheTtl};
+
+  /// Total size of the cached results, least recently used ones are evicted
+  std::size_t max_bytes{kDefaultResultCacheMaxBytes};
+
+  /// Channel to LISTEN on for invalidations. A notification with a query name
+  /// in the payload drops the results of the query, a notification without
+  /// payload drops all the results. If empty, the results expire by TTL only.
+  std::string invalidation_channel{};
+};
+
 /// Initialization modes
 enum class InitMode {
   kSync = 0,
@@ -331,6 +414,12 @@ struct ClusterSettings {
 
   /// congestion control settings
   congestion_control::v2::LinearController::StaticConfig cc_config;
+
+  /// settings for automatic batching of single statements
+  AutoBatchSettings auto_batch_settings;
+
+  /// settings for caching of the single statement results
+  ResultCacheSettings result_cache_settings;
 };
 
 }  // namespace storages::postgres
@@ -12,6 +12,9 @@ USERVER_NAMESPACE_BEGIN
 
 namespace storages::postgres {
 
+template <typename... Columns>
+class BulkParams;
+
 /// @ingroup userver_containers
 ///
 /// @brief Class for dynamic PostgreSQL parameter list construction.
@@ -55,6 +58,9 @@ class ParameterStore {
   /// @endcond
 
  private:
+  template <typename... Columns>
+  friend class BulkParams;
+
   static UserTypes kNoUserTypes;
 
   detail::DynamicQueryParameters data_;
@@ -27,6 +27,7 @@ class ConnectionPtr;
 using ConnectionCallback = std::function<void(Connection*)>;
 
 class ResultWrapper;
+class ResultCache;
 using ResultWrapperPtr = std::shared_ptr<const ResultWrapper>;
 }  // namespace detail
 
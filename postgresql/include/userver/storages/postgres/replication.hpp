@@ -0,0 +1,226 @@
+#pragma once
+
+/// @file userver/storages/postgres/replication.hpp
+/// @brief Logical replication stream of the `pgoutput` plugin
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <userver/engine/deadline.hpp>
+#include <userver/engine/task/task_processor_fwd.hpp>
+#include <userver/storages/postgres/dsn.hpp>
+#include <userver/storages/postgres/io/field_buffer.hpp>
+#include <userver/storages/postgres/io/pg_types.hpp>
+#include <userver/storages/postgres/io/traits.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace storages::postgres {
+
+/// Log sequence number, a position in the write-ahead log
+using Lsn = std::uint64_t;
+
+/// Formats the LSN as PostgreSQL does, e.g. `16/B374D848`
+std::string LsnToString(Lsn lsn);
+
+/// @brief Parses the LSN in the PostgreSQL format
+/// @throws InvalidInputFormat on an invalid string
+Lsn LsnFromString(std::string_view str);
+
+/// Settings of a ReplicationStream
+struct ReplicationSettings {
+  /// Name of the temporary replication slot, must be unique in the database
+  std::string slot_name;
+  /// Names of the publications to receive the changes of
+  std::vector<std::string> publications;
+  /// Interval of the status updates sent to the server
+  std::chrono::milliseconds status_interval{std::chrono::seconds{10}};
+};
+
+/// A row of a change in the logical replication stream
+class ReplicationTuple {
+ public:
+  enum class ColumnKind : char {
+    kNull,
+    /// The value of an unchanged TOASTed column is not sent on updates
+    kUnchangedToast,
+    kText,
+    kBinary,
+  };
+
+  std::size_t Size() const { return columns_.size(); }
+
+  ColumnKind GetKind(std::size_t index) const;
+
+  bool IsNull(std::size_t index) const {
+    return GetKind(index) == ColumnKind::kNull;
+  }
+
+  /// @brief Reads the column with the binary parser of the type, as a
+  /// field of a ResultSet is read
+  /// @throws InvalidBinaryBuffer if the value of the column was not sent in
+  /// the binary format
+  template <typename T>
+  void ReadColumn(std::size_t index, T& value,
+                  const io::TypeBufferCategory& categories) const;
+
+  /// @cond
+  void AddColumn(ColumnKind kind, std::string_view value);
+  void SetColumn(std::size_t index, const ReplicationTuple& other);
+  /// @endcond
+
+ private:
+  struct Column {
+    ColumnKind kind;
+    // Offset of the length of the value in the data
+    std::size_t offset;
+  };
+
+  std::string_view GetData(std::size_t index) const;
+  io::FieldBuffer GetRawBuffer(std::size_t index) const;
+
+  // The values in the layout of the COPY binary rows, a 32 bit length and
+  // the bytes of the value, nulls have the length of -1
+  std::string data_;
+  std::vector<Column> columns_;
+};
+
+/// A table described by the logical replication stream
+struct ReplicationRelation {
+  struct Column {
+    std::string name;
+    Oid type_oid;
+    /// The column is a part of the replica identity
+    bool is_key;
+  };
+
+  Oid oid;
+  std::string schema;
+  std::string name;
+  std::vector<Column> columns;
+
+  /// Index of the column with the name, std::nullopt if not found
+  std::optional<std::size_t> FindColumn(std::string_view name) const;
+};
+
+/// A row change in the logical replication stream
+struct ReplicationChange {
+  enum class Type { kInsert, kUpdate, kDelete, kTruncate };
+
+  Type type;
+  /// The table of the change, it is kept alive while the change exists
+  std::shared_ptr<const ReplicationRelation> relation;
+  /// The new row of an insert or an update. On updates the unchanged TOASTed
+  /// columns are taken from the old row, if the table has REPLICA IDENTITY
+  /// FULL.
+  ReplicationTuple new_row;
+  /// @brief The old row of an update or a delete.
+  ///
+  /// Only the replica identity columns are set, the other columns are null,
+  /// unless the table has REPLICA IDENTITY FULL. Updates have the old row
+  /// only if they change the replica identity or the identity is FULL.
+  std::optional<ReplicationTuple> old_row;
+};
+
+/// A committed transaction in the logical replication stream
+struct ReplicationTransaction {
+  /// LSN of the commit record
+  Lsn commit_lsn{0};
+  /// LSN right after the commit record, the one to confirm
+  Lsn end_lsn{0};
+  std::vector<ReplicationChange> changes;
+};
+
+// clang-format off
+
+/// @brief Stream of the committed changes of the tables from a logical
+/// replication slot with the `pgoutput` plugin.
+///
+/// Created by storages::postgres::Cluster::CreateReplicationStream(). Owns
+/// a dedicated replication connection to the master host, the connection is
+/// not taken from the pool.
+///
+/// The stream creates a temporary slot that exports a snapshot. Until Start()
+/// is called the snapshot may be imported by the transactions with
+/// `SET TRANSACTION SNAPSHOT`, so the current contents of the tables may be
+/// read consistently with the changes received afterwards. The slot is dropped
+/// by the server when the stream is destroyed.
+///
+/// The rows are received in the binary format (PostgreSQL 14+) and are read
+/// with the same parsers as the fields of a ResultSet. User types are
+/// supported if they are known to the connection pool the stream is created
+/// for.
+///
+/// The stream is not thread-safe.
+///
+/// @par Usage synopsis
+/// @code
+/// auto stream = cluster.CreateReplicationStream(
+///     {"my_slot", {"my_publication"}});
+/// // read the initial state in the snapshot stream.GetSnapshotName()
+/// stream.Start(deadline);
+/// while (auto trx = stream.WaitTransaction(deadline)) {
+///   // apply trx->changes
+///   stream.Confirm(trx->end_lsn);
+/// }
+/// @endcode
+
+// clang-format on
+
+class ReplicationStream final {
+ public:
+  /// @cond
+  ReplicationStream(const Dsn& dsn, engine::TaskProcessor& bg_task_processor,
+                    io::TypeBufferCategory categories,
+                    ReplicationSettings settings, engine::Deadline deadline);
+  /// @endcond
+
+  ReplicationStream(ReplicationStream&&) noexcept;
+  ReplicationStream& operator=(ReplicationStream&&) noexcept;
+  ~ReplicationStream();
+
+  /// Name of the snapshot exported by the slot, valid until Start()
+  const std::string& GetSnapshotName() const;
+
+  /// The LSN the slot starts streaming from
+  Lsn GetConsistentPoint() const;
+
+  /// Buffer categories to pass to ReplicationTuple::ReadColumn()
+  const io::TypeBufferCategory& GetTypeBufferCategories() const;
+
+  /// Starts streaming the changes committed after the consistent point
+  void Start(engine::Deadline deadline);
+
+  /// @brief Waits for the next committed transaction, sending the status
+  /// updates to the server meanwhile
+  /// @returns std::nullopt on the deadline
+  /// @throws ConnectionError if the server stops the replication
+  std::optional<ReplicationTransaction> WaitTransaction(
+      engine::Deadline deadline);
+
+  /// Reports the changes up to the LSN as applied, the server may recycle
+  /// the write-ahead log up to it
+  void Confirm(Lsn lsn);
+
+ private:
+  struct Impl;
+  std::unique_ptr<Impl> impl_;
+};
+
+template <typename T>
+void ReplicationTuple::ReadColumn(
+    std::size_t index, T& value,
+    const io::TypeBufferCategory& categories) const {
+  GetRawBuffer(index).ReadRaw(value, categories,
+                              io::traits::kTypeBufferCategory<T>);
+}
+
+}  // namespace storages::postgres
+
+USERVER_NAMESPACE_END
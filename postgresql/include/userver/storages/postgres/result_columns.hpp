@@ -0,0 +1,111 @@
+#pragma once
+
+/// @file userver/storages/postgres/result_columns.hpp
+/// @brief Columnar PostgreSQL results
+
+#include <string_view>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <userver/storages/postgres/result_set.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace storages::postgres {
+
+namespace detail {
+
+template <typename T>
+inline constexpr bool kHasColumnFastPath =
+    std::is_same_v<T, Smallint> || std::is_same_v<T, Integer> ||
+    std::is_same_v<T, Bigint> || std::is_same_v<T, float> ||
+    std::is_same_v<T, double> || std::is_same_v<T, std::string_view>;
+
+}  // namespace detail
+
+/// @brief Result set decoded column by column.
+///
+/// Obtained via ResultSet::AsColumns. All the columns are decoded at once,
+/// each column in its own loop. The columns of `Smallint`, `Integer`,
+/// `Bigint`, `float`, `double` and `std::string_view` types without nulls
+/// are copied from the result buffer and converted in bulk, that is several
+/// times faster than the row by row extraction. Other types and the columns
+/// with nulls are parsed with the same parsers as the fields of a Row.
+///
+/// `std::string_view` values point into the result buffer, they are valid
+/// while the ResultColumns object is alive.
+///
+/// ## Usage synopsis
+/// ```
+/// auto res = trx.Execute("select id, name from table");
+/// auto columns = res.AsColumns<Integer, std::string_view>();
+/// const auto& ids = columns.Get<0>();
+/// const auto& names = columns.Get<1>();
+/// ```
+template <typename... Columns>
+class ResultColumns {
+ public:
+  using size_type = ResultSet::size_type;
+
+  /// Number of rows in the result set
+  size_type Size() const { return result_.Size(); }
+  bool IsEmpty() const { return Size() == 0; }
+
+  /// Values of the column, one per row
+  template <std::size_t Index>
+  const auto& Get() const& {
+    return std::get<Index>(columns_);
+  }
+  // One should store ResultColumns before using its accessors
+  template <std::size_t Index>
+  const auto& Get() const&& = delete;
+
+ private:
+  friend class ResultSet;
+
+  explicit ResultColumns(ResultSet result) : result_{std::move(result)} {
+    Decode(std::index_sequence_for<Columns...>{});
+  }
+
+  template <std::size_t... Indexes>
+  void Decode(std::index_sequence<Indexes...>) {
+    (DecodeColumn<Indexes>(std::get<Indexes>(columns_)), ...);
+  }
+
+  template <std::size_t Index, typename T>
+  void DecodeColumn(std::vector<T>& column) {
+    column.resize(Size());
+    if constexpr (detail::kHasColumnFastPath<T>) {
+      if (result_.ReadColumn(Index, column.data())) return;
+    }
+    for (size_type row = 0; row < column.size(); ++row) {
+      const FieldView field{*result_.pimpl_, row, Index};
+      if constexpr (std::is_same_v<T, bool>) {
+        // std::vector<bool> elements are not addressable
+        bool value{};
+        field.To(value);
+        column[row] = value;
+      } else {
+        field.To(column[row]);
+      }
+    }
+  }
+
+  ResultSet result_;
+  std::tuple<std::vector<Columns>...> columns_;
+};
+
+template <typename... Columns>
+ResultColumns<Columns...> ResultSet::AsColumns() const {
+  detail::AssertSaneTypeToDeserialize<Columns...>();
+  if (FieldCount() != sizeof...(Columns)) {
+    throw FieldTupleMismatch{FieldCount(), sizeof...(Columns)};
+  }
+  return ResultColumns<Columns...>{*this};
+}
+
+}  // namespace storages::postgres
+
+USERVER_NAMESPACE_END
@@ -7,6 +7,7 @@
 #include <limits>
 #include <memory>
 #include <optional>
+#include <string_view>
 #include <tuple>
 #include <type_traits>
 #include <utility>
@@ -215,6 +216,12 @@ class RowDescription {
   /// @throw NoBinaryParser if any of the fields doesn't have a binary parser
   void CheckBinaryFormat(const UserTypes& types) const;
 
+  /// Number of the fields
+  std::size_t Size() const;
+
+  /// Name of the field as named in the query
+  std::string_view GetName(std::size_t index) const;
+
   // TODO interface for iterating field descriptions
  private:
   detail::ResultWrapperPtr res_;
@@ -224,6 +231,8 @@ class Row;
 class ResultSet;
 template <typename T, typename ExtractionTag>
 class TypedResultSet;
+template <typename... Columns>
+class ResultColumns;
 
 class FieldView final {
  public:
@@ -711,15 +720,33 @@ class ResultSet {
   std::optional<T> AsOptionalSingleRow(RowTag) const;
   template <typename T>
   std::optional<T> AsOptionalSingleRow(FieldTag) const;
+
+  /// @brief Decode the result set column by column.
+  /// The number of the types must match the number of the fields.
+  /// For more information see ResultColumns
+  template <typename... Columns>
+  ResultColumns<Columns...> AsColumns() const;
   //@}
  private:
   friend class detail::ConnectionImpl;
   void FillBufferCategories(const UserTypes& types);
   void SetBufferCategoriesFrom(const ResultSet&);
 
+  // Bulk decoding of the columns without nulls, return false if the column
+  // values have other size or format and should be parsed field by field
+  bool ReadColumn(size_type col, Smallint* out) const;
+  bool ReadColumn(size_type col, Integer* out) const;
+  bool ReadColumn(size_type col, Bigint* out) const;
+  bool ReadColumn(size_type col, float* out) const;
+  bool ReadColumn(size_type col, double* out) const;
+  bool ReadColumn(size_type col, std::string_view* out) const;
+
   template <typename T, typename Tag>
   friend class TypedResultSet;
+  template <typename... Columns>
+  friend class ResultColumns;
   friend class ConnectionImpl;
+  friend class detail::ResultCache;
 
   std::shared_ptr<detail::ResultWrapper> pimpl_;
 };
@@ -1056,4 +1083,5 @@ std::optional<T> ResultSet::AsOptionalSingleRow(FieldTag) const {
 
 USERVER_NAMESPACE_END
 
+#include <userver/storages/postgres/result_columns.hpp>
 #include <userver/storages/postgres/typed_result_set.hpp>
@@ -0,0 +1,69 @@
+#pragma once
+
+/// @file userver/storages/postgres/result_stream.hpp
+/// @brief Streaming of the portal results with prefetch
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <optional>
+
+#include <userver/storages/postgres/portal.hpp>
+#include <userver/storages/postgres/result_set.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace storages::postgres {
+
+/// @brief Reads the rows of a Portal in chunks, fetching the next chunk in
+/// background while the current one is processed.
+///
+/// At most one chunk is fetched ahead, so the memory consumption is bounded
+/// by two chunks regardless of the number of rows, and the network round-trip
+/// of a chunk overlaps with the processing of the previous one.
+///
+/// The portal connection is used by the background fetch, no other statements
+/// may be run in the transaction until the stream is done or destroyed. If the
+/// stream is destroyed with a fetch in flight, the fetch is cancelled.
+/// A stream should be read either by chunks or by rows, NextChunk() skips the
+/// rest of the chunk of NextRow().
+///
+/// @snippet storages/postgres/tests/portal_pgtest.cpp ResultStream
+class ResultStream {
+ public:
+  /// Starts fetching the first chunk of `chunk_size` rows
+  ResultStream(Portal&& portal, std::uint32_t chunk_size);
+
+  ResultStream(ResultStream&&) noexcept;
+  ResultStream& operator=(ResultStream&&) noexcept;
+
+  ResultStream(const ResultStream&) = delete;
+  ResultStream& operator=(const ResultStream&) = delete;
+
+  ~ResultStream();
+
+  /// Waits for the next chunk and starts fetching the one after it
+  /// @returns std::nullopt if there are no more rows
+  std::optional<ResultSet> NextChunk();
+
+  /// Returns the next row, switching to the next chunk when the current one
+  /// is exhausted
+  /// @returns std::nullopt if there are no more rows
+  std::optional<Row> NextRow();
+
+  /// @returns true if all the rows are returned, may be false until an empty
+  /// last chunk is fetched
+  bool Done() const;
+
+  /// Number of the rows returned by NextChunk() or NextRow() so far, the rows
+  /// of a chunk count when the chunk is taken
+  std::size_t ReadSoFar() const;
+
+ private:
+  struct Impl;
+  std::unique_ptr<Impl> pimpl_;
+};
+
+}  // namespace storages::postgres
+
+USERVER_NAMESPACE_END
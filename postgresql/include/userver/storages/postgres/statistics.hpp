@@ -48,6 +48,13 @@ struct TransactionStatistics {
   /// to pretty uniqueness of names. Nevertheless we would like to see them to
   /// diagnose certain kinds of problems
   Counter duplicate_prepared_statements = 0;
+  /// Number of statements found in the prepared statements cache
+  Counter prepared_cache_hit_total = 0;
+  /// Number of statements missing in the prepared statements cache, new
+  /// connections prepare them on the first use unless warmed up
+  Counter prepared_cache_miss_total = 0;
+  /// Number of statements prepared on the new connections warm-up
+  Counter prepared_warmup_total = 0;
 
   // TODO pick reasonable resolution for transaction
   // execution times
@@ -87,6 +94,12 @@ struct ConnectionStatistics {
   Counter error_timeout = 0;
   /// Number of maximum allowed waiting requests
   Counter max_queue_size = 0;
+  /// Target number of connections of an adaptive pool (0 - not adaptive)
+  Counter adaptive_target = 0;
+  /// Number of adaptive pool size increases
+  Counter adaptive_grow_total = 0;
+  /// Number of adaptive pool size decreases
+  Counter adaptive_shrink_total = 0;
 
   /// Prepared statements count min-max-avg
   MmaAccumulator prepared_statements;
@@ -139,11 +152,20 @@ struct StatementStatistics final {
   Percentile timings{};
   RateCounter executed{};
   RateCounter errors{};
+  /// Timings of the statement preparation
+  Percentile prepare_timings{};
+  /// Timings from sending the statement until the first bytes of the reply
+  Percentile server_timings{};
+  /// Timings of receiving the rest of the reply
+  Percentile transfer_timings{};
 
   void Add(const StatementStatistics& other) {
     timings.Add(other.timings);
     executed.Add(other.executed.Load());
     errors.Add(other.errors.Load());
+    prepare_timings.Add(other.prepare_timings);
+    server_timings.Add(other.server_timings);
+    transfer_timings.Add(other.transfer_timings);
   }
 };
 
@@ -175,6 +197,9 @@ struct InstanceStatisticsNonatomic : InstanceStatisticsNonatomicBase {
     connection.prepared_statements =
         stats.connection.prepared_statements.GetStatsForPeriod();
     connection.max_queue_size = stats.connection.max_queue_size;
+    connection.adaptive_target = stats.connection.adaptive_target;
+    connection.adaptive_grow_total = stats.connection.adaptive_grow_total;
+    connection.adaptive_shrink_total = stats.connection.adaptive_shrink_total;
 
     transaction.total = stats.transaction.total;
     transaction.commit_total = stats.transaction.commit_total;
@@ -188,6 +213,11 @@ struct InstanceStatisticsNonatomic : InstanceStatisticsNonatomicBase {
     transaction.execute_timeout = stats.transaction.execute_timeout;
     transaction.duplicate_prepared_statements =
         stats.transaction.duplicate_prepared_statements;
+    transaction.prepared_cache_hit_total =
+        stats.transaction.prepared_cache_hit_total;
+    transaction.prepared_cache_miss_total =
+        stats.transaction.prepared_cache_miss_total;
+    transaction.prepared_warmup_total = stats.transaction.prepared_warmup_total;
     transaction.total_percentile =
         stats.transaction.total_percentile.GetStatsForPeriod();
     transaction.busy_percentile =
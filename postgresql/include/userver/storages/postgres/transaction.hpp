@@ -6,6 +6,7 @@
 #include <memory>
 #include <string>
 
+#include <userver/storages/postgres/copy.hpp>
 #include <userver/storages/postgres/detail/connection_ptr.hpp>
 #include <userver/storages/postgres/detail/query_parameters.hpp>
 #include <userver/storages/postgres/detail/time_types.hpp>
@@ -101,6 +102,15 @@ namespace storages::postgres {
 /// trx.Commit();
 /// @endcode
 ///
+/// @par Bulk data transfer
+///
+/// Big amounts of rows are loaded and unloaded with the binary COPY at the
+/// speed of the connection, the rows are formatted and parsed the same way as
+/// the query parameters and the results. See Transaction::CopyIn and
+/// Transaction::CopyOut.
+///
+/// @snippet storages/postgres/tests/copy_pgtest.cpp CopyIn
+///
 /// @see Transaction
 /// @see ResultSet
 ///
@@ -290,6 +300,38 @@ class Transaction {
   Portal MakePortal(OptionalCommandControl statement_cmd_ctl,
                     const Query& query, const ParameterStore& store);
 
+  /// Start a `COPY ... FROM STDIN (FORMAT binary)` statement and return a
+  /// stream for its rows.
+  ///
+  /// @snippet storages/postgres/tests/copy_pgtest.cpp CopyIn
+  CopyInStream CopyIn(const Query& query) {
+    return CopyIn(OptionalCommandControl{}, query);
+  }
+
+  /// Start a `COPY ... FROM STDIN (FORMAT binary)` statement with
+  /// per-statement command control and return a stream for its rows.
+  CopyInStream CopyIn(OptionalCommandControl statement_cmd_ctl,
+                      const Query& query);
+
+  /// Copy a container of row types (see @ref pg_user_row_types) with a
+  /// `COPY ... FROM STDIN (FORMAT binary)` statement.
+  /// @returns the number of the copied rows
+  template <typename Container>
+  std::size_t CopyIn(const Query& query, const Container& rows);
+
+  /// Start a `COPY ... TO STDOUT (FORMAT binary)` statement and return a
+  /// stream for its rows.
+  ///
+  /// @snippet storages/postgres/tests/copy_pgtest.cpp CopyOut
+  CopyOutStream CopyOut(const Query& query) {
+    return CopyOut(OptionalCommandControl{}, query);
+  }
+
+  /// Start a `COPY ... TO STDOUT (FORMAT binary)` statement with
+  /// per-statement command control and return a stream for its rows.
+  CopyOutStream CopyOut(OptionalCommandControl statement_cmd_ctl,
+                        const Query& query);
+
   /// Set a connection parameter
   /// https://www.postgresql.org/docs/current/sql-set.html
   /// The parameter is set for this transaction only
@@ -319,6 +361,7 @@ class Transaction {
                     OptionalCommandControl statement_cmd_ctl);
 
   const UserTypes& GetConnectionUserTypes() const;
+  detail::Connection* GetCopyConnection();
 
   std::string name_;
   detail::ConnectionPtr conn_;
@@ -343,6 +386,13 @@ void Transaction::ExecuteBulk(OptionalCommandControl statement_cmd_ctl,
   }
 }
 
+template <typename Container>
+std::size_t Transaction::CopyIn(const Query& query, const Container& rows) {
+  auto stream = CopyIn(query);
+  stream.WriteRows(rows);
+  return stream.Finish();
+}
+
 template <typename Container>
 void Transaction::ExecuteDecomposeBulk(const Query& query,
                                        const Container& args,
@@ -1,9 +1,106 @@
 #include <userver/cache/base_postgres_cache.hpp>
 
+#include <algorithm>
+#include <cctype>
+
+#include <fmt/format.h>
+
+#include <userver/utils/rand.hpp>
 #include <userver/yaml_config/merge_schemas.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
+namespace components::pg_cache::detail {
+
+namespace {
+
+// Maximum length of a PostgreSQL identifier
+constexpr std::size_t kMaxSlotNameSize = 63;
+constexpr std::string_view kSlotNamePrefix = "userver_cache_";
+
+}  // namespace
+
+std::optional<CdcSettings> ParseCdcSettings(
+    const yaml_config::YamlConfig& config) {
+  const auto cdc = config["cdc"];
+  if (cdc.IsMissing()) return std::nullopt;
+
+  CdcSettings settings;
+  settings.publication = cdc["publication"].As<std::string>();
+  settings.table = cdc["table"].As<std::string>("");
+  settings.batch_max_size =
+      cdc["batch-max-size"].As<std::size_t>(kDefaultCdcBatchMaxSize);
+  settings.batch_interval = cdc["batch-interval"].As<std::chrono::milliseconds>(
+      kDefaultCdcBatchInterval);
+  if (settings.publication.empty() || settings.batch_max_size == 0) {
+    throw std::logic_error(
+        "'cdc.publication' must not be empty and 'cdc.batch-max-size' must be "
+        "positive in '" +
+        config.GetPath() + "'");
+  }
+  return settings;
+}
+
+std::string MakeCdcSlotName(std::string_view cache_name) {
+  const auto suffix = fmt::format("_{:08x}", utils::Rand());
+  std::string name{kSlotNamePrefix};
+  for (const char c : cache_name) {
+    const auto uc = static_cast<unsigned char>(c);
+    name += std::isalnum(uc) ? static_cast<char>(std::tolower(uc)) : '_';
+  }
+  name.resize(std::min(name.size(), kMaxSlotNameSize - suffix.size()));
+  return name + suffix;
+}
+
+std::vector<std::string> GetColumnNames(
+    const storages::postgres::ResultSet& res) {
+  const auto description = res.GetRowDescription();
+  std::vector<std::string> names;
+  names.reserve(description.Size());
+  for (std::size_t i = 0; i < description.Size(); ++i) {
+    names.emplace_back(description.GetName(i));
+  }
+  return names;
+}
+
+CdcColumns::CdcColumns(const CdcSettings& settings,
+                       std::vector<std::string> columns)
+    : settings_{settings}, columns_{std::move(columns)} {}
+
+const std::vector<std::size_t>* CdcColumns::Find(
+    const std::shared_ptr<const storages::postgres::ReplicationRelation>&
+        relation) {
+  UASSERT(relation);
+  auto& mapping = mappings_[relation->oid];
+  // The relation is sent again after its schema changes
+  if (mapping.relation != relation) {
+    mapping.relation = relation;
+    mapping.indices.reset();
+
+    const auto& table = settings_.table;
+    const bool is_cached =
+        table.empty() || table == relation->name ||
+        table == relation->schema + '.' + relation->name;
+    if (is_cached) {
+      auto& indices = mapping.indices.emplace();
+      indices.reserve(columns_.size());
+      for (const auto& column : columns_) {
+        const auto index = relation->FindColumn(column);
+        if (!index) {
+          throw storages::postgres::InvalidConfig{
+              "Column '" + column +
+              "' of the cache query is missing in the replicated table " +
+              relation->schema + '.' + relation->name};
+        }
+        indices.push_back(*index);
+      }
+    }
+  }
+  return mapping.indices ? &*mapping.indices : nullptr;
+}
+
+}  // namespace components::pg_cache::detail
+
 namespace components::impl {
 
 std::string GetPostgreCacheSchema() {
@@ -28,6 +125,32 @@ properties:
         type: integer
         description: number of rows to request from PostgreSQL, 0 to fetch all rows in one request
         defaultDescription: 1000
+    full-update-partitions:
+        type: integer
+        description: number of partitions to read in parallel on a full update, requires kFullUpdatePartitionKey in the cache policy
+        defaultDescription: 1
+        minimum: 1
+    cdc:
+        type: object
+        description: settings of the updates from a logical replication slot, see pg_cc_cdc
+        additionalProperties: false
+        properties:
+            publication:
+                type: string
+                description: name of the publication of the table
+            table:
+                type: string
+                description: the table of the cache as schema.name or name
+                defaultDescription: all the tables of the publication
+            batch-max-size:
+                type: integer
+                description: maximum number of the changes applied to the cache at once
+                defaultDescription: 1000
+                minimum: 1
+            batch-interval:
+                type: string
+                description: time to wait for more changes before applying them to the cache
+                defaultDescription: 100ms
     pgcomponent:
         type: string
         description: PostgreSQL component name
@@ -295,6 +295,66 @@ struct PostgresExamplePolicy7 {
   using CacheContainer = utils::ProjectedUnorderedSet<ValueType, kKeyMember>;
 };
 
+/*! [Pg Cache Policy Partitions Example] */
+struct PostgresExamplePolicy8 {
+  static constexpr std::string_view kName = "my-pg-cache";
+  using ValueType = MyStructure;
+  static constexpr auto kKeyMember = &MyStructure::id;
+  static constexpr const char* kQuery =
+      "select id, bar, updated from test.my_data";
+  static constexpr const char* kUpdatedField = "updated";
+  using UpdatedFieldType = storages::postgres::TimePointTz;
+
+  // Integer column to split the rows of the full update by the remainder
+  // of its division by the `full-update-partitions` static option
+  static constexpr const char* kFullUpdatePartitionKey = "id";
+};
+
+struct PostgresExamplePolicy9 {
+  static constexpr std::string_view kName = "my-pg-cache";
+  using ValueType = MyStructure;
+  static constexpr auto kKeyMember = &MyStructure::id;
+  static constexpr const char* kQuery =
+      "select id, bar, updated from test.my_data";
+  static constexpr const char* kUpdatedField = "updated";
+  using UpdatedFieldType = storages::postgres::TimePointTz;
+  static constexpr const char* kWhere = "id > 10";
+
+  // Conditions of the partitions of the full update, each partition is read
+  // in parallel with the others
+  static std::vector<std::string> GetFullUpdatePartitions() {
+    return {"id < 1000000", "id >= 1000000"};
+  }
+};
+/*! [Pg Cache Policy Partitions Example] */
+
+static_assert(
+    pg_cache::detail::kHasFullUpdatePartitionKey<PostgresExamplePolicy8>);
+static_assert(
+    pg_cache::detail::kHasGetFullUpdatePartitions<PostgresExamplePolicy9>);
+static_assert(!pg_cache::detail::kHasGetFullUpdatePartitions<
+              PostgresExamplePolicy8>);
+
+// Tests partitions with a container that is filled after the parsing
+struct PostgresExamplePolicy10 {
+  static constexpr std::string_view kName = "my-pg-cache";
+  using ValueType = MyStructure;
+  static constexpr auto kKeyMember = &MyStructure::id;
+  static constexpr const char* kQuery =
+      "select id, bar, updated from test.my_data";
+  static constexpr const char* kUpdatedField = "updated";
+  using UpdatedFieldType = storages::postgres::TimePointTz;
+  using CacheContainer = utils::ProjectedUnorderedSet<ValueType, kKeyMember>;
+  static constexpr const char* kFullUpdatePartitionKey = "id";
+};
+
+static_assert(
+    std::is_same_v<pg_cache::detail::PartitionDataType<PostgresExamplePolicy8>,
+                   std::unordered_map<int, MyStructure>>);
+static_assert(std::is_same_v<
+              pg_cache::detail::PartitionDataType<PostgresExamplePolicy10>,
+              std::vector<MyStructure>>);
+
 // Instantiation test
 using MyCache1 = PostgreCache<PostgresExamplePolicy>;
 using MyCache2 = PostgreCache<PostgresExamplePolicy2>;
@@ -304,6 +364,9 @@ using MyTrivialCache = PostgreCache<PostgresTrivialPolicy>;
 using MyCache5 = PostgreCache<PostgresExamplePolicy5>;
 using MyCache6 = PostgreCache<PostgresExamplePolicy6>;
 using MyCache7 = PostgreCache<PostgresExamplePolicy7>;
+using MyCache8 = PostgreCache<PostgresExamplePolicy8>;
+using MyCache9 = PostgreCache<PostgresExamplePolicy9>;
+using MyCache10 = PostgreCache<PostgresExamplePolicy10>;
 
 // NB: field access required for actual instantiation
 static_assert(MyCache1::kIncrementalUpdates);
@@ -313,6 +376,9 @@ static_assert(MyCache4::kIncrementalUpdates);
 static_assert(MyCache5::kIncrementalUpdates);
 static_assert(MyCache6::kIncrementalUpdates);
 static_assert(MyCache7::kIncrementalUpdates);
+static_assert(MyCache8::kIncrementalUpdates);
+static_assert(MyCache9::kIncrementalUpdates);
+static_assert(MyCache10::kIncrementalUpdates);
 
 namespace pg = storages::postgres;
 static_assert(MyCache1::kClusterHostTypeFlags == pg::ClusterHostType::kSlave);
@@ -335,6 +401,9 @@ static_assert(MyCache7::kClusterHostTypeFlags == pg::ClusterHostType::kSlave);
   MyCache5 cache5{config, context};
   MyCache6 cache6{config, context};
   MyCache7 cache7{config, context};
+  MyCache8 cache8{config, context};
+  MyCache9 cache9{config, context};
+  MyCache10 cache10{config, context};
 }
 
 inline auto SampleOfComponentRegistration() {
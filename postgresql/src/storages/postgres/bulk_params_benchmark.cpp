@@ -0,0 +1,78 @@
+#include <benchmark/benchmark.h>
+
+#include <string_view>
+
+#include <userver/storages/postgres/bulk_params.hpp>
+#include <userver/storages/postgres/query_queue.hpp>
+
+#include <storages/postgres/detail/connection.hpp>
+#include <storages/postgres/detail/pool.hpp>
+
+#include <storages/postgres/util_benchmark.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+namespace pg = storages::postgres;
+using namespace pg::bench;
+
+constexpr std::string_view kValue = "some bulk inserted value";
+
+const pg::Query kCreateTable{
+    "create temporary table if not exists bulk_bench(id integer, value text)"};
+const pg::Query kInsertRow{"insert into bulk_bench(id, value) values($1, $2)"};
+const pg::Query kInsertBulk{
+    "insert into bulk_bench(id, value) "
+    "select * from unnest($1::integer[], $2::text[])"};
+
+engine::Deadline MakeDeadline() {
+  return engine::Deadline::FromDuration(kBenchCmdCtl.execute);
+}
+
+BENCHMARK_DEFINE_F(PgConnection, BulkParamsInsert)(benchmark::State& state) {
+  RunStandalone(state, [this, &state] {
+    auto& conn = GetConnection();
+    conn.Execute(kCreateTable);
+    const auto rows = static_cast<pg::Integer>(state.range(0));
+    for (auto _ : state) {
+      pg::BulkParams<pg::Integer, std::string_view> bulk{
+          static_cast<std::size_t>(rows), kValue.size()};
+      for (pg::Integer i = 0; i < rows; ++i) {
+        bulk.AddRow(i, kValue);
+      }
+      conn.Execute(kInsertBulk, std::move(bulk).Build());
+    }
+    state.SetItemsProcessed(state.iterations() * rows);
+  });
+}
+BENCHMARK_REGISTER_F(PgConnection, BulkParamsInsert)->Range(1, 1 << 12);
+
+BENCHMARK_DEFINE_F(PgConnection, QueryQueueInsert)(benchmark::State& state) {
+  RunStandalone(state, [this, &state] {
+    const auto pool = MakePipelinePool();
+    const auto rows = static_cast<pg::Integer>(state.range(0));
+    {
+      auto conn = pool->Acquire(MakeDeadline());
+      if (!conn->IsPipelineActive()) {
+        state.SkipWithError("Pipeline mode is not supported");
+        return;
+      }
+      conn->Execute(kCreateTable);
+    }
+    for (auto _ : state) {
+      pg::QueryQueue queue{kBenchCmdCtl, pool->Acquire(MakeDeadline())};
+      queue.Reserve(rows);
+      for (pg::Integer i = 0; i < rows; ++i) {
+        queue.Push(kInsertRow, i, kValue);
+      }
+      benchmark::DoNotOptimize(queue.Collect());
+    }
+    state.SetItemsProcessed(state.iterations() * rows);
+  });
+}
+BENCHMARK_REGISTER_F(PgConnection, QueryQueueInsert)->Range(1, 1 << 12);
+
+}  // namespace
+
+USERVER_NAMESPACE_END
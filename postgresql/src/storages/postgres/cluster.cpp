@@ -7,6 +7,8 @@ USERVER_NAMESPACE_BEGIN
 
 namespace storages::postgres {
 
+const UserTypes Cluster::kNoUserTypes{};
+
 Cluster::Cluster(DsnList dsns, clients::dns::Resolver* resolver,
                  engine::TaskProcessor& bg_task_processor,
                  const ClusterSettings& cluster_settings,
@@ -56,6 +58,11 @@ NotifyScope Cluster::Listen(std::string_view channel,
   return pimpl_->Listen(channel, cmd_ctl);
 }
 
+ReplicationStream Cluster::CreateReplicationStream(
+    ReplicationSettings settings, OptionalCommandControl cmd_ctl) {
+  return pimpl_->CreateReplicationStream(std::move(settings), cmd_ctl);
+}
+
 QueryQueue Cluster::CreateQueryQueue(ClusterHostTypeFlags flags) {
   return CreateQueryQueue(flags, pimpl_->GetDefaultCommandControl().execute);
 }
@@ -111,6 +118,17 @@ detail::NonTransaction Cluster::Start(ClusterHostTypeFlags flags,
   return pimpl_->Start(flags, cmd_ctl);
 }
 
+bool Cluster::IsExecutedFormatted(const Query& query) const {
+  return pimpl_->IsExecutedFormatted(query);
+}
+
+ResultSet Cluster::ExecuteFormatted(ClusterHostTypeFlags flags,
+                                    OptionalCommandControl cmd_ctl,
+                                    const Query& query,
+                                    const detail::QueryParameters& params) {
+  return pimpl_->ExecuteFormatted(flags, cmd_ctl, query, params);
+}
+
 OptionalCommandControl Cluster::GetQueryCmdCtl(
     const std::string& query_name) const {
   return pimpl_->GetQueryCmdCtl(query_name);
@@ -133,6 +151,10 @@ ResultSet Cluster::Execute(ClusterHostTypeFlags flags,
     statement_cmd_ctl = GetQueryCmdCtl(query.GetName()->GetUnderlying());
   }
   statement_cmd_ctl = GetHandlersCmdCtl(statement_cmd_ctl);
+  if (IsExecutedFormatted(query)) {
+    return ExecuteFormatted(flags, statement_cmd_ctl, query,
+                            detail::QueryParameters{store.GetInternalData()});
+  }
   auto ntrx = Start(flags, statement_cmd_ctl);
   return ntrx.Execute(statement_cmd_ctl, query.Statement(), store);
 }
@@ -1,6 +1,7 @@
 #include <userver/storages/postgres/component.hpp>
 
 #include <optional>
+#include <unordered_set>
 
 #include <storages/postgres/default_command_controls.hpp>
 #include <storages/postgres/detail/connection.hpp>
@@ -12,6 +13,7 @@
 #include <userver/dynamic_config/storage/component.hpp>
 #include <userver/engine/task/task_processor_fwd.hpp>
 #include <userver/error_injection/settings.hpp>
+#include <userver/formats/parse/common_containers.hpp>
 #include <userver/logging/log.hpp>
 #include <userver/storages/postgres/cluster.hpp>
 #include <userver/storages/postgres/cluster_types.hpp>
@@ -104,6 +106,24 @@ Postgres::Postgres(const ComponentConfig& config,
       initial_config[storages::postgres::kPipelineModeKey];
   initial_settings_.conn_settings.omit_describe_mode =
       initial_config[storages::postgres::kOmitDescribeInExecuteModeKey];
+  initial_settings_.auto_batch_settings.enabled =
+      config["auto_batch_enabled"].As<bool>(false);
+  initial_settings_.auto_batch_settings.window = std::chrono::microseconds{
+      config["auto_batch_window_us"].As<std::int64_t>(0)};
+  initial_settings_.auto_batch_settings.max_size =
+      config["auto_batch_max_size"].As<std::size_t>(
+          storages::postgres::kDefaultAutoBatchMaxSize);
+  auto& result_cache_settings = initial_settings_.result_cache_settings;
+  result_cache_settings.queries =
+      config["result_cache_queries"].As<std::unordered_set<std::string>>({});
+  result_cache_settings.ttl = std::chrono::milliseconds{
+      config["result_cache_ttl_ms"].As<std::int64_t>(
+          storages::postgres::kDefaultResultCacheTtl.count())};
+  result_cache_settings.max_bytes =
+      config["result_cache_max_bytes"].As<std::size_t>(
+          storages::postgres::kDefaultResultCacheMaxBytes);
+  result_cache_settings.invalidation_channel =
+      config["result_cache_invalidation_channel"].As<std::string>({});
   initial_settings_.statement_metrics_settings =
       pg_config.statement_metrics_settings.GetOptional(name_).value_or(
           config.As<storages::postgres::StatementMetricsSettings>());
@@ -273,6 +293,13 @@ properties:
         type: boolean
         description: execute discard all on new connections
         defaultDescription: true
+    prepared-statements-warmup:
+        type: integer
+        minimum: 0
+        description: |
+            number of the hottest statements of the cluster to prepare on new
+            connections before they are put into the pool (0 - no warm-up)
+        defaultDescription: 0
     monitoring-dbalias:
         type: string
         description: name of the database for monitorings
@@ -285,6 +312,16 @@ properties:
         type: integer
         description: limit of exported metrics for named statements
         defaultDescription: 0
+    explain_threshold_ms:
+        type: integer
+        description: duration of a named statement that makes it sampled with EXPLAIN (ANALYZE) (0 - disabled)
+        defaultDescription: 0
+        minimum: 0
+    explain_interval_ms:
+        type: integer
+        description: minimal interval between EXPLAIN (ANALYZE) samples of a statement
+        defaultDescription: 60000
+        minimum: 0
     error-injection:
         type: object
         description: error-injection options
@@ -318,6 +355,50 @@ properties:
         type: boolean
         description: turns on pipeline connection mode
         defaultDescription: false
+    adaptive_pool_size:
+        type: boolean
+        description: grow and shrink the pool between min_pool_size and max_pool_size depending on the acquire wait time
+        defaultDescription: false
+    adaptive_grow_wait_ms:
+        type: integer
+        description: 95th percentile of the acquire wait time in milliseconds that makes an adaptive pool grow
+        defaultDescription: 5
+        minimum: 1
+    auto_batch_enabled:
+        type: boolean
+        description: coalesce identical concurrent single statements into pipelined batches
+        defaultDescription: false
+    auto_batch_window_us:
+        type: integer
+        description: time in microseconds to wait for the statements of a batch (0 - just yield)
+        defaultDescription: 0
+        minimum: 0
+    auto_batch_max_size:
+        type: integer
+        description: maximum number of statements in a batch
+        defaultDescription: 32
+        minimum: 1
+    result_cache_queries:
+        type: array
+        description: names of the read-only queries whose Cluster::Execute results are cached
+        defaultDescription: empty
+        items:
+            type: string
+            description: query name
+    result_cache_ttl_ms:
+        type: integer
+        description: time to live of a cached result in milliseconds
+        defaultDescription: 500
+        minimum: 1
+    result_cache_max_bytes:
+        type: integer
+        description: total size of the cached results
+        defaultDescription: 16777216
+        minimum: 0
+    result_cache_invalidation_channel:
+        type: string
+        description: LISTEN channel for invalidations, the payload is a query name, no payload drops all the results
+        defaultDescription: ''
     connecting_limit:
         type: integer
         description: limit for concurrent establishing connections number per pool (0 - unlimited)
@@ -0,0 +1,191 @@
+#include <userver/storages/postgres/copy.hpp>
+
+#include <string_view>
+#include <utility>
+
+#include <storages/postgres/detail/connection.hpp>
+#include <userver/storages/postgres/exceptions.hpp>
+#include <userver/storages/postgres/io/integral_types.hpp>
+#include <userver/utils/assert.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace storages::postgres {
+
+namespace {
+
+// https://www.postgresql.org/docs/current/sql-copy.html#id-1.9.3.55.9.4
+constexpr std::string_view kSignature{"PGCOPY\n\377\r\n\0", 11};
+constexpr std::size_t kHeaderSize = kSignature.size() + 2 * sizeof(Integer);
+constexpr Integer kHasOidsFlag = 1 << 16;
+constexpr Smallint kTrailer = -1;
+
+// The rows are sent in chunks of at least this size
+constexpr std::size_t kChunkSize = 64 * 1024;
+
+template <typename T>
+T ReadInteger(const std::string& buffer, std::size_t offset) {
+  T value{};
+  io::ReadBuffer(
+      io::FieldBuffer{
+          false, io::BufferCategory::kPlainBuffer, sizeof(T),
+          reinterpret_cast<const std::uint8_t*>(buffer.data() + offset)},
+      value);
+  return value;
+}
+
+}  // namespace
+
+CopyInStream::CopyInStream(detail::Connection* conn, const Query& query,
+                           OptionalCommandControl cmd_ctl)
+    : conn_{conn} {
+  UASSERT(conn_);
+  if (!cmd_ctl) {
+    cmd_ctl = conn_->GetQueryCmdCtl(query.GetName());
+  }
+  conn_->CopyInStart(query, std::move(cmd_ctl));
+
+  buffer_.reserve(kChunkSize);
+  buffer_.append(kSignature);
+  // Flags and the header extension length
+  io::WriteBuffer(GetUserTypes(), buffer_, Integer{0});
+  io::WriteBuffer(GetUserTypes(), buffer_, Integer{0});
+}
+
+CopyInStream::CopyInStream(CopyInStream&& other) noexcept
+    : conn_{std::exchange(other.conn_, nullptr)},
+      buffer_{std::move(other.buffer_)} {}
+
+CopyInStream& CopyInStream::operator=(CopyInStream&& other) noexcept {
+  conn_ = std::exchange(other.conn_, nullptr);
+  buffer_ = std::move(other.buffer_);
+  return *this;
+}
+
+CopyInStream::~CopyInStream() = default;
+
+std::size_t CopyInStream::Finish() {
+  io::WriteBuffer(GetUserTypes(), buffer_, kTrailer);
+  auto* conn = std::exchange(conn_, nullptr);
+  conn->CopyInPutData(buffer_);
+  buffer_.clear();
+  return conn->CopyInEnd();
+}
+
+const UserTypes& CopyInStream::GetUserTypes() const {
+  if (!conn_) {
+    throw LogicError{"COPY is already finished"};
+  }
+  return conn_->GetUserTypes();
+}
+
+void CopyInStream::SendChunkIfFull() {
+  if (buffer_.size() < kChunkSize) return;
+  conn_->CopyInPutData(buffer_);
+  buffer_.clear();
+}
+
+CopyOutStream::CopyOutStream(detail::Connection* conn, const Query& query,
+                             OptionalCommandControl cmd_ctl)
+    : conn_{conn} {
+  UASSERT(conn_);
+  if (!cmd_ctl) {
+    cmd_ctl = conn_->GetQueryCmdCtl(query.GetName());
+  }
+  conn_->CopyOutStart(query, std::move(cmd_ctl));
+  ReadHeader();
+}
+
+CopyOutStream::CopyOutStream(CopyOutStream&& other) noexcept
+    : conn_{std::exchange(other.conn_, nullptr)},
+      buffer_{std::move(other.buffer_)},
+      offset_{std::exchange(other.offset_, 0)},
+      done_{std::exchange(other.done_, true)} {}
+
+CopyOutStream& CopyOutStream::operator=(CopyOutStream&& other) noexcept {
+  conn_ = std::exchange(other.conn_, nullptr);
+  buffer_ = std::move(other.buffer_);
+  offset_ = std::exchange(other.offset_, 0);
+  done_ = std::exchange(other.done_, true);
+  return *this;
+}
+
+CopyOutStream::~CopyOutStream() = default;
+
+const UserTypes& CopyOutStream::GetUserTypes() const {
+  UASSERT(conn_);
+  return conn_->GetUserTypes();
+}
+
+std::optional<io::FieldBuffer> CopyOutStream::ReadRowBuffer(
+    std::size_t columns_count) {
+  if (done_) return std::nullopt;
+
+  // The buffers of the previous row are not used any more
+  buffer_.erase(0, offset_);
+  offset_ = 0;
+
+  EnsureBuffered(sizeof(Smallint));
+  const auto fields_count = ReadInteger<Smallint>(buffer_, 0);
+  if (fields_count == kTrailer) {
+    // Reads the result of the COPY
+    while (conn_->CopyOutGetData(buffer_)) {
+    }
+    done_ = true;
+    buffer_.clear();
+    return std::nullopt;
+  }
+  if (fields_count < 0) {
+    throw InvalidBinaryBuffer{"Negative number of fields in a COPY row"};
+  }
+  if (static_cast<std::size_t>(fields_count) != columns_count) {
+    throw InvalidTupleSizeRequested(fields_count, columns_count);
+  }
+
+  std::size_t row_size = sizeof(Smallint);
+  for (Smallint i = 0; i < fields_count; ++i) {
+    EnsureBuffered(row_size + sizeof(Integer));
+    const auto field_size = ReadInteger<Integer>(buffer_, row_size);
+    row_size += sizeof(Integer);
+    // NULL has the size of -1
+    if (field_size > 0) row_size += field_size;
+  }
+  EnsureBuffered(row_size);
+  offset_ = row_size;
+
+  return io::FieldBuffer{
+      false, io::BufferCategory::kPlainBuffer, row_size - sizeof(Smallint),
+      reinterpret_cast<const std::uint8_t*>(buffer_.data()) + sizeof(Smallint)};
+}
+
+void CopyOutStream::ReadHeader() {
+  EnsureBuffered(kHeaderSize);
+  if (std::string_view{buffer_}.substr(0, kSignature.size()) != kSignature) {
+    throw InvalidBinaryBuffer{
+        "Invalid COPY signature, only the binary format is supported"};
+  }
+  const auto flags = ReadInteger<Integer>(buffer_, kSignature.size());
+  if (flags & kHasOidsFlag) {
+    throw InvalidBinaryBuffer{"COPY with OIDs is not supported"};
+  }
+  const auto extension_size =
+      ReadInteger<Integer>(buffer_, kSignature.size() + sizeof(Integer));
+  if (extension_size < 0) {
+    throw InvalidBinaryBuffer{"Negative size of the COPY header extension"};
+  }
+  offset_ = kHeaderSize + extension_size;
+  EnsureBuffered(offset_);
+}
+
+void CopyOutStream::EnsureBuffered(std::size_t size) {
+  while (buffer_.size() < size) {
+    if (!conn_->CopyOutGetData(buffer_)) {
+      done_ = true;
+      throw InvalidBinaryBuffer{"Unexpected end of the COPY data"};
+    }
+  }
+}
+
+}  // namespace storages::postgres
+
+USERVER_NAMESPACE_END
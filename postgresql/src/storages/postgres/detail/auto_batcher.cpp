@@ -0,0 +1,174 @@
+#include <storages/postgres/detail/auto_batcher.hpp>
+
+#include <exception>
+#include <mutex>
+
+#include <boost/container_hash/hash.hpp>
+#include <fmt/format.h>
+
+#include <userver/engine/future.hpp>
+#include <userver/engine/sleep.hpp>
+#include <userver/engine/task/cancel.hpp>
+#include <userver/storages/postgres/exceptions.hpp>
+#include <userver/tracing/span.hpp>
+#include <userver/utils/assert.hpp>
+#include <userver/utils/scope_guard.hpp>
+
+#include <storages/postgres/detail/connection.hpp>
+#include <storages/postgres/detail/pool.hpp>
+#include <storages/postgres/detail/statement_stats.hpp>
+#include <storages/postgres/detail/tracing_tags.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace storages::postgres::detail {
+
+struct AutoBatcher::Request {
+  const Query& query;
+  const QueryParameters& params;
+  OptionalCommandControl cmd_ctl;
+  engine::Promise<ResultSet> promise{};
+};
+
+std::size_t AutoBatcher::KeyHash::operator()(const Key& key) const noexcept {
+  auto seed = std::hash<std::string_view>{}(std::get<1>(key));
+  boost::hash_combine(seed, std::get<0>(key));
+  boost::hash_combine(seed, std::get<2>(key));
+  return seed;
+}
+
+AutoBatcher::AutoBatcher(const AutoBatchSettings& settings)
+    : settings_{settings} {
+  UINVARIANT(settings_.max_size > 0, "Auto batch size must be positive");
+}
+
+ResultSet AutoBatcher::Execute(ConnectionPool& pool, const Query& query,
+                               const QueryParameters& params,
+                               OptionalCommandControl cmd_ctl) {
+  Request request{query, params, cmd_ctl};
+  auto future = request.promise.get_future();
+  // The statement is referenced by the key until the leader takes the batch
+  const Key key{&pool, query.Statement(), params.TypeHash()};
+
+  {
+    std::unique_lock lock{mutex_};
+    auto [it, is_leader] = batches_.try_emplace(key);
+    if (!is_leader) {
+      if (it->second.size() < settings_.max_size) {
+        it->second.push_back(&request);
+        lock.unlock();
+
+        // The leader uses the request until the result is set
+        const engine::TaskCancellationBlocker cancel_blocker;
+        return future.get();
+      }
+
+      lock.unlock();
+      ExecuteBatch(pool, {&request});
+      return future.get();
+    }
+    it->second.push_back(&request);
+  }
+
+  if (settings_.window.count() > 0) {
+    engine::SleepFor(settings_.window);
+  } else {
+    engine::Yield();
+  }
+
+  std::vector<Request*> batch;
+  {
+    const std::lock_guard lock{mutex_};
+    auto node = batches_.extract(key);
+    UASSERT(!node.empty());
+    batch = std::move(node.mapped());
+  }
+  ExecuteBatch(pool, batch);
+  return future.get();
+}
+
+void AutoBatcher::ExecuteBatch(ConnectionPool& pool,
+                               const std::vector<Request*>& batch) {
+  UASSERT(!batch.empty());
+  const auto start_time = SteadyClock::now();
+  const auto& leader = *batch.front();
+
+  // Number of requests with the result or the error set
+  std::size_t done = 0;
+  try {
+    const auto acquire_timeout = leader.cmd_ctl
+                                     ? leader.cmd_ctl->execute
+                                     : pool.GetDefaultCommandControl().execute;
+    auto conn = pool.Acquire(engine::Deadline::FromDuration(acquire_timeout));
+    UASSERT(conn);
+    conn->Start(start_time);
+    const USERVER_NAMESPACE::utils::ScopeGuard finish_guard{
+        [&conn] { conn->Finish(); }};
+
+    if (batch.size() == 1 || !conn->IsPipelineActive() ||
+        !conn->ArePreparedStatementsEnabled()) {
+      for (; done < batch.size(); ++done) {
+        auto& request = *batch[done];
+        StatementStats stats{request.query, conn, &request.params};
+        try {
+          auto result =
+              conn->Execute(request.query, request.params, request.cmd_ctl);
+          stats.AccountStatementExecution();
+          request.promise.set_value(std::move(result));
+        } catch (const std::exception&) {
+          stats.AccountStatementError();
+          request.promise.set_exception(std::current_exception());
+        }
+      }
+      return;
+    }
+
+    tracing::Span span{scopes::kAutoBatch};
+    span.AddTag("batch_size", batch.size());
+    auto scope = span.CreateScopeTime();
+
+    const auto default_cc = conn->GetDefaultCommandControl();
+    const auto leader_cc = leader.cmd_ctl.value_or(default_cc);
+    auto meta = conn->PrepareStatement(leader.query, leader.params,
+                                       leader_cc.execute);
+
+    std::vector<StatementStats> stats;
+    stats.reserve(batch.size());
+    for (const auto* request : batch) {
+      stats.emplace_back(request->query, conn, &request->params);
+      const auto request_cc = request->cmd_ctl.value_or(default_cc);
+      conn->AddIntoPipeline({leader_cc.execute, request_cc.statement},
+                            meta.statement_name, request->params,
+                            meta.description, scope);
+    }
+
+    std::vector<std::exception_ptr> errors;
+    errors.reserve(batch.size());
+    auto results = conn->GatherPipeline(
+        leader_cc.execute,
+        std::vector<ResultSet>(batch.size(), meta.description), &errors);
+    if (results.size() != batch.size()) {
+      throw RuntimeError{
+          fmt::format("Auto batch results count mismatch: expected {}, got {}",
+                      batch.size(), results.size())};
+    }
+
+    for (; done < batch.size(); ++done) {
+      if (errors[done]) {
+        stats[done].AccountStatementError();
+        batch[done]->promise.set_exception(errors[done]);
+      } else {
+        stats[done].AccountStatementExecution();
+        batch[done]->promise.set_value(std::move(results[done]));
+      }
+    }
+  } catch (const std::exception&) {
+    for (; done < batch.size(); ++done) {
+      batch[done]->promise.set_exception(std::current_exception());
+    }
+  }
+}
+
+}  // namespace storages::postgres::detail
+
+USERVER_NAMESPACE_END
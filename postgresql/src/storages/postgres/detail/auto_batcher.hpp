@@ -0,0 +1,66 @@
+#pragma once
+
+#include <cstddef>
+#include <string_view>
+#include <tuple>
+#include <unordered_map>
+#include <vector>
+
+#include <userver/engine/mutex.hpp>
+#include <userver/storages/postgres/detail/query_parameters.hpp>
+#include <userver/storages/postgres/options.hpp>
+#include <userver/storages/postgres/query.hpp>
+#include <userver/storages/postgres/result_set.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace storages::postgres::detail {
+
+class ConnectionPool;
+
+/// @brief Coalesces identical statements of concurrent single statement
+/// executions into pipelined batches on a single connection.
+///
+/// The first request for a statement becomes the leader of a batch: it waits
+/// for the batching window, acquires a connection and executes all the
+/// requests that joined the batch meanwhile. The other requests wait for the
+/// leader, their cancellation is ignored as the leader uses their parameters.
+///
+/// The statement is prepared once with the execute timeout of the leader, and
+/// the results are waited for with the same timeout. Each statement uses its
+/// own statement timeout. Errors of a statement are reported only to its
+/// caller, connection errors are reported to all the callers of the batch.
+///
+/// Without the pipeline mode or prepared statements the statements of a batch
+/// are executed one after another on the same connection.
+class AutoBatcher final {
+ public:
+  explicit AutoBatcher(const AutoBatchSettings& settings);
+
+  bool IsEnabled() const { return settings_.enabled; }
+
+  ResultSet Execute(ConnectionPool& pool, const Query& query,
+                    const QueryParameters& params,
+                    OptionalCommandControl cmd_ctl);
+
+ private:
+  struct Request;
+
+  // Pool, statement and hash of the parameter types
+  using Key = std::tuple<const ConnectionPool*, std::string_view, std::size_t>;
+
+  struct KeyHash {
+    std::size_t operator()(const Key& key) const noexcept;
+  };
+
+  static void ExecuteBatch(ConnectionPool& pool,
+                           const std::vector<Request*>& batch);
+
+  const AutoBatchSettings settings_;
+  engine::Mutex mutex_;
+  std::unordered_map<Key, std::vector<Request*>, KeyHash> batches_;
+};
+
+}  // namespace storages::postgres::detail
+
+USERVER_NAMESPACE_END
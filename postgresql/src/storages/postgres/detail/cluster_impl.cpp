@@ -1,11 +1,17 @@
 #include <storages/postgres/detail/cluster_impl.hpp>
 
+#include <algorithm>
+#include <iterator>
+
 #include <fmt/format.h>
 
 #include <userver/dynamic_config/value.hpp>
 #include <userver/engine/async.hpp>
+#include <userver/engine/sleep.hpp>
+#include <userver/engine/task/cancel.hpp>
 #include <userver/server/request/task_inherited_data.hpp>
 #include <userver/utils/assert.hpp>
+#include <userver/utils/rand.hpp>
 
 #include <storages/postgres/detail/topology/hot_standby.hpp>
 #include <storages/postgres/detail/topology/standalone.hpp>
@@ -20,6 +26,17 @@ namespace storages::postgres::detail {
 
 namespace {
 
+using DsnIndices = topology::TopologyBase::DsnIndices;
+
+// Number of the distinct statements remembered for the connections warm-up
+constexpr std::size_t kStatementRegistrySize = 1000;
+
+// Timeout of a single wait for the result cache invalidations
+constexpr std::chrono::seconds kResultCacheNotifyTimeout{1};
+
+// Interval between the attempts to start listening for the invalidations
+constexpr std::chrono::seconds kResultCacheListenRetryInterval{1};
+
 ClusterHostType Fallback(ClusterHostType ht) {
   switch (ht) {
     case ClusterHostType::kMaster:
@@ -31,15 +48,39 @@ ClusterHostType Fallback(ClusterHostType ht) {
     case ClusterHostType::kNone:
     case ClusterHostType::kRoundRobin:
     case ClusterHostType::kNearest:
+    case ClusterHostType::kLeastLoaded:
       throw ClusterError("Invalid ClusterHostType value for fallback " +
                          ToString(ht));
   }
   UINVARIANT(false, "Unexpected cluster host type");
 }
 
-size_t SelectDsnIndex(const topology::TopologyBase::DsnIndices& indices,
-                      ClusterHostTypeFlags flags,
-                      std::atomic<uint32_t>& rr_host_idx) {
+// Expected time to serve a query: the in-flight queries are served one after
+// another with the average latency
+uint64_t GetLoad(const ConnectionPool& pool) {
+  const uint64_t latency = std::max<int64_t>(pool.GetLatencyEwma().count(), 1);
+  return (pool.GetInFlightCount() + 1) * latency;
+}
+
+// Power of two choices, keeps the load balanced without herding to the single
+// least loaded host between the load updates
+size_t SelectLeastLoaded(
+    const DsnIndices& indices,
+    const std::vector<std::shared_ptr<ConnectionPool>>& host_pools) {
+  UASSERT(indices.size() > 1);
+  const auto first = USERVER_NAMESPACE::utils::RandRange(indices.size());
+  auto second = USERVER_NAMESPACE::utils::RandRange(indices.size() - 1);
+  if (second >= first) ++second;
+  return GetLoad(*host_pools[indices[first]]) <=
+                 GetLoad(*host_pools[indices[second]])
+             ? first
+             : second;
+}
+
+size_t SelectDsnIndex(
+    const DsnIndices& indices, ClusterHostTypeFlags flags,
+    std::atomic<uint32_t>& rr_host_idx,
+    const std::vector<std::shared_ptr<ConnectionPool>>& host_pools) {
   UASSERT(!indices.empty());
   if (indices.empty()) {
     throw ClusterError("Cannot select host from an empty list");
@@ -54,6 +95,10 @@ size_t SelectDsnIndex(const topology::TopologyBase::DsnIndices& indices,
       idx_pos =
           rr_host_idx.fetch_add(1, std::memory_order_relaxed) % indices.size();
     }
+  } else if (strategy_flags == ClusterHostType::kLeastLoaded) {
+    if (indices.size() != 1) {
+      idx_pos = SelectLeastLoaded(indices, host_pools);
+    }
   } else if (strategy_flags != ClusterHostType::kNearest) {
     throw LogicError(
         fmt::format("Invalid strategy requested: {}, ensure only one is used",
@@ -62,6 +107,20 @@ size_t SelectDsnIndex(const topology::TopologyBase::DsnIndices& indices,
   return indices[idx_pos];
 }
 
+DsnIndices FilterLaggingHosts(
+    const DsnIndices& indices,
+    const topology::TopologyBase::ReplicationLags& replication_lags,
+    std::chrono::milliseconds max_replication_lag) {
+  DsnIndices result;
+  result.reserve(indices.size());
+  std::copy_if(indices.begin(), indices.end(), std::back_inserter(result),
+               [&](auto idx) {
+                 UASSERT(idx < replication_lags.size());
+                 return replication_lags[idx] <= max_replication_lag;
+               });
+  return result;
+}
+
 }  // namespace
 
 ClusterImpl::ClusterImpl(DsnList dsns, clients::dns::Resolver* resolver,
@@ -75,10 +134,14 @@ ClusterImpl::ClusterImpl(DsnList dsns, clients::dns::Resolver* resolver,
     : default_cmd_ctls_(default_cmd_ctls),
       cluster_settings_(cluster_settings),
       bg_task_processor_(bg_task_processor),
+      statement_registry_(
+          std::make_shared<StatementRegistry>(kStatementRegistrySize)),
       rr_host_idx_(0),
       config_source_(std::move(config_source)),
       connlimit_watchdog_(*this, testsuite_tasks, shard_number,
-                          [this]() { OnConnlimitChanged(); }) {
+                          [this]() { OnConnlimitChanged(); }),
+      auto_batcher_(cluster_settings.auto_batch_settings),
+      result_cache_(cluster_settings.result_cache_settings) {
   if (dsns.empty()) {
     throw ClusterError("Cannot create a cluster from an empty DSN list");
   } else if (dsns.size() == 1) {
@@ -108,7 +171,7 @@ ClusterImpl::ClusterImpl(DsnList dsns, clients::dns::Resolver* resolver,
         cluster_settings.conn_settings,
         cluster_settings.statement_metrics_settings, default_cmd_ctls_,
         testsuite_pg_ctl, ei_settings, cluster_settings.cc_config,
-        config_source_));
+        config_source_, statement_registry_));
   }
   LOG_DEBUG() << "Pools initialized";
 
@@ -117,9 +180,24 @@ ClusterImpl::ClusterImpl(DsnList dsns, clients::dns::Resolver* resolver,
   if (cluster_settings.connlimit_mode == ConnlimitMode::kAuto) {
     connlimit_watchdog_.Start();
   }
+
+  const auto& result_cache_settings = cluster_settings.result_cache_settings;
+  if (!result_cache_settings.queries.empty() &&
+      !result_cache_settings.invalidation_channel.empty()) {
+    result_cache_invalidation_task_ = engine::CriticalAsyncNoSpan(
+        bg_task_processor_,
+        [this, channel = result_cache_settings.invalidation_channel] {
+          RunResultCacheInvalidation(channel);
+        });
+  }
 }
 
-ClusterImpl::~ClusterImpl() { connlimit_watchdog_.Stop(); }
+ClusterImpl::~ClusterImpl() {
+  if (result_cache_invalidation_task_.IsValid()) {
+    result_cache_invalidation_task_.SyncCancel();
+  }
+  connlimit_watchdog_.Stop();
+}
 
 ClusterStatisticsPtr ClusterImpl::GetStatistics() const {
   auto cluster_stats = std::make_unique<ClusterStatistics>();
@@ -205,9 +283,21 @@ ClusterStatisticsPtr ClusterImpl::GetStatistics() const {
 }
 
 ClusterImpl::ConnectionPoolPtr ClusterImpl::FindPool(
-    ClusterHostTypeFlags flags) {
+    ClusterHostTypeFlags flags, OptionalCommandControl cmd_ctl) {
   LOG_TRACE() << "Looking for pool: " << flags;
 
+  const auto max_replication_lag =
+      cmd_ctl.value_or(GetDefaultCommandControl()).max_replication_lag;
+  const auto replication_lags = topology_->GetReplicationLags();
+  DsnIndices fresh_dsn_indices;
+  // Hosts usable for the command
+  const auto get_usable = [&](const DsnIndices& indices) -> const DsnIndices& {
+    if (max_replication_lag <= std::chrono::milliseconds{0}) return indices;
+    fresh_dsn_indices =
+        FilterLaggingHosts(indices, *replication_lags, max_replication_lag);
+    return fresh_dsn_indices;
+  };
+
   size_t dsn_index = -1;
   const auto role_flags = flags & kClusterHostRolesMask;
 
@@ -220,32 +310,37 @@ ClusterImpl::ConnectionPoolPtr ClusterImpl::FindPool(
       (role_flags & ClusterHostType::kSlave)) {
     LOG_TRACE() << "Starting transaction on " << role_flags;
     auto alive_dsn_indices = topology_->GetAliveDsnIndices();
-    if (alive_dsn_indices->empty()) {
+    const auto& usable_dsn_indices = get_usable(*alive_dsn_indices);
+    if (usable_dsn_indices.empty()) {
       throw ClusterUnavailable("None of cluster hosts are available");
     }
-    dsn_index = SelectDsnIndex(*alive_dsn_indices, flags, rr_host_idx_);
+    dsn_index =
+        SelectDsnIndex(usable_dsn_indices, flags, rr_host_idx_, host_pools_);
   } else {
     auto host_role = static_cast<ClusterHostType>(role_flags.GetValue());
     auto dsn_indices_by_type = topology_->GetDsnIndicesByType();
-    auto dsn_indices_it = dsn_indices_by_type->find(host_role);
-    while (host_role != ClusterHostType::kMaster &&
-           (dsn_indices_it == dsn_indices_by_type->end() ||
-            dsn_indices_it->second.empty())) {
+    const DsnIndices* usable_dsn_indices = nullptr;
+    const auto find_usable = [&] {
+      const auto it = dsn_indices_by_type->find(host_role);
+      usable_dsn_indices =
+          it == dsn_indices_by_type->end() ? nullptr : &get_usable(it->second);
+      return usable_dsn_indices && !usable_dsn_indices->empty();
+    };
+    while (host_role != ClusterHostType::kMaster && !find_usable()) {
       auto fb = Fallback(host_role);
       LOG_WARNING() << "There is no pool for " << host_role
                     << ", falling back to " << fb;
       host_role = fb;
-      dsn_indices_it = dsn_indices_by_type->find(host_role);
     }
 
-    if (dsn_indices_it == dsn_indices_by_type->end() ||
-        dsn_indices_it->second.empty()) {
+    if (!find_usable()) {
       throw ClusterUnavailable(
           fmt::format("Pool for {} (requested: {}) is not available",
                       ToString(host_role), ToString(role_flags)));
     }
     LOG_TRACE() << "Starting transaction on " << host_role;
-    dsn_index = SelectDsnIndex(dsn_indices_it->second, flags, rr_host_idx_);
+    dsn_index =
+        SelectDsnIndex(*usable_dsn_indices, flags, rr_host_idx_, host_pools_);
   }
 
   UASSERT(dsn_index < host_pools_.size());
@@ -267,7 +362,7 @@ Transaction ClusterImpl::Begin(ClusterHostTypeFlags flags,
     }
     flags = ClusterHostType::kMaster | flags.Clear(kClusterHostRolesMask);
   }
-  return FindPool(flags)->Begin(options, cmd_ctl);
+  return FindPool(flags, cmd_ctl)->Begin(options, cmd_ctl);
 }
 
 NonTransaction ClusterImpl::Start(ClusterHostTypeFlags flags,
@@ -277,7 +372,80 @@ NonTransaction ClusterImpl::Start(ClusterHostTypeFlags flags,
         "Host role must be specified for execution of a single statement");
   }
   LOG_TRACE() << "Requested single statement on " << flags;
-  return FindPool(flags)->Start(cmd_ctl);
+  return FindPool(flags, cmd_ctl)->Start(cmd_ctl);
+}
+
+bool ClusterImpl::IsExecutedFormatted(const Query& query) const {
+  return auto_batcher_.IsEnabled() || result_cache_.IsCached(query);
+}
+
+ResultSet ClusterImpl::ExecuteFormatted(ClusterHostTypeFlags flags,
+                                        OptionalCommandControl cmd_ctl,
+                                        const Query& query,
+                                        const QueryParameters& params) {
+  if (!(flags & kClusterHostRolesMask)) {
+    throw LogicError(
+        "Host role must be specified for execution of a single statement");
+  }
+  if (!result_cache_.IsCached(query)) {
+    return ExecuteUncached(flags, cmd_ctl, query, params);
+  }
+
+  auto key = ResultCache::MakeKey(flags, query, params);
+  if (auto cached = result_cache_.Get(key)) {
+    LOG_TRACE() << "Cached result of single statement on " << flags;
+    return std::move(*cached);
+  }
+  const auto generation = result_cache_.GetGeneration();
+  auto result = ExecuteUncached(flags, cmd_ctl, query, params);
+  result_cache_.Put(std::move(key), result, generation);
+  return result;
+}
+
+ResultSet ClusterImpl::ExecuteUncached(ClusterHostTypeFlags flags,
+                                       OptionalCommandControl cmd_ctl,
+                                       const Query& query,
+                                       const QueryParameters& params) {
+  if (!auto_batcher_.IsEnabled()) {
+    return Start(flags, cmd_ctl).DoExecute(query, params, cmd_ctl);
+  }
+  LOG_TRACE() << "Requested auto batched single statement on " << flags;
+  const auto pool = FindPool(flags, cmd_ctl);
+  return auto_batcher_.Execute(*pool, query, params, cmd_ctl);
+}
+
+void ClusterImpl::RunResultCacheInvalidation(const std::string& channel) {
+  while (!engine::current_task::ShouldCancel()) {
+    try {
+      auto scope = Listen(channel, {});
+      // The invalidations could have been missed while not listening
+      result_cache_.InvalidateAll();
+      result_cache_.Resume();
+      LOG_INFO() << "Listening for result cache invalidations on channel '"
+                 << channel << "'";
+
+      while (!engine::current_task::ShouldCancel()) {
+        try {
+          const auto notification = scope.WaitNotify(
+              engine::Deadline::FromDuration(kResultCacheNotifyTimeout));
+          if (notification.payload) {
+            result_cache_.Invalidate(*notification.payload);
+          } else {
+            result_cache_.InvalidateAll();
+          }
+        } catch (const ConnectionTimeoutError&) {
+          // No notifications, keep waiting
+        }
+      }
+    } catch (const std::exception& e) {
+      if (engine::current_task::ShouldCancel()) break;
+      LOG_WARNING() << "Result cache invalidations are not received, caching "
+                       "is suspended: "
+                    << e;
+    }
+    result_cache_.Suspend();
+    engine::InterruptibleSleepFor(kResultCacheListenRetryInterval);
+  }
 }
 
 NotifyScope ClusterImpl::Listen(std::string_view channel,
@@ -285,6 +453,12 @@ NotifyScope ClusterImpl::Listen(std::string_view channel,
   return FindPool(ClusterHostType::kMaster)->Listen(channel, cmd_ctl);
 }
 
+ReplicationStream ClusterImpl::CreateReplicationStream(
+    ReplicationSettings settings, OptionalCommandControl cmd_ctl) {
+  return FindPool(ClusterHostType::kMaster)
+      ->CreateReplicationStream(std::move(settings), cmd_ctl);
+}
+
 QueryQueue ClusterImpl::CreateQueryQueue(ClusterHostTypeFlags flags,
                                          TimeoutDuration acquire_timeout) {
   return QueryQueue{GetDefaultCommandControl(),
@@ -7,13 +7,17 @@
 #include <userver/clients/dns/resolver_fwd.hpp>
 #include <userver/dynamic_config/source.hpp>
 #include <userver/engine/task/task_processor_fwd.hpp>
+#include <userver/engine/task/task_with_result.hpp>
 #include <userver/error_injection/settings.hpp>
 #include <userver/testsuite/postgres_control.hpp>
 #include <userver/testsuite/tasks.hpp>
 
 #include <storages/postgres/connlimit_watchdog.hpp>
+#include <storages/postgres/detail/auto_batcher.hpp>
 #include <storages/postgres/detail/pg_impl_types.hpp>
 #include <storages/postgres/detail/pool.hpp>
+#include <storages/postgres/detail/result_cache.hpp>
+#include <storages/postgres/detail/statement_registry.hpp>
 #include <storages/postgres/detail/statement_stats_storage.hpp>
 #include <storages/postgres/detail/topology/base.hpp>
 #include <userver/storages/postgres/cluster_types.hpp>
@@ -48,8 +52,16 @@ class ClusterImpl {
 
   NonTransaction Start(ClusterHostTypeFlags, OptionalCommandControl);
 
+  bool IsExecutedFormatted(const Query& query) const;
+
+  ResultSet ExecuteFormatted(ClusterHostTypeFlags, OptionalCommandControl,
+                             const Query& query, const QueryParameters& params);
+
   NotifyScope Listen(std::string_view channel, OptionalCommandControl);
 
+  ReplicationStream CreateReplicationStream(ReplicationSettings settings,
+                                            OptionalCommandControl);
+
   QueryQueue CreateQueryQueue(ClusterHostTypeFlags flags,
                               TimeoutDuration acquire_timeout);
 
@@ -81,18 +93,29 @@ class ClusterImpl {
 
   bool IsConnlimitModeAuto(const ClusterSettings& settings) const;
 
+  ResultSet ExecuteUncached(ClusterHostTypeFlags, OptionalCommandControl,
+                            const Query& query, const QueryParameters& params);
+
+  void RunResultCacheInvalidation(const std::string& channel);
+
   using ConnectionPoolPtr = std::shared_ptr<ConnectionPool>;
 
-  ConnectionPoolPtr FindPool(ClusterHostTypeFlags);
+  ConnectionPoolPtr FindPool(ClusterHostTypeFlags,
+                             OptionalCommandControl cmd_ctl = {});
 
   DefaultCommandControls default_cmd_ctls_;
   rcu::Variable<ClusterSettings> cluster_settings_;
   std::unique_ptr<topology::TopologyBase> topology_;
   engine::TaskProcessor& bg_task_processor_;
+  // Shared by the pools to warm up the new connections
+  const std::shared_ptr<StatementRegistry> statement_registry_;
   std::vector<ConnectionPoolPtr> host_pools_;
   std::atomic<uint32_t> rr_host_idx_;
   dynamic_config::Source config_source_;
   ConnlimitWatchdog connlimit_watchdog_;
+  AutoBatcher auto_batcher_;
+  ResultCache result_cache_;
+  engine::TaskWithResult<void> result_cache_invalidation_task_;
 };
 
 }  // namespace storages::postgres::detail
@@ -97,6 +97,11 @@ Connection::Statistics Connection::GetStatsAndReset() {
   return pimpl_->GetStatsAndReset();
 }
 
+std::optional<Connection::StatementPhases>
+Connection::TakeLastStatementPhases() {
+  return pimpl_->TakeLastStatementPhases();
+}
+
 void Connection::Begin(const TransactionOptions& options,
                        SteadyClock::time_point trx_start_time,
                        OptionalCommandControl trx_cmd_ctl) {
@@ -137,8 +142,9 @@ void Connection::AddIntoPipeline(CommandControl cc,
 }
 
 std::vector<ResultSet> Connection::GatherPipeline(
-    TimeoutDuration timeout, const std::vector<ResultSet>& descriptions) {
-  return pimpl_->GatherPipeline(timeout, descriptions);
+    TimeoutDuration timeout, const std::vector<ResultSet>& descriptions,
+    std::vector<std::exception_ptr>* errors) {
+  return pimpl_->GatherPipeline(timeout, descriptions, errors);
 }
 
 ResultSet Connection::Execute(const Query& query, const ParameterStore& store) {
@@ -200,6 +206,26 @@ Notification Connection::WaitNotify(engine::Deadline deadline) {
   return pimpl_->WaitNotify(deadline);
 }
 
+void Connection::CopyInStart(const Query& query,
+                             OptionalCommandControl statement_cmd_ctl) {
+  pimpl_->CopyInStart(query, std::move(statement_cmd_ctl));
+}
+
+void Connection::CopyInPutData(std::string_view data) {
+  pimpl_->CopyInPutData(data);
+}
+
+std::size_t Connection::CopyInEnd() { return pimpl_->CopyInEnd(); }
+
+void Connection::CopyOutStart(const Query& query,
+                              OptionalCommandControl statement_cmd_ctl) {
+  pimpl_->CopyOutStart(query, std::move(statement_cmd_ctl));
+}
+
+bool Connection::CopyOutGetData(std::string& buffer) {
+  return pimpl_->CopyOutGetData(buffer);
+}
+
 TimeoutDuration Connection::GetIdleDuration() const {
   return pimpl_->GetIdleDuration();
 }
@@ -208,6 +234,14 @@ void Connection::Ping() { pimpl_->Ping(); }
 
 void Connection::MarkAsBroken() { pimpl_->MarkAsBroken(); }
 
+void Connection::SetStatementRegistry(StatementRegistry* registry) {
+  pimpl_->SetStatementRegistry(registry);
+}
+
+void Connection::WarmUpPreparedStatements() {
+  pimpl_->WarmUpPreparedStatements();
+}
+
 OptionalCommandControl Connection::GetQueryCmdCtl(
     const std::optional<Query::Name>& query_name) const {
   return pimpl_->GetNamedQueryCommandControl(query_name);
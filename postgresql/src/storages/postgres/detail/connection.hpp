@@ -2,7 +2,10 @@
 
 #include <atomic>
 #include <chrono>
+#include <exception>
+#include <optional>
 #include <string>
+#include <string_view>
 
 #include <userver/clients/dns/resolver_fwd.hpp>
 #include <userver/concurrent/background_task_storage_fwd.hpp>
@@ -38,6 +41,7 @@ enum class ConnectionState {
 namespace detail {
 
 class ConnectionImpl;
+class StatementRegistry;
 
 /// @brief PostreSQL connection class
 /// Handles connecting to Postgres, sending commands, processing command results
@@ -93,6 +97,12 @@ class Connection {
     /// Number of duplicate prepared statements errors,
     /// probably caused by timeout while preparing
     Counter duplicate_prepared_statements{0};
+    /// Number of statements found in the prepared statements cache
+    Counter prepared_cache_hit_total{0};
+    /// Number of statements missing in the prepared statements cache
+    Counter prepared_cache_miss_total{0};
+    /// Number of statements prepared on the connection warm-up
+    Counter prepared_warmup_total{0};
 
     /// Current number of prepared statements
     CurrentValue prepared_statements_current{0};
@@ -110,6 +120,16 @@ class Connection {
     SteadyClock::duration sum_query_duration{0};
   };
 
+  /// Durations of the phases of a statement execution
+  struct StatementPhases {
+    /// Preparation of the statement, zero if it is already prepared
+    std::chrono::steady_clock::duration prepare{0};
+    /// From sending the statement until the first bytes of the reply
+    std::chrono::steady_clock::duration server{0};
+    /// Receiving the rest of the reply
+    std::chrono::steady_clock::duration transfer{0};
+  };
+
   using SizeGuard =
       USERVER_NAMESPACE::utils::SizeGuard<std::shared_ptr<std::atomic<size_t>>>;
 
@@ -184,6 +204,10 @@ class Connection {
   /// @note May only be called when connection is not in transaction
   Statistics GetStatsAndReset();
 
+  /// Phases of the last statement run by Execute, std::nullopt if there was
+  /// none since the previous call, e.g. the statement was pipelined
+  std::optional<StatementPhases> TakeLastStatementPhases();
+
   //@{
   /// Begin a transaction in Postgres with specific start time point
   /// Suspends coroutine for execution
@@ -224,8 +248,11 @@ class Connection {
                        const detail::QueryParameters& params,
                        const ResultSet& description, tracing::ScopeTime& scope);
 
+  /// If `errors` is not null, the errors of the queries are stored there at
+  /// the indexes of their results instead of being thrown
   std::vector<ResultSet> GatherPipeline(
-      TimeoutDuration timeout, const std::vector<ResultSet>& descriptions);
+      TimeoutDuration timeout, const std::vector<ResultSet>& descriptions,
+      std::vector<std::exception_ptr>* errors = nullptr);
 
   template <typename... T>
   ResultSet Execute(const Query& query, const T&... args) {
@@ -286,6 +313,22 @@ class Connection {
   Notification WaitNotify(engine::Deadline deadline);
   //@}
 
+  //@{
+  /** @name COPY interface */
+  /// Start `COPY ... FROM STDIN`
+  void CopyInStart(const Query& query, OptionalCommandControl);
+  /// Send a chunk of the COPY data, suspends while the socket is not writeable
+  void CopyInPutData(std::string_view data);
+  /// Finish the COPY and return the number of the copied rows
+  std::size_t CopyInEnd();
+
+  /// Start `COPY ... TO STDOUT`
+  void CopyOutStart(const Query& query, OptionalCommandControl);
+  /// Append the next chunk of the COPY data to the buffer. After the last one
+  /// read the result of the COPY and return false.
+  bool CopyOutGetData(std::string& buffer);
+  //@}
+
   /// Get duration since last network operation
   TimeoutDuration GetIdleDuration() const;
   /// Ping the connection.
@@ -294,6 +337,14 @@ class Connection {
 
   void MarkAsBroken();
 
+  /// Report the statements prepared on cache misses to the registry, the
+  /// registry must outlive the connection
+  void SetStatementRegistry(StatementRegistry* registry);
+  /// Prepare the hottest statements of the registry,
+  /// see ConnectionSettings::prepared_statements_warmup.
+  /// The statements failed to prepare are skipped.
+  void WarmUpPreparedStatements();
+
   OptionalCommandControl GetQueryCmdCtl(
       const std::optional<Query::Name>& query_name) const;
 
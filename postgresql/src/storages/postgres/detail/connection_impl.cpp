@@ -1,5 +1,7 @@
 #include <storages/postgres/detail/connection_impl.hpp>
 
+#include <algorithm>
+
 #include <boost/functional/hash.hpp>
 
 #include <userver/error_injection/hook.hpp>
@@ -14,6 +16,7 @@
 #include <userver/utils/text_light.hpp>
 #include <userver/utils/uuid4.hpp>
 
+#include <storages/postgres/detail/statement_registry.hpp>
 #include <storages/postgres/detail/tracing_tags.hpp>
 #include <storages/postgres/experiments.hpp>
 #include <storages/postgres/io/pg_type_parsers.hpp>
@@ -95,6 +98,29 @@ class CountPortalBind {
   bool completed_{false};
 };
 
+class CountCopyEnd {
+ public:
+  CountCopyEnd(Connection::Statistics& stats,
+               SteadyClock::time_point copy_start_time)
+      : stats_(stats), copy_start_time_(copy_start_time) {}
+
+  ~CountCopyEnd() {
+    auto now = SteadyClock::now();
+    if (!completed_) {
+      ++stats_.error_execute_total;
+    }
+    stats_.sum_query_duration += now - copy_start_time_;
+    stats_.last_execute_finish = now;
+  }
+
+  void AccountResult(ResultSet&) { completed_ = true; }
+
+ private:
+  Connection::Statistics& stats_;
+  bool completed_{false};
+  SteadyClock::time_point copy_start_time_;
+};
+
 struct TrackTrxEnd {
   TrackTrxEnd(Connection::Statistics& stats) : stats_(stats) {}
   ~TrackTrxEnd() { stats_.trx_end_time = SteadyClock::now(); }
@@ -359,6 +385,11 @@ Connection::Statistics ConnectionImpl::GetStatsAndReset() {
   return std::exchange(stats_, Connection::Statistics{});
 }
 
+std::optional<Connection::StatementPhases>
+ConnectionImpl::TakeLastStatementPhases() {
+  return std::exchange(last_statement_phases_, std::nullopt);
+}
+
 ResultSet ConnectionImpl::ExecuteCommand(
     const Query& query, const QueryParameters& params,
     OptionalCommandControl statement_cmd_ctl) {
@@ -530,6 +561,40 @@ Notification ConnectionImpl::WaitNotify(engine::Deadline deadline) {
   return conn_wrapper_.WaitNotify(deadline);
 }
 
+void ConnectionImpl::CopyInStart(const Query& query,
+                                 OptionalCommandControl statement_cmd_ctl) {
+  CopyStart(query, std::move(statement_cmd_ctl), PGRES_COPY_IN);
+}
+
+void ConnectionImpl::CopyInPutData(std::string_view data) {
+  conn_wrapper_.PutCopyData(data, MakeCopyDeadline());
+}
+
+std::size_t ConnectionImpl::CopyInEnd() {
+  auto deadline = MakeCopyDeadline();
+  auto span = MakeQuerySpan(copy_query_,
+                            {copy_network_timeout_, GetStatementTimeout()});
+  auto scope = span.CreateScopeTime();
+  conn_wrapper_.PutCopyEnd(deadline, scope);
+  return WaitCopyResult(deadline, span, scope).RowsAffected();
+}
+
+void ConnectionImpl::CopyOutStart(const Query& query,
+                                  OptionalCommandControl statement_cmd_ctl) {
+  CopyStart(query, std::move(statement_cmd_ctl), PGRES_COPY_OUT);
+}
+
+bool ConnectionImpl::CopyOutGetData(std::string& buffer) {
+  auto deadline = MakeCopyDeadline();
+  if (conn_wrapper_.GetCopyData(deadline, buffer)) return true;
+
+  auto span = MakeQuerySpan(copy_query_,
+                            {copy_network_timeout_, GetStatementTimeout()});
+  auto scope = span.CreateScopeTime();
+  WaitCopyResult(deadline, span, scope);
+  return false;
+}
+
 void ConnectionImpl::CancelAndCleanup(TimeoutDuration timeout) {
   auto deadline = testsuite_pg_ctl_.MakeExecuteDeadline(timeout);
 
@@ -623,6 +688,40 @@ void ConnectionImpl::Ping() {
 
 void ConnectionImpl::MarkAsBroken() { conn_wrapper_.MarkAsBroken(); }
 
+void ConnectionImpl::SetStatementRegistry(StatementRegistry* registry) {
+  statement_registry_ = registry;
+}
+
+void ConnectionImpl::WarmUpPreparedStatements() {
+  if (!statement_registry_ || !ArePreparedStatementsEnabled()) return;
+  const auto count = std::min(settings_.prepared_statements_warmup,
+                              settings_.max_prepared_cache_size);
+  if (!count) return;
+
+  const auto statements = statement_registry_->GetHotStatements(count);
+  if (statements.empty()) return;
+
+  tracing::Span span{scopes::kPrepareWarmup};
+  span.AddTag("statements", statements.size());
+  auto scope = span.CreateScopeTime();
+  const auto deadline = MakeCurrentDeadline();
+
+  is_warming_up_ = true;
+  const USERVER_NAMESPACE::utils::ScopeGuard warmup_guard{
+      [this] { is_warming_up_ = false; }};
+  for (const auto& statement : statements) {
+    try {
+      DoPrepareStatement(statement->statement, statement->GetParams(),
+                         deadline, span, scope);
+    } catch (const std::exception& e) {
+      // The statement may be outdated, e.g. a table got dropped
+      LOG_LIMITED_WARNING() << "Failed to warm up statement `"
+                            << statement->statement << "`: " << e;
+      if (IsBroken() || deadline.IsReached()) return;
+    }
+  }
+}
+
 void ConnectionImpl::CheckBusy() const {
   if ((GetConnectionState() == ConnectionState::kTranActive) &&
       (!IsPipelineActive() || conn_wrapper_.IsSyncingPipeline())) {
@@ -729,6 +828,7 @@ const ConnectionImpl::PreparedStatementInfo& ConnectionImpl::DoPrepareStatement(
   if (statement_info) {
     if (statement_info->description.pimpl_) {
       LOG_TRACE() << "Query " << statement << " is already prepared.";
+      if (!is_warming_up_) ++stats_.prepared_cache_hit_total;
       return *statement_info;
     } else {
       LOG_DEBUG() << "Found prepared but not described statement";
@@ -797,6 +897,14 @@ const ConnectionImpl::PreparedStatementInfo& ConnectionImpl::DoPrepareStatement(
   }
 
   ++stats_.parse_total;
+  if (is_warming_up_) {
+    ++stats_.prepared_warmup_total;
+  } else {
+    ++stats_.prepared_cache_miss_total;
+    if (statement_registry_) {
+      statement_registry_->Register(query_hash, statement, params);
+    }
+  }
 
   return *statement_info;
 }
@@ -850,6 +958,7 @@ ResultSet ConnectionImpl::ExecuteCommand(const Query& query,
   auto scope = span.CreateScopeTime();
   CountExecute count_execute(stats_);
 
+  const auto start = std::chrono::steady_clock::now();
   auto const& prepared_info =
       DoPrepareStatement(statement, params, deadline, span, scope);
 
@@ -861,10 +970,13 @@ ResultSet ConnectionImpl::ExecuteCommand(const Query& query,
   }
 
   scope.Reset(scopes::kExec);
+  const auto send_time = std::chrono::steady_clock::now();
   conn_wrapper_.SendPreparedQuery(prepared_info.statement_name, params, scope,
                                   description_ptr_to_send);
-  return WaitResult(statement, deadline, network_timeout, count_execute, span,
-                    scope, description_ptr_to_read);
+  auto result = WaitResult(statement, deadline, network_timeout, count_execute,
+                           span, scope, description_ptr_to_read);
+  SetLastStatementPhases(start, send_time);
+  return result;
 }
 
 const ConnectionImpl::PreparedStatementInfo& ConnectionImpl::PrepareStatement(
@@ -907,7 +1019,8 @@ void ConnectionImpl::AddIntoPipeline(CommandControl cc,
 }
 
 std::vector<ResultSet> ConnectionImpl::GatherPipeline(
-    TimeoutDuration timeout, const std::vector<ResultSet>& descriptions) {
+    TimeoutDuration timeout, const std::vector<ResultSet>& descriptions,
+    std::vector<std::exception_ptr>* errors) {
   const auto deadline = testsuite_pg_ctl_.MakeExecuteDeadline(timeout);
   CheckDeadlineReached(deadline);
 
@@ -919,10 +1032,12 @@ std::vector<ResultSet> ConnectionImpl::GatherPipeline(
     }
   }
 
-  auto result = conn_wrapper_.GatherPipeline(deadline, native_descriptions);
+  auto result =
+      conn_wrapper_.GatherPipeline(deadline, native_descriptions, errors);
 
-  for (auto& single_result : result) {
-    FillBufferCategories(single_result);
+  for (std::size_t i = 0; i < result.size(); ++i) {
+    if (errors && (*errors)[i]) continue;
+    FillBufferCategories(result[i]);
   }
 
   return result;
@@ -945,9 +1060,12 @@ ResultSet ConnectionImpl::ExecuteCommandNoPrepare(const Query& query,
   auto span = MakeQuerySpan(query, {network_timeout, GetStatementTimeout()});
   auto scope = span.CreateScopeTime();
   CountExecute count_execute(stats_);
+  const auto send_time = std::chrono::steady_clock::now();
   conn_wrapper_.SendQuery(statement, params, scope);
-  return WaitResult(statement, deadline, network_timeout, count_execute, span,
-                    scope, nullptr);
+  auto result = WaitResult(statement, deadline, network_timeout, count_execute,
+                           span, scope, nullptr);
+  SetLastStatementPhases(send_time, send_time);
+  return result;
 }
 
 void ConnectionImpl::SendCommandNoPrepare(const Query& query,
@@ -1025,6 +1143,17 @@ void ConnectionImpl::LoadUserTypes(engine::Deadline deadline) {
   }
 }
 
+void ConnectionImpl::SetLastStatementPhases(
+    std::chrono::steady_clock::time_point start,
+    std::chrono::steady_clock::time_point send_time) {
+  const auto now = std::chrono::steady_clock::now();
+  auto first_reply_time = conn_wrapper_.GetFirstReplyTime();
+  // The reply was read along with a previous one
+  if (first_reply_time < send_time) first_reply_time = now;
+  last_statement_phases_ = Connection::StatementPhases{
+      send_time - start, first_reply_time - send_time, now - first_reply_time};
+}
+
 void ConnectionImpl::FillBufferCategories(ResultSet& res) {
   try {
     res.FillBufferCategories(db_types_);
@@ -1099,6 +1228,62 @@ ResultSet ConnectionImpl::WaitResult(const std::string& statement,
   }
 }
 
+void ConnectionImpl::CopyStart(const Query& query,
+                               OptionalCommandControl statement_cmd_ctl,
+                               ExecStatusType expected_status) {
+  CheckBusy();
+  copy_network_timeout_ = ExecuteTimeout(statement_cmd_ctl);
+  auto deadline = MakeCopyDeadline();
+  SetStatementTimeout(std::move(statement_cmd_ctl));
+  CheckDeadlineReached(deadline);
+
+  auto span =
+      MakeQuerySpan(query, {copy_network_timeout_, GetStatementTimeout()});
+  auto scope = span.CreateScopeTime();
+  ++stats_.execute_total;
+  try {
+    if (IsPipelineActive()) {
+      // COPY is not allowed in the pipeline mode, the results of the commands
+      // sent before it are gathered first
+      conn_wrapper_.WaitResult(deadline, scope, nullptr);
+      conn_wrapper_.ExitPipelineMode();
+    }
+    conn_wrapper_.SendQuery(query.Statement(), scope);
+    conn_wrapper_.WaitCopyStart(deadline, scope, expected_status);
+  } catch (const std::exception&) {
+    ++stats_.error_execute_total;
+    span.AddTag(tracing::kErrorFlag, true);
+    RestorePipelineMode();
+    throw;
+  }
+  copy_query_ = query;
+  copy_start_time_ = SteadyClock::now();
+}
+
+ResultSet ConnectionImpl::WaitCopyResult(engine::Deadline deadline,
+                                         tracing::Span& span,
+                                         tracing::ScopeTime& scope) {
+  const ScopeGuard pipeline_guard{[this] { RestorePipelineMode(); }};
+  CountCopyEnd count_copy(stats_, copy_start_time_);
+  return WaitResult(copy_query_.Statement(), deadline, copy_network_timeout_,
+                    count_copy, span, scope, nullptr);
+}
+
+engine::Deadline ConnectionImpl::MakeCopyDeadline() const {
+  // The network timeout is applied to every network operation of a COPY, so
+  // the bulk loads are limited only by the statement timeout
+  return testsuite_pg_ctl_.MakeExecuteDeadline(copy_network_timeout_);
+}
+
+void ConnectionImpl::RestorePipelineMode() {
+  const auto state = GetConnectionState();
+  if (settings_.pipeline_mode == PipelineMode::kEnabled &&
+      !IsPipelineActive() && state != ConnectionState::kOffline &&
+      state != ConnectionState::kTranActive) {
+    conn_wrapper_.EnterPipelineMode();
+  }
+}
+
 void ConnectionImpl::Cancel() { conn_wrapper_.Cancel().Wait(); }
 
 void ConnectionImpl::ReportStatement(const std::string& name) {
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <cstdint>
+#include <exception>
 #include <optional>
 #include <string>
 #include <string_view>
@@ -75,6 +76,8 @@ class ConnectionImpl {
 
   Connection::Statistics GetStatsAndReset();
 
+  std::optional<Connection::StatementPhases> TakeLastStatementPhases();
+
   ResultSet ExecuteCommand(const Query& query,
                            const detail::QueryParameters& params,
                            OptionalCommandControl statement_cmd_ctl);
@@ -87,7 +90,8 @@ class ConnectionImpl {
                        const detail::QueryParameters& params,
                        const ResultSet& description, tracing::ScopeTime& scope);
   std::vector<ResultSet> GatherPipeline(
-      TimeoutDuration timeout, const std::vector<ResultSet>& descriptions);
+      TimeoutDuration timeout, const std::vector<ResultSet>& descriptions,
+      std::vector<std::exception_ptr>* errors);
 
   void Begin(const TransactionOptions& options,
              SteadyClock::time_point trx_start_time,
@@ -111,6 +115,13 @@ class ConnectionImpl {
   void Unlisten(std::string_view channel, OptionalCommandControl);
   Notification WaitNotify(engine::Deadline deadline);
 
+  void CopyInStart(const Query& query, OptionalCommandControl);
+  void CopyInPutData(std::string_view data);
+  std::size_t CopyInEnd();
+
+  void CopyOutStart(const Query& query, OptionalCommandControl);
+  bool CopyOutGetData(std::string& buffer);
+
   void CancelAndCleanup(TimeoutDuration timeout);
   bool Cleanup(TimeoutDuration timeout);
 
@@ -126,6 +137,9 @@ class ConnectionImpl {
   void Ping();
   void MarkAsBroken();
 
+  void SetStatementRegistry(StatementRegistry* registry);
+  void WarmUpPreparedStatements();
+
  private:
   using PreparedStatements =
       cache::LruMap<Connection::StatementId, PreparedStatementInfo>;
@@ -183,12 +197,23 @@ class ConnectionImpl {
   void LoadUserTypes(engine::Deadline deadline);
   void FillBufferCategories(ResultSet& res);
 
+  void SetLastStatementPhases(
+      std::chrono::steady_clock::time_point start,
+      std::chrono::steady_clock::time_point send_time);
+
   template <typename Counter>
   ResultSet WaitResult(const std::string& statement, engine::Deadline deadline,
                        TimeoutDuration network_timeout, Counter& counter,
                        tracing::Span& span, tracing::ScopeTime& scope,
                        const ResultSet* description_ptr);
 
+  void CopyStart(const Query& query, OptionalCommandControl statement_cmd_ctl,
+                 ExecStatusType expected_status);
+  ResultSet WaitCopyResult(engine::Deadline deadline, tracing::Span& span,
+                           tracing::ScopeTime& scope);
+  engine::Deadline MakeCopyDeadline() const;
+  void RestorePipelineMode();
+
   void Cancel();
 
   void ReportStatement(const std::string& name);
@@ -199,18 +224,24 @@ class ConnectionImpl {
   Connection::Statistics stats_;
   PGConnectionWrapper conn_wrapper_;
   PreparedStatements prepared_;
+  StatementRegistry* statement_registry_{nullptr};
+  bool is_warming_up_ = false;
   UserTypes db_types_;
   bool is_in_recovery_ = true;
   bool is_read_only_ = true;
   bool is_discard_prepared_pending_ = false;
   ConnectionSettings settings_;
   std::optional<std::chrono::steady_clock::time_point> expires_at_;
+  std::optional<Connection::StatementPhases> last_statement_phases_;
 
   CommandControl default_cmd_ctl_{{}, {}};
   DefaultCommandControls default_cmd_ctls_;
   testsuite::PostgresControl testsuite_pg_ctl_;
   OptionalCommandControl transaction_cmd_ctl_;
   TimeoutDuration current_statement_timeout_{};
+  Query copy_query_;
+  TimeoutDuration copy_network_timeout_{};
+  SteadyClock::time_point copy_start_time_{};
   const error_injection::Settings ei_settings_;
 
   std::unordered_set<std::string> statements_reported_;
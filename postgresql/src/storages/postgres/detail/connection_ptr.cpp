@@ -44,6 +44,11 @@ const StatementStatsStorage* ConnectionPtr::GetStatementStatsStorage() const {
   return &pool_->GetStatementStatsStorage();
 }
 
+void ConnectionPtr::ExplainStatement(const Query& query,
+                                     const QueryParameters& params) const {
+  if (pool_) pool_->ExplainStatement(query, params);
+}
+
 std::optional<dynamic_config::Source> ConnectionPtr::GetConfigSource() const {
   if (!pool_) return std::nullopt;
   return {pool_->GetConfigSource()};
@@ -41,7 +41,7 @@ ResultSet NonTransaction::DoExecute(const Query& query,
         });
   }
 
-  StatementStats stats{query, conn_};
+  StatementStats stats{query, conn_, &params};
   try {
     auto res = conn_->Execute(query, params, statement_cmd_ctl);
     stats.AccountStatementExecution();
@@ -64,6 +64,13 @@ namespace {
 // TODO move to config
 constexpr bool kVerboseErrors = false;
 
+constexpr const char* kCopyDiscardedMessage = "COPY is discarded by client";
+
+bool IsCopyStatus(ExecStatusType status) {
+  return status == PGRES_COPY_IN || status == PGRES_COPY_OUT ||
+         status == PGRES_COPY_BOTH;
+}
+
 const char* MsgForStatus(ConnStatusType status) {
   switch (status) {
     case CONNECTION_OK:
@@ -510,6 +517,9 @@ bool PGConnectionWrapper::TryConsumeInput(Deadline deadline,
     }
     CheckError<CommandError>("PQconsumeInput", PQconsumeInput(conn_));
     UpdateLastUse();
+    if (first_reply_time_ == std::chrono::steady_clock::time_point{}) {
+      first_reply_time_ = last_use_;
+    }
   }
   return true;
 }
@@ -531,6 +541,7 @@ ResultSet PGConnectionWrapper::WaitResult(Deadline deadline,
                                           const PGresult* description) {
   scope.Reset(scopes::kLibpqWaitResult);
   Flush(deadline);
+  first_reply_time_ = {};
   auto handle = MakeResultHandle(nullptr);
   auto null_res_counter{0};
   do {
@@ -542,8 +553,12 @@ ResultSet PGConnectionWrapper::WaitResult(Deadline deadline,
             << "Query returned several result sets, a result set is discarded";
       }
       auto next_handle = MakeResultHandle(pg_res);
-#if LIBPQ_HAS_PIPELINING
       const auto status = PQresultStatus(pg_res);
+      if (IsCopyStatus(status)) {
+        // libpq returns the COPY status until the COPY is over
+        return MakeResult(std::move(next_handle));
+      }
+#if LIBPQ_HAS_PIPELINING
       if (status == PGRES_PIPELINE_SYNC)
         HandlePipelineSync();
       else if (status != PGRES_PIPELINE_ABORTED)
@@ -582,9 +597,119 @@ Notification PGConnectionWrapper::WaitNotify(Deadline deadline) {
   return result;
 }
 
+std::vector<std::optional<std::string>> PGConnectionWrapper::WaitTextRow(
+    Deadline deadline, tracing::ScopeTime& scope) {
+  scope.Reset(scopes::kLibpqWaitResult);
+  Flush(deadline);
+  auto handle = MakeResultHandle(nullptr);
+  while (auto* pg_res = ReadResult(deadline, nullptr)) {
+    handle = MakeResultHandle(pg_res);
+  }
+  if (!handle || PQresultStatus(handle.get()) != PGRES_TUPLES_OK) {
+    // Throws if the statement failed
+    MakeResult(std::move(handle));
+    return {};
+  }
+
+  std::vector<std::optional<std::string>> row;
+  const auto* res = handle.get();
+  if (PQntuples(res) == 0) return row;
+  const auto fields = PQnfields(res);
+  row.reserve(fields);
+  for (int i = 0; i < fields; ++i) {
+    if (PQgetisnull(res, 0, i)) {
+      row.emplace_back();
+    } else {
+      row.emplace_back(std::string{PQgetvalue(res, 0, i),
+                                   static_cast<std::size_t>(
+                                       PQgetlength(res, 0, i))});
+    }
+  }
+  return row;
+}
+
+void PGConnectionWrapper::WaitCopyStart(Deadline deadline,
+                                        tracing::ScopeTime& scope,
+                                        ExecStatusType expected_status) {
+  scope.Reset(scopes::kLibpqWaitResult);
+  Flush(deadline);
+  auto handle = MakeResultHandle(ReadResult(deadline, nullptr));
+  const auto status =
+      handle ? PQresultStatus(handle.get()) : PGRES_EMPTY_QUERY;
+  if (status == expected_status) return;
+
+  if (IsCopyStatus(status)) {
+    PGCW_LOG_LIMITED_WARNING() << "COPY statement has an unexpected direction";
+    DiscardCopy(deadline, status);
+  }
+  // The rest of the results of the statement are discarded
+  while (auto* pg_res = ReadResult(deadline, nullptr)) {
+    PQclear(pg_res);
+  }
+  if (!IsCopyStatus(status)) {
+    // Throws if the statement failed
+    MakeResult(std::move(handle));
+  }
+  throw LogicError{"Statement is not a COPY of the expected direction"};
+}
+
+void PGConnectionWrapper::PutCopyData(std::string_view data,
+                                      Deadline deadline) {
+  const auto size = static_cast<int>(data.size());
+  auto put_res = PQputCopyData(conn_, data.data(), size);
+  if (put_res == 0) {
+    // The output buffer of libpq is full
+    Flush(deadline);
+    put_res = PQputCopyData(conn_, data.data(), size);
+  }
+  CheckError<CommandError>("PQputCopyData", put_res > 0);
+  // Sending the data right away keeps the memory consumption bounded by the
+  // speed of the connection
+  Flush(deadline);
+}
+
+void PGConnectionWrapper::PutCopyEnd(Deadline deadline,
+                                     tracing::ScopeTime& scope) {
+  scope.Reset(scopes::kLibpqPutCopyEnd);
+  SendCopyEnd(deadline, nullptr);
+}
+
+bool PGConnectionWrapper::GetCopyData(Deadline deadline, std::string& buffer) {
+  const auto result = TryGetCopyData(deadline, buffer);
+  if (!result) {
+    PGCW_LOG_LIMITED_WARNING()
+        << "Timeout while reading COPY data from PostgreSQL connection socket";
+    throw ConnectionTimeoutError("Timed out while reading COPY data");
+  }
+  return *result;
+}
+
+std::optional<bool> PGConnectionWrapper::TryGetCopyData(Deadline deadline,
+                                                        std::string& buffer) {
+  char* data = nullptr;
+  int get_res = 0;
+  while ((get_res = PQgetCopyData(conn_, &data, /* async */ 1)) == 0) {
+    if (!WaitSocketReadable(deadline)) {
+      if (engine::current_task::ShouldCancel()) {
+        throw ConnectionInterrupted("Task cancelled while reading COPY data");
+      }
+      return std::nullopt;
+    }
+    CheckError<CommandError>("PQconsumeInput", PQconsumeInput(conn_));
+    UpdateLastUse();
+  }
+  if (get_res == -1) return false;
+  CheckError<CommandError>("PQgetCopyData", get_res > 0);
+
+  const std::unique_ptr<char, decltype(&PQfreemem)> holder{data, &PQfreemem};
+  buffer.append(data, get_res);
+  return true;
+}
+
 std::vector<ResultSet> PGConnectionWrapper::GatherPipeline(
     [[maybe_unused]] Deadline deadline,
-    const std::vector<const PGresult*>& descriptions) {
+    const std::vector<const PGresult*>& descriptions,
+    [[maybe_unused]] std::vector<std::exception_ptr>* errors) {
   UASSERT(!descriptions.empty());
 
 #if !LIBPQ_HAS_PIPELINING
@@ -628,7 +753,19 @@ std::vector<ResultSet> PGConnectionWrapper::GatherPipeline(
                std::string_view{first_field_name} == kSetConfigQueryResultName;
       }();
       if (!is_set_config_response) {
-        result.push_back(MakeResult(std::move(handle)));
+        if (!errors) {
+          result.push_back(MakeResult(std::move(handle)));
+        } else {
+          try {
+            result.push_back(MakeResult(std::move(handle)));
+            errors->emplace_back();
+          } catch (const std::exception&) {
+            // The connection is closed, the rest of the results are lost
+            if (PQstatus(conn_) == CONNECTION_BAD) throw;
+            result.emplace_back(nullptr);
+            errors->push_back(std::current_exception());
+          }
+        }
       }
     }
 
@@ -655,8 +792,12 @@ void PGConnectionWrapper::DiscardInput(Deadline deadline) {
     while (auto* pg_res = ReadResult(deadline, nullptr)) {
       null_res_counter = 0;
       handle = MakeResultHandle(pg_res);
+      const auto status = PQresultStatus(pg_res);
+      if (IsCopyStatus(status)) {
+        DiscardCopy(deadline, status);
+      }
 #if LIBPQ_HAS_PIPELINING
-      if (PQresultStatus(pg_res) == PGRES_PIPELINE_SYNC) {
+      if (status == PGRES_PIPELINE_SYNC) {
         HandlePipelineSync();
       }
 #endif
@@ -669,6 +810,37 @@ void PGConnectionWrapper::DiscardInput(Deadline deadline) {
   } while (IsSyncingPipeline() && PQstatus(conn_) != CONNECTION_BAD);
 }
 
+void PGConnectionWrapper::SendCopyEnd(Deadline deadline,
+                                      const char* error_message) {
+  auto put_res = PQputCopyEnd(conn_, error_message);
+  if (put_res == 0) {
+    // The output buffer of libpq is full
+    Flush(deadline);
+    put_res = PQputCopyEnd(conn_, error_message);
+  }
+  CheckError<CommandError>("PQputCopyEnd", put_res > 0);
+}
+
+void PGConnectionWrapper::DiscardCopy(Deadline deadline,
+                                      ExecStatusType status) {
+  switch (status) {
+    case PGRES_COPY_IN:
+      PGCW_LOG_LIMITED_WARNING() << "Aborting an unfinished COPY FROM STDIN";
+      SendCopyEnd(deadline, kCopyDiscardedMessage);
+      Flush(deadline);
+      break;
+    case PGRES_COPY_OUT: {
+      PGCW_LOG_LIMITED_WARNING() << "Discarding the rest of COPY TO STDOUT";
+      std::string discarded;
+      while (GetCopyData(deadline, discarded)) discarded.clear();
+      break;
+    }
+    default:
+      PGCW_LOG_LIMITED_ERROR() << "Unexpected COPY state of the connection";
+      CloseWithError(ConnectionError{"Unexpected COPY state"});
+  }
+}
+
 void PGConnectionWrapper::FillSpanTags(tracing::Span& span,
                                        const CommandControl& cc) const {
   // With inheritable tags, they would end up being duplicated in current Span
@@ -711,9 +883,11 @@ ResultSet PGConnectionWrapper::MakeResult(ResultHandle&& handle) {
     case PGRES_COPY_OUT:
     case PGRES_COPY_BOTH:
       PGCW_LOG_LIMITED_ERROR()
-          << "PostgreSQL COPY command invoked which is not implemented"
+          << "PostgreSQL COPY command invoked outside of the COPY interface"
           << logging::LogExtra::Stacktrace();
-      CloseWithError(NotImplemented{"Copy is not implemented"});
+      CloseWithError(NotImplemented{
+          "COPY is only supported with Transaction::CopyIn and "
+          "Transaction::CopyOut"});
     case PGRES_BAD_RESPONSE:
       CloseWithError(ConnectionError{"Failed to parse server response"});
     case PGRES_NONFATAL_ERROR: {
@@ -785,6 +959,14 @@ void PGConnectionWrapper::SendQuery(const std::string& statement,
   UpdateLastUse();
 }
 
+void PGConnectionWrapper::SendSimpleQuery(const std::string& statement,
+                                          tracing::ScopeTime& scope) {
+  scope.Reset(scopes::kLibpqSendQuery);
+  CheckError<CommandError>("PQsendQuery",
+                           PQsendQuery(conn_, statement.c_str()));
+  UpdateLastUse();
+}
+
 void PGConnectionWrapper::SendQuery(const std::string& statement,
                                     const QueryParameters& params,
                                     tracing::ScopeTime& scope) {
@@ -932,6 +1114,11 @@ TimeoutDuration PGConnectionWrapper::GetIdleDuration() const {
       std::chrono::steady_clock::now() - last_use_);
 }
 
+std::chrono::steady_clock::time_point PGConnectionWrapper::GetFirstReplyTime()
+    const {
+  return first_reply_time_;
+}
+
 void PGConnectionWrapper::MarkAsBroken() { is_broken_ = true; }
 
 bool PGConnectionWrapper::IsBroken() const { return is_broken_; }
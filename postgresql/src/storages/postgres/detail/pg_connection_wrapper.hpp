@@ -1,7 +1,11 @@
 #pragma once
 
 #include <chrono>
+#include <exception>
+#include <optional>
+#include <string>
 #include <string_view>
+#include <vector>
 
 #include <libpq-fe.h>
 
@@ -86,6 +90,10 @@ class PGConnectionWrapper {
   void SendQuery(const std::string& statement, const QueryParameters& params,
                  tracing::ScopeTime&);
 
+  /// @brief Wrapper for PQsendQuery, the simple query protocol is the only
+  /// one supported by the replication commands
+  void SendSimpleQuery(const std::string& statement, tracing::ScopeTime&);
+
   /// @brief Wrapper for PQsendPrepare
   void SendPrepare(const std::string& name, const std::string& statement,
                    const QueryParameters& params, tracing::ScopeTime&);
@@ -111,11 +119,46 @@ class PGConnectionWrapper {
   ResultSet WaitResult(Deadline deadline, tracing::ScopeTime&,
                        const PGresult* description);
 
+  /// @brief Wait for the result of SendSimpleQuery
+  /// @returns the values of the first row in the text format, empty if the
+  /// statement returns no rows
+  std::vector<std::optional<std::string>> WaitTextRow(Deadline deadline,
+                                                      tracing::ScopeTime&);
+
   /// @brief Wait for notification
   Notification WaitNotify(Deadline deadline);
 
+  /// @brief Wait for the start of a COPY statement
+  /// @throws LogicError if the statement is not a COPY of the expected
+  /// direction
+  void WaitCopyStart(Deadline deadline, tracing::ScopeTime&,
+                     ExecStatusType expected_status);
+
+  /// @brief Wrapper for PQputCopyData
+  /// Waits for the socket to become writeable while the output buffer of
+  /// libpq is full
+  void PutCopyData(std::string_view data, Deadline deadline);
+
+  /// @brief Wrapper for PQputCopyEnd
+  /// The result of the COPY must be read with WaitResult then
+  void PutCopyEnd(Deadline deadline, tracing::ScopeTime&);
+
+  /// @brief Wrapper for PQgetCopyData
+  /// Appends the next message of the COPY data to the buffer. After the last
+  /// message returns false, the result of the COPY must be read with
+  /// WaitResult then.
+  bool GetCopyData(Deadline deadline, std::string& buffer);
+
+  /// @brief Same as GetCopyData, but returns std::nullopt on the deadline
+  /// instead of throwing, for the streams that are idle most of the time
+  std::optional<bool> TryGetCopyData(Deadline deadline, std::string& buffer);
+
+  /// Reads the results of the queries in the pipeline. If `errors` is not
+  /// null, the errors of the queries are stored there at the indexes of their
+  /// results instead of being thrown, and the results are empty
   std::vector<ResultSet> GatherPipeline(
-      Deadline deadline, const std::vector<const PGresult*>& descriptions);
+      Deadline deadline, const std::vector<const PGresult*>& descriptions,
+      std::vector<std::exception_ptr>* errors = nullptr);
 
   /// Consume input from connection
   void ConsumeInput(Deadline deadline, const PGresult* description);
@@ -135,6 +178,10 @@ class PGConnectionWrapper {
 
   TimeoutDuration GetIdleDuration() const;
 
+  /// Time when the first bytes of the last WaitResult() reply were received,
+  /// the default value if the reply was already buffered
+  std::chrono::steady_clock::time_point GetFirstReplyTime() const;
+
   void MarkAsBroken();
 
   bool IsBroken() const;
@@ -170,6 +217,12 @@ class PGConnectionWrapper {
 
   ResultSet MakeResult(ResultHandle&& handle);
 
+  /// Wrapper for PQputCopyEnd, the COPY fails if error_message is not null
+  void SendCopyEnd(Deadline deadline, const char* error_message);
+
+  /// Leaves the COPY state of the connection discarding the data
+  void DiscardCopy(Deadline deadline, ExecStatusType status);
+
   template <typename ExceptionType>
   void CheckError(const std::string& cmd, int pg_dispatch_result);
 
@@ -190,6 +243,7 @@ class PGConnectionWrapper {
   logging::LogExtra log_extra_;
   engine::SemaphoreLock pool_size_lock_;
   std::chrono::steady_clock::time_point last_use_;
+  std::chrono::steady_clock::time_point first_reply_time_;
   size_t pipeline_sync_counter_{0};
   bool is_broken_{false};
 };
@@ -0,0 +1,238 @@
+#include <storages/postgres/detail/pgoutput.hpp>
+
+#include <algorithm>
+#include <cstring>
+#include <string>
+
+#include <boost/endian/conversion.hpp>
+
+#include <userver/storages/postgres/exceptions.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace storages::postgres::detail {
+
+namespace {
+
+class MessageReader final {
+ public:
+  explicit MessageReader(std::string_view data) : data_{data} {}
+
+  char ReadByte() {
+    Ensure(1);
+    const char value = data_.front();
+    data_.remove_prefix(1);
+    return value;
+  }
+
+  template <typename T>
+  T ReadInteger() {
+    Ensure(sizeof(T));
+    T value{};
+    std::memcpy(&value, data_.data(), sizeof(T));
+    data_.remove_prefix(sizeof(T));
+    return boost::endian::big_to_native(value);
+  }
+
+  std::string_view ReadString() {
+    const auto end = data_.find('\0');
+    if (end == std::string_view::npos) {
+      throw InvalidBinaryBuffer{"Unterminated string in a pgoutput message"};
+    }
+    const auto value = data_.substr(0, end);
+    data_.remove_prefix(end + 1);
+    return value;
+  }
+
+  std::string_view ReadBytes(std::size_t size) {
+    Ensure(size);
+    const auto value = data_.substr(0, size);
+    data_.remove_prefix(size);
+    return value;
+  }
+
+ private:
+  void Ensure(std::size_t size) const {
+    if (data_.size() < size) {
+      throw InvalidBinaryBuffer{"Truncated pgoutput message"};
+    }
+  }
+
+  std::string_view data_;
+};
+
+ReplicationTuple ReadTuple(MessageReader& reader) {
+  using Kind = ReplicationTuple::ColumnKind;
+
+  ReplicationTuple tuple;
+  const auto count = reader.ReadInteger<std::int16_t>();
+  for (std::int16_t i = 0; i < count; ++i) {
+    const auto kind = reader.ReadByte();
+    switch (kind) {
+      case 'n':
+        tuple.AddColumn(Kind::kNull, {});
+        break;
+      case 'u':
+        tuple.AddColumn(Kind::kUnchangedToast, {});
+        break;
+      case 't':
+      case 'b': {
+        const auto size = reader.ReadInteger<std::int32_t>();
+        if (size < 0) {
+          throw InvalidBinaryBuffer{"Negative size of a pgoutput column"};
+        }
+        tuple.AddColumn(kind == 'b' ? Kind::kBinary : Kind::kText,
+                        reader.ReadBytes(size));
+        break;
+      }
+      default:
+        throw InvalidBinaryBuffer{"Unexpected kind of a pgoutput column"};
+    }
+  }
+  return tuple;
+}
+
+// 'N' for the new row, 'K' for the key and 'O' for the whole old row
+void ExpectTupleType(char type, std::string_view expected) {
+  if (expected.find(type) == std::string_view::npos) {
+    throw InvalidBinaryBuffer{"Unexpected type of a pgoutput row"};
+  }
+}
+
+void CheckTupleSize(const ReplicationTuple& tuple,
+                    const ReplicationRelation& relation) {
+  if (tuple.Size() != relation.columns.size()) {
+    throw InvalidBinaryBuffer{
+        "Number of the columns of a pgoutput row does not match the relation "
+        "of " +
+        relation.name};
+  }
+}
+
+}  // namespace
+
+std::optional<ReplicationTransaction> PgOutputDecoder::Decode(
+    std::string_view message) {
+  MessageReader reader{message};
+  const auto type = reader.ReadByte();
+
+  if (type == 'B') {
+    // The final LSN, the commit timestamp and the xid are not used
+    transaction_.emplace();
+    return std::nullopt;
+  }
+  if (type == 'C') {
+    // Flags, unused
+    reader.ReadByte();
+    if (!transaction_) {
+      throw InvalidBinaryBuffer{"pgoutput commit without a begin"};
+    }
+    auto result = std::move(*transaction_);
+    transaction_.reset();
+    result.commit_lsn = reader.ReadInteger<std::uint64_t>();
+    result.end_lsn = reader.ReadInteger<std::uint64_t>();
+    return result;
+  }
+  if (type == 'R') {
+    auto relation = std::make_shared<ReplicationRelation>();
+    relation->oid = reader.ReadInteger<Oid>();
+    relation->schema = reader.ReadString();
+    if (relation->schema.empty()) relation->schema = "pg_catalog";
+    relation->name = reader.ReadString();
+    // Replica identity setting
+    reader.ReadByte();
+    const auto count = reader.ReadInteger<std::int16_t>();
+    relation->columns.reserve(std::max<std::int16_t>(count, 0));
+    for (std::int16_t i = 0; i < count; ++i) {
+      auto& column = relation->columns.emplace_back();
+      column.is_key = reader.ReadByte() & 1;
+      column.name = reader.ReadString();
+      column.type_oid = reader.ReadInteger<Oid>();
+      // Type modifier
+      reader.ReadInteger<std::int32_t>();
+    }
+    relations_[relation->oid] = std::move(relation);
+    return std::nullopt;
+  }
+  if (type == 'O' || type == 'Y' || type == 'M') {
+    // Origin, type and logical decoding messages are of no interest
+    return std::nullopt;
+  }
+
+  if (!transaction_) {
+    throw InvalidBinaryBuffer{"pgoutput change outside of a transaction"};
+  }
+  auto& changes = transaction_->changes;
+  switch (type) {
+    case 'I': {
+      auto& change = changes.emplace_back();
+      change.type = ReplicationChange::Type::kInsert;
+      change.relation = GetRelation(reader.ReadInteger<Oid>());
+      ExpectTupleType(reader.ReadByte(), "N");
+      change.new_row = ReadTuple(reader);
+      CheckTupleSize(change.new_row, *change.relation);
+      break;
+    }
+    case 'U': {
+      auto& change = changes.emplace_back();
+      change.type = ReplicationChange::Type::kUpdate;
+      change.relation = GetRelation(reader.ReadInteger<Oid>());
+      auto tuple_type = reader.ReadByte();
+      ExpectTupleType(tuple_type, "KON");
+      if (tuple_type != 'N') {
+        change.old_row = ReadTuple(reader);
+        CheckTupleSize(*change.old_row, *change.relation);
+        ExpectTupleType(reader.ReadByte(), "N");
+      }
+      change.new_row = ReadTuple(reader);
+      CheckTupleSize(change.new_row, *change.relation);
+      if (tuple_type == 'O') {
+        for (std::size_t i = 0; i < change.new_row.Size(); ++i) {
+          if (change.new_row.GetKind(i) ==
+              ReplicationTuple::ColumnKind::kUnchangedToast) {
+            change.new_row.SetColumn(i, *change.old_row);
+          }
+        }
+      }
+      break;
+    }
+    case 'D': {
+      auto& change = changes.emplace_back();
+      change.type = ReplicationChange::Type::kDelete;
+      change.relation = GetRelation(reader.ReadInteger<Oid>());
+      ExpectTupleType(reader.ReadByte(), "KO");
+      change.old_row = ReadTuple(reader);
+      CheckTupleSize(*change.old_row, *change.relation);
+      break;
+    }
+    case 'T': {
+      const auto count = reader.ReadInteger<std::int32_t>();
+      // Options, CASCADE and RESTART IDENTITY
+      reader.ReadByte();
+      for (std::int32_t i = 0; i < count; ++i) {
+        auto& change = changes.emplace_back();
+        change.type = ReplicationChange::Type::kTruncate;
+        change.relation = GetRelation(reader.ReadInteger<Oid>());
+      }
+      break;
+    }
+    default:
+      throw InvalidBinaryBuffer{std::string{"Unexpected pgoutput message '"} +
+                                type + '\''};
+  }
+  return std::nullopt;
+}
+
+const std::shared_ptr<const ReplicationRelation>& PgOutputDecoder::GetRelation(
+    Oid oid) const {
+  const auto it = relations_.find(oid);
+  if (it == relations_.end()) {
+    throw InvalidBinaryBuffer{"pgoutput change of an unknown relation " +
+                              std::to_string(oid)};
+  }
+  return it->second;
+}
+
+}  // namespace storages::postgres::detail
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,35 @@
+#pragma once
+
+#include <memory>
+#include <optional>
+#include <string_view>
+#include <unordered_map>
+
+#include <userver/storages/postgres/replication.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace storages::postgres::detail {
+
+/// Decoder of the messages of the `pgoutput` logical decoding plugin,
+/// protocol version 1.
+/// https://www.postgresql.org/docs/current/protocol-logicalrep-message-formats.html
+class PgOutputDecoder final {
+ public:
+  /// @brief Decodes the message, the payload of an XLogData message of the
+  /// replication protocol.
+  /// @returns the transaction when its commit message is decoded
+  /// @throws InvalidBinaryBuffer on a malformed or an unexpected message
+  std::optional<ReplicationTransaction> Decode(std::string_view message);
+
+ private:
+  const std::shared_ptr<const ReplicationRelation>& GetRelation(Oid oid) const;
+
+  std::unordered_map<Oid, std::shared_ptr<const ReplicationRelation>>
+      relations_;
+  std::optional<ReplicationTransaction> transaction_;
+};
+
+}  // namespace storages::postgres::detail
+
+USERVER_NAMESPACE_END
@@ -1,5 +1,9 @@
 #include <storages/postgres/detail/pool.hpp>
 
+#include <optional>
+#include <string>
+#include <vector>
+
 #include <storages/postgres/deadline.hpp>
 #include <storages/postgres/detail/cc_config.hpp>
 #include <storages/postgres/detail/statement_stats_storage.hpp>
@@ -36,15 +40,66 @@ constexpr std::chrono::seconds kMaintainInterval{30};
 constexpr std::chrono::seconds kMaxIdleDuration{15};
 constexpr const char* kMaintainTaskName = "pg_maintain";
 
+constexpr std::chrono::seconds kAdaptiveSizeInterval{1};
+constexpr std::chrono::seconds kAdaptiveSizeWaitPeriod{5};
+constexpr const char* kAdaptiveSizeTaskName = "pg_adaptive_size";
+constexpr double kAdaptiveSizeWaitPercentile = 95;
+
 constexpr std::chrono::seconds kConnectingTimeout{2};
 constexpr auto kPendingConnectsMax{1};
 
 // Max idle connections that can be dropped in one run of maintenance task
 constexpr auto kIdleDropLimit = 1;
 
+// Weight of the previous value in the query latency moving average
+constexpr std::int64_t kLatencyEwmaWeight = 8;
+
 // Practically unlimited number on concurrent establishing connections
 constexpr auto kUnlimitedConnecting = std::numeric_limits<std::size_t>::max();
 
+constexpr std::string_view kExplainPrefix = "EXPLAIN (ANALYZE, FORMAT TEXT) ";
+
+// Copy of the query parameters for a background execution
+class OwnedQueryParameters {
+ public:
+  explicit OwnedQueryParameters(const QueryParameters& params)
+      : types_(params.ParamTypesBuffer(),
+               params.ParamTypesBuffer() + params.Size()),
+        lengths_(params.ParamLengthsBuffer(),
+                 params.ParamLengthsBuffer() + params.Size()),
+        formats_(params.ParamFormatsBuffer(),
+                 params.ParamFormatsBuffer() + params.Size()) {
+    values_.reserve(params.Size());
+    for (std::size_t i = 0; i < params.Size(); ++i) {
+      const auto* value = params.ParamBuffers()[i];
+      values_.emplace_back(value ? std::optional<std::string>{std::in_place,
+                                                              value,
+                                                              lengths_[i]}
+                                 : std::nullopt);
+    }
+    buffers_.reserve(values_.size());
+    for (const auto& value : values_) {
+      buffers_.push_back(value ? value->data() : nullptr);
+    }
+  }
+
+  OwnedQueryParameters(OwnedQueryParameters&&) = delete;
+  OwnedQueryParameters& operator=(OwnedQueryParameters&&) = delete;
+
+  std::size_t Size() const { return types_.size(); }
+  const char* const* ParamBuffers() const { return buffers_.data(); }
+  const Oid* ParamTypesBuffer() const { return types_.data(); }
+  const int* ParamLengthsBuffer() const { return lengths_.data(); }
+  const int* ParamFormatsBuffer() const { return formats_.data(); }
+
+ private:
+  std::vector<Oid> types_;
+  std::vector<int> lengths_;
+  std::vector<int> formats_;
+  std::vector<std::optional<std::string>> values_;
+  std::vector<const char*> buffers_;
+};
+
 class Stopwatch {
  public:
   using Accumulator = USERVER_NAMESPACE::utils::statistics::RecentPeriod<
@@ -76,13 +131,16 @@ ConnectionPool::ConnectionPool(
     const testsuite::PostgresControl& testsuite_pg_ctl,
     error_injection::Settings ei_settings,
     const congestion_control::v2::LinearController::StaticConfig& cc_config,
-    dynamic_config::Source config_source)
+    dynamic_config::Source config_source,
+    std::shared_ptr<StatementRegistry> statement_registry)
     : dsn_{std::move(dsn)},
       resolver_{resolver},
       db_name_{db_name},
       settings_{settings},
       conn_settings_{conn_settings},
+      statement_registry_{std::move(statement_registry)},
       bg_task_processor_{bg_task_processor},
+      size_controller_{settings.max_size},
       queue_{settings.max_size},
       size_semaphore_{settings.max_size},
       connecting_semaphore_{settings.connecting_limit
@@ -111,6 +169,7 @@ ConnectionPool::ConnectionPool(
 ConnectionPool::~ConnectionPool() {
   StopMaintainTask();
   StopConnectTasks();
+  explain_task_storage_.CancelAndWait();
   Clear();
 }
 
@@ -124,14 +183,15 @@ std::shared_ptr<ConnectionPool> ConnectionPool::Create(
     const testsuite::PostgresControl& testsuite_pg_ctl,
     error_injection::Settings ei_settings,
     const congestion_control::v2::LinearController::StaticConfig& cc_config,
-    dynamic_config::Source config_source) {
+    dynamic_config::Source config_source,
+    std::shared_ptr<StatementRegistry> statement_registry) {
   // FP?: pointer magic in boost.lockfree
   // NOLINTNEXTLINE(clang-analyzer-cplusplus.NewDeleteLeaks)
   auto impl = std::make_shared<ConnectionPool>(
       EmplaceEnabler{}, std::move(dsn), resolver, bg_task_processor, db_name,
       pool_settings, conn_settings, statement_metrics_settings,
       default_cmd_ctls, testsuite_pg_ctl, std::move(ei_settings), cc_config,
-      config_source);
+      config_source, std::move(statement_registry));
   // Init() uses shared_from_this for connections and cannot be called from
   // ctor
   impl->Init(init_mode);
@@ -234,6 +294,24 @@ void ConnectionPool::AccountConnectionStats(Connection::Statistics conn_stats) {
   stats_.transaction.execute_timeout += conn_stats.execute_timeout;
   stats_.transaction.duplicate_prepared_statements +=
       conn_stats.duplicate_prepared_statements;
+  stats_.transaction.prepared_cache_hit_total +=
+      conn_stats.prepared_cache_hit_total;
+  stats_.transaction.prepared_cache_miss_total +=
+      conn_stats.prepared_cache_miss_total;
+  stats_.transaction.prepared_warmup_total += conn_stats.prepared_warmup_total;
+
+  if (conn_stats.execute_total > 0) {
+    const auto latency =
+        std::chrono::duration_cast<std::chrono::microseconds>(
+            conn_stats.sum_query_duration)
+            .count() /
+        static_cast<std::int64_t>(conn_stats.execute_total);
+    auto ewma = latency_ewma_us_.load(std::memory_order_relaxed);
+    while (!latency_ewma_us_.compare_exchange_weak(
+        ewma, ewma ? ewma + (latency - ewma) / kLatencyEwmaWeight : latency,
+        std::memory_order_relaxed)) {
+    }
+  }
 
   stats_.transaction.total_percentile.GetCurrentCounter().Account(
       std::chrono::duration_cast<std::chrono::milliseconds>(
@@ -330,6 +408,64 @@ NotifyScope ConnectionPool::Listen(std::string_view channel,
   return NotifyScope{std::move(conn), channel, cmd_ctl};
 }
 
+ReplicationStream ConnectionPool::CreateReplicationStream(
+    ReplicationSettings settings, OptionalCommandControl cmd_ctl) {
+  const auto deadline =
+      testsuite_pg_ctl_.MakeExecuteDeadline(GetExecuteTimeout(cmd_ctl));
+  // The replication connection does not load the user types, they are taken
+  // from a connection of the pool
+  io::TypeBufferCategory categories;
+  {
+    auto conn = Acquire(deadline);
+    UASSERT(conn);
+    categories = conn->GetUserTypes().GetTypeBufferCategories();
+  }
+  const auto dsn =
+      resolver_ ? ResolveDsnHostaddrs(dsn_, *resolver_, deadline) : dsn_;
+  return ReplicationStream{dsn, bg_task_processor_, std::move(categories),
+                           std::move(settings), deadline};
+}
+
+void ConnectionPool::ExplainStatement(const Query& query,
+                                      const QueryParameters& params) {
+  // A single sample at a time, they are expensive
+  if (explain_in_flight_.exchange(true)) return;
+
+  explain_task_storage_.Detach(engine::AsyncNoSpan(
+      [this, query = Query{std::string{kExplainPrefix} + query.Statement(),
+                           query.GetName()},
+       params = std::make_unique<OwnedQueryParameters>(params)] {
+        try {
+          DoExplainStatement(query, QueryParameters{*params});
+        } catch (const std::exception& e) {
+          LOG_LIMITED_WARNING()
+              << "Failed to explain slow statement '"
+              << query.GetName()->GetUnderlying() << "': " << e;
+        }
+        explain_in_flight_ = false;
+      }));
+}
+
+void ConnectionPool::DoExplainStatement(const Query& query,
+                                        const QueryParameters& params) {
+  const auto cmd_ctl = GetDefaultCommandControl();
+  auto conn = Acquire(testsuite_pg_ctl_.MakeExecuteDeadline(cmd_ctl.execute));
+  UASSERT(conn);
+  // The statement might modify the data, EXPLAIN (ANALYZE) executes it
+  conn->Begin(TransactionOptions{}, SteadyClock::now());
+  const auto res = conn->Execute(query, params);
+  conn->Rollback();
+
+  std::string plan;
+  for (const auto& row : res) {
+    plan += row[0].As<std::string>();
+    plan += '\n';
+  }
+  LOG_WARNING() << "Plan of slow statement '"
+                << query.GetName()->GetUnderlying() << "':\n"
+                << plan;
+}
+
 TimeoutDuration ConnectionPool::GetExecuteTimeout(
     OptionalCommandControl cmd_ctl) const {
   if (cmd_ctl) return cmd_ctl->execute;
@@ -349,7 +485,9 @@ void ConnectionPool::SetSettings(const PoolSettings& settings) {
 
   auto reader = settings_.Read();
   if (*reader == settings) return;
-  if (reader->max_size != max_connections) {
+  // The capacity of an adaptive pool is updated by AdaptPoolSize()
+  if (!settings.adaptive_size && (reader->max_size != max_connections ||
+                                  reader->adaptive_size)) {
     size_semaphore_.SetCapacity(max_connections);
   }
   if (reader->connecting_limit != settings.connecting_limit)
@@ -389,6 +527,15 @@ dynamic_config::Source ConnectionPool::GetConfigSource() const {
   return config_source_;
 }
 
+std::size_t ConnectionPool::GetInFlightCount() const {
+  return stats_.connection.used + wait_count_.load(std::memory_order_relaxed);
+}
+
+std::chrono::microseconds ConnectionPool::GetLatencyEwma() const {
+  return std::chrono::microseconds{
+      latency_ewma_us_.load(std::memory_order_relaxed)};
+}
+
 engine::TaskWithResult<bool> ConnectionPool::Connect(
     engine::SemaphoreLock lock) {
   return engine::AsyncNoSpan([this, size_lock = std::move(lock)]() mutable {
@@ -442,6 +589,12 @@ bool ConnectionPool::DoConnect(engine::SemaphoreLock size_lock) {
   // Clean up the statistics and not account it
   [[maybe_unused]] const auto& stats = connection->GetStatsAndReset();
 
+  if (statement_registry_) {
+    connection->SetStatementRegistry(statement_registry_.get());
+    // Accounted with the statistics of the first use
+    connection->WarmUpPreparedStatements();
+  }
+
   Push(connection.release());
   return true;
 }
@@ -695,9 +848,15 @@ void ConnectionPool::StartMaintainTask() {
 
   ping_task_.Start(kMaintainTaskName, {kMaintainInterval, Flags::kStrong},
                    [this] { MaintainConnections(); });
+  adaptive_size_task_.Start(kAdaptiveSizeTaskName,
+                            {kAdaptiveSizeInterval, Flags::kStrong},
+                            [this] { AdaptPoolSize(); });
 }
 
-void ConnectionPool::StopMaintainTask() { ping_task_.Stop(); }
+void ConnectionPool::StopMaintainTask() {
+  adaptive_size_task_.Stop();
+  ping_task_.Stop();
+}
 
 void ConnectionPool::StopConnectTasks() {
   const auto task_count = connect_task_storage_.ActiveTasksApprox();
@@ -708,6 +867,61 @@ void ConnectionPool::StopConnectTasks() {
   connect_task_storage_.CancelAndWait();
 }
 
+void ConnectionPool::AdaptPoolSize() {
+  auto settings = settings_.Read();
+  if (!settings->adaptive_size) {
+    stats_.connection.adaptive_target = 0;
+    return;
+  }
+
+  const auto active = size_semaphore_.UsedApprox();
+  const std::size_t used = stats_.connection.used;
+  const auto acquire_wait =
+      stats_.acquire_percentile.GetStatsForPeriod(kAdaptiveSizeWaitPeriod, true)
+          .GetPercentile(kAdaptiveSizeWaitPercentile);
+  const PoolSizeController::Sample sample{
+      std::chrono::milliseconds{acquire_wait},
+      wait_count_.load(std::memory_order_relaxed),
+      active > used ? active - used : 0};
+
+  const auto decision = size_controller_.Update(*settings, sample);
+  const auto target = size_controller_.GetTargetSize();
+  if (stats_.connection.adaptive_target != target) {
+    size_semaphore_.SetCapacity(target);
+    stats_.connection.adaptive_target = target;
+  }
+
+  switch (decision) {
+    case PoolSizeController::Decision::kGrow:
+      ++stats_.connection.adaptive_grow_total;
+      LOG_INFO() << "Adaptive pool size of `" << DsnCutPassword(dsn_)
+                 << "` is increased to " << target << ", acquire wait is "
+                 << acquire_wait << "ms, " << sample.waiting
+                 << " clients are waiting";
+      break;
+    case PoolSizeController::Decision::kShrink:
+      ++stats_.connection.adaptive_shrink_total;
+      LOG_INFO() << "Adaptive pool size of `" << DsnCutPassword(dsn_)
+                 << "` is decreased to " << target << ", " << sample.idle
+                 << " connections are idle";
+      break;
+    case PoolSizeController::Decision::kKeep:
+      break;
+  }
+
+  if (active > target) {
+    DropIdleConnections(active - target);
+  }
+}
+
+void ConnectionPool::DropIdleConnections(std::size_t count) {
+  Connection* connection = nullptr;
+  for (; count > 0 && queue_.pop(connection); --count) {
+    LOG_DEBUG() << "Drop idle connection above the adaptive pool size";
+    DeleteConnection(connection);
+  }
+}
+
 void ConnectionPool::CheckUserTypes() {
   try {
     auto conn = Acquire(engine::Deadline::FromDuration(kConnectingTimeout));
@@ -1,6 +1,8 @@
 #pragma once
 
 #include <atomic>
+#include <chrono>
+#include <cstdint>
 #include <memory>
 #include <vector>
 
@@ -28,11 +30,14 @@
 #include <userver/storages/postgres/detail/non_transaction.hpp>
 #include <userver/storages/postgres/notify.hpp>
 #include <userver/storages/postgres/options.hpp>
+#include <userver/storages/postgres/replication.hpp>
 #include <userver/storages/postgres/statistics.hpp>
 #include <userver/storages/postgres/transaction.hpp>
 
 #include <storages/postgres/detail/connection.hpp>
 #include <storages/postgres/detail/pg_impl_types.hpp>
+#include <storages/postgres/detail/pool_size_controller.hpp>
+#include <storages/postgres/detail/statement_registry.hpp>
 #include <storages/postgres/detail/statement_stats_storage.hpp>
 
 USERVER_NAMESPACE_BEGIN
@@ -52,7 +57,8 @@ class ConnectionPool : public std::enable_shared_from_this<ConnectionPool> {
       const testsuite::PostgresControl& testsuite_pg_ctl,
       error_injection::Settings ei_settings,
       const congestion_control::v2::LinearController::StaticConfig& cc_config,
-      dynamic_config::Source config_source);
+      dynamic_config::Source config_source,
+      std::shared_ptr<StatementRegistry> statement_registry = {});
 
   ~ConnectionPool();
 
@@ -66,7 +72,8 @@ class ConnectionPool : public std::enable_shared_from_this<ConnectionPool> {
       const testsuite::PostgresControl& testsuite_pg_ctl,
       error_injection::Settings ei_settings,
       const congestion_control::v2::LinearController::StaticConfig& cc_config,
-      dynamic_config::Source config_source);
+      dynamic_config::Source config_source,
+      std::shared_ptr<StatementRegistry> statement_registry = {});
 
   [[nodiscard]] ConnectionPtr Acquire(engine::Deadline);
   void Release(Connection* connection);
@@ -80,6 +87,9 @@ class ConnectionPool : public std::enable_shared_from_this<ConnectionPool> {
   NotifyScope Listen(std::string_view channel,
                      OptionalCommandControl cmd_ctl = {});
 
+  ReplicationStream CreateReplicationStream(
+      ReplicationSettings settings, OptionalCommandControl cmd_ctl = {});
+
   CommandControl GetDefaultCommandControl() const;
 
   void SetSettings(const PoolSettings& settings);
@@ -92,10 +102,21 @@ class ConnectionPool : public std::enable_shared_from_this<ConnectionPool> {
     return sts_;
   }
 
+  /// Logs the `EXPLAIN (ANALYZE)` plan of the statement, executed on another
+  /// connection in a rolled back transaction in background. Does nothing if
+  /// another statement is being explained.
+  void ExplainStatement(const Query& query, const QueryParameters& params);
+
   void SetMaxConnectionsCc(std::size_t max_connections);
 
   dynamic_config::Source GetConfigSource() const;
 
+  /// Number of the clients using or waiting for a connection
+  std::size_t GetInFlightCount() const;
+
+  /// Exponentially weighted moving average of the query latency
+  std::chrono::microseconds GetLatencyEwma() const;
+
  private:
   using SizeGuard = USERVER_NAMESPACE::utils::SizeGuard<std::atomic<size_t>>;
 
@@ -128,8 +149,13 @@ class ConnectionPool : public std::enable_shared_from_this<ConnectionPool> {
   void StopMaintainTask();
   void StopConnectTasks();
 
+  void AdaptPoolSize();
+  void DropIdleConnections(std::size_t count);
+
   void CheckUserTypes();
 
+  void DoExplainStatement(const Query& query, const QueryParameters& params);
+
   using RecentCounter = USERVER_NAMESPACE::utils::statistics::RecentPeriod<
       USERVER_NAMESPACE::utils::statistics::RelaxedCounter<size_t>, size_t>;
 
@@ -139,16 +165,23 @@ class ConnectionPool : public std::enable_shared_from_this<ConnectionPool> {
   std::string db_name_;
   rcu::Variable<PoolSettings> settings_;
   rcu::Variable<ConnectionSettings> conn_settings_;
+  // Outlives the connections
+  const std::shared_ptr<StatementRegistry> statement_registry_;
   engine::TaskProcessor& bg_task_processor_;
   concurrent::BackgroundTaskStorageCore connect_task_storage_;
   concurrent::BackgroundTaskStorageCore close_task_storage_;
+  concurrent::BackgroundTaskStorageCore explain_task_storage_;
+  std::atomic<bool> explain_in_flight_{false};
   USERVER_NAMESPACE::utils::PeriodicTask ping_task_;
+  USERVER_NAMESPACE::utils::PeriodicTask adaptive_size_task_;
+  PoolSizeController size_controller_;
   engine::Mutex wait_mutex_;
   engine::ConditionVariable conn_available_;
   boost::lockfree::queue<Connection*> queue_;
   engine::Semaphore size_semaphore_;
   engine::Semaphore connecting_semaphore_;
   std::atomic<size_t> wait_count_;
+  std::atomic<std::int64_t> latency_ewma_us_{0};
   DefaultCommandControls default_cmd_ctls_;
   testsuite::PostgresControl testsuite_pg_ctl_;
   const error_injection::Settings ei_settings_;
@@ -0,0 +1,68 @@
+#include <storages/postgres/detail/pool_size_controller.hpp>
+
+#include <algorithm>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace storages::postgres::detail {
+
+namespace {
+
+// Part of the [min_size, max_size] range the pool grows by at once
+constexpr std::size_t kGrowRatio = 4;
+
+}  // namespace
+
+PoolSizeController::PoolSizeController(std::size_t initial_size)
+    : target_size_{initial_size} {}
+
+PoolSizeController::Decision PoolSizeController::Update(
+    const PoolSettings& settings, const Sample& sample) {
+  target_size_ =
+      std::clamp(target_size_, settings.min_size, settings.max_size);
+
+  const bool long_wait = sample.waiting > 0 ||
+                         sample.acquire_wait >= settings.adaptive_grow_wait;
+  const bool short_wait = sample.acquire_wait * 2 < settings.adaptive_grow_wait;
+
+  if (long_wait) {
+    shrink_streak_ = 0;
+    if (++grow_streak_ < kGrowSamples || target_size_ == settings.max_size) {
+      return Decision::kKeep;
+    }
+    const auto step = std::max(
+        std::size_t{1}, (settings.max_size - settings.min_size) / kGrowRatio);
+    target_size_ = std::min(target_size_ + step, settings.max_size);
+    ResetStreaks();
+    return Decision::kGrow;
+  }
+
+  if (short_wait && sample.idle > 0) {
+    grow_streak_ = 0;
+    min_idle_ = shrink_streak_ ? std::min(min_idle_, sample.idle) : sample.idle;
+    if (++shrink_streak_ < kShrinkSamples ||
+        target_size_ == settings.min_size) {
+      return Decision::kKeep;
+    }
+    // Keep some of the spare connections for the bursts
+    const auto step = std::max(std::size_t{1}, min_idle_ / 2);
+    target_size_ = std::max(target_size_ - std::min(step, target_size_),
+                            settings.min_size);
+    ResetStreaks();
+    return Decision::kShrink;
+  }
+
+  // Between the thresholds
+  ResetStreaks();
+  return Decision::kKeep;
+}
+
+void PoolSizeController::ResetStreaks() {
+  grow_streak_ = 0;
+  shrink_streak_ = 0;
+  min_idle_ = 0;
+}
+
+}  // namespace storages::postgres::detail
+
+USERVER_NAMESPACE_END
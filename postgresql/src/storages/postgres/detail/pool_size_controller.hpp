@@ -0,0 +1,57 @@
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+
+#include <userver/storages/postgres/options.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace storages::postgres::detail {
+
+/// @brief Decides on the target size of an adaptive connection pool.
+///
+/// The pool grows when the connections are waited for longer than
+/// PoolSettings::adaptive_grow_wait and shrinks when the wait time is below
+/// the half of it while some connections stay idle for a long time. The gap
+/// between the thresholds and the number of consecutive samples required for
+/// a decision keep the size from flapping.
+///
+/// Not thread-safe, is expected to be updated from a single periodic task.
+class PoolSizeController final {
+ public:
+  enum class Decision { kKeep, kGrow, kShrink };
+
+  struct Sample {
+    /// 95th percentile of the acquire wait time over the recent period
+    std::chrono::milliseconds acquire_wait{0};
+    /// Number of the clients waiting for a connection
+    std::size_t waiting{0};
+    /// Number of the idle connections in the pool
+    std::size_t idle{0};
+  };
+
+  /// Number of consecutive samples with long waits to grow the pool
+  static constexpr std::size_t kGrowSamples = 2;
+  /// Number of consecutive samples with idle connections to shrink the pool
+  static constexpr std::size_t kShrinkSamples = 30;
+
+  explicit PoolSizeController(std::size_t initial_size);
+
+  Decision Update(const PoolSettings& settings, const Sample& sample);
+
+  std::size_t GetTargetSize() const { return target_size_; }
+
+ private:
+  void ResetStreaks();
+
+  std::size_t target_size_;
+  std::size_t grow_streak_{0};
+  std::size_t shrink_streak_{0};
+  // Minimal number of idle connections over the shrink streak
+  std::size_t min_idle_{0};
+};
+
+}  // namespace storages::postgres::detail
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,152 @@
+#include <storages/postgres/detail/result_cache.hpp>
+
+#include <algorithm>
+#include <mutex>
+
+#include <userver/utils/assert.hpp>
+
+#include <storages/postgres/detail/result_wrapper.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace storages::postgres::detail {
+
+namespace {
+
+// Separates the query name from the rest of the key
+constexpr char kNameDelimiter = '\0';
+
+template <typename T>
+void AppendBinary(std::string& key, const T& value) {
+  key.append(reinterpret_cast<const char*>(&value), sizeof(value));
+}
+
+bool StartsWithName(const std::string& key, std::string_view query_name) {
+  return key.size() > query_name.size() &&
+         key.compare(0, query_name.size(), query_name) == 0 &&
+         key[query_name.size()] == kNameDelimiter;
+}
+
+}  // namespace
+
+ResultCache::ResultCache(const ResultCacheSettings& settings)
+    : settings_{settings},
+      suspended_{!settings_.invalidation_channel.empty()} {}
+
+bool ResultCache::IsCached(const Query& query) const {
+  if (settings_.queries.empty() || settings_.ttl.count() <= 0) return false;
+  const auto& name = query.GetName();
+  return name && settings_.queries.count(name->GetUnderlying()) != 0;
+}
+
+std::string ResultCache::MakeKey(ClusterHostTypeFlags flags,
+                                 const Query& query,
+                                 const QueryParameters& params) {
+  UASSERT(query.GetName());
+  const auto& name = query.GetName()->GetUnderlying();
+
+  std::size_t size = name.size() + 1 + sizeof(flags.GetValue());
+  for (std::size_t i = 0; i < params.Size(); ++i) {
+    size += sizeof(Oid) + sizeof(int) +
+            std::max(params.ParamLengthsBuffer()[i], 0);
+  }
+
+  std::string key;
+  key.reserve(size);
+  key.append(name);
+  key.push_back(kNameDelimiter);
+  AppendBinary(key, flags.GetValue());
+  for (std::size_t i = 0; i < params.Size(); ++i) {
+    const auto length = params.ParamLengthsBuffer()[i];
+    AppendBinary(key, params.ParamTypesBuffer()[i]);
+    AppendBinary(key, length);
+    if (length > 0) key.append(params.ParamBuffers()[i], length);
+  }
+  return key;
+}
+
+std::optional<ResultSet> ResultCache::Get(const std::string& key) {
+  std::lock_guard lock{mutex_};
+  const auto it = entries_.find(key);
+  if (it == entries_.end()) return std::nullopt;
+  if (it->second.expires_at <= SteadyClock::now()) {
+    Erase(it);
+    return std::nullopt;
+  }
+  lru_.splice(lru_.begin(), lru_, it->second.lru_it);
+  return it->second.result;
+}
+
+ResultCache::Generation ResultCache::GetGeneration() const {
+  return generation_.load();
+}
+
+void ResultCache::Put(std::string&& key, const ResultSet& result,
+                      Generation generation) {
+  if (suspended_.load()) return;
+
+  const auto size = key.size() + result.pimpl_->DataSize();
+  if (size > settings_.max_bytes) return;
+  const auto expires_at = SteadyClock::now() + settings_.ttl;
+
+  std::lock_guard lock{mutex_};
+  // An invalidation might have happened during the execution
+  if (generation != generation_.load()) return;
+
+  const auto it = entries_.find(key);
+  if (it != entries_.end()) Erase(it);
+
+  lru_.push_front(key);
+  entries_.emplace(std::move(key),
+                   Entry{result, expires_at, size, lru_.begin()});
+  total_size_ += size;
+
+  while (total_size_ > settings_.max_bytes) {
+    UASSERT(!lru_.empty());
+    Erase(entries_.find(lru_.back()));
+  }
+}
+
+void ResultCache::Invalidate(std::string_view query_name) {
+  std::lock_guard lock{mutex_};
+  ++generation_;
+  for (auto it = entries_.begin(); it != entries_.end();) {
+    if (StartsWithName(it->first, query_name)) {
+      Erase(it++);
+    } else {
+      ++it;
+    }
+  }
+}
+
+void ResultCache::InvalidateAll() {
+  std::lock_guard lock{mutex_};
+  ClearLocked();
+}
+
+void ResultCache::Suspend() {
+  std::lock_guard lock{mutex_};
+  suspended_ = true;
+  ClearLocked();
+}
+
+void ResultCache::Resume() { suspended_ = false; }
+
+void ResultCache::Erase(Entries::iterator it) {
+  UASSERT(it != entries_.end());
+  UASSERT(total_size_ >= it->second.size);
+  total_size_ -= it->second.size;
+  lru_.erase(it->second.lru_it);
+  entries_.erase(it);
+}
+
+void ResultCache::ClearLocked() {
+  ++generation_;
+  entries_.clear();
+  lru_.clear();
+  total_size_ = 0;
+}
+
+}  // namespace storages::postgres::detail
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,89 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <list>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+
+#include <userver/engine/mutex.hpp>
+#include <userver/storages/postgres/cluster_types.hpp>
+#include <userver/storages/postgres/detail/query_parameters.hpp>
+#include <userver/storages/postgres/detail/time_types.hpp>
+#include <userver/storages/postgres/options.hpp>
+#include <userver/storages/postgres/query.hpp>
+#include <userver/storages/postgres/result_set.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace storages::postgres::detail {
+
+/// @brief Client-side cache of the results of the named single statements.
+///
+/// The results are keyed by the query name, the host type flags and the
+/// binary representation of the parameters. A result lives for the TTL or
+/// until it is invalidated, the least recently used results are evicted when
+/// the total size exceeds the budget.
+///
+/// A result is stored only if no invalidation happened since its execution
+/// was started, see GetGeneration().
+class ResultCache final {
+ public:
+  using Generation = std::uint64_t;
+
+  explicit ResultCache(const ResultCacheSettings& settings);
+
+  /// Returns true if the results of the query are cached
+  bool IsCached(const Query& query) const;
+
+  static std::string MakeKey(ClusterHostTypeFlags flags, const Query& query,
+                             const QueryParameters& params);
+
+  std::optional<ResultSet> Get(const std::string& key);
+
+  /// Generation to pass to Put, must be taken before the execution starts
+  Generation GetGeneration() const;
+
+  void Put(std::string&& key, const ResultSet& result, Generation generation);
+
+  /// Drops the results of the query
+  void Invalidate(std::string_view query_name);
+
+  /// Drops all the results
+  void InvalidateAll();
+
+  /// Drops all the results and stops storing new ones until Resume(), used
+  /// while the invalidations cannot be received
+  void Suspend();
+  void Resume();
+
+ private:
+  struct Entry {
+    ResultSet result;
+    SteadyClock::time_point expires_at;
+    std::size_t size;
+    std::list<std::string>::iterator lru_it;
+  };
+
+  using Entries = std::unordered_map<std::string, Entry>;
+
+  void Erase(Entries::iterator it);
+  void ClearLocked();
+
+  const ResultCacheSettings settings_;
+  std::atomic<Generation> generation_{0};
+  std::atomic<bool> suspended_{false};
+
+  engine::Mutex mutex_;
+  Entries entries_;
+  // Most recently used keys go first
+  std::list<std::string> lru_;
+  std::size_t total_size_{0};
+};
+
+}  // namespace storages::postgres::detail
+
+USERVER_NAMESPACE_END
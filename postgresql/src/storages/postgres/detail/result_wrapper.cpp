@@ -1,5 +1,7 @@
 #include <storages/postgres/detail/result_wrapper.hpp>
 
+#include <cstring>
+
 #include <fmt/compile.h>
 #include <fmt/format.h>
 #include <boost/container/small_vector.hpp>
@@ -292,6 +294,50 @@ io::FieldBuffer ResultWrapper::GetFieldBuffer(std::size_t row,
                              PQgetvalue(handle_.get(), row, col))};
 }
 
+bool ResultWrapper::CopyFixedSizeColumn(std::size_t col, std::size_t size,
+                                        std::uint8_t* out) const {
+  auto* res = handle_.get();
+  if (PQfformat(res, col) != io::kPgBinaryDataFormat) return false;
+
+  const auto rows = RowCount();
+  for (std::size_t row = 0; row < rows; ++row, out += size) {
+    // Nulls have zero length
+    if (static_cast<std::size_t>(PQgetlength(res, row, col)) != size) {
+      return false;
+    }
+    std::memcpy(out, PQgetvalue(res, row, col), size);
+  }
+  return true;
+}
+
+bool ResultWrapper::GetColumnViews(std::size_t col,
+                                   std::string_view* out) const {
+  auto* res = handle_.get();
+  if (PQfformat(res, col) != io::kPgBinaryDataFormat) return false;
+
+  const auto rows = RowCount();
+  for (std::size_t row = 0; row < rows; ++row) {
+    if (PQgetisnull(res, row, col)) return false;
+    out[row] = std::string_view{PQgetvalue(res, row, col),
+                                static_cast<std::size_t>(
+                                    PQgetlength(res, row, col))};
+  }
+  return true;
+}
+
+std::size_t ResultWrapper::DataSize() const {
+  auto* res = handle_.get();
+  const auto rows = RowCount();
+  const auto fields = FieldCount();
+  std::size_t size = 0;
+  for (std::size_t row = 0; row < rows; ++row) {
+    for (std::size_t col = 0; col < fields; ++col) {
+      size += PQgetlength(res, row, col);
+    }
+  }
+  return size;
+}
+
 std::string ResultWrapper::GetErrorMessage() const {
   auto* msg = PQresultErrorMessage(handle_.get());
   return {msg ? msg : "no error message"};
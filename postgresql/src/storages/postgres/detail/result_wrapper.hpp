@@ -1,6 +1,7 @@
 #pragma once
 
 #include <libpq-fe.h>
+#include <cstdint>
 #include <memory>
 #include <string_view>
 
@@ -46,6 +47,17 @@ class ResultWrapper {
   bool IsFieldNull(std::size_t row, std::size_t col) const;
   std::size_t GetFieldLength(std::size_t row, std::size_t col) const;
   io::FieldBuffer GetFieldBuffer(std::size_t row, std::size_t col) const;
+
+  /// Copies the binary values of the column to `out` one after another,
+  /// returns false if the column has text format, nulls or values that are
+  /// not `size` bytes long
+  bool CopyFixedSizeColumn(std::size_t col, std::size_t size,
+                           std::uint8_t* out) const;
+  /// Fills `out` with the binary values of the column, returns false if the
+  /// column has text format or nulls
+  bool GetColumnViews(std::size_t col, std::string_view* out) const;
+  /// Total length of the field values
+  std::size_t DataSize() const;
   //@}
 
   //@{
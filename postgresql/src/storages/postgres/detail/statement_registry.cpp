@@ -0,0 +1,80 @@
+#include <storages/postgres/detail/statement_registry.hpp>
+
+#include <algorithm>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace storages::postgres::detail {
+
+namespace {
+
+// Prepare only uses the types of the parameters
+class TypesOnlyParams final {
+ public:
+  explicit TypesOnlyParams(const std::vector<Oid>& types) : types_{types} {}
+
+  std::size_t Size() const { return types_.size(); }
+  const Oid* ParamTypesBuffer() const { return types_.data(); }
+  static const char* const* ParamBuffers() { return nullptr; }
+  static const int* ParamLengthsBuffer() { return nullptr; }
+  static const int* ParamFormatsBuffer() { return nullptr; }
+
+ private:
+  const std::vector<Oid>& types_;
+};
+
+}  // namespace
+
+QueryParameters StatementRegistry::Statement::GetParams() const {
+  TypesOnlyParams params{param_types};
+  return QueryParameters{params};
+}
+
+StatementRegistry::StatementRegistry(std::size_t max_size)
+    : statements_{max_size} {}
+
+void StatementRegistry::Register(std::size_t query_hash,
+                                 const std::string& statement,
+                                 const QueryParameters& params) {
+  auto statements = statements_.UniqueLock();
+  auto* item = statements->Get(query_hash);
+  if (!item) {
+    const auto* types = params.ParamTypesBuffer();
+    statements->Put(
+        query_hash,
+        {std::make_shared<const Statement>(Statement{
+             statement, {types, types + (types ? params.Size() : 0)}}),
+         0});
+    item = statements->Get(query_hash);
+  }
+  UASSERT(item);
+  ++item->prepare_count;
+}
+
+std::vector<StatementRegistry::StatementPtr>
+StatementRegistry::GetHotStatements(std::size_t count) const {
+  std::vector<Item> items;
+  {
+    const auto statements = statements_.UniqueLock();
+    items.reserve(statements->GetSize());
+    statements->VisitAll(
+        [&items](std::size_t, const Item& item) { items.push_back(item); });
+  }
+
+  count = std::min(count, items.size());
+  std::partial_sort(items.begin(), items.begin() + count, items.end(),
+                    [](const Item& lhs, const Item& rhs) {
+                      return lhs.prepare_count > rhs.prepare_count;
+                    });
+
+  std::vector<StatementPtr> result;
+  result.reserve(count);
+  for (std::size_t i = 0; i < count; ++i) {
+    result.push_back(std::move(items[i].statement));
+  }
+  return result;
+}
+
+}  // namespace storages::postgres::detail
+
+USERVER_NAMESPACE_END
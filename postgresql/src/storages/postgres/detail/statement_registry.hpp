@@ -0,0 +1,61 @@
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <userver/cache/lru_map.hpp>
+#include <userver/concurrent/variable.hpp>
+#include <userver/engine/mutex.hpp>
+#include <userver/storages/postgres/detail/query_parameters.hpp>
+#include <userver/storages/postgres/io/pg_types.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace storages::postgres::detail {
+
+/// @brief Statements prepared by the connections of a cluster.
+///
+/// Connections register the statements on the prepared statements cache
+/// misses. The statements prepared by the most connections are prepared on
+/// the new connections before they are given out of the pool, so that a pool
+/// refill does not make the first requests pay for the Parse round-trips.
+///
+/// The number of the connections that prepared a statement is used as its
+/// hotness, it needs no accounting on the execution path. The least recently
+/// registered statements are forgotten once the registry is full.
+class StatementRegistry final {
+ public:
+  struct Statement final {
+    std::string statement;
+    std::vector<Oid> param_types;
+
+    /// Parameters with the types only, enough to prepare the statement
+    QueryParameters GetParams() const;
+  };
+  using StatementPtr = std::shared_ptr<const Statement>;
+
+  explicit StatementRegistry(std::size_t max_size);
+
+  void Register(std::size_t query_hash, const std::string& statement,
+                const QueryParameters& params);
+
+  /// Returns up to `count` statements prepared by the most connections,
+  /// the hottest first
+  std::vector<StatementPtr> GetHotStatements(std::size_t count) const;
+
+ private:
+  struct Item final {
+    StatementPtr statement;
+    std::size_t prepare_count{0};
+  };
+
+  using Storage = cache::LruMap<std::size_t, Item>;
+
+  concurrent::Variable<Storage, engine::Mutex> statements_;
+};
+
+}  // namespace storages::postgres::detail
+
+USERVER_NAMESPACE_END
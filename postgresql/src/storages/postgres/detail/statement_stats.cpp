@@ -1,5 +1,6 @@
 #include "statement_stats.hpp"
 
+#include <storages/postgres/detail/connection.hpp>
 #include <userver/storages/postgres/detail/connection_ptr.hpp>
 #include <userver/storages/postgres/query.hpp>
 
@@ -7,10 +8,25 @@ USERVER_NAMESPACE_BEGIN
 
 namespace storages::postgres::detail {
 
-StatementStats::StatementStats(const Query& query, const ConnectionPtr& conn)
+namespace {
+
+std::size_t ToMilliseconds(std::chrono::steady_clock::duration duration) {
+  return std::chrono::duration_cast<std::chrono::milliseconds>(duration)
+      .count();
+}
+
+}  // namespace
+
+StatementStats::StatementStats(const Query& query, const ConnectionPtr& conn,
+                               const QueryParameters* params)
     : query_{query},
+      conn_{conn},
+      params_{params},
       sts_{conn.GetStatementStatsStorage()},
-      start_{sts_ != nullptr ? Now() : SteadyClock::time_point{}} {}
+      start_{sts_ != nullptr ? Now() : SteadyClock::time_point{}} {
+  // Drop the phases of the statements run before this one
+  if (sts_ != nullptr && conn_) conn_->TakeLastStatementPhases();
+}
 
 void StatementStats::AccountStatementExecution() {
   AccountImpl(StatementStatsStorage::ExecutionResult::kSuccess);
@@ -24,12 +40,23 @@ void StatementStats::AccountImpl(
     StatementStatsStorage::ExecutionResult execution_result) {
   if (sts_ == nullptr || !query_.GetName().has_value()) return;
 
-  const auto duration_ms =
-      std::chrono::duration_cast<std::chrono::milliseconds>(Now() - start_)
-          .count();
+  const auto duration =
+      std::chrono::duration_cast<std::chrono::milliseconds>(Now() - start_);
+  const auto& name = query_.GetName()->GetUnderlying();
+
+  std::optional<StatementStatsStorage::PhaseTimings> phase_timings;
+  if (execution_result == StatementStatsStorage::ExecutionResult::kSuccess) {
+    if (const auto phases = conn_->TakeLastStatementPhases()) {
+      phase_timings.emplace(StatementStatsStorage::PhaseTimings{
+          ToMilliseconds(phases->prepare), ToMilliseconds(phases->server),
+          ToMilliseconds(phases->transfer)});
+    }
+    if (params_ && sts_->ShouldExplain(name, duration)) {
+      conn_.ExplainStatement(query_, *params_);
+    }
+  }
 
-  sts_->Account(query_.GetName()->GetUnderlying(), duration_ms,
-                execution_result);
+  sts_->Account(name, duration.count(), execution_result, phase_timings);
 }
 
 SteadyClock::time_point StatementStats::Now() { return SteadyClock::now(); }
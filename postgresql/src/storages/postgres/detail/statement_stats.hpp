@@ -1,6 +1,7 @@
 #pragma once
 
 #include <storages/postgres/detail/statement_stats_storage.hpp>
+#include <userver/storages/postgres/detail/query_parameters.hpp>
 #include <userver/storages/postgres/detail/time_types.hpp>
 #include <userver/storages/postgres/query.hpp>
 
@@ -13,7 +14,10 @@ class StatementStatsStorage;
 
 class StatementStats final {
  public:
-  StatementStats(const Query& query, const ConnectionPtr& conn);
+  /// The statement is sampled with `EXPLAIN (ANALYZE)` if it is slow and
+  /// `params` are provided
+  StatementStats(const Query& query, const ConnectionPtr& conn,
+                 const QueryParameters* params = nullptr);
 
   void AccountStatementExecution();
   void AccountStatementError();
@@ -25,6 +29,8 @@ class StatementStats final {
 
  private:
   const Query& query_;
+  const ConnectionPtr& conn_;
+  const QueryParameters* params_;
   const StatementStatsStorage* sts_;
 
   const SteadyClock::time_point start_;
@@ -9,12 +9,15 @@ namespace storages::postgres::detail {
 
 namespace {
 constexpr size_t kDefaultEventsQueueSize = 1000;
-}
+// Number of the statements remembered to rate limit EXPLAIN (ANALYZE) samples
+constexpr size_t kExplainTimesSize = 1000;
+}  // namespace
 
 StatementStatsStorage::StatementStatsStorage(
     const StatementMetricsSettings& settings)
     : settings_{settings},
       enabled_{settings.max_statements != 0},
+      explain_times_{kExplainTimesSize},
       data_{
           CreateStorageData(settings.max_statements, kDefaultEventsQueueSize)} {
   data_.consumer_task =
@@ -29,13 +32,35 @@ StatementStatsStorage::~StatementStatsStorage() {
 
 void StatementStatsStorage::Account(const std::string& statement_name,
                                     std::size_t duration_ms,
-                                    ExecutionResult result) const {
+                                    ExecutionResult result,
+                                    const std::optional<PhaseTimings>& phases)
+    const {
   if (!IsEnabled()) return;
 
   const auto producer = data_.events_queue->GetProducer();
 
-  [[maybe_unused]] const auto success = producer.PushNoblock(
-      std::make_unique<StatementEvent>(statement_name, duration_ms, result));
+  [[maybe_unused]] const auto success =
+      producer.PushNoblock(std::make_unique<StatementEvent>(
+          statement_name, duration_ms, result, phases));
+}
+
+bool StatementStatsStorage::ShouldExplain(
+    const std::string& statement_name,
+    std::chrono::milliseconds duration) const {
+  const auto settings = settings_.Read();
+  if (settings->explain_threshold.count() <= 0 ||
+      duration < settings->explain_threshold) {
+    return false;
+  }
+
+  const auto now = std::chrono::steady_clock::now();
+  auto explain_times = explain_times_.Lock();
+  const auto* last_time = explain_times->Get(statement_name);
+  if (last_time && now - *last_time < settings->explain_interval) {
+    return false;
+  }
+  explain_times->Put(statement_name, now);
+  return true;
 }
 
 std::unordered_map<std::string, StatementStatistics>
@@ -50,8 +75,14 @@ StatementStatsStorage::GetStatementsStats() const {
 
   stats.VisitAll([&result](const std::string& key,
                            const std::unique_ptr<StoredStatementStats>& value) {
-    result.emplace(key, StatementStatistics{value->timings.GetStatsForPeriod(),
-                                            value->executed, value->errors});
+    result.emplace(key, StatementStatistics{
+                            value->timings.GetStatsForPeriod(),
+                            value->executed,
+                            value->errors,
+                            value->prepare_timings.GetStatsForPeriod(),
+                            value->server_timings.GetStatsForPeriod(),
+                            value->transfer_timings.GetStatsForPeriod(),
+                        });
   });
 
   return result;
@@ -118,6 +149,14 @@ void StatementStatsStorage::AccountEvent(EventPtr event_ptr) const {
     case ExecutionResult::kSuccess:
       stats_ref->timings.GetCurrentCounter().Account(duration);
       stats_ref->executed.Add({1});
+      if (const auto& phases = event_ptr->phases) {
+        stats_ref->prepare_timings.GetCurrentCounter().Account(
+            phases->prepare_ms);
+        stats_ref->server_timings.GetCurrentCounter().Account(
+            phases->server_ms);
+        stats_ref->transfer_timings.GetCurrentCounter().Account(
+            phases->transfer_ms);
+      }
       break;
     case ExecutionResult::kError:
       stats_ref->errors.Add({1});
@@ -12,6 +12,8 @@
 #include <userver/utils/statistics/rate_counter.hpp>
 #include <userver/utils/statistics/recentperiod.hpp>
 
+#include <chrono>
+#include <optional>
 #include <unordered_map>
 
 USERVER_NAMESPACE_BEGIN
@@ -25,11 +27,24 @@ class StatementStatsStorage final {
 
   enum class ExecutionResult { kSuccess, kError };
 
+  /// Durations of the phases of a successful execution
+  struct PhaseTimings final {
+    std::size_t prepare_ms{0};
+    std::size_t server_ms{0};
+    std::size_t transfer_ms{0};
+  };
+
   StatementStatsStorage(const StatementMetricsSettings& settings);
   ~StatementStatsStorage();
 
   void Account(const std::string& statement_name, std::size_t duration_ms,
-               ExecutionResult result) const;
+               ExecutionResult result,
+               const std::optional<PhaseTimings>& phases = {}) const;
+
+  /// Returns true if the execution is slow enough to be sampled with
+  /// `EXPLAIN (ANALYZE)` and the statement was not sampled recently
+  bool ShouldExplain(const std::string& statement_name,
+                     std::chrono::milliseconds duration) const;
 
   std::unordered_map<std::string, StatementStatistics> GetStatementsStats()
       const;
@@ -42,14 +57,17 @@ class StatementStatsStorage final {
  private:
   struct StatementEvent final {
     StatementEvent(const std::string& statement_name_, size_t duration_,
-                   ExecutionResult result_)
+                   ExecutionResult result_,
+                   const std::optional<PhaseTimings>& phases_)
         : statement_name{statement_name_},
           duration_ms{duration_},
-          result{result_} {}
+          result{result_},
+          phases{phases_} {}
 
     std::string statement_name;
     std::size_t duration_ms;
     ExecutionResult result;
+    std::optional<PhaseTimings> phases;
   };
   using EventPtr = std::unique_ptr<StatementEvent>;
 
@@ -61,6 +79,9 @@ class StatementStatsStorage final {
     RecentPeriod timings{};
     RateCounter executed{};
     RateCounter errors{};
+    RecentPeriod prepare_timings{};
+    RecentPeriod server_timings{};
+    RecentPeriod transfer_timings{};
   };
 
   using Queue = USERVER_NAMESPACE::concurrent::MpscQueue<EventPtr>;
@@ -86,8 +107,14 @@ class StatementStatsStorage final {
   static StorageData CreateStorageData(size_t max_map_size,
                                        size_t max_queue_size);
 
+  using ExplainTimes =
+      USERVER_NAMESPACE::concurrent::Variable<USERVER_NAMESPACE::cache::LruMap<
+          std::string, std::chrono::steady_clock::time_point>>;
+
   rcu::Variable<StatementMetricsSettings> settings_;
   std::atomic_bool enabled_;
+  // Last EXPLAIN (ANALYZE) sample of a statement
+  mutable ExplainTimes explain_times_;
 
   StorageData data_;
 };
@@ -162,6 +162,11 @@ rcu::ReadablePtr<TopologyBase::DsnIndices> HotStandby::GetAliveDsnIndices()
   return alive_dsn_indices_.Read();
 }
 
+rcu::ReadablePtr<TopologyBase::ReplicationLags>
+HotStandby::GetReplicationLags() const {
+  return replication_lags_.Read();
+}
+
 const std::vector<decltype(InstanceStatistics::topology)>&
 HotStandby::GetDsnStatistics() const {
   return dsn_stats_;
@@ -200,6 +205,7 @@ void HotStandby::RunDiscovery() {
   // At this stage alive indices can point only to two types of hosts -
   // master and slaves. The record for master can contain names of sync
   // slaves.
+  ReplicationLags replication_lags(host_states_.size());
   for (DsnIndex i = 0; i < host_states_.size(); ++i) {
     auto& slave = host_states_[i];
     if (slave.role != ClusterHostType::kSlave) continue;
@@ -225,6 +231,7 @@ void HotStandby::RunDiscovery() {
     dsn_stats_[i].replication_lag.GetCurrentCounter().Account(
         std::chrono::duration_cast<std::chrono::milliseconds>(slave_lag)
             .count());
+    replication_lags[i] = slave_lag;
 
     auto& max_replication_lag = GetTopologySettings().max_replication_lag;
     if (max_replication_lag > std::chrono::milliseconds{0} &&
@@ -282,6 +289,7 @@ void HotStandby::RunDiscovery() {
   }
   dsn_indices_by_type_.Assign(std::move(dsn_indices_by_type));
   alive_dsn_indices_.Assign(std::move(alive_dsn_indices));
+  replication_lags_.Assign(std::move(replication_lags));
 }
 
 void HotStandby::RunCheck(DsnIndex idx) {
@@ -16,11 +16,16 @@ const std::string kGetConnectData = "pg_get_conn_data";
 const std::string kQuery = "pg_query";
 /// Prepare query, driver level
 const std::string kPrepare = "pg_prepare";
+/// Prepare the hot statements on a new connection, driver level
+const std::string kPrepareWarmup = "pg_prepare_warmup";
 /// Bind portal, driver level
 const std::string kBind = "pg_bind";
 /// Execute query, driver level
 const std::string kExec = "pg_exec";
 
+/// Execute an automatic batch of statements, driver level
+const std::string kAutoBatch = "pg_auto_batch";
+
 // libpq stages
 /// libpq async connect stage
 const std::string kLibpqConnect = "libpq_async_connect";
@@ -30,12 +35,16 @@ const std::string kLibpqWaitConnectFinish = "libpq_wait_connect_finish";
 const std::string kLibpqWaitResult = "libpq_wait_result";
 /// libpq send query params stage
 const std::string kLibpqSendQueryParams = "libpq_send_query_params";
+/// libpq send simple query stage
+const std::string kLibpqSendQuery = "libpq_send_query";
 /// libpq send prepare stage
 const std::string kLibpqSendPrepare = "libpq_send_prepare";
 /// libpq send describe prepared stage
 const std::string kLibpqSendDescribePrepared = "libpq_send_describe_prepared";
 /// libpq send query prepared stage
 const std::string kLibpqSendQueryPrepared = "libpq_send_query_prepared";
+/// libpq put copy end stage
+const std::string kLibpqPutCopyEnd = "libpq_put_copy_end";
 /// libpq-missing send bind portal
 const std::string kPqSendPortalBind = "pq_send_portal_bind";
 /// libpq-missing send execute portal
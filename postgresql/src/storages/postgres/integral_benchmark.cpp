@@ -1,6 +1,7 @@
 #include <benchmark/benchmark.h>
 
 #include <limits>
+#include <string_view>
 
 #include <storages/postgres/detail/connection.hpp>
 
@@ -53,6 +54,43 @@ BENCHMARK_F(PgConnection, Int64Roundtrip)(benchmark::State& state) {
   });
 }
 
+BENCHMARK_DEFINE_F(PgConnection, RowsDecode)(benchmark::State& state) {
+  RunStandalone(state, [this, &state] {
+    const auto res = SelectSeries(state.range(0));
+    for (auto _ : state) {
+      pg::Integer i{};
+      pg::Bigint b{};
+      double d{};
+      std::string_view s;
+      for (auto row : res) {
+        row.To(i, b, d, s);
+        benchmark::DoNotOptimize(i);
+        benchmark::DoNotOptimize(b);
+        benchmark::DoNotOptimize(d);
+        benchmark::DoNotOptimize(s);
+      }
+    }
+    state.SetItemsProcessed(state.iterations() * res.Size());
+  });
+}
+BENCHMARK_REGISTER_F(PgConnection, RowsDecode)->Range(1, 1 << 16);
+
+BENCHMARK_DEFINE_F(PgConnection, ColumnsDecode)(benchmark::State& state) {
+  RunStandalone(state, [this, &state] {
+    const auto res = SelectSeries(state.range(0));
+    for (auto _ : state) {
+      const auto columns =
+          res.AsColumns<pg::Integer, pg::Bigint, double, std::string_view>();
+      benchmark::DoNotOptimize(columns.Get<0>().data());
+      benchmark::DoNotOptimize(columns.Get<1>().data());
+      benchmark::DoNotOptimize(columns.Get<2>().data());
+      benchmark::DoNotOptimize(columns.Get<3>().data());
+    }
+    state.SetItemsProcessed(state.iterations() * res.Size());
+  });
+}
+BENCHMARK_REGISTER_F(PgConnection, ColumnsDecode)->Range(1, 1 << 16);
+
 }  // namespace
 
 USERVER_NAMESPACE_END
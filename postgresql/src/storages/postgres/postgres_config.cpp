@@ -31,6 +31,15 @@ CommandControl Parse(const formats::json::Value& elem,
                             "` in postgres CommandControl. The timeout must be "
                             "greater than 0."};
       }
+    } else if (name == "max_replication_lag_ms") {
+      result.max_replication_lag =
+          std::chrono::milliseconds{it->As<int64_t>()};
+      if (result.max_replication_lag.count() < 0) {
+        throw InvalidConfig{"Invalid max_replication_lag_ms `" +
+                            std::to_string(result.max_replication_lag.count()) +
+                            "` in postgres CommandControl. The lag must not be "
+                            "less than 0."};
+      }
     } else {
       LOG_WARNING() << "Unknown parameter " << name << " in PostgreSQL config";
     }
@@ -76,6 +85,10 @@ ConnectionSettings ParseConnectionSettings(const ConfigType& config) {
           ? ConnectionSettings::kDiscardAll
           : ConnectionSettings::kDiscardNone;
 
+  settings.prepared_statements_warmup =
+      config["prepared-statements-warmup"].template As<size_t>(
+          settings.prepared_statements_warmup);
+
   return settings;
 }
 
@@ -116,11 +129,18 @@ PoolSettings ParsePoolSettings(const ConfigType& config) {
       config["max_queue_size"].template As<size_t>(result.max_queue_size);
   result.connecting_limit =
       config["connecting_limit"].template As<size_t>(result.connecting_limit);
+  result.adaptive_size =
+      config["adaptive_pool_size"].template As<bool>(result.adaptive_size);
+  result.adaptive_grow_wait = std::chrono::milliseconds{
+      config["adaptive_grow_wait_ms"].template As<int64_t>(
+          result.adaptive_grow_wait.count())};
 
   if (result.max_size == 0)
     throw InvalidConfig{"max_pool_size must be greater than 0"};
   if (result.max_size < result.min_size)
     throw InvalidConfig{"max_pool_size cannot be less than min_pool_size"};
+  if (result.adaptive_grow_wait <= std::chrono::milliseconds{0})
+    throw InvalidConfig{"adaptive_grow_wait_ms must be greater than 0"};
 
   return result;
 }
@@ -159,6 +179,12 @@ StatementMetricsSettings ParseStatementMetricsSettings(
   StatementMetricsSettings result{};
   result.max_statements = config["max_statement_metrics"].template As<size_t>(
       result.max_statements);
+  result.explain_threshold = std::chrono::milliseconds{
+      config["explain_threshold_ms"].template As<std::int64_t>(
+          result.explain_threshold.count())};
+  result.explain_interval = std::chrono::milliseconds{
+      config["explain_interval_ms"].template As<std::int64_t>(
+          result.explain_interval.count())};
 
   return result;
 }
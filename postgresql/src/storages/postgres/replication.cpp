@@ -0,0 +1,365 @@
+#include <userver/storages/postgres/replication.hpp>
+
+#include <charconv>
+#include <cstring>
+#include <system_error>
+#include <utility>
+
+#include <boost/endian/conversion.hpp>
+#include <fmt/format.h>
+
+#include <storages/postgres/detail/pg_connection_wrapper.hpp>
+#include <storages/postgres/detail/pgoutput.hpp>
+#include <userver/concurrent/background_task_storage.hpp>
+#include <userver/logging/log.hpp>
+#include <userver/storages/postgres/exceptions.hpp>
+#include <userver/tracing/scope_time.hpp>
+#include <userver/utils/assert.hpp>
+#include <userver/utils/text_light.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace storages::postgres {
+
+namespace {
+
+constexpr std::uint32_t kReplicationConnectionId = 4'100'200'301;
+
+// Microseconds between the Unix epoch and the PostgreSQL one, 2000-01-01
+constexpr std::int64_t kPostgresEpochOffset = 946'684'800'000'000;
+
+constexpr std::string_view kUriPrefixes[] = {"postgres://", "postgresql://"};
+
+Dsn MakeReplicationDsn(const Dsn& dsn) {
+  const auto& str = dsn.GetUnderlying();
+  for (const auto prefix : kUriPrefixes) {
+    if (USERVER_NAMESPACE::utils::text::StartsWith(str, prefix)) {
+      const char separator = str.find('?') == std::string::npos ? '?' : '&';
+      return Dsn{str + separator + "replication=database"};
+    }
+  }
+  return Dsn{str + " replication=database"};
+}
+
+// Identifiers of the replication commands are quoted as in SQL
+std::string QuoteIdentifier(std::string_view name) {
+  std::string result{'"'};
+  for (const char c : name) {
+    if (c == '"') result += '"';
+    result += c;
+  }
+  result += '"';
+  return result;
+}
+
+std::string QuoteLiteral(std::string_view value) {
+  std::string result{'\''};
+  for (const char c : value) {
+    if (c == '\'') result += '\'';
+    result += c;
+  }
+  result += '\'';
+  return result;
+}
+
+template <typename T>
+void AppendInteger(std::string& buffer, T value) {
+  value = boost::endian::native_to_big(value);
+  buffer.append(reinterpret_cast<const char*>(&value), sizeof(value));
+}
+
+template <typename T>
+T ReadInteger(std::string_view& data) {
+  if (data.size() < sizeof(T)) {
+    throw InvalidBinaryBuffer{"Truncated replication protocol message"};
+  }
+  T value{};
+  std::memcpy(&value, data.data(), sizeof(T));
+  data.remove_prefix(sizeof(T));
+  return boost::endian::big_to_native(value);
+}
+
+}  // namespace
+
+std::string LsnToString(Lsn lsn) {
+  return fmt::format("{:X}/{:X}", lsn >> 32, lsn & 0xFFFFFFFF);
+}
+
+Lsn LsnFromString(std::string_view str) {
+  const auto parse_half = [str](std::string_view half) {
+    std::uint32_t value = 0;
+    const auto* end = half.data() + half.size();
+    const auto [ptr, ec] = std::from_chars(half.data(), end, value, 16);
+    if (half.empty() || ec != std::errc{} || ptr != end) {
+      throw InvalidInputFormat{fmt::format("Invalid LSN '{}'", str)};
+    }
+    return value;
+  };
+
+  const auto separator = str.find('/');
+  if (separator == std::string_view::npos) {
+    throw InvalidInputFormat{fmt::format("Invalid LSN '{}'", str)};
+  }
+  const Lsn high = parse_half(str.substr(0, separator));
+  const Lsn low = parse_half(str.substr(separator + 1));
+  return (high << 32) | low;
+}
+
+ReplicationTuple::ColumnKind ReplicationTuple::GetKind(
+    std::size_t index) const {
+  UASSERT(index < columns_.size());
+  return columns_[index].kind;
+}
+
+void ReplicationTuple::AddColumn(ColumnKind kind, std::string_view value) {
+  columns_.push_back({kind, data_.size()});
+  const bool has_value =
+      kind == ColumnKind::kText || kind == ColumnKind::kBinary;
+  AppendInteger(data_, has_value ? static_cast<std::int32_t>(value.size())
+                                 : io::kPgNullBufferSize);
+  if (has_value) data_.append(value);
+}
+
+void ReplicationTuple::SetColumn(std::size_t index,
+                                 const ReplicationTuple& other) {
+  UASSERT(index < columns_.size() && index < other.columns_.size());
+  // The replaced value is left in the data unused
+  columns_[index] = {other.columns_[index].kind, data_.size()};
+  data_.append(other.GetData(index));
+}
+
+std::string_view ReplicationTuple::GetData(std::size_t index) const {
+  const auto begin = columns_[index].offset;
+  const auto end =
+      index + 1 < columns_.size() ? columns_[index + 1].offset : data_.size();
+  return std::string_view{data_}.substr(begin, end - begin);
+}
+
+io::FieldBuffer ReplicationTuple::GetRawBuffer(std::size_t index) const {
+  UASSERT(index < columns_.size());
+  const auto& column = columns_[index];
+  if (column.kind == ColumnKind::kUnchangedToast) {
+    throw InvalidBinaryBuffer{
+        "The value of an unchanged TOASTed column is not replicated, set "
+        "REPLICA IDENTITY FULL for the table"};
+  }
+  if (column.kind == ColumnKind::kText) {
+    throw InvalidBinaryBuffer{
+        "The column is replicated in the text format, the binary output "
+        "function of the type is missing"};
+  }
+  const auto data = GetData(index);
+  return io::FieldBuffer{false, io::BufferCategory::kPlainBuffer, data.size(),
+                         reinterpret_cast<const std::uint8_t*>(data.data())};
+}
+
+std::optional<std::size_t> ReplicationRelation::FindColumn(
+    std::string_view name) const {
+  for (std::size_t i = 0; i < columns.size(); ++i) {
+    if (columns[i].name == name) return i;
+  }
+  return std::nullopt;
+}
+
+struct ReplicationStream::Impl {
+  Impl(engine::TaskProcessor& bg_task_processor,
+       io::TypeBufferCategory categories, ReplicationSettings settings)
+      : conn{bg_task_processor, close_storage, kReplicationConnectionId, {}},
+        categories{std::move(categories)},
+        settings{std::move(settings)} {}
+
+  void Connect(const Dsn& dsn, engine::Deadline deadline);
+  void Start(engine::Deadline deadline);
+  void HandleKeepalive(std::string_view data);
+  void SendStatusIfDue(bool force);
+
+  // Outlives the connection, whose closing task is stored in it
+  concurrent::BackgroundTaskStorageCore close_storage;
+  detail::PGConnectionWrapper conn;
+  io::TypeBufferCategory categories;
+  const ReplicationSettings settings;
+  detail::PgOutputDecoder decoder;
+
+  std::string snapshot_name;
+  Lsn consistent_point{0};
+  bool is_started{false};
+
+  Lsn received_lsn{0};
+  Lsn confirmed_lsn{0};
+  std::chrono::steady_clock::time_point last_status_time;
+  std::string buffer;
+};
+
+void ReplicationStream::Impl::Connect(const Dsn& dsn,
+                                      engine::Deadline deadline) {
+  tracing::ScopeTime scope;
+  conn.AsyncConnect(MakeReplicationDsn(dsn), deadline, scope);
+
+  conn.SendSimpleQuery(
+      fmt::format("CREATE_REPLICATION_SLOT {} TEMPORARY LOGICAL pgoutput "
+                  "EXPORT_SNAPSHOT",
+                  QuoteIdentifier(settings.slot_name)),
+      scope);
+  // slot_name, consistent_point, snapshot_name, output_plugin
+  const auto row = conn.WaitTextRow(deadline, scope);
+  if (row.size() < 3 || !row[1] || !row[2]) {
+    throw LogicError{"Unexpected result of CREATE_REPLICATION_SLOT"};
+  }
+  consistent_point = LsnFromString(*row[1]);
+  snapshot_name = *row[2];
+  LOG_INFO() << "Created replication slot '" << settings.slot_name
+             << "' at " << LsnToString(consistent_point);
+}
+
+void ReplicationStream::Impl::Start(engine::Deadline deadline) {
+  UINVARIANT(!is_started, "The replication stream is already started");
+
+  std::string publications;
+  for (const auto& publication : settings.publications) {
+    if (!publications.empty()) publications += ',';
+    publications += QuoteIdentifier(publication);
+  }
+
+  tracing::ScopeTime scope;
+  conn.SendSimpleQuery(
+      fmt::format("START_REPLICATION SLOT {} LOGICAL {} (proto_version '1', "
+                  "publication_names {}, binary 'true')",
+                  QuoteIdentifier(settings.slot_name),
+                  LsnToString(consistent_point), QuoteLiteral(publications)),
+      scope);
+  conn.WaitCopyStart(deadline, scope, PGRES_COPY_BOTH);
+
+  is_started = true;
+  received_lsn = confirmed_lsn = consistent_point;
+  last_status_time = std::chrono::steady_clock::now();
+}
+
+void ReplicationStream::Impl::HandleKeepalive(std::string_view data) {
+  const auto server_lsn = ReadInteger<std::uint64_t>(data);
+  // Server clock, unused
+  ReadInteger<std::int64_t>(data);
+  const auto reply_requested = ReadInteger<std::uint8_t>(data);
+
+  // No changes are pending before the server position, the transactions are
+  // sent as they are committed
+  if (server_lsn > received_lsn) received_lsn = server_lsn;
+  SendStatusIfDue(reply_requested != 0);
+}
+
+void ReplicationStream::Impl::SendStatusIfDue(bool force) {
+  const auto now = std::chrono::steady_clock::now();
+  if (!force && now - last_status_time < settings.status_interval) return;
+
+  const auto client_time =
+      std::chrono::duration_cast<std::chrono::microseconds>(
+          std::chrono::system_clock::now().time_since_epoch())
+          .count() -
+      kPostgresEpochOffset;
+
+  // https://www.postgresql.org/docs/current/protocol-replication.html
+  std::string message{'r'};
+  AppendInteger(message, std::uint64_t{received_lsn});
+  AppendInteger(message, std::uint64_t{confirmed_lsn});
+  AppendInteger(message, std::uint64_t{confirmed_lsn});
+  AppendInteger(message, std::int64_t{client_time});
+  message += '\0';
+  conn.PutCopyData(message, engine::Deadline::FromDuration(
+                                settings.status_interval));
+  last_status_time = now;
+}
+
+ReplicationStream::ReplicationStream(const Dsn& dsn,
+                                     engine::TaskProcessor& bg_task_processor,
+                                     io::TypeBufferCategory categories,
+                                     ReplicationSettings settings,
+                                     engine::Deadline deadline)
+    : impl_{std::make_unique<Impl>(bg_task_processor, std::move(categories),
+                                   std::move(settings))} {
+  impl_->Connect(dsn, deadline);
+}
+
+ReplicationStream::ReplicationStream(ReplicationStream&&) noexcept = default;
+
+ReplicationStream& ReplicationStream::operator=(ReplicationStream&&) noexcept =
+    default;
+
+ReplicationStream::~ReplicationStream() = default;
+
+const std::string& ReplicationStream::GetSnapshotName() const {
+  return impl_->snapshot_name;
+}
+
+Lsn ReplicationStream::GetConsistentPoint() const {
+  return impl_->consistent_point;
+}
+
+const io::TypeBufferCategory& ReplicationStream::GetTypeBufferCategories()
+    const {
+  return impl_->categories;
+}
+
+void ReplicationStream::Start(engine::Deadline deadline) {
+  impl_->Start(deadline);
+}
+
+std::optional<ReplicationTransaction> ReplicationStream::WaitTransaction(
+    engine::Deadline deadline) {
+  auto& impl = *impl_;
+  UINVARIANT(impl.is_started, "The replication stream is not started");
+
+  while (true) {
+    impl.SendStatusIfDue(false);
+
+    // Wakes up in time for the next status update
+    const auto status_deadline = engine::Deadline::FromTimePoint(
+        impl.last_status_time + impl.settings.status_interval);
+    const bool is_deadline_earlier =
+        deadline.IsReachable() &&
+        deadline.TimeLeft() < status_deadline.TimeLeft();
+
+    impl.buffer.clear();
+    const auto result = impl.conn.TryGetCopyData(
+        is_deadline_earlier ? deadline : status_deadline, impl.buffer);
+    if (!result) {
+      if (deadline.IsReached()) return std::nullopt;
+      continue;
+    }
+    if (!*result) {
+      throw ConnectionError{"The server has stopped the replication"};
+    }
+
+    std::string_view data{impl.buffer};
+    if (data.empty()) continue;
+    const auto type = data.front();
+    data.remove_prefix(1);
+    if (type == 'k') {
+      impl.HandleKeepalive(data);
+      continue;
+    }
+    if (type != 'w') {
+      throw InvalidBinaryBuffer{
+          std::string{"Unexpected replication protocol message '"} + type +
+          '\''};
+    }
+
+    // XLogData: the start and the end of the WAL data and the server clock
+    ReadInteger<std::uint64_t>(data);
+    ReadInteger<std::uint64_t>(data);
+    ReadInteger<std::int64_t>(data);
+    auto transaction = impl.decoder.Decode(data);
+    if (transaction) {
+      if (transaction->end_lsn > impl.received_lsn) {
+        impl.received_lsn = transaction->end_lsn;
+      }
+      return transaction;
+    }
+  }
+}
+
+void ReplicationStream::Confirm(Lsn lsn) {
+  if (lsn > impl_->confirmed_lsn) impl_->confirmed_lsn = lsn;
+}
+
+}  // namespace storages::postgres
+
+USERVER_NAMESPACE_END
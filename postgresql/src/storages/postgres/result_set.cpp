@@ -1,7 +1,11 @@
 #include <userver/storages/postgres/result_set.hpp>
 
+#include <cstdint>
+#include <cstring>
 #include <string_view>
+#include <type_traits>
 
+#include <boost/endian/conversion.hpp>
 #include <fmt/format.h>
 
 #include <storages/postgres/detail/result_wrapper.hpp>
@@ -33,11 +37,43 @@ constexpr std::string_view kUnknownTypeErrorMessageTemplate =
     "the type and probably altering a table was run while service up, the only "
     "way to fix this is to restart the service.";
 
+template <typename T>
+bool ReadFixedSizeColumn(const detail::ResultWrapper& res, std::size_t col,
+                         T* out) {
+  using BitsType = std::conditional_t<sizeof(T) == 2, std::uint16_t,
+                                      std::conditional_t<sizeof(T) == 4,
+                                                         std::uint32_t,
+                                                         std::uint64_t>>;
+  static_assert(sizeof(BitsType) == sizeof(T));
+
+  if (!res.CopyFixedSizeColumn(col, sizeof(T),
+                               reinterpret_cast<std::uint8_t*>(out))) {
+    return false;
+  }
+
+  // No dependencies between the iterations and no branches, the compiler
+  // vectorizes the byte swapping
+  const auto rows = res.RowCount();
+  for (std::size_t i = 0; i < rows; ++i) {
+    BitsType bits{};
+    std::memcpy(&bits, out + i, sizeof(T));
+    bits = boost::endian::big_to_native(bits);
+    std::memcpy(out + i, &bits, sizeof(T));
+  }
+  return true;
+}
+
 }  // namespace
 
 //----------------------------------------------------------------------------
 // RowDescription implementation
 //----------------------------------------------------------------------------
+std::size_t RowDescription::Size() const { return res_->FieldCount(); }
+
+std::string_view RowDescription::GetName(std::size_t index) const {
+  return res_->GetFieldName(index);
+}
+
 void RowDescription::CheckBinaryFormat(const UserTypes& types) const {
   for (std::size_t i = 0; i < res_->FieldCount(); ++i) {
     auto oid = res_->GetFieldTypeOid(i);
@@ -244,6 +280,30 @@ ResultSet::reference ResultSet::operator[](size_type index) const& {
   return {pimpl_, index};
 }
 
+bool ResultSet::ReadColumn(size_type col, Smallint* out) const {
+  return ReadFixedSizeColumn(*pimpl_, col, out);
+}
+
+bool ResultSet::ReadColumn(size_type col, Integer* out) const {
+  return ReadFixedSizeColumn(*pimpl_, col, out);
+}
+
+bool ResultSet::ReadColumn(size_type col, Bigint* out) const {
+  return ReadFixedSizeColumn(*pimpl_, col, out);
+}
+
+bool ResultSet::ReadColumn(size_type col, float* out) const {
+  return ReadFixedSizeColumn(*pimpl_, col, out);
+}
+
+bool ResultSet::ReadColumn(size_type col, double* out) const {
+  return ReadFixedSizeColumn(*pimpl_, col, out);
+}
+
+bool ResultSet::ReadColumn(size_type col, std::string_view* out) const {
+  return pimpl_->GetColumnViews(col, out);
+}
+
 void ResultSet::FillBufferCategories(const UserTypes& types) {
   pimpl_->FillBufferCategories(types);
 }
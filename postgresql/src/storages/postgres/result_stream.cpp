@@ -0,0 +1,92 @@
+#include <userver/storages/postgres/result_stream.hpp>
+
+#include <userver/engine/task/task_with_result.hpp>
+#include <userver/utils/assert.hpp>
+#include <userver/utils/async.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace storages::postgres {
+
+struct ResultStream::Impl {
+  Portal portal_;
+  const std::uint32_t chunk_size_;
+  std::size_t read_so_far_{0};
+  // Chunk of NextRow()
+  std::optional<ResultSet> chunk_{};
+  std::size_t row_index_{0};
+  // Destroyed before the portal
+  engine::TaskWithResult<ResultSet> prefetch_{};
+
+  Impl(Portal&& portal, std::uint32_t chunk_size)
+      : portal_{std::move(portal)}, chunk_size_{chunk_size} {
+    UINVARIANT(chunk_size_ > 0, "Result stream chunk size must be positive");
+    StartPrefetch();
+  }
+
+  ~Impl() {
+    if (prefetch_.IsValid()) prefetch_.SyncCancel();
+  }
+
+  void StartPrefetch() {
+    if (portal_.Done()) return;
+    prefetch_ = USERVER_NAMESPACE::utils::Async(
+        "pg_result_stream_prefetch",
+        [this] { return portal_.Fetch(chunk_size_); });
+  }
+
+  std::optional<ResultSet> NextChunk() {
+    if (!prefetch_.IsValid()) return std::nullopt;
+    auto chunk = prefetch_.Get();
+    StartPrefetch();
+    // The last chunk is empty if the row count is a multiple of chunk size
+    if (chunk.IsEmpty()) return std::nullopt;
+    read_so_far_ += chunk.Size();
+    return chunk;
+  }
+
+  std::optional<Row> NextRow() {
+    if (!chunk_ || row_index_ == chunk_->Size()) {
+      chunk_ = NextChunk();
+      row_index_ = 0;
+      if (!chunk_) return std::nullopt;
+    }
+    return (*chunk_)[row_index_++];
+  }
+
+  bool Done() const {
+    return !prefetch_.IsValid() && (!chunk_ || row_index_ == chunk_->Size());
+  }
+};
+
+ResultStream::ResultStream(Portal&& portal, std::uint32_t chunk_size)
+    : pimpl_{std::make_unique<Impl>(std::move(portal), chunk_size)} {}
+
+ResultStream::ResultStream(ResultStream&&) noexcept = default;
+ResultStream& ResultStream::operator=(ResultStream&&) noexcept = default;
+
+ResultStream::~ResultStream() = default;
+
+std::optional<ResultSet> ResultStream::NextChunk() {
+  UASSERT(pimpl_);
+  return pimpl_->NextChunk();
+}
+
+std::optional<Row> ResultStream::NextRow() {
+  UASSERT(pimpl_);
+  return pimpl_->NextRow();
+}
+
+bool ResultStream::Done() const {
+  UASSERT(pimpl_);
+  return pimpl_->Done();
+}
+
+std::size_t ResultStream::ReadSoFar() const {
+  UASSERT(pimpl_);
+  return pimpl_->read_so_far_;
+}
+
+}  // namespace storages::postgres
+
+USERVER_NAMESPACE_END
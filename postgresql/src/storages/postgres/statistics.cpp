@@ -14,6 +14,11 @@ void DumpMetric(USERVER_NAMESPACE::utils::statistics::Writer& writer,
     conn["max"] = stats.connection.maximum;
     conn["waiting"] = stats.connection.waiting;
     conn["max-queue-size"] = stats.connection.max_queue_size;
+    if (stats.connection.adaptive_target) {
+      conn["adaptive-target"] = stats.connection.adaptive_target;
+      conn["adaptive-grow"] = stats.connection.adaptive_grow_total;
+      conn["adaptive-shrink"] = stats.connection.adaptive_shrink_total;
+    }
   }
   if (auto trx = writer["transactions"]) {
     trx["total"] = stats.transaction.total;
@@ -35,6 +40,10 @@ void DumpMetric(USERVER_NAMESPACE::utils::statistics::Writer& writer,
     query["portals-bound"] = stats.transaction.portal_bind_total;
     query["executed"] = stats.transaction.execute_total;
     query["replies"] = stats.transaction.reply_total;
+    query["prepared-cache-hits"] = stats.transaction.prepared_cache_hit_total;
+    query["prepared-cache-misses"] =
+        stats.transaction.prepared_cache_miss_total;
+    query["prepared-warmup"] = stats.transaction.prepared_warmup_total;
   }
 
   if (auto errors = writer["errors"]) {
@@ -65,6 +74,16 @@ void DumpMetric(USERVER_NAMESPACE::utils::statistics::Writer& writer,
                                                    {"postgresql_query", stmt});
       writer["statement_errors"].ValueWithLabels(stmt_stats.errors,
                                                  {"postgresql_query", stmt});
+      auto phase_timings = writer["statement_phase_timings"];
+      phase_timings.ValueWithLabels(
+          stmt_stats.prepare_timings,
+          {{"postgresql_query", stmt}, {"postgresql_phase", "prepare"}});
+      phase_timings.ValueWithLabels(
+          stmt_stats.server_timings,
+          {{"postgresql_query", stmt}, {"postgresql_phase", "server"}});
+      phase_timings.ValueWithLabels(
+          stmt_stats.transfer_timings,
+          {{"postgresql_query", stmt}, {"postgresql_phase", "transfer"}});
     }
   }
 }
@@ -0,0 +1,72 @@
+#include <storages/postgres/tests/util_pgtest.hpp>
+
+#include <optional>
+#include <string>
+#include <vector>
+
+#include <storages/postgres/detail/connection.hpp>
+#include <userver/storages/postgres/bulk_params.hpp>
+#include <userver/storages/postgres/io/pg_types.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace pg = storages::postgres;
+
+UTEST_P(PostgreConnection, BulkParamsInsert) {
+  CheckConnection(GetConn());
+  GetConn()->Execute(
+      "create temporary table bulk_test(id integer primary key, value text, "
+      "weight double precision)");
+
+  /// [BulkParams]
+  pg::BulkParams<int, std::string, std::optional<double>> bulk{3};
+  bulk.AddRow(1, "one", 1.5);
+  bulk.AddRow(2, "two", std::nullopt);
+  bulk.AddRow(3, "three", 3.5);
+
+  auto res = GetConn()->Execute(
+      "insert into bulk_test(id, value, weight) "
+      "select * from unnest($1::integer[], $2::text[], $3::float8[])",
+      std::move(bulk).Build());
+  EXPECT_EQ(3, res.RowsAffected());
+  /// [BulkParams]
+
+  res = GetConn()->Execute(
+      "select id, value, weight from bulk_test order by id");
+  ASSERT_EQ(3, res.Size());
+  EXPECT_EQ("one", res[0]["value"].As<std::string>());
+  EXPECT_EQ(1.5, res[0]["weight"].As<double>());
+  EXPECT_TRUE(res[1]["weight"].IsNull());
+  EXPECT_EQ("three", res[2]["value"].As<std::string>());
+}
+
+UTEST_P(PostgreConnection, BulkParamsAny) {
+  CheckConnection(GetConn());
+
+  pg::BulkParams<pg::Bigint> bulk;
+  for (pg::Bigint i = 0; i < 1000; ++i) {
+    bulk.AddRow(i * 2);
+  }
+  auto store = std::move(bulk).Build();
+  store.PushBack(pg::Bigint{10});
+
+  const auto res = GetConn()->Execute(
+      "select count(*) from generate_series(1, 2000) i "
+      "where i = any($1) and i > $2",
+      store);
+  EXPECT_EQ(994, res.AsSingleRow<pg::Bigint>());
+}
+
+UTEST_P(PostgreConnection, BulkParamsEmpty) {
+  CheckConnection(GetConn());
+
+  pg::BulkParams<int, std::string> bulk;
+  EXPECT_TRUE(bulk.IsEmpty());
+
+  const auto res = GetConn()->Execute(
+      "select $1::integer[], cardinality($2::text[])", std::move(bulk).Build());
+  EXPECT_TRUE(res.Front()[0].As<std::vector<int>>().empty());
+  EXPECT_EQ(0, res.Front()[1].As<int>());
+}
+
+USERVER_NAMESPACE_END
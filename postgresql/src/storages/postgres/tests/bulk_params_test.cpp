@@ -0,0 +1,77 @@
+#include <gtest/gtest.h>
+
+#include <optional>
+#include <string>
+#include <vector>
+
+#include <userver/storages/postgres/bulk_params.hpp>
+#include <userver/storages/postgres/parameter_store.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace pg = storages::postgres;
+
+namespace {
+
+std::string GetParam(const pg::ParameterStore& store, std::size_t index) {
+  const auto& params = store.GetInternalData();
+  return {params.ParamBuffers()[index],
+          static_cast<std::size_t>(params.ParamLengthsBuffer()[index])};
+}
+
+void ExpectSameParams(const pg::ParameterStore& lhs,
+                      const pg::ParameterStore& rhs) {
+  const auto& lhs_params = lhs.GetInternalData();
+  const auto& rhs_params = rhs.GetInternalData();
+  ASSERT_EQ(lhs_params.Size(), rhs_params.Size());
+  for (std::size_t i = 0; i < lhs_params.Size(); ++i) {
+    EXPECT_EQ(lhs_params.ParamTypesBuffer()[i],
+              rhs_params.ParamTypesBuffer()[i]);
+    EXPECT_EQ(lhs_params.ParamFormatsBuffer()[i],
+              rhs_params.ParamFormatsBuffer()[i]);
+    EXPECT_EQ(GetParam(lhs, i), GetParam(rhs, i));
+  }
+}
+
+}  // namespace
+
+TEST(PostgreBulkParams, SameAsArrays) {
+  const std::vector<int> ids{1, 2, 3};
+  const std::vector<std::string> values{"one", "", "three"};
+  const std::vector<std::optional<double>> weights{1.5, std::nullopt, 3.5};
+
+  pg::BulkParams<int, std::string, std::optional<double>> bulk{ids.size()};
+  for (std::size_t i = 0; i < ids.size(); ++i) {
+    bulk.AddRow(ids[i], values[i], weights[i]);
+  }
+  EXPECT_EQ(ids.size(), bulk.Size());
+
+  pg::ParameterStore expected;
+  expected.PushBack(ids).PushBack(values).PushBack(weights);
+  ExpectSameParams(std::move(bulk).Build(), expected);
+}
+
+TEST(PostgreBulkParams, Empty) {
+  pg::BulkParams<pg::Bigint, std::string> bulk;
+  EXPECT_TRUE(bulk.IsEmpty());
+
+  pg::ParameterStore expected;
+  expected.PushBack(std::vector<pg::Bigint>{})
+      .PushBack(std::vector<std::string>{});
+  ExpectSameParams(std::move(bulk).Build(), expected);
+}
+
+TEST(PostgreBulkParams, MoreParams) {
+  pg::BulkParams<pg::Bigint> bulk;
+  bulk.AddRow(1).AddRow(2);
+
+  auto store = std::move(bulk).Build();
+  store.PushBack(pg::Bigint{42});
+  EXPECT_EQ(2, store.Size());
+
+  pg::ParameterStore expected;
+  expected.PushBack(std::vector<pg::Bigint>{1, 2}).PushBack(pg::Bigint{42});
+  ExpectSameParams(store, expected);
+}
+
+USERVER_NAMESPACE_END
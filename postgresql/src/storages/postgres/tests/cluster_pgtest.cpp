@@ -1,5 +1,9 @@
 #include <storages/postgres/tests/util_pgtest.hpp>
 
+#include <optional>
+#include <string>
+#include <vector>
+
 #include <gtest/gtest.h>
 
 #include <userver/utest/utest.hpp>
@@ -7,6 +11,7 @@
 #include <storages/postgres/detail/connection.hpp>
 #include <storages/postgres/postgres_config.hpp>
 #include <userver/dynamic_config/test_helpers.hpp>
+#include <userver/engine/async.hpp>
 #include <userver/storages/postgres/cluster.hpp>
 #include <userver/storages/postgres/dsn.hpp>
 #include <userver/storages/postgres/exceptions.hpp>
@@ -45,7 +50,9 @@ void CheckRwTransaction(pg::Transaction trx) {
 pg::Cluster CreateCluster(
     const pg::DsnList& dsns, engine::TaskProcessor& bg_task_processor,
     size_t max_size, testsuite::TestsuiteTasks& testsuite_tasks,
-    pg::ConnectionSettings conn_settings = kCachePreparedStatements) {
+    pg::ConnectionSettings conn_settings = kCachePreparedStatements,
+    pg::AutoBatchSettings auto_batch_settings = {},
+    pg::ResultCacheSettings result_cache_settings = {}) {
   auto source = dynamic_config::GetDefaultSource();
   return pg::Cluster(dsns, nullptr, bg_task_processor,
                      {{},
@@ -55,7 +62,9 @@ pg::Cluster CreateCluster(
                       storages::postgres::InitMode::kAsync,
                       "",
                       {},
-                      {}},
+                      {},
+                      auto_batch_settings,
+                      result_cache_settings},
                      {kTestCmdCtl, {}, {}}, {}, {}, testsuite_tasks, source, 0);
 }
 
@@ -174,6 +183,43 @@ UTEST_F(PostgreCluster, ClusterAnyRW) {
       pg::LogicError);
 }
 
+UTEST_F(PostgreCluster, ClusterLeastLoaded) {
+  testsuite::TestsuiteTasks testsuite_tasks{true};
+  auto cluster = CreateCluster(GetDsnListFromEnv(), GetTaskProcessor(), 1,
+                               testsuite_tasks);
+
+  CheckRwTransaction(cluster.Begin(
+      {pg::ClusterHostType::kMaster, pg::ClusterHostType::kLeastLoaded},
+      pg::Transaction::RW));
+  CheckRoTransaction(cluster.Begin(
+      {pg::ClusterHostType::kSlave, pg::ClusterHostType::kLeastLoaded},
+      pg::Transaction::RO));
+  UEXPECT_NO_THROW(cluster.Execute({pg::ClusterHostType::kSlaveOrMaster,
+                                    pg::ClusterHostType::kLeastLoaded},
+                                   "select 1"));
+
+  UEXPECT_THROW(
+      cluster.Begin(
+          {pg::ClusterHostType::kSlave, pg::ClusterHostType::kNearest,
+           pg::ClusterHostType::kLeastLoaded},
+          pg::Transaction::RO),
+      pg::LogicError);
+}
+
+UTEST_F(PostgreCluster, ClusterMaxReplicationLag) {
+  testsuite::TestsuiteTasks testsuite_tasks{true};
+  auto cluster = CreateCluster(GetDsnListFromEnv(), GetTaskProcessor(), 1,
+                               testsuite_tasks);
+
+  // Master has no replication lag
+  const auto cc = kTestCmdCtl.WithMaxReplicationLag(std::chrono::seconds{1});
+  UEXPECT_NO_THROW(
+      cluster.Execute(pg::ClusterHostType::kSlave, cc, "select 1"));
+  CheckRoTransaction(
+      cluster.Begin(pg::ClusterHostType::kSlave, pg::Transaction::RO, cc));
+  CheckRwTransaction(cluster.Begin(pg::Transaction::RW, cc));
+}
+
 UTEST_F(PostgreCluster, ClusterSlaveRO) {
   testsuite::TestsuiteTasks testsuite_tasks{true};
   auto cluster = CreateCluster(GetDsnListFromEnv(), GetTaskProcessor(), 1,
@@ -431,4 +477,71 @@ UTEST_F(PostgreCluster, ListenNotify) {
                 pg::ConnectionTimeoutError);
 }
 
+UTEST_F(PostgreCluster, AutoBatch) {
+  constexpr int kRequestsCount = 100;
+
+  testsuite::TestsuiteTasks testsuite_tasks{true};
+  auto cluster =
+      CreateCluster(GetDsnListFromEnv(), GetTaskProcessor(), 2,
+                    testsuite_tasks, kPipelineEnabled, {true, {}, 16});
+
+  std::vector<engine::TaskWithResult<pg::ResultSet>> tasks;
+  tasks.reserve(kRequestsCount);
+  for (int i = 0; i < kRequestsCount; ++i) {
+    tasks.push_back(engine::AsyncNoSpan([&cluster, i] {
+      return cluster.Execute(pg::ClusterHostType::kMaster,
+                             "select $1::integer, $2::text, 1 / $3::integer",
+                             i, std::to_string(i),
+                             std::optional<int>{i == 42 ? 0 : 1});
+    }));
+  }
+
+  for (int i = 0; i < kRequestsCount; ++i) {
+    if (i == 42) {
+      UEXPECT_THROW(tasks[i].Get(), pg::DataException);
+      continue;
+    }
+    const auto res = tasks[i].Get();
+    ASSERT_EQ(1, res.Size());
+    EXPECT_EQ(i, res[0][0].As<int>());
+    EXPECT_EQ(std::to_string(i), res[0][1].As<std::string>());
+  }
+
+  auto res =
+      cluster.Execute(pg::ClusterHostType::kMaster, "select $1::integer", 1);
+  EXPECT_EQ(1, res.AsSingleRow<int>());
+}
+
+UTEST_F(PostgreCluster, ResultCache) {
+  const pg::Query kCachedQuery{"select $1::integer, random()",
+                               pg::Query::Name{"cached_random"}};
+  const pg::Query kUncachedQuery{"select $1::integer, random()",
+                                 pg::Query::Name{"uncached_random"}};
+
+  pg::ResultCacheSettings result_cache_settings;
+  result_cache_settings.queries = {"cached_random"};
+  result_cache_settings.ttl = utest::kMaxTestWaitTime;
+
+  testsuite::TestsuiteTasks testsuite_tasks{true};
+  auto cluster = CreateCluster(GetDsnListFromEnv(), GetTaskProcessor(), 2,
+                               testsuite_tasks, kCachePreparedStatements, {},
+                               result_cache_settings);
+
+  const auto random_of = [&cluster](const pg::Query& query, int arg) {
+    return cluster.Execute(pg::ClusterHostType::kMaster, query, arg)[0][1]
+        .As<double>();
+  };
+
+  const auto cached = random_of(kCachedQuery, 1);
+  EXPECT_EQ(cached, random_of(kCachedQuery, 1));
+  EXPECT_NE(cached, random_of(kCachedQuery, 2));
+  EXPECT_NE(random_of(kUncachedQuery, 1), random_of(kUncachedQuery, 1));
+
+  pg::ParameterStore store;
+  store.PushBack(1);
+  const auto res = cluster.Execute(pg::ClusterHostType::kMaster, kCachedQuery,
+                                   std::move(store));
+  EXPECT_EQ(cached, res[0][1].As<double>());
+}
+
 USERVER_NAMESPACE_END
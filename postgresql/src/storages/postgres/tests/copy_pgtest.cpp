@@ -0,0 +1,196 @@
+#include <storages/postgres/tests/util_pgtest.hpp>
+
+#include <optional>
+#include <string>
+#include <vector>
+
+#include <storages/postgres/detail/connection.hpp>
+#include <userver/storages/postgres/copy.hpp>
+#include <userver/storages/postgres/io/pg_types.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace pg = storages::postgres;
+
+namespace {
+
+struct CopyRow final {
+  int id{};
+  std::string value;
+  std::optional<double> weight;
+};
+
+void CreateCopyTable(pg::detail::ConnectionPtr& conn) {
+  conn->Execute(
+      "create temporary table copy_test(id integer primary key, value text, "
+      "weight double precision)");
+}
+
+std::vector<CopyRow> MakeRows(int count) {
+  std::vector<CopyRow> rows;
+  rows.reserve(count);
+  for (int i = 0; i < count; ++i) {
+    rows.push_back({i, "value " + std::to_string(i),
+                    i % 2 ? std::optional<double>{i * 0.5} : std::nullopt});
+  }
+  return rows;
+}
+
+}  // namespace
+
+UTEST_P(PostgreConnection, CopyInStream) {
+  CheckConnection(GetConn());
+  CreateCopyTable(GetConn());
+
+  pg::Transaction trx{std::move(GetConn())};
+  /// [CopyIn]
+  auto copy = trx.CopyIn(
+      "copy copy_test(id, value, weight) from stdin (format binary)");
+  copy.WriteRow(1, std::string{"one"}, std::optional<double>{1.5});
+  copy.WriteRow(2, std::string{"two"}, std::optional<double>{});
+  EXPECT_EQ(2, copy.Finish());
+  /// [CopyIn]
+
+  auto res = trx.Execute("select id, value, weight from copy_test order by id");
+  ASSERT_EQ(2, res.Size());
+  EXPECT_EQ("one", res[0]["value"].As<std::string>());
+  EXPECT_EQ(1.5, res[0]["weight"].As<double>());
+  EXPECT_TRUE(res[1]["weight"].IsNull());
+
+  UEXPECT_THROW(copy.Finish(), pg::LogicError);
+  UEXPECT_NO_THROW(trx.Commit());
+}
+
+UTEST_P(PostgreConnection, CopyInContainer) {
+  CheckConnection(GetConn());
+  CreateCopyTable(GetConn());
+
+  // Several chunks of data
+  const auto rows = MakeRows(10'000);
+
+  pg::Transaction trx{std::move(GetConn())};
+  EXPECT_EQ(rows.size(),
+            trx.CopyIn("copy copy_test from stdin (format binary)", rows));
+
+  auto res = trx.Execute("select count(*), sum(weight) from copy_test");
+  EXPECT_EQ(rows.size(), res.Front()[0].As<pg::Bigint>());
+  EXPECT_EQ(0.5 * 5'000 * 5'000, res.Front()[1].As<double>());
+  UEXPECT_NO_THROW(trx.Commit());
+}
+
+UTEST_P(PostgreConnection, CopyOutStream) {
+  CheckConnection(GetConn());
+  CreateCopyTable(GetConn());
+
+  pg::Transaction trx{std::move(GetConn())};
+  trx.Execute(
+      "insert into copy_test select i, 'value ' || i, "
+      "case when i % 2 = 1 then i * 0.5 end from generate_series(0, 999) i");
+
+  /// [CopyOut]
+  auto copy = trx.CopyOut(
+      "copy (select id, value, weight from copy_test order by id) "
+      "to stdout (format binary)");
+  int id = 0;
+  std::string value;
+  std::optional<double> weight;
+  int count = 0;
+  while (copy.ReadRow(id, value, weight)) {
+    EXPECT_EQ(count, id);
+    EXPECT_EQ("value " + std::to_string(id), value);
+    EXPECT_EQ(id % 2 == 1, weight.has_value());
+    ++count;
+  }
+  /// [CopyOut]
+  EXPECT_EQ(1000, count);
+  EXPECT_TRUE(copy.Done());
+  EXPECT_FALSE(copy.ReadRow(id, value, weight));
+
+  UEXPECT_NO_THROW(trx.Execute("select 1"));
+  UEXPECT_NO_THROW(trx.Commit());
+}
+
+UTEST_P(PostgreConnection, CopyRoundTrip) {
+  CheckConnection(GetConn());
+  CreateCopyTable(GetConn());
+
+  const auto rows = MakeRows(5'000);
+
+  pg::Transaction trx{std::move(GetConn())};
+  trx.CopyIn("copy copy_test from stdin (format binary)", rows);
+  const auto copied =
+      trx.CopyOut("copy copy_test to stdout (format binary)")
+          .ReadRows<std::vector<CopyRow>>();
+
+  ASSERT_EQ(rows.size(), copied.size());
+  for (std::size_t i = 0; i < rows.size(); ++i) {
+    EXPECT_EQ(rows[i].id, copied[i].id);
+    EXPECT_EQ(rows[i].value, copied[i].value);
+    EXPECT_EQ(rows[i].weight, copied[i].weight);
+  }
+  UEXPECT_NO_THROW(trx.Commit());
+}
+
+UTEST_P(PostgreConnection, CopyNotCopyStatement) {
+  CheckConnection(GetConn());
+  CreateCopyTable(GetConn());
+
+  pg::Transaction trx{std::move(GetConn())};
+  UEXPECT_THROW(trx.CopyIn("select 1"), pg::LogicError);
+  UEXPECT_THROW(trx.CopyIn("copy copy_test to stdout (format binary)"),
+                pg::LogicError);
+  UEXPECT_NO_THROW(trx.Execute("select 1"));
+  UEXPECT_THROW(trx.CopyOut("copy copy_test from stdin (format binary)"),
+                pg::LogicError);
+  UEXPECT_THROW(trx.Execute("select 1"), pg::InvalidTransactionState);
+}
+
+UTEST_P(PostgreConnection, CopyInServerError) {
+  CheckConnection(GetConn());
+  CreateCopyTable(GetConn());
+
+  pg::Transaction trx{std::move(GetConn())};
+  auto copy = trx.CopyIn("copy copy_test from stdin (format binary)");
+  copy.WriteRow(1, std::string{"one"}, 1.0);
+  copy.WriteRow(1, std::string{"one again"}, 2.0);
+  UEXPECT_THROW(copy.Finish(), pg::UniqueViolation);
+  UEXPECT_NO_THROW(trx.Rollback());
+}
+
+UTEST_P(PostgreConnection, CopyOutTextFormat) {
+  CheckConnection(GetConn());
+  CreateCopyTable(GetConn());
+
+  pg::Transaction trx{std::move(GetConn())};
+  UEXPECT_THROW(trx.CopyOut("copy copy_test to stdout"),
+                pg::InvalidBinaryBuffer);
+}
+
+UTEST_P(PostgreConnection, CopyAbandoned) {
+  CheckConnection(GetConn());
+  CreateCopyTable(GetConn());
+  GetConn()->Execute("insert into copy_test values (1, 'one', 1.0)");
+
+  UEXPECT_NO_THROW(GetConn()->Begin({}, pg::detail::SteadyClock::now()));
+  {
+    pg::CopyInStream copy{GetConn().get(),
+                          "copy copy_test from stdin (format binary)", {}};
+    copy.WriteRow(2, std::string{"two"}, 2.0);
+    UEXPECT_THROW(GetConn()->Execute("select 1"), pg::ConnectionBusy);
+  }
+  UEXPECT_NO_THROW(GetConn()->CancelAndCleanup(utest::kMaxTestWaitTime));
+  EXPECT_TRUE(GetConn()->IsIdle());
+
+  UEXPECT_NO_THROW(GetConn()->Begin({}, pg::detail::SteadyClock::now()));
+  {
+    pg::CopyOutStream copy{GetConn().get(),
+                           "copy copy_test to stdout (format binary)", {}};
+  }
+  UEXPECT_NO_THROW(GetConn()->CancelAndCleanup(utest::kMaxTestWaitTime));
+  EXPECT_TRUE(GetConn()->IsIdle());
+
+  auto res = GetConn()->Execute("select count(*) from copy_test");
+  EXPECT_EQ(1, res.Front().As<pg::Bigint>());
+}
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,243 @@
+#include <gtest/gtest.h>
+
+#include <boost/endian/conversion.hpp>
+
+#include <storages/postgres/detail/pgoutput.hpp>
+#include <userver/storages/postgres/exceptions.hpp>
+#include <userver/storages/postgres/io/integral_types.hpp>
+#include <userver/storages/postgres/io/optional.hpp>
+#include <userver/storages/postgres/io/string_types.hpp>
+#include <userver/storages/postgres/io/user_types.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace pg = storages::postgres;
+
+namespace {
+
+constexpr pg::Oid kRelationOid = 16384;
+
+class MessageBuilder {
+ public:
+  explicit MessageBuilder(char type) : data_{type} {}
+
+  template <typename T>
+  MessageBuilder& Integer(T value) {
+    value = boost::endian::native_to_big(value);
+    data_.append(reinterpret_cast<const char*>(&value), sizeof(value));
+    return *this;
+  }
+
+  MessageBuilder& Byte(char value) {
+    data_ += value;
+    return *this;
+  }
+
+  MessageBuilder& String(std::string_view value) {
+    data_.append(value);
+    data_ += '\0';
+    return *this;
+  }
+
+  MessageBuilder& Column(char kind, std::string_view value = {}) {
+    Byte(kind);
+    if (kind == 't' || kind == 'b') {
+      Integer(static_cast<std::int32_t>(value.size()));
+      data_.append(value);
+    }
+    return *this;
+  }
+
+  const std::string& Get() const { return data_; }
+
+ private:
+  std::string data_;
+};
+
+std::string BinaryInt(std::int32_t value) {
+  value = boost::endian::native_to_big(value);
+  return std::string(reinterpret_cast<const char*>(&value), sizeof(value));
+}
+
+std::string Begin() {
+  return MessageBuilder{'B'}
+      .Integer(std::uint64_t{100})
+      .Integer(std::int64_t{0})
+      .Integer(std::uint32_t{1})
+      .Get();
+}
+
+std::string Commit(pg::Lsn commit_lsn, pg::Lsn end_lsn) {
+  return MessageBuilder{'C'}
+      .Byte(0)
+      .Integer(std::uint64_t{commit_lsn})
+      .Integer(std::uint64_t{end_lsn})
+      .Integer(std::int64_t{0})
+      .Get();
+}
+
+// create table public.items(id integer primary key, name text)
+std::string Relation() {
+  return MessageBuilder{'R'}
+      .Integer(kRelationOid)
+      .String("public")
+      .String("items")
+      .Byte('d')
+      .Integer(std::int16_t{2})
+      .Byte(1)
+      .String("id")
+      .Integer(pg::Oid{23})
+      .Integer(std::int32_t{-1})
+      .Byte(0)
+      .String("name")
+      .Integer(pg::Oid{25})
+      .Integer(std::int32_t{-1})
+      .Get();
+}
+
+}  // namespace
+
+TEST(PostgreReplication, Lsn) {
+  EXPECT_EQ(pg::LsnFromString("16/B374D848"), 0x16B374D848);
+  EXPECT_EQ(pg::LsnToString(0x16B374D848), "16/B374D848");
+  EXPECT_EQ(pg::LsnToString(0), "0/0");
+  EXPECT_THROW(pg::LsnFromString("16B374D848"), pg::InvalidInputFormat);
+  EXPECT_THROW(pg::LsnFromString("16/"), pg::InvalidInputFormat);
+  EXPECT_THROW(pg::LsnFromString("1/x"), pg::InvalidInputFormat);
+}
+
+TEST(PostgreReplication, DecodeTransaction) {
+  const pg::UserTypes types;
+  const auto& categories = types.GetTypeBufferCategories();
+  pg::detail::PgOutputDecoder decoder;
+
+  EXPECT_FALSE(decoder.Decode(Begin()));
+  EXPECT_FALSE(decoder.Decode(Relation()));
+  EXPECT_FALSE(decoder.Decode(MessageBuilder{'I'}
+                                  .Integer(kRelationOid)
+                                  .Byte('N')
+                                  .Integer(std::int16_t{2})
+                                  .Column('b', BinaryInt(1))
+                                  .Column('b', "one")
+                                  .Get()));
+  EXPECT_FALSE(decoder.Decode(MessageBuilder{'U'}
+                                  .Integer(kRelationOid)
+                                  .Byte('N')
+                                  .Integer(std::int16_t{2})
+                                  .Column('b', BinaryInt(2))
+                                  .Column('n')
+                                  .Get()));
+  EXPECT_FALSE(decoder.Decode(MessageBuilder{'D'}
+                                  .Integer(kRelationOid)
+                                  .Byte('K')
+                                  .Integer(std::int16_t{2})
+                                  .Column('b', BinaryInt(3))
+                                  .Column('n')
+                                  .Get()));
+  const auto transaction = decoder.Decode(Commit(200, 250));
+  ASSERT_TRUE(transaction);
+  EXPECT_EQ(transaction->commit_lsn, 200);
+  EXPECT_EQ(transaction->end_lsn, 250);
+  ASSERT_EQ(transaction->changes.size(), 3);
+
+  const auto& insert = transaction->changes[0];
+  EXPECT_EQ(insert.type, pg::ReplicationChange::Type::kInsert);
+  ASSERT_TRUE(insert.relation);
+  EXPECT_EQ(insert.relation->schema, "public");
+  EXPECT_EQ(insert.relation->name, "items");
+  EXPECT_EQ(insert.relation->FindColumn("name"), 1);
+  EXPECT_TRUE(insert.relation->columns[0].is_key);
+  EXPECT_FALSE(insert.old_row);
+  int id = 0;
+  std::string name;
+  insert.new_row.ReadColumn(0, id, categories);
+  insert.new_row.ReadColumn(1, name, categories);
+  EXPECT_EQ(id, 1);
+  EXPECT_EQ(name, "one");
+
+  const auto& update = transaction->changes[1];
+  EXPECT_EQ(update.type, pg::ReplicationChange::Type::kUpdate);
+  std::optional<std::string> optional_name{"x"};
+  update.new_row.ReadColumn(1, optional_name, categories);
+  EXPECT_FALSE(optional_name);
+  EXPECT_TRUE(update.new_row.IsNull(1));
+
+  const auto& erase = transaction->changes[2];
+  EXPECT_EQ(erase.type, pg::ReplicationChange::Type::kDelete);
+  ASSERT_TRUE(erase.old_row);
+  erase.old_row->ReadColumn(0, id, categories);
+  EXPECT_EQ(id, 3);
+}
+
+TEST(PostgreReplication, UnchangedToast) {
+  const pg::UserTypes types;
+  const auto& categories = types.GetTypeBufferCategories();
+  pg::detail::PgOutputDecoder decoder;
+
+  decoder.Decode(Begin());
+  decoder.Decode(Relation());
+  // REPLICA IDENTITY FULL, the old row has the value
+  decoder.Decode(MessageBuilder{'U'}
+                     .Integer(kRelationOid)
+                     .Byte('O')
+                     .Integer(std::int16_t{2})
+                     .Column('b', BinaryInt(1))
+                     .Column('b', "long")
+                     .Byte('N')
+                     .Integer(std::int16_t{2})
+                     .Column('b', BinaryInt(2))
+                     .Column('u')
+                     .Get());
+  // The default replica identity, the value is unknown
+  decoder.Decode(MessageBuilder{'U'}
+                     .Integer(kRelationOid)
+                     .Byte('N')
+                     .Integer(std::int16_t{2})
+                     .Column('b', BinaryInt(3))
+                     .Column('u')
+                     .Get());
+  const auto transaction = decoder.Decode(Commit(200, 250));
+  ASSERT_TRUE(transaction);
+  ASSERT_EQ(transaction->changes.size(), 2);
+
+  int id = 0;
+  std::string name;
+  const auto& full = transaction->changes[0].new_row;
+  full.ReadColumn(0, id, categories);
+  full.ReadColumn(1, name, categories);
+  EXPECT_EQ(id, 2);
+  EXPECT_EQ(name, "long");
+
+  const auto& partial = transaction->changes[1].new_row;
+  EXPECT_EQ(partial.GetKind(1),
+            pg::ReplicationTuple::ColumnKind::kUnchangedToast);
+  EXPECT_THROW(partial.ReadColumn(1, name, categories),
+               pg::InvalidBinaryBuffer);
+}
+
+TEST(PostgreReplication, DecodeErrors) {
+  pg::detail::PgOutputDecoder decoder;
+  EXPECT_THROW(decoder.Decode(Commit(1, 2)), pg::InvalidBinaryBuffer);
+
+  decoder.Decode(Begin());
+  EXPECT_THROW(decoder.Decode(MessageBuilder{'I'}
+                                  .Integer(kRelationOid)
+                                  .Byte('N')
+                                  .Integer(std::int16_t{0})
+                                  .Get()),
+               pg::InvalidBinaryBuffer);
+
+  decoder.Decode(Relation());
+  EXPECT_THROW(decoder.Decode(MessageBuilder{'I'}
+                                  .Integer(kRelationOid)
+                                  .Byte('N')
+                                  .Integer(std::int16_t{1})
+                                  .Column('b', BinaryInt(1))
+                                  .Get()),
+               pg::InvalidBinaryBuffer);
+  EXPECT_THROW(decoder.Decode(MessageBuilder{'I'}.Integer(kRelationOid).Get()),
+               pg::InvalidBinaryBuffer);
+  EXPECT_THROW(decoder.Decode("Z"), pg::InvalidBinaryBuffer);
+}
+
+USERVER_NAMESPACE_END
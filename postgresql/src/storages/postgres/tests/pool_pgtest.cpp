@@ -458,6 +458,40 @@ UTEST_P(PostgrePool, ForQueryQueueBeingNonTransactional) {
   EXPECT_EQ(inserted_values.front(), 1);
 }
 
+UTEST_P(PostgrePool, PreparedStatementsWarmUp) {
+  auto conn_settings = kCachePreparedStatements;
+  conn_settings.prepared_statements_warmup = 10;
+  auto pool = pg::detail::ConnectionPool::Create(
+      GetDsnFromEnv(), nullptr, GetTaskProcessor(), "", GetParam(), {1, 10, 10},
+      conn_settings, {}, GetTestCmdCtls(), {}, {}, {},
+      dynamic_config::GetDefaultSource(),
+      std::make_shared<pg::detail::StatementRegistry>(10));
+
+  {
+    pg::detail::ConnectionPtr conn(nullptr);
+    UASSERT_NO_THROW(conn = pool->Acquire(MakeDeadline()));
+    UEXPECT_NO_THROW(conn->Execute("select 2"));
+  }
+  {
+    const auto& stats = pool->GetStatistics();
+    EXPECT_EQ(stats.transaction.prepared_cache_miss_total, 1);
+    EXPECT_EQ(stats.transaction.prepared_warmup_total, 0);
+  }
+
+  {
+    pg::detail::ConnectionPtr busy_conn(nullptr);
+    UASSERT_NO_THROW(busy_conn = pool->Acquire(MakeDeadline()));
+    // A new connection is created with the statement already prepared
+    pg::detail::ConnectionPtr conn(nullptr);
+    UASSERT_NO_THROW(conn = pool->Acquire(MakeDeadline()));
+    UEXPECT_NO_THROW(conn->Execute("select 2"));
+  }
+  const auto& stats = pool->GetStatistics();
+  EXPECT_EQ(stats.transaction.prepared_cache_miss_total, 1);
+  EXPECT_EQ(stats.transaction.prepared_warmup_total, 1);
+  EXPECT_EQ(stats.transaction.prepared_cache_hit_total, 1);
+}
+
 INSTANTIATE_UTEST_SUITE_P(
     PoolTests, PostgrePool,
     ::testing::Values(pg::InitMode::kAsync, pg::InitMode::kSync),
@@ -0,0 +1,109 @@
+#include <userver/utest/utest.hpp>
+
+#include <storages/postgres/detail/pool_size_controller.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+namespace pg = storages::postgres;
+
+using Controller = pg::detail::PoolSizeController;
+using Decision = Controller::Decision;
+
+pg::PoolSettings MakeSettings() {
+  pg::PoolSettings settings;
+  settings.min_size = 2;
+  settings.max_size = 18;
+  settings.adaptive_size = true;
+  settings.adaptive_grow_wait = std::chrono::milliseconds{10};
+  return settings;
+}
+
+// Makes the controller see the same sample the required number of times
+Decision UpdateTimes(Controller& controller, const pg::PoolSettings& settings,
+                     const Controller::Sample& sample, std::size_t times) {
+  auto decision = Decision::kKeep;
+  for (std::size_t i = 0; i < times; ++i) {
+    decision = controller.Update(settings, sample);
+  }
+  return decision;
+}
+
+const Controller::Sample kLongWait{std::chrono::milliseconds{10}, 0, 0};
+const Controller::Sample kIdle{std::chrono::milliseconds{0}, 0, 4};
+
+}  // namespace
+
+TEST(PoolSizeController, Grow) {
+  const auto settings = MakeSettings();
+  Controller controller{settings.min_size};
+
+  EXPECT_EQ(Decision::kKeep, controller.Update(settings, kLongWait));
+  EXPECT_EQ(Decision::kGrow, controller.Update(settings, kLongWait));
+  EXPECT_EQ(6, controller.GetTargetSize());
+
+  EXPECT_EQ(Decision::kGrow,
+            UpdateTimes(controller, settings, {{}, 1, 0},
+                        Controller::kGrowSamples));
+  EXPECT_EQ(10, controller.GetTargetSize());
+
+  UpdateTimes(controller, settings, kLongWait, 10 * Controller::kGrowSamples);
+  EXPECT_EQ(settings.max_size, controller.GetTargetSize());
+}
+
+TEST(PoolSizeController, Shrink) {
+  const auto settings = MakeSettings();
+  Controller controller{settings.max_size};
+
+  EXPECT_EQ(Decision::kKeep, UpdateTimes(controller, settings, kIdle,
+                                         Controller::kShrinkSamples - 1));
+  // The minimal number of idle connections over the period matters
+  EXPECT_EQ(Decision::kShrink,
+            controller.Update(settings, {std::chrono::milliseconds{0}, 0, 2}));
+  EXPECT_EQ(17, controller.GetTargetSize());
+
+  UpdateTimes(controller, settings, kIdle, 100 * Controller::kShrinkSamples);
+  EXPECT_EQ(settings.min_size, controller.GetTargetSize());
+}
+
+TEST(PoolSizeController, Hysteresis) {
+  const auto settings = MakeSettings();
+  Controller controller{10};
+
+  // Long waits interrupted by the short ones do not grow the pool
+  for (int i = 0; i < 10; ++i) {
+    EXPECT_EQ(Decision::kKeep, controller.Update(settings, kLongWait));
+    EXPECT_EQ(Decision::kKeep, controller.Update(settings, kIdle));
+  }
+  EXPECT_EQ(10, controller.GetTargetSize());
+
+  // Waits between the thresholds neither grow nor shrink the pool
+  const Controller::Sample moderate_wait{std::chrono::milliseconds{7}, 0, 4};
+  EXPECT_EQ(Decision::kKeep,
+            UpdateTimes(controller, settings, moderate_wait,
+                        10 * Controller::kShrinkSamples));
+  EXPECT_EQ(10, controller.GetTargetSize());
+
+  // No idle connections, nothing to shrink
+  EXPECT_EQ(Decision::kKeep,
+            UpdateTimes(controller, settings, {{}, 0, 0},
+                        10 * Controller::kShrinkSamples));
+  EXPECT_EQ(10, controller.GetTargetSize());
+}
+
+TEST(PoolSizeController, SettingsChange) {
+  auto settings = MakeSettings();
+  Controller controller{settings.max_size};
+
+  settings.max_size = 8;
+  EXPECT_EQ(Decision::kKeep, controller.Update(settings, {}));
+  EXPECT_EQ(8, controller.GetTargetSize());
+
+  settings.min_size = 12;
+  settings.max_size = 20;
+  EXPECT_EQ(Decision::kKeep, controller.Update(settings, {}));
+  EXPECT_EQ(12, controller.GetTargetSize());
+}
+
+USERVER_NAMESPACE_END
@@ -4,6 +4,7 @@
 #include <userver/storages/postgres/io/pg_types.hpp>
 #include <userver/storages/postgres/parameter_store.hpp>
 #include <userver/storages/postgres/portal.hpp>
+#include <userver/storages/postgres/result_stream.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
@@ -289,6 +290,57 @@ UTEST_P(PostgreConnection, PortalParallel) {
   EXPECT_EQ(second.FetchedSoFar(), kIterations);
 }
 
+UTEST_P(PostgreConnection, ResultStream) {
+  constexpr int kRows = 1000;
+  constexpr std::uint32_t kChunkSize = 64;
+
+  CheckConnection(GetConn());
+
+  pg::Transaction trx{std::move(GetConn())};
+  /// [ResultStream]
+  pg::ResultStream stream{
+      trx.MakePortal("SELECT generate_series(1, $1)", kRows), kChunkSize};
+
+  int expected = 0;
+  while (auto row = stream.NextRow()) {
+    EXPECT_EQ(++expected, (*row)[0].As<int>());
+  }
+  /// [ResultStream]
+  EXPECT_EQ(kRows, expected);
+  EXPECT_EQ(kRows, stream.ReadSoFar());
+  EXPECT_TRUE(stream.Done());
+  EXPECT_FALSE(stream.NextChunk());
+
+  UEXPECT_NO_THROW(trx.Commit());
+}
+
+UTEST_P(PostgreConnection, ResultStreamChunks) {
+  constexpr int kRows = 256;
+  constexpr int kChunkSize = 64;
+
+  CheckConnection(GetConn());
+
+  pg::Transaction trx{std::move(GetConn())};
+  pg::ResultStream stream{
+      trx.MakePortal("SELECT generate_series(1, $1)", kRows), kChunkSize};
+
+  int chunks = 0;
+  while (auto chunk = stream.NextChunk()) {
+    EXPECT_EQ(kChunkSize, chunk->Size());
+    EXPECT_EQ(chunks * kChunkSize + 1, (*chunk)[0][0].As<int>());
+    ++chunks;
+  }
+  EXPECT_EQ(kRows / kChunkSize, chunks);
+  EXPECT_TRUE(stream.Done());
+
+  // The stream is destroyed with a prefetch in flight
+  {
+    pg::ResultStream unfinished{
+        trx.MakePortal("SELECT generate_series(1, $1)", kRows), kChunkSize};
+    EXPECT_TRUE(unfinished.NextChunk());
+  }
+}
+
 }  // namespace
 
 USERVER_NAMESPACE_END
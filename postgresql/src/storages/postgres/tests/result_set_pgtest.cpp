@@ -1,5 +1,9 @@
 #include <storages/postgres/tests/util_pgtest.hpp>
 
+#include <optional>
+#include <string>
+#include <string_view>
+
 #include <userver/storages/postgres/result_set.hpp>
 
 USERVER_NAMESPACE_BEGIN
@@ -147,4 +151,64 @@ UTEST_P(PostgreConnection, ResultAsOptionalSingleRow) {
   UEXPECT_THROW(res.AsOptionalSingleRow<int>(), pg::NonSingleRowResultSet);
 }
 
+UTEST_P(PostgreConnection, ResultAsColumns) {
+  CheckConnection(GetConn());
+
+  pg::ResultSet res{nullptr};
+  UEXPECT_NO_THROW(
+      res = GetConn()->Execute(
+          "select i::int2, i, i::int8, i::float4, i * 0.5::float8, "
+          "'text ' || i, ('bytea ' || i)::bytea, i % 2 = 0 "
+          "from generate_series(1, 1000) i"));
+
+  const auto columns =
+      res.AsColumns<pg::Smallint, pg::Integer, pg::Bigint, float, double,
+                    std::string_view, std::string_view, bool>();
+  ASSERT_EQ(1000, columns.Size());
+  ASSERT_EQ(1000, columns.Get<0>().size());
+  for (std::size_t row = 0; row < columns.Size(); ++row) {
+    const int i = row + 1;
+    EXPECT_EQ(i, columns.Get<0>()[row]);
+    EXPECT_EQ(i, columns.Get<1>()[row]);
+    EXPECT_EQ(i, columns.Get<2>()[row]);
+    EXPECT_EQ(i, columns.Get<3>()[row]);
+    EXPECT_EQ(i * 0.5, columns.Get<4>()[row]);
+    EXPECT_EQ("text " + std::to_string(i), columns.Get<5>()[row]);
+    EXPECT_EQ("bytea " + std::to_string(i), columns.Get<6>()[row]);
+    EXPECT_EQ(i % 2 == 0, columns.Get<7>()[row]);
+  }
+}
+
+UTEST_P(PostgreConnection, ResultAsColumnsFallback) {
+  CheckConnection(GetConn());
+
+  pg::ResultSet res{nullptr};
+  UEXPECT_NO_THROW(
+      res = GetConn()->Execute("select i::int2, case when i % 3 <> 0 then i "
+                               "end, 'text ' || i "
+                               "from generate_series(1, 100) i"));
+
+  // Values of other size, nulls and the types without the bulk decoding
+  const auto columns =
+      res.AsColumns<pg::Bigint, std::optional<pg::Integer>, std::string>();
+  ASSERT_EQ(100, columns.Size());
+  for (std::size_t row = 0; row < columns.Size(); ++row) {
+    const int i = row + 1;
+    EXPECT_EQ(i, columns.Get<0>()[row]);
+    EXPECT_EQ(i % 3 == 0, !columns.Get<1>()[row].has_value());
+    EXPECT_EQ("text " + std::to_string(i), columns.Get<2>()[row]);
+  }
+
+  UEXPECT_THROW((res.AsColumns<pg::Integer, pg::Integer, std::string>()),
+                pg::FieldValueIsNull);
+  UEXPECT_THROW((res.AsColumns<pg::Integer, pg::Integer>()),
+                pg::FieldTupleMismatch);
+
+  UEXPECT_NO_THROW(res = GetConn()->Execute(
+                       "select * from generate_series(0, -1)"));
+  const auto empty = res.AsColumns<pg::Integer>();
+  EXPECT_TRUE(empty.IsEmpty());
+  EXPECT_TRUE(empty.Get<0>().empty());
+}
+
 USERVER_NAMESPACE_END
@@ -0,0 +1,76 @@
+#include <userver/utest/utest.hpp>
+
+#include <algorithm>
+
+#include <userver/storages/postgres/parameter_store.hpp>
+
+#include <storages/postgres/detail/statement_registry.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+namespace pg = storages::postgres;
+
+using Registry = pg::detail::StatementRegistry;
+
+std::vector<std::string> GetHotStatements(const Registry& registry,
+                                          std::size_t count) {
+  std::vector<std::string> result;
+  for (const auto& statement : registry.GetHotStatements(count)) {
+    result.push_back(statement->statement);
+  }
+  return result;
+}
+
+}  // namespace
+
+UTEST(PostgreStatementRegistry, Hotness) {
+  Registry registry{10};
+  const pg::detail::QueryParameters params;
+
+  registry.Register(1, "select 1", params);
+  registry.Register(2, "select 2", params);
+  registry.Register(2, "select 2", params);
+  registry.Register(3, "select 3", params);
+  registry.Register(3, "select 3", params);
+  registry.Register(3, "select 3", params);
+
+  EXPECT_EQ(GetHotStatements(registry, 2),
+            (std::vector<std::string>{"select 3", "select 2"}));
+  EXPECT_EQ(GetHotStatements(registry, 10).size(), 3);
+  EXPECT_TRUE(registry.GetHotStatements(0).empty());
+}
+
+UTEST(PostgreStatementRegistry, Eviction) {
+  Registry registry{2};
+  const pg::detail::QueryParameters params;
+
+  registry.Register(1, "select 1", params);
+  registry.Register(1, "select 1", params);
+  registry.Register(2, "select 2", params);
+  registry.Register(3, "select 3", params);
+
+  // The least recently registered statement is forgotten
+  auto statements = GetHotStatements(registry, 10);
+  std::sort(statements.begin(), statements.end());
+  EXPECT_EQ(statements, (std::vector<std::string>{"select 2", "select 3"}));
+}
+
+UTEST(PostgreStatementRegistry, ParamTypes) {
+  Registry registry{10};
+  pg::ParameterStore store;
+  store.PushBack(1).PushBack(std::string{"foo"});
+
+  const pg::detail::QueryParameters original{store.GetInternalData()};
+  registry.Register(1, "select $1, $2", original);
+
+  const auto statements = registry.GetHotStatements(1);
+  ASSERT_EQ(statements.size(), 1);
+  const auto params = statements.front()->GetParams();
+  ASSERT_EQ(params.Size(), original.Size());
+  EXPECT_EQ(params.TypeHash(), original.TypeHash());
+  EXPECT_EQ(params.ParamBuffers(), nullptr);
+}
+
+USERVER_NAMESPACE_END
@@ -73,7 +73,7 @@ ResultSet Transaction::DoExecute(const Query& query,
   auto source = conn_.GetConfigSource();
   if (source) CheckDeadlineIsExpired(source->GetSnapshot());
 
-  detail::StatementStats stats{query, conn_};
+  detail::StatementStats stats{query, conn_, &params};
   try {
     auto res = conn_->Execute(query, params, std::move(statement_cmd_ctl));
     stats.AccountStatementExecution();
@@ -105,6 +105,18 @@ Portal Transaction::MakePortal(const PortalName& portal_name,
                 std::move(statement_cmd_ctl)};
 }
 
+CopyInStream Transaction::CopyIn(OptionalCommandControl statement_cmd_ctl,
+                                 const Query& query) {
+  return CopyInStream{GetCopyConnection(), query,
+                      std::move(statement_cmd_ctl)};
+}
+
+CopyOutStream Transaction::CopyOut(OptionalCommandControl statement_cmd_ctl,
+                                   const Query& query) {
+  return CopyOutStream{GetCopyConnection(), query,
+                       std::move(statement_cmd_ctl)};
+}
+
 void Transaction::SetParameter(const std::string& param_name,
                                const std::string& value) {
   if (!conn_) {
@@ -160,6 +172,17 @@ const UserTypes& Transaction::GetConnectionUserTypes() const {
   return conn_->GetUserTypes();
 }
 
+detail::Connection* Transaction::GetCopyConnection() {
+  if (!conn_) {
+    LOG_LIMITED_ERROR() << "COPY called after transaction finished"
+                        << logging::LogExtra::Stacktrace();
+    throw NotInTransaction("Transaction handle is not valid");
+  }
+  auto source = conn_.GetConfigSource();
+  if (source) CheckDeadlineIsExpired(source->GetSnapshot());
+  return conn_.get();
+}
+
 OptionalCommandControl Transaction::GetConnTransactionCommandControlDebug()
     const {
   if (!conn_) return std::nullopt;
@@ -5,6 +5,8 @@
 
 #include <storages/postgres/default_command_controls.hpp>
 #include <storages/postgres/detail/connection.hpp>
+#include <storages/postgres/detail/pool.hpp>
+#include <userver/dynamic_config/test_helpers.hpp>
 #include <userver/engine/run_standalone.hpp>
 #include <userver/storages/postgres/dsn.hpp>
 
@@ -58,6 +60,24 @@ void PgConnection::RunStandalone(benchmark::State& state,
   });
 }
 
+ResultSet PgConnection::SelectSeries(std::size_t rows) const {
+  return conn_->Execute(
+      "select i, i::bigint * 1000, i * 0.5::float8, 'value ' || i "
+      "from generate_series(1, $1) i",
+      static_cast<Integer>(rows));
+}
+
+std::shared_ptr<detail::ConnectionPool> PgConnection::MakePipelinePool()
+    const {
+  ConnectionSettings settings{ConnectionSettings::kCachePreparedStatements};
+  settings.pipeline_mode = PipelineMode::kEnabled;
+  return detail::ConnectionPool::Create(
+      GetDsnFromEnv(), nullptr, engine::current_task::GetTaskProcessor(), "",
+      InitMode::kSync, {1, 1, 1}, settings, {},
+      DefaultCommandControls(kBenchCmdCtl, {}, {}), {}, {}, {},
+      dynamic_config::GetDefaultSource());
+}
+
 bool PgConnection::IsConnectionValid() const {
   return conn_ && conn_->IsConnected();
 }
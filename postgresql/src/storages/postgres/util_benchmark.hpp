@@ -1,13 +1,19 @@
 #pragma once
 
 #include <functional>
+#include <memory>
 
 #include <benchmark/benchmark.h>
 
 #include <userver/storages/postgres/options.hpp>
+#include <userver/storages/postgres/result_set.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
+namespace storages::postgres::detail {
+class ConnectionPool;
+}  // namespace storages::postgres::detail
+
 namespace storages::postgres::bench {
 
 inline constexpr const char* kPostgresDsn = "POSTGRES_DSN_BENCH";
@@ -22,6 +28,14 @@ class PgConnection : public benchmark::Fixture {
 
   detail::Connection& GetConnection() const noexcept { return *conn_; }
 
+  // Result set with `rows` rows of integer, bigint, double precision and text
+  // columns for the result decoding benchmarks
+  ResultSet SelectSeries(std::size_t rows) const;
+
+  // Pool of a single connection in the pipeline mode for the QueryQueue
+  // benchmarks, should be created inside RunStandalone
+  std::shared_ptr<detail::ConnectionPool> MakePipelinePool() const;
+
   // Should be used for starting the benchmark's coroutine environment instead
   // of engine::RunStandalone
   void RunStandalone(benchmark::State& state, std::function<void()> payload);
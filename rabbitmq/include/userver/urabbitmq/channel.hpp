@@ -15,6 +15,33 @@ namespace urabbitmq {
 
 class ConnectionPtr;
 
+namespace impl {
+class ResponseAwaiter;
+}
+
+/// @brief Confirmation of a message published with
+/// `ReliableChannel::PublishReliableAsync`.
+///
+/// Dropping it without waiting means ignoring the result of the publish.
+class PublishConfirmation final {
+ public:
+  /// @cond
+  // For internal use only.
+  explicit PublishConfirmation(impl::ResponseAwaiter&& awaiter);
+  /// @endcond
+  ~PublishConfirmation();
+
+  PublishConfirmation(PublishConfirmation&& other) noexcept;
+  PublishConfirmation& operator=(PublishConfirmation&& other) noexcept;
+
+  /// @brief Waits for the broker to confirm the message, throws if the message
+  /// is rejected, the channel breaks or the deadline expires.
+  void Wait(engine::Deadline deadline);
+
+ private:
+  std::unique_ptr<impl::ResponseAwaiter> awaiter_;
+};
+
 /// @brief Publisher interface for the broker.
 /// You may use this class to publish your messages.
 ///
@@ -77,6 +104,24 @@ class ReliableChannel final : IReliableChannelInterface {
                     deadline);
   }
 
+  /// @brief Publish a message to an exchange without waiting for the
+  /// confirmation from the broker.
+  ///
+  /// Allows to keep several unconfirmed messages in flight, which is much
+  /// faster than waiting for each confirmation in turn. The number of
+  /// unconfirmed messages is limited by `max_in_flight_requests` of the
+  /// connection: once it is reached, this call waits for a free slot until
+  /// the deadline.
+  ///
+  /// @param exchange an exchange to publish to
+  /// @param routing_key routing key
+  /// @param message actual message
+  /// @param type type of the message
+  /// @param deadline deadline for the slot acquisition and the publish
+  [[nodiscard]] PublishConfirmation PublishReliableAsync(
+      const Exchange& exchange, const std::string& routing_key,
+      const std::string& message, MessageType type, engine::Deadline deadline);
+
  private:
   utils::FastPimpl<ConnectionPtr, 32, 8> impl_;
 };
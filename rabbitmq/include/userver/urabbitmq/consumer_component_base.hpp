@@ -38,6 +38,7 @@ namespace urabbitmq {
 /// rabbit_name      | Name of the RabbitMQ component to use for consumption
 /// queue            | Name of the queue to consume from
 /// prefetch_count   | prefetch_count for the consumer, limits the amount of in-flight messages
+/// ack_batch_size   | number of processed messages acked with a single `multiple` ack, 1 by default
 ///
 // clang-format on
 class ConsumerComponentBase : public components::ComponentBase {
@@ -24,6 +24,14 @@ struct ConsumerSettings final {
   /// Settings this value to 1 basically makes a consumer synchronous, which
   /// could be of use for some workloads
   std::uint16_t prefetch_count;
+
+  /// Number of processed messages acked with a single `multiple` ack.
+  /// A message is acked only after all the messages delivered before it are
+  /// processed, pending acks are also sent once no message is being processed.
+  ///
+  /// Setting this value to 1 acks each message individually right after it
+  /// is processed
+  std::uint16_t ack_batch_size{1};
 };
 
 }  // namespace urabbitmq
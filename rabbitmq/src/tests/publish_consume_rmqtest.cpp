@@ -150,6 +150,41 @@ UTEST(Consumer, ExhaustesQueue) {
   consumer.Wait();
 }
 
+UTEST(Consumer, PipelinedPublishBatchedAcks) {
+  ClientWrapper client{};
+  client.SetupRmqEntities();
+  urabbitmq::ConsumerSettings settings{client.GetQueue(), 20};
+  settings.ack_batch_size = 8;
+
+  const size_t messages_count = 1000;
+  {
+    auto channel = client->GetReliableChannel(client.GetDeadline());
+    std::vector<urabbitmq::PublishConfirmation> confirmations;
+    confirmations.reserve(messages_count);
+    for (size_t i = 0; i < messages_count; ++i) {
+      confirmations.push_back(channel.PublishReliableAsync(
+          client.GetExchange(), client.GetRoutingKey(), std::to_string(i),
+          urabbitmq::MessageType::kTransient, client.GetDeadline()));
+    }
+    for (auto& confirmation : confirmations) {
+      UEXPECT_NO_THROW(confirmation.Wait(client.GetDeadline()));
+    }
+  }
+
+  {
+    Consumer consumer{client.Get(), settings};
+    consumer.ExpectConsume(messages_count);
+    consumer.Start();
+    EXPECT_EQ(consumer.Wait().size(), messages_count);
+  }
+
+  // Everything is acked, nothing is redelivered
+  Consumer consumer{client.Get(), settings};
+  consumer.Start();
+  engine::InterruptibleSleepFor(std::chrono::milliseconds{200});
+  EXPECT_EQ(consumer.Get().size(), 0);
+}
+
 UTEST(Consumer, ThrowsReturnsToQueue) {
   ClientWrapper client{};
   client.SetupRmqEntities();
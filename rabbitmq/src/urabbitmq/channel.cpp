@@ -1,12 +1,39 @@
 #include <userver/urabbitmq/channel.hpp>
 
+#include <userver/utils/assert.hpp>
+
 #include <urabbitmq/connection_helper.hpp>
 #include <urabbitmq/connection_ptr.hpp>
+#include <urabbitmq/impl/response_awaiter.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
 namespace urabbitmq {
 
+PublishConfirmation::PublishConfirmation(impl::ResponseAwaiter&& awaiter)
+    : awaiter_{std::make_unique<impl::ResponseAwaiter>(std::move(awaiter))} {}
+
+PublishConfirmation::~PublishConfirmation() {
+  if (!awaiter_) return;
+  try {
+    // Marks the awaiter as awaited, the result is ignored
+    awaiter_->Wait(engine::Deadline::Passed());
+  } catch (const std::exception&) {
+  }
+}
+
+PublishConfirmation::PublishConfirmation(PublishConfirmation&& other) noexcept =
+    default;
+
+PublishConfirmation& PublishConfirmation::operator=(
+    PublishConfirmation&& other) noexcept = default;
+
+void PublishConfirmation::Wait(engine::Deadline deadline) {
+  UINVARIANT(awaiter_, "PublishConfirmation is already awaited");
+  const auto awaiter = std::move(awaiter_);
+  awaiter->Wait(deadline);
+}
+
 Channel::Channel(ConnectionPtr&& channel) : impl_{std::move(channel)} {}
 
 Channel::~Channel() = default;
@@ -44,6 +71,13 @@ void ReliableChannel::PublishReliable(const Exchange& exchange,
       .Wait(deadline);
 }
 
+PublishConfirmation ReliableChannel::PublishReliableAsync(
+    const Exchange& exchange, const std::string& routing_key,
+    const std::string& message, MessageType type, engine::Deadline deadline) {
+  return PublishConfirmation{ConnectionHelper::PublishReliable(
+      *impl_, exchange, routing_key, message, type, deadline)};
+}
+
 }  // namespace urabbitmq
 
 USERVER_NAMESPACE_END
@@ -7,6 +7,7 @@
 #include <userver/engine/task/task.hpp>
 #include <userver/logging/log.hpp>
 #include <userver/tracing/span.hpp>
+#include <userver/utils/assert.hpp>
 #include <userver/utils/async.hpp>
 
 #include <urabbitmq/connection.hpp>
@@ -28,6 +29,7 @@ ConsumerBaseImpl::ConsumerBaseImpl(ConnectionPtr&& connection,
     : dispatcher_{engine::current_task::GetTaskProcessor()},
       queue_name_{settings.queue.GetUnderlying()},
       prefetch_count_{settings.prefetch_count},
+      ack_batch_size_{settings.ack_batch_size},
       connection_ptr_{std::move(connection)},
       channel_{connection_ptr_->GetChannel()} {
   // We take ownership of the connection, because if it remains pooled
@@ -79,6 +81,14 @@ void ConsumerBaseImpl::Stop() {
   // Cancel all the active dispatched tasks
   bts_.CancelAndWait();
 
+  // Ack what is processed, so that it is not redelivered
+  try {
+    const std::lock_guard lock{acks_mutex_};
+    FlushAcks();
+  } catch (const std::exception&) {
+    // Connection is broken, the messages will be redelivered
+  }
+
   // Destroy the connection: at this point all the remaining tasks are stopped,
   // consumer is either stopped or in unknown state - that could happen if we
   // didn't receive onSuccess callback yet.
@@ -102,6 +112,15 @@ void ConsumerBaseImpl::OnMessage(const AMQP::Message& message,
   consumed.metadata.exchange = message.exchange();
   consumed.metadata.routingKey = message.routingkey();
 
+  if (ack_batch_size_ > 1) {
+    ++messages_in_processing_;
+    const std::lock_guard lock{acks_mutex_};
+    // Delivery tags are sequential within the channel
+    if (!last_processed_tag_.has_value()) {
+      last_processed_tag_.emplace(delivery_tag - 1);
+    }
+  }
+
   bts_.Detach(engine::AsyncNoSpan(
       dispatcher_,
       [this, consumed = std::move(consumed), span_name = std::move(span_name),
@@ -119,7 +138,9 @@ void ConsumerBaseImpl::OnMessage(const AMQP::Message& message,
         }
 
         try {
-          if (success) {
+          if (ack_batch_size_ > 1) {
+            OnProcessed(delivery_tag, success);
+          } else if (success) {
             channel_.Ack(delivery_tag, {});
             channel_.AccountMessageConsumed();
           } else {
@@ -133,6 +154,42 @@ void ConsumerBaseImpl::OnMessage(const AMQP::Message& message,
       }));
 }
 
+void ConsumerBaseImpl::OnProcessed(uint64_t delivery_tag, bool success) {
+  const std::lock_guard lock{acks_mutex_};
+  --messages_in_processing_;
+  processed_tags_.emplace(delivery_tag, success);
+
+  UASSERT(last_processed_tag_.has_value());
+  while (!processed_tags_.empty() &&
+         processed_tags_.begin()->first == *last_processed_tag_ + 1) {
+    const auto [tag, ack] = *processed_tags_.begin();
+    processed_tags_.erase(processed_tags_.begin());
+    last_processed_tag_.emplace(tag);
+    if (ack) {
+      ack_tag_ = tag;
+      ++pending_acks_;
+    }
+  }
+
+  if (success) {
+    channel_.AccountMessageConsumed();
+  } else {
+    // Rejected deliveries are not acked by the later `multiple` ack
+    channel_.Reject(delivery_tag, true, {});
+  }
+
+  // Do not hold the acks if no more deliveries are coming until they are sent
+  if (pending_acks_ >= ack_batch_size_ || messages_in_processing_ == 0) {
+    FlushAcks();
+  }
+}
+
+void ConsumerBaseImpl::FlushAcks() {
+  if (pending_acks_ == 0) return;
+  pending_acks_ = 0;
+  channel_.AckMultiple(ack_tag_, {});
+}
+
 }  // namespace urabbitmq
 
 USERVER_NAMESPACE_END
@@ -1,8 +1,11 @@
 #pragma once
 
 #include <atomic>
+#include <map>
+#include <optional>
 
 #include <userver/concurrent/background_task_storage.hpp>
+#include <userver/engine/mutex.hpp>
 #include <userver/engine/task/task_processor_fwd.hpp>
 
 #include <urabbitmq/connection_ptr.hpp>
@@ -33,11 +36,14 @@ class ConsumerBaseImpl final {
 
  private:
   void OnMessage(const AMQP::Message& message, uint64_t delivery_tag);
+  void OnProcessed(uint64_t delivery_tag, bool success);
+  void FlushAcks();
   void Stop();
 
   engine::TaskProcessor& dispatcher_;
   const std::string queue_name_;
   uint16_t prefetch_count_;
+  uint16_t ack_batch_size_;
 
   ConnectionPtr connection_ptr_;
   impl::AmqpChannel& channel_;
@@ -48,6 +54,17 @@ class ConsumerBaseImpl final {
 
   std::atomic<bool> stopped_{false};
 
+  // Batched acks state, not used if ack_batch_size_ is 1
+  std::atomic<std::size_t> messages_in_processing_{0};
+  engine::Mutex acks_mutex_;
+  // All the deliveries up to this tag are processed
+  std::optional<uint64_t> last_processed_tag_;
+  // Processed deliveries after last_processed_tag_ -> whether to ack them
+  std::map<uint64_t, bool> processed_tags_;
+  // The latest delivery to ack and the number of deliveries it would ack
+  uint64_t ack_tag_{0};
+  std::size_t pending_acks_{0};
+
   // Underlying channel errored, just restart the consumer
   // (consumer_base polls this and destructs+constructs us if we broke)
   std::atomic<bool> broken_{false};
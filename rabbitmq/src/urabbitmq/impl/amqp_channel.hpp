@@ -59,6 +59,9 @@ class AmqpChannel final {
 
   void Ack(uint64_t delivery_tag, engine::Deadline deadline);
 
+  // Acks all the unacked deliveries up to delivery_tag inclusive
+  void AckMultiple(uint64_t delivery_tag, engine::Deadline deadline);
+
   void Reject(uint64_t delivery_tag, bool requeue, engine::Deadline deadline);
 
   void SetQos(uint16_t prefetch_count, engine::Deadline deadline);
@@ -0,0 +1,95 @@
+#include <string>
+
+#include <benchmark/benchmark.h>
+#include <hiredis/hiredis.h>
+
+#include <userver/storages/redis/impl/reply.hpp>
+#include <userver/storages/redis/parse_reply.hpp>
+#include <userver/utils/assert.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+// HGETALL-like flat array of `fields` key-value pairs
+std::string MakeKeyValuesResp(std::size_t fields, std::size_t value_size) {
+  std::string resp = "*" + std::to_string(fields * 2) + "\r\n";
+  const std::string value(value_size, 'x');
+  for (std::size_t i = 0; i < fields; ++i) {
+    const auto key = "field" + std::to_string(i);
+    resp += "$" + std::to_string(key.size()) + "\r\n" + key + "\r\n";
+    resp += "$" + std::to_string(value.size()) + "\r\n" + value + "\r\n";
+  }
+  return resp;
+}
+
+redisReply* ReadReply(const std::string& resp) {
+  auto* reader = redisReaderCreate();
+  redisReaderFeed(reader, resp.data(), resp.size());
+  void* reply = nullptr;
+  [[maybe_unused]] const auto status = redisReaderGetReply(reader, &reply);
+  UASSERT(status == REDIS_OK && reply);
+  redisReaderFree(reader);
+  return static_cast<redisReply*>(reply);
+}
+
+}  // namespace
+
+void redis_reply_hiredis_read(benchmark::State& state) {
+  const auto resp = MakeKeyValuesResp(state.range(0), state.range(1));
+  for ([[maybe_unused]] auto _ : state) {
+    auto* reply = ReadReply(resp);
+    benchmark::DoNotOptimize(reply);
+    freeReplyObject(reply);
+  }
+  state.SetBytesProcessed(state.iterations() * resp.size());
+}
+BENCHMARK(redis_reply_hiredis_read)
+    ->ArgsProduct({{16, 1024, 65536}, {16, 256}});
+
+void redis_reply_data_from_hiredis(benchmark::State& state) {
+  const auto resp = MakeKeyValuesResp(state.range(0), state.range(1));
+  auto* reply = ReadReply(resp);
+  for ([[maybe_unused]] auto _ : state) {
+    redis::ReplyData data{reply};
+    benchmark::DoNotOptimize(data);
+  }
+  freeReplyObject(reply);
+  state.SetBytesProcessed(state.iterations() * resp.size());
+}
+BENCHMARK(redis_reply_data_from_hiredis)
+    ->ArgsProduct({{16, 1024, 65536}, {16, 256}});
+
+void redis_reply_parse_key_values(benchmark::State& state) {
+  const auto resp = MakeKeyValuesResp(state.range(0), state.range(1));
+  auto* reply = ReadReply(resp);
+  const std::string request_description = "hgetall";
+  for ([[maybe_unused]] auto _ : state) {
+    auto result = storages::redis::ParseReplyDataArray(
+        redis::ReplyData{reply}, request_description,
+        storages::redis::To<std::vector<std::pair<std::string, std::string>>>{});
+    benchmark::DoNotOptimize(result);
+  }
+  freeReplyObject(reply);
+  state.SetBytesProcessed(state.iterations() * resp.size());
+}
+BENCHMARK(redis_reply_parse_key_values)
+    ->ArgsProduct({{16, 1024, 65536}, {16, 256}});
+
+void redis_reply_key_values_view(benchmark::State& state) {
+  const auto resp = MakeKeyValuesResp(state.range(0), state.range(1));
+  auto* reply = ReadReply(resp);
+  const redis::ReplyData data{reply};
+  freeReplyObject(reply);
+  for ([[maybe_unused]] auto _ : state) {
+    std::size_t total = 0;
+    for (const auto key_value : data.GetKeyValues()) {
+      total += key_value.Key().size() + key_value.Value().size();
+    }
+    benchmark::DoNotOptimize(total);
+  }
+}
+BENCHMARK(redis_reply_key_values_view)
+    ->ArgsProduct({{16, 1024, 65536}, {16, 256}});
+
+USERVER_NAMESPACE_END
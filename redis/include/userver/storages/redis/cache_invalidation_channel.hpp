@@ -0,0 +1,81 @@
+#pragma once
+
+/// @file userver/storages/redis/cache_invalidation_channel.hpp
+/// @brief @copybrief storages::redis::CacheInvalidationChannel
+
+#include <string>
+#include <string_view>
+
+#include <userver/cache/invalidation_channel.hpp>
+#include <userver/components/component_fwd.hpp>
+#include <userver/storages/redis/client_fwd.hpp>
+#include <userver/storages/redis/subscription_token.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace storages::redis {
+
+// clang-format off
+
+/// @ingroup userver_components
+///
+/// @brief cache::InvalidationChannelBase that delivers the invalidations of
+/// the LRU cache keys to all the instances of the service over Redis Pub/Sub.
+///
+/// Pub/Sub does not store the messages, so the instances that are
+/// disconnected or restarting miss the invalidations.
+///
+/// ## Static options:
+/// All the options of cache::InvalidationChannelBase and
+/// Name | Description | Default value
+/// ---- | ----------- | -------------
+/// db | name of the redis database in components::Redis::GetClient() to publish to | -
+/// subscribe-db | name of the redis database in components::Redis::GetSubscribeClient() to subscribe to | -
+/// channel | Pub/Sub channel name, the same for all the instances of the service | userver-cache-invalidation
+///
+/// ## Static configuration example:
+///
+/// ```
+///    # yaml
+///    redis-cache-invalidation-channel:
+///        db: hello_service_cache
+///        subscribe-db: hello_service_cache_subscribe
+///    some-lru-cache:
+///        size: 10000
+///        ways: 8
+///        lifetime: 1h
+///        invalidation-channel: redis-cache-invalidation-channel
+/// ```
+
+// clang-format on
+class CacheInvalidationChannel final : public cache::InvalidationChannelBase {
+ public:
+  /// @ingroup userver_component_names
+  /// @brief The default name of storages::redis::CacheInvalidationChannel
+  static constexpr std::string_view kName = "redis-cache-invalidation-channel";
+
+  CacheInvalidationChannel(const components::ComponentConfig& config,
+                           const components::ComponentContext& context);
+
+  ~CacheInvalidationChannel() override;
+
+  static yaml_config::Schema GetStaticConfigSchema();
+
+ private:
+  void DoPublish(std::string message) override;
+
+  const std::string channel_;
+  ClientPtr client_;
+  SubscribeClientPtr subscribe_client_;
+
+  // Subscriptions must be the last fields.
+  SubscriptionToken subscription_;
+};
+
+}  // namespace storages::redis
+
+template <>
+inline constexpr bool
+    components::kHasValidate<storages::redis::CacheInvalidationChannel> = true;
+
+USERVER_NAMESPACE_END
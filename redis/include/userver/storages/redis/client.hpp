@@ -16,6 +16,7 @@
 #include <userver/storages/redis/request.hpp>
 #include <userver/storages/redis/request_eval.hpp>
 #include <userver/storages/redis/request_evalsha.hpp>
+#include <userver/storages/redis/script.hpp>
 #include <userver/storages/redis/transaction.hpp>
 
 USERVER_NAMESPACE_BEGIN
@@ -102,6 +103,27 @@ class Client {
       std::string script, size_t shard,
       const CommandControl& command_control) = 0;
 
+  /// @brief Registers the Lua script to be loaded with SCRIPT LOAD by every
+  /// master and replica connection of the group once connected, including
+  /// reconnections and the instances added on topology changes.
+  ///
+  /// Register the scripts once, e.g. in the component constructor. The
+  /// instances that are already connected get the script on the first
+  /// EvalScript through the EVAL fallback.
+  virtual Script RegisterScript(std::string script) = 0;
+
+  /// @brief Executes the registered script with EVALSHA without sending its
+  /// body. If the server does not know the script (NOSCRIPT), e.g. after
+  /// a restart or SCRIPT FLUSH, the request is transparently retried with
+  /// EVAL, which also loads the script into the server cache.
+  template <typename ScriptResult, typename ReplyType = ScriptResult>
+  RequestEval<ScriptResult, ReplyType> EvalScript(
+      const Script& script, std::vector<std::string> keys,
+      std::vector<std::string> args, const CommandControl& command_control) {
+    return RequestEval<ScriptResult, ReplyType>{EvalScriptCommon(
+        script, std::move(keys), std::move(args), command_control)};
+  }
+
   template <typename ScriptInfo, typename ReplyType = std::decay_t<ScriptInfo>>
   RequestEval<std::decay_t<ScriptInfo>, ReplyType> Eval(
       const ScriptInfo& script_info, std::vector<std::string> keys,
@@ -247,9 +269,14 @@ class Client {
   virtual RequestLtrim Ltrim(std::string key, int64_t start, int64_t stop,
                              const CommandControl& command_control) = 0;
 
+  /// In cluster mode the keys of different hash slots are requested in
+  /// parallel and the values are returned in the order of the keys. If only
+  /// some of the slots fail, redis::PartialRequestFailedException is thrown.
   virtual RequestMget Mget(std::vector<std::string> keys,
                            const CommandControl& command_control) = 0;
 
+  /// In cluster mode the keys of different hash slots are set in parallel,
+  /// without atomicity across the slots.
   virtual RequestMset Mset(
       std::vector<std::pair<std::string, std::string>> key_values,
       const CommandControl& command_control) = 0;
@@ -366,6 +393,34 @@ class Client {
   virtual RequestType Type(std::string key,
                            const CommandControl& command_control) = 0;
 
+  virtual RequestXack Xack(std::string key, std::string group,
+                           std::vector<std::string> ids,
+                           const CommandControl& command_control) = 0;
+
+  /// Appends an entry with an auto generated id, returns the id
+  virtual RequestXadd Xadd(
+      std::string key,
+      std::vector<std::pair<std::string, std::string>> field_values,
+      const CommandControl& command_control) = 0;
+
+  virtual RequestXautoclaim Xautoclaim(
+      std::string key, std::string group, std::string consumer,
+      std::chrono::milliseconds min_idle_time, std::string start, size_t count,
+      const CommandControl& command_control) = 0;
+
+  /// Creates the group and the stream if it does not exist yet
+  virtual RequestXgroupCreate XgroupCreate(
+      std::string key, std::string group, std::string id,
+      const CommandControl& command_control) = 0;
+
+  /// Reads a single stream. For blocking reads prefer a client of a separate
+  /// redis database entry: a blocked command delays the other commands of the
+  /// connection.
+  virtual RequestXreadgroup Xreadgroup(
+      std::string key, std::string group, std::string consumer, std::string id,
+      const XreadgroupOptions& options,
+      const CommandControl& command_control) = 0;
+
   virtual RequestZadd Zadd(std::string key, double score, std::string member,
                            const CommandControl& command_control) = 0;
 
@@ -493,6 +548,9 @@ class Client {
   virtual RequestEvalShaCommon EvalShaCommon(
       std::string script_hash, std::vector<std::string> keys,
       std::vector<std::string> args, const CommandControl& command_control) = 0;
+  virtual RequestEvalCommon EvalScriptCommon(
+      const Script& script, std::vector<std::string> keys,
+      std::vector<std::string> args, const CommandControl& command_control) = 0;
 };
 
 std::string CreateTmpKey(const std::string& key, std::string prefix);
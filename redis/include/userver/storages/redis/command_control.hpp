@@ -83,6 +83,11 @@ struct CommandControl {
 
     /// Send requests to 'best_dc_count' Redis instances with the min ping
     kNearestServerPing,
+
+    /// Send requests to the instance with the least product of the running
+    /// commands count and the decaying peak of the reply latency, moves the
+    /// load away from the slow or stalled instances
+    kLeastLatency,
   };
 
   /// Timeout for a single attempt to execute command
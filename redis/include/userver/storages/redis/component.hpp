@@ -64,6 +64,10 @@ namespace components {
 /// groups.[].db | name to refer to the cluster in components::Redis::GetClient() | -
 /// groups.[].sharding_strategy | one of RedisCluster, KeyShardCrc32, KeyShardTaximeterCrc32 or KeyShardGpsStorageDriver | "KeyShardTaximeterCrc32"
 /// groups.[].allow_reads_from_master | allows read requests from master instance | false
+/// groups.[].near_cache | enables the client-side cache of GET, HGET and MGET invalidated with RESP3 client tracking, requires Redis 6+ | -
+/// groups.[].near_cache.max_bytes | budget of the cached keys and values, the least recently used keys are evicted | 16777216
+/// groups.[].near_cache.prefixes | only the keys with these prefixes are cached, all keys if empty | []
+/// groups.[].near_cache.bcast | track the prefixes in BCAST mode instead of the keys read by each connection | false
 /// subscribe_groups | array of redis clusters to work with in subscribe mode | -
 /// subscribe_groups.[].config_name | key name in secdist with options for this cluster | -
 /// subscribe_groups.[].db | name to refer to the cluster in components::Redis::GetSubscribeClient() | -
@@ -3,7 +3,9 @@
 /// @file userver/storages/redis/exception.hpp
 /// @brief redis-specific exceptions
 
+#include <cstddef>
 #include <stdexcept>
+#include <string>
 #include <string_view>
 
 #include <userver/storages/redis/reply_status.hpp>
@@ -39,6 +41,23 @@ class RequestFailedException : public Exception {
   ReplyStatus status_;
 };
 
+/// Some of the per hash slot parts of a multi-key request failed in cluster
+/// mode while the others succeeded
+class PartialRequestFailedException : public Exception {
+ public:
+  PartialRequestFailedException(const std::string& request_description,
+                                std::size_t failed_count,
+                                std::size_t total_count,
+                                const std::string& error);
+
+  std::size_t GetFailedCount() const;
+  std::size_t GetTotalCount() const;
+
+ private:
+  std::size_t failed_count_;
+  std::size_t total_count_;
+};
+
 /// Request was cancelled
 class RequestCancelledException : public Exception {
  public:
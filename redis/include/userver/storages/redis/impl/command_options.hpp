@@ -1,5 +1,6 @@
 #pragma once
 
+#include <chrono>
 #include <optional>
 #include <string>
 #include <vector>
@@ -78,6 +79,16 @@ struct ScanOptions {
   std::optional<size_t> count;
 };
 
+struct XreadgroupOptions {
+  /// Maximum number of entries to read
+  std::optional<size_t> count;
+  /// Wait for new entries for up to this long; the command timeout of the
+  /// CommandControl must be greater than that
+  std::optional<std::chrono::milliseconds> block;
+  /// Do not add the read entries to the pending entries list
+  bool noack = false;
+};
+
 struct ScoreOptions {
   bool withscores = false;
 };
@@ -106,6 +117,8 @@ void PutArg(CmdArgs::CmdArgsArray& args_, const ZaddOptions& arg);
 
 void PutArg(CmdArgs::CmdArgsArray& args_, const ScanOptions& arg);
 
+void PutArg(CmdArgs::CmdArgsArray& args_, const XreadgroupOptions& arg);
+
 void PutArg(CmdArgs::CmdArgsArray& args_, const ScoreOptions& arg);
 
 void PutArg(CmdArgs::CmdArgsArray& args_, const RangeOptions& arg);
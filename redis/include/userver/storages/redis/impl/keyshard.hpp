@@ -9,6 +9,9 @@ namespace redis {
 
 void GetRedisKey(const std::string& key, size_t* key_start, size_t* key_len);
 
+/// Redis cluster hash slot of the key, respects the hash tags
+size_t HashSlot(const std::string& key);
+
 class KeyShard {
  public:
   virtual ~KeyShard() = default;
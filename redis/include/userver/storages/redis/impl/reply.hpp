@@ -2,6 +2,7 @@
 
 #include <cassert>
 #include <string>
+#include <string_view>
 #include <vector>
 
 #include <userver/logging/log_extra.hpp>
@@ -37,8 +38,10 @@ class ReplyData final {
       KeyValue(const Array& array, size_t index)
           : array_(array), index_(index) {}
 
-      std::string Key() const { return array_[index_ * 2].GetString(); }
-      std::string Value() const { return array_[index_ * 2 + 1].GetString(); }
+      const std::string& Key() const { return array_[index_ * 2].GetString(); }
+      const std::string& Value() const {
+        return array_[index_ * 2 + 1].GetString();
+      }
 
      private:
       const Array& array_;
@@ -161,6 +164,13 @@ class ReplyData final {
     return string_;
   }
 
+  /// Non-owning view of a kString, kStatus or kError reply, valid as long as
+  /// the ReplyData is alive and not modified
+  std::string_view GetStringView() const {
+    UASSERT(IsString() || IsStatus() || IsError());
+    return string_;
+  }
+
   const Array& GetArray() const {
     UASSERT(IsArray());
     return array_;
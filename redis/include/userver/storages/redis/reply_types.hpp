@@ -1,6 +1,7 @@
 #pragma once
 
 #include <string>
+#include <utility>
 #include <vector>
 
 #include <userver/storages/redis/impl/base.hpp>
@@ -111,6 +112,31 @@ enum class StatusPong { kPong };
 
 using TtlReply = USERVER_NAMESPACE::redis::TtlReply;
 
+struct StreamEntry final {
+  std::string id;
+  /// Empty for the entries that were deleted from the stream while pending
+  std::vector<std::pair<std::string, std::string>> field_values;
+
+  bool operator==(const StreamEntry& rhs) const {
+    return std::tie(id, field_values) == std::tie(rhs.id, rhs.field_values);
+  }
+
+  bool operator!=(const StreamEntry& rhs) const { return !(*this == rhs); }
+};
+
+/// Parsing tag of the XREADGROUP reply for a single stream; the request
+/// returns std::vector<StreamEntry> that is empty if BLOCK timed out
+struct XreadgroupReply final {};
+
+struct XautoclaimReply final {
+  /// Cursor for the next XAUTOCLAIM call, "0-0" when the whole pending
+  /// entries list was scanned
+  std::string next_start_id;
+  std::vector<StreamEntry> entries;
+};
+
+enum class XgroupCreateReply { kCreated, kAlreadyExists };
+
 }  // namespace storages::redis
 
 USERVER_NAMESPACE_END
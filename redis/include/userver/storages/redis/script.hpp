@@ -0,0 +1,35 @@
+#pragma once
+
+/// @file userver/storages/redis/script.hpp
+/// @brief @copybrief storages::redis::Script
+
+#include <memory>
+#include <string>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace storages::redis {
+
+/// @brief Lua script registered with Client::RegisterScript, cheap to copy.
+class Script final {
+ public:
+  /// Computes the SHA1 digest of the script
+  explicit Script(std::string body);
+
+  const std::string& GetBody() const noexcept { return data_->body; }
+
+  /// Lowercase hex SHA1 digest, as EVALSHA expects
+  const std::string& GetSha1() const noexcept { return data_->sha1; }
+
+ private:
+  struct Data final {
+    std::string body;
+    std::string sha1;
+  };
+
+  std::shared_ptr<const Data> data_;
+};
+
+}  // namespace storages::redis
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,100 @@
+#pragma once
+
+/// @file userver/storages/redis/stream_consumer.hpp
+/// @brief @copybrief storages::redis::StreamConsumer
+
+#include <chrono>
+#include <functional>
+#include <memory>
+#include <string>
+
+#include <userver/engine/task/task_processor_fwd.hpp>
+#include <userver/utils/span.hpp>
+
+#include <userver/storages/redis/client_fwd.hpp>
+#include <userver/storages/redis/reply_types.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace storages::redis {
+
+struct StreamConsumerSettings final {
+  /// Key of the stream
+  std::string stream;
+  /// Consumer group. If missing, it is created on start with the stream and
+  /// gets only the entries added afterwards
+  std::string group;
+  /// Name of this consumer in the group, must be unique among the consumers
+  /// of the group and should be the same across restarts of the same worker
+  std::string consumer;
+
+  /// Maximum number of entries in a batch passed to the callback
+  size_t batch_size{100};
+  /// XREADGROUP BLOCK time. Also bounds the delay of XACK: acks are queued
+  /// behind the blocked read on the connection
+  std::chrono::milliseconds block_timeout{1000};
+  /// Number of batches processed concurrently. Reading stops while that many
+  /// batches are processed or acked
+  size_t max_batches_in_flight{1};
+
+  /// Entries pending for longer than that in other consumers are reclaimed by
+  /// XAUTOCLAIM. Must be greater than the batch processing time
+  std::chrono::milliseconds claim_min_idle_time{std::chrono::minutes{1}};
+  /// How often XAUTOCLAIM is called, zero to disable reclaiming
+  std::chrono::milliseconds claim_interval{std::chrono::seconds{10}};
+
+  /// Delay before retrying after a redis error
+  std::chrono::milliseconds error_retry_delay{std::chrono::seconds{1}};
+};
+
+/// @ingroup userver_clients
+///
+/// @brief RAII consumer of a Redis Stream consumer group, similar to
+/// kafka::ConsumerScope.
+///
+/// Reads the stream in batches with XREADGROUP, starting with the entries
+/// left pending for this consumer name by the previous run, and passes each
+/// batch to the callback on the given task processor. Entries of a successfully
+/// processed batch are acknowledged with a single XACK. If the callback throws,
+/// the batch stays pending and is reclaimed by XAUTOCLAIM of some consumer of
+/// the group after `claim_min_idle_time`, so the processing should be
+/// idempotent.
+///
+/// Blocking reads hold the connection, so pass a client of a redis database
+/// entry that is not used for other requests: list the same `config_name`
+/// under another `db` name in the `groups` of components::Redis.
+///
+/// @note Must be placed as one of the last fields in the consumer component,
+/// because the callback often captures `this`.
+class StreamConsumer final {
+ public:
+  /// @brief Callback that is invoked on each batch of entries.
+  using Callback = std::function<void(utils::span<const StreamEntry>)>;
+
+  StreamConsumer(ClientPtr client, StreamConsumerSettings settings,
+                 engine::TaskProcessor& task_processor);
+
+  /// @brief Stops the consumer (if not yet stopped).
+  ~StreamConsumer();
+
+  StreamConsumer(StreamConsumer&&) noexcept = delete;
+  StreamConsumer& operator=(StreamConsumer&&) noexcept = delete;
+
+  /// @brief Creates the group if needed and starts reading the stream.
+  void Start(Callback callback);
+
+  /// @brief Stops reading and cancels the batches being processed.
+  ///
+  /// The entries of the unfinished batches stay pending and are reclaimed
+  /// later.
+  void Stop() noexcept;
+
+ private:
+  class Impl;
+
+  std::unique_ptr<Impl> impl_;
+};
+
+}  // namespace storages::redis
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,65 @@
+#include <userver/storages/redis/cache_invalidation_channel.hpp>
+
+#include <userver/components/component.hpp>
+#include <userver/yaml_config/merge_schemas.hpp>
+
+#include <userver/storages/redis/client.hpp>
+#include <userver/storages/redis/component.hpp>
+#include <userver/storages/redis/subscribe_client.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace storages::redis {
+
+namespace {
+
+constexpr std::string_view kDefaultChannel = "userver-cache-invalidation";
+
+}  // namespace
+
+CacheInvalidationChannel::CacheInvalidationChannel(
+    const components::ComponentConfig& config,
+    const components::ComponentContext& context)
+    : InvalidationChannelBase(config, context),
+      channel_(config["channel"].As<std::string>(kDefaultChannel)) {
+  auto& redis = context.FindComponent<components::Redis>();
+  client_ = redis.GetClient(config["db"].As<std::string>());
+  subscribe_client_ =
+      redis.GetSubscribeClient(config["subscribe-db"].As<std::string>());
+
+  subscription_ = subscribe_client_->Subscribe(
+      channel_, [this](const std::string&, const std::string& message) {
+        OnMessage(message);
+      });
+}
+
+CacheInvalidationChannel::~CacheInvalidationChannel() {
+  subscription_.Unsubscribe();
+}
+
+yaml_config::Schema CacheInvalidationChannel::GetStaticConfigSchema() {
+  return yaml_config::MergeSchemas<cache::InvalidationChannelBase>(R"(
+type: object
+description: LRU cache invalidation channel over Redis Pub/Sub
+additionalProperties: false
+properties:
+    db:
+        type: string
+        description: name of the redis database to publish to
+    subscribe-db:
+        type: string
+        description: name of the redis database to subscribe to
+    channel:
+        type: string
+        description: Pub/Sub channel name, the same for all the instances
+        defaultDescription: userver-cache-invalidation
+)");
+}
+
+void CacheInvalidationChannel::DoPublish(std::string message) {
+  client_->Publish(channel_, std::move(message), {});
+}
+
+}  // namespace storages::redis
+
+USERVER_NAMESPACE_END
@@ -114,8 +114,15 @@ UTEST_F(RedisClusterClientTest, DISABLED_MgetCrossSlot) {
   }
 
   {
-    auto req = client->Mget({MakeKey(idx[0]), MakeKey(idx[1])}, kDefaultCc);
-    UASSERT_THROW(req.Get(), redis::ParseReplyException);
+    // Split by hash slot and reassembled in the order of the keys
+    auto req = client->Mget(
+        {MakeKey(idx[1]), "missing_" + MakeKey(idx[0]), MakeKey(idx[0])},
+        kDefaultCc);
+    auto reply = req.Get();
+    ASSERT_EQ(reply.size(), 3);
+    EXPECT_EQ(reply[0], std::to_string(add + idx[1]));
+    EXPECT_FALSE(reply[1]);
+    EXPECT_EQ(reply[2], std::to_string(add + idx[0]));
   }
 
   for (unsigned long i : idx) {
@@ -124,6 +131,31 @@ UTEST_F(RedisClusterClientTest, DISABLED_MgetCrossSlot) {
   }
 }
 
+UTEST_F(RedisClusterClientTest, DISABLED_MsetCrossSlot) {
+  auto client = GetClient();
+
+  const size_t kNumKeys = 10;
+  const int add = 100;
+
+  std::vector<std::pair<std::string, std::string>> key_values;
+  std::vector<std::string> keys;
+  for (size_t i = 0; i < kNumKeys; ++i) {
+    key_values.emplace_back(MakeKey(i), std::to_string(add + i));
+    keys.push_back(MakeKey(i));
+  }
+  UASSERT_NO_THROW(client->Mset(key_values, kDefaultCc).Get());
+
+  auto reply = client->Mget(keys, kDefaultCc).Get();
+  ASSERT_EQ(reply.size(), kNumKeys);
+  for (size_t i = 0; i < kNumKeys; ++i) {
+    EXPECT_EQ(reply[i], std::to_string(add + i));
+  }
+
+  for (const auto& key : keys) {
+    EXPECT_EQ(client->Del(key, kDefaultCc).Get(), 1);
+  }
+}
+
 UTEST_F(RedisClusterClientTest, DISABLED_Transaction) {
   auto client = GetClient();
   auto transaction = client->Multi();
@@ -1,7 +1,13 @@
 #include "client_impl.hpp"
 
+#include <algorithm>
+#include <iterator>
+#include <unordered_map>
+
+#include <userver/storages/redis/impl/keyshard.hpp>
 #include <userver/utils/assert.hpp>
 
+#include <storages/redis/impl/near_cache.hpp>
 #include <storages/redis/impl/sentinel.hpp>
 
 #include "impl/command_control_impl.hpp"
@@ -35,12 +41,52 @@ void DoCheckShard(size_t shard, std::optional<size_t> force_shard_idx) {
         ')');
 }
 
+using NearCache = USERVER_NAMESPACE::redis::NearCache;
+
+ReplyPtr MakeNearCachedReply(std::string cmd, NearCache::Value&& value) {
+  return std::make_shared<Reply>(
+      std::move(cmd),
+      value ? ReplyData{std::move(*value)} : ReplyData::CreateNil());
+}
+
+std::optional<NearCache::Value> ToNearCachedValue(const ReplyData& data) {
+  if (data.IsString()) return NearCache::Value{data.GetString()};
+  if (data.IsNil()) return NearCache::Value{};
+  return std::nullopt;
+}
+
+template <typename T>
+struct SlotPart {
+  std::vector<T> args;
+  // Indexes of the args in the original command
+  std::vector<size_t> positions;
+};
+
+// A cluster rejects the multi-key commands over several hash slots
+template <typename T, typename GetKey>
+std::vector<SlotPart<T>> SplitBySlot(std::vector<T>&& args,
+                                     const GetKey& get_key) {
+  std::unordered_map<size_t, size_t> part_by_slot;
+  std::vector<SlotPart<T>> parts;
+  for (size_t i = 0; i < args.size(); ++i) {
+    const auto slot = USERVER_NAMESPACE::redis::HashSlot(get_key(args[i]));
+    const auto [it, inserted] = part_by_slot.emplace(slot, parts.size());
+    if (inserted) parts.emplace_back();
+    auto& part = parts[it->second];
+    part.args.push_back(std::move(args[i]));
+    part.positions.push_back(i);
+  }
+  return parts;
+}
+
 }  // namespace
 
 ClientImpl::ClientImpl(
     std::shared_ptr<USERVER_NAMESPACE::redis::Sentinel> sentinel,
     std::optional<size_t> force_shard_idx)
-    : redis_client_(std::move(sentinel)), force_shard_idx_(force_shard_idx) {}
+    : redis_client_(std::move(sentinel)),
+      near_cache_(redis_client_->GetNearCache()),
+      force_shard_idx_(force_shard_idx) {}
 
 void ClientImpl::WaitConnectedOnce(
     USERVER_NAMESPACE::redis::RedisWaitConnected wait_connected) {
@@ -186,6 +232,33 @@ RequestScriptLoad ClientImpl::ScriptLoad(
                   GetCommandControl(command_control)));
 }
 
+Script ClientImpl::RegisterScript(std::string script) {
+  Script result{std::move(script)};
+  redis_client_->GetScriptRegistry().Add(result.GetSha1(), result.GetBody());
+  return result;
+}
+
+RequestEvalCommon ClientImpl::EvalScriptCommon(
+    const Script& script, std::vector<std::string> keys,
+    std::vector<std::string> args, const CommandControl& command_control) {
+  UASSERT(!keys.empty());
+  auto shard = ShardByKey(keys.at(0), command_control);
+  auto cc = GetCommandControl(command_control);
+  size_t keys_size = keys.size();
+  // The keys and the args are kept for the rare NOSCRIPT fallback
+  auto request = MakeRequest(
+      CmdArgs{"evalsha", script.GetSha1(), keys_size, keys, args}, shard, true,
+      cc);
+  return CreateScriptRequest<RequestEvalCommon>(
+      std::move(request),
+      [self = shared_from_this(), script, keys = std::move(keys),
+       args = std::move(args), keys_size, shard, cc]() mutable {
+        return self->MakeRequest(CmdArgs{"eval", script.GetBody(), keys_size,
+                                         std::move(keys), std::move(args)},
+                                 shard, true, cc);
+      });
+}
+
 RequestExists ClientImpl::Exists(std::string key,
                                  const CommandControl& command_control) {
   auto shard = ShardByKey(key, command_control);
@@ -290,6 +363,21 @@ RequestGeosearch ClientImpl::Geosearch(
 RequestGet ClientImpl::Get(std::string key,
                            const CommandControl& command_control) {
   auto shard = ShardByKey(key, command_control);
+  if (near_cache_ && near_cache_->IsCached(key)) {
+    if (auto value = near_cache_->Get(key)) {
+      return CreateDummyRequest<RequestGet>(
+          MakeNearCachedReply("get", std::move(*value)));
+    }
+    return CreateNearCachedRequest<RequestGet>(
+        MakeRequest(CmdArgs{"get", key}, shard, false,
+                    GetCommandControl(command_control)),
+        [near_cache = near_cache_, key,
+         generation = near_cache_->GetGeneration()](const ReplyData& data) {
+          if (auto value = ToNearCachedValue(data)) {
+            near_cache->Put(key, std::move(*value), generation);
+          }
+        });
+  }
   return CreateRequest<RequestGet>(
       MakeRequest(CmdArgs{"get", std::move(key)}, shard, false,
                   GetCommandControl(command_control)));
@@ -332,6 +420,21 @@ RequestHexists ClientImpl::Hexists(std::string key, std::string field,
 RequestHget ClientImpl::Hget(std::string key, std::string field,
                              const CommandControl& command_control) {
   auto shard = ShardByKey(key, command_control);
+  if (near_cache_ && near_cache_->IsCached(key)) {
+    if (auto value = near_cache_->Hget(key, field)) {
+      return CreateDummyRequest<RequestHget>(
+          MakeNearCachedReply("hget", std::move(*value)));
+    }
+    return CreateNearCachedRequest<RequestHget>(
+        MakeRequest(CmdArgs{"hget", key, field}, shard, false,
+                    GetCommandControl(command_control)),
+        [near_cache = near_cache_, key, field,
+         generation = near_cache_->GetGeneration()](const ReplyData& data) {
+          if (auto value = ToNearCachedValue(data)) {
+            near_cache->Hput(key, field, std::move(*value), generation);
+          }
+        });
+  }
   return CreateRequest<RequestHget>(
       MakeRequest(CmdArgs{"hget", std::move(key), std::move(field)}, shard,
                   false, GetCommandControl(command_control)));
@@ -531,16 +634,49 @@ RequestMget ClientImpl::Mget(std::vector<std::string> keys,
   if (keys.empty())
     return CreateDummyRequest<RequestMget>(
         std::make_shared<Reply>("mget", ReplyData::Array{}));
-  const auto shard = ShardByKey(keys.at(0), command_control);
   auto max_chunk_size = CommandControlImpl{command_control}.chunk_size;
   if (max_chunk_size == 0) {
     max_chunk_size = keys.size();
   }
+
+  if (IsInClusterMode()) {
+    const auto size = keys.size();
+    auto parts = SplitBySlot(std::move(keys),
+                             [](const std::string& key) -> const std::string& {
+                               return key;
+                             });
+    if (parts.size() > 1) {
+      // The parts are sent at once and run in parallel on their shards
+      std::vector<USERVER_NAMESPACE::redis::Request> requests;
+      std::vector<std::vector<size_t>> positions;
+      const auto cc = GetCommandControl(command_control);
+      for (auto& part : parts) {
+        const auto shard = ShardByKey(part.args.front(), command_control);
+        for (size_t begin = 0; begin < part.args.size();
+             begin += max_chunk_size) {
+          const auto end = std::min(part.args.size(), begin + max_chunk_size);
+          std::vector<std::string> chunk(
+              std::make_move_iterator(part.args.begin() + begin),
+              std::make_move_iterator(part.args.begin() + end));
+          requests.push_back(
+              MakeRequest(CmdArgs{"mget", std::move(chunk)}, shard, false, cc));
+          positions.emplace_back(part.positions.begin() + begin,
+                                 part.positions.begin() + end);
+        }
+      }
+      return CreateSlotSplitRequest<RequestMget>(
+          std::move(requests), std::move(positions), size);
+    }
+    keys = std::move(parts.front().args);
+  }
+
+  const auto shard = ShardByKey(keys.at(0), command_control);
   auto make_request = [this, shard,
                        cc = GetCommandControl(command_control)](auto keys) {
     return MakeRequest(CmdArgs{"mget", std::move(keys)}, shard, false, cc);
   };
   if (max_chunk_size >= keys.size()) {
+    if (IsNearCached(keys)) return NearCachedMget(std::move(keys), make_request);
     return CreateRequest<RequestMget>(make_request(std::move(keys)));
   }
   return CreateAggregateRequest<RequestMget>(MakeRequestChunks(
@@ -548,6 +684,43 @@ RequestMget ClientImpl::Mget(std::vector<std::string> keys,
       [&make_request](auto keys) { return make_request(std::move(keys)); }));
 }
 
+bool ClientImpl::IsNearCached(const std::vector<std::string>& keys) const {
+  return near_cache_ &&
+         std::all_of(keys.begin(), keys.end(), [this](const std::string& key) {
+           return near_cache_->IsCached(key);
+         });
+}
+
+template <typename MakeRequestFunc>
+RequestMget ClientImpl::NearCachedMget(std::vector<std::string>&& keys,
+                                       const MakeRequestFunc& make_request) {
+  ReplyData::Array values;
+  values.reserve(keys.size());
+  for (const auto& key : keys) {
+    auto value = near_cache_->Get(key);
+    if (!value) break;
+    values.push_back(*value ? ReplyData{std::move(**value)}
+                            : ReplyData::CreateNil());
+  }
+  if (values.size() == keys.size()) {
+    return CreateDummyRequest<RequestMget>(
+        std::make_shared<Reply>("mget", std::move(values)));
+  }
+
+  const auto generation = near_cache_->GetGeneration();
+  auto request = make_request(keys);
+  return CreateNearCachedRequest<RequestMget>(
+      std::move(request), [near_cache = near_cache_, keys = std::move(keys),
+                           generation](const ReplyData& data) {
+        if (!data.IsArray() || data.GetArray().size() != keys.size()) return;
+        for (std::size_t i = 0; i < keys.size(); ++i) {
+          if (auto value = ToNearCachedValue(data.GetArray()[i])) {
+            near_cache->Put(keys[i], std::move(*value), generation);
+          }
+        }
+      });
+}
+
 RequestMset ClientImpl::Mset(
     std::vector<std::pair<std::string, std::string>> key_values,
     const CommandControl& command_control) {
@@ -555,6 +728,26 @@ RequestMset ClientImpl::Mset(
     return CreateDummyRequest<RequestMset>(
         std::make_shared<USERVER_NAMESPACE::redis::Reply>(
             "mset", USERVER_NAMESPACE::redis::ReplyData::CreateStatus("OK")));
+
+  if (IsInClusterMode()) {
+    auto parts = SplitBySlot(
+        std::move(key_values),
+        [](const std::pair<std::string, std::string>& key_value)
+            -> const std::string& { return key_value.first; });
+    if (parts.size() > 1) {
+      std::vector<USERVER_NAMESPACE::redis::Request> requests;
+      const auto cc = GetCommandControl(command_control);
+      for (auto& part : parts) {
+        const auto shard =
+            ShardByKey(part.args.front().first, command_control);
+        requests.push_back(MakeRequest(CmdArgs{"mset", std::move(part.args)},
+                                       shard, true, cc));
+      }
+      return CreateSlotSplitRequest<RequestMset>(std::move(requests), {}, 0);
+    }
+    key_values = std::move(parts.front().args);
+  }
+
   auto shard = ShardByKey(key_values.at(0).first, command_control);
   return CreateRequest<RequestMset>(
       MakeRequest(CmdArgs{"mset", std::move(key_values)}, shard, true,
@@ -862,6 +1055,60 @@ RequestType ClientImpl::Type(std::string key,
                   GetCommandControl(command_control)));
 }
 
+RequestXack ClientImpl::Xack(std::string key, std::string group,
+                             std::vector<std::string> ids,
+                             const CommandControl& command_control) {
+  if (ids.empty())
+    return CreateDummyRequest<RequestXack>(std::make_shared<Reply>("xack", 0));
+  auto shard = ShardByKey(key, command_control);
+  return CreateRequest<RequestXack>(
+      MakeRequest(CmdArgs{"xack", std::move(key), std::move(group),
+                          std::move(ids)},
+                  shard, true, GetCommandControl(command_control)));
+}
+
+RequestXadd ClientImpl::Xadd(
+    std::string key,
+    std::vector<std::pair<std::string, std::string>> field_values,
+    const CommandControl& command_control) {
+  auto shard = ShardByKey(key, command_control);
+  return CreateRequest<RequestXadd>(
+      MakeRequest(CmdArgs{"xadd", std::move(key), "*", std::move(field_values)},
+                  shard, true, GetCommandControl(command_control)));
+}
+
+RequestXautoclaim ClientImpl::Xautoclaim(
+    std::string key, std::string group, std::string consumer,
+    std::chrono::milliseconds min_idle_time, std::string start, size_t count,
+    const CommandControl& command_control) {
+  auto shard = ShardByKey(key, command_control);
+  return CreateRequest<RequestXautoclaim>(MakeRequest(
+      CmdArgs{"xautoclaim", std::move(key), std::move(group),
+              std::move(consumer), min_idle_time.count(), std::move(start),
+              "COUNT", count},
+      shard, true, GetCommandControl(command_control)));
+}
+
+RequestXgroupCreate ClientImpl::XgroupCreate(
+    std::string key, std::string group, std::string id,
+    const CommandControl& command_control) {
+  auto shard = ShardByKey(key, command_control);
+  return CreateRequest<RequestXgroupCreate>(
+      MakeRequest(CmdArgs{"xgroup", "CREATE", std::move(key), std::move(group),
+                          std::move(id), "MKSTREAM"},
+                  shard, true, GetCommandControl(command_control)));
+}
+
+RequestXreadgroup ClientImpl::Xreadgroup(
+    std::string key, std::string group, std::string consumer, std::string id,
+    const XreadgroupOptions& options, const CommandControl& command_control) {
+  auto shard = ShardByKey(key, command_control);
+  return CreateRequest<RequestXreadgroup>(MakeRequest(
+      CmdArgs{"xreadgroup", "GROUP", std::move(group), std::move(consumer),
+              options, "STREAMS", std::move(key), std::move(id)},
+      shard, true, GetCommandControl(command_control)));
+}
+
 RequestZadd ClientImpl::Zadd(std::string key, double score, std::string member,
                              const CommandControl& command_control) {
   auto shard = ShardByKey(key, command_control);
@@ -19,6 +19,7 @@ USERVER_NAMESPACE_BEGIN
 
 namespace redis {
 class Sentinel;
+class NearCache;
 }  // namespace redis
 
 namespace storages::redis {
@@ -91,6 +92,11 @@ class ClientImpl final : public Client,
       const CommandControl& command_control) override;
   RequestScriptLoad ScriptLoad(std::string script, size_t shard,
                                const CommandControl& command_control) override;
+  Script RegisterScript(std::string script) override;
+  RequestEvalCommon EvalScriptCommon(
+      const Script& script, std::vector<std::string> keys,
+      std::vector<std::string> args,
+      const CommandControl& command_control) override;
 
   RequestExists Exists(std::string key,
                        const CommandControl& command_control) override;
@@ -341,6 +347,30 @@ class ClientImpl final : public Client,
   RequestType Type(std::string key,
                    const CommandControl& command_control) override;
 
+  RequestXack Xack(std::string key, std::string group,
+                   std::vector<std::string> ids,
+                   const CommandControl& command_control) override;
+
+  RequestXadd Xadd(
+      std::string key,
+      std::vector<std::pair<std::string, std::string>> field_values,
+      const CommandControl& command_control) override;
+
+  RequestXautoclaim Xautoclaim(std::string key, std::string group,
+                               std::string consumer,
+                               std::chrono::milliseconds min_idle_time,
+                               std::string start, size_t count,
+                               const CommandControl& command_control) override;
+
+  RequestXgroupCreate XgroupCreate(
+      std::string key, std::string group, std::string id,
+      const CommandControl& command_control) override;
+
+  RequestXreadgroup Xreadgroup(std::string key, std::string group,
+                               std::string consumer, std::string id,
+                               const XreadgroupOptions& options,
+                               const CommandControl& command_control) override;
+
   RequestZadd Zadd(std::string key, double score, std::string member,
                    const CommandControl& command_control) override;
 
@@ -467,6 +497,12 @@ class ClientImpl final : public Client,
     return requests;
   }
 
+  bool IsNearCached(const std::vector<std::string>& keys) const;
+
+  template <typename MakeRequestFunc>
+  RequestMget NearCachedMget(std::vector<std::string>&& keys,
+                             const MakeRequestFunc& make_request);
+
   CommandControl GetCommandControl(const CommandControl& cc) const;
 
   size_t GetPublishShard(
@@ -478,6 +514,8 @@ class ClientImpl final : public Client,
   void CheckShard(size_t shard, const CommandControl& cc) const;
 
   std::shared_ptr<USERVER_NAMESPACE::redis::Sentinel> redis_client_;
+  // Caches GET, HGET and MGET results if enabled
+  const std::shared_ptr<USERVER_NAMESPACE::redis::NearCache> near_cache_;
   std::atomic<int> publish_shard_{0};
   const std::optional<size_t> force_shard_idx_;
 };
@@ -6,8 +6,11 @@
 #include <tuple>
 #include <vector>
 
+#include <userver/engine/single_consumer_event.hpp>
+#include <userver/engine/sleep.hpp>
 #include <userver/engine/task/task.hpp>
 #include <userver/engine/wait_any.hpp>
+#include <userver/storages/redis/stream_consumer.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
@@ -259,6 +262,34 @@ UTEST_F(RedisClientTest, EvalSha) {
   EXPECT_EQ(result_array[0], "key1");
 }
 
+UTEST_F(RedisClientTest, EvalScript) {
+  auto client = GetClient();
+
+  // The connections are already established, so the first call falls back to
+  // EVAL that loads the script
+  const auto script = client->RegisterScript(
+      "return { KEYS[1], ARGV[1], 'registered' }");
+  for (int i = 0; i < 2; ++i) {
+    auto result = client
+                      ->EvalScript<std::vector<std::string>>(
+                          script, {"key1"}, {"arg1"}, {})
+                      .Get();
+    ASSERT_EQ(result.size(), 3);
+    EXPECT_EQ(result[0], "key1");
+    EXPECT_EQ(result[1], "arg1");
+  }
+
+  auto loaded = client->EvalSha<std::vector<std::string>>(
+                          script.GetSha1(), {"key1"}, {"arg1"}, {})
+                    .Get();
+  EXPECT_TRUE(loaded.HasValue());
+}
+
+UTEST(RedisScript, Sha1) {
+  const storages::redis::Script script{"return 1"};
+  EXPECT_EQ(script.GetSha1(), "e0e1f9fabfc9d4800c877a703b823ac0578ff8db");
+}
+
 UTEST_F(RedisClientTest, Exists) {
   auto client = GetClient();
   client->Set("key1", "Hello", {}).Get();
@@ -896,6 +927,84 @@ UTEST_F(RedisClientTest, Zscore) {
   EXPECT_EQ(client->Zscore("zset", "two", {}).Get(), 2.);
 }
 
+UTEST_F(RedisClientTest, StreamReadAndAck) {
+  auto client = GetClient();
+
+  EXPECT_EQ(client->XgroupCreate("stream", "group", "0", {}).Get(),
+            storages::redis::XgroupCreateReply::kCreated);
+  EXPECT_EQ(client->XgroupCreate("stream", "group", "0", {}).Get(),
+            storages::redis::XgroupCreateReply::kAlreadyExists);
+
+  const auto first_id = client->Xadd("stream", {{"a", "1"}}, {}).Get();
+  const auto second_id =
+      client->Xadd("stream", {{"b", "2"}, {"c", "3"}}, {}).Get();
+
+  const auto entries =
+      client->Xreadgroup("stream", "group", "consumer", ">", {}, {}).Get();
+  ASSERT_EQ(entries.size(), 2);
+  EXPECT_EQ(entries[0], (storages::redis::StreamEntry{first_id, {{"a", "1"}}}));
+  EXPECT_EQ(entries[1], (storages::redis::StreamEntry{
+                            second_id, {{"b", "2"}, {"c", "3"}}}));
+
+  storages::redis::XreadgroupOptions options;
+  options.block = std::chrono::milliseconds{1};
+  EXPECT_TRUE(
+      client->Xreadgroup("stream", "group", "consumer", ">", options, {})
+          .Get()
+          .empty());
+
+  EXPECT_EQ(client->Xack("stream", "group", {first_id}, {}).Get(), 1);
+  const auto pending =
+      client->Xreadgroup("stream", "group", "consumer", "0", {}, {}).Get();
+  ASSERT_EQ(pending.size(), 1);
+  EXPECT_EQ(pending[0].id, second_id);
+
+  const auto claimed =
+      client
+          ->Xautoclaim("stream", "group", "other_consumer",
+                       std::chrono::milliseconds{0}, "0-0", 10, {})
+          .Get();
+  EXPECT_EQ(claimed.next_start_id, "0-0");
+  ASSERT_EQ(claimed.entries.size(), 1);
+  EXPECT_EQ(claimed.entries[0].id, second_id);
+}
+
+UTEST_F(RedisClientTest, StreamConsumer) {
+  auto client = GetClient();
+
+  storages::redis::StreamConsumerSettings settings;
+  settings.stream = "consumed_stream";
+  settings.group = "group";
+  settings.consumer = "consumer";
+  settings.block_timeout = std::chrono::milliseconds{100};
+
+  engine::SingleConsumerEvent processed;
+  std::vector<std::string> values;
+  storages::redis::StreamConsumer consumer{
+      client, settings, engine::current_task::GetTaskProcessor()};
+  consumer.Start([&](utils::span<const storages::redis::StreamEntry> batch) {
+    for (const auto& entry : batch) {
+      values.push_back(entry.field_values.at(0).second);
+    }
+    processed.Send();
+  });
+
+  // The group is created by the consumer with "$" start id
+  while (client->Exists("consumed_stream", {}).Get() == 0) {
+    engine::SleepFor(std::chrono::milliseconds{10});
+  }
+  client->Xadd("consumed_stream", {{"value", "first"}}, {}).Get();
+  ASSERT_TRUE(processed.WaitForEventFor(utest::kMaxTestWaitTime));
+  consumer.Stop();
+
+  EXPECT_EQ(values, std::vector<std::string>{"first"});
+  EXPECT_TRUE(client
+                  ->Xreadgroup("consumed_stream", "group", "consumer", "0", {},
+                               {})
+                  .Get()
+                  .empty());
+}
+
 UTEST_F(RedisClientTest, TransactionType) {
   auto client = GetClient();
   auto transaction = client->Multi();
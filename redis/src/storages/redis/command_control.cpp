@@ -67,7 +67,8 @@ constexpr utils::TrivialBiMap kToStrategy = [](auto selector) {
       .Case("default", CommandControl::Strategy::kDefault)
       .Case("local_dc_conductor", CommandControl::Strategy::kLocalDcConductor)
       .Case("nearest_server_ping",
-            CommandControl::Strategy::kNearestServerPing);
+            CommandControl::Strategy::kNearestServerPing)
+      .Case("least_latency", CommandControl::Strategy::kLeastLatency);
 };
 
 }  // namespace
@@ -1,5 +1,6 @@
 #include <userver/storages/redis/component.hpp>
 
+#include <optional>
 #include <stdexcept>
 #include <vector>
 
@@ -25,6 +26,8 @@
 #include <userver/storages/redis/subscribe_client.hpp>
 
 #include <storages/redis/impl/keyshard_impl.hpp>
+#include <storages/redis/impl/near_cache.hpp>
+#include <storages/redis/impl/redis_creation_settings.hpp>
 #include <storages/redis/impl/sentinel.hpp>
 #include <storages/redis/impl/subscribe_sentinel.hpp>
 
@@ -73,8 +76,32 @@ struct RedisGroup {
   std::string config_name;
   std::string sharding_strategy;
   bool allow_reads_from_master{false};
+  std::optional<redis::NearCacheSettings> near_cache;
+  redis::HeavyCommandsSettings heavy_commands;
 };
 
+redis::NearCacheSettings Parse(const yaml_config::YamlConfig& value,
+                               formats::parse::To<redis::NearCacheSettings>) {
+  redis::NearCacheSettings settings;
+  settings.max_bytes =
+      value["max_bytes"].As<std::size_t>(redis::kDefaultNearCacheMaxBytes);
+  settings.prefixes =
+      value["prefixes"].As<std::vector<std::string>>(settings.prefixes);
+  settings.bcast = value["bcast"].As<bool>(settings.bcast);
+  return settings;
+}
+
+redis::HeavyCommandsSettings Parse(
+    const yaml_config::YamlConfig& value,
+    formats::parse::To<redis::HeavyCommandsSettings>) {
+  redis::HeavyCommandsSettings settings;
+  settings.connections =
+      value["connections"].As<std::size_t>(settings.connections);
+  settings.args_size_threshold = value["args_size_threshold"].As<std::size_t>(
+      settings.args_size_threshold);
+  return settings;
+}
+
 RedisGroup Parse(const yaml_config::YamlConfig& value,
                  formats::parse::To<RedisGroup>) {
   RedisGroup config;
@@ -83,6 +110,11 @@ RedisGroup Parse(const yaml_config::YamlConfig& value,
   config.sharding_strategy = value["sharding_strategy"].As<std::string>("");
   config.allow_reads_from_master =
       value["allow_reads_from_master"].As<bool>(false);
+  config.near_cache =
+      value["near_cache"].As<std::optional<redis::NearCacheSettings>>();
+  config.heavy_commands =
+      value["heavy_commands"].As<redis::HeavyCommandsSettings>(
+          redis::HeavyCommandsSettings{});
   return config;
 }
 
@@ -224,7 +256,8 @@ void Redis::Connect(const ComponentConfig& config,
     auto sentinel = redis::Sentinel::CreateSentinel(
         thread_pools_, settings, redis_group.config_name, config_source,
         redis_group.db, redis::KeyShardFactory{redis_group.sharding_strategy},
-        cc, testsuite_redis_control);
+        cc, testsuite_redis_control, redis_group.near_cache,
+        redis_group.heavy_commands);
     if (sentinel) {
       sentinels_.emplace(redis_group.db, sentinel);
       const auto& client =
@@ -386,6 +419,39 @@ properties:
                     type: boolean
                     description: allows read requests from master instance
                     defaultDescription: false
+                near_cache:
+                    type: object
+                    description: enables the client-side cache of GET, HGET and MGET invalidated with RESP3 client tracking, requires Redis 6+
+                    additionalProperties: false
+                    properties:
+                        max_bytes:
+                            type: integer
+                            description: budget of the cached keys and values, the least recently used keys are evicted
+                            defaultDescription: 16777216
+                        prefixes:
+                            type: array
+                            description: only the keys with these prefixes are cached, all keys if empty
+                            defaultDescription: '[]'
+                            items:
+                                type: string
+                                description: key prefix
+                        bcast:
+                            type: boolean
+                            description: track the prefixes in BCAST mode instead of the keys read by each connection
+                            defaultDescription: false
+                heavy_commands:
+                    type: object
+                    description: extra connections of each instance for the long running commands (KEYS, SCAN, HGETALL, EVAL, XREADGROUP...) and the commands with large arguments, the order of commands of different connections is not preserved
+                    additionalProperties: false
+                    properties:
+                        connections:
+                            type: integer
+                            description: number of the extra connections, 0 to send all commands to one connection
+                            defaultDescription: 0
+                        args_size_threshold:
+                            type: integer
+                            description: commands with more bytes of arguments are sent to the extra connections
+                            defaultDescription: 65536
     metrics_level:
         type: string
         description: set metrics detail level
@@ -25,6 +25,24 @@ bool RequestFailedException::IsTimeout() const {
   return status_ == ReplyStatus::kTimeoutError;
 }
 
+PartialRequestFailedException::PartialRequestFailedException(
+    const std::string& request_description, std::size_t failed_count,
+    std::size_t total_count, const std::string& error)
+    : Exception(fmt::format("{} request failed for {} of {} hash slot "
+                            "groups, first error: {}",
+                            request_description, failed_count, total_count,
+                            error)),
+      failed_count_(failed_count),
+      total_count_(total_count) {}
+
+std::size_t PartialRequestFailedException::GetFailedCount() const {
+  return failed_count_;
+}
+
+std::size_t PartialRequestFailedException::GetTotalCount() const {
+  return total_count_;
+}
+
 }  // namespace redis
 
 USERVER_NAMESPACE_END
@@ -4,12 +4,12 @@
 
 #include <fmt/format.h>
 #include <boost/container_hash/hash.hpp>
-#include <boost/crc.hpp>
 
 #include <userver/concurrent/variable.hpp>
 #include <userver/logging/log.hpp>
 #include <userver/rcu/rcu.hpp>
 #include <userver/storages/redis/exception.hpp>
+#include <userver/storages/redis/impl/keyshard.hpp>
 #include <userver/storages/redis/impl/redis_state.hpp>
 #include <userver/storages/redis/impl/reply.hpp>
 #include <userver/utils/algo.hpp>
@@ -64,15 +64,6 @@ using NodesAddressesSet =
     std::unordered_set<NodeAddresses, NodeAddressesHasher>;
 using HostPort = std::string;
 
-size_t HashSlot(const std::string& key) {
-  size_t start = 0;
-  size_t len = 0;
-  GetRedisKey(key, &start, &len);
-  return std::for_each(key.data() + start, key.data() + start + len,
-                       boost::crc_optimal<16, 0x1021>())() &
-         0x3fff;
-}
-
 std::string ParseMovedShard(const std::string& err_string) {
   static const auto kUnknownShard = std::string("");
   size_t pos = err_string.find(' ');  // skip "MOVED" or "ASK"
@@ -351,6 +342,21 @@ class ClusterTopologyHolder
     }
   }
 
+  void SetNearCache(std::shared_ptr<NearCache> near_cache) {
+    auto near_cache_ptr = near_cache_.Lock();
+    *near_cache_ptr = std::move(near_cache);
+  }
+
+  void SetHeavyCommandsSettings(const HeavyCommandsSettings& settings) {
+    auto settings_ptr = heavy_commands_settings_.Lock();
+    *settings_ptr = settings;
+  }
+
+  void SetScriptRegistry(std::shared_ptr<ScriptRegistry> script_registry) {
+    auto script_registry_ptr = script_registry_.Lock();
+    *script_registry_ptr = std::move(script_registry);
+  }
+
   static size_t GetClusterSlotsCalledCounter() {
     return cluster_slots_call_counter_.load(std::memory_order_relaxed);
   }
@@ -429,6 +435,11 @@ class ClusterTopologyHolder
       monitoring_settings_;
   concurrent::Variable<utils::RetryBudgetSettings, std::mutex>
       retry_budget_settings_;
+  concurrent::Variable<std::shared_ptr<NearCache>, std::mutex> near_cache_;
+  concurrent::Variable<HeavyCommandsSettings, std::mutex>
+      heavy_commands_settings_;
+  concurrent::Variable<std::shared_ptr<ScriptRegistry>, std::mutex>
+      script_registry_;
   concurrent::Variable<std::unordered_set<HostPort>, std::mutex>
       nodes_to_create_;
   concurrent::Variable<std::unordered_set<HostPort>, std::mutex> actual_nodes_;
@@ -674,11 +685,15 @@ ClusterTopologyHolder::CreateRedisInstance(const std::string& host_port) {
   const auto buffering_settings_ptr = commands_buffering_settings_.Lock();
   const auto replication_monitoring_settings_ptr = monitoring_settings_.Lock();
   const auto retry_budget_settings_ptr = retry_budget_settings_.Lock();
+  const auto near_cache_ptr = near_cache_.Lock();
+  const auto heavy_commands_settings_ptr = heavy_commands_settings_.Lock();
+  const auto script_registry_ptr = script_registry_.Lock();
   LOG_DEBUG() << "Create new redis instance " << host_port;
   return std::make_shared<RedisConnectionHolder>(
       ev_thread_, redis_thread_pool_, host, port, password_,
       buffering_settings_ptr->value_or(CommandsBufferingSettings{}),
-      *replication_monitoring_settings_ptr, *retry_budget_settings_ptr);
+      *replication_monitoring_settings_ptr, *retry_budget_settings_ptr,
+      *near_cache_ptr, *heavy_commands_settings_ptr, *script_registry_ptr);
 }
 
 namespace {
@@ -1056,6 +1071,26 @@ void ClusterSentinelImpl::SetRetryBudgetSettings(
   }
 }
 
+void ClusterSentinelImpl::SetNearCache(std::shared_ptr<NearCache> near_cache) {
+  if (topology_holder_) {
+    topology_holder_->SetNearCache(std::move(near_cache));
+  }
+}
+
+void ClusterSentinelImpl::SetHeavyCommandsSettings(
+    const HeavyCommandsSettings& settings) {
+  if (topology_holder_) {
+    topology_holder_->SetHeavyCommandsSettings(settings);
+  }
+}
+
+void ClusterSentinelImpl::SetScriptRegistry(
+    std::shared_ptr<ScriptRegistry> script_registry) {
+  if (topology_holder_) {
+    topology_holder_->SetScriptRegistry(std::move(script_registry));
+  }
+}
+
 SentinelStatistics ClusterSentinelImpl::GetStatistics(
     const MetricsSettings& settings) const {
   if (!topology_holder_) {
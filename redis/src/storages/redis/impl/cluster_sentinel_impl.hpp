@@ -72,6 +72,11 @@ class ClusterSentinelImpl : public SentinelImplBase {
       override;
   void SetRetryBudgetSettings(
       const utils::RetryBudgetSettings& settings) override;
+  void SetNearCache(std::shared_ptr<NearCache> near_cache) override;
+  void SetHeavyCommandsSettings(
+      const HeavyCommandsSettings& settings) override;
+  void SetScriptRegistry(
+      std::shared_ptr<ScriptRegistry> script_registry) override;
   PublishSettings GetPublishSettings() override;
 
   static size_t GetClusterSlotsCalledCounter();
@@ -7,6 +7,8 @@
 #include <userver/logging/log.hpp>
 #include <userver/utils/assert.hpp>
 
+#include <storages/redis/impl/redis_stats.hpp>
+
 #include "command_control_impl.hpp"
 
 USERVER_NAMESPACE_BEGIN
@@ -19,6 +21,7 @@ bool IsNearestServerPing(const CommandControlImpl& control) {
   switch (control.strategy) {
     case CommandControl::Strategy::kEveryDc:
     case CommandControl::Strategy::kDefault:
+    case CommandControl::Strategy::kLeastLatency:
       return false;
     case CommandControl::Strategy::kLocalDcConductor:
     case CommandControl::Strategy::kNearestServerPing:
@@ -86,6 +89,8 @@ bool ClusterShard::AsyncCommand(CommandPtr command) const {
   const auto& available_servers = GetAvailableServers(command->control);
   const auto servers_count = available_servers.size();
   const auto is_nearest_ping_server = IsNearestServerPing(cc);
+  const auto least_latency =
+      cc.strategy == CommandControl::Strategy::kLeastLatency;
   const auto is_retry = command->counter != 0;
 
   const auto masters_count = 1;
@@ -96,14 +101,21 @@ bool ClusterShard::AsyncCommand(CommandPtr command) const {
                       command->instance_idx, current, servers_count);
 
     size_t idx = SentinelImpl::kDefaultPrevInstanceIdx;
-    const auto instance =
-        GetInstance(available_servers, is_retry, start_idx, attempt,
-                    is_nearest_ping_server, cc.best_dc_count, &idx);
+    const auto instance = GetInstance(available_servers, is_retry, start_idx,
+                                      attempt, is_nearest_ping_server,
+                                      cc.best_dc_count, least_latency, &idx);
     if (!instance) {
       continue;
     }
     command->instance_idx = idx;
-    if (instance->AsyncCommand(command)) return true;
+    if (instance->AsyncCommand(command)) {
+      if (least_latency) {
+        instance->AccountSelection(attempt == 0
+                                       ? LeastLatencySelection::kLeastLoaded
+                                       : LeastLatencySelection::kFallback);
+      }
+      return true;
+    }
   }
 
   LOG_LIMITED_WARNING() << "No Redis server is ready for shard=" << shard_
@@ -124,7 +136,7 @@ void ClusterShard::GetStatistics(bool master, const MetricsSettings& settings,
     auto it = stats.instances.emplace(std::move(master_host_port),
                                       redis::InstanceStatistics(settings));
     auto& inst_stats = it.first->second;
-    inst_stats.Fill(instance->GetStatistics());
+    instance->FillStatistics(inst_stats);
     stats.shard_total.Add(inst_stats);
   };
 
@@ -224,7 +236,7 @@ std::vector<ClusterShard::RedisConnectionPtr> ClusterShard::GetAvailableServers(
 ClusterShard::RedisPtr ClusterShard::GetInstance(
     const std::vector<RedisConnectionPtr>& instances, bool retry,
     size_t start_idx, size_t attempt, bool is_nearest_ping_server,
-    size_t best_dc_count, size_t* pinstance_idx) {
+    size_t best_dc_count, bool least_latency, size_t* pinstance_idx) {
   RedisPtr ret;
   const auto end = (is_nearest_ping_server && attempt == 0 && best_dc_count)
                        ? std::min(instances.size(), best_dc_count)
@@ -240,7 +252,7 @@ ClusterShard::RedisPtr ClusterShard::GetInstance(
     if (cur_inst && cur_inst->IsAvailable() &&
         (!retry || cur_inst->CanRetry()) &&
         (!ret || ret->IsDestroying() ||
-         cur_inst->GetRunningCommands() < ret->GetRunningCommands())) {
+         IsLessLoaded(*cur_inst, *ret, least_latency))) {
       if (pinstance_idx) *pinstance_idx = idx;
       ret = cur_inst;
     }
@@ -62,18 +62,20 @@ class SubscriptionTest : public ::testing::Test {
   }
 
   void Subscribe(const std::string& channel_name) {
-    auto message_callback = [](const std::string& /*channel*/,
-                               const std::string& /*message*/) {
-      return redis::Sentinel::Outcome::kOk;
-    };
+    auto message_callback =
+        [](const std::string& /*channel*/,
+           const redis::Sentinel::SharedMessage& /*message*/) {
+          return redis::Sentinel::Outcome::kOk;
+        };
     auto token = storage_->Subscribe(channel_name, message_callback, {});
     tokens_.push_back(std::move(token));
   }
   void Ssubscribe(const std::string& channel_name) {
-    auto message_callback = [](const std::string& /*channel*/,
-                               const std::string& /*message*/) {
-      return redis::Sentinel::Outcome::kOk;
-    };
+    auto message_callback =
+        [](const std::string& /*channel*/,
+           const redis::Sentinel::SharedMessage& /*message*/) {
+          return redis::Sentinel::Outcome::kOk;
+        };
     auto token = storage_->Ssubscribe(channel_name, message_callback, {});
     tokens_.push_back(std::move(token));
   }
@@ -0,0 +1,50 @@
+#include <storages/redis/impl/command_class.hpp>
+
+#include <string_view>
+
+#include <userver/utils/trivial_map.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace redis {
+namespace {
+
+constexpr utils::TrivialSet kHeavyCommands = [](auto selector) {
+  return selector()
+      .Case("eval")
+      .Case("evalsha")
+      .Case("hgetall")
+      .Case("hkeys")
+      .Case("hvals")
+      .Case("hscan")
+      .Case("keys")
+      .Case("lrange")
+      .Case("scan")
+      .Case("smembers")
+      .Case("sscan")
+      .Case("xautoclaim")
+      .Case("xreadgroup")
+      .Case("zrange")
+      .Case("zrangebyscore")
+      .Case("zscan");
+};
+
+}  // namespace
+
+bool IsHeavyCommand(const Command& command, std::size_t args_size_threshold) {
+  if (command.args.args.size() != 1 || command.asking) return false;
+  if (kHeavyCommands.Contains(std::string_view{command.GetName()})) {
+    return true;
+  }
+
+  std::size_t args_size = 0;
+  for (const auto& arg : command.args.args.front()) {
+    args_size += arg.size();
+    if (args_size > args_size_threshold) return true;
+  }
+  return false;
+}
+
+}  // namespace redis
+
+USERVER_NAMESPACE_END
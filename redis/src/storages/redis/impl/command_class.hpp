@@ -0,0 +1,21 @@
+#pragma once
+
+#include <cstddef>
+
+#include <storages/redis/impl/command.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace redis {
+
+/// @brief Whether the command may occupy a connection for long: scripts,
+/// scans, whole collection reads, blocking reads and the commands with large
+/// arguments.
+///
+/// Transactions and the redirected commands are never heavy, they are sent
+/// to the main connection of an instance.
+bool IsHeavyCommand(const Command& command, std::size_t args_size_threshold);
+
+}  // namespace redis
+
+USERVER_NAMESPACE_END
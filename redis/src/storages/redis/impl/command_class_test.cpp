@@ -0,0 +1,40 @@
+#include <storages/redis/impl/command_class.hpp>
+
+#include <string>
+
+#include <gtest/gtest.h>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+constexpr std::size_t kThreshold = 16;
+
+bool IsHeavy(redis::CmdArgs&& args) {
+  const auto command = redis::PrepareCommand(std::move(args), {});
+  return redis::IsHeavyCommand(*command, kThreshold);
+}
+
+}  // namespace
+
+TEST(CommandClass, ByName) {
+  EXPECT_TRUE(IsHeavy({"hgetall", "key"}));
+  EXPECT_TRUE(IsHeavy({"scan", "0"}));
+  EXPECT_TRUE(IsHeavy({"evalsha", "sha", 1, "key"}));
+  EXPECT_FALSE(IsHeavy({"get", "key"}));
+  EXPECT_FALSE(IsHeavy({"hget", "key", "field"}));
+}
+
+TEST(CommandClass, ByArgsSize) {
+  EXPECT_FALSE(IsHeavy({"set", "key", std::string(kThreshold - 6, 'v')}));
+  EXPECT_TRUE(IsHeavy({"set", "key", std::string(kThreshold, 'v')}));
+}
+
+TEST(CommandClass, Transaction) {
+  redis::CmdArgs args{"multi"};
+  args.Then("hgetall", "key");
+  args.Then("exec");
+  EXPECT_FALSE(IsHeavy(std::move(args)));
+}
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,135 @@
+#include <storages/redis/impl/command_merging.hpp>
+
+#include <algorithm>
+#include <map>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <userver/logging/log.hpp>
+#include <userver/storages/redis/impl/keyshard.hpp>
+#include <userver/storages/redis/impl/reply.hpp>
+
+#include "command_control_impl.hpp"
+
+USERVER_NAMESPACE_BEGIN
+
+namespace redis {
+namespace {
+
+bool IsMergeableGet(const Command& command) {
+  // ASKING applies to the single command that follows it
+  return command.args.args.size() == 1 && command.args.args[0].size() == 2 &&
+         command.GetName() == "get" && !command.asking;
+}
+
+const std::string& GetKey(const CommandPtr& command) {
+  return command->args.args[0][1];
+}
+
+ReplyPtr MakeGetReply(const Reply& mget_reply, ReplyData&& data) {
+  auto reply = std::make_shared<Reply>("get", std::move(data));
+  reply->server = mget_reply.server;
+  reply->server_id = mget_reply.server_id;
+  reply->time = mget_reply.time;
+  reply->log_extra = mget_reply.log_extra;
+  return reply;
+}
+
+void InvokeGets(const std::vector<CommandPtr>& gets, const ReplyPtr& reply) {
+  const bool split = reply->IsOk() && reply->data.IsArray() &&
+                     reply->data.GetArray().size() == gets.size();
+  for (size_t i = 0; i < gets.size(); ++i) {
+    const auto& get = gets[i];
+    // Errors and timeouts are passed to every GET to be retried on its own
+    auto get_reply = split ? MakeGetReply(*reply,
+                                          std::move(reply->data.GetArray()[i]))
+                           : std::make_shared<Reply>(*reply);
+    try {
+      get->callback(get, std::move(get_reply));
+    } catch (const std::exception& ex) {
+      LOG_WARNING() << "exception in callback handler (" << get->args << ") "
+                    << ex;
+    }
+  }
+}
+
+CommandPtr MakeMget(std::vector<CommandPtr>&& gets) {
+  UASSERT(gets.size() > 1);
+  CmdArgs mget;
+  auto& args = mget.args.emplace_back();
+  args.reserve(gets.size() + 1);
+  args.emplace_back("MGET");
+
+  auto control = gets.front()->control;
+  auto timeout_single = CommandControlImpl{control}.timeout_single;
+  for (const auto& get : gets) {
+    args.push_back(GetKey(get));
+    timeout_single = std::min(timeout_single,
+                              CommandControlImpl{get->control}.timeout_single);
+  }
+  control.timeout_single = timeout_single;
+
+  const auto& front = *gets.front();
+  return PrepareCommand(
+      std::move(mget),
+      [gets = std::move(gets)](const CommandPtr&, ReplyPtr reply) {
+        InvokeGets(gets, reply);
+      },
+      control, front.counter, false, front.instance_idx, front.redirected,
+      front.read_only);
+}
+
+void AppendMerged(std::vector<CommandPtr>&& gets,
+                  std::deque<CommandPtr>& result) {
+  if (gets.size() == 1) {
+    result.push_back(std::move(gets.front()));
+  } else {
+    result.push_back(MakeMget(std::move(gets)));
+  }
+}
+
+void AppendRun(std::vector<CommandPtr>&& run, bool cluster_mode,
+               std::deque<CommandPtr>& result) {
+  if (!cluster_mode) {
+    AppendMerged(std::move(run), result);
+    return;
+  }
+
+  // GETs commute, so the slots of a run may go in any order
+  std::map<size_t, std::vector<CommandPtr>> by_slot;
+  for (auto& get : run) {
+    by_slot[HashSlot(GetKey(get))].push_back(std::move(get));
+  }
+  for (auto& slot_gets : by_slot) {
+    AppendMerged(std::move(slot_gets.second), result);
+  }
+}
+
+}  // namespace
+
+void MergeGetCommands(std::deque<CommandPtr>& commands, bool cluster_mode) {
+  const auto gets_count = std::count_if(
+      commands.begin(), commands.end(),
+      [](const auto& command) { return IsMergeableGet(*command); });
+  if (gets_count < 2) return;
+
+  std::deque<CommandPtr> result;
+  std::vector<CommandPtr> run;
+  for (auto& command : commands) {
+    if (IsMergeableGet(*command)) {
+      run.push_back(std::move(command));
+      continue;
+    }
+    if (!run.empty()) AppendRun(std::exchange(run, {}), cluster_mode, result);
+    result.push_back(std::move(command));
+  }
+  if (!run.empty()) AppendRun(std::move(run), cluster_mode, result);
+
+  commands = std::move(result);
+}
+
+}  // namespace redis
+
+USERVER_NAMESPACE_END
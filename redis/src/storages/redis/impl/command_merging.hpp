@@ -0,0 +1,22 @@
+#pragma once
+
+#include <deque>
+
+#include <storages/redis/impl/command.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace redis {
+
+/// @brief Replaces the runs of consecutive single key GET commands with MGET
+/// commands that pass the values back to the callbacks of the GETs.
+///
+/// Only the adjacent GETs are merged, so the order of the GETs relative to
+/// the other commands of the connection is kept. In cluster mode only the
+/// keys of the same hash slot are merged, as MGET fails for the keys of
+/// different slots.
+void MergeGetCommands(std::deque<CommandPtr>& commands, bool cluster_mode);
+
+}  // namespace redis
+
+USERVER_NAMESPACE_END
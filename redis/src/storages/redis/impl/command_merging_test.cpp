@@ -0,0 +1,116 @@
+#include <storages/redis/impl/command_merging.hpp>
+
+#include <deque>
+#include <memory>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <userver/storages/redis/impl/reply.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+using Replies = std::vector<redis::ReplyPtr>;
+
+redis::CommandPtr MakeCommand(redis::CmdArgs&& args, Replies& replies) {
+  return redis::PrepareCommand(
+      std::move(args),
+      [&replies](const redis::CommandPtr&, redis::ReplyPtr reply) {
+        replies.push_back(std::move(reply));
+      });
+}
+
+redis::CmdArgs::CmdArgsArray ArgsOf(const redis::CommandPtr& command) {
+  EXPECT_EQ(command->args.args.size(), 1);
+  return command->args.args.front();
+}
+
+}  // namespace
+
+TEST(CommandMerging, AdjacentGets) {
+  Replies replies;
+  std::deque<redis::CommandPtr> commands{
+      MakeCommand({"get", "a"}, replies),
+      MakeCommand({"get", "b"}, replies),
+      MakeCommand({"set", "b", "value"}, replies),
+      MakeCommand({"get", "b"}, replies),
+  };
+  const auto set = commands[2];
+  const auto last_get = commands[3];
+
+  redis::MergeGetCommands(commands, false);
+
+  ASSERT_EQ(commands.size(), 3);
+  EXPECT_EQ(ArgsOf(commands[0]),
+            (redis::CmdArgs::CmdArgsArray{"MGET", "a", "b"}));
+  // The order relative to the other commands is kept
+  EXPECT_EQ(commands[1], set);
+  EXPECT_EQ(commands[2], last_get);
+
+  commands[0]->callback(
+      commands[0], std::make_shared<redis::Reply>(
+                       "mget", redis::ReplyData{redis::ReplyData::Array{
+                                   redis::ReplyData{"value"},
+                                   redis::ReplyData::CreateNil()}}));
+  ASSERT_EQ(replies.size(), 2);
+  ASSERT_TRUE(replies[0]->data.IsString());
+  EXPECT_EQ(replies[0]->data.GetString(), "value");
+  EXPECT_TRUE(replies[1]->data.IsNil());
+}
+
+TEST(CommandMerging, ErrorsPassedToEveryGet) {
+  Replies replies;
+  std::deque<redis::CommandPtr> commands{
+      MakeCommand({"get", "a"}, replies),
+      MakeCommand({"get", "b"}, replies),
+  };
+
+  redis::MergeGetCommands(commands, false);
+  ASSERT_EQ(commands.size(), 1);
+
+  commands[0]->callback(commands[0],
+                        std::make_shared<redis::Reply>(
+                            "mget", nullptr, redis::ReplyStatus::kTimeoutError));
+  ASSERT_EQ(replies.size(), 2);
+  for (const auto& reply : replies) {
+    EXPECT_EQ(reply->status, redis::ReplyStatus::kTimeoutError);
+  }
+}
+
+TEST(CommandMerging, ClusterSlots) {
+  Replies replies;
+  std::deque<redis::CommandPtr> commands{
+      MakeCommand({"get", "{user}:a"}, replies),
+      MakeCommand({"get", "other"}, replies),
+      MakeCommand({"get", "{user}:b"}, replies),
+  };
+  const auto other = commands[1];
+
+  redis::MergeGetCommands(commands, true);
+
+  ASSERT_EQ(commands.size(), 2);
+  const bool mget_first = commands[0] != other;
+  const auto& mget = commands[mget_first ? 0 : 1];
+  EXPECT_EQ(ArgsOf(mget),
+            (redis::CmdArgs::CmdArgsArray{"MGET", "{user}:a", "{user}:b"}));
+  EXPECT_EQ(commands[mget_first ? 1 : 0], other);
+}
+
+TEST(CommandMerging, NotMergeable) {
+  Replies replies;
+  std::deque<redis::CommandPtr> commands{
+      MakeCommand({"get", "a"}, replies),
+      MakeCommand({"hget", "b", "field"}, replies),
+      MakeCommand({"get", "c"}, replies),
+  };
+  commands.push_back(MakeCommand(
+      std::move(redis::CmdArgs{"multi"}.Then("get", "d").Then("exec")),
+      replies));
+
+  redis::MergeGetCommands(commands, false);
+  EXPECT_EQ(commands.size(), 4);
+}
+
+USERVER_NAMESPACE_END
@@ -128,6 +128,18 @@ void PutArg(CmdArgs::CmdArgsArray& args_, const ScanOptions& arg) {
   }
 }
 
+void PutArg(CmdArgs::CmdArgsArray& args_, const XreadgroupOptions& arg) {
+  if (arg.count) {
+    args_.emplace_back("COUNT");
+    args_.emplace_back(std::to_string(*arg.count));
+  }
+  if (arg.block) {
+    args_.emplace_back("BLOCK");
+    args_.emplace_back(std::to_string(arg.block->count()));
+  }
+  if (arg.noack) args_.emplace_back("NOACK");
+}
+
 void PutArg(CmdArgs::CmdArgsArray& args_, const ScoreOptions& arg) {
   if (arg.withscores) args_.emplace_back("WITHSCORES");
 }
@@ -82,4 +82,14 @@ TEST(KeyShardTaximeterCrc32, Multithreads) {
   EXPECT_EQ(kCount, counts[key_shard.ShardByKey(kKey)]);
 }
 
+TEST(HashSlot, Basic) {
+  // Values of CLUSTER KEYSLOT
+  EXPECT_EQ(redis::HashSlot("foo"), 12182);
+  EXPECT_EQ(redis::HashSlot("123456789"), 12739);
+  EXPECT_EQ(redis::HashSlot("{user1000}.following"),
+            redis::HashSlot("{user1000}.followers"));
+  // Empty hash tag is not a tag
+  EXPECT_NE(redis::HashSlot("{}foo"), redis::HashSlot("foo"));
+}
+
 USERVER_NAMESPACE_END
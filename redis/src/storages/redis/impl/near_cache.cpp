@@ -0,0 +1,175 @@
+#include <storages/redis/impl/near_cache.hpp>
+
+#include <algorithm>
+
+#include <userver/utils/assert.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace redis {
+
+namespace {
+
+std::size_t ValueSize(const NearCache::Value& value) {
+  return value ? value->size() : 0;
+}
+
+}  // namespace
+
+NearCache::NearCache(NearCacheSettings settings)
+    : settings_{std::move(settings)} {}
+
+bool NearCache::IsCached(const std::string& key) const {
+  if (settings_.prefixes.empty()) return true;
+  return std::any_of(settings_.prefixes.begin(), settings_.prefixes.end(),
+                     [&key](const std::string& prefix) {
+                       return key.compare(0, prefix.size(), prefix) == 0;
+                     });
+}
+
+CmdArgs NearCache::MakeTrackingCommand() const {
+  if (!settings_.bcast) return CmdArgs{"CLIENT", "TRACKING", "ON"};
+
+  std::vector<std::string> prefix_args;
+  prefix_args.reserve(settings_.prefixes.size() * 2);
+  for (const auto& prefix : settings_.prefixes) {
+    prefix_args.emplace_back("PREFIX");
+    prefix_args.push_back(prefix);
+  }
+  return CmdArgs{"CLIENT", "TRACKING", "ON", "BCAST", std::move(prefix_args)};
+}
+
+NearCache::Generation NearCache::GetGeneration() const {
+  return generation_.load();
+}
+
+std::optional<NearCache::Value> NearCache::Get(const std::string& key) {
+  std::lock_guard lock{mutex_};
+  const auto it = entries_.find(key);
+  if (it == entries_.end() || !it->second.value) {
+    return CountLookup(std::nullopt);
+  }
+  lru_.splice(lru_.begin(), lru_, it->second.lru_it);
+  return CountLookup(it->second.value);
+}
+
+std::optional<NearCache::Value> NearCache::Hget(const std::string& key,
+                                                const std::string& field) {
+  std::lock_guard lock{mutex_};
+  const auto it = entries_.find(key);
+  if (it == entries_.end()) return CountLookup(std::nullopt);
+  const auto field_it = it->second.fields.find(field);
+  if (field_it == it->second.fields.end()) return CountLookup(std::nullopt);
+  lru_.splice(lru_.begin(), lru_, it->second.lru_it);
+  return CountLookup(field_it->second);
+}
+
+void NearCache::Put(const std::string& key, Value value,
+                    Generation generation) {
+  if (key.size() + ValueSize(value) > settings_.max_bytes) return;
+  Update(key, generation, [&value](Entry& entry) {
+    if (entry.value) entry.size -= ValueSize(*entry.value);
+    entry.size += ValueSize(value);
+    entry.value = std::move(value);
+  });
+}
+
+void NearCache::Hput(const std::string& key, const std::string& field,
+                     Value value, Generation generation) {
+  if (key.size() + field.size() + ValueSize(value) > settings_.max_bytes) {
+    return;
+  }
+  Update(key, generation, [&field, &value](Entry& entry) {
+    auto [it, inserted] = entry.fields.try_emplace(field);
+    if (inserted) {
+      entry.size += field.size();
+    } else {
+      entry.size -= ValueSize(it->second);
+    }
+    entry.size += ValueSize(value);
+    it->second = std::move(value);
+  });
+}
+
+void NearCache::Invalidate(const std::string& key) {
+  std::lock_guard lock{mutex_};
+  ++generation_;
+  ++invalidations_;
+  const auto it = entries_.find(key);
+  if (it != entries_.end()) Erase(it);
+}
+
+void NearCache::InvalidateAll() {
+  std::lock_guard lock{mutex_};
+  ++generation_;
+  ++flushes_;
+  entries_.clear();
+  lru_.clear();
+  total_size_ = 0;
+}
+
+NearCacheStatistics NearCache::GetStatistics() const {
+  NearCacheStatistics stats;
+  stats.hits = hits_.Load();
+  stats.misses = misses_.Load();
+  stats.invalidations = invalidations_.Load();
+  stats.flushes = flushes_.Load();
+
+  std::lock_guard lock{mutex_};
+  stats.keys = entries_.size();
+  stats.bytes = total_size_;
+  return stats;
+}
+
+template <typename Func>
+void NearCache::Update(const std::string& key, Generation generation,
+                       Func&& func) {
+  if (!IsCached(key)) return;
+
+  std::lock_guard lock{mutex_};
+  // An invalidation might have happened while the request was in flight
+  if (generation != generation_.load()) return;
+
+  auto it = entries_.find(key);
+  if (it == entries_.end()) {
+    lru_.push_front(key);
+    it = entries_.emplace(key, Entry{}).first;
+    it->second.size = key.size();
+    it->second.lru_it = lru_.begin();
+    total_size_ += key.size();
+  } else {
+    lru_.splice(lru_.begin(), lru_, it->second.lru_it);
+  }
+
+  auto& entry = it->second;
+  total_size_ -= entry.size;
+  func(entry);
+  total_size_ += entry.size;
+
+  while (total_size_ > settings_.max_bytes) {
+    UASSERT(!lru_.empty());
+    Erase(entries_.find(lru_.back()));
+  }
+}
+
+std::optional<NearCache::Value> NearCache::CountLookup(
+    std::optional<Value> value) {
+  if (value) {
+    ++hits_;
+  } else {
+    ++misses_;
+  }
+  return value;
+}
+
+void NearCache::Erase(Entries::iterator it) {
+  UASSERT(it != entries_.end());
+  UASSERT(total_size_ >= it->second.size);
+  total_size_ -= it->second.size;
+  lru_.erase(it->second.lru_it);
+  entries_.erase(it);
+}
+
+}  // namespace redis
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,116 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <list>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include <userver/storages/redis/impl/base.hpp>
+#include <userver/utils/statistics/rate_counter.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace redis {
+
+inline constexpr std::size_t kDefaultNearCacheMaxBytes = 16 * 1024 * 1024;
+
+struct NearCacheSettings {
+  /// Budget of the cached keys, fields and values
+  std::size_t max_bytes{kDefaultNearCacheMaxBytes};
+  /// Only the keys with these prefixes are cached, all keys if empty
+  std::vector<std::string> prefixes;
+  /// Receive the invalidations of all the keys with the prefixes (BCAST mode)
+  /// instead of the keys read by the connection
+  bool bcast{false};
+};
+
+struct NearCacheStatistics {
+  utils::statistics::Rate hits;
+  utils::statistics::Rate misses;
+  utils::statistics::Rate invalidations;
+  utils::statistics::Rate flushes;
+  std::size_t keys{0};
+  std::size_t bytes{0};
+};
+
+/// @brief Client-side cache of GET and HGET results invalidated by the
+/// server through the RESP3 client tracking.
+///
+/// Connections created with the cache enable the tracking and forward the
+/// invalidation push messages here. A connection loss flushes the cache as the
+/// keys tracked by the connection are not tracked anymore.
+///
+/// A value is stored only if no invalidation happened since its request was
+/// sent, see GetGeneration().
+class NearCache final {
+ public:
+  using Generation = std::uint64_t;
+  /// Nil replies are cached too
+  using Value = std::optional<std::string>;
+
+  explicit NearCache(NearCacheSettings settings);
+
+  bool IsCached(const std::string& key) const;
+
+  /// CLIENT TRACKING command to enable the tracking on a connection
+  CmdArgs MakeTrackingCommand() const;
+
+  /// Generation to pass to Put, must be taken before the request is sent
+  Generation GetGeneration() const;
+
+  std::optional<Value> Get(const std::string& key);
+  std::optional<Value> Hget(const std::string& key, const std::string& field);
+
+  void Put(const std::string& key, Value value, Generation generation);
+  void Hput(const std::string& key, const std::string& field, Value value,
+            Generation generation);
+
+  /// Drops the key with all its fields
+  void Invalidate(const std::string& key);
+
+  /// Drops all the keys
+  void InvalidateAll();
+
+  NearCacheStatistics GetStatistics() const;
+
+ private:
+  struct Entry {
+    // GET result
+    std::optional<Value> value;
+    // HGET results
+    std::unordered_map<std::string, Value> fields;
+    std::size_t size{0};
+    std::list<std::string>::iterator lru_it;
+  };
+
+  using Entries = std::unordered_map<std::string, Entry>;
+
+  template <typename Func>
+  void Update(const std::string& key, Generation generation, Func&& func);
+  std::optional<Value> CountLookup(std::optional<Value> value);
+  void Erase(Entries::iterator it);
+
+  const NearCacheSettings settings_;
+  std::atomic<Generation> generation_{0};
+
+  utils::statistics::RateCounter hits_;
+  utils::statistics::RateCounter misses_;
+  utils::statistics::RateCounter invalidations_;
+  utils::statistics::RateCounter flushes_;
+
+  // Invalidations come from the ev threads
+  mutable std::mutex mutex_;
+  Entries entries_;
+  // Most recently used keys go first
+  std::list<std::string> lru_;
+  std::size_t total_size_{0};
+};
+
+}  // namespace redis
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,117 @@
+#include <storages/redis/impl/near_cache.hpp>
+
+#include <gtest/gtest.h>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+redis::NearCacheSettings MakeSettings(std::size_t max_bytes) {
+  redis::NearCacheSettings settings;
+  settings.max_bytes = max_bytes;
+  return settings;
+}
+
+}  // namespace
+
+TEST(NearCache, GetPut) {
+  redis::NearCache cache{MakeSettings(1024)};
+
+  EXPECT_FALSE(cache.Get("key"));
+  cache.Put("key", "value", cache.GetGeneration());
+  cache.Put("nil", std::nullopt, cache.GetGeneration());
+
+  const auto value = cache.Get("key");
+  ASSERT_TRUE(value);
+  EXPECT_EQ(*value, "value");
+  const auto nil = cache.Get("nil");
+  ASSERT_TRUE(nil);
+  EXPECT_FALSE(*nil);
+
+  const auto stats = cache.GetStatistics();
+  EXPECT_EQ(stats.hits.value, 2);
+  EXPECT_EQ(stats.misses.value, 1);
+  EXPECT_EQ(stats.keys, 2);
+  EXPECT_EQ(stats.bytes, 3 + 5 + 3);
+}
+
+TEST(NearCache, HgetHput) {
+  redis::NearCache cache{MakeSettings(1024)};
+
+  cache.Hput("hash", "field", "value", cache.GetGeneration());
+  const auto value = cache.Hget("hash", "field");
+  ASSERT_TRUE(value);
+  EXPECT_EQ(*value, "value");
+  EXPECT_FALSE(cache.Hget("hash", "other"));
+  // Fields do not make the key a GET result
+  EXPECT_FALSE(cache.Get("hash"));
+
+  cache.Invalidate("hash");
+  EXPECT_FALSE(cache.Hget("hash", "field"));
+  EXPECT_EQ(cache.GetStatistics().bytes, 0);
+}
+
+TEST(NearCache, Invalidation) {
+  redis::NearCache cache{MakeSettings(1024)};
+
+  const auto generation = cache.GetGeneration();
+  cache.Put("key", "value", generation);
+  cache.Invalidate("key");
+  EXPECT_FALSE(cache.Get("key"));
+
+  // The value might have been read before the invalidation
+  cache.Put("key", "stale", generation);
+  EXPECT_FALSE(cache.Get("key"));
+
+  cache.Put("key", "value", cache.GetGeneration());
+  cache.InvalidateAll();
+  EXPECT_FALSE(cache.Get("key"));
+
+  const auto stats = cache.GetStatistics();
+  EXPECT_EQ(stats.invalidations.value, 1);
+  EXPECT_EQ(stats.flushes.value, 1);
+  EXPECT_EQ(stats.keys, 0);
+}
+
+TEST(NearCache, Eviction) {
+  redis::NearCache cache{MakeSettings(20)};
+
+  cache.Put("a", "123456789", cache.GetGeneration());
+  cache.Put("b", "123456789", cache.GetGeneration());
+  EXPECT_TRUE(cache.Get("a"));
+
+  // Evicts the least recently used "b"
+  cache.Put("c", "123456789", cache.GetGeneration());
+  EXPECT_TRUE(cache.Get("a"));
+  EXPECT_FALSE(cache.Get("b"));
+  EXPECT_TRUE(cache.Get("c"));
+  EXPECT_LE(cache.GetStatistics().bytes, 20);
+
+  // Does not fit at all and does not evict the others
+  cache.Put("d", std::string(100, 'x'), cache.GetGeneration());
+  EXPECT_FALSE(cache.Get("d"));
+  EXPECT_TRUE(cache.Get("a"));
+}
+
+TEST(NearCache, Prefixes) {
+  auto settings = MakeSettings(1024);
+  settings.prefixes = {"flags:", "tiers:"};
+  settings.bcast = true;
+  redis::NearCache cache{settings};
+
+  EXPECT_TRUE(cache.IsCached("flags:a"));
+  EXPECT_TRUE(cache.IsCached("tiers:"));
+  EXPECT_FALSE(cache.IsCached("flag"));
+  EXPECT_FALSE(cache.IsCached("users:a"));
+
+  cache.Put("users:a", "value", cache.GetGeneration());
+  EXPECT_FALSE(cache.Get("users:a"));
+
+  const auto command = cache.MakeTrackingCommand();
+  ASSERT_EQ(command.args.size(), 1);
+  EXPECT_EQ(command.args[0],
+            (std::vector<std::string>{"CLIENT", "TRACKING", "ON", "BCAST",
+                                      "PREFIX", "flags:", "PREFIX", "tiers:"}));
+}
+
+USERVER_NAMESPACE_END
@@ -24,9 +24,13 @@
 #include <userver/utils/swappingsmart.hpp>
 
 #include <storages/redis/impl/command.hpp>
+#include <storages/redis/impl/command_class.hpp>
+#include <storages/redis/impl/command_merging.hpp>
 #include <storages/redis/impl/ev_wrapper.hpp>
+#include <storages/redis/impl/near_cache.hpp>
 #include <storages/redis/impl/redis_info.hpp>
 #include <storages/redis/impl/redis_stats.hpp>
+#include <storages/redis/impl/script_registry.hpp>
 #include <storages/redis/impl/tcp_socket.hpp>
 #include <userver/storages/redis/impl/reply.hpp>
 
@@ -170,6 +174,14 @@ class Redis::RedisImpl : public std::enable_shared_from_this<Redis::RedisImpl> {
   std::chrono::milliseconds GetPingLatency() const {
     return std::chrono::milliseconds(ping_latency_ms_);
   }
+  std::chrono::microseconds GetLatencyEwma() const {
+    return std::chrono::microseconds{static_cast<std::int64_t>(
+        statistics_.latency_ewma_us.load(std::memory_order_relaxed))};
+  }
+  double GetLeastLatencyScore() const;
+  void AccountSelection(LeastLatencySelection reason) {
+    statistics_.AccountSelection(reason);
+  }
   void SetCommandsBufferingSettings(
       CommandsBufferingSettings commands_buffering_settings);
   void SetReplicationMonitoringSettings(
@@ -199,6 +211,9 @@ class Redis::RedisImpl : public std::enable_shared_from_this<Redis::RedisImpl> {
                            void* privdata) noexcept;
   static void OnConnect(const redisAsyncContext* c, int status) noexcept;
   static void OnDisconnect(const redisAsyncContext* c, int status) noexcept;
+#ifdef REDIS_REPLY_PUSH
+  static void OnPushReply(redisAsyncContext* c, void* r) noexcept;
+#endif
   static void OnTimerPing(struct ev_loop* loop, ev_timer* w,
                           int revents) noexcept;
   static void OnTimerInfo(struct ev_loop* loop, ev_timer* w,
@@ -220,6 +235,7 @@ class Redis::RedisImpl : public std::enable_shared_from_this<Redis::RedisImpl> {
   void CommandLoopImpl();
   void OnRedisReplyImpl(redisReply* redis_reply, void* privdata, int status,
                         const char* errstr);
+  void OnPushReplyImpl(const redisReply* redis_reply);
   void AccountPingLatency(std::chrono::milliseconds latency);
   void AccountRtt();
   void OnTimerPingImpl();
@@ -235,6 +251,9 @@ class Redis::RedisImpl : public std::enable_shared_from_this<Redis::RedisImpl> {
 
   void Authenticate();
   void SendReadOnly();
+  void EnableClientTracking();
+  void SendClientTracking();
+  void LoadScripts();
   void FreeCommands();
 
   static void LogSocketErrorReply(const CommandPtr& command,
@@ -292,7 +311,11 @@ class Redis::RedisImpl : public std::enable_shared_from_this<Redis::RedisImpl> {
   std::atomic_bool enable_replication_monitoring_ = false;
   std::atomic_bool forbid_requests_to_syncing_replicas_ = false;
   const bool send_readonly_;
+  const bool cluster_mode_;
   const ConnectionSecurity connection_security_;
+  const std::shared_ptr<NearCache> near_cache_;
+  const std::shared_ptr<ScriptRegistry> script_registry_;
+  bool is_tracking_ = false;
   std::chrono::milliseconds ping_interval_{2000};
   std::chrono::milliseconds ping_timeout_{4000};
   std::chrono::milliseconds info_replication_interval_{2000};
@@ -323,13 +346,31 @@ std::string_view StateToString(RedisState state) {
 
 Redis::Redis(const std::shared_ptr<engine::ev::ThreadPool>& thread_pool,
              const RedisCreationSettings& redis_settings)
-    : thread_control_(thread_pool->NextThread()) {
+    : thread_control_(thread_pool->NextThread()),
+      heavy_args_size_threshold_(
+          redis_settings.heavy_commands.args_size_threshold) {
   impl_ = std::make_shared<RedisImpl>(thread_pool, thread_control_, *this,
                                       redis_settings);
+  // Same ev thread, so that the connections are destroyed together. The state
+  // of the instance is the state of the main connection, so the heavy ones do
+  // not signal.
+  // The scripts are cached by the server, so they are loaded only by the main
+  // connection.
+  auto heavy_settings = redis_settings;
+  heavy_settings.script_registry = nullptr;
+  heavy_impls_.reserve(redis_settings.heavy_commands.connections);
+  for (size_t i = 0; i < redis_settings.heavy_commands.connections; ++i) {
+    auto heavy_impl = std::make_shared<RedisImpl>(thread_pool, thread_control_,
+                                                  *this, heavy_settings);
+    heavy_impl->ResetRedisObj();
+    heavy_impls_.push_back(std::move(heavy_impl));
+  }
 }
 
 Redis::~Redis() {
   thread_control_.RunInEvLoopBlocking([this]() {
+    for (auto& heavy_impl : heavy_impls_) heavy_impl->Disconnect();
+    heavy_impls_.clear();
     impl_->Disconnect();
     impl_->ResetRedisObj();
     impl_.reset();
@@ -339,26 +380,82 @@ Redis::~Redis() {
 void Redis::Connect(const ConnectionInfo::HostVector& host_addrs, int port,
                     const Password& password) {
   impl_->Connect(host_addrs, port, password);
+  for (auto& heavy_impl : heavy_impls_) {
+    heavy_impl->Connect(host_addrs, port, password);
+  }
 }
 
 bool Redis::AsyncCommand(const CommandPtr& command) {
+  if (!heavy_impls_.empty() &&
+      IsHeavyCommand(*command, heavy_args_size_threshold_)) {
+    // Falls back to the main connection if no heavy one is connected
+    auto* heavy_impl = GetHeavyCommandsImpl();
+    if (heavy_impl && heavy_impl->AsyncCommand(command)) return true;
+  }
   return impl_->AsyncCommand(command);
 }
 
+Redis::RedisImpl* Redis::GetHeavyCommandsImpl() const {
+  RedisImpl* result = nullptr;
+  for (const auto& heavy_impl : heavy_impls_) {
+    if (heavy_impl->IsAvailable() &&
+        (!result ||
+         heavy_impl->GetRunningCommands() < result->GetRunningCommands())) {
+      result = heavy_impl.get();
+    }
+  }
+  return result;
+}
+
 Redis::State Redis::GetState() const { return impl_->GetState(); }
 
 const Statistics& Redis::GetStatistics() const {
   return impl_->GetStatistics();
 }
 
+void Redis::FillStatistics(InstanceStatistics& stats) const {
+  stats.Fill(impl_->GetStatistics());
+  for (const auto& heavy_impl : heavy_impls_) {
+    InstanceStatistics heavy_stats(stats.settings);
+    heavy_stats.Fill(heavy_impl->GetStatistics());
+    stats.Add(heavy_stats);
+  }
+}
+
 ServerId Redis::GetServerId() const { return impl_->GetServerId(); }
 
-size_t Redis::GetRunningCommands() const { return impl_->GetRunningCommands(); }
+size_t Redis::GetRunningCommands() const {
+  size_t running_commands = impl_->GetRunningCommands();
+  for (const auto& heavy_impl : heavy_impls_) {
+    running_commands += heavy_impl->GetRunningCommands();
+  }
+  return running_commands;
+}
 
 std::chrono::milliseconds Redis::GetPingLatency() const {
   return impl_->GetPingLatency();
 }
 
+std::chrono::microseconds Redis::GetLatencyEwma() const {
+  return impl_->GetLatencyEwma();
+}
+
+double Redis::GetLeastLatencyScore() const {
+  return impl_->GetLeastLatencyScore();
+}
+
+void Redis::AccountSelection(LeastLatencySelection reason) {
+  impl_->AccountSelection(reason);
+}
+
+bool IsLessLoaded(const Redis& candidate, const Redis& chosen,
+                  bool least_latency) {
+  if (least_latency) {
+    return candidate.GetLeastLatencyScore() < chosen.GetLeastLatencyScore();
+  }
+  return candidate.GetRunningCommands() < chosen.GetRunningCommands();
+}
+
 bool Redis::IsDestroying() const { return impl_->IsDestroying(); }
 
 bool Redis::IsSyncing() const { return impl_->IsSyncing(); }
@@ -374,15 +471,25 @@ uint16_t Redis::GetServerPort() const { return impl_->GetPort(); }
 void Redis::SetCommandsBufferingSettings(
     CommandsBufferingSettings commands_buffering_settings) {
   impl_->SetCommandsBufferingSettings(commands_buffering_settings);
+  for (auto& heavy_impl : heavy_impls_) {
+    heavy_impl->SetCommandsBufferingSettings(commands_buffering_settings);
+  }
 }
 
 void Redis::SetRetryBudgetSettings(const utils::RetryBudgetSettings& settings) {
   impl_->SetRetryBudgetSettings(settings);
+  for (auto& heavy_impl : heavy_impls_) {
+    heavy_impl->SetRetryBudgetSettings(settings);
+  }
 }
 
 void Redis::SetReplicationMonitoringSettings(
     const ReplicationMonitoringSettings& replication_monitoring_settings) {
   impl_->SetReplicationMonitoringSettings(replication_monitoring_settings);
+  for (auto& heavy_impl : heavy_impls_) {
+    heavy_impl->SetReplicationMonitoringSettings(
+        replication_monitoring_settings);
+  }
 }
 
 Redis::RedisImpl::RedisImpl(
@@ -393,7 +500,10 @@ Redis::RedisImpl::RedisImpl(
       ev_thread_control_(thread_control),
       thread_pool_(thread_pool),
       send_readonly_(redis_settings.send_readonly),
+      cluster_mode_(redis_settings.cluster_mode),
       connection_security_(redis_settings.connection_security),
+      near_cache_(redis_settings.near_cache),
+      script_registry_(redis_settings.script_registry),
       server_id_(ServerId::Generate()),
       retry_budget_(utils::RetryBudgetSettings{100, 0.1, false}) {
   SetCommandsBufferingSettings(CommandsBufferingSettings{});
@@ -500,6 +610,14 @@ bool Redis::RedisImpl::Connect(const std::string& host, int port,
     if (!err)
       CheckError(redisAsyncSetDisconnectCallback(context_, OnDisconnect),
                  "redisAsyncSetDisconnectCallback");
+    if (!err && near_cache_) {
+#ifdef REDIS_REPLY_PUSH
+      redisAsyncSetPushCallback(context_, OnPushReply);
+#else
+      err = true;
+      LOG_ERROR() << "Client tracking requires libhiredis >= 1.0.0";
+#endif
+    }
     SetState(err ? State::kInitError : State::kInit);
   });
   return true;
@@ -547,6 +665,13 @@ void Redis::RedisImpl::InvokeCommand(const CommandPtr& command,
   if (reply->status == ReplyStatus::kOk) {
     retry_budget_.AccountOk();
   }
+  if (reply->status == ReplyStatus::kOk ||
+      reply->status == ReplyStatus::kTimeoutError) {
+    statistics_.AccountLatency(
+        std::chrono::duration_cast<std::chrono::microseconds>(
+            std::chrono::steady_clock::now() -
+            command->GetStartHandlingTime()));
+  }
 
   reply->server_id = server_id_;
   reply->log_extra.Extend("redis_server", server_);
@@ -815,6 +940,14 @@ Redis::State Redis::RedisImpl::GetState() const { return state_; }
 
 size_t Redis::RedisImpl::GetRunningCommands() const { return sent_count_; }
 
+double Redis::RedisImpl::GetLeastLatencyScore() const {
+  // Before the first replies only the pings are known
+  const auto latency_us = std::max<double>(
+      {statistics_.latency_ewma_us.load(std::memory_order_relaxed),
+       ping_latency_ms_.load() * 1000, 1.0});
+  return latency_us * static_cast<double>(GetRunningCommands() + 1);
+}
+
 logging::Level Redis::RedisImpl::StateChangeToLogLevel(State /*old_state*/,
                                                        State new_state) {
   switch (new_state) {
@@ -928,7 +1061,8 @@ void Redis::RedisImpl::CommandLoopOnTimer(struct ev_loop*, ev_timer* w,
 }
 
 void Redis::RedisImpl::CommandLoopImpl() {
-  if (WatchCommandTimerEnabled(*commands_buffering_settings_.Get())) {
+  const auto commands_buffering_settings = commands_buffering_settings_.Get();
+  if (WatchCommandTimerEnabled(*commands_buffering_settings)) {
     if (std::exchange(watch_command_timer_started_, false)) {
       ev_thread_control_.Stop(watch_command_timer_);
     }
@@ -940,6 +1074,9 @@ void Redis::RedisImpl::CommandLoopImpl() {
     std::swap(commands_, commands);
   }
   LOG_TRACE() << "commands size=" << commands.size();
+  if (commands_buffering_settings->merge_gets) {
+    MergeGetCommands(commands, cluster_mode_);
+  }
   for (auto& command : commands) {
     ProcessCommand(command);
   }
@@ -1007,6 +1144,11 @@ void Redis::RedisImpl::OnDisconnectImpl(int status) {
            "https://wiki.yandex-team.ru/taxi/backend/userver/redis/"
            "#logiservera).";
   }
+  // The keys read through the connection are not tracked anymore
+  if (is_tracking_) {
+    is_tracking_ = false;
+    near_cache_->InvalidateAll();
+  }
   SetState(status == REDIS_OK ? State::kDisconnected : State::kDisconnectError);
   context_ = nullptr;
   self_.reset();
@@ -1044,7 +1186,7 @@ void Redis::RedisImpl::Authenticate() {
     if (send_readonly_)
       SendReadOnly();
     else
-      SetState(State::kConnected);
+      EnableClientTracking();
   } else {
     ProcessCommand(PrepareCommand(
         CmdArgs{"AUTH", password_.GetUnderlying()},
@@ -1053,7 +1195,7 @@ void Redis::RedisImpl::Authenticate() {
             if (send_readonly_)
               SendReadOnly();
             else
-              SetState(State::kConnected);
+              EnableClientTracking();
           } else {
             if (*reply) {
               if (reply->IsUnknownCommandError()) {
@@ -1085,7 +1227,7 @@ void Redis::RedisImpl::SendReadOnly() {
   ProcessCommand(PrepareCommand(CmdArgs{"READONLY"}, [this](const CommandPtr&,
                                                             ReplyPtr reply) {
     if (*reply && reply->data.IsStatus()) {
-      SetState(State::kConnected);
+      EnableClientTracking();
     } else {
       if (*reply) {
         LOG_LIMITED_ERROR()
@@ -1102,6 +1244,68 @@ void Redis::RedisImpl::SendReadOnly() {
   }));
 }
 
+void Redis::RedisImpl::EnableClientTracking() {
+  if (!near_cache_) {
+    LoadScripts();
+    return;
+  }
+
+  // Invalidations are delivered as RESP3 push messages
+  ProcessCommand(PrepareCommand(
+      CmdArgs{"HELLO", "3"}, [this](const CommandPtr&, ReplyPtr reply) {
+        if (*reply && reply->data.IsArray()) {
+          SendClientTracking();
+          return;
+        }
+        LOG_LIMITED_ERROR() << log_extra_ << "HELLO 3 failed: "
+                            << (*reply ? reply->data.ToDebugString()
+                                       : reply->status_string);
+        Disconnect();
+      }));
+}
+
+void Redis::RedisImpl::SendClientTracking() {
+  ProcessCommand(PrepareCommand(
+      near_cache_->MakeTrackingCommand(),
+      [this](const CommandPtr&, ReplyPtr reply) {
+        if (*reply && reply->data.IsStatus()) {
+          is_tracking_ = true;
+          LoadScripts();
+          return;
+        }
+        LOG_LIMITED_ERROR() << log_extra_ << "CLIENT TRACKING failed: "
+                            << (*reply ? reply->data.ToDebugString()
+                                       : reply->status_string);
+        Disconnect();
+      }));
+}
+
+void Redis::RedisImpl::LoadScripts() {
+  const auto scripts =
+      script_registry_ ? script_registry_->GetScripts() : nullptr;
+  if (!scripts || scripts->empty()) {
+    SetState(State::kConnected);
+    return;
+  }
+
+  // Pipelined, the replies come in order. A failed load is not fatal: EVALSHA
+  // of the script falls back to EVAL.
+  for (std::size_t i = 0; i < scripts->size(); ++i) {
+    const bool is_last = (i + 1 == scripts->size());
+    ProcessCommand(PrepareCommand(
+        CmdArgs{"SCRIPT", "LOAD", (*scripts)[i]},
+        [this, is_last](const CommandPtr&, ReplyPtr reply) {
+          if (!*reply || !reply->data.IsString()) {
+            LOG_LIMITED_WARNING()
+                << log_extra_ << "SCRIPT LOAD failed: "
+                << (*reply ? reply->data.ToDebugString()
+                           : reply->status_string);
+          }
+          if (is_last) SetState(State::kConnected);
+        }));
+  }
+}
+
 void Redis::RedisImpl::OnRedisReply(redisAsyncContext* c, void* r,
                                     void* privdata) noexcept {
   auto* impl = static_cast<Redis::RedisImpl*>(c->data);
@@ -1120,6 +1324,36 @@ void Redis::RedisImpl::OnRedisReply(redisAsyncContext* c, void* r,
   }
 }
 
+#ifdef REDIS_REPLY_PUSH
+void Redis::RedisImpl::OnPushReply(redisAsyncContext* c, void* r) noexcept {
+  auto* impl = static_cast<Redis::RedisImpl*>(c->data);
+  UASSERT(impl != nullptr);
+  try {
+    impl->OnPushReplyImpl(static_cast<const redisReply*>(r));
+  } catch (const std::exception& ex) {
+    LOG_ERROR() << "OnPushReplyImpl() failed: " << ex;
+  }
+}
+#endif
+
+void Redis::RedisImpl::OnPushReplyImpl(const redisReply* redis_reply) {
+  if (!near_cache_ || !redis_reply) return;
+
+  // >2 "invalidate" [keys...] or nil on FLUSHALL/FLUSHDB
+  const ReplyData data{redis_reply};
+  if (!data.IsArray() || data.GetArray().size() != 2) return;
+  const auto& message = data.GetArray();
+  if (!message[0].IsString() || message[0].GetString() != "invalidate") return;
+
+  if (!message[1].IsArray()) {
+    near_cache_->InvalidateAll();
+    return;
+  }
+  for (const auto& key : message[1].GetArray()) {
+    if (key.IsString()) near_cache_->Invalidate(key.GetString());
+  }
+}
+
 void Redis::RedisImpl::OnRedisReplyImpl(redisReply* redis_reply, void* privdata,
                                         int status, const char* errstr) {
   auto data = reply_privdata_.find(reinterpret_cast<size_t>(privdata));
@@ -2,6 +2,7 @@
 
 #include <cstring>
 #include <memory>
+#include <vector>
 
 #include <boost/signals2/signal.hpp>
 
@@ -21,6 +22,8 @@ USERVER_NAMESPACE_BEGIN
 namespace redis {
 
 class Statistics;
+struct InstanceStatistics;
+enum class LeastLatencySelection;
 
 class Redis {
  public:
@@ -38,6 +41,11 @@ class Redis {
   bool AsyncCommand(const CommandPtr& command);
   size_t GetRunningCommands() const;
   std::chrono::milliseconds GetPingLatency() const;
+  /// Decaying peak of the reply latency
+  std::chrono::microseconds GetLatencyEwma() const;
+  /// Expected wait of a new command for CommandControl::Strategy::kLeastLatency
+  double GetLeastLatencyScore() const;
+  void AccountSelection(LeastLatencySelection reason);
   bool IsDestroying() const;
   std::string GetServerHost() const;
   uint16_t GetServerPort() const;
@@ -47,6 +55,9 @@ class Redis {
 
   State GetState() const;
   const Statistics& GetStatistics() const;
+  /// Fills the statistics of the main connection and adds the ones of the
+  /// heavy commands connections
+  void FillStatistics(InstanceStatistics& stats) const;
   ServerId GetServerId() const;
 
   void SetCommandsBufferingSettings(
@@ -62,10 +73,22 @@ class Redis {
 
  private:
   class RedisImpl;
+
+  RedisImpl* GetHeavyCommandsImpl() const;
+
   engine::ev::ThreadControl thread_control_;
   std::shared_ptr<RedisImpl> impl_;
+  // Connections to the same server for the heavy commands, see
+  // HeavyCommandsSettings
+  std::vector<std::shared_ptr<RedisImpl>> heavy_impls_;
+  const std::size_t heavy_args_size_threshold_;
 };
 
+/// Whether a command should rather go to `candidate` than to `chosen`: by the
+/// running commands count or, with `least_latency`, by the latency score
+bool IsLessLoaded(const Redis& candidate, const Redis& chosen,
+                  bool least_latency);
+
 template <typename Rep, typename Period>
 double ToEvDuration(const std::chrono::duration<Rep, Period>& duration) {
   return std::chrono::duration_cast<std::chrono::duration<double>>(duration)
@@ -10,7 +10,10 @@ RedisConnectionHolder::RedisConnectionHolder(
     const std::string& host, uint16_t port, Password password,
     CommandsBufferingSettings buffering_settings,
     ReplicationMonitoringSettings replication_monitoring_settings,
-    utils::RetryBudgetSettings retry_budget_settings)
+    utils::RetryBudgetSettings retry_budget_settings,
+    std::shared_ptr<NearCache> near_cache,
+    HeavyCommandsSettings heavy_commands_settings,
+    std::shared_ptr<ScriptRegistry> script_registry)
     : commands_buffering_settings_(std::move(buffering_settings)),
       replication_monitoring_settings_(
           std::move(replication_monitoring_settings)),
@@ -20,6 +23,9 @@ RedisConnectionHolder::RedisConnectionHolder(
       host_(host),
       port_(port),
       password_(std::move(password)),
+      near_cache_(std::move(near_cache)),
+      heavy_commands_settings_(heavy_commands_settings),
+      script_registry_(std::move(script_registry)),
       connection_check_timer_(
           ev_thread_, [this] { EnsureConnected(); },
           kCheckRedisConnectedInterval) {
@@ -53,6 +59,10 @@ void RedisConnectionHolder::CreateConnection() {
   /// Here we allow read from replicas possibly stale data.
   /// This does not affect connections to masters
   settings.send_readonly = true;
+  settings.near_cache = near_cache_;
+  settings.heavy_commands = heavy_commands_settings_;
+  settings.script_registry = script_registry_;
+  settings.cluster_mode = true;
   auto instance = std::make_shared<Redis>(redis_thread_pool_, settings);
   instance->signal_state_change.connect(
       [weak_ptr{weak_from_this()}](Redis::State state) {
@@ -23,7 +23,10 @@ class RedisConnectionHolder
       const std::string& host, uint16_t port, Password password,
       CommandsBufferingSettings buffering_settings,
       ReplicationMonitoringSettings replication_monitoring_settings,
-      utils::RetryBudgetSettings retry_budget_settings);
+      utils::RetryBudgetSettings retry_budget_settings,
+      std::shared_ptr<NearCache> near_cache = nullptr,
+      HeavyCommandsSettings heavy_commands_settings = {},
+      std::shared_ptr<ScriptRegistry> script_registry = nullptr);
   ~RedisConnectionHolder();
   RedisConnectionHolder(const RedisConnectionHolder&) = delete;
   RedisConnectionHolder& operator=(const RedisConnectionHolder&) = delete;
@@ -55,6 +58,9 @@ class RedisConnectionHolder
   const std::string host_;
   const uint16_t port_;
   const Password password_;
+  const std::shared_ptr<NearCache> near_cache_;
+  const HeavyCommandsSettings heavy_commands_settings_;
+  const std::shared_ptr<ScriptRegistry> script_registry_;
   rcu::Variable<std::shared_ptr<Redis>, StdMutexRcuTraits> redis_;
   engine::ev::PeriodicWatcher connection_check_timer_;
 };
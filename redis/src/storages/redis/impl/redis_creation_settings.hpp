@@ -1,5 +1,7 @@
 #pragma once
 
+#include <cstddef>
+#include <memory>
 #include <unordered_map>
 
 #include <userver/storages/redis/impl/base.hpp>
@@ -8,9 +10,29 @@ USERVER_NAMESPACE_BEGIN
 
 namespace redis {
 
+class NearCache;
+class ScriptRegistry;
+
+/// Extra connections of every instance for the commands that take long to
+/// execute or to transfer, so that the other commands do not queue behind
+/// them. The commands of different connections may be reordered.
+struct HeavyCommandsSettings {
+  /// Number of the extra connections, 0 sends all commands to one connection
+  std::size_t connections{0};
+  /// Commands with more bytes of arguments are heavy whatever their name is
+  std::size_t args_size_threshold{64 * 1024};
+};
+
 struct RedisCreationSettings {
   ConnectionSecurity connection_security = ConnectionSecurity::kNone;
   bool send_readonly{false};
+  /// Enables the client tracking on the connection to invalidate the cache
+  std::shared_ptr<NearCache> near_cache;
+  /// Adjacent GETs are merged only if their keys are in the same hash slot
+  bool cluster_mode{false};
+  HeavyCommandsSettings heavy_commands;
+  /// Scripts to load with SCRIPT LOAD once connected
+  std::shared_ptr<ScriptRegistry> script_registry;
 };
 
 }  // namespace redis
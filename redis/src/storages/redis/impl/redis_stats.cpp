@@ -1,6 +1,7 @@
 #include <storages/redis/impl/redis_stats.hpp>
 
 #include <array>
+#include <cmath>
 
 #include <storages/redis/impl/command.hpp>
 #include <storages/redis/impl/redis.hpp>
@@ -17,6 +18,9 @@ namespace redis {
 
 namespace {
 
+// Time for the latency peak to decay by e times
+constexpr std::chrono::duration<double> kLatencyEwmaDecayTime{1.0};
+
 const std::string_view kCommandTypes[] = {
     "append",
     "auth",
@@ -195,6 +199,25 @@ void Statistics::AccountPing(std::chrono::milliseconds ping) {
   last_ping_ms = ping.count();
 }
 
+void Statistics::AccountLatency(std::chrono::microseconds latency) {
+  const auto now = std::chrono::steady_clock::now();
+  const auto sample = static_cast<double>(latency.count());
+  auto ewma = latency_ewma_us.load(std::memory_order_relaxed);
+  if (sample >= ewma) {
+    ewma = sample;
+  } else {
+    const std::chrono::duration<double> elapsed = now - latency_ewma_time;
+    const auto weight = std::exp(-elapsed / kLatencyEwmaDecayTime);
+    ewma = ewma * weight + sample * (1 - weight);
+  }
+  latency_ewma_time = now;
+  latency_ewma_us.store(ewma, std::memory_order_relaxed);
+}
+
+void Statistics::AccountSelection(LeastLatencySelection reason) {
+  ++least_latency_selections[static_cast<size_t>(reason)];
+}
+
 InstanceStatistics SentinelStatistics::GetShardGroupTotalStatistics() const {
   return shard_group_total;
 }
@@ -227,6 +250,15 @@ void DumpMetric(utils::statistics::Writer& writer,
     }
   }
 
+  writer["least_latency_selections"].ValueWithLabels(
+      stats.least_latency_selections[static_cast<size_t>(
+          LeastLatencySelection::kLeastLoaded)].Load(),
+      {"redis_selection_reason", "least_loaded"});
+  writer["least_latency_selections"].ValueWithLabels(
+      stats.least_latency_selections[static_cast<size_t>(
+          LeastLatencySelection::kFallback)].Load(),
+      {"redis_selection_reason", "fallback"});
+
   for (size_t i = 0; i < kReplyStatusMap.size(); ++i) {
     writer["errors"].ValueWithLabels(
         stats.error_count[i].Load().value,
@@ -240,6 +272,7 @@ void DumpMetric(utils::statistics::Writer& writer,
     writer["last_ping_ms"] = stats.last_ping_ms;
     writer["is_syncing"] = static_cast<int>(stats.is_syncing);
     writer["offset_from_master"] = stats.offset_from_master;
+    writer["latency_ewma_us"] = stats.latency_ewma_us;
 
     for (size_t i = 0; i <= static_cast<int>(Redis::State::kDisconnectError);
          ++i) {
@@ -280,6 +313,7 @@ void DumpMetric(utils::statistics::Writer& writer,
 void DumpMetric(utils::statistics::Writer& writer,
                 const SentinelStatistics& stats) {
   const auto& settings = stats.shard_group_total.settings;
+  if (stats.near_cache) writer["near_cache"] = *stats.near_cache;
   DumpMetric(writer, stats.shard_group_total, false);
   writer["errors"].ValueWithLabels(stats.internal.redis_not_ready.load(),
                                    {"redis_error", "redis_not_ready"});
@@ -327,6 +361,19 @@ void DumpMetric(utils::statistics::Writer& writer,
   }
 }
 
+void DumpMetric(utils::statistics::Writer& writer,
+                const NearCacheStatistics& stats) {
+  writer["hits"] = stats.hits;
+  writer["misses"] = stats.misses;
+  const auto lookups = stats.hits.value + stats.misses.value;
+  writer["hit_ratio_percent"] =
+      lookups ? stats.hits.value * 100.0 / lookups : 0.0;
+  writer["invalidations"] = stats.invalidations;
+  writer["flushes"] = stats.flushes;
+  writer["keys"] = stats.keys;
+  writer["bytes"] = stats.bytes;
+}
+
 }  // namespace redis
 
 USERVER_NAMESPACE_END
@@ -3,6 +3,7 @@
 #include <array>
 #include <atomic>
 #include <chrono>
+#include <optional>
 #include <string_view>
 #include <unordered_map>
 
@@ -13,6 +14,7 @@
 #include <userver/utils/statistics/rate_counter.hpp>
 #include <userver/utils/statistics/recentperiod.hpp>
 
+#include <storages/redis/impl/near_cache.hpp>
 #include <storages/redis/impl/reply_status_strings.hpp>
 
 USERVER_NAMESPACE_BEGIN
@@ -25,6 +27,16 @@ constexpr size_t ReplySizeBucketCount = 15;
 constexpr size_t RequestSizeBucketCount = 15;
 constexpr size_t TimingBucketCount = 15;
 
+/// Why CommandControl::Strategy::kLeastLatency chose an instance
+enum class LeastLatencySelection {
+  /// The least loaded of the instances preferred for the command
+  kLeastLoaded,
+  /// The preferred instances were not available or did not accept the command
+  kFallback,
+};
+
+inline constexpr size_t kLeastLatencySelectionCount = 2;
+
 class Statistics {
  public:
   Statistics();
@@ -34,6 +46,9 @@ class Statistics {
   void AccountReplyReceived(const ReplyPtr& reply, const CommandPtr& cmd);
   void AccountPing(std::chrono::milliseconds ping);
   void AccountError(ReplyStatus code);
+  /// Updates the peak EWMA of the latency, must be called from the ev thread
+  void AccountLatency(std::chrono::microseconds latency);
+  void AccountSelection(LeastLatencySelection reason);
 
   using Percentile = utils::statistics::Percentile<2048>;
   using RecentPeriod =
@@ -50,9 +65,14 @@ class Statistics {
   std::atomic_llong last_ping_ms{};
   std::atomic_bool is_syncing = false;
   std::atomic_size_t offset_from_master_bytes = 0;
+  // Grows at once on a slow reply and then decays with time
+  std::atomic<double> latency_ewma_us{0};
+  std::chrono::steady_clock::time_point latency_ewma_time{};
 
   std::array<utils::statistics::RateCounter, kReplyStatusMap.size()>
       error_count{{}};
+  std::array<utils::statistics::RateCounter, kLeastLatencySelectionCount>
+      least_latency_selections{{}};
 };
 
 struct InstanceStatistics {
@@ -70,8 +90,11 @@ struct InstanceStatistics {
     is_syncing = other.is_syncing.load(std::memory_order_relaxed);
     offset_from_master =
         other.offset_from_master_bytes.load(std::memory_order_relaxed);
+    latency_ewma_us = other.latency_ewma_us.load(std::memory_order_relaxed);
     for (size_t i = 0; i < error_count.size(); i++)
       error_count[i] = other.error_count[i];
+    for (size_t i = 0; i < least_latency_selections.size(); i++)
+      least_latency_selections[i] = other.least_latency_selections[i];
     for (const auto& [command, timings] : other.command_timings_percentile) {
       auto stats = timings.GetStatsForPeriod();
       if (!stats.Count()) continue;
@@ -87,6 +110,8 @@ struct InstanceStatistics {
 
     for (size_t i = 0; i < error_count.size(); i++)
       error_count[i] += other.error_count[i];
+    for (size_t i = 0; i < least_latency_selections.size(); i++)
+      least_latency_selections[i] += other.least_latency_selections[i];
 
     for (const auto& [command, timings] : other.command_timings_percentile)
       command_timings_percentile[command].Add(timings);
@@ -104,9 +129,12 @@ struct InstanceStatistics {
   long long last_ping_ms{};
   bool is_syncing{};
   long long offset_from_master{};
+  double latency_ewma_us{};
 
   std::array<utils::statistics::RateCounter, kReplyStatusMap.size()>
       error_count{{}};
+  std::array<utils::statistics::RateCounter, kLeastLatencySelectionCount>
+      least_latency_selections{{}};
 };
 
 struct ShardStatistics {
@@ -143,6 +171,7 @@ struct SentinelStatistics {
   std::unordered_map<std::string, ShardStatistics> slaves;
   InstanceStatistics shard_group_total;
   SentinelStatisticsInternal internal;
+  std::optional<NearCacheStatistics> near_cache;
 };
 
 void DumpMetric(utils::statistics::Writer& writer,
@@ -151,6 +180,9 @@ void DumpMetric(utils::statistics::Writer& writer,
 void DumpMetric(utils::statistics::Writer& writer,
                 const ShardStatistics& stats);
 
+void DumpMetric(utils::statistics::Writer& writer,
+                const NearCacheStatistics& stats);
+
 void DumpMetric(utils::statistics::Writer& writer,
                 const SentinelStatistics& stats);
 
@@ -43,6 +43,28 @@ ReplyData::ReplyData(const redisReply* reply) {
       type_ = Type::kError;
       string_ = std::string(reply->str, reply->len);
       break;
+#ifdef REDIS_REPLY_PUSH
+    // RESP3 replies of the connections with client tracking are represented
+    // the same way as their RESP2 counterparts
+    case REDIS_REPLY_MAP:
+    case REDIS_REPLY_SET:
+    case REDIS_REPLY_PUSH:
+      type_ = Type::kArray;
+      array_.reserve(reply->elements);
+      for (size_t i = 0; i < reply->elements; i++)
+        array_.emplace_back(reply->element[i]);
+      break;
+    case REDIS_REPLY_DOUBLE:
+    case REDIS_REPLY_BIGNUM:
+    case REDIS_REPLY_VERB:
+      type_ = Type::kString;
+      string_ = std::string(reply->str, reply->len);
+      break;
+    case REDIS_REPLY_BOOL:
+      type_ = Type::kInteger;
+      integer_ = reply->integer;
+      break;
+#endif
     default:
       type_ = Type::kNoReply;
       break;
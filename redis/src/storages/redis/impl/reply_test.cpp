@@ -22,4 +22,25 @@ TEST(Reply, IsUnusableInstanceErrorERR) {
   EXPECT_FALSE(data.IsUnusableInstanceError());
 }
 
+TEST(Reply, KeyValuesReferenceElements) {
+  const redis::ReplyData data{redis::ReplyData::Array{
+      redis::ReplyData{"key1"}, redis::ReplyData{"value1"},
+      redis::ReplyData{"key2"}, redis::ReplyData{"value2"}}};
+
+  std::size_t index = 0;
+  for (const auto key_value : data.GetKeyValues()) {
+    EXPECT_EQ(&key_value.Key(), &data[index * 2].GetString());
+    EXPECT_EQ(&key_value.Value(), &data[index * 2 + 1].GetString());
+    ++index;
+  }
+  EXPECT_EQ(index, 2);
+}
+
+TEST(Reply, GetStringView) {
+  const redis::ReplyData data{"value"};
+  EXPECT_EQ(data.GetStringView(), "value");
+  EXPECT_EQ(data.GetStringView().data(), data.GetString().data());
+  EXPECT_EQ(redis::ReplyData::CreateStatus("OK").GetStringView(), "OK");
+}
+
 USERVER_NAMESPACE_END
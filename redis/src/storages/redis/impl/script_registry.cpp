@@ -0,0 +1,25 @@
+#include <storages/redis/impl/script_registry.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace redis {
+
+void ScriptRegistry::Add(const std::string& sha1, const std::string& script) {
+  const std::lock_guard lock(mutex_);
+  if (!hashes_.insert(sha1).second) return;
+
+  // Copy on write, the snapshots are used by the connections without the lock
+  auto scripts = std::make_shared<Scripts>(*scripts_);
+  scripts->push_back(script);
+  scripts_ = std::move(scripts);
+}
+
+std::shared_ptr<const ScriptRegistry::Scripts> ScriptRegistry::GetScripts()
+    const {
+  const std::lock_guard lock(mutex_);
+  return scripts_;
+}
+
+}  // namespace redis
+
+USERVER_NAMESPACE_END
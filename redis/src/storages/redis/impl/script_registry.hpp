@@ -0,0 +1,38 @@
+#pragma once
+
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_set>
+#include <vector>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace redis {
+
+/// @brief Lua scripts that the connections load with SCRIPT LOAD once
+/// connected, so that EVALSHA of the scripts does not fail with NOSCRIPT.
+///
+/// A Sentinel shares one registry between the connections of all its masters
+/// and replicas, including the ones created on topology changes and
+/// reconnections. The scripts registered afterwards are loaded by the
+/// connections established later on.
+class ScriptRegistry final {
+ public:
+  using Scripts = std::vector<std::string>;
+
+  /// Registers the script if it is not registered yet
+  void Add(const std::string& sha1, const std::string& script);
+
+  /// Snapshot of the registered scripts
+  std::shared_ptr<const Scripts> GetScripts() const;
+
+ private:
+  mutable std::mutex mutex_;
+  std::unordered_set<std::string> hashes_;
+  std::shared_ptr<const Scripts> scripts_{std::make_shared<const Scripts>()};
+};
+
+}  // namespace redis
+
+USERVER_NAMESPACE_END
@@ -99,6 +99,7 @@ Sentinel::Sentinel(
           dynamic_config_source, mode);
     }
   });
+  impl_->SetScriptRegistry(script_registry_);
 }
 
 Sentinel::~Sentinel() {
@@ -126,7 +127,9 @@ std::shared_ptr<Sentinel> Sentinel::CreateSentinel(
     dynamic_config::Source dynamic_config_source,
     const std::string& client_name, KeyShardFactory key_shard_factory,
     const CommandControl& command_control,
-    const testsuite::RedisControl& testsuite_redis_control) {
+    const testsuite::RedisControl& testsuite_redis_control,
+    const std::optional<NearCacheSettings>& near_cache_settings,
+    const HeavyCommandsSettings& heavy_commands_settings) {
   auto ready_callback = [](size_t shard, const std::string& shard_name,
                            bool ready) {
     LOG_INFO() << "redis: ready_callback:"
@@ -136,7 +139,8 @@ std::shared_ptr<Sentinel> Sentinel::CreateSentinel(
   return CreateSentinel(thread_pools, settings, std::move(shard_group_name),
                         dynamic_config_source, client_name,
                         std::move(ready_callback), std::move(key_shard_factory),
-                        command_control, testsuite_redis_control);
+                        command_control, testsuite_redis_control,
+                        near_cache_settings, heavy_commands_settings);
 }
 
 std::shared_ptr<Sentinel> Sentinel::CreateSentinel(
@@ -146,7 +150,9 @@ std::shared_ptr<Sentinel> Sentinel::CreateSentinel(
     const std::string& client_name,
     Sentinel::ReadyChangeCallback ready_callback,
     KeyShardFactory key_shard_factory, const CommandControl& command_control,
-    const testsuite::RedisControl& testsuite_redis_control) {
+    const testsuite::RedisControl& testsuite_redis_control,
+    const std::optional<NearCacheSettings>& near_cache_settings,
+    const HeavyCommandsSettings& heavy_commands_settings) {
   const auto& password = settings.password;
 
   const std::vector<std::string>& shards = settings.shards;
@@ -177,6 +183,8 @@ std::shared_ptr<Sentinel> Sentinel::CreateSentinel(
         password, settings.secure_connection, std::move(ready_callback),
         dynamic_config_source, std::move(key_shard), command_control,
         testsuite_redis_control);
+    if (near_cache_settings) client->EnableNearCache(*near_cache_settings);
+    client->SetHeavyCommandsSettings(heavy_commands_settings);
     client->Start();
   }
 
@@ -307,7 +315,9 @@ const std::string& Sentinel::GetAnyKeyForShard(size_t shard_idx) const {
 
 SentinelStatistics Sentinel::GetStatistics(
     const MetricsSettings& settings) const {
-  return impl_->GetStatistics(settings);
+  auto stats = impl_->GetStatistics(settings);
+  if (near_cache_) stats.near_cache = near_cache_->GetStatistics();
+  return stats;
 }
 
 void Sentinel::SetCommandsBufferingSettings(
@@ -320,6 +330,15 @@ void Sentinel::SetReplicationMonitoringSettings(
   impl_->SetReplicationMonitoringSettings(replication_monitoring_settings);
 }
 
+void Sentinel::EnableNearCache(NearCacheSettings settings) {
+  near_cache_ = std::make_shared<NearCache>(std::move(settings));
+  impl_->SetNearCache(near_cache_);
+}
+
+void Sentinel::SetHeavyCommandsSettings(const HeavyCommandsSettings& settings) {
+  impl_->SetHeavyCommandsSettings(settings);
+}
+
 void Sentinel::SetRetryBudgetSettings(
     const utils::RetryBudgetSettings& settings) {
   impl_->SetRetryBudgetSettings(settings);
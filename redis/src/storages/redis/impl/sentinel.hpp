@@ -1,6 +1,7 @@
 #pragma once
 
 #include <memory>
+#include <optional>
 #include <string>
 #include <unordered_map>
 
@@ -19,7 +20,10 @@
 #include <userver/storages/redis/impl/types.hpp>
 #include <userver/storages/redis/impl/wait_connected_mode.hpp>
 
+#include <storages/redis/impl/near_cache.hpp>
+#include <storages/redis/impl/redis_creation_settings.hpp>
 #include <storages/redis/impl/redis_stats.hpp>
+#include <storages/redis/impl/script_registry.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
@@ -98,7 +102,9 @@ class Sentinel {
       dynamic_config::Source dynamic_config_source,
       const std::string& client_name, KeyShardFactory key_shard_factory,
       const CommandControl& command_control = {},
-      const testsuite::RedisControl& testsuite_redis_control = {});
+      const testsuite::RedisControl& testsuite_redis_control = {},
+      const std::optional<NearCacheSettings>& near_cache_settings = {},
+      const HeavyCommandsSettings& heavy_commands_settings = {});
   static std::shared_ptr<redis::Sentinel> CreateSentinel(
       const std::shared_ptr<ThreadPools>& thread_pools,
       const secdist::RedisSettings& settings, std::string shard_group_name,
@@ -106,7 +112,9 @@ class Sentinel {
       const std::string& client_name, ReadyChangeCallback ready_callback,
       KeyShardFactory key_shard_factory,
       const CommandControl& command_control = {},
-      const testsuite::RedisControl& testsuite_redis_control = {});
+      const testsuite::RedisControl& testsuite_redis_control = {},
+      const std::optional<NearCacheSettings>& near_cache_settings = {},
+      const HeavyCommandsSettings& heavy_commands_settings = {});
 
   void Restart();
 
@@ -141,6 +149,20 @@ class Sentinel {
       const ReplicationMonitoringSettings& replication_monitoring_settings);
   void SetRetryBudgetSettings(const utils::RetryBudgetSettings& settings);
 
+  /// Enables the client-side cache with client tracking on the connections,
+  /// must be called before Start()
+  void EnableNearCache(NearCacheSettings settings);
+
+  /// Sets the extra connections of the instances for heavy commands, must be
+  /// called before Start()
+  void SetHeavyCommandsSettings(const HeavyCommandsSettings& settings);
+
+  /// @returns nullptr if the cache is not enabled
+  std::shared_ptr<NearCache> GetNearCache() const { return near_cache_; }
+
+  /// Scripts loaded by every connection of the masters and replicas
+  ScriptRegistry& GetScriptRegistry() const { return *script_registry_; }
+
   // NOLINTNEXTLINE(misc-non-private-member-variables-in-classes)
   boost::signals2::signal<void(size_t shard)> signal_instances_changed;
   // NOLINTNEXTLINE(misc-non-private-member-variables-in-classes)
@@ -178,11 +200,14 @@ class Sentinel {
   virtual void SetConfigDefaultCommandControl(
       const std::shared_ptr<CommandControl>& cc);
 
+  /// Message of a subscription, shared by all the subscribers of a channel
+  using SharedMessage = std::shared_ptr<const std::string>;
+
   using UserMessageCallback = std::function<Outcome(
-      const std::string& channel, const std::string& message)>;
+      const std::string& channel, const SharedMessage& message)>;
   using UserPmessageCallback = std::function<Outcome(
       const std::string& pattern, const std::string& channel,
-      const std::string& message)>;
+      const SharedMessage& message)>;
 
   using MessageCallback =
       std::function<void(ServerId server_id, const std::string& channel,
@@ -229,6 +254,9 @@ class Sentinel {
   utils::SwappingSmart<CommandControl> config_default_command_control_;
   std::atomic_int publish_shard_{0};
   testsuite::RedisControl testsuite_redis_control_;
+  std::shared_ptr<NearCache> near_cache_;
+  const std::shared_ptr<ScriptRegistry> script_registry_{
+      std::make_shared<ScriptRegistry>()};
 };
 
 }  // namespace redis
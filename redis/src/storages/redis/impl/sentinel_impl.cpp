@@ -4,8 +4,6 @@
 #include <sstream>
 #include <thread>
 
-#include <boost/crc.hpp>
-
 #include <fmt/format.h>
 
 #include <hiredis/hiredis.h>
@@ -204,6 +202,9 @@ void SentinelImpl::InitShards(
       else
         connected_statuses_[i]->SetSlaveReady();
     });
+    if (near_cache_) object->SetNearCache(near_cache_);
+    object->SetHeavyCommandsSettings(heavy_commands_settings_);
+    if (script_registry_) object->SetScriptRegistry(script_registry_);
     shard_objects.emplace_back(std::move(object));
     ++i;
   }
@@ -556,6 +557,23 @@ void SentinelImpl::SetRetryBudgetSettings(
     shard->SetRetryBudgetSettings(retry_budget_settings);
 }
 
+void SentinelImpl::SetNearCache(std::shared_ptr<NearCache> near_cache) {
+  near_cache_ = near_cache;
+  for (auto& shard : master_shards_) shard->SetNearCache(near_cache);
+}
+
+void SentinelImpl::SetHeavyCommandsSettings(
+    const HeavyCommandsSettings& settings) {
+  heavy_commands_settings_ = settings;
+  for (auto& shard : master_shards_) shard->SetHeavyCommandsSettings(settings);
+}
+
+void SentinelImpl::SetScriptRegistry(
+    std::shared_ptr<ScriptRegistry> script_registry) {
+  script_registry_ = script_registry;
+  for (auto& shard : master_shards_) shard->SetScriptRegistry(script_registry);
+}
+
 PublishSettings SentinelImpl::GetPublishSettings() {
   /// Why do we always publish to master? We can actually publish to any host in
   /// shard to distribute load evenly
@@ -941,15 +959,6 @@ size_t SentinelImpl::ParseMovedShard(const std::string& err_string) {
   return shard_info_.GetShard(host, port);
 }
 
-size_t SentinelImpl::HashSlot(const std::string& key) {
-  size_t start = 0;
-  size_t len = 0;
-  GetRedisKey(key, &start, &len);
-  return std::for_each(key.data() + start, key.data() + start + len,
-                       boost::crc_optimal<16, 0x1021>())() &
-         0x3fff;
-}
-
 SentinelImpl::SlotInfo::SlotInfo() {
   for (size_t i = 0; i < kClusterHashSlots; ++i) {
     slot_to_shard_[i] = kUnknownShard;
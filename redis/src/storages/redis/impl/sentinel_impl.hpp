@@ -91,6 +91,11 @@ class SentinelImplBase {
       const ReplicationMonitoringSettings& replication_monitoring_settings) = 0;
   virtual void SetRetryBudgetSettings(
       const utils::RetryBudgetSettings& retry_budget_settings) = 0;
+  virtual void SetNearCache(std::shared_ptr<NearCache> near_cache) = 0;
+  virtual void SetHeavyCommandsSettings(
+      const HeavyCommandsSettings& settings) = 0;
+  virtual void SetScriptRegistry(
+      std::shared_ptr<ScriptRegistry> script_registry) = 0;
 
   virtual PublishSettings GetPublishSettings() = 0;
 };
@@ -148,6 +153,11 @@ class SentinelImpl : public SentinelImplBase {
       override;
   void SetRetryBudgetSettings(
       const utils::RetryBudgetSettings& retry_budget_settings) override;
+  void SetNearCache(std::shared_ptr<NearCache> near_cache) override;
+  void SetHeavyCommandsSettings(
+      const HeavyCommandsSettings& settings) override;
+  void SetScriptRegistry(
+      std::shared_ptr<ScriptRegistry> script_registry) override;
   PublishSettings GetPublishSettings() override;
 
  private:
@@ -242,8 +252,6 @@ class SentinelImpl : public SentinelImplBase {
                   std::vector<std::shared_ptr<Shard>>& shard_objects,
                   const ReadyChangeCallback& ready_callback);
 
-  static size_t HashSlot(const std::string& key);
-
   void ProcessWaitingCommands();
 
   Sentinel& sentinel_obj_;
@@ -283,6 +291,9 @@ class SentinelImpl : public SentinelImplBase {
   SentinelStatisticsInternal statistics_internal_;
   utils::SwappingSmart<KeysForShards> keys_for_shards_;
   std::optional<CommandsBufferingSettings> commands_buffering_settings_;
+  std::shared_ptr<NearCache> near_cache_;
+  HeavyCommandsSettings heavy_commands_settings_;
+  std::shared_ptr<ScriptRegistry> script_registry_;
   dynamic_config::Source dynamic_config_source_;
   std::atomic<int> publish_shard_{0};
 };
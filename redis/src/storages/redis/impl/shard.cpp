@@ -123,7 +123,8 @@ std::vector<unsigned char> Shard::GetAvailableServers(
 
   switch (cc.strategy) {
     case CommandControl::Strategy::kEveryDc:
-    case CommandControl::Strategy::kDefault: {
+    case CommandControl::Strategy::kDefault:
+    case CommandControl::Strategy::kLeastLatency: {
       std::vector<unsigned char> result(instances_.size(), 0);
       for (size_t i = 0; i < instances_.size(); i++) {
         result[i] =
@@ -179,7 +180,7 @@ std::vector<unsigned char> Shard::GetNearestServersPing(
 std::shared_ptr<Redis> Shard::GetInstance(
     const std::vector<unsigned char>& available_servers, bool is_retry,
     bool may_fallback_to_any, size_t skip_idx, bool read_only,
-    size_t* pinstance_idx) {
+    bool least_latency, size_t* pinstance_idx) {
   std::shared_ptr<Redis> instance;
 
   auto end = instances_.size();
@@ -196,7 +197,7 @@ std::shared_ptr<Redis> Shard::GetInstance(
     if (cur_inst && cur_inst->IsAvailable() &&
         (!is_retry || cur_inst->CanRetry()) &&
         (!instance || instance->IsDestroying() ||
-         cur_inst->GetRunningCommands() < instance->GetRunningCommands())) {
+         IsLessLoaded(*cur_inst, *instance, least_latency))) {
       if (pinstance_idx) *pinstance_idx = instance_idx;
       instance = cur_inst;
     }
@@ -230,6 +231,8 @@ bool Shard::AsyncCommand(CommandPtr command) {
   const auto& available_servers = GetAvailableServers(
       command->control, !command->read_only || cc.allow_reads_from_master,
       command->read_only);
+  const bool least_latency =
+      cc.strategy == CommandControl::Strategy::kLeastLatency;
 
   auto max_attempts = instances_.size() + 1;
   for (size_t attempt = 0; attempt < max_attempts; attempt++) {
@@ -244,16 +247,25 @@ bool Shard::AsyncCommand(CommandPtr command) {
         (attempt != 0 && cc.force_server_id.IsAny());
 
     instance = GetInstance(available_servers, is_retry, may_fallback_to_any,
-                           skip_idx, command->read_only, &idx);
+                           skip_idx, command->read_only, least_latency, &idx);
     command->instance_idx = idx;
 
     if (instance) {
-      if (idx >= available_servers.size() || !available_servers[idx]) {
+      const bool fallback =
+          idx >= available_servers.size() || !available_servers[idx];
+      if (fallback) {
         LOG_LIMITED_WARNING() << "Failed to use Redis server according to the "
                                  "strategy, falling back to any server"
                               << command->GetLogExtra();
       }
-      if (instance->AsyncCommand(command)) return true;
+      if (instance->AsyncCommand(command)) {
+        if (least_latency) {
+          instance->AccountSelection(fallback || attempt != 0
+                                         ? LeastLatencySelection::kFallback
+                                         : LeastLatencySelection::kLeastLoaded);
+        }
+        return true;
+      }
     }
   }
 
@@ -291,9 +303,14 @@ bool Shard::ProcessCreation(
 
   // https://github.com/boostorg/signals2/issues/59
   // NOLINTNEXTLINE(clang-analyzer-cplusplus.NewDelete)
+  const auto heavy_commands_settings = heavy_commands_settings_.Get();
   for (const auto& id : need_to_create) {
     const auto redis_settings = RedisCreationSettings{
-        id.GetConnectionSecurity(), cluster_mode_ && id.IsReadOnly()};
+        id.GetConnectionSecurity(), cluster_mode_ && id.IsReadOnly(),
+        near_cache_.Get(), cluster_mode_,
+        heavy_commands_settings ? *heavy_commands_settings
+                                : HeavyCommandsSettings{},
+        script_registry_.Get()};
     ConnectionStatus entry{
         id, std::make_shared<Redis>(
                 redis_thread_pool,
@@ -403,7 +420,7 @@ void Shard::GetStatistics(bool master, const MetricsSettings& settings,
     auto it = stats.instances.emplace(instance.info.Fulltext(),
                                       redis::InstanceStatistics(settings));
     auto& inst_stats = it.first->second;
-    inst_stats.Fill(instance.instance->GetStatistics());
+    instance.instance->FillStatistics(inst_stats);
     stats.shard_total.Add(inst_stats);
 
     if (instance.instance->GetState() == Redis::State::kConnected) {
@@ -481,6 +498,19 @@ void Shard::SetRetryBudgetSettings(
       std::make_shared<utils::RetryBudgetSettings>(retry_budget_settings));
 }
 
+void Shard::SetNearCache(std::shared_ptr<NearCache> near_cache) {
+  near_cache_.Set(near_cache);
+}
+
+void Shard::SetHeavyCommandsSettings(const HeavyCommandsSettings& settings) {
+  heavy_commands_settings_.Set(
+      std::make_shared<HeavyCommandsSettings>(settings));
+}
+
+void Shard::SetScriptRegistry(std::shared_ptr<ScriptRegistry> script_registry) {
+  script_registry_.Set(std::move(script_registry));
+}
+
 std::vector<ConnectionInfoInt> Shard::GetConnectionInfosToCreate() const {
   std::shared_lock lock(mutex_);
 
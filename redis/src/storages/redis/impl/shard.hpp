@@ -9,8 +9,10 @@
 
 #include <userver/utils/swappingsmart.hpp>
 
+#include <storages/redis/impl/near_cache.hpp>
 #include <storages/redis/impl/redis.hpp>
 #include <storages/redis/impl/redis_stats.hpp>
+#include <storages/redis/impl/script_registry.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
@@ -79,7 +81,7 @@ class Shard {
   std::shared_ptr<Redis> GetInstance(
       const std::vector<unsigned char>& available_servers, bool is_retry,
       bool may_fallback_to_any, size_t skip_idx, bool read_only,
-      size_t* pinstance_idx);
+      bool least_latency, size_t* pinstance_idx);
   void Clean();
   bool ProcessCreation(
       const std::shared_ptr<engine::ev::ThreadPool>& redis_thread_pool);
@@ -101,6 +103,11 @@ class Shard {
       const ReplicationMonitoringSettings& replication_monitoring_settings);
   void SetRetryBudgetSettings(
       const utils::RetryBudgetSettings& replication_monitoring_settings);
+  /// Only the connections created afterwards use the cache
+  void SetNearCache(std::shared_ptr<NearCache> near_cache);
+  void SetHeavyCommandsSettings(const HeavyCommandsSettings& settings);
+  /// Only the connections created afterwards load the scripts
+  void SetScriptRegistry(std::shared_ptr<ScriptRegistry> script_registry);
 
  private:
   std::vector<unsigned char> GetAvailableServers(
@@ -135,6 +142,9 @@ class Shard {
 
   utils::SwappingSmart<CommandsBufferingSettings> commands_buffering_settings_;
   utils::SwappingSmart<utils::RetryBudgetSettings> retry_budget_settings_;
+  utils::SwappingSmart<NearCache> near_cache_;
+  utils::SwappingSmart<HeavyCommandsSettings> heavy_commands_settings_;
+  utils::SwappingSmart<ScriptRegistry> script_registry_;
 
   bool prev_connected_ = false;
   const bool cluster_mode_ = false;
@@ -450,13 +450,15 @@ void SubscriptionStorageBase::SubscriptionStorageImpl<
                                           const std::string& channel,
                                           const std::string& message,
                                           size_t shard_idx) {
+  // A single copy of the message for all the subscribers, made before the lock
+  const auto shared_message = std::make_shared<const std::string>(message);
   size_t discarded{0};
   try {
     const std::lock_guard<std::mutex> lock(mutex_);
     auto& m = callback_map_.at(channel);
     for (const auto& it : m.callbacks) {
       try {
-        const auto result = it.second(channel, message);
+        const auto result = it.second(channel, shared_message);
         switch (result) {
           case SubscribedCallbackOutcome::kOk:
             break;  // do nothing
@@ -485,13 +487,15 @@ void SubscriptionStorageBase::SubscriptionStorageImpl<
                                            const std::string& channel,
                                            const std::string& message,
                                            size_t shard_idx) {
+  // A single copy of the message for all the subscribers, made before the lock
+  const auto shared_message = std::make_shared<const std::string>(message);
   size_t discarded{0};
   try {
     const std::lock_guard<std::mutex> lock(mutex_);
     auto& m = pattern_callback_map_.at(pattern);
     for (const auto& it : m.callbacks) {
       try {
-        const auto result = it.second(pattern, channel, message);
+        const auto result = it.second(pattern, channel, shared_message);
         switch (result) {
           case SubscribedCallbackOutcome::kOk:
             break;  // do nothing
@@ -519,13 +523,15 @@ void SubscriptionStorageBase::SubscriptionStorageImpl<
                                            const std::string& channel,
                                            const std::string& message,
                                            size_t shard_idx) {
+  // A single copy of the message for all the subscribers, made before the lock
+  const auto shared_message = std::make_shared<const std::string>(message);
   size_t discarded{0};
   try {
     const std::lock_guard<std::mutex> lock(mutex_);
     auto& m = sharded_callback_map_.at(channel);
     for (const auto& it : m.callbacks) {
       try {
-        const auto result = it.second(channel, message);
+        const auto result = it.second(channel, shared_message);
         switch (result) {
           case SubscribedCallbackOutcome::kOk:
             break;  // do nothing
@@ -1,5 +1,7 @@
 #include <userver/storages/redis/parse_reply.hpp>
 
+#include <iterator>
+
 #include <userver/storages/redis/reply.hpp>
 #include <userver/utils/from_string.hpp>
 
@@ -65,6 +67,39 @@ Point ParsePointArray(const redis::ReplyData& elem,
   }
 }
 
+std::vector<StreamEntry> ParseStreamEntries(
+    ReplyData& entries_data, const std::string& request_description) {
+  entries_data.ExpectArray(request_description);
+  auto& entries = entries_data.GetArray();
+  std::vector<StreamEntry> result;
+  result.reserve(entries.size());
+
+  for (auto& entry : entries) {
+    entry.ExpectArray(request_description);
+    if (entry.GetArray().size() != 2) {
+      throw USERVER_NAMESPACE::redis::ParseReplyException(
+          "Unexpected reply to '" + request_description +
+          "'. Expected stream entry of 2 elements, got " +
+          entry.ToDebugString());
+    }
+
+    StreamEntry stream_entry;
+    stream_entry.id = ExtractStringElem(entry, 0, request_description);
+    auto& field_values = entry.GetArray()[1];
+    if (!field_values.IsNil()) {
+      field_values.ExpectArray(request_description);
+      auto key_values = GetKeyValues(field_values, request_description);
+      stream_entry.field_values.reserve(key_values.size());
+      for (auto elem : key_values) {
+        stream_entry.field_values.emplace_back(std::move(elem.Key()),
+                                               std::move(elem.Value()));
+      }
+    }
+    result.push_back(std::move(stream_entry));
+  }
+  return result;
+}
+
 }  // namespace
 
 namespace impl {
@@ -140,6 +175,17 @@ std::vector<std::pair<std::string, std::string>> ParseReplyDataArray(
 std::vector<MemberScore> ParseReplyDataArray(
     ReplyData&& array_data, const std::string& request_description,
     To<std::vector<MemberScore>>) {
+  // RESP3 replies hold [member, score] pairs instead of a flat array
+  if (array_data.IsArray() && !array_data.GetArray().empty() &&
+      array_data.GetArray().front().IsArray()) {
+    ReplyData::Array flat;
+    flat.reserve(array_data.GetArray().size() * 2);
+    for (auto& pair : array_data.GetArray()) {
+      if (!pair.IsArray()) break;
+      for (auto& elem : pair.GetArray()) flat.push_back(std::move(elem));
+    }
+    array_data = ReplyData{std::move(flat)};
+  }
   auto key_values = GetKeyValues(array_data, request_description);
 
   std::vector<MemberScore> result;
@@ -173,20 +219,23 @@ std::vector<GeoPoint> ParseReplyDataArray(
     ReplyData&& array_data,
     [[maybe_unused]] const std::string& request_description,
     To<std::vector<GeoPoint>>) {
+  auto& array = array_data.GetArray();
   std::vector<GeoPoint> result;
+  result.reserve(array.size());
 
-  for (auto& elem : array_data.GetArray()) {
+  for (auto& elem : array) {
     GeoPoint geo_point;
     if (elem.IsString()) {
       geo_point.member = std::move(elem.GetString());
     } else if (elem.IsArray()) {
-      auto additional_infos = elem.GetArray();
+      auto& additional_infos = elem.GetArray();
       if (additional_infos.empty()) {
         throw USERVER_NAMESPACE::redis::ParseReplyException(
             "Can't parse value from reply to '" + request_description +
             ", additional_info item is empty array");
       }
-      geo_point.member = additional_infos[0].GetString();
+      additional_infos[0].ExpectString(request_description);
+      geo_point.member = std::move(additional_infos[0].GetString());
 
       for (size_t i = 1; i < additional_infos.size(); ++i) {
         const auto& sub_elem = additional_infos[i];
@@ -383,6 +432,61 @@ ReplyData Parse(ReplyData&& reply_data, const std::string&, To<ReplyData>) {
   return std::move(reply_data);
 }
 
+std::vector<StreamEntry> Parse(ReplyData&& reply_data,
+                               const std::string& request_description,
+                               To<XreadgroupReply, std::vector<StreamEntry>>) {
+  if (reply_data.IsNil()) return {};
+  reply_data.ExpectArray(request_description);
+
+  std::vector<StreamEntry> result;
+  for (auto& stream : reply_data.GetArray()) {
+    stream.ExpectArray(request_description);
+    if (stream.GetArray().size() != 2) {
+      throw USERVER_NAMESPACE::redis::ParseReplyException(
+          "Unexpected reply to '" + request_description +
+          "'. Expected stream key and entries, got " + stream.ToDebugString());
+    }
+    auto entries =
+        ParseStreamEntries(stream.GetArray()[1], request_description);
+    if (result.empty()) {
+      result = std::move(entries);
+    } else {
+      std::move(entries.begin(), entries.end(), std::back_inserter(result));
+    }
+  }
+  return result;
+}
+
+XautoclaimReply Parse(ReplyData&& reply_data,
+                      const std::string& request_description,
+                      To<XautoclaimReply>) {
+  reply_data.ExpectArray(request_description);
+  auto& array = reply_data.GetArray();
+  // Redis 7 appends the ids of the deleted entries as the third element
+  if (array.size() != 2 && array.size() != 3) {
+    throw USERVER_NAMESPACE::redis::ParseReplyException(
+        "Unexpected reply to '" + request_description +
+        "'. Expected 2 or 3 elements in array, got " +
+        std::to_string(array.size()));
+  }
+
+  XautoclaimReply result;
+  result.next_start_id = ExtractStringElem(reply_data, 0, request_description);
+  result.entries = ParseStreamEntries(array[1], request_description);
+  return result;
+}
+
+XgroupCreateReply Parse(ReplyData&& reply_data,
+                        const std::string& request_description,
+                        To<XgroupCreateReply>) {
+  if (reply_data.IsError() &&
+      !reply_data.GetError().compare(0, 9, "BUSYGROUP")) {
+    return XgroupCreateReply::kAlreadyExists;
+  }
+  reply_data.ExpectStatusEqualTo(kOk, request_description);
+  return XgroupCreateReply::kCreated;
+}
+
 }  // namespace storages::redis
 
 USERVER_NAMESPACE_END
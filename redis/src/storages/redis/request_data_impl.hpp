@@ -1,13 +1,19 @@
 #pragma once
 
+#include <exception>
+#include <functional>
 #include <memory>
+#include <optional>
 #include <string>
+#include <type_traits>
+#include <vector>
 
 #include <userver/storages/redis/impl/base.hpp>
 #include <userver/storages/redis/impl/request.hpp>
 #include <userver/utils/assert.hpp>
 
 #include <userver/storages/redis/client.hpp>
+#include <userver/storages/redis/exception.hpp>
 #include <userver/storages/redis/parse_reply.hpp>
 #include <userver/storages/redis/request_data_base.hpp>
 
@@ -77,6 +83,82 @@ class RequestDataImpl final : public RequestDataImplBase,
   }
 };
 
+template <typename Result, typename ReplyType>
+class NearCachedRequestDataImpl final : public RequestDataImplBase,
+                                        public RequestDataBase<ReplyType> {
+ public:
+  using OnReply = std::function<void(const ReplyData&)>;
+
+  NearCachedRequestDataImpl(USERVER_NAMESPACE::redis::Request&& request,
+                            OnReply on_reply)
+      : RequestDataImplBase(std::move(request)),
+        on_reply_(std::move(on_reply)) {}
+
+  void Wait() override { impl::Wait(GetRequest()); }
+
+  ReplyType Get(const std::string& request_description) override {
+    auto reply = GetReply();
+    if (reply->IsOk()) on_reply_(reply->data);
+    return ParseReply<Result, ReplyType>(std::move(reply), request_description);
+  }
+
+  ReplyPtr GetRaw() override { return GetReply(); }
+
+  engine::impl::ContextAccessor* TryGetContextAccessor() noexcept override {
+    return GetRequest().TryGetContextAccessor();
+  }
+
+ private:
+  OnReply on_reply_;
+};
+
+/// EVALSHA of a registered script that is retried as EVAL with the script body
+/// if the server replies with NOSCRIPT
+template <typename Result, typename ReplyType>
+class ScriptRequestDataImpl final : public RequestDataImplBase,
+                                    public RequestDataBase<ReplyType> {
+ public:
+  using MakeEval = std::function<USERVER_NAMESPACE::redis::Request()>;
+
+  ScriptRequestDataImpl(USERVER_NAMESPACE::redis::Request&& request,
+                        MakeEval make_eval)
+      : RequestDataImplBase(std::move(request)),
+        make_eval_(std::move(make_eval)) {}
+
+  void Wait() override {
+    if (eval_request_) {
+      impl::Wait(*eval_request_);
+    } else {
+      impl::Wait(GetRequest());
+    }
+  }
+
+  ReplyType Get(const std::string& request_description) override {
+    return ParseReply<Result, ReplyType>(GetRaw(), request_description);
+  }
+
+  ReplyPtr GetRaw() override {
+    if (eval_request_) return eval_request_->Get();
+
+    auto reply = GetReply();
+    if (!reply->data.IsError() ||
+        reply->data.GetError().rfind("NOSCRIPT", 0) != 0) {
+      return reply;
+    }
+    eval_request_.emplace(make_eval_());
+    return eval_request_->Get();
+  }
+
+  engine::impl::ContextAccessor* TryGetContextAccessor() noexcept override {
+    return eval_request_ ? eval_request_->TryGetContextAccessor()
+                         : GetRequest().TryGetContextAccessor();
+  }
+
+ private:
+  MakeEval make_eval_;
+  std::optional<USERVER_NAMESPACE::redis::Request> eval_request_;
+};
+
 template <typename Result, typename ReplyType>
 class AggregateRequestDataImpl final : public RequestDataBase<ReplyType> {
   using RequestDataPtr = std::unique_ptr<RequestDataBase<ReplyType>>;
@@ -114,6 +196,102 @@ class AggregateRequestDataImpl final : public RequestDataBase<ReplyType> {
   std::vector<RequestDataPtr> requests_;
 };
 
+/// Multi-key request split by the cluster hash slots. The replies of the
+/// parts are put back in the order of the keys, `positions[i]` holds the
+/// indexes of the keys of the i-th part.
+template <typename Result, typename ReplyType>
+class SlotSplitRequestDataImpl final : public RequestDataBase<ReplyType> {
+  using RequestDataPtr = std::unique_ptr<RequestDataBase<ReplyType>>;
+
+ public:
+  SlotSplitRequestDataImpl(std::vector<RequestDataPtr>&& requests,
+                           std::vector<std::vector<size_t>>&& positions,
+                           size_t size)
+      : requests_(std::move(requests)),
+        positions_(std::move(positions)),
+        size_(size) {
+    UASSERT(std::is_void_v<ReplyType> || requests_.size() == positions_.size());
+  }
+
+  void Wait() override {
+    for (auto& request : requests_) {
+      request->Wait();
+    }
+  }
+
+  ReplyType Get(const std::string& request_description) override {
+    std::exception_ptr first_error;
+    std::string first_error_message;
+    size_t failed_count = 0;
+    auto on_error = [&](const std::exception& ex) {
+      if (!failed_count++) {
+        first_error = std::current_exception();
+        first_error_message = ex.what();
+      }
+    };
+
+    if constexpr (std::is_void_v<ReplyType>) {
+      for (auto& request : requests_) {
+        try {
+          request->Get(request_description);
+        } catch (const std::exception& ex) {
+          on_error(ex);
+        }
+      }
+      ThrowOnErrors(request_description, failed_count, first_error,
+                    first_error_message);
+    } else {
+      ReplyType result(size_);
+      for (size_t i = 0; i < requests_.size(); ++i) {
+        try {
+          auto data = requests_[i]->Get(request_description);
+          const auto& positions = positions_[i];
+          if (data.size() != positions.size()) {
+            throw USERVER_NAMESPACE::redis::ParseReplyException(
+                "Unexpected reply size to '" + request_description +
+                "' request: expected " + std::to_string(positions.size()) +
+                ", got " + std::to_string(data.size()));
+          }
+          for (size_t j = 0; j < positions.size(); ++j) {
+            result[positions[j]] = std::move(data[j]);
+          }
+        } catch (const std::exception& ex) {
+          on_error(ex);
+        }
+      }
+      ThrowOnErrors(request_description, failed_count, first_error,
+                    first_error_message);
+      return result;
+    }
+  }
+
+  ReplyPtr GetRaw() override {
+    UASSERT_MSG(false, "Unsupported");
+    return {};
+  }
+
+  engine::impl::ContextAccessor* TryGetContextAccessor() noexcept override {
+    UASSERT_MSG(false, "Not implemented");
+    return nullptr;
+  }
+
+ private:
+  void ThrowOnErrors(const std::string& request_description,
+                     size_t failed_count, const std::exception_ptr& first_error,
+                     const std::string& first_error_message) const {
+    if (!failed_count) return;
+    // Keeps the original exception if the whole request failed
+    if (failed_count == requests_.size()) std::rethrow_exception(first_error);
+    throw USERVER_NAMESPACE::redis::PartialRequestFailedException(
+        request_description, failed_count, requests_.size(),
+        first_error_message);
+  }
+
+  std::vector<RequestDataPtr> requests_;
+  std::vector<std::vector<size_t>> positions_;
+  size_t size_;
+};
+
 template <typename Result, typename ReplyType>
 class DummyRequestDataImpl final : public RequestDataBase<ReplyType> {
  public:
@@ -1,6 +1,8 @@
 #pragma once
 
+#include <functional>
 #include <memory>
+#include <vector>
 
 #include <userver/storages/redis/request.hpp>
 
@@ -19,6 +21,26 @@ Request<Result, ReplyType> CreateRequest(
       std::make_unique<RequestDataImpl<Result, ReplyType>>(std::move(request)));
 }
 
+template <typename Result, typename ReplyType = Result>
+Request<Result, ReplyType> CreateNearCachedRequest(
+    USERVER_NAMESPACE::redis::Request&& request,
+    std::function<void(const ReplyData&)> on_reply,
+    Request<Result, ReplyType>* /* for ADL */) {
+  return Request<Result, ReplyType>(
+      std::make_unique<NearCachedRequestDataImpl<Result, ReplyType>>(
+          std::move(request), std::move(on_reply)));
+}
+
+template <typename Result, typename ReplyType = Result>
+Request<Result, ReplyType> CreateScriptRequest(
+    USERVER_NAMESPACE::redis::Request&& request,
+    std::function<USERVER_NAMESPACE::redis::Request()> make_eval,
+    Request<Result, ReplyType>* /* for ADL */) {
+  return Request<Result, ReplyType>(
+      std::make_unique<ScriptRequestDataImpl<Result, ReplyType>>(
+          std::move(request), std::move(make_eval)));
+}
+
 template <typename Result, typename ReplyType = Result>
 Request<Result, ReplyType> CreateAggregateRequest(
     std::vector<USERVER_NAMESPACE::redis::Request>&& requests,
@@ -34,6 +56,22 @@ Request<Result, ReplyType> CreateAggregateRequest(
           std::move(req_data)));
 }
 
+template <typename Result, typename ReplyType = Result>
+Request<Result, ReplyType> CreateSlotSplitRequest(
+    std::vector<USERVER_NAMESPACE::redis::Request>&& requests,
+    std::vector<std::vector<size_t>>&& positions, size_t size,
+    Request<Result, ReplyType>* /* for ADL */) {
+  std::vector<std::unique_ptr<RequestDataBase<ReplyType>>> req_data;
+  req_data.reserve(requests.size());
+  for (auto& request : requests) {
+    req_data.push_back(std::make_unique<RequestDataImpl<Result, ReplyType>>(
+        std::move(request)));
+  }
+  return Request<Result, ReplyType>(
+      std::make_unique<SlotSplitRequestDataImpl<Result, ReplyType>>(
+          std::move(req_data), std::move(positions), size));
+}
+
 template <typename Result, typename ReplyType = Result>
 Request<Result, ReplyType> CreateDummyRequest(
     ReplyPtr&& reply, Request<Result, ReplyType>* /* for ADL */) {
@@ -50,6 +88,26 @@ Request CreateRequest(USERVER_NAMESPACE::redis::Request&& request) {
   return impl::CreateRequest(std::move(request), tmp);
 }
 
+/// Sends the request made by `make_eval` if `request` fails with NOSCRIPT
+template <typename Request>
+Request CreateScriptRequest(
+    USERVER_NAMESPACE::redis::Request&& request,
+    std::function<USERVER_NAMESPACE::redis::Request()> make_eval) {
+  Request* tmp = nullptr;
+  return impl::CreateScriptRequest(std::move(request), std::move(make_eval),
+                                   tmp);
+}
+
+/// Calls `on_reply` with the successful reply data before parsing it
+template <typename Request>
+Request CreateNearCachedRequest(
+    USERVER_NAMESPACE::redis::Request&& request,
+    std::function<void(const ReplyData&)> on_reply) {
+  Request* tmp = nullptr;
+  return impl::CreateNearCachedRequest(std::move(request), std::move(on_reply),
+                                       tmp);
+}
+
 template <typename Request>
 Request CreateAggregateRequest(
     std::vector<USERVER_NAMESPACE::redis::Request>&& requests) {
@@ -57,6 +115,16 @@ Request CreateAggregateRequest(
   return impl::CreateAggregateRequest(std::move(requests), tmp);
 }
 
+/// Puts the replies of the per hash slot parts back in the order of the keys
+template <typename Request>
+Request CreateSlotSplitRequest(
+    std::vector<USERVER_NAMESPACE::redis::Request>&& requests,
+    std::vector<std::vector<size_t>>&& positions, size_t size) {
+  Request* tmp = nullptr;
+  return impl::CreateSlotSplitRequest(std::move(requests), std::move(positions),
+                                      size, tmp);
+}
+
 template <typename Request>
 Request CreateDummyRequest(ReplyPtr reply) {
   Request* tmp = nullptr;
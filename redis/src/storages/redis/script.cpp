@@ -0,0 +1,16 @@
+#include <userver/storages/redis/script.hpp>
+
+#include <userver/crypto/hash.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace storages::redis {
+
+Script::Script(std::string body) {
+  auto sha1 = crypto::hash::Sha1(body);
+  data_ = std::make_shared<const Data>(Data{std::move(body), std::move(sha1)});
+}
+
+}  // namespace storages::redis
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,221 @@
+#include <userver/storages/redis/stream_consumer.hpp>
+
+#include <algorithm>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include <userver/concurrent/background_task_storage.hpp>
+#include <userver/engine/semaphore.hpp>
+#include <userver/engine/sleep.hpp>
+#include <userver/engine/task/cancel.hpp>
+#include <userver/engine/task/task_with_result.hpp>
+#include <userver/logging/log.hpp>
+#include <userver/utils/assert.hpp>
+#include <userver/utils/async.hpp>
+
+#include <userver/storages/redis/client.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace storages::redis {
+namespace {
+
+/// Reads the entries delivered to this consumer before and not acked yet
+const std::string kPendingEntriesId = "0";
+/// Reads the entries never delivered to any consumer of the group
+const std::string kNewEntriesId = ">";
+const std::string kClaimStartId = "0-0";
+/// XREADGROUP reply may come that much later than its BLOCK timeout
+constexpr std::chrono::milliseconds kBlockedReadTimeoutMargin{1000};
+
+CommandControl MakeReadCommandControl(const StreamConsumerSettings& settings) {
+  CommandControl cc;
+  cc.timeout_single = settings.block_timeout + kBlockedReadTimeoutMargin;
+  cc.timeout_all = cc.timeout_single;
+  cc.max_retries = 1;
+  return cc;
+}
+
+}  // namespace
+
+class StreamConsumer::Impl final {
+ public:
+  Impl(ClientPtr client, StreamConsumerSettings settings,
+       engine::TaskProcessor& task_processor);
+
+  void Start(Callback callback);
+  void Stop() noexcept;
+
+ private:
+  void Run();
+  void CreateGroup();
+  std::vector<StreamEntry> ClaimBatch();
+  std::vector<StreamEntry> ReadBatch();
+  void ProcessBatch(const std::vector<StreamEntry>& entries) const;
+
+  const ClientPtr client_;
+  const StreamConsumerSettings settings_;
+  const CommandControl read_command_control_;
+  engine::TaskProcessor& task_processor_;
+  Callback callback_;
+
+  engine::Semaphore batches_in_flight_;
+  std::optional<concurrent::BackgroundTaskStorage> processing_tasks_;
+  engine::TaskWithResult<void> read_task_;
+
+  // Used by the read task only
+  bool group_created_{false};
+  std::string read_id_{kPendingEntriesId};
+  std::string claim_start_id_{kClaimStartId};
+  std::chrono::steady_clock::time_point next_claim_time_;
+};
+
+StreamConsumer::Impl::Impl(ClientPtr client, StreamConsumerSettings settings,
+                           engine::TaskProcessor& task_processor)
+    : client_(std::move(client)),
+      settings_(std::move(settings)),
+      read_command_control_(MakeReadCommandControl(settings_)),
+      task_processor_(task_processor),
+      batches_in_flight_(
+          std::max<size_t>(settings_.max_batches_in_flight, 1)) {
+  UINVARIANT(client_, "Redis client is required for the stream consumer");
+  UINVARIANT(settings_.batch_size > 0, "batch_size must be positive");
+}
+
+void StreamConsumer::Impl::Start(Callback callback) {
+  UINVARIANT(!read_task_.IsValid(), "Stream consumer already started");
+  callback_ = std::move(callback);
+  processing_tasks_.emplace(task_processor_);
+  read_task_ = utils::CriticalAsync(task_processor_,
+                                    "redis-stream-consumer-" + settings_.stream,
+                                    [this] { Run(); });
+}
+
+void StreamConsumer::Impl::Stop() noexcept {
+  if (!read_task_.IsValid()) return;
+
+  read_task_.SyncCancel();
+  read_task_ = {};
+  processing_tasks_->CancelAndWait();
+  processing_tasks_.reset();
+  LOG_INFO() << "Stopped consumer '" << settings_.consumer
+             << "' of redis stream '" << settings_.stream << "'";
+}
+
+void StreamConsumer::Impl::Run() {
+  while (!engine::current_task::ShouldCancel()) {
+    try {
+      if (!group_created_) CreateGroup();
+
+      auto entries = ClaimBatch();
+      if (entries.empty()) entries = ReadBatch();
+      if (entries.empty()) continue;
+
+      // Backpressure: do not read until a processing slot is free
+      engine::SemaphoreLock lock{batches_in_flight_};
+      processing_tasks_->AsyncDetach(
+          "redis-stream-batch-processing",
+          [this, lock = std::move(lock), entries = std::move(entries)] {
+            ProcessBatch(entries);
+          });
+    } catch (const std::exception& e) {
+      if (engine::current_task::ShouldCancel()) break;
+      LOG_ERROR() << "Failed to read redis stream '" << settings_.stream
+                  << "' for group '" << settings_.group << "': " << e;
+      engine::InterruptibleSleepFor(settings_.error_retry_delay);
+    }
+  }
+}
+
+void StreamConsumer::Impl::CreateGroup() {
+  const auto reply = client_
+                         ->XgroupCreate(settings_.stream, settings_.group,
+                                        "$", read_command_control_)
+                         .Get();
+  if (reply == XgroupCreateReply::kCreated) {
+    LOG_INFO() << "Created consumer group '" << settings_.group
+               << "' of redis stream '" << settings_.stream << "'";
+  }
+  group_created_ = true;
+}
+
+std::vector<StreamEntry> StreamConsumer::Impl::ClaimBatch() {
+  if (settings_.claim_interval.count() <= 0) return {};
+  const auto now = std::chrono::steady_clock::now();
+  if (now < next_claim_time_) return {};
+
+  auto reply = client_
+                   ->Xautoclaim(settings_.stream, settings_.group,
+                                settings_.consumer,
+                                settings_.claim_min_idle_time, claim_start_id_,
+                                settings_.batch_size, read_command_control_)
+                   .Get();
+  claim_start_id_ = std::move(reply.next_start_id);
+  // Keep claiming on the next iterations until the whole pending entries
+  // list is scanned
+  if (claim_start_id_ == kClaimStartId) {
+    next_claim_time_ = now + settings_.claim_interval;
+  }
+  return std::move(reply.entries);
+}
+
+std::vector<StreamEntry> StreamConsumer::Impl::ReadBatch() {
+  const bool read_pending = read_id_ != kNewEntriesId;
+
+  XreadgroupOptions options;
+  options.count = settings_.batch_size;
+  if (!read_pending) options.block = settings_.block_timeout;
+
+  auto entries = client_
+                     ->Xreadgroup(settings_.stream, settings_.group,
+                                  settings_.consumer, read_id_, options,
+                                  read_command_control_)
+                     .Get();
+  if (read_pending) {
+    read_id_ = entries.size() < settings_.batch_size ? kNewEntriesId
+                                                     : entries.back().id;
+  }
+  return entries;
+}
+
+void StreamConsumer::Impl::ProcessBatch(
+    const std::vector<StreamEntry>& entries) const {
+  try {
+    callback_(entries);
+  } catch (const std::exception& e) {
+    LOG_ERROR() << "Processing of " << entries.size()
+                << " entries of redis stream '" << settings_.stream
+                << "' failed, they are left pending: " << e;
+    return;
+  }
+
+  std::vector<std::string> ids;
+  ids.reserve(entries.size());
+  for (const auto& entry : entries) ids.push_back(entry.id);
+  try {
+    client_->Xack(settings_.stream, settings_.group, std::move(ids), {}).Get();
+  } catch (const std::exception& e) {
+    LOG_WARNING() << "Failed to ack " << entries.size()
+                  << " entries of redis stream '" << settings_.stream
+                  << "', they are left pending: " << e;
+  }
+}
+
+StreamConsumer::StreamConsumer(ClientPtr client,
+                               StreamConsumerSettings settings,
+                               engine::TaskProcessor& task_processor)
+    : impl_(std::make_unique<Impl>(std::move(client), std::move(settings),
+                                   task_processor)) {}
+
+StreamConsumer::~StreamConsumer() { Stop(); }
+
+void StreamConsumer::Start(Callback callback) {
+  impl_->Start(std::move(callback));
+}
+
+void StreamConsumer::Stop() noexcept { impl_->Stop(); }
+
+}  // namespace storages::redis
+
+USERVER_NAMESPACE_END
@@ -33,6 +33,11 @@ bool SubscriptionQueue<Item>::PopMessage(Item& msg_ptr) {
   return consumer_.Pop(msg_ptr);
 }
 
+template <typename Item>
+bool SubscriptionQueue<Item>::PopMessageNoblock(Item& msg_ptr) {
+  return consumer_.PopNoblock(msg_ptr);
+}
+
 template <typename Item>
 void SubscriptionQueue<Item>::Unsubscribe() {
   token_->Unsubscribe();
@@ -48,13 +53,13 @@ SubscriptionQueue<Item>::GetSubscriptionToken(
     const USERVER_NAMESPACE::redis::CommandControl& command_control) {
   return subscribe_sentinel.Subscribe(
       channel,
-      [this](const std::string& channel, const std::string& message) {
+      [this](const std::string& channel, const SharedMessage& message) {
         Outcome result{Outcome::kOk};
         if (!producer_.PushNoblock(Item(message))) {
           // Use SubscriptionQueue::SetMaxLength() or
           // SubscriptionToken::SetMaxQueueLength() if limit is too low
           LOG_ERROR()
-              << "failed to push message '" << message << "' from channel '"
+              << "failed to push message '" << *message << "' from channel '"
               << channel
               << "' into subscription queue due to overflow (max length="
               << queue_->GetSoftMaxSize() << ')';
@@ -78,13 +83,13 @@ SubscriptionQueue<Item>::GetSubscriptionToken(
   return subscribe_sentinel.Psubscribe(
       pattern,
       [this](const std::string& pattern, const std::string& channel,
-             const std::string& message) {
+             const SharedMessage& message) {
         Outcome result{Outcome::kOk};
         if (!producer_.PushNoblock(Item(channel, message))) {
           // Use SubscriptionQueue::SetMaxLength() or
           // SubscriptionToken::SetMaxQueueLength() if limit is too low
           LOG_ERROR()
-              << "failed to push pmessage '" << message << "' from channel '"
+              << "failed to push pmessage '" << *message << "' from channel '"
               << channel << "' from pattern '" << pattern
               << "' into subscription queue due to overflow (max length="
               << queue_->GetSoftMaxSize() << ')';
@@ -107,13 +112,13 @@ SubscriptionQueue<Item>::GetSubscriptionToken(
     const USERVER_NAMESPACE::redis::CommandControl& command_control) {
   return subscribe_sentinel.Ssubscribe(
       channel,
-      [this](const std::string& channel, const std::string& message) {
+      [this](const std::string& channel, const SharedMessage& message) {
         Outcome result{Outcome::kOk};
         if (!producer_.PushNoblock(Item(message))) {
           // Use SubscriptionQueue::SetMaxLength() or
           // SubscriptionToken::SetMaxQueueLength() if limit is too low
           LOG_ERROR()
-              << "failed to push message '" << message << "' from channel '"
+              << "failed to push message '" << *message << "' from channel '"
               << channel
               << "' into subscription queue due to overflow (max length="
               << queue_->GetSoftMaxSize() << ')';
@@ -10,28 +10,31 @@ USERVER_NAMESPACE_BEGIN
 
 namespace storages::redis {
 
+// Messages are shared by the queues of all the subscribers of a channel
+using SharedMessage = USERVER_NAMESPACE::redis::Sentinel::SharedMessage;
+
 struct ChannelSubscriptionQueueItem {
-  std::string message;
+  SharedMessage message;
 
   ChannelSubscriptionQueueItem() = default;
-  explicit ChannelSubscriptionQueueItem(std::string message)
+  explicit ChannelSubscriptionQueueItem(SharedMessage message)
       : message(std::move(message)) {}
 };
 
 struct PatternSubscriptionQueueItem {
   std::string channel;
-  std::string message;
+  SharedMessage message;
 
   PatternSubscriptionQueueItem() = default;
-  PatternSubscriptionQueueItem(std::string channel, std::string message)
+  PatternSubscriptionQueueItem(std::string channel, SharedMessage message)
       : channel(std::move(channel)), message(std::move(message)) {}
 };
 
 struct ShardedSubscriptionQueueItem {
-  std::string message;
+  SharedMessage message;
 
   ShardedSubscriptionQueueItem() = default;
-  explicit ShardedSubscriptionQueueItem(std::string message)
+  explicit ShardedSubscriptionQueueItem(SharedMessage message)
       : message(std::move(message)) {}
 };
 
@@ -51,6 +54,9 @@ class SubscriptionQueue {
 
   bool PopMessage(Item& msg_ptr);
 
+  /// Pops a message if the queue is not empty
+  bool PopMessageNoblock(Item& msg_ptr);
+
   void Unsubscribe();
 
  private:
@@ -1,5 +1,6 @@
 #include "subscription_token_impl.hpp"
 
+#include <cstddef>
 #include <stdexcept>
 
 #include <userver/engine/task/task_with_result.hpp>
@@ -14,6 +15,25 @@ namespace {
 constexpr std::string_view kProcessRedisSubscriptionMessage =
     "process redis subscription message";
 
+// Limits the number of messages processed under one span
+constexpr std::size_t kMaxMessagesPerWakeup = 64;
+
+/// Processes the messages queued by the time the subscriber task wakes up in
+/// one go, without switching back to the scheduler for each one
+template <typename Item, typename Handler>
+void ProcessMessageBatches(SubscriptionQueue<Item>& queue,
+                           const Handler& handler) {
+  Item msg;
+  while (queue.PopMessage(msg)) {
+    tracing::Span span(std::string{kProcessRedisSubscriptionMessage});
+    std::size_t processed = 0;
+    do {
+      handler(msg);
+    } while (++processed < kMaxMessagesPerWakeup &&
+             queue.PopMessageNoblock(msg));
+  }
+}
+
 }  // namespace
 
 SubscriptionTokenImpl::SubscriptionTokenImpl(
@@ -39,11 +59,9 @@ void SubscriptionTokenImpl::Unsubscribe() {
 }
 
 void SubscriptionTokenImpl::ProcessMessages() {
-  ChannelSubscriptionQueueItem msg;
-  while (queue_.PopMessage(msg)) {
-    tracing::Span span(std::string{kProcessRedisSubscriptionMessage});
-    if (on_message_cb_) on_message_cb_(channel_, msg.message);
-  }
+  ProcessMessageBatches(queue_, [this](const ChannelSubscriptionQueueItem& msg) {
+    if (on_message_cb_) on_message_cb_(channel_, *msg.message);
+  });
 }
 
 PsubscriptionTokenImpl::PsubscriptionTokenImpl(
@@ -69,11 +87,11 @@ void PsubscriptionTokenImpl::Unsubscribe() {
 }
 
 void PsubscriptionTokenImpl::ProcessMessages() {
-  PatternSubscriptionQueueItem msg;
-  while (queue_.PopMessage(msg)) {
-    tracing::Span span(std::string{kProcessRedisSubscriptionMessage});
-    if (on_pmessage_cb_) on_pmessage_cb_(pattern_, msg.channel, msg.message);
-  }
+  ProcessMessageBatches(queue_, [this](const PatternSubscriptionQueueItem& msg) {
+    if (on_pmessage_cb_) {
+      on_pmessage_cb_(pattern_, msg.channel, *msg.message);
+    }
+  });
 }
 
 SsubscriptionTokenImpl::SsubscriptionTokenImpl(
@@ -99,11 +117,9 @@ void SsubscriptionTokenImpl::Unsubscribe() {
 }
 
 void SsubscriptionTokenImpl::ProcessMessages() {
-  ShardedSubscriptionQueueItem msg;
-  while (queue_.PopMessage(msg)) {
-    tracing::Span span(std::string{kProcessRedisSubscriptionMessage});
-    if (on_message_cb_) on_message_cb_(channel_, msg.message);
-  }
+  ProcessMessageBatches(queue_, [this](const ShardedSubscriptionQueueItem& msg) {
+    if (on_message_cb_) on_message_cb_(channel_, *msg.message);
+  });
 }
 
 }  // namespace storages::redis
@@ -357,6 +357,35 @@ class GMockClient : public MockClientBase {
               (std::string key, const CommandControl& command_control),
               (override));
 
+  MOCK_METHOD(RequestXack, Xack,
+              (std::string key, std::string group,
+               std::vector<std::string> ids,
+               const CommandControl& command_control),
+              (override));
+
+  MOCK_METHOD(RequestXadd, Xadd,
+              (std::string key,
+               (std::vector<std::pair<std::string, std::string>>)field_values,
+               const CommandControl& command_control),
+              (override));
+
+  MOCK_METHOD(RequestXautoclaim, Xautoclaim,
+              (std::string key, std::string group, std::string consumer,
+               std::chrono::milliseconds min_idle_time, std::string start,
+               size_t count, const CommandControl& command_control),
+              (override));
+
+  MOCK_METHOD(RequestXgroupCreate, XgroupCreate,
+              (std::string key, std::string group, std::string id,
+               const CommandControl& command_control),
+              (override));
+
+  MOCK_METHOD(RequestXreadgroup, Xreadgroup,
+              (std::string key, std::string group, std::string consumer,
+               std::string id, const XreadgroupOptions& options,
+               const CommandControl& command_control),
+              (override));
+
   MOCK_METHOD(RequestZadd, Zadd,
               (std::string key, double score, std::string member,
                const CommandControl& command_control),
@@ -463,6 +492,12 @@ class GMockClient : public MockClientBase {
                const CommandControl& command_control),
               (override));
 
+  MOCK_METHOD(RequestEvalCommon, EvalScriptCommon,
+              (const Script& script, std::vector<std::string> keys,
+               std::vector<std::string> args,
+               const CommandControl& command_control),
+              (override));
+
   MOCK_METHOD(RequestGeosearch, Geosearch,
               (std::string key, std::string member, double radius,
                const GeosearchOptions& geosearch_options,
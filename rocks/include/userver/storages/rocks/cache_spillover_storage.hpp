@@ -0,0 +1,86 @@
+#pragma once
+
+/// @file userver/storages/rocks/cache_spillover_storage.hpp
+/// @brief @copybrief storages::rocks::CacheSpilloverStorage
+
+#include <cstddef>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <userver/cache/spillover_storage.hpp>
+#include <userver/components/component_fwd.hpp>
+#include <userver/storages/rocks/client_fwd.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace storages::rocks {
+
+// clang-format off
+
+/// @ingroup userver_components
+///
+/// @brief cache::SpilloverStorageBase that stores the entries evicted from
+/// the LRU caches in a local RocksDB database, making a two-tier cache:
+/// the in-memory cache::LruCacheComponent and the larger on-disk storage.
+///
+/// The database survives the restarts of the service, so the non-expired
+/// entries are loaded from it after a restart.
+///
+/// ## Static options:
+/// All the options of cache::SpilloverStorageBase and
+/// Name | Description | Default value
+/// ---- | ----------- | -------------
+/// rocks | name of the storages::rocks::Component with the database | -
+/// column-family | column family of the records, must be opened by the storages::rocks::Component | default
+///
+/// ## Static configuration example:
+///
+/// ```
+///    # yaml
+///    cache-rocks:
+///        task-processor: fs-task-processor
+///        db-path: /var/cache/hello_service/lru
+///    rocks-cache-spillover-storage:
+///        rocks: cache-rocks
+///    some-lru-cache:
+///        size: 10000
+///        ways: 8
+///        lifetime: 1h
+///        spillover-storage: rocks-cache-spillover-storage
+/// ```
+
+// clang-format on
+class CacheSpilloverStorage final : public cache::SpilloverStorageBase {
+ public:
+  /// @ingroup userver_component_names
+  /// @brief The default name of storages::rocks::CacheSpilloverStorage
+  static constexpr std::string_view kName = "rocks-cache-spillover-storage";
+
+  CacheSpilloverStorage(const components::ComponentConfig& config,
+                        const components::ComponentContext& context);
+
+  ~CacheSpilloverStorage() override;
+
+  static yaml_config::Schema GetStaticConfigSchema();
+
+ private:
+  void DoWrite(std::vector<Record> records) override;
+
+  std::optional<std::string> DoRead(std::string_view key) override;
+
+  std::vector<KeyValue> DoScan(std::string_view begin,
+                               std::size_t limit) override;
+
+  ClientPtr client_;
+  const std::string column_family_;
+};
+
+}  // namespace storages::rocks
+
+template <>
+inline constexpr bool
+    components::kHasValidate<storages::rocks::CacheSpilloverStorage> = true;
+
+USERVER_NAMESPACE_END
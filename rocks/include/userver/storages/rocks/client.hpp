@@ -3,23 +3,64 @@
 /// @file userver/storages/rocks/client.hpp
 /// @brief @copybrief storages::rocks::Client
 
+#include <cstddef>
+#include <functional>
+#include <map>
+#include <memory>
+#include <optional>
 #include <string>
 #include <string_view>
+#include <utility>
+#include <vector>
 
 #include <rocksdb/db.h>
 
 #include <userver/engine/task/task_processor_fwd.hpp>
+#include <userver/storages/rocks/client_fwd.hpp>
+#include <userver/storages/rocks/write_batch.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
 namespace storages::rocks {
 
+/// Compression of the database blocks
+enum class Compression {
+  kNone,
+  kSnappy,
+  kLz4,
+  kZstd,
+};
+
+/// Settings of the database, the same for all the column families
+struct ClientSettings final {
+  /// Size of the LRU cache of uncompressed blocks, zero for the RocksDB
+  /// default
+  std::size_t block_cache_size{0};
+  /// Compression of the blocks
+  Compression compression{Compression::kSnappy};
+  /// Bits per key of the bloom filter, zero to disable the filter
+  int bloom_filter_bits_per_key{10};
+  /// Length of the key prefix to build prefix bloom filters on, zero to
+  /// disable. Required for the fast Client::GetByPrefix
+  std::size_t prefix_length{0};
+  /// Column families to open, created if missing. Column families already
+  /// present in the database are opened anyway
+  std::vector<std::string> column_families;
+};
+
+/// A key and a value of a record
+using KeyValue = std::pair<std::string, std::string>;
+
 /**
  * @brief Client for working with RocksDB storage.
  *
  * This class provides an interface for interacting with the RocksDB database.
  * To use the class, you need to specify the database path when creating an
  * object.
+ *
+ * Each method makes a single hop to the blocking task processor, so batch
+ * operations (Write, MultiGet, GetRange) should be preferred to a series of
+ * single-key ones.
  */
 class Client final {
  public:
@@ -33,27 +74,95 @@ class Client final {
   Client(const std::string& db_path,
          engine::TaskProcessor& blocking_task_processor);
 
+  /**
+   * @brief Constructor of the Client class.
+   *
+   * @param db_path The path to the RocksDB database.
+   * @param settings The database options.
+   * @param blocking_task_processor - task processor to execute blocking FS
+   * operations
+   */
+  Client(const std::string& db_path, const ClientSettings& settings,
+         engine::TaskProcessor& blocking_task_processor);
+
+  ~Client();
+
   /**
    * @brief Puts a record into the database.
    *
    * @param key The key of the record.
    * @param value The value of the record.
+   * @param column_family The column family of the record.
    */
-  void Put(std::string_view key, std::string_view value);
+  void Put(std::string_view key, std::string_view value,
+           std::string_view column_family = kDefaultColumnFamily);
 
   /**
    * @brief Retrieves the value of a record from the database by key.
    *
    * @param key The key of the record.
+   * @param column_family The column family of the record.
    */
-  std::string Get(std::string_view key);
+  std::string Get(std::string_view key,
+                  std::string_view column_family = kDefaultColumnFamily);
 
   /**
    * @brief Deletes a record from the database by key.
    *
    * @param key The key of the record to be deleted.
+   * @param column_family The column family of the record.
    */
-  void Delete(std::string_view key);
+  void Delete(std::string_view key,
+              std::string_view column_family = kDefaultColumnFamily);
+
+  /**
+   * @brief Creates an empty batch of updates for Write.
+   */
+  WriteBatch MakeWriteBatch() const;
+
+  /**
+   * @brief Applies all the updates of the batch atomically.
+   *
+   * @param batch The updates to apply.
+   */
+  void Write(WriteBatch&& batch);
+
+  /**
+   * @brief Retrieves the values of several records at once.
+   *
+   * @param keys The keys of the records.
+   * @param column_family The column family of the records.
+   * @returns values in the order of keys, std::nullopt for missing records.
+   */
+  std::vector<std::optional<std::string>> MultiGet(
+      const std::vector<std::string_view>& keys,
+      std::string_view column_family = kDefaultColumnFamily);
+
+  /**
+   * @brief Retrieves the records with keys in [begin, end) in key order.
+   *
+   * @param begin The first key of the range.
+   * @param end The key after the range, empty for the range without an end.
+   * @param limit Maximum number of records to return.
+   * @param column_family The column family of the records.
+   */
+  std::vector<KeyValue> GetRange(
+      std::string_view begin, std::string_view end, std::size_t limit,
+      std::string_view column_family = kDefaultColumnFamily);
+
+  /**
+   * @brief Retrieves the records with keys starting with prefix in key order.
+   *
+   * Uses the prefix bloom filters if the prefix length is equal to
+   * ClientSettings::prefix_length.
+   *
+   * @param prefix The prefix of the keys.
+   * @param limit Maximum number of records to return.
+   * @param column_family The column family of the records.
+   */
+  std::vector<KeyValue> GetByPrefix(
+      std::string_view prefix, std::size_t limit,
+      std::string_view column_family = kDefaultColumnFamily);
 
   /**
    * Checks the status of an operation and handles any errors based on the given
@@ -65,7 +174,18 @@ class Client final {
   void CheckStatus(rocksdb::Status status, std::string_view method_name);
 
  private:
+  friend class WriteBatch;
+
+  rocksdb::ColumnFamilyHandle* GetColumnFamily(std::string_view name) const;
+
+  std::vector<KeyValue> Scan(rocksdb::ColumnFamilyHandle* column_family,
+                             const rocksdb::ReadOptions& read_options,
+                             std::string_view start, std::string_view prefix,
+                             std::size_t limit, std::string_view method_name);
+
   std::unique_ptr<rocksdb::DB> db_;
+  std::map<std::string, rocksdb::ColumnFamilyHandle*, std::less<>>
+      column_families_;
   engine::TaskProcessor& blocking_task_processor_;
 };
 }  // namespace storages::rocks
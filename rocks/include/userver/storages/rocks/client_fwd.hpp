@@ -1,6 +1,7 @@
 #pragma once
 
 #include <memory>
+#include <string_view>
 
 USERVER_NAMESPACE_BEGIN
 
@@ -9,6 +10,9 @@ namespace storages::rocks {
 class Client;
 using ClientPtr = std::shared_ptr<Client>;
 
+/// Name of the column family that always exists in a database
+inline constexpr std::string_view kDefaultColumnFamily = "default";
+
 }  // namespace storages::rocks
 
 USERVER_NAMESPACE_END
@@ -23,6 +23,11 @@ namespace storages::rocks {
 /// ---------------------------------- | ------------------------------------------------ | ---------------
 /// task-processor                     | name of the task processor to run the blocking file operations | -
 /// db-path                            | path to database file                            | -
+/// block-cache-size                   | size of the LRU cache of uncompressed blocks in bytes, 0 for the RocksDB default | 0
+/// compression                        | compression of the blocks: none, snappy, lz4 or zstd | snappy
+/// bloom-filter-bits-per-key          | bits per key of the bloom filter, 0 to disable the filter | 10
+/// prefix-length                      | length of the key prefix for the prefix bloom filters, 0 to disable | 0
+/// column-families                    | column families to open, created if missing      | []
 
 // clang-format on
 
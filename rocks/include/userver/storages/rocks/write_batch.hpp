@@ -0,0 +1,58 @@
+#pragma once
+
+/// @file userver/storages/rocks/write_batch.hpp
+/// @brief @copybrief storages::rocks::WriteBatch
+
+#include <cstddef>
+#include <string_view>
+
+#include <rocksdb/write_batch.h>
+
+#include <userver/storages/rocks/client_fwd.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace storages::rocks {
+
+/**
+ * @brief A set of updates applied atomically by Client::Write.
+ *
+ * Is created by Client::MakeWriteBatch and must not outlive the client.
+ * Building the batch does not touch the database.
+ */
+class WriteBatch final {
+ public:
+  /**
+   * @brief Adds a record to put into the database.
+   *
+   * @param key The key of the record.
+   * @param value The value of the record.
+   * @param column_family The column family of the record.
+   */
+  void Put(std::string_view key, std::string_view value,
+           std::string_view column_family = kDefaultColumnFamily);
+
+  /**
+   * @brief Adds a record to delete from the database.
+   *
+   * @param key The key of the record to be deleted.
+   * @param column_family The column family of the record.
+   */
+  void Delete(std::string_view key,
+              std::string_view column_family = kDefaultColumnFamily);
+
+  /// @brief Returns the number of updates in the batch.
+  std::size_t Size() const;
+
+ private:
+  friend class Client;
+
+  explicit WriteBatch(const Client& client);
+
+  const Client* client_;
+  rocksdb::WriteBatch batch_;
+};
+
+}  // namespace storages::rocks
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,68 @@
+#include <userver/storages/rocks/cache_spillover_storage.hpp>
+
+#include <userver/components/component.hpp>
+#include <userver/yaml_config/merge_schemas.hpp>
+
+#include <userver/storages/rocks/client.hpp>
+#include <userver/storages/rocks/component.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace storages::rocks {
+
+CacheSpilloverStorage::CacheSpilloverStorage(
+    const components::ComponentConfig& config,
+    const components::ComponentContext& context)
+    : SpilloverStorageBase(config, context),
+      client_(context
+                  .FindComponent<storages::rocks::Component>(
+                      config["rocks"].As<std::string>())
+                  .MakeClient()),
+      column_family_(config["column-family"].As<std::string>(
+          std::string{kDefaultColumnFamily})) {}
+
+CacheSpilloverStorage::~CacheSpilloverStorage() = default;
+
+yaml_config::Schema CacheSpilloverStorage::GetStaticConfigSchema() {
+  return yaml_config::MergeSchemas<cache::SpilloverStorageBase>(R"(
+type: object
+description: Storage of the entries evicted from LRU caches in RocksDB
+additionalProperties: false
+properties:
+    rocks:
+        type: string
+        description: name of the storages::rocks::Component with the database
+    column-family:
+        type: string
+        description: column family of the records
+        defaultDescription: default
+)");
+}
+
+void CacheSpilloverStorage::DoWrite(std::vector<Record> records) {
+  auto batch = client_->MakeWriteBatch();
+  for (const auto& record : records) {
+    if (record.value) {
+      batch.Put(record.key, *record.value, column_family_);
+    } else {
+      batch.Delete(record.key, column_family_);
+    }
+  }
+  client_->Write(std::move(batch));
+}
+
+std::optional<std::string> CacheSpilloverStorage::DoRead(
+    std::string_view key) {
+  // Unlike Get, distinguishes the missing records from the empty ones
+  auto values = client_->MultiGet({key}, column_family_);
+  return std::move(values.at(0));
+}
+
+std::vector<CacheSpilloverStorage::KeyValue> CacheSpilloverStorage::DoScan(
+    std::string_view begin, std::size_t limit) {
+  return client_->GetRange(begin, {}, limit, column_family_);
+}
+
+}  // namespace storages::rocks
+
+USERVER_NAMESPACE_END
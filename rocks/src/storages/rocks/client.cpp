@@ -1,61 +1,260 @@
 #include <userver/storages/rocks/client.hpp>
 
+#include <algorithm>
+
 #include <fmt/format.h>
+#include <rocksdb/cache.h>
+#include <rocksdb/filter_policy.h>
+#include <rocksdb/slice_transform.h>
+#include <rocksdb/table.h>
 
 #include <userver/storages/rocks/exception.hpp>
+#include <userver/utils/assert.hpp>
 #include <userver/utils/async.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
 namespace storages::rocks {
 
+namespace {
+
+rocksdb::CompressionType ToNative(Compression compression) {
+  switch (compression) {
+    case Compression::kNone:
+      return rocksdb::kNoCompression;
+    case Compression::kSnappy:
+      return rocksdb::kSnappyCompression;
+    case Compression::kLz4:
+      return rocksdb::kLZ4Compression;
+    case Compression::kZstd:
+      return rocksdb::kZSTD;
+  }
+  UINVARIANT(false, "Unexpected compression value");
+}
+
+// The block cache is shared by all the column families
+rocksdb::ColumnFamilyOptions MakeColumnFamilyOptions(
+    const ClientSettings& settings) {
+  rocksdb::ColumnFamilyOptions options;
+  options.compression = ToNative(settings.compression);
+
+  rocksdb::BlockBasedTableOptions table_options;
+  if (settings.block_cache_size > 0) {
+    table_options.block_cache = rocksdb::NewLRUCache(settings.block_cache_size);
+  }
+  if (settings.bloom_filter_bits_per_key > 0) {
+    table_options.filter_policy.reset(
+        rocksdb::NewBloomFilterPolicy(settings.bloom_filter_bits_per_key));
+  }
+  if (settings.prefix_length > 0) {
+    options.prefix_extractor.reset(
+        rocksdb::NewFixedPrefixTransform(settings.prefix_length));
+  }
+  options.table_factory.reset(
+      rocksdb::NewBlockBasedTableFactory(table_options));
+  return options;
+}
+
+std::vector<std::string> GetColumnFamilyNames(const std::string& db_path,
+                                              const ClientSettings& settings) {
+  std::vector<std::string> names;
+  // Fails if the database does not exist yet
+  if (!rocksdb::DB::ListColumnFamilies(rocksdb::DBOptions{}, db_path, &names)
+           .ok()) {
+    names.clear();
+  }
+
+  const auto add_name = [&names](const std::string& name) {
+    if (std::find(names.begin(), names.end(), name) == names.end()) {
+      names.push_back(name);
+    }
+  };
+  add_name(rocksdb::kDefaultColumnFamilyName);
+  for (const auto& name : settings.column_families) add_name(name);
+  return names;
+}
+
+}  // namespace
+
 Client::Client(const std::string& db_path,
                engine::TaskProcessor& blocking_task_processor)
+    : Client(db_path, ClientSettings{}, blocking_task_processor) {}
+
+Client::Client(const std::string& db_path, const ClientSettings& settings,
+               engine::TaskProcessor& blocking_task_processor)
     : blocking_task_processor_(blocking_task_processor) {
-  rocksdb::Options options;
+  rocksdb::DBOptions options;
   options.create_if_missing = true;
+  options.create_missing_column_families = true;
 
+  const auto column_family_options = MakeColumnFamilyOptions(settings);
+  const auto names = GetColumnFamilyNames(db_path, settings);
+  std::vector<rocksdb::ColumnFamilyDescriptor> descriptors;
+  descriptors.reserve(names.size());
+  for (const auto& name : names) {
+    descriptors.emplace_back(name, column_family_options);
+  }
+
+  std::vector<rocksdb::ColumnFamilyHandle*> handles;
   rocksdb::DB* db{};
-  rocksdb::Status status = rocksdb::DB::Open(options, db_path, &db);
+  rocksdb::Status status =
+      rocksdb::DB::Open(options, db_path, descriptors, &handles, &db);
   db_.reset(db);
   CheckStatus(status, "Create client");
+
+  for (std::size_t i = 0; i < handles.size(); ++i) {
+    column_families_.emplace(names[i], handles[i]);
+  }
+}
+
+Client::~Client() {
+  for (const auto& [name, handle] : column_families_) {
+    db_->DestroyColumnFamilyHandle(handle);
+  }
 }
 
-void Client::Put(std::string_view key, std::string_view value) {
-  engine::AsyncNoSpan(blocking_task_processor_, [this, key, value] {
-    rocksdb::Status status = db_->Put(rocksdb::WriteOptions(), key, value);
+void Client::Put(std::string_view key, std::string_view value,
+                 std::string_view column_family) {
+  auto* handle = GetColumnFamily(column_family);
+  engine::AsyncNoSpan(blocking_task_processor_, [this, handle, key, value] {
+    rocksdb::Status status =
+        db_->Put(rocksdb::WriteOptions(), handle, key, value);
     CheckStatus(status, "Put");
   }).Get();
 }
 
-std::string Client::Get(std::string_view key) {
+std::string Client::Get(std::string_view key, std::string_view column_family) {
+  auto* handle = GetColumnFamily(column_family);
   return engine::AsyncNoSpan(blocking_task_processor_,
-                             [this, key] {
+                             [this, handle, key] {
                                std::string res;
-                               rocksdb::Status status =
-                                   db_->Get(rocksdb::ReadOptions(), key, &res);
+                               rocksdb::Status status = db_->Get(
+                                   rocksdb::ReadOptions(), handle, key, &res);
                                CheckStatus(status, "Get");
                                return res;
                              })
       .Get();
 }
 
-void Client::Delete(std::string_view key) {
+void Client::Delete(std::string_view key, std::string_view column_family) {
+  auto* handle = GetColumnFamily(column_family);
   return engine::AsyncNoSpan(blocking_task_processor_,
-                             [this, key] {
-                               rocksdb::Status status =
-                                   db_->Delete(rocksdb::WriteOptions(), key);
+                             [this, handle, key] {
+                               rocksdb::Status status = db_->Delete(
+                                   rocksdb::WriteOptions(), handle, key);
                                CheckStatus(status, "Delete");
                              })
       .Get();
 }
 
+WriteBatch Client::MakeWriteBatch() const { return WriteBatch{*this}; }
+
+void Client::Write(WriteBatch&& batch) {
+  UINVARIANT(batch.client_ == this, "WriteBatch belongs to another client");
+  engine::AsyncNoSpan(blocking_task_processor_, [this, &batch] {
+    rocksdb::Status status = db_->Write(rocksdb::WriteOptions(), &batch.batch_);
+    CheckStatus(status, "Write");
+  }).Get();
+}
+
+std::vector<std::optional<std::string>> Client::MultiGet(
+    const std::vector<std::string_view>& keys,
+    std::string_view column_family) {
+  auto* handle = GetColumnFamily(column_family);
+  return engine::AsyncNoSpan(
+             blocking_task_processor_,
+             [this, handle, &keys] {
+               const std::vector<rocksdb::Slice> slices(keys.begin(),
+                                                        keys.end());
+               std::vector<rocksdb::PinnableSlice> values(keys.size());
+               std::vector<rocksdb::Status> statuses(keys.size());
+               db_->MultiGet(rocksdb::ReadOptions(), handle, keys.size(),
+                             slices.data(), values.data(), statuses.data());
+
+               std::vector<std::optional<std::string>> res;
+               res.reserve(keys.size());
+               for (std::size_t i = 0; i < keys.size(); ++i) {
+                 if (statuses[i].IsNotFound()) {
+                   res.emplace_back();
+                   continue;
+                 }
+                 CheckStatus(statuses[i], "MultiGet");
+                 res.emplace_back(values[i].ToString());
+               }
+               return res;
+             })
+      .Get();
+}
+
+std::vector<KeyValue> Client::GetRange(std::string_view begin,
+                                       std::string_view end, std::size_t limit,
+                                       std::string_view column_family) {
+  const rocksdb::Slice upper_bound{end};
+  rocksdb::ReadOptions read_options;
+  if (!end.empty()) read_options.iterate_upper_bound = &upper_bound;
+  // The range may span several prefixes
+  read_options.total_order_seek = true;
+  return Scan(GetColumnFamily(column_family), read_options, begin, {}, limit,
+              "GetRange");
+}
+
+std::vector<KeyValue> Client::GetByPrefix(std::string_view prefix,
+                                          std::size_t limit,
+                                          std::string_view column_family) {
+  auto* handle = GetColumnFamily(column_family);
+  const auto* prefix_extractor =
+      db_->GetOptions(handle).prefix_extractor.get();
+
+  rocksdb::ReadOptions read_options;
+  if (prefix_extractor && prefix_extractor->InDomain(prefix) &&
+      prefix_extractor->Transform(prefix).size() == prefix.size()) {
+    read_options.prefix_same_as_start = true;
+  } else {
+    read_options.total_order_seek = true;
+  }
+  return Scan(handle, read_options, prefix, prefix, limit, "GetByPrefix");
+}
+
 void Client::CheckStatus(rocksdb::Status status, std::string_view method_name) {
   if (!status.ok() && !status.IsNotFound()) {
     throw USERVER_NAMESPACE::storages::rocks::RequestFailedException(
         method_name, status.ToString());
   }
 }
+
+rocksdb::ColumnFamilyHandle* Client::GetColumnFamily(
+    std::string_view name) const {
+  const auto it = column_families_.find(name);
+  if (it == column_families_.end()) {
+    throw Exception(fmt::format("Unknown column family '{}'", name));
+  }
+  return it->second;
+}
+
+std::vector<KeyValue> Client::Scan(rocksdb::ColumnFamilyHandle* column_family,
+                                   const rocksdb::ReadOptions& read_options,
+                                   std::string_view start,
+                                   std::string_view prefix, std::size_t limit,
+                                   std::string_view method_name) {
+  return engine::AsyncNoSpan(
+             blocking_task_processor_,
+             [&] {
+               std::vector<KeyValue> res;
+               const std::unique_ptr<rocksdb::Iterator> it{
+                   db_->NewIterator(read_options, column_family)};
+               for (it->Seek(start);
+                    it->Valid() && res.size() < limit &&
+                    it->key().starts_with(prefix);
+                    it->Next()) {
+                 res.emplace_back(it->key().ToString(),
+                                  it->value().ToString());
+               }
+               CheckStatus(it->status(), method_name);
+               return res;
+             })
+      .Get();
+}
+
 }  // namespace storages::rocks
 
 USERVER_NAMESPACE_END
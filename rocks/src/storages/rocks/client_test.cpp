@@ -1,4 +1,5 @@
 #include <userver/storages/rocks/client.hpp>
+#include <userver/storages/rocks/exception.hpp>
 #include <userver/utest/utest.hpp>
 #include <userver/utils/async.hpp>
 
@@ -25,6 +26,53 @@ UTEST(Rocks, CheckCRUD) {
   EXPECT_EQ("", res);
 }
 
+UTEST(Rocks, WriteBatchAndMultiGet) {
+  storages::rocks::Client client{"/tmp/rocksdb_batch_example",
+                                 engine::current_task::GetTaskProcessor()};
+
+  auto batch = client.MakeWriteBatch();
+  batch.Put("key1", "value1");
+  batch.Put("key2", "value2");
+  batch.Delete("key3");
+  EXPECT_EQ(batch.Size(), 3u);
+  client.Write(std::move(batch));
+
+  const auto res = client.MultiGet({"key1", "key3", "key2"});
+  ASSERT_EQ(res.size(), 3u);
+  EXPECT_EQ("value1", res[0]);
+  EXPECT_EQ(std::nullopt, res[1]);
+  EXPECT_EQ("value2", res[2]);
+}
+
+UTEST(Rocks, ColumnFamiliesAndPrefixes) {
+  storages::rocks::ClientSettings settings;
+  settings.prefix_length = 2;
+  settings.column_families = {"cf"};
+  storages::rocks::Client client{"/tmp/rocksdb_column_families_example",
+                                 settings,
+                                 engine::current_task::GetTaskProcessor()};
+
+  auto batch = client.MakeWriteBatch();
+  batch.Put("a:1", "1", "cf");
+  batch.Put("a:2", "2", "cf");
+  batch.Put("b:1", "3", "cf");
+  batch.Put("a:3", "default");
+  client.Write(std::move(batch));
+
+  EXPECT_EQ("", client.Get("a:3", "cf"));
+  EXPECT_EQ("default", client.Get("a:3"));
+
+  using KeyValues = std::vector<storages::rocks::KeyValue>;
+  EXPECT_EQ((KeyValues{{"a:1", "1"}, {"a:2", "2"}}),
+            client.GetByPrefix("a:", 10, "cf"));
+  EXPECT_EQ((KeyValues{{"a:1", "1"}}), client.GetByPrefix("a:", 1, "cf"));
+  EXPECT_EQ((KeyValues{{"a:2", "2"}, {"b:1", "3"}}),
+            client.GetRange("a:2", "c", 10, "cf"));
+  EXPECT_EQ((KeyValues{{"a:2", "2"}}), client.GetRange("a:2", "b", 10, "cf"));
+
+  EXPECT_THROW(client.Get("key", "unknown"), storages::rocks::Exception);
+}
+
 }  // namespace
 
 USERVER_NAMESPACE_END
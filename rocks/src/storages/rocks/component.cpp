@@ -2,18 +2,53 @@
 
 #include <memory>
 
+#include <userver/formats/parse/common_containers.hpp>
 #include <userver/storages/rocks/client.hpp>
+#include <userver/utils/trivial_map.hpp>
 #include <userver/yaml_config/merge_schemas.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
 namespace storages::rocks {
 
+namespace {
+
+constexpr utils::TrivialBiMap kCompressions = [](auto selector) {
+  return selector()
+      .Case("none", Compression::kNone)
+      .Case("snappy", Compression::kSnappy)
+      .Case("lz4", Compression::kLz4)
+      .Case("zstd", Compression::kZstd);
+};
+
+ClientSettings ParseSettings(const components::ComponentConfig& config) {
+  ClientSettings settings;
+  settings.block_cache_size = config["block-cache-size"].As<std::size_t>(
+      settings.block_cache_size);
+  if (const auto compression = config["compression"];
+      !compression.IsMissing()) {
+    // The value is validated by the static config schema
+    settings.compression =
+        kCompressions.TryFind(compression.As<std::string>()).value();
+  }
+  settings.bloom_filter_bits_per_key =
+      config["bloom-filter-bits-per-key"].As<int>(
+          settings.bloom_filter_bits_per_key);
+  settings.prefix_length =
+      config["prefix-length"].As<std::size_t>(settings.prefix_length);
+  settings.column_families =
+      config["column-families"].As<std::vector<std::string>>(
+          std::vector<std::string>{});
+  return settings;
+}
+
+}  // namespace
+
 Component::Component(const components::ComponentConfig& config,
                      const components::ComponentContext& context)
     : ComponentBase(config, context),
       client_ptr_(std::make_shared<storages::rocks::Client>(
-          config["db-path"].As<std::string>(),
+          config["db-path"].As<std::string>(), ParseSettings(config),
           context.GetTaskProcessor(
               config["task-processor"].As<std::string>()))) {}
 
@@ -31,6 +66,32 @@ properties:
     db-path:
         type: string
         description: path to database file
+    block-cache-size:
+        type: integer
+        description: size of the LRU cache of uncompressed blocks in bytes, 0 for the RocksDB default
+        minimum: 0
+    compression:
+        type: string
+        description: compression of the blocks
+        enum:
+          - none
+          - snappy
+          - lz4
+          - zstd
+    bloom-filter-bits-per-key:
+        type: integer
+        description: bits per key of the bloom filter, 0 to disable the filter
+        minimum: 0
+    prefix-length:
+        type: integer
+        description: length of the key prefix for the prefix bloom filters, 0 to disable
+        minimum: 0
+    column-families:
+        type: array
+        description: column families to open, created if missing
+        items:
+            type: string
+            description: column family name
 )");
 }
 }  // namespace storages::rocks
@@ -0,0 +1,32 @@
+#include <userver/storages/rocks/write_batch.hpp>
+
+#include <userver/storages/rocks/client.hpp>
+#include <userver/storages/rocks/exception.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace storages::rocks {
+
+WriteBatch::WriteBatch(const Client& client) : client_(&client) {}
+
+void WriteBatch::Put(std::string_view key, std::string_view value,
+                     std::string_view column_family) {
+  auto status =
+      batch_.Put(client_->GetColumnFamily(column_family), key, value);
+  if (!status.ok()) {
+    throw RequestFailedException("WriteBatch Put", status.ToString());
+  }
+}
+
+void WriteBatch::Delete(std::string_view key, std::string_view column_family) {
+  auto status = batch_.Delete(client_->GetColumnFamily(column_family), key);
+  if (!status.ok()) {
+    throw RequestFailedException("WriteBatch Delete", status.ToString());
+  }
+}
+
+std::size_t WriteBatch::Size() const { return batch_.Count(); }
+
+}  // namespace storages::rocks
+
+USERVER_NAMESPACE_END
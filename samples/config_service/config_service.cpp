@@ -69,8 +69,10 @@ ConfigDistributor::ConfigDistributor(
       }
     },
     "USERVER_CACHES": {},
+    "USERVER_CACHE_UPDATE_SCHEDULER": {},
     "USERVER_LRU_CACHES": {},
-    "USERVER_DUMPS": {}
+    "USERVER_DUMPS": {},
+    "USERVER_DUMPS_WRITE_LIMITS": {}
   })~";
 
   auto json = formats::json::FromString(kDynamicConfig);
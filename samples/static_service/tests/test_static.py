@@ -27,3 +27,34 @@ async def test_hidden_file(service_client, service_source_dir):
     response = await service_client.get('/dir1/.hidden_file.txt')
     assert response.status == 404
     assert response.content.decode() == 'File not found'
+
+
+async def test_file_not_modified(service_client):
+    response = await service_client.get('/index.html')
+    assert response.status == 200
+    etag = response.headers['ETag']
+
+    response = await service_client.get(
+        '/index.html', headers={'If-None-Match': etag},
+    )
+    assert response.status == 304
+    assert response.headers['ETag'] == etag
+    assert response.content == b''
+
+
+async def test_file_range(service_client, service_source_dir):
+    file = service_source_dir.joinpath('public') / 'index.html'
+    data = file.open('rb').read()
+
+    response = await service_client.get(
+        '/index.html', headers={'Range': 'bytes=1-5'},
+    )
+    assert response.status == 206
+    assert response.headers['Content-Range'] == f'bytes 1-5/{len(data)}'
+    assert response.content == data[1:6]
+
+    response = await service_client.get(
+        '/index.html', headers={'Range': f'bytes={len(data)}-'},
+    )
+    assert response.status == 416
+    assert response.headers['Content-Range'] == f'bytes */{len(data)}'
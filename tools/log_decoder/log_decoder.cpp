@@ -0,0 +1,92 @@
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <iterator>
+#include <string>
+#include <vector>
+
+#include <boost/program_options.hpp>
+
+#include <userver/compression/zstd.hpp>
+#include <userver/logging/impl/binary_format.hpp>
+
+#include <userver/utest/using_namespace_userver.hpp>
+
+namespace {
+
+struct Config {
+  std::vector<std::string> files;
+  size_t max_size = size_t{4} * 1024 * 1024 * 1024;
+};
+
+Config ParseConfig(int argc, char** argv) {
+  namespace po = boost::program_options;
+
+  Config config;
+  po::options_description desc("Allowed options");
+  desc.add_options()("help,h", "produce help message")(
+      "max-size", po::value(&config.max_size)->default_value(config.max_size),
+      "max size of a decompressed file")(
+      "files", po::value(&config.files),
+      "files in the binary log format (stdin by default)");
+
+  po::positional_options_description positional;
+  positional.add("files", -1);
+
+  po::variables_map vm;
+  try {
+    po::store(po::command_line_parser(argc, argv)
+                  .options(desc)
+                  .positional(positional)
+                  .run(),
+              vm);
+    po::notify(vm);
+  } catch (const std::exception& ex) {
+    std::cerr << "Cannot parse command line: " << ex.what() << '\n';
+    exit(1);
+  }
+
+  if (vm.count("help")) {
+    std::cout << "Converts the logs written in the 'binary' format to tskv\n\n"
+              << desc << '\n';
+    exit(0);
+  }
+
+  return config;
+}
+
+void Decode(std::istream& input, const Config& config) {
+  const std::string compressed{std::istreambuf_iterator<char>(input), {}};
+  const auto records =
+      compression::zstd::Decompress(compressed, config.max_size);
+
+  std::string tskv;
+  const auto consumed = logging::impl::binary::DecodeToTskv(records, tskv);
+  std::cout << tskv;
+  if (consumed != records.size()) {
+    std::cerr << "The input ends with a truncated record\n";
+  }
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+  const auto config = ParseConfig(argc, argv);
+
+  try {
+    if (config.files.empty()) {
+      Decode(std::cin, config);
+    }
+    for (const auto& file : config.files) {
+      std::ifstream input{file, std::ios::binary};
+      if (!input) {
+        std::cerr << "Cannot open " << file << '\n';
+        return 1;
+      }
+      Decode(input, config);
+    }
+  } catch (const std::exception& ex) {
+    std::cerr << "Decoding failed: " << ex.what() << '\n';
+    return 1;
+  }
+}
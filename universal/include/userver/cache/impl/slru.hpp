@@ -1,5 +1,6 @@
 #pragma once
 
+#include <algorithm>
 #include <memory>
 #include <utility>
 
@@ -38,6 +39,11 @@ class SlruBase final {
 
   explicit SlruBase(std::size_t probation_size, std::size_t protected_size,
                     const Hash& hash = Hash(), const Equal& equal = Equal());
+
+  /// Gives the protected segment 80% of `max_size`, each segment has room
+  /// for at least one element
+  SlruBase(std::size_t max_size, const Hash& hash, const Equal& equal);
+
   ~SlruBase() = default;
 
   SlruBase(SlruBase&& other) noexcept = default;
@@ -65,6 +71,8 @@ class SlruBase final {
   void SetMaxSize(std::size_t new_probation_size,
                   std::size_t new_protected_size);
 
+  void SetMaxSize(std::size_t new_max_size);
+
   void Clear() noexcept;
 
   template <typename Function>
@@ -81,6 +89,14 @@ class SlruBase final {
   NodeType ExtractNode(const T& key) noexcept;
 
  private:
+  static std::size_t GetProbationSize(std::size_t max_size) {
+    return std::max<std::size_t>(max_size / 5, 1);
+  }
+
+  static std::size_t GetProtectedSize(std::size_t max_size) {
+    return std::max<std::size_t>(max_size - GetProbationSize(max_size), 1);
+  }
+
   cache::impl::LruBase<T, U, Hash, Equal> probation_part_;
   cache::impl::LruBase<T, U, Hash, Equal> protected_part_;
 };
@@ -92,6 +108,12 @@ SlruBase<T, U, Hash, Equal>::SlruBase(std::size_t probation_size,
     : probation_part_(probation_size, hash, equal),
       protected_part_(protected_size, hash, equal) {}
 
+template <typename T, typename U, typename Hash, typename Equal>
+SlruBase<T, U, Hash, Equal>::SlruBase(std::size_t max_size, const Hash& hash,
+                                      const Equal& equal)
+    : SlruBase(GetProbationSize(max_size), GetProtectedSize(max_size), hash,
+               equal) {}
+
 template <typename T, typename U, typename Hash, typename Equal>
 bool SlruBase<T, U, Hash, Equal>::Put(const T& key, U value) {
   auto* const value_ptr = protected_part_.Get(key);
@@ -117,16 +139,11 @@ bool SlruBase<T, U, Hash, Equal>::Put(const T& key, U value) {
 template <typename T, typename U, typename Hash, typename Equal>
 template <typename... Args>
 U* SlruBase<T, U, Hash, Equal>::Emplace(const T& key, Args&&... args) {
-  auto value_ptr = protected_part_.Get(key);
+  auto* const value_ptr = Get(key);
   if (value_ptr) {
     return value_ptr;
   }
 
-  auto node_to_protected = probation_part_.ExtractNode(key);
-  if (node_to_protected) {
-    return protected_part_.Emplace(key, std::forward<Args>(args)...);
-  }
-
   return probation_part_.Emplace(key, std::forward<Args>(args)...);
 }
 
@@ -177,6 +194,11 @@ void SlruBase<T, U, Hash, Equal>::SetMaxSize(std::size_t new_probation_size,
   protected_part_.SetMaxSize(new_protected_size);
 }
 
+template <typename T, typename U, typename Hash, typename Equal>
+void SlruBase<T, U, Hash, Equal>::SetMaxSize(std::size_t new_max_size) {
+  SetMaxSize(GetProbationSize(new_max_size), GetProtectedSize(new_max_size));
+}
+
 template <typename T, typename U, typename Hash, typename Equal>
 void SlruBase<T, U, Hash, Equal>::Clear() noexcept {
   probation_part_.Clear();
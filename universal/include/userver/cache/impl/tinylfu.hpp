@@ -0,0 +1,328 @@
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <memory>
+#include <utility>
+
+#include <userver/cache/impl/lru.hpp>
+#include <userver/utils/filter_bloom.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace cache::impl {
+
+// Derives the second hash of the count-min sketch from the user provided one
+template <typename Hash>
+struct TinyLfuSecondHash : Hash {
+  TinyLfuSecondHash(const Hash& h) : Hash{h} {}
+
+  template <typename Key>
+  std::size_t operator()(const Key& key) const {
+    std::uint64_t hash = Hash::operator()(key);
+    hash ^= hash >> 33;
+    hash *= 0xff51afd7ed558ccdULL;
+    hash ^= hash >> 33;
+    return static_cast<std::size_t>(hash | 1);
+  }
+};
+
+// W-TinyLFU, see https://arxiv.org/abs/1512.00727
+//
+// New elements go into the window LRU that takes 1% of the capacity. The
+// element evicted from the window is admitted into the main SLRU only if its
+// estimated frequency is higher than the one of the main SLRU victim. The
+// frequencies are estimated by a count-min sketch that is halved after
+// 10 * capacity accesses to age the history.
+//
+// Each of the window, probation and protected segments has room for at least
+// one element, so the capacity is at least 3.
+template <typename T, typename U, typename Hash = std::hash<T>,
+          typename Equal = std::equal_to<T>>
+class TinyLfuBase final {
+ public:
+  using NodeType = std::unique_ptr<LruNode<T, U>>;
+
+  explicit TinyLfuBase(std::size_t max_size, const Hash& hash = Hash(),
+                       const Equal& equal = Equal());
+
+  TinyLfuBase(TinyLfuBase&& other) noexcept = default;
+  TinyLfuBase& operator=(TinyLfuBase&& other) noexcept = default;
+
+  TinyLfuBase(const TinyLfuBase&) = delete;
+  TinyLfuBase& operator=(const TinyLfuBase&) = delete;
+
+  bool Put(const T& key, U value);
+
+  template <typename... Args>
+  U* Emplace(const T& key, Args&&... args);
+
+  void Erase(const T& key);
+
+  U* Get(const T& key);
+
+  // The least recently used element of the window, it is the next one to
+  // compete for the place in the main part
+  const T* GetLeastUsedKey() const;
+
+  U* GetLeastUsedValue();
+
+  NodeType ExtractLeastUsedNode();
+
+  void SetMaxSize(std::size_t new_max_size);
+
+  void Clear() noexcept;
+
+  template <typename Function>
+  void VisitAll(Function&& func) const;
+
+  template <typename Function>
+  void VisitAll(Function&& func);
+
+  std::size_t GetSize() const;
+
+  std::size_t GetCapacity() const;
+
+ private:
+  using Sketch =
+      utils::FilterBloom<T, std::uint8_t, Hash, TinyLfuSecondHash<Hash>>;
+
+  static constexpr std::size_t kSketchCountersPerElement = 8;
+  static constexpr std::size_t kSamplesPerElement = 10;
+
+  static std::size_t GetWindowSize(std::size_t max_size) {
+    return std::max<std::size_t>(max_size / 100, 1);
+  }
+
+  static std::size_t GetMainSize(std::size_t max_size) {
+    return std::max<std::size_t>(max_size - GetWindowSize(max_size), 2);
+  }
+
+  static std::size_t GetProtectedSize(std::size_t main_size) {
+    return std::max<std::size_t>(main_size * 4 / 5, 1);
+  }
+
+  static Sketch MakeSketch(std::size_t max_size, const Hash& hash) {
+    return Sketch(max_size * kSketchCountersPerElement, hash, hash);
+  }
+
+  void RecordAccess(const T& key);
+  U* GetMain(const T& key);
+  NodeType ExtractWindowVictim();
+  void Admit(NodeType&& candidate);
+  void TrimMain();
+
+  // Probation segment has room for the whole main part and is the only one to
+  // evict from, protected segment takes up to 80% of the main part
+  LruBase<T, U, Hash, Equal> window_;
+  LruBase<T, U, Hash, Equal> probation_;
+  LruBase<T, U, Hash, Equal> protected_;
+  std::size_t main_size_;
+
+  Hash hash_;
+  Sketch sketch_;
+  std::size_t samples_{0};
+  std::size_t max_samples_;
+};
+
+template <typename T, typename U, typename Hash, typename Equal>
+TinyLfuBase<T, U, Hash, Equal>::TinyLfuBase(std::size_t max_size,
+                                            const Hash& hash,
+                                            const Equal& equal)
+    : window_(GetWindowSize(max_size), hash, equal),
+      probation_(GetMainSize(max_size), hash, equal),
+      protected_(GetProtectedSize(GetMainSize(max_size)), hash, equal),
+      main_size_(GetMainSize(max_size)),
+      hash_(hash),
+      sketch_(MakeSketch(max_size, hash)),
+      max_samples_(max_size * kSamplesPerElement) {
+  UASSERT(max_size > 0);
+}
+
+template <typename T, typename U, typename Hash, typename Equal>
+bool TinyLfuBase<T, U, Hash, Equal>::Put(const T& key, U value) {
+  RecordAccess(key);
+
+  auto* const value_ptr = window_.Get(key);
+  if (value_ptr) {
+    *value_ptr = std::move(value);
+    return false;
+  }
+
+  auto* const main_value_ptr = GetMain(key);
+  if (main_value_ptr) {
+    *main_value_ptr = std::move(value);
+    return false;
+  }
+
+  auto candidate = ExtractWindowVictim();
+  window_.Put(key, std::move(value));
+  Admit(std::move(candidate));
+  return true;
+}
+
+template <typename T, typename U, typename Hash, typename Equal>
+template <typename... Args>
+U* TinyLfuBase<T, U, Hash, Equal>::Emplace(const T& key, Args&&... args) {
+  auto* const value_ptr = Get(key);
+  if (value_ptr) {
+    return value_ptr;
+  }
+
+  auto candidate = ExtractWindowVictim();
+  auto* const result = window_.Emplace(key, std::forward<Args>(args)...);
+  Admit(std::move(candidate));
+  return result;
+}
+
+template <typename T, typename U, typename Hash, typename Equal>
+void TinyLfuBase<T, U, Hash, Equal>::Erase(const T& key) {
+  window_.Erase(key);
+  probation_.Erase(key);
+  protected_.Erase(key);
+}
+
+template <typename T, typename U, typename Hash, typename Equal>
+U* TinyLfuBase<T, U, Hash, Equal>::Get(const T& key) {
+  RecordAccess(key);
+
+  auto* const value_ptr = window_.Get(key);
+  if (value_ptr) {
+    return value_ptr;
+  }
+  return GetMain(key);
+}
+
+template <typename T, typename U, typename Hash, typename Equal>
+const T* TinyLfuBase<T, U, Hash, Equal>::GetLeastUsedKey() const {
+  return window_.GetLeastUsedKey();
+}
+
+template <typename T, typename U, typename Hash, typename Equal>
+U* TinyLfuBase<T, U, Hash, Equal>::GetLeastUsedValue() {
+  return window_.GetLeastUsedValue();
+}
+
+template <typename T, typename U, typename Hash, typename Equal>
+typename TinyLfuBase<T, U, Hash, Equal>::NodeType
+TinyLfuBase<T, U, Hash, Equal>::ExtractLeastUsedNode() {
+  return window_.ExtractLeastUsedNode();
+}
+
+template <typename T, typename U, typename Hash, typename Equal>
+void TinyLfuBase<T, U, Hash, Equal>::SetMaxSize(std::size_t new_max_size) {
+  UASSERT(new_max_size > 0);
+
+  main_size_ = GetMainSize(new_max_size);
+  window_.SetMaxSize(GetWindowSize(new_max_size));
+  protected_.SetMaxSize(GetProtectedSize(main_size_));
+  probation_.SetMaxSize(main_size_);
+  TrimMain();
+
+  sketch_ = MakeSketch(new_max_size, hash_);
+  samples_ = 0;
+  max_samples_ = new_max_size * kSamplesPerElement;
+}
+
+template <typename T, typename U, typename Hash, typename Equal>
+void TinyLfuBase<T, U, Hash, Equal>::Clear() noexcept {
+  window_.Clear();
+  probation_.Clear();
+  protected_.Clear();
+  sketch_.Clear();
+  samples_ = 0;
+}
+
+template <typename T, typename U, typename Hash, typename Equal>
+template <typename Function>
+void TinyLfuBase<T, U, Hash, Equal>::VisitAll(Function&& func) const {
+  window_.VisitAll(func);
+  probation_.VisitAll(func);
+  protected_.VisitAll(func);
+}
+
+template <typename T, typename U, typename Hash, typename Equal>
+template <typename Function>
+void TinyLfuBase<T, U, Hash, Equal>::VisitAll(Function&& func) {
+  window_.VisitAll(func);
+  probation_.VisitAll(func);
+  protected_.VisitAll(func);
+}
+
+template <typename T, typename U, typename Hash, typename Equal>
+std::size_t TinyLfuBase<T, U, Hash, Equal>::GetSize() const {
+  return window_.GetSize() + probation_.GetSize() + protected_.GetSize();
+}
+
+template <typename T, typename U, typename Hash, typename Equal>
+std::size_t TinyLfuBase<T, U, Hash, Equal>::GetCapacity() const {
+  return window_.GetCapacity() + main_size_;
+}
+
+template <typename T, typename U, typename Hash, typename Equal>
+void TinyLfuBase<T, U, Hash, Equal>::RecordAccess(const T& key) {
+  sketch_.Increment(key);
+  if (++samples_ >= max_samples_) {
+    sketch_.Halve();
+    samples_ /= 2;
+  }
+}
+
+template <typename T, typename U, typename Hash, typename Equal>
+U* TinyLfuBase<T, U, Hash, Equal>::GetMain(const T& key) {
+  auto* const value_ptr = protected_.Get(key);
+  if (value_ptr) {
+    return value_ptr;
+  }
+
+  auto node = probation_.ExtractNode(key);
+  if (!node) {
+    return nullptr;
+  }
+
+  if (protected_.GetSize() == protected_.GetCapacity()) {
+    probation_.InsertNode(protected_.ExtractLeastUsedNode());
+  }
+  return &protected_.InsertNode(std::move(node));
+}
+
+template <typename T, typename U, typename Hash, typename Equal>
+typename TinyLfuBase<T, U, Hash, Equal>::NodeType
+TinyLfuBase<T, U, Hash, Equal>::ExtractWindowVictim() {
+  if (window_.GetSize() < window_.GetCapacity()) {
+    return NodeType();
+  }
+  return window_.ExtractLeastUsedNode();
+}
+
+template <typename T, typename U, typename Hash, typename Equal>
+void TinyLfuBase<T, U, Hash, Equal>::Admit(NodeType&& candidate) {
+  if (!candidate) {
+    return;
+  }
+
+  if (probation_.GetSize() + protected_.GetSize() >= main_size_) {
+    const auto* const victim = probation_.GetLeastUsedKey();
+    if (!victim ||
+        sketch_.Estimate(candidate->GetKey()) <= sketch_.Estimate(*victim)) {
+      return;
+    }
+    probation_.ExtractLeastUsedNode();
+  }
+  probation_.InsertNode(std::move(candidate));
+}
+
+template <typename T, typename U, typename Hash, typename Equal>
+void TinyLfuBase<T, U, Hash, Equal>::TrimMain() {
+  while (probation_.GetSize() + protected_.GetSize() > main_size_) {
+    if (probation_.GetSize() == 0) {
+      protected_.ExtractLeastUsedNode();
+    } else {
+      probation_.ExtractLeastUsedNode();
+    }
+  }
+}
+
+}  // namespace cache::impl
+
+USERVER_NAMESPACE_END
@@ -3,19 +3,42 @@
 /// @file userver/cache/lru_map.hpp
 /// @brief @copybrief cache::LruMap
 
+#include <type_traits>
+
 #include <userver/cache/impl/lru.hpp>
+#include <userver/cache/impl/slru.hpp>
+#include <userver/cache/impl/tinylfu.hpp>
+#include <userver/cache/policy.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
 /// Utilities for caching
 namespace cache {
 
+namespace impl {
+
+template <typename T, typename U, typename Hash, typename Equal,
+          CachePolicy Policy>
+using PolicyBase = std::conditional_t<
+    Policy == CachePolicy::kLRU, LruBase<T, U, Hash, Equal>,
+    std::conditional_t<Policy == CachePolicy::kSLRU,
+                       SlruBase<T, U, Hash, Equal>,
+                       TinyLfuBase<T, U, Hash, Equal>>>;
+
+}  // namespace impl
+
 /// @ingroup userver_universal userver_containers
 ///
 /// LRU key value storage (LRU cache), thread safety matches Standard Library
 /// thread safety
+///
+/// The elements to evict are chosen according to the `Policy`, see
+/// cache::CachePolicy. The policies other than cache::CachePolicy::kLRU may
+/// round the capacity up for very small `max_size`, and their
+/// GetLeastUsed() returns the next element to leave the first segment.
 template <typename T, typename U, typename Hash = std::hash<T>,
-          typename Equal = std::equal_to<T>>
+          typename Equal = std::equal_to<T>,
+          CachePolicy Policy = CachePolicy::kLRU>
 class LruMap final {
  public:
   explicit LruMap(size_t max_size, const Hash& hash = Hash(),
@@ -60,6 +83,11 @@ class LruMap final {
   /// @warning Returned pointer may be freed on the next map access!
   U* GetLeastUsed() { return impl_.GetLeastUsedValue(); }
 
+  /// Returns pointer to the key of the least recently used value;
+  /// returns nullptr if LRU is empty.
+  /// @warning Returned pointer may be freed on the next map access!
+  const T* GetLeastUsedKey() const { return impl_.GetLeastUsedKey(); }
+
   /// Sets the max size of the LRU, truncates values if new_max_size < GetSize()
   void SetMaxSize(size_t new_max_size) {
     return impl_.SetMaxSize(new_max_size);
@@ -85,7 +113,7 @@ class LruMap final {
   std::size_t GetCapacity() const { return impl_.GetCapacity(); }
 
  private:
-  impl::LruBase<T, U, Hash, Equal> impl_;
+  impl::PolicyBase<T, U, Hash, Equal, Policy> impl_;
 };
 
 }  // namespace cache
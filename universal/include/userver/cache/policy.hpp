@@ -0,0 +1,32 @@
+#pragma once
+
+/// @file userver/cache/policy.hpp
+/// @brief @copybrief cache::CachePolicy
+
+USERVER_NAMESPACE_BEGIN
+
+namespace cache {
+
+/// @brief Eviction policy of the LRU containers
+///
+/// @see cache::LruMap, cache::NWayLRU, cache::ExpirableLruCache
+enum class CachePolicy {
+  /// Least recently used element is evicted
+  kLRU,
+
+  /// Segmented LRU: the elements start in the probation segment and move to
+  /// the protected one on the second access, so the elements that were
+  /// accessed once are evicted first
+  kSLRU,
+
+  /// W-TinyLFU: a small LRU window followed by the main SLRU. An element
+  /// evicted from the window enters the main part only if it is accessed
+  /// more frequently than the main part's victim, the frequencies are
+  /// estimated by a count-min sketch. Keeps the hit rate for the scans and
+  /// the skewed (Zipfian) access patterns.
+  kTinyLFU,
+};
+
+}  // namespace cache
+
+USERVER_NAMESPACE_END
@@ -25,6 +25,13 @@ class ErrWithCode : public DecompressionError {
       : DecompressionError(fmt::format("Decompression failed: {}", errName)) {}
 };
 
+/// Compression failed
+class CompressionError : public std::runtime_error {
+ public:
+  explicit CompressionError(const char* errName)
+      : std::runtime_error(fmt::format("Compression failed: {}", errName)) {}
+};
+
 }  // namespace compression
 
 USERVER_NAMESPACE_END
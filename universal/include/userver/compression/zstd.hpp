@@ -1,6 +1,9 @@
 #pragma once
 
+#include <memory>
+#include <string>
 #include <string_view>
+#include <vector>
 
 #include <userver/compression/error.hpp>
 
@@ -8,10 +11,119 @@ USERVER_NAMESPACE_BEGIN
 
 namespace compression::zstd {
 
+/// @brief Digested zstd dictionary, improves the compression ratio of small
+/// payloads that are alike.
+///
+/// The same dictionary must be used to compress and to decompress the data.
+/// The dictionary may be shared between threads and must outlive the
+/// operations that use it.
+class Dictionary final {
+ public:
+  /// @param dictionary a dictionary from Dictionary::Train() or the zstd CLI
+  /// @param level compression level of the compressions with the dictionary
+  /// @throws CompressionError
+  Dictionary(std::string_view dictionary, int level);
+  ~Dictionary();
+
+  Dictionary(Dictionary&&) noexcept;
+  Dictionary& operator=(Dictionary&&) noexcept;
+
+  /// Trains a dictionary of at most `max_size` bytes on the sample payloads.
+  /// Samples are expected to be numerous, thousands of them work best.
+  /// @throws CompressionError
+  static std::string Train(const std::vector<std::string>& samples,
+                           std::size_t max_size);
+
+ private:
+  friend class Compressor;
+  friend class Decompressor;
+  friend std::string Compress(std::string_view, const Dictionary&);
+  friend std::string Decompress(std::string_view, size_t, const Dictionary&);
+
+  struct Impl;
+  std::unique_ptr<Impl> impl_;
+};
+
 /// Decompresses the string.
 /// @throws DecompressionError
 std::string Decompress(std::string_view compressed, size_t max_size);
 
+/// Decompresses the string compressed with the dictionary.
+/// @throws DecompressionError
+std::string Decompress(std::string_view compressed, size_t max_size,
+                       const Dictionary& dictionary);
+
+/// Compresses the string into a single zstd frame.
+/// @throws CompressionError
+std::string Compress(std::string_view data, int level);
+
+/// Compresses the string into a single zstd frame with the dictionary.
+/// @throws CompressionError
+std::string Compress(std::string_view data, const Dictionary& dictionary);
+
+/// @brief Incremental zstd compressor.
+///
+/// Each Compress() call flushes its output, so the concatenation of all the
+/// results received so far can be decompressed by the peer right away.
+///
+/// The compression contexts are reused, so creating a compressor per stream
+/// is cheap.
+class Compressor final {
+ public:
+  /// @throws CompressionError
+  explicit Compressor(int level);
+  /// @throws CompressionError
+  explicit Compressor(const Dictionary& dictionary);
+  ~Compressor();
+
+  Compressor(Compressor&&) noexcept;
+  Compressor& operator=(Compressor&&) noexcept;
+
+  /// Compresses the next part of the data.
+  /// @throws CompressionError
+  std::string Compress(std::string_view data);
+
+  /// Returns the end of the frame, the compressor may not be used after that.
+  /// @throws CompressionError
+  std::string Finish();
+
+ private:
+  struct Impl;
+  std::unique_ptr<Impl> impl_;
+};
+
+/// @brief Incremental zstd decompressor.
+///
+/// Accepts the compressed data in parts of any size, e.g. as they are read
+/// from a socket or a file, and returns the data decompressed so far. The
+/// decompression contexts are reused, so creating a decompressor per stream
+/// is cheap.
+class Decompressor final {
+ public:
+  /// @param max_size limit of the total size of the decompressed data
+  /// @throws DecompressionError
+  explicit Decompressor(size_t max_size);
+  /// @throws DecompressionError
+  Decompressor(size_t max_size, const Dictionary& dictionary);
+  ~Decompressor();
+
+  Decompressor(Decompressor&&) noexcept;
+  Decompressor& operator=(Decompressor&&) noexcept;
+
+  /// Decompresses the next part of the data.
+  /// @throws DecompressionError
+  /// @throws TooBigError if the decompressed data exceeds `max_size`
+  std::string Decompress(std::string_view compressed);
+
+  /// Returns whether the data received so far ends on a frame boundary, i.e.
+  /// the stream is not truncated if it ends here.
+  bool IsFrameFinished() const noexcept;
+
+ private:
+  struct Impl;
+  std::unique_ptr<Impl> impl_;
+};
+
 }  // namespace compression::zstd
 
 USERVER_NAMESPACE_END
@@ -4,6 +4,7 @@
 /// @brief @copybrief crypto::base64
 /// @ingroup userver_universal
 
+#include <string>
 #include <string_view>
 
 USERVER_NAMESPACE_BEGIN
@@ -15,24 +16,42 @@ enum class Pad { kWith, kWithout };
 
 /// @brief Encodes data to Base64, add padding by default
 /// @param pad controls if pad should be added or not
-/// @throws CryptoException internal library exception
 std::string Base64Encode(std::string_view data, Pad pad = Pad::kWith);
 
+/// @brief Encodes data to Base64 and appends the result to `out`
+/// @param pad controls if pad should be added or not
+void Base64EncodeAppend(std::string_view data, std::string& out,
+                        Pad pad = Pad::kWith);
+
 /// @brief Decodes data from Base64
-/// @throws CryptoException internal library exception
+/// @note Characters out of the alphabet, including the padding, are skipped
 std::string Base64Decode(std::string_view data);
 
+/// @brief Decodes data from Base64 and appends the result to `out`
+/// @note Characters out of the alphabet, including the padding, are skipped
+void Base64DecodeAppend(std::string_view data, std::string& out);
+
 #ifndef USERVER_NO_CRYPTOPP_BASE64_URL
 
 /// @brief Encodes data to Base64 (using URL alphabet), add padding by default
 /// @param pad controls if pad should be added or not
-/// @throws CryptoException internal library exception
 std::string Base64UrlEncode(std::string_view data, Pad pad = Pad::kWith);
 
+/// @brief Encodes data to Base64 (using URL alphabet) and appends the result
+/// to `out`
+/// @param pad controls if pad should be added or not
+void Base64UrlEncodeAppend(std::string_view data, std::string& out,
+                           Pad pad = Pad::kWith);
+
 /// @brief Decodes data from Base64 (using URL alphabet)
-/// @throws CryptoException internal library exception
+/// @note Characters out of the alphabet, including the padding, are skipped
 std::string Base64UrlDecode(std::string_view data);
 
+/// @brief Decodes data from Base64 (using URL alphabet) and appends the result
+/// to `out`
+/// @note Characters out of the alphabet, including the padding, are skipped
+void Base64UrlDecodeAppend(std::string_view data, std::string& out);
+
 #endif
 
 }  // namespace crypto::base64
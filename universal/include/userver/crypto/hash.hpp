@@ -4,8 +4,14 @@
 /// @brief @copybrief crypto::hash
 /// @ingroup userver_universal
 
+#include <cstddef>
+#include <initializer_list>
+#include <string>
 #include <string_view>
 
+#include <userver/utils/fast_pimpl.hpp>
+#include <userver/utils/span.hpp>
+
 USERVER_NAMESPACE_BEGIN
 
 /// Cryptographic hashing
@@ -89,6 +95,95 @@ std::string HmacSha384(std::string_view key, std::string_view message,
 std::string HmacSha512(std::string_view key, std::string_view message,
                        OutputEncoding encoding = OutputEncoding::kHex);
 
+/// Hash functions of the incremental Hasher and Hmac
+enum class Algorithm { kSha1, kSha224, kSha256, kSha384, kSha512 };
+
+/// @brief Incremental hash calculation.
+///
+/// Unlike the functions above, accepts the data in parts, e.g. the headers and
+/// the body of a request, without concatenating them first. After Finish() the
+/// hasher starts over and may be reused.
+///
+/// Internal OpenSSL contexts are reused via a thread-local pool.
+class Hasher final {
+ public:
+  /// @throws CryptoException internal library exception
+  explicit Hasher(Algorithm algorithm);
+
+  Hasher(Hasher&&) noexcept;
+  Hasher& operator=(Hasher&&) noexcept;
+  ~Hasher();
+
+  /// @brief Feeds the next part of the data
+  /// @throws CryptoException internal library exception
+  void Update(std::string_view data);
+
+  /// @brief Feeds several parts of the data in order
+  /// @throws CryptoException internal library exception
+  void Update(std::initializer_list<std::string_view> data);
+
+  /// @brief Returns the size of the raw digest in bytes
+  std::size_t GetDigestSize() const;
+
+  /// @brief Returns the digest of the data fed so far and resets the hasher
+  /// @param encoding result could be returned as binary string or encoded
+  /// @throws CryptoException internal library exception
+  std::string Finish(OutputEncoding encoding = OutputEncoding::kHex);
+
+  /// @brief Writes the raw digest of the data fed so far into `out` and resets
+  /// the hasher, does not allocate
+  /// @returns the number of bytes written, equals GetDigestSize()
+  /// @throws CryptoException if `out` is shorter than GetDigestSize() or on
+  /// internal library exception
+  std::size_t Finish(utils::span<char> out);
+
+ private:
+  struct Impl;
+  utils::FastPimpl<Impl, 16, 8> impl_;
+};
+
+/// @brief Incremental HMAC calculation.
+///
+/// Accepts the message in parts, after Finish() starts over with the same key
+/// and may be reused. Internal OpenSSL contexts are reused via a thread-local
+/// pool.
+class Hmac final {
+ public:
+  /// @throws CryptoException internal library exception
+  Hmac(Algorithm algorithm, std::string_view key);
+
+  Hmac(Hmac&&) noexcept;
+  Hmac& operator=(Hmac&&) noexcept;
+  ~Hmac();
+
+  /// @brief Feeds the next part of the message
+  /// @throws CryptoException internal library exception
+  void Update(std::string_view data);
+
+  /// @brief Feeds several parts of the message in order
+  /// @throws CryptoException internal library exception
+  void Update(std::initializer_list<std::string_view> data);
+
+  /// @brief Returns the size of the raw MAC in bytes
+  std::size_t GetDigestSize() const;
+
+  /// @brief Returns the MAC of the message fed so far and resets the state
+  /// @param encoding result could be returned as binary string or encoded
+  /// @throws CryptoException internal library exception
+  std::string Finish(OutputEncoding encoding = OutputEncoding::kHex);
+
+  /// @brief Writes the raw MAC of the message fed so far into `out` and
+  /// resets the state, does not allocate
+  /// @returns the number of bytes written, equals GetDigestSize()
+  /// @throws CryptoException if `out` is shorter than GetDigestSize() or on
+  /// internal library exception
+  std::size_t Finish(utils::span<char> out);
+
+ private:
+  struct Impl;
+  utils::FastPimpl<Impl, 24, 8> impl_;
+};
+
 /// Broken cryptographic hashes, must not be used except for compatibility
 namespace weak {
 
@@ -18,6 +18,7 @@
 // Licence:     BSD
 // ==================================================================
 
+#include <algorithm>
 #include <array>
 #include <cassert>
 #include <cstdint>
@@ -31,6 +32,7 @@
 #include <string>
 #include <string_view>
 #include <type_traits>
+#include <vector>
 
 #include <fmt/compile.h>
 #include <fmt/format.h>
@@ -39,7 +41,7 @@
 #include <userver/formats/common/meta.hpp>
 #include <userver/utils/assert.hpp>
 #include <userver/utils/flags.hpp>
-#include <userver/utils/meta_light.hpp>
+#include <userver/utils/meta.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
@@ -130,11 +132,32 @@ constexpr int64_t Div(int64_t nominator, int64_t denominator,
   return RoundPolicy::DivRounded(nominator, denominator, extra_odd_quotient);
 }
 
+// Rounds `whole + rem / divisor` according to RoundPolicy
+template <typename RoundPolicy>
+constexpr int64_t RoundQuotient(int64_t whole, int64_t rem, int64_t divisor) {
+  const bool extra_odd_quotient = whole % 2 != 0;
+  const int64_t rem_divided =
+      Div<RoundPolicy>(rem, divisor, extra_odd_quotient);
+  UASSERT(rem_divided == -1 || rem_divided == 0 || rem_divided == 1);
+
+  return whole + rem_divided;
+}
+
 // result = (value1 * value2) / divisor
 template <typename RoundPolicy>
 constexpr int64_t MulDiv(int64_t value1, int64_t value2, int64_t divisor) {
   if (divisor == 0) throw DivisionByZeroError();
 
+  // Most products fit in int64_t, and 64-bit division is several times
+  // cheaper than the 128-bit one. kMinInt64 / -1 would overflow.
+  int64_t prod64{};
+  if (!__builtin_mul_overflow(value1, value2, &prod64) &&
+      prod64 != kMinInt64) {
+    const int64_t whole = prod64 / divisor;
+    if (whole == kMinInt64 || whole == kMaxInt64) throw OutOfBoundsError();
+    return RoundQuotient<RoundPolicy>(whole, prod64 % divisor, divisor);
+  }
+
 #if __x86_64__ || __ppc64__ || __aarch64__
   using LongInt = __int128_t;
   static_assert(sizeof(void*) == 8);
@@ -157,13 +180,7 @@ constexpr int64_t MulDiv(int64_t value1, int64_t value2, int64_t divisor) {
 
   if (whole <= kMinInt64 || whole >= kMaxInt64) throw OutOfBoundsError();
 
-  const auto whole64 = static_cast<int64_t>(whole);
-  const bool extra_odd_quotient = whole64 % 2 != 0;
-  const int64_t rem_divided =
-      Div<RoundPolicy>(rem, divisor, extra_odd_quotient);
-  UASSERT(rem_divided == -1 || rem_divided == 0 || rem_divided == 1);
-
-  return whole64 + rem_divided;
+  return RoundQuotient<RoundPolicy>(static_cast<int64_t>(whole), rem, divisor);
 }
 
 constexpr int Sign(int64_t value) { return (value > 0) - (value < 0); }
@@ -1252,6 +1269,93 @@ template <int Prec, typename RoundPolicy, typename CharSequence>
           0};
 }
 
+// Parses the most common "[+-]digits[.digits]" strings with at most Prec
+// fractional digits in a tight loop. Returns false for anything else, which
+// is then handled (and reported) by the generic Parse.
+template <int Prec>
+constexpr bool TryParseSimple(std::string_view input,
+                              int64_t& result) noexcept {
+  const auto is_digit = [](char c) { return c >= '0' && c <= '9'; };
+  const char* it = input.data();
+  const char* const end = it + input.size();
+
+  bool is_negative = false;
+  if (it != end && (*it == '-' || *it == '+')) {
+    is_negative = *it == '-';
+    ++it;
+  }
+
+  const char* const before_begin = it;
+  int64_t before = 0;
+  while (it != end && is_digit(*it) && it - before_begin < kMaxDecimalDigits) {
+    before = 10 * before + (*it - '0');
+    ++it;
+  }
+  if (it == before_begin || before >= kMaxInt64 / kPow10<Prec>) return false;
+
+  int64_t after = 0;
+  int after_digit_count = 0;
+  if (it != end) {
+    if (*it != '.') return false;
+    ++it;
+    while (it != end && is_digit(*it) && after_digit_count < Prec) {
+      after = 10 * after + (*it - '0');
+      ++after_digit_count;
+      ++it;
+    }
+    if (it != end || after_digit_count == 0) return false;
+  }
+
+  // Can't overflow thanks to the check of `before` above
+  result = before * kPow10<Prec> +
+           after * kPowSeries10[Prec - after_digit_count];
+  if (is_negative) result = -result;
+  return true;
+}
+
+// Sums the values exactly. Upper and lower 32-bit halves are accumulated
+// separately, so that the inner loop has no overflow checks and is
+// vectorized by the compiler.
+template <typename Dec>
+constexpr int64_t SumUnbiased(const Dec* values, std::size_t size) {
+  // Neither half may overflow within a block
+  constexpr std::size_t kBlockSize = std::size_t{1} << 30;
+  constexpr uint64_t kLowMask = 0xffffffff;
+
+  int64_t high = 0;
+  uint64_t low = 0;
+  while (size != 0) {
+    const auto block_size = std::min(size, kBlockSize);
+    int64_t block_high = 0;
+    uint64_t block_low = low;
+    for (std::size_t i = 0; i < block_size; ++i) {
+      const int64_t value = values[i].AsUnbiased();
+      block_high += value >> 32;
+      block_low += static_cast<uint64_t>(value) & kLowMask;
+    }
+
+    if (__builtin_add_overflow(high, block_high, &high) ||
+        __builtin_add_overflow(high, static_cast<int64_t>(block_low >> 32),
+                               &high)) {
+      throw OutOfBoundsError();
+    }
+    low = block_low & kLowMask;
+    values += block_size;
+    size -= block_size;
+  }
+
+  int64_t result{};
+  if (__builtin_mul_overflow(high, int64_t{1} << 32, &result) ||
+      __builtin_add_overflow(result, static_cast<int64_t>(low), &result)) {
+    throw OutOfBoundsError();
+  }
+  return result;
+}
+
+template <typename Range>
+using RangeValue = std::remove_cv_t<
+    std::remove_reference_t<decltype(*std::begin(std::declval<Range&>()))>>;
+
 std::string GetErrorMessage(std::string_view source, std::string_view path,
                             size_t position, ParseErrorCode reason);
 
@@ -1266,6 +1370,8 @@ std::string ToString(int64_t before, int64_t after, int precision,
 
 template <int Prec, typename RoundPolicy>
 constexpr Decimal<Prec, RoundPolicy>::Decimal(std::string_view value) {
+  if (impl::TryParseSimple<Prec>(value, value_)) return;
+
   const auto result = impl::Parse<Prec, RoundPolicy>(
       impl::StringCharSequence(value), impl::ParseOptions::kNone);
 
@@ -1353,6 +1459,72 @@ std::string ToStringFixed(Decimal<Prec, RoundPolicy> dec) {
       decimal64::decimal_cast<Decimal<NewPrec, RoundPolicy>>(dec));
 }
 
+/// @brief Parses each string of `input` like Decimal::Decimal(std::string_view)
+///
+/// Usage example:
+///
+///     std::vector<std::string> rows = ...;
+///     auto prices = decimal64::FromStrings<Money>(rows);
+///
+/// @throws ParseError on the first invalid string
+template <typename Dec, typename Range>
+std::vector<Dec> FromStrings(const Range& input) {
+  static_assert(kIsDecimal<Dec>);
+  std::vector<Dec> result;
+  if constexpr (meta::kIsSizable<Range>) result.reserve(std::size(input));
+  for (const auto& value : input) {
+    result.emplace_back(std::string_view{value});
+  }
+  return result;
+}
+
+/// @brief Converts each `Decimal` of `input` to a string
+/// @see ToString
+template <typename Range>
+std::vector<std::string> ToStrings(const Range& input) {
+  static_assert(kIsDecimal<impl::RangeValue<Range>>);
+  std::vector<std::string> result;
+  if constexpr (meta::kIsSizable<Range>) result.reserve(std::size(input));
+  for (const auto& dec : input) result.push_back(ToString(dec));
+  return result;
+}
+
+/// @brief Sums a contiguous range of `Decimal`s
+///
+/// Much faster than a loop of `operator+` on large ranges, as the summation
+/// is vectorized. The result does not depend on the order of the values:
+/// only the total sum must fit into the `Decimal`.
+///
+/// @throws OutOfBoundsError if the sum does not fit into the `Decimal`
+template <typename Range>
+auto Sum(const Range& values) {
+  using Dec = impl::RangeValue<Range>;
+  static_assert(kIsDecimal<Dec>);
+  return Dec::FromUnbiased(
+      impl::SumUnbiased(std::data(values), std::size(values)));
+}
+
+/// @brief Multiplies each `Decimal` of a range by `factor`, rounding the
+/// results according to `RoundPolicy`
+///
+/// Equivalent to `value *= factor` for each value, but lets the compiler
+/// optimize the division by the constant denominator of `factor`.
+///
+/// @throws OutOfBoundsError on overflow, the values before the failed one are
+/// already multiplied
+template <typename Range, int Prec2, typename RoundPolicy>
+void MultiplyInPlace(Range& values, Decimal<Prec2, RoundPolicy> factor) {
+  using Dec = impl::RangeValue<Range>;
+  static_assert(kIsDecimal<Dec>);
+  static_assert(std::is_same_v<typename Dec::RoundPolicy, RoundPolicy>);
+
+  const int64_t factor_unbiased = factor.AsUnbiased();
+  for (auto& value : values) {
+    value = Dec::FromUnbiased(impl::MulDiv<RoundPolicy>(
+        value.AsUnbiased(), factor_unbiased, kPow10<Prec2>));
+  }
+}
+
 /// @brief Parses a `Decimal` from the `istream`
 ///
 /// Acts like the `Decimal(str)` constructor, except that it allows junk that
@@ -0,0 +1,51 @@
+#pragma once
+
+/// @file userver/formats/json/aggregate_field_names.hpp
+/// @brief @copybrief formats::json::AggregateFieldNames
+
+#include <array>
+#include <string_view>
+#include <type_traits>
+
+#include <userver/utils/meta_light.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace formats::json {
+
+/// @brief Names of the JSON object fields of an aggregate, in the order of
+/// the aggregate members.
+///
+/// Specialize it to let formats::json::parser::Deserialize parse the
+/// aggregate directly from the JSON object, and to let WriteToStream write it
+/// directly into a formats::json::StringBuilder (see
+/// userver/formats/json/serialize_aggregate.hpp):
+///
+/// @code
+/// struct MyStruct {
+///   std::int64_t id;
+///   std::optional<std::string> name;
+/// };
+///
+/// template <>
+/// struct formats::json::AggregateFieldNames<MyStruct> {
+///   static constexpr std::array<std::string_view, 2> kValue{"id", "name"};
+/// };
+/// @endcode
+template <typename T>
+struct AggregateFieldNames {};
+
+namespace impl {
+
+template <typename T>
+using AggregateFieldNamesValue = decltype(AggregateFieldNames<T>::kValue);
+
+template <typename T>
+inline constexpr bool kHasAggregateFieldNames =
+    std::is_aggregate_v<T> && meta::kIsDetected<AggregateFieldNamesValue, T>;
+
+}  // namespace impl
+
+}  // namespace formats::json
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,153 @@
+#pragma once
+
+/// @file userver/formats/json/lazy_value.hpp
+/// @brief @copybrief formats::json::LazyValue
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <utility>
+
+#include <userver/formats/json/value.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace formats::json {
+
+// clang-format off
+
+/// @ingroup userver_universal userver_containers userver_formats
+///
+/// @brief Read-only JSON document that keeps the JSON text and parses only
+/// the values that are accessed.
+///
+/// The constructor validates the document and builds an index of the
+/// positions of its objects and arrays, without building a DOM. Member and
+/// element access walks the text of a single object or array, skipping the
+/// nested objects and arrays in O(1) with the index. The accessed values are
+/// parsed into formats::json::Value only on As() or Materialize().
+///
+/// Useful for large documents in caches that are read only partially. For
+/// the documents that are read entirely prefer formats::json::Value.
+///
+/// Unlike formats::json::FromString, duplicate keys are not detected, the
+/// first of the duplicate members is found.
+///
+/// ## Example usage:
+///
+/// @snippet formats/json/lazy_value_test.cpp  Sample formats::json::LazyValue usage
+
+// clang-format on
+
+class LazyValue final {
+ public:
+  /// @throws formats::json::ParseException if the document is not a valid
+  /// JSON or exceeds formats::json::kDepthParseLimit
+  explicit LazyValue(std::string json);
+
+  LazyValue(const LazyValue&);
+  LazyValue(LazyValue&&) noexcept;
+  LazyValue& operator=(const LazyValue&);
+  LazyValue& operator=(LazyValue&&) noexcept;
+  ~LazyValue();
+
+  /// @brief Access member by key without parsing the other members.
+  /// @returns a missing value if there is no such member
+  /// @throws TypeMismatchException if not an object or null
+  LazyValue operator[](std::string_view key) const;
+
+  /// @brief Access array element by index without parsing the other
+  /// elements.
+  /// @throws TypeMismatchException if not an array
+  /// @throws OutOfBoundsException if index is greater or equal than size
+  LazyValue operator[](std::size_t index) const;
+
+  /// @brief Returns true if the object has a member with the key
+  /// @throws TypeMismatchException if not an object or null
+  bool HasMember(std::string_view key) const;
+
+  /// @brief Returns the number of elements of an array or of members of an
+  /// object, 0 for null
+  /// @throws TypeMismatchException if not an array, object or null
+  std::size_t GetSize() const;
+
+  /// @brief Returns true if the array or object is empty, or for null
+  /// @throws TypeMismatchException if not an array, object or null
+  bool IsEmpty() const;
+
+  bool IsMissing() const noexcept;
+  bool IsNull() const noexcept;
+  bool IsBool() const noexcept;
+  bool IsNumber() const noexcept;
+  bool IsString() const noexcept;
+  bool IsArray() const noexcept;
+  bool IsObject() const noexcept;
+
+  /// @brief Parses the value into formats::json::Value
+  /// @throws MemberMissingException if the value is missing
+  Value Materialize() const;
+
+  /// @brief Parses the value into T through formats::json::Value.
+  ///
+  /// Paths in the conversion errors are relative to this value, use
+  /// GetPath() for the path of this value in the document.
+  template <typename T>
+  auto As() const;
+
+  /// @brief Returns the default value if the value is missing or null,
+  /// parses the value into T otherwise
+  template <typename T, typename First, typename... Rest>
+  auto As(First&& default_arg, Rest&&... more_default_args) const;
+
+  /// @brief Returns the JSON text of the value
+  /// @throws MemberMissingException if the value is missing
+  std::string_view GetRawJson() const;
+
+  /// @brief Returns the path to the value in the document
+  std::string GetPath() const;
+
+ private:
+  struct Data;
+
+  LazyValue(std::shared_ptr<const Data> data, std::uint32_t begin,
+            std::uint32_t end, std::uint32_t tape_index, std::string path,
+            bool is_missing);
+
+  LazyValue MakeMissing(std::string path) const;
+  char FirstChar() const noexcept;
+  int GetExtendedType() const;
+  void CheckNotMissing() const;
+  void CheckObjectOrNull() const;
+
+  std::shared_ptr<const Data> data_;
+  // [begin_, end_) is the text of the value in the document, or of the
+  // closest existing parent for the missing values
+  std::uint32_t begin_{0};
+  std::uint32_t end_{0};
+  // index of the object or array in the index of the document
+  std::uint32_t tape_index_{0};
+  bool is_missing_{false};
+  std::string path_;
+};
+
+template <typename T>
+auto LazyValue::As() const {
+  return Materialize().As<T>();
+}
+
+template <typename T, typename First, typename... Rest>
+auto LazyValue::As(First&& default_arg, Rest&&... more_default_args) const {
+  if (IsMissing() || IsNull()) {
+    // intended raw ctor call, sometimes casts
+    // NOLINTNEXTLINE(google-readability-casting)
+    return decltype(As<T>())(std::forward<First>(default_arg),
+                             std::forward<Rest>(more_default_args)...);
+  }
+  return As<T>();
+}
+
+}  // namespace formats::json
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,431 @@
+#pragma once
+
+/// @file userver/formats/json/parser/deserialize.hpp
+/// @brief @copybrief formats::json::parser::Deserialize
+
+#include <array>
+#include <cstdint>
+#include <iterator>
+#include <map>
+#include <optional>
+#include <set>
+#include <string>
+#include <string_view>
+#include <tuple>
+#include <type_traits>
+#include <unordered_map>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+#include <boost/pfr/core.hpp>
+#include <boost/pfr/tuple_size.hpp>
+#include <fmt/format.h>
+
+#include <userver/formats/json/aggregate_field_names.hpp>
+#include <userver/formats/json/parser/array_parser.hpp>
+#include <userver/formats/json/parser/bool_parser.hpp>
+#include <userver/formats/json/parser/int_parser.hpp>
+#include <userver/formats/json/parser/map_parser.hpp>
+#include <userver/formats/json/parser/number_parser.hpp>
+#include <userver/formats/json/parser/parser_json.hpp>
+#include <userver/formats/json/parser/string_parser.hpp>
+#include <userver/formats/json/value.hpp>
+#include <userver/utils/meta_light.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace formats::json::parser {
+
+namespace impl {
+
+template <typename T, typename = void>
+struct ParserSelector;
+
+/// Parser that is used by Deserialize for the type T
+template <typename T>
+using ParserFor = typename ParserSelector<T>::type;
+
+// Skips a JSON value of any type, used for the unknown fields
+class SkipValueParser final : public BaseParser {
+ public:
+  void Reset() { depth_ = 0; }
+
+  BaseParser& GetParser() { return *this; }
+
+  void Null() override { OnScalar(); }
+  void Bool(bool) override { OnScalar(); }
+  void Int64(std::int64_t) override { OnScalar(); }
+  void Uint64(std::uint64_t) override { OnScalar(); }
+  void Double(double) override { OnScalar(); }
+  void String(std::string_view) override { OnScalar(); }
+  void StartObject() override { ++depth_; }
+  void Key(std::string_view) override {}
+  void EndObject() override { OnEnd(); }
+  void StartArray() override { ++depth_; }
+  void EndArray() override { OnEnd(); }
+
+  std::string GetPathItem() const override { return {}; }
+
+ protected:
+  std::string Expected() const override { return "value"; }
+
+ private:
+  void OnScalar() {
+    if (depth_ == 0) parser_state_->PopMe(*this);
+  }
+
+  void OnEnd() {
+    --depth_;
+    OnScalar();
+  }
+
+  std::size_t depth_{0};
+};
+
+// Proxy parser that owns its typed parser and the parsers of the items
+template <typename Result, typename Parser, typename... Subparsers>
+class OwningParser final {
+ public:
+  using ResultType = Result;
+
+  OwningParser() : parser_(std::get<Subparsers>(subparsers_)...) {}
+
+  OwningParser(const OwningParser&) = delete;
+  OwningParser& operator=(const OwningParser&) = delete;
+
+  void Reset() { parser_.Reset(); }
+
+  void Subscribe(Subscriber<Result>& subscriber) {
+    parser_.Subscribe(subscriber);
+  }
+
+  auto& GetParser() { return parser_.GetParser(); }
+
+ private:
+  std::tuple<Subparsers...> subparsers_;
+  Parser parser_;
+};
+
+template <typename T>
+class OptionalParser final : public TypedParser<std::optional<T>>,
+                             public Subscriber<T> {
+ public:
+  OptionalParser() { value_parser_.Subscribe(*this); }
+
+  OptionalParser(const OptionalParser&) = delete;
+  OptionalParser& operator=(const OptionalParser&) = delete;
+
+  void Null() override { this->SetResult(std::nullopt); }
+  void Bool(bool b) override { PushValueParser().Bool(b); }
+  void Int64(std::int64_t i) override { PushValueParser().Int64(i); }
+  void Uint64(std::uint64_t i) override { PushValueParser().Uint64(i); }
+  void Double(double d) override { PushValueParser().Double(d); }
+  void String(std::string_view sw) override { PushValueParser().String(sw); }
+  void StartObject() override { PushValueParser().StartObject(); }
+  void StartArray() override { PushValueParser().StartArray(); }
+
+  std::string GetPathItem() const override { return {}; }
+
+ protected:
+  std::string Expected() const override { return "value or null"; }
+
+ private:
+  BaseParser& PushValueParser() {
+    value_parser_.Reset();
+    this->parser_state_->PushParser(value_parser_.GetParser());
+    return value_parser_.GetParser();
+  }
+
+  void OnSend(T&& value) override {
+    this->SetResult(std::optional<T>{std::move(value)});
+  }
+
+  ParserFor<T> value_parser_;
+};
+
+// Parses a formats::json::Value and converts it with a Parse overload
+template <typename T>
+class DomParser final : public Subscriber<formats::json::Value> {
+ public:
+  using ResultType = T;
+
+  DomParser() { value_parser_.Subscribe(*this); }
+
+  DomParser(const DomParser&) = delete;
+  DomParser& operator=(const DomParser&) = delete;
+
+  void Reset() { value_parser_.Reset(); }
+
+  void Subscribe(Subscriber<T>& subscriber) { subscriber_ = &subscriber; }
+
+  auto& GetParser() { return value_parser_.GetParser(); }
+
+ private:
+  void OnSend(formats::json::Value&& value) override {
+    auto result = value.As<T>();
+    if (subscriber_) subscriber_->OnSend(std::move(result));
+  }
+
+  JsonValueParser value_parser_;
+  Subscriber<T>* subscriber_{nullptr};
+};
+
+template <typename T, std::size_t I>
+class AggregateFieldParser final
+    : public Subscriber<boost::pfr::tuple_element_t<I, T>> {
+ public:
+  using Field = boost::pfr::tuple_element_t<I, T>;
+
+  AggregateFieldParser() { parser_.Subscribe(*this); }
+
+  AggregateFieldParser(const AggregateFieldParser&) = delete;
+  AggregateFieldParser& operator=(const AggregateFieldParser&) = delete;
+
+  void Bind(T& result, bool& seen) {
+    result_ = &result;
+    seen_ = &seen;
+  }
+
+  BaseParser& Reset() {
+    parser_.Reset();
+    return parser_.GetParser();
+  }
+
+ private:
+  void OnSend(Field&& value) override {
+    boost::pfr::get<I>(*result_) = std::move(value);
+    *seen_ = true;
+  }
+
+  ParserFor<Field> parser_;
+  T* result_{nullptr};
+  bool* seen_{nullptr};
+};
+
+template <typename T, typename Indices>
+struct AggregateFieldParsers;
+
+template <typename T, std::size_t... I>
+struct AggregateFieldParsers<T, std::index_sequence<I...>> {
+  using type = std::tuple<AggregateFieldParser<T, I>...>;
+};
+
+// std::optional members may be missing from the JSON object
+template <typename T, std::size_t... I>
+constexpr std::array<bool, sizeof...(I)> GetRequiredFields(
+    std::index_sequence<I...>) {
+  return {!meta::kIsInstantiationOf<std::optional,
+                                    boost::pfr::tuple_element_t<I, T>>...};
+}
+
+template <typename T>
+class AggregateParser final : public TypedParser<T> {
+ public:
+  AggregateParser() { BindFields(kIndices); }
+
+  AggregateParser(const AggregateParser&) = delete;
+  AggregateParser& operator=(const AggregateParser&) = delete;
+
+  void Reset() override {
+    state_ = State::kStart;
+    result_ = T{};
+    seen_.fill(false);
+  }
+
+  void StartObject() override {
+    if (state_ != State::kStart) this->Throw("object");
+    state_ = State::kInside;
+  }
+
+  void Key(std::string_view key) override {
+    if (state_ != State::kInside) {
+      this->Throw("field '" + std::string{key} + "'");
+    }
+
+    key_ = key;
+    for (std::size_t i = 0; i < kSize; ++i) {
+      if (kNames[i] == key) {
+        PushField(i, kIndices);
+        return;
+      }
+    }
+    skip_parser_.Reset();
+    this->parser_state_->PushParser(skip_parser_);
+  }
+
+  void EndObject() override {
+    if (state_ != State::kInside) this->Throw("'}'");
+
+    for (std::size_t i = 0; i < kSize; ++i) {
+      if (!seen_[i] && kRequired[i]) {
+        throw InternalParseError(
+            fmt::format("Field '{}' is missing", kNames[i]));
+      }
+    }
+    this->SetResult(std::move(result_));
+  }
+
+  std::string GetPathItem() const override { return key_; }
+
+ protected:
+  std::string Expected() const override {
+    return state_ == State::kStart ? "object" : "field or '}'";
+  }
+
+ private:
+  static constexpr auto& kNames = AggregateFieldNames<T>::kValue;
+  static constexpr std::size_t kSize = boost::pfr::tuple_size_v<T>;
+  static constexpr auto kIndices = std::make_index_sequence<kSize>{};
+  static_assert(std::size(kNames) == kSize,
+                "formats::json::AggregateFieldNames must name every "
+                "member of the aggregate");
+
+  static constexpr auto kRequired = GetRequiredFields<T>(kIndices);
+
+  template <std::size_t... I>
+  void BindFields(std::index_sequence<I...>) {
+    (std::get<I>(fields_).Bind(result_, seen_[I]), ...);
+  }
+
+  template <std::size_t... I>
+  void PushField(std::size_t index, std::index_sequence<I...>) {
+    ((index == I ? PushFieldParser<I>() : void()), ...);
+  }
+
+  template <std::size_t I>
+  void PushFieldParser() {
+    this->parser_state_->PushParser(std::get<I>(fields_).Reset());
+  }
+
+  enum class State {
+    kStart,
+    kInside,
+  };
+
+  State state_{State::kStart};
+  T result_{};
+  std::array<bool, kSize> seen_{};
+  std::string key_;
+  typename AggregateFieldParsers<T, std::make_index_sequence<kSize>>::type
+      fields_;
+  SkipValueParser skip_parser_;
+};
+
+template <typename T, typename>
+struct ParserSelector {
+  using type = DomParser<T>;
+};
+
+template <>
+struct ParserSelector<formats::json::Value> {
+  using type = JsonValueParser;
+};
+
+template <>
+struct ParserSelector<bool> {
+  using type = BoolParser;
+};
+
+template <>
+struct ParserSelector<std::int32_t> {
+  using type = Int32Parser;
+};
+
+template <>
+struct ParserSelector<std::int64_t> {
+  using type = Int64Parser;
+};
+
+template <>
+struct ParserSelector<double> {
+  using type = DoubleParser;
+};
+
+template <>
+struct ParserSelector<std::string> {
+  using type = StringParser;
+};
+
+template <typename T>
+struct ParserSelector<std::optional<T>> {
+  using type = OptionalParser<T>;
+};
+
+template <typename Array, typename Item = typename Array::value_type>
+using ArrayParserFor =
+    OwningParser<Array, ArrayParser<Item, ParserFor<Item>, Array>,
+                 ParserFor<Item>>;
+
+template <typename T>
+struct ParserSelector<std::vector<T>> {
+  using type = ArrayParserFor<std::vector<T>>;
+};
+
+template <typename T>
+struct ParserSelector<std::set<T>> {
+  using type = ArrayParserFor<std::set<T>>;
+};
+
+template <typename T>
+struct ParserSelector<std::unordered_set<T>> {
+  using type = ArrayParserFor<std::unordered_set<T>>;
+};
+
+template <typename Map, typename Value = typename Map::mapped_type>
+using MapParserFor =
+    OwningParser<Map, MapParser<Map, ParserFor<Value>>, ParserFor<Value>>;
+
+template <typename T>
+struct ParserSelector<std::map<std::string, T>> {
+  using type = MapParserFor<std::map<std::string, T>>;
+};
+
+template <typename T>
+struct ParserSelector<std::unordered_map<std::string, T>> {
+  using type = MapParserFor<std::unordered_map<std::string, T>>;
+};
+
+template <typename T>
+struct ParserSelector<
+    T, std::enable_if_t<json::impl::kHasAggregateFieldNames<T>>> {
+  using type = AggregateParser<T>;
+};
+
+}  // namespace impl
+
+/// @brief Parses the JSON document directly into T, without building a
+/// formats::json::Value for the whole document.
+///
+/// Supports aggregates with formats::json::AggregateFieldNames, bool,
+/// std::int32_t, std::int64_t, double, std::string, formats::json::Value,
+/// std::optional, std::vector, std::set, std::unordered_set, and
+/// std::map or std::unordered_map with std::string keys, nested in any
+/// combination. A value of any other type is parsed into a
+/// formats::json::Value first and converted with its `Parse` overload.
+///
+/// std::optional members of aggregates may be missing from the JSON object,
+/// other members are required. Unknown fields are skipped.
+///
+/// Recursive aggregates are not supported.
+///
+/// @throws formats::json::parser::ParseError on invalid JSON or a type
+/// mismatch, the message contains the path to the offending value
+template <typename T>
+T Deserialize(std::string_view json) {
+  T result{};
+  impl::ParserFor<T> parser;
+  parser.Reset();
+  SubscriberSink<T> sink(result);
+  parser.Subscribe(sink);
+
+  ParserState state;
+  state.PushParser(parser.GetParser());
+  state.ProcessInput(json);
+
+  return result;
+}
+
+}  // namespace formats::json::parser
+
+USERVER_NAMESPACE_END
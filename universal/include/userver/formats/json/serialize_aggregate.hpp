@@ -0,0 +1,146 @@
+#pragma once
+
+/// @file userver/formats/json/serialize_aggregate.hpp
+/// @brief SAX serialization of aggregates with
+/// formats::json::AggregateFieldNames
+/// @ingroup userver_universal userver_formats_serialize_sax
+
+#include <array>
+#include <cstddef>
+#include <optional>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+
+#include <boost/pfr/core.hpp>
+#include <boost/pfr/tuple_size.hpp>
+
+#include <userver/formats/json/aggregate_field_names.hpp>
+#include <userver/formats/json/string_builder.hpp>
+#include <userver/utils/meta_light.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace formats::json {
+
+namespace impl {
+
+constexpr std::size_t EscapedCharSize(char c) noexcept {
+  switch (c) {
+    case '"':
+    case '\\':
+    case '\b':
+    case '\f':
+    case '\n':
+    case '\r':
+    case '\t':
+      return 2;
+    default:
+      return static_cast<unsigned char>(c) < 0x20 ? 6 : 1;
+  }
+}
+
+constexpr std::size_t QuotedKeySize(std::string_view key) noexcept {
+  std::size_t size = 2;
+  for (const char c : key) size += EscapedCharSize(c);
+  return size;
+}
+
+// Quotes and escapes the key exactly as rapidjson::Writer does
+template <std::size_t Size>
+constexpr std::array<char, Size> QuoteKey(std::string_view key) noexcept {
+  constexpr std::string_view kHexDigits = "0123456789ABCDEF";
+
+  std::array<char, Size> result{};
+  std::size_t pos = 0;
+  result[pos++] = '"';
+  for (const char c : key) {
+    const auto size = EscapedCharSize(c);
+    if (size == 1) {
+      result[pos++] = c;
+      continue;
+    }
+
+    result[pos++] = '\\';
+    switch (c) {
+      case '\b':
+        result[pos++] = 'b';
+        break;
+      case '\f':
+        result[pos++] = 'f';
+        break;
+      case '\n':
+        result[pos++] = 'n';
+        break;
+      case '\r':
+        result[pos++] = 'r';
+        break;
+      case '\t':
+        result[pos++] = 't';
+        break;
+      case '"':
+      case '\\':
+        result[pos++] = c;
+        break;
+      default:
+        result[pos++] = 'u';
+        result[pos++] = '0';
+        result[pos++] = '0';
+        result[pos++] = kHexDigits[static_cast<unsigned char>(c) >> 4];
+        result[pos++] = kHexDigits[static_cast<unsigned char>(c) & 0xF];
+    }
+  }
+  result[pos++] = '"';
+  return result;
+}
+
+// The quoted and escaped name of the I-th field, computed at compile time
+template <typename T, std::size_t I>
+struct QuotedFieldName {
+  static constexpr std::string_view kName = AggregateFieldNames<T>::kValue[I];
+  static constexpr auto kQuoted = QuoteKey<QuotedKeySize(kName)>(kName);
+  static constexpr std::string_view kValue{kQuoted.data(), kQuoted.size()};
+};
+
+template <typename T, std::size_t I>
+void WriteAggregateField(const T& value, StringBuilder& sw) {
+  const auto& field = boost::pfr::get<I>(value);
+  if constexpr (meta::kIsInstantiationOf<std::optional,
+                                         std::decay_t<decltype(field)>>) {
+    if (!field) return;
+  }
+
+  sw.RawKey(QuotedFieldName<T, I>::kValue);
+  WriteToStream(field, sw);
+}
+
+template <typename T, std::size_t... I>
+void WriteAggregateFields(const T& value, StringBuilder& sw,
+                          std::index_sequence<I...>) {
+  (impl::WriteAggregateField<T, I>(value, sw), ...);
+}
+
+}  // namespace impl
+
+/// @brief Writes the aggregate as a JSON object with the field names of
+/// formats::json::AggregateFieldNames, without building a
+/// formats::json::Value.
+///
+/// The field names are quoted and escaped at compile time. Members that are
+/// empty std::optional are omitted, other members are written with their
+/// WriteToStream overloads.
+template <typename T>
+std::enable_if_t<impl::kHasAggregateFieldNames<T>> WriteToStream(
+    const T& value, StringBuilder& sw) {
+  constexpr std::size_t kSize = boost::pfr::tuple_size_v<T>;
+  static_assert(std::size(AggregateFieldNames<T>::kValue) == kSize,
+                "formats::json::AggregateFieldNames must name every member "
+                "of the aggregate");
+
+  StringBuilder::ObjectGuard guard(sw);
+  impl::WriteAggregateFields(value, sw, std::make_index_sequence<kSize>{});
+}
+
+}  // namespace formats::json
+
+USERVER_NAMESPACE_END
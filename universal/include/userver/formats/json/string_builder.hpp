@@ -77,6 +77,10 @@ class StringBuilder final : public serialize::SaxStream {
   /// ONLY for objects/dicts: write key
   void Key(std::string_view sw);
 
+  /// ONLY for objects/dicts: write key that is already quoted and escaped,
+  /// e.g. `"key"`
+  void RawKey(std::string_view quoted_key);
+
   /// Appends raw data
   void WriteRawString(std::string_view value);
 
@@ -4,6 +4,7 @@
 /// @brief @copybrief formats::json::Value
 
 #include <chrono>
+#include <cstddef>
 #include <string_view>
 #include <type_traits>
 
@@ -331,6 +332,7 @@ class Value final {
   friend std::string ToPrettyString(const formats::json::Value& doc,
                                     PrettyFormat format);
   friend logging::LogHelper& operator<<(logging::LogHelper&, const Value&);
+  friend std::size_t EstimateMemoryUsage(const Value&);
 };
 
 template <typename T>
@@ -424,6 +426,15 @@ std::chrono::minutes Parse(const Value& value, parse::To<std::chrono::minutes>);
 
 std::chrono::hours Parse(const Value& value, parse::To<std::chrono::hours>);
 
+/// @brief Returns an estimate of the memory used by the JSON tree the value
+/// refers to, e.g. for the size limits of caches
+///
+/// Accounts the nodes, the arrays of members and elements and the strings
+/// that are not stored inline. The object keys that were interned on
+/// parsing are shared by all the documents and are not accounted. Copies of
+/// a Value share the tree, so each of them reports the whole tree.
+std::size_t EstimateMemoryUsage(const Value& value);
+
 /// @brief Wrapper for handy python-like iteration over a map
 ///
 /// @code
@@ -4,12 +4,16 @@
 /// @brief @copybrief formats::json::ValueBuilder
 
 #include <chrono>
+#include <cstdint>
+#include <string>
 #include <string_view>
+#include <type_traits>
 #include <vector>
 
 #include <userver/formats/common/meta.hpp>
 #include <userver/formats/common/transfer_tag.hpp>
 #include <userver/formats/json/impl/mutable_value_wrapper.hpp>
+#include <userver/formats/json/string_builder_fwd.hpp>
 #include <userver/formats/json/value.hpp>
 #include <userver/utils/strong_typedef.hpp>
 
@@ -17,6 +21,17 @@ USERVER_NAMESPACE_BEGIN
 
 namespace formats::json {
 
+namespace impl {
+
+// Types that ValueBuilder::operator= writes directly into the native value
+template <typename T>
+inline constexpr bool kIsAssignableInPlace =
+    std::is_arithmetic_v<T> || std::is_same_v<T, std::string> ||
+    std::is_same_v<T, std::string_view> || std::is_same_v<T, const char*> ||
+    std::is_same_v<T, char*>;
+
+}  // namespace impl
+
 // clang-format off
 
 /// @ingroup userver_universal userver_containers userver_formats
@@ -66,6 +81,12 @@ class ValueBuilder final {
   // NOLINTNEXTLINE(performance-noexcept-move-constructor)
   ValueBuilder& operator=(ValueBuilder&& other);
 
+  /// @brief Assigns a number, a bool or a string in place, without
+  /// constructing a temporary ValueBuilder
+  template <typename T>
+  std::enable_if_t<impl::kIsAssignableInPlace<std::decay_t<T>>, ValueBuilder&>
+  operator=(T&& value);
+
   ValueBuilder(const formats::json::Value& other);
   ValueBuilder(formats::json::Value&& other);
 
@@ -190,6 +211,13 @@ class ValueBuilder final {
 
   impl::Value& AddMember(std::string_view key, CheckMemberExists);
 
+  impl::Value& PrepareAssign();
+  void AssignBool(bool value);
+  void AssignInt64(std::int64_t value);
+  void AssignUInt64(std::uint64_t value);
+  void AssignDouble(double value);
+  void AssignString(std::string_view value);
+
   template <typename T>
   static Value DoSerialize(const T& t);
 
@@ -197,8 +225,32 @@ class ValueBuilder final {
 
   friend class Iterator<IterTraits, common::IteratorDirection::kForward>;
   friend class Iterator<IterTraits, common::IteratorDirection::kReverse>;
+  friend void WriteToStream(const ValueBuilder&, StringBuilder&);
 };
 
+/// @brief Writes the JSON being built to the StringBuilder, without
+/// extracting or copying it into a formats::json::Value. Works for the root
+/// builder and for the builders of its members.
+void WriteToStream(const ValueBuilder& builder, StringBuilder& sw);
+
+template <typename T>
+std::enable_if_t<impl::kIsAssignableInPlace<std::decay_t<T>>, ValueBuilder&>
+ValueBuilder::operator=(T&& value) {
+  using Decayed = std::decay_t<T>;
+  if constexpr (std::is_same_v<Decayed, bool>) {
+    AssignBool(value);
+  } else if constexpr (std::is_floating_point_v<Decayed>) {
+    AssignDouble(value);
+  } else if constexpr (std::is_signed_v<Decayed>) {
+    AssignInt64(value);
+  } else if constexpr (std::is_unsigned_v<Decayed>) {
+    AssignUInt64(value);
+  } else {
+    AssignString(value);
+  }
+  return *this;
+}
+
 template <typename T>
 Value ValueBuilder::DoSerialize(const T& t) {
   static_assert(
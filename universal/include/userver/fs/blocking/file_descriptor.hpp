@@ -67,6 +67,15 @@ class FileDescriptor final {
   /// @throws std::runtime_error
   std::size_t Read(char* buffer, std::size_t max_size);
 
+  /// @brief Reads data from the file at `offset`, the current offset is not
+  /// changed
+  /// @returns The amount of bytes actually acquired, which can be equal
+  /// to `max_size`, or less on end-of-file
+  /// @note Unlike the other operations, may be called concurrently
+  /// @throws std::runtime_error
+  std::size_t ReadAt(char* buffer, std::size_t max_size,
+                     std::size_t offset) const;
+
   /// @brief Sets the file read/write offset from the beginning of the file
   /// @throws std::runtime_error
   void Seek(std::size_t offset_in_bytes);
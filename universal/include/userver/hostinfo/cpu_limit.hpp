@@ -4,6 +4,7 @@
 /// @brief Information about CPU limits in container.
 /// @ingroup userver_universal
 
+#include <cstddef>
 #include <optional>
 
 USERVER_NAMESPACE_BEGIN
@@ -17,10 +18,21 @@ namespace hostinfo {
 /// `std::thread::hardware_concurrency` this method considers container limits
 /// and may return fractional values.
 ///
-/// Uses:
-///   * CPU_LIMIT environment variable (example: `CPU_LIMIT=1.95c`).
+/// Uses, in order of priority:
+///   * CPU_LIMIT environment variable (example: `CPU_LIMIT=1.95c`);
+///   * cgroup v2 `cpu.max` quota;
+///   * cgroup v1 `cpu.cfs_quota_us` and `cpu.cfs_period_us` quota.
+///
+/// Returns std::nullopt if none of the above limits the process.
 std::optional<double> CpuLimit();
 
+/// @brief Returns the threads count that uses `ratio` of the CPUs available
+/// to the process, but at least 1.
+///
+/// CpuLimit() is used as the count of available CPUs, falls back to
+/// `std::thread::hardware_concurrency()` if there is no limit.
+std::size_t CpuLimitThreads(double ratio = 1.0);
+
 /// @brief Returns true if the current process is run in container (CPU_LIMIT
 /// environment variable is set).
 bool IsInRtc();
@@ -0,0 +1,47 @@
+#pragma once
+
+/// @file userver/logging/impl/binary_format.hpp
+/// @brief Encoding helpers of the logging::Format::kBinary records
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+
+USERVER_NAMESPACE_BEGIN
+
+/// @brief Internals of the logging::Format::kBinary log format.
+///
+/// A record is `varint(body size) body`, where body is
+/// `varint(timestamp in microseconds) byte(level) field*`, and each field is
+/// `varint(key id) [varint(key size) key] varint(value size) value`. The key
+/// is written inline only for the key id 0, other ids refer to the
+/// dictionary of well-known keys. Keys and values are not escaped.
+///
+/// The loggers compress the records of a file into a zstd frame that is
+/// flushed after each batch of records, so a log file is a valid zstd stream
+/// even while it is being written.
+namespace logging::impl::binary {
+
+/// Max size of a varint-encoded 64-bit value
+inline constexpr std::size_t kMaxVarintSize = 10;
+
+/// Size of the reserved space for a varint-encoded size of a record or value
+inline constexpr std::size_t kSizeVarintSize = 5;
+
+/// Writes `value` to `out`, `out` must have room for kMaxVarintSize bytes.
+/// @returns the number of bytes written
+std::size_t WriteVarint(char* out, std::uint64_t value) noexcept;
+
+/// @returns the dictionary id of the key, 0 if the key is not interned
+std::uint32_t FindKeyId(std::string_view key) noexcept;
+
+/// @brief Converts the records to tskv lines and appends them to `out`.
+/// @returns the number of bytes consumed, a trailing incomplete record is
+/// left unconsumed
+/// @throws std::runtime_error on malformed data
+std::size_t DecodeToTskv(std::string_view records, std::string& out);
+
+}  // namespace logging::impl::binary
+
+USERVER_NAMESPACE_END
@@ -135,7 +135,7 @@ class StaticLogEntry final {
 
  private:
   static constexpr std::size_t kContentSize =
-      compiler::SelectSize().For64Bit(40).For32Bit(24);
+      compiler::SelectSize().For64Bit(48).For32Bit(28);
 
   alignas(void*) std::byte content_[kContentSize];
 };
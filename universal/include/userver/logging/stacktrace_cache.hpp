@@ -10,7 +10,7 @@ USERVER_NAMESPACE_BEGIN
 namespace logging::stacktrace_cache {
 
 /// Get cached stacktrace
-/// @see GlobalEnableStacktrace
+/// @see GlobalEnableStacktrace, AsyncSymbolizationGuard
 std::string to_string(const boost::stacktrace::stacktrace& st);
 
 /// Enable/disable stacktraces. If disabled, stacktrace_cache::to_string()
@@ -31,6 +31,28 @@ class StacktraceGuard {
   const bool old_;
 };
 
+/// @brief RAII-wrapper that enables the asynchronous symbolization for its
+/// lifetime.
+///
+/// While enabled, stacktrace_cache::to_string() does not symbolize the frames
+/// that are missing from the cache. It returns their raw addresses right away,
+/// prefixed with a stacktrace id, and a background thread symbolizes them,
+/// puts the names to the cache and logs the symbolized stacktrace with the
+/// same id. That keeps the costly debug info lookups off the request path
+/// during error storms.
+///
+/// The destructor waits for the pending stacktraces to be symbolized and
+/// logged. Only one instance may exist at a time.
+class AsyncSymbolizationGuard final {
+ public:
+  AsyncSymbolizationGuard();
+
+  AsyncSymbolizationGuard(const AsyncSymbolizationGuard&) = delete;
+  AsyncSymbolizationGuard& operator=(const AsyncSymbolizationGuard&) = delete;
+
+  ~AsyncSymbolizationGuard();
+};
+
 }  // namespace logging::stacktrace_cache
 
 USERVER_NAMESPACE_END
@@ -0,0 +1,390 @@
+#pragma once
+
+/// @file userver/utils/blocked_filter_bloom.hpp
+/// @brief @copybrief utils::BlockedFilterBloom
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <limits>
+#include <string_view>
+#include <utility>
+
+#ifdef __AVX2__
+#include <immintrin.h>
+#endif
+
+#include <userver/utils/assert.hpp>
+#include <userver/utils/fixed_array.hpp>
+#include <userver/utils/span.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace utils {
+
+namespace impl {
+
+inline constexpr std::size_t kBloomBlockSize = 64;
+inline constexpr std::size_t kBloomBlockBits = kBloomBlockSize * 8;
+
+// Odd multipliers that pick one position per 8-byte word of a block from the
+// lower half of the hash, as in the "split block" filters of Apache Parquet
+inline constexpr std::array<std::uint32_t, 8> kBloomSalts{
+    0x47b6137bU, 0x44974d91U, 0x8824ad5bU, 0xa2b7289dU,
+    0x705495c7U, 0x2df1424bU, 0x9efc4947U, 0x5c6bfb31U};
+
+// The user hashes, e.g. std::hash of integers, are often an identity
+constexpr std::uint64_t MixBloomHash(std::uint64_t hash) noexcept {
+  // MurmurHash3 finalizer
+  hash ^= hash >> 33;
+  hash *= 0xff51afd7ed558ccdULL;
+  hash ^= hash >> 33;
+  hash *= 0xc4ceb9fe1a85ec53ULL;
+  hash ^= hash >> 33;
+  return hash;
+}
+
+// Maps the upper half of the hash to [0, blocks_count) without a division
+constexpr std::size_t GetBloomBlockIndex(std::uint64_t hash,
+                                         std::size_t blocks_count) noexcept {
+  return static_cast<std::size_t>(((hash >> 32) * blocks_count) >> 32);
+}
+
+inline std::size_t GetBloomBlocksCount(std::size_t bits_num) {
+  const auto blocks_count = std::max<std::size_t>(
+      1, (bits_num + kBloomBlockBits - 1) / kBloomBlockBits);
+  UINVARIANT(blocks_count <= std::numeric_limits<std::uint32_t>::max(),
+             "Too many bits for a Bloom filter");
+  return blocks_count;
+}
+
+inline std::size_t GetBloomBlocksCountFromBytes(std::string_view bytes) {
+  UINVARIANT(!bytes.empty() && bytes.size() % kBloomBlockSize == 0,
+             "Invalid size of a serialized Bloom filter");
+  return GetBloomBlocksCount(bytes.size() * 8);
+}
+
+// A cache line of bits, a key sets one bit in each of its 8 words
+struct alignas(kBloomBlockSize) BloomBitsBlock final {
+  std::array<std::uint64_t, 8> words{};
+};
+
+// A cache line of saturating counters, a key uses one counter in each of its
+// 8 groups of 8 counters
+struct alignas(kBloomBlockSize) BloomCountersBlock final {
+  std::array<std::uint8_t, kBloomBlockSize> counters{};
+};
+
+static_assert(sizeof(BloomBitsBlock) == kBloomBlockSize);
+static_assert(sizeof(BloomCountersBlock) == kBloomBlockSize);
+
+#ifdef __AVX2__
+struct BloomMasks final {
+  __m256i low;
+  __m256i high;
+};
+
+inline BloomMasks MakeBloomMasks(std::uint64_t hash) noexcept {
+  const auto salts = _mm256_loadu_si256(
+      reinterpret_cast<const __m256i*>(kBloomSalts.data()));
+  const auto products = _mm256_mullo_epi32(
+      _mm256_set1_epi32(static_cast<int>(static_cast<std::uint32_t>(hash))),
+      salts);
+  const auto shifts = _mm256_srli_epi32(products, 26);
+  const auto one = _mm256_set1_epi64x(1);
+  return {
+      _mm256_sllv_epi64(one,
+                        _mm256_cvtepu32_epi64(_mm256_castsi256_si128(shifts))),
+      _mm256_sllv_epi64(
+          one, _mm256_cvtepu32_epi64(_mm256_extracti128_si256(shifts, 1))),
+  };
+}
+#endif
+
+inline void AddToBloomBlock(BloomBitsBlock& block,
+                            std::uint64_t hash) noexcept {
+#ifdef __AVX2__
+  const auto masks = MakeBloomMasks(hash);
+  auto* words = reinterpret_cast<__m256i*>(block.words.data());
+  _mm256_store_si256(words,
+                     _mm256_or_si256(_mm256_load_si256(words), masks.low));
+  _mm256_store_si256(
+      words + 1, _mm256_or_si256(_mm256_load_si256(words + 1), masks.high));
+#else
+  const auto lower = static_cast<std::uint32_t>(hash);
+  for (std::size_t i = 0; i < block.words.size(); ++i) {
+    block.words[i] |= std::uint64_t{1} << ((lower * kBloomSalts[i]) >> 26);
+  }
+#endif
+}
+
+inline bool BloomBlockContains(const BloomBitsBlock& block,
+                               std::uint64_t hash) noexcept {
+#ifdef __AVX2__
+  const auto masks = MakeBloomMasks(hash);
+  const auto* words = reinterpret_cast<const __m256i*>(block.words.data());
+  // testc checks that all the bits of the mask are set
+  return _mm256_testc_si256(_mm256_load_si256(words), masks.low) &
+         _mm256_testc_si256(_mm256_load_si256(words + 1), masks.high);
+#else
+  const auto lower = static_cast<std::uint32_t>(hash);
+  std::uint64_t missing = 0;
+  for (std::size_t i = 0; i < block.words.size(); ++i) {
+    const auto mask = std::uint64_t{1} << ((lower * kBloomSalts[i]) >> 26);
+    missing |= mask & ~block.words[i];
+  }
+  return missing == 0;
+#endif
+}
+
+inline std::size_t GetBloomCounterIndex(std::uint64_t hash,
+                                        std::size_t group) noexcept {
+  const auto lower = static_cast<std::uint32_t>(hash);
+  return group * 8 + ((lower * kBloomSalts[group]) >> 29);
+}
+
+template <typename Block>
+std::string_view GetBloomBytes(
+    const utils::FixedArray<Block>& blocks) noexcept {
+  return {reinterpret_cast<const char*>(blocks.data()),
+          blocks.size() * sizeof(Block)};
+}
+
+template <typename Block>
+utils::FixedArray<Block> MakeBloomBlocks(std::string_view bytes) {
+  utils::FixedArray<Block> blocks(GetBloomBlocksCountFromBytes(bytes));
+  std::memcpy(static_cast<void*>(blocks.data()), bytes.data(), bytes.size());
+  return blocks;
+}
+
+}  // namespace impl
+
+/// @ingroup userver_universal
+///
+/// @brief Bloom filter that keeps the bits of each element within a single
+/// cache line
+///
+/// @details Tests whether an element was added to the filter. False positive
+/// matches are possible, but false negatives are not. Unlike
+/// utils::FilterBloom, each lookup reads a single 64-byte block, and the bits
+/// within the block are tested at once with AVX2 when available. Suitable for
+/// caching the negative lookups in front of a database or a remote cache.
+///
+/// The filter can be stored into a cache dump, see
+/// userver/dump/blocked_filter_bloom.hpp.
+///
+/// @param T the type of elements
+/// @param Hash the callable hash struct, the result is mixed before use
+///
+/// Example:
+/// @snippet src/utils/blocked_filter_bloom_test.cpp  Sample usage
+template <typename T, typename Hash = std::hash<T>>
+class BlockedFilterBloom final {
+ public:
+  /// @brief Constructs an empty filter with the specified number of bits,
+  /// rounded up to whole 512-bit blocks
+  /// @note 10 bits per expected element give about 1% of false positives,
+  /// 16 bits give about 0.1%
+  explicit BlockedFilterBloom(std::size_t bits_num = 4096, Hash hash = Hash{})
+      : blocks_(impl::GetBloomBlocksCount(bits_num)),
+        hasher_(std::move(hash)) {}
+
+  /// @brief Restores a filter from the result of GetBytes, which must have
+  /// been produced with the same Hash by the same build
+  static BlockedFilterBloom FromBytes(std::string_view bytes,
+                                      Hash hash = Hash{}) {
+    return BlockedFilterBloom{
+        impl::MakeBloomBlocks<impl::BloomBitsBlock>(bytes), std::move(hash)};
+  }
+
+  /// @brief Adds the element to the filter
+  void Add(const T& item) {
+    const auto hash = HashItem(item);
+    impl::AddToBloomBlock(GetBlock(hash), hash);
+  }
+
+  /// @brief Checks whether the element may have been added to the filter
+  bool Contains(const T& item) const {
+    const auto hash = HashItem(item);
+    return impl::BloomBlockContains(GetBlock(hash), hash);
+  }
+
+  /// @brief Checks the elements in bulk, writing a `bool` for each of them
+  /// to `out`. Faster than separate Contains calls, because the blocks of
+  /// several elements are loaded from memory in parallel.
+  /// @returns the output iterator past the last written value
+  template <typename OutputIt>
+  OutputIt ContainsMany(utils::span<const T> items, OutputIt out) const;
+
+  /// @brief Removes all the elements
+  void Clear() {
+    for (auto& block : blocks_) block = {};
+  }
+
+  /// @brief Returns the number of bits in the filter
+  std::size_t GetBitsCount() const noexcept {
+    return blocks_.size() * impl::kBloomBlockBits;
+  }
+
+  /// @brief Returns the contents of the filter for serialization
+  /// @warning The result is valid while the filter is alive and not modified
+  std::string_view GetBytes() const noexcept {
+    return impl::GetBloomBytes(blocks_);
+  }
+
+ private:
+  static constexpr std::size_t kBatchSize = 16;
+
+  BlockedFilterBloom(utils::FixedArray<impl::BloomBitsBlock>&& blocks,
+                     Hash&& hash)
+      : blocks_(std::move(blocks)), hasher_(std::move(hash)) {}
+
+  std::uint64_t HashItem(const T& item) const {
+    return impl::MixBloomHash(static_cast<std::uint64_t>(hasher_(item)));
+  }
+
+  impl::BloomBitsBlock& GetBlock(std::uint64_t hash) noexcept {
+    return blocks_[impl::GetBloomBlockIndex(hash, blocks_.size())];
+  }
+
+  const impl::BloomBitsBlock& GetBlock(std::uint64_t hash) const noexcept {
+    return blocks_[impl::GetBloomBlockIndex(hash, blocks_.size())];
+  }
+
+  utils::FixedArray<impl::BloomBitsBlock> blocks_;
+  Hash hasher_;
+};
+
+template <typename T, typename Hash>
+template <typename OutputIt>
+OutputIt BlockedFilterBloom<T, Hash>::ContainsMany(utils::span<const T> items,
+                                                   OutputIt out) const {
+  std::array<std::uint64_t, kBatchSize> hashes{};
+  for (std::size_t begin = 0; begin < items.size(); begin += kBatchSize) {
+    const auto count = std::min(kBatchSize, items.size() - begin);
+    for (std::size_t i = 0; i < count; ++i) {
+      hashes[i] = HashItem(items[begin + i]);
+      __builtin_prefetch(&GetBlock(hashes[i]));
+    }
+    for (std::size_t i = 0; i < count; ++i) {
+      *out++ = impl::BloomBlockContains(GetBlock(hashes[i]), hashes[i]);
+    }
+  }
+  return out;
+}
+
+/// @ingroup userver_universal
+///
+/// @brief Counting Bloom filter that keeps the counters of each element
+/// within a single cache line
+///
+/// @details Estimates how many times an element was incremented, never
+/// underestimating it. Has the same interface as utils::FilterBloom, but each
+/// operation touches a single 64-byte block of 8-bit saturating counters.
+///
+/// @param T the type of elements
+/// @param Hash the callable hash struct, the result is mixed before use
+template <typename T, typename Hash = std::hash<T>>
+class BlockedCountingFilterBloom final {
+ public:
+  using Counter = std::uint8_t;
+
+  /// @brief Constructs a filter with the specified number of counters, rounded
+  /// up to whole blocks of 64 counters
+  /// @note If expected to increment n distinct elements, it is recommended to
+  /// set counters_num to 16 * n
+  explicit BlockedCountingFilterBloom(std::size_t counters_num = 256,
+                                      Hash hash = Hash{})
+      : blocks_(impl::GetBloomBlocksCount(counters_num * 8)),
+        hasher_(std::move(hash)) {}
+
+  /// @brief Restores a filter from the result of GetBytes, which must have
+  /// been produced with the same Hash by the same build
+  static BlockedCountingFilterBloom FromBytes(std::string_view bytes,
+                                              Hash hash = Hash{}) {
+    return BlockedCountingFilterBloom{
+        impl::MakeBloomBlocks<impl::BloomCountersBlock>(bytes),
+        std::move(hash)};
+  }
+
+  /// @brief Increments the smallest item counters, saturates at the maximum
+  /// value of the Counter
+  void Increment(const T& item) {
+    const auto hash = HashItem(item);
+    auto& counters = GetBlock(hash).counters;
+    const auto min_count = MinCount(counters, hash);
+    if (min_count == std::numeric_limits<Counter>::max()) return;
+
+    for (std::size_t group = 0; group < 8; ++group) {
+      auto& counter = counters[impl::GetBloomCounterIndex(hash, group)];
+      if (counter == min_count) ++counter;
+    }
+  }
+
+  /// @brief Returns the value of the smallest item counter
+  Counter Estimate(const T& item) const {
+    const auto hash = HashItem(item);
+    return MinCount(GetBlock(hash).counters, hash);
+  }
+
+  /// @brief Checks that all counters of the item have been incremented
+  bool Has(const T& item) const { return Estimate(item) > 0; }
+
+  /// @brief Resets all counters
+  void Clear() {
+    for (auto& block : blocks_) block = {};
+  }
+
+  /// @brief Divides all counters by two, allowing the estimates to follow
+  /// the changes in the frequencies of the elements
+  void Halve() {
+    for (auto& block : blocks_) {
+      for (auto& counter : block.counters) counter /= 2;
+    }
+  }
+
+  /// @brief Returns the contents of the filter for serialization
+  /// @warning The result is valid while the filter is alive and not modified
+  std::string_view GetBytes() const noexcept {
+    return impl::GetBloomBytes(blocks_);
+  }
+
+ private:
+  using Counters = std::array<Counter, impl::kBloomBlockSize>;
+
+  BlockedCountingFilterBloom(
+      utils::FixedArray<impl::BloomCountersBlock>&& blocks, Hash&& hash)
+      : blocks_(std::move(blocks)), hasher_(std::move(hash)) {}
+
+  std::uint64_t HashItem(const T& item) const {
+    return impl::MixBloomHash(static_cast<std::uint64_t>(hasher_(item)));
+  }
+
+  impl::BloomCountersBlock& GetBlock(std::uint64_t hash) noexcept {
+    return blocks_[impl::GetBloomBlockIndex(hash, blocks_.size())];
+  }
+
+  const impl::BloomCountersBlock& GetBlock(std::uint64_t hash) const noexcept {
+    return blocks_[impl::GetBloomBlockIndex(hash, blocks_.size())];
+  }
+
+  static Counter MinCount(const Counters& counters,
+                          std::uint64_t hash) noexcept {
+    Counter result = std::numeric_limits<Counter>::max();
+    for (std::size_t group = 0; group < 8; ++group) {
+      result = std::min(result,
+                        counters[impl::GetBloomCounterIndex(hash, group)]);
+    }
+    return result;
+  }
+
+  utils::FixedArray<impl::BloomCountersBlock> blocks_;
+  Hash hasher_;
+};
+
+}  // namespace utils
+
+USERVER_NAMESPACE_END
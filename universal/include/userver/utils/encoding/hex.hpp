@@ -6,6 +6,7 @@
 
 #include <cstdint>
 #include <string>
+#include <string_view>
 
 USERVER_NAMESPACE_BEGIN
 
@@ -46,6 +47,17 @@ constexpr size_t FromHexUpperBound(size_t size) noexcept {
 /// @param out string to write data. out will be cleared
 void ToHex(std::string_view input, std::string& out) noexcept;
 
+/// @brief Converts input to hex and appends data to output \p out
+/// @param input bytes to convert
+/// @param out string to append data to
+void AppendHex(std::string_view input, std::string& out) noexcept;
+
+/// @brief Converts input to hex and writes data to the caller-provided buffer
+/// @param input bytes to convert
+/// @param out buffer of at least LengthInHexForm(input) characters
+/// @returns pointer past the last written character
+char* ToHex(std::string_view input, char* out) noexcept;
+
 /// @brief Allocates std::string, converts input and writes into said string
 /// @param input range of input bytes
 inline std::string ToHex(std::string_view data) noexcept {
@@ -71,7 +83,7 @@ inline std::string ToHex(const void* encoded, size_t len) noexcept {
 /// how much it was able to process
 ///
 /// @param encoded input range to convert
-/// @param out Result will be written into out. Previous value will be cleared.
+/// @param out Result will be appended to out.
 /// @returns Number of characters successfully parsed.
 size_t FromHex(std::string_view encoded, std::string& out) noexcept;
 
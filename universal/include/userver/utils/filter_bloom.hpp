@@ -5,6 +5,7 @@
 
 #include <array>
 #include <functional>
+#include <limits>
 #include <optional>
 #include <type_traits>
 #include <utility>
@@ -50,7 +51,8 @@ class FilterBloom final {
                             std::invoke_result_t<Hash2, const T&>>));
   }
 
-  /// @brief Increments the smallest item counters
+  /// @brief Increments the smallest item counters, saturates at the maximum
+  /// value of the Counter
   void Increment(const T& item);
 
   /// @brief Returns the value of the smallest item counter
@@ -62,6 +64,10 @@ class FilterBloom final {
   /// @brief Resets all counters
   void Clear();
 
+  /// @brief Divides all counters by two, allowing the estimates to follow
+  /// the changes in the frequencies of the elements
+  void Halve();
+
  private:
   using HashedType = std::invoke_result_t<Hash1, const T&>;
 
@@ -73,8 +79,8 @@ class FilterBloom final {
                        const HashedType& hashed_value_2) const;
 
   utils::FixedArray<Counter> counters_;
-  const Hash1 hasher_1;
-  const Hash2 hasher_2;
+  Hash1 hasher_1;
+  Hash2 hasher_2;
 
   static constexpr std::size_t kHashFunctionsCount = 4;
 };
@@ -114,6 +120,7 @@ void FilterBloom<T, Counter, Hash1, Hash2>::Increment(const T& item) {
   auto hash_value_1 = hasher_1(item);
   auto hash_value_2 = hasher_2(item);
   Counter min_frequency = MinFrequency(hash_value_1, hash_value_2);
+  if (min_frequency == std::numeric_limits<Counter>::max()) return;
 
   for (std::size_t step = 0; step < kHashFunctionsCount; ++step) {
     auto& current_count =
@@ -144,6 +151,13 @@ void FilterBloom<T, Counter, Hash1, Hash2>::Clear() {
   }
 }
 
+template <typename T, typename Counter, typename Hash1, typename Hash2>
+void FilterBloom<T, Counter, Hash1, Hash2>::Halve() {
+  for (auto& counter : counters_) {
+    counter /= 2;
+  }
+}
+
 }  // namespace utils
 
 USERVER_NAMESPACE_END
@@ -10,6 +10,7 @@
 #include <cstdint>
 #include <cstdlib>
 #include <limits>
+#include <optional>
 #include <string>
 #include <string_view>
 #include <type_traits>
@@ -28,6 +29,94 @@ namespace impl {
                                            std::string_view input,
                                            std::type_index resultType);
 
+// Locale-independent and allocation-free parsing of the common case. Returns
+// std::nullopt for hexadecimal numbers, out of range values and invalid input,
+// those are handled (and reported) by the std::strtod based code below.
+template <typename T>
+std::optional<T> TryFromCharsFloating(std::string_view str) noexcept {
+#if defined(__cpp_lib_to_chars) && __cpp_lib_to_chars >= 201611L
+  const char* begin = str.data();
+  const char* const end = str.data() + str.size();
+
+  // to allow leading plus
+  if (str.size() > 1 && str[0] == '+' && str[1] != '-') ++begin;
+
+  T result{};
+  const auto [ptr, error_code] = std::from_chars(begin, end, result);
+  if (error_code == std::errc{} && ptr == end) return result;
+#else
+  static_cast<void>(str);
+#endif
+  return std::nullopt;
+}
+
+// Spelled out for compilers to merge the expressions into a single load
+inline std::uint64_t LoadFourChars(const char* data) noexcept {
+  const auto byte = [data](int i) {
+    return std::uint64_t{static_cast<unsigned char>(data[i])} << (8 * i);
+  };
+  return byte(0) | byte(1) | byte(2) | byte(3);
+}
+
+inline std::uint64_t LoadEightChars(const char* data) noexcept {
+  return LoadFourChars(data) | (LoadFourChars(data + 4) << 32);
+}
+
+inline bool IsEightDigits(std::uint64_t chunk) noexcept {
+  return ((chunk & 0xF0F0F0F0F0F0F0F0ULL) |
+          (((chunk + 0x0606060606060606ULL) & 0xF0F0F0F0F0F0F0F0ULL) >> 4)) ==
+         0x3333333333333333ULL;
+}
+
+// SWAR conversion of 8 ASCII digits, the first digit in the lowest byte
+inline std::uint64_t ParseEightDigits(std::uint64_t chunk) noexcept {
+  chunk -= 0x3030303030303030ULL;
+  chunk = (chunk * 10) + (chunk >> 8);
+  return (((chunk & 0x000000FF000000FFULL) * 0x000F424000000064ULL) +
+          (((chunk >> 16) & 0x000000FF000000FFULL) * 0x0000271000000001ULL)) >>
+         32;
+}
+
+// Same as ParseEightDigits for 4 digits in the lower half of `chunk`
+inline std::uint64_t ParseFourDigits(std::uint64_t chunk) noexcept {
+  chunk -= 0x30303030ULL;
+  chunk = (chunk * 10) + (chunk >> 8);
+  return (((chunk & 0x00FF00FFULL) * ((100 << 16) | 1)) >> 16) & 0xFFFF;
+}
+
+// Parses long numbers 8 digits at a time, several times faster than
+// std::from_chars. Handles only the digits that could not overflow T, returns
+// false for anything else.
+template <typename T>
+bool TryParseLongDecimal(std::string_view digits, T& result) noexcept {
+  constexpr std::size_t kMaxDigits = std::numeric_limits<T>::digits10;
+  if (digits.size() < 8 || digits.size() > kMaxDigits) return false;
+
+  const char* data = digits.data();
+  std::size_t size = digits.size();
+  std::uint64_t value = 0;
+  for (; size >= 8; data += 8, size -= 8) {
+    const auto chunk = LoadEightChars(data);
+    if (!IsEightDigits(chunk)) return false;
+    value = value * 100'000'000 + ParseEightDigits(chunk);
+  }
+  if (size >= 4) {
+    const auto chunk = LoadFourChars(data);
+    if (!IsEightDigits(chunk | 0x3030303000000000ULL)) return false;
+    value = value * 10'000 + ParseFourDigits(chunk);
+    data += 4;
+    size -= 4;
+  }
+  for (; size > 0; ++data, --size) {
+    const unsigned digit = static_cast<unsigned char>(*data) - '0';
+    if (digit > 9) return false;
+    value = value * 10 + digit;
+  }
+
+  result = static_cast<T>(value);
+  return true;
+}
+
 template <typename T>
 std::enable_if_t<std::is_floating_point_v<T>, T> FromString(const char* str) {
   static_assert(!std::is_const_v<T> && !std::is_volatile_v<T>);
@@ -36,6 +125,7 @@ std::enable_if_t<std::is_floating_point_v<T>, T> FromString(const char* str) {
   if (str == nullptr) {
     impl::ThrowFromStringException("nullptr string", "<null>", typeid(T));
   }
+  if (const auto result = impl::TryFromCharsFloating<T>(str)) return *result;
   if (str[0] == '\0') {
     impl::ThrowFromStringException("empty string", str, typeid(T));
   }
@@ -87,6 +177,8 @@ std::enable_if_t<std::is_floating_point_v<T>, T> FromString(
 template <typename T>
 std::enable_if_t<std::is_floating_point_v<T>, T> FromString(
     std::string_view str) {
+  if (const auto result = impl::TryFromCharsFloating<T>(str)) return *result;
+
   static constexpr std::size_t kSmallBufferSize = 32;
 
   if (str.size() >= kSmallBufferSize) {
@@ -125,6 +217,17 @@ std::enable_if_t<meta::kIsInteger<T>, T> FromString(std::string_view str) {
   if (std::is_unsigned_v<T> && str[0] == '-') offset = 1;
 
   T result{};
+  if constexpr (std::numeric_limits<T>::digits10 >= 8) {
+    const bool negative = std::is_signed_v<T> && str[0] == '-';
+    if (!(std::is_unsigned_v<T> && str[0] == '-') &&
+        impl::TryParseLongDecimal(
+            std::string_view{str.data() + offset + negative,
+                             str.size() - offset - negative},
+            result)) {
+      return negative ? static_cast<T>(-result) : result;
+    }
+  }
+
   const auto [end, error_code] =
       std::from_chars(str.data() + offset, str.data() + str.size(), result);
 
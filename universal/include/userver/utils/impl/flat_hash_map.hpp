@@ -0,0 +1,807 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <initializer_list>
+#include <iterator>
+#include <memory>
+#include <new>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
+
+#include <userver/utils/assert.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace utils::impl {
+
+namespace flat_hash {
+
+// Control bytes of a slot: negative values for empty and deleted slots, the
+// 7 bits of H2 of the hash for full slots.
+using ControlByte = std::int8_t;
+inline constexpr ControlByte kEmpty = -128;
+inline constexpr ControlByte kDeleted = -2;
+
+inline bool IsFull(ControlByte control) noexcept { return control >= 0; }
+
+// Positions of the matched control bytes of a Group, each position takes
+// 2^kShift bits of the mask.
+template <typename T, std::size_t kWidth, int kShift>
+class BitMask final {
+ public:
+  explicit BitMask(T mask) noexcept : mask_(mask) {}
+
+  explicit operator bool() const noexcept { return mask_ != 0; }
+
+  std::size_t LowestBit() const noexcept {
+    if constexpr (sizeof(T) <= sizeof(unsigned)) {
+      return static_cast<std::size_t>(__builtin_ctz(mask_)) >> kShift;
+    } else {
+      return static_cast<std::size_t>(__builtin_ctzll(mask_)) >> kShift;
+    }
+  }
+
+  void ClearLowestBit() noexcept { mask_ &= mask_ - 1; }
+
+  std::size_t TrailingZeros() const noexcept {
+    return mask_ ? LowestBit() : kWidth;
+  }
+
+  std::size_t LeadingZeros() const noexcept {
+    if (!mask_) return kWidth;
+    if constexpr (sizeof(T) <= sizeof(unsigned)) {
+      constexpr auto kExtraBits = sizeof(unsigned) * 8 - (kWidth << kShift);
+      return static_cast<std::size_t>(__builtin_clz(mask_) - kExtraBits) >>
+             kShift;
+    } else {
+      constexpr auto kExtraBits =
+          sizeof(unsigned long long) * 8 - (kWidth << kShift);
+      return static_cast<std::size_t>(__builtin_clzll(mask_) - kExtraBits) >>
+             kShift;
+    }
+  }
+
+ private:
+  T mask_;
+};
+
+#ifdef __SSE2__
+// Checks 16 control bytes at once with SSE2 instructions
+class Group final {
+ public:
+  static constexpr std::size_t kWidth = 16;
+
+  explicit Group(const ControlByte* control) noexcept
+      : control_(_mm_loadu_si128(reinterpret_cast<const __m128i*>(control))) {}
+
+  BitMask<std::uint32_t, kWidth, 0> Match(ControlByte h2) const noexcept {
+    return BitMask<std::uint32_t, kWidth, 0>(static_cast<std::uint32_t>(
+        _mm_movemask_epi8(_mm_cmpeq_epi8(_mm_set1_epi8(h2), control_))));
+  }
+
+  BitMask<std::uint32_t, kWidth, 0> MatchEmpty() const noexcept { return Match(kEmpty); }
+
+  // kEmpty and kDeleted are the only control bytes less than -1
+  BitMask<std::uint32_t, kWidth, 0> MatchEmptyOrDeleted() const noexcept {
+    return BitMask<std::uint32_t, kWidth, 0>(static_cast<std::uint32_t>(
+        _mm_movemask_epi8(_mm_cmpgt_epi8(_mm_set1_epi8(-1), control_))));
+  }
+
+ private:
+  __m128i control_;
+};
+#else
+// Checks 8 control bytes at once in a 64-bit integer
+class Group final {
+ public:
+  static constexpr std::size_t kWidth = 8;
+
+  explicit Group(const ControlByte* control) noexcept {
+    const auto* bytes = reinterpret_cast<const unsigned char*>(control);
+    control_ = 0;
+    for (std::size_t i = 0; i < kWidth; ++i) {
+      control_ |= std::uint64_t{bytes[i]} << (i * 8);
+    }
+  }
+
+  // May report false positives for full slots next to a real match, that is
+  // fine as the keys are compared anyway
+  BitMask<std::uint64_t, kWidth, 3> Match(ControlByte h2) const noexcept {
+    const auto x = control_ ^ (kLsbs * static_cast<std::uint8_t>(h2));
+    return BitMask<std::uint64_t, kWidth, 3>((x - kLsbs) & ~x & kMsbs);
+  }
+
+  // kEmpty is the only control byte with the high bit set and the bit 1 clear
+  BitMask<std::uint64_t, kWidth, 3> MatchEmpty() const noexcept {
+    return BitMask<std::uint64_t, kWidth, 3>(control_ & ~(control_ << 6) & kMsbs);
+  }
+
+  BitMask<std::uint64_t, kWidth, 3> MatchEmptyOrDeleted() const noexcept {
+    return BitMask<std::uint64_t, kWidth, 3>(control_ & ~(control_ << 7) & kMsbs);
+  }
+
+ private:
+  static constexpr std::uint64_t kLsbs = 0x0101010101010101ULL;
+  static constexpr std::uint64_t kMsbs = 0x8080808080808080ULL;
+
+  std::uint64_t control_;
+};
+#endif
+
+// Control bytes of a table without slots, lookups stop at the first group
+alignas(16) inline constexpr ControlByte kEmptyGroup[Group::kWidth] = {
+    kEmpty, kEmpty, kEmpty, kEmpty, kEmpty, kEmpty, kEmpty, kEmpty,
+#ifdef __SSE2__
+    kEmpty, kEmpty, kEmpty, kEmpty, kEmpty, kEmpty, kEmpty, kEmpty,
+#endif
+};
+
+template <typename Hash, typename Equal, typename = void>
+inline constexpr bool kIsTransparent = false;
+
+template <typename Hash, typename Equal>
+inline constexpr bool kIsTransparent<
+    Hash, Equal,
+    std::void_t<typename Hash::is_transparent, typename Equal::is_transparent>>
+    = true;
+
+// Stores std::pair<const Key, Value> but moves it as std::pair<Key, Value> on
+// rehash, so that the keys are not copied. Same trick is used by libc++ and
+// Abseil.
+template <typename Key, typename Value>
+struct MapPolicy final {
+  using key_type = Key;
+  using value_type = std::pair<const Key, Value>;
+  using MutableValue = std::pair<Key, Value>;
+
+  static constexpr bool kIsMutable = true;
+
+  union Slot {
+    Slot() noexcept {}
+    ~Slot() {}
+
+    value_type value;
+    MutableValue mutable_value;
+  };
+
+  static const Key& GetKey(const value_type& value) noexcept {
+    return value.first;
+  }
+
+  static void Transfer(Slot* to, Slot* from) noexcept {
+    static_assert(std::is_nothrow_move_constructible_v<MutableValue>);
+    new (&to->mutable_value) MutableValue(std::move(from->mutable_value));
+    from->mutable_value.~MutableValue();
+  }
+};
+
+template <typename Key>
+struct SetPolicy final {
+  using key_type = Key;
+  using value_type = Key;
+
+  // Keys of a set must not be changed through iterators
+  static constexpr bool kIsMutable = false;
+
+  union Slot {
+    Slot() noexcept {}
+    ~Slot() {}
+
+    Key value;
+  };
+
+  static const Key& GetKey(const value_type& value) noexcept { return value; }
+
+  static void Transfer(Slot* to, Slot* from) noexcept {
+    static_assert(std::is_nothrow_move_constructible_v<Key>);
+    new (&to->value) Key(std::move(from->value));
+    from->value.~Key();
+  }
+};
+
+/// @brief Open addressing hash table with SIMD probing of control bytes,
+/// base of FlatHashMap and FlatHashSet.
+///
+/// Each slot has a control byte that holds 7 bits of the hash of its key.
+/// Lookup checks a whole group of control bytes at once and compares the keys
+/// only for the matched slots, so that most of the lookups touch two cache
+/// lines at most. Slots and control bytes live in a single allocation.
+template <typename Policy, typename Hash, typename Equal>
+class Table {
+  using Slot = typename Policy::Slot;
+
+ public:
+  using key_type = typename Policy::key_type;
+  using value_type = typename Policy::value_type;
+  using size_type = std::size_t;
+  using difference_type = std::ptrdiff_t;
+  using hasher = Hash;
+  using key_equal = Equal;
+  using reference = value_type&;
+  using const_reference = const value_type&;
+
+  template <bool kIsConst>
+  class Iterator final {
+   public:
+    using iterator_category = std::forward_iterator_tag;
+    using value_type = typename Policy::value_type;
+    using difference_type = std::ptrdiff_t;
+    using reference =
+        std::conditional_t<kIsConst || !Policy::kIsMutable, const value_type&,
+                           value_type&>;
+    using pointer =
+        std::conditional_t<kIsConst || !Policy::kIsMutable, const value_type*,
+                           value_type*>;
+
+    Iterator() = default;
+
+    template <bool kOtherIsConst,
+              typename = std::enable_if_t<kIsConst && !kOtherIsConst>>
+    // NOLINTNEXTLINE(google-explicit-constructor)
+    Iterator(const Iterator<kOtherIsConst>& other) noexcept
+        : control_(other.control_), slot_(other.slot_), end_(other.end_) {}
+
+    reference operator*() const noexcept { return slot_->value; }
+    pointer operator->() const noexcept { return &slot_->value; }
+
+    Iterator& operator++() noexcept {
+      ++control_;
+      ++slot_;
+      SkipEmpty();
+      return *this;
+    }
+
+    Iterator operator++(int) noexcept {
+      auto copy = *this;
+      ++*this;
+      return copy;
+    }
+
+    friend bool operator==(const Iterator& lhs, const Iterator& rhs) noexcept {
+      return lhs.control_ == rhs.control_;
+    }
+    friend bool operator!=(const Iterator& lhs, const Iterator& rhs) noexcept {
+      return lhs.control_ != rhs.control_;
+    }
+
+   private:
+    friend class Table;
+    template <bool>
+    friend class Iterator;
+
+    Iterator(const ControlByte* control, Slot* slot,
+             const ControlByte* end) noexcept
+        : control_(control), slot_(slot), end_(end) {}
+
+    void SkipEmpty() noexcept {
+      while (control_ != end_ && !IsFull(*control_)) {
+        ++control_;
+        ++slot_;
+      }
+    }
+
+    const ControlByte* control_{nullptr};
+    Slot* slot_{nullptr};
+    const ControlByte* end_{nullptr};
+  };
+
+  using iterator = Iterator<false>;
+  using const_iterator = Iterator<true>;
+
+  Table() = default;
+
+  explicit Table(size_type bucket_count, const Hash& hash = Hash(),
+                 const Equal& equal = Equal())
+      : hash_(hash), equal_(equal) {
+    if (bucket_count) Resize(CapacityFor(bucket_count));
+  }
+
+  Table(const Table& other)
+      : hash_(other.hash_),
+        equal_(other.equal_) {
+    if (other.size_) Resize(CapacityFor(other.size_));
+    for (const auto& value : other) InsertUnique(value);
+  }
+
+  Table(Table&& other) noexcept
+      : hash_(other.hash_),
+        equal_(other.equal_),
+        control_(std::exchange(other.control_, EmptyControl())),
+        slots_(std::exchange(other.slots_, nullptr)),
+        capacity_(std::exchange(other.capacity_, 0)),
+        size_(std::exchange(other.size_, 0)),
+        growth_left_(std::exchange(other.growth_left_, 0)) {}
+
+  Table& operator=(const Table& other) {
+    if (this != &other) {
+      Table copy(other);
+      swap(copy);
+    }
+    return *this;
+  }
+
+  Table& operator=(Table&& other) noexcept {
+    if (this != &other) {
+      Table moved(std::move(other));
+      swap(moved);
+    }
+    return *this;
+  }
+
+  ~Table() { DestroyAndDeallocate(); }
+
+  iterator begin() noexcept {
+    iterator it{control_, slots_, control_ + capacity_};
+    it.SkipEmpty();
+    return it;
+  }
+  iterator end() noexcept {
+    return {control_ + capacity_, slots_ + capacity_, control_ + capacity_};
+  }
+  const_iterator begin() const noexcept {
+    return const_cast<Table&>(*this).begin();
+  }
+  const_iterator end() const noexcept {
+    return const_cast<Table&>(*this).end();
+  }
+  const_iterator cbegin() const noexcept { return begin(); }
+  const_iterator cend() const noexcept { return end(); }
+
+  bool empty() const noexcept { return size_ == 0; }
+  size_type size() const noexcept { return size_; }
+  size_type capacity() const noexcept { return capacity_; }
+
+  hasher hash_function() const { return hash_; }
+  key_equal key_eq() const { return equal_; }
+
+  /// Destroys all the elements, keeps the allocated memory
+  void clear() noexcept {
+    if (size_ == 0 && growth_left_ == MaxLoad(capacity_)) return;
+    DestroyElements();
+    if (capacity_) {
+      std::memset(control_, kEmpty, capacity_ + Group::kWidth);
+    }
+    size_ = 0;
+    growth_left_ = MaxLoad(capacity_);
+  }
+
+  void reserve(size_type count) {
+    if (count > size_ + growth_left_) Resize(CapacityFor(count));
+  }
+
+  void swap(Table& other) noexcept {
+    using std::swap;
+    swap(hash_, other.hash_);
+    swap(equal_, other.equal_);
+    swap(control_, other.control_);
+    swap(slots_, other.slots_);
+    swap(capacity_, other.capacity_);
+    swap(size_, other.size_);
+    swap(growth_left_, other.growth_left_);
+  }
+
+  friend void swap(Table& lhs, Table& rhs) noexcept { lhs.swap(rhs); }
+
+  iterator find(const key_type& key) { return FindImpl(key); }
+  const_iterator find(const key_type& key) const {
+    return const_cast<Table&>(*this).FindImpl(key);
+  }
+
+  template <typename K, typename H = Hash,
+            typename = std::enable_if_t<kIsTransparent<H, Equal>>>
+  iterator find(const K& key) {
+    return FindImpl(key);
+  }
+  template <typename K, typename H = Hash,
+            typename = std::enable_if_t<kIsTransparent<H, Equal>>>
+  const_iterator find(const K& key) const {
+    return const_cast<Table&>(*this).FindImpl(key);
+  }
+
+  bool contains(const key_type& key) const { return find(key) != end(); }
+
+  template <typename K, typename H = Hash,
+            typename = std::enable_if_t<kIsTransparent<H, Equal>>>
+  bool contains(const K& key) const {
+    return find(key) != end();
+  }
+
+  size_type count(const key_type& key) const { return contains(key) ? 1 : 0; }
+
+  template <typename K, typename H = Hash,
+            typename = std::enable_if_t<kIsTransparent<H, Equal>>>
+  size_type count(const K& key) const {
+    return contains(key) ? 1 : 0;
+  }
+
+  /// Returns the iterator to the element following the erased one
+  iterator erase(const_iterator pos) noexcept {
+    UASSERT(pos != end());
+    const auto index = static_cast<size_type>(pos.slot_ - slots_);
+    EraseAt(index);
+    iterator next{control_ + index, slots_ + index, control_ + capacity_};
+    next.SkipEmpty();
+    return next;
+  }
+
+  iterator erase(iterator pos) noexcept { return erase(const_iterator{pos}); }
+
+  size_type erase(const key_type& key) { return EraseKey(key); }
+
+  template <typename K, typename H = Hash,
+            typename = std::enable_if_t<kIsTransparent<H, Equal>>>
+  size_type erase(const K& key) {
+    return EraseKey(key);
+  }
+
+ protected:
+  // Finds the key or constructs a new element with `construct(slot_value)`
+  template <typename K, typename Construct>
+  std::pair<iterator, bool> FindOrConstruct(const K& key,
+                                            Construct&& construct) {
+    const auto hash = MixHash(key);
+    const auto found = FindIndex(key, hash);
+    if (found != capacity_) return {IteratorAt(found), false};
+
+    // A deleted slot may be reused even if there is no growth left
+    auto index = capacity_ ? FindInsertIndex(hash) : capacity_;
+    if (growth_left_ == 0 &&
+        (index == capacity_ || control_[index] != kDeleted)) {
+      Resize(CapacityFor(size_ + 1));
+      index = FindInsertIndex(hash);
+    }
+
+    construct(&slots_[index].value);
+    if (control_[index] == kEmpty) --growth_left_;
+    SetControl(index, H2(hash));
+    ++size_;
+    return {IteratorAt(index), true};
+  }
+
+ private:
+  static ControlByte* EmptyControl() noexcept {
+    // Never written to, as tables without slots have no growth left
+    return const_cast<ControlByte*>(kEmptyGroup);
+  }
+
+  static constexpr size_type kMinCapacity = 4;
+
+  static constexpr size_type MaxLoad(size_type capacity) noexcept {
+    // Tables of a single group never wrap around and always have the trailing
+    // empty control bytes, so they may be filled completely
+    return capacity < Group::kWidth ? capacity : capacity - capacity / 8;
+  }
+
+  static size_type CapacityFor(size_type count) noexcept {
+    size_type capacity = kMinCapacity;
+    while (MaxLoad(capacity) < count) capacity *= 2;
+    return capacity;
+  }
+
+  // Multiplication spreads the entropy of poor hashes (e.g. identity hash of
+  // integers) over the high bits, which are used for H2 and probing.
+  template <typename K>
+  std::uint64_t MixHash(const K& key) const {
+    const auto hash = static_cast<std::uint64_t>(hash_(key));
+    return hash * 0x9e3779b97f4a7c15ULL;
+  }
+
+  static ControlByte H2(std::uint64_t hash) noexcept {
+    return static_cast<ControlByte>(hash >> 57);
+  }
+
+  size_type ProbeStart(std::uint64_t hash) const noexcept {
+    // Tables of a single group are always probed from the start
+    if (capacity_ <= Group::kWidth) return 0;
+    return static_cast<size_type>(hash ^ (hash >> 29)) & (capacity_ - 1);
+  }
+
+  template <typename K>
+  size_type FindIndex(const K& key, std::uint64_t hash) const {
+    const auto h2 = H2(hash);
+    const auto mask = capacity_ - 1;
+    auto offset = ProbeStart(hash);
+    for (size_type step = Group::kWidth;; step += Group::kWidth) {
+      const Group group{control_ + offset};
+      for (auto match = group.Match(h2); match; match.ClearLowestBit()) {
+        const auto index = (offset + match.LowestBit()) & mask;
+        if (equal_(Policy::GetKey(slots_[index].value), key)) return index;
+      }
+      if (group.MatchEmpty()) return capacity_;
+      offset = (offset + step) & mask;
+    }
+  }
+
+  size_type FindInsertIndex(std::uint64_t hash) const noexcept {
+    UASSERT(capacity_ > 0);
+    const auto mask = capacity_ - 1;
+    auto offset = ProbeStart(hash);
+    for (size_type step = Group::kWidth;; step += Group::kWidth) {
+      const Group group{control_ + offset};
+      if (auto match = group.MatchEmptyOrDeleted()) {
+        return (offset + match.LowestBit()) & mask;
+      }
+      offset = (offset + step) & mask;
+    }
+  }
+
+  template <typename K>
+  iterator FindImpl(const K& key) {
+    const auto index = FindIndex(key, MixHash(key));
+    return index == capacity_ ? end() : IteratorAt(index);
+  }
+
+  template <typename K>
+  size_type EraseKey(const K& key) {
+    const auto index = FindIndex(key, MixHash(key));
+    if (index == capacity_) return 0;
+    EraseAt(index);
+    return 1;
+  }
+
+  void EraseAt(size_type index) noexcept {
+    slots_[index].value.~value_type();
+    --size_;
+
+    // The slot may become empty again if no probe sequence could have passed
+    // through it, i.e. every window of kWidth slots that contains it also
+    // contains an empty slot. Single group tables are never probed further.
+    if (capacity_ <= Group::kWidth) {
+      SetControl(index, kEmpty);
+      ++growth_left_;
+      return;
+    }
+    const auto mask = capacity_ - 1;
+    const Group after{control_ + index};
+    const Group before{control_ + ((index - Group::kWidth) & mask)};
+    if (before.MatchEmpty().LeadingZeros() +
+            after.MatchEmpty().TrailingZeros() <
+        Group::kWidth) {
+      SetControl(index, kEmpty);
+      ++growth_left_;
+    } else {
+      SetControl(index, kDeleted);
+    }
+  }
+
+  iterator IteratorAt(size_type index) noexcept {
+    return {control_ + index, slots_ + index, control_ + capacity_};
+  }
+
+  // The first kWidth control bytes are cloned after the last one, so that a
+  // group may be loaded at any position of a table larger than a group.
+  void SetControl(size_type index, ControlByte control) noexcept {
+    control_[index] = control;
+    if (capacity_ > Group::kWidth && index < Group::kWidth) {
+      control_[capacity_ + index] = control;
+    }
+  }
+
+  template <typename V>
+  void InsertUnique(V&& value) {
+    const auto hash = MixHash(Policy::GetKey(value));
+    const auto index = FindInsertIndex(hash);
+    UASSERT(growth_left_ > 0);
+    new (&slots_[index].value) value_type(std::forward<V>(value));
+    --growth_left_;
+    SetControl(index, H2(hash));
+    ++size_;
+  }
+
+  static size_type ControlOffset(size_type capacity) noexcept {
+    return capacity * sizeof(Slot);
+  }
+
+  static size_type AllocationSize(size_type capacity) noexcept {
+    const auto size = ControlOffset(capacity) + capacity + Group::kWidth;
+    return (size + sizeof(Slot) - 1) / sizeof(Slot);
+  }
+
+  // Slots go first to keep their alignment, control bytes follow them
+  void Resize(size_type new_capacity) {
+    UASSERT(new_capacity >= kMinCapacity);
+    UASSERT((new_capacity & (new_capacity - 1)) == 0);
+    UASSERT(MaxLoad(new_capacity) >= size_);
+
+    auto* new_slots = std::allocator<Slot>{}.allocate(
+        AllocationSize(new_capacity));
+    auto* new_control = reinterpret_cast<ControlByte*>(
+        reinterpret_cast<char*>(new_slots) + ControlOffset(new_capacity));
+    std::memset(new_control, kEmpty, new_capacity + Group::kWidth);
+
+    auto* old_control = control_;
+    auto* old_slots = slots_;
+    const auto old_capacity = capacity_;
+
+    control_ = new_control;
+    slots_ = new_slots;
+    capacity_ = new_capacity;
+    growth_left_ = MaxLoad(new_capacity) - size_;
+
+    for (size_type i = 0; i < old_capacity; ++i) {
+      if (!IsFull(old_control[i])) continue;
+      const auto hash = MixHash(Policy::GetKey(old_slots[i].value));
+      const auto index = FindInsertIndex(hash);
+      SetControl(index, H2(hash));
+      Policy::Transfer(&slots_[index], &old_slots[i]);
+    }
+
+    if (old_slots) {
+      std::allocator<Slot>{}.deallocate(old_slots,
+                                        AllocationSize(old_capacity));
+    }
+  }
+
+  void DestroyElements() noexcept {
+    if constexpr (!std::is_trivially_destructible_v<value_type>) {
+      for (size_type i = 0; i < capacity_; ++i) {
+        if (IsFull(control_[i])) slots_[i].value.~value_type();
+      }
+    }
+  }
+
+  void DestroyAndDeallocate() noexcept {
+    if (!slots_) return;
+    DestroyElements();
+    std::allocator<Slot>{}.deallocate(slots_, AllocationSize(capacity_));
+  }
+
+  Hash hash_{};
+  Equal equal_{};
+  ControlByte* control_{EmptyControl()};
+  Slot* slots_{nullptr};
+  size_type capacity_{0};
+  size_type size_{0};
+  size_type growth_left_{0};
+};
+
+}  // namespace flat_hash
+
+/// @brief Flat hash map with open addressing, a drop-in replacement for
+/// std::unordered_map in hot internal code paths.
+///
+/// Elements are stored inline in a single array, so lookups do not chase
+/// pointers. Unlike std::unordered_map, references and iterators are
+/// invalidated on rehash and the elements must be nothrow movable.
+///
+/// Lookup is heterogeneous if both Hash and Equal are transparent.
+template <typename Key, typename Value, typename Hash = std::hash<Key>,
+          typename Equal = std::equal_to<Key>>
+class FlatHashMap final
+    : public flat_hash::Table<flat_hash::MapPolicy<Key, Value>, Hash, Equal> {
+  using Base = flat_hash::Table<flat_hash::MapPolicy<Key, Value>, Hash, Equal>;
+
+ public:
+  using mapped_type = Value;
+  using typename Base::iterator;
+  using typename Base::key_type;
+  using typename Base::size_type;
+  using typename Base::value_type;
+
+  using Base::Base;
+
+  FlatHashMap() = default;
+
+  FlatHashMap(std::initializer_list<value_type> values,
+              size_type bucket_count = 0, const Hash& hash = Hash(),
+              const Equal& equal = Equal())
+      : Base(std::max(bucket_count, values.size()), hash, equal) {
+    for (const auto& value : values) insert(value);
+  }
+
+  std::pair<iterator, bool> insert(const value_type& value) {
+    return this->FindOrConstruct(value.first, [&](value_type* place) {
+      new (place) value_type(value);
+    });
+  }
+
+  std::pair<iterator, bool> insert(value_type&& value) {
+    return this->FindOrConstruct(value.first, [&](value_type* place) {
+      new (place) value_type(std::move(value));
+    });
+  }
+
+  /// Does nothing if the key is already present, unlike std::unordered_map
+  /// the key and the value are passed separately.
+  template <typename K, typename... Args>
+  std::pair<iterator, bool> emplace(K&& key, Args&&... args) {
+    return try_emplace(std::forward<K>(key), std::forward<Args>(args)...);
+  }
+
+  template <typename K, typename... Args>
+  std::pair<iterator, bool> try_emplace(K&& key, Args&&... args) {
+    if constexpr (!flat_hash::kIsTransparent<Hash, Equal> &&
+                  !std::is_same_v<std::decay_t<K>, Key>) {
+      // The hash of a non-transparent hasher is only valid for the key_type
+      return try_emplace(Key(std::forward<K>(key)),
+                         std::forward<Args>(args)...);
+    } else {
+      return this->FindOrConstruct(key, [&](value_type* place) {
+        new (place) value_type(
+            std::piecewise_construct,
+            std::forward_as_tuple(std::forward<K>(key)),
+            std::forward_as_tuple(std::forward<Args>(args)...));
+      });
+    }
+  }
+
+  template <typename K, typename V>
+  std::pair<iterator, bool> insert_or_assign(K&& key, V&& value) {
+    auto result = try_emplace(std::forward<K>(key), std::forward<V>(value));
+    if (!result.second) result.first->second = std::forward<V>(value);
+    return result;
+  }
+
+  Value& operator[](const Key& key) { return try_emplace(key).first->second; }
+  Value& operator[](Key&& key) {
+    return try_emplace(std::move(key)).first->second;
+  }
+
+  template <typename K>
+  Value& at(const K& key) {
+    const auto it = this->find(key);
+    if (it == this->end()) throw std::out_of_range("FlatHashMap::at");
+    return it->second;
+  }
+
+  template <typename K>
+  const Value& at(const K& key) const {
+    const auto it = this->find(key);
+    if (it == this->end()) throw std::out_of_range("FlatHashMap::at");
+    return it->second;
+  }
+};
+
+/// @brief Flat hash set with open addressing, a drop-in replacement for
+/// std::unordered_set in hot internal code paths.
+///
+/// @see utils::impl::FlatHashMap
+template <typename Key, typename Hash = std::hash<Key>,
+          typename Equal = std::equal_to<Key>>
+class FlatHashSet final
+    : public flat_hash::Table<flat_hash::SetPolicy<Key>, Hash, Equal> {
+  using Base = flat_hash::Table<flat_hash::SetPolicy<Key>, Hash, Equal>;
+
+ public:
+  using typename Base::iterator;
+  using typename Base::size_type;
+  using typename Base::value_type;
+
+  using Base::Base;
+
+  FlatHashSet() = default;
+
+  FlatHashSet(std::initializer_list<Key> values, size_type bucket_count = 0,
+              const Hash& hash = Hash(), const Equal& equal = Equal())
+      : Base(std::max(bucket_count, values.size()), hash, equal) {
+    for (const auto& value : values) insert(value);
+  }
+
+  std::pair<iterator, bool> insert(const Key& value) {
+    return this->FindOrConstruct(
+        value, [&](Key* place) { new (place) Key(value); });
+  }
+
+  std::pair<iterator, bool> insert(Key&& value) {
+    return this->FindOrConstruct(
+        value, [&](Key* place) { new (place) Key(std::move(value)); });
+  }
+
+  template <typename... Args>
+  std::pair<iterator, bool> emplace(Args&&... args) {
+    return insert(Key(std::forward<Args>(args)...));
+  }
+};
+
+}  // namespace utils::impl
+
+USERVER_NAMESPACE_END
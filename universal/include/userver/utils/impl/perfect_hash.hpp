@@ -0,0 +1,228 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <string_view>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace utils::impl {
+
+constexpr std::size_t PerfectHashCeilPow2(std::size_t value) noexcept {
+  std::size_t result = 1;
+  while (result < value) result <<= 1;
+  return result;
+}
+
+constexpr std::size_t PerfectHashLog2(std::size_t pow2) noexcept {
+  std::size_t result = 0;
+  while ((std::size_t{1} << result) < pow2) ++result;
+  return result;
+}
+
+constexpr std::uint64_t PerfectHashMix(std::uint64_t value) noexcept {
+  value ^= value >> 32;
+  value *= 0xd6e8feb86659fd93ULL;
+  value ^= value >> 32;
+  value *= 0xd6e8feb86659fd93ULL;
+  value ^= value >> 32;
+  return value;
+}
+
+constexpr std::uint64_t PerfectHashByte(const char* data,
+                                        std::size_t i) noexcept {
+  return std::uint64_t{static_cast<unsigned char>(data[i])};
+}
+
+// Spelled out for compilers to merge the expression into a single load
+constexpr std::uint64_t PerfectHashRead4(const char* data) noexcept {
+  return PerfectHashByte(data, 0) | (PerfectHashByte(data, 1) << 8) |
+         (PerfectHashByte(data, 2) << 16) | (PerfectHashByte(data, 3) << 24);
+}
+
+constexpr std::uint64_t PerfectHashRead8(const char* data) noexcept {
+  return PerfectHashRead4(data) | (PerfectHashRead4(data + 4) << 32);
+}
+
+constexpr std::uint64_t PerfectHashRound(std::uint64_t hash,
+                                         std::uint64_t chunk) noexcept {
+  hash = (hash ^ chunk) * 0x9e3779b97f4a7c15ULL;
+  return hash ^ (hash >> 31);
+}
+
+/// Hash of a string usable both in constant expressions and at runtime,
+/// processes 8 bytes at a time
+constexpr std::uint64_t PerfectHashString(std::string_view value,
+                                          std::uint64_t seed) noexcept {
+  const char* data = value.data();
+  const std::size_t size = value.size();
+  std::uint64_t hash = seed ^ (size * 0xff51afd7ed558ccdULL);
+
+  if (size >= 8) {
+    for (std::size_t i = 0; i + 8 < size; i += 8) {
+      hash = PerfectHashRound(hash, PerfectHashRead8(data + i));
+    }
+    hash = PerfectHashRound(hash, PerfectHashRead8(data + size - 8));
+  } else if (size >= 4) {
+    hash = PerfectHashRound(hash, (PerfectHashRead4(data) << 32) |
+                                      PerfectHashRead4(data + size - 4));
+  } else if (size > 0) {
+    hash = PerfectHashRound(hash, (PerfectHashByte(data, 0) << 16) |
+                                      (PerfectHashByte(data, size / 2) << 8) |
+                                      PerfectHashByte(data, size - 1));
+  }
+
+  return hash;
+}
+
+/// @brief Immutable string to Value map built in compile time.
+///
+/// Uses the "hash and displace" scheme of CHD/PTHash: keys are split into
+/// buckets by the low bits of their hash, then for each bucket, starting from
+/// the largest one, a pilot value is searched that places all the keys of the
+/// bucket into free slots. Lookup computes one hash, reads the pilot of the
+/// bucket and compares a single slot.
+///
+/// For duplicate keys only the first occurrence is stored. If no perfect hash
+/// is found for kMaxSeeds seeds, IsValid() returns false.
+template <typename Value, std::size_t N>
+class StringPerfectHash final {
+ public:
+  static_assert(N > 0);
+
+  static constexpr std::size_t kSlots = PerfectHashCeilPow2(N + N / 4 + 1);
+  static constexpr std::size_t kBuckets = PerfectHashCeilPow2((N + 3) / 4);
+  static constexpr std::size_t kSlotsShift = 64 - PerfectHashLog2(kSlots);
+  static constexpr std::uint64_t kMaxSeeds = 8;
+  static constexpr std::uint32_t kMaxPilot = 1 << 16;
+
+  constexpr StringPerfectHash(const std::array<std::string_view, N>& keys,
+                              const std::array<Value, N>& values) noexcept {
+    for (seed_ = 0; seed_ < kMaxSeeds; ++seed_) {
+      if (TryBuild(keys, values)) {
+        valid_ = true;
+        return;
+      }
+    }
+  }
+
+  constexpr bool IsValid() const noexcept { return valid_; }
+
+  constexpr std::optional<Value> Find(std::string_view key) const noexcept {
+    const auto hash = PerfectHashString(key, seed_);
+    const auto slot = GetSlot(hash, pilots_[hash & (kBuckets - 1)]);
+    if (!occupied_[slot] || keys_[slot] != key) return std::nullopt;
+    return values_[slot];
+  }
+
+ private:
+  // Multiplication makes the slots of keys from one bucket depend on all
+  // the bits of the pilot, a plain XOR could not separate keys whose slots
+  // collide.
+  static constexpr std::size_t GetSlot(std::uint64_t hash,
+                                       std::uint64_t pilot) noexcept {
+    return ((hash ^ pilot) * 0x9e3779b97f4a7c15ULL) >> kSlotsShift;
+  }
+
+  constexpr bool TryBuild(const std::array<std::string_view, N>& keys,
+                          const std::array<Value, N>& values) noexcept {
+    std::array<std::uint64_t, N> hashes{};
+    std::array<std::size_t, kBuckets + 1> bucket_begin{};
+    for (std::size_t i = 0; i < N; ++i) {
+      hashes[i] = PerfectHashString(keys[i], seed_);
+      ++bucket_begin[(hashes[i] & (kBuckets - 1)) + 1];
+    }
+    for (std::size_t b = 0; b < kBuckets; ++b) {
+      bucket_begin[b + 1] += bucket_begin[b];
+    }
+
+    // Stable counting sort, keeps the original order of keys in a bucket
+    std::array<std::size_t, N> members{};
+    std::array<std::size_t, kBuckets> bucket_end{};
+    for (std::size_t b = 0; b < kBuckets; ++b) bucket_end[b] = bucket_begin[b];
+    for (std::size_t i = 0; i < N; ++i) {
+      members[bucket_end[hashes[i] & (kBuckets - 1)]++] = i;
+    }
+
+    // Equal keys have equal hashes, so duplicates are always in one bucket
+    std::array<bool, N> skipped{};
+    std::size_t max_bucket_size = 0;
+    for (std::size_t b = 0; b < kBuckets; ++b) {
+      std::size_t bucket_size = 0;
+      for (auto i = bucket_begin[b]; i < bucket_end[b]; ++i) {
+        for (auto j = bucket_begin[b]; j < i && !skipped[members[i]]; ++j) {
+          skipped[members[i]] = !skipped[members[j]] &&
+                                keys[members[i]] == keys[members[j]];
+        }
+        if (!skipped[members[i]]) ++bucket_size;
+      }
+      if (bucket_size > max_bucket_size) max_bucket_size = bucket_size;
+      bucket_end[b] = bucket_begin[b] + bucket_size;
+    }
+    // Move non-skipped members to the front of each bucket
+    for (std::size_t b = 0; b < kBuckets; ++b) {
+      auto out = bucket_begin[b];
+      for (auto i = bucket_begin[b]; out < bucket_end[b]; ++i) {
+        if (!skipped[members[i]]) members[out++] = members[i];
+      }
+    }
+
+    occupied_ = {};
+    pilots_ = {};
+    for (auto size = max_bucket_size; size > 0; --size) {
+      for (std::size_t b = 0; b < kBuckets; ++b) {
+        if (bucket_end[b] - bucket_begin[b] != size) continue;
+        if (!PlaceBucket(keys, values, hashes, members, bucket_begin[b],
+                         bucket_end[b], pilots_[b])) {
+          return false;
+        }
+      }
+    }
+    return true;
+  }
+
+  constexpr bool PlaceBucket(const std::array<std::string_view, N>& keys,
+                             const std::array<Value, N>& values,
+                             const std::array<std::uint64_t, N>& hashes,
+                             const std::array<std::size_t, N>& members,
+                             std::size_t begin, std::size_t end,
+                             std::uint64_t& pilot_out) noexcept {
+    for (std::uint32_t pilot = 0; pilot < kMaxPilot; ++pilot) {
+      const auto mixed_pilot = PerfectHashMix(pilot + 1);
+      auto placed = begin;
+      for (; placed < end; ++placed) {
+        const auto slot = GetSlot(hashes[members[placed]], mixed_pilot);
+        if (occupied_[slot]) break;
+        occupied_[slot] = true;
+      }
+
+      if (placed == end) {
+        for (auto i = begin; i < end; ++i) {
+          const auto slot = GetSlot(hashes[members[i]], mixed_pilot);
+          keys_[slot] = keys[members[i]];
+          values_[slot] = values[members[i]];
+        }
+        pilot_out = mixed_pilot;
+        return true;
+      }
+
+      for (auto i = begin; i < placed; ++i) {
+        occupied_[GetSlot(hashes[members[i]], mixed_pilot)] = false;
+      }
+    }
+    return false;
+  }
+
+  std::array<std::uint64_t, kBuckets> pilots_{};
+  std::array<std::string_view, kSlots> keys_{};
+  std::array<Value, kSlots> values_{};
+  std::array<bool, kSlots> occupied_{};
+  std::uint64_t seed_{0};
+  bool valid_{false};
+};
+
+}  // namespace utils::impl
+
+USERVER_NAMESPACE_END
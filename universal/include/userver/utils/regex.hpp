@@ -3,7 +3,11 @@
 /// @file userver/utils/regex.hpp
 /// @brief @copybrief utils::regex
 
+#include <cstddef>
+#include <memory>
 #include <string>
+#include <string_view>
+#include <vector>
 
 #include <userver/utils/fast_pimpl.hpp>
 
@@ -13,6 +17,25 @@ namespace utils {
 
 class smatch;
 
+/// @brief Regular expression engines of utils::regex and utils::RegexSet
+enum class RegexEngine {
+  /// boost::regex with the Perl syntax, including backreferences and
+  /// lookarounds. Matching may take time exponential in the input size.
+  kBoost,
+  /// RE2, matching takes time linear in the input size. The syntax lacks
+  /// backreferences and lookarounds. Available only if userver is built with
+  /// USERVER_FEATURE_RE2.
+  kRe2,
+};
+
+/// @brief Returns true if userver is built with RE2 (USERVER_FEATURE_RE2)
+bool IsRe2Available() noexcept;
+
+/// @brief Returns the engine of utils::regex constructed without an explicit
+/// one: RegexEngine::kRe2 if userver is built with
+/// USERVER_FEATURE_RE2_BY_DEFAULT, RegexEngine::kBoost otherwise.
+RegexEngine GetDefaultRegexEngine() noexcept;
+
 /// @ingroup userver_universal userver_containers
 ///
 /// @brief Small alias for boost::regex / std::regex without huge includes
@@ -21,6 +44,10 @@ class regex final {
   regex();
   explicit regex(std::string_view pattern);
 
+  /// @throws std::runtime_error if the pattern is invalid or the engine is
+  /// not available
+  regex(std::string_view pattern, RegexEngine engine);
+
   ~regex();
 
   regex(const regex&);
@@ -33,9 +60,11 @@ class regex final {
 
   std::string str() const;
 
+  RegexEngine engine() const;
+
  private:
   struct Impl;
-  utils::FastPimpl<Impl, 16, 8> impl_;
+  utils::FastPimpl<Impl, 32, 8> impl_;
 
   friend class smatch;
   friend bool regex_match(std::string_view str, const regex& pattern);
@@ -66,7 +95,7 @@ class smatch final {
 
  private:
   struct Impl;
-  utils::FastPimpl<Impl, 80, 8> impl_;
+  utils::FastPimpl<Impl, 104, 8> impl_;
 
   friend bool regex_match(std::string_view str, const regex& pattern);
   friend bool regex_match(const std::string& str, smatch& m,
@@ -96,9 +125,48 @@ bool regex_search(std::string_view str, const regex& pattern);
 
 /// @brief Create a new string where all regular expression matches replaced
 /// with repl
+///
+/// `repl` uses the Perl format for both engines: `$&` is the whole match,
+/// `$n` and `${n}` are the subexpressions, `$$` is a literal `$`.
 std::string regex_replace(std::string_view str, const regex& pattern,
                           std::string_view repl);
 
+/// @ingroup userver_universal userver_containers
+///
+/// @brief A set of regular expressions to find all the matching ones at once.
+///
+/// With RegexEngine::kRe2 the input is scanned once for all the patterns in
+/// time linear in its size, otherwise the patterns are tried one by one.
+class RegexSet final {
+ public:
+  /// How the patterns are matched against the input
+  enum class Anchor {
+    /// The pattern matches the whole input, as in regex_match
+    kBoth,
+    /// The pattern matches anywhere in the input, as in regex_search
+    kNone,
+  };
+
+  /// @throws std::runtime_error if any of the patterns is invalid or the
+  /// engine is not available
+  RegexSet(const std::vector<std::string>& patterns, Anchor anchor,
+           RegexEngine engine = GetDefaultRegexEngine());
+
+  RegexSet(RegexSet&&) noexcept;
+  RegexSet& operator=(RegexSet&&) noexcept;
+  ~RegexSet();
+
+  /// @returns sorted indices of the patterns that match `str`
+  std::vector<std::size_t> Match(std::string_view str) const;
+
+  /// @returns true if any of the patterns matches `str`
+  bool MatchAny(std::string_view str) const;
+
+ private:
+  struct Impl;
+  std::unique_ptr<Impl> impl_;
+};
+
 }  // namespace utils
 
 USERVER_NAMESPACE_END
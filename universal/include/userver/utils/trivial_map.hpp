@@ -3,6 +3,7 @@
 /// @file userver/utils/trivial_map.hpp
 /// @brief Bidirectional map|sets over string literals or other trivial types.
 
+#include <array>
 #include <cstddef>
 #include <optional>
 #include <string>
@@ -15,6 +16,13 @@
 
 #include <userver/compiler/demangle.hpp>
 #include <userver/utils/assert.hpp>
+#include <userver/utils/impl/perfect_hash.hpp>
+
+#if defined(__has_builtin)
+#if __has_builtin(__builtin_bit_cast)
+#define USERVER_IMPL_HAS_BUILTIN_BIT_CAST
+#endif
+#endif
 
 USERVER_NAMESPACE_BEGIN
 
@@ -576,6 +584,137 @@ class CaseFirstIndexer final {
   std::size_t index_ = 0;
 };
 
+template <typename First, typename Second, std::size_t N>
+class CaseCollector final {
+ public:
+  constexpr CaseCollector& Case(First first, Second second) noexcept {
+    firsts[index_] = first;
+    seconds[index_] = second;
+    ++index_;
+    return *this;
+  }
+
+  template <typename T, typename U>
+  constexpr CaseCollector& Type() {
+    return *this;
+  }
+
+  std::array<First, N> firsts{};
+  std::array<Second, N> seconds{};
+
+ private:
+  std::size_t index_{0};
+};
+
+// For TrivialSet the index of a Case is collected as a second value
+template <typename First, std::size_t N>
+class CaseCollector<First, void, N> final {
+ public:
+  constexpr CaseCollector& Case(First first) noexcept {
+    firsts[index_] = first;
+    seconds[index_] = index_;
+    ++index_;
+    return *this;
+  }
+
+  template <typename T, typename U = void>
+  constexpr CaseCollector& Type() {
+    return *this;
+  }
+
+  std::array<First, N> firsts{};
+  std::array<std::size_t, N> seconds{};
+
+ private:
+  std::size_t index_{0};
+};
+
+/// Lookups of string keys in maps with at least that many Case statements use
+/// a perfect hash built in compile time instead of a chain of comparisons.
+/// Compilers tend to give up optimizing longer chains into a switch.
+inline constexpr std::size_t kTrivialMapPerfectHashThreshold = 64;
+
+// Captureless lambdas are not default constructible before C++20, however
+// an object of an empty trivially copyable type could be made from any byte.
+template <typename BuilderFunc>
+inline constexpr bool kIsStatelessBuilder =
+    std::is_empty_v<BuilderFunc> &&
+    std::is_trivially_copyable_v<BuilderFunc> && sizeof(BuilderFunc) == 1 &&
+#ifdef USERVER_IMPL_HAS_BUILTIN_BIT_CAST
+    true;
+#else
+    std::is_default_constructible_v<BuilderFunc>;
+#endif
+
+template <typename BuilderFunc>
+constexpr BuilderFunc MakeStatelessBuilder() noexcept {
+  static_assert(kIsStatelessBuilder<BuilderFunc>);
+  if constexpr (std::is_default_constructible_v<BuilderFunc>) {
+    return BuilderFunc{};
+  } else {
+#ifdef USERVER_IMPL_HAS_BUILTIN_BIT_CAST
+    return __builtin_bit_cast(BuilderFunc, static_cast<unsigned char>(0));
+#endif
+  }
+}
+
+template <typename BuilderFunc>
+constexpr auto CollectCases() noexcept {
+  using TypesPair =
+      std::invoke_result_t<const BuilderFunc&, impl::SwitchTypesDetector>;
+  using First = typename TypesPair::first_type;
+  using Second = typename TypesPair::second_type;
+
+  constexpr auto kBuilder = MakeStatelessBuilder<BuilderFunc>();
+  constexpr auto kSize = kBuilder([]() { return CaseCounter{}; }).Extract();
+  return kBuilder([]() { return CaseCollector<First, Second, kSize>{}; });
+}
+
+template <typename BuilderFunc, bool kByFirst>
+constexpr auto BuildTrivialMapPerfectHash() noexcept {
+  constexpr auto kCases = CollectCases<BuilderFunc>();
+  if constexpr (kByFirst) {
+    return StringPerfectHash<typename decltype(kCases.seconds)::value_type,
+                             kCases.firsts.size()>{kCases.firsts,
+                                                   kCases.seconds};
+  } else {
+    return StringPerfectHash<typename decltype(kCases.firsts)::value_type,
+                             kCases.firsts.size()>{kCases.seconds,
+                                                   kCases.firsts};
+  }
+}
+
+template <typename BuilderFunc, bool kByFirst>
+inline constexpr auto kTrivialMapPerfectHash =
+    BuildTrivialMapPerfectHash<BuilderFunc, kByFirst>();
+
+template <typename BuilderFunc, bool kByFirst>
+constexpr bool IsTrivialMapPerfectHashUsed() noexcept {
+  using TypesPair =
+      std::invoke_result_t<const BuilderFunc&, impl::SwitchTypesDetector>;
+  using First = typename TypesPair::first_type;
+  using Second = typename TypesPair::second_type;
+  using Key = std::conditional_t<kByFirst, First, Second>;
+  using Value = std::conditional_t<kByFirst, Second, First>;
+
+  if constexpr (!std::is_same_v<Key, std::string_view> ||
+                !kIsStatelessBuilder<BuilderFunc> ||
+                !(std::is_void_v<Value> ||
+                  std::is_default_constructible_v<Value>)) {
+    return false;
+  } else if constexpr (MakeStatelessBuilder<BuilderFunc>()(
+                           []() { return CaseCounter{}; })
+                           .Extract() < kTrivialMapPerfectHashThreshold) {
+    return false;
+  } else {
+    return kTrivialMapPerfectHash<BuilderFunc, kByFirst>.IsValid();
+  }
+}
+
+template <typename BuilderFunc, bool kByFirst>
+inline constexpr bool kUseTrivialMapPerfectHash =
+    IsTrivialMapPerfectHashUsed<BuilderFunc, kByFirst>();
+
 }  // namespace impl
 
 /// @ingroup userver_universal userver_containers
@@ -588,7 +727,7 @@ class CaseFirstIndexer final {
 /// utils::TrivialBiMap and utils::TrivialSet are known to outperform
 /// std::unordered_map if:
 /// * there's 32 or less elements in map/set
-/// * or keys are string literals and all of them differ in length.
+/// * or keys are string literals.
 ///
 /// Implementation of string search is \b very efficient due to
 /// modern compilers optimize it to a switch by input string
@@ -598,6 +737,13 @@ class CaseFirstIndexer final {
 /// The same story with integral or enum mappings - compiler optimizes them
 /// into a switch and it usually takes O(1) to find the match.
 ///
+/// For maps and sets with impl::kTrivialMapPerfectHashThreshold (64) or more
+/// Case statements the lookups by a string key (except the case insensitive
+/// ones) do not rely on the compiler: a perfect hash table is built in compile
+/// time and a lookup computes one hash and does at most one string comparison.
+/// This makes huge mappings, like proto enums or header names with many keys
+/// of the same length, as fast as the small ones.
+///
 /// @snippet universal/src/utils/trivial_map_test.cpp  sample bidir bimap
 ///
 /// Empty map:
@@ -638,15 +784,25 @@ class TrivialBiMap final {
   }
 
   constexpr std::optional<Second> TryFindByFirst(First value) const noexcept {
-    return func_(
-               [value]() { return impl::SwitchByFirst<First, Second>{value}; })
-        .Extract();
+    if constexpr (impl::kUseTrivialMapPerfectHash<BuilderFunc, true>) {
+      return impl::kTrivialMapPerfectHash<BuilderFunc, true>.Find(value);
+    } else {
+      return func_([value]() {
+               return impl::SwitchByFirst<First, Second>{value};
+             })
+          .Extract();
+    }
   }
 
   constexpr std::optional<First> TryFindBySecond(Second value) const noexcept {
-    return func_(
-               [value]() { return impl::SwitchBySecond<First, Second>{value}; })
-        .Extract();
+    if constexpr (impl::kUseTrivialMapPerfectHash<BuilderFunc, false>) {
+      return impl::kTrivialMapPerfectHash<BuilderFunc, false>.Find(value);
+    } else {
+      return func_([value]() {
+               return impl::SwitchBySecond<First, Second>{value};
+             })
+          .Extract();
+    }
   }
 
   template <class T>
@@ -826,9 +982,16 @@ class TrivialSet final {
   }
 
   constexpr bool Contains(First value) const noexcept {
-    return func_(
-               [value]() { return impl::SwitchByFirst<First, Second>{value}; })
-        .Extract();
+    if constexpr (impl::kUseTrivialMapPerfectHash<BuilderFunc, true>) {
+      return impl::kTrivialMapPerfectHash<BuilderFunc, true>
+          .Find(value)
+          .has_value();
+    } else {
+      return func_([value]() {
+               return impl::SwitchByFirst<First, Second>{value};
+             })
+          .Extract();
+    }
   }
 
   constexpr bool ContainsICase(std::string_view value) const noexcept {
@@ -855,7 +1018,12 @@ class TrivialSet final {
   /// Returns index of the value in Case parameters or std::nullopt if no such
   /// value.
   constexpr std::optional<std::size_t> GetIndex(First value) const {
-    return func_([value]() { return impl::CaseFirstIndexer{value}; }).Extract();
+    if constexpr (impl::kUseTrivialMapPerfectHash<BuilderFunc, true>) {
+      return impl::kTrivialMapPerfectHash<BuilderFunc, true>.Find(value);
+    } else {
+      return func_([value]() { return impl::CaseFirstIndexer{value}; })
+          .Extract();
+    }
   }
 
  private:
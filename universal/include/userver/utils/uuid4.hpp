@@ -4,6 +4,7 @@
 /// @brief @copybrief utils::generators::GenerateUuid
 /// @ingroup userver_universal
 
+#include <array>
 #include <string>
 
 USERVER_NAMESPACE_BEGIN
@@ -13,6 +14,10 @@ namespace utils::generators {
 /// @brief Generate a UUIDv4 string
 std::string GenerateUuid();
 
+/// @brief Generate a UUIDv4 as 32 hex characters, same as GenerateUuid() but
+/// without allocating memory
+std::array<char, 32> GenerateUuidHex();
+
 }  // namespace utils::generators
 
 USERVER_NAMESPACE_END
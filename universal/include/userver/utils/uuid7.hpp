@@ -4,6 +4,7 @@
 /// @brief @copybrief utils::generators::GenerateUuidV7
 /// @ingroup userver_universal
 
+#include <array>
 #include <string>
 
 USERVER_NAMESPACE_BEGIN
@@ -13,6 +14,10 @@ namespace utils::generators {
 /// @brief Generate a UUIDv7 string
 std::string GenerateUuidV7();
 
+/// @brief Generate a UUIDv7 as 32 hex characters, same as GenerateUuidV7() but
+/// without allocating memory
+std::array<char, 32> GenerateUuidV7Hex();
+
 }  // namespace utils::generators
 
 USERVER_NAMESPACE_END
@@ -21,8 +21,12 @@ void Merge(Schema& destination, Schema&& source);
 /// @see @ref static-configs-validation "Static configs validation"
 template <typename ParentComponent>
 Schema MergeSchemas(const std::string& yaml_string) {
+  // The schema of a base component is merged into the schemas of all of its
+  // descendants, it is parsed only once.
+  static const Schema parent_schema = ParentComponent::GetStaticConfigSchema();
+
   auto schema = impl::SchemaFromString(yaml_string);
-  impl::Merge(schema, ParentComponent::GetStaticConfigSchema());
+  impl::Merge(schema, Schema{parent_schema});
   return schema;
 }
 
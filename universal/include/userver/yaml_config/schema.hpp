@@ -35,6 +35,12 @@ class SchemaPtr final {
  public:
   explicit SchemaPtr(Schema&& schema);
 
+  SchemaPtr(const SchemaPtr& other);
+  SchemaPtr(SchemaPtr&&) noexcept = default;
+  SchemaPtr& operator=(const SchemaPtr& other);
+  SchemaPtr& operator=(SchemaPtr&&) noexcept = default;
+  ~SchemaPtr();
+
   const Schema& operator*() const { return *schema_; }
   Schema& operator*() { return *schema_; }
 
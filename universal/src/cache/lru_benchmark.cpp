@@ -1,5 +1,11 @@
 #include <benchmark/benchmark.h>
 
+#include <algorithm>
+#include <cmath>
+#include <random>
+#include <vector>
+
+#include <userver/cache/lru_map.hpp>
 #include <userver/cache/lru_set.hpp>
 
 USERVER_NAMESPACE_BEGIN
@@ -19,6 +25,38 @@ Lru FillLru(unsigned elements_count) {
   return lru;
 }
 
+constexpr unsigned kZipfKeysCount = 100'000;
+constexpr std::size_t kZipfTraceSize = 1'000'000;
+
+// Keys with ranks distributed by Zipf's law with s = 0.99, shuffled to make
+// the popular keys use different hash buckets
+const std::vector<unsigned>& GetZipfTrace() {
+  static const auto trace = [] {
+    std::vector<double> cdf(kZipfKeysCount);
+    double sum = 0;
+    for (unsigned i = 0; i < kZipfKeysCount; ++i) {
+      sum += 1.0 / std::pow(i + 1, 0.99);
+      cdf[i] = sum;
+    }
+
+    std::vector<unsigned> keys(kZipfKeysCount);
+    for (unsigned i = 0; i < kZipfKeysCount; ++i) keys[i] = i;
+    std::mt19937 random(42);
+    std::shuffle(keys.begin(), keys.end(), random);
+
+    std::uniform_real_distribution<double> distribution(0, sum);
+    std::vector<unsigned> result(kZipfTraceSize);
+    for (auto& key : result) {
+      const auto rank =
+          std::lower_bound(cdf.begin(), cdf.end(), distribution(random)) -
+          cdf.begin();
+      key = keys[std::min<std::size_t>(rank, kZipfKeysCount - 1)];
+    }
+    return result;
+  }();
+  return trace;
+}
+
 }  // namespace
 
 void LruPut(benchmark::State& state) {
@@ -51,4 +89,34 @@ void LruPutOverflow(benchmark::State& state) {
 }
 BENCHMARK(LruPutOverflow);
 
+template <cache::CachePolicy Policy>
+void LruZipfHitRate(benchmark::State& state) {
+  const auto& trace = GetZipfTrace();
+  std::size_t hits = 0;
+  std::size_t accesses = 0;
+  for ([[maybe_unused]] auto _ : state) {
+    cache::LruMap<unsigned, unsigned, std::hash<unsigned>,
+                  std::equal_to<unsigned>, Policy>
+        lru(state.range(0));
+    for (const auto key : trace) {
+      if (lru.Get(key)) {
+        ++hits;
+      } else {
+        lru.Put(key, key);
+      }
+    }
+    accesses += trace.size();
+  }
+  state.counters["hit_rate"] = static_cast<double>(hits) / accesses;
+}
+BENCHMARK_TEMPLATE(LruZipfHitRate, cache::CachePolicy::kLRU)
+    ->RangeMultiplier(10)
+    ->Range(100, 10'000);
+BENCHMARK_TEMPLATE(LruZipfHitRate, cache::CachePolicy::kSLRU)
+    ->RangeMultiplier(10)
+    ->Range(100, 10'000);
+BENCHMARK_TEMPLATE(LruZipfHitRate, cache::CachePolicy::kTinyLFU)
+    ->RangeMultiplier(10)
+    ->Range(100, 10'000);
+
 USERVER_NAMESPACE_END
@@ -186,11 +186,14 @@ TEST(Lru, Emplace) {
 TEST(Lru, GetLeastUsed) {
   Lru cache{2};
   EXPECT_EQ(cache.GetLeastUsed(), nullptr);
+  EXPECT_EQ(cache.GetLeastUsedKey(), nullptr);
   cache.Put(1, 10);
   cache.Put(2, 20);
   EXPECT_EQ(*cache.GetLeastUsed(), 10);
+  EXPECT_EQ(*cache.GetLeastUsedKey(), 1);
   cache.Get(1);
   EXPECT_EQ(*cache.GetLeastUsed(), 20);
+  EXPECT_EQ(*cache.GetLeastUsedKey(), 2);
 }
 
 TEST(Lru, Movable) {
@@ -213,4 +216,71 @@ TEST(Lru, NotMovable) {
   EXPECT_EQ(cache.GetLeastUsed()->value, 4);
 }
 
+namespace {
+
+template <typename PolicyConstant>
+class LruMapPolicy : public ::testing::Test {
+ public:
+  template <typename Value>
+  using Map = cache::LruMap<int, Value, std::hash<int>, std::equal_to<int>,
+                            PolicyConstant::value>;
+};
+
+template <cache::CachePolicy Policy>
+using PolicyConstant = std::integral_constant<cache::CachePolicy, Policy>;
+
+using Policies = ::testing::Types<PolicyConstant<cache::CachePolicy::kLRU>,
+                                  PolicyConstant<cache::CachePolicy::kSLRU>,
+                                  PolicyConstant<cache::CachePolicy::kTinyLFU>>;
+
+}  // namespace
+
+TYPED_TEST_SUITE(LruMapPolicy, Policies);
+
+TYPED_TEST(LruMapPolicy, SetGetErase) {
+  typename TestFixture::template Map<int> cache(10);
+  EXPECT_EQ(10, cache.GetCapacity());
+  EXPECT_EQ(nullptr, cache.Get(1));
+  EXPECT_TRUE(cache.Put(1, 10));
+  EXPECT_FALSE(cache.Put(1, 11));
+  EXPECT_EQ(11, cache.GetOr(1, -1));
+  EXPECT_EQ(20, *cache.Emplace(2, 20));
+  EXPECT_EQ(20, *cache.Emplace(2, 30));
+  EXPECT_EQ(2, cache.GetSize());
+
+  cache.Erase(1);
+  EXPECT_EQ(-1, cache.GetOr(1, -1));
+  EXPECT_EQ(1, cache.GetSize());
+}
+
+TYPED_TEST(LruMapPolicy, Overflow) {
+  typename TestFixture::template Map<int> cache(10);
+  for (int i = 0; i < 100; ++i) {
+    cache.Put(i, i);
+    EXPECT_LE(cache.GetSize(), 10);
+  }
+  EXPECT_EQ(99, cache.GetOr(99, -1));
+
+  cache.SetMaxSize(20);
+  EXPECT_EQ(20, cache.GetCapacity());
+  for (int i = 0; i < 100; ++i) cache.Put(i, i);
+  EXPECT_LE(cache.GetSize(), 20);
+
+  int sum = 0;
+  cache.VisitAll([&sum](int /*key*/, int value) { sum += value; });
+  EXPECT_NE(0, sum);
+
+  cache.Clear();
+  EXPECT_EQ(0, cache.GetSize());
+}
+
+TYPED_TEST(LruMapPolicy, NotMovable) {
+  typename TestFixture::template Map<NotMovable> cache(10);
+
+  cache.Emplace(1, 2);
+  EXPECT_EQ(cache.Get(1)->value, 2);
+  for (int i = 2; i < 100; ++i) cache.Emplace(i, i);
+  EXPECT_EQ(cache.Get(99)->value, 99);
+}
+
 USERVER_NAMESPACE_END
@@ -0,0 +1,122 @@
+#include <userver/cache/impl/tinylfu.hpp>
+
+#include <string>
+
+#include <gtest/gtest.h>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+using TinyLfu = cache::impl::TinyLfuBase<std::size_t, std::size_t>;
+
+}  // namespace
+
+TEST(TinyLfuBase, SetGet) {
+  cache::impl::TinyLfuBase<std::string, int> cache(100);
+  EXPECT_EQ(nullptr, cache.Get("a"));
+  EXPECT_TRUE(cache.Put("a", 1));
+  EXPECT_EQ(1, *cache.Get("a"));
+  EXPECT_FALSE(cache.Put("a", 2));
+  EXPECT_EQ(2, *cache.Get("a"));
+  EXPECT_EQ(1, cache.GetSize());
+  EXPECT_EQ(100, cache.GetCapacity());
+}
+
+TEST(TinyLfuBase, FillsCapacity) {
+  constexpr std::size_t kSize = 100;
+  TinyLfu cache(kSize);
+
+  for (std::size_t i = 0; i < kSize; ++i) {
+    cache.Put(i, i);
+  }
+  EXPECT_EQ(kSize, cache.GetSize());
+  for (std::size_t i = 0; i < kSize; ++i) {
+    EXPECT_EQ(i, *cache.Get(i));
+  }
+
+  for (std::size_t i = kSize; i < 10 * kSize; ++i) {
+    cache.Put(i, i);
+    EXPECT_LE(cache.GetSize(), kSize);
+  }
+}
+
+TEST(TinyLfuBase, ScanResistance) {
+  constexpr std::size_t kSize = 100;
+  constexpr std::size_t kHot = 50;
+  TinyLfu cache(kSize);
+
+  for (std::size_t j = 0; j < 5; ++j) {
+    for (std::size_t i = 0; i < kHot; ++i) {
+      if (!cache.Get(i)) cache.Put(i, i);
+    }
+  }
+
+  // A scan of elements that are accessed once does not evict the hot ones,
+  // except for the one that was left in the window
+  for (std::size_t i = 1000; i < 1000 + 10 * kSize; ++i) {
+    cache.Put(i, i);
+  }
+
+  std::size_t cache_hit = 0;
+  for (std::size_t i = 0; i < kHot; ++i) {
+    if (cache.Get(i)) cache_hit++;
+  }
+  EXPECT_LE(kHot - 1, cache_hit);
+}
+
+TEST(TinyLfuBase, Erase) {
+  TinyLfu cache(10);
+  for (std::size_t i = 0; i < 10; ++i) {
+    cache.Put(i, i);
+    cache.Get(i);
+  }
+
+  for (std::size_t i = 0; i < 10; ++i) {
+    cache.Erase(i);
+    EXPECT_EQ(nullptr, cache.Get(i));
+  }
+  EXPECT_EQ(0, cache.GetSize());
+}
+
+TEST(TinyLfuBase, Emplace) {
+  TinyLfu cache(10);
+  EXPECT_EQ(1, *cache.Emplace(1, std::size_t{1}));
+  EXPECT_EQ(1, *cache.Emplace(1, std::size_t{2}));
+  EXPECT_EQ(1, cache.GetSize());
+}
+
+TEST(TinyLfuBase, SetMaxSize) {
+  TinyLfu cache(100);
+  for (std::size_t i = 0; i < 100; ++i) {
+    cache.Put(i, i);
+  }
+  for (std::size_t i = 0; i < 100; ++i) {
+    cache.Get(i);
+  }
+
+  cache.SetMaxSize(10);
+  EXPECT_EQ(10, cache.GetCapacity());
+  EXPECT_EQ(10, cache.GetSize());
+
+  cache.SetMaxSize(200);
+  for (std::size_t i = 0; i < 200; ++i) {
+    cache.Put(i, i);
+  }
+  EXPECT_EQ(200, cache.GetSize());
+
+  cache.Clear();
+  EXPECT_EQ(0, cache.GetSize());
+}
+
+TEST(TinyLfuBase, SmallSize) {
+  TinyLfu cache(1);
+  EXPECT_EQ(3, cache.GetCapacity());
+  for (std::size_t i = 0; i < 10; ++i) {
+    cache.Put(i, i);
+    EXPECT_LE(cache.GetSize(), cache.GetCapacity());
+  }
+  EXPECT_EQ(9, *cache.Get(9));
+}
+
+USERVER_NAMESPACE_END
@@ -1,8 +1,16 @@
 #include <userver/compression/zstd.hpp>
 
+#include <optional>
+#include <stdexcept>
+#include <vector>
+
+#include <zdict.h>
 #include <zstd.h>
 #include <zstd_errors.h>
 
+#include <userver/compiler/thread_local.hpp>
+#include <userver/utils/assert.hpp>
+
 USERVER_NAMESPACE_BEGIN
 
 namespace compression::zstd {
@@ -10,61 +18,139 @@ namespace compression::zstd {
 namespace {
 // The same size as in ZSTD_DStreamOutSize();
 const size_t kDecompressBufferSize = ZSTD_DStreamOutSize();
-}  // namespace
 
-std::string DecompressStream(std::string_view compressed, size_t max_size) {
-  std::string decompressed;
-  std::string buf(kDecompressBufferSize, '\0');
+// The contexts are returned to the pool right after the one-shot operations,
+// only the streams hold them for longer
+constexpr std::size_t kMaxPooledContexts = 4;
+
+struct CompressionContextTraits final {
+  using Context = ZSTD_CCtx;
 
-  auto* stream = ZSTD_createDStream();
-  if (stream == nullptr) {
-    throw std::runtime_error("Couldn't create ZSTD decompression stream");
+  static Context* Create() noexcept { return ZSTD_createCCtx(); }
+  static void Free(Context* context) noexcept { ZSTD_freeCCtx(context); }
+  static void Reset(Context* context) noexcept {
+    ZSTD_CCtx_reset(context, ZSTD_reset_session_and_parameters);
+  }
+  [[noreturn]] static void ThrowCreateError() {
+    throw CompressionError("couldn't create ZSTD compression context");
   }
-  auto stream_del = [](ZSTD_DStream* ptr) { ZSTD_freeDStream(ptr); };
-  auto stream_guard =
-      std::unique_ptr<ZSTD_DStream, decltype(stream_del)>(stream, stream_del);
+};
 
-  {
-    const auto err_code = ZSTD_DCtx_reset(
-        stream, ZSTD_ResetDirective::ZSTD_reset_session_and_parameters);
-    if (ZSTD_isError(err_code)) {
-      throw ErrWithCode(ZSTD_getErrorName(err_code));
-    }
+struct DecompressionContextTraits final {
+  using Context = ZSTD_DCtx;
+
+  static Context* Create() noexcept { return ZSTD_createDCtx(); }
+  static void Free(Context* context) noexcept { ZSTD_freeDCtx(context); }
+  static void Reset(Context* context) noexcept {
+    ZSTD_DCtx_reset(context, ZSTD_reset_session_and_parameters);
+  }
+  [[noreturn]] static void ThrowCreateError() {
+    throw DecompressionError("Couldn't create ZSTD decompression context");
   }
+};
 
-  for (size_t cur_pos(0); cur_pos < compressed.size();) {
-    ZSTD_inBuffer input{
-        compressed.data() + cur_pos,
-        std::min(kDecompressBufferSize, compressed.size() - cur_pos), 0};
+// A context from the thread-local pool, creating a context allocates
+// hundreds of kilobytes for the compression
+template <typename Traits>
+class PooledContext final {
+ public:
+  using Context = typename Traits::Context;
 
-    while (input.pos < input.size) {
-      ZSTD_outBuffer output{buf.data(), buf.size(), 0};
+  PooledContext() : context_(Acquire()) {}
 
-      if (const auto ret = ZSTD_decompressStream(stream, &output, &input);
-          ZSTD_isError(ret)) {
-        throw ErrWithCode(ZSTD_getErrorName(ret));
-      }
+  PooledContext(PooledContext&&) = delete;
+  PooledContext& operator=(PooledContext&&) = delete;
 
-      decompressed.append(static_cast<char*>(output.dst), output.pos);
+  // NOTE: may be called on a different thread than the constructor, the
+  // context is then returned to the pool of that thread
+  ~PooledContext() {
+    // Clears the parameters and the dictionary for the next user
+    Traits::Reset(context_.get());
+    auto pool = local_pool.Use();
+    if (pool->size() < kMaxPooledContexts) {
+      pool->push_back(std::move(context_));
     }
+  }
 
-    if (decompressed.size() > max_size) {
-      throw TooBigError();
+  Context* Get() const noexcept { return context_.get(); }
+
+ private:
+  struct Deleter final {
+    void operator()(Context* context) const noexcept { Traits::Free(context); }
+  };
+  using ContextPtr = std::unique_ptr<Context, Deleter>;
+  using Pool = std::vector<ContextPtr>;
+
+  static ContextPtr Acquire() {
+    {
+      auto pool = local_pool.Use();
+      if (!pool->empty()) {
+        auto context = std::move(pool->back());
+        pool->pop_back();
+        return context;
+      }
     }
+    ContextPtr context{Traits::Create()};
+    if (!context) Traits::ThrowCreateError();
+    return context;
+  }
+
+  static inline compiler::ThreadLocal local_pool = [] {
+    Pool pool;
+    // So that returning a context never allocates
+    pool.reserve(kMaxPooledContexts);
+    return pool;
+  };
+
+  ContextPtr context_;
+};
 
-    cur_pos += input.size;
+using PooledCompressionContext = PooledContext<CompressionContextTraits>;
+using PooledDecompressionContext = PooledContext<DecompressionContextTraits>;
+
+void ThrowOnCompressionError(size_t result) {
+  if (ZSTD_isError(result)) {
+    throw CompressionError(ZSTD_getErrorName(result));
   }
+}
 
-  return decompressed;
+void ThrowOnDecompressionError(size_t result) {
+  if (ZSTD_isError(result)) {
+    throw ErrWithCode(ZSTD_getErrorName(result));
+  }
 }
 
-std::string Decompress(std::string_view compressed, size_t max_size) {
+// Compresses all of `data` with `directive`, appending the output to `out`
+void CompressStream(ZSTD_CCtx* context, std::string_view data,
+                    ZSTD_EndDirective directive, std::string& out) {
+  ZSTD_inBuffer input{data.data(), data.size(), 0};
+  const auto chunk_size = ZSTD_CStreamOutSize();
+
+  while (true) {
+    const auto old_size = out.size();
+    out.resize(old_size + chunk_size);
+    ZSTD_outBuffer output{out.data() + old_size, chunk_size, 0};
+
+    const auto remaining =
+        ZSTD_compressStream2(context, &output, &input, directive);
+    ThrowOnCompressionError(remaining);
+    out.resize(old_size + output.pos);
+
+    // For ZSTD_e_flush and ZSTD_e_end zero means that all the data was
+    // consumed and flushed
+    if (remaining == 0) break;
+  }
+}
+
+// Returns the decompressed size of a single frame if it is known
+std::optional<size_t> GetFrameContentSize(std::string_view compressed,
+                                          size_t max_size) {
   const auto decompressed_size =
       ZSTD_getFrameContentSize(compressed.data(), compressed.size());
 
   switch (decompressed_size) {
     case ZSTD_CONTENTSIZE_UNKNOWN:
-      return DecompressStream(compressed, max_size);
+      return std::nullopt;
     case ZSTD_CONTENTSIZE_ERROR:
       throw std::runtime_error("Error while getting size");
     default:
@@ -72,17 +158,212 @@ std::string Decompress(std::string_view compressed, size_t max_size) {
         throw TooBigError();
       }
   }
+  return decompressed_size;
+}
+
+}  // namespace
+
+struct Dictionary::Impl final {
+  struct CDictDeleter final {
+    void operator()(ZSTD_CDict* dictionary) const noexcept {
+      ZSTD_freeCDict(dictionary);
+    }
+  };
+  struct DDictDeleter final {
+    void operator()(ZSTD_DDict* dictionary) const noexcept {
+      ZSTD_freeDDict(dictionary);
+    }
+  };
 
-  std::string decompressed(decompressed_size, '\0');
-  if (const auto ret =
-          ZSTD_decompress(decompressed.data(), decompressed.capacity(),
-                          compressed.data(), compressed.size());
-      ZSTD_isError(ret)) {
-    throw ErrWithCode(ZSTD_getErrorName(ret));
+  std::unique_ptr<ZSTD_CDict, CDictDeleter> compression;
+  std::unique_ptr<ZSTD_DDict, DDictDeleter> decompression;
+};
+
+Dictionary::Dictionary(std::string_view dictionary, int level)
+    : impl_(std::make_unique<Impl>()) {
+  impl_->compression.reset(
+      ZSTD_createCDict(dictionary.data(), dictionary.size(), level));
+  impl_->decompression.reset(
+      ZSTD_createDDict(dictionary.data(), dictionary.size()));
+  if (!impl_->compression || !impl_->decompression) {
+    throw CompressionError("couldn't create ZSTD dictionary");
   }
+}
+
+Dictionary::~Dictionary() = default;
 
+Dictionary::Dictionary(Dictionary&&) noexcept = default;
+
+Dictionary& Dictionary::operator=(Dictionary&&) noexcept = default;
+
+std::string Dictionary::Train(const std::vector<std::string>& samples,
+                              std::size_t max_size) {
+  std::string samples_buffer;
+  std::vector<size_t> sample_sizes;
+  sample_sizes.reserve(samples.size());
+  for (const auto& sample : samples) {
+    samples_buffer += sample;
+    sample_sizes.push_back(sample.size());
+  }
+
+  std::string dictionary(max_size, '\0');
+  const auto size = ZDICT_trainFromBuffer(
+      dictionary.data(), dictionary.size(), samples_buffer.data(),
+      sample_sizes.data(), static_cast<unsigned>(sample_sizes.size()));
+  if (ZDICT_isError(size)) {
+    throw CompressionError(ZDICT_getErrorName(size));
+  }
+  dictionary.resize(size);
+  return dictionary;
+}
+
+std::string Decompress(std::string_view compressed, size_t max_size) {
+  const auto decompressed_size = GetFrameContentSize(compressed, max_size);
+  if (!decompressed_size) {
+    return Decompressor{max_size}.Decompress(compressed);
+  }
+
+  std::string decompressed(*decompressed_size, '\0');
+  const PooledDecompressionContext context;
+  ThrowOnDecompressionError(
+      ZSTD_decompressDCtx(context.Get(), decompressed.data(),
+                          decompressed.size(), compressed.data(),
+                          compressed.size()));
+  return decompressed;
+}
+
+std::string Decompress(std::string_view compressed, size_t max_size,
+                       const Dictionary& dictionary) {
+  const auto decompressed_size = GetFrameContentSize(compressed, max_size);
+  if (!decompressed_size) {
+    return Decompressor{max_size, dictionary}.Decompress(compressed);
+  }
+
+  std::string decompressed(*decompressed_size, '\0');
+  const PooledDecompressionContext context;
+  ThrowOnDecompressionError(ZSTD_decompress_usingDDict(
+      context.Get(), decompressed.data(), decompressed.size(),
+      compressed.data(), compressed.size(),
+      dictionary.impl_->decompression.get()));
   return decompressed;
 }
 
+std::string Compress(std::string_view data, int level) {
+  std::string compressed(ZSTD_compressBound(data.size()), '\0');
+  const PooledCompressionContext context;
+  const auto size =
+      ZSTD_compressCCtx(context.Get(), compressed.data(), compressed.size(),
+                        data.data(), data.size(), level);
+  ThrowOnCompressionError(size);
+  compressed.resize(size);
+  return compressed;
+}
+
+std::string Compress(std::string_view data, const Dictionary& dictionary) {
+  std::string compressed(ZSTD_compressBound(data.size()), '\0');
+  const PooledCompressionContext context;
+  const auto size = ZSTD_compress_usingCDict(
+      context.Get(), compressed.data(), compressed.size(), data.data(),
+      data.size(), dictionary.impl_->compression.get());
+  ThrowOnCompressionError(size);
+  compressed.resize(size);
+  return compressed;
+}
+
+struct Compressor::Impl final {
+  PooledCompressionContext context;
+};
+
+Compressor::Compressor(int level) : impl_(std::make_unique<Impl>()) {
+  ThrowOnCompressionError(ZSTD_CCtx_setParameter(
+      impl_->context.Get(), ZSTD_c_compressionLevel, level));
+}
+
+Compressor::Compressor(const Dictionary& dictionary)
+    : impl_(std::make_unique<Impl>()) {
+  ThrowOnCompressionError(ZSTD_CCtx_refCDict(
+      impl_->context.Get(), dictionary.impl_->compression.get()));
+}
+
+Compressor::~Compressor() = default;
+
+Compressor::Compressor(Compressor&&) noexcept = default;
+
+Compressor& Compressor::operator=(Compressor&&) noexcept = default;
+
+std::string Compressor::Compress(std::string_view data) {
+  UASSERT(impl_);
+  std::string compressed;
+  CompressStream(impl_->context.Get(), data, ZSTD_e_flush, compressed);
+  return compressed;
+}
+
+std::string Compressor::Finish() {
+  UASSERT(impl_);
+  std::string compressed;
+  CompressStream(impl_->context.Get(), {}, ZSTD_e_end, compressed);
+  return compressed;
+}
+
+struct Decompressor::Impl final {
+  explicit Impl(size_t max_size) : max_size(max_size) {}
+
+  PooledDecompressionContext context;
+  const size_t max_size;
+  size_t decompressed_size{0};
+  bool is_frame_finished{true};
+};
+
+Decompressor::Decompressor(size_t max_size)
+    : impl_(std::make_unique<Impl>(max_size)) {}
+
+Decompressor::Decompressor(size_t max_size, const Dictionary& dictionary)
+    : impl_(std::make_unique<Impl>(max_size)) {
+  ThrowOnDecompressionError(ZSTD_DCtx_refDDict(
+      impl_->context.Get(), dictionary.impl_->decompression.get()));
+}
+
+Decompressor::~Decompressor() = default;
+
+Decompressor::Decompressor(Decompressor&&) noexcept = default;
+
+Decompressor& Decompressor::operator=(Decompressor&&) noexcept = default;
+
+std::string Decompressor::Decompress(std::string_view compressed) {
+  UASSERT(impl_);
+  std::string decompressed;
+  if (compressed.empty()) return decompressed;
+
+  ZSTD_inBuffer input{compressed.data(), compressed.size(), 0};
+  while (true) {
+    const auto old_size = decompressed.size();
+    decompressed.resize(old_size + kDecompressBufferSize);
+    ZSTD_outBuffer output{decompressed.data() + old_size,
+                          kDecompressBufferSize, 0};
+
+    const auto ret =
+        ZSTD_decompressStream(impl_->context.Get(), &output, &input);
+    ThrowOnDecompressionError(ret);
+    decompressed.resize(old_size + output.pos);
+
+    if (impl_->decompressed_size + decompressed.size() > impl_->max_size) {
+      throw TooBigError();
+    }
+
+    // Zero means that a frame is fully decoded and flushed
+    impl_->is_frame_finished = (ret == 0);
+    // A full output buffer may leave some data inside the context
+    if (input.pos == input.size && output.pos < output.size) break;
+  }
+
+  impl_->decompressed_size += decompressed.size();
+  return decompressed;
+}
+
+bool Decompressor::IsFrameFinished() const noexcept {
+  UASSERT(impl_);
+  return impl_->is_frame_finished;
+}
+
 }  // namespace compression::zstd
 USERVER_NAMESPACE_END
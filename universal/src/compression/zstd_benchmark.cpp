@@ -2,6 +2,8 @@
 
 #include <chrono>
 #include <random>
+#include <string>
+#include <vector>
 
 #include <zstd.h>
 #include <userver/compression/zstd.hpp>
@@ -47,4 +49,70 @@ static void ZstdDecompress(benchmark::State& state) {
 }
 BENCHMARK(ZstdDecompress)->RangeMultiplier(2)->Range(1 << 10, 1 << 15);
 
+static void ZstdCompress(benchmark::State& state) {
+  const auto data = GenerateRandomData(state.range(0));
+  for ([[maybe_unused]] auto _ : state) {
+    benchmark::DoNotOptimize(compression::zstd::Compress(data, 1));
+  }
+}
+BENCHMARK(ZstdCompress)->RangeMultiplier(4)->Range(1 << 6, 1 << 15);
+
+static void ZstdStreamingCompress(benchmark::State& state) {
+  const auto data = GenerateRandomData(state.range(0));
+  for ([[maybe_unused]] auto _ : state) {
+    compression::zstd::Compressor compressor{1};
+    benchmark::DoNotOptimize(compressor.Compress(data));
+    benchmark::DoNotOptimize(compressor.Finish());
+  }
+}
+BENCHMARK(ZstdStreamingCompress)->RangeMultiplier(4)->Range(1 << 6, 1 << 15);
+
+namespace {
+
+std::string MakeSmallPayload(int i) {
+  return R"({"id":)" + std::to_string(i) + R"(,"status":"active","region":")" +
+         std::to_string(i % 5) + R"(","tags":["alpha","beta","gamma"]})";
+}
+
+compression::zstd::Dictionary MakeDictionary() {
+  std::vector<std::string> samples;
+  for (int i = 0; i < 2'000; ++i) samples.push_back(MakeSmallPayload(i));
+  return compression::zstd::Dictionary{
+      compression::zstd::Dictionary::Train(samples, 4 * 1024), 1};
+}
+
+}  // namespace
+
+static void ZstdCompressSmall(benchmark::State& state) {
+  const auto data = MakeSmallPayload(100'500);
+  std::size_t compressed_size = 0;
+  for ([[maybe_unused]] auto _ : state) {
+    compressed_size = compression::zstd::Compress(data, 1).size();
+  }
+  state.counters["ratio"] = static_cast<double>(data.size()) / compressed_size;
+}
+BENCHMARK(ZstdCompressSmall);
+
+static void ZstdCompressSmallDictionary(benchmark::State& state) {
+  const auto dictionary = MakeDictionary();
+  const auto data = MakeSmallPayload(100'500);
+  std::size_t compressed_size = 0;
+  for ([[maybe_unused]] auto _ : state) {
+    compressed_size = compression::zstd::Compress(data, dictionary).size();
+  }
+  state.counters["ratio"] = static_cast<double>(data.size()) / compressed_size;
+}
+BENCHMARK(ZstdCompressSmallDictionary);
+
+static void ZstdDecompressSmallDictionary(benchmark::State& state) {
+  const auto dictionary = MakeDictionary();
+  const auto data = MakeSmallPayload(100'500);
+  const auto compressed = compression::zstd::Compress(data, dictionary);
+  for ([[maybe_unused]] auto _ : state) {
+    benchmark::DoNotOptimize(
+        compression::zstd::Decompress(compressed, data.size(), dictionary));
+  }
+}
+BENCHMARK(ZstdDecompressSmallDictionary);
+
 USERVER_NAMESPACE_END
@@ -1,5 +1,8 @@
 #include <gtest/gtest.h>
 
+#include <string>
+#include <vector>
+
 #include <zstd.h>
 #include <userver/compression/zstd.hpp>
 
@@ -65,4 +68,110 @@ TEST(Zstd, TestOverflow) {
       compression::TooBigError);
 }
 
+TEST(Zstd, CompressRoundTrip) {
+  std::string data;
+  for (int i = 0; i < 10'000; ++i) data += "chunk #" + std::to_string(i % 7);
+
+  const auto compressed = compression::zstd::Compress(data, 3);
+  EXPECT_LT(compressed.size(), data.size());
+  EXPECT_EQ(compression::zstd::Decompress(compressed, data.size()), data);
+}
+
+TEST(Zstd, StreamingCompressor) {
+  std::string data;
+  for (int i = 0; i < 10'000; ++i) data += "chunk #" + std::to_string(i % 7);
+
+  compression::zstd::Compressor compressor{3};
+  std::string compressed;
+  for (std::size_t pos = 0; pos < data.size(); pos += 1000) {
+    compressed += compressor.Compress(std::string_view{data}.substr(pos, 1000));
+    EXPECT_FALSE(compressed.empty());
+  }
+  compressed += compressor.Finish();
+
+  EXPECT_EQ(compression::zstd::Decompress(compressed, data.size()), data);
+}
+
+namespace {
+
+std::string MakeSample(int i) {
+  return R"({"id":)" + std::to_string(i) + R"(,"status":"active","region":")" +
+         std::to_string(i % 5) + R"(","tags":["alpha","beta","gamma"]})";
+}
+
+std::vector<std::string> MakeSamples() {
+  std::vector<std::string> samples;
+  for (int i = 0; i < 2'000; ++i) samples.push_back(MakeSample(i));
+  return samples;
+}
+
+}  // namespace
+
+TEST(Zstd, StreamingDecompressor) {
+  std::string data;
+  for (int i = 0; i < 10'000; ++i) data += "chunk #" + std::to_string(i % 7);
+  const auto compressed = compression::zstd::Compress(data, 3);
+
+  compression::zstd::Decompressor decompressor{data.size()};
+  std::string decompressed;
+  for (std::size_t pos = 0; pos < compressed.size(); pos += 10) {
+    decompressed +=
+        decompressor.Decompress(std::string_view{compressed}.substr(pos, 10));
+    EXPECT_EQ(decompressor.IsFrameFinished(), pos + 10 >= compressed.size());
+  }
+  EXPECT_EQ(decompressed, data);
+}
+
+TEST(Zstd, StreamingDecompressorOverflow) {
+  const std::string data(10'000, 'a');
+  const auto compressed = compression::zstd::Compress(data, 3);
+
+  compression::zstd::Decompressor decompressor{data.size() - 1};
+  EXPECT_THROW(decompressor.Decompress(compressed), compression::TooBigError);
+}
+
+TEST(Zstd, Dictionary) {
+  const compression::zstd::Dictionary dictionary{
+      compression::zstd::Dictionary::Train(MakeSamples(), 4 * 1024), 3};
+
+  const auto data = MakeSample(100'500);
+  const auto compressed = compression::zstd::Compress(data, dictionary);
+  EXPECT_LT(compressed.size(), compression::zstd::Compress(data, 3).size());
+  EXPECT_EQ(compression::zstd::Decompress(compressed, data.size(), dictionary),
+            data);
+  EXPECT_ANY_THROW(compression::zstd::Decompress(compressed, data.size()));
+}
+
+TEST(Zstd, StreamingDictionary) {
+  const compression::zstd::Dictionary dictionary{
+      compression::zstd::Dictionary::Train(MakeSamples(), 4 * 1024), 3};
+  const auto data = MakeSample(1) + MakeSample(2) + MakeSample(3);
+
+  compression::zstd::Compressor compressor{dictionary};
+  auto compressed = compressor.Compress(data);
+  compressed += compressor.Finish();
+
+  compression::zstd::Decompressor decompressor{data.size(), dictionary};
+  EXPECT_EQ(decompressor.Decompress(compressed), data);
+  EXPECT_TRUE(decompressor.IsFrameFinished());
+}
+
+TEST(Zstd, ContextReuse) {
+  const compression::zstd::Dictionary dictionary{
+      compression::zstd::Dictionary::Train(MakeSamples(), 4 * 1024), 3};
+  const auto data = MakeSample(42);
+
+  // A pooled context must not keep the dictionary or the level of the
+  // previous user
+  for (int i = 0; i < 10; ++i) {
+    const auto with_dictionary = compression::zstd::Compress(data, dictionary);
+    const auto without_dictionary = compression::zstd::Compress(data, 1);
+    EXPECT_EQ(compression::zstd::Decompress(without_dictionary, data.size()),
+              data);
+    EXPECT_EQ(compression::zstd::Decompress(with_dictionary, data.size(),
+                                            dictionary),
+              data);
+  }
+}
+
 USERVER_NAMESPACE_END
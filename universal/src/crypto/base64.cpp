@@ -1,11 +1,14 @@
 #include <userver/crypto/base64.hpp>
 
-#include <cryptopp/base64.h>
+#include <array>
+#include <cstdint>
 
-#include <userver/crypto/exception.hpp>
+#include <userver/utils/assert.hpp>
 
-#ifdef CRYPTOPP_NO_GLOBAL_BYTE
-using CryptoPP::byte;
+#if defined(__AVX2__)
+#include <immintrin.h>
+#elif defined(__SSSE3__)
+#include <tmmintrin.h>
 #endif
 
 USERVER_NAMESPACE_BEGIN
@@ -14,53 +17,366 @@ namespace crypto::base64 {
 
 namespace {
 
-template <typename Base64Encoder>
-std::string Base64Encode(std::string_view data, Pad pad) {
-  std::string response;
-  try {
-    Base64Encoder encoder(new CryptoPP::StringSink(response));
-    CryptoPP::AlgorithmParameters params =
-        CryptoPP::MakeParameters(CryptoPP::Name::Pad(), Pad::kWith == pad)(
-            CryptoPP::Name::InsertLineBreaks(), false);
-    encoder.IsolatedInitialize(params);
-    encoder.PutMessageEnd(reinterpret_cast<const byte*>(data.data()),
-                          data.size());
-  } catch (const CryptoPP::Exception& exc) {
-    throw crypto::CryptoException(exc.what());
+// Characters for the values 62 and 63, the rest of the alphabet is common
+struct Alphabet final {
+  char char62;
+  char char63;
+};
+
+constexpr Alphabet kStandard{'+', '/'};
+constexpr Alphabet kUrl{'-', '_'};
+
+constexpr unsigned char kNotInAlphabet = 255;
+
+using EncodeTable = std::array<char, 64>;
+using DecodeTable = std::array<unsigned char, 256>;
+
+constexpr EncodeTable MakeEncodeTable(Alphabet alphabet) {
+  EncodeTable table{};
+  for (int i = 0; i < 26; ++i) {
+    table[i] = static_cast<char>('A' + i);
+    table[26 + i] = static_cast<char>('a' + i);
   }
-  return response;
+  for (int i = 0; i < 10; ++i) table[52 + i] = static_cast<char>('0' + i);
+  table[62] = alphabet.char62;
+  table[63] = alphabet.char63;
+  return table;
 }
 
-template <typename Base64Decoder>
-std::string Base64Decode(std::string_view data) {
-  std::string response;
-  try {
-    Base64Decoder decoder(new CryptoPP::StringSink(response));
-    decoder.PutMessageEnd(reinterpret_cast<const byte*>(data.data()),
-                          data.size());
-  } catch (const CryptoPP::Exception& exc) {
-    throw crypto::CryptoException(exc.what());
+constexpr DecodeTable MakeDecodeTable(Alphabet alphabet) {
+  DecodeTable table{};
+  for (auto& value : table) value = kNotInAlphabet;
+  const auto encode_table = MakeEncodeTable(alphabet);
+  for (int i = 0; i < 64; ++i) {
+    table[static_cast<unsigned char>(encode_table[i])] = i;
   }
-  return response;
+  return table;
+}
+
+constexpr std::size_t GetEncodedSize(std::size_t size, Pad pad) {
+  if (pad == Pad::kWith) return (size + 2) / 3 * 4;
+  return size / 3 * 4 + (size % 3 == 0 ? 0 : size % 3 + 1);
+}
+
+// Decoding skips the characters that are not in the alphabet, including the
+// padding and the line breaks, as CryptoPP did
+constexpr std::size_t GetDecodedSizeUpperBound(std::size_t size) {
+  return size / 4 * 3 + size % 4;
+}
+
+#if defined(__SSSE3__)
+// Writing whole vectors is cheaper than writing exactly 12 or 24 bytes
+constexpr std::size_t kDecodeSlack = 8;
+
+// Vectorized codecs after Wojciech Mula and Daniel Lemire, "Faster Base64
+// Encoding and Decoding Using AVX2 Instructions"
+struct Ops128 final {
+  using Vector = __m128i;
+
+  static __m128i Set1Epi8(char c) { return _mm_set1_epi8(c); }
+  static __m128i Set1Epi32(std::int32_t i) { return _mm_set1_epi32(i); }
+  static __m128i Lanes(__m128i v) { return v; }
+  static __m128i And(__m128i a, __m128i b) { return _mm_and_si128(a, b); }
+  static __m128i Or(__m128i a, __m128i b) { return _mm_or_si128(a, b); }
+  static __m128i Add(__m128i a, __m128i b) { return _mm_add_epi8(a, b); }
+  static __m128i Sub(__m128i a, __m128i b) { return _mm_sub_epi8(a, b); }
+  static __m128i SubsEpu8(__m128i a, __m128i b) { return _mm_subs_epu8(a, b); }
+  static __m128i CmpGt(__m128i a, __m128i b) { return _mm_cmpgt_epi8(a, b); }
+  static __m128i CmpEq(__m128i a, __m128i b) { return _mm_cmpeq_epi8(a, b); }
+  static __m128i Shuffle(__m128i a, __m128i b) {
+    return _mm_shuffle_epi8(a, b);
+  }
+  static __m128i MulHiEpu16(__m128i a, __m128i b) {
+    return _mm_mulhi_epu16(a, b);
+  }
+  static __m128i MulLoEpi16(__m128i a, __m128i b) {
+    return _mm_mullo_epi16(a, b);
+  }
+  static __m128i MaddUbs(__m128i a, __m128i b) {
+    return _mm_maddubs_epi16(a, b);
+  }
+  static __m128i Madd(__m128i a, __m128i b) { return _mm_madd_epi16(a, b); }
+  static bool AllSet(__m128i v) { return _mm_movemask_epi8(v) == 0xffff; }
+};
+
+#if defined(__AVX2__)
+struct Ops256 final {
+  using Vector = __m256i;
+
+  static __m256i Set1Epi8(char c) { return _mm256_set1_epi8(c); }
+  static __m256i Set1Epi32(std::int32_t i) { return _mm256_set1_epi32(i); }
+  static __m256i Lanes(__m128i v) { return _mm256_broadcastsi128_si256(v); }
+  static __m256i And(__m256i a, __m256i b) { return _mm256_and_si256(a, b); }
+  static __m256i Or(__m256i a, __m256i b) { return _mm256_or_si256(a, b); }
+  static __m256i Add(__m256i a, __m256i b) { return _mm256_add_epi8(a, b); }
+  static __m256i Sub(__m256i a, __m256i b) { return _mm256_sub_epi8(a, b); }
+  static __m256i SubsEpu8(__m256i a, __m256i b) {
+    return _mm256_subs_epu8(a, b);
+  }
+  static __m256i CmpGt(__m256i a, __m256i b) {
+    return _mm256_cmpgt_epi8(a, b);
+  }
+  static __m256i CmpEq(__m256i a, __m256i b) {
+    return _mm256_cmpeq_epi8(a, b);
+  }
+  static __m256i Shuffle(__m256i a, __m256i b) {
+    return _mm256_shuffle_epi8(a, b);
+  }
+  static __m256i MulHiEpu16(__m256i a, __m256i b) {
+    return _mm256_mulhi_epu16(a, b);
+  }
+  static __m256i MulLoEpi16(__m256i a, __m256i b) {
+    return _mm256_mullo_epi16(a, b);
+  }
+  static __m256i MaddUbs(__m256i a, __m256i b) {
+    return _mm256_maddubs_epi16(a, b);
+  }
+  static __m256i Madd(__m256i a, __m256i b) { return _mm256_madd_epi16(a, b); }
+  static bool AllSet(__m256i v) { return _mm256_movemask_epi8(v) == -1; }
+};
+#endif
+
+// Each 128-bit lane holds 12 input bytes in its lower part, returns 16
+// characters per lane
+template <typename O>
+typename O::Vector EncodeLanes(typename O::Vector input, Alphabet alphabet) {
+  // Spreads each 3 bytes into 4, 6 bits of each character are to be moved
+  // into place within these 4 bytes
+  input = O::Shuffle(input, O::Lanes(_mm_setr_epi8(1, 0, 2, 1, 4, 3, 5, 4, 7,
+                                                   6, 8, 7, 10, 9, 11, 10)));
+  const auto first_and_third = O::MulHiEpu16(
+      O::And(input, O::Set1Epi32(0x0fc0fc00)), O::Set1Epi32(0x04000040));
+  const auto second_and_fourth = O::MulLoEpi16(
+      O::And(input, O::Set1Epi32(0x003f03f0)), O::Set1Epi32(0x01000010));
+  const auto indices = O::Or(first_and_third, second_and_fourth);
+
+  // Maps the ranges of the indices to the offsets of their characters:
+  // [0, 26) -> 13, [26, 52) -> 0, [52, 62) -> [1, 11), 62 -> 11, 63 -> 12
+  auto ranges = O::SubsEpu8(indices, O::Set1Epi8(51));
+  const auto is_upper = O::CmpGt(O::Set1Epi8(26), indices);
+  ranges = O::Or(ranges, O::And(is_upper, O::Set1Epi8(13)));
+  const auto offsets = O::Lanes(_mm_setr_epi8(
+      'a' - 26, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52,
+      '0' - 52, '0' - 52, '0' - 52, '0' - 52,
+      static_cast<char>(alphabet.char62 - 62),
+      static_cast<char>(alphabet.char63 - 63), 'A', 0, 0));
+  return O::Add(O::Shuffle(offsets, ranges), indices);
+}
+
+// Returns false if any of the characters is not in the alphabet, otherwise
+// each 128-bit lane of `output` holds 12 decoded bytes in its lower part
+template <typename O>
+bool DecodeLanes(typename O::Vector input, Alphabet alphabet,
+                 typename O::Vector& output) {
+  // The signed comparisons reject the non-ASCII characters as well
+  const auto in_range = [&input](char first, char last) {
+    return O::And(O::CmpGt(input, O::Set1Epi8(first - 1)),
+                  O::CmpGt(O::Set1Epi8(last + 1), input));
+  };
+  const auto is_upper = in_range('A', 'Z');
+  const auto is_lower = in_range('a', 'z');
+  const auto is_digit = in_range('0', '9');
+  const auto is_62 = O::CmpEq(input, O::Set1Epi8(alphabet.char62));
+  const auto is_63 = O::CmpEq(input, O::Set1Epi8(alphabet.char63));
+  if (!O::AllSet(O::Or(O::Or(O::Or(is_upper, is_lower), O::Or(is_digit, is_62)),
+                       is_63))) {
+    return false;
+  }
+
+  const auto offsets = O::Or(
+      O::Or(O::And(is_upper, O::Set1Epi8('A')),
+            O::And(is_lower, O::Set1Epi8('a' - 26))),
+      O::Or(O::Or(O::And(is_digit, O::Set1Epi8('0' - 52)),
+                  O::And(is_62, O::Set1Epi8(alphabet.char62 - 62))),
+            O::And(is_63, O::Set1Epi8(alphabet.char63 - 63))));
+  const auto values = O::Sub(input, offsets);
+
+  // Merges each 4 values of 6 bits into 3 bytes and drops the 4th byte
+  const auto pairs = O::MaddUbs(values, O::Set1Epi32(0x01400140));
+  const auto triples = O::Madd(pairs, O::Set1Epi32(0x00011000));
+  output = O::Shuffle(triples, O::Lanes(_mm_setr_epi8(2, 1, 0, 6, 5, 4, 10, 9,
+                                                      8, 14, 13, 12, -1, -1,
+                                                      -1, -1)));
+  return true;
+}
+#endif
+
+char* Encode(std::string_view data, char* dst, Alphabet alphabet, Pad pad) {
+  static constexpr auto kStandardTable = MakeEncodeTable(kStandard);
+  static constexpr auto kUrlTable = MakeEncodeTable(kUrl);
+  const auto& table = alphabet.char62 == kStandard.char62 ? kStandardTable
+                                                           : kUrlTable;
+
+  const auto* first = reinterpret_cast<const unsigned char*>(data.data());
+  const auto* last = first + data.size();
+
+#if defined(__AVX2__)
+  // Reads 28 bytes, encodes 24 of them
+  while (last - first >= 28) {
+    const auto input = _mm256_inserti128_si256(
+        _mm256_castsi128_si256(
+            _mm_loadu_si128(reinterpret_cast<const __m128i*>(first))),
+        _mm_loadu_si128(reinterpret_cast<const __m128i*>(first + 12)), 1);
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst),
+                        EncodeLanes<Ops256>(input, alphabet));
+    first += 24;
+    dst += 32;
+  }
+#endif
+
+#if defined(__SSSE3__)
+  // Reads 16 bytes, encodes 12 of them
+  while (last - first >= 16) {
+    const auto input = _mm_loadu_si128(reinterpret_cast<const __m128i*>(first));
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(dst),
+                     EncodeLanes<Ops128>(input, alphabet));
+    first += 12;
+    dst += 16;
+  }
+#endif
+
+  for (; last - first >= 3; first += 3) {
+    const std::uint32_t triple = (first[0] << 16) | (first[1] << 8) | first[2];
+    *(dst++) = table[triple >> 18];
+    *(dst++) = table[(triple >> 12) & 0x3f];
+    *(dst++) = table[(triple >> 6) & 0x3f];
+    *(dst++) = table[triple & 0x3f];
+  }
+
+  if (last - first == 1) {
+    *(dst++) = table[first[0] >> 2];
+    *(dst++) = table[(first[0] & 0x3) << 4];
+    if (pad == Pad::kWith) {
+      *(dst++) = '=';
+      *(dst++) = '=';
+    }
+  } else if (last - first == 2) {
+    *(dst++) = table[first[0] >> 2];
+    *(dst++) = table[((first[0] & 0x3) << 4) | (first[1] >> 4)];
+    *(dst++) = table[(first[1] & 0xf) << 2];
+    if (pad == Pad::kWith) *(dst++) = '=';
+  }
+  return dst;
+}
+
+char* Decode(std::string_view data, char* dst, Alphabet alphabet) {
+  static constexpr auto kStandardTable = MakeDecodeTable(kStandard);
+  static constexpr auto kUrlTable = MakeDecodeTable(kUrl);
+  const auto& table = alphabet.char62 == kStandard.char62 ? kStandardTable
+                                                           : kUrlTable;
+
+  const auto* first = data.data();
+  const auto* last = first + data.size();
+
+  // The vectorized loops stop at the first chunk with a character out of the
+  // alphabet, usually the padding, the rest is decoded one by one
+#if defined(__AVX2__)
+  __m256i output256;
+  while (last - first >= 32 &&
+         DecodeLanes<Ops256>(
+             _mm256_loadu_si256(reinterpret_cast<const __m256i*>(first)),
+             alphabet, output256)) {
+    // Moves the 12 bytes of the upper lane next to the lower ones
+    _mm256_storeu_si256(
+        reinterpret_cast<__m256i*>(dst),
+        _mm256_permutevar8x32_epi32(output256,
+                                    _mm256_setr_epi32(0, 1, 2, 4, 5, 6, 3, 7)));
+    first += 32;
+    dst += 24;
+  }
+#endif
+
+#if defined(__SSSE3__)
+  __m128i output128;
+  while (last - first >= 16 &&
+         DecodeLanes<Ops128>(
+             _mm_loadu_si128(reinterpret_cast<const __m128i*>(first)),
+             alphabet, output128)) {
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(dst), output128);
+    first += 16;
+    dst += 12;
+  }
+#endif
+
+  std::uint32_t bits = 0;
+  int bits_count = 0;
+  for (; first != last; ++first) {
+    const auto value = table[static_cast<unsigned char>(*first)];
+    if (value == kNotInAlphabet) continue;
+
+    bits = (bits << 6) | value;
+    bits_count += 6;
+    if (bits_count >= 8) {
+      bits_count -= 8;
+      *(dst++) = static_cast<char>(bits >> bits_count);
+      bits &= (1U << bits_count) - 1;
+    }
+  }
+  // The incomplete trailing bits are dropped
+  return dst;
+}
+
+void EncodeAppend(std::string_view data, std::string& out, Alphabet alphabet,
+                  Pad pad) {
+  const auto old_size = out.size();
+  out.resize(old_size + GetEncodedSize(data.size(), pad));
+  [[maybe_unused]] const auto* end =
+      Encode(data, out.data() + old_size, alphabet, pad);
+  UASSERT(end == out.data() + out.size());
+}
+
+void DecodeAppend(std::string_view data, std::string& out, Alphabet alphabet) {
+  const auto old_size = out.size();
+#if defined(__SSSE3__)
+  out.resize(old_size + GetDecodedSizeUpperBound(data.size()) + kDecodeSlack);
+#else
+  out.resize(old_size + GetDecodedSizeUpperBound(data.size()));
+#endif
+  const auto* end = Decode(data, out.data() + old_size, alphabet);
+  out.resize(end - out.data());
 }
 
 }  // namespace
 
 std::string Base64Encode(std::string_view data, Pad pad) {
-  return Base64Encode<CryptoPP::Base64Encoder>(data, pad);
+  std::string response;
+  EncodeAppend(data, response, kStandard, pad);
+  return response;
+}
+
+void Base64EncodeAppend(std::string_view data, std::string& out, Pad pad) {
+  EncodeAppend(data, out, kStandard, pad);
 }
 
 std::string Base64Decode(std::string_view data) {
-  return Base64Decode<CryptoPP::Base64Decoder>(data);
+  std::string response;
+  DecodeAppend(data, response, kStandard);
+  return response;
+}
+
+void Base64DecodeAppend(std::string_view data, std::string& out) {
+  DecodeAppend(data, out, kStandard);
 }
 
 #ifndef USERVER_NO_CRYPTOPP_BASE64_URL
 std::string Base64UrlEncode(std::string_view data, Pad pad) {
-  return Base64Encode<CryptoPP::Base64URLEncoder>(data, pad);
+  std::string response;
+  EncodeAppend(data, response, kUrl, pad);
+  return response;
+}
+
+void Base64UrlEncodeAppend(std::string_view data, std::string& out, Pad pad) {
+  EncodeAppend(data, out, kUrl, pad);
 }
 
 std::string Base64UrlDecode(std::string_view data) {
-  return Base64Decode<CryptoPP::Base64URLDecoder>(data);
+  std::string response;
+  DecodeAppend(data, response, kUrl);
+  return response;
+}
+
+void Base64UrlDecodeAppend(std::string_view data, std::string& out) {
+  DecodeAppend(data, out, kUrl);
 }
 #endif
 
@@ -0,0 +1,71 @@
+#include <benchmark/benchmark.h>
+
+#include <string>
+
+#include <userver/crypto/base64.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+std::string GenerateSource(size_t size) {
+  std::string source;
+  source.reserve(size);
+  for (size_t i = 0; i < size; ++i) {
+    source.push_back(static_cast<char>(i * 37));
+  }
+
+  return source;
+}
+
+}  // namespace
+
+void base64_encode_benchmark(benchmark::State& state) {
+  const auto source = GenerateSource(state.range(0));
+
+  for ([[maybe_unused]] auto _ : state) {
+    benchmark::DoNotOptimize(crypto::base64::Base64Encode(source));
+  }
+}
+BENCHMARK(base64_encode_benchmark)->RangeMultiplier(4)->Range(8, 8192);
+
+void base64_encode_append_benchmark(benchmark::State& state) {
+  const auto source = GenerateSource(state.range(0));
+
+  std::string out;
+  out.reserve(state.range(0) * 2);
+
+  for ([[maybe_unused]] auto _ : state) {
+    out.clear();
+    crypto::base64::Base64EncodeAppend(source, out);
+    benchmark::DoNotOptimize(out);
+  }
+}
+BENCHMARK(base64_encode_append_benchmark)->RangeMultiplier(4)->Range(8, 8192);
+
+void base64_decode_benchmark(benchmark::State& state) {
+  const auto source =
+      crypto::base64::Base64Encode(GenerateSource(state.range(0)));
+
+  for ([[maybe_unused]] auto _ : state) {
+    benchmark::DoNotOptimize(crypto::base64::Base64Decode(source));
+  }
+}
+BENCHMARK(base64_decode_benchmark)->RangeMultiplier(4)->Range(8, 8192);
+
+void base64_decode_append_benchmark(benchmark::State& state) {
+  const auto source =
+      crypto::base64::Base64Encode(GenerateSource(state.range(0)));
+
+  std::string out;
+  out.reserve(state.range(0) + 16);
+
+  for ([[maybe_unused]] auto _ : state) {
+    out.clear();
+    crypto::base64::Base64DecodeAppend(source, out);
+    benchmark::DoNotOptimize(out);
+  }
+}
+BENCHMARK(base64_decode_append_benchmark)->RangeMultiplier(4)->Range(8, 8192);
+
+USERVER_NAMESPACE_END
@@ -1,5 +1,7 @@
 #include <gtest/gtest.h>
 
+#include <string>
+
 #include <userver/crypto/base64.hpp>
 
 USERVER_NAMESPACE_BEGIN
@@ -17,6 +19,42 @@ TEST(Crypto, Base64) {
   EXPECT_EQ("U/8=", crypto::base64::Base64Encode("S\xff"));
 }
 
+TEST(Crypto, Base64Append) {
+  std::string result{"prefix:"};
+  crypto::base64::Base64EncodeAppend("test", result);
+  EXPECT_EQ("prefix:dGVzdA==", result);
+
+  result = "prefix:";
+  crypto::base64::Base64DecodeAppend("dGVzdA==", result);
+  EXPECT_EQ("prefix:test", result);
+}
+
+TEST(Crypto, Base64RoundTripAllSizes) {
+  std::string data;
+  for (int size = 0; size < 200; ++size) {
+    for (const auto pad :
+         {crypto::base64::Pad::kWith, crypto::base64::Pad::kWithout}) {
+      const auto encoded = crypto::base64::Base64Encode(data, pad);
+      ASSERT_EQ(data, crypto::base64::Base64Decode(encoded)) << size;
+    }
+    data.push_back(static_cast<char>(size * 37));
+  }
+}
+
+TEST(Crypto, Base64DecodeSkipsJunk) {
+  const std::string data(100, '\xff');
+  const auto encoded = crypto::base64::Base64Encode(data);
+  ASSERT_EQ(std::string(132, '/') + "/w==", encoded);
+
+  // Line breaks and other characters out of the alphabet are skipped even
+  // in the middle of a long input
+  std::string with_junk = encoded;
+  with_junk.insert(70, "\r\n");
+  with_junk.insert(20, "=");
+  with_junk.insert(5, "\xff");
+  EXPECT_EQ(data, crypto::base64::Base64Decode(with_junk));
+}
+
 #ifndef USERVER_NO_CRYPTOPP_BASE64_URL
 TEST(Crypto, Base64Url) {
   EXPECT_EQ("U_8=", crypto::base64::Base64UrlEncode("S\xff"));
@@ -24,6 +62,18 @@ TEST(Crypto, Base64Url) {
                        "S\xff", crypto::base64::Pad::kWithout));
   EXPECT_EQ("S\xFF", crypto::base64::Base64UrlDecode("U_8"));
   EXPECT_EQ("S\xFF", crypto::base64::Base64UrlDecode("U_8="));
+
+  const std::string data(100, '\xff');
+  const auto encoded = crypto::base64::Base64UrlEncode(data);
+  EXPECT_EQ(std::string(132, '_') + "_w==", encoded);
+  EXPECT_EQ(data, crypto::base64::Base64UrlDecode(encoded));
+
+  std::string result{"prefix:"};
+  crypto::base64::Base64UrlEncodeAppend("S\xff", result,
+                                        crypto::base64::Pad::kWithout);
+  EXPECT_EQ("prefix:U_8", result);
+  crypto::base64::Base64UrlDecodeAppend("U_8", result);
+  EXPECT_EQ("prefix:U_8S\xff", result);
 }
 #endif
 
@@ -1,6 +1,8 @@
 #include <userver/crypto/hash.hpp>
 
 #include <array>
+#include <memory>
+#include <vector>
 
 #include <cryptopp/base64.h>
 #ifndef USERVER_NO_CRYPTOPP_BLAKE2
@@ -11,9 +13,14 @@
 #include <cryptopp/hmac.h>
 #include <cryptopp/sha.h>
 
-#include <userver/crypto/exception.hpp>
-
 #include <cryptopp/md5.h>
+#include <openssl/evp.h>
+
+#include <crypto/helpers.hpp>
+#include <crypto/openssl.hpp>
+#include <userver/compiler/thread_local.hpp>
+#include <userver/crypto/exception.hpp>
+#include <userver/utils/assert.hpp>
 
 #ifdef CRYPTOPP_NO_GLOBAL_BYTE
 using CryptoPP::byte;
@@ -145,6 +152,223 @@ std::string HmacSha1(std::string_view key, std::string_view message,
   return CalculateHmac<CryptoPP::SHA1>(key, message, encoding);
 }
 
+namespace {
+
+// A context is taken only for the lifetime of a Hasher or Hmac, a few of them
+// are enough even for nested calculations
+constexpr std::size_t kMaxPooledContexts = 4;
+
+compiler::ThreadLocal local_md_ctx_pool = [] {
+  std::vector<EvpMdCtx> pool;
+  // So that returning a context never allocates
+  pool.reserve(kMaxPooledContexts);
+  return pool;
+};
+
+void ResetMdCtx(EVP_MD_CTX* ctx) noexcept {
+#if OPENSSL_VERSION_NUMBER >= 0x010100000L
+  EVP_MD_CTX_reset(ctx);
+#else
+  EVP_MD_CTX_cleanup(ctx);
+#endif
+}
+
+// An EVP_MD_CTX from the thread-local pool, creating one is an allocation
+// inside OpenSSL
+class PooledMdCtx final {
+ public:
+  PooledMdCtx() : ctx_(Acquire()) {}
+
+  PooledMdCtx(PooledMdCtx&&) noexcept = default;
+  PooledMdCtx& operator=(PooledMdCtx&&) noexcept = default;
+
+  // NOTE: may be called on a different thread than the constructor, the
+  // context is then returned to the pool of that thread
+  ~PooledMdCtx() {
+    if (!ctx_.Get()) return;
+    // Drops the keys and the state for the next user
+    ResetMdCtx(ctx_.Get());
+    auto pool = local_md_ctx_pool.Use();
+    if (pool->size() < kMaxPooledContexts) {
+      pool->push_back(std::move(ctx_));
+    }
+  }
+
+  EVP_MD_CTX* Get() noexcept { return ctx_.Get(); }
+
+ private:
+  static EvpMdCtx Acquire() {
+    auto pool = local_md_ctx_pool.Use();
+    if (pool->empty()) return EvpMdCtx{};
+    auto ctx = std::move(pool->back());
+    pool->pop_back();
+    return ctx;
+  }
+
+  EvpMdCtx ctx_;
+};
+
+const EVP_MD* GetMd(Algorithm algorithm) {
+  switch (algorithm) {
+    case Algorithm::kSha1:
+      return EVP_sha1();
+    case Algorithm::kSha224:
+      return EVP_sha224();
+    case Algorithm::kSha256:
+      return EVP_sha256();
+    case Algorithm::kSha384:
+      return EVP_sha384();
+    case Algorithm::kSha512:
+      return EVP_sha512();
+  }
+
+  UINVARIANT(false, "Unexpected hash algorithm");
+}
+
+void CheckOutputSize(utils::span<char> out, std::size_t digest_size) {
+  if (out.size() < digest_size) {
+    throw CryptoException("Output buffer is too small for the digest");
+  }
+}
+
+std::string EncodeDigest(utils::span<const char> digest,
+                         OutputEncoding encoding) {
+  return EncodeArray(reinterpret_cast<const byte*>(digest.data()),
+                     digest.size(), encoding);
+}
+
+}  // namespace
+
+struct Hasher::Impl final {
+  void Init() {
+    if (1 != EVP_DigestInit_ex(ctx.Get(), md, nullptr)) {
+      throw CryptoException(
+          FormatSslError("Failed to hash: EVP_DigestInit_ex"));
+    }
+  }
+
+  PooledMdCtx ctx;
+  const EVP_MD* md;
+};
+
+Hasher::Hasher(Algorithm algorithm) : impl_(Impl{{}, GetMd(algorithm)}) {
+  impl::Openssl::Init();
+  impl_->Init();
+}
+
+Hasher::Hasher(Hasher&&) noexcept = default;
+
+Hasher& Hasher::operator=(Hasher&&) noexcept = default;
+
+Hasher::~Hasher() = default;
+
+void Hasher::Update(std::string_view data) {
+  if (1 != EVP_DigestUpdate(impl_->ctx.Get(), data.data(), data.size())) {
+    throw CryptoException(FormatSslError("Failed to hash: EVP_DigestUpdate"));
+  }
+}
+
+void Hasher::Update(std::initializer_list<std::string_view> data) {
+  for (const auto part : data) Update(part);
+}
+
+std::size_t Hasher::GetDigestSize() const { return EVP_MD_size(impl_->md); }
+
+std::string Hasher::Finish(OutputEncoding encoding) {
+  std::array<char, EVP_MAX_MD_SIZE> digest{};
+  const auto size = Finish(digest);
+  return EncodeDigest({digest.data(), size}, encoding);
+}
+
+std::size_t Hasher::Finish(utils::span<char> out) {
+  CheckOutputSize(out, GetDigestSize());
+  unsigned int size = 0;
+  if (1 != EVP_DigestFinal_ex(impl_->ctx.Get(),
+                              reinterpret_cast<unsigned char*>(out.data()),
+                              &size)) {
+    throw CryptoException(
+        FormatSslError("Failed to hash: EVP_DigestFinal_ex"));
+  }
+  impl_->Init();
+  return size;
+}
+
+struct Hmac::Impl final {
+  // Not final, so that the empty deleter takes no space in unique_ptr
+  struct KeyDeleter {
+    void operator()(EVP_PKEY* key) const noexcept { EVP_PKEY_free(key); }
+  };
+
+  void Init() {
+    if (1 != EVP_DigestSignInit(ctx.Get(), nullptr, md, nullptr, key.get())) {
+      throw CryptoException(
+          FormatSslError("Failed to calculate HMAC: EVP_DigestSignInit"));
+    }
+  }
+
+  PooledMdCtx ctx;
+  const EVP_MD* md;
+  std::unique_ptr<EVP_PKEY, KeyDeleter> key;
+};
+
+Hmac::Hmac(Algorithm algorithm, std::string_view key)
+    : impl_(Impl{{}, GetMd(algorithm), {}}) {
+  impl::Openssl::Init();
+
+  // OpenSSL 3 rejects empty keys. HMAC pads the key with zeros up to the block
+  // size, so a single zero byte is an equivalent key.
+  static constexpr unsigned char kZeroKey[1]{};
+  const auto* key_data = reinterpret_cast<const unsigned char*>(key.data());
+  impl_->key.reset(EVP_PKEY_new_mac_key(
+      EVP_PKEY_HMAC, nullptr, key.empty() ? kZeroKey : key_data,
+      key.empty() ? 1 : static_cast<int>(key.size())));
+  if (!impl_->key) {
+    throw CryptoException(
+        FormatSslError("Failed to calculate HMAC: EVP_PKEY_new_mac_key"));
+  }
+  impl_->Init();
+}
+
+Hmac::Hmac(Hmac&&) noexcept = default;
+
+Hmac& Hmac::operator=(Hmac&&) noexcept = default;
+
+Hmac::~Hmac() = default;
+
+void Hmac::Update(std::string_view data) {
+  if (1 != EVP_DigestSignUpdate(impl_->ctx.Get(), data.data(), data.size())) {
+    throw CryptoException(
+        FormatSslError("Failed to calculate HMAC: EVP_DigestSignUpdate"));
+  }
+}
+
+void Hmac::Update(std::initializer_list<std::string_view> data) {
+  for (const auto part : data) Update(part);
+}
+
+std::size_t Hmac::GetDigestSize() const { return EVP_MD_size(impl_->md); }
+
+std::string Hmac::Finish(OutputEncoding encoding) {
+  std::array<char, EVP_MAX_MD_SIZE> mac{};
+  const auto size = Finish(mac);
+  return EncodeDigest({mac.data(), size}, encoding);
+}
+
+std::size_t Hmac::Finish(utils::span<char> out) {
+  CheckOutputSize(out, GetDigestSize());
+  std::size_t size = out.size();
+  if (1 != EVP_DigestSignFinal(impl_->ctx.Get(),
+                               reinterpret_cast<unsigned char*>(out.data()),
+                               &size)) {
+    throw CryptoException(
+        FormatSslError("Failed to calculate HMAC: EVP_DigestSignFinal"));
+  }
+  // Re-initialization of a used signing context is only defined after reset
+  ResetMdCtx(impl_->ctx.Get());
+  impl_->Init();
+  return size;
+}
+
 namespace weak {
 
 std::string Md5(std::string_view data, OutputEncoding encoding) {
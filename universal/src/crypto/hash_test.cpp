@@ -1,5 +1,9 @@
 #include <gtest/gtest.h>
 
+#include <array>
+#include <string>
+
+#include <userver/crypto/exception.hpp>
 #include <userver/crypto/hash.hpp>
 
 USERVER_NAMESPACE_BEGIN
@@ -94,6 +98,63 @@ TEST(Crypto, Hmac) {
                                crypto::hash::OutputEncoding::kHex));
 }
 
+TEST(Crypto, Hasher) {
+  crypto::hash::Hasher hasher{crypto::hash::Algorithm::kSha256};
+  hasher.Update("te");
+  hasher.Update({"", "s", "t"});
+  EXPECT_EQ(crypto::hash::Sha256("test"), hasher.Finish());
+
+  // Starts over after Finish()
+  hasher.Update("test\n");
+  EXPECT_EQ(crypto::hash::Sha256("test\n"), hasher.Finish());
+  EXPECT_EQ(crypto::hash::Sha256({}), hasher.Finish());
+
+  crypto::hash::Hasher sha1{crypto::hash::Algorithm::kSha1};
+  sha1.Update("test");
+  EXPECT_EQ(crypto::hash::Sha1("test", crypto::hash::OutputEncoding::kBase64),
+            sha1.Finish(crypto::hash::OutputEncoding::kBase64));
+}
+
+TEST(Crypto, HasherRawDigest) {
+  crypto::hash::Hasher hasher{crypto::hash::Algorithm::kSha512};
+  EXPECT_EQ(64, hasher.GetDigestSize());
+  hasher.Update({"te", "st"});
+
+  std::array<char, 64> digest{};
+  ASSERT_EQ(64, hasher.Finish(digest));
+  EXPECT_EQ(
+      crypto::hash::Sha512("test", crypto::hash::OutputEncoding::kBinary),
+      std::string(digest.data(), digest.size()));
+
+  std::array<char, 32> too_small{};
+  EXPECT_THROW(hasher.Finish(too_small), crypto::CryptoException);
+}
+
+TEST(Crypto, HmacIncremental) {
+  crypto::hash::Hmac hmac{crypto::hash::Algorithm::kSha512, "test"};
+  hmac.Update({"t", "e", "st"});
+  EXPECT_EQ(crypto::hash::HmacSha512("test", "test"), hmac.Finish());
+
+  // Starts over with the same key after Finish()
+  hmac.Update("test");
+  EXPECT_EQ(crypto::hash::HmacSha512("test", "test"), hmac.Finish());
+
+  crypto::hash::Hmac sha384{crypto::hash::Algorithm::kSha384, "secret"};
+  EXPECT_EQ(crypto::hash::HmacSha384("secret", ""), sha384.Finish());
+
+  crypto::hash::Hmac empty_key{crypto::hash::Algorithm::kSha256, ""};
+  empty_key.Update("test");
+  EXPECT_EQ(crypto::hash::HmacSha256("", "test"), empty_key.Finish());
+
+  crypto::hash::Hmac sha1{crypto::hash::Algorithm::kSha1, "test"};
+  std::array<char, 20> mac{};
+  sha1.Update("test");
+  ASSERT_EQ(20, sha1.Finish(mac));
+  EXPECT_EQ(crypto::hash::HmacSha1("test", "test",
+                                   crypto::hash::OutputEncoding::kBinary),
+            std::string(mac.data(), mac.size()));
+}
+
 #ifndef USERVER_NO_CRYPTOPP_BLAKE2
 TEST(Crypto, Blake2b128) {
   EXPECT_EQ("e9a804b2e527fd3601d2ffc0bb023cd6",
@@ -93,16 +93,21 @@ EvpMdCtx::~EvpMdCtx() {
 EvpMdCtx::EvpMdCtx(EvpMdCtx&& other) noexcept
     : ctx_(std::exchange(other.ctx_, nullptr)) {}
 
-decltype(&crypto::hash::HmacSha256) GetHmacFuncByEnum(DigestSize bits) {
+EvpMdCtx& EvpMdCtx::operator=(EvpMdCtx&& other) noexcept {
+  std::swap(ctx_, other.ctx_);
+  return *this;
+}
+
+crypto::hash::Algorithm GetShaAlgorithmByEnum(DigestSize bits) {
   switch (bits) {
     case DigestSize::k160:
-      return crypto::hash::HmacSha1;
+      return crypto::hash::Algorithm::kSha1;
     case DigestSize::k256:
-      return crypto::hash::HmacSha256;
+      return crypto::hash::Algorithm::kSha256;
     case DigestSize::k384:
-      return crypto::hash::HmacSha384;
+      return crypto::hash::Algorithm::kSha384;
     case DigestSize::k512:
-      return crypto::hash::HmacSha512;
+      return crypto::hash::Algorithm::kSha512;
   }
 
   UINVARIANT(false, "Unexpected DigestSize");
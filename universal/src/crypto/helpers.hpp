@@ -23,6 +23,7 @@ class EvpMdCtx {
 
   EvpMdCtx(const EvpMdCtx&) = delete;
   EvpMdCtx(EvpMdCtx&&) noexcept;
+  EvpMdCtx& operator=(EvpMdCtx&&) noexcept;
 
   EVP_MD_CTX* Get() { return ctx_; }
 
@@ -49,7 +50,7 @@ constexpr size_t GetDigestLength(DigestSize digest_size) {
   return (bits + CHAR_BIT - 1) / CHAR_BIT;
 }
 
-decltype(&crypto::hash::HmacSha256) GetHmacFuncByEnum(DigestSize bits);
+crypto::hash::Algorithm GetShaAlgorithmByEnum(DigestSize bits);
 const EVP_MD* GetShaMdByEnum(DigestSize bits);
 
 std::string InitListToString(std::initializer_list<std::string_view> data);
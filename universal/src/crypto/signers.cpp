@@ -127,19 +127,9 @@ HmacShaSigner<bits>::~HmacShaSigner() {
 template <DigestSize bits>
 std::string HmacShaSigner<bits>::Sign(
     std::initializer_list<std::string_view> data) const {
-  const auto hmac = GetHmacFuncByEnum(bits);
-
-  if (data.size() <= 1) {
-    std::string_view single_value{};
-    if (data.size()) {
-      single_value = *data.begin();
-    }
-
-    return hmac(secret_, single_value, crypto::hash::OutputEncoding::kBinary);
-  }
-
-  return hmac(secret_, InitListToString(data),
-              crypto::hash::OutputEncoding::kBinary);
+  crypto::hash::Hmac hmac{GetShaAlgorithmByEnum(bits), secret_};
+  hmac.Update(data);
+  return hmac.Finish(crypto::hash::OutputEncoding::kBinary);
 }
 
 template class HmacShaSigner<DigestSize::k160>;
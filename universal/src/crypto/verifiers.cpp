@@ -121,20 +121,9 @@ HmacShaVerifier<bits>::~HmacShaVerifier() {
 template <DigestSize bits>
 void HmacShaVerifier<bits>::Verify(std::initializer_list<std::string_view> data,
                                    std::string_view raw_signature) const {
-  const auto hmac = GetHmacFuncByEnum(bits);
-  std::string signature;
-  if (data.size() <= 1) {
-    std::string_view single_value{};
-    if (data.size() == 1) {
-      single_value = *data.begin();
-    }
-
-    signature =
-        hmac(secret_, single_value, crypto::hash::OutputEncoding::kBinary);
-  } else {
-    signature = hmac(secret_, InitListToString(data),
-                     crypto::hash::OutputEncoding::kBinary);
-  }
+  crypto::hash::Hmac hmac{GetShaAlgorithmByEnum(bits), secret_};
+  hmac.Update(data);
+  const auto signature = hmac.Finish(crypto::hash::OutputEncoding::kBinary);
 
   if (raw_signature != signature) {
     throw VerificationError("Invalid signature");
@@ -0,0 +1,106 @@
+#include <benchmark/benchmark.h>
+
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <userver/decimal64/decimal64.hpp>
+#include <userver/utils/rand.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+using Money = decimal64::Decimal<4, decimal64::HalfEvenRoundPolicy>;
+
+std::vector<Money> GenerateDecimals(std::size_t count) {
+  std::vector<Money> result;
+  result.reserve(count);
+  for (std::size_t i = 0; i < count; ++i) {
+    result.push_back(Money::FromUnbiased(
+        static_cast<int64_t>(utils::RandRange(uint64_t{1'000'000'000})) -
+        500'000'000));
+  }
+  return result;
+}
+
+}  // namespace
+
+// Baseline: the generic parser, without the fast path of the constructor
+void Decimal64GenericParse(benchmark::State& state) {
+  const auto strings = decimal64::ToStrings(GenerateDecimals(state.range(0)));
+
+  for ([[maybe_unused]] auto _ : state) {
+    std::vector<Money> result;
+    result.reserve(strings.size());
+    for (const auto& string : strings) {
+      result.push_back(decimal64::impl::Parse<4, Money::RoundPolicy>(
+                           decimal64::impl::StringCharSequence(
+                               std::string_view{string}),
+                           decimal64::impl::ParseOptions::kNone)
+                           .decimal);
+    }
+    benchmark::DoNotOptimize(result);
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(Decimal64GenericParse)->Range(1024, 1 << 20);
+
+void Decimal64FromStrings(benchmark::State& state) {
+  const auto strings = decimal64::ToStrings(GenerateDecimals(state.range(0)));
+
+  for ([[maybe_unused]] auto _ : state) {
+    benchmark::DoNotOptimize(decimal64::FromStrings<Money>(strings));
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(Decimal64FromStrings)->Range(1024, 1 << 20);
+
+void Decimal64ToStrings(benchmark::State& state) {
+  const auto decimals = GenerateDecimals(state.range(0));
+
+  for ([[maybe_unused]] auto _ : state) {
+    benchmark::DoNotOptimize(decimal64::ToStrings(decimals));
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(Decimal64ToStrings)->Range(1024, 1 << 20);
+
+void Decimal64SumLoop(benchmark::State& state) {
+  const auto decimals = GenerateDecimals(state.range(0));
+
+  for ([[maybe_unused]] auto _ : state) {
+    Money sum{0};
+    for (const auto dec : decimals) sum += dec;
+    benchmark::DoNotOptimize(sum);
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(Decimal64SumLoop)->Range(1024, 1 << 20);
+
+void Decimal64Sum(benchmark::State& state) {
+  const auto decimals = GenerateDecimals(state.range(0));
+
+  for ([[maybe_unused]] auto _ : state) {
+    benchmark::DoNotOptimize(decimal64::Sum(decimals));
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(Decimal64Sum)->Range(1024, 1 << 20);
+
+void Decimal64MultiplyInPlace(benchmark::State& state) {
+  const auto decimals = GenerateDecimals(state.range(0));
+  const decimal64::Decimal<2, Money::RoundPolicy> vat{"1.18"};
+
+  for ([[maybe_unused]] auto _ : state) {
+    state.PauseTiming();
+    auto values = decimals;
+    state.ResumeTiming();
+    decimal64::MultiplyInPlace(values, vat);
+    benchmark::DoNotOptimize(values);
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(Decimal64MultiplyInPlace)->Range(1024, 1 << 20);
+
+USERVER_NAMESPACE_END
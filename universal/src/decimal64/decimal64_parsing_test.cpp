@@ -2,6 +2,8 @@
 
 #include <ios>
 #include <sstream>
+#include <string>
+#include <vector>
 
 #include <gtest/gtest.h>
 
@@ -80,6 +82,40 @@ TEST(Decimal64, ConstructFromString) {
 }
 
 // NOLINTNEXTLINE(readability-function-size)
+TEST(Decimal64, ConstructFromStringMatchesGenericParse) {
+  // The constructor has a fast path for simple strings, check that it agrees
+  // with the generic parser on strings around its boundaries
+  const std::vector<std::string> inputs{
+      "0", "-0", "+0", "007", "1.5", "-1.5", "+1.5", "1.2345", "-0.0001",
+      "1.23456", "1.", ".1", "-", "+", "", "1e5", "1,5", " 1", "1 ", "1.-5",
+      "922337203685477", "922337203685476.9999", "-922337203685476.9999",
+      "123456789012345678", "1234567890123456789", "0000000000000000001",
+      "--1", "1..2", "1.2.3"};
+
+  for (const auto& input : inputs) {
+    const auto parsed = decimal64::impl::Parse<4, decimal64::DefRoundPolicy>(
+        decimal64::impl::StringCharSequence(std::string_view{input}),
+        decimal64::impl::ParseOptions::kNone);
+    if (parsed.error) {
+      EXPECT_THROW(Dec4{input}, decimal64::ParseError) << input;
+    } else {
+      EXPECT_EQ(Dec4{input}, parsed.decimal) << input;
+    }
+  }
+}
+
+TEST(Decimal64, FromStrings) {
+  const std::vector<std::string> inputs{"1.5", "-0.0001", "42"};
+  const auto decimals = decimal64::FromStrings<Dec4>(inputs);
+  EXPECT_EQ(decimals,
+            (std::vector<Dec4>{Dec4{"1.5"}, Dec4{"-0.0001"}, Dec4{42}}));
+  EXPECT_EQ(decimal64::ToStrings(decimals),
+            (std::vector<std::string>{"1.5", "-0.0001", "42"}));
+
+  const std::vector<std::string_view> invalid{"1.5", "abc"};
+  EXPECT_THROW(decimal64::FromStrings<Dec4>(invalid), decimal64::ParseError);
+}
+
 TEST(Decimal64, FromStringPermissive) {
   EXPECT_EQ(Dec4::FromStringPermissive("1234.5678"), Dec4{"1234.5678"});
   EXPECT_EQ(Dec4::FromStringPermissive(".0"), Dec4{0});
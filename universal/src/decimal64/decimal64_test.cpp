@@ -2,6 +2,7 @@
 
 #include <limits>
 #include <unordered_map>
+#include <vector>
 
 #include <gtest/gtest.h>
 
@@ -222,6 +223,55 @@ TEST(Decimal64, Overflow) {
                decimal64::OutOfBoundsError);
 }
 
+TEST(Decimal64, Sum) {
+  const std::vector<Dec4> empty;
+  EXPECT_EQ(decimal64::Sum(empty), Dec4{0});
+
+  std::vector<Dec4> values;
+  Dec4 expected{0};
+  for (int i = -1000; i < 3000; ++i) {
+    values.push_back(Dec4::FromUnbiased(int64_t{i} * 1234567891));
+    expected += values.back();
+  }
+  EXPECT_EQ(decimal64::Sum(values), expected);
+
+  constexpr auto max_decimal =
+      Dec4::FromUnbiased(std::numeric_limits<int64_t>::max());
+  constexpr auto min_decimal =
+      Dec4::FromUnbiased(std::numeric_limits<int64_t>::min());
+
+  // Only the total sum must fit: 3 * max + 2 * min == max - 2
+  const std::vector<Dec4> cancelling{max_decimal, max_decimal, min_decimal,
+                                     min_decimal, max_decimal, Dec4{-1}};
+  EXPECT_EQ(decimal64::Sum(cancelling),
+            max_decimal - Dec4::FromUnbiased(2) - Dec4{1});
+  const std::vector<Dec4> min_sum{min_decimal, Dec4{1}, Dec4{-1}};
+  EXPECT_EQ(decimal64::Sum(min_sum), min_decimal);
+
+  const std::vector<Dec4> overflow{max_decimal, Dec4::FromUnbiased(1)};
+  EXPECT_THROW(decimal64::Sum(overflow), decimal64::OutOfBoundsError);
+  const std::vector<Dec4> underflow{min_decimal, Dec4::FromUnbiased(-1)};
+  EXPECT_THROW(decimal64::Sum(underflow), decimal64::OutOfBoundsError);
+}
+
+TEST(Decimal64, MultiplyInPlace) {
+  const std::vector<Dec4> original{Dec4{"1.2345"}, Dec4{"-1.2345"},
+                                   Dec4{"100000000"}, Dec4{"0.0001"},
+                                   Dec4{"-922337203685.4775"}};
+  const Dec2 factor{"0.15"};
+
+  auto values = original;
+  decimal64::MultiplyInPlace(values, factor);
+  ASSERT_EQ(values.size(), original.size());
+  for (std::size_t i = 0; i < values.size(); ++i) {
+    EXPECT_EQ(values[i], original[i] * factor);
+  }
+
+  std::vector<Dec4> overflow{Dec4{1}, Dec4{"500000000000000"}};
+  EXPECT_THROW(decimal64::MultiplyInPlace(overflow, Dec4{2}),
+               decimal64::OutOfBoundsError);
+}
+
 TEST(Decimal64, DivisionByZero) {
   EXPECT_THROW(Dec4{1} / Dec4{0}, decimal64::DivisionByZeroError);
   EXPECT_THROW(Dec4{1} / Dec4::FromStringPermissive("0.00001"),
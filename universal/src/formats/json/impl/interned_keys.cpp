@@ -0,0 +1,110 @@
+#include <formats/json/impl/interned_keys.hpp>
+
+#include <atomic>
+#include <cstring>
+#include <memory>
+#include <mutex>
+#include <unordered_set>
+#include <vector>
+
+#include <userver/compiler/thread_local.hpp>
+#include <userver/utils/assert.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace formats::json::impl {
+
+namespace {
+
+// The table stops growing after that, so a stream of unique keys can not
+// consume unbounded memory
+constexpr std::size_t kMaxInternedBytes = 1024 * 1024;
+
+constexpr std::size_t kChunkSize = 64 * 1024;
+
+using KeySet = std::unordered_set<std::string_view>;
+
+class KeyInternTable final {
+ public:
+  const char* FindOrIntern(std::string_view key) {
+    // A full table is not modified anymore and is read without the lock
+    if (is_full_.load(std::memory_order_acquire)) return Find(key);
+
+    std::lock_guard lock(mutex_);
+    if (const char* found = Find(key)) return found;
+    if (bytes_ + key.size() > kMaxInternedBytes) {
+      is_full_.store(true, std::memory_order_release);
+      return nullptr;
+    }
+
+    if (chunks_.empty() || chunk_used_ + key.size() > kChunkSize) {
+      chunks_.push_back(std::make_unique<char[]>(kChunkSize));
+      chunk_used_ = 0;
+    }
+    char* data = chunks_.back().get() + chunk_used_;
+    std::memcpy(data, key.data(), key.size());
+    chunk_used_ += key.size();
+    bytes_ += key.size();
+
+    keys_.emplace(data, key.size());
+    return data;
+  }
+
+  bool Contains(std::string_view key) {
+    if (is_full_.load(std::memory_order_acquire)) {
+      return Find(key) == key.data();
+    }
+
+    std::lock_guard lock(mutex_);
+    return Find(key) == key.data();
+  }
+
+ private:
+  const char* Find(std::string_view key) const {
+    const auto it = keys_.find(key);
+    return it == keys_.end() ? nullptr : it->data();
+  }
+
+  std::mutex mutex_;
+  KeySet keys_;
+  std::vector<std::unique_ptr<char[]>> chunks_;
+  std::size_t chunk_used_{0};
+  std::size_t bytes_{0};
+  std::atomic<bool> is_full_{false};
+};
+
+KeyInternTable& GetKeyInternTable() {
+  // Never destroyed, values may refer to the keys during static destruction
+  static auto* table = new KeyInternTable();
+  return *table;
+}
+
+// Caches the lookups of the shared table, holds only the interned keys
+compiler::ThreadLocal local_interned_keys = [] { return KeySet{}; };
+
+}  // namespace
+
+const char* FindOrInternKey(std::string_view key) {
+  UASSERT(key.size() <= kMaxInternedKeySize);
+
+  auto local_keys = local_interned_keys.Use();
+  const auto it = local_keys->find(key);
+  if (it != local_keys->end()) return it->data();
+
+  const char* interned = GetKeyInternTable().FindOrIntern(key);
+  if (interned) local_keys->emplace(interned, key.size());
+  return interned;
+}
+
+bool IsInternedKey(std::string_view key) {
+  {
+    auto local_keys = local_interned_keys.Use();
+    const auto it = local_keys->find(key);
+    if (it != local_keys->end()) return it->data() == key.data();
+  }
+  return GetKeyInternTable().Contains(key);
+}
+
+}  // namespace formats::json::impl
+
+USERVER_NAMESPACE_END
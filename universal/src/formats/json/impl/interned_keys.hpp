@@ -0,0 +1,34 @@
+#pragma once
+
+#include <cstddef>
+#include <string_view>
+
+#include <rapidjson/document.h>
+
+#include <userver/formats/json/impl/types.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace formats::json::impl {
+
+/// Longest key that rapidjson stores inline in the value, without a heap
+/// allocation (the payload of impl::Value minus the flags and the length)
+inline constexpr std::size_t kMaxInlineKeySize = sizeof(Value) - 3;
+
+/// Longest key that is interned, longer keys are rarely repeated
+inline constexpr std::size_t kMaxInternedKeySize = 64;
+
+/// @brief Returns the interned copy of the key, or nullptr if the key is not
+/// interned.
+///
+/// Interned keys are immutable and live till the end of the program, so the
+/// values may refer to them as to constant strings. The intern table is
+/// shared by all the threads and stops growing after a total size limit.
+const char* FindOrInternKey(std::string_view key);
+
+/// @returns true if the string points into the interned keys storage
+bool IsInternedKey(std::string_view key);
+
+}  // namespace formats::json::impl
+
+USERVER_NAMESPACE_END
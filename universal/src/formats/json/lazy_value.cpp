@@ -0,0 +1,381 @@
+#include <userver/formats/json/lazy_value.hpp>
+
+#include <limits>
+#include <optional>
+#include <vector>
+
+#include <fmt/format.h>
+#include <rapidjson/error/en.h>
+#include <rapidjson/reader.h>
+
+#include <formats/json/impl/exttypes.hpp>
+#include <userver/formats/common/path.hpp>
+#include <userver/formats/json/exception.hpp>
+#include <userver/formats/json/serialize.hpp>
+#include <userver/utils/assert.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace formats::json {
+
+namespace {
+
+// Numbers are validated but not converted, the values are parsed on access
+constexpr unsigned kIndexParseFlags =
+    rapidjson::kParseDefaultFlags | rapidjson::kParseNumbersAsStringsFlag;
+
+// SIMD routines of rapidjson read the input by aligned 16-byte blocks
+constexpr std::size_t kPadding = 16;
+
+// An object or array of the document
+struct TapeEntry final {
+  // offsets of the opening and closing brackets
+  std::uint32_t open{0};
+  std::uint32_t close{0};
+  // index of the first entry after the nested objects and arrays
+  std::uint32_t next{0};
+  // number of members or elements
+  std::uint32_t size{0};
+};
+
+using Tape = std::vector<TapeEntry>;
+
+class IndexBuilder final
+    : public rapidjson::BaseReaderHandler<rapidjson::UTF8<>, IndexBuilder> {
+ public:
+  IndexBuilder(const rapidjson::StringStream& stream, Tape& tape)
+      : stream_(stream), tape_(tape) {}
+
+  bool StartObject() { return Open(); }
+  bool EndObject(rapidjson::SizeType size) { return Close(size); }
+  bool StartArray() { return Open(); }
+  bool EndArray(rapidjson::SizeType size) { return Close(size); }
+
+  bool IsDepthExceeded() const noexcept { return is_depth_exceeded_; }
+
+ private:
+  // The recursive rapidjson parser calls the handler after consuming the
+  // bracket
+  std::uint32_t LastOffset() const {
+    return static_cast<std::uint32_t>(stream_.Tell() - 1);
+  }
+
+  bool Open() {
+    if (open_.size() >= kDepthParseLimit) {
+      is_depth_exceeded_ = true;
+      return false;
+    }
+    open_.push_back(static_cast<std::uint32_t>(tape_.size()));
+    tape_.push_back(TapeEntry{LastOffset()});
+    return true;
+  }
+
+  bool Close(rapidjson::SizeType size) {
+    auto& entry = tape_[open_.back()];
+    open_.pop_back();
+    entry.close = LastOffset();
+    entry.next = static_cast<std::uint32_t>(tape_.size());
+    entry.size = size;
+    return true;
+  }
+
+  const rapidjson::StringStream& stream_;
+  Tape& tape_;
+  std::vector<std::uint32_t> open_;
+  bool is_depth_exceeded_{false};
+};
+
+bool IsWhitespace(char c) noexcept {
+  return c == ' ' || c == '\n' || c == '\r' || c == '\t';
+}
+
+std::uint32_t SkipWhitespace(const char* text, std::uint32_t pos) noexcept {
+  while (IsWhitespace(text[pos])) ++pos;
+  return pos;
+}
+
+// Returns the offset after the closing quote of the string at `pos`
+std::uint32_t SkipString(const char* text, std::uint32_t pos) noexcept {
+  UASSERT(text[pos] == '"');
+  for (++pos;; ++pos) {
+    if (text[pos] == '\\') {
+      ++pos;
+    } else if (text[pos] == '"') {
+      return pos + 1;
+    }
+  }
+}
+
+// Returns the offset after the value at `pos`, advances `tape_index` past the
+// objects and arrays of the value
+std::uint32_t SkipValue(const char* text, const Tape& tape, std::uint32_t pos,
+                        std::uint32_t& tape_index) noexcept {
+  switch (text[pos]) {
+    case '{':
+    case '[': {
+      const auto& entry = tape[tape_index];
+      UASSERT(entry.open == pos);
+      tape_index = entry.next;
+      return entry.close + 1;
+    }
+    case '"':
+      return SkipString(text, pos);
+    default:
+      while (text[pos] != ',' && text[pos] != '}' && text[pos] != ']' &&
+             text[pos] != '\0' && !IsWhitespace(text[pos])) {
+        ++pos;
+      }
+      return pos;
+  }
+}
+
+struct Item final {
+  std::string_view raw_key;
+  std::uint32_t begin;
+  std::uint32_t end;
+  std::uint32_t tape_index;
+};
+
+// Calls `func` for the members or elements of the container at `tape_index`
+// until it returns true
+template <typename Func>
+void ForEachItem(const char* text, const Tape& tape, std::uint32_t tape_index,
+                 Func func) {
+  const bool is_object = text[tape[tape_index].open] == '{';
+  auto pos = SkipWhitespace(text, tape[tape_index].open + 1);
+  auto child_tape_index = tape_index + 1;
+  if (text[pos] == '}' || text[pos] == ']') return;
+
+  for (;;) {
+    Item item{};
+    if (is_object) {
+      const auto key_end = SkipString(text, pos);
+      item.raw_key = {text + pos + 1, key_end - pos - 2};
+      pos = SkipWhitespace(text, key_end);
+      UASSERT(text[pos] == ':');
+      pos = SkipWhitespace(text, pos + 1);
+    }
+
+    item.begin = pos;
+    item.tape_index = child_tape_index;
+    item.end = SkipValue(text, tape, pos, child_tape_index);
+    if (func(item)) return;
+
+    pos = SkipWhitespace(text, item.end);
+    if (text[pos] != ',') return;
+    pos = SkipWhitespace(text, pos + 1);
+  }
+}
+
+bool IsKeyEqual(std::string_view raw_key, std::string_view key) {
+  if (raw_key.find('\\') == std::string_view::npos) return raw_key == key;
+
+  std::string quoted;
+  quoted.reserve(raw_key.size() + 2);
+  quoted += '"';
+  quoted += raw_key;
+  quoted += '"';
+  return FromString(quoted).As<std::string>() == key;
+}
+
+}  // namespace
+
+struct LazyValue::Data final {
+  // the document followed by kPadding zero bytes
+  std::string json;
+  Tape tape;
+};
+
+LazyValue::LazyValue(std::string json) : path_(common::kPathRoot) {
+  if (json.size() + kPadding >= std::numeric_limits<std::uint32_t>::max()) {
+    throw ParseException(fmt::format(
+        "JSON document of {} bytes is too large for LazyValue", json.size()));
+  }
+
+  auto data = std::make_shared<Data>();
+  data->json = std::move(json);
+  const auto size = static_cast<std::uint32_t>(data->json.size());
+  data->json.append(kPadding, '\0');
+
+  rapidjson::StringStream stream{data->json.c_str()};
+  IndexBuilder builder{stream, data->tape};
+  rapidjson::Reader reader;
+  const auto result = reader.Parse<kIndexParseFlags>(stream, builder);
+  if (builder.IsDepthExceeded()) {
+    throw ParseException("Exceeded maximum allowed JSON depth of: " +
+                         std::to_string(kDepthParseLimit));
+  }
+  if (result.IsError()) {
+    throw ParseException(
+        fmt::format("JSON parse error at offset {}: {}", result.Offset(),
+                    rapidjson::GetParseError_En(result.Code())));
+  }
+  if (stream.Tell() != size) {
+    throw ParseException(fmt::format(
+        "JSON parse error at offset {}: unexpected zero byte", stream.Tell()));
+  }
+
+  const char* text = data->json.data();
+  begin_ = SkipWhitespace(text, 0);
+  end_ = size;
+  while (end_ > begin_ && IsWhitespace(text[end_ - 1])) --end_;
+  data_ = std::move(data);
+}
+
+LazyValue::LazyValue(std::shared_ptr<const Data> data, std::uint32_t begin,
+                     std::uint32_t end, std::uint32_t tape_index,
+                     std::string path, bool is_missing)
+    : data_(std::move(data)),
+      begin_(begin),
+      end_(end),
+      tape_index_(tape_index),
+      is_missing_(is_missing),
+      path_(std::move(path)) {}
+
+LazyValue::LazyValue(const LazyValue&) = default;
+
+LazyValue::LazyValue(LazyValue&&) noexcept = default;
+
+LazyValue& LazyValue::operator=(const LazyValue&) = default;
+
+LazyValue& LazyValue::operator=(LazyValue&&) noexcept = default;
+
+LazyValue::~LazyValue() = default;
+
+LazyValue LazyValue::operator[](std::string_view key) const {
+  if (!IsMissing()) {
+    CheckObjectOrNull();
+    if (IsObject()) {
+      std::optional<Item> found;
+      ForEachItem(data_->json.data(), data_->tape, tape_index_,
+                  [&found, key](const Item& item) {
+                    if (!IsKeyEqual(item.raw_key, key)) return false;
+                    found = item;
+                    return true;
+                  });
+      if (found) {
+        return {data_,          found->begin,
+                found->end,     found->tape_index,
+                common::MakeChildPath(path_, key), false};
+      }
+    }
+  }
+  return MakeMissing(common::MakeChildPath(path_, key));
+}
+
+LazyValue LazyValue::operator[](std::size_t index) const {
+  CheckNotMissing();
+  if (!IsArray()) {
+    if (!IsNull()) {
+      throw TypeMismatchException(GetExtendedType(), impl::arrayValue,
+                                  GetPath());
+    }
+    throw OutOfBoundsException(index, 0, GetPath());
+  }
+
+  const auto size = data_->tape[tape_index_].size;
+  if (index >= size) throw OutOfBoundsException(index, size, GetPath());
+
+  std::optional<Item> found;
+  std::size_t current = 0;
+  ForEachItem(data_->json.data(), data_->tape, tape_index_,
+              [&found, &current, index](const Item& item) {
+                if (current++ != index) return false;
+                found = item;
+                return true;
+              });
+  UASSERT(found);
+  return {data_,      found->begin,
+          found->end, found->tape_index,
+          common::MakeChildPath(path_, index), false};
+}
+
+bool LazyValue::HasMember(std::string_view key) const {
+  if (IsMissing()) return false;
+  CheckObjectOrNull();
+  return !(*this)[key].IsMissing();
+}
+
+std::size_t LazyValue::GetSize() const {
+  CheckNotMissing();
+  if (IsArray() || IsObject()) return data_->tape[tape_index_].size;
+  if (IsNull()) return 0;  // nulls are "empty arrays"
+  throw TypeMismatchException(GetExtendedType(), impl::arrayValue, GetPath());
+}
+
+bool LazyValue::IsEmpty() const { return GetSize() == 0; }
+
+bool LazyValue::IsMissing() const noexcept { return is_missing_; }
+
+bool LazyValue::IsNull() const noexcept { return FirstChar() == 'n'; }
+
+bool LazyValue::IsBool() const noexcept {
+  const char c = FirstChar();
+  return c == 't' || c == 'f';
+}
+
+bool LazyValue::IsNumber() const noexcept {
+  const char c = FirstChar();
+  return c == '-' || (c >= '0' && c <= '9');
+}
+
+bool LazyValue::IsString() const noexcept { return FirstChar() == '"'; }
+
+bool LazyValue::IsArray() const noexcept { return FirstChar() == '['; }
+
+bool LazyValue::IsObject() const noexcept { return FirstChar() == '{'; }
+
+Value LazyValue::Materialize() const { return FromString(GetRawJson()); }
+
+std::string_view LazyValue::GetRawJson() const {
+  CheckNotMissing();
+  return std::string_view{data_->json}.substr(begin_, end_ - begin_);
+}
+
+std::string LazyValue::GetPath() const { return path_; }
+
+LazyValue LazyValue::MakeMissing(std::string path) const {
+  return {data_, begin_, end_, tape_index_, std::move(path), true};
+}
+
+char LazyValue::FirstChar() const noexcept {
+  return IsMissing() ? '\0' : data_->json[begin_];
+}
+
+int LazyValue::GetExtendedType() const {
+  switch (FirstChar()) {
+    case 'n':
+      return impl::nullValue;
+    case 't':
+    case 'f':
+      return impl::booleanValue;
+    case '"':
+      return impl::stringValue;
+    case '[':
+      return impl::arrayValue;
+    case '{':
+      return impl::objectValue;
+    default: {
+      const auto number = std::string_view{data_->json}.substr(
+          begin_, end_ - begin_);
+      return number.find_first_of(".eE") == std::string_view::npos
+                 ? impl::intValue
+                 : impl::realValue;
+    }
+  }
+}
+
+void LazyValue::CheckNotMissing() const {
+  if (IsMissing()) throw MemberMissingException(GetPath());
+}
+
+void LazyValue::CheckObjectOrNull() const {
+  if (!IsNull() && !IsObject()) {
+    throw TypeMismatchException(GetExtendedType(), impl::objectValue,
+                                GetPath());
+  }
+}
+
+}  // namespace formats::json
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,54 @@
+#include <benchmark/benchmark.h>
+
+#include <fmt/format.h>
+
+#include <userver/formats/json/lazy_value.hpp>
+#include <userver/formats/json/serialize.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+std::string BuildDocument(std::size_t entries) {
+  std::string result = R"({"entries": [)";
+  for (std::size_t i = 0; i < entries; ++i) {
+    if (i != 0) result += ',';
+    result += fmt::format(
+        R"({{"id": {}, "name": "entry number {}", "values": [1, 2, 3]}})", i,
+        i);
+  }
+  result += R"(], "version": 42})";
+  return result;
+}
+
+}  // namespace
+
+void JsonPartialReadDom(benchmark::State& state) {
+  const auto doc = BuildDocument(state.range(0));
+  for ([[maybe_unused]] auto _ : state) {
+    const auto json = formats::json::FromString(doc);
+    benchmark::DoNotOptimize(json["version"].As<int>());
+  }
+}
+BENCHMARK(JsonPartialReadDom)->RangeMultiplier(8)->Range(1, 4096);
+
+void JsonPartialReadLazy(benchmark::State& state) {
+  const auto doc = BuildDocument(state.range(0));
+  for ([[maybe_unused]] auto _ : state) {
+    const formats::json::LazyValue json{doc};
+    benchmark::DoNotOptimize(json["version"].As<int>());
+  }
+}
+BENCHMARK(JsonPartialReadLazy)->RangeMultiplier(8)->Range(1, 4096);
+
+void JsonLazyValueMemberAccess(benchmark::State& state) {
+  const formats::json::LazyValue json{BuildDocument(state.range(0))};
+  const auto index = static_cast<std::size_t>(state.range(0) / 2);
+  for ([[maybe_unused]] auto _ : state) {
+    benchmark::DoNotOptimize(
+        json["entries"][index]["name"].As<std::string>());
+  }
+}
+BENCHMARK(JsonLazyValueMemberAccess)->RangeMultiplier(8)->Range(1, 4096);
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,94 @@
+#include <userver/formats/json/lazy_value.hpp>
+
+#include <gtest/gtest.h>
+
+#include <userver/formats/json/exception.hpp>
+#include <userver/formats/parse/common_containers.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+TEST(JsonLazyValue, ExampleUsage) {
+  /// [Sample formats::json::LazyValue usage]
+  // #include <userver/formats/json/lazy_value.hpp>
+  const formats::json::LazyValue json{R"({
+    "large": [{"a": 1}, {"b": [2, 3]}, "x"],
+    "key": {"inner": [1, 2, 3]}
+  })"};
+
+  // only the text of "key" is parsed into formats::json::Value
+  const auto inner = json["key"]["inner"].As<std::vector<int>>();
+  EXPECT_EQ(inner, (std::vector<int>{1, 2, 3}));
+  /// [Sample formats::json::LazyValue usage]
+}
+
+TEST(JsonLazyValue, Access) {
+  const formats::json::LazyValue json{R"(
+    {
+      "array": [ {"nested": [1, {"x": "}]"}]}, "str\"ing", -1.5e3, null ],
+      "esc\"aped": true,
+      "empty": {},
+      "nothing": null
+    } )"};
+
+  EXPECT_TRUE(json.IsObject());
+  EXPECT_EQ(json.GetSize(), 4);
+  EXPECT_EQ(json.GetPath(), "/");
+
+  const auto array = json["array"];
+  EXPECT_TRUE(array.IsArray());
+  EXPECT_EQ(array.GetSize(), 4);
+  EXPECT_EQ(array[0]["nested"][1]["x"].As<std::string>(), "}]");
+  EXPECT_EQ(array[0]["nested"][1]["x"].GetPath(), "array[0].nested[1].x");
+  EXPECT_EQ(array[1].As<std::string>(), "str\"ing");
+  EXPECT_TRUE(array[2].IsNumber());
+  EXPECT_EQ(array[2].As<double>(), -1500.0);
+  EXPECT_EQ(array[2].GetRawJson(), "-1.5e3");
+  EXPECT_TRUE(array[3].IsNull());
+  EXPECT_EQ(array[3].As<int>(42), 42);
+
+  EXPECT_TRUE(json["esc\"aped"].As<bool>());
+  EXPECT_TRUE(json.HasMember("esc\"aped"));
+  EXPECT_TRUE(json["empty"].IsEmpty());
+  EXPECT_TRUE(json["nothing"].IsEmpty());
+  EXPECT_EQ(json["nothing"].GetSize(), 0);
+
+  EXPECT_EQ(json["array"].Materialize(),
+            formats::json::FromString(
+                R"([{"nested": [1, {"x": "}]"}]}, "str\"ing", -1.5e3, null])"));
+}
+
+TEST(JsonLazyValue, Missing) {
+  const formats::json::LazyValue json{R"({"a": {"b": 1}, "n": null})"};
+
+  const auto missing = json["a"]["c"]["d"];
+  EXPECT_TRUE(missing.IsMissing());
+  EXPECT_FALSE(missing.IsNull());
+  EXPECT_EQ(missing.GetPath(), "a.c.d");
+  EXPECT_FALSE(json["a"].HasMember("c"));
+  EXPECT_FALSE(json["n"].HasMember("c"));
+  EXPECT_TRUE(json["n"]["c"].IsMissing());
+  EXPECT_EQ(missing.As<int>(1), 1);
+  EXPECT_THROW(missing.As<int>(), formats::json::MemberMissingException);
+  EXPECT_THROW(missing.GetRawJson(), formats::json::MemberMissingException);
+}
+
+TEST(JsonLazyValue, Errors) {
+  EXPECT_THROW(formats::json::LazyValue{""}, formats::json::ParseException);
+  EXPECT_THROW(formats::json::LazyValue{"{"}, formats::json::ParseException);
+  EXPECT_THROW(formats::json::LazyValue{R"({"a": 01})"},
+               formats::json::ParseException);
+  EXPECT_THROW(formats::json::LazyValue(std::string{"{}\0{}", 5}),
+               formats::json::ParseException);
+  EXPECT_THROW(
+      formats::json::LazyValue{std::string(formats::json::kDepthParseLimit + 1,
+                                           '[')},
+      formats::json::ParseException);
+
+  const formats::json::LazyValue json{R"({"a": [1], "b": 1})"};
+  EXPECT_THROW(json["a"]["key"], formats::json::TypeMismatchException);
+  EXPECT_THROW(json["b"][0], formats::json::TypeMismatchException);
+  EXPECT_THROW(json["a"][1], formats::json::OutOfBoundsException);
+  EXPECT_THROW(json["b"].GetSize(), formats::json::TypeMismatchException);
+}
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,112 @@
+#include <userver/formats/json/parser/deserialize.hpp>
+
+#include <gtest/gtest.h>
+
+#include <userver/formats/parse/common_containers.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+namespace fjp = formats::json::parser;
+
+struct Item {
+  std::int64_t id{};
+  std::string name;
+  std::optional<std::vector<std::string>> tags;
+};
+
+struct Custom {
+  std::string value;
+};
+
+Custom Parse(const formats::json::Value& value, formats::parse::To<Custom>) {
+  return {value["value"].As<std::string>() + "!"};
+}
+
+struct Request {
+  std::vector<Item> items;
+  std::unordered_map<std::string, double> weights;
+  std::optional<bool> flag;
+  Custom custom;
+  formats::json::Value raw;
+};
+
+}  // namespace
+
+template <>
+struct formats::json::AggregateFieldNames<Item> {
+  static constexpr std::array<std::string_view, 3> kValue{"id", "name",
+                                                          "tags"};
+};
+
+template <>
+struct formats::json::AggregateFieldNames<Request> {
+  static constexpr std::array<std::string_view, 5> kValue{
+      "items", "weights", "flag", "custom", "raw"};
+};
+
+TEST(JsonDeserialize, Scalars) {
+  EXPECT_EQ(fjp::Deserialize<std::int64_t>("42"), 42);
+  EXPECT_EQ(fjp::Deserialize<double>("1.5"), 1.5);
+  EXPECT_EQ(fjp::Deserialize<std::string>(R"("str")"), "str");
+  EXPECT_EQ(fjp::Deserialize<std::optional<bool>>("null"), std::nullopt);
+  EXPECT_EQ(fjp::Deserialize<std::optional<bool>>("true"), true);
+}
+
+TEST(JsonDeserialize, Containers) {
+  using Nested = std::vector<std::vector<std::int32_t>>;
+  EXPECT_EQ(fjp::Deserialize<Nested>("[[1, 2], [], [3]]"),
+            (Nested{{1, 2}, {}, {3}}));
+
+  using Map = std::map<std::string, std::optional<std::string>>;
+  EXPECT_EQ(fjp::Deserialize<Map>(R"({"a": "x", "b": null})"),
+            (Map{{"a", "x"}, {"b", std::nullopt}}));
+}
+
+TEST(JsonDeserialize, Aggregate) {
+  const auto request = fjp::Deserialize<Request>(R"({
+    "unknown": {"nested": [1, {"a": null}]},
+    "items": [
+      {"id": 1, "name": "first", "tags": ["a", "b"]},
+      {"name": "second", "extra": 1, "id": 2}
+    ],
+    "weights": {"x": 0.5, "y": 2},
+    "custom": {"value": "v"},
+    "raw": [1, "2"]
+  })");
+
+  ASSERT_EQ(request.items.size(), 2u);
+  EXPECT_EQ(request.items[0].id, 1);
+  EXPECT_EQ(request.items[0].name, "first");
+  EXPECT_EQ(request.items[0].tags,
+            (std::vector<std::string>{"a", "b"}));
+  EXPECT_EQ(request.items[1].id, 2);
+  EXPECT_EQ(request.items[1].name, "second");
+  EXPECT_EQ(request.items[1].tags, std::nullopt);
+
+  EXPECT_EQ(request.weights.at("x"), 0.5);
+  EXPECT_EQ(request.weights.at("y"), 2.0);
+  EXPECT_EQ(request.flag, std::nullopt);
+  EXPECT_EQ(request.custom.value, "v!");
+  EXPECT_EQ(request.raw, formats::json::FromString(R"([1, "2"])"));
+}
+
+TEST(JsonDeserialize, Errors) {
+  EXPECT_THROW(fjp::Deserialize<Item>(R"({"id": 1})"), fjp::ParseError);
+  EXPECT_THROW(fjp::Deserialize<Item>(R"({"id": "1", "name": ""})"),
+               fjp::ParseError);
+  EXPECT_THROW(fjp::Deserialize<Item>("[]"), fjp::ParseError);
+
+  try {
+    fjp::Deserialize<std::vector<Item>>(
+        R"([{"id": 1, "name": "a"}, {"id": 2, "name": 3}])");
+    FAIL() << "Exception was not thrown";
+  } catch (const fjp::ParseError& e) {
+    EXPECT_NE(std::string_view{e.what()}.find("path '[1].name'"),
+              std::string_view::npos)
+        << e.what();
+  }
+}
+
+USERVER_NAMESPACE_END
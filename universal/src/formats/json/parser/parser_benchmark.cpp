@@ -3,6 +3,7 @@
 #include <fmt/format.h>
 
 #include <userver/formats/json/inline.hpp>
+#include <userver/formats/json/parser/deserialize.hpp>
 #include <userver/formats/json/parser/parser.hpp>
 #include <userver/formats/json/serialize.hpp>
 #include <userver/formats/json/value_builder.hpp>
@@ -100,6 +101,31 @@ void JsonParseValueSax(benchmark::State& state) {
 }
 BENCHMARK(JsonParseValueSax)->RangeMultiplier(2)->Range(1, 16);
 
+// A pretty-printed request body with long strings, where the SIMD string
+// scanning and whitespace skipping of rapidjson matter most
+std::string BuildTextBody(std::size_t entries) {
+  const std::string text(200, 'x');
+  std::string r = "{\n  \"items\": [";
+  for (std::size_t i = 0; i < entries; ++i) {
+    if (i > 0) r += ',';
+    r += fmt::format(
+        "\n    {{\n      \"id\": {},\n      \"text\": \"{}\"\n    }}", i,
+        text);
+  }
+  r += "\n  ]\n}";
+  return r;
+}
+
+void JsonParseTextBodyDom(benchmark::State& state) {
+  const auto input = BuildTextBody(state.range(0));
+  for ([[maybe_unused]] auto _ : state) {
+    const auto res = formats::json::FromString(input);
+    benchmark::DoNotOptimize(res);
+  }
+  state.SetBytesProcessed(state.iterations() * input.size());
+}
+BENCHMARK(JsonParseTextBodyDom)->RangeMultiplier(8)->Range(1, 4096);
+
 namespace {
 
 struct SomeValue final {
@@ -216,6 +242,57 @@ BENCHMARK(JsonParseValueDomLotsOfMissingKeys)
     ->RangeMultiplier(2)
     ->Range(1 << 7, 1 << 14);
 
+struct Entry final {
+  std::int64_t id{};
+  std::string name;
+  std::optional<std::vector<std::int64_t>> values;
+};
+
+Entry Parse(const formats::json::Value& value, formats::parse::To<Entry>) {
+  return {value["id"].As<std::int64_t>(), value["name"].As<std::string>(),
+          value["values"].As<std::optional<std::vector<std::int64_t>>>()};
+}
+
+std::string BuildEntries(std::size_t entries) {
+  std::string r = "[";
+  for (std::size_t i = 0; i < entries; ++i) {
+    if (i > 0) r += ',';
+    r += fmt::format(
+        R"({{"id": {}, "name": "entry number {}", "values": [1, 2, 3]}})", i,
+        i);
+  }
+  r += ']';
+  return r;
+}
+
+}  // namespace
+
+template <>
+struct formats::json::AggregateFieldNames<Entry> {
+  static constexpr std::array<std::string_view, 3> kValue{"id", "name",
+                                                          "values"};
+};
+
+namespace {
+
+void JsonParseEntriesDom(benchmark::State& state) {
+  const auto input = BuildEntries(state.range(0));
+  for ([[maybe_unused]] auto _ : state) {
+    benchmark::DoNotOptimize(
+        formats::json::FromString(input).As<std::vector<Entry>>());
+  }
+}
+BENCHMARK(JsonParseEntriesDom)->RangeMultiplier(8)->Range(1, 1 << 15);
+
+void JsonParseEntriesDeserialize(benchmark::State& state) {
+  const auto input = BuildEntries(state.range(0));
+  for ([[maybe_unused]] auto _ : state) {
+    benchmark::DoNotOptimize(
+        formats::json::parser::Deserialize<std::vector<Entry>>(input));
+  }
+}
+BENCHMARK(JsonParseEntriesDeserialize)->RangeMultiplier(8)->Range(1, 1 << 15);
+
 }  // namespace
 
 USERVER_NAMESPACE_END
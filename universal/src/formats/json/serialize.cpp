@@ -2,6 +2,8 @@
 
 #include <algorithm>
 #include <array>
+#include <cstdint>
+#include <cstring>
 #include <fstream>
 #include <memory>
 #include <string_view>
@@ -9,13 +11,16 @@
 
 #include <fmt/format.h>
 #include <rapidjson/document.h>
+#include <rapidjson/encodedstream.h>
 #include <rapidjson/error/en.h>
 #include <rapidjson/istreamwrapper.h>
+#include <rapidjson/memorystream.h>
 #include <rapidjson/ostreamwrapper.h>
 #include <rapidjson/prettywriter.h>
 #include <rapidjson/writer.h>
 
 #include <formats/json/impl/accept.hpp>
+#include <formats/json/impl/interned_keys.hpp>
 #include <formats/json/impl/json_tree.hpp>
 #include <formats/json/impl/types_impl.hpp>
 #include <userver/formats/json/exception.hpp>
@@ -31,6 +36,89 @@ namespace {
 
 ::rapidjson::CrtAllocator g_allocator;
 
+constexpr unsigned kParseFlags = rapidjson::kParseDefaultFlags |
+                                 rapidjson::kParseIterativeFlag |
+                                 rapidjson::kParseFullPrecisionFlag;
+
+// Forwards the SAX events to the document, replacing the keys that are found
+// in the intern table with references to the interned copies
+class KeyInterningHandler final {
+ public:
+  explicit KeyInterningHandler(impl::Document& document)
+      : document_(document) {}
+
+  bool Null() { return document_.Null(); }
+  bool Bool(bool b) { return document_.Bool(b); }
+  bool Int(int i) { return document_.Int(i); }
+  bool Uint(unsigned i) { return document_.Uint(i); }
+  bool Int64(std::int64_t i) { return document_.Int64(i); }
+  bool Uint64(std::uint64_t i) { return document_.Uint64(i); }
+  bool Double(double d) { return document_.Double(d); }
+  bool RawNumber(const char* str, rapidjson::SizeType length, bool copy) {
+    return document_.RawNumber(str, length, copy);
+  }
+  bool String(const char* str, rapidjson::SizeType length, bool copy) {
+    return document_.String(str, length, copy);
+  }
+  bool StartObject() { return document_.StartObject(); }
+  bool Key(const char* str, rapidjson::SizeType length, bool copy) {
+    if (length > impl::kMaxInlineKeySize &&
+        length <= impl::kMaxInternedKeySize) {
+      if (const char* interned = impl::FindOrInternKey({str, length})) {
+        return document_.Key(interned, length, false);
+      }
+    }
+    return document_.Key(str, length, copy);
+  }
+  bool EndObject(rapidjson::SizeType count) {
+    return document_.EndObject(count);
+  }
+  bool StartArray() { return document_.StartArray(); }
+  bool EndArray(rapidjson::SizeType count) {
+    return document_.EndArray(count);
+  }
+
+ private:
+  impl::Document& document_;
+};
+
+template <typename Stream>
+rapidjson::ParseResult ParseStream(impl::Document& json, Stream& stream) {
+  rapidjson::ParseResult result;
+  auto generator = [&result, &stream](impl::Document& document) {
+    rapidjson::Reader reader;
+    KeyInterningHandler handler{document};
+    result = reader.Parse<kParseFlags>(stream, handler);
+    return !result.IsError();
+  };
+  json.Populate(generator);
+  return result;
+}
+
+#if defined(RAPIDJSON_SSE2) || defined(RAPIDJSON_SSE42) || \
+    defined(RAPIDJSON_NEON)
+// SIMD routines read the input by aligned 16-byte blocks, the block with the
+// terminating zero must not cross the end of the buffer.
+constexpr std::size_t kSimdPadding = 16;
+
+rapidjson::ParseResult ParseDocument(impl::Document& json,
+                                     std::string_view doc) {
+  // rapidjson uses SIMD for the null-terminated strings only
+  std::string buffer(doc.size() + kSimdPadding, '\0');
+  std::memcpy(buffer.data(), doc.data(), doc.size());
+  rapidjson::StringStream stream{buffer.c_str()};
+  return ParseStream(json, stream);
+}
+#else
+rapidjson::ParseResult ParseDocument(impl::Document& json,
+                                     std::string_view doc) {
+  rapidjson::MemoryStream memory{doc.data(), doc.size()};
+  rapidjson::EncodedInputStream<impl::UTF8, rapidjson::MemoryStream> stream{
+      memory};
+  return ParseStream(json, stream);
+}
+#endif
+
 std::string_view AsStringView(const impl::Value& jval) {
   return {jval.GetString(), jval.GetStringLength()};
 }
@@ -109,10 +197,7 @@ Value FromString(std::string_view doc) {
   }
 
   impl::Document json{&g_allocator};
-  rapidjson::ParseResult ok =
-      json.Parse<rapidjson::kParseDefaultFlags |
-                 rapidjson::kParseIterativeFlag |
-                 rapidjson::kParseFullPrecisionFlag>(doc.data(), doc.size());
+  const rapidjson::ParseResult ok = ParseDocument(json, doc);
   if (!ok) {
     const auto offset = ok.Offset();
     const auto line = 1 + std::count(doc.begin(), doc.begin() + offset, '\n');
@@ -136,10 +221,7 @@ Value FromStream(std::istream& is) {
 
   rapidjson::IStreamWrapper in(is);
   impl::Document json{&g_allocator};
-  rapidjson::ParseResult ok =
-      json.ParseStream<rapidjson::kParseDefaultFlags |
-                       rapidjson::kParseIterativeFlag |
-                       rapidjson::kParseFullPrecisionFlag>(in);
+  rapidjson::ParseResult ok = ParseStream(json, in);
   if (!ok) {
     throw ParseException(fmt::format("JSON parse error at offset {}: {}",
                                      ok.Offset(),
@@ -0,0 +1,85 @@
+#include <userver/formats/json/serialize_aggregate.hpp>
+
+#include <gtest/gtest.h>
+
+#include <userver/formats/json/serialize.hpp>
+#include <userver/formats/serialize/common_containers.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+struct Item {
+  std::int64_t id{};
+  std::string name;
+  std::optional<std::vector<std::string>> tags;
+};
+
+struct Response {
+  std::vector<Item> items;
+  std::map<std::string, double> weights;
+  std::optional<bool> flag;
+  formats::json::Value raw;
+};
+
+struct Escaped {
+  int quote{};
+  int control{};
+};
+
+}  // namespace
+
+template <>
+struct formats::json::AggregateFieldNames<Item> {
+  static constexpr std::array<std::string_view, 3> kValue{"id", "name",
+                                                          "tags"};
+};
+
+template <>
+struct formats::json::AggregateFieldNames<Response> {
+  static constexpr std::array<std::string_view, 4> kValue{"items", "weights",
+                                                          "flag", "raw"};
+};
+
+template <>
+struct formats::json::AggregateFieldNames<Escaped> {
+  static constexpr std::array<std::string_view, 2> kValue{"a\"b\\c",
+                                                          "\n\x01"};
+};
+
+namespace {
+
+template <typename T>
+std::string WriteToString(const T& value) {
+  formats::json::StringBuilder sw;
+  WriteToStream(value, sw);
+  return sw.GetString();
+}
+
+}  // namespace
+
+TEST(JsonSerializeAggregate, Nested) {
+  const Response response{
+      {{1, "first", std::vector<std::string>{"a", "b"}}, {2, "second", {}}},
+      {{"x", 0.5}},
+      std::nullopt,
+      formats::json::FromString(R"([1, "2"])"),
+  };
+
+  EXPECT_EQ(WriteToString(response),
+            R"({"items":[{"id":1,"name":"first","tags":["a","b"]},)"
+            R"({"id":2,"name":"second"}],"weights":{"x":0.5},"raw":[1,"2"]})");
+}
+
+TEST(JsonSerializeAggregate, EscapedNames) {
+  static_assert(formats::json::impl::QuotedFieldName<Escaped, 0>::kValue ==
+                R"("a\"b\\c")");
+  static_assert(formats::json::impl::QuotedFieldName<Escaped, 1>::kValue ==
+                R"("\n\u0001")");
+
+  const auto json = formats::json::FromString(WriteToString(Escaped{1, 2}));
+  EXPECT_EQ(json["a\"b\\c"].As<int>(), 1);
+  EXPECT_EQ(json["\n\x01"].As<int>(), 2);
+}
+
+USERVER_NAMESPACE_END
@@ -1185,6 +1185,26 @@ BENCHMARK(DeepJson);
 
 BENCHMARK(DeepWidthJson);
 
+// array of objects with typical long keys, as in the caches of API responses
+void LongKeysJson(benchmark::State& state) {
+  std::string doc = "[";
+  for (std::int64_t i = 0; i < state.range(0); ++i) {
+    if (i != 0) doc += ',';
+    doc += R"({"customer_identifier": 1, "subscription_expires_at": "never",)"
+           R"( "preferred_payment_method": null})";
+  }
+  doc += ']';
+
+  for ([[maybe_unused]] auto _ : state) {
+    auto json = formats::json::FromString(doc);
+    benchmark::DoNotOptimize(json);
+  }
+  state.counters["memory_usage"] = formats::json::EstimateMemoryUsage(
+      formats::json::FromString(doc));
+}
+
+BENCHMARK(LongKeysJson)->RangeMultiplier(8)->Range(1, 4096);
+
 namespace {
 
 struct InnerObject final {
@@ -1,6 +1,7 @@
 #include <gtest/gtest.h>
 
 #include <map>
+#include <string>
 
 #include <boost/range/adaptor/reversed.hpp>
 
@@ -68,6 +69,62 @@ TEST(FormatsJson, ParseErrorLineColumnValidation) {
                        "line 2 column 12");
 }
 
+TEST(FormatsJson, ParseLongStringsAndWhitespace) {
+  // Strings and whitespace runs longer than a SIMD block, with escapes at
+  // different offsets within the blocks
+  for (std::size_t offset = 0; offset < 40; ++offset) {
+    const std::string prefix(offset, 'a');
+    const std::string spaces(offset, ' ');
+    const auto doc = "{" + spaces + R"("key":)" + spaces + "\"" + prefix +
+                     R"(\"\n\u0441)" + prefix + "\"" + spaces + "}";
+
+    const auto json = formats::json::FromString(doc);
+    EXPECT_EQ(json["key"].As<std::string>(),
+              prefix + "\"\n\xd1\x81" + prefix);
+  }
+}
+
+TEST(FormatsJson, ParseNotNullTerminated) {
+  const std::string buffer = R"({"key":"value"}garbage)";
+  const std::string_view doc{buffer.data(), buffer.find('}') + 1};
+
+  EXPECT_EQ(formats::json::FromString(doc)["key"].As<std::string>(), "value");
+  EXPECT_THROW(formats::json::FromString(buffer),
+               formats::json::ParseException);
+}
+
+TEST(FormatsJson, ParseInternsKeys) {
+  const std::string long_key(30, 'k');
+  const std::string too_long_key(100, 'k');
+  const auto to_doc = [](const std::string& key, std::string_view value) {
+    return fmt::format(R"({{"{}": {}}})", key, value);
+  };
+
+  const auto short_keys = formats::json::FromString(to_doc("k", "1"));
+  const auto interned = formats::json::FromString(to_doc(long_key, "1"));
+  const auto not_interned =
+      formats::json::FromString(to_doc(too_long_key, "1"));
+  const auto long_value =
+      formats::json::FromString(to_doc("k", R"(")" + long_key + R"(")"));
+
+  EXPECT_EQ(interned[long_key].As<int>(), 1);
+  EXPECT_EQ(formats::json::FromString(to_doc(long_key, "1")), interned);
+  EXPECT_EQ(formats::json::ToString(interned), R"({")" + long_key + R"(":1})");
+
+  const auto base_size = formats::json::EstimateMemoryUsage(short_keys);
+  EXPECT_EQ(formats::json::EstimateMemoryUsage(interned), base_size);
+  EXPECT_EQ(formats::json::EstimateMemoryUsage(not_interned),
+            base_size + too_long_key.size() + 1);
+  EXPECT_EQ(formats::json::EstimateMemoryUsage(long_value),
+            base_size + long_key.size() + 1);
+
+  formats::json::ValueBuilder builder{interned};
+  builder["other"] = 2;
+  const auto modified = builder.ExtractValue();
+  EXPECT_EQ(modified[long_key].As<int>(), 1);
+  EXPECT_EQ(modified["other"].As<int>(), 2);
+}
+
 TEST(FormatsJson, ParseFromBadFile) {
   using formats::json::blocking::FromFile;
   using ParseException = formats::json::Value::ParseException;
@@ -59,6 +59,11 @@ void StringBuilder::Key(std::string_view sw) {
   impl_->writer.Key(sw.data(), sw.size());
 }
 
+void StringBuilder::RawKey(std::string_view quoted_key) {
+  impl_->writer.RawValue(quoted_key.data(), quoted_key.size(),
+                         rapidjson::kStringType);
+}
+
 void StringBuilder::WriteRawString(std::string_view value) {
   impl_->writer.RawValue(value.data(), value.size(), {});
 }
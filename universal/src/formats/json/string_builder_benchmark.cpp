@@ -1,7 +1,10 @@
 #include <benchmark/benchmark.h>
 
+#include <userver/formats/json/serialize.hpp>
+#include <userver/formats/json/serialize_aggregate.hpp>
 #include <userver/formats/json/string_builder.hpp>
 #include <userver/formats/json/value_builder.hpp>
+#include <userver/formats/serialize/common_containers.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
@@ -74,4 +77,90 @@ void JsonStringBuilder(benchmark::State& state) {
 }
 BENCHMARK(JsonStringBuilder)->RangeMultiplier(4)->Range(1, 1024);
 
+// A typical response: an array of many small objects
+ValueBuilder BuildSmallObjects(std::size_t count) {
+  ValueBuilder builder{formats::common::Type::kArray};
+  for (std::size_t i = 0; i < count; ++i) {
+    ValueBuilder item;
+    item["id"] = i;
+    item["name"] = "abc";
+    item["enabled"] = true;
+    builder.PushBack(std::move(item));
+  }
+  return builder;
+}
+
+void JsonValueBuilderSmallObjects(benchmark::State& state) {
+  for ([[maybe_unused]] auto _ : state) {
+    auto builder = BuildSmallObjects(state.range(0));
+    benchmark::DoNotOptimize(builder);
+  }
+}
+BENCHMARK(JsonValueBuilderSmallObjects)->RangeMultiplier(8)->Range(1, 4096);
+
+void JsonValueBuilderToStringBuilder(benchmark::State& state) {
+  const auto builder = BuildSmallObjects(state.range(0));
+  for ([[maybe_unused]] auto _ : state) {
+    StringBuilder sw;
+    WriteToStream(builder, sw);
+    benchmark::DoNotOptimize(sw.GetStringView());
+  }
+}
+BENCHMARK(JsonValueBuilderToStringBuilder)
+    ->RangeMultiplier(8)
+    ->Range(1, 4096);
+
+namespace {
+
+struct Entry {
+  std::int64_t id{};
+  std::string name;
+  std::vector<int> values;
+};
+
+Value Serialize(const Entry& entry, formats::serialize::To<Value>) {
+  ValueBuilder builder;
+  builder["id"] = entry.id;
+  builder["name"] = entry.name;
+  builder["values"] = entry.values;
+  return builder.ExtractValue();
+}
+
+std::vector<Entry> MakeEntries(std::size_t count) {
+  std::vector<Entry> entries;
+  entries.reserve(count);
+  for (std::size_t i = 0; i < count; ++i) {
+    entries.push_back({static_cast<std::int64_t>(i), "entry", {1, 2, 3}});
+  }
+  return entries;
+}
+
+}  // namespace
+
+template <>
+struct formats::json::AggregateFieldNames<Entry> {
+  static constexpr std::array<std::string_view, 3> kValue{"id", "name",
+                                                          "values"};
+};
+
+void JsonAggregatesSerializeToString(benchmark::State& state) {
+  const auto entries = MakeEntries(state.range(0));
+  for ([[maybe_unused]] auto _ : state) {
+    benchmark::DoNotOptimize(ToString(ValueBuilder{entries}.ExtractValue()));
+  }
+}
+BENCHMARK(JsonAggregatesSerializeToString)
+    ->RangeMultiplier(8)
+    ->Range(1, 4096);
+
+void JsonAggregatesWriteToStream(benchmark::State& state) {
+  const auto entries = MakeEntries(state.range(0));
+  for ([[maybe_unused]] auto _ : state) {
+    StringBuilder sw;
+    WriteToStream(entries, sw);
+    benchmark::DoNotOptimize(sw.GetStringView());
+  }
+}
+BENCHMARK(JsonAggregatesWriteToStream)->RangeMultiplier(8)->Range(1, 4096);
+
 USERVER_NAMESPACE_END
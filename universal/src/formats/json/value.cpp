@@ -4,6 +4,7 @@
 #include <functional>
 #include <limits>
 #include <utility>
+#include <vector>
 
 #include <rapidjson/allocators.h>
 #include <rapidjson/document.h>
@@ -12,6 +13,7 @@
 
 #include <formats/json/impl/are_equal.hpp>
 #include <formats/json/impl/exttypes.hpp>
+#include <formats/json/impl/interned_keys.hpp>
 #include <formats/json/impl/json_tree.hpp>
 #include <formats/json/impl/types_impl.hpp>
 #include <userver/formats/common/path.hpp>
@@ -306,6 +308,51 @@ std::string Parse(const Value& value, parse::To<std::string>) {
                               value.GetPath());
 }
 
+namespace {
+
+std::size_t StringHeapSize(const impl::Value& native) {
+  const char* str = native.GetString();
+  const auto* inline_begin = reinterpret_cast<const char*>(&native);
+  const std::less<const char*> less;
+  if (!less(str, inline_begin) && less(str, inline_begin + sizeof(native))) {
+    return 0;
+  }
+  return native.GetStringLength() + 1;
+}
+
+}  // namespace
+
+std::size_t EstimateMemoryUsage(const Value& value) {
+  std::size_t size = sizeof(Value);
+  if (value.IsMissing()) return size;
+
+  std::vector<const impl::Value*> stack{&value.GetNative()};
+  size += sizeof(impl::Value);
+  while (!stack.empty()) {
+    const auto& native = *stack.back();
+    stack.pop_back();
+
+    if (native.IsString()) {
+      size += StringHeapSize(native);
+    } else if (native.IsArray()) {
+      size += native.Capacity() * sizeof(impl::Value);
+      for (const auto& element : native.GetArray()) stack.push_back(&element);
+    } else if (native.IsObject()) {
+      size += native.MemberCapacity() * sizeof(impl::Value::Member);
+      for (const auto& member : native.GetObject()) {
+        const auto& name = member.name;
+        const std::string_view key{name.GetString(), name.GetStringLength()};
+        const bool is_interned = key.size() > impl::kMaxInlineKeySize &&
+                                 key.size() <= impl::kMaxInternedKeySize &&
+                                 impl::IsInternedKey(key);
+        if (!is_interned) size += StringHeapSize(name);
+        stack.push_back(&member.value);
+      }
+    }
+  }
+  return size;
+}
+
 template <>
 bool Value::ConvertTo<bool>() const {
   if (IsMissing()) return false;
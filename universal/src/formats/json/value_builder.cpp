@@ -6,6 +6,7 @@
 #include <rapidjson/writer.h>
 
 #include <userver/formats/json/exception.hpp>
+#include <userver/formats/json/string_builder.hpp>
 #include <userver/formats/json/value.hpp>
 #include <userver/utils/assert.hpp>
 #include <userver/utils/datetime.hpp>
@@ -109,6 +110,33 @@ ValueBuilder& ValueBuilder::operator=(ValueBuilder&& other) {
   return *this;
 }
 
+impl::Value& ValueBuilder::PrepareAssign() {
+  if ((value_->IsArray() || value_->IsObject()) && value_->GetSize() != 0) {
+    value_.OnMembersChange();
+  }
+  return value_->GetNative();
+}
+
+void ValueBuilder::AssignBool(bool value) { PrepareAssign().SetBool(value); }
+
+void ValueBuilder::AssignInt64(std::int64_t value) {
+  PrepareAssign().SetInt64(value);
+}
+
+void ValueBuilder::AssignUInt64(std::uint64_t value) {
+  PrepareAssign().SetUint64(value);
+}
+
+void ValueBuilder::AssignDouble(double value) {
+  formats::common::ValidateFloat<Exception>(value);
+  PrepareAssign().SetDouble(value);
+}
+
+void ValueBuilder::AssignString(std::string_view value) {
+  PrepareAssign().SetString(rapidjson::StringRef(value.data(), value.size()),
+                            g_allocator);
+}
+
 ValueBuilder::ValueBuilder(const formats::json::Value& other) {
   // As we have new native object created,
   // we fill it with the copy from other's native object.
@@ -249,6 +277,10 @@ formats::json::Value ValueBuilder::ExtractValue() {
   return std::exchange(value_, impl::MutableValueWrapper{}).ExtractValue();
 }
 
+void WriteToStream(const ValueBuilder& builder, StringBuilder& sw) {
+  sw.WriteValue(*builder.value_);
+}
+
 void ValueBuilder::Copy(impl::Value& to, const ValueBuilder& from) {
   to.CopyFrom(from.value_->GetNative(), g_allocator);
 }
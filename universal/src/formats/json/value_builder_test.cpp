@@ -1,6 +1,8 @@
 #include <gtest/gtest.h>
 
 #include <userver/formats/json/exception.hpp>
+#include <userver/formats/json/serialize.hpp>
+#include <userver/formats/json/string_builder.hpp>
 #include <userver/formats/json/value_builder.hpp>
 
 // for testing std::optional/null
@@ -160,6 +162,47 @@ TEST(JsonValueBuilder, StringViewEmplaceNocheck) {
   EXPECT_EQ(1025, value[std::string(1024, 'a') + 'b'].As<int>());
 }
 
+TEST(JsonValueBuilder, AssignInPlace) {
+  formats::json::ValueBuilder builder;
+  builder["int"] = 1;
+  builder["int"] = -2;
+  builder["uint"] = std::uint64_t{1} << 63;
+  builder["bool"] = true;
+  builder["double"] = 0.5;
+  builder["c_str"] = "c_str";
+  builder["view"] = std::string_view{"view"};
+
+  const std::string str = "str";
+  builder["str"] = str;
+  builder["object"]["nested"] = 1;
+  builder["object"] = str;
+
+  EXPECT_EQ(builder.ExtractValue(), formats::json::FromString(R"({
+    "int": -2,
+    "uint": 9223372036854775808,
+    "bool": true,
+    "double": 0.5,
+    "c_str": "c_str",
+    "view": "view",
+    "str": "str",
+    "object": "str"
+  })"));
+}
+
+TEST(JsonValueBuilder, WriteToStream) {
+  formats::json::ValueBuilder builder;
+  builder["a"]["b"].PushBack(1);
+  builder["a"]["b"].PushBack("x");
+
+  formats::json::StringBuilder root;
+  WriteToStream(builder, root);
+  EXPECT_EQ(root.GetString(), R"({"a":{"b":[1,"x"]}})");
+
+  formats::json::StringBuilder nested;
+  WriteToStream(builder["a"], nested);
+  EXPECT_EQ(nested.GetString(), R"({"b":[1,"x"]})");
+}
+
 }  // namespace my_namespace
 
 /// [Sample Customization formats::json::ValueBuilder usage]
@@ -165,6 +165,20 @@ std::size_t FileDescriptor::Read(char* buffer, std::size_t max_size) {
   }
 }
 
+std::size_t FileDescriptor::ReadAt(char* buffer, std::size_t max_size,
+                                   std::size_t offset) const {
+  while (true) {
+    const ::ssize_t s = ::pread(fd_, buffer, max_size, offset);
+    if (s < 0) {
+      if (errno == EAGAIN || errno == EINTR) continue;
+
+      const auto code = std::make_error_code(std::errc{errno});
+      throw std::system_error(code, "calling ::pread");
+    }
+    return s;
+  }
+}
+
 // NOLINTNEXTLINE(readability-make-member-function-const)
 void FileDescriptor::Seek(std::size_t offset_in_bytes) {
   while (true) {
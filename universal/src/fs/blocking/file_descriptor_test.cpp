@@ -125,4 +125,21 @@ TEST(FileDescriptor, WriteAppend) {
   EXPECT_EQ(fs::blocking::ReadFileContents(path), "aaabb");
 }
 
+TEST(FileDescriptor, ReadAt) {
+  const auto dir = fs::blocking::TempDirectory::Create();
+  const auto path = dir.GetPath() + "/foo";
+  fs::blocking::RewriteFileContents(path, "123456");
+
+  auto fd = FileDescriptor::Open(path, fs::blocking::OpenFlag::kRead);
+  std::string buffer(4, '\0');
+  EXPECT_EQ(4, fd.ReadAt(buffer.data(), buffer.size(), 1));
+  EXPECT_EQ("2345", buffer);
+  EXPECT_EQ(2, fd.ReadAt(buffer.data(), buffer.size(), 4));
+  EXPECT_EQ("56", buffer.substr(0, 2));
+  EXPECT_EQ(0, fd.ReadAt(buffer.data(), buffer.size(), 6));
+
+  // the current offset is not affected
+  EXPECT_EQ("123456", ReadContents(fd));
+}
+
 USERVER_NAMESPACE_END
@@ -1,23 +1,39 @@
 #include <userver/fs/blocking/read.hpp>
 
-#include <fstream>
-#include <sstream>
+#include <fcntl.h>
+
+#include <algorithm>
 
 #include <boost/filesystem/operations.hpp>
 
+#include <userver/fs/blocking/file_descriptor.hpp>
+
 USERVER_NAMESPACE_BEGIN
 
 namespace fs::blocking {
 
 std::string ReadFileContents(const std::string& path) {
-  std::ifstream ifs(path);
-  if (!ifs) {
+  // NOLINTNEXTLINE(cppcoreguidelines-pro-type-vararg)
+  const int fd = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+  if (fd == -1) {
     throw std::runtime_error("Error opening '" + path + '\'');
   }
-
-  std::ostringstream buffer;
-  buffer << ifs.rdbuf();
-  return buffer.str();
+  auto file = FileDescriptor::AdoptFd(fd);
+
+  // The size is only a hint: the file may be modified concurrently, and some
+  // special files (e.g. in /proc) report 0. The extra byte lets us detect EOF
+  // without growing the buffer.
+  constexpr std::size_t kMinBufferSize = 4096;
+  std::string contents(std::max(file.GetSize() + 1, kMinBufferSize), '\0');
+  std::size_t size = 0;
+  while (true) {
+    if (size == contents.size()) contents.resize(contents.size() * 2);
+    const auto read = file.Read(contents.data() + size, contents.size() - size);
+    if (read == 0) break;
+    size += read;
+  }
+  contents.resize(size);
+  return contents;
 }
 
 bool FileExists(const std::string& path) {
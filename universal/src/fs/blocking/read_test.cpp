@@ -0,0 +1,33 @@
+#include <userver/fs/blocking/read.hpp>
+
+#include <gtest/gtest.h>
+
+#include <userver/fs/blocking/temp_directory.hpp>
+#include <userver/fs/blocking/write.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+TEST(Fs, ReadFileContents) {
+  const auto dir = fs::blocking::TempDirectory::Create();
+  const auto path = dir.GetPath() + "/foo";
+
+  fs::blocking::RewriteFileContents(path, "");
+  EXPECT_EQ(fs::blocking::ReadFileContents(path), "");
+
+  std::string contents;
+  for (int i = 0; contents.size() < 100'000; ++i) {
+    contents += std::to_string(i);
+  }
+  fs::blocking::RewriteFileContents(path, contents);
+  EXPECT_EQ(fs::blocking::ReadFileContents(path), contents);
+
+  EXPECT_THROW(fs::blocking::ReadFileContents(dir.GetPath() + "/missing"),
+               std::runtime_error);
+}
+
+TEST(Fs, ReadFileContentsOfSpecialFile) {
+  // reports zero size
+  EXPECT_FALSE(fs::blocking::ReadFileContents("/proc/self/status").empty());
+}
+
+USERVER_NAMESPACE_END
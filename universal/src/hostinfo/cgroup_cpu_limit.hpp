@@ -0,0 +1,20 @@
+#pragma once
+
+#include <optional>
+#include <string_view>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace hostinfo::impl {
+
+/// Parses the contents of cgroup v2 `cpu.max`, returns CPUs count
+std::optional<double> ParseCgroupV2CpuMax(std::string_view cpu_max);
+
+/// Parses cgroup v1 `cpu.cfs_quota_us` and `cpu.cfs_period_us`, returns CPUs
+/// count
+std::optional<double> ParseCgroupV1CpuQuota(std::string_view quota,
+                                            std::string_view period);
+
+}  // namespace hostinfo::impl
+
+USERVER_NAMESPACE_END
@@ -1,8 +1,15 @@
 #include <userver/hostinfo/cpu_limit.hpp>
 
+#include <algorithm>
+#include <cmath>
+#include <fstream>
 #include <optional>
 #include <string>
+#include <thread>
 
+#include <fmt/format.h>
+
+#include <hostinfo/cgroup_cpu_limit.hpp>
 #include <userver/logging/log.hpp>
 
 USERVER_NAMESPACE_BEGIN
@@ -11,6 +18,19 @@ namespace hostinfo {
 
 namespace {
 
+constexpr std::string_view kCgroupV2CpuMax = "/sys/fs/cgroup/cpu.max";
+constexpr std::string_view kCgroupV1Dirs[] = {
+    "/sys/fs/cgroup/cpu",
+    "/sys/fs/cgroup/cpu,cpuacct",
+};
+
+std::optional<std::string> ReadFirstLine(const std::string& path) {
+  std::ifstream file(path);
+  std::string line;
+  if (!file || !std::getline(file, line)) return {};
+  return line;
+}
+
 std::optional<double> CpuLimitRtc() {
   // NOLINTNEXTLINE(concurrency-mt-unsafe)
   const char* cpu_limit_c_str = std::getenv("CPU_LIMIT");
@@ -38,13 +58,77 @@ std::optional<double> CpuLimitRtc() {
   return {};
 }
 
+std::optional<double> CpuLimitCgroup() {
+  if (const auto cpu_max = ReadFirstLine(std::string{kCgroupV2CpuMax})) {
+    auto limit = impl::ParseCgroupV2CpuMax(*cpu_max);
+    LOG_INFO() << "CPU limit from cgroup v2 " << kCgroupV2CpuMax << " is "
+               << (limit ? std::to_string(*limit) : "not set");
+    return limit;
+  }
+
+  for (const std::string_view dir : kCgroupV1Dirs) {
+    const auto quota = ReadFirstLine(fmt::format("{}/cpu.cfs_quota_us", dir));
+    const auto period = ReadFirstLine(fmt::format("{}/cpu.cfs_period_us", dir));
+    if (!quota || !period) continue;
+
+    auto limit = impl::ParseCgroupV1CpuQuota(*quota, *period);
+    LOG_INFO() << "CPU limit from cgroup v1 " << dir << " is "
+               << (limit ? std::to_string(*limit) : "not set");
+    return limit;
+  }
+
+  return {};
+}
+
+std::optional<double> DetectCpuLimit() {
+  if (auto limit = CpuLimitRtc()) return limit;
+  return CpuLimitCgroup();
+}
+
 }  // namespace
 
+namespace impl {
+
+std::optional<double> ParseCgroupV2CpuMax(std::string_view cpu_max) {
+  // Format: "$MAX $PERIOD", where $MAX is either a number or "max"
+  const auto space_pos = cpu_max.find(' ');
+  if (space_pos == std::string_view::npos) return {};
+  return ParseCgroupV1CpuQuota(cpu_max.substr(0, space_pos),
+                               cpu_max.substr(space_pos + 1));
+}
+
+std::optional<double> ParseCgroupV1CpuQuota(std::string_view quota,
+                                            std::string_view period) {
+  try {
+    // Negative quota ("-1" in v1) and "max" in v2 mean "no limit"
+    const auto quota_us = std::stoll(std::string{quota});
+    const auto period_us = std::stoll(std::string{period});
+    if (quota_us <= 0 || period_us <= 0) return {};
+    return static_cast<double>(quota_us) / static_cast<double>(period_us);
+  } catch (const std::exception&) {
+    return {};
+  }
+}
+
+}  // namespace impl
+
 std::optional<double> CpuLimit() {
-  static const auto limit = CpuLimitRtc();
+  static const auto limit = DetectCpuLimit();
   return limit;
 }
 
+std::size_t CpuLimitThreads(double ratio) {
+  double cpus = 0;
+  if (const auto limit = CpuLimit()) {
+    cpus = *limit;
+  } else {
+    cpus = std::thread::hardware_concurrency();
+  }
+
+  const auto threads = std::lround(cpus * ratio);
+  return static_cast<std::size_t>(std::max(threads, 1L));
+}
+
 bool IsInRtc() { return !!CpuLimitRtc(); }
 
 }  // namespace hostinfo
@@ -0,0 +1,31 @@
+#include <userver/hostinfo/cpu_limit.hpp>
+
+#include <gtest/gtest.h>
+
+#include <hostinfo/cgroup_cpu_limit.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+TEST(CpuLimit, CgroupV2) {
+  EXPECT_EQ(hostinfo::impl::ParseCgroupV2CpuMax("200000 100000"), 2.0);
+  EXPECT_EQ(hostinfo::impl::ParseCgroupV2CpuMax("150000 100000"), 1.5);
+  EXPECT_EQ(hostinfo::impl::ParseCgroupV2CpuMax("max 100000"), std::nullopt);
+  EXPECT_EQ(hostinfo::impl::ParseCgroupV2CpuMax("garbage"), std::nullopt);
+  EXPECT_EQ(hostinfo::impl::ParseCgroupV2CpuMax(""), std::nullopt);
+}
+
+TEST(CpuLimit, CgroupV1) {
+  EXPECT_EQ(hostinfo::impl::ParseCgroupV1CpuQuota("400000", "100000"), 4.0);
+  EXPECT_EQ(hostinfo::impl::ParseCgroupV1CpuQuota("-1", "100000"),
+            std::nullopt);
+  EXPECT_EQ(hostinfo::impl::ParseCgroupV1CpuQuota("100000", "0"),
+            std::nullopt);
+}
+
+TEST(CpuLimit, Threads) {
+  EXPECT_GE(hostinfo::CpuLimitThreads(), 1);
+  EXPECT_EQ(hostinfo::CpuLimitThreads(0.0), 1);
+  EXPECT_GE(hostinfo::CpuLimitThreads(2.0), hostinfo::CpuLimitThreads(1.0));
+}
+
+USERVER_NAMESPACE_END
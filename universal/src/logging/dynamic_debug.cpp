@@ -1,6 +1,9 @@
 #include "dynamic_debug.hpp"
 
 #include <cstring>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
 
 #include <fmt/format.h>
 
@@ -30,28 +33,9 @@ LogEntryContentSet& GetAllLocations() noexcept {
       fmt::format("dynamic-debug-log: no logging in '{}'", location));
 }
 
-}  // namespace
-
-Level GetForceDisabledLevelPlusOne(Level level) {
-  if (level == Level::kNone) {
-    return Level::kTrace;
-  }
-  return static_cast<Level>(utils::UnderlyingValue(level) + 1);
-}
-
-bool operator<(const LogEntryContent& x, const LogEntryContent& y) noexcept {
-  const auto cmp = std::strcmp(x.path, y.path);
-  return cmp < 0 || (cmp == 0 && x.line < y.line);
-}
-
-bool operator==(const LogEntryContent& x, const LogEntryContent& y) noexcept {
-  return x.line == y.line && std::strcmp(x.path, y.path) == 0;
-}
-
-void AddDynamicDebugLog(const std::string& location_relative, int line,
-                        EntryState state) {
-  utils::impl::AssertStaticRegistrationFinished();
-
+template <typename Func>
+void ForEachLocation(const std::string& location_relative, int line,
+                     Func func) {
   auto& all_locations = GetAllLocations();
 
   auto it_lower = all_locations.lower_bound({location_relative.c_str(), line});
@@ -66,18 +50,59 @@ void AddDynamicDebugLog(const std::string& location_relative, int line,
       ThrowUnknownDynamicLogLocation(location_relative, line);
     }
 
-    it_lower->state.store(state);
+    func(*it_lower);
     return;
   } else {
     for (; it_lower != all_locations.end(); ++it_lower) {
       if (std::strncmp(it_lower->path, location_relative.c_str(),
                        location_relative.size()) != 0)
         break;
-      it_lower->state.store(state);
+      func(*it_lower);
     }
   }
 }
 
+struct LogBudgets final {
+  std::mutex mutex;
+  // Buckets are never destroyed, as the logging locations may use them
+  // concurrently. They are reused if the budget is set again.
+  std::unordered_map<LogEntryContent*, std::unique_ptr<utils::TokenBucket>>
+      buckets;
+  std::atomic<std::uint64_t> dropped{0};
+};
+
+LogBudgets& GetLogBudgets() noexcept {
+  static LogBudgets budgets;
+  return budgets;
+}
+
+}  // namespace
+
+Level GetForceDisabledLevelPlusOne(Level level) {
+  if (level == Level::kNone) {
+    return Level::kTrace;
+  }
+  return static_cast<Level>(utils::UnderlyingValue(level) + 1);
+}
+
+bool operator<(const LogEntryContent& x, const LogEntryContent& y) noexcept {
+  const auto cmp = std::strcmp(x.path, y.path);
+  return cmp < 0 || (cmp == 0 && x.line < y.line);
+}
+
+bool operator==(const LogEntryContent& x, const LogEntryContent& y) noexcept {
+  return x.line == y.line && std::strcmp(x.path, y.path) == 0;
+}
+
+void AddDynamicDebugLog(const std::string& location_relative, int line,
+                        EntryState state) {
+  utils::impl::AssertStaticRegistrationFinished();
+
+  ForEachLocation(location_relative, line, [&state](LogEntryContent& entry) {
+    entry.state.store(state);
+  });
+}
+
 void RemoveDynamicDebugLog(const std::string& location_relative, int line) {
   utils::impl::AssertStaticRegistrationFinished();
   auto& all_locations = GetAllLocations();
@@ -97,6 +122,49 @@ const LogEntryContentSet& GetDynamicDebugLocations() {
   return GetAllLocations();
 }
 
+void SetLogBudget(const std::string& location_relative, int line,
+                  std::size_t lines_per_second) {
+  utils::impl::AssertStaticRegistrationFinished();
+  UINVARIANT(lines_per_second > 0, "Log budget must be positive");
+
+  const utils::TokenBucket::RefillPolicy policy{
+      1, utils::TokenBucket::Duration{std::chrono::seconds{1}} /
+             lines_per_second};
+
+  auto& budgets = GetLogBudgets();
+  const std::lock_guard lock{budgets.mutex};
+  ForEachLocation(location_relative, line, [&](LogEntryContent& entry) {
+    auto& bucket = budgets.buckets[&entry];
+    if (!bucket) {
+      bucket = std::make_unique<utils::TokenBucket>(lines_per_second, policy);
+    } else {
+      bucket->SetMaxSize(lines_per_second);
+      bucket->SetRefillPolicy(policy);
+    }
+    entry.budget.store(bucket.get());
+  });
+}
+
+void RemoveLogBudgets() {
+  auto& budgets = GetLogBudgets();
+  const std::lock_guard lock{budgets.mutex};
+  for (const auto& [entry, bucket] : budgets.buckets) {
+    entry->budget.store(nullptr);
+  }
+}
+
+bool ObtainLogBudget(const LogEntryContent& location) noexcept {
+  auto* const bucket = location.budget.load();
+  if (!bucket || bucket->Obtain()) return true;
+
+  GetLogBudgets().dropped.fetch_add(1, std::memory_order_relaxed);
+  return false;
+}
+
+std::uint64_t GetLogBudgetDroppedCount() noexcept {
+  return GetLogBudgets().dropped.load(std::memory_order_relaxed);
+}
+
 void RegisterLogLocation(LogEntryContent& location) {
   utils::impl::AssertStaticRegistrationAllowed(
       "Dynamic debug logging location");
@@ -1,12 +1,14 @@
 #pragma once
 
 #include <atomic>
+#include <cstdint>
 #include <string_view>
 
 #include <boost/intrusive/set.hpp>
 #include <boost/intrusive/set_hook.hpp>
 
 #include <userver/logging/log.hpp>
+#include <userver/utils/token_bucket.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
@@ -36,6 +38,8 @@ struct LogEntryContent {
   const int line;
   const char* const path;
   LogEntryContentHook hook;
+  // Limits the rate of the location logs, nullptr for no limit
+  std::atomic<utils::TokenBucket*> budget{nullptr};
 };
 
 bool operator<(const LogEntryContent& x, const LogEntryContent& y) noexcept;
@@ -59,6 +63,21 @@ void RemoveDynamicDebugLog(const std::string& location_relative, int line);
 
 const LogEntryContentSet& GetDynamicDebugLocations();
 
+/// Limits the logs of the location to `lines_per_second`, the excess logs are
+/// dropped before any formatting
+void SetLogBudget(const std::string& location_relative, int line,
+                  std::size_t lines_per_second);
+
+/// Removes the limits set by SetLogBudget()
+void RemoveLogBudgets();
+
+/// Takes a token from the location budget, if any.
+/// @returns false if the log should be dropped
+bool ObtainLogBudget(const LogEntryContent& location) noexcept;
+
+/// @returns the total number of logs dropped due to the location budgets
+std::uint64_t GetLogBudgetDroppedCount() noexcept;
+
 void RegisterLogLocation(LogEntryContent& location);
 
 }  // namespace logging
@@ -23,9 +23,14 @@ Format FormatFromString(std::string_view format_str) {
     return Format::kRaw;
   }
 
+  if (format_str == "binary") {
+    return Format::kBinary;
+  }
+
   UINVARIANT(
       false,
-      fmt::format("Unknown logging format '{}' (must be one of 'tskv', 'ltsv')",
+      fmt::format("Unknown logging format '{}' (must be one of 'tskv', "
+                  "'ltsv', 'raw', 'binary')",
                   format_str));
 }
 
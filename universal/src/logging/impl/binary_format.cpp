@@ -0,0 +1,177 @@
+#include <userver/logging/impl/binary_format.hpp>
+
+#include <chrono>
+#include <ctime>
+#include <iterator>
+#include <limits>
+#include <optional>
+#include <stdexcept>
+
+#include <fmt/chrono.h>
+#include <fmt/format.h>
+
+#include <userver/logging/level.hpp>
+#include <userver/utils/encoding/tskv.hpp>
+#include <userver/utils/trivial_map.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace logging::impl::binary {
+
+namespace {
+
+// Ids are written to the log files, so the existing ones must never change.
+// New keys may only be appended.
+constexpr utils::TrivialBiMap kInternedKeys = [](auto selector) {
+  return selector()
+      .Case("module", 1)
+      .Case("task_id", 2)
+      .Case("thread_id", 3)
+      .Case("text", 4)
+      .Case("trace_id", 5)
+      .Case("span_id", 6)
+      .Case("parent_id", 7)
+      .Case("link", 8)
+      .Case("parent_link", 9)
+      .Case("stopwatch_name", 10)
+      .Case("total_time", 11)
+      .Case("timestamp", 12)
+      .Case("start_timestamp", 13)
+      .Case("meta_type", 14)
+      .Case("type", 15)
+      .Case("http_status", 16)
+      .Case("method", 17)
+      .Case("uri", 18)
+      .Case("error", 19)
+      .Case("error_msg", 20);
+};
+
+std::optional<std::string_view> FindInternedKey(std::uint64_t id) noexcept {
+  if (id > static_cast<std::uint64_t>(std::numeric_limits<int>::max())) {
+    return std::nullopt;
+  }
+  return kInternedKeys.TryFindBySecond(static_cast<int>(id));
+}
+
+// Returns std::nullopt if the data ends in the middle of the varint
+std::optional<std::uint64_t> ReadVarint(std::string_view data,
+                                        std::size_t& pos) {
+  std::uint64_t value = 0;
+  for (std::size_t i = 0; i < kMaxVarintSize; ++i) {
+    if (pos + i >= data.size()) return std::nullopt;
+    const auto byte = static_cast<unsigned char>(data[pos + i]);
+    value |= static_cast<std::uint64_t>(byte & 0x7f) << (7 * i);
+    if (!(byte & 0x80)) {
+      pos += i + 1;
+      return value;
+    }
+  }
+  throw std::runtime_error("Malformed varint in a binary log record");
+}
+
+class RecordReader final {
+ public:
+  explicit RecordReader(std::string_view body) : body_(body) {}
+
+  bool IsEnd() const noexcept { return pos_ == body_.size(); }
+
+  std::uint64_t Varint() {
+    const auto value = ReadVarint(body_, pos_);
+    if (!value) Throw();
+    return *value;
+  }
+
+  std::string_view Bytes(std::uint64_t size) {
+    if (size > body_.size() - pos_) Throw();
+    const auto result = body_.substr(pos_, size);
+    pos_ += size;
+    return result;
+  }
+
+ private:
+  [[noreturn]] static void Throw() {
+    throw std::runtime_error("Truncated binary log record");
+  }
+
+  const std::string_view body_;
+  std::size_t pos_{0};
+};
+
+void DecodeRecord(std::string_view body, std::string& out) {
+  RecordReader reader{body};
+
+  const std::chrono::microseconds timestamp{reader.Varint()};
+  const auto level_byte = static_cast<unsigned char>(reader.Bytes(1)[0]);
+  if (level_byte > static_cast<unsigned char>(Level::kNone)) {
+    throw std::runtime_error("Invalid level in a binary log record");
+  }
+  const auto seconds =
+      std::chrono::duration_cast<std::chrono::seconds>(timestamp);
+  fmt::format_to(std::back_inserter(out), "tskv\ttimestamp={:%FT%T}.{:06}",
+                 fmt::localtime(static_cast<std::time_t>(seconds.count())),
+                 (timestamp - seconds).count());
+  out.append("\tlevel=");
+  out.append(ToUpperCaseString(static_cast<Level>(level_byte)));
+
+  while (!reader.IsEnd()) {
+    const auto key_id = reader.Varint();
+    std::string_view key;
+    if (key_id == 0) {
+      key = reader.Bytes(reader.Varint());
+    } else {
+      const auto interned = FindInternedKey(key_id);
+      if (!interned) {
+        throw std::runtime_error(
+            fmt::format("Unknown key id {} in a binary log record", key_id));
+      }
+      key = *interned;
+    }
+    const auto value = reader.Bytes(reader.Varint());
+
+    out.push_back(utils::encoding::kTskvPairsSeparator);
+    if (utils::encoding::ShouldKeyBeEscaped(key)) {
+      utils::encoding::EncodeTskv(
+          out, key, utils::encoding::EncodeTskvMode::kKeyReplacePeriod);
+    } else {
+      out.append(key);
+    }
+    out.push_back(utils::encoding::kTskvKeyValueSeparator);
+    utils::encoding::EncodeTskv(out, value,
+                                utils::encoding::EncodeTskvMode::kValue);
+  }
+  out.push_back('\n');
+}
+
+}  // namespace
+
+std::size_t WriteVarint(char* out, std::uint64_t value) noexcept {
+  std::size_t size = 0;
+  while (value >= 0x80) {
+    out[size++] = static_cast<char>((value & 0x7f) | 0x80);
+    value >>= 7;
+  }
+  out[size++] = static_cast<char>(value);
+  return size;
+}
+
+std::uint32_t FindKeyId(std::string_view key) noexcept {
+  return static_cast<std::uint32_t>(
+      kInternedKeys.TryFindByFirst(key).value_or(0));
+}
+
+std::size_t DecodeToTskv(std::string_view records, std::string& out) {
+  std::size_t consumed = 0;
+  while (consumed < records.size()) {
+    auto pos = consumed;
+    const auto body_size = ReadVarint(records, pos);
+    if (!body_size || *body_size > records.size() - pos) break;
+
+    DecodeRecord(records.substr(pos, *body_size), out);
+    consumed = pos + *body_size;
+  }
+  return consumed;
+}
+
+}  // namespace logging::impl::binary
+
+USERVER_NAMESPACE_END
@@ -1,6 +1,8 @@
 #include "log_helper_impl.hpp"
 
+#include <algorithm>
 #include <array>
+#include <cstring>
 
 #include <fmt/chrono.h>
 #include <fmt/compile.h>
@@ -8,6 +10,7 @@
 
 #include <userver/compiler/impl/constexpr.hpp>
 #include <userver/compiler/thread_local.hpp>
+#include <userver/logging/impl/binary_format.hpp>
 #include <userver/logging/impl/logger_base.hpp>
 #include <userver/utils/assert.hpp>
 #include <userver/utils/encoding/tskv.hpp>
@@ -16,12 +19,15 @@ USERVER_NAMESPACE_BEGIN
 
 namespace logging {
 
+namespace binary = impl::binary;
+
 namespace {
 
 char GetSeparatorFromLogger(LoggerRef logger) {
   switch (logger.GetFormat()) {
     case Format::kTskv:
     case Format::kRaw:
+    case Format::kBinary:
       return '=';
     case Format::kLtsv:
       return ':';
@@ -88,6 +94,7 @@ std::streamsize LogHelper::Impl::BufferStd::xsputn(const char_type* s,
 LogHelper::Impl::Impl(LoggerRef logger, Level level) noexcept
     : logger_(&logger),
       level_(std::max(level, logger_->GetLevel())),
+      format_(logger_->GetFormat()),
       key_value_separator_(GetSeparatorFromLogger(*logger_)) {
   static_assert(sizeof(LogHelper::Impl) < 4096,
                 "Structures with size more than 4096 would consume at least "
@@ -128,14 +135,40 @@ void LogHelper::Impl::PutMessageBegin() {
       msg_.append(std::string_view{"tskv"});
       return;
     }
+    case Format::kBinary: {
+      // The record size is written right before the body in PutMessageEnd()
+      const auto now = std::chrono::time_point_cast<std::chrono::microseconds>(
+          TimePoint::clock::now());
+      msg_.resize(binary::kSizeVarintSize + binary::kMaxVarintSize + 1);
+      auto* position = msg_.data() + binary::kSizeVarintSize;
+      position += binary::WriteVarint(
+          position, static_cast<std::uint64_t>(now.time_since_epoch().count()));
+      *(position++) = static_cast<char>(level_);
+      msg_.resize(position - msg_.data());
+      return;
+    }
   }
   UASSERT_MSG(false, "Invalid value of Format enum");
 }
 
-void LogHelper::Impl::PutMessageEnd() { msg_.push_back('\n'); }
+void LogHelper::Impl::PutMessageEnd() {
+  if (format_ != Format::kBinary) {
+    msg_.push_back('\n');
+    return;
+  }
+
+  char size[binary::kMaxVarintSize];
+  const auto size_length =
+      binary::WriteVarint(size, msg_.size() - binary::kSizeVarintSize);
+  UASSERT(size_length <= binary::kSizeVarintSize);
+  message_begin_ = binary::kSizeVarintSize - size_length;
+  std::copy_n(size, size_length, msg_.data() + message_begin_);
+}
 
 void LogHelper::Impl::PutKey(std::string_view key) {
-  if (!utils::encoding::ShouldKeyBeEscaped(key)) {
+  if (format_ == Format::kBinary) {
+    PutBinaryKey(key);
+  } else if (!utils::encoding::ShouldKeyBeEscaped(key)) {
     PutRawKey(key);
   } else {
     UASSERT(!std::exchange(is_within_value_, true));
@@ -148,6 +181,11 @@ void LogHelper::Impl::PutKey(std::string_view key) {
 }
 
 void LogHelper::Impl::PutRawKey(std::string_view key) {
+  if (format_ == Format::kBinary) {
+    PutBinaryKey(key);
+    return;
+  }
+
   UASSERT(!std::exchange(is_within_value_, true));
   CheckRepeatedKeys(key);
   const auto old_size = msg_.size();
@@ -162,12 +200,20 @@ void LogHelper::Impl::PutRawKey(std::string_view key) {
 
 void LogHelper::Impl::PutValuePart(std::string_view value) {
   UASSERT(is_within_value_);
+  if (format_ == Format::kBinary) {
+    msg_.append(value);
+    return;
+  }
   utils::encoding::EncodeTskv(msg_, value,
                               utils::encoding::EncodeTskvMode::kValue);
 }
 
 void LogHelper::Impl::PutValuePart(char text_part) {
   UASSERT(is_within_value_);
+  if (format_ == Format::kBinary) {
+    msg_.push_back(text_part);
+    return;
+  }
   utils::encoding::EncodeTskv(fmt::appender(msg_), text_part,
                               utils::encoding::EncodeTskvMode::kValue);
 }
@@ -179,6 +225,37 @@ LogBuffer& LogHelper::Impl::GetBufferForRawValuePart() noexcept {
 
 void LogHelper::Impl::MarkValueEnd() noexcept {
   UASSERT(std::exchange(is_within_value_, false));
+  if (format_ != Format::kBinary) return;
+
+  // Replace the reserved space before the value with the actual size
+  const auto value_size = msg_.size() - value_begin_;
+  auto* const size_begin = msg_.data() + value_begin_ - binary::kSizeVarintSize;
+  const auto size_length = binary::WriteVarint(size_begin, value_size);
+  UASSERT(size_length <= binary::kSizeVarintSize);
+  std::memmove(size_begin + size_length, msg_.data() + value_begin_,
+               value_size);
+  msg_.resize(msg_.size() - (binary::kSizeVarintSize - size_length));
+}
+
+void LogHelper::Impl::PutBinaryKey(std::string_view key) {
+  UASSERT(!std::exchange(is_within_value_, true));
+  CheckRepeatedKeys(key);
+  const auto key_id = binary::FindKeyId(key);
+  const auto old_size = msg_.size();
+  msg_.resize(old_size + 2 * binary::kMaxVarintSize + key.size() +
+              binary::kSizeVarintSize);
+
+  auto* position = msg_.data() + old_size;
+  position += binary::WriteVarint(position, key_id);
+  if (key_id == 0) {
+    position += binary::WriteVarint(position, key.size());
+    key.copy(position, key.size());
+    position += key.size();
+  }
+  // The value size is written here in MarkValueEnd()
+  position += binary::kSizeVarintSize;
+  msg_.resize(position - msg_.data());
+  value_begin_ = msg_.size();
 }
 
 void LogHelper::Impl::StartText() {
@@ -200,7 +277,8 @@ void LogHelper::Impl::LogTheMessage() const {
   }
 
   UASSERT(logger_);
-  const std::string_view message(msg_.data(), msg_.size());
+  const std::string_view message(msg_.data() + message_begin_,
+                                 msg_.size() - message_begin_);
   logger_->Log(level_, message);
 }
 
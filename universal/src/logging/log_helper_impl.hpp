@@ -76,15 +76,22 @@ class LogHelper::Impl final {
 
   LazyInitedStream& GetLazyInitedStream();
 
+  void PutBinaryKey(std::string_view key);
+
   void CheckRepeatedKeys(std::string_view raw_key);
 
   impl::LoggerBase* logger_;
   const Level level_;
+  const Format format_;
   const char key_value_separator_;
   LogBuffer msg_;
   std::optional<LazyInitedStream> lazy_stream_;
   LogExtra extra_;
   std::size_t initial_length_{0};
+  // Format::kBinary only: the beginning of the current value and of the
+  // record, which is preceded by the unused part of the reserved size space
+  std::size_t value_begin_{0};
+  std::size_t message_begin_{0};
   bool is_within_value_{false};
   std::optional<std::unordered_set<std::string>> debug_tag_keys_;
 };
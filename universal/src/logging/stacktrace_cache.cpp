@@ -1,6 +1,13 @@
 #include <userver/logging/stacktrace_cache.hpp>
 
 #include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <thread>
 #include <unordered_map>
 
 #include <fmt/format.h>
@@ -9,6 +16,7 @@
 
 #include <userver/cache/lru_map.hpp>
 #include <userver/compiler/thread_local.hpp>
+#include <userver/logging/log.hpp>
 #include <userver/utils/assert.hpp>
 
 namespace std {
@@ -29,48 +37,97 @@ namespace logging::stacktrace_cache {
 namespace {
 
 constexpr std::string_view kStartOfCoroutine = "utils::impl::WrappedCallImpl<";
+constexpr std::size_t kFrameCacheSize = 10000;
+constexpr std::size_t kMaxPendingStacktraces = 1000;
+
+using FrameNameCache = cache::LruMap<boost::stacktrace::frame, std::string>;
 
 std::atomic<bool> stacktrace_enabled{true};
 
 compiler::ThreadLocal local_frame_name_cache = [] {
-  return cache::LruMap<boost::stacktrace::frame, std::string>{10000};
+  return FrameNameCache{kFrameCacheSize};
+};
+
+// Shared between the threads, so that the frames symbolized by the background
+// thread become visible to everyone. Thread-local caches are checked first to
+// avoid contention on the mutex.
+class SharedFrameNameCache final {
+ public:
+  std::optional<std::string> Get(boost::stacktrace::frame frame) {
+    const std::lock_guard lock(mutex_);
+    auto* ptr = cache_.Get(frame);
+    if (!ptr) return std::nullopt;
+    return *ptr;
+  }
+
+  void Put(boost::stacktrace::frame frame, const std::string& name) {
+    const std::lock_guard lock(mutex_);
+    cache_.Put(frame, name);
+  }
+
+ private:
+  std::mutex mutex_;
+  FrameNameCache cache_{kFrameCacheSize};
 };
 
-const std::string& ToStringCachedFiltered(boost::stacktrace::frame frame) {
+SharedFrameNameCache& GetSharedFrameNameCache() {
+  static SharedFrameNameCache cache;
+  return cache;
+}
+
+std::string SymbolizeFiltered(boost::stacktrace::frame frame) {
+  auto name = boost::stacktrace::to_string(frame);
+  UASSERT(!name.empty());
+  if (name.find(kStartOfCoroutine) != std::string::npos) {
+    name = {};
+  }
+  return name;
+}
+
+// Returns nullptr if the frame is not cached and `symbolize` is false
+const std::string* FindOrSymbolizeFiltered(boost::stacktrace::frame frame,
+                                           bool symbolize) {
   auto frame_name_cache = local_frame_name_cache.Use();
   auto* ptr = frame_name_cache->Get(frame);
-  if (!ptr) {
-    auto name = boost::stacktrace::to_string(frame);
-    UASSERT(!name.empty());
-    if (name.find(kStartOfCoroutine) != std::string::npos) {
-      name = {};
-    }
-    ptr = frame_name_cache->Emplace(frame, std::move(name));
+  if (ptr) return ptr;
+
+  auto& shared_cache = GetSharedFrameNameCache();
+  auto name = shared_cache.Get(frame);
+  if (!name) {
+    if (!symbolize) return nullptr;
+    name = SymbolizeFiltered(frame);
+    shared_cache.Put(frame, *name);
   }
-  return *ptr;
+  return frame_name_cache->Emplace(frame, std::move(*name));
 }
 
-}  // namespace
-
-std::string to_string(const boost::stacktrace::stacktrace& st) {
-  if (!stacktrace_enabled.load()) {
-    return "<unknown>";
+void AppendFrameNumber(std::string& res, std::size_t i) {
+  if (i < 10) {
+    res += ' ';
   }
+  res += fmt::to_string(i);
+  res += '#';
+  res += ' ';
+}
 
+std::string ToStringImpl(const boost::stacktrace::stacktrace& st,
+                         bool symbolize, bool& has_unresolved) {
   std::string res;
   res.reserve(200 * st.size());
 
   size_t i = 0;
   for (const auto frame : st) {
-    if (i < 10) {
-      res += ' ';
+    AppendFrameNumber(res, i);
+    const auto* filtered_frame_name = FindOrSymbolizeFiltered(frame, symbolize);
+
+    if (!filtered_frame_name) {
+      has_unresolved = true;
+      res += fmt::format("{}\n", fmt::ptr(frame.address()));
+      i++;
+      continue;
     }
-    res += fmt::to_string(i);
-    res += '#';
-    res += ' ';
-    const auto& filtered_frame_name = ToStringCachedFiltered(frame);
 
-    if (filtered_frame_name.empty()) {
+    if (filtered_frame_name->empty()) {
       /* The rest is a long common stacktrace for a task w/ std::function,
        * WrappedCall, fiber, etc. Almost useless for service debugging.
        */
@@ -78,7 +135,7 @@ std::string to_string(const boost::stacktrace::stacktrace& st) {
       break;
     }
 
-    res += filtered_frame_name;
+    res += *filtered_frame_name;
     res += '\n';
     i++;
   }
@@ -86,6 +143,103 @@ std::string to_string(const boost::stacktrace::stacktrace& st) {
   return res;
 }
 
+class AsyncSymbolizer final {
+ public:
+  AsyncSymbolizer() : thread_([this] { Run(); }) {}
+
+  ~AsyncSymbolizer() {
+    {
+      const std::lock_guard lock(mutex_);
+      is_stopping_ = true;
+    }
+    cv_.notify_one();
+    thread_.join();
+  }
+
+  // Returns the stacktrace id, or 0 if the queue is full
+  std::uint64_t Enqueue(const boost::stacktrace::stacktrace& st) {
+    std::uint64_t id = 0;
+    {
+      const std::lock_guard lock(mutex_);
+      if (queue_.size() >= kMaxPendingStacktraces) return 0;
+      id = ++last_id_;
+      queue_.push_back({id, st});
+    }
+    cv_.notify_one();
+    return id;
+  }
+
+ private:
+  struct Pending final {
+    std::uint64_t id;
+    boost::stacktrace::stacktrace st;
+  };
+
+  void Run() {
+    std::unique_lock lock(mutex_);
+    while (true) {
+      cv_.wait(lock, [this] { return is_stopping_ || !queue_.empty(); });
+      // Drain the queue on stop, the ids are already in the logs
+      if (queue_.empty()) return;
+
+      auto pending = std::move(queue_.front());
+      queue_.pop_front();
+      lock.unlock();
+
+      try {
+        bool has_unresolved = false;
+        auto text =
+            ToStringImpl(pending.st, /*symbolize=*/true, has_unresolved);
+        LOG_WARNING() << "Symbolized stacktrace id=" << pending.id << ":\n"
+                      << text;
+      } catch (const std::exception& e) {
+        LOG_ERROR() << "Failed to symbolize stacktrace id=" << pending.id
+                    << ": " << e;
+      }
+
+      lock.lock();
+    }
+  }
+
+  std::mutex mutex_;
+  std::condition_variable cv_;
+  std::deque<Pending> queue_;
+  std::uint64_t last_id_{0};
+  bool is_stopping_{false};
+  std::thread thread_;
+};
+
+std::mutex async_symbolizer_mutex;
+std::shared_ptr<AsyncSymbolizer> async_symbolizer;
+std::atomic<bool> async_symbolization_enabled{false};
+
+std::shared_ptr<AsyncSymbolizer> GetAsyncSymbolizer() {
+  if (!async_symbolization_enabled.load()) return nullptr;
+  const std::lock_guard lock(async_symbolizer_mutex);
+  return async_symbolizer;
+}
+
+}  // namespace
+
+std::string to_string(const boost::stacktrace::stacktrace& st) {
+  if (!stacktrace_enabled.load()) {
+    return "<unknown>";
+  }
+
+  const auto symbolizer = GetAsyncSymbolizer();
+  bool has_unresolved = false;
+  auto res = ToStringImpl(st, /*symbolize=*/!symbolizer, has_unresolved);
+  if (!has_unresolved) return res;
+
+  UASSERT(symbolizer);
+  const auto id = symbolizer->Enqueue(st);
+  if (id == 0) {
+    return "[symbolization queue is full, raw addresses]\n" + res;
+  }
+  return fmt::format("[symbolized asynchronously, see stacktrace id={}]\n{}",
+                     id, res);
+}
+
 bool GlobalEnableStacktrace(bool enable) {
   return stacktrace_enabled.exchange(enable);
 }
@@ -97,6 +251,26 @@ StacktraceGuard::~StacktraceGuard() {
   logging::stacktrace_cache::GlobalEnableStacktrace(old_);
 }
 
+AsyncSymbolizationGuard::AsyncSymbolizationGuard() {
+  const std::lock_guard lock(async_symbolizer_mutex);
+  UINVARIANT(!async_symbolizer,
+             "Only one AsyncSymbolizationGuard may exist at a time");
+  async_symbolizer = std::make_shared<AsyncSymbolizer>();
+  async_symbolization_enabled = true;
+}
+
+AsyncSymbolizationGuard::~AsyncSymbolizationGuard() {
+  std::shared_ptr<AsyncSymbolizer> symbolizer;
+  {
+    const std::lock_guard lock(async_symbolizer_mutex);
+    async_symbolization_enabled = false;
+    symbolizer = std::move(async_symbolizer);
+  }
+  // Waits for the pending stacktraces unless a concurrent to_string still
+  // holds the symbolizer, in which case the last holder does that.
+  symbolizer.reset();
+}
+
 }  // namespace logging::stacktrace_cache
 
 USERVER_NAMESPACE_END
@@ -0,0 +1,106 @@
+#include <userver/utils/blocked_filter_bloom.hpp>
+
+#include <cstdint>
+#include <random>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include <userver/utils/filter_bloom.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+std::vector<std::uint64_t> GenerateKeys(std::size_t count) {
+  std::mt19937_64 rng{42};
+  std::vector<std::uint64_t> keys(count);
+  for (auto& key : keys) key = rng();
+  return keys;
+}
+
+}  // namespace
+
+// Argument: the number of items. The filters get 16 bits or counters per item,
+// so the largest ones do not fit into the CPU caches.
+void filter_bloom_has(benchmark::State& state) {
+  const auto items = static_cast<std::size_t>(state.range(0));
+  const auto keys = GenerateKeys(items);
+  utils::FilterBloom<std::uint64_t> filter(items * 16);
+  for (const auto key : keys) filter.Increment(key);
+
+  std::size_t i = 0;
+  for ([[maybe_unused]] auto _ : state) {
+    benchmark::DoNotOptimize(filter.Has(keys[i]));
+    if (++i == keys.size()) i = 0;
+  }
+}
+BENCHMARK(filter_bloom_has)->RangeMultiplier(16)->Range(1 << 10, 1 << 22);
+
+void blocked_filter_bloom_contains(benchmark::State& state) {
+  const auto items = static_cast<std::size_t>(state.range(0));
+  const auto keys = GenerateKeys(items);
+  utils::BlockedFilterBloom<std::uint64_t> filter(items * 16);
+  for (const auto key : keys) filter.Add(key);
+
+  std::size_t i = 0;
+  for ([[maybe_unused]] auto _ : state) {
+    benchmark::DoNotOptimize(filter.Contains(keys[i]));
+    if (++i == keys.size()) i = 0;
+  }
+}
+BENCHMARK(blocked_filter_bloom_contains)
+    ->RangeMultiplier(16)
+    ->Range(1 << 10, 1 << 22);
+
+void blocked_filter_bloom_contains_many(benchmark::State& state) {
+  constexpr std::size_t kBatchSize = 64;
+  const auto items = static_cast<std::size_t>(state.range(0));
+  const auto keys = GenerateKeys(items);
+  utils::BlockedFilterBloom<std::uint64_t> filter(items * 16);
+  for (const auto key : keys) filter.Add(key);
+
+  std::vector<bool> found(kBatchSize);
+  std::size_t i = 0;
+  for ([[maybe_unused]] auto _ : state) {
+    filter.ContainsMany(utils::span<const std::uint64_t>{&keys[i], kBatchSize},
+                        found.begin());
+    benchmark::DoNotOptimize(found);
+    i += kBatchSize;
+    if (i + kBatchSize > keys.size()) i = 0;
+  }
+  state.SetItemsProcessed(state.iterations() * kBatchSize);
+}
+BENCHMARK(blocked_filter_bloom_contains_many)
+    ->RangeMultiplier(16)
+    ->Range(1 << 10, 1 << 22);
+
+void filter_bloom_increment(benchmark::State& state) {
+  const auto items = static_cast<std::size_t>(state.range(0));
+  const auto keys = GenerateKeys(items);
+  utils::FilterBloom<std::uint64_t> filter(items * 16);
+
+  std::size_t i = 0;
+  for ([[maybe_unused]] auto _ : state) {
+    filter.Increment(keys[i]);
+    if (++i == keys.size()) i = 0;
+  }
+}
+BENCHMARK(filter_bloom_increment)->RangeMultiplier(16)->Range(1 << 10, 1 << 22);
+
+void blocked_counting_filter_bloom_increment(benchmark::State& state) {
+  const auto items = static_cast<std::size_t>(state.range(0));
+  const auto keys = GenerateKeys(items);
+  utils::BlockedCountingFilterBloom<std::uint64_t> filter(items * 16);
+
+  std::size_t i = 0;
+  for ([[maybe_unused]] auto _ : state) {
+    filter.Increment(keys[i]);
+    if (++i == keys.size()) i = 0;
+  }
+}
+BENCHMARK(blocked_counting_filter_bloom_increment)
+    ->RangeMultiplier(16)
+    ->Range(1 << 10, 1 << 22);
+
+USERVER_NAMESPACE_END
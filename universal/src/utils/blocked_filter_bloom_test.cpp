@@ -0,0 +1,134 @@
+#include <userver/utils/blocked_filter_bloom.hpp>
+
+#include <iterator>
+#include <limits>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+USERVER_NAMESPACE_BEGIN
+
+TEST(BlockedFilterBloom, Sample) {
+  /// [Sample usage]
+  utils::BlockedFilterBloom<int> filter(16 * 1024);
+  for (int i = 0; i < 1024; ++i) filter.Add(i);
+
+  for (int i = 0; i < 1024; ++i) {
+    EXPECT_TRUE(filter.Contains(i));
+  }
+
+  const std::vector<int> keys{1, 2, 3};
+  std::vector<bool> found;
+  filter.ContainsMany(keys, std::back_inserter(found));
+  EXPECT_EQ(found, (std::vector<bool>{true, true, true}));
+  /// [Sample usage]
+}
+
+TEST(BlockedFilterBloom, FalsePositiveRate) {
+  constexpr int kItems = 10000;
+  utils::BlockedFilterBloom<int> filter(kItems * 16);
+  for (int i = 0; i < kItems; ++i) filter.Add(i);
+
+  int false_positives = 0;
+  for (int i = kItems; i < 2 * kItems; ++i) {
+    if (filter.Contains(i)) ++false_positives;
+  }
+  // About 0.1% is expected
+  EXPECT_LT(false_positives, kItems / 100);
+}
+
+TEST(BlockedFilterBloom, ContainsMany) {
+  utils::BlockedFilterBloom<std::string> filter(1024);
+  std::vector<std::string> keys;
+  for (int i = 0; i < 100; ++i) {
+    keys.push_back(std::to_string(i));
+    if (i % 2 == 0) filter.Add(keys.back());
+  }
+
+  std::vector<bool> found(keys.size());
+  const auto end = filter.ContainsMany(keys, found.begin());
+  EXPECT_EQ(end, found.end());
+  for (std::size_t i = 0; i < keys.size(); ++i) {
+    EXPECT_EQ(found[i], filter.Contains(keys[i])) << keys[i];
+    if (i % 2 == 0) {
+      EXPECT_TRUE(found[i]) << keys[i];
+    }
+  }
+}
+
+TEST(BlockedFilterBloom, Clear) {
+  utils::BlockedFilterBloom<std::size_t> filter(32);
+  EXPECT_EQ(filter.GetBitsCount(), 512U);
+  filter.Add(1);
+  filter.Add(2);
+  EXPECT_TRUE(filter.Contains(1));
+  EXPECT_TRUE(filter.Contains(2));
+  filter.Clear();
+  EXPECT_FALSE(filter.Contains(1));
+  EXPECT_FALSE(filter.Contains(2));
+}
+
+TEST(BlockedFilterBloom, FromBytes) {
+  utils::BlockedFilterBloom<int> filter(4096);
+  for (int i = 0; i < 100; ++i) filter.Add(i);
+
+  const std::string bytes{filter.GetBytes()};
+  EXPECT_EQ(bytes.size() * 8, filter.GetBitsCount());
+  const auto restored = utils::BlockedFilterBloom<int>::FromBytes(bytes);
+  EXPECT_EQ(restored.GetBytes(), bytes);
+  for (int i = 0; i < 100; ++i) {
+    EXPECT_TRUE(restored.Contains(i));
+  }
+}
+
+TEST(BlockedCountingFilterBloom, Estimate) {
+  utils::BlockedCountingFilterBloom<int> filter(16 * 1024);
+  for (int i = 0; i < 512; ++i) {
+    for (std::size_t j = 0; j < 5; ++j) filter.Increment(i);
+  }
+  for (int i = 512; i < 1024; ++i) {
+    for (std::size_t j = 0; j < 10; ++j) filter.Increment(i);
+  }
+
+  for (int i = 0; i < 512; ++i) {
+    EXPECT_LE(5, filter.Estimate(i));
+    EXPECT_GE(7, filter.Estimate(i));
+  }
+  for (int i = 512; i < 1024; ++i) {
+    EXPECT_LE(10, filter.Estimate(i));
+  }
+  EXPECT_FALSE(filter.Has(-1));
+}
+
+TEST(BlockedCountingFilterBloom, Halve) {
+  utils::BlockedCountingFilterBloom<std::size_t> filter(1024);
+  for (std::size_t i = 0; i < 8; ++i) filter.Increment(1);
+  filter.Increment(2);
+  filter.Halve();
+  EXPECT_EQ(4, filter.Estimate(1));
+  EXPECT_FALSE(filter.Has(2));
+  filter.Clear();
+  EXPECT_FALSE(filter.Has(1));
+}
+
+TEST(BlockedCountingFilterBloom, Saturation) {
+  utils::BlockedCountingFilterBloom<std::size_t> filter(32);
+  for (std::size_t i = 0; i < 1000; ++i) filter.Increment(1);
+  EXPECT_EQ(std::numeric_limits<std::uint8_t>::max(), filter.Estimate(1));
+}
+
+TEST(BlockedCountingFilterBloom, FromBytes) {
+  utils::BlockedCountingFilterBloom<std::string> filter(1024);
+  filter.Increment("a");
+  filter.Increment("a");
+  filter.Increment("b");
+
+  const auto restored =
+      utils::BlockedCountingFilterBloom<std::string>::FromBytes(
+          filter.GetBytes());
+  EXPECT_LE(2, restored.Estimate("a"));
+  EXPECT_LE(1, restored.Estimate("b"));
+}
+
+USERVER_NAMESPACE_END
@@ -1,8 +1,10 @@
 #include <userver/utils/boost_uuid4.hpp>
 
 #include <array>
+#include <cstdint>
+#include <cstring>
+#include <random>
 
-#include <boost/uuid/random_generator.hpp>
 #include <boost/uuid/uuid.hpp>
 #include <boost/uuid/uuid_io.hpp>
 
@@ -101,10 +103,12 @@ boost::uuids::uuid FromChars(const char* begin, const char* end) {
   return u;
 }
 
-compiler::ThreadLocal local_uuid_generator = [] {
-  return WithDefaultRandom([](RandomBase& rng) {
-    return boost::uuids::basic_random_generator<RandomBase>(rng);
-  });
+// A 64-bit engine fills the UUID in two non-virtual calls, unlike
+// boost::uuids::basic_random_generator<RandomBase> that makes four virtual
+// calls and a distribution per UUID.
+compiler::ThreadLocal local_uuid_random = [] {
+  auto seed_seq = impl::MakeSeedSeq();
+  return std::mt19937_64{seed_seq};
 };
 
 }  // namespace
@@ -112,8 +116,22 @@ compiler::ThreadLocal local_uuid_generator = [] {
 namespace generators {
 
 boost::uuids::uuid GenerateBoostUuid() {
-  auto generator = local_uuid_generator.Use();
-  return (*generator)();
+  std::array<std::uint64_t, 2> random{};
+  {
+    auto engine = local_uuid_random.Use();
+    random = {(*engine)(), (*engine)()};
+  }
+
+  boost::uuids::uuid uuid{};
+  static_assert(sizeof(uuid.data) == sizeof(random));
+  std::memcpy(uuid.data, random.data(), sizeof(random));
+
+  // Version 4, see RFC 4122 section 4.4
+  uuid.data[6] = (uuid.data[6] & 0x0F) | 0x40;
+  // Variant 10xx
+  uuid.data[8] = (uuid.data[8] & 0x3F) | 0x80;
+
+  return uuid;
 }
 
 }  // namespace generators
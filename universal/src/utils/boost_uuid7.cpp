@@ -1,10 +1,7 @@
 #include <userver/utils/boost_uuid7.hpp>
 
 #include <chrono>
-#include <limits>
-
-#include <boost/random/uniform_int.hpp>
-#include <boost/random/variate_generator.hpp>
+#include <random>
 
 #include <userver/compiler/thread_local.hpp>
 #include <userver/utils/datetime/wall_coarse_clock.hpp>
@@ -19,11 +16,10 @@ namespace {
 /// https://commitfest.postgresql.org/43/4388/
 class UuidV7Generator {
  public:
-  UuidV7Generator(utils::RandomBase& rng)
-      : random_generator_(&rng,
-                          boost::uniform_int<std::uint64_t>(
-                              std::numeric_limits<std::uint64_t>::min(),
-                              std::numeric_limits<std::uint64_t>::max())) {}
+  UuidV7Generator() {
+    auto seed_seq = utils::impl::MakeSeedSeq();
+    random_engine_.seed(seed_seq);
+  }
 
   boost::uuids::uuid operator()() {
     boost::uuids::uuid uuid{};
@@ -97,11 +93,11 @@ class UuidV7Generator {
  private:
   void GenerateRandomBlock(utils::span<std::uint8_t> block) {
     int i = 0;
-    std::uint64_t random_value = random_generator_();
+    std::uint64_t random_value = random_engine_();
 
     for (auto it = block.begin(), end = block.end(); it != end; ++it, ++i) {
       if (i == sizeof(std::uint64_t)) {
-        random_value = random_generator_();
+        random_value = random_engine_();
         i = 0;
       }
 
@@ -116,9 +112,8 @@ class UuidV7Generator {
   }
 
  private:
-  boost::random::variate_generator<utils::RandomBase*,
-                                   boost::uniform_int<std::uint64_t>>
-      random_generator_;
+  // Non-virtual 64-bit engine, it produces 8 random bytes per call
+  std::mt19937_64 random_engine_;
 
   std::uint32_t sequence_counter_{0};
   std::uint64_t previous_timestamp_{0};
@@ -127,8 +122,7 @@ class UuidV7Generator {
 };
 
 compiler::ThreadLocal local_uuid_v7_generator = [] {
-  return utils::WithDefaultRandom(
-      [](utils::RandomBase& rng) { return UuidV7Generator(rng); });
+  return UuidV7Generator{};
 };
 
 }  // namespace
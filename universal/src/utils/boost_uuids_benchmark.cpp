@@ -2,6 +2,8 @@
 
 #include <userver/utils/boost_uuid4.hpp>
 #include <userver/utils/boost_uuid7.hpp>
+#include <userver/utils/uuid4.hpp>
+#include <userver/utils/uuid7.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
@@ -23,7 +25,27 @@ void GenerateUuidV7(benchmark::State& state) {
   GenerateUuid(&utils::generators::GenerateBoostUuidV7, state);
 }
 
+void GenerateUuidV4String(benchmark::State& state) {
+  GenerateUuid(&utils::generators::GenerateUuid, state);
+}
+
+void GenerateUuidV7String(benchmark::State& state) {
+  GenerateUuid(&utils::generators::GenerateUuidV7, state);
+}
+
+void GenerateUuidV4Hex(benchmark::State& state) {
+  GenerateUuid(&utils::generators::GenerateUuidHex, state);
+}
+
+void GenerateUuidV7Hex(benchmark::State& state) {
+  GenerateUuid(&utils::generators::GenerateUuidV7Hex, state);
+}
+
 BENCHMARK(GenerateUuidV4)->RangeMultiplier(2)->Range(1, 1 << 12);
 BENCHMARK(GenerateUuidV7)->RangeMultiplier(2)->Range(1, 1 << 12);
+BENCHMARK(GenerateUuidV4String)->RangeMultiplier(8)->Range(1, 1 << 12);
+BENCHMARK(GenerateUuidV7String)->RangeMultiplier(8)->Range(1, 1 << 12);
+BENCHMARK(GenerateUuidV4Hex)->RangeMultiplier(8)->Range(1, 1 << 12);
+BENCHMARK(GenerateUuidV7Hex)->RangeMultiplier(8)->Range(1, 1 << 12);
 
 USERVER_NAMESPACE_END
@@ -1,9 +1,12 @@
 #include <userver/utils/encoding/hex.hpp>
 
+#include <array>
 #include <stdexcept>
 #include <string_view>
 
-#ifdef __SSSE3__
+#if defined(__AVX2__)
+#include <immintrin.h>
+#elif defined(__SSSE3__)
 #include <tmmintrin.h>
 #endif
 
@@ -24,121 +27,102 @@ char ToHexChar(int num) {
   return detail::kXdigits[num];
 }
 
-/// Converts xDigit to its value. Undefined behaviour if
-/// xDigit is not one of "0123456789abcdef"
-unsigned char GetXDigitValue(unsigned char x_digit) noexcept {
-  switch (x_digit) {
-    case '0':
-      return 0;
-    case '1':
-      return 1;
-    case '2':
-      return 2;
-    case '3':
-      return 3;
-    case '4':
-      return 4;
-    case '5':
-      return 5;
-    case '6':
-      return 6;
-    case '7':
-      return 7;
-    case '8':
-      return 8;
-    case '9':
-      return 9;
-    case 'a':
-    case 'A':
-      return 10;
-    case 'b':
-    case 'B':
-      return 11;
-    case 'c':
-    case 'C':
-      return 12;
-    case 'd':
-    case 'D':
-      return 13;
-    case 'e':
-    case 'E':
-      return 14;
-    case 'f':
-    case 'F':
-      return 15;
-    default:
-      return 255;
+constexpr unsigned char kInvalidXDigit = 255;
+
+constexpr std::array<unsigned char, 256> MakeXDigitValues() {
+  std::array<unsigned char, 256> values{};
+  for (auto& value : values) value = kInvalidXDigit;
+  for (int i = 0; i < 10; ++i) values['0' + i] = i;
+  for (int i = 0; i < 6; ++i) {
+    values['a' + i] = 10 + i;
+    values['A' + i] = 10 + i;
   }
+  return values;
+}
 
-  return 255;  // because undefined behaviour
+constexpr auto kXDigitValues = MakeXDigitValues();
+
+/// Converts xDigit to its value, 255 if xDigit is not one of
+/// "0123456789abcdefABCDEF"
+unsigned char GetXDigitValue(unsigned char x_digit) noexcept {
+  return kXDigitValues[x_digit];
 }
 
 bool IsXDigit(unsigned char x_digit) noexcept {
-  switch (x_digit) {
-    case '0':
-    case '1':
-    case '2':
-    case '3':
-    case '4':
-    case '5':
-    case '6':
-    case '7':
-    case '8':
-    case '9':
-    case 'a':
-    case 'A':
-    case 'b':
-    case 'B':
-    case 'c':
-    case 'C':
-    case 'd':
-    case 'D':
-    case 'e':
-    case 'E':
-    case 'f':
-    case 'F':
-      return true;
-    default:
-      return false;
-  }
-
-  return false;
+  return kXDigitValues[x_digit] != kInvalidXDigit;
 }
 
-#ifdef __SSSE3__
+#if defined(__SSSE3__)
 const auto kLow4BitsMask = _mm_set1_epi8(0xf);
 const auto kDigitsMask = _mm_setr_epi8('0', '1', '2', '3', '4', '5', '6', '7',
                                        '8', '9', 'a', 'b', 'c', 'd', 'e', 'f');
-#endif
-
-}  // namespace detail
 
-std::string_view GetHexPart(std::string_view encoded) noexcept {
-  const char* ptr = encoded.data();
-  const char* last = ptr + encoded.size();
-  for (; ptr != last; ptr++) {
-    if (!detail::IsXDigit(*ptr)) {
-      break;
-    }
+// Decodes 16 hex characters into 8 bytes, returns false if any of the
+// characters is not a hex digit
+bool DecodeHex16(const char* src, char* dst) noexcept {
+  const auto chars = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src));
+  // Letters to the lower case, the digits already have this bit set
+  const auto lower = _mm_or_si128(chars, _mm_set1_epi8(0x20));
+
+  // Signed comparisons reject the non-ASCII bytes as well
+  const auto is_digit =
+      _mm_and_si128(_mm_cmpgt_epi8(chars, _mm_set1_epi8('0' - 1)),
+                    _mm_cmpgt_epi8(_mm_set1_epi8('9' + 1), chars));
+  const auto is_letter =
+      _mm_and_si128(_mm_cmpgt_epi8(lower, _mm_set1_epi8('a' - 1)),
+                    _mm_cmpgt_epi8(_mm_set1_epi8('f' + 1), lower));
+  if (_mm_movemask_epi8(_mm_or_si128(is_digit, is_letter)) != 0xffff) {
+    return false;
   }
 
-  auto length = std::distance(encoded.data(), ptr);
-  if (length % 2 == 1) {
-    // uneven length
-    length--;
-  }
+  const auto values = _mm_or_si128(
+      _mm_and_si128(is_digit, _mm_sub_epi8(chars, _mm_set1_epi8('0'))),
+      _mm_and_si128(is_letter, _mm_sub_epi8(lower, _mm_set1_epi8('a' - 10))));
+  // (high << 4) | low for each pair of the digits
+  const auto bytes = _mm_maddubs_epi16(values, _mm_set1_epi16(0x0110));
+  _mm_storel_epi64(reinterpret_cast<__m128i*>(dst),
+                   _mm_packus_epi16(bytes, bytes));
+  return true;
+}
+#endif
 
-  return std::string_view{encoded.data(), static_cast<size_t>(length)};
+#if defined(__AVX2__)
+// Encodes 32 bytes into 64 hex characters
+void EncodeHex32(const char* src, char* dst) noexcept {
+  const auto data = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src));
+  const auto low4_bits_mask = _mm256_set1_epi8(0xf);
+  const auto digits = _mm256_broadcastsi128_si256(kDigitsMask);
+
+  const auto high = _mm256_and_si256(_mm256_srli_epi16(data, 4), low4_bits_mask);
+  const auto low = _mm256_and_si256(data, low4_bits_mask);
+  // Interleaving works within the 128-bit lanes, so the halves are mixed up:
+  // first = bytes [0, 8) and [16, 24), second = bytes [8, 16) and [24, 32)
+  const auto first =
+      _mm256_shuffle_epi8(digits, _mm256_unpacklo_epi8(high, low));
+  const auto second =
+      _mm256_shuffle_epi8(digits, _mm256_unpackhi_epi8(high, low));
+
+  _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst),
+                      _mm256_permute2x128_si256(first, second, 0x20));
+  _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst + 32),
+                      _mm256_permute2x128_si256(first, second, 0x31));
 }
+#endif
 
-void ToHex(std::string_view input, std::string& out) noexcept {
-  out.clear();
-  out.resize(input.size() * 2);
+// Writes LengthInHexForm(input) characters
+char* EncodeHex(std::string_view input, char* dst) noexcept {
   const auto* first = input.data();
   const auto* last = input.data() + input.size();
-  auto* dst = out.data();
 
-#ifdef __SSSE3__
+#if defined(__AVX2__)
+  while (last - first >= 32) {
+    EncodeHex32(first, dst);
+    first += 32;
+    dst += 64;
+  }
+#endif
+
+#if defined(__SSSE3__)
   while (last - first >= 8) {
     // we only take 8 bytes because each byte transforms into 2 bytes
     // (first digit comes from 4 high bits, second comes from 4 low bits)
@@ -154,12 +138,12 @@ void ToHex(std::string_view input, std::string& out) noexcept {
     const auto interleaving_hi_lo =
         _mm_and_si128(_mm_unpacklo_epi8(_mm_srli_epi64(eight_bytes_of_data, 4),
                                         eight_bytes_of_data),
-                      detail::kLow4BitsMask);
+                      kLow4BitsMask);
 
     // and now we gather kXdigits as specified in interleaving_hi_lo
     // and store them into the result
     _mm_storeu_si128(reinterpret_cast<__m128i*>(dst),
-                     _mm_shuffle_epi8(detail::kDigitsMask, interleaving_hi_lo));
+                     _mm_shuffle_epi8(kDigitsMask, interleaving_hi_lo));
 
     first += 8;
     dst += 16;
@@ -169,10 +153,46 @@ void ToHex(std::string_view input, std::string& out) noexcept {
   while (first != last) {
     const auto value = *first;
     // We don't use ToHexChar because it does range checking
-    *(dst++) = detail::kXdigits[(value >> 4) & 0xf];
-    *(dst++) = detail::kXdigits[value & 0xf];
+    *(dst++) = kXdigits[(value >> 4) & 0xf];
+    *(dst++) = kXdigits[value & 0xf];
     ++first;
   }
+  return dst;
+}
+
+}  // namespace detail
+
+std::string_view GetHexPart(std::string_view encoded) noexcept {
+  const char* ptr = encoded.data();
+  const char* last = ptr + encoded.size();
+  for (; ptr != last; ptr++) {
+    if (!detail::IsXDigit(*ptr)) {
+      break;
+    }
+  }
+
+  auto length = std::distance(encoded.data(), ptr);
+  if (length % 2 == 1) {
+    // uneven length
+    length--;
+  }
+
+  return std::string_view{encoded.data(), static_cast<size_t>(length)};
+}
+
+void ToHex(std::string_view input, std::string& out) noexcept {
+  out.clear();
+  AppendHex(input, out);
+}
+
+void AppendHex(std::string_view input, std::string& out) noexcept {
+  const auto old_size = out.size();
+  out.resize(old_size + LengthInHexForm(input));
+  detail::EncodeHex(input, out.data() + old_size);
+}
+
+char* ToHex(std::string_view input, char* out) noexcept {
+  return detail::EncodeHex(input, out);
 }
 
 bool IsHexData(std::string_view encoded) noexcept {
@@ -186,28 +206,34 @@ bool IsHexData(std::string_view encoded) noexcept {
 }
 
 size_t FromHex(std::string_view encoded, std::string& out) noexcept {
-  // we need to read in pairs
+  const auto old_size = out.size();
+  out.resize(old_size + FromHexUpperBound(encoded.size()));
+
   const char* first = encoded.data();
-  const char* pair_ptr = first;
   const char* last = first + encoded.size();
-  for (; pair_ptr != last; pair_ptr += 2) {
-    if (!detail::IsXDigit(pair_ptr[0])) {
-      break;
-    }
+  char* dst = out.data() + old_size;
+
+#if defined(__SSSE3__)
+  // Stops at the first chunk with a non-hex character, the rest is decoded
+  // one pair at a time to find where exactly the hex data ends
+  while (last - first >= 16 && detail::DecodeHex16(first, dst)) {
+    first += 16;
+    dst += 8;
+  }
+#endif
 
-    if (pair_ptr + 1 == last) {
-      // no second element
-      break;
-    }
-    if (!detail::IsXDigit(pair_ptr[1])) {
+  // we need to read in pairs
+  for (; last - first >= 2; first += 2) {
+    const auto high = detail::GetXDigitValue(first[0]);
+    const auto low = detail::GetXDigitValue(first[1]);
+    if (high == detail::kInvalidXDigit || low == detail::kInvalidXDigit) {
       break;
     }
-
-    out.push_back((detail::GetXDigitValue(pair_ptr[0]) << 4) |
-                  (detail::GetXDigitValue(pair_ptr[1])));
+    *(dst++) = static_cast<char>((high << 4) | low);
   }
 
-  return static_cast<size_t>(std::distance(first, pair_ptr));
+  out.resize(dst - out.data());
+  return static_cast<size_t>(first - encoded.data());
 }
 
 }  // namespace utils::encoding
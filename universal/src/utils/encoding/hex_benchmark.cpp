@@ -42,4 +42,32 @@ void to_hex_benchmark_no_alloc(benchmark::State& state) {
 }
 BENCHMARK(to_hex_benchmark_no_alloc)->RangeMultiplier(2)->Range(8, 512);
 
+void append_hex_benchmark(benchmark::State& state) {
+  const auto source = GenerateSource(state.range(0));
+
+  std::string out;
+  out.reserve(state.range(0) * 2);
+
+  for ([[maybe_unused]] auto _ : state) {
+    out.clear();
+    utils::encoding::AppendHex(source, out);
+    benchmark::DoNotOptimize(out);
+  }
+}
+BENCHMARK(append_hex_benchmark)->RangeMultiplier(2)->Range(8, 512);
+
+void from_hex_benchmark(benchmark::State& state) {
+  const auto source =
+      utils::encoding::ToHex(GenerateSource(state.range(0)));
+
+  std::string out;
+  out.reserve(state.range(0));
+
+  for ([[maybe_unused]] auto _ : state) {
+    out.clear();
+    benchmark::DoNotOptimize(utils::encoding::FromHex(source, out));
+  }
+}
+BENCHMARK(from_hex_benchmark)->RangeMultiplier(2)->Range(8, 512);
+
 USERVER_NAMESPACE_END
@@ -39,6 +39,53 @@ TEST(Hex, ToHexLong) {
   EXPECT_EQ(reference, result);
 }
 
+TEST(Hex, AppendHex) {
+  std::string result{"prefix:"};
+  AppendHex("_+=156", result);
+  EXPECT_EQ("prefix:5f2b3d313536", result);
+
+  ToHex("_+=156", result);
+  EXPECT_EQ("5f2b3d313536", result);
+}
+
+TEST(Hex, ToHexBuffer) {
+  constexpr std::string_view data{"_+=156"};
+  char buffer[12];
+  char* end = ToHex(data, buffer);
+  EXPECT_EQ(buffer + 12, end);
+  EXPECT_EQ("5f2b3d313536", std::string_view(buffer, end - buffer));
+}
+
+TEST(Hex, RoundTripAllSizes) {
+  std::string data;
+  for (int size = 0; size < 200; ++size) {
+    const auto encoded = ToHex(data);
+    ASSERT_EQ(LengthInHexForm(data), encoded.size());
+    ASSERT_EQ(data, FromHex(encoded)) << size;
+    data.push_back(static_cast<char>(size * 37));
+  }
+}
+
+TEST(Hex, FromHexLong) {
+  constexpr std::string_view data{
+      "32316533306339326166653534333936"
+      "32316533306339326166653534333936"};
+  EXPECT_EQ("21e30c92afe5439621e30c92afe54396", FromHex(data));
+
+  constexpr std::string_view upper{"0123456789ABCDEFabcdef0123456789"};
+  EXPECT_EQ(
+      "\x01\x23\x45\x67\x89\xab\xcd\xef"
+      "\xab\xcd\xef\x01\x23\x45\x67\x89",
+      FromHex(upper));
+
+  // An invalid character in the middle of a long input
+  std::string invalid{data};
+  invalid[21] = 'g';
+  std::string result;
+  EXPECT_EQ(20, FromHex(invalid, result));
+  EXPECT_EQ("21e30c92af", result);
+}
+
 TEST(Hex, FromHex) {
   // Test simple case - everything is correct
   {
@@ -1,6 +1,8 @@
 #include <benchmark/benchmark.h>
 
+#include <charconv>
 #include <cstdint>
+#include <cstdlib>
 #include <string>
 
 #include <userver/utils/from_string.hpp>
@@ -28,4 +30,55 @@ BENCHMARK_TEMPLATE(ConstFromString, std::uint32_t)->DenseRange(1, 10, 1);
 BENCHMARK_TEMPLATE(ConstFromString, std::uint16_t)->DenseRange(1, 5, 1);
 BENCHMARK_TEMPLATE(ConstFromString, double)->DenseRange(1, 10, 1);
 
+// Baseline for the integer parsing
+void ConstFromCharsUint64(benchmark::State& state) {
+  std::string str;
+  std::size_t len = state.range(0);
+
+  for (std::size_t i = 1; i < len + 1; ++i) {
+    str.push_back('0' + i % 10);
+  }
+
+  for ([[maybe_unused]] auto _ : state) {
+    for (std::size_t i = 0; i < 100; ++i) {
+      std::uint64_t result{};
+      benchmark::DoNotOptimize(
+          std::from_chars(str.data(), str.data() + str.size(), result));
+      benchmark::DoNotOptimize(result);
+    }
+  }
+}
+BENCHMARK(ConstFromCharsUint64)->DenseRange(1, 20, 1);
+
+const std::string kDoubles[] = {
+    "0.5",     "3.14159265358979", "-2.5e-3", "100",
+    "1e+100",  "12345.678",        "0.001",   "-42.125",
+    "6.02e23", "1.7976931348623157e308",
+};
+
+void DoublesFromString(benchmark::State& state) {
+  for ([[maybe_unused]] auto _ : state) {
+    for (const auto& str : kDoubles) {
+      benchmark::DoNotOptimize(
+          utils::FromString<double>(std::string_view{str}));
+    }
+  }
+}
+BENCHMARK(DoublesFromString);
+
+// Baseline: what utils::FromString did for a std::string_view before
+void DoublesStrtod(benchmark::State& state) {
+  for ([[maybe_unused]] auto _ : state) {
+    for (const auto& str : kDoubles) {
+      char buffer[32];
+      std::copy(str.data(), str.data() + str.size(), buffer);
+      buffer[str.size()] = '\0';
+      char* end = nullptr;
+      benchmark::DoNotOptimize(std::strtod(buffer, &end));
+      benchmark::DoNotOptimize(end);
+    }
+  }
+}
+BENCHMARK(DoublesStrtod);
+
 USERVER_NAMESPACE_END
@@ -232,6 +232,61 @@ TYPED_TEST(FromStringTest, ExceptionDetails) {
   ASSERT_NE(what.find(compiler::GetTypeName<T>()), std::string::npos);
 }
 
+TYPED_TEST(FromStringTest, LongNumbers) {
+  using T = TypeParam;
+
+  if constexpr (std::numeric_limits<T>::digits10 >= 8) {
+    TestConverts("12345678", T{12345678});
+    TestConverts("+12345678", T{12345678});
+    TestConverts("000000000000000012345678", T{12345678});
+
+    TestInvalid<T>("1234567a");
+    TestInvalid<T>("a2345678");
+    TestInvalid<T>("12345678a");
+    TestInvalid<T>("1234:678");
+    TestInvalid<T>("1234/678");
+    TestInvalid<T>("12345678 ");
+    TestInvalid<T>("+-12345678");
+
+    if constexpr (std::is_signed_v<T>) {
+      TestConverts("-12345678", T{-12345678});
+    }
+    if constexpr (std::is_unsigned_v<T>) {
+      TestInvalid<T>("-12345678");
+    }
+    if constexpr (!std::is_floating_point_v<T>) {
+      TestInvalid<T>("123456789.");
+    }
+  }
+
+  if constexpr (std::numeric_limits<T>::digits10 >= 18 &&
+                !std::is_floating_point_v<T>) {
+    TestConverts("123456789012345678", T{123456789012345678});
+    TestConverts("-0000000000000000", T{0});
+    TestInvalid<T>("1234567890123456x8");
+    TestInvalid<T>("123456781a3");
+    if constexpr (std::is_signed_v<T>) {
+      TestConverts("-123456789012345678", T{-123456789012345678});
+    }
+  }
+}
+
+TEST(FromString, FloatingPointFormats) {
+  TestConverts("3.14159", 3.14159);
+  TestConverts("+2.5e-3", 2.5e-3);
+  TestConverts("1E+2", 1e2);
+  TestConverts("-.5", -0.5);
+  TestConverts("INF", std::numeric_limits<double>::infinity());
+  TestConverts("-infinity", -std::numeric_limits<double>::infinity());
+  TestConverts("123456789012345678901234567890", 1.2345678901234568e29);
+
+  TestInvalid<double>("1e");
+  TestInvalid<double>("1e+");
+  TestInvalid<double>("+");
+  TestInvalid<double>("-");
+  TestInvalid<double>("e1");
+}
+
 TEST(FromString, StringViewToFloatingPointSmall) {
   char buffer[5];
   for (int i = 1; i <= 5; i++) {
@@ -4,6 +4,7 @@
 #include <emmintrin.h>
 #endif
 
+#include <algorithm>
 #include <array>
 #include <cstring>
 #include <limits>
@@ -101,6 +102,17 @@ struct CaseInsensitiveSSEFetcher final {
     return FailFastCompare(Load16(lhs), Load16(rhs));
   }
 
+  // Returns the index of the first byte that differs after lower-casing,
+  // or 16 if there is none.
+  static inline std::size_t Mismatch16(const std::uint8_t* lhs,
+                                       const std::uint8_t* rhs) noexcept {
+    const auto equal_mask = static_cast<unsigned>(_mm_movemask_epi8(
+        _mm_cmpeq_epi8(DoLowercaseBytes(Load16(lhs)),
+                       DoLowercaseBytes(Load16(rhs)))));
+    if (equal_mask == 0xffff) return 16;
+    return static_cast<std::size_t>(__builtin_ctz(~equal_mask));
+  }
+
  private:
   static inline __m128i Load8(const std::uint8_t* data) noexcept {
     // _mm_loadu_si64 is missing in gcc prior to version 9
@@ -215,6 +227,18 @@ struct CaseInsensitiveFetcher final {
     return Fetch16(lhs) == Fetch16(rhs);
   }
 
+  static inline std::size_t Mismatch16(const std::uint8_t* lhs,
+                                       const std::uint8_t* rhs) noexcept {
+    for (std::size_t i = 0; i < 16; ++i) {
+      if (ToLower(lhs[i]) != ToLower(rhs[i])) return i;
+    }
+    return 16;
+  }
+
+  static inline std::uint8_t ToLower(std::uint8_t c) noexcept {
+    return (c >= 'A' && c <= 'Z') ? (c | 32) : c;
+  }
+
  private:
   static inline void Lowercase(std::uint8_t* dst, const std::uint8_t* src,
                                std::size_t len) noexcept {
@@ -390,6 +414,33 @@ inline bool NoCaseEqual(std::string_view lhs, std::string_view rhs) noexcept {
   return lhs.empty() || CompareAndAdvance<Fetcher, 8>(lhs_suffix, rhs_suffix);
 }
 
+template <typename Fetcher>
+inline int NoCaseCompareThreeWay(std::string_view lhs,
+                                 std::string_view rhs) noexcept {
+  const auto* lhs_data = reinterpret_cast<const std::uint8_t*>(lhs.data());
+  const auto* rhs_data = reinterpret_cast<const std::uint8_t*>(rhs.data());
+  const auto min_len = std::min(lhs.size(), rhs.size());
+
+  std::size_t i = 0;
+  for (; i + 16 <= min_len; i += 16) {
+    const auto mismatch = Fetcher::Mismatch16(lhs_data + i, rhs_data + i);
+    if (mismatch != 16) {
+      i += mismatch;
+      return static_cast<int>(CaseInsensitiveFetcher::ToLower(lhs_data[i])) -
+             static_cast<int>(CaseInsensitiveFetcher::ToLower(rhs_data[i]));
+    }
+  }
+
+  for (; i < min_len; ++i) {
+    const auto a = CaseInsensitiveFetcher::ToLower(lhs_data[i]);
+    const auto b = CaseInsensitiveFetcher::ToLower(rhs_data[i]);
+    if (a != b) return static_cast<int>(a) - static_cast<int>(b);
+  }
+
+  if (lhs.size() != rhs.size()) return lhs.size() < rhs.size() ? -1 : 1;
+  return 0;
+}
+
 }  // namespace
 
 SipHasher::SipHasher(std::uint64_t k0, std::uint64_t k1) noexcept
@@ -436,6 +487,22 @@ bool CaseInsensitiveEqualNoSse::operator()(std::string_view lhs,
   return NoCaseEqual<CaseInsensitiveFetcher>(lhs, rhs);
 }
 
+int CaseInsensitiveCompareThreeWay::operator()(std::string_view lhs,
+                                               std::string_view rhs) const
+    noexcept {
+#ifdef __SSE2__
+  return NoCaseCompareThreeWay<CaseInsensitiveSSEFetcher>(lhs, rhs);
+#else
+  return CaseInsensitiveCompareThreeWayNoSse{}(lhs, rhs);
+#endif
+}
+
+int CaseInsensitiveCompareThreeWayNoSse::operator()(std::string_view lhs,
+                                                    std::string_view rhs) const
+    noexcept {
+  return NoCaseCompareThreeWay<CaseInsensitiveFetcher>(lhs, rhs);
+}
+
 }  // namespace utils::impl
 
 USERVER_NAMESPACE_END
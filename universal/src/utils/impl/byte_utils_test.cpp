@@ -4,6 +4,8 @@
 #include <cctype>
 #include <cstdint>
 #include <cstring>
+#include <string>
+#include <string_view>
 
 #include <utils/impl/byte_utils.hpp>
 
@@ -366,6 +368,45 @@ void TestCaseInsensitiveEqual() {
   }
 }
 
+int ReferenceCompareThreeWay(std::string_view lhs, std::string_view rhs) {
+  const auto lower = [](std::string_view s) {
+    std::string result{s};
+    for (auto& c : result) {
+      if (c >= 'A' && c <= 'Z') c = 'a' + (c - 'A');
+    }
+    return result;
+  };
+  const auto lhs_lower = lower(lhs);
+  const auto rhs_lower = lower(rhs);
+  // std::string::compare compares chars as unsigned via char_traits
+  return lhs_lower.compare(rhs_lower);
+}
+
+int Sign(int value) { return (value > 0) - (value < 0); }
+
+template <typename Cmp>
+void TestCaseInsensitiveCompareThreeWay() {
+  const Cmp cmp{};
+
+  for (std::size_t len = 0; len <= kAllPossibleBytesString.size(); ++len) {
+    const auto lhs = std::string_view{kAllPossibleBytesString}.substr(0, len);
+    ASSERT_EQ(cmp(lhs, lhs), 0);
+    ASSERT_EQ(Sign(cmp(lhs, kAllPossibleBytesString)),
+              len == kAllPossibleBytesString.size() ? 0 : -1);
+
+    auto rhs = std::string{lhs};
+    for (std::size_t diff_at = 0; diff_at < len; ++diff_at) {
+      for (const int delta : {1, 32, 255}) {
+        rhs[diff_at] = static_cast<char>(rhs[diff_at] + delta);
+        ASSERT_EQ(Sign(cmp(lhs, rhs)), Sign(ReferenceCompareThreeWay(lhs, rhs)))
+            << "len=" << len << " diff_at=" << diff_at << " delta=" << delta;
+        ASSERT_EQ(Sign(cmp(rhs, lhs)), Sign(ReferenceCompareThreeWay(rhs, lhs)));
+        rhs[diff_at] = lhs[diff_at];
+      }
+    }
+  }
+}
+
 }  // namespace
 
 TEST(SipHashCase, MatchesReferenceImplementation) {
@@ -390,4 +431,14 @@ TEST(CaseInsensitiveEqualNoSse, Correctness) {
   TestCaseInsensitiveEqual<utils::impl::CaseInsensitiveEqualNoSse>();
 }
 
+TEST(CaseInsensitiveCompareThreeWay, Correctness) {
+  TestCaseInsensitiveCompareThreeWay<
+      utils::impl::CaseInsensitiveCompareThreeWay>();
+}
+
+TEST(CaseInsensitiveCompareThreeWayNoSse, Correctness) {
+  TestCaseInsensitiveCompareThreeWay<
+      utils::impl::CaseInsensitiveCompareThreeWayNoSse>();
+}
+
 USERVER_NAMESPACE_END
@@ -0,0 +1,109 @@
+#include <benchmark/benchmark.h>
+
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include <userver/utils/impl/flat_hash_map.hpp>
+#include <userver/utils/impl/transparent_hash.hpp>
+#include <userver/utils/str_icase.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+template <typename Hash, typename Equal>
+using StdMap = std::unordered_map<std::string, int, Hash, Equal>;
+
+template <typename Hash, typename Equal>
+using FlatMap = utils::impl::FlatHashMap<std::string, int, Hash, Equal>;
+
+using CaseHash = utils::StrCaseHash;
+using CaseEqual = std::equal_to<>;
+using IcaseHash = utils::StrIcaseHash;
+using IcaseEqual = utils::StrIcaseEqual;
+
+std::vector<std::string> GenerateKeys(std::size_t count) {
+  std::vector<std::string> result;
+  result.reserve(count);
+  for (std::size_t i = 0; i < count; ++i) {
+    result.push_back("X-Request-Header-" + std::to_string(i * 7919));
+  }
+  return result;
+}
+
+template <typename Map>
+Map FillMap(const std::vector<std::string>& keys) {
+  Map map;
+  for (std::size_t i = 0; i < keys.size(); ++i) {
+    map[keys[i]] = static_cast<int>(i);
+  }
+  return map;
+}
+
+}  // namespace
+
+template <typename Map>
+void FlatHashMapFindHit(benchmark::State& state) {
+  const auto keys = GenerateKeys(state.range(0));
+  const auto map = FillMap<Map>(keys);
+
+  std::size_t i = 0;
+  for ([[maybe_unused]] auto _ : state) {
+    const auto& key = keys[i];
+    benchmark::DoNotOptimize(map.find(key));
+    if (++i == keys.size()) i = 0;
+  }
+}
+BENCHMARK_TEMPLATE(FlatHashMapFindHit, StdMap<CaseHash, CaseEqual>)
+    ->RangeMultiplier(4)
+    ->Range(4, 4096);
+BENCHMARK_TEMPLATE(FlatHashMapFindHit, FlatMap<CaseHash, CaseEqual>)
+    ->RangeMultiplier(4)
+    ->Range(4, 4096);
+BENCHMARK_TEMPLATE(FlatHashMapFindHit, StdMap<IcaseHash, IcaseEqual>)
+    ->RangeMultiplier(4)
+    ->Range(4, 4096);
+BENCHMARK_TEMPLATE(FlatHashMapFindHit, FlatMap<IcaseHash, IcaseEqual>)
+    ->RangeMultiplier(4)
+    ->Range(4, 4096);
+
+template <typename Map>
+void FlatHashMapFindMiss(benchmark::State& state) {
+  const auto keys = GenerateKeys(state.range(0));
+  const auto map = FillMap<Map>(keys);
+  auto missing = GenerateKeys(state.range(0) * 2);
+  missing.erase(missing.begin(), missing.begin() + state.range(0));
+
+  std::size_t i = 0;
+  for ([[maybe_unused]] auto _ : state) {
+    const auto& key = missing[i];
+    benchmark::DoNotOptimize(map.find(key));
+    if (++i == missing.size()) i = 0;
+  }
+}
+BENCHMARK_TEMPLATE(FlatHashMapFindMiss, StdMap<CaseHash, CaseEqual>)
+    ->RangeMultiplier(4)
+    ->Range(4, 4096);
+BENCHMARK_TEMPLATE(FlatHashMapFindMiss, FlatMap<CaseHash, CaseEqual>)
+    ->RangeMultiplier(4)
+    ->Range(4, 4096);
+
+// Models the request arguments map: filled and destroyed on each request
+template <typename Map>
+void FlatHashMapFillSmall(benchmark::State& state) {
+  const auto keys = GenerateKeys(state.range(0));
+  const CaseHash hash;
+
+  for ([[maybe_unused]] auto _ : state) {
+    Map map{0, hash};
+    for (const auto& key : keys) map[key] = 1;
+    benchmark::DoNotOptimize(map);
+  }
+}
+BENCHMARK_TEMPLATE(FlatHashMapFillSmall, StdMap<CaseHash, CaseEqual>)
+    ->DenseRange(1, 8, 1);
+BENCHMARK_TEMPLATE(FlatHashMapFillSmall, FlatMap<CaseHash, CaseEqual>)
+    ->DenseRange(1, 8, 1);
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,232 @@
+#include <userver/utils/impl/flat_hash_map.hpp>
+
+#include <map>
+#include <memory>
+#include <random>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+
+#include <gtest/gtest.h>
+
+#include <userver/utils/impl/transparent_hash.hpp>
+#include <userver/utils/str_icase.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+using utils::impl::FlatHashMap;
+using utils::impl::FlatHashSet;
+
+using StringMap =
+    FlatHashMap<std::string, int, utils::impl::TransparentHash<std::string>,
+                std::equal_to<>>;
+
+// All the keys collide, checks probing over several groups
+struct BadHash final {
+  std::size_t operator()(int) const noexcept { return 42; }
+};
+
+}  // namespace
+
+TEST(FlatHashMap, Basic) {
+  FlatHashMap<std::string, int> map;
+  EXPECT_TRUE(map.empty());
+  EXPECT_EQ(map.begin(), map.end());
+  EXPECT_EQ(map.find("foo"), map.end());
+  EXPECT_EQ(map.erase("foo"), 0);
+
+  EXPECT_TRUE(map.emplace("foo", 1).second);
+  EXPECT_FALSE(map.emplace("foo", 2).second);
+  map["bar"] = 3;
+  ++map["bar"];
+
+  EXPECT_EQ(map.size(), 2);
+  EXPECT_EQ(map.at("foo"), 1);
+  EXPECT_EQ(map.at("bar"), 4);
+  EXPECT_THROW(map.at("baz"), std::out_of_range);
+  EXPECT_TRUE(map.contains("foo"));
+  EXPECT_EQ(map.count("baz"), 0);
+
+  EXPECT_EQ(map.erase("foo"), 1);
+  EXPECT_FALSE(map.contains("foo"));
+  EXPECT_EQ(map.size(), 1);
+
+  map.clear();
+  EXPECT_TRUE(map.empty());
+  EXPECT_EQ(map.begin(), map.end());
+  EXPECT_FALSE(map.contains("bar"));
+}
+
+TEST(FlatHashMap, Transparent) {
+  StringMap map{{"foo", 1}, {"bar", 2}};
+
+  EXPECT_EQ(map.find(std::string_view{"foo"})->second, 1);
+  EXPECT_EQ(map.find("bar")->second, 2);
+  EXPECT_TRUE(map.contains(std::string_view{"bar"}));
+  EXPECT_EQ(map.erase(std::string_view{"bar"}), 1);
+  EXPECT_FALSE(map.contains("bar"));
+
+  EXPECT_TRUE(map.try_emplace(std::string_view{"baz"}, 3).second);
+  EXPECT_EQ(map.at(std::string_view{"baz"}), 3);
+}
+
+TEST(FlatHashMap, StrCaseHash) {
+  FlatHashMap<std::string, int, utils::StrCaseHash, std::equal_to<>> map;
+  map[std::string{"Foo"}] = 1;
+  EXPECT_EQ(map.find(std::string_view{"Foo"})->second, 1);
+  EXPECT_EQ(map.find(std::string_view{"foo"}), map.end());
+
+  // Shares the seed of the first map
+  decltype(map) other{0, map.hash_function()};
+  EXPECT_EQ(other.hash_function()("key"), map.hash_function()("key"));
+}
+
+TEST(FlatHashMap, StrIcaseHash) {
+  FlatHashMap<std::string, int, utils::StrIcaseHash, utils::StrIcaseEqual>
+      map;
+  map["Content-Type"] = 1;
+  EXPECT_EQ(map["content-type"], 1);
+  EXPECT_EQ(map.size(), 1);
+  EXPECT_TRUE(map.contains("CONTENT-TYPE"));
+}
+
+TEST(FlatHashMap, InsertOrAssign) {
+  FlatHashMap<std::string, std::string> map;
+  EXPECT_TRUE(map.insert_or_assign("a", "1").second);
+  EXPECT_FALSE(map.insert_or_assign("a", "2").second);
+  EXPECT_EQ(map.at("a"), "2");
+
+  EXPECT_TRUE(map.insert({"b", "3"}).second);
+  EXPECT_FALSE(map.insert({"b", "4"}).second);
+  EXPECT_EQ(map.at("b"), "3");
+}
+
+TEST(FlatHashMap, MoveOnlyValues) {
+  FlatHashMap<int, std::unique_ptr<int>> map;
+  for (int i = 0; i < 100; ++i) map.emplace(i, std::make_unique<int>(i));
+
+  auto moved = std::move(map);
+  EXPECT_TRUE(map.empty());  // NOLINT(bugprone-use-after-move)
+  ASSERT_EQ(moved.size(), 100);
+  for (int i = 0; i < 100; ++i) EXPECT_EQ(*moved.at(i), i);
+}
+
+TEST(FlatHashMap, Copy) {
+  FlatHashMap<std::string, std::string> map;
+  for (int i = 0; i < 50; ++i) map[std::to_string(i)] = std::to_string(i * 2);
+
+  auto copy = map;
+  EXPECT_EQ(copy.size(), map.size());
+  for (const auto& [key, value] : map) EXPECT_EQ(copy.at(key), value);
+
+  copy = FlatHashMap<std::string, std::string>{};
+  EXPECT_TRUE(copy.empty());
+  copy = map;
+  EXPECT_EQ(copy.size(), 50);
+}
+
+TEST(FlatHashMap, Collisions) {
+  FlatHashMap<int, int, BadHash> map;
+  for (int i = 0; i < 100; ++i) map[i] = i;
+  for (int i = 0; i < 100; i += 2) EXPECT_EQ(map.erase(i), 1);
+
+  EXPECT_EQ(map.size(), 50);
+  for (int i = 0; i < 100; ++i) {
+    EXPECT_EQ(map.contains(i), i % 2 == 1) << i;
+  }
+  for (int i = 0; i < 100; i += 2) map[i] = i;
+  EXPECT_EQ(map.size(), 100);
+  for (int i = 0; i < 100; ++i) EXPECT_EQ(map.at(i), i);
+}
+
+TEST(FlatHashMap, EraseWhileIterating) {
+  FlatHashMap<int, int> map;
+  for (int i = 0; i < 1000; ++i) map[i] = i;
+
+  for (auto it = map.begin(); it != map.end();) {
+    if (it->first % 3 == 0) {
+      it = map.erase(it);
+    } else {
+      ++it;
+    }
+  }
+
+  EXPECT_EQ(map.size(), 666);
+  std::size_t count = 0;
+  for (const auto& [key, value] : map) {
+    EXPECT_NE(key % 3, 0);
+    EXPECT_EQ(key, value);
+    ++count;
+  }
+  EXPECT_EQ(count, map.size());
+}
+
+TEST(FlatHashMap, Reserve) {
+  FlatHashMap<int, int> map;
+  map.reserve(100);
+  const auto capacity = map.capacity();
+  EXPECT_GE(capacity, 100);
+
+  for (int i = 0; i < 100; ++i) map[i] = i;
+  EXPECT_EQ(map.capacity(), capacity);
+
+  map.clear();
+  EXPECT_EQ(map.capacity(), capacity);
+}
+
+TEST(FlatHashMap, RandomizedAgainstStd) {
+  FlatHashMap<std::uint32_t, std::uint32_t> map;
+  std::unordered_map<std::uint32_t, std::uint32_t> expected;
+
+  std::minstd_rand rng{42};
+  for (int i = 0; i < 100'000; ++i) {
+    const std::uint32_t key = rng() % 2000;
+    switch (rng() % 4) {
+      case 0:
+      case 1:
+        map[key] = i;
+        expected[key] = i;
+        break;
+      case 2:
+        EXPECT_EQ(map.erase(key), expected.erase(key));
+        break;
+      case 3: {
+        const auto it = map.find(key);
+        const auto expected_it = expected.find(key);
+        ASSERT_EQ(it == map.end(), expected_it == expected.end());
+        if (it != map.end()) {
+          EXPECT_EQ(it->second, expected_it->second);
+        }
+        break;
+      }
+    }
+    ASSERT_EQ(map.size(), expected.size());
+  }
+
+  const std::map<std::uint32_t, std::uint32_t> sorted(map.begin(), map.end());
+  const std::map<std::uint32_t, std::uint32_t> expected_sorted(
+      expected.begin(), expected.end());
+  EXPECT_EQ(sorted, expected_sorted);
+}
+
+TEST(FlatHashSet, Basic) {
+  FlatHashSet<std::string, utils::impl::TransparentHash<std::string>,
+              std::equal_to<>>
+      set{"foo", "bar"};
+
+  EXPECT_EQ(set.size(), 2);
+  EXPECT_TRUE(set.contains("foo"));
+  EXPECT_TRUE(set.contains(std::string_view{"bar"}));
+  EXPECT_FALSE(set.insert("foo").second);
+  EXPECT_TRUE(set.emplace(3, 'x').second);
+  EXPECT_TRUE(set.contains("xxx"));
+
+  static_assert(std::is_same_v<decltype(*set.begin()), const std::string&>);
+
+  EXPECT_EQ(set.erase("foo"), 1);
+  EXPECT_EQ(set.size(), 2);
+}
+
+USERVER_NAMESPACE_END
@@ -1,47 +1,207 @@
 #include <userver/utils/regex.hpp>
 
+#include <algorithm>
 #include <iterator>
+#include <optional>
+#include <stdexcept>
 
 #include <boost/regex.hpp>
+#ifdef USERVER_IMPL_FEATURE_RE2
+#include <re2/re2.h>
+#include <re2/set.h>
+#endif
 
 USERVER_NAMESPACE_BEGIN
 
 namespace utils {
 
+namespace {
+
+#ifdef USERVER_IMPL_FEATURE_RE2
+re2::RE2::Options MakeRe2Options() {
+  re2::RE2::Options options;
+  // Errors are reported via exceptions
+  options.set_log_errors(false);
+  return options;
+}
+
+std::shared_ptr<const re2::RE2> MakeRe2(std::string_view pattern) {
+  auto re2 = std::make_shared<const re2::RE2>(
+      re2::StringPiece{pattern.data(), pattern.size()}, MakeRe2Options());
+  if (!re2->ok()) {
+    throw std::runtime_error("Invalid regular expression '" +
+                             std::string{pattern} + "': " + re2->error());
+  }
+  return re2;
+}
+
+// Converts the Perl format of boost::regex_replace to the RE2 rewrite string
+std::string MakeRe2Rewrite(std::string_view repl) {
+  std::string rewrite;
+  rewrite.reserve(repl.size());
+
+  const auto append_group = [&rewrite](std::size_t group) {
+    if (group > 9) {
+      throw std::runtime_error(
+          "RE2 supports references only to the first 9 subexpressions");
+    }
+    rewrite += '\\';
+    rewrite += static_cast<char>('0' + group);
+  };
+
+  for (std::size_t i = 0; i < repl.size(); ++i) {
+    const char c = repl[i];
+    if (c == '\\') {
+      rewrite += "\\\\";
+      continue;
+    }
+    if (c != '$' || i + 1 == repl.size()) {
+      rewrite += c;
+      continue;
+    }
+
+    const char next = repl[i + 1];
+    if (next == '$') {
+      rewrite += '$';
+      ++i;
+    } else if (next == '&') {
+      append_group(0);
+      ++i;
+    } else if (next >= '0' && next <= '9') {
+      std::size_t group = 0;
+      for (++i; i < repl.size() && repl[i] >= '0' && repl[i] <= '9'; ++i) {
+        group = group * 10 + (repl[i] - '0');
+      }
+      --i;
+      append_group(group);
+    } else if (next == '{') {
+      const auto end = repl.find('}', i + 2);
+      if (end == std::string_view::npos) {
+        rewrite += c;
+        continue;
+      }
+      std::size_t group = 0;
+      for (std::size_t j = i + 2; j < end; ++j) {
+        if (repl[j] < '0' || repl[j] > '9') {
+          throw std::runtime_error("RE2 supports only numbered references");
+        }
+        group = group * 10 + (repl[j] - '0');
+      }
+      append_group(group);
+      i = end;
+    } else {
+      rewrite += c;
+    }
+  }
+  return rewrite;
+}
+#endif
+
+#ifndef USERVER_IMPL_FEATURE_RE2
+[[noreturn]] void ThrowRe2NotAvailable() {
+  throw std::runtime_error(
+      "RE2 regular expressions are not available, build userver with "
+      "USERVER_FEATURE_RE2");
+}
+#endif
+
+}  // namespace
+
+bool IsRe2Available() noexcept {
+#ifdef USERVER_IMPL_FEATURE_RE2
+  return true;
+#else
+  return false;
+#endif
+}
+
+RegexEngine GetDefaultRegexEngine() noexcept {
+#ifdef USERVER_IMPL_RE2_BY_DEFAULT
+  return RegexEngine::kRe2;
+#else
+  return RegexEngine::kBoost;
+#endif
+}
+
 struct regex::Impl {
   boost::regex r;
-
-  Impl() = default;
-  explicit Impl(std::string_view pattern) : r(pattern.begin(), pattern.end()) {}
+#ifdef USERVER_IMPL_FEATURE_RE2
+  // Set only for RegexEngine::kRe2, matching a const RE2 is thread-safe
+  std::shared_ptr<const re2::RE2> re2;
+#endif
 };
 
 regex::regex() = default;
 
-regex::regex(std::string_view pattern) : impl_(regex::Impl(pattern)) {}
+regex::regex(std::string_view pattern)
+    : regex(pattern, GetDefaultRegexEngine()) {}
+
+regex::regex(std::string_view pattern, RegexEngine engine) {
+  switch (engine) {
+    case RegexEngine::kBoost:
+      impl_->r.assign(pattern.begin(), pattern.end());
+      return;
+    case RegexEngine::kRe2:
+#ifdef USERVER_IMPL_FEATURE_RE2
+      impl_->re2 = MakeRe2(pattern);
+      return;
+#else
+      ThrowRe2NotAvailable();
+#endif
+  }
+}
 
 regex::~regex() = default;
 
 regex::regex(const regex&) = default;
 
-regex::regex(regex&& r) noexcept { impl_->r.swap(r.impl_->r); }
+regex::regex(regex&& r) noexcept {
+  impl_->r.swap(r.impl_->r);
+#ifdef USERVER_IMPL_FEATURE_RE2
+  impl_->re2.swap(r.impl_->re2);
+#endif
+}
 
 regex& regex::operator=(const regex&) = default;
 
 regex& regex::operator=(regex&& r) noexcept {
   impl_->r.swap(r.impl_->r);
+#ifdef USERVER_IMPL_FEATURE_RE2
+  impl_->re2.swap(r.impl_->re2);
+#endif
   return *this;
 }
 
 bool regex::operator==(const regex& other) const {
+#ifdef USERVER_IMPL_FEATURE_RE2
+  if (impl_->re2 || other.impl_->re2) {
+    return impl_->re2 && other.impl_->re2 &&
+           impl_->re2->pattern() == other.impl_->re2->pattern();
+  }
+#endif
   return impl_->r == other.impl_->r;
 }
 
-std::string regex::str() const { return impl_->r.str(); }
+std::string regex::str() const {
+#ifdef USERVER_IMPL_FEATURE_RE2
+  if (impl_->re2) return impl_->re2->pattern();
+#endif
+  return impl_->r.str();
+}
+
+RegexEngine regex::engine() const {
+#ifdef USERVER_IMPL_FEATURE_RE2
+  if (impl_->re2) return RegexEngine::kRe2;
+#endif
+  return RegexEngine::kBoost;
+}
 
 ////////////////////////////////////////////////////////////////
 
 struct smatch::Impl {
   boost::smatch m;
+  // Subexpressions of the last RE2 match, empty after a boost match
+  std::vector<std::string> re2_groups;
 
   Impl() = default;
 };
@@ -54,30 +214,99 @@ smatch::smatch(const smatch&) = default;
 
 smatch& smatch::operator=(const smatch&) = default;
 
-std::size_t smatch::size() const { return impl_->m.size(); }
+std::size_t smatch::size() const {
+  if (!impl_->re2_groups.empty()) return impl_->re2_groups.size();
+  return impl_->m.size();
+}
 
-std::string smatch::operator[](int sub) const { return impl_->m[sub].str(); }
+std::string smatch::operator[](int sub) const {
+  if (!impl_->re2_groups.empty()) return impl_->re2_groups.at(sub);
+  return impl_->m[sub].str();
+}
 
 ////////////////////////////////////////////////////////////////
 
+#ifdef USERVER_IMPL_FEATURE_RE2
+namespace {
+
+bool Re2Match(std::string_view str, boost::smatch& boost_groups,
+              std::vector<std::string>& re2_groups, const re2::RE2& pattern,
+              re2::RE2::Anchor anchor) {
+  const int groups_count = pattern.NumberOfCapturingGroups() + 1;
+  std::vector<re2::StringPiece> groups(groups_count);
+  const bool matched =
+      pattern.Match({str.data(), str.size()}, 0, str.size(), anchor,
+                    groups.data(), groups_count);
+
+  boost_groups = boost::smatch{};
+  re2_groups.clear();
+  if (!matched) {
+    // Same as boost, the whole match is empty
+    re2_groups.emplace_back();
+    return false;
+  }
+
+  re2_groups.reserve(groups.size());
+  for (const auto& group : groups) {
+    re2_groups.emplace_back(group.data(), group.size());
+  }
+  return true;
+}
+
+}  // namespace
+#endif
+
 bool regex_match(std::string_view str, const regex& pattern) {
+#ifdef USERVER_IMPL_FEATURE_RE2
+  if (pattern.impl_->re2) {
+    return re2::RE2::FullMatch({str.data(), str.size()}, *pattern.impl_->re2);
+  }
+#endif
   return boost::regex_match(str.begin(), str.end(), pattern.impl_->r);
 }
 
 bool regex_match(const std::string& str, smatch& m, const regex& pattern) {
+#ifdef USERVER_IMPL_FEATURE_RE2
+  if (pattern.impl_->re2) {
+    return Re2Match(str, m.impl_->m, m.impl_->re2_groups, *pattern.impl_->re2,
+                    re2::RE2::ANCHOR_BOTH);
+  }
+#endif
+  m.impl_->re2_groups.clear();
   return boost::regex_match(str, m.impl_->m, pattern.impl_->r);
 }
 
 bool regex_search(std::string_view str, const regex& pattern) {
+#ifdef USERVER_IMPL_FEATURE_RE2
+  if (pattern.impl_->re2) {
+    return re2::RE2::PartialMatch({str.data(), str.size()},
+                                  *pattern.impl_->re2);
+  }
+#endif
   return boost::regex_search(str.begin(), str.end(), pattern.impl_->r);
 }
 
 bool regex_search(const std::string& str, smatch& m, const regex& pattern) {
+#ifdef USERVER_IMPL_FEATURE_RE2
+  if (pattern.impl_->re2) {
+    return Re2Match(str, m.impl_->m, m.impl_->re2_groups, *pattern.impl_->re2,
+                    re2::RE2::UNANCHORED);
+  }
+#endif
+  m.impl_->re2_groups.clear();
   return boost::regex_search(str, m.impl_->m, pattern.impl_->r);
 }
 
 std::string regex_replace(std::string_view str, const regex& pattern,
                           std::string_view repl) {
+#ifdef USERVER_IMPL_FEATURE_RE2
+  if (pattern.impl_->re2) {
+    std::string res{str};
+    re2::RE2::GlobalReplace(&res, *pattern.impl_->re2, MakeRe2Rewrite(repl));
+    return res;
+  }
+#endif
+
   std::string res;
   res.reserve(str.size() + str.size() / 4);
 
@@ -87,6 +316,96 @@ std::string regex_replace(std::string_view str, const regex& pattern,
   return res;
 }
 
+////////////////////////////////////////////////////////////////
+
+struct RegexSet::Impl {
+#ifdef USERVER_IMPL_FEATURE_RE2
+  std::optional<re2::RE2::Set> re2;
+#endif
+  // Used only for RegexEngine::kBoost
+  std::vector<regex> patterns;
+  Anchor anchor;
+};
+
+RegexSet::RegexSet(const std::vector<std::string>& patterns, Anchor anchor,
+                   RegexEngine engine)
+    : impl_(std::make_unique<Impl>()) {
+  impl_->anchor = anchor;
+
+  switch (engine) {
+    case RegexEngine::kBoost:
+      impl_->patterns.reserve(patterns.size());
+      for (const auto& pattern : patterns) {
+        impl_->patterns.emplace_back(pattern, RegexEngine::kBoost);
+      }
+      return;
+    case RegexEngine::kRe2:
+#ifdef USERVER_IMPL_FEATURE_RE2
+    {
+      auto& set = impl_->re2.emplace(MakeRe2Options(),
+                                     anchor == Anchor::kBoth
+                                         ? re2::RE2::ANCHOR_BOTH
+                                         : re2::RE2::UNANCHORED);
+      for (const auto& pattern : patterns) {
+        std::string error;
+        if (set.Add(pattern, &error) < 0) {
+          throw std::runtime_error("Invalid regular expression '" + pattern +
+                                   "': " + error);
+        }
+      }
+      if (!set.Compile()) {
+        throw std::runtime_error("Failed to compile the regular expressions");
+      }
+      return;
+    }
+#else
+      ThrowRe2NotAvailable();
+#endif
+  }
+}
+
+RegexSet::RegexSet(RegexSet&&) noexcept = default;
+
+RegexSet& RegexSet::operator=(RegexSet&&) noexcept = default;
+
+RegexSet::~RegexSet() = default;
+
+std::vector<std::size_t> RegexSet::Match(std::string_view str) const {
+  std::vector<std::size_t> result;
+
+#ifdef USERVER_IMPL_FEATURE_RE2
+  if (impl_->re2) {
+    std::vector<int> matched;
+    impl_->re2->Match({str.data(), str.size()}, &matched);
+    result.assign(matched.begin(), matched.end());
+    std::sort(result.begin(), result.end());
+    return result;
+  }
+#endif
+
+  for (std::size_t i = 0; i < impl_->patterns.size(); ++i) {
+    const bool matched = impl_->anchor == Anchor::kBoth
+                             ? regex_match(str, impl_->patterns[i])
+                             : regex_search(str, impl_->patterns[i]);
+    if (matched) result.push_back(i);
+  }
+  return result;
+}
+
+bool RegexSet::MatchAny(std::string_view str) const {
+#ifdef USERVER_IMPL_FEATURE_RE2
+  if (impl_->re2) {
+    return impl_->re2->Match({str.data(), str.size()}, nullptr);
+  }
+#endif
+
+  const auto matches = [this, str](const regex& pattern) {
+    return impl_->anchor == Anchor::kBoth ? regex_match(str, pattern)
+                                          : regex_search(str, pattern);
+  };
+  return std::any_of(impl_->patterns.begin(), impl_->patterns.end(), matches);
+}
+
 }  // namespace utils
 
 USERVER_NAMESPACE_END
@@ -0,0 +1,70 @@
+#include <benchmark/benchmark.h>
+
+#include <string>
+#include <vector>
+
+#include <userver/utils/regex.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+const std::vector<std::string> kPatterns{
+    R"(/v1/users/[0-9]+)",
+    R"(/v1/users/[0-9]+/orders)",
+    R"(/v1/orders/[a-f0-9]{32})",
+    R"(/v2/.*/search)",
+    R"(/internal/.+)",
+    R"(/ping)",
+};
+
+const std::string kPath = "/v1/orders/0123456789abcdef0123456789abcdef";
+
+utils::RegexEngine GetEngine(const benchmark::State& state) {
+  return static_cast<utils::RegexEngine>(state.range(0));
+}
+
+bool SkipUnavailable(benchmark::State& state) {
+  if (GetEngine(state) == utils::RegexEngine::kRe2 &&
+      !utils::IsRe2Available()) {
+    state.SkipWithError("built without RE2");
+    return true;
+  }
+  return false;
+}
+
+}  // namespace
+
+void regex_match_each(benchmark::State& state) {
+  if (SkipUnavailable(state)) return;
+
+  std::vector<utils::regex> patterns;
+  for (const auto& pattern : kPatterns) {
+    patterns.emplace_back(pattern, GetEngine(state));
+  }
+
+  for ([[maybe_unused]] auto _ : state) {
+    for (const auto& pattern : patterns) {
+      benchmark::DoNotOptimize(utils::regex_match(kPath, pattern));
+    }
+  }
+}
+BENCHMARK(regex_match_each)
+    ->Arg(static_cast<int>(utils::RegexEngine::kBoost))
+    ->Arg(static_cast<int>(utils::RegexEngine::kRe2));
+
+void regex_set_match(benchmark::State& state) {
+  if (SkipUnavailable(state)) return;
+
+  const utils::RegexSet set(kPatterns, utils::RegexSet::Anchor::kBoth,
+                            GetEngine(state));
+
+  for ([[maybe_unused]] auto _ : state) {
+    benchmark::DoNotOptimize(set.Match(kPath));
+  }
+}
+BENCHMARK(regex_set_match)
+    ->Arg(static_cast<int>(utils::RegexEngine::kBoost))
+    ->Arg(static_cast<int>(utils::RegexEngine::kRe2));
+
+USERVER_NAMESPACE_END
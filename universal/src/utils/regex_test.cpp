@@ -1,5 +1,8 @@
 #include <gtest/gtest.h>
 
+#include <stdexcept>
+#include <vector>
+
 #include <userver/utils/regex.hpp>
 
 USERVER_NAMESPACE_BEGIN
@@ -76,4 +79,62 @@ TEST(Regex, MatchWithResult) {
   EXPECT_EQ(res, str);
 }
 
+TEST(Regex, Re2) {
+  if (!utils::IsRe2Available()) {
+    EXPECT_THROW(utils::regex("a", utils::RegexEngine::kRe2),
+                 std::runtime_error);
+    return;
+  }
+
+  utils::regex r("^([a-z])([0-9]+)", utils::RegexEngine::kRe2);
+  EXPECT_EQ(r.engine(), utils::RegexEngine::kRe2);
+  EXPECT_EQ(r.str(), "^([a-z])([0-9]+)");
+  EXPECT_TRUE(utils::regex_match("a123", r));
+  EXPECT_FALSE(utils::regex_match("a123a", r));
+  EXPECT_TRUE(utils::regex_search("a123a", r));
+  EXPECT_FALSE(utils::regex_search("123", r));
+
+  utils::smatch m;
+  const std::string str{"b42x"};
+  EXPECT_TRUE(utils::regex_search(str, m, r));
+  ASSERT_EQ(m.size(), 3);
+  EXPECT_EQ(m[0], "b42");
+  EXPECT_EQ(m[1], "b");
+  EXPECT_EQ(m[2], "42");
+
+  EXPECT_THROW(utils::regex("(a", utils::RegexEngine::kRe2),
+               std::runtime_error);
+}
+
+TEST(Regex, ReplaceFormatIsTheSameForEngines) {
+  std::vector<utils::RegexEngine> engines{utils::RegexEngine::kBoost};
+  if (utils::IsRe2Available()) engines.push_back(utils::RegexEngine::kRe2);
+
+  for (const auto engine : engines) {
+    utils::regex r("([a-z])([a-z])", engine);
+    EXPECT_EQ(utils::regex_replace("ab0ef1", r, "$2${1}"), "ba0fe1");
+    EXPECT_EQ(utils::regex_replace("ab0", r, "[$&]$$"), "[ab]$0");
+  }
+}
+
+TEST(RegexSet, Match) {
+  std::vector<utils::RegexEngine> engines{utils::RegexEngine::kBoost};
+  if (utils::IsRe2Available()) engines.push_back(utils::RegexEngine::kRe2);
+
+  for (const auto engine : engines) {
+    const utils::RegexSet whole({"a+", "b", "[a-z]+", "x"},
+                                utils::RegexSet::Anchor::kBoth, engine);
+    EXPECT_EQ(whole.Match("aaa"), (std::vector<std::size_t>{0, 2}));
+    EXPECT_EQ(whole.Match("aaa1"), std::vector<std::size_t>{});
+    EXPECT_TRUE(whole.MatchAny("b"));
+    EXPECT_FALSE(whole.MatchAny("1"));
+
+    const utils::RegexSet anywhere({"a+", "b", "[0-9]"},
+                                   utils::RegexSet::Anchor::kNone, engine);
+    EXPECT_EQ(anywhere.Match("xxab1"), (std::vector<std::size_t>{0, 1, 2}));
+    EXPECT_EQ(anywhere.Match("xxa"), std::vector<std::size_t>{0});
+    EXPECT_FALSE(anywhere.MatchAny("zz"));
+  }
+}
+
 USERVER_NAMESPACE_END
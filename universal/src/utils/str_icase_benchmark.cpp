@@ -124,4 +124,20 @@ BENCHMARK_TEMPLATE(CaseInsensitiveCompareDifferentStrings, 15)
 BENCHMARK_TEMPLATE(CaseInsensitiveCompareDifferentStrings, 7)
     ->DenseRange(1, 7, 1);
 
+void CaseInsensitiveCompareThreeWay(benchmark::State& state) {
+  const auto first = GenerateRandomString(state.range(0));
+  auto second = first;
+  second.back() ^= 1;
+
+  const auto cmp = utils::StrIcaseCompareThreeWay{};
+
+  for ([[maybe_unused]] auto _ : state) {
+    for (std::size_t i = 0; i < 20; ++i) {
+      benchmark::DoNotOptimize(cmp(first, second));
+    }
+  }
+}
+
+BENCHMARK(CaseInsensitiveCompareThreeWay)->RangeMultiplier(2)->Range(4, 128);
+
 USERVER_NAMESPACE_END
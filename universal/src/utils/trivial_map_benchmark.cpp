@@ -131,6 +131,347 @@ const auto kHugeUnorderedMapping = std::unordered_map<std::string_view, int>{
     {"aaaaaaaaaaaaaaaa_x9", 42},
 };
 
+// Proto-like enum names with a common prefix and many equal lengths, for such
+// mappings utils::TrivialBiMap uses a perfect hash.
+constexpr auto kLargeBuilder = [](auto selector) {
+  return selector()
+      .Case("ERROR_REASON_FIELD_USER", 0)
+      .Case("ERROR_REASON_MODEL_CANCELLED", 1)
+      .Case("ERROR_REASON_PAYLOAD_CHECKSUM", 2)
+      .Case("ERROR_REASON_RESOURCE_CREDIT", 3)
+      .Case("ERROR_REASON_INDEX_POLICY", 4)
+      .Case("ERROR_REASON_LIMIT_MISSING", 5)
+      .Case("ERROR_REASON_CANCELLED_COUNTRY", 6)
+      .Case("ERROR_REASON_ABORTED_UNKNOWN", 7)
+      .Case("ERROR_REASON_CANCELLED_DEVICE", 8)
+      .Case("ERROR_REASON_ORIGIN_IP", 9)
+      .Case("ERROR_REASON_CONTRACT_PROVIDER", 10)
+      .Case("ERROR_REASON_BUDGET_TAX", 11)
+      .Case("ERROR_REASON_HEADER_THROTTLED", 12)
+      .Case("ERROR_REASON_CREDIT_THROTTLED", 13)
+      .Case("ERROR_REASON_ORDER_FIELD", 14)
+      .Case("ERROR_REASON_BALANCE_CHECKSUM", 15)
+      .Case("ERROR_REASON_TARGET_TENANT", 16)
+      .Case("ERROR_REASON_CHECKSUM_SUBSCRIPTION", 17)
+      .Case("ERROR_REASON_NETWORK_DATA", 18)
+      .Case("ERROR_REASON_CONNECTION_API", 19)
+      .Case("ERROR_REASON_CERT_OUTDATED", 20)
+      .Case("ERROR_REASON_CARD_IMPORT", 21)
+      .Case("ERROR_REASON_MISSING_REDIRECT", 22)
+      .Case("ERROR_REASON_OWNER_CERT", 23)
+      .Case("ERROR_REASON_SESSION_URL", 24)
+      .Case("ERROR_REASON_DISABLED_HOST", 25)
+      .Case("ERROR_REASON_VALUE_LOGIN", 26)
+      .Case("ERROR_REASON_INPUT_PARTNER", 27)
+      .Case("ERROR_REASON_PAYMENT_BAD", 28)
+      .Case("ERROR_REASON_ABORTED_ROLE", 29)
+      .Case("ERROR_REASON_PENDING_TIMEOUT", 30)
+      .Case("ERROR_REASON_INDEX_CONTRACT", 31)
+      .Case("ERROR_REASON_ALREADY_EMPTY", 32)
+      .Case("ERROR_REASON_DEBIT_STATE", 33)
+      .Case("ERROR_REASON_IP_CARD", 34)
+      .Case("ERROR_REASON_ALREADY_ACTIVE", 35)
+      .Case("ERROR_REASON_EXPIRED_INVALID", 36)
+      .Case("ERROR_REASON_EXPORT_INTERNAL", 37)
+      .Case("ERROR_REASON_STATE_SECRET", 38)
+      .Case("ERROR_REASON_CLOSED_MISSING", 39)
+      .Case("ERROR_REASON_USER_REGION", 40)
+      .Case("ERROR_REASON_ORDER_API", 41)
+      .Case("ERROR_REASON_CONFIG_STALE", 42)
+      .Case("ERROR_REASON_PAYMENT_REQUEST", 43)
+      .Case("ERROR_REASON_INPUT_ACCESS", 44)
+      .Case("ERROR_REASON_OUTDATED_CACHE", 45)
+      .Case("ERROR_REASON_RETRY_HEADER", 46)
+      .Case("ERROR_REASON_PAYMENT_PENDING", 47)
+      .Case("ERROR_REASON_SESSION_CACHE", 48)
+      .Case("ERROR_REASON_TRANSFER_DISABLED", 49)
+      .Case("ERROR_REASON_PENDING_CANCELLED", 50)
+      .Case("ERROR_REASON_HOST_ROLE", 51)
+      .Case("ERROR_REASON_SCOPE_PRECONDITION", 52)
+      .Case("ERROR_REASON_FORBIDDEN_ACTIVE", 53)
+      .Case("ERROR_REASON_OUTDATED_DECLINED", 54)
+      .Case("ERROR_REASON_SUBSCRIPTION_SOURCE", 55)
+      .Case("ERROR_REASON_AMOUNT_BUDGET", 56)
+      .Case("ERROR_REASON_AMOUNT_SUSPENDED", 57)
+      .Case("ERROR_REASON_FORBIDDEN_CURRENCY", 58)
+      .Case("ERROR_REASON_TOO_LARGE_UNSUPPORTED", 59)
+      .Case("ERROR_REASON_MODEL_ALREADY", 60)
+      .Case("ERROR_REASON_FRAUD_PENDING", 61)
+      .Case("ERROR_REASON_SUSPENDED_ORIGIN", 62)
+      .Case("ERROR_REASON_API_INDEX", 63)
+      .Case("ERROR_REASON_CONSENT_GATEWAY", 64)
+      .Case("ERROR_REASON_CURRENCY_FORBIDDEN", 65)
+      .Case("ERROR_REASON_DELETED_CODE", 66)
+      .Case("ERROR_REASON_HEADER_STATE", 67)
+      .Case("ERROR_REASON_PRICE_BILLING", 68)
+      .Case("ERROR_REASON_EMPTY_SESSION", 69)
+      .Case("ERROR_REASON_SIGNATURE_FRAUD", 70)
+      .Case("ERROR_REASON_INTERNAL_BUDGET", 71)
+      .Case("ERROR_REASON_ADDRESS_QUOTA", 72)
+      .Case("ERROR_REASON_ORDER_PARSE", 73)
+      .Case("ERROR_REASON_BACKEND_TOO_LARGE", 74)
+      .Case("ERROR_REASON_PRECONDITION_DECLINED", 75)
+      .Case("ERROR_REASON_CURRENCY_VERSION", 76)
+      .Case("ERROR_REASON_REQUEST_NOT_FOUND", 77)
+      .Case("ERROR_REASON_UNAVAILABLE_BILLING", 78)
+      .Case("ERROR_REASON_CURRENCY_GEO", 79)
+      .Case("ERROR_REASON_UNSUPPORTED_DOMAIN", 80)
+      .Case("ERROR_REASON_FILE_EMAIL", 81)
+      .Case("ERROR_REASON_DUPLICATE_METHOD", 82)
+      .Case("ERROR_REASON_PAYMENT_PAYLOAD", 83)
+      .Case("ERROR_REASON_SECRET_BILLING", 84)
+      .Case("ERROR_REASON_BODY_FRAUD", 85)
+      .Case("ERROR_REASON_FAILED_CHECKSUM", 86)
+      .Case("ERROR_REASON_PROTOCOL_TIMEOUT", 87)
+      .Case("ERROR_REASON_BAD_FAILED", 88)
+      .Case("ERROR_REASON_CHECKSUM_MISSING", 89)
+      .Case("ERROR_REASON_ENDPOINT_PARAM", 90)
+      .Case("ERROR_REASON_UNAVAILABLE_LOCALE", 91)
+      .Case("ERROR_REASON_CODE_SCHEMA", 92)
+      .Case("ERROR_REASON_BILLING_UPSTREAM", 93)
+      .Case("ERROR_REASON_DEADLINE_DELETED", 94)
+      .Case("ERROR_REASON_MERCHANT_CAPACITY", 95)
+      .Case("ERROR_REASON_LIMIT_RESOURCE", 96)
+      .Case("ERROR_REASON_NETWORK_WALLET", 97)
+      .Case("ERROR_REASON_BODY_ENDPOINT", 98)
+      .Case("ERROR_REASON_PROVIDER_PRECONDITION", 99)
+      .Case("ERROR_REASON_WALLET_REVOKED", 100)
+      .Case("ERROR_REASON_PRECONDITION_CONSENT", 101)
+      .Case("ERROR_REASON_TRANSFER_PAYLOAD", 102)
+      .Case("ERROR_REASON_STATE_PRECONDITION", 103)
+      .Case("ERROR_REASON_DRIVER_MODEL", 104)
+      .Case("ERROR_REASON_USER_BANNED", 105)
+      .Case("ERROR_REASON_MISSING_CURRENCY", 106)
+      .Case("ERROR_REASON_ARCHIVED_CAPACITY", 107)
+      .Case("ERROR_REASON_CREDIT_PRECONDITION", 108)
+      .Case("ERROR_REASON_EMAIL_ROLE", 109)
+      .Case("ERROR_REASON_DEVICE_PROVIDER", 110)
+      .Case("ERROR_REASON_UPSTREAM_IP", 111)
+      .Case("ERROR_REASON_DRIVER_EXPIRED", 112)
+      .Case("ERROR_REASON_BILLING_NOT_FOUND", 113)
+      .Case("ERROR_REASON_EMPTY_ROUTE", 114)
+      .Case("ERROR_REASON_PRECONDITION_COUNTRY", 115)
+      .Case("ERROR_REASON_TARGET_PROFILE", 116)
+      .Case("ERROR_REASON_REGION_BODY", 117)
+      .Case("ERROR_REASON_GATEWAY_DISABLED", 118)
+      .Case("ERROR_REASON_USER_PAYMENT", 119)
+      .Case("ERROR_REASON_CONFIG_PASSWORD", 120)
+      .Case("ERROR_REASON_RESOURCE_ROLE", 121)
+      .Case("ERROR_REASON_REVOKED_BLOCKED", 122)
+      .Case("ERROR_REASON_SCHEMA_VALUE", 123)
+      .Case("ERROR_REASON_QUOTA_DEBIT", 124)
+      .Case("ERROR_REASON_FILE_RETRY", 125)
+      .Case("ERROR_REASON_MODEL_OUTDATED", 126)
+      .Case("ERROR_REASON_TIMEOUT_CONSENT", 127)
+      .Case("ERROR_REASON_ROUTE_LANGUAGE", 128)
+      .Case("ERROR_REASON_TARGET_CURRENCY", 129)
+      .Case("ERROR_REASON_UNAVAILABLE_CONFLICT", 130)
+      .Case("ERROR_REASON_DISABLED_ACCESS", 131)
+      .Case("ERROR_REASON_SIGNATURE_MALFORMED", 132)
+      .Case("ERROR_REASON_TARGET_OVERFLOW", 133)
+      .Case("ERROR_REASON_UNSUPPORTED_KEY", 134)
+      .Case("ERROR_REASON_REDIRECT_NETWORK", 135)
+      .Case("ERROR_REASON_BILLING_LANGUAGE", 136)
+      .Case("ERROR_REASON_API_GEO", 137)
+      .Case("ERROR_REASON_REJECTED_USER", 138)
+      .Case("ERROR_REASON_SIGNATURE_CONSENT", 139)
+      .Case("ERROR_REASON_CARD_TOKEN", 140)
+      .Case("ERROR_REASON_AUTH_BUSY", 141)
+      .Case("ERROR_REASON_FROZEN_CACHE", 142)
+      .Case("ERROR_REASON_DECLINED_REDIRECT", 143)
+      .Case("ERROR_REASON_FIELD_DRIVER", 144)
+      .Case("ERROR_REASON_BALANCE_REGION", 145)
+      .Case("ERROR_REASON_TIMEOUT_BLOCKED", 146)
+      .Case("ERROR_REASON_CHANNEL_OUTDATED", 147)
+      .Case("ERROR_REASON_ROUTE_PENDING", 148)
+      .Case("ERROR_REASON_UPSTREAM_REDIRECT", 149)
+      .Case("ERROR_REASON_SUBSCRIPTION_SECRET", 150)
+      .Case("ERROR_REASON_SIZE_EXPIRED", 151)
+      .Case("ERROR_REASON_LOCKED_CURRENCY", 152)
+      .Case("ERROR_REASON_BILLING_DOMAIN", 153)
+      .Case("ERROR_REASON_TENANT_CONFIG", 154)
+      .Case("ERROR_REASON_CHECKSUM_URL", 155)
+      .Case("ERROR_REASON_REVOKED_CONFLICT", 156)
+      .Case("ERROR_REASON_CONNECTION_STALE", 157)
+      .Case("ERROR_REASON_CURRENCY_TAX", 158)
+      .Case("ERROR_REASON_CONTENT_INVALID", 159);
+};
+
+constexpr utils::TrivialBiMap kLargeTrivialBiMap = [](auto selector) {
+  return kLargeBuilder(selector);
+};
+
+// What utils::TrivialBiMap used to compile into: a chain of comparisons
+std::optional<int> LargeSwitchChain(std::string_view value) {
+  return kLargeBuilder([value]() {
+           return utils::impl::SwitchByFirst<std::string_view, int>{value};
+         })
+      .Extract();
+}
+
+const auto kLargeUnorderedMapping = std::unordered_map<std::string_view, int>{
+    {"ERROR_REASON_FIELD_USER", 0},
+    {"ERROR_REASON_MODEL_CANCELLED", 1},
+    {"ERROR_REASON_PAYLOAD_CHECKSUM", 2},
+    {"ERROR_REASON_RESOURCE_CREDIT", 3},
+    {"ERROR_REASON_INDEX_POLICY", 4},
+    {"ERROR_REASON_LIMIT_MISSING", 5},
+    {"ERROR_REASON_CANCELLED_COUNTRY", 6},
+    {"ERROR_REASON_ABORTED_UNKNOWN", 7},
+    {"ERROR_REASON_CANCELLED_DEVICE", 8},
+    {"ERROR_REASON_ORIGIN_IP", 9},
+    {"ERROR_REASON_CONTRACT_PROVIDER", 10},
+    {"ERROR_REASON_BUDGET_TAX", 11},
+    {"ERROR_REASON_HEADER_THROTTLED", 12},
+    {"ERROR_REASON_CREDIT_THROTTLED", 13},
+    {"ERROR_REASON_ORDER_FIELD", 14},
+    {"ERROR_REASON_BALANCE_CHECKSUM", 15},
+    {"ERROR_REASON_TARGET_TENANT", 16},
+    {"ERROR_REASON_CHECKSUM_SUBSCRIPTION", 17},
+    {"ERROR_REASON_NETWORK_DATA", 18},
+    {"ERROR_REASON_CONNECTION_API", 19},
+    {"ERROR_REASON_CERT_OUTDATED", 20},
+    {"ERROR_REASON_CARD_IMPORT", 21},
+    {"ERROR_REASON_MISSING_REDIRECT", 22},
+    {"ERROR_REASON_OWNER_CERT", 23},
+    {"ERROR_REASON_SESSION_URL", 24},
+    {"ERROR_REASON_DISABLED_HOST", 25},
+    {"ERROR_REASON_VALUE_LOGIN", 26},
+    {"ERROR_REASON_INPUT_PARTNER", 27},
+    {"ERROR_REASON_PAYMENT_BAD", 28},
+    {"ERROR_REASON_ABORTED_ROLE", 29},
+    {"ERROR_REASON_PENDING_TIMEOUT", 30},
+    {"ERROR_REASON_INDEX_CONTRACT", 31},
+    {"ERROR_REASON_ALREADY_EMPTY", 32},
+    {"ERROR_REASON_DEBIT_STATE", 33},
+    {"ERROR_REASON_IP_CARD", 34},
+    {"ERROR_REASON_ALREADY_ACTIVE", 35},
+    {"ERROR_REASON_EXPIRED_INVALID", 36},
+    {"ERROR_REASON_EXPORT_INTERNAL", 37},
+    {"ERROR_REASON_STATE_SECRET", 38},
+    {"ERROR_REASON_CLOSED_MISSING", 39},
+    {"ERROR_REASON_USER_REGION", 40},
+    {"ERROR_REASON_ORDER_API", 41},
+    {"ERROR_REASON_CONFIG_STALE", 42},
+    {"ERROR_REASON_PAYMENT_REQUEST", 43},
+    {"ERROR_REASON_INPUT_ACCESS", 44},
+    {"ERROR_REASON_OUTDATED_CACHE", 45},
+    {"ERROR_REASON_RETRY_HEADER", 46},
+    {"ERROR_REASON_PAYMENT_PENDING", 47},
+    {"ERROR_REASON_SESSION_CACHE", 48},
+    {"ERROR_REASON_TRANSFER_DISABLED", 49},
+    {"ERROR_REASON_PENDING_CANCELLED", 50},
+    {"ERROR_REASON_HOST_ROLE", 51},
+    {"ERROR_REASON_SCOPE_PRECONDITION", 52},
+    {"ERROR_REASON_FORBIDDEN_ACTIVE", 53},
+    {"ERROR_REASON_OUTDATED_DECLINED", 54},
+    {"ERROR_REASON_SUBSCRIPTION_SOURCE", 55},
+    {"ERROR_REASON_AMOUNT_BUDGET", 56},
+    {"ERROR_REASON_AMOUNT_SUSPENDED", 57},
+    {"ERROR_REASON_FORBIDDEN_CURRENCY", 58},
+    {"ERROR_REASON_TOO_LARGE_UNSUPPORTED", 59},
+    {"ERROR_REASON_MODEL_ALREADY", 60},
+    {"ERROR_REASON_FRAUD_PENDING", 61},
+    {"ERROR_REASON_SUSPENDED_ORIGIN", 62},
+    {"ERROR_REASON_API_INDEX", 63},
+    {"ERROR_REASON_CONSENT_GATEWAY", 64},
+    {"ERROR_REASON_CURRENCY_FORBIDDEN", 65},
+    {"ERROR_REASON_DELETED_CODE", 66},
+    {"ERROR_REASON_HEADER_STATE", 67},
+    {"ERROR_REASON_PRICE_BILLING", 68},
+    {"ERROR_REASON_EMPTY_SESSION", 69},
+    {"ERROR_REASON_SIGNATURE_FRAUD", 70},
+    {"ERROR_REASON_INTERNAL_BUDGET", 71},
+    {"ERROR_REASON_ADDRESS_QUOTA", 72},
+    {"ERROR_REASON_ORDER_PARSE", 73},
+    {"ERROR_REASON_BACKEND_TOO_LARGE", 74},
+    {"ERROR_REASON_PRECONDITION_DECLINED", 75},
+    {"ERROR_REASON_CURRENCY_VERSION", 76},
+    {"ERROR_REASON_REQUEST_NOT_FOUND", 77},
+    {"ERROR_REASON_UNAVAILABLE_BILLING", 78},
+    {"ERROR_REASON_CURRENCY_GEO", 79},
+    {"ERROR_REASON_UNSUPPORTED_DOMAIN", 80},
+    {"ERROR_REASON_FILE_EMAIL", 81},
+    {"ERROR_REASON_DUPLICATE_METHOD", 82},
+    {"ERROR_REASON_PAYMENT_PAYLOAD", 83},
+    {"ERROR_REASON_SECRET_BILLING", 84},
+    {"ERROR_REASON_BODY_FRAUD", 85},
+    {"ERROR_REASON_FAILED_CHECKSUM", 86},
+    {"ERROR_REASON_PROTOCOL_TIMEOUT", 87},
+    {"ERROR_REASON_BAD_FAILED", 88},
+    {"ERROR_REASON_CHECKSUM_MISSING", 89},
+    {"ERROR_REASON_ENDPOINT_PARAM", 90},
+    {"ERROR_REASON_UNAVAILABLE_LOCALE", 91},
+    {"ERROR_REASON_CODE_SCHEMA", 92},
+    {"ERROR_REASON_BILLING_UPSTREAM", 93},
+    {"ERROR_REASON_DEADLINE_DELETED", 94},
+    {"ERROR_REASON_MERCHANT_CAPACITY", 95},
+    {"ERROR_REASON_LIMIT_RESOURCE", 96},
+    {"ERROR_REASON_NETWORK_WALLET", 97},
+    {"ERROR_REASON_BODY_ENDPOINT", 98},
+    {"ERROR_REASON_PROVIDER_PRECONDITION", 99},
+    {"ERROR_REASON_WALLET_REVOKED", 100},
+    {"ERROR_REASON_PRECONDITION_CONSENT", 101},
+    {"ERROR_REASON_TRANSFER_PAYLOAD", 102},
+    {"ERROR_REASON_STATE_PRECONDITION", 103},
+    {"ERROR_REASON_DRIVER_MODEL", 104},
+    {"ERROR_REASON_USER_BANNED", 105},
+    {"ERROR_REASON_MISSING_CURRENCY", 106},
+    {"ERROR_REASON_ARCHIVED_CAPACITY", 107},
+    {"ERROR_REASON_CREDIT_PRECONDITION", 108},
+    {"ERROR_REASON_EMAIL_ROLE", 109},
+    {"ERROR_REASON_DEVICE_PROVIDER", 110},
+    {"ERROR_REASON_UPSTREAM_IP", 111},
+    {"ERROR_REASON_DRIVER_EXPIRED", 112},
+    {"ERROR_REASON_BILLING_NOT_FOUND", 113},
+    {"ERROR_REASON_EMPTY_ROUTE", 114},
+    {"ERROR_REASON_PRECONDITION_COUNTRY", 115},
+    {"ERROR_REASON_TARGET_PROFILE", 116},
+    {"ERROR_REASON_REGION_BODY", 117},
+    {"ERROR_REASON_GATEWAY_DISABLED", 118},
+    {"ERROR_REASON_USER_PAYMENT", 119},
+    {"ERROR_REASON_CONFIG_PASSWORD", 120},
+    {"ERROR_REASON_RESOURCE_ROLE", 121},
+    {"ERROR_REASON_REVOKED_BLOCKED", 122},
+    {"ERROR_REASON_SCHEMA_VALUE", 123},
+    {"ERROR_REASON_QUOTA_DEBIT", 124},
+    {"ERROR_REASON_FILE_RETRY", 125},
+    {"ERROR_REASON_MODEL_OUTDATED", 126},
+    {"ERROR_REASON_TIMEOUT_CONSENT", 127},
+    {"ERROR_REASON_ROUTE_LANGUAGE", 128},
+    {"ERROR_REASON_TARGET_CURRENCY", 129},
+    {"ERROR_REASON_UNAVAILABLE_CONFLICT", 130},
+    {"ERROR_REASON_DISABLED_ACCESS", 131},
+    {"ERROR_REASON_SIGNATURE_MALFORMED", 132},
+    {"ERROR_REASON_TARGET_OVERFLOW", 133},
+    {"ERROR_REASON_UNSUPPORTED_KEY", 134},
+    {"ERROR_REASON_REDIRECT_NETWORK", 135},
+    {"ERROR_REASON_BILLING_LANGUAGE", 136},
+    {"ERROR_REASON_API_GEO", 137},
+    {"ERROR_REASON_REJECTED_USER", 138},
+    {"ERROR_REASON_SIGNATURE_CONSENT", 139},
+    {"ERROR_REASON_CARD_TOKEN", 140},
+    {"ERROR_REASON_AUTH_BUSY", 141},
+    {"ERROR_REASON_FROZEN_CACHE", 142},
+    {"ERROR_REASON_DECLINED_REDIRECT", 143},
+    {"ERROR_REASON_FIELD_DRIVER", 144},
+    {"ERROR_REASON_BALANCE_REGION", 145},
+    {"ERROR_REASON_TIMEOUT_BLOCKED", 146},
+    {"ERROR_REASON_CHANNEL_OUTDATED", 147},
+    {"ERROR_REASON_ROUTE_PENDING", 148},
+    {"ERROR_REASON_UPSTREAM_REDIRECT", 149},
+    {"ERROR_REASON_SUBSCRIPTION_SECRET", 150},
+    {"ERROR_REASON_SIZE_EXPIRED", 151},
+    {"ERROR_REASON_LOCKED_CURRENCY", 152},
+    {"ERROR_REASON_BILLING_DOMAIN", 153},
+    {"ERROR_REASON_TENANT_CONFIG", 154},
+    {"ERROR_REASON_CHECKSUM_URL", 155},
+    {"ERROR_REASON_REVOKED_CONFLICT", 156},
+    {"ERROR_REASON_CONNECTION_STALE", 157},
+    {"ERROR_REASON_CURRENCY_TAX", 158},
+    {"ERROR_REASON_CONTENT_INVALID", 159},
+};
+
 enum class Enum1 {
   C1,
   C2,
@@ -447,6 +788,87 @@ void MappingHugeUnorderedLast(benchmark::State& state) {
 }
 BENCHMARK(MappingHugeUnorderedLast);
 
+void MappingLargeTrivialBiMap(benchmark::State& state) {
+  auto k0 = MyLaunder("ERROR_REASON_FIELD_USER");
+  auto k1 = MyLaunder("ERROR_REASON_CHECKSUM_SUBSCRIPTION");
+  auto k2 = MyLaunder("ERROR_REASON_DEBIT_STATE");
+  auto k3 = MyLaunder("ERROR_REASON_FORBIDDEN_CURRENCY");
+  auto k4 = MyLaunder("ERROR_REASON_CURRENCY_GEO");
+  auto k5 = MyLaunder("ERROR_REASON_LIMIT_RESOURCE");
+  auto k6 = MyLaunder("ERROR_REASON_UPSTREAM_IP");
+  auto k7 = MyLaunder("ERROR_REASON_ROUTE_LANGUAGE");
+  auto k8 = MyLaunder("ERROR_REASON_FROZEN_CACHE");
+  auto k9 = MyLaunder("ERROR_REASON_CONTENT_INVALID");
+
+  for ([[maybe_unused]] auto _ : state) {
+    benchmark::DoNotOptimize(kLargeTrivialBiMap.TryFind(k0));
+    benchmark::DoNotOptimize(kLargeTrivialBiMap.TryFind(k1));
+    benchmark::DoNotOptimize(kLargeTrivialBiMap.TryFind(k2));
+    benchmark::DoNotOptimize(kLargeTrivialBiMap.TryFind(k3));
+    benchmark::DoNotOptimize(kLargeTrivialBiMap.TryFind(k4));
+    benchmark::DoNotOptimize(kLargeTrivialBiMap.TryFind(k5));
+    benchmark::DoNotOptimize(kLargeTrivialBiMap.TryFind(k6));
+    benchmark::DoNotOptimize(kLargeTrivialBiMap.TryFind(k7));
+    benchmark::DoNotOptimize(kLargeTrivialBiMap.TryFind(k8));
+    benchmark::DoNotOptimize(kLargeTrivialBiMap.TryFind(k9));
+  }
+}
+BENCHMARK(MappingLargeTrivialBiMap);
+
+void MappingLargeSwitchChain(benchmark::State& state) {
+  auto k0 = MyLaunder("ERROR_REASON_FIELD_USER");
+  auto k1 = MyLaunder("ERROR_REASON_CHECKSUM_SUBSCRIPTION");
+  auto k2 = MyLaunder("ERROR_REASON_DEBIT_STATE");
+  auto k3 = MyLaunder("ERROR_REASON_FORBIDDEN_CURRENCY");
+  auto k4 = MyLaunder("ERROR_REASON_CURRENCY_GEO");
+  auto k5 = MyLaunder("ERROR_REASON_LIMIT_RESOURCE");
+  auto k6 = MyLaunder("ERROR_REASON_UPSTREAM_IP");
+  auto k7 = MyLaunder("ERROR_REASON_ROUTE_LANGUAGE");
+  auto k8 = MyLaunder("ERROR_REASON_FROZEN_CACHE");
+  auto k9 = MyLaunder("ERROR_REASON_CONTENT_INVALID");
+
+  for ([[maybe_unused]] auto _ : state) {
+    benchmark::DoNotOptimize(LargeSwitchChain(k0));
+    benchmark::DoNotOptimize(LargeSwitchChain(k1));
+    benchmark::DoNotOptimize(LargeSwitchChain(k2));
+    benchmark::DoNotOptimize(LargeSwitchChain(k3));
+    benchmark::DoNotOptimize(LargeSwitchChain(k4));
+    benchmark::DoNotOptimize(LargeSwitchChain(k5));
+    benchmark::DoNotOptimize(LargeSwitchChain(k6));
+    benchmark::DoNotOptimize(LargeSwitchChain(k7));
+    benchmark::DoNotOptimize(LargeSwitchChain(k8));
+    benchmark::DoNotOptimize(LargeSwitchChain(k9));
+  }
+}
+BENCHMARK(MappingLargeSwitchChain);
+
+void MappingLargeUnordered(benchmark::State& state) {
+  auto k0 = MyLaunder("ERROR_REASON_FIELD_USER");
+  auto k1 = MyLaunder("ERROR_REASON_CHECKSUM_SUBSCRIPTION");
+  auto k2 = MyLaunder("ERROR_REASON_DEBIT_STATE");
+  auto k3 = MyLaunder("ERROR_REASON_FORBIDDEN_CURRENCY");
+  auto k4 = MyLaunder("ERROR_REASON_CURRENCY_GEO");
+  auto k5 = MyLaunder("ERROR_REASON_LIMIT_RESOURCE");
+  auto k6 = MyLaunder("ERROR_REASON_UPSTREAM_IP");
+  auto k7 = MyLaunder("ERROR_REASON_ROUTE_LANGUAGE");
+  auto k8 = MyLaunder("ERROR_REASON_FROZEN_CACHE");
+  auto k9 = MyLaunder("ERROR_REASON_CONTENT_INVALID");
+
+  for ([[maybe_unused]] auto _ : state) {
+    benchmark::DoNotOptimize(kLargeUnorderedMapping.find(k0));
+    benchmark::DoNotOptimize(kLargeUnorderedMapping.find(k1));
+    benchmark::DoNotOptimize(kLargeUnorderedMapping.find(k2));
+    benchmark::DoNotOptimize(kLargeUnorderedMapping.find(k3));
+    benchmark::DoNotOptimize(kLargeUnorderedMapping.find(k4));
+    benchmark::DoNotOptimize(kLargeUnorderedMapping.find(k5));
+    benchmark::DoNotOptimize(kLargeUnorderedMapping.find(k6));
+    benchmark::DoNotOptimize(kLargeUnorderedMapping.find(k7));
+    benchmark::DoNotOptimize(kLargeUnorderedMapping.find(k8));
+    benchmark::DoNotOptimize(kLargeUnorderedMapping.find(k9));
+  }
+}
+BENCHMARK(MappingLargeUnordered);
+
 void MappingEnumsTrivialBiMap(benchmark::State& state) {
   const auto enum2 = Launder(Enum2::C7);
 
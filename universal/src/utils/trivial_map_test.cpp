@@ -350,6 +350,186 @@ TEST(TrivialBiMap, GetIndex) {
   EXPECT_EQ(kNames.GetIndex("aba"), std::nullopt);
 }
 
+namespace {
+
+template <typename Map>
+struct BuilderOf;
+
+template <typename BuilderFunc>
+struct BuilderOf<const utils::TrivialBiMap<BuilderFunc>> {
+  using type = BuilderFunc;
+};
+
+template <typename BuilderFunc>
+struct BuilderOf<const utils::TrivialSet<BuilderFunc>> {
+  using type = BuilderFunc;
+};
+
+template <const auto& Map>
+constexpr bool kUsesPerfectHash = utils::impl::kUseTrivialMapPerfectHash<
+    typename BuilderOf<std::remove_reference_t<decltype(Map)>>::type, true>;
+
+constexpr utils::TrivialBiMap kHeaderToIndex = [](auto selector) {
+  return selector()
+      .Case("accept", 0)
+      .Case("accept-charset", 1)
+      .Case("accept-encoding", 2)
+      .Case("accept-language", 3)
+      .Case("accept-ranges", 4)
+      .Case("access-control-allow-credentials", 5)
+      .Case("access-control-allow-headers", 6)
+      .Case("access-control-allow-methods", 7)
+      .Case("access-control-allow-origin", 8)
+      .Case("access-control-expose-headers", 9)
+      .Case("access-control-max-age", 10)
+      .Case("access-control-request-headers", 11)
+      .Case("access-control-request-method", 12)
+      .Case("age", 13)
+      .Case("allow", 14)
+      .Case("alt-svc", 15)
+      .Case("authorization", 16)
+      .Case("cache-control", 17)
+      .Case("connection", 18)
+      .Case("content-disposition", 19)
+      .Case("content-encoding", 20)
+      .Case("content-language", 21)
+      .Case("content-length", 22)
+      .Case("content-location", 23)
+      .Case("content-range", 24)
+      .Case("content-security-policy", 25)
+      .Case("content-type", 26)
+      .Case("cookie", 27)
+      .Case("date", 28)
+      .Case("dnt", 29)
+      .Case("early-data", 30)
+      .Case("etag", 31)
+      .Case("expect", 32)
+      .Case("expires", 33)
+      .Case("forwarded", 34)
+      .Case("from", 35)
+      .Case("host", 36)
+      .Case("if-match", 37)
+      .Case("if-modified-since", 38)
+      .Case("if-none-match", 39)
+      .Case("if-range", 40)
+      .Case("if-unmodified-since", 41)
+      .Case("keep-alive", 42)
+      .Case("last-modified", 43)
+      .Case("link", 44)
+      .Case("location", 45)
+      .Case("max-forwards", 46)
+      .Case("origin", 47)
+      .Case("pragma", 48)
+      .Case("proxy-authenticate", 49)
+      .Case("proxy-authorization", 50)
+      .Case("range", 51)
+      .Case("referer", 52)
+      .Case("referrer-policy", 53)
+      .Case("retry-after", 54)
+      .Case("sec-fetch-dest", 55)
+      .Case("sec-fetch-mode", 56)
+      .Case("sec-fetch-site", 57)
+      .Case("server", 58)
+      .Case("set-cookie", 59)
+      .Case("strict-transport-security", 60)
+      .Case("te", 61)
+      .Case("timing-allow-origin", 62)
+      .Case("trailer", 63)
+      .Case("transfer-encoding", 64)
+      .Case("upgrade", 65)
+      .Case("user-agent", 66)
+      .Case("vary", 67)
+      .Case("via", 68)
+      .Case("warning", 69)
+      .Case("www-authenticate", 70)
+      .Case("x-content-type-options", 71)
+      .Case("x-forwarded-for", 72)
+      .Case("x-frame-options", 73);
+};
+
+constexpr std::string_view kHeaders[] = {
+    "accept", "accept-charset", "accept-encoding", "accept-language",
+    "accept-ranges", "access-control-allow-credentials",
+    "access-control-allow-headers", "access-control-allow-methods",
+    "access-control-allow-origin", "access-control-expose-headers",
+    "access-control-max-age", "access-control-request-headers",
+    "access-control-request-method", "age", "allow", "alt-svc", "authorization",
+    "cache-control", "connection", "content-disposition", "content-encoding",
+    "content-language", "content-length", "content-location", "content-range",
+    "content-security-policy", "content-type", "cookie", "date", "dnt",
+    "early-data", "etag", "expect", "expires", "forwarded", "from", "host",
+    "if-match", "if-modified-since", "if-none-match", "if-range",
+    "if-unmodified-since", "keep-alive", "last-modified", "link", "location",
+    "max-forwards", "origin", "pragma", "proxy-authenticate",
+    "proxy-authorization", "range", "referer", "referrer-policy", "retry-after",
+    "sec-fetch-dest", "sec-fetch-mode", "sec-fetch-site", "server",
+    "set-cookie", "strict-transport-security", "te", "timing-allow-origin",
+    "trailer", "transfer-encoding", "upgrade", "user-agent", "vary", "via",
+    "warning", "www-authenticate", "x-content-type-options", "x-forwarded-for",
+    "x-frame-options",
+};
+
+constexpr auto kHeadersSet = utils::MakeTrivialSet<kHeaders>();
+
+}  // namespace
+
+TEST(TrivialBiMap, PerfectHash) {
+  static_assert(kUsesPerfectHash<kHeaderToIndex>);
+  static_assert(!kUsesPerfectHash<kToInt>);
+
+  static_assert(kHeaderToIndex.TryFind("content-type") == 26);
+  static_assert(kHeaderToIndex.TryFind("content-typo") == std::nullopt);
+
+  for (std::size_t i = 0; i < std::size(kHeaders); ++i) {
+    EXPECT_EQ(kHeaderToIndex.TryFind(kHeaders[i]), static_cast<int>(i));
+    EXPECT_EQ(kHeaderToIndex.TryFind(static_cast<int>(i)), kHeaders[i]);
+  }
+
+  EXPECT_EQ(kHeaderToIndex.TryFind(""), std::nullopt);
+  EXPECT_EQ(kHeaderToIndex.TryFind("Accept"), std::nullopt);
+  EXPECT_EQ(kHeaderToIndex.TryFind("accept-"), std::nullopt);
+  EXPECT_EQ(kHeaderToIndex.TryFind("acce"), std::nullopt);
+  EXPECT_EQ(kHeaderToIndex.TryFind("x-request-id"), std::nullopt);
+  EXPECT_EQ(kHeaderToIndex.TryFind(std::string_view{"varyvary", 4}), 67);
+
+  EXPECT_EQ(kHeaderToIndex.TryFindICase("Content-Type"), 26);
+}
+
+TEST(TrivialBiMap, PerfectHashSet) {
+  static_assert(kUsesPerfectHash<kHeadersSet>);
+
+  for (std::size_t i = 0; i < std::size(kHeaders); ++i) {
+    EXPECT_TRUE(kHeadersSet.Contains(kHeaders[i]));
+    EXPECT_EQ(kHeadersSet.GetIndex(kHeaders[i]), i);
+  }
+
+  EXPECT_FALSE(kHeadersSet.Contains("x-request-id"));
+  EXPECT_EQ(kHeadersSet.GetIndex("x-request-id"), std::nullopt);
+  EXPECT_TRUE(kHeadersSet.ContainsICase("USER-AGENT"));
+}
+
+TEST(TrivialBiMap, PerfectHashBySecond) {
+  enum class Code { kFirst, kSecond, kLast };
+  static constexpr utils::TrivialBiMap kCodes = [](auto selector) {
+    auto result = selector().Case(Code::kFirst, "code-first");
+    for (int i = 0; i < 70; ++i) {
+      result.Case(Code::kSecond, "code-second");
+    }
+    return result.Case(Code::kLast, "code-last");
+  };
+  static_assert(utils::impl::kUseTrivialMapPerfectHash<
+                typename BuilderOf<decltype(kCodes)>::type, false>);
+
+  // Duplicates are allowed, the first matching Case wins
+  static_assert(kCodes.TryFind("code-first") == Code::kFirst);
+  static_assert(kCodes.TryFind("code-second") == Code::kSecond);
+  static_assert(kCodes.TryFind("code-last") == Code::kLast);
+
+  EXPECT_EQ(kCodes.TryFind("code-last"), Code::kLast);
+  EXPECT_EQ(kCodes.TryFind("code-"), std::nullopt);
+  EXPECT_EQ(kCodes.size(), 72);
+}
+
 TEST(TrivialBiMap, ConstexprIteration) {
   constexpr auto sum = []() {
     constexpr utils::TrivialBiMap kMap = [](auto selector) {
@@ -8,8 +8,18 @@ USERVER_NAMESPACE_BEGIN
 namespace utils::generators {
 
 std::string GenerateUuid() {
+  const auto hex = GenerateUuidHex();
+  return std::string(hex.data(), hex.size());
+}
+
+std::array<char, 32> GenerateUuidHex() {
   const auto val = GenerateBoostUuid();
-  return encoding::ToHex(val.begin(), val.size());
+  std::array<char, 32> result{};
+  static_assert(result.size() == encoding::LengthInHexForm(sizeof(val.data)));
+  encoding::ToHex(
+      std::string_view{reinterpret_cast<const char*>(val.data), val.size()},
+      result.data());
+  return result;
 }
 
 }  // namespace utils::generators
@@ -8,8 +8,18 @@ USERVER_NAMESPACE_BEGIN
 namespace utils::generators {
 
 std::string GenerateUuidV7() {
+  const auto hex = GenerateUuidV7Hex();
+  return std::string(hex.data(), hex.size());
+}
+
+std::array<char, 32> GenerateUuidV7Hex() {
   const auto val = GenerateBoostUuidV7();
-  return encoding::ToHex(val.begin(), val.size());
+  std::array<char, 32> result{};
+  static_assert(result.size() == encoding::LengthInHexForm(sizeof(val.data)));
+  encoding::ToHex(
+      std::string_view{reinterpret_cast<const char*>(val.data), val.size()},
+      result.data());
+  return result;
 }
 
 }  // namespace utils::generators
@@ -1,5 +1,7 @@
 #include <userver/utils/uuid7.hpp>
 
+#include <string_view>
+
 #include <gtest/gtest.h>
 
 USERVER_NAMESPACE_BEGIN
@@ -14,4 +16,16 @@ TEST(UUIDv7, String) {
             utils::generators::GenerateUuidV7());
 }
 
+TEST(UUIDv7, Hex) {
+  const auto hex = utils::generators::GenerateUuidV7Hex();
+  const std::string_view str{hex.data(), hex.size()};
+  EXPECT_EQ(str.find_first_not_of("0123456789abcdef"), std::string_view::npos);
+  EXPECT_EQ(str[12], '7');  // version
+  EXPECT_NE(std::string_view{"89ab"}.find(str[16]),
+            std::string_view::npos);  // variant
+
+  EXPECT_NE(utils::generators::GenerateUuidV7Hex(),
+            utils::generators::GenerateUuidV7Hex());
+}
+
 USERVER_NAMESPACE_END
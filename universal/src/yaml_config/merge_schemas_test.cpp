@@ -71,6 +71,15 @@ properties:
                 description: .
 )";
 
+struct ParentComponent {
+  static yaml_config::Schema GetStaticConfigSchema() {
+    ++schema_requests;
+    return yaml_config::impl::SchemaFromString(kParentSchema);
+  }
+
+  static inline int schema_requests = 0;
+};
+
 }  // namespace
 
 TEST(MergeSchemas, ParentNoObject) {
@@ -113,4 +122,27 @@ TEST(MergeSchemas, CommonOption) {
               common_option_properties.end());
 }
 
+TEST(MergeSchemas, ParentSchemaIsReused) {
+  for (int i = 0; i < 3; ++i) {
+    const auto schema =
+        yaml_config::MergeSchemas<ParentComponent>(kChildSchema);
+    const auto& properties = schema.properties.value();
+    EXPECT_TRUE(properties.find("parent_option") != properties.end());
+    EXPECT_TRUE(properties.find("child_option") != properties.end());
+  }
+  EXPECT_EQ(ParentComponent::schema_requests, 1);
+}
+
+TEST(MergeSchemas, SchemaCopy) {
+  const auto original = Merge(kParentSchema, kChildSchema);
+  auto copy = original;
+  copy.properties->erase("child_option");
+  (*copy.properties->at("common_option")).description = "changed";
+
+  const auto& properties = original.properties.value();
+  EXPECT_TRUE(properties.find("child_option") != properties.end());
+  EXPECT_EQ(properties.at("common_option")->description,
+            "child common_option");
+}
+
 USERVER_NAMESPACE_END
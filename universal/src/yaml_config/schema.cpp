@@ -139,6 +139,16 @@ formats::yaml::Value Serialize(
 SchemaPtr::SchemaPtr(Schema&& schema)
     : schema_(std::make_unique<Schema>(std::move(schema))) {}
 
+SchemaPtr::SchemaPtr(const SchemaPtr& other)
+    : schema_(std::make_unique<Schema>(*other.schema_)) {}
+
+SchemaPtr& SchemaPtr::operator=(const SchemaPtr& other) {
+  if (this != &other) schema_ = std::make_unique<Schema>(*other.schema_);
+  return *this;
+}
+
+SchemaPtr::~SchemaPtr() = default;
+
 std::variant<bool, SchemaPtr> Parse(
     const formats::yaml::Value& value,
     formats::parse::To<std::variant<bool, SchemaPtr>>) {
@@ -9,6 +9,7 @@
 #include <optional>
 #include <typeinfo>
 
+#include <userver/utils/meta.hpp>
 #include <userver/utils/not_null.hpp>
 #include <userver/ydb/impl/cast.hpp>
 #include <userver/ydb/io/insert_row.hpp>
@@ -45,6 +46,8 @@ struct ParseState final {
   std::unique_ptr<std::size_t[]> cpp_to_ydb_field_mapping{};
 };
 
+struct ParallelReadTableState;
+
 }  // namespace impl
 
 using ValueType = NYdb::EPrimitiveType;
@@ -151,6 +154,18 @@ class Cursor final {
   CursorIterator begin();
   std::default_sentinel_t end();
 
+  /// @brief Parses all the rows to a container of structs, see Row::As.
+  /// The columns are mapped to the struct members once per cursor.
+  ///
+  /// @code
+  /// auto rows = std::move(cursor).AsContainer<std::vector<MyStruct>>();
+  /// @endcode
+  ///
+  /// @throws EmptyResponseError if the cursor was consumed before
+  /// @throws ydb::ColumnParseError on parsing error
+  template <typename Container>
+  Container AsContainer() &&;
+
  private:
   friend class Row;
   friend class CursorIterator;
@@ -207,6 +222,35 @@ class ReadTableResults final {
   NYdb::NTable::TTablePartIterator iterator_;
 };
 
+/// @brief Result parts of TableClient::ReadTableParallel. The key ranges are
+/// read by background tasks ahead of the consumer, up to
+/// ParallelReadTableSettings::max_prefetched_parts parts.
+///
+/// Destroying the object cancels the background reading.
+class ParallelReadTableResults final {
+ public:
+  /// @cond
+  explicit ParallelReadTableResults(
+      std::unique_ptr<impl::ParallelReadTableState> state);
+  /// @endcond
+
+  ~ParallelReadTableResults();
+
+  /// @brief Returns the next result part of any of the key ranges or
+  /// `std::nullopt` if all the ranges are read. The parts of a single key
+  /// range are returned in order.
+  /// @throws YdbResponseError if reading of any of the key ranges failed
+  std::optional<Cursor> GetNextResult();
+
+  ParallelReadTableResults(const ParallelReadTableResults&) = delete;
+  ParallelReadTableResults(ParallelReadTableResults&&) noexcept;
+  ParallelReadTableResults& operator=(const ParallelReadTableResults&) = delete;
+  ParallelReadTableResults& operator=(ParallelReadTableResults&&) = delete;
+
+ private:
+  std::unique_ptr<impl::ParallelReadTableState> state_;
+};
+
 class ScanQueryResults final {
   using TScanQueryPartIterator = NYdb::NTable::TScanQueryPartIterator;
 
@@ -241,6 +285,20 @@ T Row::As() && {
       parse_state_.parser, parse_state_.cpp_to_ydb_field_mapping);
 }
 
+template <typename Container>
+Container Cursor::AsContainer() && {
+  using ValueType = typename Container::value_type;
+
+  Container result;
+  if constexpr (meta::kIsReservable<Container>) {
+    result.reserve(RowsCount());
+  }
+  for (Row row : *this) {
+    result.insert(result.end(), std::move(row).As<ValueType>());
+  }
+  return result;
+}
+
 template <typename T>
 T Row::Get(std::string_view column_name) {
 #ifndef NDEBUG
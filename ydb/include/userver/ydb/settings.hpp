@@ -1,6 +1,7 @@
 #pragma once
 
 #include <chrono>
+#include <cstddef>
 #include <cstdint>
 #include <optional>
 #include <string_view>
@@ -34,6 +35,14 @@ struct QuerySettings final {
       std::nullopt};
 };
 
+struct ParallelReadTableSettings final {
+  /// Max number of the table shards key ranges read concurrently
+  std::size_t max_parallel_ranges{4};
+
+  /// Max number of the result parts read ahead and not consumed yet
+  std::size_t max_prefetched_parts{16};
+};
+
 }  // namespace ydb
 
 namespace formats::parse {
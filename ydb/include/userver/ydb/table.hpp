@@ -123,6 +123,24 @@ class TableClient final {
       NYdb::NTable::TReadTableSettings&& read_settings = {},
       OperationSettings settings = {});
 
+  /// @brief Efficiently read the whole table by the key ranges of its shards
+  /// concurrently.
+  ///
+  /// The shards boundaries are taken from DescribeTable, each key range is
+  /// read with ReadTable in a background task, no more than
+  /// `parallel_settings.max_parallel_ranges` at once. The result parts are
+  /// read ahead of the consumer up to `parallel_settings.max_prefetched_parts`.
+  ///
+  /// @note The parts of different key ranges are interleaved, so `Ordered`
+  /// and `RowLimit` of `read_settings` apply to each key range separately.
+  /// `read_settings` must not have the `From` and `To` key bounds.
+  /// @warning The TableClient must outlive the returned object.
+  ParallelReadTableResults ReadTableParallel(
+      std::string_view table,
+      NYdb::NTable::TReadTableSettings read_settings = {},
+      ParallelReadTableSettings parallel_settings = {},
+      OperationSettings settings = {});
+
   /// @name Scan queries execution
   /// A separate data access interface designed primarily for performing
   /// analytical ad-hoc queries.
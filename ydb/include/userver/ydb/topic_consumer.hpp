@@ -0,0 +1,88 @@
+#pragma once
+
+/// @file userver/ydb/topic_consumer.hpp
+/// @brief @copybrief ydb::TopicConsumer
+
+#include <chrono>
+#include <cstddef>
+#include <functional>
+#include <memory>
+
+#include <ydb-cpp-sdk/client/topic/client.h>
+
+#include <userver/engine/task/task_processor_fwd.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace ydb {
+
+class TopicClient;
+
+struct TopicConsumerSettings final {
+  /// Maximum number of events taken from the read session at once
+  std::size_t max_events_per_read{100};
+  /// Number of data batches processed concurrently. Batches of one partition
+  /// are always processed sequentially. Reading stops while that many batches
+  /// are being processed
+  std::size_t max_batches_in_flight{8};
+
+  /// Processed batches are committed with a single request once that many
+  /// messages are pending commit...
+  std::size_t commit_batch_size{1000};
+  /// ... or once per this interval, whichever comes first
+  std::chrono::milliseconds commit_interval{std::chrono::seconds{1}};
+
+  /// Delay before retrying a failed batch or recreating a closed session
+  std::chrono::milliseconds error_retry_delay{std::chrono::seconds{1}};
+};
+
+/// @ingroup userver_clients
+///
+/// @brief RAII consumer of a YDB topic, similar to kafka::ConsumerScope.
+///
+/// Waits for the read session events without blocking the task processor
+/// threads and passes each received data batch to the callback on the given
+/// task processor. Batches of different partitions are processed
+/// concurrently, batches of one partition are processed in order.
+///
+/// If the callback throws, it is retried with the same batch after
+/// `error_retry_delay`. Processed batches are committed in groups, so after
+/// a restart some of them may be delivered again: the processing should be
+/// idempotent.
+///
+/// @note Must be placed as one of the last fields in the consumer component,
+/// because the callback often captures `this`. The TopicClient must outlive
+/// the consumer.
+class TopicConsumer final {
+ public:
+  /// @brief Callback that is invoked on each batch of messages.
+  using Callback = std::function<void(
+      NYdb::NTopic::TReadSessionEvent::TDataReceivedEvent& batch)>;
+
+  TopicConsumer(TopicClient& client,
+                NYdb::NTopic::TReadSessionSettings read_session_settings,
+                TopicConsumerSettings settings,
+                engine::TaskProcessor& task_processor);
+
+  /// @brief Stops the consumer (if not yet stopped).
+  ~TopicConsumer();
+
+  TopicConsumer(TopicConsumer&&) noexcept = delete;
+  TopicConsumer& operator=(TopicConsumer&&) noexcept = delete;
+
+  /// @brief Creates the read session and starts consuming the topic.
+  void Start(Callback callback);
+
+  /// @brief Stops reading, cancels the batches being processed and sends
+  /// the pending commits.
+  void Stop() noexcept;
+
+ private:
+  class Impl;
+
+  std::unique_ptr<Impl> impl_;
+};
+
+}  // namespace ydb
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,38 @@
+#pragma once
+
+#include <exception>
+#include <memory>
+#include <optional>
+#include <vector>
+
+#include <userver/concurrent/mpsc_queue.hpp>
+#include <userver/engine/task/task_with_result.hpp>
+#include <userver/ydb/response.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace ydb::impl {
+
+/// Either a result part of a key range or the error of reading it
+struct ReadTablePart final {
+  std::optional<Cursor> cursor;
+  std::exception_ptr error;
+};
+
+using ReadTablePartsQueue = concurrent::MpscQueue<ReadTablePart>;
+
+struct ParallelReadTableState final {
+  explicit ParallelReadTableState(std::size_t max_prefetched_parts)
+      : queue(ReadTablePartsQueue::Create(max_prefetched_parts)),
+        consumer(queue->GetConsumer()) {}
+
+  std::shared_ptr<ReadTablePartsQueue> queue;
+  ReadTablePartsQueue::Consumer consumer;
+
+  // Destroyed first to cancel the readers blocked on a full queue
+  std::vector<engine::TaskWithResult<void>> readers;
+};
+
+}  // namespace ydb::impl
+
+USERVER_NAMESPACE_END
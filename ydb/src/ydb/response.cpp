@@ -4,10 +4,12 @@
 #include <ydb-cpp-sdk/client/result/result.h>
 #include <ydb-cpp-sdk/client/table/table.h>
 
+#include <userver/engine/task/cancel.hpp>
 #include <userver/ydb/builder.hpp>
 #include <userver/ydb/exceptions.hpp>
 
 #include <ydb/impl/future.hpp>
+#include <ydb/impl/parallel_read_table.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
@@ -190,6 +192,34 @@ std::optional<Cursor> ReadTableResults::GetNextResult() {
   return Cursor{res};
 }
 
+ParallelReadTableResults::ParallelReadTableResults(
+    std::unique_ptr<impl::ParallelReadTableState> state)
+    : state_(std::move(state)) {
+  UASSERT(state_);
+}
+
+ParallelReadTableResults::~ParallelReadTableResults() = default;
+
+ParallelReadTableResults::ParallelReadTableResults(
+    ParallelReadTableResults&&) noexcept = default;
+
+std::optional<Cursor> ParallelReadTableResults::GetNextResult() {
+  impl::ReadTablePart part;
+  if (!state_->consumer.Pop(part)) {
+    if (engine::current_task::ShouldCancel()) {
+      throw OperationCancelledError();
+    }
+    // All the key ranges are read
+    return std::nullopt;
+  }
+
+  if (part.error) {
+    std::rethrow_exception(part.error);
+  }
+  UASSERT(part.cursor);
+  return std::move(part.cursor);
+}
+
 ScanQueryResults::ScanQueryResults(TScanQueryPartIterator iterator)
     : iterator_{std::move(iterator)} {}
 
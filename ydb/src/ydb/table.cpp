@@ -1,8 +1,13 @@
 #include <userver/ydb/table.hpp>
 
+#include <algorithm>
+#include <atomic>
+
 #include <userver/engine/deadline.hpp>
 #include <userver/logging/log.hpp>
 #include <userver/tracing/span.hpp>
+#include <userver/utils/assert.hpp>
+#include <userver/utils/async.hpp>
 #include <userver/utils/statistics/writer.hpp>
 #include <userver/ydb/impl/cast.hpp>
 
@@ -10,6 +15,7 @@
 #include <ydb/impl/driver.hpp>
 #include <ydb/impl/future.hpp>
 #include <ydb/impl/operation_settings.hpp>
+#include <ydb/impl/parallel_read_table.hpp>
 #include <ydb/impl/request_context.hpp>
 #include <ydb/impl/stats.hpp>
 
@@ -134,6 +140,73 @@ ReadTableResults TableClient::ReadTable(
       impl::GetFutureValueChecked(std::move(future), "ReadTable", context)};
 }
 
+ParallelReadTableResults TableClient::ReadTableParallel(
+    std::string_view table, NYdb::NTable::TReadTableSettings read_settings,
+    ParallelReadTableSettings parallel_settings, OperationSettings settings) {
+  if (read_settings.From_ || read_settings.To_) {
+    throw BaseError(
+        "ReadTableParallel does not support key bounds in read settings");
+  }
+
+  using DescribeSettings = NYdb::NTable::TDescribeTableSettings;
+  const auto description = ExecuteWithPathImpl<DescribeSettings>(
+      table, "DescribeTable", OperationSettings{settings},
+      [](NYdb::NTable::TSession session, const std::string& full_path,
+         const DescribeSettings& describe_settings) {
+        auto settings_copy = describe_settings;
+        settings_copy.WithKeyShardBoundary(true);
+        return session.DescribeTable(impl::ToString(full_path), settings_copy);
+      });
+
+  struct KeyRanges final {
+    std::vector<NYdb::NTable::TReadTableSettings> read_settings;
+    std::atomic<std::size_t> next{0};
+  };
+  auto ranges = std::make_shared<KeyRanges>();
+  for (const auto& key_range :
+       description.GetTableDescription().GetKeyRanges()) {
+    auto& range_settings = ranges->read_settings.emplace_back(read_settings);
+    if (key_range.From()) range_settings.From(*key_range.From());
+    if (key_range.To()) range_settings.To(*key_range.To());
+  }
+  if (ranges->read_settings.empty()) {
+    ranges->read_settings.push_back(std::move(read_settings));
+  }
+
+  auto state = std::make_unique<impl::ParallelReadTableState>(
+      parallel_settings.max_prefetched_parts);
+  const auto readers_count = std::min(parallel_settings.max_parallel_ranges,
+                                      ranges->read_settings.size());
+  UINVARIANT(readers_count > 0, "max_parallel_ranges must be positive");
+  state->readers.reserve(readers_count);
+  for (std::size_t i = 0; i < readers_count; ++i) {
+    state->readers.push_back(utils::Async(
+        "ydb-read-table-range",
+        [this, ranges, table = std::string{table}, settings,
+         producer = state->queue->GetProducer()] {
+          const auto ranges_count = ranges->read_settings.size();
+          for (auto index = ranges->next++; index < ranges_count;
+               index = ranges->next++) {
+            try {
+              auto results = ReadTable(
+                  table, std::move(ranges->read_settings[index]), settings);
+              while (auto cursor = results.GetNextResult()) {
+                if (!producer.Push({std::move(cursor), {}})) return;
+              }
+            } catch (const std::exception& ex) {
+              LOG_WARNING() << "Failed to read a key range of table '" << table
+                            << "': " << ex;
+              [[maybe_unused]] const bool pushed =
+                  producer.Push({std::nullopt, std::current_exception()});
+              return;
+            }
+          }
+        }));
+  }
+
+  return ParallelReadTableResults{std::move(state)};
+}
+
 ScanQueryResults TableClient::ExecuteScanQuery(
     ScanQuerySettings&& scan_settings, OperationSettings settings,
     const Query& query, PreparedArgsBuilder&& builder) {
@@ -0,0 +1,260 @@
+#include <userver/ydb/topic_consumer.hpp>
+
+#include <algorithm>
+#include <cstdint>
+#include <unordered_map>
+#include <utility>
+
+#include <userver/engine/mutex.hpp>
+#include <userver/engine/semaphore.hpp>
+#include <userver/engine/sleep.hpp>
+#include <userver/engine/task/cancel.hpp>
+#include <userver/engine/task/task_with_result.hpp>
+#include <userver/logging/log.hpp>
+#include <userver/utils/assert.hpp>
+#include <userver/utils/async.hpp>
+#include <userver/utils/overloaded.hpp>
+#include <userver/utils/periodic_task.hpp>
+#include <userver/utils/scope_guard.hpp>
+#include <userver/ydb/topic.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace ydb {
+
+namespace {
+
+using NYdb::NTopic::TReadSessionEvent;
+
+using PartitionSessionId = std::uint64_t;
+
+template <typename Event>
+PartitionSessionId GetPartitionSessionId(const Event& event) {
+  return event.GetPartitionSession()->GetPartitionSessionId();
+}
+
+}  // namespace
+
+class TopicConsumer::Impl final {
+ public:
+  Impl(TopicClient& client,
+       NYdb::NTopic::TReadSessionSettings read_session_settings,
+       TopicConsumerSettings settings, engine::TaskProcessor& task_processor);
+
+  void Start(Callback callback);
+  void Stop() noexcept;
+
+ private:
+  void Run();
+  void RunSession();
+  /// Returns false if the session is closed
+  bool HandleEvent(TReadSessionEvent::TEvent& event);
+
+  template <typename Func>
+  void EnqueueForPartition(PartitionSessionId id, Func&& func);
+
+  void ProcessBatch(TReadSessionEvent::TDataReceivedEvent& batch);
+  void AddCommit(TReadSessionEvent::TDataReceivedEvent& batch);
+  void FlushCommits();
+
+  TopicClient& client_;
+  const NYdb::NTopic::TReadSessionSettings read_session_settings_;
+  const TopicConsumerSettings settings_;
+  engine::TaskProcessor& task_processor_;
+  Callback callback_;
+
+  engine::Semaphore batches_in_flight_;
+
+  engine::Mutex commit_mutex_;
+  NYdb::NTopic::TDeferredCommit pending_commit_;
+  std::size_t pending_commit_messages_{0};
+
+  utils::PeriodicTask commit_task_;
+  engine::TaskWithResult<void> read_task_;
+
+  // Used by the read task only. Holds the last processing task of each
+  // partition session, every next task waits for the previous one
+  std::unordered_map<PartitionSessionId, engine::TaskWithResult<void>>
+      partition_tasks_;
+};
+
+TopicConsumer::Impl::Impl(
+    TopicClient& client,
+    NYdb::NTopic::TReadSessionSettings read_session_settings,
+    TopicConsumerSettings settings, engine::TaskProcessor& task_processor)
+    : client_(client),
+      read_session_settings_(std::move(read_session_settings)),
+      settings_(std::move(settings)),
+      task_processor_(task_processor),
+      batches_in_flight_(
+          std::max<std::size_t>(settings_.max_batches_in_flight, 1)) {
+  UINVARIANT(settings_.max_events_per_read > 0,
+             "max_events_per_read must be positive");
+}
+
+void TopicConsumer::Impl::Start(Callback callback) {
+  UINVARIANT(!read_task_.IsValid(), "Topic consumer already started");
+  callback_ = std::move(callback);
+
+  utils::PeriodicTask::Settings commit_settings{settings_.commit_interval};
+  commit_settings.task_processor = &task_processor_;
+  commit_task_.Start("ydb-topic-consumer-commit", commit_settings,
+                     [this] { FlushCommits(); });
+
+  read_task_ = utils::CriticalAsync(task_processor_, "ydb-topic-consumer",
+                                    [this] { Run(); });
+}
+
+void TopicConsumer::Impl::Stop() noexcept {
+  if (!read_task_.IsValid()) return;
+
+  read_task_.SyncCancel();
+  read_task_ = {};
+  commit_task_.Stop();
+  LOG_INFO() << "Stopped ydb topic consumer";
+}
+
+void TopicConsumer::Impl::Run() {
+  while (!engine::current_task::ShouldCancel()) {
+    try {
+      RunSession();
+    } catch (const std::exception& e) {
+      if (engine::current_task::ShouldCancel()) break;
+      LOG_ERROR() << "Failed to read ydb topic: " << e;
+    }
+    engine::InterruptibleSleepFor(settings_.error_retry_delay);
+  }
+}
+
+void TopicConsumer::Impl::RunSession() {
+  auto session = client_.CreateReadSession(read_session_settings_);
+
+  const utils::ScopeGuard cleanup{[this, &session] {
+    // Cancels the batches in flight, their offsets are not committed
+    partition_tasks_.clear();
+    FlushCommits();
+    session.Close(std::chrono::milliseconds{0});
+  }};
+
+  while (!engine::current_task::ShouldCancel()) {
+    auto events = session.GetEvents(settings_.max_events_per_read);
+    for (auto& event : events) {
+      if (!HandleEvent(event)) return;
+    }
+  }
+}
+
+bool TopicConsumer::Impl::HandleEvent(TReadSessionEvent::TEvent& event) {
+  return std::visit(
+      utils::Overloaded{
+          [this](TReadSessionEvent::TDataReceivedEvent& e) {
+            const auto id = GetPartitionSessionId(e);
+            EnqueueForPartition(id, [this, batch = std::move(e)]() mutable {
+              ProcessBatch(batch);
+            });
+            return true;
+          },
+          [](TReadSessionEvent::TStartPartitionSessionEvent& e) {
+            e.Confirm();
+            return true;
+          },
+          [this](TReadSessionEvent::TStopPartitionSessionEvent& e) {
+            // Confirm only after the batches read so far are processed and
+            // committed
+            const auto id = GetPartitionSessionId(e);
+            EnqueueForPartition(id, [this, stop = std::move(e)]() mutable {
+              FlushCommits();
+              stop.Confirm();
+            });
+            return true;
+          },
+          [this](TReadSessionEvent::TPartitionSessionClosedEvent& e) {
+            partition_tasks_.erase(GetPartitionSessionId(e));
+            return true;
+          },
+          [](NYdb::NTopic::TSessionClosedEvent& e) {
+            LOG_WARNING() << "ydb topic read session closed: "
+                          << e.DebugString();
+            return false;
+          },
+          [](auto&) { return true; }},
+      event);
+}
+
+template <typename Func>
+void TopicConsumer::Impl::EnqueueForPartition(PartitionSessionId id,
+                                              Func&& func) {
+  // Backpressure: do not read until a processing slot is free
+  engine::SemaphoreLock lock{batches_in_flight_};
+
+  auto& last_task = partition_tasks_[id];
+  last_task = utils::Async(
+      task_processor_, "ydb-topic-partition-processing",
+      [previous = std::move(last_task), lock = std::move(lock),
+       func = std::forward<Func>(func)]() mutable {
+        if (previous.IsValid()) previous.Wait();
+        if (engine::current_task::ShouldCancel()) return;
+        func();
+      });
+}
+
+void TopicConsumer::Impl::ProcessBatch(
+    TReadSessionEvent::TDataReceivedEvent& batch) {
+  while (true) {
+    try {
+      callback_(batch);
+      break;
+    } catch (const std::exception& e) {
+      if (engine::current_task::ShouldCancel()) return;
+      LOG_ERROR() << "Processing of " << batch.GetMessagesCount()
+                  << " messages of ydb topic partition failed, retrying: "
+                  << e;
+    }
+    engine::InterruptibleSleepFor(settings_.error_retry_delay);
+    if (engine::current_task::ShouldCancel()) return;
+  }
+
+  AddCommit(batch);
+}
+
+void TopicConsumer::Impl::AddCommit(
+    TReadSessionEvent::TDataReceivedEvent& batch) {
+  {
+    const std::lock_guard lock{commit_mutex_};
+    pending_commit_.Add(batch);
+    pending_commit_messages_ += batch.GetMessagesCount();
+    if (pending_commit_messages_ < settings_.commit_batch_size) return;
+  }
+  FlushCommits();
+}
+
+void TopicConsumer::Impl::FlushCommits() {
+  NYdb::NTopic::TDeferredCommit commit;
+  {
+    const std::lock_guard lock{commit_mutex_};
+    if (pending_commit_messages_ == 0) return;
+    std::swap(commit, pending_commit_);
+    pending_commit_messages_ = 0;
+  }
+  // Only sends the request, does not wait for the acknowledgement
+  commit.Commit();
+}
+
+TopicConsumer::TopicConsumer(
+    TopicClient& client,
+    NYdb::NTopic::TReadSessionSettings read_session_settings,
+    TopicConsumerSettings settings, engine::TaskProcessor& task_processor)
+    : impl_(std::make_unique<Impl>(client, std::move(read_session_settings),
+                                   std::move(settings), task_processor)) {}
+
+TopicConsumer::~TopicConsumer() { Stop(); }
+
+void TopicConsumer::Start(Callback callback) {
+  impl_->Start(std::move(callback));
+}
+
+void TopicConsumer::Stop() noexcept { impl_->Stop(); }
+
+}  // namespace ydb
+
+USERVER_NAMESPACE_END
@@ -1,4 +1,6 @@
+#include <algorithm>
 #include <chrono>
+#include <iterator>
 #include <thread>
 
 #include <userver/utest/utest.hpp>
@@ -386,6 +388,35 @@ UTEST_F(YdbExecute, ReadTable) {
   EXPECT_FALSE(results.GetNextResult().has_value());
 }
 
+UTEST_F(YdbExecute, ReadTableParallel) {
+  CreateTable("read_table", true);
+
+  auto settings = NYdb::NTable::TReadTableSettings{}
+                      .AppendColumns("key")
+                      .AppendColumns("value_str")
+                      .AppendColumns("value_int");
+  auto results = GetTableClient().ReadTableParallel(
+      "read_table", std::move(settings),
+      ydb::ParallelReadTableSettings{/*max_parallel_ranges=*/2,
+                                     /*max_prefetched_parts=*/1});
+
+  std::vector<tests::RowValue> rows;
+  while (auto cursor = results.GetNextResult()) {
+    auto part = std::move(*cursor).AsContainer<std::vector<tests::RowValue>>();
+    rows.insert(rows.end(), std::make_move_iterator(part.begin()),
+                std::make_move_iterator(part.end()));
+  }
+
+  std::sort(rows.begin(), rows.end(),
+            [](const auto& lhs, const auto& rhs) { return lhs.key < rhs.key; });
+  ASSERT_EQ(rows.size(), kPreFilledRows.size());
+  for (std::size_t i = 0; i < rows.size(); ++i) {
+    EXPECT_EQ(rows[i].key, kPreFilledRows[i].key);
+    EXPECT_EQ(rows[i].value_str, kPreFilledRows[i].value_str);
+    EXPECT_EQ(rows[i].value_int, kPreFilledRows[i].value_int);
+  }
+}
+
 UTEST_F(YdbExecute, IsQueryFromCache) {
   CreateTable("test_table", true);
 
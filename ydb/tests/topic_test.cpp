@@ -1,8 +1,13 @@
 #include <userver/utest/utest.hpp>
 
+#include <atomic>
+
 #include <userver/engine/async.hpp>
+#include <userver/engine/single_consumer_event.hpp>
+#include <userver/engine/task/task.hpp>
 #include <userver/utils/overloaded.hpp>
 #include <userver/ydb/impl/cast.hpp>
+#include <userver/ydb/topic_consumer.hpp>
 
 #include "test_utils.hpp"
 
@@ -149,6 +154,43 @@ UTEST_F(YdbTopicFixture, TopicReadSessionGetEvents) {
   DropConsumer(kTopicPath, kConsumerName);
 }
 
+UTEST_F(YdbTopicFixture, TopicConsumer) {
+  AddConsumer(kTopicPath, kConsumerName);
+
+  NYdb::NTopic::TReadSessionSettings read_session_settings;
+  read_session_settings.AppendTopics(ydb::impl::ToString(kTopicPath));
+  read_session_settings.ConsumerName(ydb::impl::ToString(kConsumerName));
+
+  ydb::TopicConsumerSettings settings;
+  settings.commit_interval = std::chrono::milliseconds{10};
+
+  std::atomic<std::size_t> messages_received{0};
+  engine::SingleConsumerEvent received_event;
+  {
+    ydb::TopicConsumer consumer{GetTopicClient(), read_session_settings,
+                                settings,
+                                engine::current_task::GetTaskProcessor()};
+    consumer.Start(
+        [&](NYdb::NTopic::TReadSessionEvent::TDataReceivedEvent& batch) {
+          messages_received += batch.GetMessagesCount();
+          if (messages_received >= 2) received_event.Send();
+        });
+
+    GetTableClient().ExecuteDataQuery(fmt::format(R"-(
+        INSERT INTO {} (key, value)
+        VALUES
+          (123, "qwe"),
+          (321, "xyz");
+      )-",
+                                                  kTable));
+
+    ASSERT_TRUE(received_event.WaitForEventFor(utest::kMaxTestWaitTime));
+  }
+  EXPECT_EQ(messages_received, 2);
+
+  DropConsumer(kTopicPath, kConsumerName);
+}
+
 UTEST_F(YdbTopicFixture, AlterTopic) {
   constexpr std::string_view consumer_name = "another_test_consumer";
 